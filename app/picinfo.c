@@ -10,19 +10,21 @@
 void usage(void)
 {
     printf("\tUsage:\n");
-    printf("\t picinfo [options h|s] image_file\n");
-    printf("\t options = help | skip_decode\n");
+    printf("\t picinfo [options h|s|t] image_file\n");
+    printf("\t options = help | skip_decode | thumbnail\n");
 }
 
 int main(int argc, char *argv[])
 {
     int ch;
     int skip_flag = 0;
+    int thumbnail = 0;
     struct option options[] = {{"help", no_argument, NULL, 'h'},
                                {"skip_decode", no_argument, &skip_flag, 1},
+                               {"thumbnail", no_argument, &thumbnail, 1},
                                {0, 0, 0, 0}};
     int option_index = 0;
-    while ((ch = getopt_long(argc, argv, "hs", options, &option_index)) !=-1) {
+    while ((ch = getopt_long(argc, argv, "hst", options, &option_index)) !=-1) {
         switch (ch) {
             case 'h':
                 usage();
@@ -30,6 +32,12 @@ int main(int argc, char *argv[])
             case 's':
                 skip_flag = 1;
                 break;
+            case 't':
+                thumbnail = 1;
+                break;
+            case 0:
+                // a long option which sets its flag
+                break;
             default:
                 usage();
                 return 0;
@@ -58,7 +66,8 @@ int main(int argc, char *argv[])
         printf("file format is not supported\n");
         goto exit;
     }
-    struct pic *p = file_load(ops, filename, skip_flag);
+    struct pic *p = thumbnail ? file_load_thumbnail(ops, filename)
+                              : file_load(ops, filename, skip_flag);
     if (!p) {
         //for GIF, the info will be stored in the last frame
         p = file_dequeue_pic();
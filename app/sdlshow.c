@@ -46,7 +46,7 @@ display_main(void *arg)
     //     goto quit;
     // }
 
-    while ((p = file_dequeue_pic())) {
+    while ((p = file_wait_pic(-1))) {
 
         int left, top;
         top = p->top;
@@ -56,7 +56,6 @@ display_main(void *arg)
             left = left ? left : 480 / 2 - p->width / 2;
         }
         pic_poll_block(true);
-        SDL_Delay(10);
         display_show(d, p->pixels, left, top, p->width, p->height, p->depth,
                     p->pitch, p->format);
         if (ret) {
@@ -139,9 +138,9 @@ main(int argc, const char *argv[])
         printf("fail to draw\n");
         goto quit;
     }
-    while ((p = file_dequeue_pic())) {
+    // sleeps until the next pic and ends after the last one of the file
+    while ((p = file_wait_pic(-1))) {
         pic_poll_block(true);
-        SDL_Delay(10);
         display_show(d, p->pixels, left, top, p->width, p->height, p->depth,
                      p->pitch, p->format);
         if (ret) {
@@ -17,9 +17,19 @@ enum simd_type {
     GPU_TYPE_VULKAN = 26,
 };
 
+/* HEVC inverse transforms, see hevc_idct_4x4_c() and the others in idct.h
+ * for what they do. Any of them may be NULL.
+ */
+typedef void (*accl_hevc_itrans)(int16_t *coeffs, int bitdepth, int w, int h);
+
 struct accl_ops {
     void (*idct_4x4)(int16_t *in, int bitdepth);
     void (*idct_8x8)(int16_t *in, int bitdepth);
+    accl_hevc_itrans hevc_idst_4x4;
+    accl_hevc_itrans hevc_idct_4x4;
+    accl_hevc_itrans hevc_idct_8x8;
+    accl_hevc_itrans hevc_idct_16x16;
+    accl_hevc_itrans hevc_idct_32x32;
     enum simd_type type;
     TAILQ_ENTRY(accl_ops) next;
 };
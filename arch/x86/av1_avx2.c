@@ -0,0 +1,234 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "x86.h"
+#include "av1dsp.h"
+#include "utils.h"
+
+#ifdef __AVX2__
+
+/* The same as the SSE4.1 versions with eight lanes or samples per vector,
+ * narrow blocks and four lane tails go to those.
+ */
+#define ITX_RANGE_32 18
+
+static inline __m256i
+clamp32(__m256i v, __m256i lo, __m256i hi)
+{
+    return _mm256_min_epi32(_mm256_max_epi32(v, lo), hi);
+}
+
+// Round2(c0 * a + c1 * b, 12)
+static inline __m256i
+rotate(__m256i a, __m256i b, __m256i c0, __m256i c1)
+{
+    const __m256i rnd = _mm256_set1_epi32(2048);
+    __m256i v = _mm256_add_epi32(_mm256_mullo_epi32(a, c0),
+                                 _mm256_mullo_epi32(b, c1));
+    return _mm256_srai_epi32(_mm256_add_epi32(v, rnd), 12);
+}
+
+static inline void
+itx_prog_lanes(int32_t *buf, int stride, int nv,
+               const struct av1_itx_prog *p, __m256i lo, __m256i hi)
+{
+    __m256i T[64][2];
+    for (int i = 0; i < p->n; i++) {
+        for (int k = 0; k < nv; k++) {
+            T[i][k] = _mm256_loadu_si256((const __m256i *)(buf + p->in[i] * stride) + k);
+        }
+    }
+    for (int n = 0; n < p->nops; n++) {
+        const struct av1_btf *op = &p->ops[n];
+        __m256i *a = T[op->a], *b = T[op->b];
+        if (op->add) {
+            for (int k = 0; k < nv; k++) {
+                __m256i s = _mm256_add_epi32(a[k], b[k]);
+                __m256i d = _mm256_sub_epi32(a[k], b[k]);
+                a[k] = clamp32(s, lo, hi);
+                b[k] = clamp32(d, lo, hi);
+            }
+        } else {
+            const __m256i c0 = _mm256_set1_epi32(op->c[0]);
+            const __m256i c1 = _mm256_set1_epi32(op->c[1]);
+            const __m256i c2 = _mm256_set1_epi32(op->c[2]);
+            const __m256i c3 = _mm256_set1_epi32(op->c[3]);
+            for (int k = 0; k < nv; k++) {
+                __m256i x = a[k], y = b[k];
+                a[k] = rotate(x, y, c0, c1);
+                b[k] = rotate(x, y, c2, c3);
+            }
+        }
+    }
+    for (int i = 0; i < p->n; i++) {
+        const __m256i *t = T[p->out[i]];
+        for (int k = 0; k < nv; k++) {
+            __m256i v = p->neg[i] ? _mm256_sub_epi32(_mm256_setzero_si256(), t[k]) : t[k];
+            _mm256_storeu_si256((__m256i *)(buf + i * stride) + k, v);
+        }
+    }
+}
+
+static void
+itx_prog_avx2(int32_t *buf, int stride, int lanes,
+              const struct av1_itx_prog *p, int range)
+{
+    if (range > ITX_RANGE_32) {
+        av1_itx_prog_c(buf, stride, lanes, p, range);
+        return;
+    }
+    const __m256i hi = _mm256_set1_epi32((1 << (range - 1)) - 1);
+    const __m256i lo = _mm256_set1_epi32(-(1 << (range - 1)));
+    int l = 0;
+    for (; l + 16 <= lanes; l += 16) {
+        itx_prog_lanes(buf + l, stride, 2, p, lo, hi);
+    }
+    if (l + 8 <= lanes) {
+        itx_prog_lanes(buf + l, stride, 1, p, lo, hi);
+        l += 8;
+    }
+    if (l < lanes) {
+        x86_av1_itx_prog_sse4(buf + l, stride, lanes - l, p, range);
+    }
+}
+
+static void
+itx_identity_avx2(int32_t *buf, int stride, int lanes, int n)
+{
+    if (lanes & 7) {
+        x86_av1_itx_identity_sse4(buf, stride, lanes, n);
+        return;
+    }
+    const __m256i rnd = _mm256_set1_epi32(2048);
+    const __m256i f = _mm256_set1_epi32(n == 4 ? 1697 : 3394);
+    for (int i = 0; i < n; i++) {
+        __m256i *b = (__m256i *)(buf + i * stride);
+        for (int l = 0; l < lanes; l += 8, b++) {
+            __m256i x = _mm256_loadu_si256(b), y;
+            if (n == 4 || n == 16) {
+                y = _mm256_srai_epi32(_mm256_add_epi32(_mm256_mullo_epi32(x, f), rnd), 12);
+                y = _mm256_add_epi32(y, n == 4 ? x : _mm256_slli_epi32(x, 1));
+            } else {
+                y = _mm256_slli_epi32(x, n == 8 ? 1 : 2);
+            }
+            _mm256_storeu_si256(b, y);
+        }
+    }
+}
+
+static inline __m256i
+paeth(__m256i a, __m256i l, __m256i tl)
+{
+    __m256i pl = _mm256_abs_epi16(_mm256_sub_epi16(a, tl));
+    __m256i pt = _mm256_abs_epi16(_mm256_sub_epi16(l, tl));
+    __m256i ptl = _mm256_abs_epi16(_mm256_sub_epi16(_mm256_add_epi16(a, l),
+                                                    _mm256_add_epi16(tl, tl)));
+    __m256i use_l = _mm256_and_si256(
+        _mm256_cmpeq_epi16(_mm256_min_epi16(pl, pt), pl),
+        _mm256_cmpeq_epi16(_mm256_min_epi16(pl, ptl), pl));
+    __m256i use_a = _mm256_cmpeq_epi16(_mm256_min_epi16(pt, ptl), pt);
+    __m256i v = _mm256_blendv_epi8(tl, a, use_a);
+    return _mm256_blendv_epi8(v, l, use_l);
+}
+
+static void
+intra_paeth_avx2(uint16_t *dst, int stride, const uint16_t *above,
+                 const uint16_t *left, int w, int h)
+{
+    if (w < 16) {
+        x86_av1_intra_paeth_sse4(dst, stride, above, left, w, h);
+        return;
+    }
+    const __m256i tl = _mm256_set1_epi16(above[-1]);
+    for (int i = 0; i < h; i++, dst += stride) {
+        const __m256i l = _mm256_set1_epi16(left[i]);
+        for (int j = 0; j < w; j += 16) {
+            __m256i a = _mm256_loadu_si256((const __m256i *)(above + j));
+            _mm256_storeu_si256((__m256i *)(dst + j), paeth(a, l, tl));
+        }
+    }
+}
+
+// eight weights w as (w, 256 - w) pairs
+static inline __m256i
+weight_pairs(const uint8_t *wt)
+{
+    __m256i v = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)wt));
+    return _mm256_or_si256(v, _mm256_slli_epi32(
+                                  _mm256_sub_epi32(_mm256_set1_epi32(256), v), 16));
+}
+
+// eight samples at p paired with a broadcast sample s
+static inline __m256i
+sample_pairs(const uint16_t *p, int s)
+{
+    __m256i v = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)p));
+    return _mm256_or_si256(v, _mm256_set1_epi32(s << 16));
+}
+
+static inline void
+store8(uint16_t *p, __m256i v)
+{
+    v = _mm256_packus_epi32(v, v);
+    v = _mm256_permute4x64_epi64(v, 0x08);
+    _mm_storeu_si128((__m128i *)p, _mm256_castsi256_si128(v));
+}
+
+static void
+intra_smooth_avx2(uint16_t *dst, int stride, const uint16_t *above,
+                  const uint16_t *left, int w, int h)
+{
+    if (w < 8) {
+        x86_av1_intra_smooth_sse4(dst, stride, above, left, w, h);
+        return;
+    }
+    const uint8_t *wx = av1_sm_weights[__builtin_ctz(w)];
+    const uint8_t *wy = av1_sm_weights[__builtin_ctz(h)];
+    const __m256i rnd = _mm256_set1_epi32(256);
+    for (int i = 0; i < h; i++, dst += stride) {
+        const __m256i wyi = _mm256_set1_epi32(wy[i] | (256 - wy[i]) << 16);
+        const __m256i l = _mm256_set1_epi32(left[i] | above[w - 1] << 16);
+        for (int j = 0; j < w; j += 8) {
+            __m256i v = _mm256_madd_epi16(sample_pairs(above + j, left[h - 1]), wyi);
+            __m256i hz = _mm256_madd_epi16(l, weight_pairs(wx + j));
+            v = _mm256_add_epi32(_mm256_add_epi32(v, hz), rnd);
+            store8(dst + j, _mm256_srai_epi32(v, 9));
+        }
+    }
+}
+
+static void
+cfl_pred_avx2(uint16_t *dst, int stride, const int16_t *ac, int w, int h,
+              int alpha, int bitdepth)
+{
+    if (w < 8) {
+        x86_av1_cfl_pred_sse4(dst, stride, ac, w, h, alpha, bitdepth);
+        return;
+    }
+    const __m256i a = _mm256_set1_epi32(alpha);
+    const __m256i rnd = _mm256_set1_epi32(32);
+    const __m256i maxv = _mm256_set1_epi32((1 << bitdepth) - 1);
+    for (int i = 0; i < h; i++, dst += stride, ac += w) {
+        for (int j = 0; j < w; j += 8) {
+            __m256i v = _mm256_mullo_epi32(
+                _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(ac + j))), a);
+            __m256i s = _mm256_srai_epi32(_mm256_add_epi32(_mm256_abs_epi32(v), rnd), 6);
+            __m256i d = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(dst + j)));
+            s = _mm256_add_epi32(_mm256_sign_epi32(s, v), d);
+            s = _mm256_min_epi32(_mm256_max_epi32(s, _mm256_setzero_si256()), maxv);
+            store8(dst + j, s);
+        }
+    }
+}
+
+void
+x86_av1_dsp_init_avx2(struct av1_dsp *dsp)
+{
+    dsp->itx_prog = itx_prog_avx2;
+    dsp->itx_identity = itx_identity_avx2;
+    dsp->intra_paeth = intra_paeth_avx2;
+    dsp->intra_smooth = intra_smooth_avx2;
+    dsp->cfl_pred = cfl_pred_avx2;
+}
+
+#endif
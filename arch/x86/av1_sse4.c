@@ -0,0 +1,373 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "x86.h"
+#include "av1dsp.h"
+#include "utils.h"
+
+#ifdef __SSE4_1__
+
+/* The transforms take four lanes of 32 bits per vector. Conformant streams
+ * keep every intermediate value of a pass in its range, so with a range of
+ * up to 18 bits (8 and 10 bit samples, and the columns of 12 bit ones) the
+ * products of a rotation and their sum fit in 32 bits. The rows of 12 bit
+ * samples take the C version.
+ */
+#define ITX_RANGE_32 18
+
+static inline __m128i
+clamp32(__m128i v, __m128i lo, __m128i hi)
+{
+    return _mm_min_epi32(_mm_max_epi32(v, lo), hi);
+}
+
+// Round2(c0 * a + c1 * b, 12)
+static inline __m128i
+rotate(__m128i a, __m128i b, __m128i c0, __m128i c1)
+{
+    const __m128i rnd = _mm_set1_epi32(2048);
+    __m128i v = _mm_add_epi32(_mm_mullo_epi32(a, c0), _mm_mullo_epi32(b, c1));
+    return _mm_srai_epi32(_mm_add_epi32(v, rnd), 12);
+}
+
+// nv vectors of four lanes at once, so one decoded op serves all of them
+static inline void
+itx_prog_lanes(int32_t *buf, int stride, int nv,
+               const struct av1_itx_prog *p, __m128i lo, __m128i hi)
+{
+    __m128i T[64][2];
+    for (int i = 0; i < p->n; i++) {
+        for (int k = 0; k < nv; k++) {
+            T[i][k] = _mm_loadu_si128((const __m128i *)(buf + p->in[i] * stride) + k);
+        }
+    }
+    for (int n = 0; n < p->nops; n++) {
+        const struct av1_btf *op = &p->ops[n];
+        __m128i *a = T[op->a], *b = T[op->b];
+        if (op->add) {
+            for (int k = 0; k < nv; k++) {
+                __m128i s = _mm_add_epi32(a[k], b[k]);
+                __m128i d = _mm_sub_epi32(a[k], b[k]);
+                a[k] = clamp32(s, lo, hi);
+                b[k] = clamp32(d, lo, hi);
+            }
+        } else {
+            const __m128i c0 = _mm_set1_epi32(op->c[0]);
+            const __m128i c1 = _mm_set1_epi32(op->c[1]);
+            const __m128i c2 = _mm_set1_epi32(op->c[2]);
+            const __m128i c3 = _mm_set1_epi32(op->c[3]);
+            for (int k = 0; k < nv; k++) {
+                __m128i x = a[k], y = b[k];
+                a[k] = rotate(x, y, c0, c1);
+                b[k] = rotate(x, y, c2, c3);
+            }
+        }
+    }
+    for (int i = 0; i < p->n; i++) {
+        const __m128i *t = T[p->out[i]];
+        for (int k = 0; k < nv; k++) {
+            __m128i v = p->neg[i] ? _mm_sub_epi32(_mm_setzero_si128(), t[k]) : t[k];
+            _mm_storeu_si128((__m128i *)(buf + i * stride) + k, v);
+        }
+    }
+}
+
+void
+x86_av1_itx_prog_sse4(int32_t *buf, int stride, int lanes,
+                      const struct av1_itx_prog *p, int range)
+{
+    if (range > ITX_RANGE_32) {
+        av1_itx_prog_c(buf, stride, lanes, p, range);
+        return;
+    }
+    const __m128i hi = _mm_set1_epi32((1 << (range - 1)) - 1);
+    const __m128i lo = _mm_set1_epi32(-(1 << (range - 1)));
+    int l = 0;
+    for (; l + 8 <= lanes; l += 8) {
+        itx_prog_lanes(buf + l, stride, 2, p, lo, hi);
+    }
+    if (l < lanes) {
+        itx_prog_lanes(buf + l, stride, 1, p, lo, hi);
+    }
+}
+
+/* The inputs of the 4 point ADST are as wide as the pass, a lane group with
+ * any of them past 17 bits goes to the C version.
+ */
+void
+x86_av1_itx_adst4_sse4(int32_t *buf, int stride, int lanes, int n)
+{
+    const __m128i s1 = _mm_set1_epi32(1321), s2 = _mm_set1_epi32(2482);
+    const __m128i s3 = _mm_set1_epi32(3344), s4 = _mm_set1_epi32(3803);
+    const __m128i rnd = _mm_set1_epi32(2048);
+    const __m128i big = _mm_set1_epi32(1 << 17);
+    for (int l = 0; l < lanes; l += 4) {
+        __m128i *b0 = (__m128i *)(buf + l), *b1 = (__m128i *)(buf + stride + l);
+        __m128i *b2 = (__m128i *)(buf + 2 * stride + l);
+        __m128i *b3 = (__m128i *)(buf + 3 * stride + l);
+        __m128i x0 = _mm_loadu_si128(b0), x1 = _mm_loadu_si128(b1);
+        __m128i x2 = _mm_loadu_si128(b2), x3 = _mm_loadu_si128(b3);
+        __m128i m = _mm_max_epi32(_mm_max_epi32(_mm_abs_epi32(x0), _mm_abs_epi32(x1)),
+                                  _mm_max_epi32(_mm_abs_epi32(x2), _mm_abs_epi32(x3)));
+        if (!_mm_testz_si128(_mm_cmpgt_epi32(m, big), _mm_set1_epi32(-1))) {
+            av1_itx_adst4_c(buf + l, stride, 4, n);
+            continue;
+        }
+        __m128i s0 = _mm_add_epi32(_mm_mullo_epi32(s1, x0), _mm_mullo_epi32(s4, x2));
+        __m128i t1 = _mm_sub_epi32(_mm_mullo_epi32(s2, x0), _mm_mullo_epi32(s1, x2));
+        __m128i t3 = _mm_mullo_epi32(s3, x1);
+        __m128i t2 = _mm_mullo_epi32(s3, _mm_add_epi32(_mm_sub_epi32(x0, x2), x3));
+        s0 = _mm_add_epi32(s0, _mm_mullo_epi32(s2, x3));
+        t1 = _mm_sub_epi32(t1, _mm_mullo_epi32(s4, x3));
+        __m128i y0 = _mm_add_epi32(s0, t3);
+        __m128i y1 = _mm_add_epi32(t1, t3);
+        __m128i y3 = _mm_sub_epi32(_mm_add_epi32(s0, t1), t3);
+        _mm_storeu_si128(b0, _mm_srai_epi32(_mm_add_epi32(y0, rnd), 12));
+        _mm_storeu_si128(b1, _mm_srai_epi32(_mm_add_epi32(y1, rnd), 12));
+        _mm_storeu_si128(b2, _mm_srai_epi32(_mm_add_epi32(t2, rnd), 12));
+        _mm_storeu_si128(b3, _mm_srai_epi32(_mm_add_epi32(y3, rnd), 12));
+    }
+}
+
+/* Round2(x * 5793, 12) is x + Round2(x * 1697, 12) and Round2(x * 11586, 12)
+ * is 2 * x + Round2(x * 3394, 12), which keeps the products in 32 bits for
+ * the 20 bit range of any pass.
+ */
+void
+x86_av1_itx_identity_sse4(int32_t *buf, int stride, int lanes, int n)
+{
+    const __m128i rnd = _mm_set1_epi32(2048);
+    const __m128i f = _mm_set1_epi32(n == 4 ? 1697 : 3394);
+    for (int i = 0; i < n; i++) {
+        __m128i *b = (__m128i *)(buf + i * stride);
+        for (int l = 0; l < lanes; l += 4, b++) {
+            __m128i x = _mm_loadu_si128(b), y;
+            if (n == 4 || n == 16) {
+                y = _mm_srai_epi32(_mm_add_epi32(_mm_mullo_epi32(x, f), rnd), 12);
+                y = _mm_add_epi32(y, n == 4 ? x : _mm_slli_epi32(x, 1));
+            } else {
+                y = _mm_slli_epi32(x, n == 8 ? 1 : 2);
+            }
+            _mm_storeu_si128(b, y);
+        }
+    }
+}
+
+static inline __m128i
+load4(const uint16_t *p)
+{
+    return _mm_loadl_epi64((const __m128i *)p);
+}
+
+static inline void
+store4(uint16_t *p, __m128i v)
+{
+    _mm_storel_epi64((__m128i *)p, v);
+}
+
+// the sum of n samples, n a multiple of 4
+static inline int
+sum16(const uint16_t *p, int n)
+{
+    __m128i s = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi16(1);
+    int k = 0;
+    for (; k + 8 <= n; k += 8) {
+        s = _mm_add_epi32(s, _mm_madd_epi16(_mm_loadu_si128((const __m128i *)(p + k)), one));
+    }
+    if (k < n) {
+        s = _mm_add_epi32(s, _mm_madd_epi16(load4(p + k), one));
+    }
+    s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0x4E));
+    s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0xB1));
+    return _mm_cvtsi128_si32(s);
+}
+
+static inline void
+fill(uint16_t *dst, int stride, int w, int h, __m128i v)
+{
+    for (int i = 0; i < h; i++, dst += stride) {
+        if (w == 4) {
+            store4(dst, v);
+            continue;
+        }
+        for (int j = 0; j < w; j += 8) {
+            _mm_storeu_si128((__m128i *)(dst + j), v);
+        }
+    }
+}
+
+static void
+intra_dc_sse4(uint16_t *dst, int stride, const uint16_t *above,
+              const uint16_t *left, int w, int h, int have_above,
+              int have_left, int bitdepth)
+{
+    int avg;
+    if (have_above && have_left) {
+        avg = (sum16(above, w) + sum16(left, h) + ((w + h) >> 1)) / (w + h);
+    } else if (have_left) {
+        avg = (sum16(left, h) + (h >> 1)) >> __builtin_ctz(h);
+    } else if (have_above) {
+        avg = (sum16(above, w) + (w >> 1)) >> __builtin_ctz(w);
+    } else {
+        avg = 1 << (bitdepth - 1);
+    }
+    fill(dst, stride, w, h, _mm_set1_epi16(avg));
+}
+
+static void
+intra_h_sse4(uint16_t *dst, int stride, const uint16_t *above UNUSED,
+             const uint16_t *left, int w, int h)
+{
+    for (int i = 0; i < h; i++) {
+        fill(dst + i * stride, stride, w, 1, _mm_set1_epi16(left[i]));
+    }
+}
+
+// four or eight samples of PAETH_PRED, all differences fit in 16 bits
+static inline __m128i
+paeth(__m128i a, __m128i l, __m128i tl)
+{
+    __m128i pl = _mm_abs_epi16(_mm_sub_epi16(a, tl));
+    __m128i pt = _mm_abs_epi16(_mm_sub_epi16(l, tl));
+    __m128i ptl = _mm_abs_epi16(_mm_sub_epi16(_mm_add_epi16(a, l),
+                                              _mm_add_epi16(tl, tl)));
+    __m128i use_l = _mm_and_si128(_mm_cmpeq_epi16(_mm_min_epi16(pl, pt), pl),
+                                  _mm_cmpeq_epi16(_mm_min_epi16(pl, ptl), pl));
+    __m128i use_a = _mm_cmpeq_epi16(_mm_min_epi16(pt, ptl), pt);
+    __m128i v = _mm_blendv_epi8(tl, a, use_a);
+    return _mm_blendv_epi8(v, l, use_l);
+}
+
+void
+x86_av1_intra_paeth_sse4(uint16_t *dst, int stride, const uint16_t *above,
+                         const uint16_t *left, int w, int h)
+{
+    const __m128i tl = _mm_set1_epi16(above[-1]);
+    for (int i = 0; i < h; i++, dst += stride) {
+        const __m128i l = _mm_set1_epi16(left[i]);
+        if (w == 4) {
+            store4(dst, paeth(load4(above), l, tl));
+            continue;
+        }
+        for (int j = 0; j < w; j += 8) {
+            __m128i a = _mm_loadu_si128((const __m128i *)(above + j));
+            _mm_storeu_si128((__m128i *)(dst + j), paeth(a, l, tl));
+        }
+    }
+}
+
+/* The smooth predictors pair each sample with its weight and take the sums
+ * with madd, samples and weights both fit in 16 bits.
+ */
+
+// four weights w as (w, 256 - w) pairs
+static inline __m128i
+weight_pairs(const uint8_t *wt)
+{
+    int32_t w4;
+    memcpy(&w4, wt, 4);
+    __m128i v = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(w4));
+    return _mm_or_si128(v, _mm_slli_epi32(_mm_sub_epi32(_mm_set1_epi32(256), v), 16));
+}
+
+// sample v of four lanes paired with a broadcast sample s
+static inline __m128i
+sample_pairs(__m128i v, int s)
+{
+    return _mm_unpacklo_epi16(v, _mm_set1_epi16(s));
+}
+
+void
+x86_av1_intra_smooth_sse4(uint16_t *dst, int stride, const uint16_t *above,
+                          const uint16_t *left, int w, int h)
+{
+    const uint8_t *wx = av1_sm_weights[__builtin_ctz(w)];
+    const uint8_t *wy = av1_sm_weights[__builtin_ctz(h)];
+    const __m128i rnd = _mm_set1_epi32(256);
+    for (int i = 0; i < h; i++, dst += stride) {
+        const __m128i wyi = _mm_set1_epi32(wy[i] | (256 - wy[i]) << 16);
+        for (int j = 0; j < w; j += 4) {
+            __m128i v = _mm_madd_epi16(sample_pairs(load4(above + j), left[h - 1]), wyi);
+            __m128i hz = _mm_madd_epi16(sample_pairs(_mm_set1_epi16(left[i]), above[w - 1]),
+                                        weight_pairs(wx + j));
+            v = _mm_srai_epi32(_mm_add_epi32(_mm_add_epi32(v, hz), rnd), 9);
+            store4(dst + j, _mm_packus_epi32(v, v));
+        }
+    }
+}
+
+static void
+intra_smooth_v_sse4(uint16_t *dst, int stride, const uint16_t *above,
+                    const uint16_t *left, int w, int h)
+{
+    const uint8_t *wy = av1_sm_weights[__builtin_ctz(h)];
+    const __m128i rnd = _mm_set1_epi32(128);
+    for (int i = 0; i < h; i++, dst += stride) {
+        const __m128i wyi = _mm_set1_epi32(wy[i] | (256 - wy[i]) << 16);
+        for (int j = 0; j < w; j += 4) {
+            __m128i v = _mm_madd_epi16(sample_pairs(load4(above + j), left[h - 1]), wyi);
+            v = _mm_srai_epi32(_mm_add_epi32(v, rnd), 8);
+            store4(dst + j, _mm_packus_epi32(v, v));
+        }
+    }
+}
+
+static void
+intra_smooth_h_sse4(uint16_t *dst, int stride, const uint16_t *above,
+                    const uint16_t *left, int w, int h)
+{
+    const uint8_t *wx = av1_sm_weights[__builtin_ctz(w)];
+    const __m128i rnd = _mm_set1_epi32(128);
+    for (int i = 0; i < h; i++, dst += stride) {
+        const __m128i l = sample_pairs(_mm_set1_epi16(left[i]), above[w - 1]);
+        for (int j = 0; j < w; j += 4) {
+            __m128i v = _mm_madd_epi16(l, weight_pairs(wx + j));
+            v = _mm_srai_epi32(_mm_add_epi32(v, rnd), 8);
+            store4(dst + j, _mm_packus_epi32(v, v));
+        }
+    }
+}
+
+// Round2Signed(alpha * ac, 6) added to four samples of the DC prediction
+static inline __m128i
+cfl4(__m128i dc, const int16_t *ac, __m128i alpha, __m128i maxv)
+{
+    const __m128i rnd = _mm_set1_epi32(32);
+    __m128i v = _mm_mullo_epi32(_mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *)ac)),
+                                alpha);
+    __m128i s = _mm_srai_epi32(_mm_add_epi32(_mm_abs_epi32(v), rnd), 6);
+    s = _mm_add_epi32(_mm_sign_epi32(s, v), _mm_cvtepu16_epi32(dc));
+    s = _mm_min_epi32(_mm_max_epi32(s, _mm_setzero_si128()), maxv);
+    return _mm_packus_epi32(s, s);
+}
+
+void
+x86_av1_cfl_pred_sse4(uint16_t *dst, int stride, const int16_t *ac, int w,
+                      int h, int alpha, int bitdepth)
+{
+    const __m128i a = _mm_set1_epi32(alpha);
+    const __m128i maxv = _mm_set1_epi32((1 << bitdepth) - 1);
+    for (int i = 0; i < h; i++, dst += stride, ac += w) {
+        for (int j = 0; j < w; j += 4) {
+            store4(dst + j, cfl4(load4(dst + j), ac + j, a, maxv));
+        }
+    }
+}
+
+void
+x86_av1_dsp_init_sse4(struct av1_dsp *dsp)
+{
+    dsp->itx_prog = x86_av1_itx_prog_sse4;
+    dsp->itx_adst4 = x86_av1_itx_adst4_sse4;
+    dsp->itx_identity = x86_av1_itx_identity_sse4;
+    dsp->intra_dc = intra_dc_sse4;
+    dsp->intra_h = intra_h_sse4;
+    dsp->intra_paeth = x86_av1_intra_paeth_sse4;
+    dsp->intra_smooth = x86_av1_intra_smooth_sse4;
+    dsp->intra_smooth_v = intra_smooth_v_sse4;
+    dsp->intra_smooth_h = intra_smooth_h_sse4;
+    dsp->cfl_pred = x86_av1_cfl_pred_sse4;
+}
+
+#endif
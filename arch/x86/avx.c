@@ -117,6 +117,12 @@ static void x86_idct_4x4_avx2_16bit(int16_t *in, int bitdepth) {
 
 static struct accl_ops avx_accl_16bit = {
     .idct_4x4 = x86_idct_4x4_avx2_16bit,
+    // 4x4 and 8x8 are narrower than a ymm register
+    .hevc_idst_4x4 = x86_hevc_idst_4x4_sse4,
+    .hevc_idct_4x4 = x86_hevc_idct_4x4_sse4,
+    .hevc_idct_8x8 = x86_hevc_idct_8x8_sse4,
+    .hevc_idct_16x16 = x86_hevc_idct_16x16_avx2,
+    .hevc_idct_32x32 = x86_hevc_idct_32x32_avx2,
     .type = SIMD_TYPE_AVX2,
 };
 
@@ -0,0 +1,862 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "x86.h"
+#include "hevcdsp.h"
+#include "idct.h"
+#include "utils.h"
+
+#ifdef __AVX2__
+
+/* The same as the SSE4.1 version, but with 16 lanes, four segments of an
+ * edge at a time. Vertical edges put rows 0..7 in the low 128 bit lane and
+ * rows 8..15 in the high one, so the transposes never cross lanes.
+ */
+
+static inline __m256i
+seg_set(int v0, int v1, int v2, int v3)
+{
+    return _mm256_set_epi64x((uint16_t)v3 * 0x0001000100010001ULL,
+                             (uint16_t)v2 * 0x0001000100010001ULL,
+                             (uint16_t)v1 * 0x0001000100010001ULL,
+                             (uint16_t)v0 * 0x0001000100010001ULL);
+}
+
+#define SEG(e, f) seg_set((e)[0].f, (e)[1].f, (e)[2].f, (e)[3].f)
+
+// broadcast the first and the fourth line of each segment
+static inline __m256i
+line0(__m256i v)
+{
+    return _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(v, 0x00), 0x00);
+}
+
+static inline __m256i
+line3(__m256i v)
+{
+    return _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(v, 0xFF), 0xFF);
+}
+
+static inline __m256i
+clamp16(__m256i v, __m256i lo, __m256i hi)
+{
+    return _mm256_min_epi16(_mm256_max_epi16(v, lo), hi);
+}
+
+// two 8x8 transposes at once, one in each 128 bit lane
+static inline void
+transpose_2x8x8_16b(__m256i *r)
+{
+    const __m256i a0 = _mm256_unpacklo_epi16(r[0], r[1]);
+    const __m256i a1 = _mm256_unpackhi_epi16(r[0], r[1]);
+    const __m256i a2 = _mm256_unpacklo_epi16(r[2], r[3]);
+    const __m256i a3 = _mm256_unpackhi_epi16(r[2], r[3]);
+    const __m256i a4 = _mm256_unpacklo_epi16(r[4], r[5]);
+    const __m256i a5 = _mm256_unpackhi_epi16(r[4], r[5]);
+    const __m256i a6 = _mm256_unpacklo_epi16(r[6], r[7]);
+    const __m256i a7 = _mm256_unpackhi_epi16(r[6], r[7]);
+    const __m256i b0 = _mm256_unpacklo_epi32(a0, a2);
+    const __m256i b1 = _mm256_unpackhi_epi32(a0, a2);
+    const __m256i b2 = _mm256_unpacklo_epi32(a1, a3);
+    const __m256i b3 = _mm256_unpackhi_epi32(a1, a3);
+    const __m256i b4 = _mm256_unpacklo_epi32(a4, a6);
+    const __m256i b5 = _mm256_unpackhi_epi32(a4, a6);
+    const __m256i b6 = _mm256_unpacklo_epi32(a5, a7);
+    const __m256i b7 = _mm256_unpackhi_epi32(a5, a7);
+    r[0] = _mm256_unpacklo_epi64(b0, b4);
+    r[1] = _mm256_unpackhi_epi64(b0, b4);
+    r[2] = _mm256_unpacklo_epi64(b1, b5);
+    r[3] = _mm256_unpackhi_epi64(b1, b5);
+    r[4] = _mm256_unpacklo_epi64(b2, b6);
+    r[5] = _mm256_unpackhi_epi64(b2, b6);
+    r[6] = _mm256_unpacklo_epi64(b3, b7);
+    r[7] = _mm256_unpackhi_epi64(b3, b7);
+}
+
+// x[0..7] are p3 p2 p1 p0 q0 q1 q2 q3, see 8.7.2.5.3 and 8.7.2.5.7
+static void
+luma_filter16(__m256i *x, const struct hevc_edge *e, __m256i maxv)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i p3 = x[0], p2 = x[1], p1 = x[2], p0 = x[3];
+    const __m256i q0 = x[4], q1 = x[5], q2 = x[6], q3 = x[7];
+    const __m256i beta = SEG(e, beta);
+    const __m256i tc = SEG(e, tc);
+    const __m256i no_p = _mm256_cmpgt_epi16(SEG(e, no_p), zero);
+    const __m256i no_q = _mm256_cmpgt_epi16(SEG(e, no_q), zero);
+
+    const __m256i dp = _mm256_abs_epi16(
+        _mm256_sub_epi16(_mm256_add_epi16(p2, p0), _mm256_slli_epi16(p1, 1)));
+    const __m256i dq = _mm256_abs_epi16(
+        _mm256_sub_epi16(_mm256_add_epi16(q2, q0), _mm256_slli_epi16(q1, 1)));
+    const __m256i dpq = _mm256_add_epi16(dp, dq);
+    const __m256i d = _mm256_add_epi16(line0(dpq), line3(dpq));
+    const __m256i on = _mm256_cmpgt_epi16(beta, d);
+
+    // dSam of every line, a segment is strong when lines 0 and 3 are
+    const __m256i tc25 = _mm256_srai_epi16(
+        _mm256_add_epi16(_mm256_add_epi16(_mm256_slli_epi16(tc, 2), tc),
+                      _mm256_set1_epi16(1)), 1);
+    const __m256i flat = _mm256_add_epi16(_mm256_abs_epi16(_mm256_sub_epi16(p3, p0)),
+                                       _mm256_abs_epi16(_mm256_sub_epi16(q0, q3)));
+    __m256i sam = _mm256_cmpgt_epi16(_mm256_srai_epi16(beta, 2), _mm256_slli_epi16(dpq, 1));
+    sam = _mm256_and_si256(sam, _mm256_cmpgt_epi16(_mm256_srai_epi16(beta, 3), flat));
+    sam = _mm256_and_si256(
+        sam, _mm256_cmpgt_epi16(tc25, _mm256_abs_epi16(_mm256_sub_epi16(p0, q0))));
+    const __m256i strong = _mm256_and_si256(line0(sam), line3(sam));
+
+    const __m256i side = _mm256_srai_epi16(
+        _mm256_add_epi16(beta, _mm256_srai_epi16(beta, 1)), 3);
+    const __m256i dEp = _mm256_cmpgt_epi16(side, _mm256_add_epi16(line0(dp), line3(dp)));
+    const __m256i dEq = _mm256_cmpgt_epi16(side, _mm256_add_epi16(line0(dq), line3(dq)));
+
+    // strong filter
+    const __m256i tc2 = _mm256_slli_epi16(tc, 1);
+    const __m256i pq0 = _mm256_add_epi16(p0, q0);
+    const __m256i four = _mm256_set1_epi16(4);
+    const __m256i two = _mm256_set1_epi16(2);
+    // p2 + 2p1 + 2p0 + 2q0 + q1 + 4
+    __m256i sp0 = _mm256_add_epi16(_mm256_add_epi16(p2, q1), four);
+    sp0 = _mm256_add_epi16(sp0, _mm256_slli_epi16(_mm256_add_epi16(p1, pq0), 1));
+    sp0 = clamp16(_mm256_srai_epi16(sp0, 3), _mm256_sub_epi16(p0, tc2),
+                  _mm256_add_epi16(p0, tc2));
+    // p2 + p1 + p0 + q0 + 2
+    const __m256i sum_p = _mm256_add_epi16(_mm256_add_epi16(p2, p1), pq0);
+    __m256i sp1 = _mm256_srai_epi16(_mm256_add_epi16(sum_p, two), 2);
+    sp1 = clamp16(sp1, _mm256_sub_epi16(p1, tc2), _mm256_add_epi16(p1, tc2));
+    // 2p3 + 3p2 + p1 + p0 + q0 + 4
+    __m256i sp2 = _mm256_add_epi16(sum_p, _mm256_slli_epi16(_mm256_add_epi16(p3, p2), 1));
+    sp2 = _mm256_srai_epi16(_mm256_add_epi16(sp2, four), 3);
+    sp2 = clamp16(sp2, _mm256_sub_epi16(p2, tc2), _mm256_add_epi16(p2, tc2));
+    // p1 + 2p0 + 2q0 + 2q1 + q2 + 4
+    __m256i sq0 = _mm256_add_epi16(_mm256_add_epi16(p1, q2), four);
+    sq0 = _mm256_add_epi16(sq0, _mm256_slli_epi16(_mm256_add_epi16(q1, pq0), 1));
+    sq0 = clamp16(_mm256_srai_epi16(sq0, 3), _mm256_sub_epi16(q0, tc2),
+                  _mm256_add_epi16(q0, tc2));
+    // p0 + q0 + q1 + q2 + 2
+    const __m256i sum_q = _mm256_add_epi16(_mm256_add_epi16(q2, q1), pq0);
+    __m256i sq1 = _mm256_srai_epi16(_mm256_add_epi16(sum_q, two), 2);
+    sq1 = clamp16(sq1, _mm256_sub_epi16(q1, tc2), _mm256_add_epi16(q1, tc2));
+    // p0 + q0 + q1 + 3q2 + 2q3 + 4
+    __m256i sq2 = _mm256_add_epi16(sum_q, _mm256_slli_epi16(_mm256_add_epi16(q3, q2), 1));
+    sq2 = _mm256_srai_epi16(_mm256_add_epi16(sq2, four), 3);
+    sq2 = clamp16(sq2, _mm256_sub_epi16(q2, tc2), _mm256_add_epi16(q2, tc2));
+
+    // normal filter
+    __m256i delta = _mm256_sub_epi16(
+        _mm256_mullo_epi16(_mm256_sub_epi16(q0, p0), _mm256_set1_epi16(9)),
+        _mm256_mullo_epi16(_mm256_sub_epi16(q1, p1), _mm256_set1_epi16(3)));
+    delta = _mm256_srai_epi16(_mm256_add_epi16(delta, _mm256_set1_epi16(8)), 4);
+    const __m256i normal = _mm256_andnot_si256(
+        strong, _mm256_cmpgt_epi16(_mm256_mullo_epi16(tc, _mm256_set1_epi16(10)),
+                                _mm256_abs_epi16(delta)));
+    delta = clamp16(delta, _mm256_sub_epi16(zero, tc), tc);
+    const __m256i np0 = clamp16(_mm256_add_epi16(p0, delta), zero, maxv);
+    const __m256i nq0 = clamp16(_mm256_sub_epi16(q0, delta), zero, maxv);
+    const __m256i tch = _mm256_srai_epi16(tc, 1);
+    const __m256i one = _mm256_set1_epi16(1);
+    __m256i dlp = _mm256_srai_epi16(_mm256_add_epi16(_mm256_add_epi16(p2, p0), one), 1);
+    dlp = _mm256_srai_epi16(_mm256_add_epi16(_mm256_sub_epi16(dlp, p1), delta), 1);
+    dlp = clamp16(dlp, _mm256_sub_epi16(zero, tch), tch);
+    const __m256i np1 = clamp16(_mm256_add_epi16(p1, dlp), zero, maxv);
+    __m256i dlq = _mm256_srai_epi16(_mm256_add_epi16(_mm256_add_epi16(q2, q0), one), 1);
+    dlq = _mm256_srai_epi16(_mm256_sub_epi16(_mm256_sub_epi16(dlq, q1), delta), 1);
+    dlq = clamp16(dlq, _mm256_sub_epi16(zero, tch), tch);
+    const __m256i nq1 = clamp16(_mm256_add_epi16(q1, dlq), zero, maxv);
+
+    const __m256i mp = _mm256_andnot_si256(no_p, on);
+    const __m256i mq = _mm256_andnot_si256(no_q, on);
+    const __m256i any = _mm256_or_si256(strong, normal);
+    x[1] = _mm256_blendv_epi8(p2, sp2, _mm256_and_si256(mp, strong));
+    x[2] = _mm256_blendv_epi8(
+        p1, _mm256_blendv_epi8(np1, sp1, strong),
+        _mm256_and_si256(mp, _mm256_or_si256(strong, _mm256_and_si256(normal, dEp))));
+    x[3] = _mm256_blendv_epi8(p0, _mm256_blendv_epi8(np0, sp0, strong),
+                           _mm256_and_si256(mp, any));
+    x[4] = _mm256_blendv_epi8(q0, _mm256_blendv_epi8(nq0, sq0, strong),
+                           _mm256_and_si256(mq, any));
+    x[5] = _mm256_blendv_epi8(
+        q1, _mm256_blendv_epi8(nq1, sq1, strong),
+        _mm256_and_si256(mq, _mm256_or_si256(strong, _mm256_and_si256(normal, dEq))));
+    x[6] = _mm256_blendv_epi8(q2, sq2, _mm256_and_si256(mq, strong));
+}
+
+// x[0..3] are p1 p0 q0 q1, see 8.7.2.5.5
+static void
+chroma_filter16(__m256i *x, const struct hevc_edge *e, __m256i maxv)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i p1 = x[0], p0 = x[1], q0 = x[2], q1 = x[3];
+    const __m256i tc = SEG(e, tc);
+    const __m256i no_p = _mm256_cmpgt_epi16(SEG(e, no_p), zero);
+    const __m256i no_q = _mm256_cmpgt_epi16(SEG(e, no_q), zero);
+
+    __m256i delta = _mm256_add_epi16(_mm256_slli_epi16(_mm256_sub_epi16(q0, p0), 2),
+                                  _mm256_sub_epi16(p1, q1));
+    delta = _mm256_srai_epi16(_mm256_add_epi16(delta, _mm256_set1_epi16(4)), 3);
+    delta = clamp16(delta, _mm256_sub_epi16(zero, tc), tc);
+    x[1] = _mm256_blendv_epi8(clamp16(_mm256_add_epi16(p0, delta), zero, maxv), p0,
+                           no_p);
+    x[2] = _mm256_blendv_epi8(clamp16(_mm256_sub_epi16(q0, delta), zero, maxv), q0,
+                           no_q);
+}
+
+static inline int
+skip4(const struct hevc_edge *e)
+{
+    return (e[0].tc | e[1].tc | e[2].tc | e[3].tc) == 0;
+}
+
+static inline __m256i
+load_rows(const int16_t *p, int stride)
+{
+    return _mm256_inserti128_si256(
+        _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)p)),
+        _mm_loadu_si128((const __m128i *)(p + 8 * stride)), 1);
+}
+
+static inline void
+store_rows(int16_t *p, int stride, __m256i v)
+{
+    _mm_storeu_si128((__m128i *)p, _mm256_castsi256_si128(v));
+    _mm_storeu_si128((__m128i *)(p + 8 * stride),
+                     _mm256_extracti128_si256(v, 1));
+}
+
+static void
+luma_edge_ver_avx2(int16_t *pix, int stride, const struct hevc_edge *e, int n,
+                   int maxval)
+{
+    const __m256i maxv = _mm256_set1_epi16(maxval);
+    int k = 0;
+
+    if (maxval > 1023) {
+        hevc_luma_edge_ver_c(pix, stride, e, n, maxval);
+        return;
+    }
+    for (; k + 4 <= n; k += 4, pix += 16 * stride) {
+        __m256i x[8];
+        if (skip4(e + k)) {
+            continue;
+        }
+        for (int i = 0; i < 8; i++) {
+            x[i] = load_rows(pix + i * stride - 4, stride);
+        }
+        transpose_2x8x8_16b(x);
+        luma_filter16(x, e + k, maxv);
+        transpose_2x8x8_16b(x);
+        for (int i = 0; i < 8; i++) {
+            store_rows(pix + i * stride - 4, stride, x[i]);
+        }
+    }
+    if (k < n) {
+        hevc_luma_edge_ver_c(pix, stride, e + k, n - k, maxval);
+    }
+}
+
+static void
+luma_edge_hor_avx2(int16_t *pix, int stride, const struct hevc_edge *e, int n,
+                   int maxval)
+{
+    const __m256i maxv = _mm256_set1_epi16(maxval);
+    int k = 0;
+
+    if (maxval > 1023) {
+        hevc_luma_edge_hor_c(pix, stride, e, n, maxval);
+        return;
+    }
+    for (; k + 4 <= n; k += 4, pix += 16) {
+        __m256i x[8];
+        if (skip4(e + k)) {
+            continue;
+        }
+        for (int i = 0; i < 8; i++) {
+            x[i] = _mm256_loadu_si256((const __m256i *)(pix + (i - 4) * stride));
+        }
+        luma_filter16(x, e + k, maxv);
+        for (int i = 1; i < 7; i++) {
+            _mm256_storeu_si256((__m256i *)(pix + (i - 4) * stride), x[i]);
+        }
+    }
+    if (k < n) {
+        hevc_luma_edge_hor_c(pix, stride, e + k, n - k, maxval);
+    }
+}
+
+static void
+chroma_edge_ver_avx2(int16_t *pix, int stride, const struct hevc_edge *e,
+                     int n, int maxval)
+{
+    const __m256i maxv = _mm256_set1_epi16(maxval);
+    int k = 0;
+
+    if (maxval > 1023) {
+        hevc_chroma_edge_ver_c(pix, stride, e, n, maxval);
+        return;
+    }
+    for (; k + 4 <= n; k += 4, pix += 16 * stride) {
+        __m256i x[8];
+        if (skip4(e + k)) {
+            continue;
+        }
+        for (int i = 0; i < 8; i++) {
+            x[i] = load_rows(pix + i * stride - 4, stride);
+        }
+        transpose_2x8x8_16b(x);
+        chroma_filter16(x + 2, e + k, maxv);
+        transpose_2x8x8_16b(x);
+        for (int i = 0; i < 8; i++) {
+            store_rows(pix + i * stride - 4, stride, x[i]);
+        }
+    }
+    if (k < n) {
+        hevc_chroma_edge_ver_c(pix, stride, e + k, n - k, maxval);
+    }
+}
+
+static void
+chroma_edge_hor_avx2(int16_t *pix, int stride, const struct hevc_edge *e,
+                     int n, int maxval)
+{
+    const __m256i maxv = _mm256_set1_epi16(maxval);
+    int k = 0;
+
+    if (maxval > 1023) {
+        hevc_chroma_edge_hor_c(pix, stride, e, n, maxval);
+        return;
+    }
+    for (; k + 4 <= n; k += 4, pix += 16) {
+        __m256i x[4];
+        if (skip4(e + k)) {
+            continue;
+        }
+        for (int i = 0; i < 4; i++) {
+            x[i] = _mm256_loadu_si256((const __m256i *)(pix + (i - 2) * stride));
+        }
+        chroma_filter16(x, e + k, maxv);
+        _mm256_storeu_si256((__m256i *)(pix - stride), x[1]);
+        _mm256_storeu_si256((__m256i *)pix, x[2]);
+    }
+    if (k < n) {
+        hevc_chroma_edge_hor_c(pix, stride, e + k, n - k, maxval);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Sample adaptive offset, 16 samples at a time
+
+// 16 bit lookup of k in [0, 7] with pshufb, the table is in both lanes
+static inline __m256i
+lookup16(__m256i table, __m256i k)
+{
+    const __m256i idx = _mm256_add_epi16(
+        _mm256_mullo_epi16(k, _mm256_set1_epi16(0x0202)),
+        _mm256_set1_epi16(0x0100));
+    return _mm256_shuffle_epi8(table, idx);
+}
+
+static void
+sao_band_avx2(int16_t *dst, const int16_t *src, int n, const int16_t *offset,
+              int band_position, int shift, int maxval)
+{
+    const __m256i table = _mm256_broadcastq_epi64(
+        _mm_loadl_epi64((const __m128i *)offset));
+    const __m256i pos = _mm256_set1_epi16(band_position);
+    const __m256i mask = _mm256_set1_epi16(31);
+    const __m256i four = _mm256_set1_epi16(4);
+    const __m256i maxv = _mm256_set1_epi16(maxval);
+    const __m128i shift_v = _mm_cvtsi32_si128(shift);
+    int i = 0;
+
+    for (; i + 16 <= n; i += 16) {
+        const __m256i s = _mm256_loadu_si256((const __m256i *)(src + i));
+        const __m256i k = _mm256_and_si256(
+            _mm256_sub_epi16(_mm256_sra_epi16(s, shift_v), pos), mask);
+        const __m256i off = _mm256_and_si256(lookup16(table, k),
+                                             _mm256_cmpgt_epi16(four, k));
+        const __m256i v = _mm256_min_epi16(
+            _mm256_max_epi16(_mm256_add_epi16(s, off), _mm256_setzero_si256()),
+            maxv);
+        _mm256_storeu_si256((__m256i *)(dst + i), v);
+    }
+    if (i < n) {
+        hevc_sao_band_c(dst + i, src + i, n - i, offset, band_position, shift,
+                        maxval);
+    }
+}
+
+static void
+sao_edge_avx2(int16_t *dst, const int16_t *src, const int16_t *a,
+              const int16_t *b, int n, const int16_t *offset, int maxval)
+{
+    // offsets by 2 + the two signs, see 8-411
+    const __m256i table = _mm256_broadcastsi128_si256(_mm_setr_epi16(
+        offset[1], offset[2], offset[0], offset[3], offset[4], 0, 0, 0));
+    const __m256i two = _mm256_set1_epi16(2);
+    const __m256i maxv = _mm256_set1_epi16(maxval);
+    int i = 0;
+
+    for (; i + 16 <= n; i += 16) {
+        const __m256i s = _mm256_loadu_si256((const __m256i *)(src + i));
+        const __m256i va = _mm256_loadu_si256((const __m256i *)(a + i));
+        const __m256i vb = _mm256_loadu_si256((const __m256i *)(b + i));
+        __m256i k = _mm256_sub_epi16(_mm256_cmpgt_epi16(va, s),
+                                     _mm256_cmpgt_epi16(s, va));
+        k = _mm256_add_epi16(k, _mm256_sub_epi16(_mm256_cmpgt_epi16(vb, s),
+                                                 _mm256_cmpgt_epi16(s, vb)));
+        k = _mm256_add_epi16(k, two);
+        const __m256i v = _mm256_min_epi16(
+            _mm256_max_epi16(_mm256_add_epi16(s, lookup16(table, k)),
+                             _mm256_setzero_si256()),
+            maxv);
+        _mm256_storeu_si256((__m256i *)(dst + i), v);
+    }
+    if (i < n) {
+        hevc_sao_edge_c(dst + i, src + i, a + i, b + i, n - i, offset, maxval);
+    }
+}
+
+
+//------------------------------------------------------------------------------
+// Inverse transforms, see 8.6.4.2
+
+static inline __m256i
+pair16(int a, int b)
+{
+    return _mm256_set1_epi32((uint16_t)a | ((uint32_t)(uint16_t)b << 16));
+}
+
+/* idct_butterfly_8() of the SSE4.1 version over 16 columns. The unpacks
+ * stay in their 128 bit lane, so lo has columns 0-3 and 8-11, hi 4-7 and
+ * 12-15, which is what packs puts back in order.
+ */
+static void
+idct_butterfly_16(const __m256i *c, int step, int n, int h, __m256i *lo,
+                  __m256i *hi)
+{
+    if (n == 1) {
+        lo[0] = _mm256_srai_epi32(_mm256_unpacklo_epi16(_mm256_setzero_si256(), c[0]), 10);
+        hi[0] = _mm256_srai_epi32(_mm256_unpackhi_epi16(_mm256_setzero_si256(), c[0]), 10);
+        return;
+    }
+    __m256i elo[16], ehi[16], olo[16], ohi[16];
+    int m = 32 / n;
+    for (int j = 0; j < n / 2; j++) {
+        olo[j] = ohi[j] = _mm256_setzero_si256();
+    }
+    for (int k = 1; k < n && k * step < h; k += 4) {
+        int k2 = k + 2;
+        int has2 = k2 < n && k2 * step < h;
+        __m256i b = has2 ? c[k2 * step] : _mm256_setzero_si256();
+        __m256i alo = _mm256_unpacklo_epi16(c[k * step], b);
+        __m256i ahi = _mm256_unpackhi_epi16(c[k * step], b);
+        for (int j = 0; j < n / 2; j++) {
+            __m256i t = pair16(hevc_idct_matrix[k * m][j],
+                               has2 ? hevc_idct_matrix[k2 * m][j] : 0);
+            olo[j] = _mm256_add_epi32(olo[j], _mm256_madd_epi16(alo, t));
+            ohi[j] = _mm256_add_epi32(ohi[j], _mm256_madd_epi16(ahi, t));
+        }
+    }
+    idct_butterfly_16(c, step * 2, n / 2, h, elo, ehi);
+    for (int j = 0; j < n / 2; j++) {
+        lo[j] = _mm256_add_epi32(elo[j], olo[j]);
+        hi[j] = _mm256_add_epi32(ehi[j], ohi[j]);
+        lo[n - 1 - j] = _mm256_sub_epi32(elo[j], olo[j]);
+        hi[n - 1 - j] = _mm256_sub_epi32(ehi[j], ohi[j]);
+    }
+}
+
+static void
+idct_cols_16(const int16_t *src, int16_t *dst, int n, int h, int shift)
+{
+    __m256i c[32], lo[32], hi[32];
+    const __m256i rnd = _mm256_set1_epi32(1 << (shift - 1));
+    for (int k = 0; k < h; k++) {
+        c[k] = _mm256_loadu_si256((const __m256i *)(src + k * n));
+    }
+    idct_butterfly_16(c, 1, n, h, lo, hi);
+    for (int j = 0; j < n; j++) {
+        __m256i l = _mm256_srai_epi32(_mm256_add_epi32(lo[j], rnd), shift);
+        __m256i r = _mm256_srai_epi32(_mm256_add_epi32(hi[j], rnd), shift);
+        _mm256_storeu_si256((__m256i *)(dst + j * n), _mm256_packs_epi32(l, r));
+    }
+}
+
+void
+x86_hevc_idct_16x16_avx2(int16_t *coeffs, int bitdepth, int w, int h)
+{
+    x86_hevc_idct_2d(coeffs, 16, bitdepth, w, h, idct_cols_16, 16);
+}
+
+void
+x86_hevc_idct_32x32_avx2(int16_t *coeffs, int bitdepth, int w, int h)
+{
+    x86_hevc_idct_2d(coeffs, 32, bitdepth, w, h, idct_cols_16, 16);
+}
+
+//------------------------------------------------------------------------------
+// Intra prediction, see 8.4.4.2
+
+// the SSE4.1 version with 8 columns a register
+void
+x86_hevc_intra_planar_avx2(uint16_t *dst, uint16_t *left, uint16_t *top,
+                           int nTbS, int stride)
+{
+    __m256i v[4], dv[4], wx[4];
+    if (nTbS < 8) {
+        x86_hevc_intra_planar_sse4(dst, left, top, nTbS, stride);
+        return;
+    }
+    int shift = log2floor(nTbS) + 1;
+    const __m256i bl = _mm256_set1_epi32(left[nTbS]);
+    for (int i = 0; i < nTbS / 8; i++) {
+        __m256i t = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(top + 8 * i)));
+        v[i] = _mm256_add_epi32(_mm256_mullo_epi32(t, _mm256_set1_epi32(nTbS - 1)),
+                                _mm256_add_epi32(bl, _mm256_set1_epi32(nTbS)));
+        dv[i] = _mm256_sub_epi32(bl, t);
+        wx[i] = _mm256_add_epi32(_mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 8),
+                                 _mm256_set1_epi32(8 * i));
+    }
+    for (int y = 0; y < nTbS; y++, dst += stride) {
+        const __m256i h = _mm256_set1_epi32(nTbS * left[y]);
+        const __m256i dh = _mm256_set1_epi32(top[nTbS] - left[y]);
+        __m256i s[4];
+        for (int i = 0; i < nTbS / 8; i++) {
+            s[i] = _mm256_add_epi32(_mm256_add_epi32(h, v[i]),
+                                    _mm256_mullo_epi32(wx[i], dh));
+            s[i] = _mm256_srli_epi32(s[i], shift);
+            v[i] = _mm256_add_epi32(v[i], dv[i]);
+        }
+        if (nTbS == 8) {
+            __m256i p = _mm256_permute4x64_epi64(_mm256_packus_epi32(s[0], s[0]), 0x08);
+            _mm_storeu_si128((__m128i *)dst, _mm256_castsi256_si128(p));
+            continue;
+        }
+        // packs works per 128 bit lane, the permute puts the halves in order
+        for (int i = 0; i < nTbS / 8; i += 2) {
+            __m256i p = _mm256_packus_epi32(s[i], s[i + 1]);
+            _mm256_storeu_si256((__m256i *)(dst + 8 * i),
+                                _mm256_permute4x64_epi64(p, 0xD8));
+        }
+    }
+}
+
+// rows of a vertical mode, 16 columns a register, unpacks stay in the lanes
+static void
+intra_rows_16(uint16_t *dst, int stride, const uint16_t *ref, int nTbS,
+              int angle)
+{
+    const __m256i rnd = _mm256_set1_epi32(16);
+    for (int y = 0; y < nTbS; y++, dst += stride) {
+        int iIdx = ((y + 1) * angle) >> 5;
+        int iFact = ((y + 1) * angle) & 31;
+        const uint16_t *r = ref + iIdx + 1;
+        if (iFact == 0) {
+            for (int x = 0; x < nTbS; x += 16) {
+                _mm256_storeu_si256((__m256i *)(dst + x),
+                                    _mm256_loadu_si256((const __m256i *)(r + x)));
+            }
+            continue;
+        }
+        const __m256i w = _mm256_set1_epi32((32 - iFact) | (iFact << 16));
+        for (int x = 0; x < nTbS; x += 16) {
+            __m256i a = _mm256_loadu_si256((const __m256i *)(r + x));
+            __m256i b = _mm256_loadu_si256((const __m256i *)(r + x + 1));
+            __m256i lo = _mm256_madd_epi16(_mm256_unpacklo_epi16(a, b), w);
+            __m256i hi = _mm256_madd_epi16(_mm256_unpackhi_epi16(a, b), w);
+            lo = _mm256_srli_epi32(_mm256_add_epi32(lo, rnd), 5);
+            hi = _mm256_srli_epi32(_mm256_add_epi32(hi, rnd), 5);
+            _mm256_storeu_si256((__m256i *)(dst + x), _mm256_packus_epi32(lo, hi));
+        }
+    }
+}
+
+void
+x86_hevc_intra_angular_avx2(uint16_t *dst, uint16_t *left, uint16_t *top,
+                            int nTbS, int stride, int cIdx, int predModeIntra,
+                            int disableIntraBoundaryFilter, int bitdepth)
+{
+    if (nTbS < 16) {
+        x86_hevc_intra_angular_sse4(dst, left, top, nTbS, stride, cIdx,
+                                    predModeIntra, disableIntraBoundaryFilter,
+                                    bitdepth);
+        return;
+    }
+    x86_hevc_intra_angular(dst, left, top, nTbS, stride, cIdx, predModeIntra,
+                           disableIntraBoundaryFilter, bitdepth, intra_rows_16);
+}
+
+//------------------------------------------------------------------------------
+// Inter prediction, see 8.5.3.3, 16 samples a time. The unpacks and packs
+// both stay in the lanes, so the columns come out in order
+
+static void
+mc_pass_avx2(int16_t *dst, int dststride, const int16_t *src, int srcstride,
+             int step, int w, int h, const int8_t *f, int taps, int shift)
+{
+    __m256i c[4];
+    for (int k = 0; k < taps / 2; k++) {
+        c[k] = _mm256_set1_epi32((uint16_t)f[2 * k] |
+                                 ((uint32_t)(uint16_t)f[2 * k + 1] << 16));
+    }
+    const __m128i sh = _mm_cvtsi32_si128(shift);
+    int x16 = w & ~15;
+    for (int y = 0; y < h && x16; y++) {
+        for (int x = 0; x < x16; x += 16) {
+            const int16_t *s = src + y * srcstride + x;
+            __m256i lo = _mm256_setzero_si256(), hi = _mm256_setzero_si256();
+            for (int k = 0; k < taps / 2; k++) {
+                const __m256i a = _mm256_loadu_si256((const __m256i *)(s + 2 * k * step));
+                const __m256i b = _mm256_loadu_si256((const __m256i *)(s + (2 * k + 1) * step));
+                lo = _mm256_add_epi32(lo, _mm256_madd_epi16(_mm256_unpacklo_epi16(a, b), c[k]));
+                hi = _mm256_add_epi32(hi, _mm256_madd_epi16(_mm256_unpackhi_epi16(a, b), c[k]));
+            }
+            _mm256_storeu_si256((__m256i *)(dst + y * dststride + x),
+                                _mm256_packs_epi32(_mm256_sra_epi32(lo, sh),
+                                                   _mm256_sra_epi32(hi, sh)));
+        }
+    }
+    if (x16 < w) {
+        x86_hevc_mc_pass_sse4(dst + x16, dststride, src + x16, srcstride, step,
+                              w - x16, h, f, taps, shift);
+    }
+}
+
+static void
+mc_luma_avx2(int16_t *dst, int dststride, const int16_t *src, int srcstride,
+             int w, int h, int mx, int my, int bitdepth)
+{
+    x86_hevc_mc(dst, dststride, src, srcstride, w, h,
+                mx ? hevc_luma_filter[mx] : NULL,
+                my ? hevc_luma_filter[my] : NULL, 8, bitdepth, mc_pass_avx2);
+}
+
+static void
+mc_chroma_avx2(int16_t *dst, int dststride, const int16_t *src,
+               int srcstride, int w, int h, int mx, int my, int bitdepth)
+{
+    x86_hevc_mc(dst, dststride, src, srcstride, w, h,
+                mx ? hevc_chroma_filter[mx] : NULL,
+                my ? hevc_chroma_filter[my] : NULL, 4, bitdepth, mc_pass_avx2);
+}
+
+// see x86_hevc_pred_uni_sse4() for the pmulhrsw
+static void
+pred_uni_avx2(int16_t *dst, int dststride, const int16_t *src, int srcstride,
+              int w, int h, int bitdepth)
+{
+    const __m256i mul = _mm256_set1_epi16(1 << (1 + bitdepth));
+    const __m256i maxv = _mm256_set1_epi16((1 << bitdepth) - 1);
+    const __m256i zero = _mm256_setzero_si256();
+    int x16 = w & ~15;
+    for (int y = 0; y < h && x16; y++) {
+        for (int x = 0; x < x16; x += 16) {
+            const __m256i s = _mm256_loadu_si256((const __m256i *)(src + y * srcstride + x));
+            _mm256_storeu_si256((__m256i *)(dst + y * dststride + x),
+                                clamp16(_mm256_mulhrs_epi16(s, mul), zero, maxv));
+        }
+    }
+    if (x16 < w) {
+        x86_hevc_pred_uni_sse4(dst + x16, dststride, src + x16, srcstride,
+                               w - x16, h, bitdepth);
+    }
+}
+
+static void
+pred_bi_avx2(int16_t *dst, int dststride, const int16_t *src0,
+             const int16_t *src1, int srcstride, int w, int h, int bitdepth)
+{
+    int shift = 15 - bitdepth;
+    const __m256i one = _mm256_set1_epi16(1);
+    const __m256i off = _mm256_set1_epi32(1 << (shift - 1));
+    const __m128i sh = _mm_cvtsi32_si128(shift);
+    const __m256i maxv = _mm256_set1_epi16((1 << bitdepth) - 1);
+    const __m256i zero = _mm256_setzero_si256();
+    int x16 = w & ~15;
+    for (int y = 0; y < h && x16; y++) {
+        for (int x = 0; x < x16; x += 16) {
+            const __m256i a = _mm256_loadu_si256((const __m256i *)(src0 + y * srcstride + x));
+            const __m256i b = _mm256_loadu_si256((const __m256i *)(src1 + y * srcstride + x));
+            const __m256i lo = _mm256_add_epi32(_mm256_madd_epi16(_mm256_unpacklo_epi16(a, b), one), off);
+            const __m256i hi = _mm256_add_epi32(_mm256_madd_epi16(_mm256_unpackhi_epi16(a, b), one), off);
+            const __m256i v = _mm256_packs_epi32(_mm256_sra_epi32(lo, sh),
+                                                 _mm256_sra_epi32(hi, sh));
+            _mm256_storeu_si256((__m256i *)(dst + y * dststride + x),
+                                clamp16(v, zero, maxv));
+        }
+    }
+    if (x16 < w) {
+        x86_hevc_pred_bi_sse4(dst + x16, dststride, src0 + x16, src1 + x16,
+                              srcstride, w - x16, h, bitdepth);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Output of the planes as rgb, 16 samples a time, the lanes hold pixels 0..7
+// and 8..15 until the stores put them back in order
+
+static inline void
+yuv_load_uv_16(const int16_t *u, const int16_t *v, int sub, __m256i half,
+               __m256i *cu, __m256i *cv)
+{
+    if (sub) {
+        __m256i a = _mm256_permute4x64_epi64(
+            _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)u)),
+            _MM_SHUFFLE(1, 1, 0, 0));
+        __m256i b = _mm256_permute4x64_epi64(
+            _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)v)),
+            _MM_SHUFFLE(1, 1, 0, 0));
+        *cu = _mm256_sub_epi16(_mm256_unpacklo_epi16(a, a), half);
+        *cv = _mm256_sub_epi16(_mm256_unpacklo_epi16(b, b), half);
+    } else {
+        *cu = _mm256_sub_epi16(_mm256_loadu_si256((const __m256i *)u), half);
+        *cv = _mm256_sub_epi16(_mm256_loadu_si256((const __m256i *)v), half);
+    }
+}
+
+static inline void
+yuv_rgb_16(__m256i y, __m256i u, __m256i v, __m256i *r, __m256i *g,
+           __m256i *b)
+{
+    *r = _mm256_add_epi16(_mm256_add_epi16(y, v),
+                          _mm256_mulhrs_epi16(v, _mm256_set1_epi16(HEVC_YUV_R_V)));
+    *g = _mm256_add_epi16(
+        y, _mm256_add_epi16(_mm256_mulhrs_epi16(u, _mm256_set1_epi16(HEVC_YUV_G_U)),
+                            _mm256_mulhrs_epi16(v, _mm256_set1_epi16(HEVC_YUV_G_V))));
+    *b = _mm256_add_epi16(_mm256_add_epi16(y, _mm256_add_epi16(u, u)),
+                          _mm256_mulhrs_epi16(u, _mm256_set1_epi16(HEVC_YUV_B_U)));
+}
+
+static void
+yuv_bgra32_avx2(uint8_t *dst, const int16_t *y, const int16_t *u,
+                const int16_t *v, int width, int sub, int bitdepth)
+{
+    __m256i half = _mm256_set1_epi16(1 << (bitdepth - 1));
+    __m128i shift = _mm_cvtsi32_si128(bitdepth - 8);
+    __m256i alpha = _mm256_set1_epi16(0xFF);
+    int i = 0;
+    for (; i + 16 <= width; i += 16) {
+        __m256i cu, cv, r, g, b;
+        yuv_load_uv_16(u + (i >> sub), v + (i >> sub), sub, half, &cu, &cv);
+        yuv_rgb_16(_mm256_loadu_si256((const __m256i *)(y + i)), cu, cv, &r,
+                   &g, &b);
+        __m256i bg = _mm256_packus_epi16(_mm256_sra_epi16(b, shift),
+                                         _mm256_sra_epi16(g, shift));
+        __m256i ra = _mm256_packus_epi16(_mm256_sra_epi16(r, shift), alpha);
+        bg = _mm256_unpacklo_epi8(bg, _mm256_srli_si256(bg, 8));
+        ra = _mm256_unpacklo_epi8(ra, _mm256_srli_si256(ra, 8));
+        __m256i lo = _mm256_unpacklo_epi16(bg, ra);
+        __m256i hi = _mm256_unpackhi_epi16(bg, ra);
+        _mm256_storeu_si256((__m256i *)(dst + 4 * i),
+                            _mm256_permute2x128_si256(lo, hi, 0x20));
+        _mm256_storeu_si256((__m256i *)(dst + 4 * i + 32),
+                            _mm256_permute2x128_si256(lo, hi, 0x31));
+    }
+    if (i < width) {
+        x86_hevc_yuv_bgra32_sse4(dst + 4 * i, y + i, u + (i >> sub),
+                                 v + (i >> sub), width - i, sub, bitdepth);
+    }
+}
+
+static void
+yuv_rgba64_avx2(uint16_t *dst, const int16_t *y, const int16_t *u,
+                const int16_t *v, int width, int sub, int bitdepth)
+{
+    __m256i half = _mm256_set1_epi16(1 << (bitdepth - 1));
+    __m256i maxval = _mm256_set1_epi16((1 << bitdepth) - 1);
+    __m128i up = _mm_cvtsi32_si128(16 - bitdepth);
+    __m128i down = _mm_cvtsi32_si128(2 * bitdepth - 16);
+    __m256i alpha = _mm256_set1_epi16(-1);
+    int i = 0;
+    for (; i + 16 <= width; i += 16) {
+        __m256i cu, cv, c[3];
+        yuv_load_uv_16(u + (i >> sub), v + (i >> sub), sub, half, &cu, &cv);
+        yuv_rgb_16(_mm256_loadu_si256((const __m256i *)(y + i)), cu, cv, &c[0],
+                   &c[1], &c[2]);
+        for (int k = 0; k < 3; k++) {
+            c[k] = _mm256_min_epi16(_mm256_max_epi16(c[k], _mm256_setzero_si256()),
+                                    maxval);
+            c[k] = _mm256_or_si256(_mm256_sll_epi16(c[k], up),
+                                   _mm256_srl_epi16(c[k], down));
+        }
+        __m256i rg0 = _mm256_unpacklo_epi16(c[0], c[1]);
+        __m256i rg1 = _mm256_unpackhi_epi16(c[0], c[1]);
+        __m256i ba0 = _mm256_unpacklo_epi16(c[2], alpha);
+        __m256i ba1 = _mm256_unpackhi_epi16(c[2], alpha);
+        // pixels 0..1 | 8..9, 2..3 | 10..11, 4..5 | 12..13 and 6..7 | 14..15
+        __m256i p0 = _mm256_unpacklo_epi32(rg0, ba0);
+        __m256i p1 = _mm256_unpackhi_epi32(rg0, ba0);
+        __m256i p2 = _mm256_unpacklo_epi32(rg1, ba1);
+        __m256i p3 = _mm256_unpackhi_epi32(rg1, ba1);
+        __m256i *d = (__m256i *)(dst + 4 * i);
+        _mm256_storeu_si256(d, _mm256_permute2x128_si256(p0, p1, 0x20));
+        _mm256_storeu_si256(d + 1, _mm256_permute2x128_si256(p2, p3, 0x20));
+        _mm256_storeu_si256(d + 2, _mm256_permute2x128_si256(p0, p1, 0x31));
+        _mm256_storeu_si256(d + 3, _mm256_permute2x128_si256(p2, p3, 0x31));
+    }
+    if (i < width) {
+        x86_hevc_yuv_rgba64_sse4(dst + 4 * i, y + i, u + (i >> sub),
+                                 v + (i >> sub), width - i, sub, bitdepth);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Emulation prevention, 32 positions a time
+
+static int
+unescape_avx2(uint8_t *dst, const uint8_t *src, int len, int *epb,
+              int *num_epb)
+{
+    __m256i zero = _mm256_setzero_si256();
+    __m256i three = _mm256_set1_epi8(3);
+    int n = 0, start = 0, num = 0, i = 0;
+    while (i + 34 <= len) {
+        __m256i a = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(src + i)), zero);
+        __m256i b = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(src + i + 1)), zero);
+        __m256i c = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(src + i + 2)), three);
+        uint32_t mask = _mm256_movemask_epi8(_mm256_and_si256(_mm256_and_si256(a, b), c));
+        if (!mask) {
+            i += 32;
+            continue;
+        }
+        i += __builtin_ctz(mask);
+        memcpy(dst + n, src + start, i + 2 - start);
+        n += i + 2 - start;
+        epb[num++] = n;
+        start = i + 3;
+        i += 3;
+    }
+    // nothing starts before i, the last bytes from there on go to the sse4
+    // version with its offsets from dst + n
+    memcpy(dst + n, src + start, i - start);
+    n += i - start;
+    int tail;
+    int m = x86_hevc_unescape_sse4(dst + n, src + i, len - i, epb + num, &tail);
+    for (int k = 0; k < tail; k++) {
+        epb[num + k] += n;
+    }
+    *num_epb = num + tail;
+    return n + m;
+}
+
+void
+x86_hevc_dsp_init_avx2(struct hevc_dsp *dsp)
+{
+    dsp->luma_edge_ver = luma_edge_ver_avx2;
+    dsp->luma_edge_hor = luma_edge_hor_avx2;
+    dsp->chroma_edge_ver = chroma_edge_ver_avx2;
+    dsp->chroma_edge_hor = chroma_edge_hor_avx2;
+    dsp->sao_band = sao_band_avx2;
+    dsp->sao_edge = sao_edge_avx2;
+    dsp->intra_planar = x86_hevc_intra_planar_avx2;
+    dsp->intra_angular = x86_hevc_intra_angular_avx2;
+    dsp->mc_luma = mc_luma_avx2;
+    dsp->mc_chroma = mc_chroma_avx2;
+    dsp->pred_uni = pred_uni_avx2;
+    dsp->pred_bi = pred_bi_avx2;
+    dsp->yuv_bgra32 = yuv_bgra32_avx2;
+    dsp->yuv_rgba64 = yuv_rgba64_avx2;
+    dsp->unescape = unescape_avx2;
+}
+
+#endif
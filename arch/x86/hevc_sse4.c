@@ -0,0 +1,1313 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "x86.h"
+#include "hevcdsp.h"
+#include "idct.h"
+#include "predict.h"
+#include "utils.h"
+
+#ifdef __SSE4_1__
+
+/* Every lane is one line across the edge, so 8 lanes of 16 bits are two
+ * segments of an edge. The intermediate sums fit in 16 bits up to 10 bit
+ * samples, deeper samples go to the C version.
+ */
+
+// four copies of v per segment, segment 0 in the low lanes
+static inline __m128i
+seg_set(int v0, int v1)
+{
+    return _mm_set_epi64x((uint16_t)v1 * 0x0001000100010001ULL,
+                          (uint16_t)v0 * 0x0001000100010001ULL);
+}
+
+// broadcast the first and the fourth line of each segment
+static inline __m128i
+line0(__m128i v)
+{
+    return _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0x00), 0x00);
+}
+
+static inline __m128i
+line3(__m128i v)
+{
+    return _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xFF), 0xFF);
+}
+
+static inline __m128i
+clamp16(__m128i v, __m128i lo, __m128i hi)
+{
+    return _mm_min_epi16(_mm_max_epi16(v, lo), hi);
+}
+
+static inline void
+transpose_8x8_16b(__m128i *r)
+{
+    const __m128i a0 = _mm_unpacklo_epi16(r[0], r[1]);
+    const __m128i a1 = _mm_unpackhi_epi16(r[0], r[1]);
+    const __m128i a2 = _mm_unpacklo_epi16(r[2], r[3]);
+    const __m128i a3 = _mm_unpackhi_epi16(r[2], r[3]);
+    const __m128i a4 = _mm_unpacklo_epi16(r[4], r[5]);
+    const __m128i a5 = _mm_unpackhi_epi16(r[4], r[5]);
+    const __m128i a6 = _mm_unpacklo_epi16(r[6], r[7]);
+    const __m128i a7 = _mm_unpackhi_epi16(r[6], r[7]);
+    const __m128i b0 = _mm_unpacklo_epi32(a0, a2);
+    const __m128i b1 = _mm_unpackhi_epi32(a0, a2);
+    const __m128i b2 = _mm_unpacklo_epi32(a1, a3);
+    const __m128i b3 = _mm_unpackhi_epi32(a1, a3);
+    const __m128i b4 = _mm_unpacklo_epi32(a4, a6);
+    const __m128i b5 = _mm_unpackhi_epi32(a4, a6);
+    const __m128i b6 = _mm_unpacklo_epi32(a5, a7);
+    const __m128i b7 = _mm_unpackhi_epi32(a5, a7);
+    r[0] = _mm_unpacklo_epi64(b0, b4);
+    r[1] = _mm_unpackhi_epi64(b0, b4);
+    r[2] = _mm_unpacklo_epi64(b1, b5);
+    r[3] = _mm_unpackhi_epi64(b1, b5);
+    r[4] = _mm_unpacklo_epi64(b2, b6);
+    r[5] = _mm_unpackhi_epi64(b2, b6);
+    r[6] = _mm_unpacklo_epi64(b3, b7);
+    r[7] = _mm_unpackhi_epi64(b3, b7);
+}
+
+// x[0..7] are p3 p2 p1 p0 q0 q1 q2 q3, see 8.7.2.5.3 and 8.7.2.5.7
+static void
+luma_filter8(__m128i *x, const struct hevc_edge *e, __m128i maxv)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i p3 = x[0], p2 = x[1], p1 = x[2], p0 = x[3];
+    const __m128i q0 = x[4], q1 = x[5], q2 = x[6], q3 = x[7];
+    const __m128i beta = seg_set(e[0].beta, e[1].beta);
+    const __m128i tc = seg_set(e[0].tc, e[1].tc);
+    const __m128i no_p = _mm_cmpgt_epi16(seg_set(e[0].no_p, e[1].no_p), zero);
+    const __m128i no_q = _mm_cmpgt_epi16(seg_set(e[0].no_q, e[1].no_q), zero);
+
+    const __m128i dp = _mm_abs_epi16(
+        _mm_sub_epi16(_mm_add_epi16(p2, p0), _mm_slli_epi16(p1, 1)));
+    const __m128i dq = _mm_abs_epi16(
+        _mm_sub_epi16(_mm_add_epi16(q2, q0), _mm_slli_epi16(q1, 1)));
+    const __m128i dpq = _mm_add_epi16(dp, dq);
+    const __m128i d = _mm_add_epi16(line0(dpq), line3(dpq));
+    const __m128i on = _mm_cmpgt_epi16(beta, d);
+
+    // dSam of every line, a segment is strong when lines 0 and 3 are
+    const __m128i tc25 = _mm_srai_epi16(
+        _mm_add_epi16(_mm_add_epi16(_mm_slli_epi16(tc, 2), tc),
+                      _mm_set1_epi16(1)), 1);
+    const __m128i flat = _mm_add_epi16(_mm_abs_epi16(_mm_sub_epi16(p3, p0)),
+                                       _mm_abs_epi16(_mm_sub_epi16(q0, q3)));
+    __m128i sam = _mm_cmpgt_epi16(_mm_srai_epi16(beta, 2), _mm_slli_epi16(dpq, 1));
+    sam = _mm_and_si128(sam, _mm_cmpgt_epi16(_mm_srai_epi16(beta, 3), flat));
+    sam = _mm_and_si128(
+        sam, _mm_cmpgt_epi16(tc25, _mm_abs_epi16(_mm_sub_epi16(p0, q0))));
+    const __m128i strong = _mm_and_si128(line0(sam), line3(sam));
+
+    const __m128i side = _mm_srai_epi16(
+        _mm_add_epi16(beta, _mm_srai_epi16(beta, 1)), 3);
+    const __m128i dEp = _mm_cmpgt_epi16(side, _mm_add_epi16(line0(dp), line3(dp)));
+    const __m128i dEq = _mm_cmpgt_epi16(side, _mm_add_epi16(line0(dq), line3(dq)));
+
+    // strong filter
+    const __m128i tc2 = _mm_slli_epi16(tc, 1);
+    const __m128i pq0 = _mm_add_epi16(p0, q0);
+    const __m128i four = _mm_set1_epi16(4);
+    const __m128i two = _mm_set1_epi16(2);
+    // p2 + 2p1 + 2p0 + 2q0 + q1 + 4
+    __m128i sp0 = _mm_add_epi16(_mm_add_epi16(p2, q1), four);
+    sp0 = _mm_add_epi16(sp0, _mm_slli_epi16(_mm_add_epi16(p1, pq0), 1));
+    sp0 = clamp16(_mm_srai_epi16(sp0, 3), _mm_sub_epi16(p0, tc2),
+                  _mm_add_epi16(p0, tc2));
+    // p2 + p1 + p0 + q0 + 2
+    const __m128i sum_p = _mm_add_epi16(_mm_add_epi16(p2, p1), pq0);
+    __m128i sp1 = _mm_srai_epi16(_mm_add_epi16(sum_p, two), 2);
+    sp1 = clamp16(sp1, _mm_sub_epi16(p1, tc2), _mm_add_epi16(p1, tc2));
+    // 2p3 + 3p2 + p1 + p0 + q0 + 4
+    __m128i sp2 = _mm_add_epi16(sum_p, _mm_slli_epi16(_mm_add_epi16(p3, p2), 1));
+    sp2 = _mm_srai_epi16(_mm_add_epi16(sp2, four), 3);
+    sp2 = clamp16(sp2, _mm_sub_epi16(p2, tc2), _mm_add_epi16(p2, tc2));
+    // p1 + 2p0 + 2q0 + 2q1 + q2 + 4
+    __m128i sq0 = _mm_add_epi16(_mm_add_epi16(p1, q2), four);
+    sq0 = _mm_add_epi16(sq0, _mm_slli_epi16(_mm_add_epi16(q1, pq0), 1));
+    sq0 = clamp16(_mm_srai_epi16(sq0, 3), _mm_sub_epi16(q0, tc2),
+                  _mm_add_epi16(q0, tc2));
+    // p0 + q0 + q1 + q2 + 2
+    const __m128i sum_q = _mm_add_epi16(_mm_add_epi16(q2, q1), pq0);
+    __m128i sq1 = _mm_srai_epi16(_mm_add_epi16(sum_q, two), 2);
+    sq1 = clamp16(sq1, _mm_sub_epi16(q1, tc2), _mm_add_epi16(q1, tc2));
+    // p0 + q0 + q1 + 3q2 + 2q3 + 4
+    __m128i sq2 = _mm_add_epi16(sum_q, _mm_slli_epi16(_mm_add_epi16(q3, q2), 1));
+    sq2 = _mm_srai_epi16(_mm_add_epi16(sq2, four), 3);
+    sq2 = clamp16(sq2, _mm_sub_epi16(q2, tc2), _mm_add_epi16(q2, tc2));
+
+    // normal filter
+    __m128i delta = _mm_sub_epi16(
+        _mm_mullo_epi16(_mm_sub_epi16(q0, p0), _mm_set1_epi16(9)),
+        _mm_mullo_epi16(_mm_sub_epi16(q1, p1), _mm_set1_epi16(3)));
+    delta = _mm_srai_epi16(_mm_add_epi16(delta, _mm_set1_epi16(8)), 4);
+    const __m128i normal = _mm_andnot_si128(
+        strong, _mm_cmpgt_epi16(_mm_mullo_epi16(tc, _mm_set1_epi16(10)),
+                                _mm_abs_epi16(delta)));
+    delta = clamp16(delta, _mm_sub_epi16(zero, tc), tc);
+    const __m128i np0 = clamp16(_mm_add_epi16(p0, delta), zero, maxv);
+    const __m128i nq0 = clamp16(_mm_sub_epi16(q0, delta), zero, maxv);
+    const __m128i tch = _mm_srai_epi16(tc, 1);
+    const __m128i one = _mm_set1_epi16(1);
+    __m128i dlp = _mm_srai_epi16(_mm_add_epi16(_mm_add_epi16(p2, p0), one), 1);
+    dlp = _mm_srai_epi16(_mm_add_epi16(_mm_sub_epi16(dlp, p1), delta), 1);
+    dlp = clamp16(dlp, _mm_sub_epi16(zero, tch), tch);
+    const __m128i np1 = clamp16(_mm_add_epi16(p1, dlp), zero, maxv);
+    __m128i dlq = _mm_srai_epi16(_mm_add_epi16(_mm_add_epi16(q2, q0), one), 1);
+    dlq = _mm_srai_epi16(_mm_sub_epi16(_mm_sub_epi16(dlq, q1), delta), 1);
+    dlq = clamp16(dlq, _mm_sub_epi16(zero, tch), tch);
+    const __m128i nq1 = clamp16(_mm_add_epi16(q1, dlq), zero, maxv);
+
+    const __m128i mp = _mm_andnot_si128(no_p, on);
+    const __m128i mq = _mm_andnot_si128(no_q, on);
+    const __m128i any = _mm_or_si128(strong, normal);
+    x[1] = _mm_blendv_epi8(p2, sp2, _mm_and_si128(mp, strong));
+    x[2] = _mm_blendv_epi8(
+        p1, _mm_blendv_epi8(np1, sp1, strong),
+        _mm_and_si128(mp, _mm_or_si128(strong, _mm_and_si128(normal, dEp))));
+    x[3] = _mm_blendv_epi8(p0, _mm_blendv_epi8(np0, sp0, strong),
+                           _mm_and_si128(mp, any));
+    x[4] = _mm_blendv_epi8(q0, _mm_blendv_epi8(nq0, sq0, strong),
+                           _mm_and_si128(mq, any));
+    x[5] = _mm_blendv_epi8(
+        q1, _mm_blendv_epi8(nq1, sq1, strong),
+        _mm_and_si128(mq, _mm_or_si128(strong, _mm_and_si128(normal, dEq))));
+    x[6] = _mm_blendv_epi8(q2, sq2, _mm_and_si128(mq, strong));
+}
+
+// x[0..3] are p1 p0 q0 q1, see 8.7.2.5.5
+static void
+chroma_filter8(__m128i *x, const struct hevc_edge *e, __m128i maxv)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i p1 = x[0], p0 = x[1], q0 = x[2], q1 = x[3];
+    const __m128i tc = seg_set(e[0].tc, e[1].tc);
+    const __m128i no_p = _mm_cmpgt_epi16(seg_set(e[0].no_p, e[1].no_p), zero);
+    const __m128i no_q = _mm_cmpgt_epi16(seg_set(e[0].no_q, e[1].no_q), zero);
+
+    __m128i delta = _mm_add_epi16(_mm_slli_epi16(_mm_sub_epi16(q0, p0), 2),
+                                  _mm_sub_epi16(p1, q1));
+    delta = _mm_srai_epi16(_mm_add_epi16(delta, _mm_set1_epi16(4)), 3);
+    delta = clamp16(delta, _mm_sub_epi16(zero, tc), tc);
+    x[1] = _mm_blendv_epi8(clamp16(_mm_add_epi16(p0, delta), zero, maxv), p0,
+                           no_p);
+    x[2] = _mm_blendv_epi8(clamp16(_mm_sub_epi16(q0, delta), zero, maxv), q0,
+                           no_q);
+}
+
+static inline int
+skip2(const struct hevc_edge *e)
+{
+    return (e[0].tc | e[1].tc) == 0;
+}
+
+static void
+luma_edge_ver_sse4(int16_t *pix, int stride, const struct hevc_edge *e, int n,
+                   int maxval)
+{
+    const __m128i maxv = _mm_set1_epi16(maxval);
+    int k = 0;
+
+    if (maxval > 1023) {
+        hevc_luma_edge_ver_c(pix, stride, e, n, maxval);
+        return;
+    }
+    for (; k + 2 <= n; k += 2, pix += 8 * stride) {
+        __m128i x[8];
+        if (skip2(e + k)) {
+            continue;
+        }
+        for (int i = 0; i < 8; i++) {
+            x[i] = _mm_loadu_si128((const __m128i *)(pix + i * stride - 4));
+        }
+        transpose_8x8_16b(x);
+        luma_filter8(x, e + k, maxv);
+        transpose_8x8_16b(x);
+        for (int i = 0; i < 8; i++) {
+            _mm_storeu_si128((__m128i *)(pix + i * stride - 4), x[i]);
+        }
+    }
+    if (k < n) {
+        hevc_luma_edge_ver_c(pix, stride, e + k, n - k, maxval);
+    }
+}
+
+static void
+luma_edge_hor_sse4(int16_t *pix, int stride, const struct hevc_edge *e, int n,
+                   int maxval)
+{
+    const __m128i maxv = _mm_set1_epi16(maxval);
+    int k = 0;
+
+    if (maxval > 1023) {
+        hevc_luma_edge_hor_c(pix, stride, e, n, maxval);
+        return;
+    }
+    for (; k + 2 <= n; k += 2, pix += 8) {
+        __m128i x[8];
+        if (skip2(e + k)) {
+            continue;
+        }
+        for (int i = 0; i < 8; i++) {
+            x[i] = _mm_loadu_si128((const __m128i *)(pix + (i - 4) * stride));
+        }
+        luma_filter8(x, e + k, maxv);
+        for (int i = 1; i < 7; i++) {
+            _mm_storeu_si128((__m128i *)(pix + (i - 4) * stride), x[i]);
+        }
+    }
+    if (k < n) {
+        hevc_luma_edge_hor_c(pix, stride, e + k, n - k, maxval);
+    }
+}
+
+static void
+chroma_edge_ver_sse4(int16_t *pix, int stride, const struct hevc_edge *e,
+                     int n, int maxval)
+{
+    const __m128i maxv = _mm_set1_epi16(maxval);
+    int k = 0;
+
+    if (maxval > 1023) {
+        hevc_chroma_edge_ver_c(pix, stride, e, n, maxval);
+        return;
+    }
+    for (; k + 2 <= n; k += 2, pix += 8 * stride) {
+        __m128i x[8];
+        if (skip2(e + k)) {
+            continue;
+        }
+        for (int i = 0; i < 8; i++) {
+            x[i] = _mm_loadu_si128((const __m128i *)(pix + i * stride - 4));
+        }
+        transpose_8x8_16b(x);
+        chroma_filter8(x + 2, e + k, maxv);
+        transpose_8x8_16b(x);
+        for (int i = 0; i < 8; i++) {
+            _mm_storeu_si128((__m128i *)(pix + i * stride - 4), x[i]);
+        }
+    }
+    if (k < n) {
+        hevc_chroma_edge_ver_c(pix, stride, e + k, n - k, maxval);
+    }
+}
+
+static void
+chroma_edge_hor_sse4(int16_t *pix, int stride, const struct hevc_edge *e,
+                     int n, int maxval)
+{
+    const __m128i maxv = _mm_set1_epi16(maxval);
+    int k = 0;
+
+    if (maxval > 1023) {
+        hevc_chroma_edge_hor_c(pix, stride, e, n, maxval);
+        return;
+    }
+    for (; k + 2 <= n; k += 2, pix += 8) {
+        __m128i x[4];
+        if (skip2(e + k)) {
+            continue;
+        }
+        for (int i = 0; i < 4; i++) {
+            x[i] = _mm_loadu_si128((const __m128i *)(pix + (i - 2) * stride));
+        }
+        chroma_filter8(x, e + k, maxv);
+        _mm_storeu_si128((__m128i *)(pix - stride), x[1]);
+        _mm_storeu_si128((__m128i *)pix, x[2]);
+    }
+    if (k < n) {
+        hevc_chroma_edge_hor_c(pix, stride, e + k, n - k, maxval);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Sample adaptive offset, 8 samples at a time
+
+// 16 bit lookup of k in [0, 7] with pshufb
+static inline __m128i
+lookup16(__m128i table, __m128i k)
+{
+    const __m128i idx = _mm_add_epi16(_mm_mullo_epi16(k, _mm_set1_epi16(0x0202)),
+                                      _mm_set1_epi16(0x0100));
+    return _mm_shuffle_epi8(table, idx);
+}
+
+static void
+sao_band_sse4(int16_t *dst, const int16_t *src, int n, const int16_t *offset,
+              int band_position, int shift, int maxval)
+{
+    const __m128i table = _mm_loadl_epi64((const __m128i *)offset);
+    const __m128i pos = _mm_set1_epi16(band_position);
+    const __m128i mask = _mm_set1_epi16(31);
+    const __m128i four = _mm_set1_epi16(4);
+    const __m128i maxv = _mm_set1_epi16(maxval);
+    const __m128i shift_v = _mm_cvtsi32_si128(shift);
+    int i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        const __m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+        const __m128i k = _mm_and_si128(_mm_sub_epi16(_mm_sra_epi16(s, shift_v), pos), mask);
+        const __m128i off = _mm_and_si128(lookup16(table, k), _mm_cmpgt_epi16(four, k));
+        const __m128i v = _mm_min_epi16(
+            _mm_max_epi16(_mm_add_epi16(s, off), _mm_setzero_si128()), maxv);
+        _mm_storeu_si128((__m128i *)(dst + i), v);
+    }
+    if (i < n) {
+        hevc_sao_band_c(dst + i, src + i, n - i, offset, band_position, shift,
+                        maxval);
+    }
+}
+
+static void
+sao_edge_sse4(int16_t *dst, const int16_t *src, const int16_t *a,
+              const int16_t *b, int n, const int16_t *offset, int maxval)
+{
+    // offsets by 2 + the two signs, see 8-411
+    const __m128i table = _mm_setr_epi16(offset[1], offset[2], offset[0],
+                                         offset[3], offset[4], 0, 0, 0);
+    const __m128i two = _mm_set1_epi16(2);
+    const __m128i maxv = _mm_set1_epi16(maxval);
+    int i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        const __m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+        const __m128i va = _mm_loadu_si128((const __m128i *)(a + i));
+        const __m128i vb = _mm_loadu_si128((const __m128i *)(b + i));
+        // the compares are -1 for true
+        __m128i k = _mm_sub_epi16(_mm_cmpgt_epi16(va, s), _mm_cmpgt_epi16(s, va));
+        k = _mm_add_epi16(k, _mm_sub_epi16(_mm_cmpgt_epi16(vb, s),
+                                           _mm_cmpgt_epi16(s, vb)));
+        k = _mm_add_epi16(k, two);
+        const __m128i v = _mm_min_epi16(
+            _mm_max_epi16(_mm_add_epi16(s, lookup16(table, k)),
+                          _mm_setzero_si128()), maxv);
+        _mm_storeu_si128((__m128i *)(dst + i), v);
+    }
+    if (i < n) {
+        hevc_sao_edge_c(dst + i, src + i, a + i, b + i, n - i, offset, maxval);
+    }
+}
+
+
+//------------------------------------------------------------------------------
+// Inverse transforms, see 8.6.4.2
+
+// madd constant for a pair of interleaved rows, a for the first one
+static inline __m128i
+pair16(int a, int b)
+{
+    return _mm_set1_epi32((uint16_t)a | ((uint32_t)(uint16_t)b << 16));
+}
+
+/* partial butterfly over 8 columns. The n point DCT of rows c[0], c[step],
+ * ... is the n / 2 point one of the even rows plus and minus the odd rows,
+ * rows from h on are zero and are never touched. lo and hi get the 32 bit
+ * sums of columns 0-3 and 4-7
+ */
+static void
+idct_butterfly_8(const __m128i *c, int step, int n, int h, __m128i *lo,
+                 __m128i *hi)
+{
+    if (n == 1) {
+        // 64 * c, sign extended by the arithmetic shift
+        lo[0] = _mm_srai_epi32(_mm_unpacklo_epi16(_mm_setzero_si128(), c[0]), 10);
+        hi[0] = _mm_srai_epi32(_mm_unpackhi_epi16(_mm_setzero_si128(), c[0]), 10);
+        return;
+    }
+    __m128i elo[16], ehi[16], olo[16], ohi[16];
+    int m = 32 / n;
+    for (int j = 0; j < n / 2; j++) {
+        olo[j] = ohi[j] = _mm_setzero_si128();
+    }
+    // odd rows k and k + 2 in one madd
+    for (int k = 1; k < n && k * step < h; k += 4) {
+        int k2 = k + 2;
+        int has2 = k2 < n && k2 * step < h;
+        __m128i b = has2 ? c[k2 * step] : _mm_setzero_si128();
+        __m128i alo = _mm_unpacklo_epi16(c[k * step], b);
+        __m128i ahi = _mm_unpackhi_epi16(c[k * step], b);
+        for (int j = 0; j < n / 2; j++) {
+            __m128i t = pair16(hevc_idct_matrix[k * m][j],
+                               has2 ? hevc_idct_matrix[k2 * m][j] : 0);
+            olo[j] = _mm_add_epi32(olo[j], _mm_madd_epi16(alo, t));
+            ohi[j] = _mm_add_epi32(ohi[j], _mm_madd_epi16(ahi, t));
+        }
+    }
+    idct_butterfly_8(c, step * 2, n / 2, h, elo, ehi);
+    for (int j = 0; j < n / 2; j++) {
+        lo[j] = _mm_add_epi32(elo[j], olo[j]);
+        hi[j] = _mm_add_epi32(ehi[j], ohi[j]);
+        lo[n - 1 - j] = _mm_sub_epi32(elo[j], olo[j]);
+        hi[n - 1 - j] = _mm_sub_epi32(ehi[j], ohi[j]);
+    }
+}
+
+// the first h rows of 8 columns of an n x n block in, n rows out
+static void
+idct_cols_8(const int16_t *src, int16_t *dst, int n, int h, int shift)
+{
+    __m128i c[32], lo[32], hi[32];
+    const __m128i rnd = _mm_set1_epi32(1 << (shift - 1));
+    for (int k = 0; k < h; k++) {
+        c[k] = _mm_loadu_si128((const __m128i *)(src + k * n));
+    }
+    idct_butterfly_8(c, 1, n, h, lo, hi);
+    // packs saturates, which is the clipping of 8-318 for the first stage
+    for (int j = 0; j < n; j++) {
+        __m128i l = _mm_srai_epi32(_mm_add_epi32(lo[j], rnd), shift);
+        __m128i r = _mm_srai_epi32(_mm_add_epi32(hi[j], rnd), shift);
+        _mm_storeu_si128((__m128i *)(dst + j * n), _mm_packs_epi32(l, r));
+    }
+}
+
+static inline void
+transpose_8x8(const void *src, int sstride, void *dst, int dstride)
+{
+    __m128i a[8], b[8], c[8];
+    for (int i = 0; i < 8; i++) {
+        a[i] = _mm_loadu_si128((const __m128i *)((const int16_t *)src + i * sstride));
+    }
+    for (int i = 0; i < 4; i++) {
+        b[2 * i] = _mm_unpacklo_epi16(a[2 * i], a[2 * i + 1]);
+        b[2 * i + 1] = _mm_unpackhi_epi16(a[2 * i], a[2 * i + 1]);
+    }
+    for (int i = 0; i < 2; i++) {
+        c[4 * i] = _mm_unpacklo_epi32(b[4 * i], b[4 * i + 2]);
+        c[4 * i + 1] = _mm_unpackhi_epi32(b[4 * i], b[4 * i + 2]);
+        c[4 * i + 2] = _mm_unpacklo_epi32(b[4 * i + 1], b[4 * i + 3]);
+        c[4 * i + 3] = _mm_unpackhi_epi32(b[4 * i + 1], b[4 * i + 3]);
+    }
+    for (int i = 0; i < 4; i++) {
+        _mm_storeu_si128((__m128i *)((int16_t *)dst + 2 * i * dstride),
+                         _mm_unpacklo_epi64(c[i], c[i + 4]));
+        _mm_storeu_si128((__m128i *)((int16_t *)dst + (2 * i + 1) * dstride),
+                         _mm_unpackhi_epi64(c[i], c[i + 4]));
+    }
+}
+
+// see 8-317 and 8-318 with coeffs[0] the only non-zero coefficient
+static inline int
+idct_dc(int16_t dc, int bitdepth)
+{
+    int bdShift = 20 - bitdepth;
+    int v = clip3(-32768, 32767, (dc * 64 + 64) >> 7);
+    return clip3(-32768, 32767, (v * 64 + (1 << (bdShift - 1))) >> bdShift);
+}
+
+/* n x n DCT for n >= 8, cols does width columns at a time. The first stage
+ * only runs on the column groups that have coefficients, the second one
+ * works on the transposed result and so skips its zero rows. The output
+ * is transposed back at the end.
+ */
+void
+x86_hevc_idct_2d(int16_t *coeffs, int n, int bitdepth, int w, int h,
+                 x86_hevc_idct_cols cols, int width)
+{
+    int16_t g[32 * 32] __attribute__((aligned(32)));
+    int16_t t[32 * 32] __attribute__((aligned(32)));
+
+    w = MAX(w, 1);
+    h = MAX(h, 1);
+    if (w == 1 && h == 1) {
+        const __m128i v = _mm_set1_epi16(idct_dc(coeffs[0], bitdepth));
+        for (int i = 0; i < n * n; i += 8) {
+            _mm_storeu_si128((__m128i *)(coeffs + i), v);
+        }
+        return;
+    }
+    int cw = (w + width - 1) / width * width;
+    for (int x = 0; x < cw; x += width) {
+        cols(coeffs + x, g + x, n, h, 7);
+    }
+    for (int y = 0; y < n; y += 8) {
+        for (int x = 0; x < cw; x += 8) {
+            transpose_8x8(g + y * n + x, n, t + x * n + y, n);
+        }
+    }
+    for (int x = 0; x < n; x += width) {
+        cols(t + x, g + x, n, w, 20 - bitdepth);
+    }
+    for (int y = 0; y < n; y += 8) {
+        for (int x = 0; x < n; x += 8) {
+            transpose_8x8(g + y * n + x, n, coeffs + x * n + y, n);
+        }
+    }
+}
+
+/* one stage of the 4x4 transforms on rows 0-1 and 2-3, a matrix multiply
+ * of interleaved row pairs. m[j] has rows 0 and 1 of column j of the matrix,
+ * m[4 + j] rows 2 and 3. The result is transposed, so the next stage goes
+ * along the other direction.
+ */
+static inline void
+itrans_4_pass(__m128i *r, const __m128i *m, int shift)
+{
+    const __m128i rnd = _mm_set1_epi32(1 << (shift - 1));
+    __m128i a01 = _mm_unpacklo_epi16(r[0], _mm_srli_si128(r[0], 8));
+    __m128i a23 = _mm_unpacklo_epi16(r[1], _mm_srli_si128(r[1], 8));
+    __m128i o[4];
+    for (int j = 0; j < 4; j++) {
+        o[j] = _mm_add_epi32(_mm_madd_epi16(a01, m[j]),
+                             _mm_madd_epi16(a23, m[4 + j]));
+        o[j] = _mm_srai_epi32(_mm_add_epi32(o[j], rnd), shift);
+    }
+    __m128i p01 = _mm_packs_epi32(o[0], o[1]);
+    __m128i p23 = _mm_packs_epi32(o[2], o[3]);
+    __m128i t0 = _mm_unpacklo_epi16(p01, p23);
+    __m128i t1 = _mm_unpackhi_epi16(p01, p23);
+    r[0] = _mm_unpacklo_epi16(t0, t1);
+    r[1] = _mm_unpackhi_epi16(t0, t1);
+}
+
+static void
+itrans_4x4(int16_t *coeffs, int bitdepth, const int8_t (*mat)[4])
+{
+    __m128i m[8], r[2];
+    for (int j = 0; j < 4; j++) {
+        m[j] = pair16(mat[0][j], mat[1][j]);
+        m[4 + j] = pair16(mat[2][j], mat[3][j]);
+    }
+    r[0] = _mm_loadu_si128((const __m128i *)coeffs);
+    r[1] = _mm_loadu_si128((const __m128i *)(coeffs + 8));
+    itrans_4_pass(r, m, 7);
+    itrans_4_pass(r, m, 20 - bitdepth);
+    _mm_storeu_si128((__m128i *)coeffs, r[0]);
+    _mm_storeu_si128((__m128i *)(coeffs + 8), r[1]);
+}
+
+void
+x86_hevc_idst_4x4_sse4(int16_t *coeffs, int bitdepth, int w UNUSED,
+                       int h UNUSED)
+{
+    itrans_4x4(coeffs, bitdepth, hevc_idst_matrix);
+}
+
+void
+x86_hevc_idct_4x4_sse4(int16_t *coeffs, int bitdepth, int w, int h)
+{
+    if (w <= 1 && h <= 1) {
+        const __m128i v = _mm_set1_epi16(idct_dc(coeffs[0], bitdepth));
+        _mm_storeu_si128((__m128i *)coeffs, v);
+        _mm_storeu_si128((__m128i *)(coeffs + 8), v);
+        return;
+    }
+    // rows 0, 8, 16 and 24 of the big matrix
+    static const int8_t mat[4][4] = {
+        {64, 64, 64, 64},
+        {83, 36, -36, -83},
+        {64, -64, -64, 64},
+        {36, -83, 83, -36},
+    };
+    itrans_4x4(coeffs, bitdepth, mat);
+}
+
+void
+x86_hevc_idct_8x8_sse4(int16_t *coeffs, int bitdepth, int w, int h)
+{
+    x86_hevc_idct_2d(coeffs, 8, bitdepth, w, h, idct_cols_8, 8);
+}
+
+void
+x86_hevc_idct_16x16_sse4(int16_t *coeffs, int bitdepth, int w, int h)
+{
+    x86_hevc_idct_2d(coeffs, 16, bitdepth, w, h, idct_cols_8, 8);
+}
+
+void
+x86_hevc_idct_32x32_sse4(int16_t *coeffs, int bitdepth, int w, int h)
+{
+    x86_hevc_idct_2d(coeffs, 32, bitdepth, w, h, idct_cols_8, 8);
+}
+
+//------------------------------------------------------------------------------
+// Intra prediction, see 8.4.4.2
+
+// see 8-38, the vertical part goes down the rows one difference at a time
+void
+x86_hevc_intra_planar_sse4(uint16_t *dst, uint16_t *left, uint16_t *top,
+                           int nTbS, int stride)
+{
+    __m128i v[8], dv[8], wx[8];
+    int shift = log2floor(nTbS) + 1;
+    const __m128i bl = _mm_set1_epi32(left[nTbS]);
+    for (int i = 0; i < nTbS / 4; i++) {
+        __m128i t = _mm_cvtepu16_epi32(_mm_loadl_epi64((const __m128i *)(top + 4 * i)));
+        v[i] = _mm_add_epi32(_mm_mullo_epi32(t, _mm_set1_epi32(nTbS - 1)),
+                             _mm_add_epi32(bl, _mm_set1_epi32(nTbS)));
+        dv[i] = _mm_sub_epi32(bl, t);
+        wx[i] = _mm_setr_epi32(4 * i + 1, 4 * i + 2, 4 * i + 3, 4 * i + 4);
+    }
+    for (int y = 0; y < nTbS; y++, dst += stride) {
+        // (nTbS - 1 - x) * left + (x + 1) * topright
+        const __m128i h = _mm_set1_epi32(nTbS * left[y]);
+        const __m128i dh = _mm_set1_epi32(top[nTbS] - left[y]);
+        __m128i s[8];
+        for (int i = 0; i < nTbS / 4; i++) {
+            s[i] = _mm_add_epi32(_mm_add_epi32(h, v[i]), _mm_mullo_epi32(wx[i], dh));
+            s[i] = _mm_srli_epi32(s[i], shift);
+            v[i] = _mm_add_epi32(v[i], dv[i]);
+        }
+        if (nTbS == 4) {
+            _mm_storel_epi64((__m128i *)dst, _mm_packus_epi32(s[0], s[0]));
+            continue;
+        }
+        for (int i = 0; i < nTbS / 4; i += 2) {
+            _mm_storeu_si128((__m128i *)(dst + 4 * i),
+                             _mm_packus_epi32(s[i], s[i + 1]));
+        }
+    }
+}
+
+// see 8-40 to 8-44, the edges with the filter are few enough to do in C
+void
+x86_hevc_intra_dc_sse4(uint16_t *dst, uint16_t *left, uint16_t *top, int nTbS,
+                       int stride, int cIdx,
+                       int intra_boundary_filtering_disabled_flag)
+{
+    __m128i sum = _mm_setzero_si128();
+    for (int i = 0; i < nTbS; i += 4) {
+        sum = _mm_add_epi32(sum, _mm_cvtepu16_epi32(_mm_loadl_epi64((const __m128i *)(left + i))));
+        sum = _mm_add_epi32(sum, _mm_cvtepu16_epi32(_mm_loadl_epi64((const __m128i *)(top + i))));
+    }
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4E));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xB1));
+    int shift = log2floor(nTbS) + 1;
+    int dc = (_mm_cvtsi128_si32(sum) + (1 << (shift - 1))) >> shift;
+
+    const __m128i v = _mm_set1_epi16(dc);
+    for (int y = 0; y < nTbS; y++) {
+        if (nTbS == 4) {
+            _mm_storel_epi64((__m128i *)(dst + y * stride), v);
+            continue;
+        }
+        for (int x = 0; x < nTbS; x += 8) {
+            _mm_storeu_si128((__m128i *)(dst + y * stride + x), v);
+        }
+    }
+    if (cIdx == 0 && nTbS < 32 && intra_boundary_filtering_disabled_flag == 0) {
+        dst[0] = (left[0] + 2 * dc + top[0] + 2) >> 2;
+        for (int x = 1; x < nTbS; x++) {
+            dst[x] = (top[x] + 3 * dc + 2) >> 2;
+        }
+        for (int y = 1; y < nTbS; y++) {
+            dst[y * stride] = (left[y] + 3 * dc + 2) >> 2;
+        }
+    }
+}
+
+/* the reference sample line of 8.4.4.2.6 for the main direction of the mode,
+ * ref[0] is the top left sample and negative indexes are projected from the
+ * other side. Returns intraPredAngle.
+ */
+static int
+intra_ref(uint16_t *ref, const uint16_t *left, const uint16_t *top, int nTbS,
+          int predModeIntra)
+{
+    static const int8_t intraPredAngle[33] = {
+        32, 26, 21, 17, 13, 9, 5, 2, 0, -2, -5, -9, -13, -17, -21, -26, -32,
+        -26, -21, -17, -13, -9, -5, -2, 0, 2, 5, 9, 13, 17, 21, 26, 32
+    };
+    static const int16_t invAngle[15] = {
+        -4096, -1638, -910, -630, -482, -390, -315, -256, -315, -390, -482,
+        -630, -910, -1638, -4096
+    };
+    int angle = intraPredAngle[predModeIntra - 2];
+    const uint16_t *side;
+    if (predModeIntra >= 18) {
+        memcpy(ref, top - 1, (2 * nTbS + 1) * sizeof(uint16_t));
+        side = left;
+    } else {
+        ref[0] = top[-1];
+        memcpy(ref + 1, left, 2 * nTbS * sizeof(uint16_t));
+        side = top;
+    }
+    if (angle < 0 && ((nTbS * angle) >> 5) < -1) {
+        int inv = invAngle[predModeIntra - 11];
+        for (int x = -1; x >= ((nTbS * angle) >> 5); x--) {
+            int i = (x * inv + 128) >> 8;
+            ref[x] = i ? side[i - 1] : ref[0];
+        }
+    }
+    return angle;
+}
+
+// rows of a vertical mode, two taps on interleaved neighbours for madd
+static void
+intra_rows_8(uint16_t *dst, int stride, const uint16_t *ref, int nTbS,
+             int angle)
+{
+    const __m128i rnd = _mm_set1_epi32(16);
+    for (int y = 0; y < nTbS; y++, dst += stride) {
+        int iIdx = ((y + 1) * angle) >> 5;
+        int iFact = ((y + 1) * angle) & 31;
+        const uint16_t *r = ref + iIdx + 1;
+        if (nTbS == 4) {
+            __m128i a = _mm_loadl_epi64((const __m128i *)r);
+            if (iFact) {
+                __m128i b = _mm_loadl_epi64((const __m128i *)(r + 1));
+                __m128i s = _mm_madd_epi16(_mm_unpacklo_epi16(a, b),
+                                           pair16(32 - iFact, iFact));
+                s = _mm_srli_epi32(_mm_add_epi32(s, rnd), 5);
+                a = _mm_packus_epi32(s, s);
+            }
+            _mm_storel_epi64((__m128i *)dst, a);
+            continue;
+        }
+        if (iFact == 0) {
+            // the pure vertical and the diagonal modes, and every 32nd row
+            for (int x = 0; x < nTbS; x += 8) {
+                _mm_storeu_si128((__m128i *)(dst + x),
+                                 _mm_loadu_si128((const __m128i *)(r + x)));
+            }
+            continue;
+        }
+        const __m128i w = pair16(32 - iFact, iFact);
+        for (int x = 0; x < nTbS; x += 8) {
+            __m128i a = _mm_loadu_si128((const __m128i *)(r + x));
+            __m128i b = _mm_loadu_si128((const __m128i *)(r + x + 1));
+            __m128i lo = _mm_madd_epi16(_mm_unpacklo_epi16(a, b), w);
+            __m128i hi = _mm_madd_epi16(_mm_unpackhi_epi16(a, b), w);
+            lo = _mm_srli_epi32(_mm_add_epi32(lo, rnd), 5);
+            hi = _mm_srli_epi32(_mm_add_epi32(hi, rnd), 5);
+            _mm_storeu_si128((__m128i *)(dst + x), _mm_packus_epi32(lo, hi));
+        }
+    }
+}
+
+static void
+transpose_4x4(const uint16_t *src, int sstride, uint16_t *dst, int dstride)
+{
+    __m128i a0 = _mm_loadl_epi64((const __m128i *)src);
+    __m128i a1 = _mm_loadl_epi64((const __m128i *)(src + sstride));
+    __m128i a2 = _mm_loadl_epi64((const __m128i *)(src + 2 * sstride));
+    __m128i a3 = _mm_loadl_epi64((const __m128i *)(src + 3 * sstride));
+    __m128i b0 = _mm_unpacklo_epi16(a0, a1);
+    __m128i b1 = _mm_unpacklo_epi16(a2, a3);
+    __m128i c0 = _mm_unpacklo_epi32(b0, b1);
+    __m128i c1 = _mm_unpackhi_epi32(b0, b1);
+    _mm_storel_epi64((__m128i *)dst, c0);
+    _mm_storel_epi64((__m128i *)(dst + dstride), _mm_srli_si128(c0, 8));
+    _mm_storel_epi64((__m128i *)(dst + 2 * dstride), c1);
+    _mm_storel_epi64((__m128i *)(dst + 3 * dstride), _mm_srli_si128(c1, 8));
+}
+
+/* see 8.4.4.2.6. rows() predicts a vertical mode, the horizontal ones are
+ * predicted the same way from the left samples and transposed
+ */
+void
+x86_hevc_intra_angular(uint16_t *dst, uint16_t *left, uint16_t *top, int nTbS,
+                       int stride, int cIdx, int predModeIntra,
+                       int disableIntraBoundaryFilter, int bitdepth,
+                       x86_hevc_intra_rows rows)
+{
+    uint16_t refs[32 + 2 * 32 + 1 + 16];
+    uint16_t tmp[32 * 32];
+    uint16_t *ref = refs + 32;
+    int filter = (cIdx == 0 && nTbS < 32 && disableIntraBoundaryFilter == 0);
+    int maxval = (1 << bitdepth) - 1;
+
+    if (predModeIntra == 10) {
+        // pure horizontal, every row is one sample
+        for (int y = 0; y < nTbS; y++) {
+            const __m128i v = _mm_set1_epi16(left[y]);
+            if (nTbS == 4) {
+                _mm_storel_epi64((__m128i *)(dst + y * stride), v);
+                continue;
+            }
+            for (int x = 0; x < nTbS; x += 8) {
+                _mm_storeu_si128((__m128i *)(dst + y * stride + x), v);
+            }
+        }
+        if (filter) {
+            for (int x = 0; x < nTbS; x++) {
+                dst[x] = clip3(0, maxval, left[0] + ((top[x] - top[-1]) >> 1));
+            }
+        }
+        return;
+    }
+    int angle = intra_ref(ref, left, top, nTbS, predModeIntra);
+    if (predModeIntra >= 18) {
+        rows(dst, stride, ref, nTbS, angle);
+        if (predModeIntra == 26 && filter) {
+            for (int y = 0; y < nTbS; y++) {
+                dst[y * stride] = clip3(0, maxval, top[0] + ((left[y] - top[-1]) >> 1));
+            }
+        }
+        return;
+    }
+    rows(tmp, nTbS, ref, nTbS, angle);
+    if (nTbS == 4) {
+        transpose_4x4(tmp, 4, dst, stride);
+        return;
+    }
+    for (int y = 0; y < nTbS; y += 8) {
+        for (int x = 0; x < nTbS; x += 8) {
+            transpose_8x8(tmp + y * nTbS + x, nTbS, dst + x * stride + y, stride);
+        }
+    }
+}
+
+void
+x86_hevc_intra_angular_sse4(uint16_t *dst, uint16_t *left, uint16_t *top,
+                            int nTbS, int stride, int cIdx, int predModeIntra,
+                            int disableIntraBoundaryFilter, int bitdepth)
+{
+    x86_hevc_intra_angular(dst, left, top, nTbS, stride, cIdx, predModeIntra,
+                           disableIntraBoundaryFilter, bitdepth, intra_rows_8);
+}
+
+/* [1 2 1] over the line of the left samples bottom up, the top left one
+ * and the top samples. (a + 2b + c + 2) >> 2 is (((a + c) >> 1) + b + 1) >> 1,
+ * which stays in 16 bits.
+ */
+static void
+intra_filter_sse4(uint16_t *left, uint16_t *top, int nTbS)
+{
+    const __m128i rev = _mm_setr_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5,
+                                      2, 3, 0, 1);
+    const __m128i one = _mm_set1_epi16(1);
+    uint16_t line[8 + 4 * 32 + 1 + 16], out[4 * 32 + 1 + 8];
+    uint16_t *c = line + 8;
+    int n2 = 2 * nTbS;
+
+    if (nTbS < 8) {
+        hevc_intra_filter(left, top, nTbS);
+        return;
+    }
+    for (int y = 0; y < n2; y += 8) {
+        __m128i l = _mm_loadu_si128((const __m128i *)(left + y));
+        _mm_storeu_si128((__m128i *)(c + n2 - 8 - y), _mm_shuffle_epi8(l, rev));
+    }
+    memcpy(c + n2, top - 1, (n2 + 1) * sizeof(uint16_t));
+    memset(line, 0, 8 * sizeof(uint16_t));
+    memset(c + 2 * n2 + 1, 0, 16 * sizeof(uint16_t));
+    for (int i = 0; i <= 2 * n2; i += 8) {
+        __m128i a = _mm_loadu_si128((const __m128i *)(c + i - 1));
+        __m128i b = _mm_loadu_si128((const __m128i *)(c + i));
+        __m128i d = _mm_loadu_si128((const __m128i *)(c + i + 1));
+        __m128i s = _mm_srli_epi16(_mm_add_epi16(a, d), 1);
+        s = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(s, b), one), 1);
+        _mm_storeu_si128((__m128i *)(out + i), s);
+    }
+    // the ends are not filtered
+    out[0] = c[0];
+    out[2 * n2] = c[2 * n2];
+    for (int y = 0; y < n2; y += 8) {
+        __m128i l = _mm_loadu_si128((const __m128i *)(out + n2 - 8 - y));
+        _mm_storeu_si128((__m128i *)(left + y), _mm_shuffle_epi8(l, rev));
+    }
+    memcpy(top - 1, out + n2, (n2 + 1) * sizeof(uint16_t));
+}
+
+// 64 * tl + (i + 1) * (end - tl) for nTbS 32, the corners stay as they are
+static void
+intra_strong_filter_sse4(uint16_t *left, uint16_t *top, int nTbS)
+{
+    int last = nTbS * 2 - 1;
+    int tl = top[-1];
+    const __m128i base = _mm_set1_epi32((last + 1) * tl + 32);
+    const __m128i dl = _mm_set1_epi32(left[last] - tl);
+    const __m128i dt = _mm_set1_epi32(top[last] - tl);
+    const int shift = 6;
+
+    // the last sample gives back the end point, so the loop covers it
+    for (int i = 0; i <= last; i += 8) {
+        __m128i k0 = _mm_setr_epi32(i + 1, i + 2, i + 3, i + 4);
+        __m128i k1 = _mm_add_epi32(k0, _mm_set1_epi32(4));
+        __m128i l0 = _mm_srai_epi32(_mm_add_epi32(base, _mm_mullo_epi32(k0, dl)), shift);
+        __m128i l1 = _mm_srai_epi32(_mm_add_epi32(base, _mm_mullo_epi32(k1, dl)), shift);
+        __m128i t0 = _mm_srai_epi32(_mm_add_epi32(base, _mm_mullo_epi32(k0, dt)), shift);
+        __m128i t1 = _mm_srai_epi32(_mm_add_epi32(base, _mm_mullo_epi32(k1, dt)), shift);
+        _mm_storeu_si128((__m128i *)(left + i), _mm_packus_epi32(l0, l1));
+        _mm_storeu_si128((__m128i *)(top + i), _mm_packus_epi32(t0, t1));
+    }
+}
+
+//------------------------------------------------------------------------------
+// Inter prediction, see 8.5.3.3, 8 samples a time
+
+/* taps / 2 madd pairs of the filter f over src[0], src[step], ..., sums of
+ * the first 4 columns go to lo, of the next 4 to hi
+ */
+static inline void
+mc_taps8(const int16_t *src, int step, const __m128i *c, int pairs,
+         __m128i *lo, __m128i *hi)
+{
+    __m128i l = _mm_setzero_si128(), h = _mm_setzero_si128();
+    for (int k = 0; k < pairs; k++) {
+        const __m128i a = _mm_loadu_si128((const __m128i *)(src + 2 * k * step));
+        const __m128i b = _mm_loadu_si128((const __m128i *)(src + (2 * k + 1) * step));
+        l = _mm_add_epi32(l, _mm_madd_epi16(_mm_unpacklo_epi16(a, b), c[k]));
+        h = _mm_add_epi32(h, _mm_madd_epi16(_mm_unpackhi_epi16(a, b), c[k]));
+    }
+    *lo = l;
+    *hi = h;
+}
+
+static inline __m128i
+mc_taps4(const int16_t *src, int step, const __m128i *c, int pairs)
+{
+    __m128i l = _mm_setzero_si128();
+    for (int k = 0; k < pairs; k++) {
+        const __m128i a = _mm_loadl_epi64((const __m128i *)(src + 2 * k * step));
+        const __m128i b = _mm_loadl_epi64((const __m128i *)(src + (2 * k + 1) * step));
+        l = _mm_add_epi32(l, _mm_madd_epi16(_mm_unpacklo_epi16(a, b), c[k]));
+    }
+    return l;
+}
+
+void
+x86_hevc_mc_pass_sse4(int16_t *dst, int dststride, const int16_t *src,
+                      int srcstride, int step, int w, int h, const int8_t *f,
+                      int taps, int shift)
+{
+    __m128i c[4];
+    for (int k = 0; k < taps / 2; k++) {
+        c[k] = pair16(f[2 * k], f[2 * k + 1]);
+    }
+    const __m128i sh = _mm_cvtsi32_si128(shift);
+    for (int y = 0; y < h; y++) {
+        int x = 0;
+        for (; x + 8 <= w; x += 8) {
+            __m128i lo, hi;
+            mc_taps8(src + x, step, c, taps / 2, &lo, &hi);
+            _mm_storeu_si128((__m128i *)(dst + x),
+                             _mm_packs_epi32(_mm_sra_epi32(lo, sh),
+                                             _mm_sra_epi32(hi, sh)));
+        }
+        if (x + 4 <= w) {
+            const __m128i lo = _mm_sra_epi32(mc_taps4(src + x, step, c, taps / 2), sh);
+            _mm_storel_epi64((__m128i *)(dst + x), _mm_packs_epi32(lo, lo));
+            x += 4;
+        }
+        // 2 or 6 wide chroma
+        for (; x < w; x++) {
+            int sum = 0;
+            for (int i = 0; i < taps; i++) {
+                sum += f[i] * src[x + i * step];
+            }
+            dst[x] = sum >> shift;
+        }
+        dst += dststride;
+        src += srcstride;
+    }
+}
+
+void
+x86_hevc_mc(int16_t *dst, int dststride, const int16_t *src, int srcstride,
+            int w, int h, const int8_t *fx, const int8_t *fy, int taps,
+            int bitdepth, x86_hevc_mc_pass pass)
+{
+    int shift1 = MIN(4, bitdepth - 8);
+    int back = taps / 2 - 1;
+    if (!fx && !fy) {
+        const __m128i sh = _mm_cvtsi32_si128(MAX(2, 14 - bitdepth));
+        for (int y = 0; y < h; y++, dst += dststride, src += srcstride) {
+            int x = 0;
+            for (; x + 8 <= w; x += 8) {
+                const __m128i s = _mm_loadu_si128((const __m128i *)(src + x));
+                _mm_storeu_si128((__m128i *)(dst + x), _mm_sll_epi16(s, sh));
+            }
+            for (; x < w; x++) {
+                dst[x] = src[x] << MAX(2, 14 - bitdepth);
+            }
+        }
+    } else if (!fy) {
+        pass(dst, dststride, src - back, srcstride, 1, w, h, fx, taps, shift1);
+    } else if (!fx) {
+        pass(dst, dststride, src - back * srcstride, srcstride, srcstride, w,
+             h, fy, taps, shift1);
+    } else {
+        int16_t tmp[(64 + 7) * 64];
+        pass(tmp, 64, src - back * srcstride - back, srcstride, 1, w,
+             h + taps - 1, fx, taps, shift1);
+        pass(dst, dststride, tmp, 64, 64, w, h, fy, taps, 6);
+    }
+}
+
+static void
+mc_luma_sse4(int16_t *dst, int dststride, const int16_t *src, int srcstride,
+             int w, int h, int mx, int my, int bitdepth)
+{
+    x86_hevc_mc(dst, dststride, src, srcstride, w, h,
+                mx ? hevc_luma_filter[mx] : NULL,
+                my ? hevc_luma_filter[my] : NULL, 8, bitdepth,
+                x86_hevc_mc_pass_sse4);
+}
+
+static void
+mc_chroma_sse4(int16_t *dst, int dststride, const int16_t *src,
+               int srcstride, int w, int h, int mx, int my, int bitdepth)
+{
+    x86_hevc_mc(dst, dststride, src, srcstride, w, h,
+                mx ? hevc_chroma_filter[mx] : NULL,
+                my ? hevc_chroma_filter[my] : NULL, 4, bitdepth,
+                x86_hevc_mc_pass_sse4);
+}
+
+/* the rounding shift of the default weighting with pmulhrsw, which is
+ * (v * (1 << (15 - shift)) + (1 << 14)) >> 15, the same as the spec without
+ * the 16 bit overflow of the offset
+ */
+void
+x86_hevc_pred_uni_sse4(int16_t *dst, int dststride, const int16_t *src,
+                       int srcstride, int w, int h, int bitdepth)
+{
+    const __m128i mul = _mm_set1_epi16(1 << (15 - (14 - bitdepth)));
+    const __m128i maxv = _mm_set1_epi16((1 << bitdepth) - 1);
+    const __m128i zero = _mm_setzero_si128();
+    for (int y = 0; y < h; y++, dst += dststride, src += srcstride) {
+        int x = 0;
+        for (; x + 8 <= w; x += 8) {
+            const __m128i s = _mm_loadu_si128((const __m128i *)(src + x));
+            _mm_storeu_si128((__m128i *)(dst + x),
+                             clamp16(_mm_mulhrs_epi16(s, mul), zero, maxv));
+        }
+        if (x + 4 <= w) {
+            const __m128i s = _mm_loadl_epi64((const __m128i *)(src + x));
+            _mm_storel_epi64((__m128i *)(dst + x),
+                             clamp16(_mm_mulhrs_epi16(s, mul), zero, maxv));
+            x += 4;
+        }
+        if (x < w) {
+            hevc_pred_uni_c(dst + x, dststride, src + x, srcstride, w - x, 1,
+                            bitdepth);
+        }
+    }
+}
+
+/* both explicit weightings as (src0 * w0 + src1 * w1 + off) >> shift, the
+ * uni one with w1 0 and its offset ox folded into off as ox << log2WD
+ */
+static void
+pred_w_sse4(int16_t *dst, int dststride, const int16_t *src0,
+            const int16_t *src1, int srcstride, int w, int h, int w0, int w1,
+            int off, int shift, int bitdepth)
+{
+    const __m128i wt = pair16(w0, w1);
+    const __m128i offv = _mm_set1_epi32(off);
+    const __m128i sh = _mm_cvtsi32_si128(shift);
+    const __m128i maxv = _mm_set1_epi16((1 << bitdepth) - 1);
+    const __m128i zero = _mm_setzero_si128();
+    for (int y = 0; y < h; y++) {
+        int x = 0;
+        for (; x + 8 <= w; x += 8) {
+            const __m128i a = _mm_loadu_si128((const __m128i *)(src0 + x));
+            const __m128i b = _mm_loadu_si128((const __m128i *)(src1 + x));
+            const __m128i lo = _mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(a, b), wt), offv);
+            const __m128i hi = _mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(a, b), wt), offv);
+            const __m128i v = _mm_packs_epi32(_mm_sra_epi32(lo, sh), _mm_sra_epi32(hi, sh));
+            _mm_storeu_si128((__m128i *)(dst + x), clamp16(v, zero, maxv));
+        }
+        if (x + 4 <= w) {
+            const __m128i a = _mm_loadl_epi64((const __m128i *)(src0 + x));
+            const __m128i b = _mm_loadl_epi64((const __m128i *)(src1 + x));
+            const __m128i lo = _mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(a, b), wt), offv);
+            const __m128i v = _mm_packs_epi32(_mm_sra_epi32(lo, sh), zero);
+            _mm_storel_epi64((__m128i *)(dst + x), clamp16(v, zero, maxv));
+            x += 4;
+        }
+        for (; x < w; x++) {
+            dst[x] = clip3(0, (1 << bitdepth) - 1,
+                           (src0[x] * w0 + src1[x] * w1 + off) >> shift);
+        }
+        dst += dststride;
+        src0 += srcstride;
+        src1 += srcstride;
+    }
+}
+
+static void
+pred_uni_w_sse4(int16_t *dst, int dststride, const int16_t *src,
+                int srcstride, int w, int h, int log2wd, int wx, int ox,
+                int bitdepth)
+{
+    pred_w_sse4(dst, dststride, src, src, srcstride, w, h, wx, 0,
+                (1 << (log2wd - 1)) + (ox << log2wd), log2wd, bitdepth);
+}
+
+static void
+pred_bi_w_sse4(int16_t *dst, int dststride, const int16_t *src0,
+               const int16_t *src1, int srcstride, int w, int h, int log2wd,
+               int w0, int w1, int o0, int o1, int bitdepth)
+{
+    pred_w_sse4(dst, dststride, src0, src1, srcstride, w, h, w0, w1,
+                (o0 + o1 + 1) << log2wd, log2wd + 1, bitdepth);
+}
+
+void
+x86_hevc_pred_bi_sse4(int16_t *dst, int dststride, const int16_t *src0,
+                      const int16_t *src1, int srcstride, int w, int h,
+                      int bitdepth)
+{
+    // the sum of both goes past 16 bits, so it is done as a weighting by 1
+    int shift = 15 - bitdepth;
+    pred_w_sse4(dst, dststride, src0, src1, srcstride, w, h, 1, 1,
+                1 << (shift - 1), shift, bitdepth);
+}
+
+
+//------------------------------------------------------------------------------
+// Output of the planes as rgb, 8 samples a time
+
+/* u and v of 8 luma samples, centered */
+static inline void
+yuv_load_uv(const int16_t *u, const int16_t *v, int sub, __m128i half,
+            __m128i *cu, __m128i *cv)
+{
+    if (sub) {
+        __m128i a = _mm_loadl_epi64((const __m128i *)u);
+        __m128i b = _mm_loadl_epi64((const __m128i *)v);
+        *cu = _mm_sub_epi16(_mm_unpacklo_epi16(a, a), half);
+        *cv = _mm_sub_epi16(_mm_unpacklo_epi16(b, b), half);
+    } else {
+        *cu = _mm_sub_epi16(_mm_loadu_si128((const __m128i *)u), half);
+        *cv = _mm_sub_epi16(_mm_loadu_si128((const __m128i *)v), half);
+    }
+}
+
+static inline void
+yuv_rgb_8(__m128i y, __m128i u, __m128i v, __m128i *r, __m128i *g, __m128i *b)
+{
+    *r = _mm_add_epi16(_mm_add_epi16(y, v),
+                       _mm_mulhrs_epi16(v, _mm_set1_epi16(HEVC_YUV_R_V)));
+    *g = _mm_add_epi16(y, _mm_add_epi16(
+                              _mm_mulhrs_epi16(u, _mm_set1_epi16(HEVC_YUV_G_U)),
+                              _mm_mulhrs_epi16(v, _mm_set1_epi16(HEVC_YUV_G_V))));
+    *b = _mm_add_epi16(_mm_add_epi16(y, _mm_add_epi16(u, u)),
+                       _mm_mulhrs_epi16(u, _mm_set1_epi16(HEVC_YUV_B_U)));
+}
+
+void
+x86_hevc_yuv_bgra32_sse4(uint8_t *dst, const int16_t *y, const int16_t *u,
+                         const int16_t *v, int width, int sub, int bitdepth)
+{
+    __m128i half = _mm_set1_epi16(1 << (bitdepth - 1));
+    __m128i shift = _mm_cvtsi32_si128(bitdepth - 8);
+    __m128i alpha = _mm_set1_epi16(0xFF);
+    int i = 0;
+    for (; i + 8 <= width; i += 8) {
+        __m128i cu, cv, r, g, b;
+        yuv_load_uv(u + (i >> sub), v + (i >> sub), sub, half, &cu, &cv);
+        yuv_rgb_8(_mm_loadu_si128((const __m128i *)(y + i)), cu, cv, &r, &g, &b);
+        // b0..b7 g0..g7 and r0..r7 a0..a7, then interleaved to pixels
+        __m128i bg = _mm_packus_epi16(_mm_sra_epi16(b, shift), _mm_sra_epi16(g, shift));
+        __m128i ra = _mm_packus_epi16(_mm_sra_epi16(r, shift), alpha);
+        bg = _mm_unpacklo_epi8(bg, _mm_srli_si128(bg, 8));
+        ra = _mm_unpacklo_epi8(ra, _mm_srli_si128(ra, 8));
+        _mm_storeu_si128((__m128i *)(dst + 4 * i), _mm_unpacklo_epi16(bg, ra));
+        _mm_storeu_si128((__m128i *)(dst + 4 * i + 16), _mm_unpackhi_epi16(bg, ra));
+    }
+    if (i < width) {
+        hevc_yuv_bgra32_c(dst + 4 * i, y + i, u + (i >> sub), v + (i >> sub),
+                          width - i, sub, bitdepth);
+    }
+}
+
+void
+x86_hevc_yuv_rgba64_sse4(uint16_t *dst, const int16_t *y, const int16_t *u,
+                         const int16_t *v, int width, int sub, int bitdepth)
+{
+    __m128i half = _mm_set1_epi16(1 << (bitdepth - 1));
+    __m128i maxval = _mm_set1_epi16((1 << bitdepth) - 1);
+    __m128i up = _mm_cvtsi32_si128(16 - bitdepth);
+    __m128i down = _mm_cvtsi32_si128(2 * bitdepth - 16);
+    __m128i alpha = _mm_set1_epi16(-1);
+    int i = 0;
+    for (; i + 8 <= width; i += 8) {
+        __m128i cu, cv, c[3];
+        yuv_load_uv(u + (i >> sub), v + (i >> sub), sub, half, &cu, &cv);
+        yuv_rgb_8(_mm_loadu_si128((const __m128i *)(y + i)), cu, cv, &c[0],
+                  &c[1], &c[2]);
+        for (int k = 0; k < 3; k++) {
+            c[k] = _mm_min_epi16(_mm_max_epi16(c[k], _mm_setzero_si128()), maxval);
+            c[k] = _mm_or_si128(_mm_sll_epi16(c[k], up), _mm_srl_epi16(c[k], down));
+        }
+        __m128i rg0 = _mm_unpacklo_epi16(c[0], c[1]);
+        __m128i rg1 = _mm_unpackhi_epi16(c[0], c[1]);
+        __m128i ba0 = _mm_unpacklo_epi16(c[2], alpha);
+        __m128i ba1 = _mm_unpackhi_epi16(c[2], alpha);
+        __m128i *d = (__m128i *)(dst + 4 * i);
+        _mm_storeu_si128(d, _mm_unpacklo_epi32(rg0, ba0));
+        _mm_storeu_si128(d + 1, _mm_unpackhi_epi32(rg0, ba0));
+        _mm_storeu_si128(d + 2, _mm_unpacklo_epi32(rg1, ba1));
+        _mm_storeu_si128(d + 3, _mm_unpackhi_epi32(rg1, ba1));
+    }
+    if (i < width) {
+        hevc_yuv_rgba64_c(dst + 4 * i, y + i, u + (i >> sub), v + (i >> sub),
+                          width - i, sub, bitdepth);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Emulation prevention, 16 positions checked for 0x000003 at a time
+
+/* bit k set if 0x00 0x00 0x03 starts at p[k], reads p[0..17] */
+static inline int
+epb_mask_16(const uint8_t *p)
+{
+    __m128i zero = _mm_setzero_si128();
+    __m128i a = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)p), zero);
+    __m128i b = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(p + 1)), zero);
+    __m128i c = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(p + 2)),
+                               _mm_set1_epi8(3));
+    return _mm_movemask_epi8(_mm_and_si128(_mm_and_si128(a, b), c));
+}
+
+int
+x86_hevc_unescape_sse4(uint8_t *dst, const uint8_t *src, int len, int *epb,
+                       int *num_epb)
+{
+    int n = 0, start = 0, num = 0, i = 0;
+    while (i + 2 < len) {
+        if (i + 18 <= len) {
+            int mask = epb_mask_16(src + i);
+            if (!mask) {
+                i += 16;
+                continue;
+            }
+            i += __builtin_ctz(mask);
+        } else if (src[i] || src[i + 1] || src[i + 2] != 3) {
+            i++;
+            continue;
+        }
+        memcpy(dst + n, src + start, i + 2 - start);
+        n += i + 2 - start;
+        epb[num++] = n;
+        start = i + 3;
+        i += 3;
+    }
+    memcpy(dst + n, src + start, len - start);
+    *num_epb = num;
+    return n + len - start;
+}
+
+void
+x86_hevc_dsp_init_sse4(struct hevc_dsp *dsp)
+{
+    dsp->luma_edge_ver = luma_edge_ver_sse4;
+    dsp->luma_edge_hor = luma_edge_hor_sse4;
+    dsp->chroma_edge_ver = chroma_edge_ver_sse4;
+    dsp->chroma_edge_hor = chroma_edge_hor_sse4;
+    dsp->sao_band = sao_band_sse4;
+    dsp->sao_edge = sao_edge_sse4;
+    dsp->intra_planar = x86_hevc_intra_planar_sse4;
+    dsp->intra_dc = x86_hevc_intra_dc_sse4;
+    dsp->intra_angular = x86_hevc_intra_angular_sse4;
+    dsp->intra_filter = intra_filter_sse4;
+    dsp->intra_strong_filter = intra_strong_filter_sse4;
+    dsp->mc_luma = mc_luma_sse4;
+    dsp->mc_chroma = mc_chroma_sse4;
+    dsp->pred_uni = x86_hevc_pred_uni_sse4;
+    dsp->pred_bi = x86_hevc_pred_bi_sse4;
+    dsp->pred_uni_w = pred_uni_w_sse4;
+    dsp->pred_bi_w = pred_bi_w_sse4;
+    dsp->yuv_bgra32 = x86_hevc_yuv_bgra32_sse4;
+    dsp->yuv_rgba64 = x86_hevc_yuv_rgba64_sse4;
+    dsp->unescape = x86_hevc_unescape_sse4;
+}
+
+#endif
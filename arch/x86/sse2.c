@@ -183,6 +183,13 @@ static void x86_idct_4x4_sse2_16bit(int16_t *in, int bitdepth UNUSED) {
 
 static struct accl_ops sse2_accl_16bit = {
     .idct_4x4 = x86_idct_4x4_sse2_16bit,
+#ifdef __SSE4_1__
+    .hevc_idst_4x4 = x86_hevc_idst_4x4_sse4,
+    .hevc_idct_4x4 = x86_hevc_idct_4x4_sse4,
+    .hevc_idct_8x8 = x86_hevc_idct_8x8_sse4,
+    .hevc_idct_16x16 = x86_hevc_idct_16x16_sse4,
+    .hevc_idct_32x32 = x86_hevc_idct_32x32_sse4,
+#endif
     .type = SIMD_TYPE_SSE2,
 };
 
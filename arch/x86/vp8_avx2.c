@@ -0,0 +1,114 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "x86.h"
+#include "vp8dsp.h"
+#include "utils.h"
+
+#ifdef __AVX2__
+
+// 16 words per row, two rows per store
+static void
+pred_TM_16_avx2(uint8_t *dst, uint8_t *top, uint8_t *left, int stride,
+                int x UNUSED, int y UNUSED)
+{
+    const __m256i t = _mm256_cvtepu8_epi16(
+        _mm_loadu_si128((const __m128i *)top));
+    const int tl = top[-1];
+    for (int j = 0; j < 16; j += 2) {
+        const __m256i r0 = _mm256_add_epi16(t, _mm256_set1_epi16(left[j] - tl));
+        const __m256i r1 =
+            _mm256_add_epi16(t, _mm256_set1_epi16(left[j + 1] - tl));
+        // r0 lo, r1 lo | r0 hi, r1 hi
+        const __m256i v = _mm256_permute4x64_epi64(_mm256_packus_epi16(r0, r1),
+                                                   _MM_SHUFFLE(3, 1, 2, 0));
+        _mm_storeu_si128((__m128i *)dst, _mm256_castsi256_si128(v));
+        _mm_storeu_si128((__m128i *)(dst + stride),
+                         _mm256_extracti128_si256(v, 1));
+        dst += 2 * stride;
+    }
+}
+
+// the same for both chroma planes in one go is not possible with the
+// per plane predictor, so only 8 words per row are used, four rows at once
+static void
+pred_TM_UV_avx2(uint8_t *dst, uint8_t *top, uint8_t *left, int stride,
+                int x UNUSED, int y UNUSED)
+{
+    const __m128i t8 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)top));
+    const __m256i t = _mm256_broadcastsi128_si256(t8);
+    const int tl = top[-1];
+    for (int j = 0; j < 8; j += 4) {
+        const __m256i b01 = _mm256_setr_m128i(_mm_set1_epi16(left[j] - tl),
+                                              _mm_set1_epi16(left[j + 1] - tl));
+        const __m256i b23 = _mm256_setr_m128i(_mm_set1_epi16(left[j + 2] - tl),
+                                              _mm_set1_epi16(left[j + 3] - tl));
+        // row0, row2 | row1, row3
+        const __m256i v = _mm256_packus_epi16(_mm256_add_epi16(t, b01),
+                                              _mm256_add_epi16(t, b23));
+        const __m128i lo = _mm256_castsi256_si128(v);
+        const __m128i hi = _mm256_extracti128_si256(v, 1);
+        _mm_storel_epi64((__m128i *)dst, lo);
+        _mm_storel_epi64((__m128i *)(dst + stride), hi);
+        _mm_storel_epi64((__m128i *)(dst + 2 * stride), _mm_unpackhi_epi64(lo, lo));
+        _mm_storel_epi64((__m128i *)(dst + 3 * stride), _mm_unpackhi_epi64(hi, hi));
+        dst += 4 * stride;
+    }
+}
+
+// four 4x4 blocks side by side per group of four rows, the vertical
+// butterflies work on whole rows, the horizontal ones are done by madd and
+// hadd/hsub inside each group of four words
+static int
+satd16x16_avx2(const uint8_t *a, int a_stride, const uint8_t *b, int b_stride)
+{
+    const __m256i one = _mm256_set1_epi16(1);
+    const __m256i pm = _mm256_set1_epi32(0xFFFF0001);  // 1, -1
+    __m256i sum = _mm256_setzero_si256();
+    for (int j = 0; j < 16; j += 4) {
+        __m256i d[4];
+        for (int i = 0; i < 4; i++) {
+            const __m256i x = _mm256_cvtepu8_epi16(
+                _mm_loadu_si128((const __m128i *)(a + (j + i) * a_stride)));
+            const __m256i y = _mm256_cvtepu8_epi16(
+                _mm_loadu_si128((const __m128i *)(b + (j + i) * b_stride)));
+            d[i] = _mm256_sub_epi16(x, y);
+        }
+        const __m256i a0 = _mm256_add_epi16(d[0], d[2]);
+        const __m256i a1 = _mm256_add_epi16(d[1], d[3]);
+        const __m256i a2 = _mm256_sub_epi16(d[1], d[3]);
+        const __m256i a3 = _mm256_sub_epi16(d[0], d[2]);
+        const __m256i v[4] = {
+            _mm256_add_epi16(a0, a1), _mm256_add_epi16(a3, a2),
+            _mm256_sub_epi16(a3, a2), _mm256_sub_epi16(a0, a1),
+        };
+        for (int i = 0; i < 4; i++) {
+            const __m256i s = _mm256_madd_epi16(v[i], one);
+            const __m256i t = _mm256_madd_epi16(v[i], pm);
+            sum = _mm256_add_epi32(sum,
+                                   _mm256_abs_epi32(_mm256_hadd_epi32(s, t)));
+            sum = _mm256_add_epi32(sum,
+                                   _mm256_abs_epi32(_mm256_hsub_epi32(s, t)));
+        }
+    }
+    __m128i s = _mm_add_epi32(_mm256_castsi256_si128(sum),
+                              _mm256_extracti128_si256(sum, 1));
+    s = _mm_add_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(1, 0, 3, 2)));
+    s = _mm_add_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(s);
+}
+
+/* the transforms and the loop filters stay with SSE2: a 4x4 block, a 16
+ * pixel luma edge or the u and v edges together fill one xmm register, and
+ * each inner edge of a macroblock filters pixels the one before changed,
+ * so there is no second block to put in the upper lane
+ */
+void
+x86_vp8_dsp_init_avx2(struct vp8_dsp *dsp)
+{
+    dsp->pred_luma16[TM_PRED] = pred_TM_16_avx2;
+    dsp->pred_chroma8[TM_PRED] = pred_TM_UV_avx2;
+    dsp->satd16x16 = satd16x16_avx2;
+}
+
+#endif
@@ -0,0 +1,1087 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "x86.h"
+#include "vp8dsp.h"
+#include "utils.h"
+
+#ifdef __SSE2__
+
+static inline __m128i
+load_u32(const uint8_t *p)
+{
+    int32_t v;
+    memcpy(&v, p, 4);
+    return _mm_cvtsi32_si128(v);
+}
+
+static inline void
+store_u32(uint8_t *p, __m128i v)
+{
+    int32_t x = _mm_cvtsi128_si32(v);
+    memcpy(p, &x, 4);
+}
+
+//------------------------------------------------------------------------------
+// Transforms
+
+// Transpose a 4x4 16b matrix held in the low half of each register
+static inline void
+transpose_4x4_16b(const __m128i *in0, const __m128i *in1, const __m128i *in2,
+                  const __m128i *in3, __m128i *out0, __m128i *out1,
+                  __m128i *out2, __m128i *out3)
+{
+    // a00 a01 a02 a03   x x x x
+    // a10 a11 a12 a13   x x x x
+    // a20 a21 a22 a23   x x x x
+    // a30 a31 a32 a33   x x x x
+    const __m128i t0 = _mm_unpacklo_epi16(*in0, *in1);
+    const __m128i t1 = _mm_unpacklo_epi16(*in2, *in3);
+    // a00 a10 a01 a11   a02 a12 a03 a13
+    // a20 a30 a21 a31   a22 a32 a23 a33
+    const __m128i t2 = _mm_unpacklo_epi32(t0, t1);
+    const __m128i t3 = _mm_unpackhi_epi32(t0, t1);
+    // a00 a10 a20 a30   a01 a11 a21 a31
+    // a02 a12 a22 a32   a03 a13 a23 a33
+    *out0 = t2;
+    *out1 = _mm_unpackhi_epi64(t2, t2);
+    *out2 = t3;
+    *out3 = _mm_unpackhi_epi64(t3, t3);
+}
+
+static void
+vp8_transform_sse2(const int16_t *in, uint8_t *dst, int stride)
+{
+    // 16-bit fixed point versions of the two multiply constants:
+    //    K1 = sqrt(2) * cos (pi/8) ~= 85627 / 2^16
+    //    K2 = sqrt(2) * sin (pi/8) ~= 35468 / 2^16
+    // they are kept in range by subtracting one, so
+    //    (x * K) >> 16 = ((x * k) >> 16) + x
+    const __m128i k1 = _mm_set1_epi16(20091);
+    const __m128i k2 = _mm_set1_epi16(-30068);
+    const __m128i zero = _mm_setzero_si128();
+    __m128i T0, T1, T2, T3;
+
+    const __m128i in0 = _mm_loadl_epi64((const __m128i *)&in[0]);
+    const __m128i in1 = _mm_loadl_epi64((const __m128i *)&in[4]);
+    const __m128i in2 = _mm_loadl_epi64((const __m128i *)&in[8]);
+    const __m128i in3 = _mm_loadl_epi64((const __m128i *)&in[12]);
+
+    // Vertical pass and subsequent transpose.
+    {
+        const __m128i a = _mm_add_epi16(in0, in2);
+        const __m128i b = _mm_sub_epi16(in0, in2);
+        // c = MUL(in1, K2) - MUL(in3, K1)
+        const __m128i c1 = _mm_mulhi_epi16(in1, k2);
+        const __m128i c2 = _mm_mulhi_epi16(in3, k1);
+        const __m128i c3 = _mm_sub_epi16(in1, in3);
+        const __m128i c4 = _mm_sub_epi16(c1, c2);
+        const __m128i c = _mm_add_epi16(c3, c4);
+        // d = MUL(in1, K1) + MUL(in3, K2)
+        const __m128i d1 = _mm_mulhi_epi16(in1, k1);
+        const __m128i d2 = _mm_mulhi_epi16(in3, k2);
+        const __m128i d3 = _mm_add_epi16(in1, in3);
+        const __m128i d4 = _mm_add_epi16(d1, d2);
+        const __m128i d = _mm_add_epi16(d3, d4);
+
+        const __m128i tmp0 = _mm_add_epi16(a, d);
+        const __m128i tmp1 = _mm_add_epi16(b, c);
+        const __m128i tmp2 = _mm_sub_epi16(b, c);
+        const __m128i tmp3 = _mm_sub_epi16(a, d);
+        transpose_4x4_16b(&tmp0, &tmp1, &tmp2, &tmp3, &T0, &T1, &T2, &T3);
+    }
+
+    // Horizontal pass and subsequent transpose.
+    {
+        const __m128i four = _mm_set1_epi16(4);
+        const __m128i dc = _mm_add_epi16(T0, four);
+        const __m128i a = _mm_add_epi16(dc, T2);
+        const __m128i b = _mm_sub_epi16(dc, T2);
+        const __m128i c1 = _mm_mulhi_epi16(T1, k2);
+        const __m128i c2 = _mm_mulhi_epi16(T3, k1);
+        const __m128i c3 = _mm_sub_epi16(T1, T3);
+        const __m128i c4 = _mm_sub_epi16(c1, c2);
+        const __m128i c = _mm_add_epi16(c3, c4);
+        const __m128i d1 = _mm_mulhi_epi16(T1, k1);
+        const __m128i d2 = _mm_mulhi_epi16(T3, k2);
+        const __m128i d3 = _mm_add_epi16(T1, T3);
+        const __m128i d4 = _mm_add_epi16(d1, d2);
+        const __m128i d = _mm_add_epi16(d3, d4);
+
+        const __m128i tmp0 = _mm_srai_epi16(_mm_add_epi16(a, d), 3);
+        const __m128i tmp1 = _mm_srai_epi16(_mm_add_epi16(b, c), 3);
+        const __m128i tmp2 = _mm_srai_epi16(_mm_sub_epi16(b, c), 3);
+        const __m128i tmp3 = _mm_srai_epi16(_mm_sub_epi16(a, d), 3);
+        transpose_4x4_16b(&tmp0, &tmp1, &tmp2, &tmp3, &T0, &T1, &T2, &T3);
+    }
+
+    // Add inverse transform to 'dst' and store.
+    {
+        __m128i dst0 = _mm_unpacklo_epi8(load_u32(dst + 0 * stride), zero);
+        __m128i dst1 = _mm_unpacklo_epi8(load_u32(dst + 1 * stride), zero);
+        __m128i dst2 = _mm_unpacklo_epi8(load_u32(dst + 2 * stride), zero);
+        __m128i dst3 = _mm_unpacklo_epi8(load_u32(dst + 3 * stride), zero);
+        dst0 = _mm_add_epi16(dst0, T0);
+        dst1 = _mm_add_epi16(dst1, T1);
+        dst2 = _mm_add_epi16(dst2, T2);
+        dst3 = _mm_add_epi16(dst3, T3);
+        store_u32(dst + 0 * stride, _mm_packus_epi16(dst0, dst0));
+        store_u32(dst + 1 * stride, _mm_packus_epi16(dst1, dst1));
+        store_u32(dst + 2 * stride, _mm_packus_epi16(dst2, dst2));
+        store_u32(dst + 3 * stride, _mm_packus_epi16(dst3, dst3));
+    }
+}
+
+static void
+vp8_transform_dc_sse2(const int16_t *in, uint8_t *dst, int stride)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dc = _mm_set1_epi16((int16_t)((in[0] + 4) >> 3));
+    for (int j = 0; j < 4; j++) {
+        __m128i d = _mm_unpacklo_epi8(load_u32(dst), zero);
+        d = _mm_add_epi16(d, dc);
+        store_u32(dst, _mm_packus_epi16(d, d));
+        dst += stride;
+    }
+}
+
+static inline __m128i
+load_4x16b_as_32b(const int16_t *in)
+{
+    const __m128i v = _mm_loadl_epi64((const __m128i *)in);
+    return _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+}
+
+static void
+vp8_transform_wht_sse2(const int16_t *in, int16_t *out)
+{
+    const __m128i three = _mm_set1_epi32(3);
+    const __m128i r0 = load_4x16b_as_32b(in + 0);
+    const __m128i r1 = load_4x16b_as_32b(in + 4);
+    const __m128i r2 = load_4x16b_as_32b(in + 8);
+    const __m128i r3 = load_4x16b_as_32b(in + 12);
+    int16_t tmp[16];
+
+    // vertical pass, one column per lane
+    const __m128i a0 = _mm_add_epi32(r0, r3);
+    const __m128i a1 = _mm_add_epi32(r1, r2);
+    const __m128i a2 = _mm_sub_epi32(r1, r2);
+    const __m128i a3 = _mm_sub_epi32(r0, r3);
+    const __m128i t0 = _mm_add_epi32(a0, a1);
+    const __m128i t1 = _mm_add_epi32(a3, a2);
+    const __m128i t2 = _mm_sub_epi32(a0, a1);
+    const __m128i t3 = _mm_sub_epi32(a3, a2);
+
+    // transpose, so each lane is a row
+    const __m128i u0 = _mm_unpacklo_epi32(t0, t1);
+    const __m128i u1 = _mm_unpacklo_epi32(t2, t3);
+    const __m128i u2 = _mm_unpackhi_epi32(t0, t1);
+    const __m128i u3 = _mm_unpackhi_epi32(t2, t3);
+    const __m128i c0 = _mm_unpacklo_epi64(u0, u1);
+    const __m128i c1 = _mm_unpackhi_epi64(u0, u1);
+    const __m128i c2 = _mm_unpacklo_epi64(u2, u3);
+    const __m128i c3 = _mm_unpackhi_epi64(u2, u3);
+
+    // horizontal pass
+    const __m128i b0 = _mm_add_epi32(_mm_add_epi32(c0, c3), three);
+    const __m128i b1 = _mm_add_epi32(c1, c2);
+    const __m128i b2 = _mm_sub_epi32(c1, c2);
+    const __m128i b3 = _mm_add_epi32(_mm_sub_epi32(c0, c3), three);
+    const __m128i o0 = _mm_srai_epi32(_mm_add_epi32(b0, b1), 3);
+    const __m128i o1 = _mm_srai_epi32(_mm_add_epi32(b3, b2), 3);
+    const __m128i o2 = _mm_srai_epi32(_mm_sub_epi32(b0, b1), 3);
+    const __m128i o3 = _mm_srai_epi32(_mm_sub_epi32(b3, b2), 3);
+
+    // tmp[4 * j + i] is the DC of block 4 * i + j
+    _mm_storeu_si128((__m128i *)&tmp[0], _mm_packs_epi32(o0, o1));
+    _mm_storeu_si128((__m128i *)&tmp[8], _mm_packs_epi32(o2, o3));
+    for (int i = 0; i < 4; i++) {
+        out[64 * i] = tmp[i];
+        out[64 * i + 16] = tmp[4 + i];
+        out[64 * i + 32] = tmp[8 + i];
+        out[64 * i + 48] = tmp[12 + i];
+    }
+}
+
+//------------------------------------------------------------------------------
+// Intra predictions
+
+// (a + 2 * b + c + 2) >> 2 on bytes, without widening
+static inline __m128i
+avg3_u8(__m128i a, __m128i b, __m128i c)
+{
+    const __m128i one = _mm_set1_epi8(1);
+    const __m128i ac = _mm_avg_epu8(a, c);
+    const __m128i lsb = _mm_and_si128(_mm_xor_si128(a, c), one);
+    return _mm_avg_epu8(_mm_subs_epu8(ac, lsb), b);
+}
+
+static inline void
+pred_TM_sse2(uint8_t *dst, const uint8_t *top, const uint8_t *left, int size,
+             int stride)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const int tl = top[-1];
+    if (size == 4) {
+        const __m128i t = _mm_unpacklo_epi8(load_u32(top), zero);
+        for (int y = 0; y < 4; y++) {
+            const __m128i v = _mm_add_epi16(t, _mm_set1_epi16(left[y] - tl));
+            store_u32(dst, _mm_packus_epi16(v, v));
+            dst += stride;
+        }
+    } else if (size == 8) {
+        const __m128i t = _mm_unpacklo_epi8(
+            _mm_loadl_epi64((const __m128i *)top), zero);
+        for (int y = 0; y < 8; y++) {
+            const __m128i v = _mm_add_epi16(t, _mm_set1_epi16(left[y] - tl));
+            _mm_storel_epi64((__m128i *)dst, _mm_packus_epi16(v, v));
+            dst += stride;
+        }
+    } else {
+        const __m128i t = _mm_loadu_si128((const __m128i *)top);
+        const __m128i lo = _mm_unpacklo_epi8(t, zero);
+        const __m128i hi = _mm_unpackhi_epi8(t, zero);
+        for (int y = 0; y < 16; y++) {
+            const __m128i base = _mm_set1_epi16(left[y] - tl);
+            const __m128i v0 = _mm_add_epi16(lo, base);
+            const __m128i v1 = _mm_add_epi16(hi, base);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(v0, v1));
+            dst += stride;
+        }
+    }
+}
+
+static void
+pred_B_DC_sse2(uint8_t *dst, uint8_t *top, uint8_t *left, int stride,
+               int x UNUSED, int y UNUSED)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i tl = _mm_unpacklo_epi32(load_u32(top), load_u32(left));
+    const int sum = _mm_cvtsi128_si32(_mm_sad_epu8(tl, zero));
+    const __m128i dc = _mm_set1_epi8((char)((sum + 4) >> 3));
+    for (int j = 0; j < 4; j++) {
+        store_u32(dst + j * stride, dc);
+    }
+}
+
+static void
+pred_B_TM_sse2(uint8_t *dst, uint8_t *top, uint8_t *left, int stride,
+               int x UNUSED, int y UNUSED)
+{
+    pred_TM_sse2(dst, top, left, 4, stride);
+}
+
+static void
+pred_B_VE_sse2(uint8_t *dst, uint8_t *top, uint8_t *left UNUSED, int stride,
+               int x UNUSED, int y UNUSED)
+{
+    // P A B C D E F G
+    const __m128i ptop = _mm_loadl_epi64((const __m128i *)(top - 1));
+    const __m128i v = avg3_u8(ptop, _mm_srli_si128(ptop, 1),
+                              _mm_srli_si128(ptop, 2));
+    for (int j = 0; j < 4; j++) {
+        store_u32(dst + j * stride, v);
+    }
+}
+
+static void
+pred_B_LD_sse2(uint8_t *dst, uint8_t *top, uint8_t *left UNUSED, int stride,
+               int x UNUSED, int y UNUSED)
+{
+    // A B C D E F G H, the last one is repeated
+    const __m128i abcdefgh = _mm_loadl_epi64((const __m128i *)top);
+    const __m128i bcdefgh0 = _mm_srli_si128(abcdefgh, 1);
+    const __m128i cdefgh00 = _mm_srli_si128(abcdefgh, 2);
+    const __m128i cdefghh0 = _mm_insert_epi16(cdefgh00, top[7], 3);
+    const __m128i v = avg3_u8(abcdefgh, bcdefgh0, cdefghh0);
+    store_u32(dst + 0 * stride, v);
+    store_u32(dst + 1 * stride, _mm_srli_si128(v, 1));
+    store_u32(dst + 2 * stride, _mm_srli_si128(v, 2));
+    store_u32(dst + 3 * stride, _mm_srli_si128(v, 3));
+}
+
+static void
+pred_B_RD_sse2(uint8_t *dst, uint8_t *top, uint8_t *left, int stride,
+               int x UNUSED, int y UNUSED)
+{
+    // L K J I P A B C D
+    const __m128i ptop = _mm_slli_si128(
+        _mm_loadl_epi64((const __m128i *)(top - 1)), 4);
+    const __m128i lkji = _mm_cvtsi32_si128(
+        (int)((uint32_t)left[3] | ((uint32_t)left[2] << 8) |
+              ((uint32_t)left[1] << 16) | ((uint32_t)left[0] << 24)));
+    const __m128i lkjip = _mm_or_si128(lkji, ptop);
+    const __m128i v = avg3_u8(lkjip, _mm_srli_si128(lkjip, 1),
+                              _mm_srli_si128(lkjip, 2));
+    store_u32(dst + 3 * stride, v);
+    store_u32(dst + 2 * stride, _mm_srli_si128(v, 1));
+    store_u32(dst + 1 * stride, _mm_srli_si128(v, 2));
+    store_u32(dst + 0 * stride, _mm_srli_si128(v, 3));
+}
+
+static void
+pred_B_VR_sse2(uint8_t *dst, uint8_t *top, uint8_t *left, int stride,
+               int x UNUSED, int y UNUSED)
+{
+    // P A B C D
+    const __m128i pabcd = _mm_loadl_epi64((const __m128i *)(top - 1));
+    const __m128i abcd0 = _mm_srli_si128(pabcd, 1);
+    const __m128i avg2 = _mm_avg_epu8(pabcd, abcd0);
+    // I P A B C
+    const __m128i ipabc = _mm_insert_epi16(_mm_slli_si128(pabcd, 1),
+                                           left[0] | (top[-1] << 8), 0);
+    const __m128i avg3 = avg3_u8(ipabc, pabcd, abcd0);
+    store_u32(dst + 0 * stride, avg2);
+    store_u32(dst + 1 * stride, avg3);
+    store_u32(dst + 2 * stride, _mm_slli_si128(avg2, 1));
+    store_u32(dst + 3 * stride, _mm_slli_si128(avg3, 1));
+
+    // the first column of the last two rows comes from left
+    dst[2 * stride] = (left[1] + 2 * left[0] + top[-1] + 2) >> 2;
+    dst[3 * stride] = (left[0] + 2 * left[1] + left[2] + 2) >> 2;
+}
+
+static void
+pred_B_VL_sse2(uint8_t *dst, uint8_t *top, uint8_t *left UNUSED, int stride,
+               int x UNUSED, int y UNUSED)
+{
+    const __m128i abcdefgh = _mm_loadl_epi64((const __m128i *)top);
+    const __m128i bcdefgh0 = _mm_srli_si128(abcdefgh, 1);
+    const __m128i cdefgh00 = _mm_srli_si128(abcdefgh, 2);
+    const __m128i avg2 = _mm_avg_epu8(abcdefgh, bcdefgh0);
+    const __m128i avg3 = avg3_u8(abcdefgh, bcdefgh0, cdefgh00);
+    const uint32_t extra = (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(avg3, 4));
+    store_u32(dst + 0 * stride, avg2);
+    store_u32(dst + 1 * stride, avg3);
+    store_u32(dst + 2 * stride, _mm_srli_si128(avg2, 1));
+    store_u32(dst + 3 * stride, _mm_srli_si128(avg3, 1));
+
+    // the last column of the last two rows is irregular
+    dst[2 * stride + 3] = extra & 0xff;
+    dst[3 * stride + 3] = (extra >> 8) & 0xff;
+}
+
+static inline int
+sum_u8(const uint8_t *p, int size)
+{
+    const __m128i zero = _mm_setzero_si128();
+    if (size == 8) {
+        const __m128i v = _mm_loadl_epi64((const __m128i *)p);
+        return _mm_cvtsi128_si32(_mm_sad_epu8(v, zero));
+    } else {
+        const __m128i v = _mm_sad_epu8(_mm_loadu_si128((const __m128i *)p), zero);
+        return _mm_cvtsi128_si32(_mm_add_epi32(v, _mm_unpackhi_epi64(v, v)));
+    }
+}
+
+static void
+pred_DC_UV_sse2(uint8_t *dst, uint8_t *top, uint8_t *left, int stride, int x,
+                int y)
+{
+    int dc;
+    if (x > 0 && y > 0) {
+        dc = (sum_u8(top, 8) + sum_u8(left, 8) + 8) >> 4;
+    } else if (y > 0) {
+        dc = (sum_u8(top, 8) + 4) >> 3;
+    } else if (x > 0) {
+        dc = (sum_u8(left, 8) + 4) >> 3;
+    } else {
+        dc = 0x80;
+    }
+    const __m128i v = _mm_set1_epi8((char)dc);
+    for (int j = 0; j < 8; j++) {
+        _mm_storel_epi64((__m128i *)(dst + j * stride), v);
+    }
+}
+
+static void
+pred_TM_UV_sse2(uint8_t *dst, uint8_t *top, uint8_t *left, int stride,
+                int x UNUSED, int y UNUSED)
+{
+    pred_TM_sse2(dst, top, left, 8, stride);
+}
+
+static void
+pred_VE_UV_sse2(uint8_t *dst, uint8_t *top, uint8_t *left UNUSED, int stride,
+                int x UNUSED, int y UNUSED)
+{
+    const __m128i v = _mm_loadl_epi64((const __m128i *)top);
+    for (int j = 0; j < 8; j++) {
+        _mm_storel_epi64((__m128i *)(dst + j * stride), v);
+    }
+}
+
+static void
+pred_HE_UV_sse2(uint8_t *dst, uint8_t *top UNUSED, uint8_t *left, int stride,
+                int x UNUSED, int y UNUSED)
+{
+    for (int j = 0; j < 8; j++) {
+        _mm_storel_epi64((__m128i *)(dst + j * stride),
+                         _mm_set1_epi8((char)left[j]));
+    }
+}
+
+static void
+pred_DC_16_sse2(uint8_t *dst, uint8_t *top, uint8_t *left, int stride, int x,
+                int y)
+{
+    int dc;
+    if (x > 0 && y > 0) {
+        dc = (sum_u8(top, 16) + sum_u8(left, 16) + 16) >> 5;
+    } else if (y > 0) {
+        dc = (sum_u8(top, 16) + 8) >> 4;
+    } else if (x > 0) {
+        dc = (sum_u8(left, 16) + 8) >> 4;
+    } else {
+        dc = 0x80;
+    }
+    const __m128i v = _mm_set1_epi8((char)dc);
+    for (int j = 0; j < 16; j++) {
+        _mm_storeu_si128((__m128i *)(dst + j * stride), v);
+    }
+}
+
+static void
+pred_TM_16_sse2(uint8_t *dst, uint8_t *top, uint8_t *left, int stride,
+                int x UNUSED, int y UNUSED)
+{
+    pred_TM_sse2(dst, top, left, 16, stride);
+}
+
+static void
+pred_VE_16_sse2(uint8_t *dst, uint8_t *top, uint8_t *left UNUSED, int stride,
+                int x UNUSED, int y UNUSED)
+{
+    const __m128i v = _mm_loadu_si128((const __m128i *)top);
+    for (int j = 0; j < 16; j++) {
+        _mm_storeu_si128((__m128i *)(dst + j * stride), v);
+    }
+}
+
+static void
+pred_HE_16_sse2(uint8_t *dst, uint8_t *top UNUSED, uint8_t *left, int stride,
+                int x UNUSED, int y UNUSED)
+{
+    for (int j = 0; j < 16; j++) {
+        _mm_storeu_si128((__m128i *)(dst + j * stride),
+                         _mm_set1_epi8((char)left[j]));
+    }
+}
+
+//------------------------------------------------------------------------------
+// Loop filters, all 16 lanes are processed at once
+
+// abs(p - q) on unsigned bytes
+#define MM_ABS(p, q) _mm_or_si128(_mm_subs_epu8((q), (p)), _mm_subs_epu8((p), (q)))
+
+// signed byte >> 3
+static inline __m128i
+signed_shift3(__m128i x)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i lo = _mm_srai_epi16(_mm_unpacklo_epi8(zero, x), 3 + 8);
+    const __m128i hi = _mm_srai_epi16(_mm_unpackhi_epi8(zero, x), 3 + 8);
+    return _mm_packs_epi16(lo, hi);
+}
+
+// 2 * abs(p0 - q0) + abs(p1 - q1) / 2 <= thresh, which is the same as
+// 4 * abs(p0 - q0) + abs(p1 - q1) <= 2 * thresh + 1 in the C version
+static inline __m128i
+needs_filter(__m128i p1, __m128i p0, __m128i q0, __m128i q1, int thresh)
+{
+    const __m128i m_thresh = _mm_set1_epi8((char)thresh);
+    const __m128i kfe = _mm_set1_epi8((char)0xFE);
+    const __m128i t1 = _mm_srli_epi16(_mm_and_si128(MM_ABS(p1, q1), kfe), 1);
+    const __m128i t2 = MM_ABS(p0, q0);
+    const __m128i t3 = _mm_adds_epu8(_mm_adds_epu8(t2, t2), t1);
+    return _mm_cmpeq_epi8(_mm_subs_epu8(t3, m_thresh), _mm_setzero_si128());
+}
+
+static inline __m128i
+not_hev(__m128i p1, __m128i p0, __m128i q0, __m128i q1, int hev_thresh)
+{
+    const __m128i t = _mm_max_epu8(MM_ABS(p1, p0), MM_ABS(q1, q0));
+    const __m128i h = _mm_set1_epi8((char)hev_thresh);
+    return _mm_cmpeq_epi8(_mm_subs_epu8(t, h), _mm_setzero_si128());
+}
+
+// p1 - q1 + 3 * (q0 - p0) on signed bytes, beware of the saturation order
+static inline __m128i
+base_delta(__m128i p1, __m128i p0, __m128i q0, __m128i q1)
+{
+    const __m128i p1_q1 = _mm_subs_epi8(p1, q1);
+    const __m128i q0_p0 = _mm_subs_epi8(q0, p0);
+    const __m128i s1 = _mm_adds_epi8(p1_q1, q0_p0);
+    const __m128i s2 = _mm_adds_epi8(q0_p0, s1);
+    return _mm_adds_epi8(q0_p0, s2);
+}
+
+// signed p0 += (a + 3) >> 3, q0 -= (a + 4) >> 3
+static inline void
+do_simple_filter(__m128i *p0, __m128i *q0, __m128i a)
+{
+    const __m128i k3 = _mm_set1_epi8(3);
+    const __m128i k4 = _mm_set1_epi8(4);
+    const __m128i v3 = signed_shift3(_mm_adds_epi8(a, k3));
+    const __m128i v4 = signed_shift3(_mm_adds_epi8(a, k4));
+    *q0 = _mm_subs_epi8(*q0, v4);
+    *p0 = _mm_adds_epi8(*p0, v3);
+}
+
+// same as DoFilter2_C on the masked lanes
+static inline void
+do_filter2(__m128i p1, __m128i *p0, __m128i *q0, __m128i q1, int thresh)
+{
+    const __m128i sign_bit = _mm_set1_epi8((char)0x80);
+    const __m128i mask = needs_filter(p1, *p0, *q0, q1, thresh);
+    const __m128i p1s = _mm_xor_si128(p1, sign_bit);
+    const __m128i q1s = _mm_xor_si128(q1, sign_bit);
+    __m128i p0s = _mm_xor_si128(*p0, sign_bit);
+    __m128i q0s = _mm_xor_si128(*q0, sign_bit);
+    const __m128i a = _mm_and_si128(base_delta(p1s, p0s, q0s, q1s), mask);
+    do_simple_filter(&p0s, &q0s, a);
+    *p0 = _mm_xor_si128(p0s, sign_bit);
+    *q0 = _mm_xor_si128(q0s, sign_bit);
+}
+
+// the complex filter mask, max_diff is the max of the interior differences
+static inline __m128i
+complex_mask(__m128i p1, __m128i p0, __m128i q0, __m128i q1, __m128i max_diff,
+             int thresh, int ithresh)
+{
+    const __m128i it = _mm_set1_epi8((char)ithresh);
+    const __m128i imask = _mm_cmpeq_epi8(_mm_subs_epu8(max_diff, it),
+                                         _mm_setzero_si128());
+    return _mm_and_si128(imask, needs_filter(p1, p0, q0, q1, thresh));
+}
+
+static inline __m128i
+interior_diff(__m128i p3, __m128i p2, __m128i p1, __m128i p0, __m128i q0,
+              __m128i q1, __m128i q2, __m128i q3)
+{
+    __m128i m = _mm_max_epu8(MM_ABS(p3, p2), MM_ABS(p2, p1));
+    m = _mm_max_epu8(m, MM_ABS(p1, p0));
+    m = _mm_max_epu8(m, MM_ABS(q3, q2));
+    m = _mm_max_epu8(m, MM_ABS(q2, q1));
+    return _mm_max_epu8(m, MM_ABS(q1, q0));
+}
+
+// FilterLoop24_C, 4 pixels in and 4 pixels out
+static inline void
+do_filter4(__m128i *p1, __m128i *p0, __m128i *q0, __m128i *q1, __m128i mask,
+           int hev_thresh)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i sign_bit = _mm_set1_epi8((char)0x80);
+    const __m128i k64 = _mm_set1_epi8(64);
+    const __m128i k3 = _mm_set1_epi8(3);
+    const __m128i k4 = _mm_set1_epi8(4);
+    const __m128i nhev = not_hev(*p1, *p0, *q0, *q1, hev_thresh);
+    __m128i p1s = _mm_xor_si128(*p1, sign_bit);
+    __m128i p0s = _mm_xor_si128(*p0, sign_bit);
+    __m128i q0s = _mm_xor_si128(*q0, sign_bit);
+    __m128i q1s = _mm_xor_si128(*q1, sign_bit);
+    __m128i t1, t2, t3;
+
+    t1 = _mm_andnot_si128(nhev, _mm_subs_epi8(p1s, q1s)); // hev(p1 - q1)
+    t2 = _mm_subs_epi8(q0s, p0s);
+    t1 = _mm_adds_epi8(t1, t2);
+    t1 = _mm_adds_epi8(t1, t2);
+    t1 = _mm_adds_epi8(t1, t2);                           // + 3 * (q0 - p0)
+    t1 = _mm_and_si128(t1, mask);
+
+    t2 = signed_shift3(_mm_adds_epi8(t1, k3));
+    t3 = signed_shift3(_mm_adds_epi8(t1, k4));
+    p0s = _mm_adds_epi8(p0s, t2);
+    q0s = _mm_subs_epi8(q0s, t3);
+    *p0 = _mm_xor_si128(p0s, sign_bit);
+    *q0 = _mm_xor_si128(q0s, sign_bit);
+
+    // signed (a + 1) >> 1, only for !hev
+    t2 = _mm_add_epi8(t3, sign_bit);
+    t3 = _mm_sub_epi8(_mm_avg_epu8(t2, zero), k64);
+    t3 = _mm_and_si128(nhev, t3);
+    q1s = _mm_subs_epi8(q1s, t3);
+    p1s = _mm_adds_epi8(p1s, t3);
+    *p1 = _mm_xor_si128(p1s, sign_bit);
+    *q1 = _mm_xor_si128(q1s, sign_bit);
+}
+
+// q -= delta and p += delta on signed bytes, delta is (a >> 7) on 16 bits
+static inline void
+update_2pixels(__m128i *pi, __m128i *qi, __m128i a_lo, __m128i a_hi)
+{
+    const __m128i delta = _mm_packs_epi16(_mm_srai_epi16(a_lo, 7),
+                                          _mm_srai_epi16(a_hi, 7));
+    *pi = _mm_adds_epi8(*pi, delta);
+    *qi = _mm_subs_epi8(*qi, delta);
+}
+
+// FilterLoop26_C, 6 pixels in and 6 pixels out
+static inline void
+do_filter6(__m128i *p2, __m128i *p1, __m128i *p0, __m128i *q0, __m128i *q1,
+           __m128i *q2, __m128i mask, int hev_thresh)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i sign_bit = _mm_set1_epi8((char)0x80);
+    const __m128i nhev = not_hev(*p1, *p0, *q0, *q1, hev_thresh);
+    __m128i p2s = _mm_xor_si128(*p2, sign_bit);
+    __m128i p1s = _mm_xor_si128(*p1, sign_bit);
+    __m128i p0s = _mm_xor_si128(*p0, sign_bit);
+    __m128i q0s = _mm_xor_si128(*q0, sign_bit);
+    __m128i q1s = _mm_xor_si128(*q1, sign_bit);
+    __m128i q2s = _mm_xor_si128(*q2, sign_bit);
+    const __m128i a = base_delta(p1s, p0s, q0s, q1s);
+
+    // simple filter on pixels with hev
+    do_simple_filter(&p0s, &q0s, _mm_and_si128(a, _mm_andnot_si128(nhev, mask)));
+
+    // strong filter on pixels with not hev
+    {
+        const __m128i k9 = _mm_set1_epi16(0x0900);
+        const __m128i k63 = _mm_set1_epi16(63);
+        const __m128i f = _mm_and_si128(a, _mm_and_si128(nhev, mask));
+        const __m128i f_lo = _mm_unpacklo_epi8(zero, f);
+        const __m128i f_hi = _mm_unpackhi_epi8(zero, f);
+        const __m128i f9_lo = _mm_mulhi_epi16(f_lo, k9);   // f * 9
+        const __m128i f9_hi = _mm_mulhi_epi16(f_hi, k9);
+        const __m128i a2_lo = _mm_add_epi16(f9_lo, k63);   // f * 9 + 63
+        const __m128i a2_hi = _mm_add_epi16(f9_hi, k63);
+        const __m128i a1_lo = _mm_add_epi16(a2_lo, f9_lo); // f * 18 + 63
+        const __m128i a1_hi = _mm_add_epi16(a2_hi, f9_hi);
+        const __m128i a0_lo = _mm_add_epi16(a1_lo, f9_lo); // f * 27 + 63
+        const __m128i a0_hi = _mm_add_epi16(a1_hi, f9_hi);
+        update_2pixels(&p2s, &q2s, a2_lo, a2_hi);
+        update_2pixels(&p1s, &q1s, a1_lo, a1_hi);
+        update_2pixels(&p0s, &q0s, a0_lo, a0_hi);
+    }
+    *p2 = _mm_xor_si128(p2s, sign_bit);
+    *p1 = _mm_xor_si128(p1s, sign_bit);
+    *p0 = _mm_xor_si128(p0s, sign_bit);
+    *q0 = _mm_xor_si128(q0s, sign_bit);
+    *q1 = _mm_xor_si128(q1s, sign_bit);
+    *q2 = _mm_xor_si128(q2s, sign_bit);
+}
+
+// Load 8 bytes of 16 rows around a vertical edge and transpose them, so c[i]
+// holds column i of all rows. r0 is used for rows 0-7 and r8 for rows 8-15.
+static inline void
+load_8x16(const uint8_t *r0, const uint8_t *r8, int stride, __m128i c[8])
+{
+    __m128i t[8], u[8], v[8];
+    for (int i = 0; i < 4; i++) {
+        t[i] = _mm_unpacklo_epi8(
+            _mm_loadl_epi64((const __m128i *)(r0 + (2 * i) * stride)),
+            _mm_loadl_epi64((const __m128i *)(r0 + (2 * i + 1) * stride)));
+        t[i + 4] = _mm_unpacklo_epi8(
+            _mm_loadl_epi64((const __m128i *)(r8 + (2 * i) * stride)),
+            _mm_loadl_epi64((const __m128i *)(r8 + (2 * i + 1) * stride)));
+    }
+    // u[0] = columns 0-3 of rows 0-3, u[1] = columns 4-7 of rows 0-3, ...
+    for (int i = 0; i < 4; i++) {
+        u[2 * i] = _mm_unpacklo_epi16(t[2 * i], t[2 * i + 1]);
+        u[2 * i + 1] = _mm_unpackhi_epi16(t[2 * i], t[2 * i + 1]);
+    }
+    // v[0] = columns 0-1 of rows 0-7, v[1] = columns 2-3 of rows 0-7, ...
+    for (int i = 0; i < 2; i++) {
+        v[4 * i] = _mm_unpacklo_epi32(u[4 * i], u[4 * i + 2]);
+        v[4 * i + 1] = _mm_unpackhi_epi32(u[4 * i], u[4 * i + 2]);
+        v[4 * i + 2] = _mm_unpacklo_epi32(u[4 * i + 1], u[4 * i + 3]);
+        v[4 * i + 3] = _mm_unpackhi_epi32(u[4 * i + 1], u[4 * i + 3]);
+    }
+    for (int i = 0; i < 4; i++) {
+        c[2 * i] = _mm_unpacklo_epi64(v[i], v[i + 4]);
+        c[2 * i + 1] = _mm_unpackhi_epi64(v[i], v[i + 4]);
+    }
+}
+
+// the reverse of load_8x16()
+static inline void
+store_8x16(uint8_t *r0, uint8_t *r8, int stride, const __m128i c[8])
+{
+    __m128i a[8], b[8], d[8];
+    // a[0] = columns 0-1 of rows 0-7, a[1] = columns 0-1 of rows 8-15, ...
+    for (int i = 0; i < 4; i++) {
+        a[2 * i] = _mm_unpacklo_epi8(c[2 * i], c[2 * i + 1]);
+        a[2 * i + 1] = _mm_unpackhi_epi8(c[2 * i], c[2 * i + 1]);
+    }
+    // b[0] = columns 0-3 of rows 0-3, b[1] = columns 0-3 of rows 4-7,
+    // b[2] = columns 4-7 of rows 0-3, b[3] = columns 4-7 of rows 4-7
+    for (int i = 0; i < 2; i++) {
+        b[4 * i] = _mm_unpacklo_epi16(a[i], a[i + 2]);
+        b[4 * i + 1] = _mm_unpackhi_epi16(a[i], a[i + 2]);
+        b[4 * i + 2] = _mm_unpacklo_epi16(a[i + 4], a[i + 6]);
+        b[4 * i + 3] = _mm_unpackhi_epi16(a[i + 4], a[i + 6]);
+    }
+    // d[i] = rows 2 * i and 2 * i + 1
+    for (int i = 0; i < 2; i++) {
+        d[4 * i] = _mm_unpacklo_epi32(b[4 * i], b[4 * i + 2]);
+        d[4 * i + 1] = _mm_unpackhi_epi32(b[4 * i], b[4 * i + 2]);
+        d[4 * i + 2] = _mm_unpacklo_epi32(b[4 * i + 1], b[4 * i + 3]);
+        d[4 * i + 3] = _mm_unpackhi_epi32(b[4 * i + 1], b[4 * i + 3]);
+    }
+    for (int i = 0; i < 4; i++) {
+        _mm_storel_epi64((__m128i *)(r0 + (2 * i) * stride), d[i]);
+        _mm_storel_epi64((__m128i *)(r0 + (2 * i + 1) * stride),
+                         _mm_unpackhi_epi64(d[i], d[i]));
+        _mm_storel_epi64((__m128i *)(r8 + (2 * i) * stride), d[i + 4]);
+        _mm_storel_epi64((__m128i *)(r8 + (2 * i + 1) * stride),
+                         _mm_unpackhi_epi64(d[i + 4], d[i + 4]));
+    }
+}
+
+static inline __m128i
+load_uv(const uint8_t *u, const uint8_t *v)
+{
+    return _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)u),
+                              _mm_loadl_epi64((const __m128i *)v));
+}
+
+static inline void
+store_uv(uint8_t *u, uint8_t *v, __m128i x)
+{
+    _mm_storel_epi64((__m128i *)u, x);
+    _mm_storel_epi64((__m128i *)v, _mm_unpackhi_epi64(x, x));
+}
+
+static void
+simple_vfilter16_sse2(uint8_t *p, int stride, int thresh)
+{
+    const __m128i p1 = _mm_loadu_si128((const __m128i *)(p - 2 * stride));
+    __m128i p0 = _mm_loadu_si128((const __m128i *)(p - stride));
+    __m128i q0 = _mm_loadu_si128((const __m128i *)p);
+    const __m128i q1 = _mm_loadu_si128((const __m128i *)(p + stride));
+    do_filter2(p1, &p0, &q0, q1, thresh);
+    _mm_storeu_si128((__m128i *)(p - stride), p0);
+    _mm_storeu_si128((__m128i *)p, q0);
+}
+
+static void
+simple_hfilter16_sse2(uint8_t *p, int stride, int thresh)
+{
+    __m128i c[8];
+    load_8x16(p - 4, p - 4 + 8 * stride, stride, c);
+    do_filter2(c[2], &c[3], &c[4], c[5], thresh);
+    store_8x16(p - 4, p - 4 + 8 * stride, stride, c);
+}
+
+static void
+simple_vfilter16i_sse2(uint8_t *p, int stride, int thresh)
+{
+    for (int k = 3; k > 0; --k) {
+        p += 4 * stride;
+        simple_vfilter16_sse2(p, stride, thresh);
+    }
+}
+
+static void
+simple_hfilter16i_sse2(uint8_t *p, int stride, int thresh)
+{
+    for (int k = 3; k > 0; --k) {
+        p += 4;
+        simple_hfilter16_sse2(p, stride, thresh);
+    }
+}
+
+// normal filter on 8 lines of 16 lanes, p[4] is the first pixel after the edge
+static inline void
+filter_mb_edge(__m128i p[8], int thresh, int ithresh, int hev_thresh)
+{
+    const __m128i diff = interior_diff(p[0], p[1], p[2], p[3], p[4], p[5],
+                                       p[6], p[7]);
+    const __m128i mask = complex_mask(p[2], p[3], p[4], p[5], diff, thresh,
+                                      ithresh);
+    do_filter6(&p[1], &p[2], &p[3], &p[4], &p[5], &p[6], mask, hev_thresh);
+}
+
+static inline void
+filter_inner_edge(__m128i p[8], int thresh, int ithresh, int hev_thresh)
+{
+    const __m128i diff = interior_diff(p[0], p[1], p[2], p[3], p[4], p[5],
+                                       p[6], p[7]);
+    const __m128i mask = complex_mask(p[2], p[3], p[4], p[5], diff, thresh,
+                                      ithresh);
+    do_filter4(&p[2], &p[3], &p[4], &p[5], mask, hev_thresh);
+}
+
+static void
+vfilter16_sse2(uint8_t *p, int stride, int thresh, int ithresh, int hev_thresh)
+{
+    __m128i r[8];
+    for (int i = 0; i < 8; i++) {
+        r[i] = _mm_loadu_si128((const __m128i *)(p + (i - 4) * stride));
+    }
+    filter_mb_edge(r, thresh, ithresh, hev_thresh);
+    for (int i = 1; i < 7; i++) {
+        _mm_storeu_si128((__m128i *)(p + (i - 4) * stride), r[i]);
+    }
+}
+
+static void
+hfilter16_sse2(uint8_t *p, int stride, int thresh, int ithresh, int hev_thresh)
+{
+    __m128i c[8];
+    load_8x16(p - 4, p - 4 + 8 * stride, stride, c);
+    filter_mb_edge(c, thresh, ithresh, hev_thresh);
+    store_8x16(p - 4, p - 4 + 8 * stride, stride, c);
+}
+
+static void
+vfilter16i_sse2(uint8_t *p, int stride, int thresh, int ithresh,
+                int hev_thresh)
+{
+    for (int k = 3; k > 0; --k) {
+        __m128i r[8];
+        p += 4 * stride;
+        for (int i = 0; i < 8; i++) {
+            r[i] = _mm_loadu_si128((const __m128i *)(p + (i - 4) * stride));
+        }
+        filter_inner_edge(r, thresh, ithresh, hev_thresh);
+        for (int i = 2; i < 6; i++) {
+            _mm_storeu_si128((__m128i *)(p + (i - 4) * stride), r[i]);
+        }
+    }
+}
+
+static void
+hfilter16i_sse2(uint8_t *p, int stride, int thresh, int ithresh,
+                int hev_thresh)
+{
+    for (int k = 3; k > 0; --k) {
+        __m128i c[8];
+        p += 4;
+        load_8x16(p - 4, p - 4 + 8 * stride, stride, c);
+        filter_inner_edge(c, thresh, ithresh, hev_thresh);
+        store_8x16(p - 4, p - 4 + 8 * stride, stride, c);
+    }
+}
+
+// chroma, u and v are filtered together in the low and high 8 lanes
+static void
+vfilter8_sse2(uint8_t *u, uint8_t *v, int stride, int thresh, int ithresh,
+              int hev_thresh)
+{
+    __m128i r[8];
+    for (int i = 0; i < 8; i++) {
+        r[i] = load_uv(u + (i - 4) * stride, v + (i - 4) * stride);
+    }
+    filter_mb_edge(r, thresh, ithresh, hev_thresh);
+    for (int i = 1; i < 7; i++) {
+        store_uv(u + (i - 4) * stride, v + (i - 4) * stride, r[i]);
+    }
+}
+
+static void
+hfilter8_sse2(uint8_t *u, uint8_t *v, int stride, int thresh, int ithresh,
+              int hev_thresh)
+{
+    __m128i c[8];
+    load_8x16(u - 4, v - 4, stride, c);
+    filter_mb_edge(c, thresh, ithresh, hev_thresh);
+    store_8x16(u - 4, v - 4, stride, c);
+}
+
+static void
+vfilter8i_sse2(uint8_t *u, uint8_t *v, int stride, int thresh, int ithresh,
+               int hev_thresh)
+{
+    __m128i r[8];
+    u += 4 * stride;
+    v += 4 * stride;
+    for (int i = 0; i < 8; i++) {
+        r[i] = load_uv(u + (i - 4) * stride, v + (i - 4) * stride);
+    }
+    filter_inner_edge(r, thresh, ithresh, hev_thresh);
+    for (int i = 2; i < 6; i++) {
+        store_uv(u + (i - 4) * stride, v + (i - 4) * stride, r[i]);
+    }
+}
+
+static void
+hfilter8i_sse2(uint8_t *u, uint8_t *v, int stride, int thresh, int ithresh,
+               int hev_thresh)
+{
+    __m128i c[8];
+    load_8x16(u, v, stride, c);
+    filter_inner_edge(c, thresh, ithresh, hev_thresh);
+    store_8x16(u, v, stride, c);
+}
+
+//------------------------------------------------------------------------------
+// Encoder distortion
+
+static int
+sad16x16_sse2(const uint8_t *a, int a_stride, const uint8_t *b, int b_stride)
+{
+    __m128i sum = _mm_setzero_si128();
+    for (int j = 0; j < 16; j++) {
+        const __m128i x = _mm_loadu_si128((const __m128i *)(a + j * a_stride));
+        const __m128i y = _mm_loadu_si128((const __m128i *)(b + j * b_stride));
+        sum = _mm_add_epi64(sum, _mm_sad_epu8(x, y));
+    }
+    return _mm_cvtsi128_si32(sum) + _mm_extract_epi16(sum, 4);
+}
+
+static int
+sad8x8_sse2(const uint8_t *a, int a_stride, const uint8_t *b, int b_stride)
+{
+    __m128i sum = _mm_setzero_si128();
+    for (int j = 0; j < 8; j += 2) {
+        const __m128i x = _mm_unpacklo_epi64(
+            _mm_loadl_epi64((const __m128i *)(a + j * a_stride)),
+            _mm_loadl_epi64((const __m128i *)(a + (j + 1) * a_stride)));
+        const __m128i y = _mm_unpacklo_epi64(
+            _mm_loadl_epi64((const __m128i *)(b + j * b_stride)),
+            _mm_loadl_epi64((const __m128i *)(b + (j + 1) * b_stride)));
+        sum = _mm_add_epi64(sum, _mm_sad_epu8(x, y));
+    }
+    return _mm_cvtsi128_si32(sum) + _mm_extract_epi16(sum, 4);
+}
+
+static int
+sad4x4_sse2(const uint8_t *a, int a_stride, const uint8_t *b, int b_stride)
+{
+    const __m128i x = _mm_unpacklo_epi64(
+        _mm_unpacklo_epi32(load_u32(a), load_u32(a + a_stride)),
+        _mm_unpacklo_epi32(load_u32(a + 2 * a_stride),
+                           load_u32(a + 3 * a_stride)));
+    const __m128i y = _mm_unpacklo_epi64(
+        _mm_unpacklo_epi32(load_u32(b), load_u32(b + b_stride)),
+        _mm_unpacklo_epi32(load_u32(b + 2 * b_stride),
+                           load_u32(b + 3 * b_stride)));
+    const __m128i sum = _mm_sad_epu8(x, y);
+    return _mm_cvtsi128_si32(sum) + _mm_extract_epi16(sum, 4);
+}
+
+// one pass of the 4 point hadamard on rows 0-1 and rows 2-3, the order of the
+// outputs does not matter as only their absolute values are summed
+static inline void
+hadamard4_rows(__m128i *r01, __m128i *r23)
+{
+    const __m128i a = _mm_add_epi16(*r01, *r23);    // r0+r2 | r1+r3
+    const __m128i b = _mm_sub_epi16(*r01, *r23);    // r0-r2 | r1-r3
+    const __m128i s = _mm_unpacklo_epi64(a, b);     // r0+r2 | r0-r2
+    const __m128i t = _mm_unpackhi_epi64(a, b);     // r1+r3 | r1-r3
+    *r01 = _mm_add_epi16(s, t);
+    *r23 = _mm_sub_epi16(s, t);
+}
+
+// returns the partial sums in four 32b lanes
+static inline __m128i
+satd4x4_sse2_sum(const uint8_t *a, int a_stride, const uint8_t *b, int b_stride)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i d[4];
+    for (int i = 0; i < 4; i++) {
+        d[i] = _mm_sub_epi16(
+            _mm_unpacklo_epi8(load_u32(a + i * a_stride), zero),
+            _mm_unpacklo_epi8(load_u32(b + i * b_stride), zero));
+    }
+    __m128i r01 = _mm_unpacklo_epi64(d[0], d[1]);
+    __m128i r23 = _mm_unpacklo_epi64(d[2], d[3]);
+    hadamard4_rows(&r01, &r23);
+    // transpose, so the columns go through the same butterflies
+    const __m128i t0 = _mm_unpacklo_epi16(r01, r23);
+    const __m128i t1 = _mm_unpackhi_epi16(r01, r23);
+    r01 = _mm_unpacklo_epi16(t0, t1);
+    r23 = _mm_unpackhi_epi16(t0, t1);
+    hadamard4_rows(&r01, &r23);
+
+    const __m128i a01 = _mm_max_epi16(r01, _mm_sub_epi16(zero, r01));
+    const __m128i a23 = _mm_max_epi16(r23, _mm_sub_epi16(zero, r23));
+    const __m128i one = _mm_set1_epi16(1);
+    return _mm_add_epi32(_mm_madd_epi16(a01, one), _mm_madd_epi16(a23, one));
+}
+
+static inline int
+hsum_epi32(__m128i v)
+{
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(v);
+}
+
+static int
+satd4x4_sse2(const uint8_t *a, int a_stride, const uint8_t *b, int b_stride)
+{
+    return hsum_epi32(satd4x4_sse2_sum(a, a_stride, b, b_stride));
+}
+
+static int
+satd8x8_sse2(const uint8_t *a, int a_stride, const uint8_t *b, int b_stride)
+{
+    __m128i sum = _mm_setzero_si128();
+    for (int j = 0; j < 8; j += 4) {
+        for (int i = 0; i < 8; i += 4) {
+            sum = _mm_add_epi32(sum, satd4x4_sse2_sum(a + j * a_stride + i,
+                                                      a_stride,
+                                                      b + j * b_stride + i,
+                                                      b_stride));
+        }
+    }
+    return hsum_epi32(sum);
+}
+
+static int
+satd16x16_sse2(const uint8_t *a, int a_stride, const uint8_t *b, int b_stride)
+{
+    __m128i sum = _mm_setzero_si128();
+    for (int j = 0; j < 16; j += 4) {
+        for (int i = 0; i < 16; i += 4) {
+            sum = _mm_add_epi32(sum, satd4x4_sse2_sum(a + j * a_stride + i,
+                                                      a_stride,
+                                                      b + j * b_stride + i,
+                                                      b_stride));
+        }
+    }
+    return hsum_epi32(sum);
+}
+
+void
+x86_vp8_dsp_init_sse2(struct vp8_dsp *dsp)
+{
+    dsp->transform = vp8_transform_sse2;
+    dsp->transform_dc = vp8_transform_dc_sse2;
+    dsp->transform_wht = vp8_transform_wht_sse2;
+
+    dsp->pred_luma4[B_DC_PRED] = pred_B_DC_sse2;
+    dsp->pred_luma4[B_TM_PRED] = pred_B_TM_sse2;
+    dsp->pred_luma4[B_VE_PRED] = pred_B_VE_sse2;
+    dsp->pred_luma4[B_LD_PRED] = pred_B_LD_sse2;
+    dsp->pred_luma4[B_RD_PRED] = pred_B_RD_sse2;
+    dsp->pred_luma4[B_VR_PRED] = pred_B_VR_sse2;
+    dsp->pred_luma4[B_VL_PRED] = pred_B_VL_sse2;
+
+    dsp->pred_luma16[DC_PRED] = pred_DC_16_sse2;
+    dsp->pred_luma16[TM_PRED] = pred_TM_16_sse2;
+    dsp->pred_luma16[V_PRED] = pred_VE_16_sse2;
+    dsp->pred_luma16[H_PRED] = pred_HE_16_sse2;
+
+    dsp->pred_chroma8[DC_PRED] = pred_DC_UV_sse2;
+    dsp->pred_chroma8[TM_PRED] = pred_TM_UV_sse2;
+    dsp->pred_chroma8[V_PRED] = pred_VE_UV_sse2;
+    dsp->pred_chroma8[H_PRED] = pred_HE_UV_sse2;
+
+    dsp->simple_vfilter16 = simple_vfilter16_sse2;
+    dsp->simple_hfilter16 = simple_hfilter16_sse2;
+    dsp->simple_vfilter16i = simple_vfilter16i_sse2;
+    dsp->simple_hfilter16i = simple_hfilter16i_sse2;
+
+    dsp->vfilter16 = vfilter16_sse2;
+    dsp->hfilter16 = hfilter16_sse2;
+    dsp->vfilter16i = vfilter16i_sse2;
+    dsp->hfilter16i = hfilter16i_sse2;
+    dsp->vfilter8 = vfilter8_sse2;
+    dsp->hfilter8 = hfilter8_sse2;
+    dsp->vfilter8i = vfilter8i_sse2;
+    dsp->hfilter8i = hfilter8i_sse2;
+
+    dsp->sad16x16 = sad16x16_sse2;
+    dsp->sad8x8 = sad8x8_sse2;
+    dsp->sad4x4 = sad4x4_sse2;
+    dsp->satd16x16 = satd16x16_sse2;
+    dsp->satd8x8 = satd8x8_sse2;
+    dsp->satd4x4 = satd4x4_sse2;
+}
+
+#endif
@@ -5,13 +5,106 @@
 extern "C" {
 #endif
 
+#include <stdint.h>
 #include <immintrin.h>
 
+struct vp8_dsp;
+struct hevc_dsp;
+struct av1_dsp;
+
 #ifdef __AVX2__
 void x86_avx2_init(void);
+void x86_vp8_dsp_init_avx2(struct vp8_dsp *dsp);
+void x86_hevc_dsp_init_avx2(struct hevc_dsp *dsp);
+void x86_av1_dsp_init_avx2(struct av1_dsp *dsp);
+void x86_hevc_idct_16x16_avx2(int16_t *coeffs, int bitdepth, int w, int h);
+void x86_hevc_idct_32x32_avx2(int16_t *coeffs, int bitdepth, int w, int h);
+void x86_hevc_intra_planar_avx2(uint16_t *dst, uint16_t *left, uint16_t *top,
+                                int nTbS, int stride);
+void x86_hevc_intra_angular_avx2(uint16_t *dst, uint16_t *left, uint16_t *top,
+                                 int nTbS, int stride, int cIdx,
+                                 int predModeIntra,
+                                 int disableIntraBoundaryFilter, int bitdepth);
+#endif
+#ifdef __SSE4_1__
+void x86_hevc_dsp_init_sse4(struct hevc_dsp *dsp);
+void x86_av1_dsp_init_sse4(struct av1_dsp *dsp);
+
+// the AV1 kernels the AVX2 versions hand their four sample tails to
+struct av1_itx_prog;
+void x86_av1_itx_prog_sse4(int32_t *buf, int stride, int lanes,
+                           const struct av1_itx_prog *p, int range);
+void x86_av1_itx_adst4_sse4(int32_t *buf, int stride, int lanes, int n);
+void x86_av1_itx_identity_sse4(int32_t *buf, int stride, int lanes, int n);
+void x86_av1_intra_paeth_sse4(uint16_t *dst, int stride, const uint16_t *above,
+                              const uint16_t *left, int w, int h);
+void x86_av1_intra_smooth_sse4(uint16_t *dst, int stride,
+                               const uint16_t *above, const uint16_t *left,
+                               int w, int h);
+void x86_av1_cfl_pred_sse4(uint16_t *dst, int stride, const int16_t *ac,
+                           int w, int h, int alpha, int bitdepth);
+
+/* first h rows of some columns of an n x n block to all n rows, with the
+ * rounding shift of the stage
+ */
+typedef void (*x86_hevc_idct_cols)(const int16_t *src, int16_t *dst, int n,
+                                   int h, int shift);
+void x86_hevc_idct_2d(int16_t *coeffs, int n, int bitdepth, int w, int h,
+                      x86_hevc_idct_cols cols, int width);
+void x86_hevc_idst_4x4_sse4(int16_t *coeffs, int bitdepth, int w, int h);
+void x86_hevc_idct_4x4_sse4(int16_t *coeffs, int bitdepth, int w, int h);
+void x86_hevc_idct_8x8_sse4(int16_t *coeffs, int bitdepth, int w, int h);
+void x86_hevc_idct_16x16_sse4(int16_t *coeffs, int bitdepth, int w, int h);
+void x86_hevc_idct_32x32_sse4(int16_t *coeffs, int bitdepth, int w, int h);
+
+/* nTbS rows of a vertical intra mode, ref[0] is the top left sample of the
+ * reference line, and angle is intraPredAngle
+ */
+typedef void (*x86_hevc_intra_rows)(uint16_t *dst, int stride,
+                                    const uint16_t *ref, int nTbS, int angle);
+void x86_hevc_intra_angular(uint16_t *dst, uint16_t *left, uint16_t *top,
+                            int nTbS, int stride, int cIdx, int predModeIntra,
+                            int disableIntraBoundaryFilter, int bitdepth,
+                            x86_hevc_intra_rows rows);
+void x86_hevc_intra_planar_sse4(uint16_t *dst, uint16_t *left, uint16_t *top,
+                                int nTbS, int stride);
+void x86_hevc_intra_dc_sse4(uint16_t *dst, uint16_t *left, uint16_t *top,
+                            int nTbS, int stride, int cIdx,
+                            int intra_boundary_filtering_disabled_flag);
+void x86_hevc_intra_angular_sse4(uint16_t *dst, uint16_t *left, uint16_t *top,
+                                 int nTbS, int stride, int cIdx,
+                                 int predModeIntra,
+                                 int disableIntraBoundaryFilter, int bitdepth);
+void x86_hevc_yuv_bgra32_sse4(uint8_t *dst, const int16_t *y, const int16_t *u,
+                              const int16_t *v, int width, int sub,
+                              int bitdepth);
+void x86_hevc_yuv_rgba64_sse4(uint16_t *dst, const int16_t *y,
+                              const int16_t *u, const int16_t *v, int width,
+                              int sub, int bitdepth);
+
+/* one pass of an interpolation filter, see x86_hevc_mc() */
+typedef void (*x86_hevc_mc_pass)(int16_t *dst, int dststride,
+                                 const int16_t *src, int srcstride, int step,
+                                 int w, int h, const int8_t *f, int taps,
+                                 int shift);
+void x86_hevc_mc_pass_sse4(int16_t *dst, int dststride, const int16_t *src,
+                           int srcstride, int step, int w, int h,
+                           const int8_t *f, int taps, int shift);
+void x86_hevc_mc(int16_t *dst, int dststride, const int16_t *src,
+                 int srcstride, int w, int h, const int8_t *fx,
+                 const int8_t *fy, int taps, int bitdepth,
+                 x86_hevc_mc_pass pass);
+void x86_hevc_pred_uni_sse4(int16_t *dst, int dststride, const int16_t *src,
+                            int srcstride, int w, int h, int bitdepth);
+void x86_hevc_pred_bi_sse4(int16_t *dst, int dststride, const int16_t *src0,
+                           const int16_t *src1, int srcstride, int w, int h,
+                           int bitdepth);
+int x86_hevc_unescape_sse4(uint8_t *dst, const uint8_t *src, int len, int *epb,
+                           int *num_epb);
 #endif
 #ifdef __SSE2__
 void x86_sse2_init(void);
+void x86_vp8_dsp_init_sse2(struct vp8_dsp *dsp);
 #endif
 
 #ifdef __cplusplus
@@ -0,0 +1,4514 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <errno.h>
+
+#include "bitstream.h"
+#include "symdec.h"
+#include "av1cdf.h"
+#include "av1qm.h"
+#include "av1dsp.h"
+#include "hevcdsp.h"
+#include "vlog.h"
+#include "utils.h"
+#include "av1.h"
+
+VLOG_REGISTER(av1, INFO)
+
+#define MI_SIZE 4
+#define MI_SIZE_LOG2 2
+#define PALETTE_COLORS 8
+#define MAX_LOOP_FILTER 63
+#define PRIMARY_REF_NONE 7
+
+static inline int
+floor_log2(uint32_t x)
+{
+    return 31 - __builtin_clz(x);
+}
+
+static inline int
+ceil_log2(int x)
+{
+    int i = 0;
+    if (x < 2) {
+        return 0;
+    }
+    while ((1 << i) < x) {
+        i++;
+    }
+    return i;
+}
+
+//------------------------------------------------------------------------------
+// OBU syntax, see 5.3 to 5.8
+
+static uint64_t
+read_leb128(struct bits_vec *v)
+{
+    uint64_t value = 0;
+    for (int i = 0; i < 8; i++) {
+        int byte = READ_BITS(v, 8);
+        value |= (uint64_t)(byte & 0x7F) << (i * 7);
+        if (!(byte & 0x80)) {
+            break;
+        }
+    }
+    return value;
+}
+
+/* see 4.10.3 */
+static int
+read_uvlc(struct bits_vec *v)
+{
+    int leading = 0;
+    while (!READ_BIT(v)) {
+        if (++leading >= 32) {
+            return -1;
+        }
+    }
+    return READ_BITS(v, leading) + (1 << leading) - 1;
+}
+
+/* see 4.10.6, su(n) */
+static int
+read_su(struct bits_vec *v, int n)
+{
+    int value = READ_BITS(v, n);
+    int sign_mask = 1 << (n - 1);
+    if (value & sign_mask) {
+        value -= 2 * sign_mask;
+    }
+    return value;
+}
+
+/* see 4.10.7, ns(n) */
+static int
+read_ns(struct bits_vec *v, int n)
+{
+    int w = floor_log2(n) + 1;
+    int m = (1 << w) - n;
+    int value = READ_BITS(v, w - 1);
+    if (value < m) {
+        return value;
+    }
+    return (value << 1) - m + READ_BIT(v);
+}
+
+int
+av1_obu_header(struct obu_header *h, const uint8_t *data, int len,
+               int *header_size, int *size)
+{
+    if (len < 1) {
+        return -1;
+    }
+    h->obu_forbidden_bit = data[0] >> 7;
+    h->obu_type = (data[0] >> 3) & 0xF;
+    h->obu_extension_flag = (data[0] >> 2) & 1;
+    h->obu_has_size_field = (data[0] >> 1) & 1;
+    h->obu_reserved_1bit = data[0] & 1;
+    int n = 1;
+    if (h->obu_extension_flag) {
+        if (len < 2) {
+            return -1;
+        }
+        h->ext.temporal_id = data[1] >> 5;
+        h->ext.spatial_id = (data[1] >> 3) & 3;
+        h->ext.extension_header_reserved_3bits = data[1] & 7;
+        n++;
+    }
+    if (h->obu_has_size_field) {
+        uint64_t value = 0;
+        for (int i = 0; i < 8; i++) {
+            if (n >= len) {
+                return -1;
+            }
+            value |= (uint64_t)(data[n] & 0x7F) << (i * 7);
+            if (!(data[n++] & 0x80)) {
+                break;
+            }
+        }
+        if (value > (uint64_t)(len - n)) {
+            return -1;
+        }
+        *size = (int)value;
+    } else {
+        *size = len - n;
+    }
+    *header_size = n;
+    return 0;
+}
+
+static int
+parse_color_config(struct color_config *cc, struct sequence_header_obu *obu, struct bits_vec *v)
+{
+    cc->high_bitdepth = READ_BIT(v);
+    if (obu->seq_profile == 2 && cc->high_bitdepth) {
+        cc->twelve_bit = READ_BIT(v);
+        obu->BitDepth = cc->twelve_bit ? 12: 10;
+    } else {
+        cc->twelve_bit = 0;
+        obu->BitDepth = cc->high_bitdepth ? 10 : 8;
+    }
+    if (obu->seq_profile == 1) {
+        cc->mono_chrome = 0;
+    } else {
+        cc->mono_chrome = READ_BIT(v);
+    }
+    obu->NumPlanes = cc->mono_chrome ? 1: 3;
+    cc->color_description_present_flag = READ_BIT(v);
+    if (cc->color_description_present_flag) {
+        cc->color_primaries = READ_BITS(v, 8);
+        cc->transfer_characteristics = READ_BITS(v, 8);
+        cc->matrix_coefficients = READ_BITS(v, 8);
+    } else {
+        cc->color_primaries = CP_UNSPECIFIED;
+        cc->transfer_characteristics = TC_UNSPECIFIED;
+        cc->matrix_coefficients = MC_UNSPECIFIED;
+    }
+    if (cc->mono_chrome) {
+        cc->color_range = READ_BIT(v);
+        cc->subsampling_x = 1;
+        cc->subsampling_y = 1;
+        cc->chroma_sample_position = CSP_UNKNOWN;
+        cc->separate_uv_delta_q = 0;
+        return 0;
+    } else if (cc->color_primaries == CP_BT_709 &&
+        cc->transfer_characteristics == TC_SRGB &&
+        cc->matrix_coefficients == MC_IDENTITY) {
+        cc->color_range = 1;
+        cc->subsampling_x = 0;
+        cc->subsampling_y = 0;
+    } else {
+        cc->color_range = READ_BIT(v);
+        if (obu->seq_profile == 0) {
+            cc->subsampling_x = 1;
+            cc->subsampling_y = 1;
+        } else if (obu->seq_profile == 1) {
+            cc->subsampling_x = 0;
+            cc->subsampling_y = 0;
+        } else {
+            if (obu->BitDepth == 12) {
+                cc->subsampling_x = READ_BIT(v);
+                if (cc->subsampling_x) {
+                    cc->subsampling_y = READ_BIT(v);
+                } else {
+                    cc->subsampling_y = 0;
+                }
+            } else {
+                cc->subsampling_x = 1;
+                cc->subsampling_y = 0;
+            }
+        }
+        if (cc->subsampling_x && cc->subsampling_y) {
+            cc->chroma_sample_position = READ_BITS(v, 2);
+        }
+    }
+    cc->separate_uv_delta_q = READ_BIT(v);
+    return 0;
+}
+
+/* see 5.5.1 */
+static struct sequence_header_obu *
+parse_sequence_header_obu(struct bits_vec *v)
+{
+    struct sequence_header_obu *obu = calloc(1, sizeof(*obu));
+    obu->seq_profile = READ_BITS(v, 3);
+    obu->still_picture = READ_BIT(v);
+    obu->reduced_still_picture_header = READ_BIT(v);
+    if (obu->reduced_still_picture_header) {
+        obu->timing_info_present_flag = 0;
+        obu->decoder_model_info_present_flag = 0;
+        obu->initial_display_delay_present_flag = 0;
+        obu->operating_points_cnt_minus_1 = 0;
+        obu->points = calloc(1, sizeof(struct operating_points));
+        obu->points[0].operating_point_idc = 0;
+        obu->points[0].seq_level_idx = READ_BITS(v, 5);
+        obu->points[0].seq_tier = 0;
+        obu->points[0].decoder_model_present_for_this_op = 0;
+        obu->points[0].initial_display_delay_present_for_this_op = 0;
+    } else {
+        obu->timing_info_present_flag = READ_BIT(v);
+        if (obu->timing_info_present_flag) {
+            // see 5.5.3, timing_info()
+            SKIP_BITS(v, 32);
+            SKIP_BITS(v, 32);
+            obu->equal_picture_interval = READ_BIT(v);
+            if (obu->equal_picture_interval) {
+                read_uvlc(v);
+            }
+            obu->decoder_model_info_present_flag = READ_BIT(v);
+            if (obu->decoder_model_info_present_flag) {
+                obu->minfo.buffer_delay_length_minus_1 = READ_BITS(v, 5);
+                obu->minfo.num_units_in_decoding_tick = (uint32_t)READ_BITS(v, 16) << 16;
+                obu->minfo.num_units_in_decoding_tick |= READ_BITS(v, 16);
+                obu->minfo.buffer_removal_time_length_minus_1 = READ_BITS(v, 5);
+                obu->minfo.frame_presentation_time_length_minus_1 = READ_BITS(v, 5);
+            }
+        } else {
+            obu->decoder_model_info_present_flag = 0;
+        }
+        obu->initial_display_delay_present_flag = READ_BIT(v);
+        obu->operating_points_cnt_minus_1 = READ_BITS(v, 5);
+        obu->points = calloc(obu->operating_points_cnt_minus_1 + 1,
+                             sizeof(struct operating_points));
+        for (int i = 0; i <= obu->operating_points_cnt_minus_1; i++) {
+            obu->points[i].operating_point_idc = READ_BITS(v, 12);
+            obu->points[i].seq_level_idx = READ_BITS(v, 5);
+            if (obu->points[i].seq_level_idx > 7) {
+                obu->points[i].seq_tier = READ_BIT(v);
+            } else {
+                obu->points[i].seq_tier = 0;
+            }
+            if (obu->decoder_model_info_present_flag) {
+                obu->points[i].decoder_model_present_for_this_op = READ_BIT(v);
+                if (obu->points[i].decoder_model_present_for_this_op) {
+                    int n = obu->minfo.buffer_delay_length_minus_1 + 1;
+                    obu->points[i].pinfo.decoder_buffer_delay = READ_BITS(v, n);
+                    obu->points[i].pinfo.encoder_buffer_delay = READ_BITS(v, n);
+                    obu->points[i].pinfo.low_delay_mode_flag = READ_BIT(v);
+                }
+            } else {
+                obu->points[i].decoder_model_present_for_this_op = 0;
+            }
+            if (obu->initial_display_delay_present_flag) {
+                obu->points[i].initial_display_delay_present_for_this_op = READ_BIT(v);
+                if (obu->points[i].initial_display_delay_present_for_this_op) {
+                    obu->points[i].initial_display_delay_minus_1 = READ_BITS(v, 4);
+                }
+            }
+        }
+    }
+    obu->frame_width_bits_minus_1 = READ_BITS(v, 4);
+    obu->frame_height_bits_minus_1 = READ_BITS(v, 4);
+    obu->max_frame_width_minus_1 = READ_BITS(v, obu->frame_width_bits_minus_1+1);
+    obu->max_frame_height_minus_1 = READ_BITS(v, obu->frame_height_bits_minus_1+1);
+    if (obu->reduced_still_picture_header) {
+        obu->frame_id_numbers_present_flag = 0;
+    } else {
+        obu->frame_id_numbers_present_flag = READ_BIT(v);
+    }
+    if (obu->frame_id_numbers_present_flag) {
+        obu->delta_frame_id_length_minus_2 = READ_BITS(v, 4);
+        obu->additional_frame_id_length_minus_1 = READ_BITS(v, 3);
+    }
+    obu->use_128x128_superblock = READ_BIT(v);
+    obu->enable_filter_intra = READ_BIT(v);
+    obu->enable_intra_edge_filter = READ_BIT(v);
+    if (obu->reduced_still_picture_header) {
+        obu->enable_interintra_compound = 0;
+        obu->enable_masked_compound = 0;
+        obu->enable_warped_motion = 0;
+        obu->enable_dual_filter = 0;
+        obu->enable_order_hint = 0;
+        obu->enable_jnt_comp = 0;
+        obu->enable_ref_frame_mvs = 0;
+        obu->seq_force_screen_content_tools = SELECT_SCREEN_CONTENT_TOOLS;
+        obu->seq_force_integer_mv = SELECT_INTEGER_MV;
+        obu->OrderHintBits = 0;
+    } else {
+        obu->enable_interintra_compound = READ_BIT(v);
+        obu->enable_masked_compound = READ_BIT(v);
+        obu->enable_warped_motion = READ_BIT(v);
+        obu->enable_dual_filter = READ_BIT(v);
+        obu->enable_order_hint = READ_BIT(v);
+        if (obu->enable_order_hint) {
+            obu->enable_jnt_comp = READ_BIT(v);
+            obu->enable_ref_frame_mvs = READ_BIT(v);
+        } else {
+            obu->enable_jnt_comp = 0;
+            obu->enable_ref_frame_mvs = 0;
+        }
+        obu->seq_choose_screen_content_tools = READ_BIT(v);
+        if (obu->seq_choose_screen_content_tools) {
+            obu->seq_force_screen_content_tools = SELECT_SCREEN_CONTENT_TOOLS;
+        } else {
+            obu->seq_force_screen_content_tools = READ_BIT(v);
+        }
+        if (obu->seq_force_screen_content_tools > 0) {
+            obu->seq_choose_integer_mv = READ_BIT(v);
+            if (obu->seq_choose_integer_mv) {
+                obu->seq_force_integer_mv = SELECT_INTEGER_MV;
+            } else {
+                obu->seq_force_integer_mv = READ_BIT(v);
+            }
+        } else {
+            obu->seq_force_integer_mv = SELECT_INTEGER_MV;
+        }
+        if (obu->enable_order_hint) {
+            obu->order_hint_bits_minus_1 = READ_BITS(v, 3);
+            obu->OrderHintBits = obu->order_hint_bits_minus_1 + 1;
+        } else {
+            obu->OrderHintBits = 0;
+        }
+    }
+
+    obu->enable_superres = READ_BIT(v);
+    obu->enable_cdef = READ_BIT(v);
+    obu->enable_restoration = READ_BIT(v);
+    parse_color_config(&obu->cc, obu, v);
+    obu->film_grain_params_present = READ_BIT(v);
+
+    return obu;
+}
+
+struct sequence_header_obu *
+av1_parse_sequence_header(const uint8_t *data, int len)
+{
+    struct bits_vec *v = bits_vec_alloc((uint8_t *)data, len, BITS_MSB);
+    struct sequence_header_obu *obu = parse_sequence_header_obu(v);
+    if (v->eof) {
+        av1_free_sequence_header(obu);
+        obu = NULL;
+    }
+    v->buff = NULL;
+    bits_vec_free(v);
+    return obu;
+}
+
+void
+av1_free_sequence_header(struct sequence_header_obu *seq)
+{
+    if (seq) {
+        free(seq->points);
+        free(seq);
+    }
+}
+
+static int
+parse_metadata_itut_t35(struct metadata_itut_t35 *mi, struct bits_vec *v)
+{
+    mi->itu_t_t35_country_code = READ_BITS(v, 8);
+    if (mi->itu_t_t35_country_code == 0xFF) {
+        mi->itu_t_t35_country_code_extension_byte = READ_BITS(v, 8);
+    }
+    // the payload is left to whoever knows the country code
+    mi->itu_t_t35_payload_bytes = NULL;
+    return 0;
+}
+
+static int
+parse_metadata_hdr_cll(struct metadata_hdr_cll *mh, struct bits_vec *v)
+{
+    mh->max_cll = READ_BITS(v, 16);
+    mh->max_fall = READ_BITS(v, 16);
+    return 0;
+}
+
+static int
+parse_metadata_hdr_mdcv(struct metadata_hdr_mdcv *mh, struct bits_vec *v)
+{
+    for (int i = 0; i < 3; i++ ) {
+        mh->primary_chromaticity_x[i] = READ_BITS(v, 16);
+        mh->primary_chromaticity_y[i] = READ_BITS(v, 16);
+    }
+    mh->white_point_chromaticity_x = READ_BITS(v, 16);
+    mh->white_point_chromaticity_y = READ_BITS(v, 16);
+    mh->luminance_max = (uint32_t)READ_BITS(v, 16) << 16;
+    mh->luminance_max |= READ_BITS(v, 16);
+    mh->luminance_min = (uint32_t)READ_BITS(v, 16) << 16;
+    mh->luminance_min |= READ_BITS(v, 16);
+    return 0;
+}
+
+static int
+parse_metadata_scalability(struct metadata_scalability *ms, struct bits_vec *v)
+{
+    ms->scalability_mode_idc = READ_BITS(v, 8);
+    ms->groups = NULL;
+    if (ms->scalability_mode_idc == SCALABILITY_SS) {
+        ms->spatial_layers_cnt_minus_1 =  READ_BITS(v, 2);
+        ms->spatial_layer_dimensions_present_flag =  READ_BIT(v);
+        ms->spatial_layer_description_present_flag =  READ_BIT(v);
+        ms->temporal_group_description_present_flag = READ_BIT(v);
+        ms->scalability_structure_reserved_3bits = READ_BITS(v, 3);
+        if (ms->spatial_layer_dimensions_present_flag) {
+            for (int i = 0; i <= ms->spatial_layers_cnt_minus_1 ; i++ ) {
+                ms->spatial_layer_max_width[i] = READ_BITS(v, 16);
+                ms->spatial_layer_max_height[i] = READ_BITS(v, 16);
+            }
+        }
+        if (ms->spatial_layer_description_present_flag) {
+            for (int i = 0; i <= ms->spatial_layers_cnt_minus_1; i++) {
+                ms->spatial_layer_ref_id[i] = READ_BITS(v, 8);
+            }
+        }
+        if (ms->temporal_group_description_present_flag) {
+            ms->temporal_group_size = READ_BITS(v, 8);
+            ms->groups = malloc(sizeof(struct temporal_group) * ms->temporal_group_size);
+            for (int i = 0; i < ms->temporal_group_size; i++ ) {
+                ms->groups[i].temporal_group_temporal_id = READ_BITS(v, 3);
+                ms->groups[i].temporal_group_temporal_switching_up_point_flag = READ_BIT(v);
+                ms->groups[i].temporal_group_spatial_switching_up_point_flag = READ_BIT(v);
+                ms->groups[i].temporal_group_ref_cnt = READ_BITS(v, 3);
+                for (int j = 0; j < ms->groups[i].temporal_group_ref_cnt; j++) {
+                    ms->groups[i].temporal_group_ref_pic_diff[j] = READ_BITS(v, 8);
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+static int
+parse_metadata_timecode(struct metadata_timecode *mt, struct bits_vec *v)
+{
+    mt->counting_type = READ_BITS(v, 5);
+    mt->full_timestamp_flag = READ_BIT(v);
+    mt->discontinuity_flag = READ_BIT(v);
+    mt->cnt_dropped_flag = READ_BIT(v);
+    mt->n_frames = READ_BITS(v, 9);
+    if (mt->full_timestamp_flag) {
+        mt->seconds_value = READ_BITS(v, 6);
+        mt->minutes_value = READ_BITS(v, 6);
+        mt->hours_value = READ_BITS(v, 5);
+    } else {
+        mt->seconds_flag =  READ_BIT(v);
+        if (mt->seconds_flag) {
+            mt->seconds_value = READ_BITS(v, 6);
+            mt->minutes_flag = READ_BIT(v);
+            if (mt->minutes_flag) {
+                mt->minutes_value = READ_BITS(v, 6);
+                mt->hours_flag = READ_BIT(v);
+                if (mt->hours_flag) {
+                    mt->hours_value = READ_BITS(v, 5);
+                }
+            }
+        }
+    }
+    int time_offset_length = READ_BITS(v, 5);
+    if (time_offset_length > 0) {
+        mt->time_offset_value = READ_BITS(v, time_offset_length);
+    }
+    return 0;
+}
+
+struct metadata_obu *
+av1_parse_metadata(const uint8_t *data, int len)
+{
+    struct bits_vec *v = bits_vec_alloc((uint8_t *)data, len, BITS_MSB);
+    struct metadata_obu *mo = calloc(1, sizeof(struct metadata_obu));
+    mo->metadata_type = read_leb128(v);
+    if (mo->metadata_type == METADATA_TYPE_ITUT_T35) {
+        parse_metadata_itut_t35(&mo->itut_t35, v);
+    } else if (mo->metadata_type == METADATA_TYPE_HDR_CLL) {
+        parse_metadata_hdr_cll(&mo->hdr_cll, v);
+    } else if (mo->metadata_type == METADATA_TYPE_HDR_MDCV) {
+        parse_metadata_hdr_mdcv(&mo->hdr_mdcv, v);
+    } else if (mo->metadata_type == METADATA_TYPE_SCALABILITY) {
+        parse_metadata_scalability(&mo->scalability, v);
+    } else if (mo->metadata_type == METADATA_TYPE_TIMECODE) {
+        parse_metadata_timecode(&mo->timecode, v);
+    }
+    v->buff = NULL;
+    bits_vec_free(v);
+    return mo;
+}
+
+void
+av1_free_metadata(struct metadata_obu *mo)
+{
+    if (mo && mo->metadata_type == METADATA_TYPE_SCALABILITY) {
+        free(mo->scalability.groups);
+    }
+    free(mo);
+}
+
+//------------------------------------------------------------------------------
+// constant tables of the spec, see section 9.3 and the annex of its tables
+
+enum {
+    BLOCK_4X4 = 0,
+    BLOCK_4X8,
+    BLOCK_8X4,
+    BLOCK_8X8,
+    BLOCK_8X16,
+    BLOCK_16X8,
+    BLOCK_16X16,
+    BLOCK_16X32,
+    BLOCK_32X16,
+    BLOCK_32X32,
+    BLOCK_32X64,
+    BLOCK_64X32,
+    BLOCK_64X64,
+    BLOCK_64X128,
+    BLOCK_128X64,
+    BLOCK_128X128,
+    BLOCK_4X16,
+    BLOCK_16X4,
+    BLOCK_8X32,
+    BLOCK_32X8,
+    BLOCK_16X64,
+    BLOCK_64X16,
+    BLOCK_INVALID,
+};
+
+enum {
+    PARTITION_NONE = 0,
+    PARTITION_HORZ,
+    PARTITION_VERT,
+    PARTITION_SPLIT,
+    PARTITION_HORZ_A,
+    PARTITION_HORZ_B,
+    PARTITION_VERT_A,
+    PARTITION_VERT_B,
+    PARTITION_HORZ_4,
+    PARTITION_VERT_4,
+};
+
+enum {
+    TX_4X4 = 0,
+    TX_8X8,
+    TX_16X16,
+    TX_32X32,
+    TX_64X64,
+    TX_4X8,
+    TX_8X4,
+    TX_8X16,
+    TX_16X8,
+    TX_16X32,
+    TX_32X16,
+    TX_32X64,
+    TX_64X32,
+    TX_4X16,
+    TX_16X4,
+    TX_8X32,
+    TX_32X8,
+    TX_16X64,
+    TX_64X16,
+    TX_INVALID,
+};
+
+// intra modes, UV_CFL_PRED only for chroma
+enum {
+    DC_PRED = 0,
+    V_PRED,
+    H_PRED,
+    D45_PRED,
+    D135_PRED,
+    D113_PRED,
+    D157_PRED,
+    D203_PRED,
+    D67_PRED,
+    SMOOTH_PRED,
+    SMOOTH_V_PRED,
+    SMOOTH_H_PRED,
+    PAETH_PRED,
+    UV_CFL_PRED,
+};
+
+enum {
+    TX_SET_DCTONLY = 0,
+    TX_SET_INTRA_1,
+    TX_SET_INTRA_2,
+};
+
+enum {
+    TX_CLASS_2D = 0,
+    TX_CLASS_HORIZ,
+    TX_CLASS_VERT,
+};
+
+static const uint8_t Num_4x4_Blocks_Wide[BLOCK_INVALID] = {
+    1, 1, 2, 2, 2, 4, 4, 4, 8, 8, 8, 16, 16, 16, 32, 32, 1, 4, 2, 8, 4, 16,
+};
+
+static const uint8_t Num_4x4_Blocks_High[BLOCK_INVALID] = {
+    1, 2, 1, 2, 4, 2, 4, 8, 4, 8, 16, 8, 16, 32, 16, 32, 4, 1, 8, 2, 16, 4,
+};
+
+static const uint8_t Mi_Width_Log2[BLOCK_INVALID] = {
+    0, 0, 1, 1, 1, 2, 2, 2, 3, 3, 3, 4, 4, 4, 5, 5, 0, 2, 1, 3, 2, 4,
+};
+
+static const uint8_t Mi_Height_Log2[BLOCK_INVALID] = {
+    0, 1, 0, 1, 2, 1, 2, 3, 2, 3, 4, 3, 4, 5, 4, 5, 2, 0, 3, 1, 4, 2,
+};
+
+// block sizes by log2 of width and height - 2
+static const uint8_t Block_Size_Dims[6][6] = {
+    { BLOCK_4X4, BLOCK_4X8, BLOCK_4X16, BLOCK_INVALID, BLOCK_INVALID, BLOCK_INVALID },
+    { BLOCK_8X4, BLOCK_8X8, BLOCK_8X16, BLOCK_8X32, BLOCK_INVALID, BLOCK_INVALID },
+    { BLOCK_16X4, BLOCK_16X8, BLOCK_16X16, BLOCK_16X32, BLOCK_16X64, BLOCK_INVALID },
+    { BLOCK_INVALID, BLOCK_32X8, BLOCK_32X16, BLOCK_32X32, BLOCK_32X64, BLOCK_INVALID },
+    { BLOCK_INVALID, BLOCK_INVALID, BLOCK_64X16, BLOCK_64X32, BLOCK_64X64, BLOCK_64X128 },
+    { BLOCK_INVALID, BLOCK_INVALID, BLOCK_INVALID, BLOCK_INVALID, BLOCK_128X64, BLOCK_128X128 },
+};
+
+static const uint8_t Tx_Width_Log2[TX_INVALID] = {
+    2, 3, 4, 5, 6, 2, 3, 3, 4, 4, 5, 5, 6, 2, 4, 3, 5, 4, 6,
+};
+
+static const uint8_t Tx_Height_Log2[TX_INVALID] = {
+    2, 3, 4, 5, 6, 3, 2, 4, 3, 5, 4, 6, 5, 4, 2, 5, 3, 6, 4,
+};
+
+static const uint8_t Split_Tx_Size[TX_INVALID] = {
+    TX_4X4, TX_4X4, TX_8X8, TX_16X16, TX_32X32, TX_4X4, TX_4X4, TX_8X8,
+    TX_8X8, TX_16X16, TX_16X16, TX_32X32, TX_32X32, TX_4X8, TX_8X4,
+    TX_8X16, TX_16X8, TX_16X32, TX_32X16,
+};
+
+static const uint8_t Tx_Size_Sqr[TX_INVALID] = {
+    TX_4X4, TX_8X8, TX_16X16, TX_32X32, TX_64X64, TX_4X4, TX_4X4, TX_8X8,
+    TX_8X8, TX_16X16, TX_16X16, TX_32X32, TX_32X32, TX_4X4, TX_4X4,
+    TX_8X8, TX_8X8, TX_16X16, TX_16X16,
+};
+
+static const uint8_t Tx_Size_Sqr_Up[TX_INVALID] = {
+    TX_4X4, TX_8X8, TX_16X16, TX_32X32, TX_64X64, TX_8X8, TX_8X8, TX_16X16,
+    TX_16X16, TX_32X32, TX_32X32, TX_64X64, TX_64X64, TX_16X16, TX_16X16,
+    TX_32X32, TX_32X32, TX_64X64, TX_64X64,
+};
+
+// transform sizes by log2 of width and height - 2
+static const uint8_t Tx_Size_Dims[5][5] = {
+    { TX_4X4, TX_4X8, TX_4X16, TX_INVALID, TX_INVALID },
+    { TX_8X4, TX_8X8, TX_8X16, TX_8X32, TX_INVALID },
+    { TX_16X4, TX_16X8, TX_16X16, TX_16X32, TX_16X64 },
+    { TX_INVALID, TX_32X8, TX_32X16, TX_32X32, TX_32X64 },
+    { TX_INVALID, TX_INVALID, TX_64X16, TX_64X32, TX_64X64 },
+};
+
+static const uint8_t Max_Tx_Depth[BLOCK_INVALID] = {
+    0, 1, 1, 1, 2, 2, 2, 3, 3, 3, 4, 4, 4, 4, 4, 4, 2, 2, 3, 3, 4, 4,
+};
+
+static const uint8_t Mode_To_Angle[PAETH_PRED + 1] = {
+    0, 90, 180, 45, 135, 113, 157, 203, 67, 0, 0, 0, 0,
+};
+
+static const uint8_t Intra_Mode_Context[PAETH_PRED + 1] = {
+    0, 1, 2, 3, 4, 4, 4, 4, 3, 0, 1, 2, 0,
+};
+
+static const uint8_t Mode_To_Txfm[UV_CFL_PRED + 1] = {
+    DCT_DCT, ADST_DCT, DCT_ADST, DCT_DCT, ADST_ADST, ADST_DCT, DCT_ADST,
+    DCT_ADST, ADST_DCT, ADST_ADST, ADST_DCT, DCT_ADST, ADST_ADST, DCT_DCT,
+};
+
+static const uint8_t Tx_Type_Intra_Inv_Set1[7] = {
+    IDTX, DCT_DCT, V_DCT, H_DCT, ADST_ADST, ADST_DCT, DCT_ADST,
+};
+
+static const uint8_t Tx_Type_Intra_Inv_Set2[5] = {
+    IDTX, DCT_DCT, ADST_ADST, ADST_DCT, DCT_ADST,
+};
+
+static const uint8_t Filter_Intra_Mode_To_Intra_Dir[5] = {
+    DC_PRED, V_PRED, H_PRED, D157_PRED, DC_PRED,
+};
+
+static const uint8_t Segmentation_Feature_Bits[AV1_SEG_LVL_MAX] = {
+    8, 6, 6, 6, 6, 3, 0, 0,
+};
+static const uint8_t Segmentation_Feature_Signed[AV1_SEG_LVL_MAX] = {
+    1, 1, 1, 1, 1, 0, 0, 0,
+};
+static const uint8_t Segmentation_Feature_Max[AV1_SEG_LVL_MAX] = {
+    255, MAX_LOOP_FILTER, MAX_LOOP_FILTER, MAX_LOOP_FILTER,
+    MAX_LOOP_FILTER, 7, 0, 0,
+};
+
+static const int8_t Palette_Color_Context[9] = {
+    -1, -1, 0, -1, -1, 4, 3, 2, 1,
+};
+
+static const uint8_t Palette_Color_Hash_Multipliers[3] = { 1, 2, 2 };
+
+static const int8_t Sig_Ref_Diff_Offset[3][5][2] = {
+    { { 0, 1 }, { 1, 0 }, { 1, 1 }, { 0, 2 }, { 2, 0 } },
+    { { 0, 1 }, { 1, 0 }, { 0, 2 }, { 0, 3 }, { 0, 4 } },
+    { { 0, 1 }, { 1, 0 }, { 2, 0 }, { 3, 0 }, { 4, 0 } },
+};
+
+static const int8_t Mag_Ref_Offset_With_Tx_Class[3][3][2] = {
+    { { 0, 1 }, { 1, 0 }, { 1, 1 } },
+    { { 0, 1 }, { 1, 0 }, { 0, 2 } },
+    { { 0, 1 }, { 1, 0 }, { 2, 0 } },
+};
+
+static const uint8_t Coeff_Base_Pos_Ctx_Offset[3] = { 26, 31, 36 };
+
+static const uint8_t Intra_Edge_Kernel[3][5] = {
+    { 0, 4, 8, 4, 0 }, { 0, 5, 6, 5, 0 }, { 2, 4, 4, 4, 2 },
+};
+
+static const uint8_t Cdef_Uv_Dir[2][2][8] = {
+    { { 0, 1, 2, 3, 4, 5, 6, 7 }, { 1, 2, 2, 2, 3, 4, 6, 0 } },
+    { { 7, 0, 2, 4, 5, 6, 6, 6 }, { 0, 1, 2, 3, 4, 5, 6, 7 } },
+};
+
+static const int8_t Wiener_Taps_Min[3] = { -5, -23, -17 };
+static const int8_t Wiener_Taps_Max[3] = { 10, 8, 46 };
+static const int8_t Wiener_Taps_K[3] = { 1, 2, 3 };
+static const int8_t Wiener_Taps_Mid[3] = { 3, -7, 15 };
+static const int8_t Sgrproj_Xqd_Min[2] = { -96, -32 };
+static const int8_t Sgrproj_Xqd_Max[2] = { 31, 95 };
+static const int8_t Sgrproj_Xqd_Mid[2] = { -32, 31 };
+
+/* Sgr_Params of the spec as the radius of both passes and then their
+ * scale, which is -1 where the radius is 0
+ */
+static const int16_t Sgr_Params[16][4] = {
+    { 2, 1, 140, 3236 }, { 2, 1, 112, 2158 }, { 2, 1, 93, 1618 },
+    { 2, 1, 80, 1438 },  { 2, 1, 70, 1295 },  { 2, 1, 58, 1177 },
+    { 2, 1, 47, 1079 },  { 2, 1, 37, 996 },   { 2, 1, 30, 925 },
+    { 2, 1, 25, 863 },   { 0, 1, -1, 2589 },  { 0, 1, -1, 1618 },
+    { 0, 1, -1, 1177 },  { 0, 1, -1, 925 },   { 2, 0, 56, -1 },
+    { 2, 0, 22, -1 },
+};
+
+static const uint8_t Remap_Lr_Type[4] = {
+    AV1_RESTORE_NONE, AV1_RESTORE_SWITCHABLE, AV1_RESTORE_WIENER,
+    AV1_RESTORE_SGRPROJ,
+};
+
+static const int16_t Dc_Qlookup[3][256] = {
+    {
+        4, 8, 8, 9, 10, 11, 12, 12, 13, 14, 15, 16,
+        17, 18, 19, 19, 20, 21, 22, 23, 24, 25, 26, 26,
+        27, 28, 29, 30, 31, 32, 32, 33, 34, 35, 36, 37,
+        38, 38, 39, 40, 41, 42, 43, 43, 44, 45, 46, 47,
+        48, 48, 49, 50, 51, 52, 53, 53, 54, 55, 56, 57,
+        57, 58, 59, 60, 61, 62, 62, 63, 64, 65, 66, 66,
+        67, 68, 69, 70, 70, 71, 72, 73, 74, 74, 75, 76,
+        77, 78, 78, 79, 80, 81, 81, 82, 83, 84, 85, 85,
+        87, 88, 90, 92, 93, 95, 96, 98, 99, 101, 102, 104,
+        105, 107, 108, 110, 111, 113, 114, 116, 117, 118, 120, 121,
+        123, 125, 127, 129, 131, 134, 136, 138, 140, 142, 144, 146,
+        148, 150, 152, 154, 156, 158, 161, 164, 166, 169, 172, 174,
+        177, 180, 182, 185, 187, 190, 192, 195, 199, 202, 205, 208,
+        211, 214, 217, 220, 223, 226, 230, 233, 237, 240, 243, 247,
+        250, 253, 257, 261, 265, 269, 272, 276, 280, 284, 288, 292,
+        296, 300, 304, 309, 313, 317, 322, 326, 330, 335, 340, 344,
+        349, 354, 359, 364, 369, 374, 379, 384, 389, 395, 400, 406,
+        411, 417, 423, 429, 435, 441, 447, 454, 461, 467, 475, 482,
+        489, 497, 505, 513, 522, 530, 539, 549, 559, 569, 579, 590,
+        602, 614, 626, 640, 654, 668, 684, 700, 717, 736, 755, 775,
+        796, 819, 843, 869, 896, 925, 955, 988, 1022, 1058, 1098, 1139,
+        1184, 1232, 1282, 1336,
+    },
+    {
+        4, 9, 10, 13, 15, 17, 20, 22, 25, 28, 31, 34,
+        37, 40, 43, 47, 50, 53, 57, 60, 64, 68, 71, 75,
+        78, 82, 86, 90, 93, 97, 101, 105, 109, 113, 116, 120,
+        124, 128, 132, 136, 140, 143, 147, 151, 155, 159, 163, 166,
+        170, 174, 178, 182, 185, 189, 193, 197, 200, 204, 208, 212,
+        215, 219, 223, 226, 230, 233, 237, 241, 244, 248, 251, 255,
+        259, 262, 266, 269, 273, 276, 280, 283, 287, 290, 293, 297,
+        300, 304, 307, 310, 314, 317, 321, 324, 327, 331, 334, 337,
+        343, 350, 356, 362, 369, 375, 381, 387, 394, 400, 406, 412,
+        418, 424, 430, 436, 442, 448, 454, 460, 466, 472, 478, 484,
+        490, 499, 507, 516, 525, 533, 542, 550, 559, 567, 576, 584,
+        592, 601, 609, 617, 625, 634, 644, 655, 666, 676, 687, 698,
+        708, 718, 729, 739, 749, 759, 770, 782, 795, 807, 819, 831,
+        844, 856, 868, 880, 891, 906, 920, 933, 947, 961, 975, 988,
+        1001, 1015, 1030, 1045, 1061, 1076, 1090, 1105, 1120, 1137, 1153, 1170,
+        1186, 1202, 1218, 1236, 1253, 1271, 1288, 1306, 1323, 1342, 1361, 1379,
+        1398, 1416, 1436, 1456, 1476, 1496, 1516, 1537, 1559, 1580, 1601, 1624,
+        1647, 1670, 1692, 1717, 1741, 1766, 1791, 1817, 1844, 1871, 1900, 1929,
+        1958, 1990, 2021, 2054, 2088, 2123, 2159, 2197, 2236, 2276, 2319, 2363,
+        2410, 2458, 2508, 2561, 2616, 2675, 2737, 2802, 2871, 2944, 3020, 3102,
+        3188, 3280, 3375, 3478, 3586, 3702, 3823, 3953, 4089, 4236, 4394, 4559,
+        4737, 4929, 5130, 5347,
+    },
+    {
+        4, 12, 18, 25, 33, 41, 50, 60, 70, 80, 91, 103,
+        115, 127, 140, 153, 166, 180, 194, 208, 222, 237, 251, 266,
+        281, 296, 312, 327, 343, 358, 374, 390, 405, 421, 437, 453,
+        469, 484, 500, 516, 532, 548, 564, 580, 596, 611, 627, 643,
+        659, 674, 690, 706, 721, 737, 752, 768, 783, 798, 814, 829,
+        844, 859, 874, 889, 904, 919, 934, 949, 964, 978, 993, 1008,
+        1022, 1037, 1051, 1065, 1080, 1094, 1108, 1122, 1136, 1151, 1165, 1179,
+        1192, 1206, 1220, 1234, 1248, 1261, 1275, 1288, 1302, 1315, 1329, 1342,
+        1368, 1393, 1419, 1444, 1469, 1494, 1519, 1544, 1569, 1594, 1618, 1643,
+        1668, 1692, 1717, 1741, 1765, 1789, 1814, 1838, 1862, 1885, 1909, 1933,
+        1957, 1992, 2027, 2061, 2096, 2130, 2165, 2199, 2233, 2267, 2300, 2334,
+        2367, 2400, 2434, 2467, 2499, 2532, 2575, 2618, 2661, 2704, 2746, 2788,
+        2830, 2872, 2913, 2954, 2995, 3036, 3076, 3127, 3177, 3226, 3275, 3324,
+        3373, 3421, 3469, 3517, 3565, 3621, 3677, 3733, 3788, 3843, 3897, 3951,
+        4005, 4058, 4119, 4181, 4241, 4301, 4361, 4420, 4479, 4546, 4612, 4677,
+        4742, 4807, 4871, 4942, 5013, 5083, 5153, 5222, 5291, 5367, 5442, 5517,
+        5591, 5665, 5745, 5825, 5905, 5984, 6063, 6149, 6234, 6319, 6404, 6495,
+        6587, 6678, 6769, 6867, 6966, 7064, 7163, 7269, 7376, 7483, 7599, 7715,
+        7832, 7958, 8085, 8214, 8352, 8492, 8635, 8788, 8945, 9104, 9275, 9450,
+        9639, 9832, 10031, 10245, 10465, 10702, 10946, 11210, 11482, 11776, 12081, 12409,
+        12750, 13118, 13501, 13913, 14343, 14807, 15290, 15812, 16356, 16943, 17575, 18237,
+        18949, 19718, 20521, 21387,
+    },
+};
+
+static const int16_t Ac_Qlookup[3][256] = {
+    {
+        4, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+        19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+        31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42,
+        43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54,
+        55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66,
+        67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78,
+        79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90,
+        91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102,
+        104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124, 126,
+        128, 130, 132, 134, 136, 138, 140, 142, 144, 146, 148, 150,
+        152, 155, 158, 161, 164, 167, 170, 173, 176, 179, 182, 185,
+        188, 191, 194, 197, 200, 203, 207, 211, 215, 219, 223, 227,
+        231, 235, 239, 243, 247, 251, 255, 260, 265, 270, 275, 280,
+        285, 290, 295, 300, 305, 311, 317, 323, 329, 335, 341, 347,
+        353, 359, 366, 373, 380, 387, 394, 401, 408, 416, 424, 432,
+        440, 448, 456, 465, 474, 483, 492, 501, 510, 520, 530, 540,
+        550, 560, 571, 582, 593, 604, 615, 627, 639, 651, 663, 676,
+        689, 702, 715, 729, 743, 757, 771, 786, 801, 816, 832, 848,
+        864, 881, 898, 915, 933, 951, 969, 988, 1007, 1026, 1046, 1066,
+        1087, 1108, 1129, 1151, 1173, 1196, 1219, 1243, 1267, 1292, 1317, 1343,
+        1369, 1396, 1423, 1451, 1479, 1508, 1537, 1567, 1597, 1628, 1660, 1692,
+        1725, 1759, 1793, 1828,
+    },
+    {
+        4, 9, 11, 13, 16, 18, 21, 24, 27, 30, 33, 37,
+        40, 44, 48, 51, 55, 59, 63, 67, 71, 75, 79, 83,
+        88, 92, 96, 100, 105, 109, 114, 118, 122, 127, 131, 136,
+        140, 145, 149, 154, 158, 163, 168, 172, 177, 181, 186, 190,
+        195, 199, 204, 208, 213, 217, 222, 226, 231, 235, 240, 244,
+        249, 253, 258, 262, 267, 271, 275, 280, 284, 289, 293, 297,
+        302, 306, 311, 315, 319, 324, 328, 332, 337, 341, 345, 349,
+        354, 358, 362, 367, 371, 375, 379, 384, 388, 392, 396, 401,
+        409, 417, 425, 433, 441, 449, 458, 466, 474, 482, 490, 498,
+        506, 514, 523, 531, 539, 547, 555, 563, 571, 579, 588, 596,
+        604, 616, 628, 640, 652, 664, 676, 688, 700, 713, 725, 737,
+        749, 761, 773, 785, 797, 809, 825, 841, 857, 873, 889, 905,
+        922, 938, 954, 970, 986, 1002, 1018, 1038, 1058, 1078, 1098, 1118,
+        1138, 1158, 1178, 1198, 1218, 1242, 1266, 1290, 1314, 1338, 1362, 1386,
+        1411, 1435, 1463, 1491, 1519, 1547, 1575, 1603, 1631, 1663, 1695, 1727,
+        1759, 1791, 1823, 1859, 1895, 1931, 1967, 2003, 2039, 2079, 2119, 2159,
+        2199, 2239, 2283, 2327, 2371, 2415, 2459, 2507, 2555, 2603, 2651, 2703,
+        2755, 2807, 2859, 2915, 2971, 3027, 3083, 3143, 3203, 3263, 3327, 3391,
+        3455, 3523, 3591, 3659, 3731, 3803, 3876, 3952, 4028, 4104, 4184, 4264,
+        4348, 4432, 4516, 4604, 4692, 4784, 4876, 4972, 5068, 5168, 5268, 5372,
+        5476, 5584, 5692, 5804, 5916, 6032, 6148, 6268, 6388, 6512, 6640, 6768,
+        6900, 7036, 7172, 7312,
+    },
+    {
+        4, 13, 19, 27, 35, 44, 54, 64, 75, 87, 99, 112,
+        126, 139, 154, 168, 183, 199, 214, 230, 247, 263, 280, 297,
+        314, 331, 349, 366, 384, 402, 420, 438, 456, 475, 493, 511,
+        530, 548, 567, 586, 604, 623, 642, 660, 679, 698, 716, 735,
+        753, 772, 791, 809, 828, 846, 865, 884, 902, 920, 939, 957,
+        976, 994, 1012, 1030, 1049, 1067, 1085, 1103, 1121, 1139, 1157, 1175,
+        1193, 1211, 1229, 1246, 1264, 1282, 1299, 1317, 1335, 1352, 1370, 1387,
+        1405, 1422, 1440, 1457, 1474, 1491, 1509, 1526, 1543, 1560, 1577, 1595,
+        1627, 1660, 1693, 1725, 1758, 1791, 1824, 1856, 1889, 1922, 1954, 1987,
+        2020, 2052, 2085, 2118, 2150, 2183, 2216, 2248, 2281, 2313, 2346, 2378,
+        2411, 2459, 2508, 2556, 2605, 2653, 2701, 2750, 2798, 2847, 2895, 2943,
+        2992, 3040, 3088, 3137, 3185, 3234, 3298, 3362, 3426, 3491, 3555, 3619,
+        3684, 3748, 3812, 3876, 3941, 4005, 4069, 4149, 4230, 4310, 4390, 4470,
+        4550, 4631, 4711, 4791, 4871, 4967, 5064, 5160, 5256, 5352, 5448, 5544,
+        5641, 5737, 5849, 5961, 6073, 6185, 6297, 6410, 6522, 6650, 6778, 6906,
+        7034, 7162, 7290, 7435, 7579, 7723, 7867, 8011, 8155, 8315, 8475, 8635,
+        8795, 8956, 9132, 9308, 9484, 9660, 9836, 10028, 10220, 10412, 10604, 10812,
+        11020, 11228, 11437, 11661, 11885, 12109, 12333, 12573, 12813, 13053, 13309, 13565,
+        13821, 14093, 14365, 14637, 14925, 15213, 15502, 15806, 16110, 16414, 16734, 17054,
+        17390, 17726, 18062, 18414, 18766, 19134, 19502, 19886, 20270, 20670, 21070, 21486,
+        21902, 22334, 22766, 23214, 23662, 24126, 24590, 25070, 25551, 26047, 26559, 27071,
+        27599, 28143, 28687, 29247,
+    },
+};
+
+static const int8_t Intra_Filter_Taps[5][8][7] = {
+    {
+        { -6, 10, 0, 0, 0, 12, 0 },
+        { -5, 2, 10, 0, 0, 9, 0 },
+        { -3, 1, 1, 10, 0, 7, 0 },
+        { -3, 1, 1, 2, 10, 5, 0 },
+        { -4, 6, 0, 0, 0, 2, 12 },
+        { -3, 2, 6, 0, 0, 2, 9 },
+        { -3, 2, 2, 6, 0, 2, 7 },
+        { -3, 1, 2, 2, 6, 3, 5 },
+    },
+    {
+        { -10, 16, 0, 0, 0, 10, 0 },
+        { -6, 0, 16, 0, 0, 6, 0 },
+        { -4, 0, 0, 16, 0, 4, 0 },
+        { -2, 0, 0, 0, 16, 2, 0 },
+        { -10, 16, 0, 0, 0, 0, 10 },
+        { -6, 0, 16, 0, 0, 0, 6 },
+        { -4, 0, 0, 16, 0, 0, 4 },
+        { -2, 0, 0, 0, 16, 0, 2 },
+    },
+    {
+        { -8, 8, 0, 0, 0, 16, 0 },
+        { -8, 0, 8, 0, 0, 16, 0 },
+        { -8, 0, 0, 8, 0, 16, 0 },
+        { -8, 0, 0, 0, 8, 16, 0 },
+        { -4, 4, 0, 0, 0, 0, 16 },
+        { -4, 0, 4, 0, 0, 0, 16 },
+        { -4, 0, 0, 4, 0, 0, 16 },
+        { -4, 0, 0, 0, 4, 0, 16 },
+    },
+    {
+        { -2, 8, 0, 0, 0, 10, 0 },
+        { -1, 3, 8, 0, 0, 6, 0 },
+        { -1, 2, 3, 8, 0, 4, 0 },
+        { 0, 1, 2, 3, 8, 2, 0 },
+        { -1, 4, 0, 0, 0, 3, 10 },
+        { -1, 3, 4, 0, 0, 4, 6 },
+        { -1, 2, 3, 4, 0, 4, 4 },
+        { -1, 2, 2, 3, 4, 3, 3 },
+    },
+    {
+        { -12, 14, 0, 0, 0, 14, 0 },
+        { -10, 0, 14, 0, 0, 12, 0 },
+        { -9, 0, 0, 14, 0, 11, 0 },
+        { -8, 0, 0, 0, 14, 10, 0 },
+        { -10, 12, 0, 0, 0, 0, 14 },
+        { -9, 1, 12, 0, 0, 0, 12 },
+        { -8, 0, 0, 12, 0, 1, 11 },
+        { -7, 0, 0, 1, 12, 1, 9 },
+    },
+};
+
+/* see 9.3 the scan tables, by log2 of the width and height - 2 of the
+ * adjusted transform size. The diagonal default scans, and the row and
+ * column ones of the 1D transforms which go up to 16 samples. They only
+ * depend on the size, so all frames share one copy.
+ */
+enum {
+    SCAN_DEFAULT = 0,
+    SCAN_MROW,
+    SCAN_MCOL,
+};
+
+static const uint16_t *Scans[4][4][3];
+static uint16_t scan_pool[3 * (4 + 8 + 16 + 32) * (4 + 8 + 16 + 32)];
+static pthread_once_t scan_once = PTHREAD_ONCE_INIT;
+
+static uint16_t *
+init_diag_scan(uint16_t *pos, int w, int h)
+{
+    for (int d = 0; d < w + h - 1; d++) {
+        // squares zig-zag, the first diagonal going up, and the other
+        // shapes go down on tall blocks and up on wide ones all the way
+        int down = (w == h) ? (d & 1) : (h > w);
+        int r0 = d < w ? 0 : d - w + 1;
+        int r1 = d < h ? d : h - 1;
+        for (int k = 0; k <= r1 - r0; k++) {
+            int r = down ? r0 + k : r1 - k;
+            *pos++ = r * w + d - r;
+        }
+    }
+    return pos;
+}
+
+static void
+init_scans(void)
+{
+    uint16_t *pos = scan_pool;
+    for (int wl = 0; wl < 4; wl++) {
+        for (int hl = 0; hl < 4; hl++) {
+            int w = 4 << wl, h = 4 << hl;
+            Scans[wl][hl][SCAN_DEFAULT] = pos;
+            pos = init_diag_scan(pos, w, h);
+            Scans[wl][hl][SCAN_MROW] = pos;
+            for (int i = 0; i < w * h; i++) {
+                *pos++ = i;
+            }
+            Scans[wl][hl][SCAN_MCOL] = pos;
+            for (int c = 0; c < w; c++) {
+                for (int r = 0; r < h; r++) {
+                    *pos++ = r * w + c;
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// the state of a frame being decoded
+
+/* what the later blocks and the loop filters need to know of a block, kept
+ * for every 4x4 luma position of the frame
+ */
+struct av1_mi {
+    uint8_t bsize;
+    uint8_t skip;
+    uint8_t segment_id;
+    uint8_t y_mode;
+    uint8_t uv_mode;
+    uint8_t tx_size;
+    int8_t delta_lf[4];
+};
+
+/* see 5.11.58, the loop restoration parameters of a unit */
+struct lr_unit {
+    uint8_t type;
+    uint8_t sgr_set;
+    int8_t wiener[2][3];
+    int16_t xqd[2];
+};
+
+/* the block being decoded, see 5.11.5 and the syntax elements it reads */
+struct av1_block {
+    int MiRow;
+    int MiCol;
+    int MiSize;
+    int bw4;
+    int bh4;
+    int HasChroma;
+    int AvailU;
+    int AvailL;
+    int AvailUChroma;
+    int AvailLChroma;
+
+    int skip;
+    int segment_id;
+    int Lossless;
+    int YMode;
+    int UVMode;
+    int AngleDeltaY;
+    int AngleDeltaUV;
+    int CflAlphaU;
+    int CflAlphaV;
+    int use_filter_intra;
+    int filter_intra_mode;
+    int PaletteSizeY;
+    int PaletteSizeUV;
+    uint16_t palette_colors[3][PALETTE_COLORS];
+    int TxSize;
+    int MaxLumaW;
+    int MaxLumaH;
+    uint8_t ColorMapY[64 * 64];     // by rows of 64
+    uint8_t ColorMapUV[64 * 64];
+};
+
+/* all a thread needs to decode a tile, a tile runs from start to end on one
+ * thread. The above contexts span the frame width and the left ones its
+ * height, by 4x4 units of each plane.
+ */
+struct av1_tile_ctx {
+    struct av1_decoder *dec;
+    struct symdec sd;
+    struct av1_cdf cdf;
+    struct av1_coef_cdf ccdf;
+    int MiRowStart;
+    int MiRowEnd;
+    int MiColStart;
+    int MiColEnd;
+    int CurrentQIndex;
+    int ReadDeltas;
+    int DeltaLF[4];
+    int RefSgrXqd[3][2];
+    int RefLrWiener[3][2][3];
+
+    uint8_t *above_level[3];
+    uint8_t *above_dc[3];
+    uint8_t *left_level[3];
+    uint8_t *left_dc[3];
+    uint8_t *above_pal_size[2];
+    uint8_t *left_pal_size[2];
+    uint16_t *above_pal[2];
+    uint16_t *left_pal[2];
+    int above_size;
+    int left_size;
+    uint8_t *ctx_buf;
+
+    // see 7.3.1, [plane][y + 1][x + 1] by 4x4 units of the superblock
+    uint8_t BlockDecoded[3][34][34];
+    struct av1_block b;
+
+    // the levels of the coefficients by rows, 4 more columns and rows so
+    // the contexts need no bounds checks
+    uint8_t levels[36 * 36];
+    int32_t coef[64 * 64] __attribute__((aligned(32)));
+    int16_t cfl_ac[32 * 32] __attribute__((aligned(32)));
+    uint16_t edge[2][2 * 64 + 48] __attribute__((aligned(32)));
+};
+
+struct av1_frame_ctx {
+    // CurrFrame, and CdefFrame and LrFrame when the filters are on, planes
+    // padded to whole 128x128 superblocks
+    uint16_t *frame[3][3];
+    uint16_t *buf[3];
+    size_t buf_size[3];
+    int stride[3];
+    int height[3];
+
+    struct av1_mi *mi;
+    size_t mi_size;
+    int mi_stride;
+    // LoopfilterTxSizes by 4x4 units of each plane, with mi_stride
+    uint8_t *txsz[3];
+    size_t txsz_size;
+    // by 64x64 luma blocks
+    int8_t *cdef_idx;
+    size_t cdef_size;
+    int cdef_stride;
+    struct lr_unit *lr[3];
+    size_t lr_size[3];
+    int lr_cols[3];
+    int lr_rows[3];
+
+    struct av1_tile_ctx **tc;
+    int ntc;
+    atomic_int next;
+    atomic_int error;
+};
+
+static inline int
+sb_size4(const struct sequence_header_obu *seq)
+{
+    return seq->use_128x128_superblock ? 32 : 16;
+}
+
+//------------------------------------------------------------------------------
+// uncompressed header, see 5.9
+
+static int
+tile_log2(int blk, int target)
+{
+    int k = 0;
+    while ((blk << k) < target) {
+        k++;
+    }
+    return k;
+}
+
+/* see 5.9.15 */
+static void
+parse_tile_info(struct av1_decoder *dec, struct bits_vec *v)
+{
+    struct av1_frame_header *fh = &dec->fh;
+    struct av1_tile_info *ti = &fh->ti;
+    int use128 = dec->seq->use_128x128_superblock;
+    int sbCols = use128 ? ((fh->MiCols + 31) >> 5) : ((fh->MiCols + 15) >> 4);
+    int sbRows = use128 ? ((fh->MiRows + 31) >> 5) : ((fh->MiRows + 15) >> 4);
+    int sbShift = use128 ? 5 : 4;
+    int sbSize = sbShift + 2;
+    int maxTileWidthSb = 4096 >> sbSize;
+    int maxTileAreaSb = (4096 * 2304) >> (2 * sbSize);
+    int minLog2TileCols = tile_log2(maxTileWidthSb, sbCols);
+    int maxLog2TileCols = tile_log2(1, MIN(sbCols, AV1_MAX_TILE_COLS));
+    int maxLog2TileRows = tile_log2(1, MIN(sbRows, AV1_MAX_TILE_ROWS));
+    int minLog2Tiles = MAX(minLog2TileCols,
+                           tile_log2(maxTileAreaSb, sbRows * sbCols));
+    int i, startSb;
+
+    int uniform_tile_spacing_flag = READ_BIT(v);
+    if (uniform_tile_spacing_flag) {
+        ti->TileColsLog2 = minLog2TileCols;
+        while (ti->TileColsLog2 < maxLog2TileCols && READ_BIT(v) == 1) {
+            ti->TileColsLog2++;
+        }
+        int tileWidthSb = (sbCols + (1 << ti->TileColsLog2) - 1) >>
+                          ti->TileColsLog2;
+        for (i = 0, startSb = 0; startSb < sbCols; startSb += tileWidthSb) {
+            ti->MiColStarts[i++] = startSb << sbShift;
+        }
+        ti->MiColStarts[i] = fh->MiCols;
+        ti->TileCols = i;
+
+        int minLog2TileRows = MAX(minLog2Tiles - ti->TileColsLog2, 0);
+        ti->TileRowsLog2 = minLog2TileRows;
+        while (ti->TileRowsLog2 < maxLog2TileRows && READ_BIT(v) == 1) {
+            ti->TileRowsLog2++;
+        }
+        int tileHeightSb = (sbRows + (1 << ti->TileRowsLog2) - 1) >>
+                           ti->TileRowsLog2;
+        for (i = 0, startSb = 0; startSb < sbRows; startSb += tileHeightSb) {
+            ti->MiRowStarts[i++] = startSb << sbShift;
+        }
+        ti->MiRowStarts[i] = fh->MiRows;
+        ti->TileRows = i;
+    } else {
+        int widestTileSb = 0;
+        for (i = 0, startSb = 0; startSb < sbCols && i < AV1_MAX_TILE_COLS; i++) {
+            ti->MiColStarts[i] = startSb << sbShift;
+            int maxWidth = MIN(sbCols - startSb, maxTileWidthSb);
+            int sizeSb = read_ns(v, maxWidth) + 1;
+            widestTileSb = MAX(sizeSb, widestTileSb);
+            startSb += sizeSb;
+        }
+        ti->MiColStarts[i] = fh->MiCols;
+        ti->TileCols = i;
+        ti->TileColsLog2 = tile_log2(1, ti->TileCols);
+
+        if (minLog2Tiles > 0) {
+            maxTileAreaSb = (sbRows * sbCols) >> (minLog2Tiles + 1);
+        } else {
+            maxTileAreaSb = sbRows * sbCols;
+        }
+        int maxTileHeightSb = MAX(maxTileAreaSb / widestTileSb, 1);
+        for (i = 0, startSb = 0; startSb < sbRows && i < AV1_MAX_TILE_ROWS; i++) {
+            ti->MiRowStarts[i] = startSb << sbShift;
+            int maxHeight = MIN(sbRows - startSb, maxTileHeightSb);
+            startSb += read_ns(v, maxHeight) + 1;
+        }
+        ti->MiRowStarts[i] = fh->MiRows;
+        ti->TileRows = i;
+        ti->TileRowsLog2 = tile_log2(1, ti->TileRows);
+    }
+    if (ti->TileColsLog2 > 0 || ti->TileRowsLog2 > 0) {
+        ti->context_update_tile_id = READ_BITS(v, ti->TileRowsLog2 + ti->TileColsLog2);
+        ti->TileSizeBytes = READ_BITS(v, 2) + 1;
+    } else {
+        ti->context_update_tile_id = 0;
+        ti->TileSizeBytes = 4;
+    }
+}
+
+static int
+read_delta_q(struct bits_vec *v)
+{
+    if (READ_BIT(v)) {
+        return read_su(v, 7);
+    }
+    return 0;
+}
+
+/* see 5.9.12 */
+static void
+parse_quantization_params(struct av1_decoder *dec, struct bits_vec *v)
+{
+    struct av1_quant_params *qp = &dec->fh.qp;
+    const struct sequence_header_obu *seq = dec->seq;
+    qp->base_q_idx = READ_BITS(v, 8);
+    qp->DeltaQYDc = read_delta_q(v);
+    if (seq->NumPlanes > 1) {
+        int diff_uv_delta = 0;
+        if (seq->cc.separate_uv_delta_q) {
+            diff_uv_delta = READ_BIT(v);
+        }
+        qp->DeltaQUDc = read_delta_q(v);
+        qp->DeltaQUAc = read_delta_q(v);
+        if (diff_uv_delta) {
+            qp->DeltaQVDc = read_delta_q(v);
+            qp->DeltaQVAc = read_delta_q(v);
+        } else {
+            qp->DeltaQVDc = qp->DeltaQUDc;
+            qp->DeltaQVAc = qp->DeltaQUAc;
+        }
+    } else {
+        qp->DeltaQUDc = qp->DeltaQUAc = 0;
+        qp->DeltaQVDc = qp->DeltaQVAc = 0;
+    }
+    qp->using_qmatrix = READ_BIT(v);
+    if (qp->using_qmatrix) {
+        qp->qm_y = READ_BITS(v, 4);
+        qp->qm_u = READ_BITS(v, 4);
+        if (!seq->cc.separate_uv_delta_q) {
+            qp->qm_v = qp->qm_u;
+        } else {
+            qp->qm_v = READ_BITS(v, 4);
+        }
+    }
+}
+
+/* see 5.9.14, the frames decoded here never predict it from a reference */
+static void
+parse_segmentation_params(struct av1_decoder *dec, struct bits_vec *v)
+{
+    struct av1_segmentation_params *sp = &dec->fh.sp;
+    memset(sp, 0, sizeof(*sp));
+    sp->segmentation_enabled = READ_BIT(v);
+    if (sp->segmentation_enabled) {
+        sp->segmentation_update_map = 1;
+        sp->segmentation_temporal_update = 0;
+        for (int i = 0; i < AV1_MAX_SEGMENTS; i++) {
+            for (int j = 0; j < AV1_SEG_LVL_MAX; j++) {
+                int clipped = 0;
+                sp->FeatureEnabled[i][j] = READ_BIT(v);
+                if (sp->FeatureEnabled[i][j]) {
+                    int bits = Segmentation_Feature_Bits[j];
+                    int limit = Segmentation_Feature_Max[j];
+                    if (Segmentation_Feature_Signed[j]) {
+                        clipped = clip3(-limit, limit, read_su(v, 1 + bits));
+                    } else {
+                        clipped = clip3(0, limit, READ_BITS(v, bits));
+                    }
+                }
+                sp->FeatureData[i][j] = clipped;
+            }
+        }
+    }
+    for (int i = 0; i < AV1_MAX_SEGMENTS; i++) {
+        for (int j = 0; j < AV1_SEG_LVL_MAX; j++) {
+            if (sp->FeatureEnabled[i][j]) {
+                sp->LastActiveSegId = i;
+                if (j >= 5) {
+                    sp->SegIdPreSkip = 1;
+                }
+            }
+        }
+    }
+}
+
+static inline int
+seg_feature_active(const struct av1_frame_header *fh, int segment_id, int feature)
+{
+    return fh->sp.segmentation_enabled && fh->sp.FeatureEnabled[segment_id][feature];
+}
+
+/* see 7.12.2 */
+static int
+get_qindex(const struct av1_frame_header *fh, int ignore_delta_q,
+           int segment_id, int CurrentQIndex)
+{
+    if (seg_feature_active(fh, segment_id, AV1_SEG_LVL_ALT_Q)) {
+        int data = fh->sp.FeatureData[segment_id][AV1_SEG_LVL_ALT_Q];
+        int qindex = fh->qp.base_q_idx + data;
+        if (!ignore_delta_q && fh->delta_q_present) {
+            qindex = CurrentQIndex + data;
+        }
+        return clip3(0, 255, qindex);
+    } else if (!ignore_delta_q && fh->delta_q_present) {
+        return CurrentQIndex;
+    }
+    return fh->qp.base_q_idx;
+}
+
+/* see 5.9.11 */
+static void
+parse_loop_filter_params(struct av1_decoder *dec, struct bits_vec *v)
+{
+    static const int8_t ref_deltas[8] = { 1, 0, 0, 0, -1, 0, -1, -1 };
+    struct av1_loop_filter_params *lf = &dec->fh.lf;
+    memset(lf, 0, sizeof(*lf));
+    for (int i = 0; i < 8; i++) {
+        lf->loop_filter_ref_deltas[i] = ref_deltas[i];
+    }
+    if (dec->fh.CodedLossless || dec->fh.allow_intrabc) {
+        return;
+    }
+    lf->loop_filter_level[0] = READ_BITS(v, 6);
+    lf->loop_filter_level[1] = READ_BITS(v, 6);
+    if (dec->seq->NumPlanes > 1) {
+        if (lf->loop_filter_level[0] || lf->loop_filter_level[1]) {
+            lf->loop_filter_level[2] = READ_BITS(v, 6);
+            lf->loop_filter_level[3] = READ_BITS(v, 6);
+        }
+    }
+    lf->loop_filter_sharpness = READ_BITS(v, 3);
+    lf->loop_filter_delta_enabled = READ_BIT(v);
+    if (lf->loop_filter_delta_enabled) {
+        if (READ_BIT(v)) {
+            for (int i = 0; i < 8; i++) {
+                if (READ_BIT(v)) {
+                    lf->loop_filter_ref_deltas[i] = read_su(v, 7);
+                }
+            }
+            for (int i = 0; i < 2; i++) {
+                if (READ_BIT(v)) {
+                    lf->loop_filter_mode_deltas[i] = read_su(v, 7);
+                }
+            }
+        }
+    }
+}
+
+/* see 5.9.19 */
+static void
+parse_cdef_params(struct av1_decoder *dec, struct bits_vec *v)
+{
+    struct av1_cdef_params *cdef = &dec->fh.cdef;
+    memset(cdef, 0, sizeof(*cdef));
+    if (dec->fh.CodedLossless || dec->fh.allow_intrabc ||
+        !dec->seq->enable_cdef) {
+        cdef->cdef_damping = 3;
+        return;
+    }
+    cdef->cdef_damping = READ_BITS(v, 2) + 3;
+    cdef->cdef_bits = READ_BITS(v, 2);
+    for (int i = 0; i < (1 << cdef->cdef_bits); i++) {
+        cdef->cdef_y_pri_strength[i] = READ_BITS(v, 4);
+        cdef->cdef_y_sec_strength[i] = READ_BITS(v, 2);
+        if (cdef->cdef_y_sec_strength[i] == 3) {
+            cdef->cdef_y_sec_strength[i]++;
+        }
+        if (dec->seq->NumPlanes > 1) {
+            cdef->cdef_uv_pri_strength[i] = READ_BITS(v, 4);
+            cdef->cdef_uv_sec_strength[i] = READ_BITS(v, 2);
+            if (cdef->cdef_uv_sec_strength[i] == 3) {
+                cdef->cdef_uv_sec_strength[i]++;
+            }
+        }
+    }
+}
+
+/* see 5.9.20 */
+static void
+parse_lr_params(struct av1_decoder *dec, struct bits_vec *v)
+{
+    struct av1_lr_params *lr = &dec->fh.lr;
+    const struct sequence_header_obu *seq = dec->seq;
+    memset(lr, 0, sizeof(*lr));
+    if (dec->fh.AllLossless || dec->fh.allow_intrabc ||
+        !seq->enable_restoration) {
+        return;
+    }
+    int usesChromaLr = 0;
+    for (int i = 0; i < seq->NumPlanes; i++) {
+        lr->FrameRestorationType[i] = Remap_Lr_Type[READ_BITS(v, 2)];
+        if (lr->FrameRestorationType[i] != AV1_RESTORE_NONE) {
+            lr->UsesLr = 1;
+            if (i > 0) {
+                usesChromaLr = 1;
+            }
+        }
+    }
+    if (lr->UsesLr) {
+        int lr_unit_shift = READ_BIT(v);
+        if (seq->use_128x128_superblock) {
+            lr_unit_shift++;
+        } else if (lr_unit_shift) {
+            lr_unit_shift += READ_BIT(v);
+        }
+        lr->LoopRestorationSize[0] = 256 >> (2 - lr_unit_shift);
+        int lr_uv_shift = 0;
+        if (seq->cc.subsampling_x && seq->cc.subsampling_y && usesChromaLr) {
+            lr_uv_shift = READ_BIT(v);
+        }
+        lr->LoopRestorationSize[1] = lr->LoopRestorationSize[0] >> lr_uv_shift;
+        lr->LoopRestorationSize[2] = lr->LoopRestorationSize[0] >> lr_uv_shift;
+    }
+}
+
+/* see 5.9.24, only parsed to get past it, the grain is not applied */
+static void
+parse_film_grain_params(struct av1_decoder *dec, struct bits_vec *v)
+{
+    struct av1_frame_header *fh = &dec->fh;
+    const struct sequence_header_obu *seq = dec->seq;
+    fh->apply_grain = 0;
+    if (!seq->film_grain_params_present ||
+        (!fh->show_frame && !fh->showable_frame)) {
+        return;
+    }
+    fh->apply_grain = READ_BIT(v);
+    if (!fh->apply_grain) {
+        return;
+    }
+    SKIP_BITS(v, 16);   // grain_seed
+    int update_grain = 1;
+    if (fh->frame_type == AV1_INTER_FRAME) {
+        update_grain = READ_BIT(v);
+    }
+    if (!update_grain) {
+        SKIP_BITS(v, 3);    // film_grain_params_ref_idx
+        return;
+    }
+    int num_y_points = READ_BITS(v, 4);
+    SKIP_BITS(v, 16 * num_y_points);
+    int chroma_scaling_from_luma = 0;
+    if (!seq->cc.mono_chrome) {
+        chroma_scaling_from_luma = READ_BIT(v);
+    }
+    int num_cb_points = 0, num_cr_points = 0;
+    if (!seq->cc.mono_chrome && !chroma_scaling_from_luma &&
+        !(seq->cc.subsampling_x && seq->cc.subsampling_y && num_y_points == 0)) {
+        num_cb_points = READ_BITS(v, 4);
+        SKIP_BITS(v, 16 * num_cb_points);
+        num_cr_points = READ_BITS(v, 4);
+        SKIP_BITS(v, 16 * num_cr_points);
+    }
+    SKIP_BITS(v, 2);    // grain_scaling_minus_8
+    int ar_coeff_lag = READ_BITS(v, 2);
+    int numPosLuma = 2 * ar_coeff_lag * (ar_coeff_lag + 1);
+    int numPosChroma = numPosLuma;
+    if (num_y_points) {
+        numPosChroma = numPosLuma + 1;
+        SKIP_BITS(v, 8 * numPosLuma);
+    }
+    if (chroma_scaling_from_luma || num_cb_points) {
+        SKIP_BITS(v, 8 * numPosChroma);
+    }
+    if (chroma_scaling_from_luma || num_cr_points) {
+        SKIP_BITS(v, 8 * numPosChroma);
+    }
+    SKIP_BITS(v, 4);    // ar_coeff_shift_minus_6, grain_scale_shift
+    if (num_cb_points) {
+        SKIP_BITS(v, 25);
+    }
+    if (num_cr_points) {
+        SKIP_BITS(v, 25);
+    }
+    SKIP_BITS(v, 2);    // overlap_flag, clip_to_restricted_range
+}
+
+/* see 5.9.2, for the key and intra only frames of a still image. Returns -1
+ * for what is not supported.
+ */
+static int
+parse_uncompressed_header(struct av1_decoder *dec, struct bits_vec *v,
+                          const struct obu_header *h)
+{
+    struct av1_frame_header *fh = &dec->fh;
+    const struct sequence_header_obu *seq = dec->seq;
+    int idLen = 0;
+    memset(fh, 0, sizeof(*fh));
+    if (seq->frame_id_numbers_present_flag) {
+        idLen = seq->additional_frame_id_length_minus_1 +
+                seq->delta_frame_id_length_minus_2 + 3;
+    }
+    if (seq->reduced_still_picture_header) {
+        fh->frame_type = AV1_KEY_FRAME;
+        fh->show_frame = 1;
+        fh->showable_frame = 0;
+    } else {
+        fh->show_existing_frame = READ_BIT(v);
+        if (fh->show_existing_frame) {
+            VERR(av1, "show_existing_frame is not supported");
+            return -1;
+        }
+        fh->frame_type = READ_BITS(v, 2);
+        fh->show_frame = READ_BIT(v);
+        if (fh->show_frame && seq->decoder_model_info_present_flag &&
+            !seq->equal_picture_interval) {
+            SKIP_BITS(v, seq->minfo.frame_presentation_time_length_minus_1 + 1);
+        }
+        if (fh->show_frame) {
+            fh->showable_frame = fh->frame_type != AV1_KEY_FRAME;
+        } else {
+            fh->showable_frame = READ_BIT(v);
+        }
+        if (fh->frame_type == AV1_SWITCH_FRAME ||
+            (fh->frame_type == AV1_KEY_FRAME && fh->show_frame)) {
+            fh->error_resilient_mode = 1;
+        } else {
+            fh->error_resilient_mode = READ_BIT(v);
+        }
+    }
+    if (fh->frame_type != AV1_KEY_FRAME &&
+        fh->frame_type != AV1_INTRA_ONLY_FRAME) {
+        VERR(av1, "inter frames are not supported");
+        return -1;
+    }
+    fh->disable_cdf_update = READ_BIT(v);
+    if (seq->seq_force_screen_content_tools == SELECT_SCREEN_CONTENT_TOOLS) {
+        fh->allow_screen_content_tools = READ_BIT(v);
+    } else {
+        fh->allow_screen_content_tools = seq->seq_force_screen_content_tools;
+    }
+    if (fh->allow_screen_content_tools &&
+        seq->seq_force_integer_mv == SELECT_INTEGER_MV) {
+        READ_BIT(v);
+    }
+    fh->force_integer_mv = 1;
+    if (seq->frame_id_numbers_present_flag) {
+        SKIP_BITS(v, idLen);   // current_frame_id
+    }
+    if (seq->reduced_still_picture_header) {
+        fh->frame_size_override_flag = 0;
+    } else {
+        fh->frame_size_override_flag = READ_BIT(v);
+    }
+    fh->order_hint = READ_BITS(v, seq->OrderHintBits);
+    fh->primary_ref_frame = PRIMARY_REF_NONE;
+    if (seq->decoder_model_info_present_flag) {
+        int buffer_removal_time_present_flag = READ_BIT(v);
+        if (buffer_removal_time_present_flag) {
+            for (int op = 0; op <= seq->operating_points_cnt_minus_1; op++) {
+                if (seq->points[op].decoder_model_present_for_this_op) {
+                    int idc = seq->points[op].operating_point_idc;
+                    int inTemporalLayer = (idc >> h->ext.temporal_id) & 1;
+                    int inSpatialLayer = (idc >> (h->ext.spatial_id + 8)) & 1;
+                    if (idc == 0 || (inTemporalLayer && inSpatialLayer)) {
+                        SKIP_BITS(v, seq->minfo.buffer_removal_time_length_minus_1 + 1);
+                    }
+                }
+            }
+        }
+    }
+    if (fh->frame_type == AV1_KEY_FRAME && fh->show_frame) {
+        fh->refresh_frame_flags = 0xFF;
+    } else {
+        fh->refresh_frame_flags = READ_BITS(v, 8);
+    }
+    if (fh->refresh_frame_flags != 0xFF && fh->error_resilient_mode &&
+        seq->enable_order_hint) {
+        SKIP_BITS(v, 8 * seq->OrderHintBits);   // ref_order_hint
+    }
+
+    // see 5.9.5 to 5.9.8, frame_size() and render_size()
+    if (fh->frame_size_override_flag) {
+        fh->FrameWidth = READ_BITS(v, seq->frame_width_bits_minus_1 + 1) + 1;
+        fh->FrameHeight = READ_BITS(v, seq->frame_height_bits_minus_1 + 1) + 1;
+    } else {
+        fh->FrameWidth = seq->max_frame_width_minus_1 + 1;
+        fh->FrameHeight = seq->max_frame_height_minus_1 + 1;
+    }
+    if (seq->enable_superres) {
+        fh->use_superres = READ_BIT(v);
+    }
+    if (fh->use_superres) {
+        VERR(av1, "superres is not supported");
+        return -1;
+    }
+    fh->UpscaledWidth = fh->FrameWidth;
+    fh->MiCols = 2 * ((fh->FrameWidth + 7) >> 3);
+    fh->MiRows = 2 * ((fh->FrameHeight + 7) >> 3);
+    if (READ_BIT(v)) {
+        fh->RenderWidth = READ_BITS(v, 16) + 1;
+        fh->RenderHeight = READ_BITS(v, 16) + 1;
+    } else {
+        fh->RenderWidth = fh->UpscaledWidth;
+        fh->RenderHeight = fh->FrameHeight;
+    }
+    if (fh->allow_screen_content_tools && fh->UpscaledWidth == fh->FrameWidth) {
+        fh->allow_intrabc = READ_BIT(v);
+    }
+    if (fh->allow_intrabc) {
+        VERR(av1, "intra block copy is not supported");
+        return -1;
+    }
+    if (seq->reduced_still_picture_header || fh->disable_cdf_update) {
+        fh->disable_frame_end_update_cdf = 1;
+    } else {
+        fh->disable_frame_end_update_cdf = READ_BIT(v);
+    }
+
+    parse_tile_info(dec, v);
+    parse_quantization_params(dec, v);
+    parse_segmentation_params(dec, v);
+    // see 5.9.17 and 5.9.18
+    if (fh->qp.base_q_idx > 0) {
+        fh->delta_q_present = READ_BIT(v);
+    }
+    if (fh->delta_q_present) {
+        fh->delta_q_res = READ_BITS(v, 2);
+        fh->delta_lf_present = READ_BIT(v);
+        if (fh->delta_lf_present) {
+            fh->delta_lf_res = READ_BITS(v, 2);
+            fh->delta_lf_multi = READ_BIT(v);
+        }
+    }
+    fh->CodedLossless = 1;
+    for (int s = 0; s < AV1_MAX_SEGMENTS; s++) {
+        int qindex = get_qindex(fh, 1, s, fh->qp.base_q_idx);
+        fh->LosslessArray[s] = qindex == 0 && fh->qp.DeltaQYDc == 0 &&
+                               fh->qp.DeltaQUAc == 0 && fh->qp.DeltaQUDc == 0 &&
+                               fh->qp.DeltaQVAc == 0 && fh->qp.DeltaQVDc == 0;
+        if (!fh->LosslessArray[s]) {
+            fh->CodedLossless = 0;
+        }
+    }
+    fh->AllLossless = fh->CodedLossless && fh->FrameWidth == fh->UpscaledWidth;
+    parse_loop_filter_params(dec, v);
+    parse_cdef_params(dec, v);
+    parse_lr_params(dec, v);
+    // see 5.9.21, read_tx_mode()
+    if (fh->CodedLossless) {
+        fh->TxMode = AV1_ONLY_4X4;
+    } else {
+        fh->TxMode = READ_BIT(v) ? AV1_TX_MODE_SELECT : AV1_TX_MODE_LARGEST;
+    }
+    fh->reduced_tx_set = READ_BIT(v);
+    parse_film_grain_params(dec, v);
+    if (fh->apply_grain) {
+        VDBG(av1, "film grain is not applied");
+    }
+    return v->eof ? -1 : 0;
+}
+
+//------------------------------------------------------------------------------
+// block syntax, see 5.11
+
+static inline int
+is_inside(const struct av1_tile_ctx *t, int r, int c)
+{
+    return c >= t->MiColStart && c < t->MiColEnd && r >= t->MiRowStart &&
+           r < t->MiRowEnd;
+}
+
+static inline struct av1_mi *
+mi_at(const struct av1_frame_ctx *f, int r, int c)
+{
+    return &f->mi[r * f->mi_stride + c];
+}
+
+/* see 5.11.38, get_plane_residual_size() as Subsampled_Size */
+static inline int
+plane_res_size(int bsize, int subx, int suby)
+{
+    int wl = Mi_Width_Log2[bsize] - subx, hl = Mi_Height_Log2[bsize] - suby;
+    return Block_Size_Dims[wl < 0 ? 0 : wl][hl < 0 ? 0 : hl];
+}
+
+/* Max_Tx_Size_Rect */
+static inline int
+max_tx_size_rect(int bsize)
+{
+    return Tx_Size_Dims[MIN(Mi_Width_Log2[bsize], 4)][MIN(Mi_Height_Log2[bsize], 4)];
+}
+
+/* see 5.11.37, the transform size of a chroma plane */
+static int
+get_tx_size(const struct av1_decoder *dec, const struct av1_block *b,
+            int plane, int txSz)
+{
+    if (plane == 0) {
+        return txSz;
+    }
+    int uvTx = max_tx_size_rect(plane_res_size(b->MiSize,
+                                               dec->seq->cc.subsampling_x,
+                                               dec->seq->cc.subsampling_y));
+    if (Tx_Width_Log2[uvTx] == 6 || Tx_Height_Log2[uvTx] == 6) {
+        if (Tx_Width_Log2[uvTx] == 4) {
+            return TX_16X32;
+        }
+        if (Tx_Height_Log2[uvTx] == 4) {
+            return TX_32X16;
+        }
+        return TX_32X32;
+    }
+    return uvTx;
+}
+
+static int
+neg_deinterleave(int diff, int ref, int max)
+{
+    if (!ref) {
+        return diff;
+    }
+    if (ref >= max - 1) {
+        return max - diff - 1;
+    }
+    if (2 * ref < max) {
+        if (diff <= 2 * ref) {
+            if (diff & 1) {
+                return ref + ((diff + 1) >> 1);
+            }
+            return ref - (diff >> 1);
+        }
+        return diff;
+    }
+    if (diff <= 2 * (max - ref - 1)) {
+        if (diff & 1) {
+            return ref + ((diff + 1) >> 1);
+        }
+        return ref - (diff >> 1);
+    }
+    return max - (diff + 1);
+}
+
+/* see 5.11.9 */
+static void
+read_segment_id(struct av1_tile_ctx *t)
+{
+    const struct av1_frame_ctx *f = t->dec->ctx;
+    struct av1_block *b = &t->b;
+    int prevUL = -1, prevU = -1, prevL = -1, pred, ctx;
+    if (b->AvailU && b->AvailL) {
+        prevUL = mi_at(f, b->MiRow - 1, b->MiCol - 1)->segment_id;
+    }
+    if (b->AvailU) {
+        prevU = mi_at(f, b->MiRow - 1, b->MiCol)->segment_id;
+    }
+    if (b->AvailL) {
+        prevL = mi_at(f, b->MiRow, b->MiCol - 1)->segment_id;
+    }
+    if (prevU == -1) {
+        pred = prevL == -1 ? 0 : prevL;
+    } else if (prevL == -1) {
+        pred = prevU;
+    } else {
+        pred = prevUL == prevU ? prevU : prevL;
+    }
+    if (b->skip) {
+        b->segment_id = pred;
+        return;
+    }
+    if (prevUL < 0) {
+        ctx = 0;
+    } else if (prevUL == prevU && prevUL == prevL) {
+        ctx = 2;
+    } else if (prevUL == prevU || prevUL == prevL || prevU == prevL) {
+        ctx = 1;
+    } else {
+        ctx = 0;
+    }
+    int last = t->dec->fh.sp.LastActiveSegId;
+    int v = SYM(&t->sd, t->cdf.segment_id[ctx], AV1_MAX_SEGMENTS);
+    b->segment_id = clip3(0, last, neg_deinterleave(v, pred, last + 1));
+}
+
+static void
+intra_segment_id(struct av1_tile_ctx *t)
+{
+    const struct av1_frame_header *fh = &t->dec->fh;
+    if (fh->sp.segmentation_enabled) {
+        read_segment_id(t);
+    } else {
+        t->b.segment_id = 0;
+    }
+    t->b.Lossless = fh->LosslessArray[t->b.segment_id];
+}
+
+/* see 5.11.11 */
+static void
+read_skip(struct av1_tile_ctx *t)
+{
+    const struct av1_frame_ctx *f = t->dec->ctx;
+    struct av1_block *b = &t->b;
+    if (t->dec->fh.sp.SegIdPreSkip &&
+        seg_feature_active(&t->dec->fh, b->segment_id, AV1_SEG_LVL_SKIP)) {
+        b->skip = 1;
+        return;
+    }
+    int ctx = 0;
+    if (b->AvailU) {
+        ctx += mi_at(f, b->MiRow - 1, b->MiCol)->skip;
+    }
+    if (b->AvailL) {
+        ctx += mi_at(f, b->MiRow, b->MiCol - 1)->skip;
+    }
+    b->skip = SYM(&t->sd, t->cdf.skip[ctx], 2);
+}
+
+/* see 5.11.56 */
+static void
+read_cdef(struct av1_tile_ctx *t)
+{
+    struct av1_decoder *dec = t->dec;
+    struct av1_frame_ctx *f = dec->ctx;
+    struct av1_block *b = &t->b;
+    if (b->skip || dec->fh.CodedLossless || !dec->seq->enable_cdef) {
+        return;
+    }
+    int r = b->MiRow >> 4, c = b->MiCol >> 4;
+    int8_t *idx = &f->cdef_idx[r * f->cdef_stride + c];
+    if (*idx == -1) {
+        *idx = SYM_L(&t->sd, dec->fh.cdef.cdef_bits);
+        int w64 = MAX(b->bw4 >> 4, 1), h64 = MAX(b->bh4 >> 4, 1);
+        for (int y = 0; y < h64; y++) {
+            for (int x = 0; x < w64; x++) {
+                idx[y * f->cdef_stride + x] = *idx;
+            }
+        }
+    }
+}
+
+/* see 5.11.12 and 5.11.13 */
+static void
+read_delta_qindex_lf(struct av1_tile_ctx *t)
+{
+    struct av1_decoder *dec = t->dec;
+    const struct av1_frame_header *fh = &dec->fh;
+    struct av1_block *b = &t->b;
+    struct symdec *sd = &t->sd;
+    int sbSize = dec->seq->use_128x128_superblock ? BLOCK_128X128 : BLOCK_64X64;
+    if ((b->MiSize == sbSize && b->skip) || !t->ReadDeltas) {
+        return;
+    }
+    int delta_q_abs = SYM(sd, t->cdf.delta_q, 4);
+    if (delta_q_abs == 3) {
+        int rem_bits = SYM_L(sd, 3) + 1;
+        delta_q_abs = SYM_L(sd, rem_bits) + (1 << rem_bits) + 1;
+    }
+    if (delta_q_abs) {
+        int reduced = SYM_L(sd, 1) ? -delta_q_abs : delta_q_abs;
+        t->CurrentQIndex = clip3(1, 255, t->CurrentQIndex +
+                                         (reduced << fh->delta_q_res));
+    }
+    if (!fh->delta_lf_present) {
+        return;
+    }
+    int frameLfCount = 1;
+    if (fh->delta_lf_multi) {
+        frameLfCount = dec->seq->NumPlanes > 1 ? 4 : 2;
+    }
+    for (int i = 0; i < frameLfCount; i++) {
+        uint16_t *cdf = fh->delta_lf_multi ? t->cdf.delta_lf_multi[i] :
+                        t->cdf.delta_lf;
+        int abs = SYM(sd, cdf, 4);
+        if (abs == 3) {
+            int n = SYM_L(sd, 3) + 1;
+            abs = SYM_L(sd, n) + (1 << n) + 1;
+        }
+        if (abs) {
+            int reduced = SYM_L(sd, 1) ? -abs : abs;
+            t->DeltaLF[i] = clip3(-MAX_LOOP_FILTER, MAX_LOOP_FILTER,
+                                  t->DeltaLF[i] + (reduced << fh->delta_lf_res));
+        }
+    }
+}
+
+static inline int
+is_directional_mode(int mode)
+{
+    return mode >= V_PRED && mode <= D67_PRED;
+}
+
+/* see 5.11.26 */
+static void
+read_cfl_alphas(struct av1_tile_ctx *t)
+{
+    struct av1_block *b = &t->b;
+    int signs = SYM(&t->sd, t->cdf.cfl_sign, 8);
+    int signU = (signs + 1) / 3, signV = (signs + 1) % 3;
+    b->CflAlphaU = b->CflAlphaV = 0;
+    if (signU) {
+        int ctx = (signU - 1) * 3 + signV;
+        b->CflAlphaU = 1 + SYM(&t->sd, t->cdf.cfl_alpha[ctx], 16);
+        if (signU == 1) {
+            b->CflAlphaU = -b->CflAlphaU;
+        }
+    }
+    if (signV) {
+        int ctx = (signV - 1) * 3 + signU;
+        b->CflAlphaV = 1 + SYM(&t->sd, t->cdf.cfl_alpha[ctx], 16);
+        if (signV == 1) {
+            b->CflAlphaV = -b->CflAlphaV;
+        }
+    }
+}
+
+/* see 7.11.4.2 get_palette_cache(), neighbours come from the tile above
+ * and left arrays, only from the same 64 luma rows for the above one
+ */
+static int
+get_palette_cache(struct av1_tile_ctx *t, int plane, uint16_t *cache)
+{
+    const struct av1_block *b = &t->b;
+    int aboveN = 0, leftN = 0;
+    const uint16_t *above = t->above_pal[plane] + b->MiCol * PALETTE_COLORS;
+    const uint16_t *left = t->left_pal[plane] + b->MiRow * PALETTE_COLORS;
+    if (((b->MiRow * MI_SIZE) % 64) && b->AvailU) {
+        aboveN = t->above_pal_size[plane][b->MiCol];
+    }
+    if (b->AvailL) {
+        leftN = t->left_pal_size[plane][b->MiRow];
+    }
+    int aboveIdx = 0, leftIdx = 0, n = 0;
+    while (aboveIdx < aboveN && leftIdx < leftN) {
+        int aboveC = above[aboveIdx], leftC = left[leftIdx];
+        if (leftC < aboveC) {
+            if (n == 0 || leftC != cache[n - 1]) {
+                cache[n++] = leftC;
+            }
+            leftIdx++;
+        } else {
+            if (n == 0 || aboveC != cache[n - 1]) {
+                cache[n++] = aboveC;
+            }
+            aboveIdx++;
+            if (leftC == aboveC) {
+                leftIdx++;
+            }
+        }
+    }
+    for (; aboveIdx < aboveN; aboveIdx++) {
+        if (n == 0 || above[aboveIdx] != cache[n - 1]) {
+            cache[n++] = above[aboveIdx];
+        }
+    }
+    for (; leftIdx < leftN; leftIdx++) {
+        if (n == 0 || left[leftIdx] != cache[n - 1]) {
+            cache[n++] = left[leftIdx];
+        }
+    }
+    return n;
+}
+
+static void
+sort_colors(uint16_t *c, int n)
+{
+    for (int i = 1; i < n; i++) {
+        uint16_t v = c[i];
+        int j = i - 1;
+        for (; j >= 0 && c[j] > v; j--) {
+            c[j + 1] = c[j];
+        }
+        c[j + 1] = v;
+    }
+}
+
+/* the palette colors of Y or U, which only differ by Y taking one more
+ * for the deltas
+ */
+static void
+read_palette_colors(struct av1_tile_ctx *t, int plane, uint16_t *colors, int n)
+{
+    struct symdec *sd = &t->sd;
+    int bitdepth = t->dec->seq->BitDepth;
+    uint16_t cache[2 * PALETTE_COLORS];
+    int cacheN = get_palette_cache(t, plane, cache);
+    int idx = 0, paletteBits = 0;
+    for (int i = 0; i < cacheN && idx < n; i++) {
+        if (SYM_L(sd, 1)) {
+            colors[idx++] = cache[i];
+        }
+    }
+    if (idx < n) {
+        colors[idx++] = SYM_L(sd, bitdepth);
+    }
+    if (idx < n) {
+        paletteBits = bitdepth - 3 + SYM_L(sd, 2);
+    }
+    for (; idx < n; idx++) {
+        int delta = SYM_L(sd, paletteBits) + (plane == 0);
+        colors[idx] = MIN(colors[idx - 1] + delta, (1 << bitdepth) - 1);
+        int range = (1 << bitdepth) - colors[idx] - (plane == 0);
+        paletteBits = MIN(paletteBits, ceil_log2(range));
+    }
+    sort_colors(colors, n);
+}
+
+/* see 5.11.46 */
+static void
+palette_mode_info(struct av1_tile_ctx *t)
+{
+    struct av1_block *b = &t->b;
+    struct symdec *sd = &t->sd;
+    int bitdepth = t->dec->seq->BitDepth;
+    int bsizeCtx = Mi_Width_Log2[b->MiSize] + Mi_Height_Log2[b->MiSize] - 2;
+    if (b->YMode == DC_PRED) {
+        int ctx = 0;
+        if (b->AvailU && t->above_pal_size[0][b->MiCol] > 0) {
+            ctx++;
+        }
+        if (b->AvailL && t->left_pal_size[0][b->MiRow] > 0) {
+            ctx++;
+        }
+        if (SYM(sd, t->cdf.palette_y_mode[bsizeCtx][ctx], 2)) {
+            b->PaletteSizeY = SYM(sd, t->cdf.palette_y_size[bsizeCtx], 7) + 2;
+            read_palette_colors(t, 0, b->palette_colors[0], b->PaletteSizeY);
+        }
+    }
+    if (b->HasChroma && b->UVMode == DC_PRED) {
+        int ctx = b->PaletteSizeY > 0;
+        if (SYM(sd, t->cdf.palette_uv_mode[ctx], 2)) {
+            int n = SYM(sd, t->cdf.palette_uv_size[bsizeCtx], 7) + 2;
+            uint16_t *v = b->palette_colors[2];
+            b->PaletteSizeUV = n;
+            read_palette_colors(t, 1, b->palette_colors[1], n);
+            if (SYM_L(sd, 1)) {
+                int maxVal = 1 << bitdepth;
+                int paletteBits = bitdepth - 4 + SYM_L(sd, 2);
+                v[0] = SYM_L(sd, bitdepth);
+                for (int idx = 1; idx < n; idx++) {
+                    int delta = SYM_L(sd, paletteBits);
+                    if (delta && SYM_L(sd, 1)) {
+                        delta = -delta;
+                    }
+                    int val = v[idx - 1] + delta;
+                    if (val < 0) {
+                        val += maxVal;
+                    }
+                    if (val >= maxVal) {
+                        val -= maxVal;
+                    }
+                    v[idx] = clip3(0, maxVal - 1, val);
+                }
+            } else {
+                for (int idx = 0; idx < n; idx++) {
+                    v[idx] = SYM_L(sd, bitdepth);
+                }
+            }
+        }
+    }
+}
+
+/* see 5.11.24 */
+static void
+intra_frame_mode_info(struct av1_tile_ctx *t)
+{
+    struct av1_decoder *dec = t->dec;
+    const struct av1_frame_header *fh = &dec->fh;
+    const struct av1_frame_ctx *f = dec->ctx;
+    struct av1_block *b = &t->b;
+    struct symdec *sd = &t->sd;
+
+    b->skip = 0;
+    if (fh->sp.SegIdPreSkip) {
+        intra_segment_id(t);
+    }
+    read_skip(t);
+    if (!fh->sp.SegIdPreSkip) {
+        intra_segment_id(t);
+    }
+    read_cdef(t);
+    read_delta_qindex_lf(t);
+    t->ReadDeltas = 0;
+
+    int aboveMode = b->AvailU ? mi_at(f, b->MiRow - 1, b->MiCol)->y_mode : DC_PRED;
+    int leftMode = b->AvailL ? mi_at(f, b->MiRow, b->MiCol - 1)->y_mode : DC_PRED;
+    b->YMode = SYM(sd, t->cdf.y_mode[Intra_Mode_Context[aboveMode]]
+                                    [Intra_Mode_Context[leftMode]], 13);
+    b->AngleDeltaY = 0;
+    if (b->MiSize >= BLOCK_8X8 && is_directional_mode(b->YMode)) {
+        b->AngleDeltaY = SYM(sd, t->cdf.angle_delta[b->YMode - V_PRED], 7) - 3;
+    }
+    b->UVMode = DC_PRED;
+    b->AngleDeltaUV = 0;
+    if (b->HasChroma) {
+        int bw = 4 << Mi_Width_Log2[b->MiSize], bh = 4 << Mi_Height_Log2[b->MiSize];
+        int cflAllowed;
+        if (b->Lossless) {
+            cflAllowed = plane_res_size(b->MiSize, dec->seq->cc.subsampling_x,
+                                        dec->seq->cc.subsampling_y) == BLOCK_4X4;
+        } else {
+            cflAllowed = MAX(bw, bh) <= 32;
+        }
+        if (cflAllowed) {
+            b->UVMode = SYM(sd, t->cdf.uv_mode_cfl_allowed[b->YMode], 14);
+        } else {
+            b->UVMode = SYM(sd, t->cdf.uv_mode_cfl_not_allowed[b->YMode], 13);
+        }
+        if (b->UVMode == UV_CFL_PRED) {
+            read_cfl_alphas(t);
+        }
+        if (b->MiSize >= BLOCK_8X8 && is_directional_mode(b->UVMode)) {
+            b->AngleDeltaUV = SYM(sd, t->cdf.angle_delta[b->UVMode - V_PRED], 7) - 3;
+        }
+    }
+    b->PaletteSizeY = b->PaletteSizeUV = 0;
+    if (b->MiSize >= BLOCK_8X8 && b->bw4 <= 16 && b->bh4 <= 16 &&
+        fh->allow_screen_content_tools) {
+        palette_mode_info(t);
+    }
+    b->use_filter_intra = 0;
+    if (dec->seq->enable_filter_intra && b->YMode == DC_PRED &&
+        b->PaletteSizeY == 0 && MAX(b->bw4, b->bh4) <= 8) {
+        b->use_filter_intra = SYM(sd, t->cdf.filter_intra[b->MiSize], 2);
+        if (b->use_filter_intra) {
+            b->filter_intra_mode = SYM(sd, t->cdf.filter_intra_mode, 5);
+        }
+    }
+}
+
+/* see 7.11.4.3 */
+static int
+get_palette_color_context(const uint8_t *map, int r, int c, int n,
+                          uint8_t *order)
+{
+    int scores[PALETTE_COLORS] = { 0 };
+    if (c > 0) {
+        scores[map[r * 64 + c - 1]] += 2;
+    }
+    if (r > 0 && c > 0) {
+        scores[map[(r - 1) * 64 + c - 1]] += 1;
+    }
+    if (r > 0) {
+        scores[map[(r - 1) * 64 + c]] += 2;
+    }
+    for (int i = 0; i < PALETTE_COLORS; i++) {
+        order[i] = i;
+    }
+    for (int i = 0; i < 3; i++) {
+        int maxScore = scores[i], maxIdx = i;
+        for (int j = i + 1; j < n; j++) {
+            if (scores[j] > maxScore) {
+                maxScore = scores[j];
+                maxIdx = j;
+            }
+        }
+        if (maxIdx != i) {
+            int maxColorOrder = order[maxIdx];
+            for (int k = maxIdx; k > i; k--) {
+                scores[k] = scores[k - 1];
+                order[k] = order[k - 1];
+            }
+            scores[i] = maxScore;
+            order[i] = maxColorOrder;
+        }
+    }
+    int hash = 0;
+    for (int i = 0; i < 3; i++) {
+        hash += scores[i] * Palette_Color_Hash_Multipliers[i];
+    }
+    return Palette_Color_Context[hash];
+}
+
+/* the color map of a plane in wavefront order, see 5.11.49 */
+static void
+read_color_map(struct av1_tile_ctx *t, uint8_t *map, int n, uint16_t cdf[][9],
+               int blockWidth, int blockHeight, int onscreenWidth,
+               int onscreenHeight)
+{
+    uint8_t order[PALETTE_COLORS];
+    map[0] = symdec_ns(&t->sd, n);
+    for (int i = 1; i < onscreenHeight + onscreenWidth - 1; i++) {
+        for (int j = MIN(i, onscreenWidth - 1); j >= MAX(0, i - onscreenHeight + 1); j--) {
+            int ctx = get_palette_color_context(map, i - j, j, n, order);
+            map[(i - j) * 64 + j] = order[SYM(&t->sd, cdf[ctx], n)];
+        }
+    }
+    for (int i = 0; i < onscreenHeight; i++) {
+        for (int j = onscreenWidth; j < blockWidth; j++) {
+            map[i * 64 + j] = map[i * 64 + onscreenWidth - 1];
+        }
+    }
+    for (int i = onscreenHeight; i < blockHeight; i++) {
+        memcpy(map + i * 64, map + (onscreenHeight - 1) * 64, blockWidth);
+    }
+}
+
+static void
+palette_tokens(struct av1_tile_ctx *t)
+{
+    const struct av1_frame_header *fh = &t->dec->fh;
+    const struct color_config *cc = &t->dec->seq->cc;
+    struct av1_block *b = &t->b;
+    int blockHeight = b->bh4 * 4, blockWidth = b->bw4 * 4;
+    int onscreenHeight = MIN(blockHeight, (fh->MiRows - b->MiRow) * MI_SIZE);
+    int onscreenWidth = MIN(blockWidth, (fh->MiCols - b->MiCol) * MI_SIZE);
+    if (b->PaletteSizeY) {
+        read_color_map(t, b->ColorMapY, b->PaletteSizeY,
+                       t->cdf.palette_y_color[b->PaletteSizeY - 2], blockWidth,
+                       blockHeight, onscreenWidth, onscreenHeight);
+    }
+    if (b->PaletteSizeUV) {
+        blockHeight >>= cc->subsampling_y;
+        blockWidth >>= cc->subsampling_x;
+        onscreenHeight >>= cc->subsampling_y;
+        onscreenWidth >>= cc->subsampling_x;
+        if (blockWidth < 4) {
+            blockWidth += 2;
+            onscreenWidth += 2;
+        }
+        if (blockHeight < 4) {
+            blockHeight += 2;
+            onscreenHeight += 2;
+        }
+        read_color_map(t, b->ColorMapUV, b->PaletteSizeUV,
+                       t->cdf.palette_uv_color[b->PaletteSizeUV - 2], blockWidth,
+                       blockHeight, onscreenWidth, onscreenHeight);
+    }
+}
+
+/* see 5.11.15 and 5.11.16, intra blocks take one transform size */
+static void
+read_tx_size(struct av1_tile_ctx *t)
+{
+    struct av1_decoder *dec = t->dec;
+    const struct av1_frame_ctx *f = dec->ctx;
+    struct av1_block *b = &t->b;
+    if (b->Lossless) {
+        b->TxSize = TX_4X4;
+        return;
+    }
+    int maxRectTxSize = max_tx_size_rect(b->MiSize);
+    int maxTxDepth = Max_Tx_Depth[b->MiSize];
+    b->TxSize = maxRectTxSize;
+    if (b->MiSize == BLOCK_4X4 || dec->fh.TxMode != AV1_TX_MODE_SELECT) {
+        return;
+    }
+    int aboveW = 0, leftH = 0;
+    if (b->AvailU) {
+        aboveW = 1 << Tx_Width_Log2[mi_at(f, b->MiRow - 1, b->MiCol)->tx_size];
+    }
+    if (b->AvailL) {
+        leftH = 1 << Tx_Height_Log2[mi_at(f, b->MiRow, b->MiCol - 1)->tx_size];
+    }
+    int ctx = (aboveW >= (1 << Tx_Width_Log2[maxRectTxSize])) +
+              (leftH >= (1 << Tx_Height_Log2[maxRectTxSize]));
+    int depth;
+    switch (maxTxDepth) {
+    case 4:
+        depth = SYM(&t->sd, t->cdf.tx_64x64[ctx], 3);
+        break;
+    case 3:
+        depth = SYM(&t->sd, t->cdf.tx_32x32[ctx], 3);
+        break;
+    case 2:
+        depth = SYM(&t->sd, t->cdf.tx_16x16[ctx], 3);
+        break;
+    default:
+        depth = SYM(&t->sd, t->cdf.tx_8x8[ctx], 2);
+        break;
+    }
+    for (int i = 0; i < depth; i++) {
+        b->TxSize = Split_Tx_Size[b->TxSize];
+    }
+}
+
+/* see 5.11.2, read_lr() and read_lr_unit() */
+static int
+decode_subexp_bool(struct symdec *sd, int numSyms, int k)
+{
+    int i = 0, mk = 0;
+    while (1) {
+        int b2 = i ? k + i - 1 : k;
+        int a = 1 << b2;
+        if (numSyms <= mk + 3 * a) {
+            return symdec_ns(sd, numSyms - mk) + mk;
+        }
+        if (!SYM_L(sd, 1)) {
+            return SYM_L(sd, b2) + mk;
+        }
+        i++;
+        mk += a;
+    }
+}
+
+static inline int
+inverse_recenter(int r, int v)
+{
+    if (v > 2 * r) {
+        return v;
+    } else if (v & 1) {
+        return r - ((v + 1) >> 1);
+    }
+    return r + (v >> 1);
+}
+
+static int
+decode_signed_subexp_with_ref_bool(struct symdec *sd, int low, int high, int k,
+                                   int r)
+{
+    int mx = high - low;
+    r -= low;
+    int v = decode_subexp_bool(sd, mx, k);
+    if ((r << 1) <= mx) {
+        return inverse_recenter(r, v) + low;
+    }
+    return mx - 1 - inverse_recenter(mx - 1 - r, v) + low;
+}
+
+static void
+read_lr_unit(struct av1_tile_ctx *t, int plane, struct lr_unit *u)
+{
+    struct symdec *sd = &t->sd;
+    int type = t->dec->fh.lr.FrameRestorationType[plane];
+    if (type == AV1_RESTORE_WIENER) {
+        type = SYM(sd, t->cdf.use_wiener, 2) ? AV1_RESTORE_WIENER : AV1_RESTORE_NONE;
+    } else if (type == AV1_RESTORE_SGRPROJ) {
+        type = SYM(sd, t->cdf.use_sgrproj, 2) ? AV1_RESTORE_SGRPROJ : AV1_RESTORE_NONE;
+    } else {
+        type = SYM(sd, t->cdf.restoration_type, 3);
+    }
+    u->type = type;
+    if (type == AV1_RESTORE_WIENER) {
+        for (int pass = 0; pass < 2; pass++) {
+            int firstCoeff = 0;
+            if (plane) {
+                firstCoeff = 1;
+                u->wiener[pass][0] = 0;
+            }
+            for (int j = firstCoeff; j < 3; j++) {
+                int v = decode_signed_subexp_with_ref_bool(sd,
+                            Wiener_Taps_Min[j], Wiener_Taps_Max[j] + 1,
+                            Wiener_Taps_K[j], t->RefLrWiener[plane][pass][j]);
+                u->wiener[pass][j] = v;
+                t->RefLrWiener[plane][pass][j] = v;
+            }
+        }
+    } else if (type == AV1_RESTORE_SGRPROJ) {
+        u->sgr_set = SYM_L(sd, 4);
+        for (int i = 0; i < 2; i++) {
+            int radius = Sgr_Params[u->sgr_set][i];
+            int min = Sgrproj_Xqd_Min[i], max = Sgrproj_Xqd_Max[i];
+            int v = 0;
+            if (radius) {
+                v = decode_signed_subexp_with_ref_bool(sd, min, max + 1, 4,
+                                                       t->RefSgrXqd[plane][i]);
+            } else if (i == 1) {
+                v = clip3(min, max, (1 << 7) - t->RefSgrXqd[plane][0]);
+            }
+            u->xqd[i] = v;
+            t->RefSgrXqd[plane][i] = v;
+        }
+    }
+}
+
+static void
+read_lr(struct av1_tile_ctx *t, int r, int c, int bsize)
+{
+    struct av1_decoder *dec = t->dec;
+    const struct av1_frame_header *fh = &dec->fh;
+    struct av1_frame_ctx *f = dec->ctx;
+    int w = Num_4x4_Blocks_Wide[bsize], h = Num_4x4_Blocks_High[bsize];
+    for (int plane = 0; plane < dec->seq->NumPlanes; plane++) {
+        if (fh->lr.FrameRestorationType[plane] == AV1_RESTORE_NONE) {
+            continue;
+        }
+        int subX = plane ? dec->seq->cc.subsampling_x : 0;
+        int subY = plane ? dec->seq->cc.subsampling_y : 0;
+        int unitSize = fh->lr.LoopRestorationSize[plane];
+        int unitRows = f->lr_rows[plane], unitCols = f->lr_cols[plane];
+        int unitRowStart = (r * (MI_SIZE >> subY) + unitSize - 1) / unitSize;
+        int unitRowEnd = MIN(unitRows, ((r + h) * (MI_SIZE >> subY) + unitSize - 1) / unitSize);
+        int unitColStart = (c * (MI_SIZE >> subX) + unitSize - 1) / unitSize;
+        int unitColEnd = MIN(unitCols, ((c + w) * (MI_SIZE >> subX) + unitSize - 1) / unitSize);
+        for (int unitRow = unitRowStart; unitRow < unitRowEnd; unitRow++) {
+            for (int unitCol = unitColStart; unitCol < unitColEnd; unitCol++) {
+                read_lr_unit(t, plane, &f->lr[plane][unitRow * unitCols + unitCol]);
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// coefficients, see 5.11.39 and 7.12.3
+
+static const uint8_t Tx_Type_In_Set_Intra[3][16] = {
+    { 1 },
+    { 1, 1, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1 },
+    { 1, 1, 1, 1, 0, 0, 0, 0, 0, 1 },
+};
+
+static int
+get_tx_set(const struct av1_frame_header *fh, int txSz)
+{
+    int txSzSqr = Tx_Size_Sqr[txSz], txSzSqrUp = Tx_Size_Sqr_Up[txSz];
+    if (txSzSqrUp >= TX_32X32) {
+        return TX_SET_DCTONLY;
+    }
+    if (fh->reduced_tx_set || txSzSqr == TX_16X16) {
+        return TX_SET_INTRA_2;
+    }
+    return TX_SET_INTRA_1;
+}
+
+static inline int
+get_tx_class(int txType)
+{
+    if (txType == V_DCT || txType == V_ADST || txType == V_FLIPADST) {
+        return TX_CLASS_VERT;
+    }
+    if (txType == H_DCT || txType == H_ADST || txType == H_FLIPADST) {
+        return TX_CLASS_HORIZ;
+    }
+    return TX_CLASS_2D;
+}
+
+/* see 5.11.47 and 5.11.40, the type of a luma transform is read, the chroma
+ * ones follow the mode
+ */
+static int
+read_tx_type(struct av1_tile_ctx *t, int plane, int txSz)
+{
+    const struct av1_frame_header *fh = &t->dec->fh;
+    const struct av1_block *b = &t->b;
+    if (b->Lossless || Tx_Size_Sqr_Up[txSz] > TX_32X32) {
+        return DCT_DCT;
+    }
+    int set = get_tx_set(fh, txSz);
+    if (plane) {
+        int txType = Mode_To_Txfm[b->UVMode];
+        return Tx_Type_In_Set_Intra[set][txType] ? txType : DCT_DCT;
+    }
+    int qindex = fh->sp.segmentation_enabled ?
+                 get_qindex(fh, 1, b->segment_id, t->CurrentQIndex) :
+                 fh->qp.base_q_idx;
+    if (set == TX_SET_DCTONLY || qindex == 0) {
+        return DCT_DCT;
+    }
+    int intraDir = b->use_filter_intra ?
+                   Filter_Intra_Mode_To_Intra_Dir[b->filter_intra_mode] : b->YMode;
+    int txSzSqr = Tx_Size_Sqr[txSz];
+    if (set == TX_SET_INTRA_1) {
+        return Tx_Type_Intra_Inv_Set1[SYM(&t->sd, t->cdf.intra_tx_set1[txSzSqr][intraDir], 7)];
+    }
+    return Tx_Type_Intra_Inv_Set2[SYM(&t->sd, t->cdf.intra_tx_set2[txSzSqr][intraDir], 5)];
+}
+
+static const uint16_t *
+get_scan(int txSz, int txType)
+{
+    int wl = MIN(Tx_Width_Log2[txSz], 5) - 2, hl = MIN(Tx_Height_Log2[txSz], 5) - 2;
+    int cls = get_tx_class(txType);
+    if (Tx_Size_Sqr_Up[txSz] == TX_64X64 || cls == TX_CLASS_2D) {
+        return Scans[wl][hl][SCAN_DEFAULT];
+    }
+    return Scans[wl][hl][cls == TX_CLASS_VERT ? SCAN_MROW : SCAN_MCOL];
+}
+
+/* Coeff_Base_Ctx_Offset of the spec, by the shape of the whole transform
+ * and not just its coded part
+ */
+static inline int
+coeff_base_ctx_offset(int w, int h, int row, int col)
+{
+    if (row == 0 && col == 0) {
+        return 0;
+    }
+    row = MIN(row, 4);
+    col = MIN(col, 4);
+    if (w < h && row < 2) {
+        return 11;
+    }
+    if (w > h && col < 2) {
+        return 16;
+    }
+    if (row + col < 2) {
+        return 1;
+    }
+    if (row + col < 4) {
+        return 6;
+    }
+    return 21;
+}
+
+#define LEVELS_STRIDE 36
+
+/* reads the coefficients of a transform block and dequantizes them into
+ * t->coef. Returns the eob, *rows the number of rows there may be non-zero
+ * coefficients in.
+ */
+static int
+coeffs(struct av1_tile_ctx *t, int plane, int startX, int startY, int txSz,
+       int *txTypeOut, int *rows)
+{
+    struct av1_decoder *dec = t->dec;
+    const struct av1_frame_header *fh = &dec->fh;
+    const struct av1_block *b = &t->b;
+    struct symdec *sd = &t->sd;
+    struct av1_coef_cdf *cc = &t->ccdf;
+    int subX = plane ? dec->seq->cc.subsampling_x : 0;
+    int subY = plane ? dec->seq->cc.subsampling_y : 0;
+    int x4 = startX >> 2, y4 = startY >> 2;
+    int w4 = 1 << (Tx_Width_Log2[txSz] - 2), h4 = 1 << (Tx_Height_Log2[txSz] - 2);
+    int maxX4 = fh->MiCols >> subX, maxY4 = fh->MiRows >> subY;
+    int txSzCtx = (Tx_Size_Sqr[txSz] + Tx_Size_Sqr_Up[txSz] + 1) >> 1;
+    int ptype = plane > 0;
+    uint8_t *above_level = t->above_level[plane] + x4;
+    uint8_t *above_dc = t->above_dc[plane] + x4;
+    uint8_t *left_level = t->left_level[plane] + y4;
+    uint8_t *left_dc = t->left_dc[plane] + y4;
+    int aw4 = MIN(w4, maxX4 - x4), lh4 = MIN(h4, maxY4 - y4);
+    int ctx;
+
+    // see 8.3.2, the context of all_zero
+    int bsize = plane_res_size(b->MiSize, subX, subY);
+    if (plane == 0) {
+        int top = 0, left = 0;
+        for (int k = 0; k < aw4; k++) {
+            top = MAX(top, above_level[k]);
+        }
+        for (int k = 0; k < lh4; k++) {
+            left = MAX(left, left_level[k]);
+        }
+        if (Mi_Width_Log2[bsize] + 2 == Tx_Width_Log2[txSz] &&
+            Mi_Height_Log2[bsize] + 2 == Tx_Height_Log2[txSz]) {
+            ctx = 0;
+        } else if (top == 0 && left == 0) {
+            ctx = 1;
+        } else if (top == 0 || left == 0) {
+            ctx = 2 + (MAX(top, left) > 3);
+        } else if (MAX(top, left) <= 3) {
+            ctx = 4;
+        } else if (MIN(top, left) <= 3) {
+            ctx = 5;
+        } else {
+            ctx = 6;
+        }
+    } else {
+        int above = 0, left = 0;
+        for (int i = 0; i < aw4; i++) {
+            above |= above_level[i] | above_dc[i];
+        }
+        for (int i = 0; i < lh4; i++) {
+            left |= left_level[i] | left_dc[i];
+        }
+        ctx = 7 + (above != 0) + (left != 0);
+        if (Mi_Width_Log2[bsize] + Mi_Height_Log2[bsize] + 4 >
+            Tx_Width_Log2[txSz] + Tx_Height_Log2[txSz]) {
+            ctx += 3;
+        }
+    }
+
+    int eob = 0, culLevel = 0, dcCategory = 0;
+    *rows = 0;
+    if (!SYM(sd, cc->txb_skip[txSzCtx][ctx], 2)) {
+        int txType = read_tx_type(t, plane, txSz);
+        int txClass = get_tx_class(txType);
+        const uint16_t *scan = get_scan(txSz, txType);
+        int bwl = MIN(Tx_Width_Log2[txSz], 5);
+        int txw = 1 << bwl, txh = 1 << MIN(Tx_Height_Log2[txSz], 5);
+        int area = txw * txh;
+        int eobMultisize = bwl + MIN(Tx_Height_Log2[txSz], 5) - 4;
+        int ectx = txClass == TX_CLASS_2D ? 0 : 1;
+        int eobPt;
+        *txTypeOut = txType;
+
+        switch (eobMultisize) {
+        case 0:
+            eobPt = SYM(sd, cc->eob_pt_16[ptype][ectx], 5);
+            break;
+        case 1:
+            eobPt = SYM(sd, cc->eob_pt_32[ptype][ectx], 6);
+            break;
+        case 2:
+            eobPt = SYM(sd, cc->eob_pt_64[ptype][ectx], 7);
+            break;
+        case 3:
+            eobPt = SYM(sd, cc->eob_pt_128[ptype][ectx], 8);
+            break;
+        case 4:
+            eobPt = SYM(sd, cc->eob_pt_256[ptype][ectx], 9);
+            break;
+        case 5:
+            eobPt = SYM(sd, cc->eob_pt_512[ptype], 10);
+            break;
+        default:
+            eobPt = SYM(sd, cc->eob_pt_1024[ptype], 11);
+            break;
+        }
+        eobPt++;
+        eob = eobPt < 2 ? eobPt : (1 << (eobPt - 2)) + 1;
+        int eobShift = eobPt - 3;
+        if (eobShift >= 0) {
+            if (SYM(sd, cc->eob_extra[txSzCtx][ptype][eobPt - 3], 2)) {
+                eob += 1 << eobShift;
+            }
+            for (int i = 1; i < MAX(0, eobPt - 2); i++) {
+                eobShift = MAX(0, eobPt - 2) - 1 - i;
+                if (SYM_L(sd, 1)) {
+                    eob += 1 << eobShift;
+                }
+            }
+        }
+
+        // the levels by rows with 4 zero rows and columns after them, as
+        // the contexts only look right and down
+        uint8_t *levels = t->levels;
+        int32_t quant[32 * 32];
+        memset(levels, 0, LEVELS_STRIDE * (txh + 4));
+        for (int c = eob - 1; c >= 0; c--) {
+            int pos = scan[c];
+            int row = pos >> bwl, col = pos - (row << bwl);
+            uint8_t *l = levels + row * LEVELS_STRIDE + col;
+            int level;
+            if (c == eob - 1) {
+                int ectx2 = c == 0 ? 0 : (c <= area / 8 ? 1 : (c <= area / 4 ? 2 : 3));
+                level = SYM(sd, cc->coeff_base_eob[txSzCtx][ptype][ectx2], 3) + 1;
+            } else {
+                int mag = 0;
+                for (int idx = 0; idx < 5; idx++) {
+                    mag += MIN(l[Sig_Ref_Diff_Offset[txClass][idx][0] * LEVELS_STRIDE +
+                                 Sig_Ref_Diff_Offset[txClass][idx][1]], 3);
+                }
+                int bctx = MIN((mag + 1) >> 1, 4);
+                if (txClass == TX_CLASS_2D) {
+                    bctx = (row == 0 && col == 0) ? 0 :
+                           bctx + coeff_base_ctx_offset(Tx_Width_Log2[txSz],
+                                                        Tx_Height_Log2[txSz],
+                                                        row, col);
+                } else {
+                    int idx = txClass == TX_CLASS_VERT ? row : col;
+                    bctx += Coeff_Base_Pos_Ctx_Offset[MIN(idx, 2)];
+                }
+                level = SYM(sd, cc->coeff_base[txSzCtx][ptype][bctx], 4);
+            }
+            if (level > 2) {
+                int mag = 0;
+                for (int idx = 0; idx < 3; idx++) {
+                    mag += MIN(l[Mag_Ref_Offset_With_Tx_Class[txClass][idx][0] * LEVELS_STRIDE +
+                                 Mag_Ref_Offset_With_Tx_Class[txClass][idx][1]], 15);
+                }
+                mag = MIN((mag + 1) >> 1, 6);
+                int brctx;
+                if (pos == 0) {
+                    brctx = mag;
+                } else if (txClass == TX_CLASS_2D) {
+                    brctx = mag + ((row < 2 && col < 2) ? 7 : 14);
+                } else if (txClass == TX_CLASS_HORIZ) {
+                    brctx = mag + (col == 0 ? 7 : 14);
+                } else {
+                    brctx = mag + (row == 0 ? 7 : 14);
+                }
+                uint16_t *cdf = cc->coeff_br[MIN(txSzCtx, 3)][ptype][brctx];
+                for (int idx = 0; idx < 4; idx++) {
+                    int br = SYM(sd, cdf, 4);
+                    level += br;
+                    if (br < 3) {
+                        break;
+                    }
+                }
+            }
+            *l = level;
+            quant[pos] = level;
+        }
+
+        for (int c = 0; c < eob; c++) {
+            int pos = scan[c];
+            int32_t q = quant[pos];
+            int sign = 0;
+            if (q == 0) {
+                continue;
+            }
+            if (c == 0) {
+                int dcSign = 0;
+                for (int k = 0; k < aw4; k++) {
+                    dcSign += above_dc[k] == 1 ? -1 : (above_dc[k] == 2);
+                }
+                for (int k = 0; k < lh4; k++) {
+                    dcSign += left_dc[k] == 1 ? -1 : (left_dc[k] == 2);
+                }
+                int sctx = dcSign < 0 ? 1 : (dcSign > 0 ? 2 : 0);
+                sign = SYM(sd, cc->dc_sign[ptype][sctx], 2);
+            } else {
+                sign = SYM_L(sd, 1);
+            }
+            if (q > 14) {
+                int length = 0, golomb_length_bit;
+                do {
+                    length++;
+                    golomb_length_bit = SYM_L(sd, 1);
+                } while (!golomb_length_bit && length < 32);
+                int x = 1;
+                for (int i = length - 2; i >= 0; i--) {
+                    x = (x << 1) | SYM_L(sd, 1);
+                }
+                q = x + 14;
+            }
+            if (pos == 0) {
+                dcCategory = sign ? 1 : 2;
+            }
+            q &= 0xFFFFF;
+            culLevel += q;
+            quant[pos] = sign ? -q : q;
+        }
+        culLevel = MIN(63, culLevel);
+
+        // see 7.12.3 steps 1 and 2, Dequant by columns for the transform
+        int bd = dec->seq->BitDepth;
+        int qindex = get_qindex(fh, 0, b->segment_id, t->CurrentQIndex);
+        int dcDelta = plane == 0 ? fh->qp.DeltaQYDc :
+                      (plane == 1 ? fh->qp.DeltaQUDc : fh->qp.DeltaQVDc);
+        int acDelta = plane == 0 ? 0 :
+                      (plane == 1 ? fh->qp.DeltaQUAc : fh->qp.DeltaQVAc);
+        int dcQ = Dc_Qlookup[(bd - 8) >> 1][clip3(0, 255, qindex + dcDelta)];
+        int acQ = Ac_Qlookup[(bd - 8) >> 1][clip3(0, 255, qindex + acDelta)];
+        int pels = Tx_Width_Log2[txSz] + Tx_Height_Log2[txSz];
+        int dqShift = (pels > 8) + (pels > 10);
+        int32_t maxv = (1 << (7 + bd)) - 1, minv = -(1 << (7 + bd));
+        // 1D and identity transforms stay flat
+        const uint8_t *qm = NULL;
+        if (fh->qp.using_qmatrix && !fh->LosslessArray[b->segment_id] &&
+            txType < IDTX) {
+            int qmLevel = plane == 0 ? fh->qp.qm_y :
+                          (plane == 1 ? fh->qp.qm_u : fh->qp.qm_v);
+            qm = av1_qm_get(qmLevel, plane, bwl,
+                            MIN(Tx_Height_Log2[txSz], 5));
+        }
+        for (int c = 0; c < eob; c++) {
+            int pos = scan[c];
+            int32_t q = quant[pos];
+            if (!q) {
+                continue;
+            }
+            int row = pos >> bwl, col = pos - (row << bwl);
+            int dqv = pos == 0 ? dcQ : acQ;
+            if (qm) {
+                dqv = (qm[pos] * dqv + 16) >> 5;
+            }
+            int64_t dq = (int64_t)(q < 0 ? -q : q) * dqv;
+            int32_t v = (int32_t)((dq & 0xFFFFFF) >> dqShift);
+            t->coef[col * 64 + row] = clip3(minv, maxv, q < 0 ? -v : v);
+            *rows = MAX(*rows, row + 1);
+        }
+    }
+    memset(above_level, culLevel, w4);
+    memset(above_dc, dcCategory, w4);
+    memset(left_level, culLevel, h4);
+    memset(left_dc, dcCategory, h4);
+    return eob;
+}
+
+//------------------------------------------------------------------------------
+// intra prediction, see 7.11.2
+
+static inline int
+is_smooth(const struct av1_frame_ctx *f, int row, int col, int plane)
+{
+    const struct av1_mi *mi = mi_at(f, row, col);
+    int mode = plane == 0 ? mi->y_mode : mi->uv_mode;
+    return mode == SMOOTH_PRED || mode == SMOOTH_V_PRED || mode == SMOOTH_H_PRED;
+}
+
+static int
+get_filter_type(const struct av1_tile_ctx *t, int plane)
+{
+    const struct av1_frame_ctx *f = t->dec->ctx;
+    const struct color_config *cc = &t->dec->seq->cc;
+    const struct av1_block *b = &t->b;
+    int aboveSmooth = 0, leftSmooth = 0;
+    if (plane == 0 ? b->AvailU : b->AvailUChroma) {
+        int r = b->MiRow - 1, c = b->MiCol;
+        if (plane > 0) {
+            if (cc->subsampling_x && !(b->MiCol & 1)) {
+                c++;
+            }
+            if (cc->subsampling_y && (b->MiRow & 1)) {
+                r--;
+            }
+        }
+        aboveSmooth = is_smooth(f, r, c, plane);
+    }
+    if (plane == 0 ? b->AvailL : b->AvailLChroma) {
+        int r = b->MiRow, c = b->MiCol - 1;
+        if (plane > 0) {
+            if (cc->subsampling_x && (b->MiCol & 1)) {
+                c--;
+            }
+            if (cc->subsampling_y && !(b->MiRow & 1)) {
+                r++;
+            }
+        }
+        leftSmooth = is_smooth(f, r, c, plane);
+    }
+    return aboveSmooth || leftSmooth;
+}
+
+static int
+intra_edge_filter_strength(int w, int h, int filterType, int delta)
+{
+    int d = abs(delta), blkWh = w + h, strength = 0;
+    if (filterType == 0) {
+        if (blkWh <= 8) {
+            strength = d >= 56;
+        } else if (blkWh <= 16) {
+            strength = d >= 40;
+        } else if (blkWh <= 24) {
+            strength = d >= 32 ? 3 : (d >= 16 ? 2 : (d >= 8));
+        } else if (blkWh <= 32) {
+            strength = d >= 32 ? 3 : (d >= 4 ? 2 : (d >= 1));
+        } else {
+            strength = d >= 1 ? 3 : 0;
+        }
+    } else {
+        if (blkWh <= 8) {
+            strength = d >= 64 ? 2 : (d >= 40);
+        } else if (blkWh <= 16) {
+            strength = d >= 48 ? 2 : (d >= 20);
+        } else if (blkWh <= 24) {
+            strength = d >= 4 ? 3 : 0;
+        } else {
+            strength = d >= 1 ? 3 : 0;
+        }
+    }
+    return strength;
+}
+
+/* see 7.11.2.12, on edge[-1..sz - 2] */
+static void
+intra_edge_filter(uint16_t *edge, int sz, int strength)
+{
+    uint16_t e[2 * 64 + 1];
+    if (!strength) {
+        return;
+    }
+    memcpy(e, edge - 1, sz * sizeof(uint16_t));
+    for (int i = 1; i < sz; i++) {
+        int s = 0;
+        for (int j = 0; j < 5; j++) {
+            s += Intra_Edge_Kernel[strength - 1][j] * e[clip3(0, sz - 1, i - 2 + j)];
+        }
+        edge[i - 1] = (s + 8) >> 4;
+    }
+}
+
+static inline int
+intra_edge_upsample_selection(int w, int h, int filterType, int delta)
+{
+    int d = abs(delta), blkWh = w + h;
+    if (d <= 0 || d >= 40) {
+        return 0;
+    }
+    return filterType ? blkWh <= 8 : blkWh <= 16;
+}
+
+/* see 7.11.2.11 */
+static void
+intra_edge_upsample(uint16_t *buf, int numPx, int bitdepth)
+{
+    int dup[16 + 3];
+    dup[0] = buf[-1];
+    for (int i = -1; i < numPx; i++) {
+        dup[i + 2] = buf[i];
+    }
+    dup[numPx + 2] = buf[numPx - 1];
+    buf[-2] = dup[0];
+    for (int i = 0; i < numPx; i++) {
+        int s = -dup[i] + 9 * dup[i + 1] + 9 * dup[i + 2] - dup[i + 3];
+        buf[2 * i - 1] = clip3(0, (1 << bitdepth) - 1, (s + 8) >> 4);
+        buf[2 * i] = dup[i + 2];
+    }
+}
+
+/* see 7.11.2.3 */
+static void
+recursive_intra_prediction(uint16_t *dst, int stride, const uint16_t *above,
+                           const uint16_t *left, int w, int h, int mode,
+                           int bitdepth)
+{
+    int w4 = w >> 2, h2 = h >> 1;
+    for (int i2 = 0; i2 < h2; i2++) {
+        for (int j4 = 0; j4 < w4; j4++) {
+            int p[7];
+            for (int i = 0; i < 7; i++) {
+                if (i < 5) {
+                    if (i2 == 0) {
+                        p[i] = above[(j4 << 2) + i - 1];
+                    } else if (j4 == 0 && i == 0) {
+                        p[i] = left[(i2 << 1) - 1];
+                    } else {
+                        p[i] = dst[((i2 << 1) - 1) * stride + (j4 << 2) + i - 1];
+                    }
+                } else {
+                    if (j4 == 0) {
+                        p[i] = left[(i2 << 1) + i - 5];
+                    } else {
+                        p[i] = dst[((i2 << 1) + i - 5) * stride + (j4 << 2) - 1];
+                    }
+                }
+            }
+            for (int i = 0; i < 8; i++) {
+                int pr = 0;
+                for (int j = 0; j < 7; j++) {
+                    pr += Intra_Filter_Taps[mode][i][j] * p[j];
+                }
+                pr = pr < 0 ? -((-pr + 8) >> 4) : (pr + 8) >> 4;
+                dst[((i2 << 1) + (i >> 2)) * stride + (j4 << 2) + (i & 3)] =
+                    clip3(0, (1 << bitdepth) - 1, pr);
+            }
+        }
+    }
+}
+
+static void
+predict_intra(struct av1_tile_ctx *t, int plane, int x, int y, int haveLeft,
+              int haveAbove, int haveAboveRight, int haveBelowLeft, int mode,
+              int log2W, int log2H)
+{
+    struct av1_decoder *dec = t->dec;
+    const struct av1_frame_header *fh = &dec->fh;
+    struct av1_frame_ctx *f = dec->ctx;
+    const struct av1_block *b = &t->b;
+    const struct av1_dsp *dsp = av1_dsp_get();
+    int bd = dec->seq->BitDepth;
+    int subX = plane ? dec->seq->cc.subsampling_x : 0;
+    int subY = plane ? dec->seq->cc.subsampling_y : 0;
+    int stride = f->stride[plane];
+    uint16_t *cur = f->frame[plane][0];
+    uint16_t *dst = cur + y * stride + x;
+    int w = 1 << log2W, h = 1 << log2H;
+    int maxX = ((fh->MiCols * MI_SIZE) >> subX) - 1;
+    int maxY = ((fh->MiRows * MI_SIZE) >> subY) - 1;
+    uint16_t *above = t->edge[0] + 16, *left = t->edge[1] + 16;
+    int n = w + h;
+
+    if (!haveAbove && haveLeft) {
+        for (int i = 0; i < n; i++) {
+            above[i] = dst[-1];
+        }
+    } else if (!haveAbove) {
+        for (int i = 0; i < n; i++) {
+            above[i] = (1 << (bd - 1)) - 1;
+        }
+    } else {
+        int aboveLimit = MIN(maxX, x + (haveAboveRight ? 2 * w : w) - 1) - x;
+        const uint16_t *s = dst - stride;
+        for (int i = 0; i < n; i++) {
+            above[i] = s[MIN(aboveLimit, i)];
+        }
+    }
+    if (!haveLeft && haveAbove) {
+        for (int i = 0; i < n; i++) {
+            left[i] = dst[-stride];
+        }
+    } else if (!haveLeft) {
+        for (int i = 0; i < n; i++) {
+            left[i] = (1 << (bd - 1)) + 1;
+        }
+    } else {
+        int leftLimit = MIN(maxY, y + (haveBelowLeft ? 2 * h : h) - 1) - y;
+        for (int i = 0; i < n; i++) {
+            left[i] = dst[MIN(leftLimit, i) * stride - 1];
+        }
+    }
+    if (haveAbove && haveLeft) {
+        above[-1] = dst[-stride - 1];
+    } else if (haveAbove) {
+        above[-1] = dst[-stride];
+    } else if (haveLeft) {
+        above[-1] = dst[-1];
+    } else {
+        above[-1] = 1 << (bd - 1);
+    }
+    left[-1] = above[-1];
+
+    if (plane == 0 && b->use_filter_intra) {
+        recursive_intra_prediction(dst, stride, above, left, w, h,
+                                   b->filter_intra_mode, bd);
+    } else if (is_directional_mode(mode)) {
+        int pAngle = Mode_To_Angle[mode] +
+                     (plane == 0 ? b->AngleDeltaY : b->AngleDeltaUV) * 3;
+        int upsampleAbove = 0, upsampleLeft = 0;
+        if (dec->seq->enable_intra_edge_filter) {
+            int filterType = get_filter_type(t, plane);
+            if (pAngle != 90 && pAngle != 180) {
+                if (pAngle > 90 && pAngle < 180 && w + h >= 24) {
+                    int c = (left[0] * 5 + above[-1] * 6 + above[0] * 5 + 8) >> 4;
+                    above[-1] = left[-1] = c;
+                }
+                if (haveAbove) {
+                    int strength = intra_edge_filter_strength(w, h, filterType, pAngle - 90);
+                    int numPx = MIN(w, maxX - x + 1) + (pAngle < 90 ? h : 0) + 1;
+                    intra_edge_filter(above, numPx, strength);
+                }
+                if (haveLeft) {
+                    int strength = intra_edge_filter_strength(w, h, filterType, pAngle - 180);
+                    int numPx = MIN(h, maxY - y + 1) + (pAngle > 180 ? w : 0) + 1;
+                    intra_edge_filter(left, numPx, strength);
+                }
+            }
+            upsampleAbove = intra_edge_upsample_selection(w, h, filterType, pAngle - 90);
+            if (upsampleAbove) {
+                intra_edge_upsample(above, w + (pAngle < 90 ? h : 0), bd);
+            }
+            upsampleLeft = intra_edge_upsample_selection(w, h, filterType, pAngle - 180);
+            if (upsampleLeft) {
+                intra_edge_upsample(left, h + (pAngle > 180 ? w : 0), bd);
+            }
+        }
+        if (pAngle == 90) {
+            dsp->intra_v(dst, stride, above, left, w, h);
+        } else if (pAngle == 180) {
+            dsp->intra_h(dst, stride, above, left, w, h);
+        } else {
+            dsp->intra_z(dst, stride, above, left, w, h, pAngle, upsampleAbove,
+                         upsampleLeft);
+        }
+    } else if (mode == SMOOTH_PRED) {
+        dsp->intra_smooth(dst, stride, above, left, w, h);
+    } else if (mode == SMOOTH_V_PRED) {
+        dsp->intra_smooth_v(dst, stride, above, left, w, h);
+    } else if (mode == SMOOTH_H_PRED) {
+        dsp->intra_smooth_h(dst, stride, above, left, w, h);
+    } else if (mode == DC_PRED) {
+        dsp->intra_dc(dst, stride, above, left, w, h, haveAbove, haveLeft, bd);
+    } else {
+        dsp->intra_paeth(dst, stride, above, left, w, h);
+    }
+}
+
+/* see 7.11.5 */
+static void
+predict_chroma_from_luma(struct av1_tile_ctx *t, int plane, int startX,
+                         int startY, int txSz)
+{
+    struct av1_frame_ctx *f = t->dec->ctx;
+    const struct av1_block *b = &t->b;
+    int subX = t->dec->seq->cc.subsampling_x, subY = t->dec->seq->cc.subsampling_y;
+    int log2W = Tx_Width_Log2[txSz], log2H = Tx_Height_Log2[txSz];
+    int w = 1 << log2W, h = 1 << log2H;
+    int alpha = plane == 1 ? b->CflAlphaU : b->CflAlphaV;
+    const uint16_t *luma = f->frame[0][0];
+    int lstride = f->stride[0];
+    int16_t *ac = t->cfl_ac;
+    int sum = 0;
+    for (int i = 0; i < h; i++) {
+        int lumaY = MIN(startY + i, (b->MaxLumaH >> subY) - 1) << subY;
+        for (int j = 0; j < w; j++) {
+            int lumaX = MIN(startX + j, (b->MaxLumaW >> subX) - 1) << subX;
+            const uint16_t *l = luma + lumaY * lstride + lumaX;
+            int v = l[0];
+            if (subX) {
+                v += l[1];
+            }
+            if (subY) {
+                v += l[lstride];
+                if (subX) {
+                    v += l[lstride + 1];
+                }
+            }
+            v <<= 3 - subX - subY;
+            ac[i * w + j] = v;
+            sum += v;
+        }
+    }
+    int avg = (sum + (1 << (log2W + log2H - 1))) >> (log2W + log2H);
+    for (int i = 0; i < w * h; i++) {
+        ac[i] -= avg;
+    }
+    av1_dsp_get()->cfl_pred(f->frame[plane][0] + startY * f->stride[plane] + startX,
+                            f->stride[plane], ac, w, h, alpha,
+                            t->dec->seq->BitDepth);
+}
+
+//------------------------------------------------------------------------------
+// decoding of the blocks, see 5.11.4 to 5.11.35
+
+/* see 7.11.4 */
+static void
+predict_palette(struct av1_tile_ctx *t, int plane, int startX, int startY,
+                int x, int y, int txSz)
+{
+    struct av1_frame_ctx *f = t->dec->ctx;
+    const struct av1_block *b = &t->b;
+    int w = 1 << Tx_Width_Log2[txSz], h = 1 << Tx_Height_Log2[txSz];
+    const uint16_t *palette = b->palette_colors[plane];
+    const uint8_t *map = (plane == 0 ? b->ColorMapY : b->ColorMapUV) +
+                         y * 4 * 64 + x * 4;
+    int stride = f->stride[plane];
+    uint16_t *dst = f->frame[plane][0] + startY * stride + startX;
+    for (int i = 0; i < h; i++) {
+        for (int j = 0; j < w; j++) {
+            dst[i * stride + j] = palette[map[i * 64 + j]];
+        }
+    }
+}
+
+/* see 5.11.35 */
+static void
+transform_block(struct av1_tile_ctx *t, int plane, int baseX, int baseY,
+                int txSz, int x, int y)
+{
+    struct av1_decoder *dec = t->dec;
+    struct av1_frame_ctx *f = dec->ctx;
+    struct av1_block *b = &t->b;
+    int subX = plane ? dec->seq->cc.subsampling_x : 0;
+    int subY = plane ? dec->seq->cc.subsampling_y : 0;
+    int startX = baseX + 4 * x, startY = baseY + 4 * y;
+    int row = (startY << subY) >> MI_SIZE_LOG2, col = (startX << subX) >> MI_SIZE_LOG2;
+    int sbMask = sb_size4(dec->seq) - 1;
+    int sbRow = (row & sbMask) >> subY, sbCol = (col & sbMask) >> subX;
+    int stepX = 1 << (Tx_Width_Log2[txSz] - 2), stepY = 1 << (Tx_Height_Log2[txSz] - 2);
+    int maxX = (dec->fh.MiCols * MI_SIZE) >> subX;
+    int maxY = (dec->fh.MiRows * MI_SIZE) >> subY;
+    if (startX >= maxX || startY >= maxY) {
+        return;
+    }
+    if ((plane == 0 && b->PaletteSizeY) || (plane != 0 && b->PaletteSizeUV)) {
+        predict_palette(t, plane, startX, startY, x, y, txSz);
+    } else {
+        int isCfl = plane > 0 && b->UVMode == UV_CFL_PRED;
+        int mode = plane == 0 ? b->YMode : (isCfl ? DC_PRED : b->UVMode);
+        predict_intra(t, plane, startX, startY,
+                      (plane == 0 ? b->AvailL : b->AvailLChroma) || x > 0,
+                      (plane == 0 ? b->AvailU : b->AvailUChroma) || y > 0,
+                      t->BlockDecoded[plane][sbRow][sbCol + stepX + 1],
+                      t->BlockDecoded[plane][sbRow + stepY + 1][sbCol],
+                      mode, Tx_Width_Log2[txSz], Tx_Height_Log2[txSz]);
+        if (isCfl) {
+            predict_chroma_from_luma(t, plane, startX, startY, txSz);
+        }
+    }
+    if (plane == 0) {
+        b->MaxLumaW = startX + stepX * 4;
+        b->MaxLumaH = startY + stepY * 4;
+    }
+    if (!b->skip) {
+        int txType = DCT_DCT, rows;
+        int eob = coeffs(t, plane, startX, startY, txSz, &txType, &rows);
+        if (eob > 0) {
+            int stride = f->stride[plane];
+            av1_inv_txfm_add(f->frame[plane][0] + startY * stride + startX,
+                             stride, t->coef, Tx_Width_Log2[txSz],
+                             Tx_Height_Log2[txSz], txType, b->Lossless, rows,
+                             dec->seq->BitDepth);
+        }
+    }
+    uint8_t *lf = f->txsz[plane] + (row >> subY) * f->mi_stride + (col >> subX);
+    for (int i = 0; i < stepY; i++) {
+        memset(lf + i * f->mi_stride, txSz, stepX);
+        memset(&t->BlockDecoded[plane][sbRow + i + 1][sbCol + 1], 1, stepX);
+    }
+}
+
+/* see 5.11.34, by 64x64 chunks of the block */
+static void
+residual(struct av1_tile_ctx *t)
+{
+    struct av1_decoder *dec = t->dec;
+    struct av1_block *b = &t->b;
+    int widthChunks = MAX(1, b->bw4 >> 4), heightChunks = MAX(1, b->bh4 >> 4);
+    int planes = b->HasChroma ? 3 : 1;
+    for (int chunkY = 0; chunkY < heightChunks; chunkY++) {
+        for (int chunkX = 0; chunkX < widthChunks; chunkX++) {
+            for (int plane = 0; plane < planes; plane++) {
+                int subX = plane ? dec->seq->cc.subsampling_x : 0;
+                int subY = plane ? dec->seq->cc.subsampling_y : 0;
+                int txSz = b->Lossless ? TX_4X4 : get_tx_size(dec, b, plane, b->TxSize);
+                int stepX = 1 << (Tx_Width_Log2[txSz] - 2);
+                int stepY = 1 << (Tx_Height_Log2[txSz] - 2);
+                int planeSz = plane_res_size(b->MiSize, subX, subY);
+                int num4x4W = Num_4x4_Blocks_Wide[planeSz];
+                int num4x4H = Num_4x4_Blocks_High[planeSz];
+                int baseX = (b->MiCol >> subX) * MI_SIZE;
+                int baseY = (b->MiRow >> subY) * MI_SIZE;
+                int x0 = (chunkX << 4) >> subX, y0 = (chunkY << 4) >> subY;
+                int x1 = MIN(num4x4W, x0 + (16 >> subX));
+                int y1 = MIN(num4x4H, y0 + (16 >> subY));
+                for (int y = y0; y < y1; y += stepY) {
+                    for (int x = x0; x < x1; x += stepX) {
+                        transform_block(t, plane, baseX, baseY, txSz, x, y);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/* see 5.11.5 */
+static void
+decode_block(struct av1_tile_ctx *t, int r, int c, int subSize)
+{
+    struct av1_decoder *dec = t->dec;
+    const struct color_config *cc = &dec->seq->cc;
+    struct av1_frame_ctx *f = dec->ctx;
+    struct av1_block *b = &t->b;
+    int bw4 = Num_4x4_Blocks_Wide[subSize], bh4 = Num_4x4_Blocks_High[subSize];
+
+    b->MiRow = r;
+    b->MiCol = c;
+    b->MiSize = subSize;
+    b->bw4 = bw4;
+    b->bh4 = bh4;
+    if (bh4 == 1 && cc->subsampling_y && (r & 1) == 0) {
+        b->HasChroma = 0;
+    } else if (bw4 == 1 && cc->subsampling_x && (c & 1) == 0) {
+        b->HasChroma = 0;
+    } else {
+        b->HasChroma = dec->seq->NumPlanes > 1;
+    }
+    b->AvailU = is_inside(t, r - 1, c);
+    b->AvailL = is_inside(t, r, c - 1);
+    b->AvailUChroma = b->AvailU;
+    b->AvailLChroma = b->AvailL;
+    if (b->HasChroma) {
+        if (cc->subsampling_y && bh4 == 1) {
+            b->AvailUChroma = is_inside(t, r - 2, c);
+        }
+        if (cc->subsampling_x && bw4 == 1) {
+            b->AvailLChroma = is_inside(t, r, c - 2);
+        }
+    } else {
+        b->AvailUChroma = b->AvailLChroma = 0;
+    }
+
+    intra_frame_mode_info(t);
+    palette_tokens(t);
+    read_tx_size(t);
+    if (b->skip) {
+        // see 5.11.36, reset_block_context()
+        for (int plane = 0; plane < 1 + 2 * b->HasChroma; plane++) {
+            int subX = plane ? cc->subsampling_x : 0;
+            int subY = plane ? cc->subsampling_y : 0;
+            int x0 = c >> subX, x1 = (c + bw4 - 1) >> subX;
+            int y0 = r >> subY, y1 = (r + bh4 - 1) >> subY;
+            memset(t->above_level[plane] + x0, 0, x1 - x0 + 1);
+            memset(t->above_dc[plane] + x0, 0, x1 - x0 + 1);
+            memset(t->left_level[plane] + y0, 0, y1 - y0 + 1);
+            memset(t->left_dc[plane] + y0, 0, y1 - y0 + 1);
+        }
+    }
+
+    struct av1_mi m = {
+        .bsize = subSize,
+        .skip = b->skip,
+        .segment_id = b->segment_id,
+        .y_mode = b->YMode,
+        .tx_size = b->TxSize,
+    };
+    for (int i = 0; i < 4; i++) {
+        m.delta_lf[i] = t->DeltaLF[i];
+    }
+    for (int y = 0; y < bh4; y++) {
+        struct av1_mi *mi = mi_at(f, r + y, c);
+        for (int x = 0; x < bw4; x++) {
+            m.uv_mode = b->HasChroma ? b->UVMode : mi[x].uv_mode;
+            mi[x] = m;
+        }
+    }
+    int sizes[2] = { b->PaletteSizeY, b->PaletteSizeUV };
+    for (int plane = 0; plane < 2; plane++) {
+        memset(t->above_pal_size[plane] + c, sizes[plane], bw4);
+        memset(t->left_pal_size[plane] + r, sizes[plane], bh4);
+        for (int x = 0; x < bw4 && sizes[plane]; x++) {
+            memcpy(t->above_pal[plane] + (c + x) * PALETTE_COLORS,
+                   b->palette_colors[plane], sizes[plane] * sizeof(uint16_t));
+        }
+        for (int y = 0; y < bh4 && sizes[plane]; y++) {
+            memcpy(t->left_pal[plane] + (r + y) * PALETTE_COLORS,
+                   b->palette_colors[plane], sizes[plane] * sizeof(uint16_t));
+        }
+    }
+    residual(t);
+}
+
+/* the partition cdf of a block size, with the number of symbols */
+static uint16_t *
+partition_cdf(struct av1_tile_ctx *t, int bsl, int ctx, int *n)
+{
+    switch (bsl) {
+    case 1:
+        *n = 4;
+        return t->cdf.partition_w8[ctx];
+    case 2:
+        *n = 10;
+        return t->cdf.partition_w16[ctx];
+    case 3:
+        *n = 10;
+        return t->cdf.partition_w32[ctx];
+    case 4:
+        *n = 10;
+        return t->cdf.partition_w64[ctx];
+    default:
+        *n = 8;
+        return t->cdf.partition_w128[ctx];
+    }
+}
+
+/* see 9.3.1, the cdf of split_or_horz and split_or_vert gathers the
+ * probabilities of the partitions that split the way the block can
+ */
+static int
+read_split_or(struct av1_tile_ctx *t, const uint16_t *pcdf, int n, int horz)
+{
+    static const uint8_t split_or_horz[6] = {
+        PARTITION_VERT, PARTITION_SPLIT, PARTITION_HORZ_A, PARTITION_VERT_A,
+        PARTITION_VERT_B, PARTITION_VERT_4,
+    };
+    static const uint8_t split_or_vert[6] = {
+        PARTITION_HORZ, PARTITION_SPLIT, PARTITION_HORZ_A, PARTITION_HORZ_B,
+        PARTITION_VERT_A, PARTITION_HORZ_4,
+    };
+    const uint8_t *p = horz ? split_or_horz : split_or_vert;
+    int psum = 0;
+    for (int i = 0; i < 6; i++) {
+        if (p[i] < n && (i < 5 || n == 10)) {
+            psum += pcdf[p[i]] - (p[i] ? pcdf[p[i] - 1] : 0);
+        }
+    }
+    uint16_t cdf[3] = { 32768 - psum, 32768, 0 };
+    return symdec_read(&t->sd, cdf, 2);
+}
+
+static int
+partition_subsize(int partition, int bsize)
+{
+    int wl = Mi_Width_Log2[bsize], hl = Mi_Height_Log2[bsize];
+    switch (partition) {
+    case PARTITION_NONE:
+        return bsize;
+    case PARTITION_HORZ:
+    case PARTITION_HORZ_A:
+    case PARTITION_HORZ_B:
+        return Block_Size_Dims[wl][hl - 1];
+    case PARTITION_VERT:
+    case PARTITION_VERT_A:
+    case PARTITION_VERT_B:
+        return Block_Size_Dims[wl - 1][hl];
+    case PARTITION_SPLIT:
+        return Block_Size_Dims[wl - 1][hl - 1];
+    case PARTITION_HORZ_4:
+        return Block_Size_Dims[wl][hl - 2];
+    default:
+        return Block_Size_Dims[wl - 2][hl];
+    }
+}
+
+/* see 5.11.4 */
+static int
+decode_partition(struct av1_tile_ctx *t, int r, int c, int bSize)
+{
+    struct av1_decoder *dec = t->dec;
+    const struct av1_frame_header *fh = &dec->fh;
+    const struct av1_frame_ctx *f = dec->ctx;
+    if (r >= fh->MiRows || c >= fh->MiCols) {
+        return 0;
+    }
+    int availU = is_inside(t, r - 1, c), availL = is_inside(t, r, c - 1);
+    int num4x4 = Num_4x4_Blocks_Wide[bSize];
+    int halfBlock4x4 = num4x4 >> 1, quarterBlock4x4 = halfBlock4x4 >> 1;
+    int hasRows = (r + halfBlock4x4) < fh->MiRows;
+    int hasCols = (c + halfBlock4x4) < fh->MiCols;
+    int partition;
+    if (bSize < BLOCK_8X8) {
+        partition = PARTITION_NONE;
+    } else {
+        int bsl = Mi_Width_Log2[bSize], n;
+        int above = availU && Mi_Width_Log2[mi_at(f, r - 1, c)->bsize] < bsl;
+        int left = availL && Mi_Height_Log2[mi_at(f, r, c - 1)->bsize] < bsl;
+        uint16_t *cdf = partition_cdf(t, bsl, left * 2 + above, &n);
+        if (hasRows && hasCols) {
+            partition = SYM(&t->sd, cdf, n);
+        } else if (hasCols) {
+            partition = read_split_or(t, cdf, n, 1) ? PARTITION_SPLIT : PARTITION_HORZ;
+        } else if (hasRows) {
+            partition = read_split_or(t, cdf, n, 0) ? PARTITION_SPLIT : PARTITION_VERT;
+        } else {
+            partition = PARTITION_SPLIT;
+        }
+    }
+    int subSize = partition_subsize(partition, bSize);
+    int splitSize = bSize < BLOCK_8X8 ? subSize :
+                    partition_subsize(PARTITION_SPLIT, bSize);
+    if (subSize == BLOCK_INVALID ||
+        plane_res_size(subSize, dec->seq->cc.subsampling_x,
+                       dec->seq->cc.subsampling_y) == BLOCK_INVALID) {
+        VERR(av1, "invalid block size %d at %d %d", subSize, r, c);
+        return -1;
+    }
+    int ret = 0;
+    switch (partition) {
+    case PARTITION_NONE:
+        decode_block(t, r, c, subSize);
+        break;
+    case PARTITION_HORZ:
+        decode_block(t, r, c, subSize);
+        if (hasRows) {
+            decode_block(t, r + halfBlock4x4, c, subSize);
+        }
+        break;
+    case PARTITION_VERT:
+        decode_block(t, r, c, subSize);
+        if (hasCols) {
+            decode_block(t, r, c + halfBlock4x4, subSize);
+        }
+        break;
+    case PARTITION_SPLIT:
+        ret |= decode_partition(t, r, c, subSize);
+        ret |= decode_partition(t, r, c + halfBlock4x4, subSize);
+        ret |= decode_partition(t, r + halfBlock4x4, c, subSize);
+        ret |= decode_partition(t, r + halfBlock4x4, c + halfBlock4x4, subSize);
+        break;
+    case PARTITION_HORZ_A:
+        decode_block(t, r, c, splitSize);
+        decode_block(t, r, c + halfBlock4x4, splitSize);
+        decode_block(t, r + halfBlock4x4, c, subSize);
+        break;
+    case PARTITION_HORZ_B:
+        decode_block(t, r, c, subSize);
+        decode_block(t, r + halfBlock4x4, c, splitSize);
+        decode_block(t, r + halfBlock4x4, c + halfBlock4x4, splitSize);
+        break;
+    case PARTITION_VERT_A:
+        decode_block(t, r, c, splitSize);
+        decode_block(t, r + halfBlock4x4, c, splitSize);
+        decode_block(t, r, c + halfBlock4x4, subSize);
+        break;
+    case PARTITION_VERT_B:
+        decode_block(t, r, c, subSize);
+        decode_block(t, r, c + halfBlock4x4, splitSize);
+        decode_block(t, r + halfBlock4x4, c + halfBlock4x4, splitSize);
+        break;
+    case PARTITION_HORZ_4:
+        for (int i = 0; i < 4 && r + quarterBlock4x4 * i < fh->MiRows; i++) {
+            decode_block(t, r + quarterBlock4x4 * i, c, subSize);
+        }
+        break;
+    default:
+        for (int i = 0; i < 4 && c + quarterBlock4x4 * i < fh->MiCols; i++) {
+            decode_block(t, r, c + quarterBlock4x4 * i, subSize);
+        }
+        break;
+    }
+    return ret;
+}
+
+/* see 5.11.3 clear_block_decoded_flags() */
+static void
+clear_block_decoded_flags(struct av1_tile_ctx *t, int r, int c, int sbSize4)
+{
+    const struct sequence_header_obu *seq = t->dec->seq;
+    for (int plane = 0; plane < seq->NumPlanes; plane++) {
+        int subX = plane ? seq->cc.subsampling_x : 0;
+        int subY = plane ? seq->cc.subsampling_y : 0;
+        int sbWidth4 = (t->MiColEnd - c) >> subX;
+        int sbHeight4 = (t->MiRowEnd - r) >> subY;
+        for (int y = -1; y <= (sbSize4 >> subY); y++) {
+            for (int x = -1; x <= (sbSize4 >> subX); x++) {
+                int v = 0;
+                if (y < 0 && x < sbWidth4) {
+                    v = 1;
+                } else if (x < 0 && y < sbHeight4) {
+                    v = 1;
+                }
+                t->BlockDecoded[plane][y + 1][x + 1] = v;
+            }
+        }
+        t->BlockDecoded[plane][(sbSize4 >> subY) + 1][0] = 0;
+    }
+}
+
+/* see 5.11.2 */
+static int
+decode_tile(struct av1_tile_ctx *t, const uint8_t *data, int size)
+{
+    struct av1_decoder *dec = t->dec;
+    const struct av1_frame_header *fh = &dec->fh;
+    struct av1_frame_ctx *f = dec->ctx;
+    const struct sequence_header_obu *seq = dec->seq;
+    int sbSize = seq->use_128x128_superblock ? BLOCK_128X128 : BLOCK_64X64;
+    int sbSize4 = sb_size4(seq);
+    int ret = 0;
+
+    memcpy(&t->cdf, &av1_default_cdf, sizeof(t->cdf));
+    memcpy(&t->ccdf, &av1_default_coef_cdf[av1_coef_cdf_idx(fh->qp.base_q_idx)],
+           sizeof(t->ccdf));
+    symdec_init(&t->sd, data, size, fh->disable_cdf_update);
+    for (int plane = 0; plane < 3; plane++) {
+        memset(t->above_level[plane], 0, t->above_size);
+        memset(t->above_dc[plane], 0, t->above_size);
+        for (int pass = 0; pass < 2; pass++) {
+            t->RefSgrXqd[plane][pass] = Sgrproj_Xqd_Mid[pass];
+            for (int i = 0; i < 3; i++) {
+                t->RefLrWiener[plane][pass][i] = Wiener_Taps_Mid[i];
+            }
+        }
+    }
+    memset(t->DeltaLF, 0, sizeof(t->DeltaLF));
+    t->CurrentQIndex = fh->qp.base_q_idx;
+
+    for (int r = t->MiRowStart; r < t->MiRowEnd && !ret; r += sbSize4) {
+        for (int plane = 0; plane < 3; plane++) {
+            memset(t->left_level[plane], 0, t->left_size);
+            memset(t->left_dc[plane], 0, t->left_size);
+        }
+        for (int c = t->MiColStart; c < t->MiColEnd && !ret; c += sbSize4) {
+            t->ReadDeltas = fh->delta_q_present;
+            // clear_cdef()
+            int8_t *idx = f->cdef_idx + (r >> 4) * f->cdef_stride + (c >> 4);
+            idx[0] = -1;
+            if (seq->use_128x128_superblock) {
+                idx[1] = idx[f->cdef_stride] = idx[f->cdef_stride + 1] = -1;
+            }
+            clear_block_decoded_flags(t, r, c, sbSize4);
+            read_lr(t, r, c, sbSize);
+            ret = decode_partition(t, r, c, sbSize);
+        }
+    }
+    return ret;
+}
+
+//------------------------------------------------------------------------------
+// frame buffers and threads
+
+static inline int
+align_up(int x, int a)
+{
+    return (x + a - 1) & ~(a - 1);
+}
+
+/* grows *p to size bytes, keeping nothing of the old content */
+static int
+grow_buffer(void **p, size_t *cur, size_t size)
+{
+    if (size <= *cur) {
+        return 0;
+    }
+    free(*p);
+    *p = malloc(size);
+    if (!*p) {
+        *cur = 0;
+        return -1;
+    }
+    *cur = size;
+    return 0;
+}
+
+static void
+free_tile_ctx(struct av1_tile_ctx *t)
+{
+    if (t) {
+        free(t->ctx_buf);
+        free(t);
+    }
+}
+
+/* the above and left contexts of a tile ctx, for the whole frame so a tile
+ * can index them by its position
+ */
+static int
+alloc_tile_ctx(struct av1_tile_ctx *t, int above_size, int left_size)
+{
+    if (t->ctx_buf && above_size <= t->above_size && left_size <= t->left_size) {
+        return 0;
+    }
+    above_size = MAX(above_size, t->above_size);
+    left_size = MAX(left_size, t->left_size);
+    free(t->ctx_buf);
+    size_t pal = (size_t)(above_size + left_size) * 2 * PALETTE_COLORS;
+    t->ctx_buf = malloc(pal * sizeof(uint16_t) + (above_size + left_size) * 8);
+    if (!t->ctx_buf) {
+        return -1;
+    }
+    uint16_t *p16 = (uint16_t *)t->ctx_buf;
+    for (int i = 0; i < 2; i++) {
+        t->above_pal[i] = p16;
+        p16 += above_size * PALETTE_COLORS;
+        t->left_pal[i] = p16;
+        p16 += left_size * PALETTE_COLORS;
+    }
+    uint8_t *p = (uint8_t *)p16;
+    uint8_t **above[8] = {
+        &t->above_level[0], &t->above_level[1], &t->above_level[2],
+        &t->above_dc[0], &t->above_dc[1], &t->above_dc[2],
+        &t->above_pal_size[0], &t->above_pal_size[1],
+    };
+    uint8_t **left[8] = {
+        &t->left_level[0], &t->left_level[1], &t->left_level[2],
+        &t->left_dc[0], &t->left_dc[1], &t->left_dc[2],
+        &t->left_pal_size[0], &t->left_pal_size[1],
+    };
+    for (int i = 0; i < 8; i++) {
+        *above[i] = p;
+        p += above_size;
+        *left[i] = p;
+        p += left_size;
+    }
+    t->above_size = above_size;
+    t->left_size = left_size;
+    return 0;
+}
+
+static int
+num_threads(const struct av1_decoder *dec)
+{
+    if (dec->nthreads > 0) {
+        return dec->nthreads;
+    }
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+}
+
+/* the buffers of the frame in dec->fh, only grown from frame to frame.
+ * Returns the number of tile contexts there are for the tile threads.
+ */
+static int
+alloc_frame(struct av1_decoder *dec, int cdef, int ntc)
+{
+    struct av1_frame_ctx *f = dec->ctx;
+    const struct av1_frame_header *fh = &dec->fh;
+    const struct sequence_header_obu *seq = dec->seq;
+    int cols = align_up(fh->MiCols, 32), rows = align_up(fh->MiRows, 32);
+
+    f->mi_stride = cols;
+    if (grow_buffer((void **)&f->mi, &f->mi_size,
+                    (size_t)cols * rows * sizeof(struct av1_mi)) ||
+        grow_buffer((void **)&f->txsz[0], &f->txsz_size, (size_t)cols * rows * 3)) {
+        return -1;
+    }
+    f->txsz[1] = f->txsz[0] + cols * rows;
+    f->txsz[2] = f->txsz[1] + cols * rows;
+    f->cdef_stride = cols >> 4;
+    if (grow_buffer((void **)&f->cdef_idx, &f->cdef_size,
+                    (size_t)(cols >> 4) * (rows >> 4))) {
+        return -1;
+    }
+    for (int plane = 0; plane < seq->NumPlanes; plane++) {
+        int subX = plane ? seq->cc.subsampling_x : 0;
+        int subY = plane ? seq->cc.subsampling_y : 0;
+        int lr = fh->lr.FrameRestorationType[plane] != AV1_RESTORE_NONE;
+        // some slack on the right for the SIMD kernels
+        f->stride[plane] = (align_up(fh->MiCols * MI_SIZE, 128) >> subX) + 32;
+        f->height[plane] = align_up(fh->MiRows * MI_SIZE, 128) >> subY;
+        size_t size = (size_t)f->stride[plane] * f->height[plane];
+        if (grow_buffer((void **)&f->buf[plane], &f->buf_size[plane],
+                        size * (1 + cdef + lr) * sizeof(uint16_t))) {
+            return -1;
+        }
+        uint16_t *p = f->buf[plane];
+        f->frame[plane][0] = p;
+        f->frame[plane][1] = cdef ? (p += size) : f->frame[plane][0];
+        f->frame[plane][2] = lr ? (p += size) : f->frame[plane][1];
+
+        if (lr) {
+            // see 7.17, count_units_in_frame()
+            int unitSize = fh->lr.LoopRestorationSize[plane];
+            int w = (fh->UpscaledWidth + subX) >> subX;
+            int h = (fh->FrameHeight + subY) >> subY;
+            f->lr_cols[plane] = MAX((w + (unitSize >> 1)) / unitSize, 1);
+            f->lr_rows[plane] = MAX((h + (unitSize >> 1)) / unitSize, 1);
+            if (grow_buffer((void **)&f->lr[plane], &f->lr_size[plane],
+                            sizeof(struct lr_unit) * f->lr_cols[plane] *
+                            f->lr_rows[plane])) {
+                return -1;
+            }
+        }
+    }
+
+    if (ntc > f->ntc) {
+        struct av1_tile_ctx **tc = realloc(f->tc, ntc * sizeof(*tc));
+        if (!tc) {
+            return -1;
+        }
+        f->tc = tc;
+        for (int i = f->ntc; i < ntc; i++) {
+            tc[i] = aligned_alloc(32, sizeof(struct av1_tile_ctx));
+            if (!tc[i]) {
+                return -1;
+            }
+            memset(tc[i], 0, sizeof(struct av1_tile_ctx));
+            tc[i]->dec = dec;
+            f->ntc = i + 1;
+        }
+    }
+    for (int i = 0; i < ntc; i++) {
+        if (alloc_tile_ctx(f->tc[i], fh->MiCols + 32, fh->MiRows + 32)) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static void
+free_frame(struct av1_frame_ctx *f)
+{
+    if (!f) {
+        return;
+    }
+    for (int plane = 0; plane < 3; plane++) {
+        free(f->buf[plane]);
+        free(f->lr[plane]);
+    }
+    free(f->mi);
+    free(f->txsz[0]);
+    free(f->cdef_idx);
+    for (int i = 0; i < f->ntc; i++) {
+        free_tile_ctx(f->tc[i]);
+    }
+    free(f->tc);
+    free(f);
+}
+
+/* jobs 0 to num - 1 taken by whichever thread is free first, fn also gets
+ * the index of the thread running it
+ */
+typedef void (*av1_job_func)(struct av1_decoder *dec, int job, int tid);
+
+struct av1_jobs {
+    struct av1_decoder *dec;
+    av1_job_func fn;
+    int num;
+    atomic_int next;
+};
+
+struct av1_worker {
+    struct av1_jobs *jobs;
+    int tid;
+};
+
+static void *
+job_worker(void *arg)
+{
+    struct av1_worker *w = arg;
+    struct av1_jobs *jobs = w->jobs;
+    int job;
+    while ((job = atomic_fetch_add(&jobs->next, 1)) < jobs->num) {
+        jobs->fn(jobs->dec, job, w->tid);
+    }
+    return NULL;
+}
+
+static void
+run_jobs(struct av1_decoder *dec, int num, int nthreads, av1_job_func fn)
+{
+    struct av1_jobs jobs = { .dec = dec, .fn = fn, .num = num };
+    atomic_init(&jobs.next, 0);
+    nthreads = MAX(1, MIN(nthreads, num));
+    pthread_t *th = malloc(sizeof(pthread_t) * nthreads);
+    struct av1_worker *w = malloc(sizeof(struct av1_worker) * nthreads);
+    if (!th || !w) {
+        nthreads = 1;
+    }
+    struct av1_worker self = { .jobs = &jobs, .tid = 0 };
+    int started = 1;
+    for (int i = 1; i < nthreads; i++) {
+        w[i].jobs = &jobs;
+        w[i].tid = i;
+        if (pthread_create(&th[i], NULL, job_worker, &w[i])) {
+            break;
+        }
+        started++;
+    }
+    job_worker(&self);
+    for (int i = 1; i < started; i++) {
+        pthread_join(th[i], NULL);
+    }
+    free(th);
+    free(w);
+}
+
+static void
+tile_job(struct av1_decoder *dec, int job, int tid)
+{
+    struct av1_frame_ctx *f = dec->ctx;
+    const struct av1_tile_info *ti = &dec->fh.ti;
+    struct av1_tile_ctx *t = f->tc[tid];
+    int tileRow = job / ti->TileCols, tileCol = job % ti->TileCols;
+    if (atomic_load(&f->error)) {
+        return;
+    }
+    t->MiRowStart = ti->MiRowStarts[tileRow];
+    t->MiRowEnd = ti->MiRowStarts[tileRow + 1];
+    t->MiColStart = ti->MiColStarts[tileCol];
+    t->MiColEnd = ti->MiColStarts[tileCol + 1];
+    if (decode_tile(t, dec->tile_start[job], dec->tile_size[job])) {
+        VERR(av1, "tile %d is broken", job);
+        atomic_store(&f->error, 1);
+    }
+}
+
+//------------------------------------------------------------------------------
+// loop filter, see 7.14
+
+/* see 7.14.4, the filter level of the block at mi for plane and pass */
+static int
+filter_level(const struct av1_frame_header *fh, const struct av1_mi *mi,
+             int plane, int pass)
+{
+    int i = plane == 0 ? pass : plane + 1;
+    int deltaLF = fh->delta_lf_multi ? mi->delta_lf[i] : mi->delta_lf[0];
+    int lvl = clip3(0, MAX_LOOP_FILTER, deltaLF + fh->lf.loop_filter_level[i]);
+    int feature = AV1_SEG_LVL_ALT_LF_Y_V + i;
+    if (seg_feature_active(fh, mi->segment_id, feature)) {
+        lvl = clip3(0, MAX_LOOP_FILTER,
+                    lvl + fh->sp.FeatureData[mi->segment_id][feature]);
+    }
+    if (fh->lf.loop_filter_delta_enabled) {
+        // intra blocks only take the delta of INTRA_FRAME
+        lvl = clip3(0, MAX_LOOP_FILTER,
+                    lvl + (fh->lf.loop_filter_ref_deltas[0] << (lvl >> 5)));
+    }
+    return lvl;
+}
+
+/* see 7.14.2, the edges of one pass of a plane in rows y0 to y1 and columns
+ * x0 to x1, by 4x4 units of the plane
+ */
+static void
+filter_edges(struct av1_decoder *dec, int plane, int pass, int y0, int y1,
+             int x0, int x1)
+{
+    const struct av1_frame_header *fh = &dec->fh;
+    const struct sequence_header_obu *seq = dec->seq;
+    const struct av1_dsp *dsp = av1_dsp_get();
+    struct av1_frame_ctx *f = dec->ctx;
+    int subX = plane ? seq->cc.subsampling_x : 0;
+    int subY = plane ? seq->cc.subsampling_y : 0;
+    int stride = f->stride[plane];
+    int shift = fh->lf.loop_filter_sharpness > 4 ? 2 :
+                (fh->lf.loop_filter_sharpness > 0 ? 1 : 0);
+    int bdShift = seq->BitDepth - 8;
+    int dx = pass == 0, dy = pass == 1;
+    const uint8_t *txLog2 = pass == 0 ? Tx_Width_Log2 : Tx_Height_Log2;
+
+    // onScreen, the luma position of the unit is inside the frame
+    y1 = MIN(y1, (fh->FrameHeight + (MI_SIZE << subY) - 1) / (MI_SIZE << subY));
+    x1 = MIN(x1, (fh->FrameWidth + (MI_SIZE << subX) - 1) / (MI_SIZE << subX));
+    for (int y = MAX(y0, dy); y < y1; y++) {
+        const uint8_t *txsz = f->txsz[plane] + y * f->mi_stride;
+        int row = (y << subY) | subY;
+        for (int x = MAX(x0, dx); x < x1; x++) {
+            int col = (x << subX) | subX;
+            int txSz = txsz[x];
+            int prevTxSz = pass == 0 ? txsz[x - 1] : txsz[x - f->mi_stride];
+            // only transform edges matter for intra blocks
+            int pos = pass == 0 ? x : y;
+            if (pos & ((1 << (txLog2[txSz] - 2)) - 1)) {
+                continue;
+            }
+            int lvl = filter_level(fh, mi_at(f, row, col), plane, pass);
+            if (lvl == 0) {
+                lvl = filter_level(fh, mi_at(f, row - (dy << subY),
+                                             col - (dx << subX)), plane, pass);
+                if (lvl == 0) {
+                    continue;
+                }
+            }
+            int size = 1 << MIN(txLog2[txSz], txLog2[prevTxSz]);
+            size = MIN(size, 16 >> (plane > 0));
+            if (plane && size == 8) {
+                size = 6;
+            }
+            int limit = fh->lf.loop_filter_sharpness > 0 ?
+                        clip3(1, 9 - fh->lf.loop_filter_sharpness, lvl >> shift) :
+                        MAX(1, lvl >> shift);
+            int blimit = 2 * (lvl + 2) + limit;
+            uint16_t *pix = f->frame[plane][0] + y * 4 * stride + x * 4;
+            dsp->lf_edge(pix, pass == 0 ? 1 : stride, pass == 0 ? stride : 1,
+                         4, size, limit << bdShift, blimit << bdShift,
+                         (lvl >> 4) << bdShift, seq->BitDepth);
+        }
+    }
+}
+
+/* planes that are filtered, luma goes by both passes and chroma by its own
+ * level, see 7.14.1
+ */
+static int
+lf_plane_on(const struct av1_frame_header *fh, int plane)
+{
+    if (!fh->lf.loop_filter_level[0] && !fh->lf.loop_filter_level[1]) {
+        return 0;
+    }
+    return plane == 0 || fh->lf.loop_filter_level[1 + plane];
+}
+
+/* the vertical edges by bands of 64 luma rows */
+static void
+lf_rows_job(struct av1_decoder *dec, int job, int tid)
+{
+    const struct sequence_header_obu *seq = dec->seq;
+    (void)tid;
+    for (int plane = 0; plane < seq->NumPlanes; plane++) {
+        if (!lf_plane_on(&dec->fh, plane)) {
+            continue;
+        }
+        int subX = plane ? seq->cc.subsampling_x : 0;
+        int subY = plane ? seq->cc.subsampling_y : 0;
+        filter_edges(dec, plane, 0, (job * 16) >> subY, ((job + 1) * 16) >> subY,
+                     0, dec->fh.MiCols >> subX);
+    }
+}
+
+/* the horizontal edges by bands of 64 luma columns */
+static void
+lf_cols_job(struct av1_decoder *dec, int job, int tid)
+{
+    const struct sequence_header_obu *seq = dec->seq;
+    (void)tid;
+    for (int plane = 0; plane < seq->NumPlanes; plane++) {
+        if (!lf_plane_on(&dec->fh, plane)) {
+            continue;
+        }
+        int subX = plane ? seq->cc.subsampling_x : 0;
+        int subY = plane ? seq->cc.subsampling_y : 0;
+        filter_edges(dec, plane, 1, 0, dec->fh.MiRows >> subY,
+                     (job * 16) >> subX, ((job + 1) * 16) >> subX);
+    }
+}
+
+//------------------------------------------------------------------------------
+// cdef, see 7.15
+
+/* one 64x64 block of a plane to the padded source of 7.15.2, which is
+ * CdefAvailable as far as the frame goes
+ */
+static void
+cdef_fill(int16_t *dst, int dstride, const uint16_t *src, int stride, int x0,
+          int y0, int w, int h, int pw, int ph)
+{
+    for (int y = -2; y < h + 2; y++) {
+        int16_t *d = dst + y * dstride;
+        int yy = y0 + y;
+        if (yy < 0 || yy >= ph) {
+            for (int x = -3; x < w + 3; x++) {
+                d[x] = AV1_CDEF_VERY_LARGE;
+            }
+            continue;
+        }
+        const uint16_t *s = src + yy * stride + x0;
+        for (int x = -3; x < w + 3; x++) {
+            int xx = x0 + x;
+            d[x] = (xx < 0 || xx >= pw) ? AV1_CDEF_VERY_LARGE : s[x];
+        }
+    }
+}
+
+#define CDEF_STRIDE (64 + 6)
+
+/* a band of 64 luma rows, copied from CurrFrame to CdefFrame and filtered
+ * by 8x8 blocks where cdef_idx says so
+ */
+static void
+cdef_job(struct av1_decoder *dec, int job, int tid)
+{
+    const struct av1_frame_header *fh = &dec->fh;
+    const struct sequence_header_obu *seq = dec->seq;
+    const struct av1_dsp *dsp = av1_dsp_get();
+    struct av1_frame_ctx *f = dec->ctx;
+    int16_t pad[3][(64 + 4) * CDEF_STRIDE];
+    int coeffShift = seq->BitDepth - 8;
+    int fbr = job * 16;
+    (void)tid;
+
+    for (int plane = 0; plane < seq->NumPlanes; plane++) {
+        int subY = plane ? seq->cc.subsampling_y : 0;
+        int stride = f->stride[plane];
+        int y0 = (fbr * MI_SIZE) >> subY;
+        int y1 = MIN(((fbr + 16) * MI_SIZE) >> subY, (fh->MiRows * MI_SIZE) >> subY);
+        memcpy(f->frame[plane][1] + y0 * stride, f->frame[plane][0] + y0 * stride,
+               (size_t)(y1 - y0) * stride * sizeof(uint16_t));
+    }
+    for (int fbc = 0; fbc < fh->MiCols; fbc += 16) {
+        int idx = f->cdef_idx[(fbr >> 4) * f->cdef_stride + (fbc >> 4)];
+        if (idx == -1) {
+            continue;
+        }
+        for (int plane = 0; plane < seq->NumPlanes; plane++) {
+            int subX = plane ? seq->cc.subsampling_x : 0;
+            int subY = plane ? seq->cc.subsampling_y : 0;
+            cdef_fill(pad[plane] + 2 * CDEF_STRIDE + 3, CDEF_STRIDE,
+                      f->frame[plane][0], f->stride[plane],
+                      (fbc * MI_SIZE) >> subX, (fbr * MI_SIZE) >> subY,
+                      64 >> subX, 64 >> subY,
+                      (fh->MiCols * MI_SIZE) >> subX,
+                      (fh->MiRows * MI_SIZE) >> subY);
+        }
+        for (int r = fbr; r < MIN(fbr + 16, fh->MiRows); r += 2) {
+            for (int c = fbc; c < MIN(fbc + 16, fh->MiCols); c += 2) {
+                const struct av1_mi *m0 = mi_at(f, r, c), *m1 = mi_at(f, r + 1, c);
+                if (m0[0].skip && m0[1].skip && m1[0].skip && m1[1].skip) {
+                    continue;
+                }
+                int var;
+                int yDir = dsp->cdef_dir(f->frame[0][0] + r * MI_SIZE * f->stride[0] +
+                                         c * MI_SIZE, f->stride[0], &var,
+                                         seq->BitDepth);
+                for (int plane = 0; plane < seq->NumPlanes; plane++) {
+                    int subX = plane ? seq->cc.subsampling_x : 0;
+                    int subY = plane ? seq->cc.subsampling_y : 0;
+                    int pri, sec, dir, damping = fh->cdef.cdef_damping + coeffShift;
+                    if (plane == 0) {
+                        pri = fh->cdef.cdef_y_pri_strength[idx] << coeffShift;
+                        sec = fh->cdef.cdef_y_sec_strength[idx] << coeffShift;
+                        dir = pri == 0 ? 0 : yDir;
+                        int varStr = (var >> 6) ? MIN(floor_log2(var >> 6), 12) : 0;
+                        pri = var ? (pri * (4 + varStr) + 8) >> 4 : 0;
+                    } else {
+                        pri = fh->cdef.cdef_uv_pri_strength[idx] << coeffShift;
+                        sec = fh->cdef.cdef_uv_sec_strength[idx] << coeffShift;
+                        dir = pri == 0 ? 0 : Cdef_Uv_Dir[subX][subY][yDir];
+                        damping--;
+                    }
+                    if (pri == 0 && sec == 0) {
+                        continue;
+                    }
+                    int x = ((c - fbc) * MI_SIZE) >> subX;
+                    int y = ((r - fbr) * MI_SIZE) >> subY;
+                    int stride = f->stride[plane];
+                    dsp->cdef_filter(f->frame[plane][1] +
+                                     (((r * MI_SIZE) >> subY) * stride) +
+                                     ((c * MI_SIZE) >> subX), stride,
+                                     pad[plane] + (y + 2) * CDEF_STRIDE + x + 3,
+                                     CDEF_STRIDE, 8 >> subX, 8 >> subY, pri, sec,
+                                     damping, dir, seq->BitDepth);
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// loop restoration, see 7.17
+
+/* w x h samples at x, y of a stripe from StripeStartY to StripeEndY, padded
+ * by 3 as get_source_sample() has them
+ */
+static void
+lr_fill(uint16_t *dst, int dstride, const uint16_t *cur, const uint16_t *cdef,
+        int stride, int x, int y, int w, int h, int stripeStart, int stripeEnd,
+        int planeEndX, int planeEndY)
+{
+    for (int i = -3; i < h + 3; i++) {
+        int yy = clip3(0, planeEndY, y + i);
+        const uint16_t *src = cdef;
+        if (yy < stripeStart) {
+            yy = MAX(stripeStart - 2, yy);
+            src = cur;
+        } else if (yy > stripeEnd) {
+            yy = MIN(stripeEnd + 2, yy);
+            src = cur;
+        }
+        src += yy * stride;
+        uint16_t *d = dst + i * dstride;
+        for (int j = -3; j < w + 3; j++) {
+            d[j] = src[clip3(0, planeEndX, x + j)];
+        }
+    }
+}
+
+#define LR_STRIDE (64 + 6)
+
+/* one stripe of 64 luma rows, which starts 8 rows above its superblocks */
+static void
+lr_job(struct av1_decoder *dec, int job, int tid)
+{
+    const struct av1_frame_header *fh = &dec->fh;
+    const struct sequence_header_obu *seq = dec->seq;
+    const struct av1_dsp *dsp = av1_dsp_get();
+    struct av1_frame_ctx *f = dec->ctx;
+    uint16_t src[(64 + 6) * LR_STRIDE];
+    (void)tid;
+
+    for (int plane = 0; plane < seq->NumPlanes; plane++) {
+        int type = fh->lr.FrameRestorationType[plane];
+        if (type == AV1_RESTORE_NONE) {
+            continue;
+        }
+        int subX = plane ? seq->cc.subsampling_x : 0;
+        int subY = plane ? seq->cc.subsampling_y : 0;
+        int stride = f->stride[plane];
+        int unitSize = fh->lr.LoopRestorationSize[plane];
+        int planeEndX = ((fh->UpscaledWidth + subX) >> subX) - 1;
+        int planeEndY = ((fh->FrameHeight + subY) >> subY) - 1;
+        int stripeStart = (-8 + job * 64) >> subY;
+        int stripeEnd = stripeStart + (64 >> subY) - 1;
+        int y0 = MAX(0, stripeStart), y1 = MIN(stripeEnd, planeEndY) + 1;
+        int unitRow = MIN(f->lr_rows[plane] - 1, ((job * 64) >> subY) / unitSize);
+        uint16_t *cdef = f->frame[plane][1], *lr = f->frame[plane][2];
+        if (y0 >= y1) {
+            continue;
+        }
+        for (int y = y0; y < y1; y++) {
+            memcpy(lr + y * stride, cdef + y * stride,
+                   (planeEndX + 1) * sizeof(uint16_t));
+        }
+        for (int unitCol = 0; unitCol < f->lr_cols[plane]; unitCol++) {
+            const struct lr_unit *u =
+                &f->lr[plane][unitRow * f->lr_cols[plane] + unitCol];
+            int x0 = unitCol * unitSize;
+            int x1 = unitCol == f->lr_cols[plane] - 1 ? planeEndX + 1 :
+                     MIN(x0 + unitSize, planeEndX + 1);
+            if (u->type == AV1_RESTORE_NONE) {
+                continue;
+            }
+            for (int x = x0; x < x1; x += 64) {
+                int w = MIN(64, x1 - x), h = y1 - y0;
+                uint16_t *s = src + 3 * LR_STRIDE + 3;
+                uint16_t *dst = lr + y0 * stride + x;
+                lr_fill(s, LR_STRIDE, f->frame[plane][0], cdef, stride, x, y0,
+                        w, h, stripeStart, stripeEnd, planeEndX, planeEndY);
+                if (u->type == AV1_RESTORE_WIENER) {
+                    int16_t filter[2][7];
+                    for (int pass = 0; pass < 2; pass++) {
+                        // the first coefficients are the vertical ones
+                        const int8_t *c = u->wiener[1 - pass];
+                        filter[pass][0] = filter[pass][6] = c[0];
+                        filter[pass][1] = filter[pass][5] = c[1];
+                        filter[pass][2] = filter[pass][4] = c[2];
+                        filter[pass][3] = 128 - 2 * (c[0] + c[1] + c[2]);
+                    }
+                    dsp->wiener(dst, stride, s, LR_STRIDE, w, h,
+                                (const int16_t (*)[7])filter, seq->BitDepth);
+                } else {
+                    const int16_t *p = Sgr_Params[u->sgr_set];
+                    int r[2] = { p[0], p[1] }, sc[2] = { p[2], p[3] };
+                    int xqd[2] = { u->xqd[0], u->xqd[1] };
+                    dsp->sgr(dst, stride, s, LR_STRIDE, w, h, r, sc, xqd,
+                             seq->BitDepth);
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// frames and the decoder
+
+/* the frame in its planes to out, see av1_output */
+static void
+output_frame(struct av1_decoder *dec, const struct av1_output *out)
+{
+    const struct sequence_header_obu *seq = dec->seq;
+    struct av1_frame_ctx *f = dec->ctx;
+    int width = dec->fh.UpscaledWidth, height = dec->fh.FrameHeight;
+    int subX = seq->cc.subsampling_x, subY = seq->cc.subsampling_y;
+    int mono = seq->NumPlanes == 1;
+
+    if (out->format == AV1_OUTPUT_YUV) {
+        struct av1_yuv *yuv = out->yuv;
+        int cw = mono ? 0 : (width + subX) >> subX;
+        int ch = mono ? 0 : (height + subY) >> subY;
+        uint16_t *pixel = malloc(((size_t)width * height + 2 * cw * ch) *
+                                 sizeof(uint16_t));
+        if (!pixel) {
+            return;
+        }
+        free(yuv->planes[0]);
+        uint16_t *p = pixel;
+        for (int plane = 0; plane < 3; plane++) {
+            int w = plane ? cw : width, h = plane ? ch : height;
+            yuv->planes[plane] = w ? p : NULL;
+            yuv->strides[plane] = w;
+            for (int y = 0; y < h; y++) {
+                memcpy(p + y * w, f->frame[plane][2] + y * f->stride[plane],
+                       w * sizeof(uint16_t));
+            }
+            p += w * h;
+        }
+        yuv->width = width;
+        yuv->height = height;
+        yuv->subsampling_x = subX;
+        yuv->subsampling_y = subY;
+        yuv->bitdepth = seq->BitDepth;
+        yuv->color_range = seq->cc.color_range;
+        return;
+    }
+
+    struct av1_output whole = {
+        .pixels = out->pixels,
+        .pitch = width * 4,
+        .width = width,
+        .height = height,
+        .format = out->format,
+    };
+    if (out->pitch == 0) {
+        out = &whole;
+    }
+    int out_width = MIN(width, out->width);
+    int out_height = MIN(height, out->height);
+    const struct hevc_dsp *dsp = hevc_dsp_get();
+    int bitdepth = seq->BitDepth;
+    int sub = subX;
+    int16_t *grey = NULL;
+    if (mono) {
+        grey = malloc(out_width * sizeof(int16_t));
+        if (!grey) {
+            return;
+        }
+        for (int i = 0; i < out_width; i++) {
+            grey[i] = 1 << (bitdepth - 1);
+        }
+        sub = 0;
+    }
+    // the samples never get near the sign bit, so they pass as int16_t
+    for (int i = 0; i < out_height; i++) {
+        const int16_t *y = (const int16_t *)(f->frame[0][2] + i * f->stride[0]);
+        const int16_t *u = grey, *v = grey;
+        if (!grey) {
+            u = (const int16_t *)(f->frame[1][2] + (i >> subY) * f->stride[1]);
+            v = (const int16_t *)(f->frame[2][2] + (i >> subY) * f->stride[2]);
+        }
+        dsp->yuv_bgra32(out->pixels + i * out->pitch, y, u, v, out_width, sub,
+                        bitdepth);
+    }
+    free(grey);
+}
+
+/* see 7.4, all tiles of the frame are there, decode it and run the loop
+ * filters
+ */
+static int
+decode_frame(struct av1_decoder *dec, const struct av1_output *out)
+{
+    const struct av1_frame_header *fh = &dec->fh;
+    const struct sequence_header_obu *seq = dec->seq;
+    int nthreads = num_threads(dec);
+    int ntiles = fh->ti.TileCols * fh->ti.TileRows;
+    int ntc = MIN(nthreads, ntiles);
+    int cdef = seq->enable_cdef && !fh->CodedLossless;
+
+    if (!dec->ctx) {
+        dec->ctx = calloc(1, sizeof(struct av1_frame_ctx));
+        if (!dec->ctx) {
+            return -ENOMEM;
+        }
+    }
+    struct av1_frame_ctx *f = dec->ctx;
+    if (alloc_frame(dec, cdef, ntc)) {
+        return -ENOMEM;
+    }
+    atomic_init(&f->error, 0);
+    run_jobs(dec, ntiles, ntc, tile_job);
+    if (atomic_load(&f->error)) {
+        return -EINVAL;
+    }
+
+    if (lf_plane_on(fh, 0)) {
+        run_jobs(dec, (fh->MiRows + 15) >> 4, nthreads, lf_rows_job);
+        run_jobs(dec, (fh->MiCols + 15) >> 4, nthreads, lf_cols_job);
+    }
+    if (cdef) {
+        run_jobs(dec, (fh->MiRows + 15) >> 4, nthreads, cdef_job);
+    }
+    if (fh->lr.UsesLr) {
+        run_jobs(dec, (fh->FrameHeight + 8 + 63) >> 6, nthreads, lr_job);
+    }
+    if (fh->show_frame && out) {
+        output_frame(dec, out);
+    }
+    return 0;
+}
+
+/* see 5.11.1, gathers the tiles of the group at data. Returns 1 once the
+ * last tile of the frame is there.
+ */
+static int
+tile_group(struct av1_decoder *dec, const uint8_t *data, int len)
+{
+    const struct av1_tile_info *ti = &dec->fh.ti;
+    int numTiles = ti->TileCols * ti->TileRows;
+    int tgStart = 0, tgEnd = numTiles - 1;
+    struct bits_vec *v = bits_vec_alloc((uint8_t *)data, len, BITS_MSB);
+    if (numTiles > 1 && READ_BIT(v)) {
+        int tileBits = ti->TileColsLog2 + ti->TileRowsLog2;
+        tgStart = READ_BITS(v, tileBits);
+        tgEnd = READ_BITS(v, tileBits);
+    }
+    int pos = (bits_vec_position(v) + 7) >> 3;
+    int eof = v->eof;
+    v->buff = NULL;
+    bits_vec_free(v);
+    if (eof || tgEnd < tgStart || tgEnd >= numTiles) {
+        return -1;
+    }
+
+    if (numTiles > dec->num_tiles) {
+        free(dec->tile_start);
+        free(dec->tile_size);
+        dec->tile_start = malloc(numTiles * sizeof(*dec->tile_start));
+        dec->tile_size = malloc(numTiles * sizeof(*dec->tile_size));
+        if (!dec->tile_start || !dec->tile_size) {
+            dec->num_tiles = 0;
+            return -1;
+        }
+        dec->num_tiles = numTiles;
+    }
+    data += pos;
+    len -= pos;
+    for (int tileNum = tgStart; tileNum <= tgEnd; tileNum++) {
+        int tileSize = len;
+        if (tileNum != tgEnd) {
+            if (len < ti->TileSizeBytes) {
+                return -1;
+            }
+            tileSize = 0;
+            for (int i = 0; i < ti->TileSizeBytes; i++) {
+                tileSize |= data[i] << (8 * i);
+            }
+            tileSize++;
+            data += ti->TileSizeBytes;
+            len -= ti->TileSizeBytes;
+            if (tileSize > len) {
+                return -1;
+            }
+        }
+        dec->tile_start[tileNum] = data;
+        dec->tile_size[tileNum] = tileSize;
+        data += tileSize;
+        len -= tileSize;
+    }
+    return tgEnd == numTiles - 1;
+}
+
+/* see 5.9.1, returns the size of the header up to its byte alignment */
+static int
+frame_header(struct av1_decoder *dec, const uint8_t *data, int len,
+             const struct obu_header *h)
+{
+    if (!dec->seq) {
+        VERR(av1, "frame header without a sequence header");
+        return -1;
+    }
+    struct bits_vec *v = bits_vec_alloc((uint8_t *)data, len, BITS_MSB);
+    int ret = parse_uncompressed_header(dec, v, h);
+    int pos = (bits_vec_position(v) + 7) >> 3;
+    v->buff = NULL;
+    bits_vec_free(v);
+    return ret < 0 ? -1 : pos;
+}
+
+struct av1_decoder *
+av1_decoder_init(void)
+{
+    struct av1_decoder *dec = calloc(1, sizeof(*dec));
+    pthread_once(&scan_once, init_scans);
+    av1_qm_init();
+    av1_dsp_init();
+    hevc_dsp_init();
+    return dec;
+}
+
+/* whether an obu belongs to operating point 0, see 7.5 */
+static int
+in_operating_point(const struct av1_decoder *dec, const struct obu_header *h)
+{
+    if (!dec->seq || !h->obu_extension_flag ||
+        h->obu_type == OBU_SEQUENCE_HEADER ||
+        h->obu_type == OBU_TEMPORAL_DELIMITER) {
+        return 1;
+    }
+    int idc = dec->seq->points[0].operating_point_idc;
+    if (idc == 0) {
+        return 1;
+    }
+    return ((idc >> h->ext.temporal_id) & 1) &&
+           ((idc >> (h->ext.spatial_id + 8)) & 1);
+}
+
+int
+av1_decoder_decode(struct av1_decoder *dec, const uint8_t *data, int len,
+                   const struct av1_output *out)
+{
+    int pos = 0;
+    while (pos < len) {
+        struct obu_header h;
+        int hsize, size, ret = 0;
+        if (av1_obu_header(&h, data + pos, len - pos, &hsize, &size)) {
+            VERR(av1, "broken obu header at %d", pos);
+            return -EINVAL;
+        }
+        const uint8_t *payload = data + pos + hsize;
+        pos += hsize + size;
+        if (!in_operating_point(dec, &h)) {
+            continue;
+        }
+        switch (h.obu_type) {
+        case OBU_SEQUENCE_HEADER: {
+            struct sequence_header_obu *seq = av1_parse_sequence_header(payload, size);
+            if (!seq) {
+                return -EINVAL;
+            }
+            av1_free_sequence_header(dec->seq);
+            dec->seq = seq;
+            break;
+        }
+        case OBU_TEMPORAL_DELIMITER:
+            dec->seen_frame_header = 0;
+            break;
+        case OBU_FRAME_HEADER:
+        case OBU_REDUNDANT_FRAME_HEADER:
+            if (dec->seen_frame_header) {
+                break;
+            }
+            if (frame_header(dec, payload, size, &h) < 0) {
+                return -EINVAL;
+            }
+            dec->seen_frame_header = 1;
+            break;
+        case OBU_FRAME: {
+            int n = frame_header(dec, payload, size, &h);
+            if (n < 0) {
+                return -EINVAL;
+            }
+            dec->seen_frame_header = 1;
+            ret = tile_group(dec, payload + n, size - n);
+            break;
+        }
+        case OBU_TILE_GROUP:
+            if (!dec->seen_frame_header) {
+                return -EINVAL;
+            }
+            ret = tile_group(dec, payload, size);
+            break;
+        default:
+            // metadata, tile lists and padding change nothing here
+            break;
+        }
+        if (ret < 0) {
+            return -EINVAL;
+        }
+        if (ret == 1) {
+            dec->seen_frame_header = 0;
+            ret = decode_frame(dec, out);
+            if (ret < 0) {
+                return ret;
+            }
+        }
+    }
+    return 0;
+}
+
+void
+av1_decoder_destroy(struct av1_decoder *dec)
+{
+    if (!dec) {
+        return;
+    }
+    av1_free_sequence_header(dec->seq);
+    free(dec->tile_start);
+    free(dec->tile_size);
+    free_frame(dec->ctx);
+    free(dec);
+}
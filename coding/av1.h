@@ -0,0 +1,546 @@
+#ifndef _AV1_H_
+#define _AV1_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/* AV1 decoding as far as still images take it, see the av1-spec.
+ * The structs follow its syntax elements and keep their names.
+ */
+
+#pragma pack(push, 1)
+
+struct obu_externsion_header {
+    uint8_t temporal_id:3;
+    uint8_t spatial_id:2;
+    uint8_t extension_header_reserved_3bits:3;
+};
+
+struct obu_header{
+    uint8_t obu_forbidden_bit:1;
+    uint8_t obu_type:4;
+    uint8_t obu_extension_flag:1;
+    uint8_t obu_has_size_field:1;
+    uint8_t obu_reserved_1bit:1;
+    struct obu_externsion_header ext;
+};
+
+enum {
+    OBU_SEQUENCE_HEADER = 1,
+    OBU_TEMPORAL_DELIMITER = 2,
+    OBU_FRAME_HEADER = 3,
+    OBU_TILE_GROUP = 4,
+    OBU_METADATA = 5,
+    OBU_FRAME = 6,
+    OBU_REDUNDANT_FRAME_HEADER = 7,
+    OBU_TILE_LIST = 8,
+    OBU_PADDING = 15,
+};
+
+
+enum {
+    METADATA_TYPE_HDR_CLL = 1,
+    METADATA_TYPE_HDR_MDCV = 2,
+    METADATA_TYPE_SCALABILITY = 3,
+    METADATA_TYPE_ITUT_T35 = 4,
+    METADATA_TYPE_TIMECODE = 5,
+};
+
+enum {
+    SCALABILITY_L1T2 = 0,
+    SCALABILITY_L1T3,
+    SCALABILITY_L2T1,
+    SCALABILITY_L2T2,
+    SCALABILITY_L2T3,
+    SCALABILITY_S2T1,
+    SCALABILITY_S2T2,
+    SCALABILITY_S2T3,
+    SCALABILITY_L2T1h,
+    SCALABILITY_L2T2h,
+    SCALABILITY_L2T3h,
+    SCALABILITY_S2T1h,
+    SCALABILITY_S2T2h,
+    SCALABILITY_S2T3h,
+    SCALABILITY_SS,
+    SCALABILITY_L3T1,
+    SCALABILITY_L3T2,
+    SCALABILITY_L3T3,
+    SCALABILITY_S3T1,
+    SCALABILITY_S3T2,
+    SCALABILITY_S3T3,
+    SCALABILITY_L3T2_KEY,
+    SCALABILITY_L3T3_KEY,
+    SCALABILITY_L4T5_KEY,
+    SCALABILITY_L4T7_KEY,
+    SCALABILITY_L3T2_KEY_SHIFT,
+    SCALABILITY_L3T3_KEY_SHIFT,
+    SCALABILITY_L4T5_KEY_SHIFT,
+    SCALABILITY_L4T7_KEY_SHIFT,
+};
+
+struct metadata_itut_t35 {
+    uint8_t itu_t_t35_country_code;
+    uint8_t itu_t_t35_country_code_extension_byte;
+    uint8_t *itu_t_t35_payload_bytes;
+};
+struct metadata_hdr_cll {
+    uint16_t max_cll;
+    uint16_t max_fall;
+};
+struct metadata_hdr_mdcv {
+    uint16_t primary_chromaticity_x[3];
+    uint16_t primary_chromaticity_y[3];
+    uint16_t white_point_chromaticity_x;
+    uint16_t white_point_chromaticity_y;
+    uint32_t luminance_max;
+    uint32_t luminance_min;
+};
+struct metadata_scalability {
+    uint32_t scalability_mode_idc;
+    uint8_t spatial_layers_cnt_minus_1:2;
+    uint8_t spatial_layer_dimensions_present_flag:1;
+    uint8_t spatial_layer_description_present_flag:1;
+    uint8_t temporal_group_description_present_flag:1;
+    uint8_t scalability_structure_reserved_3bits:3;
+    uint16_t spatial_layer_max_width[4];
+    uint16_t spatial_layer_max_height[4];
+    uint8_t spatial_layer_ref_id[4];
+    uint8_t temporal_group_size;
+    struct temporal_group {
+        uint8_t temporal_group_temporal_id:3;
+        uint8_t temporal_group_temporal_switching_up_point_flag:1;
+        uint8_t temporal_group_spatial_switching_up_point_flag:1;
+        uint8_t temporal_group_ref_cnt:3;
+        uint8_t temporal_group_ref_pic_diff[8];
+    } * groups;
+};
+struct metadata_timecode {
+    uint8_t counting_type:5;
+    uint8_t full_timestamp_flag:1;
+    uint8_t discontinuity_flag:1;
+    uint8_t cnt_dropped_flag:1;
+
+    uint16_t n_frames:9;
+
+    uint8_t seconds_flag:1;
+    uint8_t seconds_value:6;
+    uint8_t minutes_flag:1;
+
+    uint8_t minutes_value:6;
+    uint8_t hours_flag:1;
+    uint8_t hours_value:5;
+
+    // uint8_t time_offset_length:5;
+
+    uint32_t time_offset_value;
+};
+struct metadata_obu {
+    struct obu_header h;
+    uint64_t metadata_type;
+    union {
+        struct metadata_itut_t35 itut_t35;
+        struct metadata_hdr_cll hdr_cll;
+        struct metadata_hdr_mdcv hdr_mdcv;
+        struct metadata_scalability scalability;
+        struct metadata_timecode timecode;
+    };
+};
+
+struct operating_parameters_info {
+    uint32_t decoder_buffer_delay;
+    uint32_t encoder_buffer_delay;
+    uint8_t low_delay_mode_flag:1;
+};
+
+struct operating_points {
+    uint16_t operating_point_idc:12;
+    uint8_t seq_level_idx:5;
+    uint8_t seq_tier:1;
+    uint8_t decoder_model_present_for_this_op:1;
+    struct operating_parameters_info pinfo;
+
+    uint8_t initial_display_delay_present_for_this_op:1;
+    uint8_t initial_display_delay_minus_1:4;
+};
+
+struct decoder_model_info {
+    uint8_t buffer_delay_length_minus_1 :5;
+    uint32_t num_units_in_decoding_tick;
+    uint8_t buffer_removal_time_length_minus_1:5;
+    uint8_t frame_presentation_time_length_minus_1:5;
+};
+
+/*color_primaries is an integer that is defined by the
+ “Color primaries” section of ISO/IEC 23091-4/ITU-T H.273.*/
+enum {
+    CP_BT_709 = 1,
+    CP_UNSPECIFIED = 2,
+    CP_BT_470_M = 4,
+    CP_BT_470_B_G,
+    CP_BT_601,
+    CP_SMPTE_240,
+    CP_GENERIC_FILM,
+    CP_BT_2020,
+    CP_XYZ,
+    CP_SMPTE_431,
+    CP_SMPTE_432,
+    CP_EBU_3213 = 22,
+};
+
+/* transfer_characteristics is an integer that is defined by the 
+“Transfer characteristics” section of ISO/IEC 23091-4/ITU-T H.273.*/
+enum {
+    TC_RESERVED_0 = 0,
+    TC_BT_709 = 1,
+    TC_UNSPECIFIED = 2,
+    TC_RESERVED_3 = 3,
+    TC_BT_470_M = 4,
+    TC_BT_470_B_G = 5,
+    TC_BT_601,
+    TC_SMPTE_240,
+    TC_LINEAR,
+    TC_LOG_100,
+    TC_LOG_100_SQRT10,
+    TC_IEC_61966,
+    TC_BT_1361,
+    TC_SRGB,
+    TC_BT_2020_10_BIT,
+    TC_BT_2020_12_BIT,
+    TC_SMPTE_2084,
+    TC_SMPTE_428,
+    TC_HLG,
+};
+
+/*matrix_coefficients is an integer that is defined by
+ the “Matrix coefficients” section of ISO/IEC 23091-4/ITU-T H.273.*/
+enum {
+    MC_IDENTITY = 0,
+    MC_BT_709,
+    MC_UNSPECIFIED,
+    MC_RESERVED_3,
+    MC_FCC,
+    MC_BT_470_B_G,
+    MC_BT_601,
+    MC_SMPTE_240,
+    MC_SMPTE_YCGCO,
+    MC_BT_2020_NCL,
+    MC_BT_2020_CL,
+    MC_SMPTE_2085,
+    MC_CHROMAT_NCL,
+    MC_CHROMAT_CL,
+    MC_ICTCP
+};
+
+/* chroma_sample_position specifies the sample position for subsampled streams: */
+enum {
+    CSP_UNKNOWN = 0,
+    CSP_VERTICAL,
+    CSP_COLOCATED,
+    CSP_RESERVED,
+};
+
+struct color_config {
+    uint8_t high_bitdepth:1;
+    uint8_t twelve_bit:1;
+    uint8_t mono_chrome:1;
+    uint8_t color_description_present_flag:1;
+    uint8_t color_primaries;
+    uint8_t transfer_characteristics;
+    uint8_t matrix_coefficients;
+    uint8_t color_range:1;
+    uint8_t subsampling_x:1;
+    uint8_t subsampling_y:1;
+    uint8_t chroma_sample_position:2;
+    uint8_t separate_uv_delta_q:1;
+};
+
+/* see av1-spec 5.5.1 */
+struct sequence_header_obu {
+    struct obu_header h;
+
+    uint8_t seq_profile:3;
+    uint8_t still_picture:1;
+    uint8_t reduced_still_picture_header:1;
+
+    uint8_t seq_level_idx_0 : 5;
+    uint8_t timing_info_present_flag:1;
+    uint8_t equal_picture_interval:1;
+    uint8_t decoder_model_info_present_flag:1;
+    struct decoder_model_info minfo;
+
+    uint8_t initial_display_delay_present_flag:1;
+    uint8_t operating_points_cnt_minus_1: 5;
+    struct operating_points * points;
+
+    uint8_t frame_width_bits_minus_1: 4;
+    uint8_t frame_height_bits_minus_1: 4;
+
+    uint16_t max_frame_width_minus_1;
+    uint16_t max_frame_height_minus_1;
+
+    uint8_t frame_id_numbers_present_flag:1;
+    uint8_t delta_frame_id_length_minus_2:4;
+    uint8_t additional_frame_id_length_minus_1:3;
+
+    uint8_t use_128x128_superblock:1;
+    uint8_t enable_filter_intra:1;
+    uint8_t enable_intra_edge_filter:1;
+    uint8_t enable_interintra_compound:1;
+    uint8_t enable_masked_compound :1;
+    uint8_t enable_warped_motion:1;
+    uint8_t enable_dual_filter:1;
+    uint8_t enable_order_hint:1;
+
+    uint8_t enable_jnt_comp:1;
+    uint8_t enable_ref_frame_mvs:1;
+    uint8_t seq_choose_screen_content_tools:1;
+    uint8_t seq_force_screen_content_tools:2; // read 1 bit but could be 2 in other branch
+    uint8_t seq_choose_integer_mv:1;
+
+    uint8_t seq_force_integer_mv:2; // read 1 bit but could be 2 in other branch
+
+    uint8_t order_hint_bits_minus_1:3;
+    uint8_t enable_superres:1;
+    uint8_t enable_cdef:1;
+    uint8_t enable_restoration:1;
+    uint8_t film_grain_params_present:1;
+
+    struct color_config cc;
+
+    int OrderHintBits;
+    int NumPlanes;
+    int BitDepth;
+
+};
+
+#define SELECT_SCREEN_CONTENT_TOOLS 2
+#define SELECT_INTEGER_MV 2
+
+#pragma pack(pop)
+
+enum {
+    AV1_KEY_FRAME = 0,
+    AV1_INTER_FRAME = 1,
+    AV1_INTRA_ONLY_FRAME = 2,
+    AV1_SWITCH_FRAME = 3,
+};
+
+enum {
+    AV1_RESTORE_NONE = 0,
+    AV1_RESTORE_WIENER,
+    AV1_RESTORE_SGRPROJ,
+    AV1_RESTORE_SWITCHABLE,
+};
+
+enum {
+    AV1_ONLY_4X4 = 0,
+    AV1_TX_MODE_LARGEST,
+    AV1_TX_MODE_SELECT,
+};
+
+#define AV1_MAX_SEGMENTS 8
+#define AV1_SEG_LVL_MAX 8
+#define AV1_SEG_LVL_ALT_Q 0
+#define AV1_SEG_LVL_ALT_LF_Y_V 1
+#define AV1_SEG_LVL_SKIP 6
+#define AV1_MAX_TILE_COLS 64
+#define AV1_MAX_TILE_ROWS 64
+
+/* see 5.9.15 */
+struct av1_tile_info {
+    int TileColsLog2;
+    int TileRowsLog2;
+    int TileCols;
+    int TileRows;
+    int MiColStarts[AV1_MAX_TILE_COLS + 1];
+    int MiRowStarts[AV1_MAX_TILE_ROWS + 1];
+    int context_update_tile_id;
+    int TileSizeBytes;
+};
+
+/* see 5.9.12 */
+struct av1_quant_params {
+    int base_q_idx;
+    int DeltaQYDc;
+    int DeltaQUDc;
+    int DeltaQUAc;
+    int DeltaQVDc;
+    int DeltaQVAc;
+    int using_qmatrix;
+    int qm_y;
+    int qm_u;
+    int qm_v;
+};
+
+/* see 5.9.14 */
+struct av1_segmentation_params {
+    int segmentation_enabled;
+    int segmentation_update_map;
+    int segmentation_temporal_update;
+    int FeatureEnabled[AV1_MAX_SEGMENTS][AV1_SEG_LVL_MAX];
+    int FeatureData[AV1_MAX_SEGMENTS][AV1_SEG_LVL_MAX];
+    int SegIdPreSkip;
+    int LastActiveSegId;
+};
+
+/* see 5.9.11 */
+struct av1_loop_filter_params {
+    int loop_filter_level[4];
+    int loop_filter_sharpness;
+    int loop_filter_delta_enabled;
+    int loop_filter_ref_deltas[8];
+    int loop_filter_mode_deltas[2];
+};
+
+/* see 5.9.19 */
+struct av1_cdef_params {
+    int cdef_damping;
+    int cdef_bits;
+    int cdef_y_pri_strength[8];
+    int cdef_y_sec_strength[8];
+    int cdef_uv_pri_strength[8];
+    int cdef_uv_sec_strength[8];
+};
+
+/* see 5.9.20 */
+struct av1_lr_params {
+    int FrameRestorationType[3];
+    int LoopRestorationSize[3];
+    int UsesLr;
+};
+
+/* see 5.9.2, the uncompressed header as far as intra frames need it */
+struct av1_frame_header {
+    int show_existing_frame;
+    int frame_type;
+    int show_frame;
+    int showable_frame;
+    int error_resilient_mode;
+    int disable_cdf_update;
+    int allow_screen_content_tools;
+    int force_integer_mv;
+    int frame_size_override_flag;
+    int order_hint;
+    int primary_ref_frame;
+    int refresh_frame_flags;
+    int FrameWidth;
+    int FrameHeight;
+    int UpscaledWidth;
+    int RenderWidth;
+    int RenderHeight;
+    int use_superres;
+    int allow_intrabc;
+    int disable_frame_end_update_cdf;
+    int MiCols;
+    int MiRows;
+
+    struct av1_tile_info ti;
+    struct av1_quant_params qp;
+    struct av1_segmentation_params sp;
+    int delta_q_present;
+    int delta_q_res;
+    int delta_lf_present;
+    int delta_lf_res;
+    int delta_lf_multi;
+    int CodedLossless;
+    int AllLossless;
+    int LosslessArray[AV1_MAX_SEGMENTS];
+    struct av1_loop_filter_params lf;
+    struct av1_cdef_params cdef;
+    struct av1_lr_params lr;
+    int TxMode;
+    int reduced_tx_set;
+    int apply_grain;
+};
+
+enum av1_output_format {
+    AV1_OUTPUT_BGRA32 = 0, // 8 bits per channel
+    AV1_OUTPUT_YUV,        // the decoded planes as they are, see av1_yuv
+};
+
+/* the planes handed over with AV1_OUTPUT_YUV. Samples have bitdepth bits in
+ * 16, the chroma planes are subsampled by subsampling_x and subsampling_y
+ * and NULL for a monochrome frame. All planes live in one buffer which
+ * belongs to the caller then, free(planes[0]) is all it takes; a frame
+ * decoded while planes[0] is still set frees the old one.
+ */
+struct av1_yuv {
+    uint16_t *planes[3];
+    int strides[3]; // in samples
+    int width;
+    int height;
+    int subsampling_x;
+    int subsampling_y;
+    int bitdepth;
+    int color_range; // 0 for studio swing, 1 for full range samples
+};
+
+/* where a decoded frame goes, the same as hevc_output: format at pixels with
+ * pitch bytes per line, cropped to width x height, pitch 0 takes the whole
+ * frame at its own width. AV1_OUTPUT_YUV fills yuv instead.
+ */
+struct av1_output {
+    uint8_t *pixels;
+    int pitch;
+    int width;
+    int height;
+    int format;
+    struct av1_yuv *yuv;
+};
+
+struct av1_frame_ctx;
+
+/* a decoder keeps the sequence header and its buffers from one temporal
+ * unit to the next and only ever grows them, so same sized frames like the
+ * tiles of an avif grid allocate nothing after the first one. Only intra
+ * frames are decoded, which is all a still image takes. The tiles of a
+ * frame and its loop filters run on up to nthreads threads, 0 takes one
+ * per cpu. A decoder is for one thread at a time.
+ */
+struct av1_decoder {
+    struct sequence_header_obu *seq;
+    struct av1_frame_header fh;
+    int seen_frame_header;
+    int nthreads;
+
+    // the tile data of the frame, gathered over its tile group obus
+    const uint8_t **tile_start;
+    int *tile_size;
+    int num_tiles;
+
+    struct av1_frame_ctx *ctx;
+};
+
+struct av1_decoder *av1_decoder_init(void);
+
+/* a temporal unit or any part of it, OBUs in the low overhead format.
+ * A frame that shows is written to out. Returns 0 or a negative error.
+ */
+int av1_decoder_decode(struct av1_decoder *dec, const uint8_t *data, int len,
+                       const struct av1_output *out);
+
+void av1_decoder_destroy(struct av1_decoder *dec);
+
+/* see 5.3.1, the header of the obu at data, which the payload of size bytes
+ * follows at data + *header_size. Returns -1 if it does not fit in len.
+ */
+int av1_obu_header(struct obu_header *h, const uint8_t *data, int len,
+                   int *header_size, int *size);
+
+struct sequence_header_obu *av1_parse_sequence_header(const uint8_t *data,
+                                                      int len);
+
+void av1_free_sequence_header(struct sequence_header_obu *seq);
+
+struct metadata_obu *av1_parse_metadata(const uint8_t *data, int len);
+
+void av1_free_metadata(struct metadata_obu *mo);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*_AV1_H_*/
@@ -0,0 +1,90 @@
+#ifndef _AV1CDF_H_
+#define _AV1CDF_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/* the adaptive cdfs of an AV1 intra frame, see av1-spec 9.3 and the
+ * default tables in its section 10. Every cdf of N symbols takes N + 1
+ * entries, the last one is the counter of symdec_read().
+ * The ones of inter frames and intra block copy are left out.
+ */
+struct av1_cdf {
+    uint16_t y_mode[5][5][14];      // Default_Intra_Frame_Y_Mode_Cdf
+    uint16_t uv_mode_cfl_not_allowed[13][14];
+    uint16_t uv_mode_cfl_allowed[13][15];
+    uint16_t angle_delta[8][8];
+    uint16_t partition_w8[4][5];
+    uint16_t partition_w16[4][11];
+    uint16_t partition_w32[4][11];
+    uint16_t partition_w64[4][11];
+    uint16_t partition_w128[4][9];
+    uint16_t segment_id[3][9];
+    uint16_t skip[3][3];
+    uint16_t delta_q[5];
+    uint16_t delta_lf[5];
+    uint16_t delta_lf_multi[4][5];
+    uint16_t tx_8x8[3][3];
+    uint16_t tx_16x16[3][4];
+    uint16_t tx_32x32[3][4];
+    uint16_t tx_64x64[3][4];
+    uint16_t filter_intra[22][3];
+    uint16_t filter_intra_mode[6];
+    uint16_t palette_y_size[7][8];
+    uint16_t palette_uv_size[7][8];
+    uint16_t palette_y_mode[7][3][3];
+    uint16_t palette_uv_mode[2][3];
+    // by the palette size - 2 and the color context
+    uint16_t palette_y_color[7][5][9];
+    uint16_t palette_uv_color[7][5][9];
+    uint16_t cfl_sign[9];
+    uint16_t cfl_alpha[6][17];
+    uint16_t use_wiener[3];
+    uint16_t use_sgrproj[3];
+    uint16_t restoration_type[4];
+    uint16_t intra_tx_set1[2][13][8];
+    uint16_t intra_tx_set2[3][13][6];
+};
+
+/* the coefficient cdfs, the defaults come in four sets by base_q_idx */
+struct av1_coef_cdf {
+    uint16_t txb_skip[5][13][3];
+    uint16_t eob_pt_16[2][2][6];
+    uint16_t eob_pt_32[2][2][7];
+    uint16_t eob_pt_64[2][2][8];
+    uint16_t eob_pt_128[2][2][9];
+    uint16_t eob_pt_256[2][2][10];
+    uint16_t eob_pt_512[2][11];
+    uint16_t eob_pt_1024[2][12];
+    uint16_t eob_extra[5][2][9][3];
+    uint16_t dc_sign[2][3][3];
+    uint16_t coeff_base_eob[5][2][4][4];
+    uint16_t coeff_base[5][2][42][5];
+    uint16_t coeff_br[5][2][21][5];
+};
+
+extern const struct av1_cdf av1_default_cdf;
+extern const struct av1_coef_cdf av1_default_coef_cdf[4];
+
+/* see 8.3.2 init_coeff_cdfs(), the set for base_q_idx */
+static inline int
+av1_coef_cdf_idx(int base_q_idx)
+{
+    if (base_q_idx <= 20) {
+        return 0;
+    } else if (base_q_idx <= 60) {
+        return 1;
+    } else if (base_q_idx <= 120) {
+        return 2;
+    }
+    return 3;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*_AV1CDF_H_*/
@@ -0,0 +1,1086 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "av1dsp.h"
+#include "utils.h"
+#ifdef __SSE4_1__
+#include "x86/x86.h"
+#endif
+
+/* see 7.13.2.3, cos128(angle) * 4096 for angles 0..64 in units of pi/128 */
+static const int16_t Cos128_Lookup[65] = {
+    4096, 4095, 4091, 4085, 4076, 4065, 4052, 4036, 4017, 3996, 3973,
+    3948, 3920, 3889, 3857, 3822, 3784, 3745, 3703, 3659, 3612, 3564,
+    3513, 3461, 3406, 3349, 3290, 3229, 3166, 3102, 3035, 2967, 2896,
+    2824, 2751, 2675, 2598, 2520, 2440, 2359, 2276, 2191, 2106, 2019,
+    1931, 1842, 1751, 1660, 1567, 1474, 1380, 1285, 1189, 1092, 995,
+    897, 799, 700, 601, 501, 401, 301, 201, 101, 0,
+};
+
+const uint8_t av1_sm_weights[7][64] = {
+    [2] = { 255, 149, 85, 64 },
+    [3] = { 255, 197, 146, 105, 73, 50, 37, 32 },
+    [4] = { 255, 225, 196, 170, 145, 123, 102, 84, 68, 54, 43, 33, 26, 20,
+            17, 16 },
+    [5] = { 255, 240, 225, 210, 196, 182, 169, 157, 145, 133, 122, 111, 101,
+            92, 83, 74, 66, 59, 52, 45, 39, 34, 29, 25, 21, 17, 14, 12, 10,
+            9, 8, 8 },
+    [6] = { 255, 248, 240, 233, 225, 218, 210, 203, 196, 189, 182, 176, 169,
+            163, 156, 150, 144, 138, 133, 127, 121, 116, 111, 106, 101, 96,
+            91, 86, 82, 77, 73, 69, 65, 61, 57, 54, 50, 47, 44, 41, 38, 35,
+            32, 29, 27, 25, 22, 20, 18, 16, 15, 13, 12, 10, 9, 8, 7, 6, 6,
+            5, 5, 4, 4, 4 },
+};
+
+const int16_t av1_dr_intra_derivative[90] = {
+    [3] = 1023, [6] = 547, [9] = 372, [14] = 273, [17] = 215, [20] = 178,
+    [23] = 151, [26] = 132, [29] = 116, [32] = 102, [36] = 90, [39] = 80,
+    [42] = 71, [45] = 64, [48] = 57, [51] = 51, [54] = 45, [58] = 40,
+    [61] = 35, [64] = 31, [67] = 27, [70] = 23, [73] = 19, [76] = 15,
+    [81] = 11, [84] = 7, [87] = 3,
+};
+
+static inline int
+cos128(int angle)
+{
+    int a = angle & 255;
+    if (a <= 64) {
+        return Cos128_Lookup[a];
+    } else if (a <= 128) {
+        return -Cos128_Lookup[128 - a];
+    } else if (a <= 192) {
+        return -Cos128_Lookup[a - 128];
+    }
+    return Cos128_Lookup[256 - a];
+}
+
+static inline int
+sin128(int angle)
+{
+    return cos128(angle - 64);
+}
+
+static inline int
+brev(int n, int x)
+{
+    int r = 0;
+    for (int i = 0; i < n; i++) {
+        r = (r << 1) | ((x >> i) & 1);
+    }
+    return r;
+}
+
+static void
+prog_rot(struct av1_itx_prog *p, int a, int b, int c0, int c1, int c2, int c3)
+{
+    struct av1_btf *op = &p->ops[p->nops++];
+    op->a = a;
+    op->b = b;
+    op->add = 0;
+    op->c[0] = c0;
+    op->c[1] = c1;
+    op->c[2] = c2;
+    op->c[3] = c3;
+}
+
+static void
+prog_add(struct av1_itx_prog *p, int a, int b)
+{
+    struct av1_btf *op = &p->ops[p->nops++];
+    op->a = a;
+    op->b = b;
+    op->add = 1;
+}
+
+/* the odd half of a DCT of 1 << n samples, on T[p..p + N / 2 - 1]. It
+ * starts with rotations by the odd angles and then alternates butterflies
+ * of growing group sizes with rotations of the middle pairs, like the
+ * stages of 7.13.2.3 do.
+ */
+static void
+idct_odd(struct av1_itx_prog *p, int n, int base)
+{
+    int N = 1 << n, M = N >> 1;
+    for (int i = 0; i < M / 2; i++) {
+        int t = 64 - (64 / N) * (2 * brev(n - 1, i) + 1);
+        prog_rot(p, base + i, base + M - 1 - i, cos128(t), -sin128(t),
+                 sin128(t), cos128(t));
+    }
+    for (int g = 2; g <= M / 2; g *= 2) {
+        for (int k = 0; k < M / g; k++) {
+            int s = base + k * g;
+            for (int j = 0; j < g / 2; j++) {
+                if (k % 2 == 0) {
+                    prog_add(p, s + j, s + g - 1 - j);
+                } else {
+                    prog_add(p, s + g - 1 - j, s + j);
+                }
+            }
+        }
+        for (int m = 0; m < M / 2; m++) {
+            int r = m % (2 * g);
+            int lo = base + m, hi = base + M - 1 - m;
+            if (r < g / 2 || r >= g / 2 + g) {
+                continue;
+            }
+            if (g == M / 2) {
+                prog_rot(p, lo, hi, -Cos128_Lookup[32], Cos128_Lookup[32],
+                         Cos128_Lookup[32], Cos128_Lookup[32]);
+            } else {
+                int npp = N / (2 * g), log2 = 0;
+                while ((2 << log2) < npp) {
+                    log2++;
+                }
+                int phi = (64 / npp) * (2 * brev(log2, m / (2 * g)) + 1);
+                int c = cos128(phi), s = sin128(phi);
+                if (r < g) {
+                    prog_rot(p, lo, hi, -c, s, s, c);
+                } else {
+                    prog_rot(p, lo, hi, -s, -c, -c, s);
+                }
+            }
+        }
+    }
+}
+
+static void
+idct_even(struct av1_itx_prog *p, int n)
+{
+    int N = 1 << n;
+    if (n == 1) {
+        prog_rot(p, 0, 1, Cos128_Lookup[32], Cos128_Lookup[32],
+                 Cos128_Lookup[32], -Cos128_Lookup[32]);
+        return;
+    }
+    idct_even(p, n - 1);
+    idct_odd(p, n, N / 2);
+    for (int k = 0; k < N / 2; k++) {
+        prog_add(p, k, N - 1 - k);
+    }
+}
+
+static void
+build_idct(struct av1_itx_prog *p, int n)
+{
+    p->n = 1 << n;
+    p->nops = 0;
+    for (int i = 0; i < p->n; i++) {
+        p->in[i] = brev(n, i);
+        p->out[i] = i;
+        p->neg[i] = 0;
+    }
+    idct_even(p, n);
+}
+
+/* see 7.13.2.7 and 7.13.2.8, the ADST8 and ADST16 after the input
+ * permutation, as libaom arranges their stages
+ */
+static void
+build_iadst(struct av1_itx_prog *p, int n)
+{
+    static const uint8_t in8[8] = { 7, 0, 5, 2, 3, 4, 1, 6 };
+    static const int8_t out8[8] = { 0, -4, 6, -2, 3, -7, 5, -1 };
+    static const uint8_t in16[16] = {
+        15, 0, 13, 2, 11, 4, 9, 6, 7, 8, 5, 10, 3, 12, 1, 14,
+    };
+    static const int8_t out16[16] = {
+        0, -8, 12, -4, 6, -14, 10, -2, 3, -11, 15, -7, 5, -13, 9, -1,
+    };
+    const int16_t *C = Cos128_Lookup;
+    p->n = 1 << n;
+    p->nops = 0;
+    for (int i = 0; i < p->n; i++) {
+        int o = n == 3 ? out8[i] : out16[i];
+        p->in[i] = n == 3 ? in8[i] : in16[i];
+        p->out[i] = abs(o);
+        // output 1 is the negated T[8] (T[4] for ADST8)
+        p->neg[i] = (o < 0 || i == 1);
+    }
+    p->out[1] = p->n / 2;
+    if (n == 3) {
+        static const int pq[4][2] = { { 4, 60 }, { 20, 44 }, { 36, 28 },
+                                      { 52, 12 } };
+        for (int i = 0; i < 4; i++) {
+            prog_rot(p, 2 * i, 2 * i + 1, C[pq[i][0]], C[pq[i][1]],
+                     C[pq[i][1]], -C[pq[i][0]]);
+        }
+        for (int i = 0; i < 4; i++) {
+            prog_add(p, i, i + 4);
+        }
+        prog_rot(p, 4, 5, C[16], C[48], C[48], -C[16]);
+        prog_rot(p, 6, 7, -C[48], C[16], C[16], C[48]);
+        static const int a2[4] = { 0, 1, 4, 5 };
+        for (int i = 0; i < 4; i++) {
+            prog_add(p, a2[i], a2[i] + 2);
+        }
+        prog_rot(p, 2, 3, C[32], C[32], C[32], -C[32]);
+        prog_rot(p, 6, 7, C[32], C[32], C[32], -C[32]);
+        return;
+    }
+    for (int i = 0; i < 8; i++) {
+        int q = 2 + 8 * i;
+        prog_rot(p, 2 * i, 2 * i + 1, C[q], C[64 - q], C[64 - q], -C[q]);
+    }
+    for (int i = 0; i < 8; i++) {
+        prog_add(p, i, i + 8);
+    }
+    prog_rot(p, 8, 9, C[8], C[56], C[56], -C[8]);
+    prog_rot(p, 10, 11, C[40], C[24], C[24], -C[40]);
+    prog_rot(p, 12, 13, -C[56], C[8], C[8], C[56]);
+    prog_rot(p, 14, 15, -C[24], C[40], C[40], C[24]);
+    static const int a4[8] = { 0, 1, 2, 3, 8, 9, 10, 11 };
+    for (int i = 0; i < 8; i++) {
+        prog_add(p, a4[i], a4[i] + 4);
+    }
+    for (int b = 4; b <= 12; b += 8) {
+        prog_rot(p, b, b + 1, C[16], C[48], C[48], -C[16]);
+        prog_rot(p, b + 2, b + 3, -C[48], C[16], C[16], C[48]);
+    }
+    static const int a2[8] = { 0, 1, 4, 5, 8, 9, 12, 13 };
+    for (int i = 0; i < 8; i++) {
+        prog_add(p, a2[i], a2[i] + 2);
+    }
+    for (int i = 2; i < 16; i += 4) {
+        prog_rot(p, i, i + 1, C[32], C[32], C[32], -C[32]);
+    }
+}
+
+static struct av1_itx_prog idct_progs[5];
+static struct av1_itx_prog iadst_progs[2];
+
+const struct av1_itx_prog *
+av1_idct_prog(int log2n)
+{
+    return &idct_progs[log2n - 2];
+}
+
+const struct av1_itx_prog *
+av1_iadst_prog(int log2n)
+{
+    return &iadst_progs[log2n - 3];
+}
+
+static inline int32_t
+clamp_range(int64_t x, int range)
+{
+    int32_t hi = (1 << (range - 1)) - 1;
+    if (x > hi) {
+        return hi;
+    } else if (x < -hi - 1) {
+        return -hi - 1;
+    }
+    return (int32_t)x;
+}
+
+void
+av1_itx_prog_c(int32_t *buf, int stride, int lanes,
+               const struct av1_itx_prog *p, int range)
+{
+    int32_t T[64];
+    for (int l = 0; l < lanes; l++) {
+        for (int i = 0; i < p->n; i++) {
+            T[i] = buf[p->in[i] * stride + l];
+        }
+        for (int k = 0; k < p->nops; k++) {
+            const struct av1_btf *op = &p->ops[k];
+            int64_t a = T[op->a], b = T[op->b];
+            if (op->add) {
+                T[op->a] = clamp_range(a + b, range);
+                T[op->b] = clamp_range(a - b, range);
+            } else {
+                T[op->a] = (int32_t)((op->c[0] * a + op->c[1] * b + 2048) >> 12);
+                T[op->b] = (int32_t)((op->c[2] * a + op->c[3] * b + 2048) >> 12);
+            }
+        }
+        for (int i = 0; i < p->n; i++) {
+            int32_t v = T[p->out[i]];
+            buf[i * stride + l] = p->neg[i] ? -v : v;
+        }
+    }
+}
+
+/* see 7.13.2.6, without clamping in between as the conformance range of
+ * the 4 point ADST leaves room for it
+ */
+void
+av1_itx_adst4_c(int32_t *buf, int stride, int lanes, int n UNUSED)
+{
+    static const int64_t sinpi[5] = { 0, 1321, 2482, 3344, 3803 };
+    for (int l = 0; l < lanes; l++) {
+        int64_t x0 = buf[l], x1 = buf[stride + l];
+        int64_t x2 = buf[2 * stride + l], x3 = buf[3 * stride + l];
+        int64_t s0 = sinpi[1] * x0, s1 = sinpi[2] * x0;
+        int64_t s2 = sinpi[3] * x1, s3 = sinpi[4] * x2;
+        int64_t s4 = sinpi[1] * x2, s5 = sinpi[2] * x3;
+        int64_t s6 = sinpi[4] * x3, s7 = (x0 - x2) + x3;
+        s0 = s0 + s3;
+        s1 = s1 - s4;
+        s3 = s2;
+        s2 = sinpi[3] * s7;
+        s0 = s0 + s5;
+        s1 = s1 - s6;
+        buf[l] = (int32_t)((s0 + s3 + 2048) >> 12);
+        buf[stride + l] = (int32_t)((s1 + s3 + 2048) >> 12);
+        buf[2 * stride + l] = (int32_t)((s2 + 2048) >> 12);
+        buf[3 * stride + l] = (int32_t)((s0 + s1 - s3 + 2048) >> 12);
+    }
+}
+
+/* see 7.13.2.15 */
+void
+av1_itx_identity_c(int32_t *buf, int stride, int lanes, int n)
+{
+    for (int i = 0; i < n; i++) {
+        int32_t *b = buf + i * stride;
+        for (int l = 0; l < lanes; l++) {
+            if (n == 4) {
+                b[l] = (int32_t)(((int64_t)b[l] * 5793 + 2048) >> 12);
+            } else if (n == 8) {
+                b[l] = b[l] * 2;
+            } else if (n == 16) {
+                b[l] = (int32_t)(((int64_t)b[l] * 11586 + 2048) >> 12);
+            } else {
+                b[l] = b[l] * 4;
+            }
+        }
+    }
+}
+
+/* see 7.13.2.10, the Walsh-Hadamard transform of lossless blocks */
+static void
+iwht4(int32_t *T, int step, int shift)
+{
+    int32_t a = T[0] >> shift, c = T[step] >> shift;
+    int32_t d = T[2 * step] >> shift, b = T[3 * step] >> shift;
+    a += c;
+    d -= b;
+    int32_t e = (a - d) >> 1;
+    b = e - b;
+    c = e - c;
+    a -= b;
+    d += c;
+    T[0] = a;
+    T[step] = b;
+    T[2 * step] = c;
+    T[3 * step] = d;
+}
+
+static inline uint16_t
+clip_pixel(int v, int bitdepth)
+{
+    int max = (1 << bitdepth) - 1;
+    return v < 0 ? 0 : (v > max ? max : v);
+}
+
+static void
+inv_wht_add(uint16_t *dst, int stride, int32_t *coef, int bitdepth)
+{
+    int32_t R[16];
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            R[i * 4 + j] = coef[j * 64 + i];
+            coef[j * 64 + i] = 0;
+        }
+        iwht4(R + i * 4, 1, 2);
+    }
+    for (int j = 0; j < 4; j++) {
+        iwht4(R + j, 4, 0);
+    }
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            dst[i * stride + j] = clip_pixel(dst[i * stride + j] + R[i * 4 + j],
+                                             bitdepth);
+        }
+    }
+}
+
+/* Transform_Row_Shift of 7.13.3 by log2 of width and height - 2 */
+static const int8_t row_shift[5][5] = {
+    { 0, 0, 1, -1, -1 },
+    { 0, 1, 1, 2, -1 },
+    { 1, 1, 2, 1, 2 },
+    { -1, 2, 1, 2, 1 },
+    { -1, -1, 2, 1, 2 },
+};
+
+enum { TX_1D_DCT, TX_1D_ADST, TX_1D_FLIPADST, TX_1D_IDTX };
+
+// the vertical and the horizontal 1D type of each av1_tx_type
+static const uint8_t tx_1d_types[16][2] = {
+    { TX_1D_DCT, TX_1D_DCT },           { TX_1D_ADST, TX_1D_DCT },
+    { TX_1D_DCT, TX_1D_ADST },          { TX_1D_ADST, TX_1D_ADST },
+    { TX_1D_FLIPADST, TX_1D_DCT },      { TX_1D_DCT, TX_1D_FLIPADST },
+    { TX_1D_FLIPADST, TX_1D_FLIPADST }, { TX_1D_ADST, TX_1D_FLIPADST },
+    { TX_1D_FLIPADST, TX_1D_ADST },     { TX_1D_IDTX, TX_1D_IDTX },
+    { TX_1D_DCT, TX_1D_IDTX },          { TX_1D_IDTX, TX_1D_DCT },
+    { TX_1D_ADST, TX_1D_IDTX },         { TX_1D_IDTX, TX_1D_ADST },
+    { TX_1D_FLIPADST, TX_1D_IDTX },     { TX_1D_IDTX, TX_1D_FLIPADST },
+};
+
+static void
+itx_1d(const struct av1_dsp *dsp, int32_t *buf, int lanes, int log2n,
+       int type, int range)
+{
+    if (type == TX_1D_DCT) {
+        dsp->itx_prog(buf, 64, lanes, av1_idct_prog(log2n), range);
+    } else if (type == TX_1D_IDTX) {
+        dsp->itx_identity(buf, 64, lanes, 1 << log2n);
+    } else if (log2n == 2) {
+        dsp->itx_adst4(buf, 64, lanes, 4);
+    } else {
+        dsp->itx_prog(buf, 64, lanes, av1_iadst_prog(log2n), range);
+    }
+}
+
+void
+av1_inv_txfm_add(uint16_t *dst, int stride, int32_t *coef, int log2w,
+                 int log2h, int tx_type, int lossless, int rows,
+                 int bitdepth)
+{
+    if (lossless) {
+        inv_wht_add(dst, stride, coef, bitdepth);
+        return;
+    }
+    const struct av1_dsp *dsp = av1_dsp_get();
+    int w = 1 << log2w, h = 1 << log2h;
+    int nzw = w > 32 ? 32 : w, nzh = h > 32 ? 32 : h;
+    int col_type = tx_1d_types[tx_type][0], row_type = tx_1d_types[tx_type][1];
+    int row_range = bitdepth + 8;
+    int col_range = bitdepth + 6 > 16 ? bitdepth + 6 : 16;
+    int shift = row_shift[log2w - 2][log2h - 2];
+    int lanes = (rows > nzh ? nzh : rows + 3) & ~3;
+    if (lanes < 4) {
+        lanes = 4;
+    }
+    int32_t tmp[64 * 64] __attribute__((aligned(32)));
+
+    // rows, vector l of coef is row l, the first nzw samples may be non-zero
+    for (int j = 0; j < nzw; j++) {
+        int32_t *c = coef + j * 64;
+        for (int l = 0; l < lanes; l++) {
+            int64_t v = c[l];
+            if (log2w - log2h == 1 || log2h - log2w == 1) {
+                v = (v * 2896 + 2048) >> 12;
+            }
+            c[l] = clamp_range(v, row_range);
+        }
+    }
+    itx_1d(dsp, coef, lanes, log2w, row_type, row_range);
+
+    // to columns, with the row shift and the left-right flip
+    for (int i = 0; i < h; i++) {
+        int32_t *t = tmp + i * 64;
+        if (i >= lanes) {
+            memset(t, 0, sizeof(int32_t) * w);
+            continue;
+        }
+        for (int j = 0; j < w; j++) {
+            int jj = row_type == TX_1D_FLIPADST ? w - 1 - j : j;
+            int32_t v = coef[jj * 64 + i];
+            if (shift > 0) {
+                v = (v + (1 << (shift - 1))) >> shift;
+            }
+            t[j] = clamp_range(v, col_range);
+        }
+    }
+    for (int j = 0; j < w; j++) {
+        memset(coef + j * 64, 0, sizeof(int32_t) * lanes);
+    }
+    itx_1d(dsp, tmp, w < 4 ? 4 : w, log2h, col_type, col_range);
+
+    for (int i = 0; i < h; i++) {
+        int ii = col_type == TX_1D_FLIPADST ? h - 1 - i : i;
+        const int32_t *t = tmp + ii * 64;
+        uint16_t *d = dst + i * stride;
+        for (int j = 0; j < w; j++) {
+            d[j] = clip_pixel(d[j] + ((t[j] + 8) >> 4), bitdepth);
+        }
+    }
+}
+
+void
+av1_intra_dc_c(uint16_t *dst, int stride, const uint16_t *above,
+               const uint16_t *left, int w, int h, int have_above,
+               int have_left, int bitdepth)
+{
+    int sum = 0, avg;
+    if (have_above && have_left) {
+        for (int k = 0; k < w; k++) {
+            sum += above[k];
+        }
+        for (int k = 0; k < h; k++) {
+            sum += left[k];
+        }
+        avg = (sum + ((w + h) >> 1)) / (w + h);
+    } else if (have_left) {
+        for (int k = 0; k < h; k++) {
+            sum += left[k];
+        }
+        avg = (sum + (h >> 1)) >> __builtin_ctz(h);
+    } else if (have_above) {
+        for (int k = 0; k < w; k++) {
+            sum += above[k];
+        }
+        avg = (sum + (w >> 1)) >> __builtin_ctz(w);
+    } else {
+        avg = 1 << (bitdepth - 1);
+    }
+    for (int i = 0; i < h; i++) {
+        for (int j = 0; j < w; j++) {
+            dst[i * stride + j] = avg;
+        }
+    }
+}
+
+void
+av1_intra_v_c(uint16_t *dst, int stride, const uint16_t *above,
+              const uint16_t *left UNUSED, int w, int h)
+{
+    for (int i = 0; i < h; i++) {
+        memcpy(dst + i * stride, above, w * sizeof(uint16_t));
+    }
+}
+
+void
+av1_intra_h_c(uint16_t *dst, int stride, const uint16_t *above UNUSED,
+              const uint16_t *left, int w, int h)
+{
+    for (int i = 0; i < h; i++) {
+        for (int j = 0; j < w; j++) {
+            dst[i * stride + j] = left[i];
+        }
+    }
+}
+
+/* see 7.11.2.2 */
+void
+av1_intra_paeth_c(uint16_t *dst, int stride, const uint16_t *above,
+                  const uint16_t *left, int w, int h)
+{
+    int tl = above[-1];
+    for (int i = 0; i < h; i++) {
+        for (int j = 0; j < w; j++) {
+            int base = above[j] + left[i] - tl;
+            int pl = abs(base - left[i]);
+            int pt = abs(base - above[j]);
+            int ptl = abs(base - tl);
+            if (pl <= pt && pl <= ptl) {
+                dst[i * stride + j] = left[i];
+            } else if (pt <= ptl) {
+                dst[i * stride + j] = above[j];
+            } else {
+                dst[i * stride + j] = tl;
+            }
+        }
+    }
+}
+
+/* see 7.11.2.6 */
+void
+av1_intra_smooth_c(uint16_t *dst, int stride, const uint16_t *above,
+                   const uint16_t *left, int w, int h)
+{
+    const uint8_t *wx = av1_sm_weights[__builtin_ctz(w)];
+    const uint8_t *wy = av1_sm_weights[__builtin_ctz(h)];
+    for (int i = 0; i < h; i++) {
+        for (int j = 0; j < w; j++) {
+            int p = wy[i] * above[j] + (256 - wy[i]) * left[h - 1] +
+                    wx[j] * left[i] + (256 - wx[j]) * above[w - 1];
+            dst[i * stride + j] = (p + 256) >> 9;
+        }
+    }
+}
+
+void
+av1_intra_smooth_v_c(uint16_t *dst, int stride, const uint16_t *above,
+                     const uint16_t *left, int w, int h)
+{
+    const uint8_t *wy = av1_sm_weights[__builtin_ctz(h)];
+    for (int i = 0; i < h; i++) {
+        for (int j = 0; j < w; j++) {
+            int p = wy[i] * above[j] + (256 - wy[i]) * left[h - 1];
+            dst[i * stride + j] = (p + 128) >> 8;
+        }
+    }
+}
+
+void
+av1_intra_smooth_h_c(uint16_t *dst, int stride, const uint16_t *above,
+                     const uint16_t *left, int w, int h)
+{
+    const uint8_t *wx = av1_sm_weights[__builtin_ctz(w)];
+    for (int i = 0; i < h; i++) {
+        for (int j = 0; j < w; j++) {
+            int p = wx[j] * left[i] + (256 - wx[j]) * above[w - 1];
+            dst[i * stride + j] = (p + 128) >> 8;
+        }
+    }
+}
+
+/* see 7.11.2.4 step 4, with the samples past the end of the edges taken
+ * as the last one like libaom does
+ */
+void
+av1_intra_z_c(uint16_t *dst, int stride, const uint16_t *above,
+              const uint16_t *left, int w, int h, int angle,
+              int upsample_above, int upsample_left)
+{
+    const int16_t *dr = av1_dr_intra_derivative;
+    if (angle < 90) {
+        int dx = dr[angle];
+        int max_base = (w + h - 1) << upsample_above;
+        for (int i = 0; i < h; i++) {
+            int idx = (i + 1) * dx;
+            int base = idx >> (6 - upsample_above);
+            int shift = ((idx << upsample_above) >> 1) & 0x1F;
+            for (int j = 0; j < w; j++, base += 1 << upsample_above) {
+                if (base < max_base) {
+                    dst[i * stride + j] = (above[base] * (32 - shift) +
+                                           above[base + 1] * shift + 16) >> 5;
+                } else {
+                    dst[i * stride + j] = above[max_base];
+                }
+            }
+        }
+    } else if (angle < 180) {
+        int dx = dr[180 - angle], dy = dr[angle - 90];
+        for (int i = 0; i < h; i++) {
+            for (int j = 0; j < w; j++) {
+                int idx = (j << 6) - (i + 1) * dx;
+                int base = idx >> (6 - upsample_above);
+                if (base >= -(1 << upsample_above)) {
+                    int shift = ((idx * (1 << upsample_above)) >> 1) & 0x1F;
+                    dst[i * stride + j] = (above[base] * (32 - shift) +
+                                           above[base + 1] * shift + 16) >> 5;
+                } else {
+                    idx = (i << 6) - (j + 1) * dy;
+                    base = idx >> (6 - upsample_left);
+                    int shift = ((idx * (1 << upsample_left)) >> 1) & 0x1F;
+                    dst[i * stride + j] = (left[base] * (32 - shift) +
+                                           left[base + 1] * shift + 16) >> 5;
+                }
+            }
+        }
+    } else {
+        int dy = dr[270 - angle];
+        int max_base = (w + h - 1) << upsample_left;
+        for (int j = 0; j < w; j++) {
+            int idx = (j + 1) * dy;
+            int base = idx >> (6 - upsample_left);
+            int shift = ((idx << upsample_left) >> 1) & 0x1F;
+            for (int i = 0; i < h; i++, base += 1 << upsample_left) {
+                if (base < max_base) {
+                    dst[i * stride + j] = (left[base] * (32 - shift) +
+                                           left[base + 1] * shift + 16) >> 5;
+                } else {
+                    dst[i * stride + j] = left[max_base];
+                }
+            }
+        }
+    }
+}
+
+void
+av1_cfl_pred_c(uint16_t *dst, int stride, const int16_t *ac, int w, int h,
+               int alpha, int bitdepth)
+{
+    for (int i = 0; i < h; i++) {
+        for (int j = 0; j < w; j++) {
+            int v = alpha * ac[i * w + j];
+            int s = v < 0 ? -((-v + 32) >> 6) : (v + 32) >> 6;
+            dst[i * stride + j] = clip_pixel(dst[i * stride + j] + s, bitdepth);
+        }
+    }
+}
+
+static inline int
+filter4_clamp(int x, int bitdepth)
+{
+    int lo = -(1 << (bitdepth - 1)), hi = (1 << (bitdepth - 1)) - 1;
+    return x < lo ? lo : (x > hi ? hi : x);
+}
+
+/* see 7.14.6.3 */
+static void
+lf_narrow(uint16_t *p, int step, int hev, int bitdepth)
+{
+    int off = 0x80 << (bitdepth - 8);
+    int ps1 = p[-2 * step] - off, ps0 = p[-step] - off;
+    int qs0 = p[0] - off, qs1 = p[step] - off;
+    int filter = hev ? filter4_clamp(ps1 - qs1, bitdepth) : 0;
+    filter = filter4_clamp(filter + 3 * (qs0 - ps0), bitdepth);
+    int filter1 = filter4_clamp(filter + 4, bitdepth) >> 3;
+    int filter2 = filter4_clamp(filter + 3, bitdepth) >> 3;
+    p[0] = filter4_clamp(qs0 - filter1, bitdepth) + off;
+    p[-step] = filter4_clamp(ps0 + filter2, bitdepth) + off;
+    if (!hev) {
+        filter = (filter1 + 1) >> 1;
+        p[step] = filter4_clamp(qs1 - filter, bitdepth) + off;
+        p[-2 * step] = filter4_clamp(ps1 + filter, bitdepth) + off;
+    }
+}
+
+/* see 7.14.6.4, n taps each side with a weight of 2 for the n2 nearest */
+static void
+lf_wide(uint16_t *p, int step, int log2size, int n, int n2)
+{
+    int F[14];
+    for (int k = -n - 1; k <= n; k++) {
+        F[k + 7] = p[k * step];
+    }
+    for (int i = -n; i < n; i++) {
+        int t = 0;
+        for (int j = -n; j <= n; j++) {
+            int k = i + j;
+            k = k < -(n + 1) ? -(n + 1) : (k > n ? n : k);
+            t += F[k + 7] * (abs(j) <= n2 ? 2 : 1);
+        }
+        p[i * step] = (t + (1 << (log2size - 1))) >> log2size;
+    }
+}
+
+/* see 7.14.6.2, size is filterLen here, 6 for the chroma 8 sample one */
+void
+av1_lf_edge_c(uint16_t *pix, int step, int pitch, int n, int size, int limit,
+              int blimit, int thresh, int bitdepth)
+{
+    int one = 1 << (bitdepth - 8);
+    for (int k = 0; k < n; k++) {
+        uint16_t *p = pix + k * pitch;
+        int q0 = p[0], q1 = p[step], p0 = p[-step], p1 = p[-2 * step];
+        int hev = abs(p1 - p0) > thresh || abs(q1 - q0) > thresh;
+        int mask = abs(p1 - p0) > limit || abs(q1 - q0) > limit ||
+                   abs(p0 - q0) * 2 + abs(p1 - q1) / 2 > blimit;
+        int flat = 0, flat2 = 0;
+        if (size >= 6) {
+            int q2 = p[2 * step], p2 = p[-3 * step];
+            mask |= abs(p2 - p1) > limit || abs(q2 - q1) > limit;
+            flat = abs(p1 - p0) <= one && abs(q1 - q0) <= one &&
+                   abs(p2 - p0) <= one && abs(q2 - q0) <= one;
+            if (size >= 8) {
+                int q3 = p[3 * step], p3 = p[-4 * step];
+                mask |= abs(p3 - p2) > limit || abs(q3 - q2) > limit;
+                flat = flat && abs(p3 - p0) <= one && abs(q3 - q0) <= one;
+            }
+        }
+        if (mask) {
+            continue;
+        }
+        if (size == 16) {
+            flat2 = 1;
+            for (int i = 4; i <= 6; i++) {
+                flat2 = flat2 && abs(p[-(i + 1) * step] - p0) <= one &&
+                        abs(p[i * step] - q0) <= one;
+            }
+        }
+        if (size == 4 || !flat) {
+            lf_narrow(p, step, hev, bitdepth);
+        } else if (size == 6) {
+            lf_wide(p, step, 3, 2, 1);
+        } else if (size == 8 || !flat2) {
+            lf_wide(p, step, 3, 3, 0);
+        } else {
+            lf_wide(p, step, 4, 6, 1);
+        }
+    }
+}
+
+static const int Div_Table[9] = { 0, 840, 420, 280, 210, 168, 140, 120, 105 };
+
+/* see 7.15.2 */
+int
+av1_cdef_dir_c(const uint16_t *src, int stride, int *var, int bitdepth)
+{
+    int cost[8] = { 0 }, partial[8][15] = { { 0 } };
+    int best_cost = 0, dir = 0;
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) {
+            int x = (src[i * stride + j] >> (bitdepth - 8)) - 128;
+            partial[0][i + j] += x;
+            partial[1][i + j / 2] += x;
+            partial[2][i] += x;
+            partial[3][3 + i - j / 2] += x;
+            partial[4][7 + i - j] += x;
+            partial[5][3 - i / 2 + j] += x;
+            partial[6][j] += x;
+            partial[7][i / 2 + j] += x;
+        }
+    }
+    for (int i = 0; i < 8; i++) {
+        cost[2] += partial[2][i] * partial[2][i];
+        cost[6] += partial[6][i] * partial[6][i];
+    }
+    cost[2] *= Div_Table[8];
+    cost[6] *= Div_Table[8];
+    for (int i = 0; i < 7; i++) {
+        cost[0] += (partial[0][i] * partial[0][i] +
+                    partial[0][14 - i] * partial[0][14 - i]) * Div_Table[i + 1];
+        cost[4] += (partial[4][i] * partial[4][i] +
+                    partial[4][14 - i] * partial[4][14 - i]) * Div_Table[i + 1];
+    }
+    cost[0] += partial[0][7] * partial[0][7] * Div_Table[8];
+    cost[4] += partial[4][7] * partial[4][7] * Div_Table[8];
+    for (int i = 1; i < 8; i += 2) {
+        for (int j = 0; j < 5; j++) {
+            cost[i] += partial[i][3 + j] * partial[i][3 + j];
+        }
+        cost[i] *= Div_Table[8];
+        for (int j = 0; j < 3; j++) {
+            cost[i] += (partial[i][j] * partial[i][j] +
+                        partial[i][10 - j] * partial[i][10 - j]) *
+                       Div_Table[2 * j + 2];
+        }
+    }
+    for (int i = 0; i < 8; i++) {
+        if (cost[i] > best_cost) {
+            best_cost = cost[i];
+            dir = i;
+        }
+    }
+    *var = (best_cost - cost[(dir + 4) & 7]) >> 10;
+    return dir;
+}
+
+static const int8_t Cdef_Directions[8][2][2] = {
+    { { -1, 1 }, { -2, 2 } }, { { 0, 1 }, { -1, 2 } },
+    { { 0, 1 }, { 0, 2 } },   { { 0, 1 }, { 1, 2 } },
+    { { 1, 1 }, { 2, 2 } },   { { 1, 0 }, { 2, 1 } },
+    { { 1, 0 }, { 2, 0 } },   { { 1, 0 }, { 2, -1 } },
+};
+
+static inline int
+constrain(int diff, int threshold, int damping)
+{
+    if (!threshold) {
+        return 0;
+    }
+    int adj = damping - (31 - __builtin_clz(threshold));
+    int ad = abs(diff);
+    int v = threshold - (ad >> (adj < 0 ? 0 : adj));
+    v = v < 0 ? 0 : v;
+    v = ad < v ? ad : v;
+    return diff < 0 ? -v : v;
+}
+
+void
+av1_cdef_filter_c(uint16_t *dst, int dstride, const int16_t *src,
+                  int sstride, int w, int h, int pri, int sec, int damping,
+                  int dir, int bitdepth)
+{
+    static const int pri_taps[2][2] = { { 4, 2 }, { 3, 3 } };
+    static const int sec_taps[2] = { 2, 1 };
+    const int *pt = pri_taps[(pri >> (bitdepth - 8)) & 1];
+    for (int i = 0; i < h; i++) {
+        for (int j = 0; j < w; j++) {
+            const int16_t *s = src + i * sstride + j;
+            int x = s[0], sum = 0, max = x, min = x;
+            for (int k = 0; k < 2; k++) {
+                for (int sign = -1; sign <= 1; sign += 2) {
+                    int p = s[sign * (Cdef_Directions[dir][k][0] * sstride +
+                                      Cdef_Directions[dir][k][1])];
+                    if (p != AV1_CDEF_VERY_LARGE) {
+                        sum += pt[k] * constrain(p - x, pri, damping);
+                        max = p > max ? p : max;
+                        min = p < min ? p : min;
+                    }
+                    for (int off = -2; off <= 2; off += 4) {
+                        const int8_t *d = Cdef_Directions[(dir + off) & 7][k];
+                        int q = s[sign * (d[0] * sstride + d[1])];
+                        if (q != AV1_CDEF_VERY_LARGE) {
+                            sum += sec_taps[k] * constrain(q - x, sec, damping);
+                            max = q > max ? q : max;
+                            min = q < min ? q : min;
+                        }
+                    }
+                }
+            }
+            int y = x + ((8 + sum - (sum < 0)) >> 4);
+            dst[i * dstride + j] = y < min ? min : (y > max ? max : y);
+        }
+    }
+}
+
+/* see 7.17.4, InterRound0 and InterRound1 of a non compound prediction */
+void
+av1_wiener_c(uint16_t *dst, int dstride, const uint16_t *src, int sstride,
+             int w, int h, const int16_t filter[2][7], int bitdepth)
+{
+    int r0 = bitdepth == 12 ? 5 : 3, r1 = bitdepth == 12 ? 9 : 11;
+    int offset = 1 << (bitdepth + 7 - r0 - 1);
+    int limit = (1 << (bitdepth + 1 + 7 - r0)) - 1;
+    int32_t mid[70 * 64];
+    for (int r = 0; r < h + 6; r++) {
+        const uint16_t *s = src + (r - 3) * sstride - 3;
+        for (int c = 0; c < w; c++) {
+            int v = 0;
+            for (int t = 0; t < 7; t++) {
+                v += filter[0][t] * s[c + t];
+            }
+            v = (v + (1 << (r0 - 1))) >> r0;
+            mid[r * 64 + c] = v < -offset ? -offset :
+                              (v > limit - offset ? limit - offset : v);
+        }
+    }
+    for (int r = 0; r < h; r++) {
+        for (int c = 0; c < w; c++) {
+            int v = 0;
+            for (int t = 0; t < 7; t++) {
+                v += filter[1][t] * mid[(r + t) * 64 + c];
+            }
+            dst[r * dstride + c] = clip_pixel((v + (1 << (r1 - 1))) >> r1,
+                                              bitdepth);
+        }
+    }
+}
+
+/* see 7.17.3, one pass of the box filter. The A and B of radius 2 are only
+ * taken on every other row.
+ */
+static void
+sgr_box(int32_t *F, const uint16_t *src, int sstride, int w, int h, int r,
+        int s, int pass, int bitdepth)
+{
+    // A and B for rows and columns -1..h and -1..w
+    int32_t A[66 * 66], B[66 * 66];
+    int n = (2 * r + 1) * (2 * r + 1);
+    int one_over_n = ((1 << 12) + n / 2) / n;
+    for (int i = -1; i < h + 1; i++) {
+        if (pass == 0 && !(i & 1)) {
+            continue;
+        }
+        for (int j = -1; j < w + 1; j++) {
+            uint32_t a = 0, b = 0;
+            for (int dy = -r; dy <= r; dy++) {
+                const uint16_t *p = src + (i + dy) * sstride + j;
+                for (int dx = -r; dx <= r; dx++) {
+                    a += p[dx] * p[dx];
+                    b += p[dx];
+                }
+            }
+            if (bitdepth > 8) {
+                a = (a + (1 << (2 * (bitdepth - 8) - 1))) >> (2 * (bitdepth - 8));
+            }
+            uint32_t d = bitdepth > 8 ?
+                         (b + (1 << (bitdepth - 9))) >> (bitdepth - 8) : b;
+            uint32_t p = a * n < d * d ? 0 : a * n - d * d;
+            uint32_t z = (uint32_t)(((uint64_t)p * s + (1 << 19)) >> 20);
+            int a2;
+            if (z >= 255) {
+                a2 = 256;
+            } else if (z == 0) {
+                a2 = 1;
+            } else {
+                a2 = ((z << 8) + (z / 2)) / (z + 1);
+            }
+            uint32_t b2 = (uint32_t)(256 - a2) * b * one_over_n;
+            A[(i + 1) * 66 + j + 1] = a2;
+            B[(i + 1) * 66 + j + 1] = (b2 + (1 << 11)) >> 12;
+        }
+    }
+    for (int i = 0; i < h; i++) {
+        int shift = (pass == 0 && (i & 1)) ? 4 : 5;
+        for (int j = 0; j < w; j++) {
+            int32_t a = 0, b = 0;
+            for (int dy = -1; dy <= 1; dy++) {
+                for (int dx = -1; dx <= 1; dx++) {
+                    int weight;
+                    if (pass == 0) {
+                        weight = ((i + dy) & 1) ? (dx == 0 ? 6 : 5) : 0;
+                    } else {
+                        weight = (dx == 0 || dy == 0) ? 4 : 3;
+                    }
+                    if (weight) {
+                        int k = (i + dy + 1) * 66 + j + dx + 1;
+                        a += weight * A[k];
+                        b += weight * B[k];
+                    }
+                }
+            }
+            int32_t v = a * src[i * sstride + j] + b;
+            F[i * 64 + j] = (v + (1 << (8 + shift - 4 - 1))) >> (8 + shift - 4);
+        }
+    }
+}
+
+void
+av1_sgr_c(uint16_t *dst, int dstride, const uint16_t *src, int sstride,
+          int w, int h, const int r[2], const int s[2], const int xqd[2],
+          int bitdepth)
+{
+    int32_t *flt[2] = { NULL, NULL };
+    for (int pass = 0; pass < 2; pass++) {
+        if (r[pass]) {
+            flt[pass] = malloc(sizeof(int32_t) * 64 * 64);
+            sgr_box(flt[pass], src, sstride, w, h, r[pass], s[pass], pass,
+                    bitdepth);
+        }
+    }
+    int w0 = xqd[0], w1 = xqd[1], w2 = (1 << 7) - w0 - w1;
+    for (int i = 0; i < h; i++) {
+        for (int j = 0; j < w; j++) {
+            int32_t u = src[i * sstride + j] << 4;
+            int32_t v = w1 * u;
+            v += w0 * (flt[0] ? flt[0][i * 64 + j] : u);
+            v += w2 * (flt[1] ? flt[1][i * 64 + j] : u);
+            dst[i * dstride + j] = clip_pixel((v + (1 << 10)) >> 11, bitdepth);
+        }
+    }
+    free(flt[0]);
+    free(flt[1]);
+}
+
+static struct av1_dsp av1dsp;
+static int av1dsp_inited = 0;
+
+void
+av1_dsp_init_c(struct av1_dsp *dsp)
+{
+    dsp->itx_prog = av1_itx_prog_c;
+    dsp->itx_adst4 = av1_itx_adst4_c;
+    dsp->itx_identity = av1_itx_identity_c;
+    dsp->intra_dc = av1_intra_dc_c;
+    dsp->intra_v = av1_intra_v_c;
+    dsp->intra_h = av1_intra_h_c;
+    dsp->intra_paeth = av1_intra_paeth_c;
+    dsp->intra_smooth = av1_intra_smooth_c;
+    dsp->intra_smooth_v = av1_intra_smooth_v_c;
+    dsp->intra_smooth_h = av1_intra_smooth_h_c;
+    dsp->intra_z = av1_intra_z_c;
+    dsp->cfl_pred = av1_cfl_pred_c;
+    dsp->lf_edge = av1_lf_edge_c;
+    dsp->cdef_dir = av1_cdef_dir_c;
+    dsp->cdef_filter = av1_cdef_filter_c;
+    dsp->wiener = av1_wiener_c;
+    dsp->sgr = av1_sgr_c;
+}
+
+void
+av1_dsp_init(void)
+{
+    if (av1dsp_inited) {
+        return;
+    }
+    for (int n = 2; n <= 6; n++) {
+        build_idct(&idct_progs[n - 2], n);
+    }
+    build_iadst(&iadst_progs[0], 3);
+    build_iadst(&iadst_progs[1], 4);
+    av1_dsp_init_c(&av1dsp);
+#ifdef __SSE4_1__
+    x86_av1_dsp_init_sse4(&av1dsp);
+#endif
+#ifdef __AVX2__
+    x86_av1_dsp_init_avx2(&av1dsp);
+#endif
+    av1dsp_inited = 1;
+}
+
+const struct av1_dsp *
+av1_dsp_get(void)
+{
+    if (!av1dsp_inited) {
+        av1_dsp_init();
+    }
+    return &av1dsp;
+}
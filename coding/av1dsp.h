@@ -0,0 +1,237 @@
+#ifndef _AV1DSP_H_
+#define _AV1DSP_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/* AV1 reconstruction kernels, filled with the C version first and then
+ * overridden by whatever the cpu supports, see av1_dsp_init()
+ */
+
+/* see 6.10.19, the 2D transform types, column (vertical) type first */
+enum av1_tx_type {
+    DCT_DCT = 0,
+    ADST_DCT,
+    DCT_ADST,
+    ADST_ADST,
+    FLIPADST_DCT,
+    DCT_FLIPADST,
+    FLIPADST_FLIPADST,
+    ADST_FLIPADST,
+    FLIPADST_ADST,
+    IDTX,
+    V_DCT,
+    H_DCT,
+    V_ADST,
+    H_ADST,
+    V_FLIPADST,
+    H_FLIPADST,
+};
+
+/* one step of the butterfly structure of an inverse transform, see 7.13.2.
+ * A rotation sets a = Round2(c[0] * a + c[1] * b, 12) and
+ * b = Round2(c[2] * a + c[3] * b, 12) from the old a and b, an add sets a to
+ * a + b and b to a - b, both clamped to the range of the pass.
+ */
+struct av1_btf {
+    uint8_t a;
+    uint8_t b;
+    uint8_t add;
+    int16_t c[4];
+};
+
+/* the whole 1D transform of n samples as a list of butterflies on T, which
+ * starts as T[i] = x[in[i]] and ends up in y[i] = T[out[i]], negated where
+ * neg[i] is set. The DCTs of all sizes and the 8 and 16 point ADSTs take
+ * this form, so the C and the SIMD kernels share one interpreter each.
+ */
+struct av1_itx_prog {
+    int n;
+    int nops;
+    uint8_t in[64];
+    uint8_t out[64];
+    uint8_t neg[64];
+    struct av1_btf ops[256];
+};
+
+/* 1D inverse transforms of lanes vectors side by side, sample k of vector l
+ * is at buf[k * stride + l] and is overwritten by the result. lanes is a
+ * multiple of 4 and range the clamping range of the pass in bits.
+ */
+typedef void (*av1_itx_prog_func)(int32_t *buf, int stride, int lanes,
+                                  const struct av1_itx_prog *p, int range);
+
+/* see 7.13.2.6 and 7.13.2.15, the 4 point ADST and the identity transform
+ * of n samples with the same layout
+ */
+typedef void (*av1_itx_func)(int32_t *buf, int stride, int lanes, int n);
+
+/* w x h samples of intra prediction at dst. above[-1..w + h - 1] and
+ * left[-1..w + h - 1] are AboveRow and LeftCol of 7.11.2, above[-1] is the
+ * top left sample. w and h are powers of two from 4 to 64.
+ */
+typedef void (*av1_intra_func)(uint16_t *dst, int stride,
+                               const uint16_t *above, const uint16_t *left,
+                               int w, int h);
+
+/* see 7.11.2.5, DC_PRED averages the edges there are, or takes the middle
+ * of the range without any
+ */
+typedef void (*av1_intra_dc_func)(uint16_t *dst, int stride,
+                                  const uint16_t *above, const uint16_t *left,
+                                  int w, int h, int have_above, int have_left,
+                                  int bitdepth);
+
+/* see 7.11.2.4, pAngle other than 90 and 180 from the edges after filtering
+ * and upsampling. The edges reach down to index -2 when upsampled.
+ */
+typedef void (*av1_intra_z_func)(uint16_t *dst, int stride,
+                                 const uint16_t *above, const uint16_t *left,
+                                 int w, int h, int angle, int upsample_above,
+                                 int upsample_left);
+
+/* see 7.11.5, chroma from luma on top of the DC prediction in dst. ac holds
+ * the w x h luma samples in Q3 with their average taken out, alpha is
+ * CflAlphaU or CflAlphaV.
+ */
+typedef void (*av1_cfl_func)(uint16_t *dst, int stride, const int16_t *ac,
+                             int w, int h, int alpha, int bitdepth);
+
+/* see 7.14.6, filters n lines across an edge. pix points to q0 of the first
+ * line, step goes across the edge and pitch along it, both in samples.
+ * size is the filter size 4, 6, 8 or 16 and the limits are already scaled
+ * to the bit depth.
+ */
+typedef void (*av1_lf_func)(uint16_t *pix, int step, int pitch, int n,
+                            int size, int limit, int blimit, int thresh,
+                            int bitdepth);
+
+/* see 7.15.2, one 8x8 block (or the chroma size of one) from src, which is
+ * padded by 2 rows and 3 columns each side with AV1_CDEF_VERY_LARGE where
+ * CdefAvailable is 0. The strengths are scaled, dir is the one of the block
+ * for the plane.
+ */
+typedef void (*av1_cdef_func)(uint16_t *dst, int dstride, const int16_t *src,
+                              int sstride, int w, int h, int pri, int sec,
+                              int damping, int dir, int bitdepth);
+
+/* see 7.15.1, the direction of an 8x8 luma block and its variance */
+typedef int (*av1_cdef_dir_func)(const uint16_t *src, int stride, int *var,
+                                 int bitdepth);
+
+/* see 7.17.4, w x h samples of the Wiener filter from src, which is
+ * padded by 3 samples all around. filter is 2 x 7 taps, horizontal first.
+ */
+typedef void (*av1_wiener_func)(uint16_t *dst, int dstride,
+                                const uint16_t *src, int sstride, int w,
+                                int h, const int16_t filter[2][7],
+                                int bitdepth);
+
+/* see 7.17.3, w x h samples of the self guided filter from src, padded by 3
+ * samples all around like for the Wiener filter. r and s are the radius and
+ * scale of both passes from Sgr_Params, a radius of 0 skips the pass. xqd
+ * is LrSgrXqd of the unit.
+ */
+typedef void (*av1_sgr_func)(uint16_t *dst, int dstride, const uint16_t *src,
+                             int sstride, int w, int h, const int r[2],
+                             const int s[2], const int xqd[2], int bitdepth);
+
+#define AV1_CDEF_VERY_LARGE (30000)
+
+struct av1_dsp {
+    av1_itx_prog_func itx_prog;
+    av1_itx_func itx_adst4;
+    av1_itx_func itx_identity;
+
+    av1_intra_dc_func intra_dc;
+    av1_intra_func intra_v;
+    av1_intra_func intra_h;
+    av1_intra_func intra_paeth;
+    av1_intra_func intra_smooth;
+    av1_intra_func intra_smooth_v;
+    av1_intra_func intra_smooth_h;
+    av1_intra_z_func intra_z;
+    av1_cfl_func cfl_pred;
+
+    av1_lf_func lf_edge;
+    av1_cdef_dir_func cdef_dir;
+    av1_cdef_func cdef_filter;
+    av1_wiener_func wiener;
+    av1_sgr_func sgr;
+};
+
+/* see 7.13.3, the inverse transform of a block and its addition to the
+ * prediction in dst. coef holds Dequant in columns, coefficient i, j (row
+ * and column) is at coef[j * 64 + i]; only rows and columns below 32 are
+ * read and the whole area it takes is cleared again on return. rows is the
+ * number of rows that may have non-zero coefficients.
+ */
+void av1_inv_txfm_add(uint16_t *dst, int stride, int32_t *coef, int log2w,
+                      int log2h, int tx_type, int lossless, int rows,
+                      int bitdepth);
+
+/* the programs of the DCTs of 4 to 64 samples by log2 size - 2, and of the
+ * 8 and 16 point ADSTs
+ */
+const struct av1_itx_prog *av1_idct_prog(int log2n);
+const struct av1_itx_prog *av1_iadst_prog(int log2n);
+
+/* see 7.11.2.11, weights of SMOOTH_PRED by log2 of the size */
+extern const uint8_t av1_sm_weights[7][64];
+/* see 7.11.2.4, dx and dy by angle */
+extern const int16_t av1_dr_intra_derivative[90];
+
+/* fill all entries with the plain C version */
+void av1_dsp_init_c(struct av1_dsp *dsp);
+
+/* select the best kernels once, safe to call more than once */
+void av1_dsp_init(void);
+
+const struct av1_dsp *av1_dsp_get(void);
+
+/* C kernels, exported for the tails the SIMD versions leave over */
+void av1_itx_prog_c(int32_t *buf, int stride, int lanes,
+                    const struct av1_itx_prog *p, int range);
+void av1_itx_adst4_c(int32_t *buf, int stride, int lanes, int n);
+void av1_itx_identity_c(int32_t *buf, int stride, int lanes, int n);
+void av1_intra_dc_c(uint16_t *dst, int stride, const uint16_t *above,
+                    const uint16_t *left, int w, int h, int have_above,
+                    int have_left, int bitdepth);
+void av1_intra_v_c(uint16_t *dst, int stride, const uint16_t *above,
+                   const uint16_t *left, int w, int h);
+void av1_intra_h_c(uint16_t *dst, int stride, const uint16_t *above,
+                   const uint16_t *left, int w, int h);
+void av1_intra_paeth_c(uint16_t *dst, int stride, const uint16_t *above,
+                       const uint16_t *left, int w, int h);
+void av1_intra_smooth_c(uint16_t *dst, int stride, const uint16_t *above,
+                        const uint16_t *left, int w, int h);
+void av1_intra_smooth_v_c(uint16_t *dst, int stride, const uint16_t *above,
+                          const uint16_t *left, int w, int h);
+void av1_intra_smooth_h_c(uint16_t *dst, int stride, const uint16_t *above,
+                          const uint16_t *left, int w, int h);
+void av1_intra_z_c(uint16_t *dst, int stride, const uint16_t *above,
+                   const uint16_t *left, int w, int h, int angle,
+                   int upsample_above, int upsample_left);
+void av1_cfl_pred_c(uint16_t *dst, int stride, const int16_t *ac, int w,
+                    int h, int alpha, int bitdepth);
+void av1_lf_edge_c(uint16_t *pix, int step, int pitch, int n, int size,
+                   int limit, int blimit, int thresh, int bitdepth);
+int av1_cdef_dir_c(const uint16_t *src, int stride, int *var, int bitdepth);
+void av1_cdef_filter_c(uint16_t *dst, int dstride, const int16_t *src,
+                       int sstride, int w, int h, int pri, int sec,
+                       int damping, int dir, int bitdepth);
+void av1_wiener_c(uint16_t *dst, int dstride, const uint16_t *src,
+                  int sstride, int w, int h, const int16_t filter[2][7],
+                  int bitdepth);
+void av1_sgr_c(uint16_t *dst, int dstride, const uint16_t *src, int sstride,
+               int w, int h, const int r[2], const int s[2], const int xqd[2],
+               int bitdepth);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*_AV1DSP_H_*/
@@ -0,0 +1,3164 @@
+#include <stdint.h>
+#include <pthread.h>
+
+#include "av1qm.h"
+
+/* Quantizer_Matrix of av1-spec section 10 by level and luma or chroma.
+ * Most of its matrices are others in disguise: the smaller squares sample
+ * the 32x32 one, the wide shapes sample the 32x16 one and the tall shapes
+ * are the wide ones transposed. So only 32x32, 32x16 and 16x4 are written
+ * out here and av1_qm_init() puts the rest back together.
+ */
+
+// the lower triangle of the 32x32 matrices, row by row
+static const uint8_t qm_32x32[15][2][528] = {
+    {
+        {
+            32, 31, 32, 31, 32, 32, 31, 32, 32, 32, 31, 32,
+            32, 33, 33, 32, 32, 32, 33, 34, 35, 34, 34, 33,
+            34, 35, 37, 39, 35, 34, 34, 35, 36, 37, 41, 43,
+            36, 35, 34, 35, 36, 38, 42, 45, 48, 39, 38, 37,
+            38, 39, 40, 45, 47, 50, 54, 44, 42, 41, 41, 42,
+            42, 47, 50, 54, 58, 63, 46, 44, 42, 43, 44, 44,
+            49, 52, 55, 59, 65, 67, 48, 46, 44, 45, 45, 46,
+            51, 53, 57, 61, 67, 69, 71, 54, 51, 49, 49, 50,
+            49, 54, 57, 60, 65, 71, 74, 76, 82, 59, 56, 54,
+            54, 54, 53, 58, 61, 64, 69, 75, 78, 80, 87, 92,
+            62, 59, 56, 56, 56, 55, 60, 63, 66, 71, 77, 80,
+            83, 89, 95, 98, 65, 62, 59, 59, 59, 58, 63, 65,
+            68, 73, 79, 82, 85, 92, 98, 101, 105, 71, 68, 65,
+            64, 64, 63, 68, 70, 73, 78, 84, 87, 90, 97, 103,
+            107, 111, 117, 80, 76, 72, 72, 71, 69, 74, 76, 79,
+            84, 90, 93, 96, 104, 110, 114, 118, 125, 134, 81, 77,
+            73, 73, 72, 70, 75, 77, 80, 85, 91, 94, 97, 105,
+            111, 115, 119, 126, 135, 137, 83, 78, 75, 74, 74, 72,
+            76, 79, 81, 86, 92, 95, 99, 106, 113, 117, 121, 128,
+            137, 138, 140, 88, 84, 80, 79, 78, 76, 80, 82, 85,
+            91, 95, 98, 103, 111, 115, 119, 126, 134, 139, 144, 147,
+            152, 91, 86, 83, 82, 81, 79, 81, 84, 88, 92, 95,
+            100, 107, 110, 115, 123, 127, 132, 140, 147, 151, 154, 159,
+            94, 89, 86, 85, 84, 82, 82, 86, 90, 92, 97, 103,
+            105, 111, 119, 121, 128, 136, 139, 146, 156, 158, 161, 166,
+            97, 92, 90, 88, 86, 85, 84, 89, 91, 95, 100, 102,
+            108, 114, 116, 125, 130, 133, 143, 148, 152, 163, 166, 168,
+            174, 101, 95, 93, 91, 89, 89, 87, 91, 93, 98, 101,
+            105, 111, 113, 120, 126, 130, 138, 142, 149, 157, 159, 171,
+            174, 176, 183, 104, 99, 97, 94, 93, 93, 90, 92, 96,
+            100, 102, 108, 111, 116, 122, 125, 134, 137, 144, 151, 155,
+            165, 169, 179, 182, 184, 191, 107, 102, 101, 97, 96, 96,
+            93, 93, 99, 101, 105, 110, 113, 120, 122, 129, 133, 140,
+            146, 150, 161, 163, 173, 178, 187, 191, 193, 200, 111, 105,
+            104, 101, 100, 99, 97, 96, 102, 103, 109, 111, 117, 120,
+            125, 131, 135, 143, 146, 156, 158, 168, 173, 180, 189, 195,
+            200, 202, 210, 115, 109, 108, 104, 104, 102, 101, 100, 103,
+            106, 111, 113, 119, 121, 129, 131, 140, 142, 151, 155, 162,
+            168, 176, 183, 188, 199, 204, 210, 212, 220, 119, 113, 112,
+            107, 107, 106, 105, 103, 105, 110, 112, 117, 120, 125, 130,
+            135, 140, 145, 152, 157, 165, 169, 179, 183, 193, 197, 210,
+            214, 220, 222, 231, 123, 116, 116, 111, 111, 109, 110, 107,
+            107, 114, 114, 121, 122, 130, 130, 140, 140, 150, 151, 163,
+            164, 176, 177, 190, 191, 204, 206, 222, 224, 230, 232, 242,
+        },
+        {
+            32, 31, 31, 30, 31, 32, 32, 33, 33, 35, 33, 34,
+            35, 37, 39, 36, 38, 40, 41, 43, 47, 41, 42, 42,
+            43, 45, 47, 48, 45, 45, 44, 45, 46, 47, 49, 50,
+            49, 47, 46, 47, 47, 48, 50, 51, 53, 48, 47, 45,
+            46, 46, 46, 49, 51, 53, 54, 49, 47, 45, 45, 45,
+            45, 49, 51, 53, 55, 58, 50, 47, 45, 46, 46, 46,
+            49, 51, 54, 56, 59, 60, 50, 48, 46, 46, 46, 46,
+            50, 52, 54, 56, 60, 60, 61, 52, 50, 47, 47, 47,
+            47, 50, 52, 54, 57, 61, 62, 63, 66, 54, 52, 49,
+            49, 49, 48, 52, 53, 55, 58, 62, 64, 65, 68, 71,
+            56, 53, 51, 50, 50, 49, 52, 54, 56, 59, 63, 64,
+            66, 69, 72, 73, 57, 54, 52, 51, 51, 50, 53, 55,
+            56, 60, 63, 65, 67, 70, 73, 75, 76, 60, 57, 54,
+            54, 53, 52, 55, 57, 58, 61, 65, 67, 68, 72, 75,
+            77, 79, 82, 63, 60, 57, 57, 56, 54, 57, 59, 60,
+            63, 67, 69, 71, 75, 78, 80, 82, 85, 89, 64, 61,
+            58, 57, 57, 55, 58, 59, 61, 64, 67, 69, 71, 75,
+            78, 80, 82, 85, 89, 90, 65, 61, 58, 58, 57, 55,
+            58, 60, 61, 64, 68, 70, 71, 75, 79, 81, 83, 86,
+            90, 91, 91, 67, 63, 61, 60, 59, 57, 60, 61, 63,
+            66, 69, 70, 73, 77, 79, 81, 85, 88, 90, 92, 94,
+            96, 68, 64, 62, 61, 60, 58, 59, 61, 64, 66, 67,
+            71, 74, 75, 78, 82, 84, 86, 90, 93, 94, 96, 98,
+            69, 65, 63, 62, 61, 59, 59, 62, 64, 65, 68, 71,
+            72, 75, 79, 80, 83, 87, 89, 92, 96, 97, 98, 100,
+            70, 66, 64, 63, 62, 61, 60, 63, 64, 66, 69, 70,
+            73, 76, 77, 81, 84, 85, 89, 92, 93, 98, 99, 100,
+            102, 71, 67, 66, 64, 63, 62, 61, 63, 64, 67, 68,
+            70, 74, 75, 78, 81, 83, 86, 88, 91, 94, 95, 100,
+            101, 102, 104, 72, 68, 67, 65, 64, 64, 61, 63, 65,
+            67, 68, 71, 73, 75, 78, 79, 84, 85, 88, 91, 93,
+            97, 98, 102, 103, 104, 106, 73, 69, 68, 66, 65, 65,
+            63, 63, 66, 67, 69, 71, 73, 76, 77, 81, 82, 85,
+            88, 90, 94, 95, 99, 101, 104, 105, 106, 109, 74, 70,
+            70, 67, 66, 66, 64, 63, 66, 67, 70, 71, 74, 75,
+            78, 80, 82, 86, 87, 91, 92, 96, 98, 101, 104, 106,
+            108, 108, 111, 75, 71, 71, 68, 68, 67, 66, 64, 66,
+            68, 70, 71, 74, 75, 79, 79, 84, 84, 88, 90, 93,
+            95, 98, 101, 103, 107, 108, 110, 111, 113, 76, 72, 72,
+            69, 69, 68, 67, 65, 66, 69, 70, 72, 74, 76, 78,
+            81, 83, 85, 88, 90, 93, 95, 98, 100, 104, 105, 109,
+            111, 112, 113, 116, 78, 74, 74, 70, 70, 69, 69, 66,
+            66, 70, 70, 74, 74, 77, 78, 82, 82, 86, 87, 92,
+            92, 96, 97, 102, 102, 107, 107, 112, 113, 115, 115, 118,
+        },
+    },
+    {
+        {
+            32, 31, 32, 31, 32, 32, 31, 32, 32, 32, 31, 32,
+            32, 32, 33, 32, 32, 32, 33, 34, 35, 32, 33, 33,
+            33, 34, 36, 36, 34, 34, 33, 34, 35, 37, 38, 39,
+            36, 35, 34, 35, 36, 38, 40, 42, 48, 38, 37, 36,
+            36, 38, 39, 41, 44, 50, 51, 39, 38, 37, 38, 39,
+            40, 42, 45, 50, 52, 54, 44, 42, 41, 41, 42, 42,
+            44, 47, 54, 56, 58, 63, 47, 45, 44, 44, 45, 45,
+            47, 50, 56, 58, 60, 66, 69, 49, 47, 46, 45, 46,
+            46, 48, 51, 57, 60, 62, 68, 71, 73, 54, 51, 50,
+            49, 50, 49, 51, 54, 60, 63, 65, 71, 75, 77, 82,
+            59, 56, 54, 54, 54, 53, 55, 58, 64, 67, 69, 75,
+            79, 81, 87, 92, 61, 58, 56, 56, 56, 55, 57, 60,
+            65, 68, 70, 77, 81, 83, 89, 94, 97, 65, 62, 60,
+            59, 59, 58, 60, 63, 68, 71, 73, 79, 84, 87, 92,
+            98, 101, 105, 71, 68, 65, 65, 64, 63, 65, 68, 73,
+            76, 78, 84, 89, 92, 97, 103, 106, 111, 117, 76, 72,
+            70, 69, 68, 66, 68, 71, 76, 79, 81, 88, 92, 95,
+            101, 107, 110, 115, 122, 127, 80, 76, 73, 72, 71, 69,
+            71, 74, 79, 82, 84, 90, 95, 98, 104, 110, 113, 118,
+            125, 130, 134, 83, 78, 76, 75, 74, 72, 73, 76, 81,
+            84, 86, 92, 97, 100, 106, 113, 116, 121, 128, 133, 137,
+            140, 86, 82, 79, 78, 77, 74, 76, 79, 84, 87, 89,
+            95, 100, 103, 109, 116, 119, 124, 131, 136, 140, 144, 147,
+            89, 85, 82, 81, 79, 78, 78, 82, 86, 87, 92, 97,
+            100, 105, 112, 114, 120, 128, 131, 136, 146, 147, 150, 155,
+            92, 88, 85, 84, 82, 81, 80, 85, 86, 90, 95, 97,
+            102, 107, 110, 117, 122, 125, 134, 138, 142, 152, 154, 156,
+            162, 95, 90, 88, 86, 85, 84, 82, 86, 88, 93, 95,
+            99, 105, 106, 113, 118, 121, 129, 132, 139, 146, 148, 159,
+            161, 163, 169, 98, 93, 91, 89, 88, 87, 85, 87, 90,
+            94, 96, 102, 104, 109, 114, 117, 126, 128, 134, 141, 145,
+            154, 157, 166, 168, 170, 176, 101, 96, 95, 92, 91, 90,
+            88, 88, 93, 95, 99, 103, 106, 112, 114, 121, 124, 131,
+            136, 140, 149, 151, 160, 165, 173, 176, 178, 184, 104, 99,
+            98, 95, 94, 93, 91, 90, 95, 96, 102, 103, 109, 112,
+            117, 122, 125, 133, 136, 145, 146, 156, 160, 167, 174, 180,
+            184, 186, 193, 108, 102, 101, 98, 97, 96, 95, 93, 97,
+            100, 104, 106, 111, 113, 121, 122, 130, 132, 140, 143, 150,
+            155, 162, 169, 174, 183, 188, 192, 194, 201, 111, 105, 105,
+            101, 100, 99, 98, 96, 98, 103, 105, 109, 112, 117, 121,
+            125, 130, 135, 141, 146, 152, 156, 165, 169, 178, 181, 193,
+            196, 201, 202, 210, 114, 109, 109, 104, 104, 102, 102, 99,
+            100, 106, 106, 113, 113, 120, 121, 129, 130, 139, 140, 151,
+            151, 162, 162, 175, 176, 187, 188, 203, 204, 210, 211, 219,
+        },
+        {
+            32, 31, 31, 30, 31, 31, 31, 32, 32, 33, 33, 34,
+            35, 36, 39, 36, 38, 39, 40, 43, 47, 38, 40, 41,
+            41, 44, 47, 47, 41, 42, 42, 43, 45, 47, 48, 48,
+            49, 47, 46, 46, 47, 48, 49, 50, 53, 49, 47, 46,
+            46, 46, 47, 48, 50, 53, 53, 48, 47, 46, 45, 46,
+            46, 48, 49, 53, 54, 54, 49, 47, 45, 45, 45, 45,
+            47, 49, 53, 55, 55, 58, 50, 48, 46, 46, 46, 46,
+            47, 50, 54, 55, 56, 59, 61, 51, 48, 47, 46, 47,
+            46, 47, 50, 54, 55, 56, 60, 61, 62, 52, 50, 48,
+            47, 47, 47, 48, 50, 54, 56, 57, 61, 63, 64, 66,
+            54, 52, 50, 49, 49, 48, 49, 52, 55, 57, 58, 62,
+            64, 66, 68, 71, 55, 53, 51, 50, 50, 49, 50, 52,
+            56, 58, 59, 63, 65, 66, 69, 72, 73, 57, 54, 52,
+            51, 51, 50, 51, 53, 56, 58, 60, 63, 66, 67, 70,
+            73, 74, 76, 60, 57, 55, 54, 53, 52, 53, 55, 58,
+            60, 61, 65, 68, 69, 72, 75, 77, 79, 82, 62, 59,
+            57, 56, 55, 53, 54, 56, 59, 61, 63, 66, 69, 70,
+            74, 77, 78, 80, 84, 86, 63, 60, 58, 57, 56, 54,
+            55, 57, 60, 62, 63, 67, 70, 71, 75, 78, 79, 82,
+            85, 87, 89, 65, 61, 59, 58, 57, 55, 56, 58, 61,
+            63, 64, 68, 71, 72, 75, 79, 80, 83, 86, 88, 90,
+            91, 66, 63, 60, 59, 58, 56, 58, 59, 62, 64, 65,
+            69, 72, 73, 76, 80, 81, 84, 87, 90, 91, 93, 94,
+            67, 64, 62, 61, 59, 58, 58, 60, 63, 64, 66, 69,
+            71, 73, 77, 78, 81, 85, 86, 89, 93, 94, 95, 97,
+            68, 65, 63, 62, 60, 59, 58, 61, 62, 64, 67, 68,
+            71, 74, 75, 79, 81, 83, 87, 89, 91, 95, 96, 97,
+            99, 69, 66, 64, 63, 61, 61, 59, 61, 62, 65, 66,
+            68, 72, 73, 76, 78, 80, 84, 85, 88, 91, 92, 97,
+            98, 98, 101, 70, 67, 65, 63, 62, 62, 60, 61, 63,
+            65, 66, 69, 71, 73, 76, 77, 81, 83, 85, 88, 90,
+            94, 95, 99, 100, 100, 103, 71, 67, 67, 64, 63, 63,
+            61, 61, 64, 65, 67, 69, 71, 74, 75, 78, 80, 83,
+            85, 87, 91, 92, 95, 97, 100, 102, 102, 105, 72, 68,
+            68, 65, 65, 64, 62, 62, 64, 65, 68, 69, 72, 73,
+            76, 78, 80, 83, 84, 88, 89, 93, 95, 97, 100, 102,
+            104, 104, 107, 73, 69, 69, 66, 66, 65, 64, 63, 64,
+            66, 68, 69, 72, 73, 77, 77, 81, 82, 86, 87, 90,
+            92, 95, 97, 99, 103, 104, 106, 106, 109, 74, 70, 70,
+            67, 67, 66, 65, 63, 64, 67, 68, 70, 72, 74, 76,
+            78, 80, 82, 85, 87, 90, 91, 95, 96, 100, 101, 105,
+            106, 108, 108, 111, 75, 71, 71, 68, 68, 66, 66, 64,
+            64, 68, 68, 71, 71, 75, 75, 79, 79, 83, 84, 88,
+            89, 93, 93, 98, 98, 102, 103, 108, 108, 110, 110, 113,
+        },
+    },
+    {
+        {
+            32, 31, 32, 31, 32, 32, 31, 32, 32, 32, 31, 32,
+            32, 32, 33, 32, 32, 32, 32, 33, 34, 32, 32, 32,
+            32, 34, 34, 35, 34, 34, 33, 33, 35, 36, 37, 39,
+            34, 34, 34, 34, 36, 36, 37, 41, 42, 36, 35, 34,
+            34, 36, 37, 38, 42, 45, 48, 39, 38, 38, 37, 39,
+            40, 40, 45, 47, 50, 54, 41, 39, 39, 38, 40, 40,
+            41, 46, 48, 51, 55, 56, 44, 42, 41, 41, 42, 42,
+            42, 47, 50, 54, 58, 59, 63, 48, 46, 45, 44, 45,
+            45, 45, 50, 53, 56, 61, 62, 66, 70, 49, 47, 46,
+            45, 46, 46, 46, 51, 53, 57, 62, 63, 68, 71, 73,
+            54, 51, 50, 49, 50, 49, 49, 54, 56, 60, 65, 67,
+            71, 76, 77, 82, 58, 55, 54, 53, 53, 53, 52, 57,
+            59, 63, 68, 70, 74, 79, 81, 86, 90, 59, 57, 55,
+            54, 54, 54, 54, 59, 61, 64, 69, 71, 75, 80, 82,
+            87, 91, 93, 65, 62, 60, 59, 59, 58, 58, 63, 65,
+            68, 73, 75, 79, 85, 87, 92, 97, 99, 105, 69, 66,
+            64, 63, 63, 62, 61, 66, 68, 71, 76, 78, 83, 88,
+            90, 96, 100, 102, 109, 113, 71, 68, 66, 65, 64, 63,
+            63, 68, 70, 73, 78, 80, 84, 90, 92, 97, 102, 104,
+            111, 115, 117, 80, 76, 73, 72, 71, 70, 69, 74, 76,
+            79, 84, 86, 90, 96, 98, 104, 109, 111, 118, 123, 125,
+            134, 81, 77, 75, 74, 73, 72, 71, 75, 77, 80, 85,
+            87, 91, 97, 99, 105, 110, 112, 120, 125, 127, 136, 137,
+            83, 78, 76, 75, 74, 73, 72, 76, 78, 81, 86, 88,
+            92, 98, 100, 106, 111, 113, 121, 126, 128, 137, 139, 140,
+            87, 83, 81, 79, 78, 77, 75, 80, 82, 85, 90, 91,
+            96, 101, 103, 110, 114, 117, 125, 129, 133, 142, 143, 145,
+            150, 90, 85, 83, 81, 80, 79, 78, 81, 83, 87, 89,
+            93, 98, 100, 106, 110, 114, 121, 124, 130, 136, 138, 148,
+            149, 151, 156, 93, 88, 86, 84, 83, 82, 80, 82, 85,
+            89, 90, 96, 98, 102, 107, 109, 118, 120, 125, 131, 134,
+            143, 145, 153, 156, 157, 163, 95, 90, 89, 86, 85, 85,
+            83, 83, 88, 89, 93, 97, 99, 105, 106, 113, 116, 122,
+            127, 130, 139, 140, 148, 153, 159, 162, 164, 169, 98, 93,
+            92, 89, 88, 87, 86, 85, 89, 90, 96, 97, 102, 105,
+            109, 114, 117, 124, 126, 134, 136, 144, 148, 154, 160, 166,
+            169, 170, 176, 101, 96, 95, 91, 91, 90, 89, 87, 90,
+            93, 97, 99, 104, 105, 112, 113, 121, 122, 130, 133, 139,
+            144, 150, 155, 160, 168, 172, 176, 177, 184, 104, 99, 98,
+            94, 94, 92, 92, 90, 92, 96, 98, 102, 104, 109, 112,
+            116, 121, 125, 130, 135, 141, 144, 152, 155, 163, 166, 177,
+            179, 184, 185, 191, 107, 101, 101, 97, 97, 95, 95, 93,
+            93, 99, 99, 105, 105, 112, 112, 120, 120, 129, 129, 139,
+            140, 149, 149, 161, 161, 172, 172, 185, 186, 191, 192, 199,
+        },
+        {
+            32, 31, 31, 30, 31, 31, 30, 31, 31, 32, 33, 34,
+            35, 35, 39, 35, 36, 37, 37, 41, 43, 36, 38, 39,
+            40, 43, 45, 47, 41, 42, 42, 42, 45, 46, 47, 48,
+            44, 44, 44, 44, 46, 46, 47, 49, 50, 49, 47, 47,
+            46, 47, 47, 48, 50, 51, 53, 48, 47, 46, 45, 46,
+            46, 46, 49, 51, 53, 54, 48, 47, 46, 45, 46, 46,
+            46, 49, 51, 53, 54, 55, 49, 47, 46, 45, 45, 45,
+            45, 49, 51, 53, 55, 56, 58, 50, 48, 47, 46, 46,
+            46, 46, 50, 51, 54, 56, 57, 59, 61, 51, 48, 47,
+            46, 47, 46, 46, 50, 51, 54, 56, 57, 60, 62, 62,
+            52, 50, 48, 47, 47, 47, 47, 50, 52, 54, 57, 58,
+            61, 63, 64, 66, 54, 51, 50, 49, 49, 48, 48, 51,
+            53, 55, 58, 59, 62, 64, 65, 68, 70, 55, 52, 51,
+            50, 49, 49, 48, 52, 53, 55, 59, 60, 62, 65, 66,
+            68, 70, 71, 57, 54, 53, 52, 51, 50, 50, 53, 54,
+            56, 60, 61, 63, 66, 67, 70, 73, 73, 76, 59, 56,
+            54, 53, 53, 52, 51, 54, 56, 58, 61, 62, 65, 68,
+            69, 72, 74, 75, 78, 80, 60, 57, 55, 54, 53, 53,
+            52, 55, 56, 58, 61, 63, 65, 68, 69, 72, 75, 76,
+            79, 81, 82, 63, 60, 58, 57, 56, 55, 54, 57, 59,
+            60, 63, 65, 67, 70, 71, 75, 77, 78, 82, 84, 85,
+            89, 64, 61, 59, 58, 57, 56, 55, 58, 59, 61, 64,
+            65, 68, 71, 72, 75, 78, 79, 82, 85, 86, 89, 90,
+            65, 61, 60, 58, 57, 56, 55, 58, 59, 61, 64, 65,
+            68, 71, 72, 75, 78, 79, 83, 85, 86, 90, 91, 91,
+            67, 63, 61, 60, 59, 58, 57, 60, 61, 63, 65, 66,
+            69, 72, 73, 77, 79, 80, 84, 86, 88, 92, 93, 93,
+            95, 68, 64, 63, 61, 60, 59, 58, 60, 61, 63, 65,
+            67, 70, 71, 74, 76, 78, 81, 83, 86, 88, 89, 94,
+            94, 95, 97, 68, 65, 64, 62, 61, 60, 58, 59, 61,
+            64, 64, 68, 69, 71, 74, 75, 79, 80, 83, 86, 87,
+            91, 92, 95, 96, 97, 99, 69, 66, 65, 63, 62, 61,
+            59, 59, 62, 63, 65, 67, 69, 72, 72, 76, 78, 80,
+            83, 84, 88, 89, 92, 94, 97, 98, 99, 101, 70, 67,
+            66, 63, 63, 62, 61, 60, 63, 63, 66, 67, 69, 71,
+            73, 76, 77, 81, 82, 85, 86, 90, 91, 94, 96, 99,
+            100, 100, 103, 71, 67, 67, 64, 64, 63, 62, 61, 62,
+            64, 66, 67, 70, 71, 74, 74, 78, 79, 83, 84, 87,
+            89, 91, 94, 95, 99, 100, 102, 102, 104, 72, 68, 68,
+            65, 65, 64, 63, 61, 62, 65, 66, 68, 69, 71, 73,
+            75, 77, 79, 82, 84, 87, 88, 92, 93, 96, 97, 101,
+            102, 104, 104, 106, 73, 69, 69, 66, 66, 64, 64, 62,
+            62, 66, 66, 69, 69, 72, 73, 76, 77, 81, 81, 85,
+            85, 89, 90, 94, 94, 99, 99, 104, 104, 106, 106, 108,
+        },
+    },
+    {
+        {
+            32, 31, 32, 31, 32, 32, 31, 32, 32, 32, 31, 32,
+            32, 32, 33, 31, 32, 32, 32, 33, 33, 32, 32, 32,
+            32, 33, 34, 35, 32, 33, 33, 33, 34, 34, 36, 36,
+            34, 34, 34, 33, 35, 35, 37, 38, 39, 35, 35, 34,
+            34, 36, 36, 38, 39, 42, 46, 36, 35, 35, 34, 36,
+            36, 38, 40, 42, 47, 48, 39, 38, 38, 37, 39, 39,
+            40, 42, 45, 49, 50, 54, 41, 40, 39, 38, 40, 40,
+            41, 43, 46, 50, 52, 55, 57, 44, 42, 42, 41, 42,
+            42, 42, 44, 47, 52, 54, 58, 60, 63, 47, 45, 45,
+            44, 44, 45, 45, 47, 50, 55, 56, 60, 62, 66, 69,
+            48, 46, 45, 44, 45, 45, 46, 47, 51, 55, 57, 61,
+            63, 67, 70, 71, 54, 51, 50, 49, 49, 50, 49, 51,
+            54, 59, 60, 65, 67, 71, 75, 76, 82, 56, 53, 52,
+            51, 51, 51, 51, 53, 56, 60, 61, 66, 69, 73, 77,
+            78, 84, 86, 59, 56, 55, 54, 54, 54, 53, 55, 58,
+            62, 64, 69, 71, 75, 79, 80, 87, 89, 92, 64, 61,
+            60, 58, 58, 58, 57, 59, 62, 66, 67, 72, 75, 79,
+            83, 84, 91, 93, 97, 102, 65, 62, 61, 59, 59, 59,
+            58, 60, 63, 67, 68, 73, 75, 79, 84, 85, 92, 94,
+            98, 103, 105, 71, 68, 67, 65, 64, 64, 63, 65, 68,
+            72, 73, 78, 80, 84, 89, 90, 97, 100, 103, 109, 111,
+            117, 74, 71, 69, 68, 67, 67, 65, 67, 70, 74, 75,
+            80, 83, 86, 91, 93, 100, 102, 106, 112, 114, 120, 123,
+            80, 76, 74, 72, 71, 71, 69, 71, 74, 78, 79, 84,
+            86, 90, 95, 96, 104, 106, 110, 116, 118, 125, 128, 134,
+            82, 78, 76, 74, 73, 73, 71, 73, 76, 79, 80, 86,
+            88, 92, 97, 98, 106, 108, 112, 118, 120, 127, 131, 136,
+            139, 83, 78, 77, 75, 74, 74, 72, 73, 76, 80, 81,
+            86, 89, 92, 97, 99, 106, 109, 113, 119, 121, 128, 131,
+            137, 139, 140, 87, 83, 81, 79, 78, 78, 75, 77, 80,
+            83, 85, 90, 92, 96, 100, 102, 110, 112, 117, 122, 125,
+            133, 135, 142, 144, 145, 150, 90, 85, 84, 81, 80, 80,
+            78, 78, 82, 84, 87, 91, 93, 98, 99, 106, 108, 113,
+            118, 121, 129, 130, 137, 141, 147, 150, 151, 156, 92, 88,
+            87, 84, 83, 82, 80, 80, 84, 85, 90, 91, 95, 98,
+            102, 106, 109, 115, 117, 125, 126, 134, 137, 142, 148, 152,
+            155, 156, 162, 95, 90, 89, 86, 85, 84, 83, 82, 85,
+            87, 91, 92, 97, 98, 105, 105, 112, 114, 121, 123, 129,
+            133, 138, 143, 147, 155, 158, 161, 162, 168, 97, 92, 92,
+            88, 88, 86, 86, 84, 85, 90, 91, 95, 97, 101, 104,
+            108, 112, 116, 121, 125, 130, 133, 140, 143, 150, 152, 162,
+            164, 168, 168, 174, 100, 95, 95, 90, 90, 89, 89, 86,
+            86, 92, 92, 97, 98, 104, 104, 111, 111, 119, 119, 128,
+            129, 137, 137, 147, 148, 157, 158, 169, 170, 174, 175, 181,
+        },
+        {
+            32, 31, 31, 31, 31, 31, 30, 31, 31, 32, 33, 34,
+            34, 34, 37, 33, 34, 35, 35, 38, 39, 36, 38, 39,
+            40, 42, 43, 47, 38, 40, 40, 41, 43, 44, 47, 47,
+            41, 42, 42, 42, 44, 45, 47, 48, 48, 47, 46, 46,
+            45, 46, 47, 47, 48, 50, 52, 49, 47, 47, 46, 47,
+            47, 48, 49, 50, 52, 53, 48, 47, 46, 45, 46, 46,
+            46, 48, 49, 52, 53, 54, 49, 47, 46, 45, 46, 46,
+            46, 47, 49, 52, 53, 55, 55, 49, 47, 46, 45, 45,
+            45, 45, 47, 49, 52, 53, 55, 57, 58, 50, 48, 47,
+            46, 46, 46, 46, 47, 50, 53, 54, 56, 57, 59, 61,
+            50, 48, 47, 46, 46, 46, 46, 47, 50, 53, 54, 56,
+            58, 60, 61, 61, 52, 50, 49, 47, 47, 47, 47, 48,
+            50, 53, 54, 57, 59, 61, 63, 63, 66, 53, 50, 50,
+            48, 48, 48, 47, 49, 51, 54, 55, 58, 59, 62, 64,
+            64, 67, 68, 54, 52, 51, 49, 49, 49, 48, 49, 52,
+            55, 55, 58, 60, 62, 64, 65, 68, 69, 71, 56, 54,
+            53, 51, 51, 51, 49, 51, 53, 55, 56, 59, 61, 63,
+            66, 66, 70, 71, 73, 75, 57, 54, 53, 52, 51, 51,
+            50, 51, 53, 56, 56, 60, 61, 63, 66, 67, 70, 71,
+            73, 76, 76, 60, 57, 56, 54, 53, 53, 52, 53, 55,
+            58, 58, 61, 63, 65, 68, 68, 72, 73, 75, 78, 79,
+            82, 61, 58, 57, 55, 55, 54, 53, 54, 56, 58, 59,
+            62, 64, 66, 69, 69, 73, 74, 76, 79, 80, 83, 84,
+            63, 60, 59, 57, 56, 56, 54, 55, 57, 60, 60, 63,
+            65, 67, 70, 71, 75, 76, 78, 81, 82, 85, 86, 89,
+            64, 61, 60, 58, 57, 57, 55, 56, 58, 60, 61, 64,
+            66, 68, 70, 71, 75, 77, 79, 82, 82, 86, 87, 90,
+            91, 65, 61, 60, 58, 57, 57, 55, 56, 58, 61, 61,
+            64, 66, 68, 71, 71, 75, 77, 79, 82, 83, 86, 88,
+            90, 91, 91, 67, 63, 62, 60, 59, 59, 57, 58, 60,
+            62, 63, 66, 67, 69, 72, 73, 77, 78, 80, 83, 84,
+            88, 89, 92, 93, 93, 95, 67, 64, 63, 61, 60, 60,
+            58, 58, 61, 61, 63, 65, 67, 70, 70, 74, 75, 78,
+            80, 81, 85, 86, 89, 91, 93, 94, 95, 97, 68, 65,
+            64, 62, 61, 60, 59, 58, 61, 61, 64, 65, 67, 69,
+            71, 73, 75, 78, 79, 83, 83, 87, 88, 91, 93, 95,
+            96, 97, 99, 69, 65, 65, 62, 62, 61, 60, 59, 61,
+            62, 64, 65, 68, 68, 72, 72, 76, 76, 80, 81, 84,
+            86, 88, 90, 92, 95, 96, 98, 98, 100, 70, 66, 66,
+            63, 63, 62, 61, 60, 60, 63, 64, 66, 67, 69, 71,
+            73, 75, 77, 79, 81, 84, 85, 88, 89, 93, 93, 97,
+            98, 100, 100, 102, 71, 67, 67, 64, 64, 62, 62, 60,
+            60, 64, 64, 67, 67, 70, 70, 74, 74, 78, 78, 82,
+            82, 86, 86, 91, 91, 95, 95, 100, 100, 101, 101, 104,
+        },
+    },
+    {
+        {
+            32, 31, 32, 31, 32, 32, 31, 32, 32, 32, 31, 32,
+            32, 32, 32, 31, 32, 32, 32, 33, 33, 32, 32, 32,
+            32, 33, 33, 34, 32, 32, 32, 32, 33, 34, 35, 35,
+            33, 33, 33, 33, 34, 35, 36, 36, 38, 34, 34, 34,
+            33, 34, 35, 36, 37, 39, 39, 36, 35, 35, 34, 35,
+            36, 37, 38, 42, 42, 48, 36, 35, 35, 34, 35, 36,
+            38, 38, 42, 43, 48, 49, 39, 38, 38, 37, 38, 39,
+            40, 40, 44, 45, 50, 51, 54, 41, 39, 39, 38, 39,
+            40, 40, 41, 45, 46, 51, 52, 55, 56, 44, 42, 42,
+            41, 41, 42, 42, 42, 46, 47, 54, 54, 58, 59, 63,
+            46, 44, 44, 42, 43, 44, 44, 44, 48, 49, 55, 55,
+            59, 61, 65, 67, 48, 46, 46, 44, 45, 45, 45, 46,
+            50, 51, 57, 57, 61, 63, 67, 69, 71, 52, 50, 49,
+            48, 48, 48, 48, 48, 52, 53, 59, 59, 64, 65, 70,
+            72, 74, 78, 54, 51, 51, 49, 49, 50, 49, 49, 53,
+            54, 60, 60, 65, 67, 71, 74, 76, 80, 82, 58, 56,
+            55, 53, 53, 53, 53, 53, 57, 58, 63, 64, 68, 70,
+            75, 77, 80, 84, 86, 91, 59, 56, 56, 54, 54, 54,
+            53, 53, 57, 58, 64, 64, 69, 70, 75, 78, 80, 85,
+            87, 91, 92, 65, 62, 61, 59, 59, 59, 58, 58, 62,
+            63, 68, 68, 73, 75, 79, 82, 85, 90, 92, 97, 98,
+            105, 66, 63, 63, 60, 60, 60, 59, 59, 63, 64, 69,
+            69, 74, 76, 80, 83, 86, 91, 93, 98, 99, 106, 107,
+            71, 68, 67, 65, 65, 64, 63, 63, 67, 68, 73, 73,
+            78, 80, 84, 87, 90, 95, 97, 103, 103, 111, 112, 117,
+            74, 71, 70, 68, 67, 67, 66, 65, 69, 70, 75, 75,
+            80, 82, 86, 89, 93, 97, 100, 105, 106, 114, 115, 120,
+            123, 80, 76, 75, 72, 72, 71, 70, 69, 73, 74, 79,
+            79, 84, 86, 90, 93, 96, 101, 104, 110, 110, 118, 119,
+            125, 128, 134, 81, 77, 77, 74, 73, 73, 71, 71, 74,
+            75, 80, 80, 85, 87, 91, 94, 98, 103, 105, 111, 112,
+            120, 121, 127, 130, 136, 137, 83, 78, 78, 75, 74, 74,
+            72, 72, 75, 76, 81, 81, 86, 88, 92, 95, 99, 104,
+            106, 112, 113, 121, 122, 128, 131, 137, 139, 140, 86, 82,
+            81, 78, 77, 77, 75, 74, 78, 79, 84, 84, 89, 91,
+            95, 98, 101, 106, 109, 115, 116, 124, 125, 131, 135, 140,
+            142, 144, 147, 89, 84, 84, 80, 80, 79, 78, 77, 79,
+            81, 85, 86, 91, 92, 97, 98, 104, 106, 112, 114, 119,
+            123, 128, 132, 135, 142, 145, 148, 149, 153, 91, 86, 86,
+            82, 82, 81, 80, 79, 80, 84, 85, 88, 91, 94, 97,
+            100, 104, 107, 112, 115, 120, 123, 129, 132, 138, 140, 148,
+            150, 153, 154, 159, 93, 88, 88, 84, 84, 83, 83, 80,
+            81, 86, 86, 91, 91, 96, 97, 103, 103, 110, 110, 118,
+            119, 126, 126, 135, 136, 144, 144, 155, 155, 159, 159, 164,
+        },
+        {
+            32, 31, 31, 31, 31, 31, 30, 31, 31, 32, 31, 32,
+            32, 33, 34, 33, 34, 35, 35, 37, 39, 35, 37, 37,
+            38, 39, 41, 44, 36, 38, 39, 40, 41, 43, 46, 47,
+            40, 41, 41, 42, 43, 44, 46, 47, 48, 41, 42, 42,
+            42, 43, 45, 46, 47, 48, 48, 49, 47, 47, 46, 46,
+            47, 47, 48, 50, 50, 53, 49, 47, 47, 46, 46, 47,
+            47, 47, 49, 50, 53, 53, 48, 47, 47, 45, 46, 46,
+            46, 46, 49, 49, 53, 53, 54, 48, 47, 46, 45, 45,
+            46, 46, 46, 49, 49, 53, 53, 54, 55, 49, 47, 46,
+            45, 45, 45, 45, 45, 48, 49, 53, 54, 55, 56, 58,
+            50, 47, 47, 45, 46, 46, 46, 46, 49, 49, 54, 54,
+            56, 57, 59, 60, 50, 48, 48, 46, 46, 46, 46, 46,
+            49, 50, 54, 54, 56, 57, 60, 60, 61, 52, 49, 49,
+            47, 47, 47, 47, 46, 49, 50, 54, 54, 57, 58, 61,
+            62, 63, 65, 52, 50, 49, 47, 47, 47, 47, 47, 49,
+            50, 54, 54, 57, 58, 61, 62, 63, 65, 66, 54, 52,
+            51, 49, 49, 49, 48, 48, 51, 52, 55, 55, 58, 59,
+            62, 63, 65, 67, 68, 70, 54, 52, 51, 49, 49, 49,
+            48, 48, 51, 52, 55, 56, 58, 60, 62, 64, 65, 67,
+            68, 70, 71, 57, 54, 54, 52, 51, 51, 50, 50, 52,
+            53, 56, 57, 60, 61, 63, 65, 67, 69, 70, 73, 73,
+            76, 57, 55, 54, 52, 52, 51, 51, 50, 53, 53, 57,
+            57, 60, 61, 64, 65, 67, 70, 71, 73, 74, 77, 77,
+            60, 57, 56, 54, 54, 53, 52, 52, 54, 55, 58, 59,
+            61, 63, 65, 67, 68, 71, 72, 75, 75, 79, 79, 82,
+            61, 58, 57, 55, 55, 54, 53, 53, 55, 56, 59, 59,
+            62, 63, 66, 68, 69, 72, 73, 76, 76, 80, 80, 83,
+            84, 63, 60, 59, 57, 57, 56, 55, 54, 57, 57, 60,
+            61, 63, 65, 67, 69, 71, 73, 75, 78, 78, 82, 82,
+            85, 86, 89, 64, 61, 60, 58, 57, 57, 56, 55, 57,
+            58, 61, 61, 64, 65, 68, 69, 71, 74, 75, 78, 78,
+            82, 83, 86, 87, 89, 90, 65, 61, 61, 58, 58, 57,
+            56, 55, 58, 58, 61, 62, 64, 65, 68, 70, 71, 74,
+            75, 78, 79, 83, 83, 86, 88, 90, 91, 91, 66, 63,
+            62, 60, 59, 58, 57, 56, 59, 59, 62, 63, 65, 66,
+            69, 70, 72, 75, 76, 79, 80, 84, 84, 87, 89, 91,
+            92, 93, 94, 67, 64, 63, 61, 60, 59, 58, 57, 59,
+            60, 62, 63, 66, 66, 70, 70, 73, 74, 77, 78, 81,
+            83, 85, 87, 89, 92, 93, 94, 94, 96, 68, 64, 64,
+            61, 61, 60, 59, 58, 59, 61, 62, 64, 65, 67, 69,
+            71, 72, 74, 77, 78, 81, 82, 85, 86, 89, 90, 94,
+            94, 96, 96, 98, 69, 65, 65, 62, 62, 61, 61, 58,
+            59, 62, 62, 65, 65, 68, 68, 71, 71, 75, 75, 79,
+            79, 83, 83, 87, 87, 91, 91, 96, 96, 97, 97, 99,
+        },
+    },
+    {
+        {
+            32, 31, 32, 31, 32, 32, 31, 32, 32, 32, 31, 32,
+            32, 32, 32, 31, 32, 32, 32, 32, 33, 31, 32, 32,
+            32, 32, 33, 33, 32, 32, 32, 32, 32, 34, 34, 35,
+            32, 32, 32, 32, 32, 34, 34, 35, 35, 34, 34, 34,
+            33, 33, 35, 35, 37, 37, 39, 34, 34, 34, 33, 33,
+            35, 35, 37, 37, 39, 39, 36, 35, 35, 34, 34, 36,
+            36, 38, 38, 42, 42, 48, 36, 35, 35, 34, 34, 36,
+            36, 38, 38, 42, 42, 48, 48, 39, 38, 38, 37, 37,
+            39, 39, 40, 40, 45, 45, 50, 50, 54, 39, 38, 38,
+            37, 37, 39, 39, 40, 40, 45, 45, 50, 50, 54, 54,
+            44, 42, 42, 41, 41, 42, 42, 42, 42, 47, 47, 54,
+            54, 58, 58, 63, 44, 42, 42, 41, 41, 42, 42, 42,
+            42, 47, 47, 54, 54, 58, 58, 63, 63, 48, 46, 46,
+            44, 44, 45, 45, 46, 46, 51, 51, 57, 57, 61, 61,
+            67, 67, 71, 48, 46, 46, 44, 44, 45, 45, 46, 46,
+            51, 51, 57, 57, 61, 61, 67, 67, 71, 71, 54, 51,
+            51, 49, 49, 50, 50, 49, 49, 54, 54, 60, 60, 65,
+            65, 71, 71, 76, 76, 82, 54, 51, 51, 49, 49, 50,
+            50, 49, 49, 54, 54, 60, 60, 65, 65, 71, 71, 76,
+            76, 82, 82, 59, 56, 56, 54, 54, 54, 54, 53, 53,
+            58, 58, 64, 64, 69, 69, 75, 75, 80, 80, 87, 87,
+            92, 59, 56, 56, 54, 54, 54, 54, 53, 53, 58, 58,
+            64, 64, 69, 69, 75, 75, 80, 80, 87, 87, 92, 92,
+            65, 62, 62, 59, 59, 59, 59, 58, 58, 63, 63, 68,
+            68, 73, 73, 79, 79, 85, 85, 92, 92, 98, 98, 105,
+            65, 62, 62, 59, 59, 59, 59, 58, 58, 63, 63, 68,
+            68, 73, 73, 79, 79, 85, 85, 92, 92, 98, 98, 105,
+            105, 71, 68, 68, 65, 65, 64, 64, 63, 63, 68, 68,
+            73, 73, 78, 78, 84, 84, 90, 90, 97, 97, 103, 103,
+            111, 111, 117, 71, 68, 68, 65, 65, 64, 64, 63, 63,
+            68, 68, 73, 73, 78, 78, 84, 84, 90, 90, 97, 97,
+            103, 103, 111, 111, 117, 117, 80, 76, 76, 72, 72, 71,
+            71, 69, 69, 74, 74, 79, 79, 84, 84, 90, 90, 96,
+            96, 104, 104, 110, 110, 118, 118, 125, 125, 134, 80, 76,
+            76, 72, 72, 71, 71, 69, 69, 74, 74, 79, 79, 84,
+            84, 90, 90, 96, 96, 104, 104, 110, 110, 118, 118, 125,
+            125, 134, 134, 83, 78, 78, 75, 75, 74, 74, 72, 72,
+            76, 76, 81, 81, 86, 86, 92, 92, 99, 99, 106, 106,
+            113, 113, 121, 121, 128, 128, 137, 137, 140, 83, 78, 78,
+            75, 75, 74, 74, 72, 72, 76, 76, 81, 81, 86, 86,
+            92, 92, 99, 99, 106, 106, 113, 113, 121, 121, 128, 128,
+            137, 137, 140, 140, 87, 83, 83, 79, 79, 77, 77, 75,
+            75, 80, 80, 84, 84, 90, 90, 96, 96, 102, 102, 109,
+            109, 116, 116, 124, 124, 132, 132, 141, 141, 144, 144, 149,
+        },
+        {
+            32, 31, 31, 31, 31, 31, 30, 31, 31, 32, 30, 31,
+            31, 32, 32, 33, 34, 34, 35, 35, 39, 33, 34, 34,
+            35, 35, 39, 39, 36, 38, 38, 40, 40, 43, 43, 47,
+            36, 38, 38, 40, 40, 43, 43, 47, 47, 41, 42, 42,
+            42, 42, 45, 45, 47, 47, 48, 41, 42, 42, 42, 42,
+            45, 45, 47, 47, 48, 48, 49, 47, 47, 46, 46, 47,
+            47, 48, 48, 50, 50, 53, 49, 47, 47, 46, 46, 47,
+            47, 48, 48, 50, 50, 53, 53, 48, 47, 47, 45, 45,
+            46, 46, 46, 46, 49, 49, 53, 53, 54, 48, 47, 47,
+            45, 45, 46, 46, 46, 46, 49, 49, 53, 53, 54, 54,
+            49, 47, 47, 45, 45, 45, 45, 45, 45, 49, 49, 53,
+            53, 55, 55, 58, 49, 47, 47, 45, 45, 45, 45, 45,
+            45, 49, 49, 53, 53, 55, 55, 58, 58, 50, 48, 48,
+            46, 46, 46, 46, 46, 46, 50, 50, 54, 54, 56, 56,
+            60, 60, 61, 50, 48, 48, 46, 46, 46, 46, 46, 46,
+            50, 50, 54, 54, 56, 56, 60, 60, 61, 61, 52, 50,
+            50, 47, 47, 47, 47, 47, 47, 50, 50, 54, 54, 57,
+            57, 61, 61, 63, 63, 66, 52, 50, 50, 47, 47, 47,
+            47, 47, 47, 50, 50, 54, 54, 57, 57, 61, 61, 63,
+            63, 66, 66, 54, 52, 52, 49, 49, 49, 49, 48, 48,
+            52, 52, 55, 55, 58, 58, 62, 62, 65, 65, 68, 68,
+            71, 54, 52, 52, 49, 49, 49, 49, 48, 48, 52, 52,
+            55, 55, 58, 58, 62, 62, 65, 65, 68, 68, 71, 71,
+            57, 54, 54, 52, 52, 51, 51, 50, 50, 53, 53, 56,
+            56, 60, 60, 63, 63, 67, 67, 70, 70, 73, 73, 76,
+            57, 54, 54, 52, 52, 51, 51, 50, 50, 53, 53, 56,
+            56, 60, 60, 63, 63, 67, 67, 70, 70, 73, 73, 76,
+            76, 60, 57, 57, 54, 54, 53, 53, 52, 52, 55, 55,
+            58, 58, 61, 61, 65, 65, 68, 68, 72, 72, 75, 75,
+            79, 79, 82, 60, 57, 57, 54, 54, 53, 53, 52, 52,
+            55, 55, 58, 58, 61, 61, 65, 65, 68, 68, 72, 72,
+            75, 75, 79, 79, 82, 82, 63, 60, 60, 57, 57, 56,
+            56, 54, 54, 57, 57, 60, 60, 63, 63, 67, 67, 71,
+            71, 75, 75, 78, 78, 82, 82, 85, 85, 89, 63, 60,
+            60, 57, 57, 56, 56, 54, 54, 57, 57, 60, 60, 63,
+            63, 67, 67, 71, 71, 75, 75, 78, 78, 82, 82, 85,
+            85, 89, 89, 65, 61, 61, 58, 58, 57, 57, 55, 55,
+            58, 58, 61, 61, 64, 64, 68, 68, 71, 71, 75, 75,
+            79, 79, 83, 83, 86, 86, 90, 90, 91, 65, 61, 61,
+            58, 58, 57, 57, 55, 55, 58, 58, 61, 61, 64, 64,
+            68, 68, 71, 71, 75, 75, 79, 79, 83, 83, 86, 86,
+            90, 90, 91, 91, 67, 63, 63, 60, 60, 59, 59, 57,
+            57, 60, 60, 62, 62, 66, 66, 69, 69, 72, 72, 76,
+            76, 80, 80, 84, 84, 88, 88, 92, 92, 93, 93, 95,
+        },
+    },
+    {
+        {
+            32, 31, 31, 31, 32, 32, 31, 32, 32, 32, 31, 32,
+            32, 32, 32, 31, 32, 32, 32, 32, 32, 31, 32, 32,
+            32, 32, 33, 33, 32, 32, 32, 32, 32, 33, 33, 34,
+            32, 32, 32, 32, 32, 33, 34, 34, 35, 32, 32, 32,
+            32, 33, 33, 34, 34, 35, 35, 34, 34, 34, 33, 33,
+            34, 35, 35, 37, 37, 39, 34, 34, 34, 33, 33, 34,
+            35, 35, 37, 37, 39, 39, 35, 35, 35, 34, 34, 35,
+            36, 36, 38, 38, 42, 42, 46, 36, 35, 35, 34, 34,
+            35, 36, 37, 38, 38, 42, 42, 47, 48, 38, 37, 37,
+            36, 36, 37, 38, 38, 39, 40, 44, 44, 48, 50, 51,
+            39, 38, 38, 38, 37, 38, 39, 39, 40, 41, 45, 45,
+            49, 50, 52, 54, 41, 40, 40, 39, 38, 39, 40, 40,
+            41, 41, 46, 46, 50, 52, 54, 55, 57, 44, 42, 42,
+            41, 41, 41, 42, 42, 42, 43, 47, 47, 52, 54, 56,
+            58, 60, 63, 45, 43, 43, 42, 41, 42, 42, 43, 43,
+            43, 48, 48, 53, 54, 57, 58, 60, 64, 65, 48, 46,
+            46, 45, 44, 45, 45, 45, 46, 46, 51, 51, 55, 57,
+            59, 61, 63, 67, 68, 71, 48, 46, 46, 45, 44, 45,
+            45, 45, 46, 46, 51, 51, 55, 57, 59, 61, 63, 67,
+            68, 71, 71, 53, 51, 51, 49, 49, 49, 49, 49, 49,
+            49, 54, 54, 58, 59, 62, 64, 67, 71, 72, 75, 75,
+            81, 54, 52, 51, 50, 49, 49, 50, 49, 49, 50, 54,
+            54, 59, 60, 63, 65, 67, 71, 72, 76, 76, 81, 82,
+            57, 55, 55, 53, 52, 52, 52, 52, 52, 52, 57, 57,
+            61, 62, 65, 67, 70, 74, 75, 79, 79, 85, 85, 89,
+            59, 56, 56, 54, 54, 54, 54, 54, 53, 54, 58, 58,
+            62, 64, 67, 69, 71, 75, 76, 80, 80, 86, 87, 90,
+            92, 62, 59, 59, 57, 56, 56, 56, 56, 55, 56, 60,
+            60, 64, 66, 69, 71, 73, 77, 78, 83, 83, 89, 89,
+            93, 95, 98, 65, 62, 62, 60, 59, 59, 59, 59, 58,
+            58, 63, 63, 67, 68, 71, 73, 75, 79, 81, 85, 85,
+            91, 92, 96, 98, 101, 105, 67, 64, 64, 62, 61, 61,
+            60, 60, 59, 60, 64, 64, 68, 69, 72, 74, 77, 81,
+            82, 87, 87, 93, 94, 98, 99, 103, 106, 108, 71, 68,
+            68, 66, 65, 64, 64, 64, 63, 63, 68, 68, 72, 73,
+            76, 78, 80, 84, 85, 90, 90, 97, 97, 102, 103, 107,
+            111, 113, 117, 72, 69, 69, 66, 65, 65, 65, 64, 63,
+            64, 68, 68, 72, 73, 76, 78, 81, 85, 86, 91, 91,
+            97, 98, 102, 104, 108, 111, 113, 118, 119, 80, 76, 76,
+            73, 72, 72, 71, 70, 69, 70, 74, 74, 78, 79, 82,
+            84, 86, 90, 91, 96, 96, 103, 104, 108, 110, 114, 118,
+            120, 125, 126, 134, 80, 76, 76, 73, 72, 72, 71, 70,
+            69, 70, 74, 74, 78, 79, 82, 84, 86, 90, 91, 96,
+            96, 103, 104, 108, 110, 114, 118, 120, 125, 126, 134, 134,
+        },
+        {
+            32, 31, 31, 31, 31, 31, 30, 31, 31, 31, 30, 31,
+            31, 31, 32, 32, 32, 33, 33, 33, 35, 33, 34, 34,
+            35, 35, 37, 39, 34, 35, 35, 36, 36, 38, 40, 41,
+            36, 38, 38, 39, 40, 41, 43, 44, 47, 37, 38, 39,
+            40, 40, 42, 43, 44, 47, 47, 41, 42, 42, 42, 42,
+            43, 45, 45, 47, 47, 48, 41, 42, 42, 42, 42, 43,
+            45, 45, 47, 47, 48, 48, 47, 46, 46, 46, 45, 46,
+            47, 47, 47, 48, 50, 50, 52, 49, 48, 47, 47, 46,
+            47, 47, 47, 48, 48, 50, 50, 52, 53, 49, 47, 47,
+            46, 46, 46, 46, 47, 47, 47, 50, 50, 52, 53, 53,
+            48, 47, 47, 46, 45, 46, 46, 46, 46, 47, 49, 49,
+            52, 53, 54, 54, 49, 47, 47, 46, 45, 45, 46, 46,
+            46, 46, 49, 49, 52, 53, 54, 55, 55, 49, 47, 47,
+            45, 45, 45, 45, 45, 45, 45, 49, 49, 52, 53, 55,
+            55, 57, 58, 49, 47, 47, 46, 45, 45, 45, 45, 45,
+            46, 49, 49, 52, 53, 55, 56, 57, 59, 59, 50, 48,
+            48, 47, 46, 46, 46, 46, 46, 46, 50, 50, 53, 54,
+            55, 56, 58, 60, 60, 61, 50, 48, 48, 47, 46, 46,
+            46, 46, 46, 46, 50, 50, 53, 54, 55, 56, 58, 60,
+            60, 61, 61, 52, 50, 49, 48, 47, 47, 47, 47, 46,
+            47, 50, 50, 53, 54, 56, 57, 59, 61, 61, 63, 63,
+            66, 52, 50, 50, 48, 47, 47, 47, 47, 47, 47, 50,
+            50, 53, 54, 56, 57, 59, 61, 61, 63, 63, 66, 66,
+            54, 51, 51, 50, 49, 49, 49, 48, 48, 48, 51, 51,
+            54, 55, 57, 58, 60, 62, 62, 65, 65, 67, 68, 69,
+            54, 52, 52, 50, 49, 49, 49, 49, 48, 48, 52, 52,
+            55, 55, 57, 58, 60, 62, 63, 65, 65, 68, 68, 70,
+            71, 56, 53, 53, 51, 51, 50, 50, 50, 49, 49, 52,
+            52, 55, 56, 58, 59, 61, 63, 63, 66, 66, 69, 69,
+            71, 72, 73, 57, 54, 54, 52, 52, 51, 51, 51, 50,
+            50, 53, 53, 56, 56, 58, 60, 61, 63, 64, 67, 67,
+            70, 70, 72, 73, 75, 76, 58, 55, 55, 53, 52, 52,
+            52, 51, 50, 51, 54, 54, 56, 57, 59, 60, 62, 64,
+            65, 67, 67, 71, 71, 73, 74, 75, 77, 78, 60, 57,
+            57, 55, 54, 54, 53, 53, 52, 52, 55, 55, 58, 58,
+            60, 61, 63, 65, 66, 68, 68, 72, 72, 74, 75, 77,
+            79, 80, 82, 60, 57, 57, 55, 54, 54, 54, 53, 52,
+            52, 55, 55, 58, 58, 60, 62, 63, 65, 66, 69, 69,
+            72, 73, 75, 76, 77, 79, 80, 82, 82, 63, 60, 60,
+            58, 57, 57, 56, 55, 54, 55, 57, 57, 60, 60, 62,
+            63, 65, 67, 68, 71, 71, 74, 75, 77, 78, 80, 82,
+            83, 85, 85, 89, 63, 60, 60, 58, 57, 57, 56, 55,
+            54, 55, 57, 57, 60, 60, 62, 63, 65, 67, 68, 71,
+            71, 74, 75, 77, 78, 80, 82, 83, 85, 85, 89, 89,
+        },
+    },
+    {
+        {
+            32, 31, 31, 31, 31, 32, 31, 32, 32, 32, 31, 32,
+            32, 32, 32, 31, 32, 32, 32, 32, 32, 31, 32, 32,
+            32, 32, 32, 33, 31, 32, 32, 32, 32, 32, 33, 33,
+            32, 32, 32, 32, 32, 32, 33, 33, 34, 32, 32, 32,
+            32, 32, 32, 33, 34, 34, 35, 32, 32, 32, 32, 32,
+            32, 33, 34, 34, 35, 35, 33, 33, 33, 33, 33, 33,
+            34, 35, 35, 36, 36, 38, 34, 34, 34, 34, 33, 33,
+            35, 35, 36, 37, 37, 39, 39, 34, 34, 34, 34, 34,
+            34, 35, 36, 36, 37, 37, 40, 41, 42, 36, 35, 35,
+            35, 34, 34, 36, 36, 37, 38, 38, 42, 42, 45, 48,
+            36, 35, 35, 35, 34, 34, 36, 36, 37, 38, 38, 42,
+            42, 45, 48, 48, 38, 38, 38, 37, 37, 37, 38, 38,
+            39, 40, 40, 43, 44, 46, 50, 50, 52, 39, 38, 38,
+            38, 37, 37, 39, 39, 39, 40, 40, 44, 45, 47, 50,
+            50, 53, 54, 41, 40, 40, 39, 38, 38, 40, 40, 40,
+            41, 41, 45, 46, 48, 52, 52, 54, 55, 57, 44, 42,
+            42, 42, 41, 41, 42, 42, 42, 42, 42, 46, 47, 50,
+            54, 54, 57, 58, 60, 63, 44, 42, 42, 42, 41, 41,
+            42, 42, 42, 42, 42, 46, 47, 50, 54, 54, 57, 58,
+            60, 63, 63, 47, 46, 45, 45, 44, 44, 44, 45, 45,
+            45, 45, 49, 50, 52, 56, 56, 59, 60, 62, 66, 66,
+            69, 48, 47, 46, 45, 44, 44, 45, 45, 45, 46, 46,
+            50, 51, 53, 57, 57, 60, 61, 63, 67, 67, 70, 71,
+            50, 49, 48, 47, 46, 46, 47, 47, 47, 47, 47, 51,
+            52, 54, 58, 58, 61, 62, 65, 68, 68, 72, 73, 75,
+            54, 52, 51, 50, 49, 49, 49, 50, 49, 49, 49, 53,
+            54, 56, 60, 60, 64, 65, 67, 71, 71, 75, 76, 78,
+            82, 54, 52, 51, 50, 49, 49, 49, 50, 49, 49, 49,
+            53, 54, 56, 60, 60, 64, 65, 67, 71, 71, 75, 76,
+            78, 82, 82, 58, 56, 55, 54, 53, 53, 53, 53, 53,
+            52, 52, 56, 57, 59, 63, 63, 67, 68, 70, 74, 74,
+            78, 79, 82, 86, 86, 90, 59, 57, 56, 55, 54, 54,
+            54, 54, 54, 53, 53, 57, 58, 60, 64, 64, 68, 69,
+            71, 75, 75, 79, 80, 83, 87, 87, 91, 92, 61, 59,
+            58, 57, 56, 56, 56, 56, 55, 55, 55, 59, 60, 62,
+            65, 65, 69, 70, 73, 77, 77, 81, 82, 85, 89, 89,
+            93, 94, 97, 65, 63, 62, 61, 59, 59, 59, 59, 59,
+            58, 58, 62, 63, 65, 68, 68, 72, 73, 75, 79, 79,
+            84, 85, 88, 92, 92, 97, 98, 101, 105, 65, 63, 62,
+            61, 59, 59, 59, 59, 59, 58, 58, 62, 63, 65, 68,
+            68, 72, 73, 75, 79, 79, 84, 85, 88, 92, 92, 97,
+            98, 101, 105, 105, 70, 67, 67, 65, 64, 64, 63, 63,
+            63, 62, 62, 66, 67, 69, 72, 72, 76, 77, 79, 83,
+            83, 88, 89, 92, 96, 96, 101, 102, 105, 109, 109, 114,
+        },
+        {
+            32, 31, 31, 31, 31, 31, 31, 31, 31, 31, 30, 31,
+            31, 31, 32, 30, 31, 31, 31, 32, 32, 33, 33, 34,
+            34, 34, 34, 37, 33, 34, 34, 35, 35, 35, 38, 39,
+            34, 36, 36, 36, 37, 37, 40, 40, 42, 36, 38, 38,
+            39, 40, 40, 42, 43, 45, 47, 36, 38, 38, 39, 40,
+            40, 42, 43, 45, 47, 47, 40, 41, 41, 41, 42, 42,
+            44, 44, 45, 47, 47, 48, 41, 42, 42, 42, 42, 42,
+            44, 45, 46, 47, 47, 48, 48, 44, 44, 44, 44, 44,
+            44, 45, 46, 46, 47, 47, 49, 49, 50, 49, 48, 47,
+            47, 46, 46, 47, 47, 47, 48, 48, 50, 50, 51, 53,
+            49, 48, 47, 47, 46, 46, 47, 47, 47, 48, 48, 50,
+            50, 51, 53, 53, 48, 47, 47, 46, 45, 45, 46, 46,
+            46, 47, 47, 49, 50, 51, 53, 53, 54, 48, 47, 47,
+            46, 45, 45, 46, 46, 46, 46, 46, 49, 49, 51, 53,
+            53, 54, 54, 49, 47, 47, 46, 45, 45, 46, 46, 46,
+            46, 46, 49, 49, 51, 53, 53, 54, 55, 55, 49, 47,
+            47, 46, 45, 45, 45, 45, 45, 45, 45, 48, 49, 51,
+            53, 53, 55, 55, 57, 58, 49, 47, 47, 46, 45, 45,
+            45, 45, 45, 45, 45, 48, 49, 51, 53, 53, 55, 55,
+            57, 58, 58, 50, 48, 48, 47, 46, 46, 46, 46, 46,
+            46, 46, 49, 50, 51, 54, 54, 56, 56, 57, 59, 59,
+            61, 50, 49, 48, 47, 46, 46, 46, 46, 46, 46, 46,
+            49, 50, 51, 54, 54, 56, 56, 58, 60, 60, 61, 61,
+            51, 49, 49, 48, 47, 47, 47, 47, 47, 46, 46, 49,
+            50, 51, 54, 54, 56, 57, 58, 60, 60, 62, 62, 63,
+            52, 50, 50, 49, 47, 47, 47, 47, 47, 47, 47, 49,
+            50, 52, 54, 54, 57, 57, 59, 61, 61, 63, 63, 65,
+            66, 52, 50, 50, 49, 47, 47, 47, 47, 47, 47, 47,
+            49, 50, 52, 54, 54, 57, 57, 59, 61, 61, 63, 63,
+            65, 66, 66, 54, 52, 51, 50, 49, 49, 49, 49, 48,
+            48, 48, 51, 51, 53, 55, 55, 58, 58, 60, 62, 62,
+            64, 65, 66, 68, 68, 70, 54, 52, 52, 51, 49, 49,
+            49, 49, 49, 48, 48, 51, 52, 53, 55, 55, 58, 58,
+            60, 62, 62, 64, 65, 66, 68, 68, 70, 71, 55, 53,
+            53, 52, 50, 50, 50, 50, 49, 49, 49, 51, 52, 54,
+            56, 56, 58, 59, 60, 63, 63, 65, 66, 67, 69, 69,
+            71, 72, 73, 57, 55, 54, 53, 52, 52, 51, 51, 50,
+            50, 50, 52, 53, 54, 56, 56, 59, 60, 61, 63, 63,
+            66, 67, 68, 70, 70, 73, 73, 74, 76, 57, 55, 54,
+            53, 52, 52, 51, 51, 50, 50, 50, 52, 53, 54, 56,
+            56, 59, 60, 61, 63, 63, 66, 67, 68, 70, 70, 73,
+            73, 74, 76, 76, 59, 57, 56, 55, 54, 54, 53, 53,
+            52, 51, 51, 54, 55, 56, 58, 58, 60, 61, 63, 65,
+            65, 67, 68, 70, 72, 72, 74, 75, 76, 78, 78, 80,
+        },
+    },
+    {
+        {
+            32, 31, 31, 31, 31, 32, 31, 31, 32, 32, 31, 32,
+            32, 32, 32, 31, 32, 32, 32, 32, 32, 31, 32, 32,
+            32, 32, 32, 32, 31, 32, 32, 32, 32, 32, 32, 33,
+            31, 32, 32, 32, 32, 32, 32, 33, 33, 32, 32, 32,
+            32, 32, 32, 33, 33, 33, 34, 32, 32, 32, 32, 32,
+            32, 33, 34, 34, 34, 35, 32, 32, 32, 32, 32, 32,
+            33, 34, 34, 34, 35, 35, 32, 33, 33, 33, 33, 33,
+            33, 34, 34, 35, 36, 36, 36, 34, 34, 34, 34, 33,
+            33, 34, 35, 35, 35, 37, 37, 38, 39, 34, 34, 34,
+            34, 33, 33, 34, 35, 35, 35, 37, 37, 38, 39, 39,
+            35, 34, 34, 34, 34, 34, 34, 35, 36, 36, 37, 37,
+            39, 41, 41, 43, 36, 35, 35, 35, 34, 34, 35, 36,
+            36, 37, 38, 38, 40, 42, 42, 45, 48, 36, 35, 35,
+            35, 34, 34, 35, 36, 36, 37, 38, 38, 40, 42, 42,
+            45, 48, 48, 38, 37, 37, 37, 36, 36, 36, 38, 38,
+            38, 39, 39, 41, 44, 44, 47, 50, 50, 51, 39, 39,
+            38, 38, 37, 37, 38, 39, 39, 39, 40, 40, 42, 45,
+            45, 47, 50, 50, 52, 54, 39, 39, 38, 38, 37, 37,
+            38, 39, 39, 39, 40, 40, 42, 45, 45, 47, 50, 50,
+            52, 54, 54, 42, 41, 41, 41, 40, 40, 40, 41, 41,
+            41, 42, 42, 44, 47, 47, 49, 53, 53, 55, 56, 56,
+            60, 44, 43, 42, 42, 41, 41, 41, 42, 42, 42, 42,
+            42, 44, 47, 47, 50, 54, 54, 56, 58, 58, 61, 63,
+            44, 43, 43, 42, 41, 41, 41, 42, 42, 42, 43, 43,
+            45, 48, 48, 51, 54, 54, 56, 58, 58, 62, 64, 64,
+            47, 46, 45, 45, 44, 44, 44, 44, 45, 45, 45, 45,
+            47, 50, 50, 53, 56, 56, 58, 60, 60, 64, 66, 66,
+            69, 48, 47, 46, 46, 45, 44, 45, 45, 45, 45, 46,
+            46, 47, 51, 51, 53, 57, 57, 59, 61, 61, 65, 67,
+            67, 70, 71, 49, 48, 47, 47, 46, 45, 45, 46, 46,
+            46, 46, 46, 48, 51, 51, 54, 57, 57, 60, 62, 62,
+            66, 68, 68, 71, 72, 73, 53, 51, 51, 51, 49, 49,
+            49, 49, 49, 49, 49, 49, 51, 54, 54, 57, 59, 59,
+            62, 64, 64, 69, 71, 71, 74, 75, 77, 81, 54, 52,
+            51, 51, 50, 49, 49, 50, 50, 49, 49, 49, 51, 54,
+            54, 57, 60, 60, 63, 65, 65, 69, 71, 72, 75, 76,
+            77, 81, 82, 55, 53, 53, 52, 51, 50, 50, 51, 51,
+            51, 50, 50, 52, 55, 55, 58, 61, 61, 64, 66, 66,
+            70, 72, 73, 76, 77, 78, 83, 83, 85, 59, 57, 56,
+            56, 54, 54, 54, 54, 54, 54, 53, 53, 55, 58, 58,
+            61, 64, 64, 67, 69, 69, 73, 75, 76, 79, 80, 81,
+            86, 87, 88, 92, 59, 57, 56, 56, 54, 54, 54, 54,
+            54, 54, 53, 53, 55, 58, 58, 61, 64, 64, 67, 69,
+            69, 73, 75, 76, 79, 80, 81, 86, 87, 88, 92, 92,
+        },
+        {
+            32, 31, 31, 31, 31, 31, 31, 31, 31, 31, 30, 31,
+            31, 31, 31, 30, 31, 31, 31, 31, 32, 31, 31, 32,
+            32, 32, 32, 33, 33, 34, 34, 34, 35, 35, 35, 38,
+            33, 34, 34, 34, 35, 35, 36, 38, 39, 34, 35, 35,
+            36, 36, 36, 37, 40, 40, 41, 36, 38, 38, 38, 39,
+            40, 40, 43, 43, 44, 47, 36, 38, 38, 38, 39, 40,
+            40, 43, 43, 44, 47, 47, 38, 39, 40, 40, 41, 41,
+            41, 43, 44, 45, 47, 47, 47, 41, 42, 42, 42, 42,
+            42, 43, 44, 45, 45, 47, 47, 48, 48, 41, 42, 42,
+            42, 42, 42, 43, 44, 45, 45, 47, 47, 48, 48, 48,
+            45, 45, 45, 45, 44, 44, 44, 46, 46, 46, 47, 47,
+            48, 49, 49, 50, 49, 48, 47, 47, 46, 46, 46, 47,
+            47, 47, 48, 48, 49, 50, 50, 51, 53, 49, 48, 47,
+            47, 46, 46, 46, 47, 47, 47, 48, 48, 49, 50, 50,
+            51, 53, 53, 49, 47, 47, 47, 46, 46, 46, 46, 46,
+            47, 47, 47, 48, 50, 50, 51, 53, 53, 53, 48, 47,
+            47, 47, 46, 45, 45, 46, 46, 46, 46, 46, 48, 49,
+            49, 51, 53, 53, 54, 54, 48, 47, 47, 47, 46, 45,
+            45, 46, 46, 46, 46, 46, 48, 49, 49, 51, 53, 53,
+            54, 54, 54, 49, 47, 47, 47, 45, 45, 45, 45, 45,
+            45, 45, 45, 47, 49, 49, 51, 53, 53, 54, 55, 55,
+            57, 49, 47, 47, 46, 45, 45, 45, 45, 45, 45, 45,
+            45, 47, 49, 49, 51, 53, 53, 55, 55, 55, 57, 58,
+            49, 47, 47, 47, 45, 45, 45, 45, 45, 45, 45, 45,
+            47, 49, 49, 51, 53, 53, 55, 56, 56, 58, 58, 59,
+            50, 49, 48, 48, 46, 46, 46, 46, 46, 46, 46, 46,
+            47, 50, 50, 52, 54, 54, 55, 56, 56, 58, 59, 59,
+            61, 50, 49, 48, 48, 47, 46, 46, 46, 46, 46, 46,
+            46, 47, 50, 50, 52, 54, 54, 55, 56, 56, 59, 60,
+            60, 61, 61, 51, 49, 48, 48, 47, 46, 46, 47, 47,
+            46, 46, 46, 47, 50, 50, 52, 54, 54, 55, 56, 56,
+            59, 60, 60, 61, 62, 62, 52, 50, 49, 49, 48, 47,
+            47, 47, 47, 47, 46, 46, 48, 50, 50, 52, 54, 54,
+            56, 57, 57, 60, 61, 61, 63, 63, 64, 66, 52, 50,
+            50, 49, 48, 47, 47, 47, 47, 47, 47, 47, 48, 50,
+            50, 52, 54, 54, 56, 57, 57, 60, 61, 61, 63, 63,
+            64, 66, 66, 53, 51, 50, 50, 48, 48, 48, 48, 48,
+            48, 47, 47, 48, 51, 51, 52, 54, 54, 56, 58, 58,
+            60, 61, 62, 63, 64, 64, 67, 67, 68, 54, 53, 52,
+            52, 50, 49, 49, 49, 49, 49, 48, 48, 49, 52, 52,
+            53, 55, 55, 57, 58, 58, 61, 62, 63, 64, 65, 66,
+            68, 68, 69, 71, 54, 53, 52, 52, 50, 49, 49, 49,
+            49, 49, 48, 48, 49, 52, 52, 53, 55, 55, 57, 58,
+            58, 61, 62, 63, 64, 65, 66, 68, 68, 69, 71, 71,
+        },
+    },
+    {
+        {
+            32, 31, 31, 31, 31, 32, 31, 31, 32, 32, 31, 31,
+            32, 32, 32, 31, 31, 32, 32, 32, 32, 31, 31, 32,
+            32, 32, 32, 32, 31, 32, 32, 32, 32, 32, 32, 32,
+            31, 32, 32, 32, 32, 32, 32, 32, 33, 31, 32, 32,
+            32, 32, 32, 32, 32, 33, 33, 31, 32, 32, 32, 32,
+            32, 32, 32, 33, 33, 33, 32, 32, 32, 32, 32, 32,
+            32, 33, 33, 33, 33, 34, 32, 32, 32, 32, 32, 32,
+            32, 33, 33, 34, 34, 35, 35, 32, 32, 32, 32, 32,
+            32, 32, 33, 33, 34, 34, 35, 35, 35, 32, 33, 33,
+            33, 33, 33, 33, 33, 34, 34, 34, 35, 36, 36, 36,
+            34, 34, 34, 34, 34, 33, 33, 34, 35, 35, 35, 36,
+            37, 37, 38, 39, 34, 34, 34, 34, 34, 33, 33, 34,
+            35, 35, 35, 36, 37, 37, 38, 39, 39, 34, 34, 34,
+            34, 34, 34, 34, 34, 35, 35, 35, 36, 37, 37, 38,
+            40, 40, 41, 35, 35, 35, 35, 34, 34, 34, 34, 36,
+            36, 36, 37, 38, 38, 39, 42, 42, 43, 46, 36, 35,
+            35, 35, 35, 34, 34, 35, 36, 36, 36, 37, 38, 38,
+            40, 42, 42, 44, 47, 48, 36, 35, 35, 35, 35, 34,
+            34, 35, 36, 36, 36, 37, 38, 38, 40, 42, 42, 44,
+            47, 48, 48, 38, 37, 37, 37, 36, 36, 36, 36, 37,
+            38, 38, 39, 39, 39, 41, 44, 44, 45, 48, 50, 50,
+            51, 39, 39, 38, 38, 38, 37, 37, 38, 39, 39, 39,
+            40, 40, 40, 42, 45, 45, 46, 49, 50, 50, 52, 54,
+            39, 39, 38, 38, 38, 37, 37, 38, 39, 39, 39, 40,
+            40, 40, 42, 45, 45, 46, 49, 50, 50, 52, 54, 54,
+            41, 40, 40, 40, 39, 38, 38, 39, 40, 40, 40, 41,
+            41, 41, 43, 46, 46, 47, 50, 52, 52, 54, 55, 55,
+            57, 44, 43, 42, 42, 42, 41, 41, 41, 42, 42, 42,
+            42, 42, 42, 44, 47, 47, 49, 52, 54, 54, 56, 58,
+            58, 60, 63, 44, 43, 42, 42, 42, 41, 41, 41, 42,
+            42, 42, 42, 42, 42, 44, 47, 47, 49, 52, 54, 54,
+            56, 58, 58, 60, 63, 63, 45, 44, 43, 43, 42, 41,
+            41, 42, 42, 42, 42, 43, 43, 43, 45, 48, 48, 49,
+            53, 54, 54, 57, 58, 58, 60, 64, 64, 65, 47, 46,
+            45, 45, 45, 44, 44, 44, 44, 45, 45, 45, 45, 45,
+            47, 50, 50, 51, 55, 56, 56, 58, 60, 60, 62, 66,
+            66, 67, 69, 48, 47, 46, 46, 45, 44, 44, 45, 45,
+            45, 45, 45, 46, 46, 47, 51, 51, 52, 55, 57, 57,
+            59, 61, 61, 63, 67, 67, 68, 70, 71, 48, 47, 46,
+            46, 45, 44, 44, 45, 45, 45, 45, 45, 46, 46, 47,
+            51, 51, 52, 55, 57, 57, 59, 61, 61, 63, 67, 67,
+            68, 70, 71, 71, 51, 50, 49, 49, 48, 47, 47, 47,
+            48, 48, 48, 48, 48, 48, 50, 53, 53, 54, 57, 58,
+            58, 61, 63, 63, 66, 69, 69, 70, 73, 74, 74, 77,
+        },
+        {
+            32, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 30, 31, 31, 31, 31, 32, 30, 31, 31,
+            31, 31, 32, 32, 31, 31, 32, 32, 32, 32, 32, 33,
+            33, 33, 34, 34, 34, 34, 34, 35, 37, 33, 34, 34,
+            34, 35, 35, 35, 36, 38, 39, 33, 34, 34, 34, 35,
+            35, 35, 36, 38, 39, 39, 35, 36, 37, 37, 37, 38,
+            38, 38, 41, 41, 41, 44, 36, 37, 38, 38, 39, 40,
+            40, 40, 42, 43, 43, 46, 47, 36, 37, 38, 38, 39,
+            40, 40, 40, 42, 43, 43, 46, 47, 47, 38, 39, 40,
+            40, 40, 41, 41, 41, 43, 44, 44, 46, 47, 47, 47,
+            41, 42, 42, 42, 42, 42, 42, 43, 44, 45, 45, 46,
+            47, 47, 48, 48, 41, 42, 42, 42, 42, 42, 42, 43,
+            44, 45, 45, 46, 47, 47, 48, 48, 48, 43, 43, 43,
+            43, 43, 43, 43, 43, 45, 45, 45, 46, 47, 47, 48,
+            49, 49, 49, 47, 47, 46, 46, 46, 45, 45, 46, 46,
+            47, 47, 47, 47, 47, 48, 50, 50, 50, 52, 49, 48,
+            47, 47, 47, 46, 46, 46, 47, 47, 47, 47, 48, 48,
+            49, 50, 50, 51, 52, 53, 49, 48, 47, 47, 47, 46,
+            46, 46, 47, 47, 47, 47, 48, 48, 49, 50, 50, 51,
+            52, 53, 53, 49, 48, 47, 47, 46, 46, 46, 46, 46,
+            46, 46, 47, 47, 47, 48, 50, 50, 50, 52, 53, 53,
+            53, 48, 47, 47, 47, 46, 45, 45, 45, 46, 46, 46,
+            46, 46, 46, 48, 49, 49, 50, 52, 53, 53, 54, 54,
+            48, 47, 47, 47, 46, 45, 45, 45, 46, 46, 46, 46,
+            46, 46, 48, 49, 49, 50, 52, 53, 53, 54, 54, 54,
+            49, 47, 47, 47, 46, 45, 45, 45, 46, 46, 46, 46,
+            46, 46, 47, 49, 49, 50, 52, 53, 53, 54, 55, 55,
+            55, 49, 47, 47, 47, 46, 45, 45, 45, 45, 45, 45,
+            45, 45, 45, 47, 49, 49, 50, 52, 53, 53, 55, 55,
+            55, 57, 58, 49, 47, 47, 47, 46, 45, 45, 45, 45,
+            45, 45, 45, 45, 45, 47, 49, 49, 50, 52, 53, 53,
+            55, 55, 55, 57, 58, 58, 49, 48, 47, 47, 46, 45,
+            45, 45, 45, 45, 45, 45, 45, 45, 47, 49, 49, 50,
+            52, 53, 53, 55, 56, 56, 57, 59, 59, 59, 50, 49,
+            48, 48, 47, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+            47, 50, 50, 50, 53, 54, 54, 55, 56, 56, 57, 59,
+            59, 60, 61, 50, 49, 48, 48, 47, 46, 46, 46, 46,
+            46, 46, 46, 46, 46, 47, 50, 50, 50, 53, 54, 54,
+            55, 56, 56, 58, 60, 60, 60, 61, 61, 50, 49, 48,
+            48, 47, 46, 46, 46, 46, 46, 46, 46, 46, 46, 47,
+            50, 50, 50, 53, 54, 54, 55, 56, 56, 58, 60, 60,
+            60, 61, 61, 61, 51, 50, 49, 49, 48, 47, 47, 47,
+            47, 47, 47, 47, 46, 46, 48, 50, 50, 51, 53, 54,
+            54, 56, 57, 57, 58, 60, 60, 61, 62, 63, 63, 64,
+        },
+    },
+    {
+        {
+            32, 31, 31, 31, 31, 32, 31, 31, 32, 32, 31, 31,
+            32, 32, 32, 31, 31, 32, 32, 32, 32, 31, 31, 32,
+            32, 32, 32, 32, 31, 31, 32, 32, 32, 32, 32, 32,
+            31, 31, 32, 32, 32, 32, 32, 32, 32, 31, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 31, 32, 32, 32, 32,
+            32, 32, 32, 32, 33, 33, 31, 32, 32, 32, 32, 32,
+            32, 32, 32, 33, 33, 33, 31, 32, 32, 32, 32, 32,
+            32, 32, 32, 33, 33, 33, 33, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 33, 33, 33, 33, 34, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 33, 34, 34, 34, 34, 35,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 33, 34, 34,
+            34, 34, 35, 35, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 33, 34, 34, 34, 34, 35, 35, 35, 33, 33, 33,
+            33, 33, 33, 33, 33, 33, 34, 34, 34, 34, 35, 36,
+            36, 36, 37, 34, 34, 34, 34, 34, 34, 33, 33, 33,
+            34, 35, 35, 35, 36, 37, 37, 37, 38, 39, 34, 34,
+            34, 34, 34, 34, 33, 33, 33, 34, 35, 35, 35, 36,
+            37, 37, 37, 38, 39, 39, 34, 34, 34, 34, 34, 34,
+            33, 33, 33, 34, 35, 35, 35, 36, 37, 37, 37, 38,
+            39, 39, 39, 35, 34, 34, 34, 34, 34, 34, 34, 34,
+            35, 36, 36, 36, 36, 37, 37, 37, 39, 41, 41, 41,
+            43, 36, 35, 35, 35, 35, 35, 34, 34, 34, 35, 36,
+            36, 36, 37, 38, 38, 38, 40, 42, 42, 42, 45, 48,
+            36, 35, 35, 35, 35, 35, 34, 34, 34, 35, 36, 36,
+            36, 37, 38, 38, 38, 40, 42, 42, 42, 45, 48, 48,
+            36, 35, 35, 35, 35, 35, 34, 34, 34, 35, 36, 36,
+            36, 37, 38, 38, 38, 40, 42, 42, 42, 45, 48, 48,
+            48, 37, 37, 37, 37, 37, 36, 36, 36, 36, 37, 38,
+            38, 38, 38, 39, 39, 39, 41, 44, 44, 44, 46, 49,
+            49, 49, 51, 39, 39, 38, 38, 38, 38, 37, 37, 37,
+            38, 39, 39, 39, 40, 40, 40, 40, 42, 45, 45, 45,
+            47, 50, 50, 50, 52, 54, 39, 39, 38, 38, 38, 38,
+            37, 37, 37, 38, 39, 39, 39, 40, 40, 40, 40, 42,
+            45, 45, 45, 47, 50, 50, 50, 52, 54, 54, 39, 39,
+            38, 38, 38, 38, 37, 37, 37, 38, 39, 39, 39, 40,
+            40, 40, 40, 42, 45, 45, 45, 47, 50, 50, 50, 52,
+            54, 54, 54, 41, 41, 40, 40, 40, 39, 39, 39, 39,
+            40, 40, 40, 40, 41, 41, 41, 41, 44, 46, 46, 46,
+            49, 52, 52, 52, 54, 56, 56, 56, 58, 44, 43, 42,
+            42, 42, 41, 41, 41, 41, 41, 42, 42, 42, 42, 42,
+            42, 42, 45, 47, 47, 47, 50, 54, 54, 54, 56, 58,
+            58, 58, 60, 63, 44, 43, 42, 42, 42, 41, 41, 41,
+            41, 41, 42, 42, 42, 42, 42, 42, 42, 45, 47, 47,
+            47, 50, 54, 54, 54, 56, 58, 58, 58, 60, 63, 63,
+        },
+        {
+            32, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 30, 31, 31,
+            31, 31, 31, 32, 30, 31, 31, 31, 31, 31, 32, 32,
+            30, 31, 31, 31, 31, 31, 32, 32, 32, 32, 32, 33,
+            33, 33, 33, 33, 33, 33, 35, 33, 34, 34, 34, 34,
+            35, 35, 35, 35, 37, 39, 33, 34, 34, 34, 34, 35,
+            35, 35, 35, 37, 39, 39, 33, 34, 34, 34, 34, 35,
+            35, 35, 35, 37, 39, 39, 39, 35, 35, 36, 36, 36,
+            37, 37, 37, 37, 39, 41, 41, 41, 43, 36, 37, 38,
+            38, 38, 39, 40, 40, 40, 41, 43, 43, 43, 45, 47,
+            36, 37, 38, 38, 38, 39, 40, 40, 40, 41, 43, 43,
+            43, 45, 47, 47, 36, 37, 38, 38, 38, 39, 40, 40,
+            40, 41, 43, 43, 43, 45, 47, 47, 47, 39, 39, 40,
+            40, 40, 41, 41, 41, 41, 42, 44, 44, 44, 45, 47,
+            47, 47, 47, 41, 42, 42, 42, 42, 42, 42, 42, 42,
+            43, 45, 45, 45, 46, 47, 47, 47, 48, 48, 41, 42,
+            42, 42, 42, 42, 42, 42, 42, 43, 45, 45, 45, 46,
+            47, 47, 47, 48, 48, 48, 41, 42, 42, 42, 42, 42,
+            42, 42, 42, 43, 45, 45, 45, 46, 47, 47, 47, 48,
+            48, 48, 48, 45, 45, 45, 45, 45, 44, 44, 44, 44,
+            45, 46, 46, 46, 47, 47, 47, 47, 48, 49, 49, 49,
+            50, 49, 48, 47, 47, 47, 47, 46, 46, 46, 47, 47,
+            47, 47, 47, 48, 48, 48, 49, 50, 50, 50, 51, 53,
+            49, 48, 47, 47, 47, 47, 46, 46, 46, 47, 47, 47,
+            47, 47, 48, 48, 48, 49, 50, 50, 50, 51, 53, 53,
+            49, 48, 47, 47, 47, 47, 46, 46, 46, 47, 47, 47,
+            47, 47, 48, 48, 48, 49, 50, 50, 50, 51, 53, 53,
+            53, 49, 48, 47, 47, 47, 46, 46, 46, 46, 46, 47,
+            47, 47, 47, 47, 47, 47, 48, 50, 50, 50, 51, 53,
+            53, 53, 53, 48, 48, 47, 47, 47, 46, 45, 45, 45,
+            46, 46, 46, 46, 46, 46, 46, 46, 48, 49, 49, 49,
+            51, 53, 53, 53, 53, 54, 48, 48, 47, 47, 47, 46,
+            45, 45, 45, 46, 46, 46, 46, 46, 46, 46, 46, 48,
+            49, 49, 49, 51, 53, 53, 53, 53, 54, 54, 48, 48,
+            47, 47, 47, 46, 45, 45, 45, 46, 46, 46, 46, 46,
+            46, 46, 46, 48, 49, 49, 49, 51, 53, 53, 53, 53,
+            54, 54, 54, 49, 48, 47, 47, 47, 46, 45, 45, 45,
+            45, 46, 46, 46, 46, 46, 46, 46, 47, 49, 49, 49,
+            51, 53, 53, 53, 54, 55, 55, 55, 56, 49, 48, 47,
+            47, 47, 46, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+            45, 45, 47, 49, 49, 49, 51, 53, 53, 53, 54, 55,
+            55, 55, 57, 58, 49, 48, 47, 47, 47, 46, 45, 45,
+            45, 45, 45, 45, 45, 45, 45, 45, 45, 47, 49, 49,
+            49, 51, 53, 53, 53, 54, 55, 55, 55, 57, 58, 58,
+        },
+    },
+    {
+        {
+            32, 31, 31, 31, 31, 31, 31, 31, 31, 32, 31, 31,
+            31, 32, 32, 31, 31, 31, 32, 32, 32, 31, 31, 32,
+            32, 32, 32, 32, 31, 31, 32, 32, 32, 32, 32, 32,
+            31, 31, 32, 32, 32, 32, 32, 32, 32, 31, 31, 32,
+            32, 32, 32, 32, 32, 32, 32, 31, 31, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 31, 31, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 31, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 33, 33, 31, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 33, 33, 33, 31, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 33, 33, 33, 33,
+            31, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 33,
+            33, 33, 33, 33, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 33, 33, 33, 33, 33, 34, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 33, 33, 34, 34,
+            34, 34, 35, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 33, 33, 34, 34, 34, 34, 35, 35, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 33, 33, 34,
+            34, 34, 34, 35, 35, 35, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 33, 33, 34, 34, 34, 34, 35,
+            35, 35, 35, 32, 32, 33, 33, 33, 33, 33, 33, 33,
+            33, 33, 33, 34, 34, 34, 34, 35, 35, 36, 36, 36,
+            36, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+            34, 34, 35, 35, 35, 35, 36, 36, 36, 36, 37, 38,
+            34, 34, 34, 34, 34, 34, 34, 33, 33, 33, 33, 34,
+            35, 35, 35, 35, 36, 36, 37, 37, 37, 38, 39, 39,
+            34, 34, 34, 34, 34, 34, 34, 33, 33, 33, 33, 34,
+            35, 35, 35, 35, 36, 36, 37, 37, 37, 38, 39, 39,
+            39, 34, 34, 34, 34, 34, 34, 34, 33, 33, 33, 33,
+            34, 35, 35, 35, 35, 36, 36, 37, 37, 37, 38, 39,
+            39, 39, 39, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+            34, 34, 34, 35, 36, 36, 36, 36, 37, 37, 37, 37,
+            38, 40, 41, 41, 41, 42, 35, 35, 35, 35, 35, 35,
+            34, 34, 34, 34, 34, 35, 36, 36, 36, 36, 37, 37,
+            38, 38, 38, 39, 41, 42, 42, 42, 44, 46, 36, 35,
+            35, 35, 35, 35, 35, 34, 34, 34, 34, 35, 36, 36,
+            36, 36, 37, 38, 38, 38, 38, 40, 42, 42, 42, 42,
+            45, 47, 48, 36, 35, 35, 35, 35, 35, 35, 34, 34,
+            34, 34, 35, 36, 36, 36, 36, 37, 38, 38, 38, 38,
+            40, 42, 42, 42, 42, 45, 47, 48, 48, 36, 35, 35,
+            35, 35, 35, 35, 34, 34, 34, 34, 35, 36, 36, 36,
+            36, 37, 38, 38, 38, 38, 40, 42, 42, 42, 42, 45,
+            47, 48, 48, 48, 37, 37, 36, 36, 36, 36, 36, 35,
+            35, 35, 35, 36, 37, 37, 37, 37, 38, 39, 39, 39,
+            39, 41, 42, 43, 43, 43, 45, 48, 49, 49, 49, 50,
+        },
+        {
+            32, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 30, 31, 31, 31, 31, 31, 31, 31,
+            30, 30, 31, 31, 31, 31, 31, 31, 32, 30, 30, 31,
+            31, 31, 31, 31, 31, 32, 32, 30, 30, 31, 31, 31,
+            31, 31, 31, 32, 32, 32, 31, 32, 32, 32, 32, 32,
+            33, 33, 33, 33, 33, 34, 33, 33, 33, 34, 34, 34,
+            34, 34, 34, 34, 34, 36, 37, 33, 34, 34, 34, 34,
+            34, 35, 35, 35, 35, 35, 37, 38, 39, 33, 34, 34,
+            34, 34, 34, 35, 35, 35, 35, 35, 37, 38, 39, 39,
+            33, 34, 34, 34, 34, 34, 35, 35, 35, 35, 35, 37,
+            38, 39, 39, 39, 34, 35, 36, 36, 36, 36, 36, 37,
+            37, 37, 37, 38, 40, 40, 40, 40, 42, 36, 36, 37,
+            37, 37, 37, 38, 38, 39, 39, 39, 40, 41, 42, 42,
+            42, 44, 46, 36, 37, 38, 38, 38, 38, 39, 39, 40,
+            40, 40, 41, 42, 43, 43, 43, 45, 46, 47, 36, 37,
+            38, 38, 38, 38, 39, 39, 40, 40, 40, 41, 42, 43,
+            43, 43, 45, 46, 47, 47, 36, 37, 38, 38, 38, 38,
+            39, 39, 40, 40, 40, 41, 42, 43, 43, 43, 45, 46,
+            47, 47, 47, 38, 39, 39, 40, 40, 40, 40, 41, 41,
+            41, 41, 42, 43, 44, 44, 44, 45, 47, 47, 47, 47,
+            47, 40, 41, 41, 41, 41, 41, 41, 42, 42, 42, 42,
+            43, 44, 44, 44, 44, 45, 47, 47, 47, 47, 48, 48,
+            41, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 43,
+            44, 45, 45, 45, 46, 47, 47, 47, 47, 48, 48, 48,
+            41, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 43,
+            44, 45, 45, 45, 46, 47, 47, 47, 47, 48, 48, 48,
+            48, 41, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+            43, 44, 45, 45, 45, 46, 47, 47, 47, 47, 48, 48,
+            48, 48, 48, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+            44, 44, 44, 45, 46, 46, 46, 46, 47, 47, 47, 47,
+            48, 49, 49, 49, 49, 50, 47, 47, 46, 46, 46, 46,
+            46, 46, 45, 45, 45, 46, 46, 47, 47, 47, 47, 47,
+            47, 47, 47, 48, 49, 50, 50, 50, 51, 52, 49, 48,
+            48, 47, 47, 47, 47, 46, 46, 46, 46, 46, 47, 47,
+            47, 47, 47, 47, 48, 48, 48, 49, 50, 50, 50, 50,
+            51, 52, 53, 49, 48, 48, 47, 47, 47, 47, 46, 46,
+            46, 46, 46, 47, 47, 47, 47, 47, 47, 48, 48, 48,
+            49, 50, 50, 50, 50, 51, 52, 53, 53, 49, 48, 48,
+            47, 47, 47, 47, 46, 46, 46, 46, 46, 47, 47, 47,
+            47, 47, 47, 48, 48, 48, 49, 50, 50, 50, 50, 51,
+            52, 53, 53, 53, 49, 48, 47, 47, 47, 47, 47, 46,
+            46, 46, 46, 46, 46, 47, 47, 47, 47, 47, 47, 47,
+            47, 48, 49, 50, 50, 50, 51, 52, 53, 53, 53, 53,
+        },
+    },
+    {
+        {
+            32, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 32, 32, 31, 31, 31, 32, 32, 32, 31, 31, 31,
+            32, 32, 32, 32, 31, 31, 31, 32, 32, 32, 32, 32,
+            31, 31, 31, 32, 32, 32, 32, 32, 32, 31, 31, 31,
+            32, 32, 32, 32, 32, 32, 32, 31, 31, 31, 32, 32,
+            32, 32, 32, 32, 32, 32, 31, 31, 31, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 31, 31, 31, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 31, 31, 31, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 31, 31, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            31, 31, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 31, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 33, 33, 31, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            33, 33, 33, 31, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 33, 33, 33, 33, 31, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 33, 33, 33, 33, 33, 31, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 33, 33, 33,
+            33, 33, 33, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 33, 33, 33, 33, 33, 33, 33,
+            34, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 33, 33, 33, 33, 33, 33, 33, 34, 34,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 33, 33, 33, 34, 34, 34, 34, 34, 34, 35,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 33, 33, 33, 34, 34, 34, 34, 34, 35, 35,
+            35, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 33, 33, 33, 34, 34, 34, 34, 34, 35,
+            35, 35, 35, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 33, 33, 33, 34, 34, 34, 34,
+            34, 35, 35, 35, 35, 35, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 33, 33, 33, 33, 33, 33, 34, 34,
+            34, 34, 34, 34, 35, 35, 35, 35, 35, 35, 32, 32,
+            33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+            33, 34, 34, 34, 34, 34, 34, 35, 35, 35, 36, 36,
+            36, 36, 36, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+            33, 33, 33, 33, 33, 33, 34, 34, 35, 35, 35, 35,
+            35, 35, 36, 36, 36, 36, 36, 37, 38, 34, 34, 34,
+            34, 34, 34, 34, 34, 34, 33, 33, 33, 33, 33, 34,
+            34, 35, 35, 35, 35, 35, 35, 36, 36, 37, 37, 37,
+            37, 38, 38, 39, 34, 34, 34, 34, 34, 34, 34, 34,
+            34, 33, 33, 33, 33, 33, 34, 34, 35, 35, 35, 35,
+            35, 35, 36, 36, 37, 37, 37, 37, 38, 38, 39, 39,
+        },
+        {
+            32, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 30, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 30, 30, 31, 31, 31,
+            31, 31, 31, 31, 31, 32, 30, 30, 31, 31, 31, 31,
+            31, 31, 31, 31, 32, 32, 30, 30, 31, 31, 31, 31,
+            31, 31, 31, 31, 32, 32, 32, 30, 30, 31, 31, 31,
+            31, 31, 31, 31, 31, 32, 32, 32, 32, 31, 31, 31,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 33,
+            32, 32, 32, 32, 33, 33, 33, 33, 33, 33, 33, 33,
+            33, 33, 34, 35, 33, 33, 33, 34, 34, 34, 34, 34,
+            34, 34, 34, 34, 34, 34, 35, 36, 37, 33, 34, 34,
+            34, 34, 34, 34, 34, 35, 35, 35, 35, 35, 35, 36,
+            37, 38, 39, 33, 34, 34, 34, 34, 34, 34, 34, 35,
+            35, 35, 35, 35, 35, 36, 37, 38, 39, 39, 33, 34,
+            34, 34, 34, 34, 34, 34, 35, 35, 35, 35, 35, 35,
+            36, 37, 38, 39, 39, 39, 33, 34, 34, 34, 34, 34,
+            34, 34, 35, 35, 35, 35, 35, 35, 36, 37, 38, 39,
+            39, 39, 39, 34, 35, 35, 35, 35, 35, 35, 36, 36,
+            36, 36, 36, 36, 36, 37, 38, 39, 40, 40, 40, 40,
+            41, 35, 36, 36, 36, 37, 37, 37, 37, 37, 37, 38,
+            38, 38, 38, 38, 39, 41, 41, 41, 41, 41, 42, 44,
+            36, 37, 37, 38, 38, 38, 38, 38, 38, 39, 39, 39,
+            39, 39, 40, 41, 42, 43, 43, 43, 43, 44, 45, 46,
+            36, 37, 37, 38, 38, 38, 38, 38, 39, 39, 40, 40,
+            40, 40, 40, 41, 42, 43, 43, 43, 43, 44, 46, 47,
+            47, 36, 37, 37, 38, 38, 38, 38, 38, 39, 39, 40,
+            40, 40, 40, 40, 41, 42, 43, 43, 43, 43, 44, 46,
+            47, 47, 47, 36, 37, 37, 38, 38, 38, 38, 38, 39,
+            39, 40, 40, 40, 40, 40, 41, 42, 43, 43, 43, 43,
+            44, 46, 47, 47, 47, 47, 37, 37, 38, 38, 39, 39,
+            39, 39, 39, 40, 40, 40, 40, 40, 41, 42, 43, 43,
+            43, 43, 43, 44, 46, 47, 47, 47, 47, 47, 38, 39,
+            39, 40, 40, 40, 40, 40, 40, 40, 41, 41, 41, 41,
+            41, 42, 43, 44, 44, 44, 44, 45, 46, 47, 47, 47,
+            47, 47, 47, 40, 40, 40, 41, 41, 41, 41, 41, 41,
+            41, 42, 42, 42, 42, 42, 43, 44, 44, 44, 44, 44,
+            45, 46, 47, 47, 47, 47, 47, 48, 48, 41, 42, 42,
+            42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 43,
+            43, 44, 45, 45, 45, 45, 45, 46, 47, 47, 47, 47,
+            47, 48, 48, 48, 41, 42, 42, 42, 42, 42, 42, 42,
+            42, 42, 42, 42, 42, 42, 43, 43, 44, 45, 45, 45,
+            45, 45, 46, 47, 47, 47, 47, 47, 48, 48, 48, 48,
+        },
+    },
+    {
+        {
+            32, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 32, 31, 31, 31,
+            31, 31, 32, 32, 31, 31, 31, 31, 31, 32, 32, 32,
+            31, 31, 31, 31, 31, 32, 32, 32, 32, 31, 31, 31,
+            31, 31, 32, 32, 32, 32, 32, 31, 31, 31, 31, 31,
+            32, 32, 32, 32, 32, 32, 31, 31, 31, 31, 32, 32,
+            32, 32, 32, 32, 32, 32, 31, 31, 31, 31, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 31, 31, 31, 31, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 31, 31, 31,
+            31, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            31, 31, 31, 31, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 31, 31, 31, 31, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 31, 31, 31,
+            31, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 31, 31, 31, 31, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 31, 31,
+            31, 31, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 31, 31, 31, 31, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 31, 31, 31, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 31, 31, 31, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            31, 31, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 33,
+            31, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 33, 33,
+            33, 31, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 33,
+            33, 33, 33, 31, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 33, 33, 33, 33, 33, 31, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 33, 33, 33, 33, 33, 33, 31, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 33, 33, 33, 33,
+            33, 33, 33, 31, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 33, 33, 33, 33, 33, 33, 33, 33, 31, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 33, 33, 33, 33, 33,
+            33, 33, 33, 33, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        },
+        {
+            32, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 30, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 30, 30, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            30, 30, 30, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 32, 30, 30, 30, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 32, 32, 30, 30, 30,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            32, 32, 32, 30, 30, 30, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 30, 30,
+            30, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 32, 32, 32, 32, 32, 30, 30, 30, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 32, 32, 32,
+            32, 32, 32, 31, 31, 31, 31, 31, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            33, 31, 31, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 33, 33, 33, 33, 33, 33, 33, 33, 33, 34, 34,
+            32, 32, 32, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+            33, 33, 34, 34, 34, 34, 34, 34, 34, 34, 35, 36,
+            33, 33, 33, 33, 33, 34, 34, 34, 34, 34, 34, 34,
+            34, 34, 34, 34, 34, 34, 34, 34, 34, 35, 36, 37,
+            37, 33, 33, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+            35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 36, 37,
+            37, 38, 39, 33, 33, 34, 34, 34, 34, 34, 34, 34,
+            34, 34, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+            36, 37, 37, 38, 39, 39, 33, 33, 34, 34, 34, 34,
+            34, 34, 34, 34, 34, 35, 35, 35, 35, 35, 35, 35,
+            35, 35, 35, 36, 37, 37, 38, 39, 39, 39, 33, 33,
+            34, 34, 34, 34, 34, 34, 34, 34, 34, 35, 35, 35,
+            35, 35, 35, 35, 35, 35, 35, 36, 37, 37, 38, 39,
+            39, 39, 39, 33, 33, 34, 34, 34, 34, 34, 34, 34,
+            34, 34, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+            36, 37, 37, 38, 39, 39, 39, 39, 39, 33, 33, 34,
+            34, 34, 34, 34, 34, 34, 34, 34, 35, 35, 35, 35,
+            35, 35, 35, 35, 35, 35, 36, 37, 37, 38, 39, 39,
+            39, 39, 39, 39, 34, 34, 34, 35, 35, 35, 35, 35,
+            35, 35, 35, 35, 35, 36, 36, 36, 36, 36, 36, 36,
+            36, 37, 37, 38, 39, 40, 40, 40, 40, 40, 40, 40,
+        },
+    },
+    {
+        {
+            32, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 32, 32, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 32, 32, 32, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 32, 32, 32, 32, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 32, 32, 32, 32, 32, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 32, 32,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 32, 32, 32,
+            32, 32, 32, 32, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 32, 32, 32, 32, 32, 32, 32, 32, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 31, 31, 31, 31, 31, 31, 31, 31, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 31, 31, 31, 31, 31, 31, 31, 31, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            31, 31, 31, 31, 31, 31, 31, 31, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            31, 31, 31, 31, 31, 31, 31, 31, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 31, 31, 31, 31, 31, 31, 31, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 31, 31, 31, 31, 31, 31, 31, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 31, 31, 31, 31, 31, 31,
+            31, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 31, 31,
+            31, 31, 31, 31, 31, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 31, 31, 31, 31, 31, 31, 31, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 31, 31, 31,
+            31, 31, 31, 31, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 31, 31, 31, 31, 31, 31, 31, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        },
+        {
+            32, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 30, 30, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 30, 30, 30, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 30, 30,
+            30, 30, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 30, 30, 30, 30, 30, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 30, 30, 30,
+            30, 30, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 32, 30, 30, 30, 30, 30, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 32, 32,
+        },
+    },
+};
+
+// 32 wide and 16 high
+static const uint8_t qm_32x16[15][2][512] = {
+    {
+        {
+            32, 31, 31, 31, 32, 32, 34, 35, 36, 39, 44, 46,
+            48, 53, 58, 61, 65, 71, 79, 81, 82, 88, 91, 94,
+            97, 100, 103, 107, 110, 114, 118, 122, 31, 32, 32, 32,
+            32, 33, 34, 34, 34, 37, 41, 43, 45, 49, 54, 57,
+            60, 65, 72, 74, 75, 80, 83, 85, 88, 91, 94, 97,
+            101, 104, 108, 111, 32, 32, 33, 33, 34, 35, 37, 37,
+            38, 40, 43, 44, 46, 50, 54, 56, 58, 63, 70, 71,
+            72, 77, 80, 83, 86, 89, 93, 96, 100, 104, 107, 111,
+            34, 34, 33, 34, 35, 37, 39, 41, 43, 45, 48, 49,
+            51, 54, 58, 60, 63, 68, 74, 75, 76, 80, 81, 82,
+            85, 87, 90, 93, 97, 100, 103, 107, 36, 35, 34, 35,
+            36, 38, 42, 45, 48, 50, 53, 55, 56, 60, 63, 66,
+            68, 73, 79, 80, 81, 85, 88, 91, 94, 97, 98, 100,
+            101, 103, 105, 107, 44, 42, 41, 41, 42, 42, 48, 50,
+            54, 58, 63, 65, 67, 71, 75, 77, 79, 84, 90, 91,
+            92, 97, 100, 100, 100, 100, 101, 104, 108, 112, 115, 119,
+            53, 51, 49, 49, 50, 49, 54, 57, 60, 65, 71, 73,
+            76, 82, 87, 89, 92, 97, 104, 105, 106, 108, 106, 105,
+            107, 111, 114, 117, 117, 117, 118, 119, 59, 56, 54, 54,
+            54, 53, 58, 61, 64, 69, 75, 78, 80, 87, 92, 95,
+            98, 103, 110, 112, 113, 115, 114, 118, 123, 121, 120, 119,
+            123, 127, 131, 136, 65, 62, 59, 59, 59, 58, 63, 65,
+            68, 73, 79, 82, 85, 92, 98, 101, 105, 111, 118, 119,
+            121, 126, 130, 131, 128, 127, 131, 136, 138, 137, 136, 136,
+            79, 75, 72, 71, 71, 69, 73, 76, 78, 84, 90, 93,
+            96, 103, 110, 114, 118, 125, 133, 135, 136, 142, 142, 137,
+            140, 145, 144, 142, 141, 146, 151, 156, 87, 82, 78, 78,
+            77, 75, 79, 82, 84, 89, 95, 98, 102, 109, 116, 120,
+            124, 132, 141, 142, 144, 149, 148, 153, 157, 152, 150, 155,
+            161, 159, 157, 156, 90, 85, 82, 81, 80, 78, 78, 83,
+            87, 89, 93, 100, 102, 107, 115, 118, 123, 132, 136, 140,
+            151, 153, 155, 160, 161, 164, 170, 168, 165, 167, 172, 178,
+            93, 88, 86, 84, 82, 82, 80, 84, 86, 91, 94, 98,
+            105, 107, 112, 119, 122, 130, 135, 140, 149, 153, 162, 165,
+            167, 173, 174, 177, 183, 185, 182, 179, 96, 91, 90, 87,
+            86, 86, 83, 84, 89, 91, 95, 100, 102, 110, 111, 118,
+            123, 128, 135, 138, 149, 152, 160, 167, 173, 178, 180, 187,
+            188, 190, 197, 203, 99, 94, 93, 90, 89, 89, 88, 87,
+            90, 93, 97, 99, 105, 107, 115, 116, 124, 127, 135, 139,
+            146, 152, 159, 166, 171, 182, 186, 191, 193, 201, 203, 204,
+            102, 97, 97, 93, 93, 92, 92, 90, 90, 96, 97, 103,
+            104, 111, 112, 120, 121, 130, 131, 142, 143, 154, 155, 168,
+            169, 181, 183, 198, 200, 206, 208, 217,
+        },
+        {
+            32, 31, 30, 32, 33, 37, 42, 45, 49, 48, 49, 49,
+            50, 52, 54, 55, 57, 60, 63, 64, 64, 67, 68, 69,
+            70, 71, 72, 73, 74, 75, 76, 77, 31, 31, 32, 34,
+            36, 40, 43, 44, 46, 46, 45, 46, 46, 48, 50, 51,
+            52, 54, 57, 58, 59, 61, 62, 62, 63, 64, 65, 66,
+            67, 68, 69, 70, 37, 38, 40, 41, 43, 47, 47, 47,
+            48, 47, 46, 46, 46, 47, 49, 49, 50, 52, 55, 55,
+            56, 58, 59, 60, 62, 63, 64, 65, 67, 68, 69, 70,
+            42, 42, 42, 44, 45, 47, 48, 49, 50, 50, 49, 49,
+            50, 50, 52, 52, 53, 55, 58, 58, 58, 60, 60, 60,
+            60, 61, 62, 63, 64, 65, 66, 67, 48, 47, 46, 46,
+            47, 47, 50, 51, 53, 53, 53, 53, 54, 54, 55, 56,
+            56, 58, 60, 61, 61, 63, 64, 65, 66, 67, 66, 66,
+            66, 66, 67, 67, 49, 47, 45, 45, 46, 45, 49, 51,
+            53, 56, 58, 59, 59, 61, 62, 63, 64, 65, 67, 68,
+            68, 69, 71, 70, 69, 68, 68, 69, 70, 71, 72, 73,
+            52, 50, 48, 48, 47, 47, 50, 52, 54, 57, 61, 62,
+            64, 66, 68, 69, 70, 72, 75, 75, 75, 76, 74, 72,
+            73, 74, 75, 75, 74, 74, 73, 73, 54, 52, 50, 49,
+            49, 48, 52, 54, 55, 59, 62, 64, 65, 68, 71, 72,
+            73, 75, 78, 78, 79, 79, 78, 79, 81, 79, 78, 76,
+            77, 78, 80, 81, 57, 54, 52, 51, 51, 50, 53, 55,
+            57, 60, 64, 65, 67, 71, 73, 75, 76, 79, 82, 82,
+            83, 85, 86, 85, 83, 82, 83, 84, 84, 83, 82, 81,
+            63, 60, 57, 57, 56, 54, 57, 59, 60, 64, 67, 69,
+            71, 75, 78, 80, 82, 85, 89, 89, 90, 92, 91, 88,
+            89, 90, 89, 87, 86, 87, 88, 90, 66, 63, 60, 59,
+            59, 57, 60, 61, 62, 66, 69, 71, 73, 77, 80, 82,
+            84, 88, 92, 92, 93, 95, 94, 95, 96, 93, 92, 93,
+            94, 93, 91, 90, 67, 64, 62, 61, 60, 58, 58, 61,
+            63, 65, 67, 70, 72, 74, 78, 80, 82, 86, 88, 90,
+            95, 96, 96, 98, 97, 98, 100, 98, 96, 96, 97, 99,
+            68, 65, 63, 62, 60, 60, 59, 61, 62, 65, 66, 68,
+            72, 73, 76, 79, 80, 84, 87, 89, 93, 94, 98, 99,
+            99, 102, 101, 102, 103, 103, 101, 99, 69, 66, 65, 63,
+            62, 61, 60, 60, 63, 64, 66, 68, 70, 73, 74, 78,
+            80, 82, 85, 87, 91, 92, 96, 98, 101, 102, 103, 105,
+            105, 105, 107, 108, 71, 67, 66, 64, 63, 62, 62, 61,
+            62, 64, 66, 67, 70, 71, 75, 76, 79, 81, 84, 86,
+            89, 91, 94, 97, 98, 102, 104, 106, 106, 109, 109, 108,
+            72, 68, 68, 65, 65, 63, 63, 61, 62, 65, 65, 68,
+            69, 72, 73, 77, 77, 81, 81, 86, 87, 91, 91, 96,
+            97, 101, 102, 107, 107, 109, 110, 113,
+        },
+    },
+    {
+        {
+            32, 31, 31, 31, 32, 32, 32, 34, 36, 38, 39, 44,
+            47, 49, 53, 58, 61, 65, 71, 76, 79, 82, 86, 89,
+            92, 95, 98, 101, 104, 107, 110, 114, 31, 32, 32, 32,
+            32, 33, 33, 34, 34, 36, 37, 41, 44, 46, 49, 54,
+            56, 60, 65, 69, 72, 75, 78, 81, 84, 86, 89, 92,
+            95, 98, 101, 104, 32, 32, 32, 33, 34, 35, 35, 36,
+            37, 39, 40, 42, 45, 47, 50, 54, 56, 59, 64, 68,
+            70, 73, 76, 79, 82, 85, 88, 91, 94, 97, 100, 104,
+            32, 33, 33, 33, 34, 36, 36, 38, 40, 41, 42, 45,
+            47, 48, 51, 55, 57, 60, 65, 69, 71, 74, 77, 78,
+            80, 83, 85, 88, 91, 94, 97, 100, 36, 35, 35, 35,
+            36, 38, 40, 42, 48, 49, 50, 53, 56, 57, 60, 63,
+            65, 68, 73, 76, 79, 81, 84, 87, 89, 92, 93, 94,
+            95, 96, 98, 100, 44, 42, 41, 41, 42, 42, 44, 48,
+            54, 56, 58, 63, 66, 67, 71, 75, 77, 79, 84, 88,
+            90, 92, 95, 95, 95, 95, 95, 98, 101, 105, 108, 111,
+            47, 45, 44, 44, 45, 45, 47, 50, 56, 58, 60, 66,
+            69, 71, 75, 79, 81, 84, 89, 92, 95, 97, 100, 99,
+            101, 105, 108, 110, 110, 110, 111, 111, 53, 51, 49, 49,
+            50, 49, 51, 54, 60, 63, 65, 71, 75, 77, 82, 87,
+            89, 92, 97, 101, 104, 106, 109, 112, 116, 114, 113, 112,
+            115, 119, 123, 126, 65, 62, 60, 59, 59, 58, 60, 63,
+            68, 71, 73, 79, 84, 86, 92, 98, 100, 105, 111, 115,
+            118, 121, 124, 124, 121, 120, 124, 128, 129, 128, 127, 127,
+            73, 69, 67, 66, 65, 64, 66, 69, 74, 77, 79, 85,
+            90, 93, 99, 105, 107, 112, 119, 123, 127, 130, 133, 130,
+            132, 136, 136, 133, 132, 136, 141, 145, 79, 75, 72, 71,
+            71, 69, 71, 73, 78, 81, 84, 90, 95, 97, 103, 110,
+            113, 118, 125, 130, 133, 136, 140, 145, 148, 143, 141, 146,
+            151, 149, 147, 145, 87, 83, 80, 79, 78, 76, 76, 80,
+            84, 86, 90, 96, 99, 103, 111, 114, 118, 126, 130, 134,
+            143, 146, 147, 152, 151, 155, 160, 158, 154, 156, 161, 166,
+            90, 86, 84, 82, 80, 80, 78, 82, 83, 88, 91, 94,
+            101, 103, 108, 114, 116, 124, 129, 134, 142, 145, 153, 156,
+            157, 163, 163, 166, 171, 173, 169, 166, 93, 88, 87, 84,
+            83, 83, 81, 81, 86, 88, 92, 96, 98, 105, 107, 113,
+            117, 122, 129, 131, 141, 144, 151, 157, 163, 167, 169, 175,
+            175, 177, 183, 189, 96, 91, 90, 87, 87, 86, 85, 84,
+            87, 90, 94, 96, 101, 102, 110, 111, 118, 121, 129, 132,
+            138, 144, 150, 156, 161, 171, 174, 179, 181, 188, 188, 190,
+            99, 94, 94, 90, 90, 88, 89, 86, 87, 93, 93, 99,
+            99, 106, 107, 115, 116, 124, 125, 135, 136, 145, 146, 158,
+            159, 170, 171, 185, 186, 192, 193, 201,
+        },
+        {
+            32, 31, 30, 31, 33, 37, 39, 42, 49, 48, 48, 49,
+            50, 51, 52, 54, 55, 57, 60, 62, 63, 64, 66, 67,
+            68, 69, 70, 71, 72, 73, 74, 75, 31, 31, 32, 33,
+            36, 40, 41, 43, 46, 46, 46, 45, 46, 47, 48, 50,
+            51, 52, 54, 56, 57, 59, 60, 61, 62, 63, 64, 65,
+            65, 66, 67, 68, 35, 37, 38, 38, 41, 45, 46, 46,
+            48, 47, 46, 45, 46, 47, 47, 49, 49, 50, 53, 54,
+            55, 56, 58, 59, 60, 61, 62, 64, 65, 66, 67, 68,
+            38, 40, 40, 41, 44, 47, 47, 48, 49, 48, 48, 47,
+            48, 48, 48, 50, 50, 51, 53, 55, 56, 57, 58, 58,
+            59, 60, 60, 61, 62, 63, 64, 65, 48, 47, 46, 46,
+            47, 47, 48, 50, 53, 53, 53, 53, 54, 54, 54, 55,
+            56, 56, 58, 60, 60, 61, 62, 63, 64, 65, 65, 65,
+            65, 65, 65, 65, 49, 47, 45, 45, 46, 45, 47, 49,
+            53, 55, 56, 58, 59, 60, 61, 62, 63, 64, 65, 66,
+            67, 68, 69, 68, 67, 66, 66, 67, 68, 69, 70, 71,
+            50, 48, 46, 46, 46, 46, 47, 50, 54, 55, 56, 59,
+            61, 61, 63, 65, 65, 66, 68, 69, 70, 71, 72, 71,
+            71, 72, 73, 73, 72, 72, 71, 71, 52, 50, 48, 48,
+            47, 47, 48, 50, 54, 56, 57, 61, 63, 64, 66, 68,
+            69, 70, 72, 74, 75, 75, 76, 78, 79, 77, 76, 74,
+            75, 76, 77, 78, 57, 54, 52, 52, 51, 50, 51, 53,
+            57, 58, 60, 64, 66, 68, 71, 73, 74, 76, 79, 81,
+            82, 83, 84, 83, 81, 80, 81, 82, 82, 81, 79, 78,
+            61, 57, 55, 55, 54, 52, 54, 56, 59, 61, 62, 66,
+            68, 70, 73, 76, 77, 79, 82, 84, 86, 87, 88, 86,
+            86, 88, 87, 85, 83, 85, 86, 87, 63, 60, 58, 57,
+            56, 54, 55, 57, 60, 62, 64, 67, 70, 71, 75, 78,
+            79, 82, 85, 87, 89, 90, 91, 93, 94, 91, 89, 90,
+            92, 90, 89, 87, 67, 63, 61, 60, 59, 57, 57, 60,
+            63, 64, 66, 69, 71, 73, 77, 79, 81, 85, 87, 88,
+            92, 93, 94, 96, 95, 96, 97, 95, 93, 93, 94, 96,
+            68, 64, 63, 61, 60, 59, 58, 60, 61, 64, 65, 67,
+            71, 72, 75, 78, 79, 83, 85, 87, 91, 92, 95, 96,
+            97, 99, 98, 99, 100, 100, 98, 96, 69, 65, 64, 62,
+            61, 61, 59, 59, 62, 63, 65, 67, 68, 72, 73, 76,
+            78, 81, 84, 85, 89, 90, 93, 96, 98, 99, 100, 102,
+            102, 102, 103, 105, 70, 66, 65, 63, 63, 62, 61, 60,
+            61, 63, 65, 66, 69, 70, 74, 74, 78, 79, 82, 84,
+            87, 89, 91, 94, 96, 100, 101, 103, 103, 105, 105, 105,
+            71, 67, 67, 64, 64, 62, 62, 60, 61, 64, 64, 67,
+            67, 71, 71, 75, 75, 79, 80, 84, 84, 89, 89, 94,
+            94, 98, 99, 104, 104, 106, 106, 109,
+        },
+    },
+    {
+        {
+            32, 31, 31, 31, 32, 32, 32, 34, 34, 36, 39, 40,
+            44, 47, 49, 53, 57, 59, 65, 69, 71, 79, 81, 82,
+            87, 90, 92, 95, 98, 100, 103, 106, 31, 32, 32, 32,
+            32, 32, 33, 34, 34, 34, 37, 38, 41, 44, 46, 49,
+            53, 54, 60, 63, 65, 72, 74, 75, 79, 82, 84, 87,
+            89, 92, 94, 97, 32, 32, 32, 32, 33, 34, 34, 35,
+            36, 37, 39, 40, 42, 45, 46, 50, 53, 54, 59, 62,
+            64, 71, 72, 73, 77, 80, 83, 85, 88, 91, 94, 97,
+            32, 32, 32, 33, 34, 34, 35, 37, 37, 38, 40, 41,
+            43, 46, 47, 50, 53, 54, 58, 62, 63, 70, 71, 72,
+            76, 78, 81, 83, 85, 88, 90, 93, 36, 35, 35, 34,
+            36, 37, 38, 42, 44, 48, 50, 51, 53, 56, 57, 60,
+            63, 64, 68, 71, 73, 79, 80, 81, 85, 87, 88, 88,
+            89, 90, 92, 93, 39, 38, 38, 37, 39, 40, 40, 45,
+            47, 51, 54, 55, 58, 61, 62, 65, 68, 69, 73, 76,
+            78, 84, 85, 86, 90, 89, 90, 92, 95, 98, 101, 104,
+            44, 42, 41, 41, 42, 42, 42, 48, 50, 54, 58, 59,
+            63, 66, 67, 71, 74, 75, 79, 83, 84, 90, 91, 92,
+            96, 99, 102, 103, 103, 103, 103, 104, 53, 51, 50, 49,
+            50, 49, 49, 54, 56, 60, 65, 67, 71, 75, 77, 82,
+            86, 87, 92, 96, 97, 104, 105, 106, 110, 108, 106, 105,
+            108, 111, 114, 118, 58, 55, 54, 53, 53, 53, 52, 57,
+            59, 63, 68, 70, 74, 79, 81, 86, 90, 91, 97, 100,
+            102, 109, 110, 111, 114, 113, 117, 120, 121, 120, 119, 118,
+            65, 62, 60, 59, 59, 58, 58, 63, 65, 68, 73, 75,
+            79, 85, 86, 92, 97, 98, 105, 109, 111, 118, 120, 121,
+            125, 129, 128, 125, 124, 127, 131, 135, 79, 75, 73, 72,
+            71, 70, 69, 73, 75, 78, 84, 85, 90, 95, 97, 103,
+            108, 111, 118, 122, 125, 133, 135, 136, 140, 135, 133, 137,
+            141, 139, 137, 135, 81, 77, 75, 74, 72, 71, 70, 75,
+            77, 80, 85, 87, 91, 97, 99, 105, 110, 112, 119, 124,
+            127, 135, 137, 139, 143, 146, 150, 148, 144, 146, 150, 154,
+            88, 83, 81, 79, 78, 77, 76, 79, 81, 85, 88, 91,
+            97, 99, 104, 109, 111, 119, 123, 127, 135, 137, 145, 147,
+            148, 153, 153, 155, 160, 161, 158, 155, 90, 86, 84, 82,
+            81, 80, 78, 79, 83, 85, 89, 92, 94, 101, 102, 108,
+            112, 117, 123, 125, 134, 136, 143, 148, 154, 157, 158, 164,
+            164, 165, 170, 175, 93, 88, 88, 84, 84, 83, 82, 81,
+            84, 86, 90, 92, 97, 98, 105, 106, 113, 115, 122, 125,
+            131, 136, 141, 147, 151, 160, 163, 168, 169, 175, 175, 176,
+            96, 91, 91, 87, 87, 85, 86, 83, 84, 89, 89, 95,
+            95, 102, 102, 110, 110, 118, 119, 128, 129, 137, 138, 149,
+            149, 159, 160, 173, 174, 179, 180, 187,
+        },
+        {
+            32, 31, 31, 30, 33, 35, 37, 42, 44, 49, 48, 48,
+            49, 50, 51, 52, 54, 54, 57, 59, 60, 63, 64, 64,
+            66, 67, 68, 69, 70, 71, 72, 73, 31, 31, 32, 32,
+            36, 38, 40, 43, 44, 46, 46, 45, 45, 46, 47, 48,
+            49, 50, 52, 54, 54, 57, 58, 59, 60, 61, 62, 63,
+            64, 65, 65, 66, 34, 35, 36, 36, 40, 42, 44, 45,
+            46, 47, 46, 46, 45, 46, 47, 47, 49, 49, 51, 52,
+            53, 56, 57, 57, 59, 60, 61, 62, 63, 64, 65, 66,
+            37, 38, 39, 40, 43, 45, 47, 47, 47, 48, 47, 46,
+            46, 46, 47, 47, 48, 49, 50, 52, 52, 55, 55, 56,
+            57, 58, 59, 60, 60, 61, 62, 63, 48, 47, 46, 46,
+            47, 47, 47, 50, 51, 53, 53, 53, 53, 54, 54, 54,
+            55, 55, 56, 58, 58, 60, 61, 61, 63, 63, 63, 63,
+            63, 63, 63, 63, 48, 47, 46, 45, 46, 46, 46, 50,
+            51, 53, 54, 55, 56, 56, 57, 57, 58, 59, 60, 61,
+            62, 64, 64, 65, 66, 65, 64, 65, 66, 67, 68, 69,
+            49, 47, 46, 45, 46, 45, 45, 49, 51, 53, 56, 56,
+            58, 59, 60, 61, 62, 62, 64, 65, 65, 67, 68, 68,
+            69, 70, 71, 71, 70, 70, 69, 69, 52, 50, 48, 48,
+            47, 47, 47, 50, 52, 54, 57, 58, 61, 63, 64, 66,
+            68, 68, 70, 72, 72, 75, 75, 75, 77, 75, 74, 72,
+            73, 74, 75, 76, 54, 51, 50, 49, 49, 48, 48, 51,
+            53, 55, 58, 59, 62, 65, 65, 68, 70, 70, 73, 74,
+            75, 77, 78, 78, 79, 78, 79, 80, 80, 78, 77, 76,
+            57, 54, 53, 52, 51, 50, 50, 53, 54, 57, 60, 61,
+            64, 66, 68, 71, 73, 74, 76, 78, 79, 82, 82, 83,
+            84, 85, 84, 82, 81, 82, 83, 84, 63, 60, 58, 57,
+            56, 55, 54, 57, 59, 60, 64, 65, 67, 70, 71, 75,
+            77, 78, 82, 84, 85, 89, 89, 90, 91, 88, 87, 88,
+            89, 88, 86, 84, 64, 61, 59, 58, 57, 56, 55, 58,
+            59, 61, 64, 65, 68, 71, 72, 75, 78, 79, 82, 85,
+            86, 90, 90, 91, 93, 93, 94, 93, 90, 90, 92, 93,
+            67, 63, 62, 60, 59, 58, 57, 59, 60, 63, 64, 66,
+            70, 70, 73, 76, 77, 81, 83, 85, 89, 90, 93, 94,
+            94, 96, 96, 96, 97, 97, 95, 93, 68, 64, 63, 61,
+            60, 60, 58, 58, 61, 62, 64, 66, 67, 71, 71, 75,
+            77, 79, 82, 83, 87, 88, 91, 93, 95, 97, 97, 99,
+            99, 99, 100, 101, 69, 65, 65, 62, 62, 61, 60, 59,
+            61, 62, 64, 65, 68, 68, 72, 73, 76, 77, 81, 82,
+            85, 87, 89, 92, 93, 97, 98, 100, 100, 102, 102, 101,
+            69, 66, 66, 63, 63, 61, 61, 59, 60, 63, 63, 66,
+            66, 70, 70, 73, 74, 78, 78, 82, 82, 86, 87, 91,
+            91, 95, 96, 101, 101, 103, 103, 105,
+        },
+    },
+    {
+        {
+            32, 31, 31, 31, 31, 32, 32, 32, 34, 35, 36, 39,
+            41, 44, 47, 48, 53, 55, 58, 63, 65, 71, 74, 79,
+            82, 82, 87, 89, 92, 94, 97, 99, 31, 32, 32, 32,
+            32, 32, 33, 33, 34, 34, 34, 37, 39, 41, 44, 45,
+            49, 51, 54, 58, 60, 65, 68, 72, 75, 75, 79, 82,
+            84, 86, 88, 91, 31, 32, 32, 32, 33, 33, 34, 34,
+            35, 36, 36, 39, 40, 42, 44, 45, 50, 51, 54, 58,
+            59, 64, 67, 71, 73, 74, 78, 81, 83, 85, 88, 91,
+            32, 32, 32, 33, 34, 34, 35, 36, 37, 38, 38, 40,
+            41, 43, 45, 46, 50, 51, 54, 57, 58, 63, 66, 70,
+            72, 72, 76, 78, 80, 82, 85, 87, 35, 35, 34, 34,
+            35, 36, 37, 39, 41, 45, 46, 48, 49, 51, 53, 54,
+            57, 59, 61, 65, 66, 71, 73, 77, 79, 79, 83, 83,
+            84, 85, 86, 87, 36, 35, 35, 34, 36, 36, 38, 40,
+            42, 47, 48, 50, 51, 53, 56, 56, 60, 61, 63, 67,
+            68, 73, 75, 79, 81, 81, 85, 87, 89, 92, 94, 97,
+            44, 42, 41, 41, 42, 42, 42, 44, 48, 52, 54, 58,
+            60, 63, 66, 67, 71, 72, 75, 78, 79, 84, 86, 90,
+            92, 92, 96, 97, 97, 97, 97, 97, 47, 45, 45, 44,
+            44, 45, 45, 47, 50, 55, 56, 60, 62, 66, 69, 70,
+            75, 77, 79, 83, 84, 89, 91, 95, 97, 97, 100, 99,
+            101, 104, 107, 110, 53, 51, 50, 49, 49, 50, 49, 51,
+            54, 59, 60, 65, 67, 71, 75, 76, 82, 84, 87, 91,
+            92, 97, 100, 104, 105, 106, 110, 113, 114, 112, 111, 110,
+            62, 59, 58, 57, 57, 57, 56, 58, 61, 65, 66, 71,
+            74, 78, 82, 83, 90, 92, 95, 100, 102, 108, 110, 115,
+            117, 117, 120, 118, 116, 119, 123, 126, 65, 62, 61, 59,
+            59, 59, 58, 60, 63, 67, 68, 73, 76, 79, 84, 85,
+            92, 94, 98, 103, 105, 111, 113, 118, 120, 121, 125, 128,
+            132, 130, 128, 126, 79, 75, 74, 72, 71, 71, 69, 71,
+            73, 77, 78, 84, 86, 90, 95, 96, 103, 106, 110, 116,
+            118, 125, 128, 133, 136, 136, 141, 139, 135, 136, 140, 144,
+            82, 78, 76, 74, 73, 73, 71, 73, 76, 79, 80, 86,
+            88, 92, 97, 98, 106, 108, 112, 118, 120, 127, 131, 136,
+            139, 139, 144, 145, 150, 151, 147, 144, 88, 83, 82, 79,
+            79, 78, 76, 76, 81, 82, 85, 89, 91, 97, 98, 104,
+            107, 111, 117, 119, 127, 129, 135, 140, 145, 148, 148, 153,
+            153, 154, 159, 163, 90, 86, 85, 82, 81, 80, 79, 78,
+            81, 83, 87, 88, 93, 94, 101, 101, 108, 110, 116, 119,
+            124, 129, 134, 139, 142, 150, 153, 157, 157, 163, 163, 163,
+            93, 88, 88, 84, 84, 82, 83, 80, 80, 86, 86, 91,
+            91, 97, 98, 105, 105, 112, 113, 121, 122, 130, 130, 140,
+            140, 149, 150, 161, 162, 166, 167, 173,
+        },
+        {
+            32, 31, 31, 30, 33, 33, 37, 39, 42, 47, 49, 48,
+            48, 49, 50, 50, 52, 53, 54, 56, 57, 60, 61, 63,
+            64, 64, 66, 67, 68, 69, 70, 70, 31, 31, 32, 32,
+            35, 36, 40, 41, 43, 46, 46, 46, 45, 45, 46, 46,
+            48, 49, 50, 51, 52, 54, 56, 57, 58, 59, 60, 61,
+            62, 63, 63, 64, 33, 34, 34, 35, 37, 38, 43, 43,
+            44, 46, 47, 46, 46, 45, 46, 46, 47, 48, 49, 51,
+            51, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+            37, 38, 39, 40, 42, 43, 47, 47, 47, 48, 48, 47,
+            46, 46, 46, 46, 47, 48, 49, 50, 50, 52, 53, 55,
+            56, 56, 57, 58, 59, 59, 60, 61, 45, 45, 45, 44,
+            46, 46, 47, 48, 49, 51, 52, 51, 51, 51, 52, 52,
+            53, 53, 54, 55, 55, 57, 58, 59, 60, 60, 61, 61,
+            61, 61, 61, 61, 48, 47, 46, 46, 47, 47, 47, 48,
+            50, 52, 53, 53, 53, 53, 54, 54, 54, 55, 55, 56,
+            56, 58, 59, 60, 61, 61, 63, 63, 64, 65, 66, 67,
+            49, 47, 46, 45, 45, 46, 45, 47, 49, 53, 53, 56,
+            57, 58, 59, 59, 61, 61, 62, 63, 64, 65, 66, 67,
+            68, 68, 69, 69, 68, 68, 67, 67, 50, 48, 47, 46,
+            46, 46, 46, 47, 50, 53, 54, 56, 57, 59, 61, 61,
+            63, 64, 65, 66, 66, 68, 69, 70, 71, 71, 72, 70,
+            71, 72, 73, 74, 52, 50, 49, 48, 47, 47, 47, 48,
+            50, 53, 54, 57, 59, 61, 63, 64, 66, 67, 68, 70,
+            70, 72, 73, 75, 75, 75, 77, 78, 77, 76, 75, 74,
+            56, 53, 52, 51, 50, 50, 49, 50, 53, 55, 56, 59,
+            61, 63, 65, 66, 70, 71, 72, 74, 75, 77, 79, 80,
+            81, 81, 82, 80, 79, 80, 81, 82, 57, 54, 53, 52,
+            51, 51, 50, 51, 53, 56, 57, 60, 61, 64, 66, 67,
+            71, 72, 73, 76, 76, 79, 80, 82, 83, 83, 84, 85,
+            86, 85, 83, 82, 63, 60, 59, 57, 56, 56, 54, 55,
+            57, 60, 60, 64, 65, 67, 70, 71, 75, 76, 78, 81,
+            82, 85, 86, 89, 90, 90, 92, 90, 88, 88, 89, 90,
+            64, 61, 60, 58, 57, 57, 55, 56, 58, 61, 61, 64,
+            66, 68, 71, 71, 75, 77, 79, 82, 83, 86, 87, 90,
+            91, 91, 93, 93, 94, 94, 92, 90, 67, 63, 62, 60,
+            60, 59, 57, 57, 60, 61, 63, 65, 66, 70, 70, 73,
+            75, 77, 80, 81, 85, 86, 89, 91, 93, 94, 94, 96,
+            96, 95, 97, 98, 68, 64, 64, 61, 61, 60, 59, 58,
+            60, 61, 63, 64, 67, 67, 71, 71, 74, 75, 79, 80,
+            83, 85, 87, 89, 91, 94, 95, 97, 97, 99, 98, 98,
+            68, 65, 65, 62, 62, 60, 61, 59, 59, 62, 62, 65,
+            65, 68, 68, 72, 72, 76, 76, 80, 80, 84, 84, 89,
+            89, 93, 93, 97, 98, 99, 99, 102,
+        },
+    },
+    {
+        {
+            32, 31, 31, 31, 31, 32, 32, 32, 33, 34, 36, 36,
+            39, 40, 44, 46, 48, 52, 53, 58, 58, 65, 66, 71,
+            74, 79, 81, 82, 86, 88, 91, 93, 31, 32, 32, 32,
+            32, 32, 32, 33, 33, 34, 34, 35, 37, 38, 41, 43,
+            45, 48, 49, 53, 54, 60, 61, 65, 68, 72, 74, 75,
+            78, 81, 83, 85, 31, 32, 32, 32, 32, 33, 33, 33,
+            34, 34, 35, 35, 38, 39, 41, 43, 45, 48, 49, 53,
+            54, 59, 60, 65, 67, 72, 73, 74, 78, 80, 82, 85,
+            32, 32, 32, 33, 33, 34, 35, 35, 36, 37, 38, 38,
+            40, 41, 43, 44, 46, 49, 50, 53, 54, 58, 59, 63,
+            66, 70, 71, 72, 75, 77, 79, 81, 33, 33, 33, 33,
+            34, 35, 36, 36, 38, 39, 42, 42, 44, 45, 46, 48,
+            50, 52, 53, 57, 57, 62, 63, 67, 69, 73, 75, 75,
+            78, 80, 80, 81, 36, 35, 35, 34, 35, 36, 37, 38,
+            41, 42, 48, 48, 50, 51, 53, 55, 56, 59, 60, 63,
+            63, 68, 69, 73, 75, 79, 80, 81, 84, 86, 88, 90,
+            40, 39, 39, 38, 38, 39, 40, 41, 44, 45, 51, 51,
+            54, 56, 59, 60, 62, 65, 66, 69, 70, 74, 75, 79,
+            81, 85, 86, 87, 90, 90, 90, 90, 44, 42, 42, 41,
+            41, 42, 42, 42, 46, 48, 54, 54, 58, 59, 63, 65,
+            67, 70, 71, 74, 75, 79, 80, 84, 86, 90, 91, 92,
+            95, 98, 100, 102, 51, 49, 49, 47, 47, 48, 48, 48,
+            52, 53, 58, 59, 63, 65, 69, 72, 74, 78, 79, 83,
+            84, 89, 90, 94, 97, 101, 102, 103, 106, 105, 103, 103,
+            53, 51, 51, 49, 49, 50, 49, 49, 53, 54, 60, 60,
+            65, 67, 71, 73, 76, 80, 82, 86, 87, 92, 93, 97,
+            100, 104, 105, 106, 109, 112, 114, 117, 65, 62, 61, 59,
+            59, 59, 58, 58, 62, 63, 68, 68, 73, 75, 79, 82,
+            85, 90, 92, 97, 98, 105, 106, 111, 113, 118, 120, 121,
+            124, 122, 119, 117, 66, 63, 62, 60, 60, 60, 59, 59,
+            63, 64, 69, 69, 74, 76, 80, 83, 86, 91, 93, 98,
+            99, 106, 107, 112, 115, 119, 121, 122, 125, 127, 130, 134,
+            79, 75, 74, 72, 71, 71, 69, 69, 72, 73, 78, 79,
+            84, 85, 90, 93, 96, 101, 103, 109, 110, 118, 119, 125,
+            128, 133, 135, 136, 140, 140, 137, 134, 81, 77, 76, 74,
+            73, 72, 71, 70, 74, 75, 80, 80, 85, 87, 91, 94,
+            98, 103, 105, 111, 112, 119, 121, 127, 130, 135, 137, 139,
+            142, 144, 148, 151, 87, 83, 82, 79, 79, 78, 77, 75,
+            78, 80, 84, 85, 89, 90, 96, 97, 103, 105, 111, 113,
+            118, 122, 126, 131, 134, 141, 143, 147, 147, 152, 151, 152,
+            90, 85, 85, 81, 81, 80, 80, 77, 78, 83, 83, 87,
+            88, 93, 93, 100, 100, 107, 107, 115, 115, 123, 123, 132,
+            132, 140, 140, 151, 151, 155, 155, 160,
+        },
+        {
+            32, 31, 31, 30, 31, 33, 35, 37, 41, 42, 49, 49,
+            48, 48, 49, 49, 50, 51, 52, 54, 54, 57, 57, 60,
+            61, 63, 64, 64, 66, 67, 68, 68, 31, 31, 31, 32,
+            33, 36, 38, 40, 42, 43, 46, 46, 46, 45, 45, 46,
+            46, 47, 48, 50, 50, 52, 52, 54, 56, 57, 58, 59,
+            60, 61, 62, 62, 32, 33, 33, 33, 35, 37, 39, 41,
+            43, 43, 47, 47, 46, 46, 45, 46, 46, 47, 48, 49,
+            50, 52, 52, 54, 55, 57, 58, 58, 59, 60, 61, 62,
+            37, 38, 38, 40, 41, 43, 45, 47, 47, 47, 48, 48,
+            47, 46, 46, 46, 46, 47, 47, 48, 49, 50, 51, 52,
+            53, 55, 55, 56, 57, 58, 58, 59, 40, 41, 41, 42,
+            43, 44, 46, 47, 48, 48, 50, 50, 49, 49, 48, 49,
+            49, 49, 50, 51, 51, 52, 53, 55, 56, 57, 58, 58,
+            59, 59, 59, 59, 48, 47, 47, 46, 46, 47, 47, 47,
+            49, 50, 53, 53, 53, 53, 53, 53, 54, 54, 54, 55,
+            55, 56, 57, 58, 59, 60, 61, 61, 62, 63, 64, 65,
+            49, 47, 47, 45, 46, 46, 46, 46, 49, 49, 53, 53,
+            54, 55, 56, 57, 57, 58, 58, 59, 59, 60, 61, 62,
+            63, 64, 65, 65, 66, 66, 65, 65, 49, 47, 47, 45,
+            45, 46, 45, 45, 48, 49, 53, 54, 56, 56, 58, 59,
+            59, 61, 61, 62, 62, 64, 64, 65, 66, 67, 68, 68,
+            69, 70, 71, 71, 51, 49, 49, 47, 47, 47, 47, 46,
+            49, 50, 54, 54, 57, 58, 61, 62, 63, 64, 65, 67,
+            67, 69, 69, 71, 72, 73, 73, 74, 75, 74, 72, 71,
+            52, 50, 49, 48, 48, 47, 47, 47, 50, 50, 54, 55,
+            57, 58, 61, 62, 64, 66, 66, 68, 68, 70, 71, 72,
+            73, 75, 75, 75, 76, 77, 78, 79, 57, 54, 54, 52,
+            51, 51, 50, 50, 52, 53, 57, 57, 60, 61, 64, 65,
+            67, 69, 71, 73, 73, 76, 77, 79, 80, 82, 82, 83,
+            84, 82, 81, 79, 58, 55, 54, 52, 52, 52, 51, 50,
+            53, 54, 57, 57, 60, 61, 64, 66, 67, 70, 71, 73,
+            74, 77, 77, 79, 81, 82, 83, 83, 85, 85, 86, 87,
+            63, 60, 59, 57, 57, 56, 55, 54, 57, 57, 60, 61,
+            64, 65, 67, 69, 71, 73, 75, 77, 78, 82, 82, 85,
+            86, 89, 89, 90, 91, 91, 89, 87, 64, 61, 60, 58,
+            57, 57, 56, 55, 57, 58, 61, 61, 64, 65, 68, 69,
+            71, 74, 75, 78, 78, 82, 83, 86, 87, 90, 90, 91,
+            92, 93, 94, 95, 67, 63, 63, 60, 60, 59, 58, 57,
+            59, 60, 62, 63, 65, 66, 69, 70, 73, 74, 77, 78,
+            81, 83, 85, 87, 88, 92, 92, 94, 94, 96, 95, 95,
+            67, 64, 64, 61, 61, 60, 60, 58, 58, 61, 61, 64,
+            64, 67, 67, 70, 71, 74, 74, 78, 78, 82, 82, 86,
+            86, 90, 90, 95, 95, 96, 96, 98,
+        },
+    },
+    {
+        {
+            32, 31, 31, 31, 31, 32, 32, 32, 32, 34, 34, 36,
+            36, 39, 39, 44, 44, 48, 48, 53, 53, 58, 58, 65,
+            65, 71, 71, 79, 79, 82, 82, 87, 31, 32, 32, 32,
+            32, 32, 32, 33, 33, 34, 34, 34, 34, 37, 37, 41,
+            41, 45, 45, 49, 49, 54, 54, 60, 60, 65, 65, 72,
+            72, 75, 75, 79, 31, 32, 32, 32, 32, 32, 32, 33,
+            33, 34, 34, 34, 34, 37, 37, 41, 41, 45, 45, 49,
+            49, 54, 54, 60, 60, 65, 65, 72, 72, 75, 75, 79,
+            32, 32, 32, 33, 33, 34, 34, 35, 35, 37, 37, 38,
+            38, 40, 40, 43, 43, 46, 46, 50, 50, 54, 54, 58,
+            58, 63, 63, 70, 70, 72, 72, 76, 32, 32, 32, 33,
+            33, 34, 34, 35, 35, 37, 37, 38, 38, 40, 40, 43,
+            43, 46, 46, 50, 50, 54, 54, 58, 58, 63, 63, 70,
+            70, 72, 72, 76, 36, 35, 35, 34, 34, 36, 36, 38,
+            38, 42, 42, 48, 48, 50, 50, 53, 53, 56, 56, 60,
+            60, 63, 63, 68, 68, 73, 73, 79, 79, 81, 81, 84,
+            36, 35, 35, 34, 34, 36, 36, 38, 38, 42, 42, 48,
+            48, 50, 50, 53, 53, 56, 56, 60, 60, 63, 63, 68,
+            68, 73, 73, 79, 79, 81, 81, 84, 44, 42, 42, 41,
+            41, 42, 42, 42, 42, 48, 48, 54, 54, 58, 58, 63,
+            63, 67, 67, 71, 71, 75, 75, 79, 79, 84, 84, 90,
+            90, 92, 92, 96, 44, 42, 42, 41, 41, 42, 42, 42,
+            42, 48, 48, 54, 54, 58, 58, 63, 63, 67, 67, 71,
+            71, 75, 75, 79, 79, 84, 84, 90, 90, 92, 92, 96,
+            53, 51, 51, 49, 49, 50, 50, 49, 49, 54, 54, 60,
+            60, 65, 65, 71, 71, 76, 76, 82, 82, 87, 87, 92,
+            92, 97, 97, 104, 104, 106, 106, 109, 53, 51, 51, 49,
+            49, 50, 50, 49, 49, 54, 54, 60, 60, 65, 65, 71,
+            71, 76, 76, 82, 82, 87, 87, 92, 92, 97, 97, 104,
+            104, 106, 106, 109, 65, 62, 62, 59, 59, 59, 59, 58,
+            58, 63, 63, 68, 68, 73, 73, 79, 79, 85, 85, 92,
+            92, 98, 98, 105, 105, 111, 111, 118, 118, 121, 121, 124,
+            65, 62, 62, 59, 59, 59, 59, 58, 58, 63, 63, 68,
+            68, 73, 73, 79, 79, 85, 85, 92, 92, 98, 98, 105,
+            105, 111, 111, 118, 118, 121, 121, 124, 79, 75, 75, 72,
+            72, 71, 71, 69, 69, 73, 73, 78, 78, 84, 84, 90,
+            90, 96, 96, 103, 103, 110, 110, 118, 118, 125, 125, 133,
+            133, 136, 136, 141, 79, 75, 75, 72, 72, 71, 71, 69,
+            69, 73, 73, 78, 78, 84, 84, 90, 90, 96, 96, 103,
+            103, 110, 110, 118, 118, 125, 125, 133, 133, 136, 136, 141,
+            87, 82, 82, 78, 78, 77, 77, 75, 75, 79, 79, 84,
+            84, 89, 89, 95, 95, 102, 102, 109, 109, 116, 116, 124,
+            124, 132, 132, 141, 141, 144, 144, 149,
+        },
+        {
+            32, 31, 31, 30, 30, 33, 33, 37, 37, 42, 42, 49,
+            49, 48, 48, 49, 49, 50, 50, 52, 52, 54, 54, 57,
+            57, 60, 60, 63, 63, 64, 64, 66, 31, 31, 31, 32,
+            32, 36, 36, 40, 40, 43, 43, 46, 46, 46, 46, 45,
+            45, 46, 46, 48, 48, 50, 50, 52, 52, 54, 54, 57,
+            57, 59, 59, 60, 31, 31, 31, 32, 32, 36, 36, 40,
+            40, 43, 43, 46, 46, 46, 46, 45, 45, 46, 46, 48,
+            48, 50, 50, 52, 52, 54, 54, 57, 57, 59, 59, 60,
+            37, 38, 38, 40, 40, 43, 43, 47, 47, 47, 47, 48,
+            48, 47, 47, 46, 46, 46, 46, 47, 47, 49, 49, 50,
+            50, 52, 52, 55, 55, 56, 56, 57, 37, 38, 38, 40,
+            40, 43, 43, 47, 47, 47, 47, 48, 48, 47, 47, 46,
+            46, 46, 46, 47, 47, 49, 49, 50, 50, 52, 52, 55,
+            55, 56, 56, 57, 48, 47, 47, 46, 46, 47, 47, 47,
+            47, 50, 50, 53, 53, 53, 53, 53, 53, 54, 54, 54,
+            54, 55, 55, 56, 56, 58, 58, 60, 60, 61, 61, 63,
+            48, 47, 47, 46, 46, 47, 47, 47, 47, 50, 50, 53,
+            53, 53, 53, 53, 53, 54, 54, 54, 54, 55, 55, 56,
+            56, 58, 58, 60, 60, 61, 61, 63, 49, 47, 47, 45,
+            45, 46, 46, 45, 45, 49, 49, 53, 53, 56, 56, 58,
+            58, 59, 59, 61, 61, 62, 62, 64, 64, 65, 65, 67,
+            67, 68, 68, 69, 49, 47, 47, 45, 45, 46, 46, 45,
+            45, 49, 49, 53, 53, 56, 56, 58, 58, 59, 59, 61,
+            61, 62, 62, 64, 64, 65, 65, 67, 67, 68, 68, 69,
+            52, 50, 50, 48, 48, 47, 47, 47, 47, 50, 50, 54,
+            54, 57, 57, 61, 61, 64, 64, 66, 66, 68, 68, 70,
+            70, 72, 72, 75, 75, 75, 75, 77, 52, 50, 50, 48,
+            48, 47, 47, 47, 47, 50, 50, 54, 54, 57, 57, 61,
+            61, 64, 64, 66, 66, 68, 68, 70, 70, 72, 72, 75,
+            75, 75, 75, 77, 57, 54, 54, 52, 52, 51, 51, 50,
+            50, 53, 53, 57, 57, 60, 60, 64, 64, 67, 67, 71,
+            71, 73, 73, 76, 76, 79, 79, 82, 82, 83, 83, 84,
+            57, 54, 54, 52, 52, 51, 51, 50, 50, 53, 53, 57,
+            57, 60, 60, 64, 64, 67, 67, 71, 71, 73, 73, 76,
+            76, 79, 79, 82, 82, 83, 83, 84, 63, 60, 60, 57,
+            57, 56, 56, 54, 54, 57, 57, 60, 60, 64, 64, 67,
+            67, 71, 71, 75, 75, 78, 78, 82, 82, 85, 85, 89,
+            89, 90, 90, 92, 63, 60, 60, 57, 57, 56, 56, 54,
+            54, 57, 57, 60, 60, 64, 64, 67, 67, 71, 71, 75,
+            75, 78, 78, 82, 82, 85, 85, 89, 89, 90, 90, 92,
+            66, 63, 63, 60, 60, 59, 59, 57, 57, 60, 60, 62,
+            62, 66, 66, 69, 69, 73, 73, 77, 77, 80, 80, 84,
+            84, 88, 88, 92, 92, 93, 93, 95,
+        },
+    },
+    {
+        {
+            32, 31, 31, 31, 31, 31, 32, 32, 32, 32, 34, 34,
+            35, 36, 38, 39, 41, 44, 44, 48, 48, 53, 53, 57,
+            58, 61, 65, 67, 71, 72, 79, 79, 31, 32, 32, 32,
+            32, 32, 32, 32, 32, 33, 34, 34, 34, 35, 36, 38,
+            39, 41, 42, 45, 45, 49, 50, 53, 54, 57, 60, 62,
+            66, 66, 73, 73, 31, 32, 32, 32, 32, 32, 32, 32,
+            33, 33, 34, 34, 34, 34, 36, 37, 39, 41, 42, 45,
+            45, 49, 49, 52, 54, 57, 60, 61, 65, 66, 72, 72,
+            32, 32, 32, 32, 32, 33, 33, 34, 34, 34, 36, 36,
+            37, 37, 38, 40, 41, 42, 43, 46, 46, 49, 50, 52,
+            54, 56, 59, 60, 64, 64, 71, 71, 32, 32, 32, 32,
+            33, 33, 34, 34, 35, 35, 37, 37, 38, 38, 40, 40,
+            41, 43, 43, 46, 46, 49, 50, 52, 54, 56, 58, 60,
+            63, 64, 70, 70, 34, 34, 34, 33, 33, 34, 35, 35,
+            37, 37, 39, 39, 42, 43, 44, 45, 46, 48, 48, 51,
+            51, 54, 54, 57, 58, 60, 63, 64, 68, 68, 74, 74,
+            36, 35, 35, 35, 34, 35, 36, 37, 38, 39, 42, 42,
+            47, 48, 49, 50, 51, 53, 54, 56, 56, 59, 60, 62,
+            63, 66, 68, 69, 73, 73, 79, 79, 38, 37, 37, 36,
+            36, 37, 38, 38, 39, 40, 44, 44, 48, 49, 51, 52,
+            54, 56, 56, 59, 59, 62, 63, 65, 67, 69, 71, 72,
+            76, 76, 82, 82, 44, 42, 42, 41, 41, 41, 42, 42,
+            42, 43, 48, 48, 52, 54, 56, 58, 60, 63, 64, 67,
+            67, 71, 71, 74, 75, 77, 79, 81, 84, 85, 90, 90,
+            44, 43, 43, 42, 41, 42, 43, 43, 43, 44, 48, 48,
+            53, 54, 57, 58, 60, 64, 64, 67, 67, 71, 72, 75,
+            76, 78, 80, 82, 85, 86, 91, 91, 53, 51, 51, 50,
+            49, 49, 50, 49, 49, 50, 54, 54, 59, 60, 63, 65,
+            67, 71, 72, 76, 76, 81, 82, 85, 87, 89, 92, 94,
+            97, 98, 104, 104, 53, 51, 51, 50, 49, 49, 50, 49,
+            49, 50, 54, 54, 59, 60, 63, 65, 67, 71, 72, 76,
+            76, 81, 82, 85, 87, 89, 92, 94, 97, 98, 104, 104,
+            62, 60, 59, 58, 57, 57, 57, 56, 56, 56, 61, 61,
+            65, 66, 69, 71, 74, 78, 79, 83, 83, 89, 90, 94,
+            95, 98, 102, 103, 108, 108, 115, 115, 65, 62, 62, 60,
+            59, 59, 59, 59, 58, 58, 63, 63, 67, 68, 71, 73,
+            76, 79, 81, 85, 85, 91, 92, 96, 98, 101, 105, 106,
+            111, 111, 118, 118, 73, 70, 69, 67, 66, 66, 65, 65,
+            64, 64, 69, 69, 73, 74, 77, 79, 81, 85, 86, 91,
+            91, 98, 99, 103, 105, 108, 112, 114, 119, 119, 127, 127,
+            79, 75, 75, 73, 72, 71, 71, 70, 69, 69, 73, 73,
+            77, 78, 81, 84, 86, 90, 91, 96, 96, 103, 103, 108,
+            110, 114, 118, 120, 125, 125, 133, 133,
+        },
+        {
+            32, 31, 31, 30, 30, 32, 33, 34, 37, 37, 42, 42,
+            47, 49, 48, 48, 48, 49, 49, 50, 50, 52, 52, 53,
+            54, 55, 57, 58, 60, 60, 63, 63, 31, 31, 31, 32,
+            32, 33, 35, 37, 40, 40, 43, 43, 46, 47, 46, 46,
+            46, 45, 46, 47, 47, 48, 48, 50, 50, 51, 52, 53,
+            55, 55, 58, 58, 31, 31, 31, 32, 32, 34, 36, 37,
+            40, 40, 43, 43, 46, 46, 46, 46, 45, 45, 45, 46,
+            46, 48, 48, 49, 50, 51, 52, 53, 54, 55, 57, 57,
+            35, 36, 36, 37, 37, 39, 40, 42, 45, 45, 46, 46,
+            47, 47, 47, 46, 46, 45, 46, 46, 46, 47, 47, 48,
+            49, 50, 51, 51, 53, 53, 56, 56, 37, 38, 38, 39,
+            40, 41, 43, 44, 47, 47, 47, 47, 48, 48, 47, 47,
+            46, 46, 46, 46, 46, 47, 47, 48, 49, 49, 50, 51,
+            52, 53, 55, 55, 42, 42, 42, 42, 42, 44, 45, 45,
+            47, 47, 48, 48, 50, 50, 50, 50, 49, 49, 49, 50,
+            50, 50, 50, 51, 52, 52, 53, 54, 55, 55, 58, 58,
+            48, 47, 47, 46, 46, 46, 47, 47, 47, 48, 50, 50,
+            52, 53, 53, 53, 53, 53, 53, 54, 54, 54, 54, 55,
+            55, 56, 56, 57, 58, 59, 60, 60, 48, 47, 47, 46,
+            46, 46, 46, 47, 47, 47, 50, 50, 52, 53, 53, 54,
+            54, 55, 55, 55, 55, 56, 56, 57, 57, 58, 58, 59,
+            60, 60, 62, 62, 49, 47, 47, 46, 45, 45, 46, 45,
+            45, 46, 49, 49, 53, 53, 55, 56, 57, 58, 58, 59,
+            59, 61, 61, 62, 62, 63, 64, 64, 65, 65, 67, 67,
+            49, 47, 47, 46, 45, 45, 46, 46, 46, 46, 49, 49,
+            53, 54, 55, 56, 57, 59, 59, 60, 60, 61, 61, 62,
+            63, 63, 64, 65, 66, 66, 68, 68, 52, 50, 50, 48,
+            48, 48, 47, 47, 47, 47, 50, 50, 53, 54, 56, 57,
+            59, 61, 62, 64, 64, 66, 66, 68, 68, 69, 70, 71,
+            72, 73, 75, 75, 52, 50, 50, 48, 48, 48, 47, 47,
+            47, 47, 50, 50, 53, 54, 56, 57, 59, 61, 62, 64,
+            64, 66, 66, 68, 68, 69, 70, 71, 72, 73, 75, 75,
+            56, 54, 53, 52, 51, 51, 50, 50, 49, 49, 53, 53,
+            55, 56, 58, 59, 61, 63, 64, 66, 66, 69, 70, 71,
+            72, 74, 75, 76, 77, 78, 80, 80, 57, 54, 54, 52,
+            52, 51, 51, 51, 50, 50, 53, 53, 56, 57, 58, 60,
+            61, 64, 64, 67, 67, 70, 71, 72, 73, 75, 76, 77,
+            79, 79, 82, 82, 61, 58, 57, 56, 55, 54, 54, 53,
+            52, 53, 56, 56, 58, 59, 61, 62, 63, 66, 66, 69,
+            69, 72, 73, 75, 76, 78, 79, 80, 82, 83, 86, 86,
+            63, 60, 60, 58, 57, 57, 56, 55, 54, 55, 57, 57,
+            60, 60, 62, 64, 65, 67, 68, 71, 71, 74, 75, 77,
+            78, 80, 82, 83, 85, 85, 89, 89,
+        },
+    },
+    {
+        {
+            32, 31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 33,
+            34, 34, 36, 36, 38, 39, 41, 44, 44, 47, 48, 50,
+            53, 53, 57, 58, 61, 65, 65, 70, 31, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 33, 34, 34, 35, 35,
+            37, 38, 39, 41, 41, 44, 45, 47, 50, 50, 54, 55,
+            57, 61, 61, 65, 31, 32, 32, 32, 32, 32, 32, 32,
+            32, 33, 33, 33, 34, 34, 34, 34, 37, 37, 39, 41,
+            41, 44, 45, 46, 49, 49, 53, 54, 56, 60, 60, 64,
+            31, 32, 32, 32, 32, 32, 33, 33, 33, 34, 34, 35,
+            35, 35, 36, 36, 38, 39, 40, 42, 42, 44, 45, 47,
+            50, 50, 53, 54, 56, 59, 59, 63, 32, 32, 32, 32,
+            33, 33, 34, 34, 34, 35, 35, 36, 37, 37, 38, 38,
+            40, 40, 41, 43, 43, 45, 46, 47, 50, 50, 53, 54,
+            56, 58, 58, 62, 32, 32, 32, 32, 33, 33, 34, 34,
+            34, 35, 35, 36, 37, 37, 38, 38, 40, 40, 41, 43,
+            43, 45, 46, 47, 50, 50, 53, 54, 56, 58, 58, 62,
+            35, 35, 35, 34, 34, 34, 35, 36, 36, 37, 37, 40,
+            41, 43, 46, 46, 47, 48, 49, 51, 51, 53, 54, 55,
+            57, 57, 60, 61, 63, 66, 66, 70, 36, 35, 35, 35,
+            34, 34, 36, 36, 37, 38, 38, 41, 42, 44, 48, 48,
+            50, 50, 51, 53, 53, 56, 56, 58, 60, 60, 63, 63,
+            65, 68, 68, 72, 39, 38, 38, 37, 37, 37, 38, 38,
+            39, 40, 40, 43, 44, 46, 50, 50, 52, 53, 54, 57,
+            57, 59, 60, 61, 64, 64, 67, 68, 69, 72, 72, 76,
+            44, 42, 42, 41, 41, 41, 42, 42, 42, 42, 42, 46,
+            48, 50, 54, 54, 57, 58, 60, 63, 63, 66, 67, 68,
+            71, 71, 74, 75, 77, 79, 79, 83, 44, 42, 42, 41,
+            41, 41, 42, 42, 42, 42, 42, 46, 48, 50, 54, 54,
+            57, 58, 60, 63, 63, 66, 67, 68, 71, 71, 74, 75,
+            77, 79, 79, 83, 51, 49, 49, 48, 47, 47, 48, 48,
+            48, 48, 48, 52, 53, 55, 58, 58, 62, 63, 66, 69,
+            69, 73, 74, 76, 79, 79, 83, 84, 86, 89, 89, 93,
+            53, 52, 51, 50, 49, 49, 49, 50, 49, 49, 49, 53,
+            54, 56, 60, 60, 64, 65, 67, 71, 71, 75, 76, 78,
+            82, 82, 86, 87, 89, 92, 92, 96, 58, 56, 55, 54,
+            53, 53, 53, 53, 53, 52, 52, 56, 57, 59, 63, 63,
+            67, 68, 70, 74, 74, 78, 79, 82, 86, 86, 90, 91,
+            93, 97, 97, 101, 65, 63, 62, 61, 59, 59, 59, 59,
+            58, 58, 58, 62, 63, 65, 68, 68, 72, 73, 76, 79,
+            79, 84, 85, 88, 92, 92, 97, 98, 100, 105, 105, 109,
+            65, 63, 62, 61, 59, 59, 59, 59, 58, 58, 58, 62,
+            63, 65, 68, 68, 72, 73, 76, 79, 79, 84, 85, 88,
+            92, 92, 97, 98, 100, 105, 105, 109,
+        },
+        {
+            32, 31, 31, 31, 30, 30, 33, 33, 35, 37, 37, 41,
+            42, 44, 49, 49, 48, 48, 48, 49, 49, 50, 50, 51,
+            52, 52, 54, 54, 55, 57, 57, 59, 31, 31, 31, 31,
+            32, 32, 34, 35, 37, 39, 39, 42, 42, 44, 47, 47,
+            46, 46, 46, 46, 46, 47, 47, 48, 48, 48, 50, 51,
+            51, 53, 53, 55, 31, 31, 31, 32, 32, 32, 35, 36,
+            37, 40, 40, 42, 43, 44, 46, 46, 46, 46, 45, 45,
+            45, 46, 46, 47, 48, 48, 49, 50, 51, 52, 52, 54,
+            33, 34, 34, 34, 35, 35, 37, 38, 40, 43, 43, 44,
+            44, 45, 47, 47, 46, 46, 46, 45, 45, 46, 46, 47,
+            47, 47, 49, 49, 50, 51, 51, 53, 37, 38, 38, 39,
+            40, 40, 42, 43, 44, 47, 47, 47, 47, 47, 48, 48,
+            47, 47, 46, 46, 46, 46, 46, 47, 47, 47, 48, 49,
+            49, 50, 50, 52, 37, 38, 38, 39, 40, 40, 42, 43,
+            44, 47, 47, 47, 47, 47, 48, 48, 47, 47, 46, 46,
+            46, 46, 46, 47, 47, 47, 48, 49, 49, 50, 50, 52,
+            45, 45, 45, 45, 44, 44, 46, 46, 46, 47, 47, 49,
+            49, 50, 52, 52, 51, 51, 51, 51, 51, 52, 52, 52,
+            53, 53, 54, 54, 54, 55, 55, 57, 48, 47, 47, 46,
+            46, 46, 47, 47, 47, 47, 47, 49, 50, 51, 53, 53,
+            53, 53, 53, 53, 53, 54, 54, 54, 54, 54, 55, 55,
+            56, 56, 56, 58, 48, 47, 47, 46, 45, 45, 46, 46,
+            46, 47, 47, 49, 50, 51, 53, 53, 54, 54, 54, 55,
+            55, 56, 56, 56, 57, 57, 58, 58, 58, 59, 59, 61,
+            49, 47, 47, 46, 45, 45, 45, 46, 45, 45, 45, 48,
+            49, 51, 53, 53, 55, 56, 57, 58, 58, 59, 59, 60,
+            61, 61, 62, 62, 63, 64, 64, 65, 49, 47, 47, 46,
+            45, 45, 45, 46, 45, 45, 45, 48, 49, 51, 53, 53,
+            55, 56, 57, 58, 58, 59, 59, 60, 61, 61, 62, 62,
+            63, 64, 64, 65, 51, 50, 49, 48, 47, 47, 47, 47,
+            47, 46, 46, 49, 50, 52, 54, 54, 56, 57, 58, 61,
+            61, 62, 63, 64, 65, 65, 67, 67, 68, 69, 69, 70,
+            52, 50, 50, 49, 48, 48, 47, 47, 47, 47, 47, 50,
+            50, 52, 54, 54, 57, 57, 59, 61, 61, 63, 64, 65,
+            66, 66, 68, 68, 69, 70, 70, 72, 54, 52, 51, 51,
+            49, 49, 49, 49, 48, 48, 48, 51, 51, 53, 55, 55,
+            58, 58, 60, 62, 62, 64, 65, 66, 68, 68, 70, 70,
+            71, 73, 73, 74, 57, 55, 54, 53, 52, 52, 51, 51,
+            51, 50, 50, 52, 53, 54, 57, 57, 59, 60, 61, 64,
+            64, 66, 67, 68, 71, 71, 73, 73, 74, 76, 76, 78,
+            57, 55, 54, 53, 52, 52, 51, 51, 51, 50, 50, 52,
+            53, 54, 57, 57, 59, 60, 61, 64, 64, 66, 67, 68,
+            71, 71, 73, 73, 74, 76, 76, 78,
+        },
+    },
+    {
+        {
+            32, 31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 32,
+            32, 34, 34, 35, 36, 36, 38, 39, 39, 42, 44, 44,
+            47, 48, 49, 53, 53, 55, 58, 58, 31, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 33, 34, 34, 34,
+            35, 35, 37, 38, 38, 40, 42, 42, 45, 46, 47, 50,
+            51, 52, 55, 55, 31, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 33, 33, 33, 34, 34, 34, 34, 34, 36, 37,
+            37, 40, 41, 41, 44, 45, 46, 49, 49, 51, 54, 54,
+            31, 32, 32, 32, 32, 32, 32, 32, 33, 33, 33, 33,
+            33, 34, 34, 34, 35, 35, 37, 38, 38, 40, 41, 41,
+            44, 45, 46, 49, 49, 51, 54, 54, 32, 32, 32, 32,
+            32, 32, 33, 33, 34, 34, 35, 35, 35, 36, 36, 37,
+            37, 37, 39, 40, 40, 42, 42, 43, 45, 46, 47, 49,
+            50, 51, 54, 54, 32, 32, 32, 32, 32, 33, 33, 34,
+            34, 34, 35, 35, 36, 37, 37, 37, 38, 38, 40, 40,
+            40, 42, 43, 43, 45, 46, 47, 49, 50, 51, 54, 54,
+            32, 33, 33, 33, 33, 33, 33, 34, 34, 35, 36, 36,
+            36, 38, 38, 39, 40, 40, 41, 42, 42, 44, 45, 45,
+            47, 48, 48, 51, 51, 53, 55, 55, 35, 35, 35, 35,
+            34, 34, 35, 36, 36, 37, 38, 38, 39, 42, 42, 44,
+            47, 47, 48, 49, 49, 51, 52, 52, 54, 55, 56, 58,
+            59, 60, 62, 62, 36, 35, 35, 35, 35, 34, 35, 36,
+            36, 37, 38, 38, 40, 42, 42, 45, 48, 48, 49, 50,
+            50, 52, 53, 54, 56, 56, 57, 59, 60, 61, 63, 63,
+            38, 37, 37, 37, 36, 36, 36, 38, 38, 38, 39, 39,
+            41, 44, 44, 46, 49, 49, 51, 52, 52, 55, 56, 56,
+            58, 59, 60, 62, 63, 64, 67, 67, 44, 43, 42, 42,
+            41, 41, 41, 42, 42, 42, 42, 42, 44, 48, 48, 50,
+            54, 54, 56, 58, 58, 61, 63, 63, 66, 67, 67, 71,
+            71, 72, 75, 75, 44, 43, 42, 42, 41, 41, 41, 42,
+            42, 42, 42, 42, 44, 48, 48, 50, 54, 54, 56, 58,
+            58, 61, 63, 63, 66, 67, 67, 71, 71, 72, 75, 75,
+            47, 46, 45, 45, 44, 44, 44, 45, 45, 45, 45, 45,
+            47, 50, 50, 53, 56, 56, 58, 60, 60, 64, 66, 66,
+            69, 70, 71, 74, 75, 76, 79, 79, 53, 52, 51, 51,
+            49, 49, 49, 49, 50, 49, 49, 49, 51, 54, 54, 57,
+            60, 60, 63, 65, 65, 69, 71, 72, 75, 76, 77, 81,
+            82, 83, 87, 87, 53, 52, 51, 51, 49, 49, 49, 49,
+            50, 49, 49, 49, 51, 54, 54, 57, 60, 60, 63, 65,
+            65, 69, 71, 72, 75, 76, 77, 81, 82, 83, 87, 87,
+            59, 57, 56, 56, 54, 54, 54, 54, 54, 54, 53, 53,
+            55, 58, 58, 61, 64, 64, 67, 69, 69, 73, 75, 76,
+            79, 80, 81, 86, 87, 88, 92, 92,
+        },
+        {
+            32, 31, 31, 31, 30, 30, 31, 33, 33, 34, 37, 37,
+            39, 42, 42, 45, 49, 49, 48, 48, 48, 49, 49, 49,
+            50, 50, 51, 52, 52, 53, 54, 54, 31, 31, 31, 31,
+            31, 31, 32, 35, 35, 36, 39, 39, 40, 42, 42, 45,
+            47, 47, 47, 46, 46, 46, 46, 46, 47, 48, 48, 49,
+            49, 50, 51, 51, 31, 31, 31, 31, 32, 32, 33, 35,
+            36, 37, 40, 40, 41, 43, 43, 44, 46, 46, 46, 46,
+            46, 45, 45, 45, 46, 46, 47, 48, 48, 48, 50, 50,
+            31, 32, 32, 32, 32, 33, 33, 36, 36, 37, 41, 41,
+            42, 43, 43, 45, 47, 47, 46, 46, 46, 45, 45, 45,
+            46, 46, 47, 48, 48, 48, 50, 50, 35, 36, 37, 37,
+            38, 38, 38, 41, 41, 42, 45, 45, 46, 46, 46, 47,
+            48, 48, 47, 46, 46, 46, 45, 46, 46, 46, 47, 47,
+            47, 48, 49, 49, 37, 38, 38, 38, 39, 40, 40, 43,
+            43, 44, 47, 47, 47, 47, 47, 47, 48, 48, 47, 47,
+            47, 46, 46, 46, 46, 46, 47, 47, 47, 48, 49, 49,
+            38, 39, 40, 40, 40, 41, 41, 43, 44, 45, 47, 47,
+            47, 48, 48, 48, 49, 49, 48, 48, 48, 47, 47, 47,
+            48, 48, 48, 48, 48, 49, 50, 50, 47, 46, 46, 46,
+            45, 45, 45, 46, 46, 47, 47, 47, 48, 50, 50, 51,
+            52, 52, 52, 52, 52, 52, 52, 52, 53, 53, 53, 53,
+            53, 54, 55, 55, 48, 47, 47, 47, 46, 46, 46, 47,
+            47, 47, 47, 47, 48, 50, 50, 51, 53, 53, 53, 53,
+            53, 53, 53, 53, 54, 54, 54, 54, 54, 54, 55, 55,
+            48, 47, 47, 47, 46, 46, 46, 46, 46, 47, 47, 47,
+            48, 50, 50, 51, 53, 53, 53, 54, 54, 54, 55, 55,
+            55, 55, 55, 56, 56, 56, 57, 57, 49, 48, 47, 47,
+            45, 45, 45, 45, 46, 45, 45, 45, 47, 49, 49, 51,
+            53, 53, 55, 56, 56, 57, 58, 58, 59, 59, 60, 61,
+            61, 61, 62, 62, 49, 48, 47, 47, 45, 45, 45, 45,
+            46, 45, 45, 45, 47, 49, 49, 51, 53, 53, 55, 56,
+            56, 57, 58, 58, 59, 59, 60, 61, 61, 61, 62, 62,
+            50, 49, 48, 48, 46, 46, 46, 46, 46, 46, 46, 46,
+            47, 50, 50, 52, 54, 54, 55, 56, 56, 58, 59, 60,
+            61, 61, 61, 63, 63, 63, 65, 65, 52, 50, 50, 50,
+            48, 48, 48, 47, 47, 47, 47, 47, 48, 50, 50, 52,
+            54, 54, 56, 57, 57, 60, 61, 61, 63, 64, 64, 66,
+            66, 67, 68, 68, 52, 50, 50, 50, 48, 48, 48, 47,
+            47, 47, 47, 47, 48, 50, 50, 52, 54, 54, 56, 57,
+            57, 60, 61, 61, 63, 64, 64, 66, 66, 67, 68, 68,
+            54, 53, 52, 52, 50, 50, 50, 49, 49, 49, 48, 48,
+            50, 52, 52, 54, 55, 55, 57, 59, 59, 61, 62, 63,
+            65, 65, 66, 68, 68, 69, 71, 71,
+        },
+    },
+    {
+        {
+            32, 31, 31, 31, 31, 31, 31, 31, 31, 32, 32, 32,
+            32, 32, 32, 34, 34, 34, 35, 36, 36, 38, 39, 39,
+            41, 44, 44, 44, 47, 48, 48, 51, 31, 31, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 33, 34,
+            34, 34, 35, 35, 35, 37, 38, 38, 40, 42, 42, 43,
+            45, 46, 46, 49, 31, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 33, 33, 33, 34, 34, 34, 34, 34,
+            34, 36, 37, 37, 39, 41, 41, 42, 44, 45, 45, 47,
+            31, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            33, 33, 33, 34, 34, 34, 34, 34, 34, 36, 37, 37,
+            39, 41, 41, 42, 44, 45, 45, 47, 31, 32, 32, 32,
+            32, 32, 32, 32, 33, 33, 33, 33, 34, 34, 34, 35,
+            35, 35, 36, 36, 36, 37, 39, 39, 40, 42, 42, 42,
+            44, 45, 45, 48, 32, 32, 32, 32, 32, 33, 33, 33,
+            34, 34, 34, 35, 35, 35, 36, 37, 37, 37, 38, 38,
+            38, 40, 40, 40, 41, 43, 43, 43, 45, 46, 46, 48,
+            32, 32, 32, 32, 32, 33, 33, 33, 34, 34, 34, 35,
+            35, 35, 36, 37, 37, 37, 38, 38, 38, 40, 40, 40,
+            41, 43, 43, 43, 45, 46, 46, 48, 32, 33, 33, 33,
+            33, 33, 33, 33, 34, 34, 34, 35, 36, 36, 36, 38,
+            38, 38, 39, 40, 40, 41, 42, 42, 43, 45, 45, 45,
+            47, 48, 48, 50, 35, 35, 35, 35, 34, 34, 34, 34,
+            35, 36, 36, 37, 37, 37, 39, 41, 41, 42, 45, 46,
+            46, 47, 48, 48, 49, 51, 51, 51, 53, 54, 54, 56,
+            36, 35, 35, 35, 35, 34, 34, 35, 36, 36, 36, 37,
+            38, 38, 40, 42, 42, 43, 47, 48, 48, 49, 50, 50,
+            51, 53, 53, 54, 56, 56, 56, 58, 36, 35, 35, 35,
+            35, 34, 34, 35, 36, 36, 36, 37, 38, 38, 40, 42,
+            42, 43, 47, 48, 48, 49, 50, 50, 51, 53, 53, 54,
+            56, 56, 56, 58, 40, 39, 39, 39, 39, 38, 38, 38,
+            39, 39, 39, 40, 41, 41, 42, 45, 45, 46, 50, 51,
+            51, 53, 54, 54, 56, 59, 59, 59, 61, 62, 62, 64,
+            44, 43, 42, 42, 41, 41, 41, 41, 42, 42, 42, 42,
+            42, 42, 44, 48, 48, 49, 52, 54, 54, 56, 58, 58,
+            60, 63, 63, 64, 66, 67, 67, 69, 44, 43, 42, 42,
+            41, 41, 41, 41, 42, 42, 42, 42, 42, 42, 44, 48,
+            48, 49, 52, 54, 54, 56, 58, 58, 60, 63, 63, 64,
+            66, 67, 67, 69, 47, 46, 45, 45, 45, 44, 44, 44,
+            44, 45, 45, 45, 45, 45, 47, 50, 50, 51, 55, 56,
+            56, 58, 60, 60, 62, 66, 66, 67, 69, 70, 70, 73,
+            53, 52, 51, 51, 50, 49, 49, 49, 49, 50, 50, 49,
+            49, 49, 51, 54, 54, 55, 59, 60, 60, 63, 65, 65,
+            67, 71, 71, 72, 75, 76, 76, 79,
+        },
+        {
+            32, 31, 31, 31, 31, 30, 30, 31, 33, 33, 33, 35,
+            37, 37, 39, 42, 42, 43, 47, 49, 49, 48, 48, 48,
+            48, 49, 49, 49, 50, 50, 50, 51, 31, 31, 31, 31,
+            31, 31, 31, 32, 34, 35, 35, 37, 39, 39, 40, 42,
+            42, 43, 46, 47, 47, 47, 47, 47, 47, 46, 46, 47,
+            48, 48, 48, 49, 31, 31, 31, 31, 32, 32, 32, 33,
+            35, 36, 36, 38, 40, 40, 41, 43, 43, 43, 46, 46,
+            46, 46, 46, 46, 45, 45, 45, 45, 46, 46, 46, 47,
+            31, 31, 31, 31, 32, 32, 32, 33, 35, 36, 36, 38,
+            40, 40, 41, 43, 43, 43, 46, 46, 46, 46, 46, 46,
+            45, 45, 45, 45, 46, 46, 46, 47, 33, 33, 34, 34,
+            34, 35, 35, 35, 37, 38, 38, 41, 43, 43, 43, 44,
+            44, 45, 46, 47, 47, 46, 46, 46, 46, 45, 45, 45,
+            46, 46, 46, 47, 37, 38, 38, 38, 39, 40, 40, 40,
+            42, 43, 43, 45, 47, 47, 47, 47, 47, 47, 48, 48,
+            48, 47, 47, 47, 46, 46, 46, 46, 46, 46, 46, 47,
+            37, 38, 38, 38, 39, 40, 40, 40, 42, 43, 43, 45,
+            47, 47, 47, 47, 47, 47, 48, 48, 48, 47, 47, 47,
+            46, 46, 46, 46, 46, 46, 46, 47, 38, 39, 40, 40,
+            40, 41, 41, 41, 43, 44, 44, 46, 47, 47, 47, 48,
+            48, 48, 48, 49, 49, 48, 48, 48, 47, 47, 47, 47,
+            48, 48, 48, 48, 45, 45, 45, 45, 45, 44, 44, 45,
+            46, 46, 46, 47, 47, 47, 48, 49, 49, 50, 51, 52,
+            52, 52, 51, 51, 51, 51, 51, 52, 52, 52, 52, 52,
+            48, 47, 47, 47, 46, 46, 46, 46, 47, 47, 47, 47,
+            47, 47, 48, 50, 50, 50, 52, 53, 53, 53, 53, 53,
+            53, 53, 53, 53, 54, 54, 54, 54, 48, 47, 47, 47,
+            46, 46, 46, 46, 47, 47, 47, 47, 47, 47, 48, 50,
+            50, 50, 52, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+            54, 54, 54, 54, 49, 48, 47, 47, 46, 45, 45, 45,
+            46, 46, 46, 46, 46, 46, 47, 49, 49, 50, 52, 53,
+            53, 54, 54, 54, 55, 56, 56, 56, 57, 57, 57, 58,
+            49, 48, 47, 47, 46, 45, 45, 45, 45, 46, 46, 45,
+            45, 45, 47, 49, 49, 50, 53, 53, 53, 55, 56, 56,
+            57, 58, 58, 58, 59, 59, 59, 60, 49, 48, 47, 47,
+            46, 45, 45, 45, 45, 46, 46, 45, 45, 45, 47, 49,
+            49, 50, 53, 53, 53, 55, 56, 56, 57, 58, 58, 58,
+            59, 59, 59, 60, 50, 49, 48, 48, 47, 46, 46, 46,
+            46, 46, 46, 46, 46, 46, 47, 50, 50, 50, 53, 54,
+            54, 55, 56, 56, 57, 59, 59, 60, 61, 61, 61, 62,
+            52, 51, 50, 50, 49, 48, 48, 48, 47, 47, 47, 47,
+            47, 47, 48, 50, 50, 51, 53, 54, 54, 56, 57, 57,
+            59, 61, 61, 62, 63, 64, 64, 65,
+        },
+    },
+    {
+        {
+            32, 31, 31, 31, 31, 31, 31, 31, 31, 31, 32, 32,
+            32, 32, 32, 32, 32, 33, 34, 34, 34, 35, 36, 36,
+            36, 37, 39, 39, 39, 41, 44, 44, 31, 31, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 33, 34, 34, 34, 34, 35, 35, 35, 37, 38, 38,
+            38, 40, 42, 42, 31, 31, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 33, 33, 33, 33, 34, 34,
+            34, 34, 34, 34, 34, 36, 37, 37, 37, 39, 41, 41,
+            31, 31, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 33, 33, 33, 33, 34, 34, 34, 34, 34, 34,
+            34, 36, 37, 37, 37, 39, 41, 41, 31, 31, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 33, 33,
+            33, 33, 34, 34, 34, 34, 34, 34, 34, 36, 37, 37,
+            37, 39, 41, 41, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 33, 33, 33, 33, 33, 34, 34, 34, 34, 35, 35,
+            35, 36, 36, 36, 36, 38, 39, 39, 39, 40, 42, 42,
+            32, 32, 32, 32, 32, 32, 33, 33, 33, 33, 34, 34,
+            34, 34, 35, 35, 35, 36, 37, 37, 37, 37, 38, 38,
+            38, 39, 40, 40, 40, 42, 43, 43, 32, 32, 32, 32,
+            32, 32, 33, 33, 33, 33, 34, 34, 34, 34, 35, 35,
+            35, 36, 37, 37, 37, 37, 38, 38, 38, 39, 40, 40,
+            40, 42, 43, 43, 32, 32, 32, 32, 32, 32, 33, 33,
+            33, 33, 34, 34, 34, 34, 35, 35, 35, 36, 37, 37,
+            37, 37, 38, 38, 38, 39, 40, 40, 40, 42, 43, 43,
+            34, 34, 34, 34, 34, 34, 33, 33, 33, 34, 35, 35,
+            35, 36, 37, 37, 37, 38, 39, 39, 39, 41, 43, 43,
+            43, 44, 45, 45, 45, 46, 48, 48, 36, 35, 35, 35,
+            35, 35, 34, 34, 34, 35, 36, 36, 36, 37, 38, 38,
+            38, 40, 42, 42, 42, 45, 48, 48, 48, 49, 50, 50,
+            50, 52, 53, 53, 36, 35, 35, 35, 35, 35, 34, 34,
+            34, 35, 36, 36, 36, 37, 38, 38, 38, 40, 42, 42,
+            42, 45, 48, 48, 48, 49, 50, 50, 50, 52, 53, 53,
+            36, 35, 35, 35, 35, 35, 34, 34, 34, 35, 36, 36,
+            36, 37, 38, 38, 38, 40, 42, 42, 42, 45, 48, 48,
+            48, 49, 50, 50, 50, 52, 53, 53, 39, 39, 38, 38,
+            38, 38, 37, 37, 37, 38, 39, 39, 39, 40, 40, 40,
+            40, 42, 45, 45, 45, 47, 51, 51, 51, 52, 54, 54,
+            54, 56, 58, 58, 44, 43, 42, 42, 42, 41, 41, 41,
+            41, 41, 42, 42, 42, 42, 42, 42, 42, 45, 48, 48,
+            48, 50, 54, 54, 54, 56, 58, 58, 58, 60, 63, 63,
+            44, 43, 42, 42, 42, 41, 41, 41, 41, 41, 42, 42,
+            42, 42, 42, 42, 42, 45, 48, 48, 48, 50, 54, 54,
+            54, 56, 58, 58, 58, 60, 63, 63,
+        },
+        {
+            32, 31, 31, 31, 31, 31, 30, 30, 30, 32, 33, 33,
+            33, 35, 37, 37, 37, 39, 42, 42, 42, 45, 49, 49,
+            49, 48, 48, 48, 48, 48, 49, 49, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 33, 34, 34, 34, 36, 38, 38,
+            38, 40, 42, 42, 42, 45, 48, 48, 48, 47, 47, 47,
+            47, 47, 47, 47, 31, 31, 31, 31, 31, 32, 32, 32,
+            32, 34, 36, 36, 36, 38, 40, 40, 40, 41, 43, 43,
+            43, 44, 46, 46, 46, 46, 46, 46, 46, 45, 45, 45,
+            31, 31, 31, 31, 31, 32, 32, 32, 32, 34, 36, 36,
+            36, 38, 40, 40, 40, 41, 43, 43, 43, 44, 46, 46,
+            46, 46, 46, 46, 46, 45, 45, 45, 31, 31, 31, 31,
+            31, 32, 32, 32, 32, 34, 36, 36, 36, 38, 40, 40,
+            40, 41, 43, 43, 43, 44, 46, 46, 46, 46, 46, 46,
+            46, 45, 45, 45, 33, 34, 34, 34, 34, 35, 35, 35,
+            35, 37, 39, 39, 39, 41, 43, 43, 43, 44, 45, 45,
+            45, 46, 47, 47, 47, 47, 46, 46, 46, 46, 45, 45,
+            37, 37, 38, 38, 38, 39, 40, 40, 40, 41, 43, 43,
+            43, 45, 47, 47, 47, 47, 47, 47, 47, 47, 48, 48,
+            48, 47, 47, 47, 47, 46, 46, 46, 37, 37, 38, 38,
+            38, 39, 40, 40, 40, 41, 43, 43, 43, 45, 47, 47,
+            47, 47, 47, 47, 47, 47, 48, 48, 48, 47, 47, 47,
+            47, 46, 46, 46, 37, 37, 38, 38, 38, 39, 40, 40,
+            40, 41, 43, 43, 43, 45, 47, 47, 47, 47, 47, 47,
+            47, 47, 48, 48, 48, 47, 47, 47, 47, 46, 46, 46,
+            42, 42, 42, 42, 42, 42, 42, 42, 42, 44, 45, 45,
+            45, 46, 47, 47, 47, 48, 48, 48, 48, 49, 50, 50,
+            50, 50, 50, 50, 50, 49, 49, 49, 48, 47, 47, 47,
+            47, 46, 46, 46, 46, 46, 47, 47, 47, 47, 47, 47,
+            47, 49, 50, 50, 50, 51, 53, 53, 53, 53, 53, 53,
+            53, 53, 53, 53, 48, 47, 47, 47, 47, 46, 46, 46,
+            46, 46, 47, 47, 47, 47, 47, 47, 47, 49, 50, 50,
+            50, 51, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+            48, 47, 47, 47, 47, 46, 46, 46, 46, 46, 47, 47,
+            47, 47, 47, 47, 47, 49, 50, 50, 50, 51, 53, 53,
+            53, 53, 53, 53, 53, 53, 53, 53, 48, 48, 47, 47,
+            47, 46, 45, 45, 45, 46, 46, 46, 46, 46, 46, 46,
+            46, 48, 50, 50, 50, 51, 53, 53, 53, 54, 54, 54,
+            54, 55, 56, 56, 49, 48, 47, 47, 47, 46, 45, 45,
+            45, 45, 46, 46, 46, 45, 45, 45, 45, 47, 49, 49,
+            49, 51, 53, 53, 53, 54, 56, 56, 56, 57, 58, 58,
+            49, 48, 47, 47, 47, 46, 45, 45, 45, 45, 46, 46,
+            46, 45, 45, 45, 45, 47, 49, 49, 49, 51, 53, 53,
+            53, 54, 56, 56, 56, 57, 58, 58,
+        },
+    },
+    {
+        {
+            32, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 32, 32, 32, 32, 32, 32, 32, 32, 32, 33, 34,
+            34, 34, 34, 35, 36, 36, 36, 37, 31, 31, 31, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 33, 33, 34, 34, 34, 34, 35,
+            35, 35, 35, 36, 31, 31, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 33, 33, 34, 34, 34, 34, 34, 35, 35, 35, 36,
+            31, 31, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 33, 33, 33, 33, 33, 33, 34,
+            34, 34, 34, 34, 34, 34, 34, 36, 31, 31, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 33, 33, 33, 33, 33, 33, 34, 34, 34, 34, 34,
+            34, 34, 34, 36, 31, 31, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 33, 33, 33,
+            33, 33, 33, 34, 34, 34, 34, 34, 34, 34, 34, 36,
+            31, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 33,
+            33, 33, 33, 33, 33, 33, 34, 34, 34, 34, 35, 35,
+            35, 35, 35, 36, 36, 36, 36, 37, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 33, 33, 34, 34, 34,
+            34, 34, 35, 35, 35, 35, 36, 36, 36, 36, 37, 37,
+            37, 37, 37, 38, 32, 32, 32, 32, 32, 32, 32, 32,
+            33, 33, 33, 33, 34, 34, 34, 34, 34, 35, 35, 35,
+            35, 36, 36, 37, 37, 37, 37, 38, 38, 38, 38, 39,
+            32, 32, 32, 32, 32, 32, 32, 32, 33, 33, 33, 33,
+            34, 34, 34, 34, 34, 35, 35, 35, 35, 36, 36, 37,
+            37, 37, 37, 38, 38, 38, 38, 39, 32, 32, 32, 32,
+            32, 32, 32, 32, 33, 33, 33, 33, 34, 34, 34, 34,
+            34, 35, 35, 35, 35, 36, 36, 37, 37, 37, 37, 38,
+            38, 38, 38, 39, 33, 33, 33, 33, 33, 33, 33, 33,
+            33, 33, 33, 34, 34, 35, 35, 35, 35, 36, 36, 36,
+            36, 37, 38, 39, 39, 39, 40, 41, 42, 42, 42, 42,
+            35, 35, 35, 35, 35, 35, 34, 34, 34, 34, 34, 35,
+            35, 36, 36, 36, 36, 37, 37, 37, 37, 39, 40, 41,
+            41, 41, 43, 45, 46, 46, 46, 46, 36, 35, 35, 35,
+            35, 35, 35, 35, 34, 34, 34, 35, 36, 36, 36, 36,
+            37, 38, 38, 38, 38, 40, 41, 42, 42, 42, 44, 47,
+            48, 48, 48, 49, 36, 35, 35, 35, 35, 35, 35, 35,
+            34, 34, 34, 35, 36, 36, 36, 36, 37, 38, 38, 38,
+            38, 40, 41, 42, 42, 42, 44, 47, 48, 48, 48, 49,
+            36, 35, 35, 35, 35, 35, 35, 35, 34, 34, 34, 35,
+            36, 36, 36, 36, 37, 38, 38, 38, 38, 40, 41, 42,
+            42, 42, 44, 47, 48, 48, 48, 49,
+        },
+        {
+            32, 31, 31, 31, 31, 31, 31, 30, 30, 30, 30, 31,
+            33, 33, 33, 33, 35, 36, 37, 37, 37, 39, 41, 42,
+            42, 42, 44, 47, 49, 49, 49, 49, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 32, 34, 34, 34, 34,
+            36, 37, 38, 38, 38, 39, 41, 42, 42, 42, 44, 46,
+            48, 48, 48, 48, 31, 31, 31, 31, 31, 31, 31, 31,
+            32, 32, 32, 33, 34, 35, 35, 35, 37, 38, 39, 39,
+            39, 40, 42, 42, 42, 42, 44, 46, 47, 47, 47, 47,
+            31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 32, 33,
+            35, 36, 36, 36, 37, 39, 40, 40, 40, 41, 42, 43,
+            43, 43, 44, 46, 46, 46, 46, 46, 31, 31, 31, 31,
+            31, 31, 32, 32, 32, 32, 32, 33, 35, 36, 36, 36,
+            37, 39, 40, 40, 40, 41, 42, 43, 43, 43, 44, 46,
+            46, 46, 46, 46, 31, 31, 31, 31, 31, 31, 32, 32,
+            32, 32, 32, 33, 35, 36, 36, 36, 37, 39, 40, 40,
+            40, 41, 42, 43, 43, 43, 44, 46, 46, 46, 46, 46,
+            33, 33, 34, 34, 34, 34, 34, 34, 35, 35, 35, 36,
+            37, 38, 38, 38, 40, 42, 43, 43, 43, 43, 44, 44,
+            44, 44, 45, 46, 47, 47, 47, 47, 35, 36, 36, 37,
+            37, 37, 37, 38, 38, 38, 38, 39, 40, 41, 41, 41,
+            43, 44, 45, 45, 45, 46, 46, 46, 46, 46, 47, 47,
+            48, 48, 48, 47, 37, 37, 38, 38, 38, 38, 39, 39,
+            40, 40, 40, 41, 42, 43, 43, 43, 44, 46, 47, 47,
+            47, 47, 47, 47, 47, 47, 47, 48, 48, 48, 48, 47,
+            37, 37, 38, 38, 38, 38, 39, 39, 40, 40, 40, 41,
+            42, 43, 43, 43, 44, 46, 47, 47, 47, 47, 47, 47,
+            47, 47, 47, 48, 48, 48, 48, 47, 37, 37, 38, 38,
+            38, 38, 39, 39, 40, 40, 40, 41, 42, 43, 43, 43,
+            44, 46, 47, 47, 47, 47, 47, 47, 47, 47, 47, 48,
+            48, 48, 48, 47, 40, 41, 41, 41, 41, 41, 41, 42,
+            42, 42, 42, 43, 44, 44, 44, 44, 45, 47, 47, 47,
+            47, 48, 48, 48, 48, 48, 49, 49, 50, 50, 50, 49,
+            45, 45, 45, 45, 45, 45, 45, 44, 44, 44, 44, 45,
+            46, 46, 46, 46, 46, 47, 47, 47, 47, 48, 49, 49,
+            49, 49, 50, 51, 52, 52, 52, 52, 48, 48, 47, 47,
+            47, 47, 46, 46, 46, 46, 46, 46, 47, 47, 47, 47,
+            47, 47, 47, 47, 47, 48, 49, 50, 50, 50, 51, 52,
+            53, 53, 53, 53, 48, 48, 47, 47, 47, 47, 46, 46,
+            46, 46, 46, 46, 47, 47, 47, 47, 47, 47, 47, 47,
+            47, 48, 49, 50, 50, 50, 51, 52, 53, 53, 53, 53,
+            48, 48, 47, 47, 47, 47, 46, 46, 46, 46, 46, 46,
+            47, 47, 47, 47, 47, 47, 47, 47, 47, 48, 49, 50,
+            50, 50, 51, 52, 53, 53, 53, 53,
+        },
+    },
+    {
+        {
+            32, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 33, 34, 34, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            33, 33, 34, 34, 31, 31, 31, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 33, 33, 34, 34,
+            31, 31, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 33, 33, 33, 34, 34, 31, 31, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 33, 33, 33, 33, 33,
+            33, 33, 34, 34, 31, 31, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 33, 33, 33, 33, 33, 33, 33, 34, 34,
+            31, 31, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 33,
+            33, 33, 33, 33, 33, 33, 34, 34, 31, 31, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+            33, 34, 34, 34, 31, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 33, 33, 33, 33, 33,
+            33, 33, 33, 33, 34, 34, 34, 34, 34, 34, 35, 35,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 33, 33, 33, 33, 33, 33, 33, 34, 34, 34,
+            34, 34, 34, 34, 35, 35, 36, 36, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 33, 33, 33, 33, 33, 33,
+            34, 34, 34, 34, 34, 34, 35, 35, 35, 35, 35, 35,
+            36, 36, 37, 37, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 33, 33, 33, 33, 33, 33, 34, 34, 34, 34,
+            34, 34, 35, 35, 35, 35, 35, 35, 36, 36, 37, 37,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 33, 33,
+            33, 33, 33, 33, 34, 34, 34, 34, 34, 34, 35, 35,
+            35, 35, 35, 35, 36, 36, 37, 37, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 33, 33, 33, 33, 33, 33,
+            34, 34, 34, 34, 34, 34, 35, 35, 35, 35, 35, 35,
+            36, 36, 37, 37, 32, 33, 33, 33, 33, 33, 33, 33,
+            33, 33, 33, 33, 33, 33, 33, 34, 34, 34, 34, 34,
+            34, 35, 35, 36, 36, 36, 36, 36, 36, 37, 38, 38,
+            34, 34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 33,
+            33, 33, 34, 34, 35, 35, 35, 35, 35, 35, 36, 36,
+            37, 37, 37, 37, 38, 38, 39, 39,
+        },
+        {
+            32, 31, 31, 31, 31, 31, 31, 31, 31, 30, 30, 30,
+            30, 30, 31, 32, 33, 33, 33, 33, 33, 34, 35, 36,
+            37, 37, 37, 37, 39, 40, 42, 42, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 32,
+            33, 34, 34, 34, 34, 35, 36, 37, 38, 38, 38, 38,
+            39, 41, 42, 42, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 32, 33, 34, 35, 35, 35,
+            35, 36, 37, 38, 39, 39, 39, 39, 40, 41, 42, 42,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 32, 32, 32,
+            32, 32, 32, 33, 35, 35, 35, 35, 35, 37, 38, 39,
+            40, 40, 40, 40, 41, 42, 43, 43, 31, 31, 31, 31,
+            31, 31, 31, 31, 32, 32, 32, 32, 32, 32, 33, 34,
+            35, 36, 36, 36, 36, 37, 38, 39, 40, 40, 40, 40,
+            41, 42, 43, 43, 31, 31, 31, 31, 31, 31, 31, 31,
+            32, 32, 32, 32, 32, 32, 33, 34, 35, 36, 36, 36,
+            36, 37, 38, 39, 40, 40, 40, 40, 41, 42, 43, 43,
+            31, 31, 31, 31, 31, 31, 31, 31, 32, 32, 32, 32,
+            32, 32, 33, 34, 35, 36, 36, 36, 36, 37, 38, 39,
+            40, 40, 40, 40, 41, 42, 43, 43, 31, 31, 32, 32,
+            32, 32, 32, 32, 32, 32, 33, 33, 33, 33, 33, 34,
+            35, 36, 36, 36, 36, 37, 39, 40, 41, 41, 41, 41,
+            42, 42, 43, 43, 33, 33, 33, 34, 34, 34, 34, 34,
+            34, 34, 35, 35, 35, 35, 35, 36, 37, 38, 38, 38,
+            38, 39, 41, 42, 43, 43, 43, 43, 43, 44, 44, 44,
+            35, 35, 35, 36, 36, 36, 36, 36, 36, 37, 37, 37,
+            37, 37, 38, 39, 40, 40, 40, 40, 40, 42, 43, 44,
+            45, 45, 45, 45, 45, 45, 46, 46, 37, 37, 38, 38,
+            38, 38, 38, 38, 39, 39, 40, 40, 40, 40, 40, 41,
+            42, 43, 43, 43, 43, 44, 45, 47, 47, 47, 47, 47,
+            47, 47, 47, 47, 37, 37, 38, 38, 38, 38, 38, 38,
+            39, 39, 40, 40, 40, 40, 40, 41, 42, 43, 43, 43,
+            43, 44, 45, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+            37, 37, 38, 38, 38, 38, 38, 38, 39, 39, 40, 40,
+            40, 40, 40, 41, 42, 43, 43, 43, 43, 44, 45, 47,
+            47, 47, 47, 47, 47, 47, 47, 47, 37, 37, 38, 38,
+            38, 38, 38, 38, 39, 39, 40, 40, 40, 40, 40, 41,
+            42, 43, 43, 43, 43, 44, 45, 47, 47, 47, 47, 47,
+            47, 47, 47, 47, 38, 39, 39, 40, 40, 40, 40, 40,
+            40, 40, 41, 41, 41, 41, 41, 42, 43, 44, 44, 44,
+            44, 45, 46, 47, 47, 47, 47, 47, 47, 47, 48, 48,
+            42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+            42, 42, 43, 44, 44, 45, 45, 45, 45, 45, 46, 47,
+            47, 47, 47, 47, 48, 48, 48, 48,
+        },
+    },
+    {
+        {
+            32, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 32, 32, 32, 32, 32, 32, 32, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 31, 31, 31, 31, 31, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            31, 31, 31, 31, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 31, 31, 31, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 31, 31, 31, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            31, 31, 31, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 31, 31, 31, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 31, 31, 31, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            31, 31, 31, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 31, 31, 31, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 31, 31, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 33, 33, 33, 33, 33, 33, 33, 33,
+            31, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 33, 33,
+            33, 33, 33, 33, 33, 33, 33, 33, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 33, 33, 33, 33, 33, 33, 33,
+            33, 33, 33, 33, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 33, 33, 33, 33, 34, 34, 34, 34, 34, 34, 34,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+            34, 34, 34, 34, 34, 34, 34, 34,
+        },
+        {
+            32, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 30, 30, 30, 30, 30, 30, 30, 31, 31, 32,
+            33, 33, 33, 33, 33, 33, 33, 34, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 32, 32, 33, 34, 34, 34,
+            34, 34, 34, 34, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 32, 33, 34, 34, 34, 34, 34, 34, 34, 35,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 32, 33, 33,
+            34, 35, 35, 35, 35, 35, 35, 35, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 32,
+            32, 32, 32, 32, 32, 32, 33, 34, 34, 35, 35, 35,
+            35, 35, 35, 36, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 33, 33, 34, 35, 36, 36, 36, 36, 36, 36, 36,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 33, 33, 34,
+            35, 36, 36, 36, 36, 36, 36, 36, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 33, 33, 34, 35, 36, 36, 36,
+            36, 36, 36, 36, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 33, 33, 34, 35, 36, 36, 36, 36, 36, 36, 36,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 33, 33, 34,
+            35, 36, 36, 36, 36, 36, 36, 36, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 33, 33, 34, 35, 36, 36, 36,
+            36, 36, 36, 36, 32, 32, 32, 32, 32, 33, 33, 33,
+            33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+            33, 34, 35, 35, 36, 37, 37, 37, 37, 37, 37, 38,
+            33, 33, 33, 33, 34, 34, 34, 34, 34, 34, 34, 34,
+            34, 34, 34, 35, 35, 35, 35, 35, 35, 35, 36, 37,
+            37, 38, 38, 38, 38, 38, 38, 39, 34, 34, 34, 35,
+            35, 35, 35, 35, 35, 35, 35, 35, 36, 36, 36, 36,
+            36, 36, 36, 36, 36, 37, 37, 38, 39, 40, 40, 40,
+            40, 40, 40, 40, 35, 35, 36, 36, 36, 37, 37, 37,
+            37, 37, 37, 37, 37, 37, 38, 38, 38, 38, 38, 38,
+            38, 38, 39, 40, 40, 41, 41, 41, 41, 41, 41, 42,
+            37, 37, 37, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+            39, 39, 39, 40, 40, 40, 40, 40, 40, 40, 41, 41,
+            42, 43, 43, 43, 43, 43, 43, 44,
+        },
+    },
+    {
+        {
+            32, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 32, 32, 32, 32, 32, 32, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 31, 31, 31, 31, 31, 31, 31, 31,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            31, 31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 31, 31, 31, 31,
+            31, 31, 31, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 31, 31, 31, 31, 31, 31, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 31, 31, 31, 31,
+            31, 31, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 31, 31, 31, 31, 31, 31, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 31, 31, 31, 31,
+            31, 31, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 31, 31, 31, 31, 31, 31, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32,
+        },
+        {
+            32, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 30, 30, 30, 30, 30, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 30, 30, 30, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 32, 32, 32,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 32, 32, 32, 32, 32, 32, 32, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 32,
+            32, 32, 32, 32, 32, 32, 32, 32,
+        },
+    },
+};
+
+// 16 wide and 4 high
+static const uint8_t qm_16x4[15][2][64] = {
+    {
+        {
+            31, 32, 32, 34, 34, 41, 45, 54, 60, 72, 75, 83,
+            88, 94, 101, 108, 44, 41, 42, 48, 54, 63, 67, 75,
+            79, 90, 92, 100, 100, 101, 108, 115, 79, 72, 71, 73,
+            78, 90, 96, 110, 118, 133, 136, 142, 140, 144, 141, 151,
+            96, 90, 86, 83, 89, 95, 102, 111, 123, 135, 149, 160,
+            173, 180, 188, 197,
+        },
+        {
+            31, 32, 36, 43, 46, 45, 46, 50, 52, 57, 59, 62,
+            63, 65, 67, 69, 49, 45, 46, 49, 53, 58, 59, 62,
+            64, 67, 68, 71, 69, 68, 70, 72, 63, 57, 56, 57,
+            60, 67, 71, 78, 82, 89, 90, 91, 89, 89, 86, 88,
+            69, 65, 62, 60, 63, 66, 70, 74, 80, 85, 91, 96,
+            101, 103, 105, 107,
+        },
+    },
+    {
+        {
+            31, 32, 32, 33, 34, 37, 44, 49, 56, 65, 72, 78,
+            84, 89, 95, 101, 44, 41, 42, 44, 54, 58, 66, 71,
+            77, 84, 90, 95, 95, 95, 101, 108, 73, 67, 65, 66,
+            74, 79, 90, 99, 107, 119, 127, 133, 132, 136, 132, 141,
+            93, 87, 83, 81, 86, 92, 98, 107, 117, 129, 141, 151,
+            163, 169, 175, 183,
+        },
+        {
+            31, 32, 36, 41, 46, 46, 46, 48, 51, 54, 57, 60,
+            62, 64, 65, 67, 49, 45, 46, 47, 53, 56, 59, 61,
+            63, 65, 67, 69, 67, 66, 68, 70, 61, 55, 54, 54,
+            59, 62, 68, 73, 77, 82, 86, 88, 86, 87, 83, 86,
+            69, 64, 61, 59, 62, 65, 68, 73, 78, 84, 89, 93,
+            98, 100, 102, 103,
+        },
+    },
+    {
+        {
+            31, 32, 32, 33, 34, 37, 41, 46, 53, 60, 65, 74,
+            79, 84, 89, 94, 39, 38, 39, 40, 47, 54, 58, 62,
+            68, 73, 78, 85, 90, 90, 95, 101, 65, 60, 59, 58,
+            65, 73, 79, 86, 97, 105, 111, 120, 125, 128, 124, 131,
+            90, 84, 81, 78, 83, 89, 94, 102, 112, 123, 134, 143,
+            154, 158, 164, 170,
+        },
+        {
+            31, 32, 36, 40, 44, 46, 45, 47, 49, 52, 54, 58,
+            60, 62, 64, 65, 48, 46, 46, 46, 51, 54, 56, 57,
+            58, 60, 62, 64, 66, 64, 66, 68, 57, 53, 51, 50,
+            54, 60, 64, 68, 73, 76, 79, 82, 84, 84, 81, 83,
+            68, 63, 60, 58, 61, 64, 67, 71, 77, 82, 87, 91,
+            95, 97, 99, 100,
+        },
+    },
+    {
+        {
+            31, 32, 32, 33, 34, 34, 39, 44, 49, 54, 60, 68,
+            75, 79, 84, 88, 36, 35, 36, 38, 42, 48, 51, 56,
+            60, 63, 68, 75, 81, 85, 89, 94, 62, 58, 57, 56,
+            61, 66, 74, 82, 90, 95, 102, 110, 117, 120, 116, 123,
+            88, 82, 79, 76, 81, 85, 91, 98, 107, 117, 127, 135,
+            145, 148, 153, 159,
+        },
+        {
+            31, 32, 35, 40, 43, 46, 45, 46, 48, 50, 52, 56,
+            58, 60, 62, 63, 48, 46, 47, 47, 50, 53, 53, 54,
+            54, 55, 56, 59, 61, 63, 64, 66, 56, 52, 50, 49,
+            53, 56, 61, 65, 70, 72, 75, 79, 81, 82, 79, 81,
+            67, 62, 60, 57, 60, 63, 66, 70, 75, 80, 85, 89,
+            93, 94, 96, 97,
+        },
+    },
+    {
+        {
+            31, 32, 32, 32, 33, 34, 37, 41, 45, 49, 54, 61,
+            68, 74, 78, 83, 36, 35, 35, 37, 41, 48, 50, 53,
+            56, 60, 63, 69, 75, 80, 84, 88, 53, 51, 49, 49,
+            53, 60, 65, 71, 76, 82, 87, 93, 100, 105, 109, 114,
+            81, 76, 73, 71, 74, 80, 85, 91, 98, 105, 112, 121,
+            130, 137, 142, 148,
+        },
+        {
+            31, 31, 33, 38, 42, 46, 46, 45, 46, 48, 50, 52,
+            56, 58, 60, 62, 48, 47, 46, 47, 49, 53, 53, 53,
+            54, 54, 55, 57, 59, 61, 62, 64, 52, 49, 48, 47,
+            50, 54, 57, 61, 64, 66, 68, 71, 73, 75, 76, 78,
+            64, 60, 57, 56, 57, 61, 64, 68, 71, 75, 78, 83,
+            87, 90, 92, 94,
+        },
+    },
+    {
+        {
+            31, 32, 32, 32, 33, 34, 34, 37, 41, 45, 49, 54,
+            60, 65, 72, 75, 36, 35, 34, 36, 38, 42, 48, 50,
+            53, 56, 60, 63, 68, 73, 79, 81, 53, 51, 49, 50,
+            49, 54, 60, 65, 71, 76, 82, 87, 92, 97, 104, 106,
+            79, 75, 72, 71, 69, 73, 78, 84, 90, 96, 103, 110,
+            118, 125, 133, 136,
+        },
+        {
+            31, 31, 32, 36, 40, 43, 46, 46, 45, 46, 48, 50,
+            52, 54, 57, 59, 48, 47, 46, 47, 47, 50, 53, 53,
+            53, 54, 54, 55, 56, 58, 60, 61, 52, 50, 48, 47,
+            47, 50, 54, 57, 61, 64, 66, 68, 70, 72, 75, 75,
+            63, 60, 57, 56, 54, 57, 60, 64, 67, 71, 75, 78,
+            82, 85, 89, 90,
+        },
+    },
+    {
+        {
+            31, 32, 32, 32, 32, 34, 34, 36, 39, 42, 45, 50,
+            54, 60, 66, 73, 34, 34, 33, 35, 37, 39, 42, 44,
+            46, 48, 51, 54, 58, 63, 68, 74, 44, 43, 41, 43,
+            43, 48, 53, 57, 60, 64, 67, 72, 76, 80, 85, 91,
+            65, 62, 59, 59, 58, 63, 67, 71, 76, 81, 85, 92,
+            98, 105, 111, 118,
+        },
+        {
+            31, 31, 32, 35, 40, 43, 46, 46, 46, 46, 47, 48,
+            50, 52, 55, 58, 42, 42, 42, 45, 47, 48, 50, 50,
+            49, 49, 50, 50, 52, 53, 55, 58, 49, 47, 45, 46,
+            46, 49, 53, 55, 57, 59, 60, 61, 63, 64, 66, 68,
+            57, 54, 52, 51, 50, 53, 56, 58, 61, 64, 67, 71,
+            73, 76, 79, 82,
+        },
+    },
+    {
+        {
+            31, 32, 32, 32, 32, 32, 34, 35, 37, 39, 41, 45,
+            50, 54, 57, 61, 32, 32, 33, 34, 34, 35, 37, 38,
+            40, 41, 43, 46, 50, 53, 56, 58, 44, 42, 41, 42,
+            42, 42, 48, 54, 57, 60, 63, 67, 71, 74, 77, 79,
+            58, 55, 53, 53, 53, 52, 57, 63, 67, 70, 74, 79,
+            86, 90, 93, 97,
+        },
+        {
+            31, 31, 32, 34, 37, 39, 42, 47, 46, 46, 46, 47,
+            48, 50, 51, 53, 37, 38, 40, 42, 44, 47, 47, 48,
+            47, 46, 46, 46, 47, 48, 49, 50, 49, 47, 45, 45,
+            45, 45, 49, 53, 55, 57, 58, 59, 61, 62, 63, 64,
+            54, 51, 49, 49, 48, 48, 51, 55, 58, 60, 62, 65,
+            68, 70, 71, 73,
+        },
+    },
+    {
+        {
+            31, 32, 32, 32, 32, 32, 33, 34, 35, 37, 38, 42,
+            45, 47, 51, 55, 32, 32, 32, 33, 34, 35, 36, 37,
+            38, 40, 40, 43, 45, 47, 50, 54, 38, 37, 36, 36,
+            38, 39, 41, 44, 49, 51, 52, 56, 58, 60, 63, 67,
+            53, 51, 49, 49, 50, 49, 51, 54, 60, 63, 65, 71,
+            75, 77, 82, 87,
+        },
+        {
+            31, 31, 31, 32, 35, 39, 40, 42, 47, 47, 46, 46,
+            47, 48, 49, 51, 37, 38, 39, 40, 43, 47, 47, 47,
+            48, 47, 47, 46, 46, 47, 47, 49, 48, 47, 46, 46,
+            46, 47, 48, 50, 53, 53, 54, 55, 55, 55, 56, 57,
+            52, 50, 48, 48, 47, 47, 48, 50, 54, 56, 57, 61,
+            63, 64, 66, 68,
+        },
+    },
+    {
+        {
+            31, 32, 32, 32, 32, 32, 32, 33, 34, 35, 35, 38,
+            40, 42, 45, 46, 32, 32, 32, 33, 34, 34, 35, 36,
+            37, 38, 38, 40, 41, 43, 45, 46, 36, 35, 35, 34,
+            36, 36, 38, 40, 42, 47, 48, 50, 51, 53, 56, 56,
+            44, 42, 41, 41, 42, 42, 42, 44, 48, 52, 54, 58,
+            60, 63, 66, 67,
+        },
+        {
+            31, 31, 31, 31, 34, 35, 39, 40, 42, 46, 47, 47,
+            47, 46, 48, 48, 37, 38, 39, 40, 42, 43, 47, 47,
+            47, 48, 48, 47, 46, 46, 46, 46, 48, 47, 46, 46,
+            47, 47, 47, 48, 50, 52, 53, 53, 53, 53, 54, 54,
+            49, 47, 46, 45, 45, 46, 45, 47, 49, 53, 53, 56,
+            57, 58, 59, 59,
+        },
+    },
+    {
+        {
+            31, 32, 32, 32, 32, 32, 32, 32, 32, 34, 34, 35,
+            35, 38, 38, 42, 32, 32, 32, 32, 32, 33, 33, 34,
+            34, 35, 35, 36, 36, 39, 39, 42, 34, 34, 34, 33,
+            33, 35, 35, 37, 37, 39, 39, 43, 43, 45, 45, 48,
+            39, 38, 38, 37, 37, 39, 39, 40, 40, 45, 45, 51,
+            51, 54, 54, 58,
+        },
+        {
+            31, 31, 31, 31, 31, 34, 34, 38, 38, 42, 42, 48,
+            48, 47, 47, 47, 33, 34, 34, 35, 35, 39, 39, 43,
+            43, 45, 45, 47, 47, 46, 46, 45, 42, 42, 42, 42,
+            42, 45, 45, 47, 47, 48, 48, 50, 50, 50, 50, 49,
+            48, 47, 47, 45, 45, 46, 46, 46, 46, 50, 50, 53,
+            53, 54, 54, 56,
+        },
+    },
+    {
+        {
+            31, 31, 32, 32, 32, 32, 32, 32, 32, 32, 32, 33,
+            34, 34, 35, 35, 31, 32, 32, 32, 32, 32, 32, 32,
+            32, 33, 33, 33, 34, 34, 34, 34, 32, 32, 32, 32,
+            33, 33, 34, 34, 34, 35, 35, 36, 37, 37, 38, 38,
+            36, 35, 35, 35, 34, 34, 36, 36, 37, 38, 38, 41,
+            42, 44, 48, 48,
+        },
+        {
+            31, 31, 31, 31, 31, 31, 34, 34, 36, 38, 38, 41,
+            42, 44, 48, 48, 31, 31, 31, 32, 32, 32, 35, 36,
+            37, 40, 40, 42, 43, 44, 46, 46, 37, 38, 38, 39,
+            40, 40, 42, 43, 44, 47, 47, 47, 47, 47, 48, 48,
+            48, 47, 47, 46, 46, 46, 47, 47, 47, 47, 47, 49,
+            50, 51, 53, 53,
+        },
+    },
+    {
+        {
+            31, 31, 31, 31, 31, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 33, 34, 31, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 33, 33, 33, 34, 32, 32, 32, 32,
+            32, 32, 32, 33, 33, 33, 33, 34, 34, 34, 35, 36,
+            32, 32, 32, 32, 32, 33, 33, 33, 34, 34, 34, 35,
+            35, 35, 36, 37,
+        },
+        {
+            31, 31, 31, 31, 31, 31, 31, 31, 33, 34, 34, 36,
+            38, 38, 39, 42, 31, 31, 31, 31, 32, 32, 32, 33,
+            35, 36, 36, 38, 40, 40, 41, 43, 35, 35, 36, 36,
+            36, 37, 37, 38, 40, 40, 40, 43, 45, 45, 45, 46,
+            37, 38, 38, 38, 39, 40, 40, 40, 42, 43, 43, 45,
+            47, 47, 47, 47,
+        },
+    },
+    {
+        {
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 32,
+            32, 32, 32, 32, 31, 31, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 31, 31, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 33,
+            33, 33, 33, 33,
+        },
+        {
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 32,
+            33, 34, 34, 34, 31, 31, 31, 31, 31, 31, 32, 32,
+            32, 32, 32, 33, 35, 36, 36, 36, 31, 31, 31, 31,
+            31, 31, 32, 32, 32, 32, 32, 33, 35, 36, 36, 36,
+            34, 34, 35, 35, 35, 35, 36, 36, 36, 36, 36, 37,
+            39, 40, 40, 40,
+        },
+    },
+    {
+        {
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 32, 32, 32, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 31, 31, 31, 32,
+            32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            31, 31, 31, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+            32, 32, 32, 32,
+        },
+        {
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 30, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 32, 32, 32,
+            31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+            32, 32, 32, 32,
+        },
+    },
+};
+
+// by level, plane and log2 of width and height - 2, NULL for 4x32 and 32x4
+static const uint8_t *Qm[15][2][4][4];
+static uint8_t qm_pool[15][2][3344];
+static pthread_once_t qm_once = PTHREAD_ONCE_INIT;
+
+/* w x h samples of the matrix src, which is w0 wide, every sy-th row and
+ * every sx-th column from row and column off on, transposed if asked to
+ */
+static uint8_t *
+qm_sample(uint8_t *dst, const uint8_t *src, int w0, int w, int h, int sx,
+          int sy, int off, int transpose)
+{
+    for (int i = 0; i < h; i++) {
+        for (int j = 0; j < w; j++) {
+            uint8_t v = src[(i * sy + off) * w0 + j * sx + off];
+            if (transpose) {
+                dst[j * h + i] = v;
+            } else {
+                dst[i * w + j] = v;
+            }
+        }
+    }
+    return dst + w * h;
+}
+
+static void
+qm_build(void)
+{
+    uint8_t sq[32 * 32];
+    for (int l = 0; l < 15; l++) {
+        for (int p = 0; p < 2; p++) {
+            const uint8_t **q = &Qm[l][p][0][0];
+            uint8_t *pos = qm_pool[l][p];
+            const uint8_t *t = qm_32x32[l][p];
+            for (int i = 0; i < 32; i++) {
+                for (int j = 0; j <= i; j++) {
+                    sq[i * 32 + j] = sq[j * 32 + i] = *t++;
+                }
+            }
+            const uint8_t *r = qm_32x16[l][p];
+            // squares, with the phase the samples happen to have
+            q[3 * 4 + 3] = pos;
+            pos = qm_sample(pos, sq, 32, 32, 32, 1, 1, 0, 0);
+            q[2 * 4 + 2] = pos;
+            pos = qm_sample(pos, sq, 32, 16, 16, 2, 2, 0, 0);
+            q[1 * 4 + 1] = pos;
+            pos = qm_sample(pos, sq, 32, 8, 8, 4, 4, 1, 0);
+            q[0 * 4 + 0] = pos;
+            pos = qm_sample(pos, sq, 32, 4, 4, 8, 8, 3, 0);
+            // wide ones and then the tall ones as their transpose
+            for (int tr = 0; tr < 2; tr++) {
+                q[tr ? 2 * 4 + 3 : 3 * 4 + 2] = pos;
+                pos = qm_sample(pos, r, 32, 32, 16, 1, 1, 0, tr);
+                q[tr ? 1 * 4 + 2 : 2 * 4 + 1] = pos;
+                pos = qm_sample(pos, r, 32, 16, 8, 2, 2, 0, tr);
+                q[tr ? 0 * 4 + 1 : 1 * 4 + 0] = pos;
+                pos = qm_sample(pos, r, 32, 8, 4, 4, 4, 1, tr);
+                q[tr ? 1 * 4 + 3 : 3 * 4 + 1] = pos;
+                pos = qm_sample(pos, r, 32, 32, 8, 1, 2, 0, tr);
+                q[tr ? 0 * 4 + 2 : 2 * 4 + 0] = pos;
+                pos = qm_sample(pos, qm_16x4[l][p], 16, 16, 4, 1, 1, 0, tr);
+            }
+        }
+    }
+}
+
+void
+av1_qm_init(void)
+{
+    pthread_once(&qm_once, qm_build);
+}
+
+const uint8_t *
+av1_qm_get(int level, int plane, int log2w, int log2h)
+{
+    if (level >= 15) {
+        return NULL;
+    }
+    return Qm[level][plane > 0][log2w - 2][log2h - 2];
+}
@@ -0,0 +1,25 @@
+#ifndef _AV1QM_H_
+#define _AV1QM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/* the quantizer matrices of AV1, see av1-spec 7.12.3 and section 10 */
+
+/* build the matrices once, safe to call more than once */
+void av1_qm_init(void);
+
+/* the matrix of qmLevel level for plane and a transform of the size given
+ * by log2 of width and height, which 64 is clipped to 32 for. Coefficient
+ * pos takes the weight at pos, in Q5. NULL for level 15, which is flat.
+ */
+const uint8_t *av1_qm_get(int level, int plane, int log2w, int log2h);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*_AV1QM_H_*/
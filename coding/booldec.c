@@ -35,10 +35,13 @@ static void
 bool_load_bytes(bool_dec *br)
 {
     uint64_t read = 0;
-    if (EOF_BITS(br->bits, 8)) {
-        VERR(booldec, "why here!");
+    // past the end the stream reads as zeros, as rfc6386 7.3 does, an
+    // encoder only flushes the bits it needs
+    if (!EOF_BITS(br->bits, 8)) {
+        read = READ_BITS(br->bits, 8);
+    } else {
+        br->bits->eof = 1;
     }
-    read = READ_BITS(br->bits, 8);
     br->value = read | (br->value << 8);
     br->count += 8;
 }
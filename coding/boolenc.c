@@ -0,0 +1,154 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utils.h"
+#include "boolenc.h"
+#include "vlog.h"
+
+VLOG_REGISTER(boolenc, INFO)
+
+bool_enc *
+bool_enc_init(int expected_size)
+{
+    bool_enc *be = (bool_enc *)malloc(sizeof(bool_enc));
+    be->range = 255 - 1;
+    be->value = 0;
+    be->nb_bits = -8;
+    be->run = 0;
+    be->pos = 0;
+    be->size = expected_size > 16 ? expected_size : 16;
+    be->buf = malloc(be->size);
+    return be;
+}
+
+void
+bool_enc_free(bool_enc *be)
+{
+    if (be->buf)
+        free(be->buf);
+    free(be);
+}
+
+static void
+bool_enc_reserve(bool_enc *be, int n)
+{
+    if (be->pos + n > be->size) {
+        while (be->pos + n > be->size) {
+            be->size <<= 1;
+        }
+        be->buf = realloc(be->buf, be->size);
+    }
+}
+
+/* output one byte, a byte of 0xff may still be changed by a carry, so it is
+ * kept as a pending run until a byte which can absorb the carry comes
+ */
+static void
+bool_enc_flush(bool_enc *be)
+{
+    const int s = 8 + be->nb_bits;
+    const int32_t bits = be->value >> s;
+    be->value -= bits << s;
+    be->nb_bits -= 8;
+    if ((bits & 0xff) != 0xff) {
+        bool_enc_reserve(be, be->run + 1);
+        if (bits & 0x100) {
+            // carry into the previous byte
+            if (be->pos > 0) {
+                be->buf[be->pos - 1]++;
+            }
+        }
+        for (; be->run > 0; be->run--) {
+            be->buf[be->pos++] = (bits & 0x100) ? 0x00 : 0xff;
+        }
+        be->buf[be->pos++] = bits & 0xff;
+    } else {
+        be->run++;
+    }
+}
+
+void
+bool_enc_bit(bool_enc *be, int bit, int probability)
+{
+    const uint32_t split = (be->range * probability) >> 8;
+    if (bit) {
+        be->value += split + 1;
+        be->range -= split + 1;
+    } else {
+        be->range = split;
+    }
+    if (be->range < 127) {
+        // renormalize so that range is in [127, 254] again
+        const int shift = 7 - log2floor(be->range + 1);
+        be->range = ((be->range + 1) << shift) - 1;
+        be->value <<= shift;
+        be->nb_bits += shift;
+        if (be->nb_bits > 0) {
+            bool_enc_flush(be);
+        }
+    }
+}
+
+void
+bool_enc_bits(bool_enc *be, uint32_t v, int nums)
+{
+    for (int i = nums - 1; i >= 0; i--) {
+        bool_enc_bit(be, (v >> i) & 1, 0x80);
+    }
+}
+
+void
+bool_enc_signed_bits(bool_enc *be, int v, int nums)
+{
+    bool_enc_bits(be, v < 0 ? -v : v, nums);
+    bool_enc_bit(be, v < 0, 0x80);
+}
+
+/* find the path from node i to leaf -value, bits are stored root first */
+static int
+bool_tree_path(const int8_t *t, int i, int value, int *bits, int *probs,
+               int depth)
+{
+    for (int b = 0; b < 2; b++) {
+        int next = t[i + b];
+        bits[depth] = b;
+        probs[depth] = i >> 1;
+        if (next <= 0) {
+            if (-next == value) {
+                return depth + 1;
+            }
+        } else {
+            int n = bool_tree_path(t, next, value, bits, probs, depth + 1);
+            if (n > 0) {
+                return n;
+            }
+        }
+    }
+    return 0;
+}
+
+void
+bool_enc_tree(bool_enc *be, const int8_t *t, const uint8_t *p, int value)
+{
+    int bits[16], probs[16];
+    int n = bool_tree_path(t, 0, value, bits, probs, 0);
+    if (n == 0) {
+        VERR(boolenc, "value %d is not in the tree", value);
+        return;
+    }
+    for (int i = 0; i < n; i++) {
+        bool_enc_bit(be, bits[i], p[probs[i]]);
+    }
+}
+
+uint8_t *
+bool_enc_finish(bool_enc *be, int *len)
+{
+    bool_enc_bits(be, 0, 9 - be->nb_bits);
+    be->nb_bits = 0;
+    bool_enc_flush(be);
+    *len = be->pos;
+    return be->buf;
+}
@@ -0,0 +1,53 @@
+#ifndef _BOOL_ENC_H_
+#define _BOOL_ENC_H_
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+#include <stdint.h>
+
+/* boolean entropy encoder, the counterpart of booldec, see rfc6386 7.3 */
+
+typedef struct bool_enc {
+    uint32_t range;     // range - 1, [127, 254]
+    uint32_t value;
+    int nb_bits;        // number of pending bits in value
+    int run;            // number of pending 0xff bytes
+    uint8_t *buf;
+    int pos;
+    int size;
+} bool_enc;
+
+bool_enc *bool_enc_init(int expected_size);
+
+void bool_enc_free(bool_enc *be);
+
+void bool_enc_bit(bool_enc *be, int bit, int probability);
+
+/* write the lowest nums bits of v, msb first */
+void bool_enc_bits(bool_enc *be, uint32_t v, int nums);
+
+/* similar to bool_enc_bits but write one more bit as sign */
+void bool_enc_signed_bits(bool_enc *be, int v, int nums);
+
+/* write the path to leaf -value in tree t, the layout is the same as
+ * bool_dec_tree
+ */
+void bool_enc_tree(bool_enc *be, const int8_t *t, const uint8_t *p, int value);
+
+/* flush the pending bits, the returned buffer is still owned by be */
+uint8_t *bool_enc_finish(bool_enc *be, int *len);
+
+#define BOOL_ENC_BIT(be, b)  bool_enc_bit(be, b, 0x80)
+#define BOOL_ENC_BITS(be, v, n) bool_enc_bits(be, v, n)
+#define BOOL_ENC_SBITS(be, v, n) bool_enc_signed_bits(be, v, n)
+
+#define BOOL_ENCODE(be, b, p) bool_enc_bit(be, b, p)
+
+#define BOOL_ENC_TREE(be, t, p, v) bool_enc_tree(be, t, p, v)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*_BOOL_ENC_H_*/
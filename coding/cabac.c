@@ -2,6 +2,7 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "utils.h"
 #include "cabac.h"
@@ -52,16 +53,6 @@ static uint8_t LPSTable[1 << STATE_BITS][RANGE_NUM] = {
     {2, 2, 2, 2},
 };
 
-struct ctx_model {
-    uint8_t mpsbit : 1;
-    uint8_t state : 7; // state need 6 bits, put mps or lps at the least bit
-
-    // below is need for TR
-    uint8_t bypass; // 6 bits 1 for bypass, greater than 5
-                    //  should keep the same with 6th
-    uint8_t bypass_len;
-};
-
 static int initValue_sao_merge[3] = {153, 153, 153};
 static int initValue_sao_type_idx[3] = {200, 185, 160};
 static int initValue_split_cu_flag[3][3] = {
@@ -76,8 +67,12 @@ static int initValue_cu_skip_flag[2][3] = {
 };
 static int initValue_palette_mode_flag[3] = {154, 154, 154};
 static int initValue_pred_mode_flag[2] = {149, 134};
-static int initValue_part_mode[9] = {184, 154, 139, 154, 154,
-                                     154, 139, 154, 154};
+// only ctxIdx 0 is there for initType 0, the others are never used then
+static int initValue_part_mode[3][4] = {
+    {184, 154, 154, 154},
+    {154, 139, 154, 154},
+    {154, 139, 154, 154},
+};
 static int initValue_prev_intra_luma_pred_flag[3] = {184, 154, 183};
 static int initValue_intra_chrome_pred_mode[3] = {63, 152, 152};
 static int initValue_rqt_root_cbf[2] = {79, 79};
@@ -222,9 +217,7 @@ static int initValue_depth_dc_abs[3] = {154, 154, 154};
 // see 9.9.3.2.2
 // see table 9-4 to 9-35
 // see table I.4, to I.14
-//assume we only have slice_type == I, which initType = 0 (see 9-7)
-static struct ctx_model ctx_table[CTX_TYPE_MAX_NUM];
-
+// initType is 0 for I slices, see (9-7) for P and B ones
 
 static void init_bypass_flag(struct ctx_model *ctx, uint8_t flags, uint8_t len)
 {
@@ -248,10 +241,14 @@ static void init_model_ctx(struct ctx_model *ctx, int qpy, int initValue) {
 }
 
 
-void cabac_init_models(int qpy, int initType)
+void cabac_init_models(cabac_dec *dec, int qpy, int initType)
 {
     //see table 9-48
-    struct ctx_model *ctx = ctx_table;
+    struct ctx_model *ctx = dec->models;
+    // see 9.3.2.2, persistent_rice_adaptation starts over as well
+    for (int i = 0; i < 4; i++) {
+        dec->StatCoeff[i] = 0;
+    }
     init_bypass_flag(ctx + CTX_TYPE_ALL_BYPASS, 0x3F, 6);
     init_model_ctx(ctx + CTX_TYPE_SAO_MERGE, qpy,
                        initValue_sao_merge[initType]);
@@ -270,8 +267,10 @@ void cabac_init_models(int qpy, int initType)
 
     init_model_ctx(ctx + CTX_TYPE_CU_PALETTE_MODE_FLAG, qpy,
                    initValue_palette_mode_flag[initType]);
-    init_model_ctx(ctx + CTX_TYPE_CU_PART_MODE, qpy,
-                   initValue_part_mode[initType]);
+    for (int i = 0; i < 4; i++) {
+        init_model_ctx(ctx + CTX_TYPE_CU_PART_MODE + i, qpy,
+                       initValue_part_mode[initType][i]);
+    }
     init_bypass_flag(ctx + CTX_TYPE_CU_PART_MODE, 1 << 3, 4);
     init_model_ctx(ctx + CTX_TYPE_CU_PREV_INTRA_LUMA_PRED_FLAG, qpy,
                    initValue_prev_intra_luma_pred_flag[initType]);
@@ -423,43 +422,76 @@ void cabac_init_models(int qpy, int initType)
     }
 }
 
-cabac_dec *
-cabac_dec_init(struct bits_vec *v)
+// see Table 9-52 and Figure 9-7, bits to renormalize rangeLPS by, on
+// rangeLPS >> 3
+static const uint8_t RenormTable[32] = {
+    6,  5,  4,  4,
+    3,  3,  3,  3,
+    2,  2,  2,  2,
+    2,  2,  2,  2,
+    1,  1,  1,  1,
+    1,  1,  1,  1,
+    1,  1,  1,  1,
+    1,  1,  1,  1
+};
+
+/* value keeps ivlOffset above bits_left bits which are read ahead, so a
+ * renormalization only takes bits_left down, and the stream is fetched four
+ * bytes at a time. bits_left stays at least 24 between two bins, which is
+ * more than any single bin or a 16 bins bypass batch needs.
+ */
+static inline void
+refill(cabac_dec *dec)
 {
-    cabac_dec *dec = malloc(sizeof(*dec));
-    dec->bits = v;
-    dec->count = 8;
-    dec->value = READ_BITS(v, 16);
-    dec->range = 510;
+    const uint8_t *p = dec->ptr;
+    if (dec->end - p >= 4) {
+        dec->value = (dec->value << 32) | ((uint32_t)p[0] << 24) |
+                     ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+    } else {
+        // zeros past the end, a broken stream stops at the terminate bin
+        for (int i = 0; i < 4; i++) {
+            dec->value = (dec->value << 8) | ((p + i < dec->end) ? p[i] : 0);
+        }
+    }
+    dec->ptr += 4;
+    dec->bits_left += 32;
+}
 
-    return dec;
+// see 9.3.2.5, start on the byte the bits reader points at
+static void
+cabac_dec_start(cabac_dec *dec)
+{
+    struct bits_vec *v = dec->bits;
+    dec->start = dec->ptr = v->ptr;
+    dec->end = v->start + v->len;
+    dec->value = 0;
+    dec->bits_left = 0;
+    refill(dec);
+    // ivlOffset is the first 9 bits
+    dec->bits_left -= 9;
+    dec->range = 510;
 }
 
-//see Figure 9-7
+/* after a terminate bin of 1, the last bit read is the stop or alignment
+ * bit, so the syntax goes on at the next byte boundary, see 9.3.4.3.5
+ */
 static void
-renormD(cabac_dec *dec)
+cabac_dec_sync_bits(cabac_dec *dec)
 {
-    // static uint8_t RenormTable[32] = {
-    //     6,  5,  4,  4,
-    //     3,  3,  3,  3,
-    //     2,  2,  2,  2,
-    //     2,  2,  2,  2,
-    //     1,  1,  1,  1,
-    //     1,  1,  1,  1,
-    //     1,  1,  1,  1,
-    //     1,  1,  1,  1
-    // };
-
-    //scaledRange is dec->range << 7
-    while ((dec->range) < (256)) {
-        dec->range = dec->range << 1;
-        dec->value <<= 1;
-        //refill value when all read out
-        if (--dec->count <= 0) {
-            dec->count += 8;
-            dec->value += READ_BITS(dec->bits, 8);
-        }
-    }
+    struct bits_vec *v = dec->bits;
+    int64_t pos = (dec->ptr - dec->start) * 8 - dec->bits_left;
+    const uint8_t *p = dec->start + (pos + 7) / 8;
+    v->ptr = (uint8_t *)MIN(p, dec->end);
+    v->offset = 0;
+}
+
+cabac_dec *
+cabac_dec_init(struct bits_vec *v)
+{
+    cabac_dec *dec = malloc(sizeof(*dec));
+    dec->bits = v;
+    cabac_dec_start(dec);
+    return dec;
 }
 
 void
@@ -472,35 +504,39 @@ cabac_dec_free(cabac_dec *dec)
 int
 cabac_dec_bypass(cabac_dec *dec)
 {
-    int binVal = 0;
-    /*Figure 9-8 */
-    dec->value <<= 1;
-    if (--dec->count <= 0) {
-        dec->count += 8;
-        dec->value += READ_BITS(dec->bits, 8);
-    }
-    // we have the last 7 bits for buffer TBD
-    uint32_t scaledRange = dec->range << 7;
-#ifndef NDEBUG
-    VDBG(cabac, "scaledRange %d, value %d", scaledRange, dec->value);
-#endif
-    if (dec->value >= scaledRange) {
-        binVal = 1;
+    dec->bits_left--;
+    uint64_t scaledRange = (uint64_t)dec->range << dec->bits_left;
+    int binVal = dec->value >= scaledRange;
+    if (binVal) {
         dec->value -= scaledRange;
     }
-#ifndef NDEBUG
-    VDBG(cabac, "bypass v %x r %x c %d: binVal %d", dec->value, dec->range,
-         dec->count, binVal);
-#endif
+    if (dec->bits_left < 24) {
+        refill(dec);
+    }
     return binVal;
 }
 
+/* n bins of Figure 9-8 in one go: shifting in a bit and taking ivlCurrRange
+ * off when it fits is a long division, so the bins are the quotient of the
+ * offset with n more bits over the range, at most 16 at a time
+ */
 int cabac_dec_bypass_n(cabac_dec *dec, int n)
 {
-    int val = 0;
-    while (n--) {
-        val <<= 1;
-        val |= cabac_dec_bypass(dec); 
+    uint32_t val = 0;
+    if (n == 1) {
+        return cabac_dec_bypass(dec);
+    }
+    while (n > 0) {
+        int k = MIN(n, 16);
+        dec->bits_left -= k;
+        uint32_t offset = dec->value >> dec->bits_left;
+        uint32_t q = offset / dec->range;
+        dec->value -= (uint64_t)(q * dec->range) << dec->bits_left;
+        val = (val << k) | q;
+        n -= k;
+        if (dec->bits_left < 24) {
+            refill(dec);
+        }
     }
     return val;
 }
@@ -533,60 +569,56 @@ int
 cabac_dec_terminate(cabac_dec *dec)
 {
     /*Figure 9-9 */
-    int binVal = 0;
     dec->range -= 2;
-    uint32_t scaledRange = dec->range << 7;
+    uint64_t scaledRange = (uint64_t)dec->range << dec->bits_left;
     if (dec->value >= scaledRange) {
-        binVal = 1;
-    } else {
-        binVal = 0;
-        renormD(dec);
+        cabac_dec_sync_bits(dec);
+        VDBG(cabac, "term bit 1, at byte %d", (int)(dec->bits->ptr - dec->start));
+        return 1;
     }
-    VDBG(cabac, "term bit %d, value %x, range %x", binVal, dec->value, dec->range);
-    return binVal;
+    if (dec->range < 256) {
+        dec->range <<= 1;
+        dec->bits_left--;
+    }
+    if (dec->bits_left < 24) {
+        refill(dec);
+    }
+    return 0;
 }
 
 // see 9.3.4.3
 int
 cabac_dec_decision(cabac_dec *dec, int ctx_tid)
 {
-    struct ctx_model *m = ctx_table+ctx_tid;
+    struct ctx_model *m = dec->models + ctx_tid;
     int binVal;
     uint8_t state = m->state;
     uint32_t rangelps = LPSTable[state][(dec->range >> 6) & 3];
-#ifndef NDEBUG
-    VDBG(cabac, "decision tid %d, state %d,%d ", ctx_tid, state,
-         (dec->range >> 6) - 4);
-#endif
     dec->range -= rangelps;
-    uint32_t scaledRange = dec->range << 7;
-#ifndef NDEBUG
-    VDBG(cabac, "decision state %d,%d, rlps %d, v %x scr %x, count %d", state,
-         (dec->range >> 6) & 3, rangelps, dec->value, scaledRange, dec->count);
-#endif
+    uint64_t scaledRange = (uint64_t)dec->range << dec->bits_left;
     if (dec->value < scaledRange) {
-        //MPS (Most Probable Symbol)
+        //MPS (Most Probable Symbol), the range is 128 at least, so one bit
+        //renormalizes it
         binVal = m->mpsbit;
         m->state = NextStateMPS[state];
+        int numbits = dec->range < 256;
+        dec->range <<= numbits;
+        dec->bits_left -= numbits;
     } else {
         //LPS (Least Probable Symbol)
         binVal = 1 - m->mpsbit;
         m->state = NextStateLPS[state];
-        // int numbits = RenormTable[rangelps>>3];
-        // dec->value = (dec->value - scaledRange) << numbits;
-        // dec->range = rangelps << numbits;
-        // dec->count -= numbits;
-        dec->value = dec->value - scaledRange;
-        dec->range = rangelps;
         if (state == 0) {
             m->mpsbit = 1 - m->mpsbit;
         }
+        int numbits = RenormTable[rangelps >> 3];
+        dec->value -= scaledRange;
+        dec->range = rangelps << numbits;
+        dec->bits_left -= numbits;
+    }
+    if (dec->bits_left < 24) {
+        refill(dec);
     }
-    renormD(dec);
-#ifndef NDEBUG
-    VDBG(cabac, "decision v %x r %x state %d: binVal %d", dec->value, dec->range,
-         m->state, binVal);
-#endif
     return binVal;
 }
 
@@ -602,8 +634,8 @@ cabac_dec_bin(cabac_dec *dec, int tid, int bypass)
 
 
 static inline int
-ctx_bypass_flags(int ctx_idx, int bin_idx) {
-    struct ctx_model *m = &ctx_table[ctx_idx];
+ctx_bypass_flags(cabac_dec *dec, int ctx_idx, int bin_idx) {
+    struct ctx_model *m = &dec->models[ctx_idx];
     if (bin_idx > 5) {
         bin_idx = 5;
     }
@@ -633,13 +665,16 @@ int cabac_dec_tr(cabac_dec *dec, int tid, int cMax, int cRiceParam,
     int prefix = 0, suffix = 0;
     int binIdx = 0;
 #ifndef NDEBUG
-    VDBG(cabac, "tid %d, (binIdx %d)flag %d, range %x, value %x", tid,
-         binIdx, ctx_bypass_flags(cb(tid, binIdx), binIdx),
-         dec->range, dec->value);
+    VDBG(cabac, "tid %d, (binIdx %d)flag %d, range %x", tid,
+         binIdx, ctx_bypass_flags(dec, cb(tid, binIdx), binIdx),
+         dec->range);
 #endif
-    while (prefix < t && ctx_bypass_flags(cb(tid, binIdx), binIdx) >= 0 &&
-           cabac_dec_bin(dec, cb(tid, binIdx),
-                         ctx_bypass_flags(cb(tid, binIdx), binIdx)) == 1) {
+    while (prefix < t) {
+        int ctx = cb(tid, binIdx);
+        int bypass = ctx_bypass_flags(dec, ctx, binIdx);
+        if (bypass < 0 || cabac_dec_bin(dec, ctx, bypass) == 0) {
+            break;
+        }
         binIdx++;
         prefix++;
     }
@@ -654,7 +689,7 @@ int cabac_dec_tr(cabac_dec *dec, int tid, int cMax, int cRiceParam,
         // if prefix < cMax >> cRiceParam, the prefix bin string
         // is a bit string of length prefix + 1, then bins for binIdx less than prefix are equal to 1
         // the bin
-        // assert(ctx_bypass_flags(cb(tid, binIdx), binIdx) == 1);
+        // assert(ctx_bypass_flags(dec, cb(tid, binIdx), binIdx) == 1);
         // when cMax > symbolVal and cRiceParam > 0, suffix is present
         if (cRiceParam > 0) {
             // VDBG(cabac, "(%d,binIdx %d)flag %d, state %d, range %x, value %x",
@@ -683,8 +718,8 @@ int cabac_dec_egk(cabac_dec *dec, int kth, int max_pre_ext_len,
         escape_length = trunc_suffix_len;
     else
         escape_length = pre_ext_len + kth;
-    while (escape_length-- > 0) {
-        val = (val << 1) + cabac_dec_bypass(dec);
+    if (escape_length > 0) {
+        val = cabac_dec_bypass_n(dec, escape_length);
     }
     val += ((1 << pre_ext_len) - 1) << kth;
     return val;
@@ -692,43 +727,21 @@ int cabac_dec_egk(cabac_dec *dec, int kth, int max_pre_ext_len,
 
 void cabac_dec_reset(cabac_dec *dec)
 {
-    VDBG(cabac, "dec: count %d, range %x, v %x", dec->count, dec->range, dec->value);
     bits_vec_reinit_cur(dec->bits);
-    dec->range = 510;
-    dec->count = 8;
-    dec->value = READ_BITS(dec->bits, 16);
-    VDBG(cabac, "dec: count %d, range %x, v %x", dec->count, dec->range, dec->value);
+    cabac_dec_start(dec);
 }
 
 // for storage and sync, see 9.3.2.4 , 9.3.2.5
-static int tableStatCoeffSync[4];
-static uint8_t tableStateSync[CTX_TYPE_MAX_NUM];
-static uint8_t tableMPSSync[CTX_TYPE_MAX_NUM];
-
-void storage_process_for_cabac_context(int *StatCoeff) {
-    // see Figure 9-4
-    // if (pps->entropy_coding_sync_enabled_flag &&
-    //     (CtbAddrInRs % slice->PicWidthInCtbsY == 1 ||
-    //      (CtbAddrInRs > 1 && pps->TileId[pps->CtbAddrRsToTs[CtbAddrInRs - 2]]
-    //      !=
-    //                              pps->TileId[CtbAddrInTs]))) {
-    // store context in Wpp
-    for (int i = 0; i < CTX_TYPE_MAX_NUM; i++) {
-        tableStateSync[i] = ctx_table[i].state;
-        tableMPSSync[i] = ctx_table[i].mpsbit;
-    }
-
-    for (int i = 0; i < 4; i++) {
-        tableStatCoeffSync[i] = StatCoeff[i];
-    }
+void storage_process_for_cabac_context(cabac_dec *dec,
+                                       struct cabac_ctx_store *store)
+{
+    memcpy(store->models, dec->models, sizeof(dec->models));
+    memcpy(store->StatCoeff, dec->StatCoeff, sizeof(dec->StatCoeff));
 }
 
-void sync_process_for_cabac_context(int *StatCoeff) {
-    for (int i = 0; i < CTX_TYPE_MAX_NUM; i++) {
-        ctx_table[i].state = tableStateSync[i];
-        ctx_table[i].mpsbit = tableMPSSync[i];
-    }
-    for (int i = 0; i < 4; i++) {
-        StatCoeff[i] = tableStatCoeffSync[i];
-    }
+void sync_process_for_cabac_context(cabac_dec *dec,
+                                    const struct cabac_ctx_store *store)
+{
+    memcpy(dec->models, store->models, sizeof(dec->models));
+    memcpy(dec->StatCoeff, store->StatCoeff, sizeof(dec->StatCoeff));
 }
@@ -11,14 +11,6 @@ extern "C"{
 #define STATE_NUM  (1 << STATE_BITS)
 #define RANGE_NUM (4)
 
-typedef struct cabac_dec {
-    uint32_t value;
-    uint32_t range;     //[127, 254]
-    int count;
-
-    struct bits_vec *bits;
-} cabac_dec;
-
 enum ctx_index_type {
   CTX_TYPE_ALL_BYPASS = 0,
   CTX_TYPE_SAO_MERGE = 1,
@@ -31,7 +23,7 @@ enum ctx_index_type {
   CTX_TYPE_CU_PALETTE_MODE_FLAG = CTX_TYPE_CU_SKIP_FLAG + 3,
   CTX_TYPE_CU_PRED_MODE_FLAG,
   CTX_TYPE_CU_PART_MODE,
-  CTX_TYPE_CU_PREV_INTRA_LUMA_PRED_FLAG,
+  CTX_TYPE_CU_PREV_INTRA_LUMA_PRED_FLAG = CTX_TYPE_CU_PART_MODE + 4,
   CTX_TYPE_CU_INTRA_CHROME_PRED_MODE,
   CTX_TYPE_CU_RQT_ROOT_CBF,
   CTX_TYPE_TU_RESIDUAL_ACT_FLAG,
@@ -40,7 +32,7 @@ enum ctx_index_type {
   CTX_TYPE_PU_MERGE_IDX,
   CTX_TYPE_PU_INTER_PRED_IDC,
   CTX_TYPE_PU_REF_IDX = CTX_TYPE_PU_INTER_PRED_IDC + 5,
-  CTX_TYPE_PU_MVP_FLAG,
+  CTX_TYPE_PU_MVP_FLAG = CTX_TYPE_PU_REF_IDX + 2,
 
   CTX_TYPE_TU_SPLIT_TRANSFORM_FLAG,
   CTX_TYPE_TU_CBF_LUMA = CTX_TYPE_TU_SPLIT_TRANSFORM_FLAG + 3,
@@ -100,6 +92,39 @@ enum ctx_index_type {
   CTX_TYPE_MAX_NUM,
 };
 
+struct ctx_model {
+    uint8_t mpsbit : 1;
+    uint8_t state : 7; // state need 6 bits, put mps or lps at the least bit
+
+    // below is need for TR
+    uint8_t bypass; // 6 bits 1 for bypass, greater than 5
+                    //  should keep the same with 6th
+    uint8_t bypass_len;
+};
+
+/* every decoder carries its own context variables, so the substreams of a
+ * slice can be decoded at the same time, see 9.3.1
+ */
+typedef struct cabac_dec {
+    uint64_t value;     // ivlOffset << bits_left, and the bits read ahead
+    uint32_t range;     // ivlCurrRange, [256, 510]
+    int bits_left;
+
+    const uint8_t *start;   // where the engine was started
+    const uint8_t *ptr;     // next byte to fetch, may run past end
+    const uint8_t *end;
+    struct bits_vec *bits;  // set on the byte after a terminate bin of 1
+
+    struct ctx_model models[CTX_TYPE_MAX_NUM];
+    int StatCoeff[4];   // see 9.3.2.2, persistent_rice_adaptation_enabled_flag
+} cabac_dec;
+
+/* context variables saved for a later substream, see 9.3.2.4 */
+struct cabac_ctx_store {
+    struct ctx_model models[CTX_TYPE_MAX_NUM];
+    int StatCoeff[4];
+};
+
 cabac_dec * cabac_dec_init(struct bits_vec*);
 
 typedef int (*cabac_get_ctxInc) (int ctx_idx, int binIdx);
@@ -115,9 +140,12 @@ int cabac_dec_bypass_fl(cabac_dec *dec, int max);
 int cabac_dec_egk(cabac_dec *dec, int kth, int max_pre_ext_len,
                   int trunc_suffix_len);
 void cabac_dec_free(cabac_dec *dec);
+/* start over on the byte the bits reader is at, after end_of_subset_one_bit
+ * or pcm samples */
 void cabac_dec_reset(cabac_dec *dec);
 
-void cabac_init_models(int qpy, int initType);//here initType should alway be 0
+/* initType as of 9.3.2.2, 0 for I slices and 1 or 2 for P and B ones */
+void cabac_init_models(cabac_dec *dec, int qpy, int initType);
 
 #define CABAC(br, tid) cabac_dec_decision(br, tid)
 #define CABAC_BP(br) cabac_dec_bypass(br)
@@ -129,9 +157,11 @@ int cabac_dec_tr(cabac_dec *dec, int tid, int cMax, int cRiceParam,
 
 #define CABAC_TB(br, max) cabac_dec_bypass_tb(br, max)
 
-void storage_process_for_cabac_context(int *StatCoeff);
+void storage_process_for_cabac_context(cabac_dec *dec,
+                                       struct cabac_ctx_store *store);
 
-void sync_process_for_cabac_context(int *StatCoeff);
+void sync_process_for_cabac_context(cabac_dec *dec,
+                                    const struct cabac_ctx_store *store);
 
 #ifdef __cplusplus
 }
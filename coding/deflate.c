@@ -26,8 +26,41 @@ struct deflate_decoder {
 
     struct deflate_tree ltree; /* Literal/length tree */
     struct deflate_tree dtree; /* Distance tree */
+
+    /* state kept between two calls of deflate_stream_decode */
+    int bfinal;
+    int in_block;       /* in the data of a block of btype */
+    int btype;
+    int stored_left;    /* bytes left of a stored block */
 };
 
+/* the input ran out, what was read since the last mark is read again */
+#define DEFLATE_SUSPEND (1)
+
+struct deflate_mark {
+    uint8_t *ptr;
+    uint8_t offset;
+    uint8_t *dest;
+};
+
+static void
+deflate_set_mark(struct deflate_decoder *d, struct deflate_mark *m)
+{
+    m->ptr = d->v->ptr;
+    m->offset = d->v->offset;
+    m->dest = d->dest;
+}
+
+static int
+deflate_back_to_mark(struct deflate_decoder *d, struct deflate_mark *m)
+{
+    d->v->ptr = m->ptr;
+    d->v->offset = m->offset;
+    d->v->eof = 0;
+    d->dest = m->dest;
+    return DEFLATE_SUSPEND;
+}
+
 
 enum {
     BTYPE_NOCOMPRESSION = 0,
@@ -148,17 +181,23 @@ deflate_build_tree(struct deflate_tree *t, const uint8_t *lengths,
     return 0;
 }
 
-/* Inflate an uncompressed block of data */
+/* Read the header of an uncompressed block */
 static int 
 deflate_nocompression_block(struct deflate_decoder *d)
 {
     int length, invlength;
 
+    /* skip any remaining bits in byte */
+    RESET_BORDER(d->v);
+
     /* Get length */
     length = READ_BITS(d->v, 16);
 
     /* Get one's complement of length */
     invlength = READ_BITS(d->v, 16);
+    if (d->v->eof) {
+        return DEFLATE_SUSPEND;
+    }
 
     VDBG(deflate, "no compression %d, %d", length, invlength);
     /* Check length */
@@ -166,23 +205,27 @@ deflate_nocompression_block(struct deflate_decoder *d)
         return -2;
     }
 
-    if (EOF_BITS(d->v, 0) < length) {
-        return -3;
-    }
-
     if (d->dest_end - d->dest < length) {
         return -4;
     }
+    d->stored_left = length;
 
-    /* Copy block */
-    while (length--) {
-        *d->dest++ = READ_BITS(d->v, 8);
-    }
+    return 0;
+}
 
-    /* Make sure we start next block on a byte boundary */
-    RESET_BORDER(d->v);
+/* Copy the data of an uncompressed block, as much as there is */
+static int
+deflate_nocompression_data(struct deflate_decoder *d)
+{
+    int avail = bits_vec_left_bits(d->v) / 8;
+    int n = (avail < d->stored_left) ? avail : d->stored_left;
 
-    return 0;
+    memcpy(d->dest, d->v->ptr, n);
+    d->dest += n;
+    d->v->ptr += n;
+    d->stored_left -= n;
+
+    return d->stored_left ? DEFLATE_SUSPEND : 0;
 }
 
 /* Given a data stream and a tree, decode a symbol */
@@ -206,9 +249,15 @@ deflate_decode_symbol(struct bits_vec *v, const struct deflate_tree *t)
      * of offs and add one more bit to it.
      */
     for (len = 1; ; ++len) {
-        offs = 2 * offs + READ_BIT(v);
+        int bit = READ_BIT(v);
+        if (bit < 0) {
+            return -1;
+        }
+        offs = 2 * offs + bit;
 
-        assert(len <= 15);
+        if (len > 15) {
+            return -1;
+        }
 
         if (offs < t->counts[len]) {
             break;
@@ -256,8 +305,16 @@ deflate_block_data(struct deflate_decoder *d, struct deflate_tree *lt,
     };
 
     for (;;) {
+        struct deflate_mark m;
+        deflate_set_mark(d, &m);
         int sym = deflate_decode_symbol(d->v, lt);
 
+        if (d->v->eof) {
+            return deflate_back_to_mark(d, &m);
+        }
+        if (sym < 0) {
+            return -1;
+        }
         if (sym < 256) {
             if (d->dest == d->dest_end) {
                 return -2;
@@ -286,7 +343,10 @@ deflate_block_data(struct deflate_decoder *d, struct deflate_tree *lt,
             dist = deflate_decode_symbol(d->v, dt);
 
             /* Check dist is within range */
-            if (dist > dt->max_sym || dist > 29) {
+            if (d->v->eof) {
+                return deflate_back_to_mark(d, &m);
+            }
+            if (dist < 0 || dist > dt->max_sym || dist > 29) {
                 VERR(deflate, "error for dist");
                 return -1;
             }
@@ -295,6 +355,9 @@ deflate_block_data(struct deflate_decoder *d, struct deflate_tree *lt,
             offs = READ_BITS_BASE(d->v, dist_bits[dist],
                                      dist_base[dist]);
 
+            if (d->v->eof) {
+                return deflate_back_to_mark(d, &m);
+            }
             if (offs > d->dest - d->dest_start) {
                 return -1;
             }
@@ -362,6 +425,9 @@ deflate_decode_trees(struct deflate_decoder *d, struct deflate_tree *lt,
         /* Get 3 bits code length (0-7) */
         lengths[clcidx[i]] = READ_BITS(d->v, 3);
     }
+    if (d->v->eof) {
+        return DEFLATE_SUSPEND;
+    }
 
     /* Build code length tree (in literal/length tree to save space) */
     res = deflate_build_tree(lt, lengths, 19);
@@ -379,7 +445,10 @@ deflate_decode_trees(struct deflate_decoder *d, struct deflate_tree *lt,
     for (num = 0; num < hlit + hdist; ) {
         int sym = deflate_decode_symbol(d->v, lt);
 
-        if (sym > lt->max_sym) {
+        if (d->v->eof) {
+            return DEFLATE_SUSPEND;
+        }
+        if (sym < 0 || sym > lt->max_sym) {
             return -1;
         }
 
@@ -417,6 +486,10 @@ deflate_decode_trees(struct deflate_decoder *d, struct deflate_tree *lt,
         }
     }
 
+    if (d->v->eof) {
+        return DEFLATE_SUSPEND;
+    }
+
     /* Check EOB symbol is present */
     if (lengths[256] == 0) {
         return -1;
@@ -438,45 +511,51 @@ deflate_decode_trees(struct deflate_decoder *d, struct deflate_tree *lt,
     return 0;
 }
 
-/* Inflate a block of data compressed with fixed Huffman trees */
-static int
-deflate_fixed_block(struct deflate_decoder *d)
+int
+deflate_decode(uint8_t* compressed, int compressed_length, uint8_t* decompressed, int* decomp_len)
 {
-    /* Build fixed Huffman trees */
-    build_fixed_trees(&d->ltree, &d->dtree);
+    struct deflate_decoder *d = deflate_stream_init(decompressed, *decomp_len);
+
+    /* last four bytes alder32 */
+    int res = deflate_stream_decode(d, compressed, compressed_length - 4,
+                                    decomp_len);
+    deflate_stream_free(d);
+    if (res == 0) {
+        VERR(deflate, "deflate stream truncated");
+        return -1;
+    }
 
-    /* Decode block using fixed trees */
-    return deflate_block_data(d, &d->ltree, &d->dtree);
+    return (res < 0) ? res : 0;
 }
 
-/* Inflate a block of data compressed with dynamic Huffman trees */
-static int
-deflate_dynamic_block(struct deflate_decoder *d)
+struct deflate_decoder *
+deflate_stream_init(uint8_t* decompressed, int decomp_len)
 {
-    /* Decode trees from stream */
-    int res = deflate_decode_trees(d, &d->ltree, &d->dtree);
-    if (res != 0) {
-        VERR(deflate, "decode trees error");
-        return res;
-    }
-
-    /* Decode block using decoded trees */
-    return deflate_block_data(d, &d->ltree, &d->dtree);
+    struct deflate_decoder *d = calloc(1, sizeof(struct deflate_decoder));
+    d->dest = decompressed;
+    d->dest_start = decompressed;
+    d->dest_end = decompressed + decomp_len;
+    return d;
 }
 
-
-int 
-deflate_decode(uint8_t* compressed, int compressed_length, uint8_t* decompressed, int* decomp_len)
+void
+deflate_stream_free(struct deflate_decoder *d)
 {
-    unsigned bfinal = 0;
+    // the compressed data belongs to the caller
+    free(d->v);
+    free(d);
+}
 
+static int
+deflate_check_header(uint8_t *compressed)
+{
     struct zlib_header h;
     uint16_t check;
-    // uint32_t alder32 = *(uint32_t *)(compressed + compressed_length - 4);
 
     memcpy(&h, compressed, 2);
     if (h.compress_method != 8) {
         VERR(deflate, "not deflate, cm %d", h.compress_method);
+        return -1;
     }
     memcpy(&check, &h, 2);
     if( SWAP(check) % 31) {
@@ -489,55 +568,93 @@ deflate_decode(uint8_t* compressed, int compressed_length, uint8_t* decompressed
     if (h.preset_dict) {
         VERR(deflate, "for png preset dict should not be set");
     }
-    compressed += 2;
+    return 0;
+}
 
-    /* Initialise data */
-    struct deflate_decoder d = {
-        .dest = decompressed,
-        .dest_start = decompressed,
-        .dest_end = decompressed + *decomp_len,
-    };
+/* read the header of the next block, and the trees of it */
+static int
+deflate_block_header(struct deflate_decoder *d)
+{
+    struct deflate_mark m;
+    int res;
 
-    /* first two bytes zlib header and last four bytes alder32 */
-    d.v = bits_vec_alloc(compressed, compressed_length - 6, BITS_LSB);
+    deflate_set_mark(d, &m);
+    /* Read final block flag */
+    d->bfinal = READ_BIT(d->v);
+    /* Read block type (2 bits) */
+    d->btype = READ_BITS(d->v, 2);
+
+    VDBG(deflate, "btype %d", d->btype);
+    switch (d->btype) {
+    case BTYPE_NOCOMPRESSION:
+        res = deflate_nocompression_block(d);
+        break;
+    case BTYPE_COMPRESSED_WITH_FIXED_HUFFMAN:
+        /* Build fixed Huffman trees */
+        build_fixed_trees(&d->ltree, &d->dtree);
+        res = d->v->eof ? DEFLATE_SUSPEND : 0;
+        break;
+    case BTYPE_COMPRESSED_WITH_DYNAMIC_HUFFMAN:
+        /* Decode trees from stream */
+        res = deflate_decode_trees(d, &d->ltree, &d->dtree);
+        if (res < 0) {
+            VERR(deflate, "decode trees error");
+        }
+        break;
+    default:
+        res = d->v->eof ? DEFLATE_SUSPEND : -1;
+        break;
+    }
+    if (res == DEFLATE_SUSPEND || d->v->eof) {
+        d->bfinal = 0;
+        return deflate_back_to_mark(d, &m);
+    }
+    return res;
+}
 
-     while (!bfinal)
-     {
-        uint32_t btype;
-        int res;
+int
+deflate_stream_decode(struct deflate_decoder *d, uint8_t *compressed,
+                      int compressed_length, int *decomp_len)
+{
+    int res = 0;
 
-        /* Read final block flag */
-        bfinal = READ_BIT(d.v);
-        /* Read block type (2 bits) */
-        btype = READ_BITS(d.v, 2);
+    /* first two bytes zlib header */
+    if (compressed_length < 2) {
+        *decomp_len = 0;
+        return 0;
+    }
+    if (!d->v) {
+        if (deflate_check_header(compressed) < 0) {
+            return -1;
+        }
+        d->v = bits_vec_alloc(compressed + 2, compressed_length - 2, BITS_LSB);
+    } else {
+        bits_vec_extend(d->v, compressed + 2, compressed_length - 2);
+    }
 
-        VDBG(deflate, "btype %d", btype);
+    while (res == 0 && (d->in_block || !d->bfinal)) {
+        if (!d->in_block) {
+            res = deflate_block_header(d);
+            if (res != 0) {
+                break;
+            }
+            d->in_block = 1;
+        }
         /* Decompress block */
-        switch (btype) {
-        case BTYPE_NOCOMPRESSION:
-            /* skip any remaining bits in byte */
-            RESET_BORDER(d.v);
-            res = deflate_nocompression_block(&d);
-            break;
-        case BTYPE_COMPRESSED_WITH_FIXED_HUFFMAN:
-            res = deflate_fixed_block(&d);
-            break;
-        case BTYPE_COMPRESSED_WITH_DYNAMIC_HUFFMAN:
-            /* Decompress block with dynamic Huffman trees */
-            res = deflate_dynamic_block(&d);
-            break;
-        default:
-            res = -1;
-            break;
+        if (d->btype == BTYPE_NOCOMPRESSION) {
+            res = deflate_nocompression_data(d);
+        } else {
+            res = deflate_block_data(d, &d->ltree, &d->dtree);
         }
-
-        if (res != 0) {
-            VERR(deflate, "deflate error %d", res);
+        if (res == 0) {
+            d->in_block = 0;
         }
     }
-    *decomp_len = d.dest - d.dest_start;
-
-    free(d.v);
+    *decomp_len = d->dest - d->dest_start;
 
-    return 0;
+    if (res < 0) {
+        VERR(deflate, "deflate error %d", res);
+        return res;
+    }
+    return (res == DEFLATE_SUSPEND) ? 0 : 1;
 }
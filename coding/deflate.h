@@ -19,6 +19,20 @@ struct zlib_header {
 /* decode comp buffer with comp_len to decomp buffer */
 int deflate_decode(uint8_t* comp, int comp_len, uint8_t* decomp, int * decomp_len);
 
+/* incremental decoding, for a zlib stream coming in pieces */
+struct deflate_decoder;
+
+struct deflate_decoder *deflate_stream_init(uint8_t *decomp, int decomp_len);
+
+/* comp holds all of the stream got so far, it may move between two calls.
+ * Returns 1 once the final block is decoded, 0 when more data is needed or
+ * a negative value on error. *decomp_len is set to the bytes decoded so far
+ */
+int deflate_stream_decode(struct deflate_decoder *d, uint8_t *comp,
+                          int comp_len, int *decomp_len);
+
+void deflate_stream_free(struct deflate_decoder *d);
+
 #ifdef __cplusplus
 }
 #endif
@@ -4,47 +4,138 @@
 #include <stdlib.h>
 #include <assert.h>
 #include <string.h>
+#include <pthread.h>
+#include <unistd.h>
 
 #include "bitstream.h"
 #include "idct.h"
 #include "vlog.h"
 #include "utils.h"
 #include "hevc.h"
+#include "hevcdsp.h"
 #include "cabac.h"
 #include "predict.h"
-#include "colorspace.h"
 #include "accl.h"
 
 VLOG_REGISTER(hevc, DEBUG)
 
-#pragma pack(push, 1)
-struct cu_info {
-    uint8_t ctDepth : 2;
-    uint8_t CuPredMode : 2;
-    uint8_t pcm_flag : 1;
-    uint8_t cu_transquant_bypass_flag:1; //for sao
-    uint8_t qpy;
+enum rps_marking {
+    UNUSED_FOR_REFERENCE = -1,
+    USED_FOR_SHORT_TERM_REFERENCE = 0,
+    USED_FOR_LONG_TERM_REFERENCE = 1,
+};
+
+// the current picture and up to 16 reference ones, see A.4.2
+#define HEVC_DPB_SIZE (17)
+
+/* the motion of a prediction block per 4x4 luma block, see 8.5.3.2. Lists
+ * that are not used keep mv 0 and ref_idx -1, so candidates compare as a
+ * whole.
+ */
+struct mv_field {
+    int16_t mv[2][2];
+    int8_t ref_idx[2];
+    uint8_t pred_flag; // bit 0 for list 0, bit 1 for list 1, 0 for intra
+    uint8_t ref_id[2]; // the dpb frames referred to, for the deblocking bS
+};
+
+/* what temporal motion vector prediction of later pictures finds, the
+ * motion of the top left 4x4 block per 16x16 one, see 8.5.3.2.8
+ */
+struct col_mv {
+    int16_t mv[2][2];
+    int poc[2];
+    uint8_t pred_flag;
+    uint8_t lt; // bit per list, the reference is a long term one
+};
+
+/* a picture of the decoded picture buffer, the one being decoded or a
+ * reference one. It is free once it is unused for reference and done.
+ */
+struct hevc_frame {
+    int16_t *pixel;
+    size_t pixel_size;
+    int size;
+    int uv_size;
+    int y_stride;
+    int uv_stride;
+    int width;
+    int height;
+
+    struct col_mv *col;
+    size_t col_size;
+    int col_stride;
+
+    int poc;
+    int8_t marking; // enum rps_marking
+    uint8_t decoding;
+    uint8_t id; // index in the dpb
 };
-#pragma pack(pop)
 
 struct picture {
+    // the three planes back to back, chroma ones at the size of chroma_format_idc
     int16_t *pixel;
     int size;
+    int uv_size;
     int y_stride;
     int uv_stride;
 
+    // the coding tree metadata, one plane per field, see pic_meta_init()
+    // per min cb
+    uint8_t *CuPredMode;
+    uint8_t *ctDepth;
+    uint8_t *pcm_flag;
+    uint8_t *cu_transquant_bypass_flag; // for sao
+    int8_t *qpy; // negative down to -QpBdOffsetY for high bit depth
+    int cb_stride;
+
+    // per min pu
     uint8_t *IntraPredModeY;
     uint8_t *IntraPredModeC;
+    int pu_stride;
+
+    // per min tb
+    uint8_t *split_transform_flag;
+    // 0 until the cu covering it is parsed, then (MinTbAddrZs + 1) << 1 with
+    // bit 0 set for intra cus, see nb_available()
+    uint32_t *nb_map;
+    int nb_stride;
 
-    struct cu_info * info;
-    uint8_t* split_transform_flag;
+    // edges for the deblocking filter per 4x4 luma block, see DBK_*
+    uint8_t *deblock;
+    int deblock_stride;
+    int deblock_rows; // ctb rows already deblocked
+
+    // two lines of deblocked samples and the last line of the row above per
+    // component for sao, each line padded with one sample on both sides
+    int16_t *sao_line;
+    int sao_rows; // ctb rows sao is done with
 
     struct ctu** ctus;
 
-    int slice_num;
-    struct slice_segment_header *slices;
+    // the frame of the dpb holding the samples, motion per 4x4 luma block at
+    // deblock_stride
+    struct hevc_frame *frame;
+    struct mv_field *mvf;
+    // see 8.3.2, RefPicSetStCurrBefore, RefPicSetStCurrAfter, RefPicSetLtCurr
+    struct hevc_frame *rps[3][16];
+    int num_rps[3];
+
+    // ctbs decoded per row and in all, slices come one nal unit at a time
+    int *row_done;
+    int ctbs_done;
+    // the contexts after the second ctb of each row for wpp, and the ones at
+    // the end of the last slice segment for a dependent one, see 9.3.1
+    struct cabac_ctx_store *wpp;
+    struct cabac_ctx_store ds;
 };
 
+static inline int16_t *
+pic_plane(struct picture *p, int cIdx)
+{
+    return p->pixel + (cIdx ? p->size + (cIdx - 1) * p->uv_size : 0);
+}
+
 static void
 rbsp_trailing_bits(struct bits_vec *v)
 {
@@ -186,14 +277,13 @@ parse_scaling_list_data(struct bits_vec *v, struct scaling_list_data *sld)
                 }
                 refMatrixId = mid - sld->scaling_list_pred_matrix_id_delta[sizeid][mid] *
                               (sizeid == 3 ? 3 : 1);
+                // see 7.4.5, the default list or one of the same size sent before
+                int coefNum = MIN(64, 1 << (4 + (sizeid << 1)));
                 if (sld->scaling_list_pred_matrix_id_delta[sizeid][mid] == 0) {
-                    for (int i = 0; i < MIN(63, (1 << (4 + (sizeid << 1))) - 1); i++) {
-                      sld->scalinglist[sizeid][mid][i] = ScalingList[sizeid][mid][i];
-                    }
+                    memcpy(sld->scalinglist[sizeid][mid], ScalingList[sizeid][mid], coefNum);
                 } else {
-                    for (int i = 0; i < MIN(63, (1 << (4 + (sizeid << 1))) - 1); i++) {
-                      sld->scalinglist[sizeid][mid][i] =  ScalingList[sizeid][refMatrixId][i];
-                    }
+                    memcpy(sld->scalinglist[sizeid][mid],
+                           sld->scalinglist[sizeid][refMatrixId], coefNum);
                 }
 
                 if (sld->scaling_list_pred_matrix_id_delta[sizeid][mid] == 0 &&
@@ -228,67 +318,143 @@ parse_scaling_list_data(struct bits_vec *v, struct scaling_list_data *sld)
     }
 }
 
-static void 
-init_scaling_factor(struct slice_segment_header *slice, struct sps *sps, struct scaling_list_data *sld)
-{
-    // if (sizeid == 0) {
-        for (int mid = 0; mid < 6; mid++) {
-            for (int i = 0; i < 16; i++) {
-                int x = slice->ScanOrder[2][0][i].x;
-                int y = slice->ScanOrder[2][0][i].y;
-                slice->ScalingFactor[0][mid][x][y] = sld->scalinglist[0][mid][i];
+/*see 6.5.3 (6-11)*/
+static void init_up_right_scan_order(scanpos *diagScan, int blkSize) {
+    int i = 0;
+    int x = 0, y = 0;
+    bool stopLoop = false;
+
+    while (!stopLoop) {
+        while (y >= 0) {
+            if (x < blkSize && y < blkSize) {
+                diagScan[i].x = x;
+                diagScan[i].y = y;
+                i++;
             }
+            y--;
+            x++;
         }
-    // } else if (sizeid == 1) {
-        for (int mid = 0; mid < 6; mid++) {
-            for (int i = 0; i < 64; i++) {
-                int x = slice->ScanOrder[3][0][i].x;
-                int y = slice->ScanOrder[3][0][i].y;
-                slice->ScalingFactor[1][mid][x][y] = sld->scalinglist[1][mid][i];
+        y = x;
+        x = 0;
+        if (i >= blkSize * blkSize) {
+            stopLoop = true;
+        }
+    }
+}
+
+/*see 6.5.4 (6-12)*/
+static void init_horizontal_scan_order(scanpos *horScan, int blkSize) {
+    int i = 0;
+
+    for (int y = 0; y < blkSize; y++) {
+        for (int x = 0; x < blkSize; x++) {
+            horScan[i].x = x;
+            horScan[i].y = y;
+            i++;
+        }
+    }
+}
+
+/*see 6.5.5 (6-13)*/
+static void init_vertical_scan_order(scanpos *verScan, int blkSize) {
+    int i = 0;
+
+    for (int x = 0; x < blkSize; x++) {
+        for (int y = 0; y < blkSize; y++) {
+            verScan[i].x = x;
+            verScan[i].y = y;
+            i++;
+        }
+    }
+}
+
+/*see 6.5.6 (6-14)*/
+static void init_traverse_scan_order(scanpos *travScan, int blkSize) {
+    int i = 0;
+
+    for (int y = 0; y < blkSize; y++) {
+        if (y % 2 == 0) {
+            for (int x = 0; x < blkSize; x++) {
+                travScan[i].x = x;
+                travScan[i].y = y;
+                i++;
+            }
+        } else {
+            for (int x = blkSize - 1; x >= 0; x--) {
+                travScan[i].x = x;
+                travScan[i].y = y;
+                i++;
             }
         }
-    // } else if (sizeid == 2) {
+    }
+}
+
+/* [log2BlockSize][scanIdx][sPos], scanIdx 0 for up-right, 1 for horizontal,
+ * 2 for vertical, which go up to 8x8, and 3 for traverse from 4x4 to 32x32.
+ * They only depend on the block size, so all slices share one copy.
+ */
+static const scanpos *ScanOrder[6][4];
+static scanpos scan_pool[3 * (1 + 4 + 16 + 64) + (16 + 64 + 256 + 1024)];
+static pthread_once_t scan_order_once = PTHREAD_ONCE_INIT;
+
+static void
+init_scan_order(void)
+{
+    scanpos *pos = scan_pool;
+    for (int log2blocksize = 0; log2blocksize < 6; log2blocksize++) {
+        int blkSize = 1 << log2blocksize;
+        if (log2blocksize < 4) {
+            init_up_right_scan_order(pos, blkSize);
+            ScanOrder[log2blocksize][0] = pos;
+            pos += blkSize * blkSize;
+            init_horizontal_scan_order(pos, blkSize);
+            ScanOrder[log2blocksize][1] = pos;
+            pos += blkSize * blkSize;
+            init_vertical_scan_order(pos, blkSize);
+            ScanOrder[log2blocksize][2] = pos;
+            pos += blkSize * blkSize;
+        }
+        if (log2blocksize >= 2) {
+            init_traverse_scan_order(pos, blkSize);
+            ScanOrder[log2blocksize][3] = pos;
+            pos += blkSize * blkSize;
+        }
+    }
+}
+
+/* see 7.4.5, ScalingFactor from the lists of sld, or from the default ones
+ * of table 7-5 and 7-6 if neither sps nor pps carries any
+ */
+static void
+init_scaling_factor(struct slice_segment_header *slice, struct sps *sps,
+                    const struct scaling_list_data *sld)
+{
+    const uint8_t (*list)[6][64] = sld ? sld->scalinglist : ScalingList;
+    for (int sizeid = 0; sizeid < 4; sizeid++) {
+        // 4x4 and 8x8 lists, the larger sizes repeat the 8x8 entries
+        const scanpos *scan = ScanOrder[sizeid ? 3 : 2][0];
+        int n = sizeid ? 64 : 16;
+        int rep = (sizeid < 2) ? 1 : 1 << (sizeid - 1);
         for (int mid = 0; mid < 6; mid++) {
-            for (int i = 0; i < 64; i++) {
-                int x = slice->ScanOrder[3][0][i].x;
-                int y = slice->ScanOrder[3][0][i].y;
-                for (int j = 0; j < 2; j++) {
-                    for (int k = 0; k < 2; k++) {
-                      slice->ScalingFactor[2][mid][x * 2 + k][y * 2 + j] = ScalingList[2][mid][i];
-                      slice->ScalingFactor[2][mid][0][0] = sld->scaling_list_dc_coef_minus8[0][mid] + 8;
-                    }
-                }
+            // 32x32 chroma blocks only come with 4:4:4, from the 16x16 lists
+            bool chroma32 = (sizeid == 3 && mid % 3);
+            if (chroma32 && sps->ChromaArrayType != 3) {
+                continue;
             }
-        }
-    // } else if (sizeid == 3) {
-        for (int mid = 0; mid < 4; mid += 3) {
-            for (int i = 0; i < 64; i++) {
-                int x = slice->ScanOrder[3][0][i].x;
-                int y = slice->ScanOrder[3][0][i].y;
-                for (int j = 0; j < 4; j++) {
-                    for (int k = 0; k < 4; k++) {
-                      slice->ScalingFactor[3][mid][x * 4 + k][y * 4 + j] = ScalingList[3][mid][i];
-                      slice->ScalingFactor[3][mid][0][0] = sld->scaling_list_dc_coef_minus8[1][mid] + 8;
+            const uint8_t *l = list[chroma32 ? 2 : sizeid][mid];
+            for (int i = 0; i < n; i++) {
+                int x = scan[i].x, y = scan[i].y;
+                for (int j = 0; j < rep; j++) {
+                    for (int k = 0; k < rep; k++) {
+                        slice->ScalingFactor[sizeid][mid][x * rep + k][y * rep + j] = l[i];
                     }
                 }
             }
-        }
-    // }
-    if (sps->ChromaArrayType == 3) {
-        for (int mid = 1; mid == 1 || mid == 2 || mid == 4 || mid == 5;
-             mid += 1) {
-            for (int i = 0; i < 64; i++) {
-                int x = slice->ScanOrder[3][0][i].x;
-                int y = slice->ScanOrder[3][0][i].y;
-                for (int j = 0; j < 4; j++) {
-                    for (int k = 0; k < 4; k++) {
-                      slice->ScalingFactor[3][mid][x * 4 + k][y * 4 + j] =
-                          ScalingList[2][mid][i];
-                    }
-                }
+            if (sizeid >= 2) {
+                slice->ScalingFactor[sizeid][mid][0][0] =
+                    sld ? sld->scaling_list_dc_coef_minus8[chroma32 ? 0 : sizeid - 2][mid] + 8
+                        : 16;
             }
-            slice->ScalingFactor[3][mid][0][0] =
-                sld->scaling_list_dc_coef_minus8[0][mid] + 8;
         }
     }
 }
@@ -842,10 +1008,10 @@ parse_pps(struct bits_vec *v)
 static void
 parse_lt_ref_set(struct bits_vec *v, struct sps *sps, struct lt_ref_pic_set *lt)
 {
-    lt->lt_ref_pic_poc_lsb_sps = calloc(sps->num_long_term_ref_pics_sps, 1);
+    lt->lt_ref_pic_poc_lsb_sps = calloc(sps->num_long_term_ref_pics_sps, sizeof(uint16_t));
     lt->used_by_curr_pic_lt_sps_flag = calloc(sps->num_long_term_ref_pics_sps, 1);
     for (uint32_t i = 0; i < sps->num_long_term_ref_pics_sps; i ++) {
-        lt->lt_ref_pic_poc_lsb_sps[i] = READ_BITS(v, 8);
+        lt->lt_ref_pic_poc_lsb_sps[i] = READ_BITS(v, sps->log2_max_pic_order_cnt_lsb_minus4 + 4);
         lt->used_by_curr_pic_lt_sps_flag[i] = READ_BIT(v);
     }
 }
@@ -864,9 +1030,9 @@ parse_lt_ref_set(struct bits_vec *v, struct sps *sps, struct lt_ref_pic_set *lt)
         has short_term_ref_pic_set_idx equal to stRpsIdx in a CVS that has the SPS as the active SPS.
     */
 static void
-parse_st_ref_set(struct bits_vec *v, struct st_ref_pic_set *st, int idx, int num_short_term_ref_pic_sets)
+parse_st_ref_set(struct bits_vec *v, struct st_ref_pic_set *sets,
+                 struct st_ref_pic_set *st, int idx, int num_short_term_ref_pic_sets)
 {
-    printf("st_ref_set %d, %d\n", idx, num_short_term_ref_pic_sets);
     if (idx != 0) {
         st->inter_ref_pic_set_prediction_flag = READ_BIT(v);
     }
@@ -877,32 +1043,89 @@ parse_st_ref_set(struct bits_vec *v, struct st_ref_pic_set *st, int idx, int num
         st->delta_rps_sign = READ_BIT(v);
         st->abs_delta_rps_minus1 = GOL_UE(v);
         int ref_idx = idx - (st->delta_idx_minus1 + 1);
-        struct st_ref_pic_set *ref_st = st - idx + ref_idx;
-        int num_delta_procs = ref_st->num_negative_pics + ref_st->num_positive_pics;
-        for (int j = 0; j < num_delta_procs; j ++) {
+        if (ref_idx < 0) {
+            VERR(hevc, "st_ref_pic_set %d predicted from %d", idx, ref_idx);
+            return;
+        }
+        const struct st_ref_pic_set *ref = sets + ref_idx;
+        int num_delta_pocs = ref->NumNegativePics + ref->NumPositivePics;
+        for (int j = 0; j <= num_delta_pocs; j ++) {
             st->ref_used[j].used_by_curr_pic_flag = READ_BIT(v);
-            if (st->ref_used[j].used_by_curr_pic_flag) {
+            st->ref_used[j].use_delta_flag = 1;
+            if (!st->ref_used[j].used_by_curr_pic_flag) {
                 st->ref_used[j].use_delta_flag = READ_BIT(v);
             }
         }
+        /* (7-61) and (7-62) */
+        int deltaRps = (1 - 2 * st->delta_rps_sign) * (int)(st->abs_delta_rps_minus1 + 1);
+        int i = 0;
+        for (int j = ref->NumPositivePics - 1; j >= 0 && i < 16; j--) {
+            int dPoc = ref->DeltaPocS1[j] + deltaRps;
+            if (dPoc < 0 && st->ref_used[ref->NumNegativePics + j].use_delta_flag) {
+                st->DeltaPocS0[i] = dPoc;
+                st->UsedByCurrPicS0[i++] = st->ref_used[ref->NumNegativePics + j].used_by_curr_pic_flag;
+            }
+        }
+        if (deltaRps < 0 && st->ref_used[num_delta_pocs].use_delta_flag && i < 16) {
+            st->DeltaPocS0[i] = deltaRps;
+            st->UsedByCurrPicS0[i++] = st->ref_used[num_delta_pocs].used_by_curr_pic_flag;
+        }
+        for (int j = 0; j < ref->NumNegativePics && i < 16; j++) {
+            int dPoc = ref->DeltaPocS0[j] + deltaRps;
+            if (dPoc < 0 && st->ref_used[j].use_delta_flag) {
+                st->DeltaPocS0[i] = dPoc;
+                st->UsedByCurrPicS0[i++] = st->ref_used[j].used_by_curr_pic_flag;
+            }
+        }
+        st->NumNegativePics = i;
+
+        i = 0;
+        for (int j = ref->NumNegativePics - 1; j >= 0 && i < 16; j--) {
+            int dPoc = ref->DeltaPocS0[j] + deltaRps;
+            if (dPoc > 0 && st->ref_used[j].use_delta_flag) {
+                st->DeltaPocS1[i] = dPoc;
+                st->UsedByCurrPicS1[i++] = st->ref_used[j].used_by_curr_pic_flag;
+            }
+        }
+        if (deltaRps > 0 && st->ref_used[num_delta_pocs].use_delta_flag && i < 16) {
+            st->DeltaPocS1[i] = deltaRps;
+            st->UsedByCurrPicS1[i++] = st->ref_used[num_delta_pocs].used_by_curr_pic_flag;
+        }
+        for (int j = 0; j < ref->NumPositivePics && i < 16; j++) {
+            int dPoc = ref->DeltaPocS1[j] + deltaRps;
+            if (dPoc > 0 && st->ref_used[ref->NumNegativePics + j].use_delta_flag) {
+                st->DeltaPocS1[i] = dPoc;
+                st->UsedByCurrPicS1[i++] = st->ref_used[ref->NumNegativePics + j].used_by_curr_pic_flag;
+            }
+        }
+        st->NumPositivePics = i;
     } else {
         st->num_negative_pics = GOL_UE(v);
         st->num_positive_pics = GOL_UE(v);
-        //see 7-63
-        // NumNegativePics[idx] = st->num_negative_pics;
-        //see 7-64
-        // NumPositivePics[idx] = st->num_positive_pics;
+        if (st->num_negative_pics > 16 || st->num_positive_pics > 16) {
+            VERR(hevc, "st_ref_pic_set %d with %d %d pictures", idx,
+                 st->num_negative_pics, st->num_positive_pics);
+            st->num_negative_pics = MIN(st->num_negative_pics, 16);
+            st->num_positive_pics = MIN(st->num_positive_pics, 16);
+        }
+        /* (7-63) to (7-68) */
+        st->NumNegativePics = st->num_negative_pics;
+        st->NumPositivePics = st->num_positive_pics;
+        int poc = 0;
         for (uint32_t i = 0; i < st->num_negative_pics; i ++) {
             st->delta_poc_s0_minus1[i] = GOL_UE(v);
             st->used_by_curr_pic_s0_flag[i] = READ_BIT(v);
-            //see 7-65
-            // UsedByCurrPicS0[idx][i] = used_by_curr_pic_s0_flag[i];
+            poc -= st->delta_poc_s0_minus1[i] + 1;
+            st->DeltaPocS0[i] = poc;
+            st->UsedByCurrPicS0[i] = st->used_by_curr_pic_s0_flag[i];
         }
+        poc = 0;
         for (uint32_t i = 0; i < st->num_positive_pics; i ++) {
             st->delta_poc_s1_minus1[i] = GOL_UE(v);
             st->used_by_curr_pic_s1_flag[i] = READ_BIT(v);
-            //see 7-66
-            // UsedByCurrPicS1[idx][i] = used_by_curr_pic_s1_flag[i];
+            poc += st->delta_poc_s1_minus1[i] + 1;
+            st->DeltaPocS1[i] = poc;
+            st->UsedByCurrPicS1[i] = st->used_by_curr_pic_s1_flag[i];
         }
     }
 }
@@ -1096,7 +1319,8 @@ parse_sps(struct hevc_nalu_header * h, struct bits_vec *v, struct vps *vps)
     if (sps->num_short_term_ref_pic_sets) {
         sps->sps_st_ref = calloc(sps->num_short_term_ref_pic_sets, sizeof(struct st_ref_pic_set));
         for (uint32_t i = 0; i < sps->num_short_term_ref_pic_sets; i++) {
-            parse_st_ref_set(v, sps->sps_st_ref + i, i, sps->num_short_term_ref_pic_sets);
+            parse_st_ref_set(v, sps->sps_st_ref, sps->sps_st_ref + i, i,
+                             sps->num_short_term_ref_pic_sets);
         }
     }
     sps->long_term_ref_pics_present_flag = READ_BIT(v);
@@ -1185,390 +1409,329 @@ parse_rep_format(struct bits_vec *v, struct vps_rep_format * rep)
     }
 }
 
-struct rps {
-    int* PocStCurrBefore;
-    int* PocStCurrAfter;
-    int* PocStFoll;
-    int* PocLtCurr;
-    int* PocLtFoll;
-    int NumPocStCurrBefore;
-    int NumPocStCurrAfter;
-    int NumPocStFoll;
-    int NumPocLtCurr;
-    int NumPocLtFoll;
-
-    int* RefPicList0;
-    int* RefPicList1;
-
-    int* CurrDeltaPocMsbPresentFlag;
-    int *FollDeltaPocMsbPresentFlag;
+//------------------------------------------------------------------------------
+// The decoded picture buffer, see 8.3. A frame is taken again once no picture
+// refers to it anymore and it is not being decoded, its buffers only grow.
 
-    int *RefPicSetLtCurr;
-    int *RefPicSetLtFoll;
-    int *RefPicSetStCurrBefore;
-    int *RefPicSetStCurrAfter;
-    int *RefPicSetStFoll;
-
-    int RpRefPicAvailFlag;
-};
+/* the st_ref_pic_set() of the current picture, NULL for idr ones */
+static const struct st_ref_pic_set *
+slice_st_ref_set(const struct sps *sps, const struct slice_segment_header *slice)
+{
+    if (!slice->short_term_ref_pic_set_sps_flag) {
+        return slice->st;
+    }
+    if (slice->short_term_ref_pic_set_idx < sps->num_short_term_ref_pic_sets) {
+        return sps->sps_st_ref + slice->short_term_ref_pic_set_idx;
+    }
+    return NULL;
+}
 
-enum rps_marking {
-    UNUSED_FOR_REFERENCE = -1,
-    USED_FOR_SHORT_TERM_REFERENCE = 0,
-    USED_FOR_LONG_TERM_REFERENCE = 1,
-};
+// see 7.4.2.2
+#define IS_IRAP(t) ((t) >= BLA_W_LP && (t) <= RSV_IRAP_VCL23)
+#define IS_IDR(t) ((t) == IDR_W_RADL || (t) == IDR_N_LP)
+#define IS_BLA(t) ((t) >= BLA_W_LP && (t) <= BLA_N_LP)
+#define IS_RASL(t) ((t) == RASL_N || (t) == RASL_R)
+#define IS_RADL(t) ((t) == RADL_N || (t) == RADL_R)
+// sub-layer non-reference pictures
+#define IS_SLNR(t) ((t) <= RSV_VCL_N14 && !((t) & 1))
 
+/* sets f up for the pictures of sps, the motion for tmvp starts as intra */
+static void
+frame_alloc(struct hevc_frame *f, const struct sps *sps)
+{
+    int width = sps->pic_width_in_luma_samples;
+    int height = ((sps->pic_height_in_luma_samples + 3) >> 2) << 2;
+    int y_stride = ((width + 3) >> 2) << 2;
+    int uv_stride = y_stride / sps->SubWidthC;
+    int uv_size = (sps->ChromaArrayType == 0) ? 0 : uv_stride * height / sps->SubHeightC;
+    size_t pixel_size = (height * y_stride + 2 * uv_size) * sizeof(int16_t);
+    if (pixel_size > f->pixel_size) {
+        free(f->pixel);
+        f->pixel = malloc(pixel_size);
+        f->pixel_size = pixel_size;
+    }
+    f->size = height * y_stride;
+    f->uv_size = uv_size;
+    f->y_stride = y_stride;
+    f->uv_stride = uv_stride;
+    f->width = width;
+    f->height = sps->pic_height_in_luma_samples;
+
+    f->col_stride = (width + 15) >> 4;
+    size_t col_size = f->col_stride * ((height + 15) >> 4) * sizeof(struct col_mv);
+    if (col_size > f->col_size) {
+        free(f->col);
+        f->col = malloc(col_size);
+        f->col_size = col_size;
+    }
+    memset(f->col, 0, col_size);
+}
 
-static int
-PicOrderCnt(struct hevc_slice *hslice, struct sps *sps, int picX UNUSED, bool IRAP)
+static inline int16_t *
+frame_plane(struct hevc_frame *f, int cIdx)
 {
-    /* Random access point pictures, where a decoder may start decoding a coded video sequence.
-      These are referred to as Intra Random Access Pictures (IRAP). Three IRAP picture types exist:
-      Instantaneous Decoder Refresh (IDR), Clean Random Access (CRA), and Broken Link Access (BLA).
-      The decoding process for a coded video sequence always starts at an IRAP. */
-    // int prevTid0Pic = 0;//has TemporalId == 0 and not RASL, RADL, SLNR
-    int PicOrderCntMsb;
-    int PicOrderCntVal = 0;
+    return f->pixel + (cIdx ? f->size + (cIdx - 1) * f->uv_size : 0);
+}
 
-    struct slice_segment_header *slice = hslice->slice;
-    //see 8.3.1
-    int prevPicOrderCntMsb = 0;// = PicOrderCntMsb;
-    int prevPicOrderCntLsb = 0;
-    //see (7-8)
-    int MaxPicOrderCntLsb = 2 << (sps->log2_max_pic_order_cnt_lsb_minus4 + 4);
-    if (IRAP) {
-        PicOrderCntMsb = 0;
-    } else {
-        //see (8-1)
-        if ((slice->slice_pic_order_cnt_lsb < (uint32_t)prevPicOrderCntLsb) &&
-            ((prevPicOrderCntLsb - (int)slice->slice_pic_order_cnt_lsb) >= (MaxPicOrderCntLsb / 2))) {
-            PicOrderCntMsb = prevPicOrderCntMsb + MaxPicOrderCntLsb;
-        } else if ((slice->slice_pic_order_cnt_lsb > (uint32_t)prevPicOrderCntLsb ) &&
-            (((int)slice->slice_pic_order_cnt_lsb - prevPicOrderCntLsb) > (MaxPicOrderCntLsb / 2))) {
-            PicOrderCntMsb = prevPicOrderCntMsb - MaxPicOrderCntLsb;
-        } else {
-            PicOrderCntMsb = prevPicOrderCntMsb;
+static void
+dpb_init(struct hevc_decoder *dec)
+{
+    if (!dec->dpb) {
+        dec->dpb = calloc(HEVC_DPB_SIZE, sizeof(struct hevc_frame));
+        for (int i = 0; i < HEVC_DPB_SIZE; i++) {
+            dec->dpb[i].id = i;
+            dec->dpb[i].marking = UNUSED_FOR_REFERENCE;
         }
-        //for BLA 
-        uint16_t pic_type = hslice->nalu->nal_unit_type;
-        if (pic_type == BLA_N_LP ||pic_type == BLA_W_LP || pic_type == BLA_W_RADL) {
-            PicOrderCntMsb = 0;
+    }
+}
+
+static struct hevc_frame *
+dpb_free_frame(struct hevc_decoder *dec)
+{
+    for (int i = 0; i < HEVC_DPB_SIZE; i++) {
+        if (dec->dpb[i].marking == UNUSED_FOR_REFERENCE && !dec->dpb[i].decoding) {
+            return &dec->dpb[i];
         }
-        //see (8-2)
-        PicOrderCntVal = PicOrderCntMsb + slice->slice_pic_order_cnt_lsb;
     }
-    return PicOrderCntVal;
+    return NULL;
 }
 
-static int
-DiffPicOrderCnt(struct hevc_slice *hslice, struct sps *sps, int picA, int picB)
+/* see 8.3.3.2, a mid grey intra picture in place of a missing reference */
+static struct hevc_frame *
+generate_unavailable_frame(struct hevc_decoder *dec, const struct sps *sps,
+                           int poc, int marking)
 {
-    return PicOrderCnt(hslice, sps, picA, true) - PicOrderCnt(hslice, sps, picB, true);
+    struct hevc_frame *f = dpb_free_frame(dec);
+    if (!f) {
+        VERR(hevc, "no room in the dpb for missing picture %d", poc);
+        return NULL;
+    }
+    VERR(hevc, "reference picture %d is missing", poc);
+    frame_alloc(f, sps);
+    for (int i = 0; i < f->size; i++) {
+        f->pixel[i] = 1 << (sps->BitDepthY - 1);
+    }
+    for (int i = 0; i < 2 * f->uv_size; i++) {
+        f->pixel[f->size + i] = 1 << (sps->BitDepthC - 1);
+    }
+    f->poc = poc;
+    f->marking = marking;
+    return f;
 }
 
-static bool
-is_ref_pic_in_dpb(int picX UNUSED, int PicOrderCntVal, int Poc, int layerid, int currPicLayerId)
+/* see 8.3.1, PicOrderCntVal of the current picture */
+static int
+pic_order_cnt(struct hevc_decoder *dec, const struct sps *sps,
+              const struct hevc_nalu_header *h,
+              const struct slice_segment_header *slice)
 {
-    if (PicOrderCntVal == Poc && layerid == currPicLayerId) {
-        return true;
+    int type = h->nal_unit_type;
+    int MaxPicOrderCntLsb = 1 << (sps->log2_max_pic_order_cnt_lsb_minus4 + 4);
+    int lsb = slice->slice_pic_order_cnt_lsb;
+    int prevPicOrderCntLsb = dec->prev_tid0_poc & (MaxPicOrderCntLsb - 1);
+    int prevPicOrderCntMsb = dec->prev_tid0_poc - prevPicOrderCntLsb;
+    int PicOrderCntMsb;
+    // see (8-1)
+    if (IS_IRAP(type) && dec->no_rasl_output) {
+        PicOrderCntMsb = 0;
+    } else if (lsb < prevPicOrderCntLsb &&
+               prevPicOrderCntLsb - lsb >= MaxPicOrderCntLsb / 2) {
+        PicOrderCntMsb = prevPicOrderCntMsb + MaxPicOrderCntLsb;
+    } else if (lsb > prevPicOrderCntLsb &&
+               lsb - prevPicOrderCntLsb > MaxPicOrderCntLsb / 2) {
+        PicOrderCntMsb = prevPicOrderCntMsb - MaxPicOrderCntLsb;
+    } else {
+        PicOrderCntMsb = prevPicOrderCntMsb;
     }
-    return false;
+    int poc = PicOrderCntMsb + lsb;
+    if (h->nuh_temporal_id == 0 && !IS_RASL(type) && !IS_RADL(type) &&
+        !IS_SLNR(type)) {
+        dec->prev_tid0_poc = poc;
+    }
+    return poc;
 }
 
-/* see 8.3.2 
- This process is invoked once per picture, after decoding of a slice header
- but prior to the decoding of any coding unit and prior to the decoding process
- for reference picture list construction 
-*/
-static struct rps *
-process_reference_picture_set(bool idr, struct hevc_slice *hslice, struct hevc_param_set * hps)
+/* see 8.3.2, marks the frames of the dpb for the current picture with
+ * PicOrderCntVal poc and keeps RefPicSetStCurrBefore, RefPicSetStCurrAfter
+ * and RefPicSetLtCurr in p. The missing ones are generated as in 8.3.3,
+ * whatever the current picture is.
+ */
+static void
+reference_picture_set(struct hevc_decoder *dec, const struct sps *sps,
+                      const struct hevc_nalu_header *h,
+                      const struct slice_segment_header *slice,
+                      struct picture *p, int poc)
 {
-    struct slice_segment_header *slice = hslice->slice;
-    struct hevc_nalu_header *headr = hslice->nalu;
-    struct rps *rps = calloc(1, sizeof(*rps));
-
-    struct pps *pps = hps->pps[slice->slice_pic_parameter_set_id];
-    struct sps *sps = hps->sps[pps->pps_seq_parameter_set_id];
-    struct vps *vps = hps->vps[sps->sps_video_parameter_set_id];
-
-    int currPicLayerId = headr->nuh_layer_id;
-    int picX = 0;
-
-    //see (7-8)
-    int MaxPicOrderCntLsb = 2 << (sps->log2_max_pic_order_cnt_lsb_minus4 + 4);
-    int PicOrderCntVal = PicOrderCnt(hslice, sps, picX, false);
-    /* Five lists of picture order count values are constructed to derive the RPS.
-     These five lists are PocStCurrBefore, PocStCurrAfter, PocStFoll, PocLtCurr and PocLtFoll,
-     with NumPocStCurrBefore, NumPocStCurrAfter, NumPocStFoll, NumPocLtCurr and NumPocLtFoll
-     number of elements, respectively.
-     If the current picture is an IDR picture, PocStCurrBefore, PocStCurrAfter,
-     PocStFoll, PocLtCurr and PocLtFoll are all set to be empty, and NumPocStCurrBefore, 
-     NumPocStCurrAfter, NumPocStFoll, NumPocLtCurr and NumPocLtFoll are all set equal to 0.*/
-    if (idr) {
-        rps->PocStCurrBefore = NULL;
-        rps->PocStCurrAfter = NULL;
-        rps->PocStFoll = NULL;
-        rps->PocLtCurr = NULL;
-        rps->PocLtFoll = NULL;
-
-        rps->NumPocStCurrBefore = 0;
-        rps->NumPocStCurrAfter = 0;
-        rps->NumPocStFoll = 0;
-        rps->NumPocLtCurr = 0;
-        rps->NumPocLtFoll = 0;
-    } else {
+    struct hevc_frame *dpb = dec->dpb;
+    int MaxPicOrderCntLsb = 1 << (sps->log2_max_pic_order_cnt_lsb_minus4 + 4);
 
-        /*value  CurrRpsIdx in the range of 0 to num_short_term_ref_pic_sets - 1, */
-        /* see (8-5) */
-        int i = 0, j = 0, k = 0;
-        for (; i < slice->NumNegativePics[slice->CurrRpsIdx] ; i++ ) {
-            if (slice->UsedByCurrPicS0[slice->CurrRpsIdx][i]) {
-                rps->PocStCurrBefore[j++] = PicOrderCntVal + slice->DeltaPocS0[slice->CurrRpsIdx][i];
-            } else {
-                rps->PocStFoll[k++] = PicOrderCntVal + slice->DeltaPocS0[slice->CurrRpsIdx][i];
-            }
-        }
-        rps->NumPocStCurrBefore = j;
-        for (i = 0, j = 0; i < slice->NumPositivePics[slice->CurrRpsIdx]; i++) {
-            if (slice->UsedByCurrPicS1[slice->CurrRpsIdx][i]) {
-                rps->PocStCurrAfter[j++] = PicOrderCntVal + slice->DeltaPocS1[slice->CurrRpsIdx][i];
-            } else {
-                rps->PocStFoll[k++] = PicOrderCntVal + slice->DeltaPocS1[slice->CurrRpsIdx][i];
-            }
-        }
-        rps->NumPocStCurrAfter = j;
-        rps->NumPocStFoll = k;
-        for (i = 0, j = 0, k = 0; i < (int)slice->num_long_term_sps + (int)slice->num_long_term_pics; i++) {
-            int pocLt = slice->PocLsbLt[i];
-            if (slice->terms[i].delta_poc_msb_present_flag) {
-                pocLt += PicOrderCntVal - slice->DeltaPocMsbCycleLt[i] * MaxPicOrderCntLsb -
-                    (PicOrderCntVal & ( MaxPicOrderCntLsb - 1));
-            }
-            if (slice->UsedByCurrPicLt[i]) {
-                rps->PocLtCurr[j] = pocLt;
-                rps->CurrDeltaPocMsbPresentFlag[j++] = slice->terms[i].delta_poc_msb_present_flag;
-            } else {
-                rps->PocLtFoll[k] = pocLt;
-                rps->FollDeltaPocMsbPresentFlag[k++] = slice->terms[i].delta_poc_msb_present_flag;
-            }
+    memset(p->num_rps, 0, sizeof(p->num_rps));
+    if (IS_IRAP(h->nal_unit_type) && dec->no_rasl_output) {
+        for (int k = 0; k < HEVC_DPB_SIZE; k++) {
+            dpb[k].marking = UNUSED_FOR_REFERENCE;
         }
-        rps->NumPocLtCurr = j;
-        rps->NumPocLtFoll = k;
+    }
+    if (IS_IDR(h->nal_unit_type)) {
+        return;
     }
 
-    /* (8-6)*/
-    /* step 1 */
-    for (int i = 0; i < rps->NumPocLtCurr; i++) {
-        if (!rps->CurrDeltaPocMsbPresentFlag[i]) {
-            if (is_ref_pic_in_dpb(picX, PicOrderCntVal & (MaxPicOrderCntLsb-1), rps->PocLtCurr[i], vps->vps_ext->layer_id_in_nuh[i], currPicLayerId)) {
-                rps->RefPicSetLtCurr[i] = picX;
-            } else {
-                rps->RefPicSetLtCurr[i] = -1; //means no reference picture
-            }
-        } else {
-            if (is_ref_pic_in_dpb(picX, PicOrderCntVal, rps->PocLtCurr[i], vps->vps_ext->layer_id_in_nuh[i], currPicLayerId)) {
-                rps->RefPicSetLtCurr[i] = picX;
-            } else {
-                rps->RefPicSetLtCurr[i] = -1;
+    // see (8-5), the curr lists first, then the foll ones
+    int st_poc[3][32], num_st[3] = {0};
+    int lt_poc[2][32], num_lt[2] = {0};
+    uint8_t lt_msb[2][32];
+    const struct st_ref_pic_set *st = slice_st_ref_set(sps, slice);
+    if (st) {
+        for (int i = 0; i < st->NumNegativePics; i++) {
+            int c = st->UsedByCurrPicS0[i] ? 0 : 2;
+            st_poc[c][num_st[c]++] = poc + st->DeltaPocS0[i];
+        }
+        for (int i = 0; i < st->NumPositivePics; i++) {
+            int c = st->UsedByCurrPicS1[i] ? 1 : 2;
+            st_poc[c][num_st[c]++] = poc + st->DeltaPocS1[i];
+        }
+    }
+    int num_long_term = MIN((int)(slice->num_long_term_sps + slice->num_long_term_pics), 32);
+    for (int i = 0; i < num_long_term; i++) {
+        int pocLt = slice->PocLsbLt[i];
+        if (slice->terms[i].delta_poc_msb_present_flag) {
+            pocLt += poc - slice->DeltaPocMsbCycleLt[i] * MaxPicOrderCntLsb -
+                     (poc & (MaxPicOrderCntLsb - 1));
+        }
+        int c = slice->UsedByCurrPicLt[i] ? 0 : 1;
+        lt_msb[c][num_lt[c]] = slice->terms[i].delta_poc_msb_present_flag;
+        lt_poc[c][num_lt[c]++] = pocLt;
+    }
+
+    // (8-6), long term ones are looked up among all reference pictures, as
+    // they may still be short term ones, but only marked after (8-7)
+    bool keep[HEVC_DPB_SIZE] = {false};
+    struct hevc_frame *lt[2][32];
+    for (int c = 0; c < 2; c++) {
+        for (int i = 0; i < num_lt[c]; i++) {
+            lt[c][i] = NULL;
+            for (int k = 0; k < HEVC_DPB_SIZE; k++) {
+                int fpoc = lt_msb[c][i] ? dpb[k].poc
+                                        : (dpb[k].poc & (MaxPicOrderCntLsb - 1));
+                if (dpb[k].marking != UNUSED_FOR_REFERENCE && fpoc == lt_poc[c][i]) {
+                    lt[c][i] = &dpb[k];
+                    break;
+                }
             }
         }
     }
-    for (int i = 0; i < rps->NumPocLtFoll; i ++) {
-        if (!rps->FollDeltaPocMsbPresentFlag[i]) {
-            if (is_ref_pic_in_dpb(picX, PicOrderCntVal & (MaxPicOrderCntLsb-1), rps->PocLtFoll[i], vps->vps_ext->layer_id_in_nuh[i], currPicLayerId)) {
-                rps->RefPicSetLtFoll[i] = picX;
-            } else {
-                rps->RefPicSetLtFoll[i] = -1;
-            }
-        } else {
-            if (is_ref_pic_in_dpb(picX, PicOrderCntVal, rps->PocLtFoll[i], vps->vps_ext->layer_id_in_nuh[i], currPicLayerId)) {
-                rps->RefPicSetLtFoll[i] = picX;
-            } else {
-                rps->RefPicSetLtFoll[i] = -1;
+    // (8-7)
+    struct hevc_frame *stf[3][32];
+    for (int c = 0; c < 3; c++) {
+        for (int i = 0; i < num_st[c]; i++) {
+            stf[c][i] = NULL;
+            for (int k = 0; k < HEVC_DPB_SIZE; k++) {
+                if (dpb[k].marking == USED_FOR_SHORT_TERM_REFERENCE &&
+                    dpb[k].poc == st_poc[c][i]) {
+                    stf[c][i] = &dpb[k];
+                    keep[k] = true;
+                    break;
+                }
             }
         }
     }
-    /* step 2 */
-    /* All reference pictures that are included in RefPicSetLtCurr or RefPicSetLtFoll
-     and have nuh_layer_id equal to currPicLayerId are marked as "used for long-term reference".*/
-    
-    /* step 3*/
-    for (int i = 0; i < rps->NumPocStCurrBefore; i++ ) {
-        if (is_ref_pic_in_dpb(picX, PicOrderCntVal & (MaxPicOrderCntLsb-1), rps->PocStCurrBefore[i], vps->vps_ext->layer_id_in_nuh[i], currPicLayerId)) {
-            rps->RefPicSetStCurrBefore[i] = picX;
-        } else {
-            rps->RefPicSetStCurrBefore[i] = -1;
-        }
-    }
-    for (int i = 0; i < rps->NumPocStCurrAfter; i++ ) {
-        if (is_ref_pic_in_dpb(picX, PicOrderCntVal, rps->PocStCurrAfter[i], vps->vps_ext->layer_id_in_nuh[i], currPicLayerId)) {
-            rps->RefPicSetStCurrAfter[i] = picX;
-        } else {
-            rps->RefPicSetStCurrAfter[i] = -1;
+    for (int c = 0; c < 2; c++) {
+        for (int i = 0; i < num_lt[c]; i++) {
+            if (lt[c][i]) {
+                lt[c][i]->marking = USED_FOR_LONG_TERM_REFERENCE;
+                keep[lt[c][i]->id] = true;
+            }
         }
     }
-    for (int i = 0; i < rps->NumPocStFoll; i++ ) {
-        if (is_ref_pic_in_dpb(picX, PicOrderCntVal, rps->PocStFoll[i], vps->vps_ext->layer_id_in_nuh[i], currPicLayerId)) {
-            rps->RefPicSetStFoll[i] = picX;
-        } else {
-            rps->RefPicSetStFoll[i] = -1;
+    for (int k = 0; k < HEVC_DPB_SIZE; k++) {
+        if (!keep[k]) {
+            dpb[k].marking = UNUSED_FOR_REFERENCE;
         }
     }
-    /*step 4*/
-    /*All reference pictures in the DPB that are not included in RefPicSetLtCurr, RefPicSetLtFoll,
-    RefPicSetStCurrBefore, RefPicSetStCurrAfter, or RefPicSetStFoll and have nuh_layer_id equal to
-    currPicLayerId are marked as "unused for reference"*/
 
-    return rps;
-}
-#if 0
-/* 8.3.3 
- This process is invoked once per coded picture when the current picture is a BLA picture
- or is a CRA picture with NoRaslOutputFlag equal to 1.*/
-static void
-process_generating_unavailable_reference_pictures(struct hevc_nalu_header *headr, struct slice_segment_header *slice, struct rps *rps)
-{
-    if (headr->nal_unit_type == BLA_N_LP || headr->nal_unit_type == BLA_W_LP ||
-     headr->nal_unit_type == BLA_W_RADL || headr->nal_unit_type == CRA_NUT) {
-        for (int i = 0; i < rps->NumPocStFoll; i ++) {
-            PicOrderCntVal = rps->PocStFoll[i];
-            PicOutputFlag = 0;
-            USED_FOR_SHORT_TERM_REFERENCE;
-            rps->RefPicSetStFoll[i] = ;
-        }
-        for (int i = 0; i < rps->NumPocLtFoll; i ++) {
-            rps->RefPicSetLtFoll[i] = UNUSED_FOR_REFERENCE;
-            PicOrderCntVal = rps->PocLtFoll[i];
-            USED_FOR_LONG_TERM_REFERENCE
-            rps->RefPicSetLtFoll[i] = ;
+    // the curr ones, with what is missing generated
+    for (int c = 0; c < 2; c++) {
+        for (int i = 0; i < num_st[c] && p->num_rps[c] < 16; i++) {
+            struct hevc_frame *f = stf[c][i];
+            if (!f) {
+                f = generate_unavailable_frame(dec, sps, st_poc[c][i],
+                                               USED_FOR_SHORT_TERM_REFERENCE);
+            }
+            if (f) {
+                p->rps[c][p->num_rps[c]++] = f;
+            }
         }
-     }
-}
-
-//8.3.3.2
-static void
-process_gerneration_of_one_unavailable_picture()
-{
-    luma = 1 << (BitDepth -1);
-    if (ChromaArrayType != 0) {
-        cr = cb = 1 << (BitDepth -1);
-    }
-
-}
-#endif
-/*see 8.3.4
-This process is invoked at the beginning of the decoding process for each P or B slice */
-static void
-process_reference_picture_lists_construction(struct hevc_slice *hslice, struct hevc_param_set * hps)
-{
-    struct rps *rps = hslice->rps;
-    struct slice_segment_header *slice = hslice->slice;
-    if (slice->slice_type == SLICE_TYPE_I) {
-        return ;
-    }
-
-    struct pps *pps = hps->pps[slice->slice_pic_parameter_set_id];
-    // struct sps *sps = hps->sps[pps->pps_seq_parameter_set_id];
-
-    int NumRpsCurrTempList0 = MAX((int)(slice->num_ref_idx_l0_active_minus1) + 1, slice->NumPicTotalCurr);
-    //see (8-8)/ f-65 , F.8.3.4 Decoding process for reference picture lists construction
-    int rIdx = 0;
-    int currPic = 0;
-    int * RefPicListTemp0 = calloc(NumRpsCurrTempList0, sizeof(int));
-    while (rIdx < NumRpsCurrTempList0) {
-        for (int i = 0; i < rps->NumPocStCurrBefore && rIdx < NumRpsCurrTempList0; rIdx++, i++)
-            RefPicListTemp0[rIdx] = rps->RefPicSetStCurrBefore[i];
-        for (int i = 0; i < rps->NumPocStCurrAfter && rIdx < NumRpsCurrTempList0; rIdx++, i++)
-            RefPicListTemp0[rIdx] = rps->RefPicSetStCurrAfter[i];
-        for (int i = 0; i < rps->NumPocLtCurr && rIdx < NumRpsCurrTempList0; rIdx++, i++)
-            RefPicListTemp0[rIdx] = rps->RefPicSetLtCurr[i];
-        if (pps->pps_scc_ext.pps_curr_pic_ref_enabled_flag)
-            RefPicListTemp0[rIdx++] = currPic;
-    }
-    //see (8-9) / f-66
-    for (rIdx = 0; rIdx <= (int)slice->num_ref_idx_l0_active_minus1; rIdx++) {
-        rps->RefPicList0[rIdx] = slice->ref_pic_list_modification_flag_l0 ? RefPicListTemp0[slice->list_entry_l0[rIdx]] : RefPicListTemp0[rIdx];
-    }
-    if (pps->pps_scc_ext.pps_curr_pic_ref_enabled_flag && !slice->ref_pic_list_modification_flag_l0 &&
-            NumRpsCurrTempList0 > (int)(slice->num_ref_idx_l0_active_minus1 + 1)) {
-        rps->RefPicList0[slice->num_ref_idx_l0_active_minus1] = currPic;
     }
-    if (slice->slice_type == SLICE_TYPE_B) {
-        int NumRpsCurrTempList1 = MAX((int)slice->num_ref_idx_l1_active_minus1 + 1, slice->NumPicTotalCurr);
-        int * RefPicListTemp1 = calloc(NumRpsCurrTempList1, sizeof(int));
-        /* (8-10) */
-        rIdx = 0;
-        while (rIdx < NumRpsCurrTempList1) {
-            for (int i = 0; i < rps->NumPocStCurrAfter && rIdx < NumRpsCurrTempList1; rIdx++, i++ )
-                RefPicListTemp1[rIdx] = rps->RefPicSetStCurrAfter[i];
-            for (int i = 0; i < rps->NumPocStCurrBefore && rIdx < NumRpsCurrTempList1; rIdx++, i++ )
-                RefPicListTemp1[rIdx] = rps->RefPicSetStCurrBefore[i];
-            for (int i = 0; i < rps->NumPocLtCurr && rIdx < NumRpsCurrTempList1; rIdx++, i++ )
-                RefPicListTemp1[rIdx] = rps->RefPicSetLtCurr[i];
-            if (pps->pps_scc_ext.pps_curr_pic_ref_enabled_flag)
-                RefPicListTemp1[rIdx++] = currPic;
+    for (int i = 0; i < num_lt[0] && p->num_rps[2] < 16; i++) {
+        struct hevc_frame *f = lt[0][i];
+        if (!f) {
+            f = generate_unavailable_frame(dec, sps, lt_poc[0][i],
+                                           USED_FOR_LONG_TERM_REFERENCE);
         }
-        /* (8-11) */
-        for( rIdx = 0; rIdx <= (int)slice->num_ref_idx_l1_active_minus1; rIdx++) {
-            rps->RefPicList1[rIdx] = slice->ref_pic_list_modification_flag_l1 ? RefPicListTemp1[slice->list_entry_l1[rIdx]] :
-                RefPicListTemp1[rIdx];
+        if (f) {
+            p->rps[2][p->num_rps[2]++] = f;
         }
-
-        free(RefPicListTemp1);
     }
-
-    free(RefPicListTemp0);
 }
 
-/* 8.3.5,
-  at the beginning of the decoding process for each P or B slice,
-   after decoding of the slice header as well as the invocation of the
-   decoding process for reference picture set as specified in clause 8.3.2
-*/
-
-//I.8.3.5, when the current slice is a P or B slice.
-static void
-process_target_reference_index_for_residual_predication(struct hevc_slice *hslice, struct hevc_param_set * hps)
+/* see 8.3.4, the reference picture lists of a slice, with the collocated
+ * picture and NoBackwardPredFlag of 8.5.3.2.8. Returns -1 if a P or B slice
+ * has nothing to refer to.
+ */
+static int
+ref_pic_lists(struct hevc_slice *hslice, const struct picture *p)
 {
-    struct rps *rps = hslice->rps;
     struct slice_segment_header *slice = hslice->slice;
+    memset(hslice->RefPicList, 0, sizeof(hslice->RefPicList));
+    hslice->ColPic = NULL;
+    hslice->NoBackwardPredFlag = 1;
     if (slice->slice_type == SLICE_TYPE_I) {
-        return;
+        return 0;
     }
-
-    struct pps *pps = hps->pps[slice->slice_pic_parameter_set_id];
-    struct sps *sps = hps->sps[pps->pps_seq_parameter_set_id];
-
-    int RpRefPicAvailFlagL0 = 0, RpRefPicAvailFlagL1 = 0;
-    int RpRefIdxL0 UNUSED = -1, RpRefIdxL1 UNUSED = -1;
-    int CurrPic = 0;
-
-    for (int x = 0; x <= ((slice->slice_type == SLICE_TYPE_B) ? 1 : 0); x++) {
-        int minPocDiff = (1 << 15) - 1;
-        if (x == 0) {
-            for (uint32_t i = 0; i <= slice->num_ref_idx_l0_active_minus1; i ++) {
-                int pocDiff = ABS(DiffPicOrderCnt(hslice, sps, CurrPic, rps->RefPicList0[i]));
-                if (pocDiff !=0 && pocDiff < minPocDiff) {
-                    minPocDiff = pocDiff;
-                    RpRefIdxL0 = 0;
-                    RpRefPicAvailFlagL0 = 1;
+    int NumPicTotalCurr = p->num_rps[0] + p->num_rps[1] + p->num_rps[2];
+    if (NumPicTotalCurr == 0) {
+        VERR(hevc, "no reference picture for an inter slice");
+        return -1;
+    }
+    for (int X = 0; X <= (slice->slice_type == SLICE_TYPE_B); X++) {
+        int num_active = (X ? slice->num_ref_idx_l1_active_minus1
+                            : slice->num_ref_idx_l0_active_minus1) + 1;
+        int NumRpsCurrTempList = MAX(num_active, NumPicTotalCurr);
+        // see (8-8) and (8-10), list 1 starts with the pictures that follow
+        struct hevc_frame *temp[48];
+        const int order[3] = {X, !X, 2};
+        int rIdx = 0;
+        while (rIdx < NumRpsCurrTempList) {
+            for (int k = 0; k < 3; k++) {
+                for (int i = 0; i < p->num_rps[order[k]] && rIdx < NumRpsCurrTempList; i++) {
+                    temp[rIdx++] = p->rps[order[k]][i];
                 }
             }
-        } else if (x == 1) {
-            for (uint32_t i = 0; i <= slice->num_ref_idx_l1_active_minus1; i++) {
-                int pocDiff = ABS(DiffPicOrderCnt(hslice, sps, CurrPic, rps->RefPicList1[i]));
-                if (pocDiff !=0 && pocDiff < minPocDiff) {
-                    minPocDiff = pocDiff;
-                    RpRefIdxL1 = 0;
-                    RpRefPicAvailFlagL1 = 1;
-                }
+        }
+        // see (8-9) and (8-11)
+        uint8_t modified = X ? slice->ref_pic_list_modification_flag_l1
+                             : slice->ref_pic_list_modification_flag_l0;
+        const uint32_t *list_entry = X ? slice->list_entry_l1 : slice->list_entry_l0;
+        for (rIdx = 0; rIdx < num_active; rIdx++) {
+            int entry = modified ? (int)list_entry[rIdx] : rIdx;
+            if (entry >= NumRpsCurrTempList) {
+                VERR(hevc, "list_entry_l%d %d out of %d pictures", X, entry,
+                     NumRpsCurrTempList);
+                return -1;
+            }
+            hslice->RefPicList[X][rIdx] = temp[entry];
+            if (temp[entry]->poc > hslice->poc) {
+                hslice->NoBackwardPredFlag = 0;
             }
         }
     }
-    //see I.8.3.2
-    int DispAvailFlag = 1;//TODO
-    //see (I-61)
-    rps->RpRefPicAvailFlag = (RpRefPicAvailFlagL0 || RpRefPicAvailFlagL1) && DispAvailFlag;
+    if (slice->slice_temporal_mvp_enabled_flag) {
+        int X = (slice->slice_type == SLICE_TYPE_B && !slice->collocated_from_l0_flag);
+        if (slice->collocated_ref_idx <= (X ? slice->num_ref_idx_l1_active_minus1
+                                            : slice->num_ref_idx_l0_active_minus1)) {
+            hslice->ColPic = hslice->RefPicList[X][slice->collocated_ref_idx];
+        }
+    }
+    return 0;
 }
 
 static void
@@ -2495,8 +2658,6 @@ static void calc_pps_params(struct sps *sps, struct pps *pps) {
     for (int ctbAddrRs = 0; ctbAddrRs < sps->PicSizeInCtbsY; ctbAddrRs++)
         pps->CtbAddrTsToRs[pps->CtbAddrRsToTs[ctbAddrRs]] = ctbAddrRs;
     // see (6-9)
-    printf("Tile row %d, col %d\n", pps->num_tile_rows_minus1 + 1,
-           pps->num_tile_columns_minus1+1);
     pps->TileId = calloc(sps->PicSizeInCtbsY, sizeof(uint32_t));
     for (int j = 0, tileIdx = 0; j <= (int)pps->num_tile_rows_minus1; j++) {
         for (int i = 0; i <= (int)pps->num_tile_columns_minus1; i++, tileIdx++) {
@@ -2576,115 +2737,198 @@ calc_sps_params(struct sps *sps)
 
 }
 
-/*see 6.5.3 (6-11)*/
-static scanpos *init_up_right_scan_order(int blkSize) {
-    int i = 0;
-    int x = 0, y = 0;
-    bool stopLoop = false;
-    scanpos *diagScan = malloc(sizeof(scanpos) * blkSize * blkSize);
-
-    while (!stopLoop) {
-        while (y >= 0) {
-            if (x < blkSize && y < blkSize) {
-                diagScan[i].x = x;
-                diagScan[i].y = y;
-                i++;
-            }
-            y--;
-            x++;
-        }
-        y = x;
-        x = 0;
-        if (i >= blkSize * blkSize) {
-            stopLoop = true;
-        }
-    }
-    return diagScan;
+static void
+free_vps(struct vps *vps)
+{
+    if (vps->vps_timing_info)
+        free(vps->vps_timing_info);
+    if (vps->vps_ext)
+        free(vps->vps_ext);
+    if (vps->vps_3d_ext)
+        free(vps->vps_3d_ext);
+    free(vps);
 }
 
-/*see 6.5.4 (6-12)*/
-static scanpos *init_horizontal_scan_order(int blkSize) {
-    int i = 0;
-    scanpos *horScan = malloc(sizeof(scanpos) * blkSize * blkSize);
+static void
+free_sps(struct sps *sps)
+{
+    if (sps->list_data)
+        free(sps->list_data);
+    if (sps->pcm)
+        free(sps->pcm);
+    if (sps->sps_st_ref)
+        free(sps->sps_st_ref);
+    if (sps->sps_lt_ref) {
+        free(sps->sps_lt_ref->lt_ref_pic_poc_lsb_sps);
+        free(sps->sps_lt_ref->used_by_curr_pic_lt_sps_flag);
+        free(sps->sps_lt_ref);
+    }
+    if (sps->vui)
+        free(sps->vui);
+    free(sps);
+}
 
-    for (int y = 0; y < blkSize; y++) {
-        for (int x = 0; x < blkSize; x++) {
-            horScan[i].x = x;
-            horScan[i].y = y;
-            i++;
-        }
+/* the tables calc_pps_params() derived with pps->derived_sps */
+static void
+free_pps_tables(struct pps *pps)
+{
+    struct sps *sps = pps->derived_sps;
+    if (!sps) {
+        return;
     }
-    return horScan;
+    int PicWidthInTbsY = sps->PicWidthInCtbsY
+                         << (sps->CtbLog2SizeY - sps->MinTbLog2SizeY);
+    for (int x = 0; x < PicWidthInTbsY; x++) {
+        free(pps->MinTbAddrZs[x]);
+    }
+    free(pps->MinTbAddrZs);
+    free(pps->CtbAddrTsToRs);
+    free(pps->CtbAddrRsToTs);
+    free(pps->TileId);
+    pps->MinTbAddrZs = NULL;
+    pps->CtbAddrTsToRs = NULL;
+    pps->CtbAddrRsToTs = NULL;
+    pps->TileId = NULL;
+    pps->derived_sps = NULL;
 }
 
-/*see 6.5.5 (6-13)*/
-static scanpos *init_vertical_scan_order(int blkSize) {
-    int i = 0;
-    scanpos *verScan = malloc(sizeof(scanpos) * blkSize * blkSize);
+static void
+free_pps(struct pps *pps)
+{
+    if (pps->pps_3d_ext)
+        free(pps->pps_3d_ext);
+    if (pps->pps_multilayer_ext)
+        free(pps->pps_multilayer_ext);
+    free(pps->column_width_minus1);
+    free(pps->row_height_minus1);
+    free_pps_tables(pps);
+    free(pps);
+}
 
-    for (int x = 0; x < blkSize; x++) {
-        for (int y = 0; y < blkSize; y++) {
-            verScan[i].x = x;
-            verScan[i].y = y;
-            i++;
-        }
+/* the derived values only depend on the parameter sets, so they are worked
+ * out with the first slice which refers to them and kept with them after.
+ * The tiles of a grid decode with the same sets on several threads.
+ */
+static pthread_mutex_t param_set_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void
+activate_param_sets(struct sps *sps, struct pps *pps)
+{
+    pthread_mutex_lock(&param_set_lock);
+    if (!sps->derived) {
+        calc_sps_params(sps);
+        sps->derived = 1;
+    }
+    if (pps->derived_sps != sps) {
+        free_pps_tables(pps);
+        calc_pps_params(sps, pps);
+        pps->derived_sps = sps;
     }
-    return verScan;
+    pthread_mutex_unlock(&param_set_lock);
 }
 
-/*see 6.5.6 (6-14)*/
-static scanpos *init_traverse_scan_order(int blkSize) {
-    int i = 0;
-    scanpos *travScan = malloc(sizeof(scanpos) * blkSize * blkSize);
+/* see 7.3.6.3, the weights and offsets of every reference index go to the
+ * tables of the slice with their defaults for the ones not sent
+ */
+static void
+parse_pred_weight_table(struct bits_vec *v, struct sps *sps,
+                        struct slice_segment_header *slice)
+{
+    int high_precision = sps->sps_range_ext.high_precision_offsets_enabled_flag;
+    int shiftY = high_precision ? 0 : sps->BitDepthY - 8;
+    int shiftC = high_precision ? 0 : sps->BitDepthC - 8;
+    int half = 1 << (high_precision ? sps->BitDepthC - 1 : 7);
 
-    for (int y = 0; y < blkSize; y++) {
-        if (y % 2 == 0) {
-            for (int x = 0; x < blkSize; x++) {
-                travScan[i].x = x;
-                travScan[i].y = y;
-                i++;
-            }
-        } else {
-            for (int x = blkSize - 1; x >= 0; x--) {
-                travScan[i].x = x;
-                travScan[i].y = y;
-                i++;
+    slice->luma_log2_weight_denom = GOL_UE(v);
+    if (slice->luma_log2_weight_denom > 7) {
+        VERR(hevc, "luma_log2_weight_denom %d", slice->luma_log2_weight_denom);
+        slice->luma_log2_weight_denom = 7;
+    }
+    slice->ChromaLog2WeightDenom = slice->luma_log2_weight_denom;
+    if (sps->ChromaArrayType != 0) {
+        slice->ChromaLog2WeightDenom = clip3(0, 7, slice->luma_log2_weight_denom + GOL_SE(v));
+    }
+    int num_lists = (slice->slice_type == SLICE_TYPE_B) ? 2 : 1;
+    for (int l = 0; l < num_lists; l++) {
+        int num = MIN((l ? slice->num_ref_idx_l1_active_minus1 : slice->num_ref_idx_l0_active_minus1) + 1, 16);
+        uint8_t luma_weight_flag[16] = {0};
+        uint8_t chroma_weight_flag[16] = {0};
+        // the flags of pictures with the poc of the current one are not
+        // sent for multi-layer streams only, which are not decoded here
+        for (int i = 0; i < num; i++) {
+            luma_weight_flag[i] = READ_BIT(v);
+        }
+        if (sps->ChromaArrayType != 0) {
+            for (int i = 0; i < num; i++) {
+                chroma_weight_flag[i] = READ_BIT(v);
+            }
+        }
+        for (int i = 0; i < num; i++) {
+            /* (7-56) */
+            slice->LumaWeight[l][i] = 1 << slice->luma_log2_weight_denom;
+            slice->LumaOffset[l][i] = 0;
+            if (luma_weight_flag[i]) {
+                slice->LumaWeight[l][i] += GOL_SE(v);
+                slice->LumaOffset[l][i] = GOL_SE(v) * (1 << shiftY);
+            }
+            for (int j = 0; j < 2; j++) {
+                slice->ChromaWeight[l][i][j] = 1 << slice->ChromaLog2WeightDenom;
+                slice->ChromaOffset[l][i][j] = 0;
+                if (chroma_weight_flag[i]) {
+                    slice->ChromaWeight[l][i][j] += GOL_SE(v);
+                    int delta_chroma_offset = GOL_SE(v);
+                    /* (7-58) */
+                    int off = clip3(-half, half - 1,
+                                    (half + delta_chroma_offset) -
+                                        ((half * slice->ChromaWeight[l][i][j]) >>
+                                         slice->ChromaLog2WeightDenom));
+                    slice->ChromaOffset[l][i][j] = off * (1 << shiftC);
+                }
             }
         }
     }
-    return travScan;
 }
 
-//see I.7.3.6.1
+/* a dependent slice segment shares what it took over from the independent
+ * one, only its own entry points are freed then
+ */
+static void
+free_slice_segment_header(struct slice_segment_header *slice)
+{
+    if (!slice) {
+        return;
+    }
+    free(slice->entry_point_offset);
+    if (!slice->dependent_slice_segment_flag) {
+        free(slice->st);
+        free(slice->PocLsbLt);
+        free(slice->UsedByCurrPicLt);
+        free(slice->terms);
+        free(slice->DeltaPocMsbCycleLt);
+        free(slice->inter_layer_pred_layer_idc);
+        free(slice->list_entry_l0);
+        free(slice->list_entry_l1);
+    }
+    free(slice);
+}
+
+/* see I.7.3.6.1, prev is the header of the last independent slice segment,
+ * a dependent one takes over everything from it
+ */
 static struct slice_segment_header *
 parse_slice_segment_header(struct bits_vec *v, struct hevc_nalu_header *headr,
-        struct hevc_param_set * hps, uint32_t *SliceAddrRs)
+        struct hevc_param_set * hps, const struct slice_segment_header *prev)
 {
     struct slice_segment_header *slice = calloc(1, sizeof(*slice));
 
-    static int slice_idx = 0;
+    static _Thread_local int slice_idx = 0;
     slice->idx = slice_idx++;
 
-    //init ScanOrder table
-    for (int log2blocksize = 0; log2blocksize < 6; log2blocksize++) {
-        if (log2blocksize >= 0 && log2blocksize < 6) {
-            if (log2blocksize < 4) {
-                slice->ScanOrder[log2blocksize][0] =
-                    init_up_right_scan_order(1 << log2blocksize);
-                slice->ScanOrder[log2blocksize][1] =
-                    init_horizontal_scan_order(1 << log2blocksize);
-                slice->ScanOrder[log2blocksize][2] =
-                    init_vertical_scan_order(1 << log2blocksize);
-            }
-            if (log2blocksize >= 2) {
-                slice->ScanOrder[log2blocksize][3] =
-                    init_traverse_scan_order(1 << log2blocksize);
-            }
-        }
-    }
+    pthread_once(&scan_order_once, init_scan_order);
 
     // the first VCL NAL unit of the coded picture shall have first_slice_segment_in_pic_flag = 1 
     uint8_t first_slice_segment_in_pic_flag = READ_BIT(v);
+    slice->first_slice_segment_in_pic_flag = first_slice_segment_in_pic_flag;
     if (headr->nal_unit_type >= BLA_W_LP && headr->nal_unit_type <= RSV_IRAP_VCL23) {
         slice->no_output_of_prior_pics_flag = READ_BIT(v);
     }
@@ -2698,8 +2942,7 @@ parse_slice_segment_header(struct bits_vec *v, struct hevc_nalu_header *headr,
     VDBG(hevc, "slice_pic_parameter_set_id %d", slice->slice_pic_parameter_set_id);
     VDBG(hevc, "no_output_of_prior_pics_flag %d", slice->no_output_of_prior_pics_flag);
 
-    calc_sps_params(sps);
-    calc_pps_params(sps, pps);
+    activate_param_sets(sps, pps);
     //see 7-36
     slice->Log2MinCuQpDeltaSize = sps->CtbLog2SizeY - pps->diff_cu_qp_delta_depth;
     //see 7-39
@@ -2726,11 +2969,26 @@ parse_slice_segment_header(struct bits_vec *v, struct hevc_nalu_header *headr,
          pps->dependent_slice_segments_enabled_flag,
          slice->dependent_slice_segment_flag);
     if (slice->dependent_slice_segment_flag) {
-        *SliceAddrRs = pps->CtbAddrTsToRs[pps->CtbAddrRsToTs[slice->slice_segment_address] - 1];
+        if (!prev || prev->slice_pic_parameter_set_id != slice->slice_pic_parameter_set_id) {
+            VERR(hevc, "dependent slice segment without an independent one");
+            free(slice);
+            return NULL;
+        }
+        //see 7.4.7.1 dependent_slice_segment_flag
+        int idx = slice->idx;
+        uint32_t slice_segment_address = slice->slice_segment_address;
+        memcpy(slice, prev, sizeof(*slice));
+        slice->idx = idx;
+        slice->first_slice_segment_in_pic_flag = 0;
+        slice->dependent_slice_segment_flag = 1;
+        slice->slice_segment_address = slice_segment_address;
+        slice->entry_point_offset = NULL;
+        slice->num_entry_point_offsets = 0;
+        slice->CuQpDeltaVal = 0;
     }
     if (!slice->dependent_slice_segment_flag) {
         //see 7.4.7.1 dependent_slice_segment_flag
-        *SliceAddrRs = slice->slice_segment_address;
+        slice->SliceAddrRs = slice->slice_segment_address;
         //FIXME
         // //see I.7.3.6.1
         // int i = 0;
@@ -2754,8 +3012,11 @@ parse_slice_segment_header(struct bits_vec *v, struct hevc_nalu_header *headr,
         slice->slice_type = GOL_UE(v);
         VDBG(hevc, "slice_type %d, nal_type %d", slice->slice_type, headr->nal_unit_type);
 
-        //make an assumation here, cause we have pic only
-        assert(slice->slice_type == SLICE_TYPE_I);
+        if (slice->slice_type > SLICE_TYPE_I) {
+            VERR(hevc, "slice_type %d", slice->slice_type);
+            free(slice);
+            return NULL;
+        }
         if (pps->output_flag_present_flag) {
             slice->pic_output_flag = READ_BIT(v);
         } else {
@@ -2776,7 +3037,9 @@ parse_slice_segment_header(struct bits_vec *v, struct hevc_nalu_header *headr,
             slice->short_term_ref_pic_set_sps_flag = READ_BIT(v);
             if (!slice->short_term_ref_pic_set_sps_flag) {
                 slice->st = calloc(1, sizeof(struct st_ref_pic_set));
-                parse_st_ref_set(v, slice->st, sps->num_short_term_ref_pic_sets, sps->num_short_term_ref_pic_sets);
+                parse_st_ref_set(v, sps->sps_st_ref, slice->st,
+                                 sps->num_short_term_ref_pic_sets,
+                                 sps->num_short_term_ref_pic_sets);
             } else if (sps->num_short_term_ref_pic_sets > 1) {
                 slice->short_term_ref_pic_set_idx = READ_BITS(v, log2ceil(sps->num_short_term_ref_pic_sets));
             }
@@ -2792,10 +3055,11 @@ parse_slice_segment_header(struct bits_vec *v, struct hevc_nalu_header *headr,
                     slice->num_long_term_sps = GOL_UE(v);
                 }
                 slice->num_long_term_pics = GOL_UE(v);
-                slice->PocLsbLt = calloc(MAX(sps->num_long_term_ref_pics_sps, slice->num_long_term_sps + slice->num_long_term_pics), 1);
-                slice->UsedByCurrPicLt = calloc(MAX(sps->num_long_term_ref_pics_sps, slice->num_long_term_sps + slice->num_long_term_pics), 1);
-                slice->terms = calloc((slice->num_long_term_sps + slice->num_long_term_pics), sizeof(struct slice_long_term));
-                slice->DeltaPocMsbCycleLt = calloc(slice->num_long_term_sps, sizeof(int));
+                int num_lt = slice->num_long_term_sps + slice->num_long_term_pics;
+                slice->PocLsbLt = calloc(num_lt + 1, sizeof(uint16_t));
+                slice->UsedByCurrPicLt = calloc(num_lt + 1, 1);
+                slice->terms = calloc(num_lt + 1, sizeof(struct slice_long_term));
+                slice->DeltaPocMsbCycleLt = calloc(num_lt + 1, sizeof(int));
                 VDBG(hevc, "num_long_term_sps %d, num_long_term_pics %d", slice->num_long_term_sps, slice->num_long_term_pics);
                 for (uint32_t i = 0; i < slice->num_long_term_sps + slice->num_long_term_pics; i ++) {
                     if (i < slice->num_long_term_sps) {
@@ -2830,98 +3094,18 @@ parse_slice_segment_header(struct bits_vec *v, struct hevc_nalu_header *headr,
             }
         }
 
-        struct st_ref_pic_set *st;
-        if (!slice->short_term_ref_pic_set_sps_flag) {
-            slice->st = calloc(1, sizeof(struct st_ref_pic_set));
-            st = slice->st;
-        } else {
-            st = sps->sps_st_ref + slice->short_term_ref_pic_set_idx;
-        }
-        int stRpsIdx = slice->CurrRpsIdx;
-        /*see (7-59)*/
-        int RefRpsIdx = stRpsIdx - (st->delta_idx_minus1 + 1);
-        int deltaRps = (1 - 2 * st->delta_rps_sign) *(st->abs_delta_rps_minus1 + 1);
-        if (st->inter_ref_pic_set_prediction_flag == 1) {
-            /* (7-61)*/
-            int i = 0;
-            for (int j = slice->NumPositivePics[ RefRpsIdx ] - 1; j >= 0; j--) {
-                int dPoc = slice->DeltaPocS1[ RefRpsIdx ][ j ] + deltaRps;
-                if (dPoc < 0 && st->ref_used[slice->NumNegativePics[RefRpsIdx]+j].use_delta_flag) {
-                    slice->DeltaPocS0[stRpsIdx][i] = dPoc;
-                    slice->UsedByCurrPicS0[stRpsIdx][i++] = st->ref_used[slice->NumNegativePics[RefRpsIdx] + j].used_by_curr_pic_flag;
-                }
-            }
-            if (deltaRps < 0 && st->ref_used[slice->NumDeltaPocs[RefRpsIdx]].use_delta_flag) {
-                slice->DeltaPocS0[stRpsIdx][i] = deltaRps;
-                slice->UsedByCurrPicS0[ stRpsIdx ][ i++ ] = st->ref_used[slice->NumDeltaPocs[ RefRpsIdx]].used_by_curr_pic_flag;
-            }
-            for (int j = 0; j < slice->NumNegativePics[ RefRpsIdx ]; j++ ) {
-                int dPoc = slice->DeltaPocS0[ RefRpsIdx ][ j ] + deltaRps;
-                if (dPoc < 0 && st->ref_used[j].use_delta_flag) {
-                    slice->DeltaPocS0[ stRpsIdx ][ i ] = dPoc;
-                    slice->UsedByCurrPicS0[ stRpsIdx ][ i++ ] = st->ref_used[j].used_by_curr_pic_flag;
-                }
-            }
-            slice->NumNegativePics[stRpsIdx] = i;
-            /*(7-62)*/
-            i = 0;
-            for (int j = slice->NumNegativePics[RefRpsIdx]-1; j >= 0; j--) {
-                int dPoc = slice->DeltaPocS0[RefRpsIdx][j] + deltaRps;
-                if (dPoc > 0 && st->ref_used[j].use_delta_flag) {
-                    slice->DeltaPocS1[stRpsIdx][i] = dPoc;
-                    slice->UsedByCurrPicS1[stRpsIdx][i++] = st->ref_used[j].used_by_curr_pic_flag;
-                }
-            }
-            if (deltaRps > 0 && st->ref_used[slice->NumDeltaPocs[RefRpsIdx]].use_delta_flag) {
-                slice->DeltaPocS1[ stRpsIdx ][ i ] = deltaRps;
-                slice->UsedByCurrPicS1[ stRpsIdx ][ i++ ] = st->ref_used[slice->NumDeltaPocs[RefRpsIdx]].used_by_curr_pic_flag;
-            }
-            for (int j = 0; j < slice->NumPositivePics[ RefRpsIdx ]; j++) {
-                int dPoc = slice->DeltaPocS1[ RefRpsIdx ][ j ] + deltaRps;
-                if (dPoc > 0 && st->ref_used[slice->NumNegativePics[RefRpsIdx] + j].use_delta_flag) {
-                    slice->DeltaPocS1[stRpsIdx][i] = dPoc;
-                    slice->UsedByCurrPicS1[stRpsIdx][i++] =
-                        st->ref_used[slice->NumNegativePics[ RefRpsIdx ] + j ].used_by_curr_pic_flag;
-                }
-            }
-            slice->NumPositivePics[ stRpsIdx ] = i;
-        } else {
-            /* (7-63) */
-            slice->NumNegativePics[stRpsIdx] = st->num_negative_pics;
-            /* (7-64) */
-            slice->NumPositivePics[stRpsIdx] = st->num_positive_pics;
-            /* (7-65)*/
-            for (uint32_t i = 0; i < st->num_negative_pics; i ++) {
-                slice->UsedByCurrPicS0[stRpsIdx][i] = st->used_by_curr_pic_s0_flag[i];
-                slice->UsedByCurrPicS1[stRpsIdx][i] = st->used_by_curr_pic_s1_flag[i];
-                if (i == 0) {
-                    /*(7-67)*/
-                    slice->DeltaPocS0[stRpsIdx][i] = -(st->delta_poc_s0_minus1[i] + 1);
-                    slice->DeltaPocS1[stRpsIdx][i] = st->delta_poc_s1_minus1[i] + 1; 
-                } else {
-                    slice->DeltaPocS0[stRpsIdx][i] = slice->DeltaPocS0[stRpsIdx][i - 1] - (st->delta_poc_s0_minus1[i] + 1);
-                    slice->DeltaPocS1[stRpsIdx][i] = slice->DeltaPocS1[stRpsIdx][i - 1] + (st->delta_poc_s1_minus1[i] + 1);
-                }
-            }
-            
-        }
-        /* (7-71) */
-        slice->NumDeltaPocs[stRpsIdx] = slice->NumNegativePics[stRpsIdx] + slice->NumPositivePics[stRpsIdx];
-
-        //see (7-57)
-        for (int i = 0; i < slice->NumNegativePics[slice->CurrRpsIdx]; i++ )
-            if (sps->sps_st_ref[slice->CurrRpsIdx].used_by_curr_pic_s0_flag[i]) {//TODO
-                slice->NumPicTotalCurr ++;
+        //see (7-55)
+        const struct st_ref_pic_set *st = slice_st_ref_set(sps, slice);
+        if (st) {
+            for (int i = 0; i < st->NumNegativePics; i++) {
+                slice->NumPicTotalCurr += st->UsedByCurrPicS0[i];
             }
-        for (int i = 0; i < slice->NumPositivePics[slice->CurrRpsIdx]; i++) {
-            if (sps->sps_st_ref[slice->CurrRpsIdx].used_by_curr_pic_s1_flag[i]) {
-                slice->NumPicTotalCurr ++;
+            for (int i = 0; i < st->NumPositivePics; i++) {
+                slice->NumPicTotalCurr += st->UsedByCurrPicS1[i];
             }
         }
         for (uint32_t i = 0; i < slice->num_long_term_sps + slice->num_long_term_pics; i++) {
-            if(slice->UsedByCurrPicLt[i]) {
-                slice->NumPicTotalCurr++;
-            }
+            slice->NumPicTotalCurr += slice->UsedByCurrPicLt[i];
         }
         if (pps->pps_scc_extension_flag && pps->pps_scc_ext.pps_curr_pic_ref_enabled_flag) {
             slice->NumPicTotalCurr++;
@@ -3020,6 +3204,15 @@ parse_slice_segment_header(struct bits_vec *v, struct hevc_nalu_header *headr,
                 slice->num_ref_idx_l0_active_minus1 = pps->num_ref_idx_l0_default_active_minus1;
                 slice->num_ref_idx_l1_active_minus1 = pps->num_ref_idx_l1_default_active_minus1;
             }
+            // see 7.4.7.1, at most 15 of them, the lists hold 16
+            if (slice->num_ref_idx_l0_active_minus1 > 14 ||
+                slice->num_ref_idx_l1_active_minus1 > 14) {
+                VERR(hevc, "num_ref_idx_active_minus1 %d %d out of range",
+                     slice->num_ref_idx_l0_active_minus1,
+                     slice->num_ref_idx_l1_active_minus1);
+                slice->num_ref_idx_l0_active_minus1 = MIN(slice->num_ref_idx_l0_active_minus1, 14u);
+                slice->num_ref_idx_l1_active_minus1 = MIN(slice->num_ref_idx_l1_active_minus1, 14u);
+            }
 
             VDBG(hevc, "lists_modification_present_flag %d", pps->lists_modification_present_flag);
             VDBG(hevc, "NumPicTotalCurr %d", slice->NumPicTotalCurr);
@@ -3036,15 +3229,13 @@ parse_slice_segment_header(struct bits_vec *v, struct hevc_nalu_header *headr,
             VDBG(hevc, "cabac_init_present_flag %d, cabac_init_flag %d", pps->cabac_init_present_flag, slice->cabac_init_flag);
 
             VDBG(hevc, "slice_temporal_mvp_enabled_flag %d", slice->slice_temporal_mvp_enabled_flag);
+            slice->collocated_from_l0_flag = 1;
             if (slice->slice_temporal_mvp_enabled_flag) {
-                uint8_t collocated_from_l0_flag = 0;
                 if (slice->slice_type == SLICE_TYPE_B) {
-                    collocated_from_l0_flag = READ_BIT(v);
-                } else {
-                    collocated_from_l0_flag = 1;
+                    slice->collocated_from_l0_flag = READ_BIT(v);
                 }
-                if ((collocated_from_l0_flag && slice->num_ref_idx_l0_active_minus1 > 0) ||
-                    (!collocated_from_l0_flag && slice->num_ref_idx_l1_active_minus1 > 0)) {
+                if ((slice->collocated_from_l0_flag && slice->num_ref_idx_l0_active_minus1 > 0) ||
+                    (!slice->collocated_from_l0_flag && slice->num_ref_idx_l1_active_minus1 > 0)) {
                     slice->collocated_ref_idx = GOL_UE(v);
                 }
             }
@@ -3054,9 +3245,7 @@ parse_slice_segment_header(struct bits_vec *v, struct hevc_nalu_header *headr,
             VDBG(hevc, "NumRefListLayers %d", vps->NumRefListLayers[headr->nuh_layer_id]);
             if ((pps->weighted_pred_flag && slice->slice_type == SLICE_TYPE_P) ||
                 (pps->weighted_bipred_flag && slice->slice_type == SLICE_TYPE_B)) {
-                    printf("need pred_weight_table\n");
-                    assert(0);
-                // parse_pred_weight_table();
+                parse_pred_weight_table(v, sps, slice);
             } else if (!DepthFlag && vps->NumRefListLayers[headr->nuh_layer_id] > 0) {
                 slice->slice_ic_enabled_flag = READ_BIT(v);
                 if (slice->slice_ic_enabled_flag) {
@@ -3065,6 +3254,11 @@ parse_slice_segment_header(struct bits_vec *v, struct hevc_nalu_header *headr,
             }
             slice->five_minus_max_num_merge_cand = GOL_UE(v);
             VDBG(hevc, "five_minus_max_num_merge_cand %d", slice->five_minus_max_num_merge_cand);
+            if (slice->five_minus_max_num_merge_cand > 4) {
+                VERR(hevc, "five_minus_max_num_merge_cand %d out of range",
+                     slice->five_minus_max_num_merge_cand);
+                slice->five_minus_max_num_merge_cand = 4;
+            }
 
             if (sps->sps_scc_ext.motion_vector_resolution_control_idc == 2) {
                 slice->use_integer_mv_flag = READ_BIT(v);
@@ -3102,20 +3296,22 @@ parse_slice_segment_header(struct bits_vec *v, struct hevc_nalu_header *headr,
         if (pps->deblocking_filter_override_enabled_flag) {
             deblocking_filter_override_flag = READ_BIT(v);
         }
-        uint8_t slice_deblocking_filter_disabled_flag = 0;
+        // see 7.4.7.1, inferred from the pps when not present
+        slice->slice_beta_offset_div2 = pps->pps_beta_offset_div2;
+        slice->slice_tc_offset_div2 = pps->pps_tc_offset_div2;
         if (deblocking_filter_override_flag) {
-            slice_deblocking_filter_disabled_flag = READ_BIT(v);
-            if (!slice_deblocking_filter_disabled_flag) {
+            slice->slice_deblocking_filter_disabled_flag = READ_BIT(v);
+            if (!slice->slice_deblocking_filter_disabled_flag) {
                 slice->slice_beta_offset_div2 = GOL_SE(v);
                 slice->slice_tc_offset_div2 = GOL_SE(v);
             }
         } else {
-            slice_deblocking_filter_disabled_flag = pps->pps_deblocking_filter_disabled_flag;
+            slice->slice_deblocking_filter_disabled_flag = pps->pps_deblocking_filter_disabled_flag;
         }
-        VDBG(hevc, "slice_deblocking_filter_disabled_flag %d", slice_deblocking_filter_disabled_flag);
+        VDBG(hevc, "slice_deblocking_filter_disabled_flag %d", slice->slice_deblocking_filter_disabled_flag);
         if (pps->pps_loop_filter_across_slices_enabled_flag &&
                 (slice->slice_sao_luma_flag || slice->slice_sao_chroma_flag ||
-                !slice_deblocking_filter_disabled_flag )) {
+                !slice->slice_deblocking_filter_disabled_flag )) {
             slice->slice_loop_filter_across_slices_enabled_flag = READ_BIT(v);
         } else {
             slice->slice_loop_filter_across_slices_enabled_flag = pps->pps_loop_filter_across_slices_enabled_flag;
@@ -3379,7 +3575,7 @@ static struct sao *parse_sao(cabac_dec *d, struct sps *sps, struct pps *pps,
                 VDBG(hevc, "cIdx %d, SaoTypeIdx %d", cIdx, sao->SaoTypeIdx[cIdx]);
                 if (sao->SaoTypeIdx[cIdx] != 0 ) {
                     for (int i = 0; i < 4; i++) {
-                        int bitdepth = ((i == 0) ? (sps->BitDepthY) : (sps->BitDepthC));
+                        int bitdepth = ((cIdx == 0) ? (sps->BitDepthY) : (sps->BitDepthC));
                         int cMax = (1 << (MIN(bitdepth, 10) - 5)) - 1;
                         sao_offset_abs[cIdx][i] = CABAC_TR(d, CTX_TYPE_ALL_BYPASS, cMax, 0, NULL);
                         VDBG(hevc, "cMax %d, sao_offset_abs[%d][%d][%d][%d] %d", cMax,
@@ -3408,11 +3604,7 @@ static struct sao *parse_sao(cabac_dec *d, struct sps *sps, struct pps *pps,
                         VDBG(hevc, "sao_eo_class_luma %d, sao_eo_class_chroma %d",
                              sao->SaoEoClass[0], sao->SaoEoClass[1]);
                         for (int i = 0; i < 4; i++ ) {
-                            if (i == 0|| i == 1) {
-                                sao_offset_sign[cIdx][i] = 0;
-                            } {
-                                sao_offset_sign[cIdx][i] = 1;
-                            }
+                            sao_offset_sign[cIdx][i] = (i >= 2);
                         }
                         sao->sao_band_position[cIdx] = 0;
                     }
@@ -3420,7 +3612,8 @@ static struct sao *parse_sao(cabac_dec *d, struct sps *sps, struct pps *pps,
                     //see 7-72
                     sao->saoOffsetVal[cIdx][0] = 0;
                     for (int i = 0; i < 4; i ++) {
-                        sao->saoOffsetVal[cIdx][i+1] = (1 - 2 * sao_offset_sign[cIdx][i]) * sao_offset_sign[cIdx][i] << log2OffsetScale;
+                        sao->saoOffsetVal[cIdx][i+1] = (1 - 2 * sao_offset_sign[cIdx][i]) *
+                            (sao_offset_abs[cIdx][i] << log2OffsetScale);
                     }
                 }
             }
@@ -3539,10 +3732,11 @@ process_zscan_order_block_availablity(struct slice_segment_header *slice,
     int addrRsN = (xNbY >> sps->CtbLog2SizeY) + (yNbY >> sps->CtbLog2SizeY) * sps->PicWidthInCtbsY;
     // VDBG(hevc, "CtbLog2SizeY %d (%d, %d) addrRsCurr %d, (%d, %d) addrRsN %d",
     //      sps->CtbLog2SizeY, xCurr, yCurr, addrRsCurr, xNbY, yNbY, addrRsN);
-    // FIXME for more then one slice, should compare SliceAddrRs
-    //  if (addrRsCurr != addrRsN) {
-    //      return false
-    //  }
+    // slices are contiguous in tile scan, so one that started after the
+    // neighbour is a different one
+    if (pps->CtbAddrRsToTs[addrRsN] < pps->CtbAddrRsToTs[slice->SliceAddrRs]) {
+        return false;
+    }
 
     if (pps->TileId[pps->CtbAddrRsToTs[addrRsCurr]] !=
             pps->TileId[pps->CtbAddrRsToTs[addrRsN]]) {
@@ -3555,121 +3749,211 @@ process_zscan_order_block_availablity(struct slice_segment_header *slice,
 
 static uint8_t get_split_transform_flag(struct sps *sps, struct picture *p,
                                         int xTb, int yTb, int trafoDepth) {
-    int PicWidthInTbsY = sps->PicWidthInCtbsY
-                         << (sps->CtbLog2SizeY - sps->MinTbLog2SizeY);
-    // int PicHeightInTbsY = sps->PicHeightInCtbsY
-    //                       << (sps->CtbLog2SizeY - sps->MinTbLog2SizeY);
-
     return p->split_transform_flag[(xTb >> sps->MinTbLog2SizeY) +
-                                   (yTb >> sps->MinTbLog2SizeY) *
-                                       PicWidthInTbsY] &
-           (1 << trafoDepth);
+                                   (yTb >> sps->MinTbLog2SizeY) * p->nb_stride] >>
+               trafoDepth & 1;
 }
 
 static void set_split_transform_flag(struct sps *sps, struct picture *p,
                                      int xTb, int yTb, int trafoDepth,
                                      int split_transform_flag) {
-    int PicWidthInTbsY = sps->PicWidthInCtbsY
-                         << (sps->CtbLog2SizeY - sps->MinTbLog2SizeY);
-    // int PicHeightInTbsY = sps->PicHeightInCtbsY
-    //                       << (sps->CtbLog2SizeY - sps->MinTbLog2SizeY);
     p->split_transform_flag[(xTb >> sps->MinTbLog2SizeY) +
-                            (yTb >> sps->MinTbLog2SizeY) * PicWidthInTbsY] |=
+                            (yTb >> sps->MinTbLog2SizeY) * p->nb_stride] |=
         (split_transform_flag << trafoDepth);
 }
 
-static inline struct cu_info *get_cu_info(struct sps *sps,
-                                          struct picture *p, int x, int y) {
-    return &p->info[(x >> sps->MinCbLog2SizeY) +
-                    (y >> sps->MinCbLog2SizeY) * sps->PicWidthInMinCbsY];
+/* n x n units of a plane from (x, y), a row at a time */
+static inline void
+fill_plane(uint8_t *plane, int stride, int x, int y, int n, uint8_t v)
+{
+    plane += x + y * stride;
+    for (int j = 0; j < n; j++, plane += stride) {
+        memset(plane, v, n);
+    }
 }
 
-#define set_cu_info(sps, p, x0, y0, log2CbSize, name, value) \
-{ \
-    int CbSize = 1 << (log2CbSize - sps->MinCbLog2SizeY); \
-    int CuIdx = (x0 >> sps->MinCbLog2SizeY) + \
-                (y0 >> sps->MinCbLog2SizeY) * sps->PicWidthInMinCbsY; \
-    for (int y = 0; y < CbSize; y++) { \
-        for (int x = 0; x < CbSize; x++) { \
-            p->info[CuIdx + x + y * sps->PicWidthInMinCbsY].name = value; \
-        } \
-    } \
+#define CB_IDX(sps, p, x, y) \
+    (((x) >> (sps)->MinCbLog2SizeY) + ((y) >> (sps)->MinCbLog2SizeY) * (p)->cb_stride)
+
+#define set_cu_plane(sps, p, x0, y0, log2CbSize, name, value) \
+    fill_plane((uint8_t *)(p)->name, (p)->cb_stride, \
+               (x0) >> (sps)->MinCbLog2SizeY, (y0) >> (sps)->MinCbLog2SizeY, \
+               1 << ((log2CbSize) - (sps)->MinCbLog2SizeY), (uint8_t)(value))
+
+/* the fields of a cu known once its prediction mode is parsed, in one pass
+ * over its min cbs
+ */
+static void set_cu_info(struct sps *sps, struct picture *p, int x0, int y0,
+                        int log2CbSize, int ctDepth, int CuPredMode,
+                        int cu_transquant_bypass_flag) {
+    int n = 1 << (log2CbSize - sps->MinCbLog2SizeY);
+    int idx = CB_IDX(sps, p, x0, y0);
+    for (int j = 0; j < n; j++, idx += p->cb_stride) {
+        memset(p->ctDepth + idx, ctDepth, n);
+        memset(p->CuPredMode + idx, CuPredMode, n);
+        memset(p->cu_transquant_bypass_flag + idx, cu_transquant_bypass_flag, n);
+    }
 }
 
 static uint8_t get_CuPredMode(struct sps *sps,
                               struct picture *p, int x, int y) {
-    return get_cu_info(sps, p, x, y)->CuPredMode;
+    return p->CuPredMode[CB_IDX(sps, p, x, y)];
+}
+
+static void set_nb_map(struct pps *pps, struct sps *sps, struct picture *p,
+                       int x0, int y0, int log2CbSize, int CuPredMode) {
+    int n = 1 << (log2CbSize - sps->MinTbLog2SizeY);
+    int xTb = x0 >> sps->MinTbLog2SizeY;
+    int yTb = y0 >> sps->MinTbLog2SizeY;
+    for (int y = yTb; y < yTb + n; y++) {
+        for (int x = xTb; x < xTb + n; x++) {
+            p->nb_map[x + y * p->nb_stride] =
+                ((pps->MinTbAddrZs[x][y] + 1) << 1) | (CuPredMode == MODE_INTRA);
+        }
+    }
 }
 
-static void set_CuPredMode(struct sps *sps, struct picture *p, int x0, int y0,
-                           int log2CbSize, int CuPredMode) {
-    set_cu_info(sps, p, x0, y0, log2CbSize, CuPredMode, CuPredMode);
+/* 6.4.1 for the reference samples of 8.4.4.2.1, cur is the map entry of the
+ * current tb, tile its TileId and slice_ts the tile scan address the slice
+ * starts at. It is the same for all samples of a min tb, and also says no to
+ * inter neighbours with constrained_intra_pred_flag.
+ */
+static inline bool
+nb_available(struct pps *pps, struct sps *sps, struct picture *p, uint32_t cur,
+             int tile, int slice_ts, int xNbY, int yNbY)
+{
+    if (xNbY < 0 || yNbY < 0 || xNbY >= (int)sps->pic_width_in_luma_samples ||
+        yNbY >= (int)sps->pic_height_in_luma_samples) {
+        return false;
+    }
+    uint32_t m = p->nb_map[(xNbY >> sps->MinTbLog2SizeY) +
+                           (yNbY >> sps->MinTbLog2SizeY) * p->nb_stride];
+    if (m == 0 || (m >> 1) > (cur >> 1) ||
+        (pps->constrained_intra_pred_flag && !(m & 1))) {
+        return false;
+    }
+    int addrRsN = (xNbY >> sps->CtbLog2SizeY) +
+                  (yNbY >> sps->CtbLog2SizeY) * sps->PicWidthInCtbsY;
+    int ts = pps->CtbAddrRsToTs[addrRsN];
+    return ts >= slice_ts && pps->TileId[ts] == tile;
 }
 static uint8_t get_pcm_flag(struct sps *sps, struct picture *p, int x, int y) {
-    return get_cu_info(sps, p, x, y)->pcm_flag;
+    return p->pcm_flag[CB_IDX(sps, p, x, y)];
 }
 
 static void set_pcm_flag(struct sps *sps, struct picture *p, int x0, int y0,
                          int log2CbSize, int pcm_flag) {
-    set_cu_info(sps, p, x0, y0, log2CbSize, pcm_flag, pcm_flag);
+    set_cu_plane(sps, p, x0, y0, log2CbSize, pcm_flag, pcm_flag);
 }
 
 static uint8_t get_ctDepth(struct sps *sps, struct picture *p, int x, int y) {
-    return get_cu_info(sps, p, x, y)->ctDepth;
+    return p->ctDepth[CB_IDX(sps, p, x, y)];
 }
 
-static void set_ctDepth(struct sps *sps, struct picture *p, int x0, int y0,
-                        int log2CbSize, int ctDepth) {
-    set_cu_info(sps, p, x0, y0, log2CbSize, ctDepth, ctDepth);
-}
 static uint8_t get_cu_transquant_bypass_flag(struct sps *sps,
                                              struct picture *p, int x, int y) {
-    return get_cu_info(sps, p, x, y)->cu_transquant_bypass_flag;
-}
-
-static void set_cu_transquant_bypass_flag(struct sps *sps, struct picture *p,
-                                          int x0, int y0, int log2CbSize,
-                                          int cu_transquant_bypass_flag) {
-    set_cu_info(sps, p, x0, y0, log2CbSize, cu_transquant_bypass_flag,
-                cu_transquant_bypass_flag);
+    return p->cu_transquant_bypass_flag[CB_IDX(sps, p, x, y)];
 }
 
-static uint8_t get_qpy(struct sps *sps, struct picture *p, int x, int y) {
-    return get_cu_info(sps, p, x, y)->qpy;
+static int get_qpy(struct sps *sps, struct picture *p, int x, int y) {
+    return p->qpy[CB_IDX(sps, p, x, y)];
 }
 
 static void set_qpy(struct sps *sps, struct picture *p, int x0, int y0,
                     int log2CbSize, int qpy) {
-    set_cu_info(sps, p, x0, y0, log2CbSize, qpy, qpy);
+    set_cu_plane(sps, p, x0, y0, log2CbSize, qpy, qpy);
+}
+
+// bits of picture->deblock, the edges are the left and the top one of a 4x4
+#define DBK_TU_VER 0x1  // transform or coding block edge
+#define DBK_TU_HOR 0x2
+#define DBK_PU_VER 0x4  // prediction block edge
+#define DBK_PU_HOR 0x8
+#define DBK_CODED 0x10  // in a luma transform block with non-zero coefficients
+
+// see 8.7.2.3, filterEdgeFlag for the edge between (xp, yp) and (xq, yq)
+static bool deblock_edge_allowed(struct slice_segment_header *slice,
+                                 struct pps *pps, struct sps *sps,
+                                 struct picture *p, int xq, int yq, int xp,
+                                 int yp) {
+    if (xp < 0 || yp < 0) {
+        return false;
+    }
+    int rxq = xq >> sps->CtbLog2SizeY, ryq = yq >> sps->CtbLog2SizeY;
+    int rxp = xp >> sps->CtbLog2SizeY, ryp = yp >> sps->CtbLog2SizeY;
+    if (rxq == rxp && ryq == ryp) {
+        return true;
+    }
+    struct ctu *cq = get_ctu(sps, p, rxq, ryq);
+    struct ctu *cp = get_ctu(sps, p, rxp, ryp);
+    if (!cp) {
+        // not decoded in this picture
+        return false;
+    }
+    if (cp->SliceAddrRs != cq->SliceAddrRs &&
+        !slice->slice_loop_filter_across_slices_enabled_flag) {
+        return false;
+    }
+    if (!pps->loop_filter_across_tiles_enabled_flag &&
+        pps->TileId[cp->CtbAddrInTs] != pps->TileId[cq->CtbAddrInTs]) {
+        return false;
+    }
+    return true;
+}
+
+// record the left and top edge of a transform or coding block for deblocking
+static void deblock_mark_tb(struct slice_segment_header *slice,
+                            struct pps *pps, struct sps *sps,
+                            struct picture *p, int x0, int y0, int log2Size,
+                            int coded) {
+    int n = 1 << (log2Size - 2);
+    uint8_t *m = p->deblock + (y0 >> 2) * p->deblock_stride + (x0 >> 2);
+    if (coded) {
+        for (int j = 0; j < n; j++) {
+            for (int i = 0; i < n; i++) {
+                m[j * p->deblock_stride + i] |= DBK_CODED;
+            }
+        }
+    }
+    if (slice->slice_deblocking_filter_disabled_flag) {
+        return;
+    }
+    // only the edges on the 8x8 grid are filtered
+    if ((x0 & 7) == 0 &&
+        deblock_edge_allowed(slice, pps, sps, p, x0, y0, x0 - 1, y0)) {
+        for (int j = 0; j < n; j++) {
+            m[j * p->deblock_stride] |= DBK_TU_VER;
+        }
+    }
+    if ((y0 & 7) == 0 &&
+        deblock_edge_allowed(slice, pps, sps, p, x0, y0, x0, y0 - 1)) {
+        for (int i = 0; i < n; i++) {
+            m[i] |= DBK_TU_HOR;
+        }
+    }
 }
 
+#define PU_IDX(sps, p, x, y) \
+    (((x) >> ((sps)->MinCbLog2SizeY - 1)) + \
+     ((y) >> ((sps)->MinCbLog2SizeY - 1)) * (p)->pu_stride)
+
 static uint8_t get_IntraPredModeY(struct sps *sps, struct picture *p, int x,
                                   int y) {
-    int Log2MinPUSize = sps->MinCbLog2SizeY - 1;
-    int PicWidthInMinPUs = sps->PicWidthInCtbsY << (sps->CtbLog2SizeY - Log2MinPUSize);
-    return p->IntraPredModeY[(x >> Log2MinPUSize) + (y >> Log2MinPUSize) * PicWidthInMinPUs];
+    return p->IntraPredModeY[PU_IDX(sps, p, x, y)];
 }
 
 static void set_IntraPredModeY(struct sps *sps, int log2PbSize,
                                struct picture *p, int x0, int y0,
                                int IntraPredModeY) {
     int Log2MinPUSize = sps->MinCbLog2SizeY - 1;
-    int PbSize = 1 << (log2PbSize - Log2MinPUSize);
-    int PicWidthInMinPUs = sps->PicWidthInCtbsY << (sps->CtbLog2SizeY - Log2MinPUSize);
-    int PuIdx = (x0 >> Log2MinPUSize) + (y0 >> Log2MinPUSize) * PicWidthInMinPUs;
-    for (int y = 0; y < PbSize; y++) {
-        for (int x = 0; x < PbSize; x++) {
-            p->IntraPredModeY[PuIdx + x + y * PicWidthInMinPUs] = IntraPredModeY;
-        }
-    }
+    fill_plane(p->IntraPredModeY, p->pu_stride, x0 >> Log2MinPUSize,
+               y0 >> Log2MinPUSize, 1 << (log2PbSize - Log2MinPUSize),
+               IntraPredModeY);
 }
 
 static uint8_t get_IntraPredModeC(struct sps *sps, struct picture *p, int x,
                                   int y) {
-    int Log2MinPUSize = sps->MinCbLog2SizeY - 1;
-    int PicWidthInMinPUs = sps->PicWidthInCtbsY << (sps->CtbLog2SizeY - Log2MinPUSize);
-    uint8_t v = p->IntraPredModeC[(x >> Log2MinPUSize) + (y >> Log2MinPUSize) * PicWidthInMinPUs];
-    return v & 0x3F;
+    return p->IntraPredModeC[PU_IDX(sps, p, x, y)] & 0x3F;
 }
 
 static void set_IntraPredModeC(struct sps *sps, int log2PbSize,
@@ -3681,23 +3965,13 @@ static void set_IntraPredModeC(struct sps *sps, int log2PbSize,
         v |= 0x80;
     }
     int Log2MinPUSize = sps->MinCbLog2SizeY - 1;
-    int PbSize = 1 << (log2PbSize - Log2MinPUSize);
-    int PicWidthInMinPUs = sps->PicWidthInCtbsY << (sps->CtbLog2SizeY - Log2MinPUSize);
-    int PuIdx = (x0 >> Log2MinPUSize) + (y0 >> Log2MinPUSize) * PicWidthInMinPUs;
-    for (int y =0; y < PbSize; y++) {
-        for(int x = 0; x < PbSize; x++) {
-            p->IntraPredModeC[PuIdx + x + y * PicWidthInMinPUs] = v;
-        }
-    }
+    fill_plane(p->IntraPredModeC, p->pu_stride, x0 >> Log2MinPUSize,
+               y0 >> Log2MinPUSize, 1 << (log2PbSize - Log2MinPUSize), v);
 }
 
 static bool get_intra_chroma_pred_mode4(struct sps *sps, struct picture *p,
                                         int x, int y) {
-    int Log2MinPUSize = sps->MinCbLog2SizeY - 1;
-    int PicWidthInMinPUs = sps->PicWidthInCtbsY << (sps->CtbLog2SizeY - Log2MinPUSize);
-    uint8_t v = p->IntraPredModeC[(x >> Log2MinPUSize) + (y >> Log2MinPUSize) * PicWidthInMinPUs];
-
-    return  (v & 0x80) ? true: false;
+    return (p->IntraPredModeC[PU_IDX(sps, p, x, y)] & 0x80) ? true : false;
 }
 
 /* 6.4.2 */
@@ -3706,7 +3980,7 @@ static bool get_intra_chroma_pred_mode4(struct sps *sps, struct picture *p,
  * @return: the availability of the neighbouring prediction block covering the
  * location (xNbY, yNbY)
  */
-static bool UNUSED process_predication_block_availablity(
+static bool process_predication_block_availablity(
     struct slice_segment_header *slice, struct picture *p, struct hevc_param_set *hps,
     int xCb, int yCb, int nCbS, int xPb, int yPb, int nPbW,
     int nPbH, int partIdx, int xNbY, int yNbY) {
@@ -3782,7 +4056,7 @@ static void scale_transform_coefficients(struct sps *sps, struct cu *cu,
     int m = 16;
     int sizeid = log2floor(nTbS) - 2;
     assert(sizeid < 4);
-    int mid = (get_CuPredMode(sps, p, xTbY, yTbY) == MODE_INTRA) ? cIdx : cIdx - 3;
+    int mid = (get_CuPredMode(sps, p, xTbY, yTbY) == MODE_INTRA) ? cIdx : cIdx + 3;
     if (sps->scaling_list_enabled_flag == 0 ||
         (transform_skip_flag == 1 && nTbS > 4)) {
         for (int y = 0; y < nTbS; y++) {
@@ -3817,47 +4091,6 @@ static void scale_transform_coefficients(struct sps *sps, struct cu *cu,
 
 // see 8.6.4.2
 static void transformation(int nTbS, int trType, int16_t *x, int *y) {
-    const int8_t transMatrix[4][4] = {
-        {29, 55, 74, 84},
-        {74, 74, 0, -74},
-        {84, -29, -74, 55},
-        {55, -84, 74, -29}
-    };
-    const int8_t transMatrixCol[32][32] = {
-        {64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,  64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64},
-        {90, 90, 88, 85, 82, 78, 73, 67, 61, 54, 46, 38, 31, 22, 13,  4,  -4,-13,-22,-31,-38,-46,-54,-61,-67,-73,-78,-82,-85,-88,-90,-90},
-        {90, 87, 80, 70, 57, 43, 25,  9, -9,-25,-43,-57,-70,-80,-87,-90,  -90,-87,-80,-70,-57,-43,-25, -9,  9, 25, 43, 57, 70, 80, 87, 90},
-        {90, 82, 67, 46, 22, -4,-31,-54,-73,-85,-90,-88,-78,-61,-38,-13,  13, 38, 61, 78, 88, 90, 85, 73, 54, 31,  4,-22,-46,-67,-82,-90},
-        {89, 75, 50, 18,-18,-50,-75,-89,-89,-75,-50,-18, 18, 50, 75, 89,  89, 75, 50, 18,-18,-50,-75,-89,-89,-75,-50,-18, 18, 50, 75, 89},
-        {88, 67, 31,-13,-54,-82,-90,-78,-46, -4, 38, 73, 90, 85, 61, 22,  -22,-61,-85,-90,-73,-38,  4, 46, 78, 90, 82, 54, 13,-31,-67,-88},
-        {87, 57,  9,-43,-80,-90,-70,-25, 25, 70, 90, 80, 43, -9,-57,-87,  -87,-57, -9, 43, 80, 90, 70, 25,-25,-70,-90,-80,-43,  9, 57, 87},
-        {85, 46,-13,-67,-90,-73,-22, 38, 82, 88, 54, -4,-61,-90,-78,-31,  31, 78, 90, 61,  4,-54,-88,-82,-38, 22, 73, 90, 67, 13,-46,-85},
-        {83, 36,-36,-83,-83,-36, 36, 83, 83, 36,-36,-83,-83,-36, 36, 83,  83, 36,-36,-83,-83,-36, 36, 83, 83, 36,-36,-83,-83,-36, 36, 83},
-        {82, 22,-54,-90,-61, 13, 78, 85, 31,-46,-90,-67,  4, 73, 88, 38,  -38,-88,-73, -4, 67, 90, 46,-31,-85,-78,-13, 61, 90, 54,-22,-82},
-        {80,  9,-70,-87,-25, 57, 90, 43,-43,-90,-57, 25, 87, 70, -9,-80, -80, -9, 70, 87, 25,-57,-90,-43, 43, 90, 57,-25,-87,-70,  9, 80},
-        {78, -4,-82,-73, 13, 85, 67,-22,-88,-61, 31, 90, 54,-38,-90,-46, 46, 90, 38,-54,-90,-31, 61, 88, 22,-67,-85,-13, 73, 82,  4,-78},
-        {75,-18,-89,-50, 50, 89, 18,-75,-75, 18, 89, 50,-50,-89,-18, 75, 75,-18,-89,-50, 50, 89, 18,-75,-75, 18, 89, 50,-50,-89,-18, 75},
-        {73,-31,-90,-22, 78, 67,-38,-90,-13, 82, 61,-46,-88, -4, 85, 54, -54,-85,  4, 88, 46,-61,-82, 13, 90, 38,-67,-78, 22, 90, 31,-73},
-        {70,-43,-87,  9, 90, 25,-80,-57, 57, 80,-25,-90, -9, 87, 43,-70, -70, 43, 87, -9,-90,-25, 80, 57,-57,-80, 25, 90,  9,-87,-43, 70},
-        {67,-54,-78, 38, 85,-22,-90,  4, 90, 13,-88,-31, 82, 46,-73,-61, 61, 73,-46,-82, 31, 88,-13,-90, -4, 90, 22,-85,-38, 78, 54,-67},
-        {64,-64,-64, 64, 64,-64,-64, 64, 64,-64,-64, 64, 64,-64,-64, 64, 64,-64,-64, 64, 64,-64,-64, 64, 64,-64,-64, 64, 64,-64,-64, 64},
-        {61,-73,-46, 82, 31,-88,-13, 90, -4,-90, 22, 85,-38,-78, 54, 67, -67,-54, 78, 38,-85,-22, 90,  4,-90, 13, 88,-31,-82, 46, 73,-61},
-        {57,-80,-25, 90, -9,-87, 43, 70,-70,-43, 87,  9,-90, 25, 80,-57, -57, 80, 25,-90,  9, 87,-43,-70, 70, 43,-87, -9, 90,-25,-80, 57},
-        {54,-85, -4, 88,-46,-61, 82, 13,-90, 38, 67,-78,-22, 90,-31,-73, 73, 31,-90, 22, 78,-67,-38, 90,-13,-82, 61, 46,-88,  4, 85,-54},
-        {50,-89, 18, 75,-75,-18, 89,-50,-50, 89,-18,-75, 75, 18,-89, 50, 50,-89, 18, 75,-75,-18, 89,-50,-50, 89,-18,-75, 75, 18,-89, 50},
-        {46,-90, 38, 54,-90, 31, 61,-88, 22, 67,-85, 13, 73,-82,  4, 78, -78, -4, 82,-73,-13, 85,-67,-22, 88,-61,-31, 90,-54,-38, 90,-46},
-        {43,-90, 57, 25,-87, 70,  9,-80, 80, -9,-70, 87,-25,-57, 90,-43, -43, 90,-57,-25, 87,-70, -9, 80,-80,  9, 70,-87, 25, 57,-90, 43},
-        {38,-88, 73, -4,-67, 90,-46,-31, 85,-78, 13, 61,-90, 54, 22,-82, 82,-22,-54, 90,-61,-13, 78,-85, 31, 46,-90, 67,  4,-73, 88,-38},
-        {36,-83, 83,-36,-36, 83,-83, 36, 36,-83, 83,-36,-36, 83,-83, 36, 36,-83, 83,-36,-36, 83,-83, 36, 36,-83, 83,-36,-36, 83,-83, 36},
-        {31,-78, 90,-61,  4, 54,-88, 82,-38,-22, 73,-90, 67,-13,-46, 85, -85, 46, 13,-67, 90,-73, 22, 38,-82, 88,-54, -4, 61,-90, 78,-31},
-        {25,-70, 90,-80, 43,  9,-57, 87,-87, 57, -9,-43, 80,-90, 70,-25, -25, 70,-90, 80,-43, -9, 57,-87, 87,-57,  9, 43,-80, 90,-70, 25},
-        {22,-61, 85,-90, 73,-38, -4, 46,-78, 90,-82, 54,-13,-31, 67,-88, 88,-67, 31, 13,-54, 82,-90, 78,-46,  4, 38,-73, 90,-85, 61,-22},
-        {18,-50, 75,-89, 89,-75, 50,-18,-18, 50,-75, 89,-89, 75,-50, 18, 18,-50, 75,-89, 89,-75, 50,-18,-18, 50,-75, 89,-89, 75,-50, 18},
-        {13,-38, 61,-78, 88,-90, 85,-73, 54,-31,  4, 22,-46, 67,-82, 90, -90, 82,-67, 46,-22, -4, 31,-54, 73,-85, 90,-88, 78,-61, 38,-13},
-        {9,-25, 43,-57, 70,-80, 87,-90, 90,-87, 80,-70, 57,-43, 25, -9,  -9, 25,-43, 57,-70, 80,-87, 90,-90, 87,-80, 70,-57, 43,-25,  9},
-        {4,-13, 22,-31, 38,-46, 54,-61, 67,-73, 78,-82, 85,-88, 90,-90,  90,-90, 88,-85, 82,-78, 73,-67, 61,-54, 46,-38, 31,-22, 13, -4}
-    };
-
     // save unnecessary multiply with zero
     int last_nz = 0;
     for (int i = nTbS -1; i>=0; i--) {
@@ -3871,14 +4104,14 @@ static void transformation(int nTbS, int trType, int16_t *x, int *y) {
         for (int i = 0; i < nTbS; i++) {
             y[i] = 0;
             for (int j = 0; j <= last_nz; j++) {
-                y[i] += transMatrix[j][i] * x[j];
+                y[i] += hevc_idst_matrix[j][i] * x[j];
             }
         }
     } else {
         for (int i = 0; i < nTbS; i++) {
             y[i] = 0;
             for (int j = 0; j <= last_nz; j++) {
-                y[i] += transMatrixCol[j * (1 << (5 - log2floor(nTbS)))][i] * x[j];
+                y[i] += hevc_idct_matrix[j * (1 << (5 - log2floor(nTbS)))][i] * x[j];
             }
         }
     }
@@ -3906,17 +4139,39 @@ static int transform_scaled_coeffients(struct sps *sps, struct picture *p,
     int trType = 0;
     if (get_CuPredMode(sps, p, xTbY, yTbY) == MODE_INTRA && nTbS == 4 && cIdx == 0) {
         trType = 1;
-        VDBG(hevc, "trType %d, nTbS %d, coeffMin %d,coeffMax %d", trType, nTbS,
-             coeffMin, coeffMax);
+    }
+    if (!sre->extended_precision_processing_flag) {
+        // the coefficients are all in the top left w x h, the rest is skipped
+        int w = 0, h = 0;
+        for (int y = 0; y < nTbS; y++) {
+            for (int x = 0; x < nTbS; x++) {
+                if (d[x + y * nTbS]) {
+                    w = MAX(w, x + 1);
+                    h = y + 1;
+                }
+            }
+        }
+        VDBG(hevc, "trType %d, nTbS %d, nonzero %dx%d", trType, nTbS, w, h);
         struct accl_ops *ops = accl_first_available();
-        // struct accl_ops *ops = accl_find(GPU_TYPE_OPENCL);
-        if (ops) {
-            ops->idct_4x4(d, sps->BitDepthY);
-            memcpy(r, d, sizeof(uint16_t) * 16);
+        accl_hevc_itrans itrans = NULL;
+        if (trType == 1) {
+            itrans = ops ? ops->hevc_idst_4x4 : NULL;
+            itrans = itrans ? itrans : hevc_idst_4x4_c;
+        } else if (nTbS == 4) {
+            itrans = ops ? ops->hevc_idct_4x4 : NULL;
+            itrans = itrans ? itrans : hevc_idct_4x4_c;
+        } else if (nTbS == 8) {
+            itrans = ops ? ops->hevc_idct_8x8 : NULL;
+            itrans = itrans ? itrans : hevc_idct_8x8_c;
+        } else if (nTbS == 16) {
+            itrans = ops ? ops->hevc_idct_16x16 : NULL;
+            itrans = itrans ? itrans : hevc_idct_16x16_c;
         } else {
-            idct_4x4_hevc(d, r, sps->BitDepthY,
-                          sre->extended_precision_processing_flag);
+            itrans = ops ? ops->hevc_idct_32x32 : NULL;
+            itrans = itrans ? itrans : hevc_idct_32x32_c;
         }
+        memcpy(r, d, sizeof(int16_t) * nTbS * nTbS);
+        itrans(r, bitdepth, w, h);
         return 0;
     }
     VDBG(hevc, "trType %d, nTbS %d, coeffMin %d,coeffMax %d", trType, nTbS,
@@ -3994,6 +4249,14 @@ struct quant_pixel {
     int q_cr;
 };
 
+// See table 8-10, qpc for ChromaArrayType equal to 1
+static const int qpc_from_qpi[] = {
+    0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  10, 11, 12, 13, 14, 15, 16, 17,
+    18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 29, 30, 31, 32, 33, 33,
+    34, 34, 35, 35, 36, 36, 37, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51
+};
+
 // 8.6.1 derivation process for quatization parameters
 static struct quant_pixel
 quatization_parameters(int xCb, int yCb,
@@ -4001,22 +4264,14 @@ quatization_parameters(int xCb, int yCb,
                        struct slice_segment_header *slice, struct cu *cu,
                        struct picture *p) {
 
-    // See table 8-10, qpc for ChromaArrayType equal to 1
-    static const int qpc_from_qpi[] = {
-        0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  10, 11, 12, 13, 14, 15, 16, 17,
-        18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 29, 30, 31, 32, 33, 33,
-        34, 34, 35, 35, 36, 36, 37, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
-        48, 49, 50, 51
-    };
-
     struct pps *pps = hps->pps[slice->slice_pic_parameter_set_id];
     struct sps *sps = hps->sps[pps->pps_seq_parameter_set_id];
 
     struct trans_tree *tt = &cu->tt;
     int qPY_prev, qPY_pred;
-    static int last_xQg = -1, last_yQg = -1;
-    static struct quant_pixel last_q;
-    static struct quant_pixel prev_q;
+    static _Thread_local int last_xQg = -1, last_yQg = -1;
+    static _Thread_local struct quant_pixel last_q;
+    static _Thread_local struct quant_pixel prev_q;
 
     bool first_quant_group_in_slice = false;
     bool first_quant_group_in_tile = false;
@@ -4050,8 +4305,11 @@ quatization_parameters(int xCb, int yCb,
     if (pps->tiles_enabled_flag) {
         if ((xQg & (sps->CtbSizeY-1)) == 0 &&
             (yQg & (sps->CtbSizeY-1)) == 0) {
-            //FIXME
-            first_quant_group_in_tile = true;
+            // the first ctb of a tile in tile scan
+            int ts = pps->CtbAddrRsToTs[(xQg >> sps->CtbLog2SizeY) +
+                                        (yQg >> sps->CtbLog2SizeY) * sps->PicWidthInCtbsY];
+            first_quant_group_in_tile =
+                (ts == 0 || pps->TileId[ts] != pps->TileId[ts - 1]);
         }
     }
 
@@ -4062,7 +4320,8 @@ quatization_parameters(int xCb, int yCb,
          (pps->entropy_coding_sync_enabled_flag == 1))) {
         qPY_prev = SliceQpY;
     } else {
-        qPY_prev = prev_q.q_y;
+        // last_q keeps Qp'Y, the prediction is in QpY
+        qPY_prev = prev_q.q_y - sps->QpBdOffsetY;
     }
     VDBG(hevc, "xQg, yQg(%d, %d) qPY_prev %d, MinTbLog2SizeY %d", xQg,
          yQg, qPY_prev, sps->MinTbLog2SizeY);
@@ -4118,16 +4377,19 @@ quatization_parameters(int xCb, int yCb,
     VDBG(hevc, "Qpy %d, CuQpDeltaVal %d, log2CbSize %d, %d", Qpy,
          slice->CuQpDeltaVal, cu->log2CbSize, sps->CtbLog2SizeY);
 
-    set_qpy(sps, p, xCb, yCb, cu->log2CbSize, Qpy);
+    set_qpy(sps, p, cu->x0, cu->y0, cu->log2CbSize, Qpy);
     int Qp_Y = Qpy + sps->QpBdOffsetY;
     int Qp_Cb = 0;
     int Qp_Cr = 0;
+    // inter coding units keep the flags of the transform unit being decoded
+    // only, see decode_inter_residual()
+    int act = (xCb == tt->xT0 && yCb == tt->yT0) ? tt->tu_residual_act_flag[0][0] : 0;
     if (sps->ChromaArrayType != 0) {
         VDBG(hevc, "tu_residual_act_flag %d, Qp_Y %d, CuQpDeltaVal %d, "
              "CuQpOffsetCb %d, CuQpOffsetCr %d",
-             tt->tu_residual_act_flag[xCb - tt->xT0][yCb - tt->yT0], Qp_Y,
-             slice->CuQpDeltaVal, cu->CuQpOffsetCb, cu->CuQpOffsetCr);
-        if (tt->tu_residual_act_flag[xCb - tt->xT0][yCb-tt->yT0] == 0) {
+             act, Qp_Y, slice->CuQpDeltaVal, cu->CuQpOffsetCb,
+             cu->CuQpOffsetCr);
+        if (act == 0) {
             qPcb = clip3(-sps->QpBdOffsetC, 57,
                          Qpy + pps->pps_cb_qp_offset +
                              slice->slice_cb_qp_offset + cu->CuQpOffsetCb);
@@ -4179,7 +4441,8 @@ static int scale_and_transform(struct cu *cu, int transform_skip_flag,
 
     int qP;
     int PpsActQpOffsetY = pps->pps_scc_ext.pps_act_y_qp_offset_plus5 - 5;
-    struct quant_pixel q = quatization_parameters(xTbY, yTbY, hps, slice, cu, p);
+    // the quantization group goes by the coding unit, not the transform block
+    struct quant_pixel q = quatization_parameters(cu->x0, cu->y0, hps, slice, cu, p);
     struct trans_tree *tt = &cu->tt;
     // see 8-291, 8-292
     if (cIdx == 0) {
@@ -4218,7 +4481,11 @@ static int scale_and_transform(struct cu *cu, int transform_skip_flag,
             }
         }
     } else {
-        int tsShift = 5 + log2floor(nTbS);
+        // see 8.6.4.2, bdShift is applied right here for transform skip,
+        // transform_scaled_coeffients() does it for the others
+        int ext = sps->sps_range_ext.extended_precision_processing_flag;
+        int bdShift = MAX(20 - (cIdx ? sps->BitDepthC : sps->BitDepthY), (ext ? 11 : 0));
+        int tsShift = (ext ? MIN(5, bdShift - 2) : 5) + log2floor(nTbS);
         int16_t d[32*32];
         // step 1, invoke 8.6.3
         scale_transform_coefficients(sps, cu, slice, p, transform_skip_flag, xTbY, yTbY, nTbS,
@@ -4227,8 +4494,8 @@ static int scale_and_transform(struct cu *cu, int transform_skip_flag,
         if (transform_skip_flag == 1) {
             for (int y = 0; y < nTbS; y++) {
                 for (int x = 0; x < nTbS; x++) {
-                    r[x + y*nTbS] =
-                        (rotateCoeffs ? d[nTbS - x - 1 + (nTbS - y - 1)*nTbS] : d[x+y*nTbS]) << tsShift;
+                    int t = (rotateCoeffs ? d[nTbS - x - 1 + (nTbS - y - 1)*nTbS] : d[x+y*nTbS]) * (1 << tsShift);
+                    r[x + y*nTbS] = (t + (1 << (bdShift - 1))) >> bdShift;
                 }
             }
         } else {
@@ -4380,35 +4647,11 @@ filtering_neighbouring_samples(struct sps *sps, int predModeIntra, int cIdx, int
             biIntFlag = 1;
         }
 
-        int16_t fleft[64];
-        int16_t mftop[65];
-        assert(nTbS <= 32);
-        int16_t *ftop = mftop + 1;
+        const struct hevc_dsp *dsp = hevc_dsp_get();
         if (biIntFlag == 1) {
-            ftop[-1] = top[-1];
-            for (int y = 0; y < 63; y++) {
-                fleft[y] = (top[-1] * (63 - y) + (y + 1) * left[63] + 32) >> 6;
-            }
-            fleft[63] = left[63];
-            for (int x = 0; x < 63; x++) {
-                ftop[x] = (top[-1] * (63 - x) + (x + 1) * top[63] + 32) >> 6;
-            }
-            ftop[63] = top[63];
-            memcpy(top - 1, mftop, 65 * sizeof(int16_t));
-            memcpy(left, fleft, 64 * sizeof(int16_t));
+            dsp->intra_strong_filter((uint16_t *)left, (uint16_t *)top, nTbS);
         } else {
-            ftop[-1] = (left[0] + 2 * top[-1] + top[0] + 2) >> 2;
-            fleft[0] = (left[1] + 2 * left[0] + top[-1] + 2) >> 2;
-            for (int y = 1; y < nTbS * 2 - 1; y++) {
-                fleft[y] = (left[y + 1] + 2 * left[y] + left[y - 1] + 2) >> 2;
-            }
-            fleft[nTbS * 2 - 1] = left[nTbS * 2 - 1];
-            for (int x = 0; x < nTbS * 2 - 1; x++) {
-                ftop[x] = (top[x - 1] + 2 * top[x] + top[x + 1] + 2) >> 2;
-            }
-            ftop[nTbS * 2 - 1] = top[nTbS * 2 - 1];
-            memcpy(top - 1, mftop, (nTbS * 2 + 1) * sizeof(int16_t));
-            memcpy(left, fleft, nTbS * 2 * sizeof(int16_t));
+            dsp->intra_filter((uint16_t *)left, (uint16_t *)top, nTbS);
         }
     }
 #ifndef NDEBUG
@@ -4556,54 +4799,50 @@ static void intra_sample_prediction(struct slice_segment_header *slice,
     int16_t *top = top_default + 1;
     int16_t *left = left_default;
     // int16_t *dst = (cIdx == 0) ? p->Y: ((cIdx == 1) ? p->U : p->V);
-    int16_t *dst = (cIdx == 0) ? p->pixel: ((cIdx == 1) ? p->pixel + p->size : p->pixel + p->size * 3/2);
+    int16_t *dst = pic_plane(p, cIdx);
     int stride = (cIdx == 0) ? p->y_stride : p->uv_stride;
 
     int xTbY = (cIdx == 0) ? xTbCmp : xTbCmp * sps->SubWidthC;
     int yTbY = (cIdx == 0) ? yTbCmp : yTbCmp * sps->SubHeightC;
     // VDBG(hevc, "intra_sample_prediction %d (%d, %d), (%d, %d) %d",
     //      predModeIntra, xTbCmp, yTbCmp, xTbY, yTbY, nTbS);
+    // availability only changes from one min tb to the next, so the
+    // reference samples go in runs of a min tb
+    uint32_t cur = p->nb_map[(xTbY >> sps->MinTbLog2SizeY) +
+                             (yTbY >> sps->MinTbLog2SizeY) * p->nb_stride];
+    int addrRsCurr = (xTbY >> sps->CtbLog2SizeY) +
+                     (yTbY >> sps->CtbLog2SizeY) * sps->PicWidthInCtbsY;
+    int tile = pps->TileId[pps->CtbAddrRsToTs[addrRsCurr]];
+    int slice_ts = pps->CtbAddrRsToTs[slice->SliceAddrRs];
+    int subW = (cIdx == 0) ? 1 : sps->SubWidthC;
+    int subH = (cIdx == 0) ? 1 : sps->SubHeightC;
+    int runW = (1 << sps->MinTbLog2SizeY) / subW;
+    int runH = (1 << sps->MinTbLog2SizeY) / subH;
+
+    // the top left sample on its own, then the top row
     int yNbCmp = yTbCmp - 1;
-    int yNbY = (cIdx == 0) ? yNbCmp : yNbCmp * sps->SubHeightC;
-    int xNbCmp;
-    int xNbY;
-    for (int x = -1; x < nTbS * 2; x++) {
-        xNbCmp = xTbCmp + x;
-        xNbY = (cIdx == 0) ? xNbCmp : xNbCmp * sps->SubWidthC;
-        bool availableN = process_zscan_order_block_availablity(
-            slice, hps, xTbY, yTbY, xNbY, yNbY);
-
-        if (availableN == false || (get_CuPredMode(sps, p, xNbY,yNbY) != MODE_INTRA &&
-                                    pps->constrained_intra_pred_flag == 1)) {
-            // mark unavaible;
-            // VDBG(hevc,
-            //      "available top (%d, %d) %d, CuPredMode %d",
-            //      xNbCmp, yNbCmp, availableN, get_CuPredMode(ctu, xNbY,yNbY));
-            unavaible ++;
-            unavaibleT[x] = 1;
+    for (int x = -1, len; x < nTbS * 2; x += len) {
+        int xNbCmp = xTbCmp + x;
+        len = (x < 0) ? 1 : MIN(runW - (xNbCmp & (runW - 1)), nTbS * 2 - x);
+        if (nb_available(pps, sps, p, cur, tile, slice_ts, xNbCmp * subW, yNbCmp * subH)) {
+            memcpy(top + x, dst + xNbCmp + yNbCmp * stride, len * sizeof(int16_t));
         } else {
-            top[x] = dst[xNbCmp + yNbCmp*stride];
+            memset(unavaibleT + x, 1, len);
+            unavaible += len;
         }
     }
-    xNbCmp = xTbCmp - 1;
-    xNbY = (cIdx == 0) ? xNbCmp : xNbCmp * sps->SubWidthC;
-    for (int y = 0; y < nTbS*2; y++) {
+    int xNbCmp = xTbCmp - 1;
+    for (int y = 0, len; y < nTbS * 2; y += len) {
         yNbCmp = yTbCmp + y;
-        yNbY = (cIdx == 0) ? yNbCmp : yNbCmp * sps->SubHeightC;
-        bool availableN = process_zscan_order_block_availablity(
-            slice, hps, xTbY, yTbY, xNbY, yNbY);
-        // VDBG(hevc, "nTbS %d, xNbY yNbY(%d, %d), aval %d", nTbS, xNbY, yNbY,
-        //      availableN);
-        if (availableN == false ||
-            (get_CuPredMode(sps, p, xNbY, yNbY) != MODE_INTRA &&
-             pps->constrained_intra_pred_flag == 1)) {
-            // mark unavaible;
-            // VDBG(hevc, "available left (%d, %d) %d, CuPredMode %d",
-            //      xNbY, yNbY, availableN, get_CuPredMode(ctu, xNbY,yNbY));
-            unavaible++;
-            unavaibleL[y] = 1;
+        len = MIN(runH - (yNbCmp & (runH - 1)), nTbS * 2 - y);
+        if (nb_available(pps, sps, p, cur, tile, slice_ts, xNbCmp * subW, yNbCmp * subH)) {
+            const int16_t *src = dst + xNbCmp + yNbCmp * stride;
+            for (int i = 0; i < len; i++) {
+                left[y + i] = src[i * stride];
+            }
         } else {
-            left[y] = dst[xNbCmp + yNbCmp * stride];
+            memset(unavaibleL + y, 1, len);
+            unavaible += len;
         }
     }
 #ifndef NDEBUG
@@ -4629,11 +4868,12 @@ static void intra_sample_prediction(struct slice_segment_header *slice,
         // 8.4.4.2.3 invoked
         filtering_neighbouring_samples(sps, predModeIntra, cIdx, nTbS, left, top);
     }
+    const struct hevc_dsp *dsp = hevc_dsp_get();
     if (predModeIntra == INTRA_PLANAR) {
-        hevc_intra_planar((uint16_t *)predSamples, (uint16_t *)left,
+        dsp->intra_planar((uint16_t *)predSamples, (uint16_t *)left,
                           (uint16_t *)top, nTbS, nTbS);
     } else if (predModeIntra == INTRA_DC) {
-        hevc_intra_DC((uint16_t *)predSamples, (uint16_t *)left,
+        dsp->intra_dc((uint16_t *)predSamples, (uint16_t *)left,
                       (uint16_t *)top, nTbS, nTbS, cIdx,
                       sps->sps_scc_ext.intra_boundary_filtering_disabled_flag);
     } else {
@@ -4644,7 +4884,7 @@ static void intra_sample_prediction(struct slice_segment_header *slice,
             cu->cu_transquant_bypass_flag == 1) {
             disableIntraBoundaryFilter = 1;
         }
-        hevc_intra_angular((uint16_t *)predSamples, (uint16_t *)left,
+        dsp->intra_angular((uint16_t *)predSamples, (uint16_t *)left,
                            (uint16_t *)top, nTbS, nTbS, cIdx, predModeIntra,
                            disableIntraBoundaryFilter,
                            sps->BitDepthY);
@@ -4758,7 +4998,7 @@ void decode_intra_block(struct slice_segment_header *slice, struct cu *cu,
             }
             // step 9
             // int16_t *dst = (cIdx == 0) ? p->Y : (cIdx == 1 ? p->U : p->V);
-            int16_t *dst = (cIdx == 0) ? p->pixel: ((cIdx == 1) ? p->pixel + p->size : p->pixel + p->size * 3/2);
+            int16_t *dst = pic_plane(p, cIdx);
             int stride = (cIdx == 0) ? p->y_stride : p->uv_stride;
             int xTbInCb, yTbInCb;
             if (controlParaAct != 0) {
@@ -5111,7 +5351,7 @@ static void decode_cu_coded_intra_prediction_mode(
                 for (int j = 0; j < nCbS / sps->SubHeightC - 1; j++) {
                     p->pixel[p->size + xCb / sps->SubWidthC + i+ (yCb / sps->SubHeightC + j)*p->uv_stride] =
                         cu->pcm->pcm_sample_chroma[(nCbS / sps->SubWidthC * j) +i] << (sps->BitDepthC - PcmBitDepthC);
-                    p->pixel[p->size * 3/2 + xCb / sps->SubWidthC + i+(yCb / sps->SubHeightC + j)*p->uv_stride] =
+                    p->pixel[p->size + p->uv_size + xCb / sps->SubWidthC + i+(yCb / sps->SubHeightC + j)*p->uv_stride] =
                         cu->pcm->pcm_sample_chroma[(nCbS / sps->SubWidthC * ( j + nCbS / sps->SubHeightC)) +i] << (sps->BitDepthC - PcmBitDepthC);
                 }
             }
@@ -5127,14 +5367,14 @@ static void decode_cu_coded_intra_prediction_mode(
             if (cu->pc[xCb][yCb]->palette_transpose_flag == 1) {
                 for (int y = 0; y < nCbS / sps->SubHeightC; y++) {
                     for (int x = 0; x < nCbS / sps->SubWidthC; x++) {
-                        p->pixel[p->size * 3/2 + xCb / sps->SubWidthC + x+(yCb / sps->SubHeightC + y)*p->uv_stride] =
+                        p->pixel[p->size + p->uv_size + xCb / sps->SubWidthC + x+(yCb / sps->SubHeightC + y)*p->uv_stride] =
                                recSamples[y + x * nCbS];
                     }
                 }
             } else {
                 for (int y = 0; y < nCbS / sps->SubHeightC; y++) {
                     for (int x = 0; x < nCbS / sps->SubWidthC; x++) {
-                        p->pixel[p->size*3/2 + xCb / sps->SubWidthC + x+ (yCb / sps->SubHeightC + y)*p->uv_stride] =
+                        p->pixel[p->size + p->uv_size + xCb / sps->SubWidthC + x+ (yCb / sps->SubHeightC + y)*p->uv_stride] =
                             recSamples[x + nCbS * y];
                     }
                 }
@@ -5166,7 +5406,7 @@ static void decode_cu_coded_intra_prediction_mode(
                 // invoke 8.4.4.1
                 decode_intra_block(
                     slice, cu, hps, xPb, yPb, log2CbSizeC - 1, 1,
-                    get_IntraPredModeC(sps, p, xPb, yPb), 2,
+                    get_IntraPredModeC(sps, p, xPb, yPb), 1,
                     pps->pps_scc_ext.residual_adaptive_colour_transform_enabled_flag ? 2 : 0,
                     p);
                 decode_intra_block(
@@ -5358,11 +5598,11 @@ static void parse_palette_coding(cabac_dec *d, struct palette_coding *pc,
     uint8_t CopyAboveIndicesFlag[64][64] = {0};
 
     while (PaletteScanPos < nCbS * nCbS ) {
-        xC = x0 + slice->ScanOrder[log2BlockSize][3][PaletteScanPos].x;
-        yC = y0 + slice->ScanOrder[log2BlockSize][3][PaletteScanPos].y;
+        xC = x0 + ScanOrder[log2BlockSize][3][PaletteScanPos].x;
+        yC = y0 + ScanOrder[log2BlockSize][3][PaletteScanPos].y;
         if (PaletteScanPos > 0) {
-            xcPrev = x0 + slice->ScanOrder[log2BlockSize][3][PaletteScanPos - 1].x;
-            ycPrev = y0 + slice->ScanOrder[log2BlockSize][3][PaletteScanPos - 1].y;
+            xcPrev = x0 + ScanOrder[log2BlockSize][3][PaletteScanPos - 1].x;
+            ycPrev = y0 + ScanOrder[log2BlockSize][3][PaletteScanPos - 1].y;
         }
         int PaletteRunMinus1 = nCbS * nCbS - PaletteScanPos - 1;
         int RunToEnd UNUSED= 1;
@@ -5392,9 +5632,9 @@ static void parse_palette_coding(cabac_dec *d, struct palette_coding *pc,
         int log2BlkSize = log2floor(nCbS) - 2;
         if (PaletteScanPos > 0) {
             int xcPrev =
-                x0 + slice->ScanOrder[log2BlkSize][3][PaletteScanPos - 1].x;
+                x0 + ScanOrder[log2BlkSize][3][PaletteScanPos - 1].x;
             int ycPrev =
-                y0 + slice->ScanOrder[log2BlkSize][3][PaletteScanPos - 1].y;
+                y0 + ScanOrder[log2BlkSize][3][PaletteScanPos - 1].y;
             if (CopyAboveIndicesFlag[xcPrev][ycPrev] == 0) {
                 adjustedRefPaletteIndex = cu->PaletteIndexMap[xcPrev-x0][ycPrev-y0];
             } else {
@@ -5431,8 +5671,8 @@ static void parse_palette_coding(cabac_dec *d, struct palette_coding *pc,
         }
         runPos = 0;
         while (runPos <= PaletteRunMinus1) {
-            xR = x0 + slice->ScanOrder[log2BlockSize][3][PaletteScanPos].x;
-            yR = y0 + slice->ScanOrder[log2BlockSize][3][PaletteScanPos].y;
+            xR = x0 + ScanOrder[log2BlockSize][3][PaletteScanPos].x;
+            yR = y0 + ScanOrder[log2BlockSize][3][PaletteScanPos].y;
             if (CopyAboveIndicesFlag[xC][yC] == 0 ) {
                 CopyAboveIndicesFlag[xR][yR] = 0;
                 cu->PaletteIndexMap[xR-x0][yR-y0] = CurrPaletteIndex;
@@ -5447,8 +5687,8 @@ static void parse_palette_coding(cabac_dec *d, struct palette_coding *pc,
     if (pc->palette_escape_val_present_flag) {
         for (int cIdx = 0; cIdx < numComps; cIdx++) {
             for (int sPos = 0; sPos < nCbS * nCbS; sPos++) {
-                xC = x0 + slice->ScanOrder[log2BlockSize][3][sPos].x;
-                yC = y0 + slice->ScanOrder[log2BlockSize][3][sPos].y;
+                xC = x0 + ScanOrder[log2BlockSize][3][sPos].x;
+                yC = y0 + ScanOrder[log2BlockSize][3][sPos].y;
                 if ((int)cu->PaletteIndexMap[xC-x0][yC-y0] == pc->MaxPaletteIndex ) {
                     if (cIdx == 0 || (xC % 2 == 0 && yC % 2 == 0 &&
                         sps->ChromaArrayType == 1 ) || (xC % 2 == 0 &&
@@ -5468,7 +5708,8 @@ static void parse_palette_coding(cabac_dec *d, struct palette_coding *pc,
 }
 
 //see 9.3.4.2.3
-int ctxOffset, ctxShift;
+// set right before the bins they are used for, per decoding thread
+static _Thread_local int ctxOffset, ctxShift;
 static int ctx_for_last_sig_coeff_prefix(int ctx_idx, int binIdx) {
     // int ctxOffset, ctxShift;
     // if (cIdx == 0) {
@@ -5556,7 +5797,7 @@ static int ctx_for_coeff_abs_level_greater1(int cIdx, int scanBlockIdx,
                                             int coeff_abs_level_greater1_flag, int *ctxinc2) {
     // see 9.3.4.2.6
     int ctxSet, lastGreater1Ctx, lastGreater1Flag, greater1Ctx;
-    static int prev_ctxSet = 0, prev_greater1Ctx = 0;
+    static _Thread_local int prev_ctxSet = 0, prev_greater1Ctx = 0;
     if (firstCtx) {
         // if invoked for the first time
         if (scanBlockIdx == 0 || cIdx > 0) {
@@ -5629,56 +5870,12 @@ static int ctx_for_coded_sub_block_flag(int xS, int yS, int log2TrafoSize,
     return ctxInc;
 }
 
-static int StatCoeff[4] = {0};
 
-/*see 7.3.8.11 */
+/* see 7-74 to 7-77 */
 static void
-parse_residual_coding(cabac_dec *d, struct cu *cu,
-                      struct slice_segment_header *slice,
-                      struct hevc_param_set *hps, int x0, int y0,
-                      int log2TrafoSize, int cIdx, struct picture *p) {
-
-    struct pps *pps = hps->pps[slice->slice_pic_parameter_set_id];
-    struct sps *sps = hps->sps[pps->pps_seq_parameter_set_id];
-
-    struct trans_tree *tt = &cu->tt;
-    int coded_sub_block_flag[8][8] = {0};
-    int explicit_rdpcm_flag[4] = {0};
-    int explicit_rdpcm_dir_flag[4] UNUSED = {0};
-
-    //see 7-38
-    int Log2MaxTransformSkipSize = pps->pps_range_ext.log2_max_transform_skip_block_size_minus2 + 2;
-    // VDBG(hevc, "parse_residual_coding Log2MaxTransformSkipSize %d, "
-    //      "transform_skip_enabled_flag %d, cu_transquant_bypass_flag %d, "
-    //      "log2TrafoSize %d",
-    //      Log2MaxTransformSkipSize, pps->transform_skip_enabled_flag,
-    //      cu->cu_transquant_bypass_flag, log2TrafoSize);
-    if (pps->transform_skip_enabled_flag && !cu->cu_transquant_bypass_flag &&
-        (log2TrafoSize <= Log2MaxTransformSkipSize)) {
-        //see table 9-4
-        int ctxInc = (cIdx == 0) ? 0 : 1;
-        tt->transform_skip_flag[cIdx][x0 - tt->xT0][y0 - tt->yT0] =
-            CABAC(d, CTX_TYPE_RESIDUAL_CODING_TRANSFORM_SKIP + ctxInc);
-        // VDBG(hevc, "transform_skip_flag %d", tt->transform_skip_flag[cIdx][x0-tt->xT0][y0-tt->yT0]);
-    }
-    if (cu->CuPredMode == MODE_INTER &&
-        sps->sps_range_ext.explicit_rdpcm_enabled_flag &&
-        (tt->transform_skip_flag[cIdx][x0-tt->xT0][y0-tt->yT0] ||
-         cu->cu_transquant_bypass_flag)) {
-        //we will not go here for heif
-        assert(0);
-        explicit_rdpcm_flag[cIdx] =
-            CABAC(d, CTX_TYPE_RESIDUAL_CODING_EXPLICIT_RDPCM);
-        if (explicit_rdpcm_flag[cIdx]) {
-            explicit_rdpcm_dir_flag[cIdx] =
-                CABAC(d, CTX_TYPE_RESIDUAL_CODING_EXPLICIT_RDPCM_DIR);
-        }
-    }
-
-    /* see (7-74) (7-75)  (7-76) (7-77)*/
-    int LastSignificantCoeffX;
-    int LastSignificantCoeffY;
-
+parse_last_sig_coeff(cabac_dec *d, int log2TrafoSize, int cIdx,
+                     int *LastSignificantCoeffX, int *LastSignificantCoeffY)
+{
     //see 9.3.4.2.3
     if (cIdx == 0) {
         ctxOffset = 3 * (log2TrafoSize - 2) + ((log2TrafoSize - 1) >> 2);
@@ -5700,54 +5897,366 @@ parse_residual_coding(cabac_dec *d, struct cu *cu,
         int last_sig_coeff_x_suffix = CABAC_FL(d,
             (1 << ((last_sig_coeff_x_prefix >> 1) - 1)) - 1);
         // VDBG(hevc, "last_sig_coeff_x_suffix %d", last_sig_coeff_x_suffix);
-        LastSignificantCoeffX =
+        *LastSignificantCoeffX =
             (1 << ((last_sig_coeff_x_prefix >> 1) - 1)) *
                 (2 + (last_sig_coeff_x_prefix & 1)) + last_sig_coeff_x_suffix;
     } else {
-        LastSignificantCoeffX = last_sig_coeff_x_prefix;
+        *LastSignificantCoeffX = last_sig_coeff_x_prefix;
     }
 
     if (last_sig_coeff_y_prefix > 3) {
          int last_sig_coeff_y_suffix = CABAC_FL(d,
             (1 << ((last_sig_coeff_y_prefix >> 1) - 1)) - 1);
         // VDBG(hevc, "last_sig_coeff_y_suffix %d", last_sig_coeff_y_suffix);
-        LastSignificantCoeffY =
+        *LastSignificantCoeffY =
             (1 << ((last_sig_coeff_y_prefix >> 1) - 1)) *
                 (2 + (last_sig_coeff_y_prefix & 1)) +
             last_sig_coeff_y_suffix;
     } else {
-        LastSignificantCoeffY = last_sig_coeff_y_prefix;
+        *LastSignificantCoeffY = last_sig_coeff_y_prefix;
     }
-    // VDBG(hevc, "LastSignificantCoeffX %d, LastSignificantCoeffY %d",
-    //      LastSignificantCoeffX, LastSignificantCoeffY);
+}
 
-    int xS, xC, yS, yC;
-    //see 7.4.9.11
-    int predModeIntra = 0, scanIdx;
+//see 7.4.9.11, predModeIntra is 0 when the intra mode does not pick the scan
+static int
+residual_scan_idx(struct cu *cu, struct sps *sps, struct picture *p, int x0,
+                  int y0, int log2TrafoSize, int cIdx, int *predModeIntra)
+{
+    *predModeIntra = 0;
     if (cu->CuPredMode == MODE_INTRA &&
         (log2TrafoSize == 2 || (log2TrafoSize == 3 && cIdx == 0) ||
          (log2TrafoSize == 3 && CHROMA_444 == sps->ChromaArrayType))) {
-        predModeIntra = (cIdx == 0) ? get_IntraPredModeY(sps, p, x0, y0)
-                                    : get_IntraPredModeC(sps, p, x0, y0);
+        *predModeIntra = (cIdx == 0) ? get_IntraPredModeY(sps, p, x0, y0)
+                                     : get_IntraPredModeC(sps, p, x0, y0);
 
-        if (predModeIntra >= 6 && predModeIntra <= 14) {
-            scanIdx = 2;
-        } else if (predModeIntra >= 22 && predModeIntra <= 30) {
-            scanIdx = 1;
-        } else {
-            scanIdx = 0;
+        if (*predModeIntra >= 6 && *predModeIntra <= 14) {
+            return 2;
+        } else if (*predModeIntra >= 22 && *predModeIntra <= 30) {
+            return 1;
         }
-    } else {
-        scanIdx = 0;
-    }
-    /*see(7-78)*/
-    if (scanIdx == 2) {
-        swap(&LastSignificantCoeffX, &LastSignificantCoeffY);
     }
-    // VDBG(hevc, "scanIdx %d, LastSignificantCoeffX %d, LastSignificantCoeffY %d",
-    //      scanIdx, LastSignificantCoeffX, LastSignificantCoeffY);
+    return 0;
+}
 
-    // int escapeDataPresent;
+/* the 4x4 scans of 6.5.3 to 6.5.5 as raster positions (yP << 2) + xP, by
+ * scanIdx and scan position n
+ */
+static const uint8_t scan_4x4[3][16] = {
+    {0, 4, 1, 8, 5, 2, 12, 9, 6, 3, 13, 10, 7, 14, 11, 15},
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15},
+};
+
+/* sigCtx of 9.3.4.2.5 by scan position, ctxIdMap for 4x4 transform blocks */
+static const uint8_t sig_ctx_4x4[3][16] = {
+    {0, 2, 1, 6, 3, 4, 7, 6, 4, 5, 7, 8, 5, 8, 8, 8},
+    {0, 1, 4, 5, 2, 3, 4, 5, 6, 6, 8, 8, 7, 7, 8, 8},
+    {0, 2, 6, 7, 1, 3, 6, 7, 4, 4, 8, 8, 5, 5, 8, 8},
+};
+
+/* and for the larger ones by prevCsbf, before the offsets of the block
+ * size, scan and sub-block are added
+ */
+static const uint8_t sig_ctx_sub[3][4][16] = {
+    {
+        {2, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {2, 1, 2, 0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 0, 0, 0},
+        {2, 2, 1, 2, 1, 0, 2, 1, 0, 0, 1, 0, 0, 0, 0, 0},
+        {2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2},
+    },
+    {
+        {2, 1, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+        {2, 2, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0},
+        {2, 1, 0, 0, 2, 1, 0, 0, 2, 1, 0, 0, 2, 1, 0, 0},
+        {2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2},
+    },
+    {
+        {2, 1, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0},
+        {2, 1, 0, 0, 2, 1, 0, 0, 2, 1, 0, 0, 2, 1, 0, 0},
+        {2, 2, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0},
+        {2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2},
+    },
+};
+
+/* Main and Main Still Picture streams, no transform skip and none of the
+ * range extension tools, take parse_residual_coding_main()
+ */
+static inline int
+residual_coding_is_main(const struct sps *sps, const struct pps *pps)
+{
+    const struct sps_range_extension *sre = &sps->sps_range_ext;
+    return !pps->transform_skip_enabled_flag &&
+           !sre->transform_skip_context_enabled_flag &&
+           !sre->implicit_rdpcm_enabled_flag &&
+           !sre->explicit_rdpcm_enabled_flag &&
+           !sre->extended_precision_processing_flag &&
+           !sre->persistent_rice_adaptation_enabled_flag &&
+           !sre->cabac_bypass_alignment_enabled_flag;
+}
+
+//see 9.3.3.11, cRiceParam never goes over 4 without the range extension
+static inline int
+coeff_abs_level_remaining(cabac_dec *d, int cRiceParam)
+{
+    int prefix = 0;
+    while (prefix < 32 && CABAC_BP(d)) {
+        prefix++;
+    }
+    if (prefix <= 3) {
+        return (prefix << cRiceParam) + cabac_dec_bypass_n(d, cRiceParam);
+    }
+    return (((1 << (prefix - 3)) + 2) << cRiceParam) +
+           cabac_dec_bypass_n(d, prefix - 3 + cRiceParam);
+}
+
+/* 7.3.8.11 for residual_coding_is_main() streams. The sig_coeff_flag and
+ * greater1 contexts come from the tables above, the flags of a sub-block
+ * are kept in scan order of the significant coefficients only and the
+ * levels go straight to TransCoeffLevel.
+ */
+static void
+parse_residual_coding_main(cabac_dec *d, struct cu *cu, struct pps *pps,
+                           struct sps *sps, int x0, int y0, int log2TrafoSize, int cIdx, struct picture *p)
+{
+    struct trans_tree *tt = &cu->tt;
+    int LastSignificantCoeffX, LastSignificantCoeffY;
+    parse_last_sig_coeff(d, log2TrafoSize, cIdx, &LastSignificantCoeffX,
+                         &LastSignificantCoeffY);
+    int predModeIntra;
+    int scanIdx = residual_scan_idx(cu, sps, p, x0, y0, log2TrafoSize, cIdx,
+                                    &predModeIntra);
+    /*see(7-78)*/
+    if (scanIdx == 2) {
+        swap(&LastSignificantCoeffX, &LastSignificantCoeffY);
+    }
+
+    const scanpos *scanSb = ScanOrder[log2TrafoSize - 2][scanIdx];
+    const uint8_t *scan = scan_4x4[scanIdx];
+    int sbWidth = 1 << (log2TrafoSize - 2);
+    int xSLast = LastSignificantCoeffX >> 2, ySLast = LastSignificantCoeffY >> 2;
+    int posLast = ((LastSignificantCoeffY & 3) << 2) | (LastSignificantCoeffX & 3);
+    int lastSubBlock = sbWidth * sbWidth - 1;
+    int lastScanPos = 15;
+    while (lastSubBlock > 0 && (scanSb[lastSubBlock].x != xSLast ||
+                                scanSb[lastSubBlock].y != ySLast)) {
+        lastSubBlock--;
+    }
+    while (lastScanPos > 0 && scan[lastScanPos] != posLast) {
+        lastScanPos--;
+    }
+
+    // see 9.3.4.2.5, the sigCtx offsets of the sub-blocks other than (0, 0)
+    // and the one of the DC coefficient
+    int sigOffset, sigDc;
+    if (cIdx == 0) {
+        sigOffset = (log2TrafoSize == 3) ? ((scanIdx == 0) ? 9 : 15) : 21;
+        sigDc = 0;
+    } else {
+        sigOffset = 27 + ((log2TrafoSize == 3) ? 9 : 12);
+        sigDc = 27;
+    }
+    int16_t (*level)[32] = tt->TransCoeffLevel[cIdx];
+    uint8_t coded_sub_block_flag[8][8] = {{0}};
+    int greater1Ctx = 1;
+    int numSigCoeff = 0;
+
+    for (int i = lastSubBlock; i >= 0; i--) {
+        int xS = scanSb[i].x;
+        int yS = scanSb[i].y;
+        int inferSbDcSigCoeffFlag = 0;
+        int prevCsbf = 0;
+        if (xS < sbWidth - 1) {
+            prevCsbf |= coded_sub_block_flag[xS + 1][yS];
+        }
+        if (yS < sbWidth - 1) {
+            prevCsbf |= coded_sub_block_flag[xS][yS + 1] << 1;
+        }
+        if (i < lastSubBlock && i > 0) {
+            //see 9.3.4.2.4
+            coded_sub_block_flag[xS][yS] =
+                CABAC(d, CTX_TYPE_RESIDUAL_CODING_CODED_SUB_BLOCK_FLAG +
+                             (prevCsbf != 0) + (cIdx ? 2 : 0));
+            if (!coded_sub_block_flag[xS][yS]) {
+                continue;
+            }
+            inferSbDcSigCoeffFlag = 1;
+        } else {
+            coded_sub_block_flag[xS][yS] = 1;
+        }
+
+        // scan positions of the significant coefficients, from 15 down
+        uint8_t sig[16];
+        int nsig = 0;
+        int n = 15;
+        if (i == lastSubBlock) {
+            sig[nsig++] = lastScanPos;
+            n = lastScanPos - 1;
+        }
+        const uint8_t *sigCtx;
+        int sigInc;
+        if (log2TrafoSize == 2) {
+            sigCtx = sig_ctx_4x4[scanIdx];
+            sigInc = CTX_TYPE_RESIDUAL_CODING_SIG_COEFF_FLAG + sigDc;
+        } else {
+            sigCtx = sig_ctx_sub[scanIdx][prevCsbf];
+            sigInc = CTX_TYPE_RESIDUAL_CODING_SIG_COEFF_FLAG + sigOffset +
+                     ((cIdx == 0 && i > 0) ? 3 : 0);
+        }
+        for (; n > 0; n--) {
+            if (CABAC(d, sigInc + sigCtx[n])) {
+                sig[nsig++] = n;
+                inferSbDcSigCoeffFlag = 0;
+            }
+        }
+        if (n == 0) {
+            if (inferSbDcSigCoeffFlag) {
+                sig[nsig++] = 0;
+            } else if (CABAC(d, (i == 0 && log2TrafoSize > 2) ?
+                                    CTX_TYPE_RESIDUAL_CODING_SIG_COEFF_FLAG + sigDc :
+                                    sigInc + sigCtx[0])) {
+                sig[nsig++] = 0;
+            }
+        }
+        if (nsig == 0) {
+            continue;
+        }
+
+        //see 9.3.4.2.6 and 9.3.4.2.7
+        int ctxSet = (i == 0 || cIdx > 0) ? 0 : 2;
+        if (greater1Ctx == 0) {
+            ctxSet++;
+        }
+        greater1Ctx = 1;
+        int greater1Inc = CTX_TYPE_RESIDUAL_CODING_COEFF_ABS_LEVEL_GREATER1 +
+                          ctxSet * 4 + (cIdx ? 16 : 0);
+        int baseLevel[16];
+        int lastGreater1Idx = -1;
+        for (int k = 0; k < nsig; k++) {
+            baseLevel[k] = 1;
+            if (k < 8) {
+                int flag = CABAC(d, greater1Inc + greater1Ctx);
+                baseLevel[k] += flag;
+                if (flag) {
+                    greater1Ctx = 0;
+                    if (lastGreater1Idx < 0) {
+                        lastGreater1Idx = k;
+                    }
+                } else if (greater1Ctx > 0 && greater1Ctx < 3) {
+                    greater1Ctx++;
+                }
+            }
+        }
+        if (lastGreater1Idx >= 0) {
+            baseLevel[lastGreater1Idx] +=
+                CABAC(d, CTX_TYPE_RESIDUAL_CODING_COEFF_ABS_LEVEL_GREATER2 +
+                             ctxSet + (cIdx ? 4 : 0));
+        }
+
+        int signHidden = pps->sign_data_hiding_enabled_flag &&
+                         !cu->cu_transquant_bypass_flag &&
+                         (sig[0] - sig[nsig - 1] > 3);
+        int numSigns = nsig - signHidden;
+        uint32_t signs = numSigns ?
+            (uint32_t)cabac_dec_bypass_n(d, numSigns) << (32 - numSigns) : 0;
+
+        int cRiceParam = 0;
+        int sumAbsLevel = 0;
+        for (int k = 0; k < nsig; k++) {
+            int absLevel = baseLevel[k];
+            if (absLevel == ((k < 8) ? ((k == lastGreater1Idx) ? 3 : 2) : 1)) {
+                absLevel += coeff_abs_level_remaining(d, cRiceParam);
+                if (absLevel > 3 * (1 << cRiceParam)) {
+                    cRiceParam = MIN(cRiceParam + 1, 4);
+                }
+            }
+            sumAbsLevel += absLevel;
+            int negative;
+            if (signHidden && k == nsig - 1) {
+                negative = sumAbsLevel & 1;
+            } else {
+                negative = signs >> 31;
+                signs <<= 1;
+            }
+            int pos = scan[sig[k]];
+            int xC = (xS << 2) + (pos & 3);
+            int yC = (yS << 2) + (pos >> 2);
+            level[x0 + xC - tt->xT0][y0 + yC - tt->yT0] =
+                negative ? -absLevel : absLevel;
+        }
+        numSigCoeff += nsig;
+    }
+    tt->numSigCoeff[cIdx] += numSigCoeff;
+}
+
+/*see 7.3.8.11 */
+static void
+parse_residual_coding(cabac_dec *d, struct cu *cu,
+                      struct slice_segment_header *slice,
+                      struct hevc_param_set *hps, int x0, int y0,
+                      int log2TrafoSize, int cIdx, struct picture *p) {
+
+    struct pps *pps = hps->pps[slice->slice_pic_parameter_set_id];
+    struct sps *sps = hps->sps[pps->pps_seq_parameter_set_id];
+
+    if (residual_coding_is_main(sps, pps)) {
+        parse_residual_coding_main(d, cu, pps, sps, x0, y0,
+                                   log2TrafoSize, cIdx, p);
+        return;
+    }
+
+    struct trans_tree *tt = &cu->tt;
+    int coded_sub_block_flag[8][8] = {0};
+    int explicit_rdpcm_flag[4] = {0};
+    int explicit_rdpcm_dir_flag[4] UNUSED = {0};
+
+    //see 7-38
+    int Log2MaxTransformSkipSize = pps->pps_range_ext.log2_max_transform_skip_block_size_minus2 + 2;
+    // VDBG(hevc, "parse_residual_coding Log2MaxTransformSkipSize %d, "
+    //      "transform_skip_enabled_flag %d, cu_transquant_bypass_flag %d, "
+    //      "log2TrafoSize %d",
+    //      Log2MaxTransformSkipSize, pps->transform_skip_enabled_flag,
+    //      cu->cu_transquant_bypass_flag, log2TrafoSize);
+    if (pps->transform_skip_enabled_flag && !cu->cu_transquant_bypass_flag &&
+        (log2TrafoSize <= Log2MaxTransformSkipSize)) {
+        //see table 9-4
+        int ctxInc = (cIdx == 0) ? 0 : 1;
+        tt->transform_skip_flag[cIdx][x0 - tt->xT0][y0 - tt->yT0] =
+            CABAC(d, CTX_TYPE_RESIDUAL_CODING_TRANSFORM_SKIP + ctxInc);
+        // VDBG(hevc, "transform_skip_flag %d", tt->transform_skip_flag[cIdx][x0-tt->xT0][y0-tt->yT0]);
+    }
+    if (cu->CuPredMode == MODE_INTER &&
+        sps->sps_range_ext.explicit_rdpcm_enabled_flag &&
+        (tt->transform_skip_flag[cIdx][x0-tt->xT0][y0-tt->yT0] ||
+         cu->cu_transquant_bypass_flag)) {
+        // parsed to stay in sync, the residual goes without the dpcm of 8.6.8
+        explicit_rdpcm_flag[cIdx] =
+            CABAC(d, CTX_TYPE_RESIDUAL_CODING_EXPLICIT_RDPCM);
+        if (explicit_rdpcm_flag[cIdx]) {
+            explicit_rdpcm_dir_flag[cIdx] =
+                CABAC(d, CTX_TYPE_RESIDUAL_CODING_EXPLICIT_RDPCM_DIR);
+        }
+    }
+
+    /* see (7-74) (7-75)  (7-76) (7-77)*/
+    int LastSignificantCoeffX;
+    int LastSignificantCoeffY;
+    parse_last_sig_coeff(d, log2TrafoSize, cIdx, &LastSignificantCoeffX,
+                         &LastSignificantCoeffY);
+    // VDBG(hevc, "LastSignificantCoeffX %d, LastSignificantCoeffY %d",
+    //      LastSignificantCoeffX, LastSignificantCoeffY);
+
+    int xS, xC, yS, yC;
+    int predModeIntra;
+    int scanIdx = residual_scan_idx(cu, sps, p, x0, y0, log2TrafoSize, cIdx,
+                                    &predModeIntra);
+    /*see(7-78)*/
+    if (scanIdx == 2) {
+        swap(&LastSignificantCoeffX, &LastSignificantCoeffY);
+    }
+    // VDBG(hevc, "scanIdx %d, LastSignificantCoeffX %d, LastSignificantCoeffY %d",
+    //      scanIdx, LastSignificantCoeffX, LastSignificantCoeffY);
+
+    // int escapeDataPresent;
     int lastScanPos = 16;
     int lastSubBlock =
         (1 << (log2TrafoSize - 2)) * (1 << (log2TrafoSize - 2)) - 1;
@@ -5758,10 +6267,10 @@ parse_residual_coding(cabac_dec *d, struct cu *cu,
             lastSubBlock --;
         }
         lastScanPos --;
-        xS = slice->ScanOrder[log2TrafoSize - 2][scanIdx][lastSubBlock].x;
-        yS = slice->ScanOrder[log2TrafoSize - 2][scanIdx][lastSubBlock].y;
-        xC = ( xS << 2 ) + slice->ScanOrder[2][scanIdx][lastScanPos].x;
-        yC = ( yS << 2 ) + slice->ScanOrder[2][scanIdx][lastScanPos].y;
+        xS = ScanOrder[log2TrafoSize - 2][scanIdx][lastSubBlock].x;
+        yS = ScanOrder[log2TrafoSize - 2][scanIdx][lastSubBlock].y;
+        xC = ( xS << 2 ) + ScanOrder[2][scanIdx][lastScanPos].x;
+        yC = ( yS << 2 ) + ScanOrder[2][scanIdx][lastScanPos].y;
     } while((xC != LastSignificantCoeffX ) || (yC != LastSignificantCoeffY));
     // find the lastSubBlock and lastScanPos and accordingly xC, yC
     // VDBG(hevc, "xC %d, yC %d, lastSubBlock %d, lastScanPos %d", xC, yC,
@@ -5776,8 +6285,8 @@ parse_residual_coding(cabac_dec *d, struct cu *cu,
         int coeff_sign_flag[16] = {0};
         int coeff_abs_level_greater2_flag[16] = {0};
 
-        xS = slice->ScanOrder[log2TrafoSize - 2][scanIdx][i].x;
-        yS = slice->ScanOrder[log2TrafoSize - 2][scanIdx][i].y;
+        xS = ScanOrder[log2TrafoSize - 2][scanIdx][i].x;
+        yS = ScanOrder[log2TrafoSize - 2][scanIdx][i].y;
         // int escapeDataPresent = 0;
         int inferSbDcSigCoeffFlag = 0;
 
@@ -5818,8 +6327,8 @@ parse_residual_coding(cabac_dec *d, struct cu *cu,
 #if 0
         VDBG(hevc, "lastCoeff %d", lastCoeff);
         for (int n = nz; n >= 0; n--) {
-            xC = (xS << 2) + slice->ScanOrder[2][scanIdx][n].x;
-            yC = (yS << 2) + slice->ScanOrder[2][scanIdx][n].y;
+            xC = (xS << 2) + ScanOrder[2][scanIdx][n].x;
+            yC = (yS << 2) + ScanOrder[2][scanIdx][n].y;
             if (xC == LastSignificantCoeffX && yC == LastSignificantCoeffY) {
                 VDBG(hevc, "last n %d", n);
             }
@@ -5830,8 +6339,8 @@ parse_residual_coding(cabac_dec *d, struct cu *cu,
 #endif
         // decode all coeff flag, except last one which already got
         for (int n = lastCoeff; n >= 0; n--) {
-            xC = (xS << 2) + slice->ScanOrder[2][scanIdx][n].x;
-            yC = (yS << 2) + slice->ScanOrder[2][scanIdx][n].y;
+            xC = (xS << 2) + ScanOrder[2][scanIdx][n].x;
+            yC = (yS << 2) + ScanOrder[2][scanIdx][n].y;
             // VDBG(hevc, "n %d, xC, yC(%d, %d), coded_sub_block_flag %d", n, xC,
             //      yC, coded_sub_block_flag[xS][yS]);
             if (coded_sub_block_flag[xS][yS] &&
@@ -5874,8 +6383,8 @@ parse_residual_coding(cabac_dec *d, struct cu *cu,
         // from ScanOrder[2][scanIdx][n], just use the index and ignore the pos
         // cause they should be the same
         for (int n = 15; n >= 0; n--) {
-            xC = ( xS << 2 ) + slice->ScanOrder[2][scanIdx][n].x;
-            yC = ( yS << 2 ) + slice->ScanOrder[2][scanIdx][n].y;
+            xC = ( xS << 2 ) + ScanOrder[2][scanIdx][n].x;
+            yC = ( yS << 2 ) + ScanOrder[2][scanIdx][n].y;
             // VDBG(hevc, "n %d (%d, %d) sig_coeff_flag %d", n, xC, yC, sig_coeff_flag[n]);
             //use indexed sig_coeff_flag
             if (sig_coeff_flag[n]) {
@@ -5938,8 +6447,8 @@ parse_residual_coding(cabac_dec *d, struct cu *cu,
         }
 
         for (int n = 15; n >= 0; n--) {
-            xC = (xS << 2) + slice->ScanOrder[2][scanIdx][n].x;
-            yC = (yS << 2) + slice->ScanOrder[2][scanIdx][n].y;
+            xC = (xS << 2) + ScanOrder[2][scanIdx][n].x;
+            yC = (yS << 2) + ScanOrder[2][scanIdx][n].y;
             if (sig_coeff_flag[n] &&
                 (!pps->sign_data_hiding_enabled_flag || !signHidden ||
                  (n != firstSigScanPos))) {
@@ -5950,14 +6459,14 @@ parse_residual_coding(cabac_dec *d, struct cu *cu,
         int sumAbsLevel = 0;
         int cRiceParam = 0;
         if (sps->sps_range_ext.persistent_rice_adaptation_enabled_flag) {
-            cRiceParam = StatCoeff[sbType] / 4;
+            cRiceParam = d->StatCoeff[sbType] / 4;
         }
         // bool firstAbsLevelRemaining = true;
 
         int coeff_abs_level_remaining[16] = {0};
         for (int n = 15; n >= 0; n--) {
-            xC = (xS << 2) + slice->ScanOrder[2][scanIdx][n].x;
-            yC = (yS << 2) + slice->ScanOrder[2][scanIdx][n].y;
+            xC = (xS << 2) + ScanOrder[2][scanIdx][n].x;
+            yC = (yS << 2) + ScanOrder[2][scanIdx][n].y;
             if (sig_coeff_flag[n]) {
                 int baseLevel = 1 + coeff_abs_level_greater1_flag[n] + coeff_abs_level_greater2_flag[n];
                 if (baseLevel == ((numSigCoeff < 8) ? ((n == lastGreater1ScanPos) ? 3 : 2) : 1)) {
@@ -5995,10 +6504,10 @@ parse_residual_coding(cabac_dec *d, struct cu *cu,
                         }
                     }
                     // see 9-23
-                    if (coeff_abs_level_remaining[n] >= (3 << (StatCoeff[sbType] / 4))) {
-                        StatCoeff[sbType]++;
-                    } else if (2 * coeff_abs_level_remaining[n] < (1 << (StatCoeff[sbType] / 4)) && StatCoeff[sbType] > 0) {
-                        StatCoeff[sbType]--;
+                    if (coeff_abs_level_remaining[n] >= (3 << (d->StatCoeff[sbType] / 4))) {
+                        d->StatCoeff[sbType]++;
+                    } else if (2 * coeff_abs_level_remaining[n] < (1 << (d->StatCoeff[sbType] / 4)) && d->StatCoeff[sbType] > 0) {
+                        d->StatCoeff[sbType]--;
                     }
                     // firstAbsLevelRemaining = false;
                     // VDBG(hevc, "coeff_abs_level_remaining %d", coeff_abs_level_remaining[n]);
@@ -6011,10 +6520,10 @@ parse_residual_coding(cabac_dec *d, struct cu *cu,
                 if (pps->sign_data_hiding_enabled_flag && signHidden) {
                     sumAbsLevel += (coeff_abs_level_remaining[n] + baseLevel);
                     if ((n == firstSigScanPos) && ((sumAbsLevel % 2) == 1)) {
-                        tt->TransCoeffLevel[cIdx][x0 + xC - cu->x0]
-                                           [y0 + yC - cu->y0] =
-                            -tt->TransCoeffLevel[cIdx][x0 + xC - cu->x0]
-                                                [y0 + yC - cu->y0];
+                        tt->TransCoeffLevel[cIdx][x0 + xC - tt->xT0]
+                                           [y0 + yC - tt->yT0] =
+                            -tt->TransCoeffLevel[cIdx][x0 + xC - tt->xT0]
+                                                [y0 + yC - tt->yT0];
                     }
                 }
                 numSigCoeff++;
@@ -6173,6 +6682,74 @@ init_value_for_cbf(int* cbf_cb)
     }
 }
 
+/* see 8.6.2 and 8.6.7, the residual of a transform unit of an inter coding
+ * unit on top of its prediction, right after the unit is parsed. Unlike the
+ * intra ones the levels are kept relative to the unit, at xBase for the 4x4
+ * luma blocks sharing a chroma one, and are cleared for the next unit. There
+ * is no explicit rdpcm or cross component prediction.
+ */
+static void decode_inter_residual(struct slice_segment_header *slice,
+                                  struct cu *cu, struct hevc_param_set *hps,
+                                  int x0, int y0, int xBase, int yBase,
+                                  int log2TrafoSize, int blkIdx, int cbf_luma,
+                                  int cbf_cb, int cbf_cr, struct picture *p) {
+    struct pps *pps = hps->pps[slice->slice_pic_parameter_set_id];
+    struct sps *sps = hps->sps[pps->pps_seq_parameter_set_id];
+    struct trans_tree *tt = &cu->tt;
+    uint8_t ChromaArrayType = sps->ChromaArrayType;
+    int16_t r[32 * 32];
+
+    for (int cIdx = 0; cIdx < (ChromaArrayType ? 3 : 1); cIdx++) {
+        int log2TrafoSizeC = MAX(2, log2TrafoSize - (ChromaArrayType == 3 ? 0 : 1));
+        int xT = x0, yT = y0, log2Size = cIdx ? log2TrafoSizeC : log2TrafoSize;
+        int cbf = (cIdx == 0) ? cbf_luma : (cIdx == 1 ? cbf_cb : cbf_cr);
+        if (cIdx && log2TrafoSize == 2 && ChromaArrayType != 3) {
+            if (blkIdx != 3) {
+                break;
+            }
+            xT = xBase;
+            yT = yBase;
+        }
+        int sw = cIdx ? sps->SubWidthC : 1, sh = cIdx ? sps->SubHeightC : 1;
+        int stride = cIdx ? p->uv_stride : p->y_stride;
+        int maxval = (1 << (cIdx ? sps->BitDepthC : sps->BitDepthY)) - 1;
+        int nTbS = 1 << log2Size;
+        for (int tIdx = 0; tIdx < ((cIdx && ChromaArrayType == 2) ? 2 : 1); tIdx++) {
+            if (!(cbf & (1 << tIdx))) {
+                continue;
+            }
+            int yTb = yT + (tIdx << log2Size);
+            scale_and_transform(cu,
+                                tt->transform_skip_flag[cIdx][xT - tt->xT0][yTb - tt->yT0],
+                                hps, slice, xT, yTb, cIdx, nTbS, r, p);
+            int16_t *dst = pic_plane(p, cIdx) + xT / sw +
+                           (yT / sh + (tIdx << log2Size)) * stride;
+            for (int y = 0; y < nTbS; y++) {
+                for (int x = 0; x < nTbS; x++) {
+                    dst[x + y * stride] =
+                        clip3(0, maxval, dst[x + y * stride] + r[x + y * nTbS]);
+                }
+            }
+        }
+    }
+
+    int n = (log2TrafoSize == 2) ? 8 : 1 << log2TrafoSize;
+    for (int cIdx = 0; cIdx < 3; cIdx++) {
+        if (tt->numSigCoeff[cIdx]) {
+            for (int x = 0; x < n; x++) {
+                memset(tt->TransCoeffLevel[cIdx][x], 0, n * sizeof(int16_t));
+            }
+            tt->numSigCoeff[cIdx] = 0;
+        }
+        for (int x = 0; x < n; x++) {
+            memset(tt->transform_skip_flag[cIdx][x], 0, n);
+        }
+    }
+    for (int x = 0; x < n; x++) {
+        memset(tt->tu_residual_act_flag[x], 0, n);
+    }
+}
+
 /* see 7.3.8.8 */
 static void parse_transform_tree(cabac_dec *d, struct cu *cu,
                                  struct slice_segment_header *slice,
@@ -6271,129 +6848,634 @@ static void parse_transform_tree(cabac_dec *d, struct cu *cu,
                 CABAC(d, CTX_TYPE_TU_CBF_LUMA + ((trafoDepth == 0) ? 1 : 0));
             VDBG(hevc, "cbf_luma %d", cbf_luma);
         }
+        deblock_mark_tb(slice, pps, sps, p, x0, y0, log2TrafoSize, cbf_luma);
+        if (cu->CuPredMode != MODE_INTRA) {
+            cu->tt.xT0 = (log2TrafoSize == 2) ? xBase : x0;
+            cu->tt.yT0 = (log2TrafoSize == 2) ? yBase : y0;
+        }
         parse_transform_unit(d, cu, slice, hps, x0, y0, xBase, yBase,
                              log2TrafoSize, blkIdx, p, cbf_luma,
                              cbf_cb, cbf_cr);
+        if (cu->CuPredMode != MODE_INTRA) {
+            decode_inter_residual(slice, cu, hps, x0, y0, xBase, yBase,
+                                  log2TrafoSize, blkIdx, cbf_luma, cbf_cb,
+                                  cbf_cr, p);
+        }
     }
     // decode the transform unit including split tree from the top trafo level
-    if (trafoDepth == 0) {
+    if (trafoDepth == 0 && cu->CuPredMode == MODE_INTRA) {
         decode_cu_coded_intra_prediction_mode(slice, cu, hps, x0, y0, xBase,
                                               yBase, log2TrafoSize, p);
     }
 }
 
-static void UNUSED parse_mvd_coding(cabac_dec *d, struct mvd_coding *mvd) {
-    mvd->abs_mvd_greater0_flag[0] = CABAC(d, CTX_TYPE_MV_ABS_MVD_GREATER0);
-    mvd->abs_mvd_greater0_flag[1] = CABAC(d, CTX_TYPE_MV_ABS_MVD_GREATER0);
-    if (mvd->abs_mvd_greater0_flag[0]) {
-        mvd->abs_mvd_greater1_flag[0] = CABAC(d, CTX_TYPE_MV_ABS_MVD_GREATER1);
+//------------------------------------------------------------------------------
+// Inter prediction, see 8.5.3. The motion of every prediction block goes to
+// p->mvf for the blocks after it and the deblocking filter, the one at the
+// top left of each 16x16 block to the frame for the tmvp of later pictures.
+
+static inline struct mv_field *
+mvf_at(struct picture *p, int x, int y)
+{
+    return p->mvf + (x >> 2) + (y >> 2) * p->deblock_stride;
+}
+
+static inline bool
+mvf_same_motion(const struct mv_field *a, const struct mv_field *b)
+{
+    return a->pred_flag == b->pred_flag &&
+           a->ref_idx[0] == b->ref_idx[0] && a->ref_idx[1] == b->ref_idx[1] &&
+           !memcmp(a->mv, b->mv, sizeof(a->mv));
+}
+
+// see (8-182) to (8-186), mv for the poc distance tb when it is td
+static void
+scale_mv(int16_t *dst, const int16_t *mv, int tb, int td)
+{
+    if (td == 0) {
+        dst[0] = mv[0];
+        dst[1] = mv[1];
+        return;
+    }
+    td = clip3(-128, 127, td);
+    tb = clip3(-128, 127, tb);
+    int tx = (16384 + (ABS(td) >> 1)) / td;
+    int distScaleFactor = clip3(-4096, 4095, (tb * tx + 32) >> 6);
+    for (int c = 0; c < 2; c++) {
+        int v = distScaleFactor * mv[c];
+        dst[c] = clip3(-32768, 32767, (v < 0 ? -1 : 1) * ((ABS(v) + 127) >> 8));
+    }
+}
+
+// see 8.5.3.2.9, the motion of the collocated block covering (xCol, yCol)
+static bool
+col_motion(const struct hevc_slice *hslice, int xCol, int yCol, int refIdx,
+           int X, int16_t *mv)
+{
+    const struct hevc_frame *col = hslice->ColPic;
+    const struct col_mv *c =
+        &col->col[(xCol >> 4) + (yCol >> 4) * col->col_stride];
+    if (!c->pred_flag) {
+        return false;
     }
-    if (mvd->abs_mvd_greater0_flag[1]) {
-        mvd->abs_mvd_greater1_flag[1] = CABAC(d, CTX_TYPE_MV_ABS_MVD_GREATER1);
+    int listCol;
+    if (!(c->pred_flag & 1)) {
+        listCol = 1;
+    } else if (c->pred_flag == 1) {
+        listCol = 0;
+    } else {
+        listCol = hslice->NoBackwardPredFlag ? X
+                                             : hslice->slice->collocated_from_l0_flag;
     }
-    if (mvd->abs_mvd_greater0_flag[0]) {
-        if (mvd->abs_mvd_greater1_flag[0]) {
-            mvd->abs_mvd_minus2[0] = GOL_UE(d->bits);
-        }
-        mvd->mvd_sign_flag[0] = CABAC_BP(d);
+    const struct hevc_frame *ref = hslice->RefPicList[X][refIdx];
+    int lt = (ref->marking == USED_FOR_LONG_TERM_REFERENCE);
+    if (lt != ((c->lt >> listCol) & 1)) {
+        return false;
     }
-    if (mvd->abs_mvd_greater0_flag[1]) {
-        if (mvd->abs_mvd_greater1_flag[1]) {
-            mvd->abs_mvd_minus2[1] = GOL_UE(d->bits);
-        }
-        mvd->mvd_sign_flag[1] = CABAC_BP(d);
+    int colPocDiff = col->poc - c->poc[listCol];
+    int currPocDiff = hslice->poc - ref->poc;
+    if (lt || colPocDiff == currPocDiff) {
+        mv[0] = c->mv[listCol][0];
+        mv[1] = c->mv[listCol][1];
+    } else {
+        scale_mv(mv, c->mv[listCol], currPocDiff, colPocDiff);
     }
+    return true;
 }
 
-static void parse_prediction_unit(cabac_dec *d,
-                                  struct slice_segment_header *slice,
-                                  struct cu *cu, struct hevc_nalu_header *h,
-                                  struct hevc_param_set *hps, int x0, int y0,
-                                  int nxCbS UNUSED, int nyCbS UNUSED) {
+// see 8.5.3.2.8, the bottom right block if it is in the same ctb row, else
+// the one at the centre
+static bool
+temporal_mv(const struct hevc_slice *hslice, const struct sps *sps, int xPb,
+            int yPb, int nPbW, int nPbH, int refIdx, int X, int16_t *mv)
+{
+    if (!hslice->ColPic) {
+        return false;
+    }
+    int xColBr = xPb + nPbW, yColBr = yPb + nPbH;
+    if ((yPb >> sps->CtbLog2SizeY) == (yColBr >> sps->CtbLog2SizeY) &&
+        yColBr < (int)sps->pic_height_in_luma_samples &&
+        xColBr < (int)sps->pic_width_in_luma_samples &&
+        col_motion(hslice, xColBr, yColBr, refIdx, X, mv)) {
+        return true;
+    }
+    return col_motion(hslice, xPb + (nPbW >> 1), yPb + (nPbH >> 1), refIdx,
+                      X, mv);
+}
 
+/* see 8.5.3.2.2 to 8.5.3.2.5, the candidate merge_idx of the merge list,
+ * which is only built as far as that
+ */
+static void
+merge_motion(struct hevc_slice *hslice, struct hevc_param_set *hps,
+             struct picture *p, const struct cu *cu, int xPb, int yPb,
+             int nPbW, int nPbH, int partIdx, int merge_idx,
+             struct mv_field *out)
+{
+    struct slice_segment_header *slice = hslice->slice;
     struct pps *pps = hps->pps[slice->slice_pic_parameter_set_id];
     struct sps *sps = hps->sps[pps->pps_seq_parameter_set_id];
-    struct vps *vps = hps->vps[sps->sps_video_parameter_set_id];
-
-    struct predication_unit *pu = &cu->pu[x0][y0];
-    VDBG(hevc, "parse_prediction_unit");
-
-    //see I.7.4.7.1
-    int DepthFlag = vps->DepthLayerFlag[h->nuh_layer_id];
-    int ViewIdx = vps->ViewOrderIdx[h->nuh_layer_id];
-
-    uint8_t cpAvailableFlag = 1;
-    /* see (I-34) */
-    /* changed IdRefListLayer to IdDirectRefLayer in F-54 */
-    for (int i = 0; i < slice->NumActiveRefLayerPics; i++) {
-        slice->RefPicLayerId[i] = vps->IdRefListLayer[vps->vps_ext->layer_id_in_nuh[i]][slice->inter_layer_pred_layer_idc[i]];
+    int Log2ParMrgLevel = pps->log2_parallel_merge_level_minus2 + 2;
+    int nOrigPbW = nPbW, nOrigPbH = nPbH;
+    int PartMode = cu->PartMode;
+
+    // all prediction blocks of an 8x8 coding block share one list
+    if (Log2ParMrgLevel > 2 && cu->nCbS == 8) {
+        xPb = cu->x0;
+        yPb = cu->y0;
+        nPbW = nPbH = cu->nCbS;
+        partIdx = 0;
+        PartMode = PART_2Nx2N;
+    }
+
+    struct mv_field cand[5];
+    int n = 0;
+    // A1, B1, B0, A0 and B2, see 8.5.3.2.3
+    const int xN[5] = {xPb - 1, xPb + nPbW - 1, xPb + nPbW, xPb - 1, xPb - 1};
+    const int yN[5] = {yPb + nPbH - 1, yPb - 1, yPb - 1, yPb + nPbH, yPb - 1};
+    const struct mv_field *nb[5] = {NULL};
+    for (int k = 0; k < 5 && n <= merge_idx; k++) {
+        if ((xPb >> Log2ParMrgLevel) == (xN[k] >> Log2ParMrgLevel) &&
+            (yPb >> Log2ParMrgLevel) == (yN[k] >> Log2ParMrgLevel)) {
+            continue;
+        }
+        if (k == 0 && partIdx == 1 &&
+            (PartMode == PART_Nx2N || PartMode == PART_nLx2N ||
+             PartMode == PART_nRx2N)) {
+            continue;
+        }
+        if (k == 1 && partIdx == 1 &&
+            (PartMode == PART_2NxN || PartMode == PART_2NxnU ||
+             PartMode == PART_2NxnD)) {
+            continue;
+        }
+        if (!process_predication_block_availablity(
+                slice, p, hps, cu->x0, cu->y0, cu->nCbS, xPb, yPb, nPbW, nPbH,
+                partIdx, xN[k], yN[k])) {
+            continue;
+        }
+        nb[k] = mvf_at(p, xN[k], yN[k]);
+        // B1, A0 and B2 are compared with A1, B0 and B2 with B1
+        if ((k == 1 || k == 3 || k == 4) && nb[0] &&
+            mvf_same_motion(nb[k], nb[0])) {
+            continue;
+        }
+        if ((k == 2 || k == 4) && nb[1] && mvf_same_motion(nb[k], nb[1])) {
+            continue;
+        }
+        if (k == 4 && n == 4) {
+            continue;
+        }
+        cand[n++] = *nb[k];
+    }
+
+    if (n <= merge_idx && slice->slice_temporal_mvp_enabled_flag) {
+        struct mv_field t = {.ref_idx = {-1, -1}};
+        if (temporal_mv(hslice, sps, xPb, yPb, nPbW, nPbH, 0, 0, t.mv[0])) {
+            t.pred_flag = 1;
+            t.ref_idx[0] = 0;
+        }
+        if (slice->slice_type == SLICE_TYPE_B &&
+            temporal_mv(hslice, sps, xPb, yPb, nPbW, nPbH, 0, 1, t.mv[1])) {
+            t.pred_flag |= 2;
+            t.ref_idx[1] = 0;
+        }
+        if (t.pred_flag) {
+            cand[n++] = t;
+        }
+    }
+
+    // see 8.5.3.2.4, combined bi-predictive candidates
+    if (slice->slice_type == SLICE_TYPE_B && n > 1 && n <= merge_idx) {
+        static const uint8_t l0CandIdx[12] = {0, 1, 0, 2, 1, 2, 0, 3, 1, 3, 2, 3};
+        static const uint8_t l1CandIdx[12] = {1, 0, 2, 0, 2, 1, 3, 0, 3, 1, 3, 2};
+        int numOrigMergeCand = n;
+        for (int combIdx = 0;
+             combIdx < numOrigMergeCand * (numOrigMergeCand - 1) && n <= merge_idx;
+             combIdx++) {
+            const struct mv_field *l0 = &cand[l0CandIdx[combIdx]];
+            const struct mv_field *l1 = &cand[l1CandIdx[combIdx]];
+            if ((l0->pred_flag & 1) && (l1->pred_flag & 2) &&
+                (hslice->RefPicList[0][l0->ref_idx[0]]->poc !=
+                     hslice->RefPicList[1][l1->ref_idx[1]]->poc ||
+                 l0->mv[0][0] != l1->mv[1][0] || l0->mv[0][1] != l1->mv[1][1])) {
+                struct mv_field *c = &cand[n++];
+                c->pred_flag = 3;
+                c->ref_idx[0] = l0->ref_idx[0];
+                c->ref_idx[1] = l1->ref_idx[1];
+                memcpy(c->mv[0], l0->mv[0], sizeof(c->mv[0]));
+                memcpy(c->mv[1], l1->mv[1], sizeof(c->mv[1]));
+            }
+        }
+    }
+
+    // see 8.5.3.2.5, zero motion vectors over the reference indices
+    int numRefIdx = slice->num_ref_idx_l0_active_minus1 + 1;
+    if (slice->slice_type == SLICE_TYPE_B) {
+        numRefIdx = MIN(numRefIdx, (int)slice->num_ref_idx_l1_active_minus1 + 1);
+    }
+    for (int zeroIdx = 0; n <= merge_idx; zeroIdx++) {
+        int refIdx = (zeroIdx < numRefIdx) ? zeroIdx : 0;
+        struct mv_field *c = &cand[n++];
+        memset(c->mv, 0, sizeof(c->mv));
+        c->ref_idx[0] = refIdx;
+        if (slice->slice_type == SLICE_TYPE_P) {
+            c->ref_idx[1] = -1;
+            c->pred_flag = 1;
+        } else {
+            c->ref_idx[1] = refIdx;
+            c->pred_flag = 3;
+        }
     }
 
-    int numCurCmpLIds = DepthFlag ? 1 : slice->NumActiveRefLayerPics;
+    *out = cand[merge_idx];
+    // no bi-prediction for 8x4 and 4x8 blocks, see (8-116)
+    if (out->pred_flag == 3 && nOrigPbW + nOrigPbH == 12) {
+        out->pred_flag = 1;
+        out->ref_idx[1] = -1;
+        out->mv[1][0] = out->mv[1][1] = 0;
+    }
+}
 
+/* see 8.5.3.2.7, the motion vector of neighbour nb for the picture ref of
+ * list X, from the same picture first and with scaling after
+ */
+static bool
+amvp_nb_mv(const struct hevc_slice *hslice, const struct mv_field *nb, int X,
+           const struct hevc_frame *ref, bool scaled, int16_t *mv)
+{
+    for (int k = 0; k < 2; k++) {
+        int Y = k ? !X : X;
+        if (!((nb->pred_flag >> Y) & 1)) {
+            continue;
+        }
+        const struct hevc_frame *f = hslice->RefPicList[Y][nb->ref_idx[Y]];
+        if (!scaled) {
+            if (f == ref) {
+                mv[0] = nb->mv[Y][0];
+                mv[1] = nb->mv[Y][1];
+                return true;
+            }
+            continue;
+        }
+        int lt = (ref->marking == USED_FOR_LONG_TERM_REFERENCE);
+        if (lt != (f->marking == USED_FOR_LONG_TERM_REFERENCE)) {
+            continue;
+        }
+        if (lt) {
+            mv[0] = nb->mv[Y][0];
+            mv[1] = nb->mv[Y][1];
+        } else {
+            scale_mv(mv, nb->mv[Y], hslice->poc - ref->poc, hslice->poc - f->poc);
+        }
+        return true;
+    }
+    return false;
+}
 
+/* see 8.5.3.2.6, the motion vector predictor mvp_flag of list X for the
+ * reference index refIdx
+ */
+static void
+mvp_motion(struct hevc_slice *hslice, struct hevc_param_set *hps,
+           struct picture *p, const struct cu *cu, int xPb, int yPb, int nPbW,
+           int nPbH, int partIdx, int refIdx, int X, int mvp_flag,
+           int16_t *mvp)
+{
+    struct slice_segment_header *slice = hslice->slice;
+    struct pps *pps = hps->pps[slice->slice_pic_parameter_set_id];
+    struct sps *sps = hps->sps[pps->pps_seq_parameter_set_id];
+    const struct hevc_frame *ref = hslice->RefPicList[X][refIdx];
+
+    // A0, A1, then B0, B1 and B2
+    const int xN[5] = {xPb - 1, xPb - 1, xPb + nPbW, xPb + nPbW - 1, xPb - 1};
+    const int yN[5] = {yPb + nPbH, yPb + nPbH - 1, yPb - 1, yPb - 1, yPb - 1};
+    const struct mv_field *nb[5];
+    for (int k = 0; k < 5; k++) {
+        nb[k] = process_predication_block_availablity(
+                    slice, p, hps, cu->x0, cu->y0, cu->nCbS, xPb, yPb, nPbW,
+                    nPbH, partIdx, xN[k], yN[k])
+                    ? mvf_at(p, xN[k], yN[k])
+                    : NULL;
+    }
+    int16_t mvA[2], mvB[2];
+    bool availableFlagA = false, availableFlagB = false;
+    bool isScaledFlag = nb[0] || nb[1];
+    for (int k = 0; k < 2 && !availableFlagA; k++) {
+        availableFlagA = nb[k] && amvp_nb_mv(hslice, nb[k], X, ref, false, mvA);
+    }
+    for (int k = 0; k < 2 && !availableFlagA; k++) {
+        availableFlagA = nb[k] && amvp_nb_mv(hslice, nb[k], X, ref, true, mvA);
+    }
+    for (int k = 2; k < 5 && !availableFlagB; k++) {
+        availableFlagB = nb[k] && amvp_nb_mv(hslice, nb[k], X, ref, false, mvB);
+    }
+    // without a left neighbour B moves to A, and B may be a scaled one
+    if (!isScaledFlag) {
+        if (availableFlagB) {
+            availableFlagA = true;
+            mvA[0] = mvB[0];
+            mvA[1] = mvB[1];
+        }
+        availableFlagB = false;
+        for (int k = 2; k < 5 && !availableFlagB; k++) {
+            availableFlagB = nb[k] && amvp_nb_mv(hslice, nb[k], X, ref, true, mvB);
+        }
+    }
+
+    int16_t list[2][2];
+    int n = 0;
+    if (availableFlagA) {
+        list[n][0] = mvA[0];
+        list[n++][1] = mvA[1];
+    }
+    if (availableFlagB && !(availableFlagA && mvA[0] == mvB[0] && mvA[1] == mvB[1])) {
+        list[n][0] = mvB[0];
+        list[n++][1] = mvB[1];
+    }
+    if (n <= mvp_flag && slice->slice_temporal_mvp_enabled_flag &&
+        temporal_mv(hslice, sps, xPb, yPb, nPbW, nPbH, refIdx, X, list[n])) {
+        n++;
+    }
+    while (n <= mvp_flag) {
+        list[n][0] = list[n][1] = 0;
+        n++;
+    }
+    mvp[0] = list[mvp_flag][0];
+    mvp[1] = list[mvp_flag][1];
+}
 
-    for (int i =0; i < numCurCmpLIds; i ++) {
-        int curCmpLIds = DepthFlag ? h->nuh_layer_id : slice->RefPicLayerId[i];
-        int inCmpRefViewIdcs = vps->ViewOrderIdx[curCmpLIds];
-        if (vps->CpPresentFlag[ViewIdx][inCmpRefViewIdcs] == 0)
-            cpAvailableFlag = 0;
+/* the w x h block of a reference plane at (xInt, yInt) through the
+ * interpolation filter to dst at a stride of 64. Samples outside of the
+ * picture repeat the border ones, see (8-228) and (8-229).
+ */
+static void
+mc_block(const struct sps *sps, const struct hevc_frame *ref, int cIdx,
+         int16_t *dst, int xInt, int yInt, int w, int h, int xFrac,
+         int yFrac)
+{
+    const struct hevc_dsp *dsp = hevc_dsp_get();
+    int16_t edge[(64 + 7) * (64 + 7)];
+    int before = cIdx ? 1 : 3, after = cIdx ? 2 : 4;
+    int width = cIdx ? ref->width / sps->SubWidthC : ref->width;
+    int height = cIdx ? ref->height / sps->SubHeightC : ref->height;
+    int stride = cIdx ? ref->uv_stride : ref->y_stride;
+    const int16_t *src = frame_plane((struct hevc_frame *)ref, cIdx);
+
+    if (xInt - before < 0 || yInt - before < 0 || xInt + w + after > width ||
+        yInt + h + after > height) {
+        int es = w + before + after;
+        for (int y = 0; y < h + before + after; y++) {
+            const int16_t *row =
+                src + clip3(0, height - 1, yInt - before + y) * stride;
+            for (int x = 0; x < es; x++) {
+                edge[x + y * es] = row[clip3(0, width - 1, xInt - before + x)];
+            }
+        }
+        src = edge + before + before * es;
+        stride = es;
+    } else {
+        src += xInt + yInt * stride;
     }
-    //see I-19
-    uint8_t IvDiMcEnabledFlag = vps->NumRefListLayers[h->nuh_layer_id] > 0 && sps->sps_3d_ext[DepthFlag].iv_di_mc_enabled_flag;
-    //see I-25
-    uint8_t TexMcEnabledFlag = sps->sps_3d_ext[DepthFlag].tex_mc_enabled_flag && slice->in_comp_pred_flag;
-    //see I-22
-    uint8_t VspMcEnabledFlag = vps->NumRefListLayers[h->nuh_layer_id] > 0 &&
-        sps->sps_3d_ext[DepthFlag].vsp_mc_enabled_flag && slice->in_comp_pred_flag && cpAvailableFlag;
-    //see I-35
-    int NumExtraMergeCand = IvDiMcEnabledFlag || TexMcEnabledFlag || VspMcEnabledFlag;
-    /*MaxNumMergeCand should be range of 1 to 5 + NumExtraMergeCand */
-    //see I-36
-    int MaxNumMergeCand = 5 + NumExtraMergeCand - slice->five_minus_max_num_merge_cand;
-    if (cu->CuPredMode==MODE_SKIP) {
-        if (MaxNumMergeCand > 1) {
-            pu->merge_idx = CABAC(d, CTX_TYPE_PU_MERGE_IDX);
-        } else {
-            //when merge_idx is not present, it is inferred to be 0
-            pu->merge_idx = 0;
-        }
-    } else {/*MODE_INTER*/
-        assert(0);
-#if 0
-        pu->merge_flag = CABAC(d, CTX_TYPE_PU_MERGE_FLAG);
-        if (pu->merge_flag) {
-            if (MaxNumMergeCand > 1) {
-                pu->merge_idx = CABAC(d, CTX_TYPE_PU_MERGE_IDX);
-            }
-        } else {
-            if (slice->slice_type == SLICE_TYPE_B) {
-                pu->inter_pred_idc = CABAC(d, CTX_TYPE_PU_INTER_PRED_IDC + nPbW);
+    if (cIdx) {
+        dsp->mc_chroma(dst, 64, src, stride, w, h, xFrac, yFrac, sps->BitDepthC);
+    } else {
+        dsp->mc_luma(dst, 64, src, stride, w, h, xFrac, yFrac, sps->BitDepthY);
+    }
+}
+
+/* see 8.5.3.3, the samples of a prediction block straight to the picture,
+ * weighted as in 8.5.3.3.4.3 if the pps asks for it
+ */
+static void
+predict_inter(struct hevc_slice *hslice, struct pps *pps, struct sps *sps,
+              struct picture *p, int xPb, int yPb, int nPbW, int nPbH,
+              const struct mv_field *mvf)
+{
+    const struct hevc_dsp *dsp = hevc_dsp_get();
+    struct slice_segment_header *slice = hslice->slice;
+    int16_t tmp[2][64 * 64] __attribute__((aligned(32)));
+    bool weighted =
+        (slice->slice_type == SLICE_TYPE_P && pps->weighted_pred_flag) ||
+        (slice->slice_type == SLICE_TYPE_B && pps->weighted_bipred_flag);
+
+    for (int cIdx = 0; cIdx < (sps->ChromaArrayType ? 3 : 1); cIdx++) {
+        int sw = cIdx ? sps->SubWidthC : 1, sh = cIdx ? sps->SubHeightC : 1;
+        int x0 = xPb / sw, y0 = yPb / sh, w = nPbW / sw, h = nPbH / sh;
+        int bitdepth = cIdx ? sps->BitDepthC : sps->BitDepthY;
+        for (int X = 0; X < 2; X++) {
+            if (!((mvf->pred_flag >> X) & 1)) {
+                continue;
             }
-            if (pu->inter_pred_idc != PRED_L1) {
-                if (slice->num_ref_idx_l0_active_minus1 > 0) {
-                    pu->ref_idx_l0 = CABAC(d, CTX_TYPE_PU_REF_IDX);
-                }
-                parse_mvd_coding(d, &pu->mvd, x0, y0, 0);
-                pu->mvp_l0_flag = CABAC(d, CTX_TYPE_PU_MVP_FLAG);
+            const struct hevc_frame *ref = hslice->RefPicList[X][mvf->ref_idx[X]];
+            if (cIdx == 0) {
+                mc_block(sps, ref, 0, tmp[X], x0 + (mvf->mv[X][0] >> 2),
+                         y0 + (mvf->mv[X][1] >> 2), w, h, mvf->mv[X][0] & 3,
+                         mvf->mv[X][1] & 3);
+            } else {
+                // see (8-228), in eighth chroma samples
+                int mvCx = mvf->mv[X][0] * 2 / sw, mvCy = mvf->mv[X][1] * 2 / sh;
+                mc_block(sps, ref, cIdx, tmp[X], x0 + (mvCx >> 3),
+                         y0 + (mvCy >> 3), w, h, mvCx & 7, mvCy & 7);
+            }
+        }
+
+        int stride = cIdx ? p->uv_stride : p->y_stride;
+        int16_t *dst = pic_plane(p, cIdx) + x0 + y0 * stride;
+        int log2WD = (cIdx ? slice->ChromaLog2WeightDenom
+                           : (int)slice->luma_log2_weight_denom) + 14 - bitdepth;
+        if (mvf->pred_flag == 3) {
+            if (weighted) {
+                int i0 = mvf->ref_idx[0], i1 = mvf->ref_idx[1];
+                int w0 = cIdx ? slice->ChromaWeight[0][i0][cIdx - 1] : slice->LumaWeight[0][i0];
+                int w1 = cIdx ? slice->ChromaWeight[1][i1][cIdx - 1] : slice->LumaWeight[1][i1];
+                int o0 = cIdx ? slice->ChromaOffset[0][i0][cIdx - 1] : slice->LumaOffset[0][i0];
+                int o1 = cIdx ? slice->ChromaOffset[1][i1][cIdx - 1] : slice->LumaOffset[1][i1];
+                dsp->pred_bi_w(dst, stride, tmp[0], tmp[1], 64, w, h, log2WD,
+                               w0, w1, o0, o1, bitdepth);
+            } else {
+                dsp->pred_bi(dst, stride, tmp[0], tmp[1], 64, w, h, bitdepth);
             }
-            if (pu->inter_pred_idc != PRED_L0) {
-                if (slice->num_ref_idx_l1_active_minus1 > 0) {
-                    pu->ref_idx_l1 = CABAC(d, CTX_TYPE_PU_REF_IDX);
-                }
-                if (slice->mvd_l1_zero_flag && pu->inter_pred_idc == PRED_BI) {
-                    pu->MvdL1[x0][y0][0] = 0;
-                    pu->MvdL1[x0][y0][1] = 0;
-                } else {
-                    parse_mvd_coding(d, &pu->mvd, x0, y0, 1);
-                }
-                pu->mvp_l1_flag = CABAC(d, CTX_TYPE_PU_MVP_FLAG);
+        } else {
+            int X = mvf->pred_flag >> 1, i = mvf->ref_idx[X];
+            if (weighted) {
+                int wx = cIdx ? slice->ChromaWeight[X][i][cIdx - 1] : slice->LumaWeight[X][i];
+                int ox = cIdx ? slice->ChromaOffset[X][i][cIdx - 1] : slice->LumaOffset[X][i];
+                dsp->pred_uni_w(dst, stride, tmp[X], 64, w, h, log2WD, wx, ox,
+                                bitdepth);
+            } else {
+                dsp->pred_uni(dst, stride, tmp[X], 64, w, h, bitdepth);
             }
         }
-#endif
     }
 }
 
+/* the motion of a prediction block to p->mvf and, for the blocks at the top
+ * left of 16x16 ones, to the frame for the collocated motion of 8.5.3.2.9
+ */
+static void
+store_motion(struct hevc_slice *hslice, struct picture *p, int xPb, int yPb,
+             int nPbW, int nPbH, struct mv_field *mvf)
+{
+    struct col_mv c = {.pred_flag = mvf->pred_flag};
+    for (int X = 0; X < 2; X++) {
+        if ((mvf->pred_flag >> X) & 1) {
+            const struct hevc_frame *ref = hslice->RefPicList[X][mvf->ref_idx[X]];
+            mvf->ref_id[X] = ref->id;
+            memcpy(c.mv[X], mvf->mv[X], sizeof(c.mv[X]));
+            c.poc[X] = ref->poc;
+            if (ref->marking == USED_FOR_LONG_TERM_REFERENCE) {
+                c.lt |= 1 << X;
+            }
+        } else {
+            mvf->mv[X][0] = mvf->mv[X][1] = 0;
+            mvf->ref_idx[X] = -1;
+            mvf->ref_id[X] = 0;
+        }
+    }
+    for (int y = 0; y < nPbH; y += 4) {
+        struct mv_field *m = mvf_at(p, xPb, yPb + y);
+        for (int x = 0; x < (nPbW >> 2); x++) {
+            m[x] = *mvf;
+        }
+    }
+    struct hevc_frame *f = p->frame;
+    for (int y = (yPb + 15) & ~15; y < yPb + nPbH; y += 16) {
+        for (int x = (xPb + 15) & ~15; x < xPb + nPbW; x += 16) {
+            f->col[(x >> 4) + (y >> 4) * f->col_stride] = c;
+        }
+    }
+}
+
+// record the prediction block edges inside a coding block for deblocking,
+// the ones on its border are there already
+static void deblock_mark_pb(struct slice_segment_header *slice,
+                            struct picture *p, const struct cu *cu, int xPb,
+                            int yPb, int nPbW, int nPbH) {
+    if (slice->slice_deblocking_filter_disabled_flag) {
+        return;
+    }
+    uint8_t *m = p->deblock + (yPb >> 2) * p->deblock_stride + (xPb >> 2);
+    if (xPb != cu->x0 && (xPb & 7) == 0) {
+        for (int j = 0; j < (nPbH >> 2); j++) {
+            m[j * p->deblock_stride] |= DBK_PU_VER;
+        }
+    }
+    if (yPb != cu->y0 && (yPb & 7) == 0) {
+        for (int i = 0; i < (nPbW >> 2); i++) {
+            m[i] |= DBK_PU_HOR;
+        }
+    }
+}
+
+/* see 7.3.8.9 */
+static void parse_mvd_coding(cabac_dec *d, int *mvd) {
+    int abs_mvd_greater0_flag[2], abs_mvd_greater1_flag[2] = {0, 0};
+    abs_mvd_greater0_flag[0] = CABAC(d, CTX_TYPE_MV_ABS_MVD_GREATER0);
+    abs_mvd_greater0_flag[1] = CABAC(d, CTX_TYPE_MV_ABS_MVD_GREATER0);
+    for (int c = 0; c < 2; c++) {
+        if (abs_mvd_greater0_flag[c]) {
+            abs_mvd_greater1_flag[c] = CABAC(d, CTX_TYPE_MV_ABS_MVD_GREATER1);
+        }
+    }
+    for (int c = 0; c < 2; c++) {
+        mvd[c] = 0;
+        if (abs_mvd_greater0_flag[c]) {
+            mvd[c] = 1;
+            if (abs_mvd_greater1_flag[c]) {
+                // abs_mvd_minus2, see 9.3.3.5
+                mvd[c] = cabac_dec_egk(d, 1, 32, 32) + 2;
+            }
+            if (CABAC_BP(d)) {
+                mvd[c] = -mvd[c];
+            }
+        }
+    }
+}
+
+// ref_idx_lX, truncated rice with the first two bins in contexts
+static int parse_ref_idx(cabac_dec *d, int cMax) {
+    int i = 0;
+    while (i < cMax &&
+           (i < 2 ? CABAC(d, CTX_TYPE_PU_REF_IDX + i) : CABAC_BP(d))) {
+        i++;
+    }
+    return i;
+}
+
+/* see 7.3.8.6, the motion of a prediction block and its samples. Returns
+ * merge_flag.
+ */
+static int parse_prediction_unit(cabac_dec *d, struct hevc_slice *hslice,
+                                 struct cu *cu, struct hevc_param_set *hps,
+                                 int x0, int y0, int nPbW, int nPbH,
+                                 int partIdx, struct picture *p) {
+    struct slice_segment_header *slice = hslice->slice;
+    struct pps *pps = hps->pps[slice->slice_pic_parameter_set_id];
+    struct sps *sps = hps->sps[pps->pps_seq_parameter_set_id];
+
+    int MaxNumMergeCand = 5 - slice->five_minus_max_num_merge_cand;
+    struct mv_field mvf = {.ref_idx = {-1, -1}};
+    int merge_flag = 1;
+    if (cu->CuPredMode != MODE_SKIP) {
+        merge_flag = CABAC(d, CTX_TYPE_PU_MERGE_FLAG);
+    }
+    if (merge_flag) {
+        // truncated rice, only the first bin has a context
+        int merge_idx = 0;
+        if (MaxNumMergeCand > 1 && CABAC(d, CTX_TYPE_PU_MERGE_IDX)) {
+            merge_idx = 1;
+            while (merge_idx < MaxNumMergeCand - 1 && CABAC_BP(d)) {
+                merge_idx++;
+            }
+        }
+        merge_motion(hslice, hps, p, cu, x0, y0, nPbW, nPbH, partIdx,
+                     merge_idx, &mvf);
+    } else {
+        int inter_pred_idc = PRED_L0;
+        if (slice->slice_type == SLICE_TYPE_B) {
+            // see 9.3.4.2.2, the first bin by the depth of the coding tree
+            if (nPbW + nPbH != 12 &&
+                CABAC(d, CTX_TYPE_PU_INTER_PRED_IDC + get_ctDepth(sps, p, x0, y0))) {
+                inter_pred_idc = PRED_BI;
+            } else {
+                inter_pred_idc = CABAC(d, CTX_TYPE_PU_INTER_PRED_IDC + 4) ? PRED_L1 : PRED_L0;
+            }
+        }
+        int ref_idx[2] = {0, 0}, mvd[2][2] = {{0}}, mvp_flag[2] = {0, 0};
+        for (int X = 0; X < 2; X++) {
+            if (inter_pred_idc == (X ? PRED_L0 : PRED_L1)) {
+                continue;
+            }
+            int num_ref_idx_active_minus1 = X ? slice->num_ref_idx_l1_active_minus1
+                                              : slice->num_ref_idx_l0_active_minus1;
+            if (num_ref_idx_active_minus1 > 0) {
+                ref_idx[X] = parse_ref_idx(d, num_ref_idx_active_minus1);
+            }
+            if (!(X && slice->mvd_l1_zero_flag && inter_pred_idc == PRED_BI)) {
+                parse_mvd_coding(d, mvd[X]);
+            }
+            mvp_flag[X] = CABAC(d, CTX_TYPE_PU_MVP_FLAG);
+        }
+        mvf.pred_flag = (inter_pred_idc == PRED_BI) ? 3 : 1 << inter_pred_idc;
+        for (int X = 0; X < 2; X++) {
+            if ((mvf.pred_flag >> X) & 1) {
+                int16_t mvp[2];
+                mvp_motion(hslice, hps, p, cu, x0, y0, nPbW, nPbH, partIdx,
+                           ref_idx[X], X, mvp_flag[X], mvp);
+                mvf.ref_idx[X] = ref_idx[X];
+                // see (8-272) to (8-275), wrapped to 16 bits
+                mvf.mv[X][0] = (int16_t)(mvp[0] + mvd[X][0]);
+                mvf.mv[X][1] = (int16_t)(mvp[1] + mvd[X][1]);
+            }
+        }
+    }
+    store_motion(hslice, p, x0, y0, nPbW, nPbH, &mvf);
+    deblock_mark_pb(slice, p, cu, x0, y0, nPbW, nPbH);
+    predict_inter(hslice, pps, sps, p, x0, y0, nPbW, nPbH, &mvf);
+    return merge_flag;
+}
+
 //see 7.3.8.7 PCM sample sytax
 static void parse_pcm_sample(struct bits_vec *v, struct pcm_sample *pcm,
                              struct sps *sps, int x0 UNUSED, int y0 UNUSED, int log2CbSize) {
@@ -6461,6 +7543,34 @@ int get_cu_skip_flag_ctxInc(struct slice_segment_header *slice, struct picture *
     return ((condL && availableL) + (condA && availableA));
 }
 
+// see table 9-43 for the binarization of part_mode, bins 0 to 3 have
+// contexts and the last one of the amp modes is bypass coded
+static int parse_part_mode(cabac_dec *d, struct sps *sps, int CuPredMode,
+                           int log2CbSize) {
+    if (CABAC(d, CTX_TYPE_CU_PART_MODE)) {
+        return PART_2Nx2N;
+    }
+    if (CuPredMode == MODE_INTRA) {
+        return PART_NxN;
+    }
+    if (log2CbSize == sps->MinCbLog2SizeY) {
+        if (CABAC(d, CTX_TYPE_CU_PART_MODE + 1)) {
+            return PART_2NxN;
+        }
+        if (log2CbSize == 3) {
+            return PART_Nx2N;
+        }
+        return CABAC(d, CTX_TYPE_CU_PART_MODE + 2) ? PART_Nx2N : PART_NxN;
+    }
+    int hor = CABAC(d, CTX_TYPE_CU_PART_MODE + 1);
+    if (!sps->amp_enabled_flag || CABAC(d, CTX_TYPE_CU_PART_MODE + 3)) {
+        return hor ? PART_2NxN : PART_Nx2N;
+    }
+    if (hor) {
+        return CABAC_BP(d) ? PART_2NxnD : PART_2NxnU;
+    }
+    return CABAC_BP(d) ? PART_nRx2N : PART_nLx2N;
+}
 
 //see I.7.3.8.5
 static void
@@ -6471,7 +7581,6 @@ parse_coding_unit(cabac_dec *d, struct hevc_slice *hslice,
     struct cu cum = {.log2CbSize = log2CbSize,};
     struct cu *cu = &cum;
     struct slice_segment_header *slice = hslice->slice;
-    struct hevc_nalu_header *headr = hslice->nalu;
 
     struct pps *pps = hps->pps[slice->slice_pic_parameter_set_id];
     struct sps *sps = hps->sps[pps->pps_seq_parameter_set_id];
@@ -6483,7 +7592,8 @@ parse_coding_unit(cabac_dec *d, struct hevc_slice *hslice,
     cu->y0 = y0;
     cu->log2CbSize = log2CbSize;
     cu->nCbS = nCbS;
-    set_ctDepth(sps, p, x0, y0, log2CbSize, cqtDepth);
+    // the coding block edges, the transform tree adds the ones inside
+    deblock_mark_tb(slice, pps, sps, p, x0, y0, log2CbSize, 0);
     //see I.7.4.7.1
     // int DepthFlag = vps->DepthLayerFlag[headr->nuh_layer_id];
     //see (I-30)
@@ -6494,10 +7604,8 @@ parse_coding_unit(cabac_dec *d, struct hevc_slice *hslice,
     int MinCbLog2SizeY = (int)sps->log2_min_luma_coding_block_size_minus3 + 3;
     if (pps->transquant_bypass_enabled_flag) {
         cu->cu_transquant_bypass_flag = CABAC(d, CTX_TYPE_CU_TRANSQUANT_BYPASS_FLAG);
-        set_cu_transquant_bypass_flag(sps, p, x0, y0, log2CbSize, cu->cu_transquant_bypass_flag);
     }
-    assert(slice->slice_type == SLICE_TYPE_I);
-    int cu_skip_flag = 0, pcm_flag = 0;
+    int cu_skip_flag = 0, pcm_flag = 0, merge_flag = 0;
     if (slice->slice_type != SLICE_TYPE_I) {
         cu_skip_flag =
             CABAC(d, CTX_TYPE_CU_SKIP_FLAG +
@@ -6506,11 +7614,8 @@ parse_coding_unit(cabac_dec *d, struct hevc_slice *hslice,
 
     // VDBG(hevc, "(%d, %d) nCbS %d, cu_skip_flag %d, SkipIntraEnabledFlag %d, cqtDepth %d", x0, y0, nCbS,
     //      cu_skip_flag, SkipIntraEnabledFlag, cqtDepth);
-    if (cu_skip_flag) {
-        parse_prediction_unit(d, slice, cu, headr, hps, x0, y0, nCbS, nCbS);
-    }
 #ifdef ENABLE_3D
-    else if (SkipIntraEnabledFlag) {
+    if (!cu_skip_flag && SkipIntraEnabledFlag) {
         cu->skip_intra_flag[x0][y0] = CABAC(d, CTX_TYPE_3D_SKIP_INTRA_FLAG);
     }
 #endif
@@ -6541,7 +7646,13 @@ parse_coding_unit(cabac_dec *d, struct hevc_slice *hslice,
             cu->CuPredMode = MODE_SKIP;
         }
     }
-    set_CuPredMode(sps, p, x0, y0, log2CbSize, cu->CuPredMode);
+    set_cu_info(sps, p, x0, y0, log2CbSize, cqtDepth, cu->CuPredMode,
+                cu->cu_transquant_bypass_flag);
+    set_nb_map(pps, sps, p, x0, y0, log2CbSize, cu->CuPredMode);
+    if (cu_skip_flag) {
+        cu->PartMode = PART_2Nx2N;
+        parse_prediction_unit(d, hslice, cu, hps, x0, y0, nCbS, nCbS, 0, p);
+    }
 
     // int CqtCuPartPredEnabledFlag = sps->sps_3d_ext[DepthFlag].cqt_cu_part_pred_enabled_flag && slice->in_comp_pred_flag &&
     //     slice->slice_type != SLICE_TYPE_I && !( headr->nal_unit_type >= BLA_W_LP && headr->nal_unit_type <= RSV_IRAP_VCL23 );
@@ -6574,70 +7685,19 @@ parse_coding_unit(cabac_dec *d, struct hevc_slice *hslice,
         } else {
             if ((cu->CuPredMode != MODE_INTRA) ||
                 (log2CbSize == MinCbLog2SizeY)) {
-                //FIXME table 9-45
-                int part_mode = 0;
-                if (cu->CuPredMode == MODE_INTRA) {
-                    int bit0 = CABAC(d, CTX_TYPE_CU_PART_MODE);
-                    part_mode = (bit0 == 1? PART_2Nx2N:PART_NxN);
-                } else {
-                    int bit0 = CABAC(d, CTX_TYPE_CU_PART_MODE);
-                    if (bit0) {
-                        part_mode = PART_2Nx2N;
-                    } else {
-                        int bit1 = CABAC(d, CTX_TYPE_CU_PART_MODE+1);
-                        if (log2CbSize > MinCbLog2SizeY && sps->amp_enabled_flag == 0) {
-                            part_mode = (bit1? PART_2Nx2N: PART_NxN);
-                        } else if ((log2CbSize > MinCbLog2SizeY && sps->amp_enabled_flag == 1)) {
-                            int bit3 = CABAC(d, CTX_TYPE_CU_PART_MODE + 3);
-                            if (bit3) {
-                                part_mode = bit1 ? PART_2Nx2N: PART_NxN;
-                            }
-                            int bit4 = CABAC_BP(d);
-                            if (bit1 && bit4) {
-                                part_mode = PART_2Nx2N;
-                            }
-                            if (bit1 && !bit4) {
-                                part_mode = PART_NxN;
-                            }
-                            if (!bit1 && !bit4) {
-                                part_mode = PART_nLx2N;
-                            }
-                            if (!bit1 && bit4) {
-                                part_mode = PART_nRx2N;
-                            }
-                        } else if (log2CbSize < MinCbLog2SizeY) {
-                            if (bit1) {
-                                part_mode = PART_2NxN;
-                            }
-                            if (log2CbSize == 3) {
-                                part_mode = PART_Nx2N;
-                            } else {
-                                int bit2 = CABAC(d, CTX_TYPE_CU_PART_MODE+2);
-                                part_mode = PART_NxN - bit2;
-                            }
-                        }
-                    }
-                }
-                cu->PartMode = part_mode;
+                int part_mode = parse_part_mode(d, sps, cu->CuPredMode,
+                                                log2CbSize);
                 //see table7-10
-                if (cu->CuPredMode == MODE_INTRA) {
-                    cu->PartMode = (part_mode == 0) ? PART_2Nx2N : PART_NxN;
-                    cu->IntraSplitFlag = (part_mode == 0) ? 0 : 1;
-                } else if (cu->CuPredMode == MODE_INTER) {
-                    cu->PartMode = part_mode;// already aligned the value be define
-                    cu->IntraSplitFlag = 0;
-                }
+                cu->PartMode = part_mode;
+                cu->IntraSplitFlag = (cu->CuPredMode == MODE_INTRA &&
+                                      part_mode == PART_NxN);
             } else {
                 // if part_mode is not preset
                 cu->PartMode = PART_2Nx2N;
                 cu->IntraSplitFlag = 0;
             }
-            // for a picture, make sure it is MODE_INTRA
             // VDBG(hevc, "CuPredMode (%d, %d) %d, cu->PartMode %d", x0, y0,
             //       cu->CuPredMode, cu->PartMode);
-
-            assert(cu->CuPredMode == MODE_INTRA);
-            assert(cu->PartMode == PART_2Nx2N || cu->PartMode == PART_NxN);
             if (cu->CuPredMode == MODE_INTRA) {
                 if (sps->pcm_enabled_flag) {
                     int Log2MinIpcmCbSizeY = sps->pcm->log2_min_pcm_luma_coding_block_size_minus3 + 3;
@@ -6657,6 +7717,8 @@ parse_coding_unit(cabac_dec *d, struct hevc_slice *hslice,
                         SKIP_BITS(d->bits, 1);
                     }
                     parse_pcm_sample(d->bits, cu->pcm, sps, x0, y0, log2CbSize);
+                    // see 9.3.2.5, the engine starts over after the samples
+                    cabac_dec_reset(d);
                 } else {
                     int pbOffset = (cu->PartMode == PART_NxN) ? (nCbS / 2) : nCbS;
                     int log2PbSize = log2CbSize - ((cu->PartMode == PART_NxN) ? 1 : 0);
@@ -6769,36 +7831,38 @@ parse_coding_unit(cabac_dec *d, struct hevc_slice *hslice,
 
                         int IntraPredModeC = process_chroma_intra_prediction_mode(slice,
                             hps, x0, y0, intra_chroma_pred_mode[0], p);
-                        set_IntraPredModeC(sps, log2PbSize, p, x0, y0, IntraPredModeC, intra_chroma_pred_mode[0] == 4);
+                        // one mode for the whole cu, the second 4:2:2 block
+                        // of an NxN cu reads it below the first
+                        set_IntraPredModeC(sps, log2CbSize, p, x0, y0, IntraPredModeC, intra_chroma_pred_mode[0] == 4);
                     }
                 }
             } else {
-                //inter, which is not possible a I frame
-                if( cu->PartMode == PART_2Nx2N )
-                    parse_prediction_unit(d, slice, cu, headr, hps, x0, y0, nCbS, nCbS);
-                else if( cu->PartMode == PART_2NxN ) {
-                    parse_prediction_unit(d, slice, cu, headr, hps, x0, y0, nCbS, nCbS / 2 );
-                    parse_prediction_unit(d, slice, cu, headr, hps, x0, y0 + ( nCbS / 2 ), nCbS, nCbS / 2 );
-                } else if( cu->PartMode == PART_Nx2N ) {
-                    parse_prediction_unit(d, slice, cu, headr, hps, x0, y0, nCbS / 2, nCbS );
-                    parse_prediction_unit(d, slice, cu, headr, hps, x0 + ( nCbS / 2 ), y0, nCbS / 2, nCbS );
-                } else if( cu->PartMode == PART_2NxnU ) {
-                    parse_prediction_unit(d, slice, cu, headr, hps, x0, y0, nCbS, nCbS / 4 );
-                    parse_prediction_unit(d, slice, cu, headr, hps, x0, y0 + ( nCbS / 4 ), nCbS, nCbS * 3 / 4 );
-                } else if( cu->PartMode == PART_2NxnD ) {
-                    parse_prediction_unit(d, slice, cu, headr, hps, x0, y0, nCbS, nCbS * 3 / 4 );
-                    parse_prediction_unit(d, slice, cu, headr, hps, x0, y0 + ( nCbS * 3 / 4 ), nCbS, nCbS / 4 );
-                } else if( cu->PartMode == PART_nLx2N ) {
-                    parse_prediction_unit(d, slice, cu, headr, hps, x0, y0, nCbS / 4, nCbS );
-                    parse_prediction_unit(d, slice, cu, headr, hps, x0 + ( nCbS / 4 ), y0, nCbS * 3 / 4, nCbS );
-                } else if( cu->PartMode == PART_nRx2N ) {
-                    parse_prediction_unit(d, slice, cu, headr, hps, x0, y0, nCbS * 3 / 4, nCbS );
-                    parse_prediction_unit(d, slice, cu, headr, hps, x0 + ( nCbS * 3 / 4 ), y0, nCbS / 4, nCbS );
+                int h = nCbS / 2, q = nCbS / 4;
+                if (cu->PartMode == PART_2Nx2N) {
+                    merge_flag = parse_prediction_unit(d, hslice, cu, hps, x0, y0, nCbS, nCbS, 0, p);
+                } else if (cu->PartMode == PART_2NxN) {
+                    parse_prediction_unit(d, hslice, cu, hps, x0, y0, nCbS, h, 0, p);
+                    parse_prediction_unit(d, hslice, cu, hps, x0, y0 + h, nCbS, h, 1, p);
+                } else if (cu->PartMode == PART_Nx2N) {
+                    parse_prediction_unit(d, hslice, cu, hps, x0, y0, h, nCbS, 0, p);
+                    parse_prediction_unit(d, hslice, cu, hps, x0 + h, y0, h, nCbS, 1, p);
+                } else if (cu->PartMode == PART_2NxnU) {
+                    parse_prediction_unit(d, hslice, cu, hps, x0, y0, nCbS, q, 0, p);
+                    parse_prediction_unit(d, hslice, cu, hps, x0, y0 + q, nCbS, nCbS - q, 1, p);
+                } else if (cu->PartMode == PART_2NxnD) {
+                    parse_prediction_unit(d, hslice, cu, hps, x0, y0, nCbS, nCbS - q, 0, p);
+                    parse_prediction_unit(d, hslice, cu, hps, x0, y0 + nCbS - q, nCbS, q, 1, p);
+                } else if (cu->PartMode == PART_nLx2N) {
+                    parse_prediction_unit(d, hslice, cu, hps, x0, y0, q, nCbS, 0, p);
+                    parse_prediction_unit(d, hslice, cu, hps, x0 + q, y0, nCbS - q, nCbS, 1, p);
+                } else if (cu->PartMode == PART_nRx2N) {
+                    parse_prediction_unit(d, hslice, cu, hps, x0, y0, nCbS - q, nCbS, 0, p);
+                    parse_prediction_unit(d, hslice, cu, hps, x0 + nCbS - q, y0, q, nCbS, 1, p);
                 } else if (cu->PartMode == PART_NxN) {
-                    parse_prediction_unit(d, slice, cu, headr, hps, x0, y0, nCbS / 2, nCbS / 2 );
-                    parse_prediction_unit(d, slice, cu, headr, hps, x0 + ( nCbS / 2 ), y0, nCbS / 2, nCbS / 2 );
-                    parse_prediction_unit(d, slice, cu, headr, hps, x0, y0 + ( nCbS / 2 ), nCbS / 2, nCbS / 2 );
-                    parse_prediction_unit(d, slice, cu, headr, hps, x0 + ( nCbS / 2 ), y0 + ( nCbS / 2 ), nCbS / 2, nCbS / 2 );
+                    parse_prediction_unit(d, hslice, cu, hps, x0, y0, h, h, 0, p);
+                    parse_prediction_unit(d, hslice, cu, hps, x0 + h, y0, h, h, 1, p);
+                    parse_prediction_unit(d, hslice, cu, hps, x0, y0 + h, h, h, 2, p);
+                    parse_prediction_unit(d, hslice, cu, hps, x0 + h, y0 + h, h, h, 3, p);
                 } else {
                     //unreachable code
                     assert(0);
@@ -6822,7 +7886,7 @@ parse_coding_unit(cabac_dec *d, struct hevc_slice *hslice,
 #endif
     ) {
             if (cu->CuPredMode != MODE_INTRA &&
-                !(cu->PartMode == PART_2Nx2N && cu->pu[x0][y0].merge_flag)) {
+                !(cu->PartMode == PART_2Nx2N && merge_flag)) {
                 cu->rqt_root_cbf = CABAC(d, CTX_TYPE_CU_RQT_ROOT_CBF);
             } else {
                 // for inter blocks with 2NX2N, must be 1
@@ -6846,6 +7910,13 @@ parse_coding_unit(cabac_dec *d, struct hevc_slice *hslice,
 
             }
     }
+    // intra coding units get their qp with the samples, the others may have
+    // no residual at all
+    if (cu->CuPredMode != MODE_INTRA) {
+        cu->tt.xT0 = x0;
+        cu->tt.yT0 = y0;
+        quatization_parameters(x0, y0, hps, slice, cu, p);
+    }
 }
 
 static void
@@ -6912,6 +7983,10 @@ static struct ctu *coding_tree_unit(cabac_dec *d, struct hevc_slice *hslice,
     struct ctu *ctu = calloc(1, sizeof(*ctu));
     ctu->CtbAddrInTs = CtbAddrInTs;
     ctu->slice_id = slice->idx;
+    ctu->SliceAddrRs = SliceAddrRs;
+    ctu->beta_offset_div2 = slice->slice_beta_offset_div2;
+    ctu->tc_offset_div2 = slice->slice_tc_offset_div2;
+    ctu->loop_filter_across_slices = slice->slice_loop_filter_across_slices_enabled_flag;
     uint32_t xCtb = (CtbAddrInRs % sps->PicWidthInCtbsY) << sps->CtbLog2SizeY;
     uint32_t yCtb = (CtbAddrInRs / sps->PicWidthInCtbsY) << sps->CtbLog2SizeY;
 
@@ -6929,376 +8004,1229 @@ static struct ctu *coding_tree_unit(cabac_dec *d, struct hevc_slice *hslice,
     return ctu;
 }
 
+// see table 8-12
+static const uint8_t deblock_beta_table[52] = {
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  7,
+    8,  9,  10, 11, 12, 13, 14, 15, 16, 17, 18, 20, 22, 24, 26, 28, 30, 32,
+    34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64
+};
+
+static const uint8_t deblock_tc_table[54] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 5, 5, 6, 6, 7, 8, 9, 10, 11, 13, 14, 16, 18, 20,
+    22, 24
+};
+
+// a motion vector difference of one integer sample or more
+static inline bool mv_far(const int16_t *a, const int16_t *b) {
+    return ABS(a[0] - b[0]) >= 4 || ABS(a[1] - b[1]) >= 4;
+}
+
+// see 8.7.2.4, bS 1 for blocks predicted from other pictures, or from the
+// same ones with motion vectors too far apart
+static int deblock_mv_bs(const struct mv_field *q, const struct mv_field *p) {
+    if (q->pred_flag != 3 && p->pred_flag != 3) {
+        const int Xq = q->pred_flag >> 1, Xp = p->pred_flag >> 1;
+        if (q->ref_id[Xq] != p->ref_id[Xp]) {
+            return 1;
+        }
+        return mv_far(q->mv[Xq], p->mv[Xp]);
+    }
+    if (q->pred_flag != p->pred_flag) {
+        return 1;
+    }
+    if (!((q->ref_id[0] == p->ref_id[0] && q->ref_id[1] == p->ref_id[1]) ||
+          (q->ref_id[0] == p->ref_id[1] && q->ref_id[1] == p->ref_id[0]))) {
+        return 1;
+    }
+    if (q->ref_id[0] != q->ref_id[1]) {
+        if (q->ref_id[0] == p->ref_id[0]) {
+            return mv_far(q->mv[0], p->mv[0]) || mv_far(q->mv[1], p->mv[1]);
+        }
+        return mv_far(q->mv[0], p->mv[1]) || mv_far(q->mv[1], p->mv[0]);
+    }
+    // both from the same picture, either pairing may match
+    return (mv_far(q->mv[0], p->mv[0]) || mv_far(q->mv[1], p->mv[1])) &&
+           (mv_far(q->mv[0], p->mv[1]) || mv_far(q->mv[1], p->mv[0]));
+}
+
+// see 8.7.2.4
+static int deblock_bs(struct sps *sps, struct picture *p, int xq, int yq,
+                      int xp, int yp, uint8_t fq, uint8_t fp, int tu_edge) {
+    if (get_CuPredMode(sps, p, xq, yq) == MODE_INTRA ||
+        get_CuPredMode(sps, p, xp, yp) == MODE_INTRA) {
+        return 2;
+    }
+    if (tu_edge && ((fq | fp) & DBK_CODED)) {
+        return 1;
+    }
+    return deblock_mv_bs(mvf_at(p, xq, yq), mvf_at(p, xp, yp));
+}
+
+// samples of pcm blocks with pcm_loop_filter_disabled_flag, or of transquant
+// bypass blocks, are left as they are
+static uint8_t deblock_bypass(struct sps *sps, struct picture *p, int x, int y) {
+    if (sps->pcm_enabled_flag && sps->pcm->pcm_loop_filter_disabled_flag &&
+        get_pcm_flag(sps, p, x, y)) {
+        return 1;
+    }
+    return get_cu_transquant_bypass_flag(sps, p, x, y);
+}
+
+// see 8.7.2.5.3, beta and tc of the luma segment starting at q0 (xq, yq)
+static int deblock_luma_edge(struct sps *sps, struct picture *p, int xq,
+                             int yq, int xp, int yp, uint8_t tu, uint8_t pu,
+                             struct hevc_edge *e) {
+    uint8_t fq = p->deblock[(yq >> 2) * p->deblock_stride + (xq >> 2)];
+    uint8_t fp = p->deblock[(yp >> 2) * p->deblock_stride + (xp >> 2)];
+    int bS = 0;
+
+    if (fq & (tu | pu)) {
+        bS = deblock_bs(sps, p, xq, yq, xp, yp, fq, fp, fq & tu);
+    }
+    e->tc = 0;
+    if (bS == 0) {
+        return 0;
+    }
+    struct ctu *ctu = get_ctu(sps, p, xq >> sps->CtbLog2SizeY, yq >> sps->CtbLog2SizeY);
+    int qPL = (get_qpy(sps, p, xq, yq) + get_qpy(sps, p, xp, yp) + 1) >> 1;
+    int Q = clip3(0, 51, qPL + (ctu->beta_offset_div2 << 1));
+    e->beta = deblock_beta_table[Q] * (1 << (sps->BitDepthY - 8));
+    Q = clip3(0, 53, qPL + 2 * (bS - 1) + (ctu->tc_offset_div2 << 1));
+    e->tc = deblock_tc_table[Q] * (1 << (sps->BitDepthY - 8));
+    e->no_p = deblock_bypass(sps, p, xp, yp);
+    e->no_q = deblock_bypass(sps, p, xq, yq);
+    return bS;
+}
+
+// see 8.7.2.5.5, tc of the chroma segment whose first line is at luma (xq, yq)
+static void deblock_chroma_edge(struct sps *sps, struct picture *p, int xq,
+                                int yq, int xp, int yp, int bS,
+                                int cQpPicOffset, struct hevc_edge *e) {
+    e->tc = 0;
+    if (bS != 2) {
+        return;
+    }
+    struct ctu *ctu = get_ctu(sps, p, xq >> sps->CtbLog2SizeY, yq >> sps->CtbLog2SizeY);
+    int qPi = ((get_qpy(sps, p, xq, yq) + get_qpy(sps, p, xp, yp) + 1) >> 1) +
+              cQpPicOffset;
+    int QpC = (sps->ChromaArrayType == 1) ? qpc_from_qpi[clip3(0, 57, qPi)]
+                                          : MIN(qPi, 51);
+    int Q = clip3(0, 53, QpC + 2 + (ctu->tc_offset_div2 << 1));
+    e->beta = 0;
+    e->tc = deblock_tc_table[Q] * (1 << (sps->BitDepthC - 8));
+    e->no_p = deblock_bypass(sps, p, xp, yp);
+    e->no_q = deblock_bypass(sps, p, xq, yq);
+}
+
+// see 8.7.2, all vertical edges of a ctb row first, then the horizontal ones
+// including the top edge of the row, which changes the row above
+static void deblock_ctb_row(struct pps *pps, struct sps *sps,
+                            struct picture *p, int ry) {
+    const struct hevc_dsp *dsp = hevc_dsp_get();
+    int width = sps->pic_width_in_luma_samples;
+    int height = sps->pic_height_in_luma_samples;
+    int y0 = ry << sps->CtbLog2SizeY;
+    int y1 = MIN(y0 + (int)sps->CtbSizeY, height);
+    int maxy = (1 << sps->BitDepthY) - 1;
+    int maxc = (1 << sps->BitDepthC) - 1;
+    int sw = sps->SubWidthC, sh = sps->SubHeightC;
+    bool chroma = (sps->ChromaArrayType != 0);
+    int16_t *cb = pic_plane(p, 1);
+    int16_t *cr = pic_plane(p, 2);
+    int m = (MAX(width, (int)sps->CtbSizeY) >> 2) + 1;
+    struct hevc_edge *e = malloc(3 * m * sizeof(struct hevc_edge));
+    struct hevc_edge *ecb = e + m, *ecr = e + 2 * m;
+    uint8_t *bs = malloc(m);
+
+    int n = (y1 - y0) >> 2;
+    int nc = (y1 - y0) / sh / 4;
+    for (int x = 8; x < width; x += 8) {
+        int any = 0;
+        for (int k = 0; k < n; k++) {
+            int y = y0 + 4 * k;
+            bs[k] = deblock_luma_edge(sps, p, x, y, x - 1, y, DBK_TU_VER,
+                                      DBK_PU_VER, e + k);
+            any |= bs[k];
+        }
+        if (!any) {
+            continue;
+        }
+        dsp->luma_edge_ver(p->pixel + y0 * p->y_stride + x, p->y_stride, e, n,
+                           maxy);
+        if (!chroma || (x % (8 * sw))) {
+            continue;
+        }
+        // a chroma segment takes the bS of the luma line it starts at
+        for (int k = 0; k < nc; k++) {
+            int y = y0 + 4 * sh * k;
+            deblock_chroma_edge(sps, p, x, y, x - 1, y, bs[sh * k],
+                                pps->pps_cb_qp_offset, ecb + k);
+            deblock_chroma_edge(sps, p, x, y, x - 1, y, bs[sh * k],
+                                pps->pps_cr_qp_offset, ecr + k);
+        }
+        int off = (y0 / sh) * p->uv_stride + x / sw;
+        dsp->chroma_edge_ver(cb + off, p->uv_stride, ecb, nc, maxc);
+        dsp->chroma_edge_ver(cr + off, p->uv_stride, ecr, nc, maxc);
+    }
+
+    n = width >> 2;
+    nc = width / sw / 4;
+    for (int y = (y0 ? y0 : 8); y < y1; y += 8) {
+        int any = 0;
+        for (int k = 0; k < n; k++) {
+            int x = 4 * k;
+            bs[k] = deblock_luma_edge(sps, p, x, y, x, y - 1, DBK_TU_HOR,
+                                      DBK_PU_HOR, e + k);
+            any |= bs[k];
+        }
+        if (!any) {
+            continue;
+        }
+        dsp->luma_edge_hor(p->pixel + y * p->y_stride, p->y_stride, e, n, maxy);
+        if (!chroma || (y % (8 * sh))) {
+            continue;
+        }
+        for (int k = 0; k < nc; k++) {
+            int x = 4 * sw * k;
+            deblock_chroma_edge(sps, p, x, y, x, y - 1, bs[sw * k],
+                                pps->pps_cb_qp_offset, ecb + k);
+            deblock_chroma_edge(sps, p, x, y, x, y - 1, bs[sw * k],
+                                pps->pps_cr_qp_offset, ecr + k);
+        }
+        int off = (y / sh) * p->uv_stride;
+        dsp->chroma_edge_hor(cb + off, p->uv_stride, ecb, nc, maxc);
+        dsp->chroma_edge_hor(cr + off, p->uv_stride, ecr, nc, maxc);
+    }
+    free(bs);
+    free(e);
+}
+
+// see 8.7.3.2, whether the samples of the ctb at (rx, ry) may be used as
+// neighbours of the samples in ctu
+static bool sao_ctb_usable(struct pps *pps, struct sps *sps, struct picture *p,
+                           struct ctu *ctu, int rx, int ry) {
+    if (rx < 0 || ry < 0 || rx >= sps->PicWidthInCtbsY ||
+        ry >= sps->PicHeightInCtbsY) {
+        return false;
+    }
+    struct ctu *n = get_ctu(sps, p, rx, ry);
+    if (!n) {
+        return false;
+    }
+    if (n->SliceAddrRs != ctu->SliceAddrRs) {
+        // the flag of the slice later in decoding order decides
+        struct ctu *later = (n->CtbAddrInTs < ctu->CtbAddrInTs) ? ctu : n;
+        if (!later->loop_filter_across_slices) {
+            return false;
+        }
+    }
+    if (!pps->loop_filter_across_tiles_enabled_flag &&
+        pps->TileId[n->CtbAddrInTs] != pps->TileId[ctu->CtbAddrInTs]) {
+        return false;
+    }
+    return true;
+}
+
+// see 8.7.3.2, one ctb row of a colour component. The samples are changed in
+// place line by line, so the kernels read the deblocked samples from copies:
+// the current line, the line above, and for the first line of the row the
+// backup the row above left. The line below is not touched yet.
+static void sao_plane_row(struct pps *pps, struct sps *sps, struct picture *p,
+                          int ry, int cIdx, int16_t *pix, int stride) {
+    // table 8-13, hPos and vPos of the two neighbours per SaoEoClass
+    static const int8_t hpos[4][2] = {{-1, 1}, {0, 0}, {-1, 1}, {1, -1}};
+    static const int8_t vpos[4][2] = {{0, 0}, {-1, 1}, {-1, 1}, {-1, 1}};
+    const struct hevc_dsp *dsp = hevc_dsp_get();
+    int sw = cIdx ? sps->SubWidthC : 1;
+    int sh = cIdx ? sps->SubHeightC : 1;
+    int width = sps->pic_width_in_luma_samples / sw;
+    int height = sps->pic_height_in_luma_samples / sh;
+    int ctb_w = sps->CtbSizeY / sw;
+    int ctb_h = sps->CtbSizeY / sh;
+    int y0 = ry * ctb_h;
+    int y1 = MIN(y0 + ctb_h, height);
+    int bitDepth = cIdx ? sps->BitDepthC : sps->BitDepthY;
+    int maxval = (1 << bitDepth) - 1;
+    int len = p->y_stride + 2;
+    int16_t *backup = p->sao_line + (2 + cIdx) * len + 1;
+    // pcm samples with pcm_loop_filter_disabled_flag and transquant bypass
+    // samples are put back afterwards, see deblock_bypass()
+    bool bypass = pps->transquant_bypass_enabled_flag ||
+                  (sps->pcm_enabled_flag && sps->pcm->pcm_loop_filter_disabled_flag);
+    int min_cb = (1 << sps->MinCbLog2SizeY) / sw;
+
+    for (int y = y0; y < y1; y++) {
+        int16_t *dst = pix + y * stride;
+        int16_t *cur = p->sao_line + (y & 1) * len + 1;
+        int16_t *rows[3];
+        memcpy(cur, dst, width * sizeof(int16_t));
+        cur[-1] = cur[0];
+        cur[width] = cur[width - 1];
+        rows[0] = (y == y0) ? backup : p->sao_line + ((y - 1) & 1) * len + 1;
+        rows[1] = cur;
+        rows[2] = (y + 1 < height) ? dst + stride : cur;
+
+        for (int rx = 0; rx < sps->PicWidthInCtbsY; rx++) {
+            struct ctu *ctu = get_ctu(sps, p, rx, ry);
+            if (!ctu || !ctu->sao || ctu->sao->SaoTypeIdx[cIdx] == 0) {
+                continue;
+            }
+            struct sao *sao = ctu->sao;
+            int x0 = rx * ctb_w;
+            int w = MIN(ctb_w, width - x0);
+            if (sao->SaoTypeIdx[cIdx] == 1) {
+                dsp->sao_band(dst + x0, cur + x0, w, sao->saoOffsetVal[cIdx] + 1,
+                              sao->sao_band_position[cIdx], bitDepth - 5,
+                              maxval);
+                continue;
+            }
+            int c = sao->SaoEoClass[cIdx];
+            // the neighbours of the inner samples may sit in the ctb above or
+            // below, the ones of the first and last sample in any of the eight
+            bool mid = true, left = true, right = true;
+            for (int k = 0; k < 2; k++) {
+                int dy = (y == y0 && vpos[c][k] < 0) ? -1 :
+                         (y == y1 - 1 && vpos[c][k] > 0) ? 1 : 0;
+                mid = mid && sao_ctb_usable(pps, sps, p, ctu, rx, ry + dy);
+                left = left && sao_ctb_usable(pps, sps, p, ctu,
+                                              rx - (hpos[c][k] < 0), ry + dy);
+                right = right && sao_ctb_usable(pps, sps, p, ctu,
+                                                rx + (hpos[c][k] > 0), ry + dy);
+            }
+            if (!mid && !left && !right) {
+                continue;
+            }
+            dsp->sao_edge(dst + x0, cur + x0,
+                          rows[1 + vpos[c][0]] + x0 + hpos[c][0],
+                          rows[1 + vpos[c][1]] + x0 + hpos[c][1], w,
+                          sao->saoOffsetVal[cIdx], maxval);
+            if (!mid && w > 2) {
+                memcpy(dst + x0 + 1, cur + x0 + 1, (w - 2) * sizeof(int16_t));
+            }
+            if (!left) {
+                dst[x0] = cur[x0];
+            }
+            if (!right) {
+                dst[x0 + w - 1] = cur[x0 + w - 1];
+            }
+        }
+
+        if (bypass) {
+            for (int x = 0; x < width; x += min_cb) {
+                if (deblock_bypass(sps, p, x * sw, y * sh)) {
+                    memcpy(dst + x, cur + x, MIN(min_cb, width - x) * sizeof(int16_t));
+                }
+            }
+        }
+    }
+    memcpy(backup, p->sao_line + ((y1 - 1) & 1) * len + 1,
+           width * sizeof(int16_t));
+}
+
+// see 8.7.3, sao of the ctb rows up to end
+static void sao_rows(struct pps *pps, struct sps *sps, struct picture *p,
+                     int end) {
+    if (!sps->sample_adaptive_offset_enabled_flag) {
+        return;
+    }
+    for (; p->sao_rows < end; p->sao_rows++) {
+        sao_plane_row(pps, sps, p, p->sao_rows, 0, p->pixel, p->y_stride);
+        if (sps->ChromaArrayType != 0) {
+            sao_plane_row(pps, sps, p, p->sao_rows, 1, pic_plane(p, 1),
+                          p->uv_stride);
+            sao_plane_row(pps, sps, p, p->sao_rows, 2, pic_plane(p, 2),
+                          p->uv_stride);
+        }
+    }
+}
+
+// deblock the ctb rows up to end, a row can go once the row below it is
+// reconstructed, intra prediction reads the samples before deblocking.
+// sao runs one row behind, deblocking a row changes the last lines of the row
+// above, and sao of a row reads the first line of the row below.
+static void inloop_rows(struct pps *pps, struct sps *sps, struct picture *p,
+                        int end) {
+    for (; p->deblock_rows < end; p->deblock_rows++) {
+        deblock_ctb_row(pps, sps, p, p->deblock_rows);
+        sao_rows(pps, sps, p, p->deblock_rows);
+    }
+    if (end == sps->PicHeightInCtbsY) {
+        sao_rows(pps, sps, p, end);
+    }
+}
+
+/* see 9.3.2.2, initType of the context variables */
+static int
+slice_init_type(const struct slice_segment_header *slice)
+{
+    if (slice->slice_type == SLICE_TYPE_I) {
+        return 0;
+    }
+    if (slice->slice_type == SLICE_TYPE_P) {
+        return slice->cabac_init_flag ? 2 : 1;
+    }
+    return slice->cabac_init_flag ? 1 : 2;
+}
+
+/* see 9.3.1, the storage the contexts are synchronized with at the start of
+ * a slice segment, a tile or a wavefront row, NULL if they are initialized
+ * instead
+ */
+static const struct cabac_ctx_store *
+ctx_start_store(struct hevc_slice *hslice, struct hevc_param_set *hps,
+                struct picture *p, int CtbAddrInTs)
+{
+    struct slice_segment_header *slice = hslice->slice;
+    struct pps *pps = hps->pps[slice->slice_pic_parameter_set_id];
+    struct sps *sps = hps->sps[pps->pps_seq_parameter_set_id];
+    int width = sps->PicWidthInCtbsY;
+    int CtbAddrInRs = pps->CtbAddrTsToRs[CtbAddrInTs];
+
+    if (CtbAddrInTs == 0 ||
+        pps->TileId[CtbAddrInTs] != pps->TileId[CtbAddrInTs - 1]) {
+        return NULL;
+    }
+    if (pps->entropy_coding_sync_enabled_flag &&
+        (CtbAddrInRs % width == 0 ||
+         pps->TileId[CtbAddrInTs] !=
+             pps->TileId[pps->CtbAddrRsToTs[CtbAddrInRs - 1]])) {
+        // the top right ctb, stored after it was decoded
+        int xCtb = (CtbAddrInRs % width) << sps->CtbLog2SizeY;
+        int yCtb = (CtbAddrInRs / width) << sps->CtbLog2SizeY;
+        if (process_zscan_order_block_availablity(slice, hps, xCtb, yCtb,
+                                                  xCtb + sps->CtbSizeY,
+                                                  yCtb - sps->CtbSizeY)) {
+            return &p->wpp[CtbAddrInRs / width - 1];
+        }
+        return NULL;
+    }
+    if (CtbAddrInRs == (int)slice->slice_segment_address &&
+        slice->dependent_slice_segment_flag) {
+        return &p->ds;
+    }
+    return NULL;
+}
+
+//------------------------------------------------------------------------------
+// Substreams decoded in parallel, see 9.3.1. Each substream starts at its own
+// entry point with its own cabac decoder and runs on a pool of threads.
+//
+// With wavefront parallel processing every ctb row of the slice segment is a
+// substream. Ctb x of a row goes once the row above is done with ctb x + 1:
+// the up-right samples for intra prediction are there by then, and so are the
+// contexts the row above stored after its second ctb.
+//
+// With tiles every tile is a substream. Tiles do not predict from each other,
+// so they only meet again in the in-loop filters, which follow the ctb rows
+// once all the tiles crossing them are done.
+
+struct substream {
+    int start;                     // rbsp offset of the substream
+    int first_ts;                  // CtbAddrInTs it starts with
+};
+
+struct slice_threads {
+    struct bits_vec *v;
+    struct hevc_slice *hslice;
+    struct hevc_param_set *hps;
+    struct picture *p;
+    int SliceAddrRs;
+    int slice_qpy;
+    int nsubs;
+    struct substream *subs;
+
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    int *row_done;                 // p->row_done, under lock
+    int next;                      // the next substream a thread takes
+    int error;
+};
+
+// see 7.4.7.1, the entry points count the emulation prevention bytes of the
+// slice segment data, the rbsp has them dropped already
+static int substream_start(struct hevc_slice *hslice, struct bits_vec *v,
+                           int k) {
+    if (k == 0) {
+        return 0;
+    }
+    int data = v->start - v->buff;
+    int i = 0, n = 0;
+    while (i < hslice->num_epb && hslice->epb[i] <= data) {
+        i++;
+    }
+    // position in the nal unit payload, then back to the rbsp
+    int target = data + i + hslice->slice->entry_point_offset[k - 1];
+    while (n < hslice->num_epb && hslice->epb[n] + n < target) {
+        n++;
+    }
+    return target - n - data;
+}
+
+// wait for ctb row ry to get n ctbs done, false if decoding failed somewhere
+static bool substream_wait(struct slice_threads *t, int ry, int n) {
+    pthread_mutex_lock(&t->lock);
+    while (t->row_done[ry] < n && !t->error) {
+        pthread_cond_wait(&t->cond, &t->lock);
+    }
+    bool ok = !t->error;
+    pthread_mutex_unlock(&t->lock);
+    return ok;
+}
+
+static void substream_progress(struct slice_threads *t, int ry, int error) {
+    pthread_mutex_lock(&t->lock);
+    if (ry >= 0) {
+        t->row_done[ry]++;
+    }
+    t->error |= error;
+    pthread_cond_broadcast(&t->cond);
+    pthread_mutex_unlock(&t->lock);
+}
+
+static void substream_decode(struct slice_threads *t, int k) {
+    struct pps *pps = t->hps->pps[t->hslice->slice->slice_pic_parameter_set_id];
+    struct sps *sps = t->hps->sps[pps->pps_seq_parameter_set_id];
+    int width = sps->PicWidthInCtbsY;
+    struct substream *sub = &t->subs[k];
+    int CtbAddrInTs = sub->first_ts;
+    int CtbAddrInRs = pps->CtbAddrTsToRs[CtbAddrInTs];
+    int ry = CtbAddrInRs / width;
+    int x = CtbAddrInRs % width;
+    bool wpp = pps->entropy_coding_sync_enabled_flag;
+
+    // the cu level state in the slice header belongs to the substream
+    struct slice_segment_header slice = *t->hslice->slice;
+    struct hevc_slice hslice = *t->hslice;
+    hslice.slice = &slice;
+
+    struct bits_vec bits = *t->v;
+    bits.start = bits.ptr = t->v->start + sub->start;
+    bits.len = t->v->len - sub->start;
+    bits.offset = 0;
+    cabac_dec *d = cabac_dec_init(&bits);
+
+    // see 9.3.2, the contexts of the row above are there with its second ctb
+    const struct cabac_ctx_store *store = ctx_start_store(&hslice, t->hps,
+                                                          t->p, CtbAddrInTs);
+    if (store) {
+        if (wpp && k > 0 && !substream_wait(t, ry - 1, 2)) {
+            cabac_dec_free(d);
+            return;
+        }
+        sync_process_for_cabac_context(d, store);
+    } else {
+        cabac_init_models(d, t->slice_qpy, slice_init_type(&slice));
+    }
+
+    int end_of_slice_segment_flag = 0;
+    int error = 0;
+    do {
+        if (wpp && k > 0 && !substream_wait(t, ry - 1, MIN(x + 2, width))) {
+            break;
+        }
+        (void)coding_tree_unit(d, &hslice, t->hps, CtbAddrInTs, CtbAddrInRs,
+                               t->SliceAddrRs, pps->TileId, t->p);
+        if (wpp && x == 1) {
+            storage_process_for_cabac_context(d, &t->p->wpp[ry]);
+        }
+        end_of_slice_segment_flag = cabac_dec_terminate(d);
+        if (end_of_slice_segment_flag &&
+            pps->dependent_slice_segments_enabled_flag) {
+            storage_process_for_cabac_context(d, &t->p->ds);
+        }
+        substream_progress(t, ry, 0);
+
+        CtbAddrInTs++;
+        if (CtbAddrInTs >= sps->PicSizeInCtbsY) {
+            error = !end_of_slice_segment_flag;
+            break;
+        }
+        CtbAddrInRs = pps->CtbAddrTsToRs[CtbAddrInTs];
+        ry = CtbAddrInRs / width;
+        x = CtbAddrInRs % width;
+    } while (!end_of_slice_segment_flag &&
+             !(wpp ? x == 0 : pps->TileId[CtbAddrInTs] != pps->TileId[CtbAddrInTs - 1]));
+    cabac_dec_free(d);
+
+    // only the last substream ends the slice segment
+    if (error || end_of_slice_segment_flag != (k == t->nsubs - 1)) {
+        VERR(hevc, "substream %d of %d ends before ctb %d", k, t->nsubs,
+             CtbAddrInTs);
+        substream_progress(t, -1, 1);
+    }
+}
+
+static void *substream_worker(void *arg) {
+    struct slice_threads *t = arg;
+    for (;;) {
+        pthread_mutex_lock(&t->lock);
+        int k = t->next++;
+        bool stop = t->error;
+        pthread_mutex_unlock(&t->lock);
+        if (k >= t->nsubs || stop) {
+            break;
+        }
+        substream_decode(t, k);
+    }
+    return NULL;
+}
+
+// the threads a decoder keeps for the substreams of its slice segments, they
+// sleep between them and go over the slice_threads of the next one
+struct hevc_workers {
+    pthread_t *tids;
+    int num;
+
+    pthread_mutex_t lock;
+    pthread_cond_t work;           // a slice segment is there, or stop
+    pthread_cond_t idle;           // the last busy thread is done with it
+    struct slice_threads *job;
+    int pending;                   // threads still to take the job
+    int busy;                      // and still to be done with it
+    bool stop;
+};
+
+static void *hevc_worker(void *arg) {
+    struct hevc_workers *w = arg;
+    pthread_mutex_lock(&w->lock);
+    for (;;) {
+        while (!w->stop && w->pending == 0) {
+            pthread_cond_wait(&w->work, &w->lock);
+        }
+        if (w->stop) {
+            break;
+        }
+        // one that comes back before the others took theirs finds the
+        // substreams gone and only counts itself out
+        w->pending--;
+        struct slice_threads *t = w->job;
+        pthread_mutex_unlock(&w->lock);
+        substream_worker(t);
+        pthread_mutex_lock(&w->lock);
+        if (--w->busy == 0) {
+            pthread_cond_signal(&w->idle);
+        }
+    }
+    pthread_mutex_unlock(&w->lock);
+    return NULL;
+}
+
+// 0 takes one thread per cpu
+static int decoder_threads(const struct hevc_decoder *dec) {
+    if (dec->nthreads > 0) {
+        return dec->nthreads;
+    }
+    return MAX((int)sysconf(_SC_NPROCESSORS_ONLN), 1);
+}
+
+// the pool grows to n threads at most once and stays with the decoder,
+// returns how many it has
+static int workers_reserve(struct hevc_decoder *dec, int n) {
+    struct hevc_workers *w = dec->workers;
+    if (!w) {
+        w = dec->workers = calloc(1, sizeof(struct hevc_workers));
+        pthread_mutex_init(&w->lock, NULL);
+        pthread_cond_init(&w->work, NULL);
+        pthread_cond_init(&w->idle, NULL);
+    }
+    if (w->num < n) {
+        w->tids = realloc(w->tids, n * sizeof(pthread_t));
+        while (w->num < n &&
+               !pthread_create(&w->tids[w->num], NULL, hevc_worker, w)) {
+            w->num++;
+        }
+    }
+    return w->num;
+}
+
+static void workers_start(struct hevc_workers *w, struct slice_threads *t) {
+    pthread_mutex_lock(&w->lock);
+    w->job = t;
+    w->pending = w->busy = w->num;
+    pthread_cond_broadcast(&w->work);
+    pthread_mutex_unlock(&w->lock);
+}
+
+static void workers_finish(struct hevc_workers *w) {
+    pthread_mutex_lock(&w->lock);
+    while (w->busy > 0) {
+        pthread_cond_wait(&w->idle, &w->lock);
+    }
+    w->job = NULL;
+    pthread_mutex_unlock(&w->lock);
+}
+
+static void workers_destroy(struct hevc_workers *w) {
+    if (!w) {
+        return;
+    }
+    pthread_mutex_lock(&w->lock);
+    w->stop = true;
+    pthread_cond_broadcast(&w->work);
+    pthread_mutex_unlock(&w->lock);
+    for (int i = 0; i < w->num; i++) {
+        pthread_join(w->tids[i], NULL);
+    }
+    free(w->tids);
+    pthread_cond_destroy(&w->idle);
+    pthread_cond_destroy(&w->work);
+    pthread_mutex_destroy(&w->lock);
+    free(w);
+}
+
+// substreams are taken in order, so every wavefront row a thread waits for is
+// already being decoded by another one. The calling thread runs the in-loop
+// filters behind the ctb rows as they complete. With a budget of one thread
+// it decodes the substreams itself first, in order nothing waits for long.
+static void substreams_decode(struct hevc_decoder *dec, struct bits_vec *v,
+                              struct hevc_slice *hslice,
+                              struct hevc_param_set *hps, int slice_qpy,
+                              struct picture *p) {
+    struct slice_segment_header *slice = hslice->slice;
+    struct pps *pps = hps->pps[slice->slice_pic_parameter_set_id];
+    struct sps *sps = hps->sps[pps->pps_seq_parameter_set_id];
+    int width = sps->PicWidthInCtbsY;
+    struct slice_threads t = {
+        .v = v,
+        .hslice = hslice,
+        .hps = hps,
+        .p = p,
+        .SliceAddrRs = slice->SliceAddrRs,
+        .slice_qpy = slice_qpy,
+        .nsubs = slice->num_entry_point_offsets + 1,
+        .row_done = p->row_done,
+    };
+    t.subs = calloc(t.nsubs, sizeof(struct substream));
+    int *target = NULL;
+
+    // the first ctb of every substream
+    int ts = pps->CtbAddrRsToTs[slice->slice_segment_address];
+    int end_ts = ts;
+    for (int k = 0; k < t.nsubs; k++) {
+        if (end_ts >= sps->PicSizeInCtbsY) {
+            VERR(hevc, "%d substreams for %d ctbs", t.nsubs, sps->PicSizeInCtbsY);
+            goto out;
+        }
+        t.subs[k].first_ts = end_ts;
+        t.subs[k].start = substream_start(hslice, v, k);
+        if (t.subs[k].start < 0 || t.subs[k].start >= v->len) {
+            VERR(hevc, "entry point %d out of the slice data", k);
+            goto out;
+        }
+        do {
+            end_ts++;
+        } while (end_ts < sps->PicSizeInCtbsY &&
+                 (pps->entropy_coding_sync_enabled_flag
+                      ? pps->CtbAddrTsToRs[end_ts] % width != 0
+                      : pps->TileId[end_ts] == pps->TileId[end_ts - 1]));
+    }
+    // the ctbs each row has once this slice segment is done, the rows it
+    // leaves incomplete wait for the next one
+    target = malloc(sps->PicHeightInCtbsY * sizeof(int));
+    memcpy(target, p->row_done, sps->PicHeightInCtbsY * sizeof(int));
+    for (int i = ts; i < end_ts; i++) {
+        target[pps->CtbAddrTsToRs[i] / width]++;
+    }
+    pthread_mutex_init(&t.lock, NULL);
+    pthread_cond_init(&t.cond, NULL);
+
+    int nthreads = MIN(decoder_threads(dec), t.nsubs);
+    struct hevc_workers *w = NULL;
+    if (nthreads > 1 && workers_reserve(dec, nthreads) > 0) {
+        w = dec->workers;
+        workers_start(w, &t);
+    } else {
+        substream_worker(&t);
+    }
+    // see inloop_rows(), a row is filtered once the row below is complete
+    for (int ry = p->deblock_rows;
+         ry < sps->PicHeightInCtbsY && target[ry] == width; ry++) {
+        if (!substream_wait(&t, ry, width)) {
+            break;
+        }
+        inloop_rows(pps, sps, p, ry);
+    }
+    if (w) {
+        workers_finish(w);
+    }
+    pthread_cond_destroy(&t.cond);
+    pthread_mutex_destroy(&t.lock);
+    p->ctbs_done += end_ts - ts;
+out:
+    free(target);
+    free(t.subs);
+}
+
+// the ctb rows that are complete together with the row below them go through
+// the in-loop filters, see inloop_rows()
+static void inloop_ready_rows(struct pps *pps, struct sps *sps,
+                              struct picture *p) {
+    int end = p->deblock_rows;
+    while (end + 1 < sps->PicHeightInCtbsY &&
+           p->row_done[end] == sps->PicWidthInCtbsY &&
+           p->row_done[end + 1] == sps->PicWidthInCtbsY) {
+        end++;
+    }
+    inloop_rows(pps, sps, p, end);
+}
+
 /* see 7.3.8.1 */
 static void
-parse_slice_segment_data(struct bits_vec *v, struct hevc_slice *hslice,
-        struct hevc_param_set *hps, int SliceAddrRs, struct picture *p)
+parse_slice_segment_data(struct hevc_decoder *dec, struct bits_vec *v,
+        struct hevc_slice *hslice, struct hevc_param_set *hps,
+        struct picture *p)
 {
     struct slice_segment_header *slice = hslice->slice;
-    struct hevc_nalu_header *headr = hslice->nalu;
 
     struct pps *pps = hps->pps[slice->slice_pic_parameter_set_id];
     struct sps *sps = hps->sps[pps->pps_seq_parameter_set_id];
     // struct vps *vps = hps->vps[sps->sps_video_parameter_set_id];
+    int width = sps->PicWidthInCtbsY;
+    bool wpp = pps->entropy_coding_sync_enabled_flag;
 
     uint8_t end_of_slice_segment_flag = 0;
 
     int slice_qpy = pps->init_qp_minus26 + 26 + slice->slice_qp_delta;
 
-    cabac_init_models(slice_qpy, 0);
-
-    /* invoke at the beginning of the decoding process */
-    hslice->rps =
-    process_reference_picture_set((headr->nal_unit_type == IDR_W_RADL ||
-                                  headr->nal_unit_type == IDR_N_LP),
-                                  hslice, hps);
-    process_reference_picture_lists_construction(hslice, hps);
-    process_target_reference_index_for_residual_predication(hslice, hps);
+    // tiles with wavefronts inside them stay on the serial path below
+    if ((pps->entropy_coding_sync_enabled_flag != pps->tiles_enabled_flag) &&
+        slice->num_entry_point_offsets > 0) {
+        substreams_decode(dec, v, hslice, hps, slice_qpy, p);
+        return;
+    }
 
     //see 7.4.7.1 slice_segment_address
-    int CtbAddrInRs = SliceAddrRs;//slice->slice_segment_address;
+    int CtbAddrInRs = slice->slice_segment_address;
     int CtbAddrInTs = pps->CtbAddrRsToTs[CtbAddrInRs];
     VDBG(hevc, "starting CtbAddrInTs %d", CtbAddrInTs);
-    // int i = 0;
-    cabac_dec *d;
-    bool first_ctu_in_tile = true, first_ctu_in_slice_segment = true;
+    cabac_dec *d = cabac_dec_init(v);
+    bool first_ctu_in_slice_segment = true;
     do {
-        // see 7-55, 7-56, but slice->entry_point_offset is alreay accumlated
-        // int firstByte = (i > 0) ? slice->entry_point_offset[i-1]: 0;
-        // int lastByte = (i < (int)slice->num_entry_point_offsets) ? (slice->entry_point_offset[i] - firstByte): v->len;
-        // bits_vec_dump(v);
         VDBG(hevc, "CtbAddrInTs %u, CtbAddrInRs %u, TileId %d", CtbAddrInTs,
              CtbAddrInRs, pps->TileId[CtbAddrInTs]);
 
-        uint32_t xCtb = (CtbAddrInRs % sps->PicWidthInCtbsY) << sps->CtbLog2SizeY;
-        uint32_t yCtb = (CtbAddrInRs / sps->PicWidthInCtbsY) << sps->CtbLog2SizeY;
         //see Figure 9-3
-        if (first_ctu_in_tile || first_ctu_in_slice_segment) {
-            // reset cabac
-            first_ctu_in_tile = false;
+        bool first_ctu_in_tile =
+            CtbAddrInTs == 0 ||
+            pps->TileId[CtbAddrInTs] != pps->TileId[CtbAddrInTs - 1];
+        bool first_ctu_in_row =
+            wpp && (CtbAddrInRs % width == 0 ||
+                    pps->TileId[CtbAddrInTs] !=
+                        pps->TileId[pps->CtbAddrRsToTs[CtbAddrInRs - 1]]);
+        if (first_ctu_in_slice_segment || first_ctu_in_tile || first_ctu_in_row) {
             first_ctu_in_slice_segment = false;
-            d = cabac_dec_init(v);
-        } else if ((xCtb == 0) && pps->entropy_coding_sync_enabled_flag) {
-            //load cabac context with upper-right CTU if it is avaibale and at the start of a line
-            int availableFlagT = process_zscan_order_block_availablity(slice, hps, xCtb, yCtb, xCtb + sps->CtbSizeY, yCtb - sps->CtbSizeY);
-            if (availableFlagT) {
-                sync_process_for_cabac_context(StatCoeff);
+            const struct cabac_ctx_store *store =
+                ctx_start_store(hslice, hps, p, CtbAddrInTs);
+            if (store) {
+                sync_process_for_cabac_context(d, store);
             } else {
-                // reset cabac
+                cabac_init_models(d, slice_qpy, slice_init_type(slice));
             }
-        } else if (first_ctu_in_slice_segment &&
-                   slice->dependent_slice_segment_flag) {
-            first_ctu_in_slice_segment = false;
         }
 
-        (void)coding_tree_unit(d, hslice, hps, CtbAddrInTs, CtbAddrInRs, SliceAddrRs, pps->TileId, p);
+        (void)coding_tree_unit(d, hslice, hps, CtbAddrInTs, CtbAddrInRs,
+                               slice->SliceAddrRs, pps->TileId, p);
 
         // store the second CTU state in a row
         // see Figure 9-4
-        if (pps->entropy_coding_sync_enabled_flag &&
-            (CtbAddrInRs % sps->PicWidthInCtbsY == 1 ||
-             (CtbAddrInRs > 1 &&
-              pps->TileId[pps->CtbAddrRsToTs[CtbAddrInRs - 2]] !=
-                  pps->TileId[CtbAddrInTs]))) {
+        if (wpp && (CtbAddrInRs % width == 1 ||
+                    (CtbAddrInRs > 1 &&
+                     pps->TileId[pps->CtbAddrRsToTs[CtbAddrInRs - 2]] !=
+                         pps->TileId[CtbAddrInTs]))) {
             VDBG(hevc, "storage process for cabac context");
-            storage_process_for_cabac_context(StatCoeff);
+            storage_process_for_cabac_context(d, &p->wpp[CtbAddrInRs / width]);
         }
 
         end_of_slice_segment_flag = cabac_dec_terminate(d);
         VDBG(hevc, "end_of_slice_segment_flag %d", end_of_slice_segment_flag);
-        // bits_vec_dump(v);
+        p->row_done[CtbAddrInRs / width]++;
+        p->ctbs_done++;
         CtbAddrInTs++;
-        if (CtbAddrInTs < sps->PicSizeInCtbsY) {
-            printf("CtbAddrInTs %d, PicSizeInCtbsY %d\n", CtbAddrInTs, sps->PicSizeInCtbsY);
-            CtbAddrInRs = pps->CtbAddrTsToRs[CtbAddrInTs];
-        } else {
-            CtbAddrInRs = sps->PicSizeInCtbsY;
+        if (CtbAddrInTs >= sps->PicSizeInCtbsY) {
             if (!end_of_slice_segment_flag) {
-                printf("error !\n");
-                exit(-1);
+                VERR(hevc, "slice segment data goes on after the last ctb");
             }
+            break;
         }
-
-        VDBG(hevc, "CtbAddrInTs %d TileId[CtbAddrInTs] %d, "
-             "CtbAddrRsToTs[CtbAddrInRs - 1] %d, "
-             "TileId[pps->CtbAddrRsToTs[CtbAddrInRs - 1]] %d",
-             CtbAddrInTs, pps->TileId[CtbAddrInTs],
-             pps->CtbAddrRsToTs[CtbAddrInRs - 1],
-             pps->TileId[pps->CtbAddrRsToTs[CtbAddrInRs - 1]]);
-
-        if (!end_of_slice_segment_flag && ((pps->tiles_enabled_flag && pps->TileId[CtbAddrInTs] != pps->TileId[CtbAddrInTs - 1]) ||
-                (pps->entropy_coding_sync_enabled_flag && (CtbAddrInRs % sps->PicWidthInCtbsY == 0 ||
-                pps->TileId[CtbAddrInTs] != pps->TileId[pps->CtbAddrRsToTs[CtbAddrInRs - 1]])))) {
-            uint8_t end_of_subset_one_bit = cabac_dec_terminate(d); // should be equal to 1
-            assert(end_of_subset_one_bit == 1);
+        CtbAddrInRs = pps->CtbAddrTsToRs[CtbAddrInTs];
+        // pipelined with parsing, rows of other slice segments or tiles may
+        // still be missing
+        inloop_ready_rows(pps, sps, p);
+
+        if (!end_of_slice_segment_flag &&
+            ((pps->tiles_enabled_flag &&
+              pps->TileId[CtbAddrInTs] != pps->TileId[CtbAddrInTs - 1]) ||
+             (wpp && (CtbAddrInRs % width == 0 ||
+                      pps->TileId[CtbAddrInTs] !=
+                          pps->TileId[pps->CtbAddrRsToTs[CtbAddrInRs - 1]])))) {
+            uint8_t end_of_subset_one_bit = cabac_dec_terminate(d);
             if (end_of_subset_one_bit == 0) {
-                return ;
+                VERR(hevc, "end_of_subset_one_bit 0 before ctb %d", CtbAddrInTs);
+                break;
             }
-            bits_vec_dump(v);
-            // VDBG(hevc,"firstByte %d, lastByte %d, len %zu", firstByte, lastByte, (v->ptr - v->start));
-
-            // assert(lastByte == v->ptr - v->start);
+            // the contexts are set up again with the next ctb
             cabac_dec_reset(d);
-            // i ++;
-            // end of entry_point_offset
         }
     } while (!end_of_slice_segment_flag);
+    // see 9.3.2.4, for a dependent slice segment that follows
+    if (end_of_slice_segment_flag && pps->dependent_slice_segments_enabled_flag) {
+        storage_process_for_cabac_context(d, &p->ds);
+    }
     cabac_dec_free(d);
 }
-#define Sign(value) (((value) < 0) ? -1 : ((value) > 0) ? 1 : 0)
-// see 8.7.3.2
-static void sao_ctb_modification_process(struct slice_segment_header *slice, struct pps *pps,
-                                         struct sps *sps, struct picture *p, int16_t *rec, int stride,
-                                         struct ctu *ctu, int cIdx, int rx, int ry,
-                                         int nCtbSw, int nCtbSh) {
-    int bitDepth = ((cIdx == 0) ? sps->BitDepthC : sps->BitDepthC);
-    //see 8-406
-    int xCtb = rx * nCtbSw;
-    int yCtb = ry * nCtbSh;
-    struct sao *sao = ctu->sao;
-    // see 8-407, 8-408
-    for (int j = 0; j < nCtbSh; j++) {
-        for (int i = 0; i < nCtbSw; i++) {
-            int xSi = xCtb + i;
-            int ySj = yCtb + j;
-            if ((rx == (sps->PicWidthInCtbsY - 1) &&
-                 xSi >= (int)sps->pic_width_in_luma_samples) ||
-                (ry == (sps->PicWidthInCtbsY - 1) &&
-                 ySj >= (int)sps->pic_height_in_luma_samples)) {
-                // outside of the picture boundaries
-                // in case the pic_height_in_luma_samples % 64 != 0
-                continue;
-            }
-            int xYi = cIdx == 0 ? xSi : xSi * sps->SubWidthC;
-            int yYj = cIdx == 0 ? ySj : ySj * sps->SubHeightC;
-            if ((sps->pcm &&sps->pcm->pcm_loop_filter_disabled_flag == 1 &&
-                 get_pcm_flag(sps, p, xYi, yYj) == 1) ||
-                 get_cu_transquant_bypass_flag(sps, p, xYi, yYj) == 1 || ctu->sao->SaoTypeIdx[cIdx] == 0) {
-                
-            } else if (sao->SaoTypeIdx[cIdx] == 2) {
-                // Table 8-13
-                const int hPosTable[2][4] = {
-                    {-1, 0, -1, 1},
-                    {1, 0, 1, -1},
-                };
-                const int vPosTable[2][4] = {
-                    {0, -1, -1, -1},
-                    {0, 1, 1, 1}
-                };
-                //  int hPos = hPosTable[sao->SaoEoClass[cIdx]];
-                //  int vPos = vPosTable[sao->SaoEoClass[cIdx]];
-                // see 8-409, 8-410
-                int edgeIdx = 0;
-                bool cond = false;
-                for (int k = 0; k < 2; k++) {
-                    int xSik = xSi + hPosTable[k][sao->SaoEoClass[cIdx]];
-                    int ySjk = ySj + hPosTable[k][sao->SaoEoClass[cIdx]];
-                    int xYik = (cIdx == 0) ? xSik : (xSik * sps->SubWidthC);
-                    int yYjk = (cIdx == 0) ? ySjk : (ySjk * sps->SubHeightC);
-                    if (xSik < 0 || ySjk < 0 ||
-                        xSik >= (int)sps->pic_width_in_luma_samples ||
-                        ySjk >= (int)sps->pic_height_in_luma_samples) {
-                        //outside of the picture boundaries
-                        cond = true;
-                        break;
-                    }
-                    struct ctu * ctuk = get_ctu(sps, p, xSik >> sps->CtbLog2SizeY, ySjk >> sps->CtbLog2SizeY);
-                    if (ctuk->slice_id != ctu->slice_id &&
-                            ((pps->MinTbAddrZs[xYik >> sps->MinTbLog2SizeY][yYjk >> sps->MinTbLog2SizeY] <
-                            pps->MinTbAddrZs[xYi >> sps->MinTbLog2SizeY][yYj >> sps->MinTbLog2SizeY] &&
-                            slice->slice_loop_filter_across_slices_enabled_flag == 0) ||
-                            (pps->MinTbAddrZs[xYi >> sps->MinTbLog2SizeY][yYj >> sps->MinTbLog2SizeY] <
-                            pps->MinTbAddrZs[xYik >> sps->MinTbLog2SizeY][yYjk >> sps->MinTbLog2SizeY] &&
-                            slice->slice_loop_filter_across_slices_enabled_flag == 0))) {
-                        cond = true;
-                        break;
-                    }
-                    if (pps->loop_filter_across_tiles_enabled_flag == 0 &&
-                        (pps->TileId[ctuk->CtbAddrInTs] != pps->TileId[ctu->CtbAddrInTs])) {
-                        cond = true;
-                        break;
-                    }
-                }
-                if (!cond) {
-                    edgeIdx = 2 + Sign(rec[xSi + ySj * stride] -
-                                rec[xSi + hPosTable[0][sao->SaoEoClass[cIdx]] +
-                                    (ySj + vPosTable[0][sao->SaoEoClass[cIdx]]) * stride]) +
-                                Sign(rec[xSi + ySj * stride] - rec[xSi +  hPosTable[1][sao->SaoEoClass[cIdx]] +
-                                    (ySj + vPosTable[1][sao->SaoEoClass[cIdx]]) * stride]);
-                    if (edgeIdx == 0 || edgeIdx == 1 || edgeIdx == 2) {
-                        edgeIdx = (edgeIdx == 2) ? 0 : edgeIdx + 1;
-                    }
-                }
-                if (sao->saoOffsetVal[cIdx][edgeIdx] != 0)
-                    rec[xSi + ySj * stride] = clip3(0, (1<<bitDepth)-1, rec[xSi + ySj *stride] + sao->saoOffsetVal[cIdx][edgeIdx]);
-            } else if (ctu->sao->SaoTypeIdx[cIdx] == 1) {
-                int bandShift = bitDepth - 5;
-                int saoLeftClass = ctu->sao->sao_band_position[cIdx];
-                int bandTable[32] = {0};
-                //see 8-414
-                for (int k = 0; k < 4; k++) {
-                    bandTable[(k + saoLeftClass) & 31] = k + 1;
-                }
-                int bandIdx = bandTable[rec[xSi + ySj * stride] >> bandShift];
-                if (sao->saoOffsetVal[cIdx][bandIdx])
-                    rec[xSi + ySj * stride] = clip3(0, (1 << bitDepth)-1, rec[xSi + ySj * stride] + sao->saoOffsetVal[cIdx][bandIdx]);
-            }
+
+/* the planes of the coding tree metadata share one buffer of the decoder.
+ * It is cleared for each picture, as nb_map and the or-ed
+ * split_transform_flag rely on starting from 0.
+ */
+static void
+pic_meta_init(struct hevc_decoder *dec, struct sps *sps, struct picture *p)
+{
+    int Log2MinPUSize = sps->MinCbLog2SizeY - 1;
+    int cbs = sps->PicWidthInMinCbsY * sps->PicHeightInMinCbsY;
+    int pus = (sps->PicWidthInCtbsY << (sps->CtbLog2SizeY - Log2MinPUSize)) *
+              (sps->PicHeightInCtbsY << (sps->CtbLog2SizeY - Log2MinPUSize));
+    int tbs = (sps->PicWidthInCtbsY << (sps->CtbLog2SizeY - sps->MinTbLog2SizeY)) *
+              (sps->PicHeightInCtbsY << (sps->CtbLog2SizeY - sps->MinTbLog2SizeY));
+    int dbks = (sps->PicWidthInCtbsY << (sps->CtbLog2SizeY - 2)) *
+               (sps->PicHeightInCtbsY << (sps->CtbLog2SizeY - 2));
+    int rows = sps->PicHeightInCtbsY;
+    // the wider fields first, so they all stay aligned
+    size_t size = rows * (sizeof(struct cabac_ctx_store) + sizeof(int)) +
+                  tbs * sizeof(uint32_t) + dbks * sizeof(struct mv_field) +
+                  tbs + cbs * 5 + pus * 2 + dbks;
+    if (size > dec->meta_size) {
+        free(dec->meta);
+        dec->meta = malloc(size);
+        dec->meta_size = size;
+    }
+    uint8_t *m = dec->meta;
+    memset(m, 0, size);
+
+    p->wpp = (struct cabac_ctx_store *)m;
+    m += rows * sizeof(struct cabac_ctx_store);
+    p->row_done = (int *)m;
+    m += rows * sizeof(int);
+    p->ctbs_done = 0;
+
+    p->nb_stride = sps->PicWidthInCtbsY << (sps->CtbLog2SizeY - sps->MinTbLog2SizeY);
+    p->nb_map = (uint32_t *)m;
+    m += tbs * sizeof(uint32_t);
+    // no motion, the same as intra for the neighbours
+    p->mvf = (struct mv_field *)m;
+    m += dbks * sizeof(struct mv_field);
+    p->split_transform_flag = m;
+    m += tbs;
+
+    p->cb_stride = sps->PicWidthInMinCbsY;
+    p->CuPredMode = m;
+    m += cbs;
+    p->ctDepth = m;
+    m += cbs;
+    p->pcm_flag = m;
+    m += cbs;
+    p->cu_transquant_bypass_flag = m;
+    m += cbs;
+    p->qpy = (int8_t *)m;
+    m += cbs;
+
+    p->pu_stride = sps->PicWidthInCtbsY << (sps->CtbLog2SizeY - Log2MinPUSize);
+    p->IntraPredModeY = m;
+    m += pus;
+    p->IntraPredModeC = m;
+    m += pus;
+
+    p->deblock_stride = sps->PicWidthInCtbsY << (sps->CtbLog2SizeY - 2);
+    p->deblock = m;
+}
+
+/* converts p as out asks for, one line at a time. 4:0:0 goes through the
+ * same kernels with a line of mid grey chroma. Returns 1 if the samples were
+ * handed over with HEVC_OUTPUT_YUV and must not be freed, with keep they are
+ * copied instead as later pictures still refer to them.
+ */
+static int
+output_picture(struct sps *sps, struct picture *p, const struct hevc_output *out,
+               bool keep)
+{
+    int width = sps->pic_width_in_luma_samples;
+    int height = sps->pic_height_in_luma_samples;
+    if (out->format == HEVC_OUTPUT_YUV) {
+        struct hevc_yuv *yuv = out->yuv;
+        int16_t *pixel = p->pixel;
+        if (keep) {
+            size_t size = (p->size + 2 * p->uv_size) * sizeof(int16_t);
+            pixel = malloc(size);
+            memcpy(pixel, p->pixel, size);
+        }
+        free(yuv->planes[0]);
+        yuv->planes[0] = (uint16_t *)pixel;
+        yuv->strides[0] = p->y_stride;
+        for (int c = 1; c < 3; c++) {
+            yuv->planes[c] = p->uv_size ?
+                (uint16_t *)(pixel + p->size + (c - 1) * p->uv_size) : NULL;
+            yuv->strides[c] = p->uv_size ? p->uv_stride : 0;
+        }
+        yuv->width = width;
+        yuv->height = height;
+        yuv->chroma_format_idc = sps->ChromaArrayType ? sps->chroma_format_idc : 0;
+        yuv->bitdepth = sps->BitDepthY;
+        return !keep;
+    }
+
+    int bpp = (out->format == HEVC_OUTPUT_RGBA64) ? 8 : 4;
+    struct hevc_output whole = {
+        .pixels = out->pixels,
+        .pitch = p->y_stride * bpp,
+        .width = width,
+        .height = height,
+        .format = out->format,
+    };
+    if (out->pitch == 0) {
+        out = &whole;
+    }
+    int out_width = MIN(width, out->width);
+    int out_height = MIN(height, out->height);
+    const struct hevc_dsp *dsp = hevc_dsp_get();
+    int bitdepth = sps->BitDepthY;
+    int sub = (sps->SubWidthC == 2);
+    int16_t *grey = NULL;
+    if (p->uv_size == 0) {
+        grey = malloc(out_width * sizeof(int16_t));
+        for (int i = 0; i < out_width; i++) {
+            grey[i] = 1 << (bitdepth - 1);
+        }
+        sub = 0;
+    }
+    for (int i = 0; i < out_height; i++) {
+        const int16_t *y = p->pixel + i * p->y_stride;
+        const int16_t *u = grey, *v = grey;
+        if (!grey) {
+            int off = (i / sps->SubHeightC) * p->uv_stride;
+            u = pic_plane(p, 1) + off;
+            v = pic_plane(p, 2) + off;
+        }
+        uint8_t *dst = out->pixels + i * out->pitch;
+        if (out->format == HEVC_OUTPUT_RGBA64) {
+            dsp->yuv_rgba64((uint16_t *)dst, y, u, v, out_width, sub, bitdepth);
+        } else {
+            dsp->yuv_bgra32(dst, y, u, v, out_width, sub, bitdepth);
         }
     }
+    free(grey);
+    return 0;
 }
 
-// see 8.7.3.1 sample adaptive offset process
-// this proccess is after deblocking filter process
-void sao_filter(struct slice_segment_header *slice, struct pps *pps, struct sps *sps, struct picture *p)
+// the ctus of the picture with their sao parameters
+static void
+free_pic_ctus(struct hevc_decoder *dec)
 {
-    VDBG(hevc, "run sao_filter");
-    struct ctu * ctu;
-    for (int ry = 0; ry < sps->PicHeightInCtbsY; ry ++) {
-        for (int rx = 0; rx < sps->PicWidthInCtbsY; rx ++) {
-            ctu = get_ctu(sps, p, rx, ry);
-            if (slice->slice_sao_luma_flag) {
-                //invoke 8.7.3.2 for luma
-                sao_ctb_modification_process(slice, pps, sps, p, p->pixel, p->y_stride, ctu, 0, rx, ry, sps->CtbSizeY, sps->CtbSizeY);
-            }
-            if (sps->ChromaArrayType != 0 && slice->slice_sao_chroma_flag) {
-                //invoke 8.7.3.2 for Cb and Cr
-                sao_ctb_modification_process(slice, pps, sps, p, p->pixel + p->size, p->uv_stride, ctu,  0, rx, ry, (1 << sps->CtbLog2SizeY)/sps->SubWidthC, (1 << sps->CtbLog2SizeY)/sps->SubHeightC);
-                sao_ctb_modification_process(slice, pps, sps, p, p->pixel + p->size * 3/2, p->uv_stride, ctu,  0, rx, ry, (1 << sps->CtbLog2SizeY)/sps->SubWidthC, (1 << sps->CtbLog2SizeY)/sps->SubHeightC);
-            }
+    for (int i = 0; i < dec->ctus_size; i++) {
+        if (dec->ctus[i]) {
+            free(dec->ctus[i]->sao);
+            free(dec->ctus[i]);
+            dec->ctus[i] = NULL;
         }
     }
 }
 
-//see 8.7.2
-static void deblock_filter(struct slice_segment_header*slice UNUSED, struct sps *sps UNUSED, struct picture *p UNUSED)
+/* see 8.1.3, sets up the dpb and a frame for the picture slice is the first
+ * slice segment of. Returns -1 if the picture is not decoded.
+ */
+static int
+picture_start(struct hevc_decoder *dec, const struct hevc_nalu_header *h,
+              struct sps *sps, const struct slice_segment_header *slice)
 {
-
+    int type = h->nal_unit_type;
+    if (IS_IRAP(type)) {
+        // NoRaslOutputFlag, a cra is only a starting point at the beginning
+        dec->no_rasl_output = IS_IDR(type) || IS_BLA(type) || !dec->seen_irap;
+        dec->seen_irap = 1;
+    } else if (!dec->seen_irap) {
+        VERR(hevc, "no irap picture to start decoding with");
+        return -1;
+    }
+    // see 8.3.3.1, the leading pictures the stream does not hold the
+    // references of
+    if (IS_RASL(type) && dec->no_rasl_output) {
+        return -1;
+    }
+    dpb_init(dec);
+    int poc = pic_order_cnt(dec, sps, h, slice);
+
+    struct picture *p = calloc(1, sizeof(struct picture));
+    reference_picture_set(dec, sps, h, slice, p, poc);
+    struct hevc_frame *f = dpb_free_frame(dec);
+    if (!f) {
+        VERR(hevc, "no room in the dpb for picture %d", poc);
+        free(p);
+        return -1;
+    }
+    frame_alloc(f, sps);
+    f->poc = poc;
+    f->marking = UNUSED_FOR_REFERENCE;
+    f->decoding = 1;
+
+    p->frame = f;
+    p->pixel = f->pixel;
+    p->size = f->size;
+    p->uv_size = f->uv_size;
+    p->y_stride = f->y_stride;
+    p->uv_stride = f->uv_stride;
+    pic_meta_init(dec, sps, p);
+    if (sps->sample_adaptive_offset_enabled_flag) {
+        int sao_size = 5 * (p->y_stride + 2);
+        if (sao_size > dec->sao_size) {
+            free(dec->sao_line);
+            dec->sao_line = malloc(sao_size * sizeof(int16_t));
+            dec->sao_size = sao_size;
+        }
+        p->sao_line = dec->sao_line;
+    }
+    if (sps->PicSizeInCtbsY > dec->ctus_size) {
+        free_pic_ctus(dec);
+        free(dec->ctus);
+        dec->ctus = calloc(sps->PicSizeInCtbsY, sizeof(struct ctu *));
+        dec->ctus_size = sps->PicSizeInCtbsY;
+    }
+    p->ctus = dec->ctus;
+    dec->pic = p;
+    return 0;
 }
 
-//see 8.7
-static void inloop_filter(struct slice_segment_header*slice, struct pps *pps, struct sps *sps, struct picture *p)
+/* the picture goes to the dpb as a short term reference, the rps of a later
+ * one decides for how long. out is NULL for one that lacks slices and only
+ * stands in as a reference.
+ */
+static void
+picture_done(struct hevc_decoder *dec, struct pps *pps, struct sps *sps,
+             const struct slice_segment_header *slice,
+             const struct hevc_output *out)
 {
-    // When the in-loop filter process is specified as optional in Annex
-    // A, the application of either or both of these filters is optional.
-    // deblocking filter
-    // invoke 8.7.2
-    deblock_filter(slice, sps, p);
-    // sao (sample adaptive offset) filter
-    sps->sample_adaptive_offset_enabled_flag = 0;
-    if (sps->sample_adaptive_offset_enabled_flag == 1) {
-        // invoke 8.7.3
-        sao_filter(slice, pps, sps, p);
-    }
+    struct picture *p = dec->pic;
+    struct hevc_frame *f = p->frame;
+
+    f->marking = USED_FOR_SHORT_TERM_REFERENCE;
+    f->decoding = 0;
+    if (out) {
+        //see 8.7, the rows left over by parse_slice_segment_data()
+        inloop_rows(pps, sps, p, sps->PicHeightInCtbsY);
+        if (slice->pic_output_flag) {
+            // nothing refers to the pictures of a stream without a dpb, the
+            // samples are handed over then
+            int HighestTid = sps->sps_max_sub_layer_minus1;
+            bool keep = sps->sps_sublayers[HighestTid].sps_max_dec_pic_buffering_minus1 > 0;
+            if (output_picture(sps, p, out, keep)) {
+                f->pixel = NULL;
+                f->pixel_size = 0;
+                f->marking = UNUSED_FOR_REFERENCE;
+            }
+        }
+    }
+    free_pic_ctus(dec);
+    free(p);
+    dec->pic = NULL;
 }
 
-static void parse_slice_segment_layer(struct hevc_nalu_header *headr,
+static void parse_slice_segment_layer(struct hevc_decoder *dec,
+                                      struct hevc_nalu_header *headr,
                                       struct bits_vec *v,
-                                      struct hevc_param_set *hps,
-                                      uint8_t **pixels) {
-    uint32_t SliceAddrRs;
+                                      const struct hevc_output *out,
+                                      const int *epb, int num_epb) {
+    struct hevc_param_set *hps = dec->hps;
     struct hevc_slice hslice = {
         .nalu = headr,
+        .epb = epb,
+        .num_epb = num_epb,
     };
 
-    hslice.slice = parse_slice_segment_header(v, headr, hps, &SliceAddrRs);
-
-    struct pps *pps = hps->pps[hslice.slice->slice_pic_parameter_set_id];
+    struct slice_segment_header *slice =
+        parse_slice_segment_header(v, headr, hps, dec->slice);
+    if (!slice) {
+        return;
+    }
+    hslice.slice = slice;
+    struct pps *pps = hps->pps[slice->slice_pic_parameter_set_id];
     struct sps *sps = hps->sps[pps->pps_seq_parameter_set_id];
     // struct vps *vps = hps->vps[sps->sps_video_parameter_set_id];
 
+    if (slice->first_slice_segment_in_pic_flag) {
+        if (dec->pic) {
+            VERR(hevc, "picture %d ends with %d ctbs missing", dec->pic->frame->poc,
+                 sps->PicSizeInCtbsY - dec->pic->ctbs_done);
+            picture_done(dec, pps, sps, slice, NULL);
+        }
+        if (picture_start(dec, headr, sps, slice) < 0) {
+            free_slice_segment_header(slice);
+            return;
+        }
+    } else if (!dec->pic) {
+        // the picture was skipped or its first slice segment is lost
+        free_slice_segment_header(slice);
+        return;
+    }
+    struct picture *p = dec->pic;
+
     VDBG(hevc, "scaling_list_enabled_flag %d", sps->scaling_list_enabled_flag);
     if (sps->scaling_list_enabled_flag) {
         if (pps->pps_scaling_list_data_present_flag) {
-            init_scaling_factor(hslice.slice, sps, &pps->list_data);
+            init_scaling_factor(slice, sps, &pps->list_data);
         } else if (sps->sps_scaling_list_data_present_flag) {
-            init_scaling_factor(hslice.slice, sps, sps->list_data);
+            init_scaling_factor(slice, sps, sps->list_data);
+        } else {
+            init_scaling_factor(slice, sps, NULL);
         }
     }
     // bits_vec_dump(v);
     //we have process the segment header done, reinit for segment_data, move pointer
     bits_vec_reinit_cur(v);
     // bits_vec_dump(v);
-    int width = sps->pic_width_in_luma_samples;
-    int height = ((sps->pic_height_in_luma_samples + 3)>>2)<<2;
-    int y_stride = ((width + 3) >> 2) << 2;
-    int uv_stride = y_stride >> 1;
-    struct picture p = {
-        .size = height * y_stride,
-        .pixel = calloc(height * y_stride * 2, sizeof(int16_t)),
-        .y_stride = y_stride,
-        .uv_stride = uv_stride,
-    };
-    int Log2MinPUSize = sps->MinCbLog2SizeY - 1;
-    int PicWidthInMinPUs = sps->PicWidthInCtbsY
-                           << (sps->CtbLog2SizeY - Log2MinPUSize);
-    int PicHeightInMinPUs = sps->PicHeightInCtbsY
-                            << (sps->CtbLog2SizeY - Log2MinPUSize);
-    p.IntraPredModeY =
-        calloc(PicWidthInMinPUs * PicHeightInMinPUs, sizeof(uint8_t));
-    p.IntraPredModeC =
-        calloc(PicWidthInMinPUs * PicHeightInMinPUs, sizeof(uint8_t));
-
-    p.info = calloc(sps->PicWidthInMinCbsY * sps->PicHeightInMinCbsY,
-                    sizeof(struct cu_info));
-
-    int PicWidthInTbsY = sps->PicWidthInCtbsY << (sps->CtbLog2SizeY - sps->MinTbLog2SizeY);
-    int PicHeightInTbsY = sps->PicHeightInCtbsY << (sps->CtbLog2SizeY - sps->MinTbLog2SizeY);
-
-    p.split_transform_flag = calloc(PicWidthInTbsY * PicHeightInTbsY, sizeof(uint8_t));
-    p.ctus = malloc(sizeof(struct ctu *) * sps->PicHeightInCtbsY * sps->PicWidthInCtbsY);
-    p.slice_num ++;
-    p.slices = realloc(p.slices, p.slice_num * sizeof(struct slice_segment_header *));
 
-    parse_slice_segment_data(v, &hslice, hps, SliceAddrRs, &p);
-    bits_vec_dump(v);
-    if (!bits_vec_aligned(v)) {
-        rbsp_trailing_bits(v);
+    // see 8.3.4, once per slice, a dependent segment gets the same lists
+    hslice.poc = p->frame->poc;
+    if (ref_pic_lists(&hslice, p) == 0) {
+        parse_slice_segment_data(dec, v, &hslice, hps, p);
+        if (!bits_vec_aligned(v)) {
+            rbsp_trailing_bits(v);
+        }
     }
 
-    inloop_filter(hslice.slice, pps, sps, &p);
-
-    if (sps->chroma_format_idc == CHROMA_420) {
-        YUV420_to_BGRA32_16bit(*pixels, ((y_stride * 32 + 32 - 1) >> 5) << 2, p.pixel,
-                p.pixel+p.size, p.pixel+p.size * 3/2, y_stride, uv_stride, divceil(height, (1 << sps->CtbLog2SizeY)),
-                divceil(width, (1 << sps->CtbLog2SizeY)), 1 << sps->CtbLog2SizeY);
-    } else if (sps->chroma_format_idc == CHROMA_422) {
-        VDBG(hevc, "we got CHROMA_422");
-
-    } else if (sps->chroma_format_idc == CHROMA_444) {
-        VDBG(hevc, "we got CHROMA_444");
-
-    } else if (sps->chroma_format_idc == CHROMA_400) {
-        VDBG(hevc, "we got CHROME_400");
-        YUV400_to_BGRA32_16bit(
-            *pixels, ((y_stride * 32 + 32 - 1) >> 5) << 2, p.pixel,
-            y_stride,
-            divceil(height, (1 << sps->CtbLog2SizeY)),
-            divceil(width, (1 << sps->CtbLog2SizeY)), 1 << sps->CtbLog2SizeY);
+    if (p->ctbs_done >= sps->PicSizeInCtbsY) {
+        picture_done(dec, pps, sps, slice, out);
     }
+    // the independent header stays for the dependent segments after it
+    if (slice->dependent_slice_segment_flag) {
+        free_slice_segment_header(slice);
+    } else {
+        free_slice_segment_header(dec->slice);
+        dec->slice = slice;
+    }
+}
 
-    free(p.pixel);
-    free(p.info);
-    free(p.split_transform_flag);
-    free(p.IntraPredModeC);
-    free(p.IntraPredModeY);
-    for (int i = 0; i < sps->PicHeightInCtbsY * sps->PicWidthInCtbsY; i++) {
-        if (p.ctus[i]) {
-            if (p.ctus[i]->sao) {
-                free(p.ctus[i]->sao);
+/* a parameter set replaces the one with the same id, the tables derived
+ * from an sps go with it
+ */
+static void
+replace_sps(struct hevc_param_set *hps, struct sps *sps)
+{
+    struct sps *old = hps->sps[sps->sps_seq_parameter_set_id];
+    if (old) {
+        for (int i = 0; i < 64; i++) {
+            if (hps->pps[i] && hps->pps[i]->derived_sps == old) {
+                free_pps_tables(hps->pps[i]);
             }
-            free(p.ctus[i]);
         }
+        free_sps(old);
     }
-    free(p.ctus);
-    if (hslice.rps) {
-        free(hslice.rps);
-    }
-    free(hslice.slice);
+    hps->sps[sps->sps_seq_parameter_set_id] = sps;
 }
 
-uint16_t
-parse_nalu(uint8_t *data, int len, uint8_t **pixels, struct hevc_param_set *hps)
+static uint16_t
+decode_nalu(struct hevc_decoder *dec, uint8_t *data, int len, uint8_t **pixels,
+            const struct hevc_output *out)
 {
+    struct hevc_param_set *hps = dec->hps;
     struct hevc_nalu_header h;
     h.forbidden_zero_bit = (data[0] & 0x80) >> 7;
     h.nal_unit_type = (data[0] & 0x7E) >> 1;
@@ -7311,36 +9239,48 @@ parse_nalu(uint8_t *data, int len, uint8_t **pixels, struct hevc_param_set *hps)
     struct sps *new_sps = NULL;
     struct pps *new_pps = NULL;
 
-    uint8_t *rbsp = malloc(len - 2);
-
-    // See 7.3.1.1
-    int nrbsp = 0;
-    uint8_t *p = data + 2;
-    for (int l = 2; l < len; l ++) {
-        if ((l + 2 < len) && ((p[0]<<16| p[1]<<8| p[2]) == 0x3)) {
-            rbsp[nrbsp++] = p[0];
-            rbsp[nrbsp++] = p[1];
-            l += 2;
-            /* skip third byte */
-            p += 3;
-        } else {
-            rbsp[nrbsp++] = *p;
-            p++;
-        }
+    // See 7.3.1.1, into the buffers kept with the decoder
+    if (len > dec->nal_size) {
+        free(dec->rbsp);
+        free(dec->epb);
+        dec->rbsp = malloc(len);
+        dec->epb = malloc((len / 3 + 1) * sizeof(int));
+        dec->nal_size = len;
     }
+    uint8_t *rbsp = dec->rbsp;
+    int *epb = dec->epb;
+    int num_epb = 0;
+    int nrbsp = hevc_dsp_get()->unescape(rbsp, data + 2, len - 2, epb, &num_epb);
 
     struct bits_vec *v = bits_vec_alloc(rbsp, nrbsp, BITS_MSB);
 
     switch (h.nal_unit_type) {
+    case TRAIL_N:
+    case TRAIL_R:
+    case TSA_N:
+    case TSA_R:
+    case STSA_N:
+    case STSA_R:
+    case RADL_N:
+    case RADL_R:
+    case RASL_N:
+    case RASL_R:
+    case BLA_W_LP:
+    case BLA_W_RADL:
+    case BLA_N_LP:
     case IDR_W_RADL:
     case IDR_N_LP:
+    case CRA_NUT:
         // hexdump(stdout, "data: ", "", data, 32);
         // printf("nrbsp %d\n", nrbsp);
         // hexdump(stdout, "rbsp: ", "", rbsp, 32);
-        parse_slice_segment_layer(&h, v, hps, pixels);
+        parse_slice_segment_layer(dec, &h, v, out, epb, num_epb);
         break;
     case VPS_NUT:
         new_vps = parse_vps(v);
+        if (hps->vps[new_vps->vps_video_parameter_set_id]) {
+            free_vps(hps->vps[new_vps->vps_video_parameter_set_id]);
+        }
         hps->vps[new_vps->vps_video_parameter_set_id] = new_vps;
         *pixels = (uint8_t *)new_vps;
         break;
@@ -7348,75 +9288,150 @@ parse_nalu(uint8_t *data, int len, uint8_t **pixels, struct hevc_param_set *hps)
         new_sps = parse_sps(&h, v, new_vps);
         if (!new_sps) {
             VERR(hevc, "can no parse sps correctly");
-            exit(-1);
+            break;
         }
         *pixels = (uint8_t *)new_sps;
-        hps->sps[new_sps->sps_seq_parameter_set_id] = new_sps;
+        replace_sps(hps, new_sps);
         break;
     case PPS_NUT:
         new_pps = parse_pps(v);
         if (!new_pps) {
             VERR(hevc, "can no parse pps correctly");
-            exit(-1);
+            break;
         }
         *pixels = (uint8_t *)new_pps;
+        if (hps->pps[new_pps->pps_pic_parameter_set_id]) {
+            free_pps(hps->pps[new_pps->pps_pic_parameter_set_id]);
+        }
         hps->pps[new_pps->pps_pic_parameter_set_id] = new_pps;
         break;
     case PREFIX_SEI_NUT:
     case SUFFIX_SEI_NUT:
         /* this is not necessary for decoding a picture */
-        parse_sei(v);
+        free(parse_sei(v));
         break;
     default:
         VDBG(hevc, "unhandle nal_unit_type %d", h.nal_unit_type);
         break;
     }
+    v->buff = NULL;
     bits_vec_free(v);
     return h.nal_unit_type;
 }
 
+struct hevc_decoder *
+hevc_decoder_init(struct hevc_param_set *hps)
+{
+    struct hevc_decoder *dec = calloc(1, sizeof(struct hevc_decoder));
+    if (!hps) {
+        hps = calloc(1, sizeof(struct hevc_param_set));
+        dec->own_hps = 1;
+    }
+    dec->hps = hps;
+    return dec;
+}
+
+uint16_t
+hevc_decoder_decode_nal(struct hevc_decoder *dec, uint8_t *data, int len,
+                        const struct hevc_output *out)
+{
+    uint8_t *xps = NULL;
+    return decode_nalu(dec, data, len, &xps, out);
+}
+
+void
+hevc_decoder_flush(struct hevc_decoder *dec)
+{
+    if (dec->ctus) {
+        free_pic_ctus(dec);
+    }
+    free(dec->pic);
+    free_slice_segment_header(dec->slice);
+    if (dec->dpb) {
+        for (int i = 0; i < HEVC_DPB_SIZE; i++) {
+            free(dec->dpb[i].pixel);
+            free(dec->dpb[i].col);
+        }
+    }
+    free(dec->dpb);
+    free(dec->rbsp);
+    free(dec->epb);
+    free(dec->meta);
+    free(dec->ctus);
+    free(dec->sao_line);
+    dec->pic = NULL;
+    dec->slice = NULL;
+    dec->dpb = NULL;
+    dec->prev_tid0_poc = 0;
+    dec->seen_irap = 0;
+    dec->no_rasl_output = 0;
+    dec->rbsp = NULL;
+    dec->epb = NULL;
+    dec->nal_size = 0;
+    dec->meta = NULL;
+    dec->meta_size = 0;
+    dec->ctus = NULL;
+    dec->ctus_size = 0;
+    dec->sao_line = NULL;
+    dec->sao_size = 0;
+}
+
+void
+hevc_decoder_destroy(struct hevc_decoder *dec)
+{
+    if (!dec) {
+        return;
+    }
+    hevc_decoder_flush(dec);
+    workers_destroy(dec->workers);
+    if (dec->own_hps) {
+        free_hevc_param_set(dec->hps);
+        free(dec->hps);
+    }
+    free(dec);
+}
+
+uint16_t
+parse_nalu(uint8_t *data, int len, uint8_t **pixels, struct hevc_param_set *hps)
+{
+    struct hevc_decoder dec = {.hps = hps};
+    struct hevc_output out = {
+        .pixels = *pixels,
+    };
+    uint16_t type = decode_nalu(&dec, data, len, pixels, &out);
+    hevc_decoder_flush(&dec);
+    workers_destroy(dec.workers);
+    return type;
+}
+
+uint16_t
+hevc_decode_nalu(uint8_t *data, int len, const struct hevc_output *out,
+                 struct hevc_param_set *hps)
+{
+    struct hevc_decoder dec = {.hps = hps};
+    uint16_t type = hevc_decoder_decode_nal(&dec, data, len, out);
+    hevc_decoder_flush(&dec);
+    workers_destroy(dec.workers);
+    return type;
+}
+
 void free_hevc_param_set(struct hevc_param_set *hps)
 {
-    for (int i = 0; i < 16; i++) {
+    for (int i = 0; i < 64; i++) {
         if (hps->pps[i]) {
-            if (hps->pps[i]->pps_3d_ext)
-                free(hps->pps[i]->pps_3d_ext);
-            if (hps->pps[i]->pps_multilayer_ext)
-                free(hps->pps[i]->pps_multilayer_ext);
-            free(hps->pps[i]->column_width_minus1);
-            free(hps->pps[i]->row_height_minus1);
-            free(hps->pps[i]->CtbAddrTsToRs);
-            free(hps->pps[i]->CtbAddrRsToTs);
-            free(hps->pps[i]->TileId);
-            free(hps->pps[i]);
+            free_pps(hps->pps[i]);
             hps->pps[i] = NULL;
         }
     }
     for (int i = 0; i < 16; i++) {
         if (hps->sps[i]) {
-            if (hps->sps[i]->list_data)
-                free(hps->sps[i]->list_data);
-            if (hps->sps[i]->pcm)
-                free(hps->sps[i]->pcm);
-            if (hps->sps[i]->sps_st_ref)
-                free(hps->sps[i]->sps_st_ref);
-            if (hps->sps[i]->sps_lt_ref)
-                free(hps->sps[i]->sps_lt_ref);
-            if (hps->sps[i]->vui)
-                free(hps->sps[i]->vui);
-            free(hps->sps[i]);
+            free_sps(hps->sps[i]);
             hps->sps[i] = NULL;
         }
     }
     for (int i = 0; i < 16; i++) {
         if (hps->vps[i]) {
-            if (hps->vps[i]->vps_timing_info)
-                free(hps->vps[i]->vps_timing_info);
-            if (hps->vps[i]->vps_ext)
-                free(hps->vps[i]->vps_ext);
-            if (hps->vps[i]->vps_3d_ext)
-                free(hps->vps[i]->vps_3d_ext);
-            free(hps->vps[i]);
+            free_vps(hps->vps[i]);
             hps->vps[i] = NULL;
         }
     }
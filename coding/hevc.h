@@ -680,6 +680,8 @@ struct pps {
     int *CtbAddrRsToTs;
     int *TileId;
     int ** MinTbAddrZs;
+    // the sps the tables above were derived with, see activate_param_sets()
+    struct sps *derived_sps;
 };
 
 
@@ -748,7 +750,7 @@ struct st_ref_pic_set {
     struct {
         uint8_t used_by_curr_pic_flag:1;
         uint8_t use_delta_flag:1;
-    } ref_used[16];
+    } ref_used[17];
 
     GUE(num_negative_pics);
     GUE(num_positive_pics);
@@ -757,11 +759,19 @@ struct st_ref_pic_set {
 
     GUE(delta_poc_s1_minus1)[16];
     uint8_t used_by_curr_pic_s1_flag[16];
+
+    // the set itself, see (7-61) to (7-72)
+    int NumNegativePics;
+    int NumPositivePics;
+    int DeltaPocS0[16];
+    int DeltaPocS1[16];
+    uint8_t UsedByCurrPicS0[16];
+    uint8_t UsedByCurrPicS1[16];
 };
 
 /* long term reference picture set syntax */
 struct lt_ref_pic_set {
-    uint8_t* lt_ref_pic_poc_lsb_sps; // variable
+    uint16_t* lt_ref_pic_poc_lsb_sps; // variable
     uint8_t* used_by_curr_pic_lt_sps_flag;
 };
 
@@ -949,6 +959,7 @@ struct sps {
     int MinTbLog2SizeY;
     int MaxTbLog2SizeY;
     uint8_t ChromaArrayType;
+    uint8_t derived; // the variables above are set
 };
 
 
@@ -995,14 +1006,14 @@ struct sao {
     // uint32_t sao_type_idx_chroma;
     uint8_t SaoEoClass[3]; // 0: 1d 0-degree; 1: 1d 90-degree; 2: 1d 135-degree; 3: 1d 45-degree;
     uint8_t SaoTypeIdx[3]; // 0: not applied; 1: band offset; 2: edge offset;
-    int saoOffsetVal[3][4];
+    int16_t saoOffsetVal[3][5]; // see 7-72, [0] is always 0
 };
 
 
 
 struct slice_long_term {
     uint8_t lt_idx_sps;
-    uint8_t poc_lsb_lt;
+    uint16_t poc_lsb_lt;
     uint8_t used_by_curr_pic_lt_flag:1;
     uint8_t delta_poc_msb_present_flag:1;
     GUE(delta_poc_msb_cycle_lt);
@@ -1020,18 +1031,21 @@ struct palette_predictor_entries {
 };
 
 typedef struct {
-    int x;
-    int y;
+    uint8_t x;
+    uint8_t y;
 } scanpos;
 
 struct slice_segment_header {
     int idx;
 
+    uint8_t first_slice_segment_in_pic_flag : 1;
     uint8_t no_output_of_prior_pics_flag : 1;
     uint8_t dependent_slice_segment_flag : 1;
 
     GUE(slice_pic_parameter_set_id);
     uint32_t slice_segment_address;
+    // the address of the first ctb of the slice, see 7.4.7.1
+    uint32_t SliceAddrRs;
 
     GUE(slice_type);
     uint8_t pic_output_flag:1;
@@ -1049,7 +1063,7 @@ struct slice_segment_header {
     GUE(num_long_term_sps);
     GUE(num_long_term_pics);
 
-    uint8_t *PocLsbLt;
+    uint16_t *PocLsbLt;
     uint8_t *UsedByCurrPicLt;
     struct slice_long_term* terms;
 
@@ -1075,13 +1089,6 @@ struct slice_segment_header {
     GUE(num_ref_idx_l0_active_minus1);
     GUE(num_ref_idx_l1_active_minus1);
 
-    int DeltaPocS0[64][64];
-    int DeltaPocS1[64][64];
-    int UsedByCurrPicS0[64][64];
-    int UsedByCurrPicS1[64][64];
-    int NumPositivePics[64];
-    int NumNegativePics[64];
-    int NumDeltaPocs[64];
     int NumPicTotalCurr;
 
     uint8_t ref_pic_list_modification_flag_l0;
@@ -1093,8 +1100,18 @@ struct slice_segment_header {
     uint8_t mvd_l1_zero_flag:1;
     uint8_t cabac_init_flag:1;
 
+    uint8_t collocated_from_l0_flag:1;
     GUE(collocated_ref_idx);
 
+    // pred_weight_table, see (7-56) and the semantics in 7.4.7.3. The
+    // offsets are scaled to the bit depth already
+    GUE(luma_log2_weight_denom);
+    int ChromaLog2WeightDenom;
+    int16_t LumaWeight[2][16];
+    int16_t LumaOffset[2][16];
+    int16_t ChromaWeight[2][16][2];
+    int16_t ChromaOffset[2][16][2];
+
     uint8_t slice_ic_enabled_flag;
     uint8_t slice_ic_disabled_merge_zero_idx_flag;
 
@@ -1110,6 +1127,7 @@ struct slice_segment_header {
     GSE(slice_act_cr_qp_offset);
     uint8_t cu_chroma_qp_offset_enabled_flag:1;
 
+    uint8_t slice_deblocking_filter_disabled_flag:1;
     GSE(slice_beta_offset_div2);
     GSE(slice_tc_offset_div2);
 
@@ -1136,12 +1154,6 @@ struct slice_segment_header {
     //palette_predictor_entries
     struct palette_predictor_entries ppe;
 
-    // [log2BlockSize][scanIdx][sPos][sComp]
-    // log2BlockSize range 2-5, 
-    // scanIdx 0-2: 0 for up-right, 1 for horizontal, 2 for vertical, 3 for traverse
-    // sPos range 0 - blkSize * blkSize,
-    scanpos* ScanOrder[6][4];
-
     uint8_t ScalingFactor[4][6][64][64];
 };
 
@@ -1158,28 +1170,6 @@ struct pcm_sample {
     int *pcm_sample_chroma;
 };
 
-struct mvd_coding {
-    uint8_t abs_mvd_greater0_flag[2];
-    uint8_t abs_mvd_greater1_flag[2];
-    uint8_t mvd_sign_flag[2];
-    uint32_t abs_mvd_minus2[2];
-};
-
-struct predication_unit {
-    uint8_t mvp_l0_flag; /* the motion vector predictor index of list 0*/
-    uint8_t mvp_l1_flag; /* the motion vector predictor index of list 1*/
-    uint8_t merge_flag; /* whether the inter prediction parameters for the current prediction
-                         unit are inferred from a neighbouring inter-predicted partition */
-    int merge_idx;      /* merging candidate index of the merging candidate list */
-    int inter_pred_idc; /* whether list0, list1, or bi-prediction is used for
-                          the current prediction unit. see  @enum inter_pred_mpde*/
-    int ref_idx_l0;     /* list 0 reference picture index for the current prediction unit */
-    int ref_idx_l1;     /* list 1 reference picture index for the current prediction unit */
-    struct mvd_coding mvd;
-    int MvdL1[64][64][2];
-};
-
-
 enum part_mode {
     PART_2Nx2N = 0,
     PART_2NxN,
@@ -1207,8 +1197,8 @@ struct trans_tree {
     int8_t transform_skip_flag[4][32][32];
     // see 7.4.9.10
     uint8_t tu_residual_act_flag[32][32];
-    int16_t TransCoeffLevel[3][32][32]; // 3 for color index, 0 for Y, 1 for Cb,
-                                        // 2 for Cr
+    // 3 for color index, 0 for Y, 1 for Cb, 2 for Cr
+    int16_t TransCoeffLevel[3][32][32] __attribute__((aligned(32)));
     int numSigCoeff[3];
     int tu_num;
 };
@@ -1294,7 +1284,6 @@ struct cu {
 #ifdef ENABLE_3D
     struct cu_extension **ext;
 #endif
-    struct predication_unit pu[8][8];
 
     struct trans_tree tt;
 
@@ -1321,6 +1310,11 @@ struct chroma_qp_offset {
 struct ctu {
     struct sao *sao;
     int slice_id;
+    int SliceAddrRs;
+    // offsets of the slice, the deblocking filter looks them up by ctb
+    int8_t beta_offset_div2;
+    int8_t tc_offset_div2;
+    uint8_t loop_filter_across_slices;
 
     int cu_num;
     // struct cu *cu[64]; // MAX is 64*64 CTU divided into 64 numbers of 8*8 cu
@@ -1335,16 +1329,129 @@ struct hevc_param_set {
     struct pps *pps[64]; // for several pictures
 };
 
+struct hevc_frame;
+struct picture;
+
 struct hevc_slice {
     struct hevc_nalu_header *nalu;
     struct slice_segment_header *slice;
-    struct rps *rps;
+
+    // see 8.3.4, the frames of the dpb the reference indices point to
+    struct hevc_frame *RefPicList[2][16];
+    struct hevc_frame *ColPic;
+    int poc;
+    // no reference picture follows the current one in output order, see
+    // 8.5.3.2.8
+    uint8_t NoBackwardPredFlag;
+
+    // rbsp offsets of the bytes that followed a dropped
+    // emulation_prevention_three_byte, the entry points still count them
+    const int *epb;
+    int num_epb;
 };
 
 #pragma pack(pop)
 
+enum hevc_output_format {
+    HEVC_OUTPUT_BGRA32 = 0, // 8 bits per channel
+    HEVC_OUTPUT_RGBA64,     // 16 bits per channel, keeps 10 and 12 bit samples
+    HEVC_OUTPUT_YUV,        // the decoded planes as they are, see hevc_yuv
+};
+
+/* the planes handed over with HEVC_OUTPUT_YUV, no conversion or copy. The
+ * samples have bitdepth bits in 16, chroma planes are subsampled as given by
+ * chroma_format_idc and NULL for 4:0:0. All planes live in one buffer which
+ * belongs to the caller then, free(planes[0]) is all it takes; a picture
+ * decoded while planes[0] is still set frees the old one.
+ */
+struct hevc_yuv {
+    uint16_t *planes[3];
+    int strides[3]; // in samples
+    int width;
+    int height;
+    int chroma_format_idc;
+    int bitdepth;
+};
+
+/* where a decoded picture goes: format at pixels with pitch bytes per line,
+ * cropped to width x height. Lets a caller put a picture straight into its
+ * place on a larger canvas, like a tile of a heif grid. pitch 0 takes the
+ * whole picture at its own width. HEVC_OUTPUT_YUV fills yuv instead.
+ */
+struct hevc_output {
+    uint8_t *pixels;
+    int pitch;
+    int width;
+    int height;
+    int format;
+    struct hevc_yuv *yuv;
+};
+
+/* a decoder keeps its buffers from one nal unit and picture to the next and
+ * only ever grows them, so same sized pictures like the tiles of a heif grid
+ * allocate nothing after the first one. Reference pictures stay with it until
+ * the rps of a later picture lets go of them. Parameter sets go to hps, which
+ * decoders on several threads may share once it is set up. One created
+ * without hps has its own. The wpp rows or tiles of a slice segment run on
+ * up to nthreads threads, 0 takes one per cpu; the threads stay with the
+ * decoder. A decoder is for one thread at a time.
+ */
+struct hevc_workers;
+
+struct hevc_decoder {
+    struct hevc_param_set *hps;
+    int own_hps;
+    int nthreads;
+    struct hevc_workers *workers;
+
+    // the rbsp of the nal unit and the offsets of its dropped epb bytes
+    uint8_t *rbsp;
+    int *epb;
+    int nal_size;
+
+    // the decoded picture buffer, the frames keep their planes and motion
+    // fields for the pictures that follow, see 8.3.2
+    struct hevc_frame *dpb;
+    // the picture being decoded, its slices may come in several nal units
+    struct picture *pic;
+    // the last independent slice segment header, dependent ones take it over
+    struct slice_segment_header *slice;
+    // see 8.3.1, PicOrderCntVal of the previous TemporalId 0 picture
+    int prev_tid0_poc;
+    uint8_t seen_irap;
+    uint8_t no_rasl_output;
+
+    // the coding tree metadata of the picture
+    uint8_t *meta;
+    size_t meta_size;
+    struct ctu **ctus;
+    int ctus_size;
+    int16_t *sao_line;
+    int sao_size;
+};
+
+struct hevc_decoder *hevc_decoder_init(struct hevc_param_set *hps);
+
+/* one nal unit without start code. The picture its slice completes is
+ * written to out. That is decoding order, the caller does the reordering
+ * for output if there is any.
+ */
+uint16_t hevc_decoder_decode_nal(struct hevc_decoder *dec, uint8_t *data,
+                                 int len, const struct hevc_output *out);
+
+/* drops the reference pictures and a picture that is not complete yet, and
+ * gives back the buffers kept so far, the parameter sets stay
+ */
+void hevc_decoder_flush(struct hevc_decoder *dec);
+
+void hevc_decoder_destroy(struct hevc_decoder *dec);
+
+/* one-shot versions with a decoder of their own for the nal unit */
 uint16_t parse_nalu(uint8_t *data, int len, uint8_t **pixels, struct hevc_param_set *hps);
 
+uint16_t hevc_decode_nalu(uint8_t *data, int len, const struct hevc_output *out,
+                          struct hevc_param_set *hps);
+
 void free_hevc_param_set(struct hevc_param_set *hps);
 
 #ifdef __cplusplus
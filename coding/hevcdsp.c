@@ -0,0 +1,461 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hevcdsp.h"
+#include "predict.h"
+#include "utils.h"
+#include "x86.h"
+
+//------------------------------------------------------------------------------
+// Deblocking, see 8.7.2.5
+
+/* xstride steps across the edge, ystride along it */
+#define P(i, l) pix[(l) * ystride - ((i) + 1) * xstride]
+#define Q(i, l) pix[(l) * ystride + (i) * xstride]
+
+static void
+luma_filter(int16_t *pix, int xstride, int ystride, const struct hevc_edge *e,
+            int n, int maxval)
+{
+    for (int k = 0; k < n; k++, pix += 4 * ystride) {
+        int tc = e[k].tc;
+        int beta = e[k].beta;
+        if (tc == 0) {
+            continue;
+        }
+        // see 8-350 to 8-360, decisions on the first and the fourth line
+        int dp0 = abs(P(2, 0) - 2 * P(1, 0) + P(0, 0));
+        int dp3 = abs(P(2, 3) - 2 * P(1, 3) + P(0, 3));
+        int dq0 = abs(Q(2, 0) - 2 * Q(1, 0) + Q(0, 0));
+        int dq3 = abs(Q(2, 3) - 2 * Q(1, 3) + Q(0, 3));
+        int dpq0 = dp0 + dq0;
+        int dpq3 = dp3 + dq3;
+        int dp = dp0 + dp3;
+        int dq = dq0 + dq3;
+        if (dpq0 + dpq3 >= beta) {
+            continue;
+        }
+        // see 8.7.2.5.6
+        int dSam0 = (2 * dpq0 < (beta >> 2)) &&
+                    (abs(P(3, 0) - P(0, 0)) + abs(Q(0, 0) - Q(3, 0)) < (beta >> 3)) &&
+                    (abs(P(0, 0) - Q(0, 0)) < ((5 * tc + 1) >> 1));
+        int dSam3 = (2 * dpq3 < (beta >> 2)) &&
+                    (abs(P(3, 3) - P(0, 3)) + abs(Q(0, 3) - Q(3, 3)) < (beta >> 3)) &&
+                    (abs(P(0, 3) - Q(0, 3)) < ((5 * tc + 1) >> 1));
+        int dEp = dp < ((beta + (beta >> 1)) >> 3);
+        int dEq = dq < ((beta + (beta >> 1)) >> 3);
+
+        for (int l = 0; l < 4; l++) {
+            int p0 = P(0, l), p1 = P(1, l), p2 = P(2, l), p3 = P(3, l);
+            int q0 = Q(0, l), q1 = Q(1, l), q2 = Q(2, l), q3 = Q(3, l);
+            if (dSam0 && dSam3) {
+                // strong filter, see 8-373 to 8-378
+                if (!e[k].no_p) {
+                    P(0, l) = clip3(p0 - 2 * tc, p0 + 2 * tc,
+                                    (p2 + 2 * p1 + 2 * p0 + 2 * q0 + q1 + 4) >> 3);
+                    P(1, l) = clip3(p1 - 2 * tc, p1 + 2 * tc,
+                                    (p2 + p1 + p0 + q0 + 2) >> 2);
+                    P(2, l) = clip3(p2 - 2 * tc, p2 + 2 * tc,
+                                    (2 * p3 + 3 * p2 + p1 + p0 + q0 + 4) >> 3);
+                }
+                if (!e[k].no_q) {
+                    Q(0, l) = clip3(q0 - 2 * tc, q0 + 2 * tc,
+                                    (p1 + 2 * p0 + 2 * q0 + 2 * q1 + q2 + 4) >> 3);
+                    Q(1, l) = clip3(q1 - 2 * tc, q1 + 2 * tc,
+                                    (p0 + q0 + q1 + q2 + 2) >> 2);
+                    Q(2, l) = clip3(q2 - 2 * tc, q2 + 2 * tc,
+                                    (p0 + q0 + q1 + 3 * q2 + 2 * q3 + 4) >> 3);
+                }
+                continue;
+            }
+            // normal filter, see 8-379 to 8-387
+            int delta = (9 * (q0 - p0) - 3 * (q1 - p1) + 8) >> 4;
+            if (abs(delta) >= tc * 10) {
+                continue;
+            }
+            delta = clip3(-tc, tc, delta);
+            if (!e[k].no_p) {
+                P(0, l) = clip3(0, maxval, p0 + delta);
+                if (dEp) {
+                    int dlt = clip3(-(tc >> 1), tc >> 1,
+                                    (((p2 + p0 + 1) >> 1) - p1 + delta) >> 1);
+                    P(1, l) = clip3(0, maxval, p1 + dlt);
+                }
+            }
+            if (!e[k].no_q) {
+                Q(0, l) = clip3(0, maxval, q0 - delta);
+                if (dEq) {
+                    int dlt = clip3(-(tc >> 1), tc >> 1,
+                                    (((q2 + q0 + 1) >> 1) - q1 - delta) >> 1);
+                    Q(1, l) = clip3(0, maxval, q1 + dlt);
+                }
+            }
+        }
+    }
+}
+
+static void
+chroma_filter(int16_t *pix, int xstride, int ystride,
+              const struct hevc_edge *e, int n, int maxval)
+{
+    for (int k = 0; k < n; k++, pix += 4 * ystride) {
+        int tc = e[k].tc;
+        if (tc == 0) {
+            continue;
+        }
+        // see 8-388 to 8-390
+        for (int l = 0; l < 4; l++) {
+            int p0 = P(0, l), p1 = P(1, l);
+            int q0 = Q(0, l), q1 = Q(1, l);
+            int delta = clip3(-tc, tc, ((((q0 - p0) * 4) + p1 - q1 + 4) >> 3));
+            if (!e[k].no_p) {
+                P(0, l) = clip3(0, maxval, p0 + delta);
+            }
+            if (!e[k].no_q) {
+                Q(0, l) = clip3(0, maxval, q0 - delta);
+            }
+        }
+    }
+}
+
+#undef P
+#undef Q
+
+void
+hevc_luma_edge_ver_c(int16_t *pix, int stride, const struct hevc_edge *e,
+                     int n, int maxval)
+{
+    luma_filter(pix, 1, stride, e, n, maxval);
+}
+
+void
+hevc_luma_edge_hor_c(int16_t *pix, int stride, const struct hevc_edge *e,
+                     int n, int maxval)
+{
+    luma_filter(pix, stride, 1, e, n, maxval);
+}
+
+void
+hevc_chroma_edge_ver_c(int16_t *pix, int stride, const struct hevc_edge *e,
+                       int n, int maxval)
+{
+    chroma_filter(pix, 1, stride, e, n, maxval);
+}
+
+void
+hevc_chroma_edge_hor_c(int16_t *pix, int stride, const struct hevc_edge *e,
+                       int n, int maxval)
+{
+    chroma_filter(pix, stride, 1, e, n, maxval);
+}
+
+//------------------------------------------------------------------------------
+// Sample adaptive offset, see 8.7.3.2
+
+void
+hevc_sao_band_c(int16_t *dst, const int16_t *src, int n, const int16_t *offset,
+                int band_position, int shift, int maxval)
+{
+    for (int i = 0; i < n; i++) {
+        int k = ((src[i] >> shift) - band_position) & 31;
+        dst[i] = (k < 4) ? clip3(0, maxval, src[i] + offset[k]) : src[i];
+    }
+}
+
+void
+hevc_sao_edge_c(int16_t *dst, const int16_t *src, const int16_t *a,
+                const int16_t *b, int n, const int16_t *offset, int maxval)
+{
+    // 2 + the two signs to edgeIdx, see 8-411
+    static const uint8_t edge_idx[5] = {1, 2, 0, 3, 4};
+    for (int i = 0; i < n; i++) {
+        int s = 2 + (src[i] > a[i]) - (src[i] < a[i]) + (src[i] > b[i]) -
+                (src[i] < b[i]);
+        dst[i] = clip3(0, maxval, src[i] + offset[edge_idx[s]]);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Inter prediction, see 8.5.3.3
+
+const int8_t hevc_luma_filter[4][8] = {
+    {0, 0, 0, 64, 0, 0, 0, 0},
+    {-1, 4, -10, 58, 17, -5, 1, 0},
+    {-1, 4, -11, 40, 40, -11, 4, -1},
+    {0, 1, -5, 17, 58, -10, 4, -1},
+};
+
+const int8_t hevc_chroma_filter[8][4] = {
+    {0, 64, 0, 0},    {-2, 58, 10, -2}, {-4, 54, 16, -2}, {-6, 46, 28, -4},
+    {-4, 36, 36, -4}, {-4, 28, 46, -6}, {-2, 16, 54, -4}, {-2, 10, 58, -2},
+};
+
+/* one pass of the filter f with taps taps, step is 1 for the horizontal one
+ * and the stride for the vertical one. src points to the first tap.
+ */
+static void
+mc_pass(int16_t *dst, int dststride, const int16_t *src, int srcstride,
+        int step, int w, int h, const int8_t *f, int taps, int shift)
+{
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            int sum = 0;
+            for (int i = 0; i < taps; i++) {
+                sum += f[i] * src[x + i * step];
+            }
+            dst[x] = sum >> shift;
+        }
+        dst += dststride;
+        src += srcstride;
+    }
+}
+
+static void
+mc_filter(int16_t *dst, int dststride, const int16_t *src, int srcstride,
+          int w, int h, const int8_t *fx, const int8_t *fy, int taps,
+          int bitdepth)
+{
+    int shift1 = MIN(4, bitdepth - 8);
+    int shift3 = MAX(2, 14 - bitdepth);
+    int back = taps / 2 - 1;
+    if (!fx && !fy) {
+        for (int y = 0; y < h; y++) {
+            for (int x = 0; x < w; x++) {
+                dst[y * dststride + x] = src[y * srcstride + x] << shift3;
+            }
+        }
+    } else if (!fy) {
+        mc_pass(dst, dststride, src - back, srcstride, 1, w, h, fx, taps,
+                shift1);
+    } else if (!fx) {
+        mc_pass(dst, dststride, src - back * srcstride, srcstride, srcstride,
+                w, h, fy, taps, shift1);
+    } else {
+        // the rows the vertical pass needs above and below, then shift2 = 6
+        int16_t tmp[(64 + 7) * 64];
+        mc_pass(tmp, 64, src - back * srcstride - back, srcstride, 1, w,
+                h + taps - 1, fx, taps, shift1);
+        mc_pass(dst, dststride, tmp, 64, 64, w, h, fy, taps, 6);
+    }
+}
+
+void
+hevc_mc_luma_c(int16_t *dst, int dststride, const int16_t *src,
+               int srcstride, int w, int h, int mx, int my, int bitdepth)
+{
+    mc_filter(dst, dststride, src, srcstride, w, h,
+              mx ? hevc_luma_filter[mx] : NULL,
+              my ? hevc_luma_filter[my] : NULL, 8, bitdepth);
+}
+
+void
+hevc_mc_chroma_c(int16_t *dst, int dststride, const int16_t *src,
+                 int srcstride, int w, int h, int mx, int my, int bitdepth)
+{
+    mc_filter(dst, dststride, src, srcstride, w, h,
+              mx ? hevc_chroma_filter[mx] : NULL,
+              my ? hevc_chroma_filter[my] : NULL, 4, bitdepth);
+}
+
+void
+hevc_pred_uni_c(int16_t *dst, int dststride, const int16_t *src,
+                int srcstride, int w, int h, int bitdepth)
+{
+    int shift = 14 - bitdepth;
+    int maxval = (1 << bitdepth) - 1;
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            dst[x] = clip3(0, maxval, (src[x] + (1 << (shift - 1))) >> shift);
+        }
+        dst += dststride;
+        src += srcstride;
+    }
+}
+
+void
+hevc_pred_bi_c(int16_t *dst, int dststride, const int16_t *src0,
+               const int16_t *src1, int srcstride, int w, int h, int bitdepth)
+{
+    int shift = 15 - bitdepth;
+    int maxval = (1 << bitdepth) - 1;
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            dst[x] = clip3(0, maxval,
+                           (src0[x] + src1[x] + (1 << (shift - 1))) >> shift);
+        }
+        dst += dststride;
+        src0 += srcstride;
+        src1 += srcstride;
+    }
+}
+
+void
+hevc_pred_uni_w_c(int16_t *dst, int dststride, const int16_t *src,
+                  int srcstride, int w, int h, int log2wd, int wx, int ox,
+                  int bitdepth)
+{
+    // log2WD is at least 14 - bitdepth, so never below 1
+    int maxval = (1 << bitdepth) - 1;
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            dst[x] = clip3(0, maxval,
+                           ((src[x] * wx + (1 << (log2wd - 1))) >> log2wd) +
+                               ox);
+        }
+        dst += dststride;
+        src += srcstride;
+    }
+}
+
+void
+hevc_pred_bi_w_c(int16_t *dst, int dststride, const int16_t *src0,
+                 const int16_t *src1, int srcstride, int w, int h, int log2wd,
+                 int w0, int w1, int o0, int o1, int bitdepth)
+{
+    int maxval = (1 << bitdepth) - 1;
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            dst[x] = clip3(0, maxval,
+                           (src0[x] * w0 + src1[x] * w1 +
+                            ((o0 + o1 + 1) << log2wd)) >> (log2wd + 1));
+        }
+        dst += dststride;
+        src0 += srcstride;
+        src1 += srcstride;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Output of the planes as rgb
+
+static inline int
+mulhrs(int a, int b)
+{
+    return (a * b + 0x4000) >> 15;
+}
+
+static inline void
+yuv_rgb(int y, int u, int v, int bitdepth, int *r, int *g, int *b)
+{
+    u -= 1 << (bitdepth - 1);
+    v -= 1 << (bitdepth - 1);
+    *r = y + v + mulhrs(v, HEVC_YUV_R_V);
+    *g = y + mulhrs(u, HEVC_YUV_G_U) + mulhrs(v, HEVC_YUV_G_V);
+    *b = y + 2 * u + mulhrs(u, HEVC_YUV_B_U);
+}
+
+void
+hevc_yuv_bgra32_c(uint8_t *dst, const int16_t *y, const int16_t *u,
+                  const int16_t *v, int width, int sub, int bitdepth)
+{
+    int shift = bitdepth - 8;
+    for (int i = 0; i < width; i++) {
+        int r, g, b;
+        yuv_rgb(y[i], u[i >> sub], v[i >> sub], bitdepth, &r, &g, &b);
+        dst[4 * i] = clamp(b >> shift, 255);
+        dst[4 * i + 1] = clamp(g >> shift, 255);
+        dst[4 * i + 2] = clamp(r >> shift, 255);
+        dst[4 * i + 3] = 0xFF;
+    }
+}
+
+/* c in bitdepth bits to 16 bits, repeating the top bits in the low ones */
+static inline uint16_t
+scale16(int c, int bitdepth)
+{
+    return (c << (16 - bitdepth)) | (c >> (2 * bitdepth - 16));
+}
+
+void
+hevc_yuv_rgba64_c(uint16_t *dst, const int16_t *y, const int16_t *u,
+                  const int16_t *v, int width, int sub, int bitdepth)
+{
+    int maxval = (1 << bitdepth) - 1;
+    for (int i = 0; i < width; i++) {
+        int r, g, b;
+        yuv_rgb(y[i], u[i >> sub], v[i >> sub], bitdepth, &r, &g, &b);
+        dst[4 * i] = scale16(clamp(r, maxval), bitdepth);
+        dst[4 * i + 1] = scale16(clamp(g, maxval), bitdepth);
+        dst[4 * i + 2] = scale16(clamp(b, maxval), bitdepth);
+        dst[4 * i + 3] = 0xFFFF;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Emulation prevention, see 7.3.1.1
+
+int
+hevc_unescape_c(uint8_t *dst, const uint8_t *src, int len, int *epb,
+                int *num_epb)
+{
+    int n = 0, start = 0, num = 0;
+    for (int i = 0; i + 2 < len; i++) {
+        if (src[i] == 0 && src[i + 1] == 0 && src[i + 2] == 3) {
+            // everything up to the two zeros in one go
+            memcpy(dst + n, src + start, i + 2 - start);
+            n += i + 2 - start;
+            epb[num++] = n;
+            start = i + 3;
+            i += 2;
+        }
+    }
+    memcpy(dst + n, src + start, len - start);
+    *num_epb = num;
+    return n + len - start;
+}
+
+//------------------------------------------------------------------------------
+
+static struct hevc_dsp hevcdsp;
+static int hevcdsp_inited = 0;
+
+void
+hevc_dsp_init_c(struct hevc_dsp *dsp)
+{
+    dsp->luma_edge_ver = hevc_luma_edge_ver_c;
+    dsp->luma_edge_hor = hevc_luma_edge_hor_c;
+    dsp->chroma_edge_ver = hevc_chroma_edge_ver_c;
+    dsp->chroma_edge_hor = hevc_chroma_edge_hor_c;
+    dsp->sao_band = hevc_sao_band_c;
+    dsp->sao_edge = hevc_sao_edge_c;
+    dsp->intra_planar = hevc_intra_planar;
+    dsp->intra_dc = hevc_intra_DC;
+    dsp->intra_angular = hevc_intra_angular;
+    dsp->intra_filter = hevc_intra_filter;
+    dsp->intra_strong_filter = hevc_intra_strong_filter;
+    dsp->mc_luma = hevc_mc_luma_c;
+    dsp->mc_chroma = hevc_mc_chroma_c;
+    dsp->pred_uni = hevc_pred_uni_c;
+    dsp->pred_bi = hevc_pred_bi_c;
+    dsp->pred_uni_w = hevc_pred_uni_w_c;
+    dsp->pred_bi_w = hevc_pred_bi_w_c;
+    dsp->yuv_bgra32 = hevc_yuv_bgra32_c;
+    dsp->yuv_rgba64 = hevc_yuv_rgba64_c;
+    dsp->unescape = hevc_unescape_c;
+}
+
+void
+hevc_dsp_init(void)
+{
+    if (hevcdsp_inited) {
+        return;
+    }
+    hevc_dsp_init_c(&hevcdsp);
+#ifdef __SSE4_1__
+    x86_hevc_dsp_init_sse4(&hevcdsp);
+#endif
+#ifdef __AVX2__
+    x86_hevc_dsp_init_avx2(&hevcdsp);
+#endif
+    hevcdsp_inited = 1;
+}
+
+const struct hevc_dsp *
+hevc_dsp_get(void)
+{
+    if (!hevcdsp_inited) {
+        hevc_dsp_init();
+    }
+    return &hevcdsp;
+}
@@ -0,0 +1,223 @@
+#ifndef _HEVCDSP_H_
+#define _HEVCDSP_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/* HEVC reconstruction kernels, filled with the C version first and then
+ * overridden by whatever the cpu supports, see hevc_dsp_init()
+ */
+
+/* one segment of an edge for the deblocking filter, four lines across the
+ * edge. tc equal to 0 leaves the segment untouched, which is how bS 0 and
+ * the edges that are not filtered at all are passed in.
+ */
+struct hevc_edge {
+    int16_t beta;
+    int16_t tc;
+    uint8_t no_p;   /* pcm with loop filter disabled, or transquant bypass */
+    uint8_t no_q;
+};
+
+/* pix points to q0 of the first line, the segments go along the edge, so
+ * segment k covers rows 4k..4k+3 of a vertical edge (EDGE_VER) or columns
+ * 4k..4k+3 of a horizontal edge (EDGE_HOR).
+ * maxval is (1 << BitDepth) - 1
+ */
+typedef void (*hevc_deblock_func)(int16_t *pix, int stride,
+                                  const struct hevc_edge *e, int n,
+                                  int maxval);
+
+/* see 8.7.3.2, band offset of n samples of a line. offset holds
+ * SaoOffsetVal[1..4] of the four bands from band_position on, shift is
+ * bitDepth - 5. dst may be the same as src.
+ */
+typedef void (*hevc_sao_band_func)(int16_t *dst, const int16_t *src, int n,
+                                   const int16_t *offset, int band_position,
+                                   int shift, int maxval);
+
+/* see 8.7.3.2, edge offset of n samples of a line. a and b point to the two
+ * neighbours of src[0] for the edge class, offset is SaoOffsetVal[0..4] by
+ * edgeIdx. dst must not overlap with the sources.
+ */
+typedef void (*hevc_sao_edge_func)(int16_t *dst, const int16_t *src,
+                                   const int16_t *a, const int16_t *b, int n,
+                                   const int16_t *offset, int maxval);
+
+/* see 8.4.4.2.4 to 8.4.4.2.6, nTbS x nTbS samples of intra prediction.
+ * left[0..2 * nTbS - 1] and top[-1..2 * nTbS - 1] are the reference samples
+ * after substitution and filtering, top[-1] is the top left one.
+ */
+typedef void (*hevc_intra_planar_func)(uint16_t *dst, uint16_t *left,
+                                       uint16_t *top, int nTbS, int stride);
+typedef void (*hevc_intra_dc_func)(uint16_t *dst, uint16_t *left,
+                                   uint16_t *top, int nTbS, int stride,
+                                   int cIdx,
+                                   int intra_boundary_filtering_disabled_flag);
+typedef void (*hevc_intra_angular_func)(uint16_t *dst, uint16_t *left,
+                                        uint16_t *top, int nTbS, int stride,
+                                        int cIdx, int predModeIntra,
+                                        int disableIntraBoundaryFilter,
+                                        int bitdepth);
+
+/* see 8.4.4.2.3, the [1 2 1] filter of the reference samples in place, and
+ * the bi-linear one for 32x32 luma with strong_intra_smoothing_enabled_flag
+ */
+typedef void (*hevc_intra_filter_func)(uint16_t *left, uint16_t *top,
+                                       int nTbS);
+
+/* one line of width samples from the planes to packed rgb with full alpha.
+ * u and v hold a sample for every 1 << sub luma ones, so sub is 1 for 4:2:0
+ * and 4:2:2 and 0 for 4:4:4. bgra32 is scaled down to 8 bits, rgba64 up to
+ * 16 bits per channel from bitdepth, which is at most 12.
+ */
+typedef void (*hevc_yuv_bgra32_func)(uint8_t *dst, const int16_t *y,
+                                     const int16_t *u, const int16_t *v,
+                                     int width, int sub, int bitdepth);
+typedef void (*hevc_yuv_rgba64_func)(uint16_t *dst, const int16_t *y,
+                                     const int16_t *u, const int16_t *v,
+                                     int width, int sub, int bitdepth);
+
+/* see 7.3.1.1, the nal unit payload src of len bytes to dst without the
+ * emulation_prevention_three_bytes. epb gets the offsets in dst right after
+ * each dropped byte, there are at most len / 3 of them. Returns the number
+ * of bytes in dst.
+ */
+typedef int (*hevc_unescape_func)(uint8_t *dst, const uint8_t *src, int len,
+                                  int *epb, int *num_epb);
+
+/* see 8.5.3.3.3, fractional sample interpolation of a w x h block to the 14
+ * bit intermediate predSamples. src points to the sample at the integer
+ * position, the 8 tap luma filter reads 3 samples before and 4 after it on
+ * both axes, the 4 tap chroma one 1 before and 2 after. mx and my are
+ * xFrac and yFrac, in quarter samples for luma and eighth ones for chroma.
+ * w is at most 64.
+ */
+typedef void (*hevc_mc_func)(int16_t *dst, int dststride, const int16_t *src,
+                             int srcstride, int w, int h, int mx, int my,
+                             int bitdepth);
+
+/* see 8.5.3.3.4.2, default weighted sample prediction of one or two lists
+ * of predSamples to the picture samples. The bi version takes both blocks
+ * at srcstride.
+ */
+typedef void (*hevc_pred_uni_func)(int16_t *dst, int dststride,
+                                   const int16_t *src, int srcstride, int w,
+                                   int h, int bitdepth);
+typedef void (*hevc_pred_bi_func)(int16_t *dst, int dststride,
+                                  const int16_t *src0, const int16_t *src1,
+                                  int srcstride, int w, int h, int bitdepth);
+
+/* see 8.5.3.3.4.3, explicit weighted sample prediction. log2wd is log2WD,
+ * the offsets are already scaled to the bit depth.
+ */
+typedef void (*hevc_pred_uni_w_func)(int16_t *dst, int dststride,
+                                     const int16_t *src, int srcstride, int w,
+                                     int h, int log2wd, int wx, int ox,
+                                     int bitdepth);
+typedef void (*hevc_pred_bi_w_func)(int16_t *dst, int dststride,
+                                    const int16_t *src0, const int16_t *src1,
+                                    int srcstride, int w, int h, int log2wd,
+                                    int w0, int w1, int o0, int o1,
+                                    int bitdepth);
+
+struct hevc_dsp {
+    /* see 8.7.2.5.3 and 8.7.2.5.7, luma decisions and filtering */
+    hevc_deblock_func luma_edge_ver;
+    hevc_deblock_func luma_edge_hor;
+    /* see 8.7.2.5.5, chroma is only filtered for bS 2 */
+    hevc_deblock_func chroma_edge_ver;
+    hevc_deblock_func chroma_edge_hor;
+
+    hevc_sao_band_func sao_band;
+    hevc_sao_edge_func sao_edge;
+
+    hevc_intra_planar_func intra_planar;
+    hevc_intra_dc_func intra_dc;
+    hevc_intra_angular_func intra_angular;
+    hevc_intra_filter_func intra_filter;
+    hevc_intra_filter_func intra_strong_filter;
+
+    hevc_mc_func mc_luma;
+    hevc_mc_func mc_chroma;
+    hevc_pred_uni_func pred_uni;
+    hevc_pred_bi_func pred_bi;
+    hevc_pred_uni_w_func pred_uni_w;
+    hevc_pred_bi_w_func pred_bi_w;
+
+    hevc_yuv_bgra32_func yuv_bgra32;
+    hevc_yuv_rgba64_func yuv_rgba64;
+
+    hevc_unescape_func unescape;
+};
+
+/* fill all entries with the plain C version */
+void hevc_dsp_init_c(struct hevc_dsp *dsp);
+
+/* select the best kernels once, safe to call more than once */
+void hevc_dsp_init(void);
+
+const struct hevc_dsp *hevc_dsp_get(void);
+
+/* C kernels, exported for the tails the SIMD versions leave over */
+void hevc_luma_edge_ver_c(int16_t *pix, int stride, const struct hevc_edge *e,
+                          int n, int maxval);
+void hevc_luma_edge_hor_c(int16_t *pix, int stride, const struct hevc_edge *e,
+                          int n, int maxval);
+void hevc_chroma_edge_ver_c(int16_t *pix, int stride,
+                            const struct hevc_edge *e, int n, int maxval);
+void hevc_chroma_edge_hor_c(int16_t *pix, int stride,
+                            const struct hevc_edge *e, int n, int maxval);
+void hevc_sao_band_c(int16_t *dst, const int16_t *src, int n,
+                     const int16_t *offset, int band_position, int shift,
+                     int maxval);
+void hevc_sao_edge_c(int16_t *dst, const int16_t *src, const int16_t *a,
+                     const int16_t *b, int n, const int16_t *offset,
+                     int maxval);
+void hevc_yuv_bgra32_c(uint8_t *dst, const int16_t *y, const int16_t *u,
+                       const int16_t *v, int width, int sub, int bitdepth);
+void hevc_yuv_rgba64_c(uint16_t *dst, const int16_t *y, const int16_t *u,
+                       const int16_t *v, int width, int sub, int bitdepth);
+int hevc_unescape_c(uint8_t *dst, const uint8_t *src, int len, int *epb,
+                    int *num_epb);
+void hevc_mc_luma_c(int16_t *dst, int dststride, const int16_t *src,
+                    int srcstride, int w, int h, int mx, int my, int bitdepth);
+void hevc_mc_chroma_c(int16_t *dst, int dststride, const int16_t *src,
+                      int srcstride, int w, int h, int mx, int my,
+                      int bitdepth);
+void hevc_pred_uni_c(int16_t *dst, int dststride, const int16_t *src,
+                     int srcstride, int w, int h, int bitdepth);
+void hevc_pred_bi_c(int16_t *dst, int dststride, const int16_t *src0,
+                    const int16_t *src1, int srcstride, int w, int h,
+                    int bitdepth);
+void hevc_pred_uni_w_c(int16_t *dst, int dststride, const int16_t *src,
+                       int srcstride, int w, int h, int log2wd, int wx,
+                       int ox, int bitdepth);
+void hevc_pred_bi_w_c(int16_t *dst, int dststride, const int16_t *src0,
+                      const int16_t *src1, int srcstride, int w, int h,
+                      int log2wd, int w0, int w1, int o0, int o1,
+                      int bitdepth);
+
+/* the interpolation filter coefficients fL and fC by fractional position,
+ * see table 8-11 and 8-12
+ */
+extern const int8_t hevc_luma_filter[4][8];
+extern const int8_t hevc_chroma_filter[8][4];
+
+/* the fractional parts of the yuv to rgb coefficients in Q15, see
+ * YUV420_to_BGRA32_16bit(). They go through pmulhrsw, which rounds, so
+ * every version gives the same result.
+ */
+#define HEVC_YUV_R_V    9175    /* 1.280 - 1 */
+#define HEVC_YUV_G_U    (-7045) /* -0.215 */
+#define HEVC_YUV_G_V    (-12485)/* -0.381 */
+#define HEVC_YUV_B_U    4194    /* 2.128 - 2 */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*_HEVCDSP_H_*/
@@ -183,7 +183,9 @@ remaining:
                 goto remaining;
             }
         }
-        VERR(huffman, "end of stream %ld, %d", v->ptr - v->start, v->len);
+        // not always an error, an incremental decoder waits for more data
+        VDBG(huffman, "end of stream %ld, %d", v->ptr - v->start, v->len);
+        v->eof = 1;
         return -1;
     }
     c = READ_BITS(v, trybits);
@@ -192,6 +194,16 @@ remaining:
         return -1;
     }
 
+    if (trybits < FAST_HF_BITS) {
+        /* the stream tail, the code must fit in what is left */
+        c <<= FAST_HF_BITS - trybits;
+        if (tree->fast_symbol[c] == 0xFFFF || tree->fast_bitlen[c] > trybits) {
+            STEP_BACK(v, trybits);
+            v->eof = 1;
+            return -1;
+        }
+    }
+
     /* looup fast table first */
     ct = tree->fast_symbol[c];
     if (ct != 0xFFFF) {
@@ -0,0 +1,133 @@
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "symdec.h"
+
+#define SYM_WINDOW (64)
+#define SYM_LOTS_OF_BITS (0x4000)
+
+/* shift in whole bytes as long as they fit below the 16 bits in use.
+ * Past the end the stream reads as zeros, padding only has to make it
+ * through the last symbol, see 8.2.4.
+ */
+static void
+symdec_refill(struct symdec *s)
+{
+    int shift = SYM_WINDOW - 9 - (s->cnt + 15);
+    uint64_t dif = s->dif;
+    int cnt = s->cnt;
+    const uint8_t *p = s->buf;
+    for (; shift >= 0 && p < s->end; shift -= 8, p++) {
+        dif ^= (uint64_t)p[0] << shift;
+        cnt += 8;
+    }
+    if (p >= s->end) {
+        cnt = SYM_LOTS_OF_BITS;
+    }
+    s->dif = dif;
+    s->cnt = cnt;
+    s->buf = p;
+}
+
+void
+symdec_init(struct symdec *s, const uint8_t *data, int len,
+            int disable_update)
+{
+    s->buf = data;
+    s->end = data + len;
+    s->dif = ((uint64_t)1 << (SYM_WINDOW - 1)) - 1;
+    s->rng = 0x8000;
+    s->cnt = -15;
+    s->disable_update = disable_update;
+    symdec_refill(s);
+}
+
+/* see 8.2.6, renormalize rng back to 16 bits */
+static inline int
+symdec_normalize(struct symdec *s, uint64_t dif, uint32_t rng, int ret)
+{
+    int d = __builtin_clz(rng) - 16;
+    s->cnt -= d;
+    s->dif = ((dif + 1) << d) - 1;
+    s->rng = rng << d;
+    if (s->cnt < 0) {
+        symdec_refill(s);
+    }
+    return ret;
+}
+
+static inline int
+symdec_decode(struct symdec *s, const uint16_t *cdf, int n)
+{
+    uint32_t r = s->rng;
+    uint32_t c = (uint32_t)(s->dif >> (SYM_WINDOW - 16));
+    uint32_t u, v = r;
+    int ret = -1;
+    do {
+        u = v;
+        ret++;
+        v = ((r >> 8) * (uint32_t)((32768 - cdf[ret]) >> 6) >> 1);
+        v += 4 * (n - ret - 1);
+    } while (c < v);
+    return symdec_normalize(s, s->dif - ((uint64_t)v << (SYM_WINDOW - 16)),
+                            u - v, ret);
+}
+
+/* see 8.2.6, the probabilities move towards the symbol seen, quicker for
+ * the first ones
+ */
+static inline void
+symdec_adapt(uint16_t *cdf, int n, int symbol)
+{
+    int rate = 3 + (cdf[n] > 15) + (cdf[n] > 31) + (n > 3 ? 2 : n > 1);
+    for (int i = 0; i < n - 1; i++) {
+        if (i < symbol) {
+            cdf[i] -= cdf[i] >> rate;
+        } else {
+            cdf[i] += (32768 - cdf[i]) >> rate;
+        }
+    }
+    cdf[n] += (cdf[n] < 32);
+}
+
+int
+symdec_read(struct symdec *s, uint16_t *cdf, int n)
+{
+    int symbol = symdec_decode(s, cdf, n);
+    if (!s->disable_update) {
+        symdec_adapt(cdf, n, symbol);
+    }
+    return symbol;
+}
+
+int
+symdec_bool(struct symdec *s)
+{
+    static const uint16_t half[3] = { 1 << 14, 1 << 15, 0 };
+    return symdec_decode(s, half, 2);
+}
+
+int
+symdec_literal(struct symdec *s, int n)
+{
+    int x = 0;
+    for (int i = 0; i < n; i++) {
+        x = 2 * x + symdec_bool(s);
+    }
+    return x;
+}
+
+int
+symdec_ns(struct symdec *s, int n)
+{
+    int w = 0;
+    for (int x = n; x != 0; x >>= 1) {
+        w++;
+    }
+    int m = (1 << w) - n;
+    int v = symdec_literal(s, w - 1);
+    if (v < m) {
+        return v;
+    }
+    return (v << 1) - m + symdec_bool(s);
+}
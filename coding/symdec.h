@@ -0,0 +1,49 @@
+#ifndef _SYMDEC_H_
+#define _SYMDEC_H_
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include <stdint.h>
+
+/* the multi-symbol arithmetic decoder of AV1, see av1-spec 8.2.
+ * Keeps a window of the stream like libaom's od_ec_dec does, so a symbol
+ * costs one refill every few bytes instead of one per bit as 8.2.6 reads.
+ *
+ * The cdf arrays are in the form of the spec: N values for N symbols, the
+ * last one 32768, and one more for the adaptation counter.
+ */
+struct symdec {
+    const uint8_t *buf;
+    const uint8_t *end;
+    uint64_t dif;       // inverted, the top 16 bits are compared to the range
+    uint32_t rng;
+    int cnt;
+    int disable_update; // disable_cdf_update of the frame header
+};
+
+void symdec_init(struct symdec *s, const uint8_t *data, int len,
+                 int disable_update);
+
+/* one symbol out of n, adapts cdf unless updates are off */
+int symdec_read(struct symdec *s, uint16_t *cdf, int n);
+
+/* see 8.2.3, an equiprobable bit without a cdf of its own */
+int symdec_bool(struct symdec *s);
+
+/* see 4.10.7, L(n), n bits most significant first */
+int symdec_literal(struct symdec *s, int n);
+
+/* see 4.10.10, NS(n), in the range 0..n-1 */
+int symdec_ns(struct symdec *s, int n);
+
+#define SYM(s, cdf, n) symdec_read(s, cdf, n)
+#define SYM_BOOL(s) symdec_bool(s)
+#define SYM_L(s, n) symdec_literal(s, n)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*_SYMDEC_H_*/
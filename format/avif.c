@@ -5,12 +5,18 @@
 #include <string.h>
 #include <assert.h>
 #include <inttypes.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <unistd.h>
 
 #include "bitstream.h"
 #include "colorspace.h"
 #include "vlog.h"
 #include "file.h"
 #include "avif.h"
+#include "av1dsp.h"
+#include "hevcdsp.h"
 #include "utils.h"
 
 VLOG_REGISTER(avif, DEBUG)
@@ -31,582 +37,643 @@ AVIF_probe(FILE *f)
     return -EINVAL;
 }
 
-static uint64_t
-read_leb128(struct bits_vec *v)
-{
-    uint64_t value = 0;
-    uint64_t lbe = 0;
-    for (int i = 0; i < 8; i++) {
-        lbe = READ_BITS(v, 8);
-        value |= ((lbe & 0x7F) << (i * 7));
-        lbe += 1;
-        if (!(lbe & 0x80)) {
-            break;
-        }
-    }
-    return value;
-}
-
-static int
-parse_color_config(struct color_config *cc, struct sequence_header_obu *obu, struct bits_vec *v)
+/* see 2.3 of the av1 isobmff binding, the configOBUs follow the 4 bytes of
+ * the record and hold at most one sequence header, first if there is one
+ */
+int
+read_av1c_box(FILE *f, struct box **bn)
 {
-    cc->high_bitdepth = READ_BIT(v);
-    if (obu->seq_profile == 2 && cc->high_bitdepth) {
-        cc->twelve_bit = READ_BIT(v);
-        obu->BitDepth = cc->twelve_bit ? 12: 10;
-    } else if (obu->seq_profile <= 2) {
-        obu->BitDepth = cc->high_bitdepth ? 10 : 8;
-    }
-    if (obu->seq_profile == 1) {
-        cc->mono_chrome = 0;
-    } else {
-        cc->mono_chrome = READ_BIT(v);
-    }
-    obu->NumPlanes = cc->mono_chrome ? 1: 3;
-    cc->color_description_present_flag = READ_BIT(v);
-    if (cc->color_description_present_flag) {
-        cc->color_primaries = READ_BITS(v, 8);
-        cc->transfer_characteristics = READ_BITS(v, 8);
-        cc->matrix_coefficients = READ_BITS(v, 8);
-    } else {
-        cc->color_primaries = CP_UNSPECIFIED;
-        cc->transfer_characteristics = TC_UNSPECIFIED;
-        cc->matrix_coefficients = MC_UNSPECIFIED;
-    }
-    if (cc->mono_chrome) {
-        cc->color_range = READ_BIT(v);
-        cc->subsampling_x = 1;
-        cc->subsampling_y = 1;
-        cc->chroma_sample_position = CSP_UNKNOWN;
-        cc->separate_uv_delta_q = 0;
-        return 0;
-    } else if (cc->color_primaries == CP_BT_709 &&
-        cc->transfer_characteristics == TC_SRGB &&
-        cc->matrix_coefficients == MC_IDENTITY) {
-        cc->color_range = 1;
-        cc->subsampling_x = 0;
-        cc->subsampling_y = 0;
-    } else {
-        cc->color_range = READ_BIT(v);
-        if (obu->seq_profile == 0) {
-            cc->subsampling_x = 1;
-            cc->subsampling_y = 1;
-        } else if (obu->seq_profile == 1) {
-            cc->subsampling_x = 0;
-            cc->subsampling_y = 0;
-        } else {
-            if (obu->BitDepth == 12) {
-                cc->subsampling_x = READ_BIT(v);
-                if (cc->subsampling_x) {
-                    cc->subsampling_y = READ_BIT(v);
-                } else {
-                    cc->subsampling_y = 0;
-                }
-            } else {
-                cc->subsampling_x = 1;
-                cc->subsampling_y = 0;
-            }
-        }
-        if (cc->subsampling_x && cc->subsampling_y) {
-            cc->chroma_sample_position = READ_BITS(v, 2);
+    if (*bn == NULL) {
+        *bn = (struct box *)calloc(1, sizeof(struct av1C_box));
+    }
+    struct av1C_box *b = (struct av1C_box *)(*bn);
+
+    FFREAD_BOX_ST(b, f, FOURCC2UINT('a', 'v', '1', 'C'));
+    uint8_t rec[4];
+    FFREAD(rec, 4, 1, f);
+    b->marker = rec[0] >> 7;
+    b->version = rec[0] & 0x7F;
+    b->seq_profile = rec[1] >> 5;
+    b->seq_level_idx_0 = rec[1] & 0x1F;
+    b->seq_tier_0 = rec[2] >> 7;
+    b->high_bitdepth = (rec[2] >> 6) & 1;
+    b->twelve_bit = (rec[2] >> 5) & 1;
+    b->monochrome = (rec[2] >> 4) & 1;
+    b->chroma_subsampling_x = (rec[2] >> 3) & 1;
+    b->chroma_subsampling_y = (rec[2] >> 2) & 1;
+    b->chroma_sample_position = rec[2] & 3;
+    b->initial_presentation_delay_present = (rec[3] >> 4) & 1;
+    b->initial_presentation_delay_minus_one = rec[3] & 0xF;
+    VDBG(avif, "av1C: size %" PRIu64 ", version %d, marker 0x%x", b->size,
+         b->version, b->marker);
+    b->config_len = b->size - 12;
+    if (b->config_len > 0) {
+        b->config = malloc(b->config_len);
+        FFREAD(b->config, b->config_len, 1, f);
+        struct obu_header h;
+        int hsize, size;
+        if (!av1_obu_header(&h, b->config, b->config_len, &hsize, &size) &&
+            h.obu_type == OBU_SEQUENCE_HEADER) {
+            b->seq = av1_parse_sequence_header(b->config + hsize, size);
         }
     }
-    cc->separate_uv_delta_q = READ_BIT(v);
-    return 0;
+    return b->size;
 }
 
-int choose_operating_point(void)
+void
+free_av1c_box(struct box *bn)
 {
-    return 0;
+    struct av1C_box *b = (struct av1C_box *)bn;
+    free(b->config);
+    av1_free_sequence_header(b->seq);
 }
 
-static struct sequence_header_obu *
-parse_sequence_header_obu(struct bits_vec *v)
+static struct box *
+get_property(AVIF *h, int id, uint32_t fourcc)
 {
-    struct sequence_header_obu *obu = malloc(sizeof(*obu));
-    obu->seq_profile = READ_BITS(v, 3);
-    obu->still_picture = READ_BIT(v);
-    obu->reduced_still_picture_header = READ_BIT(v);
-    if (obu->reduced_still_picture_header) {
-        obu->timing_info_present_flag = 0;
-        obu->decoder_model_info_present_flag = 0;
-        obu->initial_display_delay_present_flag = 0;
-        obu->operating_points_cnt_minus_1 = 0;
-        obu->points[0].operating_point_idc = 0;
-        obu->points[0].seq_level_idx = READ_BITS(v, 5);
-        obu->points[0].seq_tier = 0;
-        obu->points[0].decoder_model_present_for_this_op = 0;
-        obu->points[0].initial_display_delay_present_for_this_op = 0;
-    } else {
-        obu->timing_info_present_flag = READ_BIT(v);
-        if (obu->timing_info_present_flag) {
-            obu->decoder_model_info_present_flag = READ_BIT(v);
-            if (obu->decoder_model_info_present_flag) {
-                obu->minfo.buffer_delay_length_minus_1 = READ_BITS(v, 5);
-                obu->minfo.num_units_in_decoding_tick = READ_BITS(v, 32);
-                obu->minfo.buffer_removal_time_length_minus_1 = READ_BITS(v, 5);
-                obu->minfo.frame_presentation_time_length_minus_1 = READ_BITS(v, 5);
-            }
-        } else {
-            obu->decoder_model_info_present_flag = 0;
+    for (uint32_t i = 0; i < h->meta.iprp.ipma.entry_count; i++) {
+        struct ipma_item *e = &h->meta.iprp.ipma.entries[i];
+        if (e->item_id != (uint32_t)id) {
+            continue;
         }
-        obu->initial_display_delay_present_flag = READ_BIT(v);
-        obu->operating_points_cnt_minus_1 = READ_BITS(v, 5);
-        obu->points = malloc(sizeof(struct operating_points) * (obu->operating_points_cnt_minus_1+1));
-        for (int i = 0; i <= obu->operating_points_cnt_minus_1; i++) {
-            obu->points[i].operating_point_idc = READ_BITS(v, 12);
-            obu->points[i].seq_level_idx = READ_BITS(v, 5);
-            if (obu->points[i].seq_level_idx > 7) {
-                obu->points[i].seq_tier = READ_BIT(v);
-            } else {
-                obu->points[i].seq_tier = 0;
+        for (int k = 0; k < e->association_count; k++) {
+            int property_index = e->property_index[k] & 0x7FFF;
+            // 0 is no property, the rest are 1 based into ipco
+            if (property_index == 0 ||
+                property_index > h->meta.iprp.ipco.n_property) {
+                continue;
             }
-            if (obu->decoder_model_info_present_flag) {
-                obu->points[i].decoder_model_present_for_this_op = READ_BIT(v);
-                if (obu->points[i].decoder_model_present_for_this_op) {
-                    int n = obu->minfo.buffer_delay_length_minus_1 + 1;
-                    obu->points[i].pinfo.decoder_buffer_delay = READ_BITS(v, n);
-                    obu->points[i].pinfo.encoder_buffer_delay = READ_BITS(v, n);
-                    obu->points[i].pinfo.low_delay_mode_flag = READ_BIT(v);
-                }
-            } else {
-                obu->points[i].decoder_model_present_for_this_op = 0;
-            }
-            if (obu->initial_display_delay_present_flag) {
-                obu->points[i].initial_display_delay_present_for_this_op = READ_BIT(v);
-                if (obu->points[i].initial_display_delay_present_for_this_op) {
-                    obu->points[i].initial_display_delay_minus_1 = READ_BITS(v, 4);
-                }
+            struct box *b = h->meta.iprp.ipco.property[property_index - 1];
+            if (b && b->type == fourcc) {
+                return b;
             }
         }
     }
-    // int op = choose_operating_point();
-    // int OperatingPointIdc = obu->points[op].operating_point_idc;
-    obu->frame_width_bits_minus_1 = READ_BITS(v, 4);
-    obu->frame_height_bits_minus_1 = READ_BITS(v, 4);
-    obu->max_frame_width_minus_1 = READ_BITS(v, obu->frame_width_bits_minus_1+1);
-    obu->max_frame_height_minus_1 = READ_BITS(v, obu->frame_height_bits_minus_1+1);
-    if (obu->reduced_still_picture_header) {
-        obu->frame_id_numbers_present_flag = 0;
-    } else {
-        obu->frame_id_numbers_present_flag = READ_BIT(v);
-    }
-    if (obu->frame_id_numbers_present_flag) {
-        obu->delta_frame_id_length_minus_2 = READ_BITS(v, 4);
-        obu->additional_frame_id_length_minus_1 = READ_BITS(v, 3);
-    }
-    obu->use_128x128_superblock = READ_BIT(v);
-    obu->enable_filter_intra = READ_BIT(v);
-    obu->enable_intra_edge_filter = READ_BIT(v);
-    if (obu->reduced_still_picture_header) {
-        obu->enable_interintra_compound = 0;
-        obu->enable_masked_compound = 0;
-        obu->enable_warped_motion = 0;
-        obu->enable_dual_filter = 0;
-        obu->enable_order_hint = 0;
-        obu->enable_jnt_comp = 0;
-        obu->enable_ref_frame_mvs = 0;
-        obu->seq_force_screen_content_tools = SELECT_SCREEN_CONTENT_TOOLS;
-        obu->seq_force_integer_mv = SELECT_INTEGER_MV;
-        obu->OrderHintBits = 0;
-    } else {
-        obu->enable_interintra_compound = READ_BIT(v);
-        obu->enable_masked_compound = READ_BIT(v);
-        obu->enable_warped_motion = READ_BIT(v);
-        obu->enable_dual_filter = READ_BIT(v);
-        obu->enable_order_hint = READ_BIT(v);
-        if (obu->enable_order_hint) {
-            obu->enable_jnt_comp = READ_BIT(v);
-            obu->enable_ref_frame_mvs = READ_BIT(v);
-        } else {
-            obu->enable_jnt_comp = 0;
-            obu->enable_ref_frame_mvs = 0;
-        }
-        obu->seq_choose_screen_content_tools = READ_BIT(v);
-        if (obu->seq_choose_screen_content_tools) {
-            obu->seq_force_screen_content_tools = SELECT_SCREEN_CONTENT_TOOLS;
-        } else {
-            obu->seq_force_screen_content_tools = READ_BIT(v);
-        }
-        if (obu->seq_force_screen_content_tools > 0) {
-            obu->seq_choose_integer_mv = READ_BIT(v);
-            if (obu->seq_choose_integer_mv) {
-                obu->seq_force_integer_mv = SELECT_INTEGER_MV;
-            } else {
-                obu->seq_force_integer_mv = READ_BIT(v);
-            }
-        } else {
-            obu->seq_force_integer_mv = SELECT_INTEGER_MV;
-        }
-        if (obu->enable_order_hint) {
-            obu->order_hint_bits_minus_1 = READ_BITS(v, 3);
-            obu->OrderHintBits = obu->order_hint_bits_minus_1 + 1;
-        } else {
-            obu->OrderHintBits = 0;
+    return NULL;
+}
+
+static struct avif_item *
+find_item(AVIF *h, int id)
+{
+    for (int i = 0; i < h->meta.iloc.item_count; i++) {
+        if (h->items[i].item->item_id == id) {
+            return h->items + i;
         }
     }
-
-    obu->enable_superres = READ_BIT(v);
-    obu->enable_cdef = READ_BIT(v);
-    obu->enable_restoration = READ_BIT(v);
-    parse_color_config(&obu->cc, obu, v);
-    obu->film_grain_params_present = READ_BIT(v);
-
-    return obu;
+    return NULL;
 }
 
-int parse_metadata_itut_t35(struct metadata_itut_t35 *mi, struct bits_vec *v)
+/* the payload is only read, or looked up in the mapping, when the item is
+ * decoded
+ */
+static struct avif_item *
+avif_item_read(AVIF *h, struct avif_item *it)
 {
-    mi->itu_t_t35_country_code = READ_BITS(v, 8);
-    if (mi->itu_t_t35_country_code == 0xFF) {
-        mi->itu_t_t35_country_code_extension_byte = READ_BITS(v, 8);
+    if (it && !it->data) {
+        it->data = media_item_data(&h->mf, &h->meta.idat, it->item,
+                                   &it->length, &it->buf);
+        if (!it->data) {
+            VERR(avif, "can not read item %d", it->item->item_id);
+        }
     }
-    // skip now for mi->itu_t_t35_payload_bytes
-    while(READ_BITS(v, 8)) {
+    return it;
+}
 
+/* an av01 item is one temporal unit of OBUs, after the configOBUs of its
+ * av1C, which dec only needs once
+ */
+static int
+decode_av01(struct av1_decoder *dec, struct avif_item *it,
+            const struct av1C_box *av1c, int configured,
+            const struct av1_output *out)
+{
+    int ret = 0;
+    if (!configured && av1c && av1c->config_len > 0) {
+        ret = av1_decoder_decode(dec, av1c->config, av1c->config_len, NULL);
     }
-    return 0;
+    if (!ret) {
+        ret = av1_decoder_decode(dec, it->data, it->length, out);
+    }
+    if (!ret && !out->yuv->planes[0]) {
+        ret = -EINVAL;
+    }
+    if (ret) {
+        VERR(avif, "can not decode item %d", it->item->item_id);
+    }
+    return ret;
 }
 
+/* one av01 item to decode into its planes, a whole image or a tile */
+struct avif_job {
+    struct avif_item *item;
+    const struct av1C_box *av1c;
+    struct av1_yuv yuv;
+    int ret;
+};
 
-int parse_metadata_hdr_cll(struct metadata_hdr_cll *mh, struct bits_vec *v)
-{
-    mh->max_cll = READ_BITS(v, 16);
-    mh->max_fall = READ_BITS(v, 16);
-    return 0;
-}
+struct avif_jobs {
+    struct avif_job *jobs;
+    int num;
+    int nthreads; // of each decoder
+    atomic_int next;
+};
 
-int parse_metadata_hdr_mdcv(struct metadata_hdr_mdcv *mh, struct bits_vec *v)
+static void *
+avif_worker(void *arg)
 {
-    for (int i = 0; i < 3; i++ ) {
-        mh->primary_chromaticity_x[i] = READ_BITS(v, 16);
-        mh->primary_chromaticity_y[i] = READ_BITS(v, 16);
-    }
-    mh->white_point_chromaticity_x = READ_BITS(v, 16);
-    mh->white_point_chromaticity_y = READ_BITS(v, 16);
-    mh->luminance_max = READ_BITS(v, 32);
-    mh->luminance_min = READ_BITS(v, 32);
-    return 0;
+    struct avif_jobs *g = arg;
+    struct av1_decoder *dec = NULL;
+    const struct av1C_box *av1c = NULL;
+    int i;
+    while ((i = atomic_fetch_add(&g->next, 1)) < g->num) {
+        struct avif_job *j = &g->jobs[i];
+        struct av1_output out = {
+            .format = AV1_OUTPUT_YUV,
+            .yuv = &j->yuv,
+        };
+        // the buffers stay with the decoder from one item to the next
+        if (dec && av1c != j->av1c) {
+            av1_decoder_destroy(dec);
+            dec = NULL;
+        }
+        int configured = (dec != NULL);
+        if (!dec) {
+            dec = av1_decoder_init();
+            dec->nthreads = g->nthreads;
+            av1c = j->av1c;
+        }
+        j->ret = decode_av01(dec, j->item, j->av1c, configured, &out);
+    }
+    if (dec) {
+        av1_decoder_destroy(dec);
+    }
+    return NULL;
 }
 
-int parse_metadata_scalability(struct metadata_scalability *ms, struct bits_vec *v)
+/* the items share nothing but their av1C, which was parsed with the meta
+ * box, so they go to a pool of threads in any order. What is left of the
+ * cpus goes to the tiles inside each item.
+ */
+static int
+run_jobs(struct avif_jobs *g)
 {
-    ms->scalability_mode_idc = READ_BITS(v, 8);
-    if (ms->scalability_mode_idc == SCALABILITY_SS) {
-        ms->spatial_layers_cnt_minus_1 =  READ_BITS(v, 2);
-        ms->spatial_layer_dimensions_present_flag =  READ_BIT(v);
-        ms->spatial_layer_description_present_flag =  READ_BIT(v);
-        ms->temporal_group_description_present_flag = READ_BIT(v);
-        ms->scalability_structure_reserved_3bits = READ_BITS(v, 3);
-        if (ms->spatial_layer_dimensions_present_flag) {
-            for (int i = 0; i <= ms->spatial_layers_cnt_minus_1 ; i++ ) {
-                ms->spatial_layer_max_width[i] = READ_BITS(v, 16);
-                ms->spatial_layer_max_height[i] = READ_BITS(v, 16);
-            }
-        }
-        if (ms->spatial_layer_description_present_flag) {
-            for (int i = 0; i <= ms->spatial_layers_cnt_minus_1; i++) {
-                ms->spatial_layer_ref_id[i] = READ_BITS(v, 8);
-            }
+    int ncpu = MAX((int)sysconf(_SC_NPROCESSORS_ONLN), 1);
+    int nthreads = MIN(ncpu, g->num);
+    g->nthreads = MAX(ncpu / MAX(nthreads, 1), 1);
+    atomic_init(&g->next, 0);
+
+    // pick the kernels before the threads race for them
+    av1_dsp_init();
+    hevc_dsp_init();
+    pthread_t *tids = malloc(sizeof(pthread_t) * MAX(nthreads, 1));
+    int spawned = 0;
+    for (int i = 1; i < nthreads; i++) {
+        if (pthread_create(&tids[spawned], NULL, avif_worker, g)) {
+            break;
         }
-        if (ms->temporal_group_description_present_flag) {
-            ms->temporal_group_size = READ_BITS(v, 8);
-            ms->groups = malloc(sizeof(struct temporal_group) * ms->temporal_group_size);
-            for (int i = 0; i < ms->temporal_group_size; i++ ) {
-                ms->groups[i].temporal_group_temporal_id = READ_BITS(v, 3);
-                ms->groups[i].temporal_group_temporal_switching_up_point_flag = READ_BIT(v);
-                ms->groups[i].temporal_group_spatial_switching_up_point_flag = READ_BIT(v);
-                ms->groups[i].temporal_group_ref_cnt = READ_BITS(v, 3);
-                for (int j = 0; j < ms->groups[i].temporal_group_ref_cnt; j++) {
-                    ms->groups[i].temporal_group_ref_pic_diff[j] = READ_BITS(v, 8);
-                }
-            }
+        spawned++;
+    }
+    avif_worker(g);
+    for (int i = 0; i < spawned; i++) {
+        pthread_join(tids[i], NULL);
+    }
+    free(tids);
+    for (int i = 0; i < g->num; i++) {
+        if (g->jobs[i].ret) {
+            return g->jobs[i].ret;
         }
     }
     return 0;
 }
 
-int parse_metadata_timecode(struct metadata_timecode *mt, struct bits_vec *v)
+/* the planes of an image, a single item or the tiles of a grid in raster
+ * order, all of tile_width x tile_height, cropped to width x height
+ */
+struct avif_canvas {
+    int first; // job of the top left tile
+    int rows;
+    int columns;
+    int tile_width;
+    int tile_height;
+    int width;
+    int height;
+    const struct avif_job *tiles;
+};
+
+/* see ISO/IEC 23008-12 6.6.2.3.2 */
+static int
+read_grid(struct avif_item *it, struct grid *ig)
 {
-    mt->counting_type = READ_BITS(v, 5);
-    mt->full_timestamp_flag = READ_BIT(v);
-    mt->discontinuity_flag = READ_BIT(v);
-    mt->cnt_dropped_flag = READ_BIT(v);
-    mt->n_frames = READ_BITS(v, 9);
-    if (mt->full_timestamp_flag) {
-        mt->seconds_value = READ_BITS(v, 6);
-        mt->minutes_value = READ_BITS(v, 6);
-        mt->hours_value = READ_BITS(v, 5);
+    if (it->length < 8) {
+        return -EINVAL;
+    }
+    ig->version = it->data[0];
+    ig->flags = it->data[1];
+    ig->row_minus_one = it->data[2];
+    ig->columns_minus_one = it->data[3];
+    if ((ig->flags & 1) == 0) {
+        ig->output_width = it->data[4] << 8 | it->data[5];
+        ig->output_height = it->data[6] << 8 | it->data[7];
+    } else if (it->length >= 12) {
+        ig->output_width = (uint32_t)it->data[4] << 24 | it->data[5] << 16 |
+                           it->data[6] << 8 | it->data[7];
+        ig->output_height = (uint32_t)it->data[8] << 24 | it->data[9] << 16 |
+                            it->data[10] << 8 | it->data[11];
     } else {
-        mt->seconds_flag =  READ_BIT(v);
-        if (mt->seconds_flag) {
-            mt->seconds_value = READ_BITS(v, 6);
-            mt->minutes_flag = READ_BIT(v);
-            if (mt->minutes_flag) {
-                mt->minutes_value = READ_BITS(v, 6);
-                mt->hours_flag = READ_BIT(v);
-                if (mt->hours_flag) {
-                    mt->hours_value = READ_BITS(v, 5);
-                }
-            }
-        }
-    }
-    int time_offset_length = READ_BITS(v, 5);
-    if (time_offset_length > 0) {
-        mt->time_offset_value = READ_BITS(v, time_offset_length);
+        return -EINVAL;
     }
     return 0;
 }
 
-struct metadata_obu*
-parse_metadata_obu(struct bits_vec *v)
+static struct itemtype_ref_box *
+find_ref(AVIF *h, int from, uint32_t type)
 {
-    struct metadata_obu *mo = malloc(sizeof(struct metadata_obu));
-    mo->metadata_type = read_leb128(v);
-    if (mo->metadata_type == METADATA_TYPE_ITUT_T35) {
-        parse_metadata_itut_t35(&mo->itut_t35, v);
-    } else if (mo->metadata_type == METADATA_TYPE_HDR_CLL) {
-        parse_metadata_hdr_cll(&mo->hdr_cll, v);
-    } else if (mo->metadata_type == METADATA_TYPE_HDR_MDCV) {
-        parse_metadata_hdr_mdcv(&mo->hdr_mdcv, v);
-    } else if (mo->metadata_type == METADATA_TYPE_SCALABILITY) {
-        parse_metadata_scalability(&mo->scalability, v);
-    } else if (mo->metadata_type == METADATA_TYPE_TIMECODE) {
-        parse_metadata_timecode(&mo->timecode, v);
-    } else {
-
+    for (int i = 0; i < h->meta.iref.refs_count; i++) {
+        if (h->meta.iref.refs[i].from_item_id == (uint32_t)from &&
+            h->meta.iref.refs[i].type == type) {
+            return &h->meta.iref.refs[i];
+        }
     }
-    return mo;
+    return NULL;
 }
 
-struct frame_header_obu * parse_frame_header_obu(struct bits_vec *v)
+static int
+add_job(AVIF *h, struct avif_jobs *g, int id)
 {
-    struct frame_header_obu * obu = malloc(sizeof(*obu));
-    bits_vec_dump(v);
-    return obu;
+    struct avif_item *it = avif_item_read(h, find_item(h, id));
+    if (!it || it->type != TYPE2UINT("av01") || !it->data) {
+        VERR(avif, "item %d is not an av01 image", id);
+        return -EINVAL;
+    }
+    g->jobs = realloc(g->jobs, (g->num + 1) * sizeof(struct avif_job));
+    struct avif_job *j = &g->jobs[g->num++];
+    memset(j, 0, sizeof(*j));
+    j->item = it;
+    j->av1c = (const struct av1C_box *)get_property(h, id, FOURCC2UINT('a', 'v', '1', 'C'));
+    return 0;
 }
 
-int parse_tile_group_obu(struct bits_vec *v, int size UNUSED)
+/* the jobs of item id, an av01 image or a grid of them */
+static int
+setup_canvas(AVIF *h, int id, struct avif_jobs *g, struct avif_canvas *c)
 {
-    bits_vec_dump(v);
+    struct avif_item *it = find_item(h, id);
+    c->first = g->num;
+    c->rows = c->columns = 1;
+    c->width = c->height = 0;
+    if (!it || it->type != TYPE2UINT("grid")) {
+        return add_job(h, g, id);
+    }
+    struct grid ig;
+    if (!avif_item_read(h, it)->data || read_grid(it, &ig)) {
+        VERR(avif, "broken grid %d", id);
+        return -EINVAL;
+    }
+    c->rows = ig.row_minus_one + 1;
+    c->columns = ig.columns_minus_one + 1;
+    c->width = ig.output_width;
+    c->height = ig.output_height;
+    VDBG(avif, "grid %d: %dx%d tiles, %dx%d", id, c->rows, c->columns,
+         c->width, c->height);
+    struct itemtype_ref_box *ref = find_ref(h, id, TYPE2UINT("dimg"));
+    if (!ref || ref->ref_count != c->rows * c->columns) {
+        VERR(avif, "grid %d has no %dx%d dimg tiles", id, c->rows, c->columns);
+        return -EINVAL;
+    }
+    for (int i = 0; i < ref->ref_count; i++) {
+        if (add_job(h, g, ref->to_item_ids[i])) {
+            return -EINVAL;
+        }
+    }
     return 0;
 }
 
-int parse_frame_obu(struct bits_vec *v)
+/* the tiles are decoded now, they have to be of one size and format and
+ * cover the grid
+ */
+static int
+check_canvas(struct avif_canvas *c, const struct avif_jobs *g)
 {
-    bits_vec_dump(v);
+    c->tiles = g->jobs + c->first;
+    const struct av1_yuv *t = &c->tiles[0].yuv;
+    c->tile_width = t->width;
+    c->tile_height = t->height;
+    if (c->rows * c->columns == 1 && !c->width) {
+        c->width = t->width;
+        c->height = t->height;
+    }
+    for (int i = 1; i < c->rows * c->columns; i++) {
+        const struct av1_yuv *o = &c->tiles[i].yuv;
+        if (o->width != t->width || o->height != t->height ||
+            o->bitdepth != t->bitdepth || !o->planes[1] != !t->planes[1] ||
+            o->subsampling_x != t->subsampling_x ||
+            o->subsampling_y != t->subsampling_y) {
+            VERR(avif, "grid tile %d differs from the first one", i);
+            return -EINVAL;
+        }
+    }
+    if (c->width > c->columns * c->tile_width ||
+        c->height > c->rows * c->tile_height) {
+        VERR(avif, "%dx%d tiles do not cover %dx%d", c->tile_width,
+             c->tile_height, c->width, c->height);
+        return -EINVAL;
+    }
     return 0;
 }
 
-int parse_tile_list_obu(struct bits_vec *v)
+/* the tile sample (x, y) of c is in, at (*lx, *ly) of it, and in *n how
+ * many steps of (dx, dy) stay inside the tile
+ */
+static const struct av1_yuv *
+canvas_tile(const struct avif_canvas *c, int x, int y, int dx, int dy,
+            int *lx, int *ly, int *n)
 {
-    bits_vec_dump(v);
-    return 0;
+    int col = x / c->tile_width, row = y / c->tile_height;
+    *lx = x - col * c->tile_width;
+    *ly = y - row * c->tile_height;
+    if (dx) {
+        *n = dx > 0 ? c->tile_width - *lx : *lx + 1;
+    } else {
+        *n = dy > 0 ? c->tile_height - *ly : *ly + 1;
+    }
+    return &c->tiles[row * c->columns + col].yuv;
 }
 
+/* clap, irot and imir of an item, in the order of MIAF 7.3.6.7, folded into
+ * one mapping: the pixel (x, y) of the width x height shown is the sample
+ * (x0 + x * dxx + y * dyx, y0 + x * dxy + y * dyy) of the decoded image
+ */
+struct avif_transform {
+    int width;
+    int height;
+    int x0, y0;
+    int dxx, dxy;
+    int dyx, dyy;
+};
+
+/* see 12.1.4 of 14496-12, the offsets are from the centre of the image */
 static int
-parse_obu_header(struct obu_header *h, struct bits_vec *v)
+clap_rect(const struct clap_box *clap, int width, int height, int *left,
+          int *top, int *cw, int *ch)
 {
-    h->obu_forbidden_bit = READ_BIT(v);
-    h->obu_type = READ_BITS(v, 4);
-    h->obu_extension_flag = READ_BIT(v);
-    h->obu_has_size_field = READ_BIT(v);
-    h->obu_reserved_1bit = READ_BIT(v);
-    if (h->obu_extension_flag) {
-        h->ext.temporal_id = READ_BITS(v, 3);
-        h->ext.spatial_id = READ_BITS(v, 2);
-        h->ext.extension_header_reserved_3bits = READ_BITS(v, 3);
-    }
+    int32_t hoff = (int32_t)clap->horizOffN, voff = (int32_t)clap->vertOffN;
+    if (!clap->cleanApertureWidthD || !clap->cleanApertureHeightD ||
+        !clap->horizOffD || !clap->vertOffD ||
+        clap->cleanApertureWidthN % clap->cleanApertureWidthD ||
+        clap->cleanApertureHeightN % clap->cleanApertureHeightD) {
+        return -EINVAL;
+    }
+    int64_t w = clap->cleanApertureWidthN / clap->cleanApertureWidthD;
+    int64_t hh = clap->cleanApertureHeightN / clap->cleanApertureHeightD;
+    int64_t x = (width - w) * clap->horizOffD + 2 * (int64_t)hoff;
+    int64_t y = (height - hh) * clap->vertOffD + 2 * (int64_t)voff;
+    if (x % (2 * (int64_t)clap->horizOffD) || y % (2 * (int64_t)clap->vertOffD)) {
+        return -EINVAL;
+    }
+    x /= 2 * (int64_t)clap->horizOffD;
+    y /= 2 * (int64_t)clap->vertOffD;
+    if (w <= 0 || hh <= 0 || x < 0 || y < 0 || x + w > width || y + hh > height) {
+        return -EINVAL;
+    }
+    *left = x;
+    *top = y;
+    *cw = w;
+    *ch = hh;
     return 0;
 }
 
-int parse_obu(struct bits_vec *v, int sz, struct obu_header **obu, int idx UNUSED)
+static void
+setup_transform(AVIF *h, int id, int width, int height, struct avif_transform *t)
 {
-    struct obu_header h;
-    parse_obu_header(&h, v);
-    static struct sequence_header_obu *seqobu = NULL;
-    // static int SeenFrameHeader = -1;
-    int obu_size = 0;
-    /* The above code is declaring a variable `OperatingPointIdc` and assigning it a value based on a
-    conditional statement. If `seqobu` is not null, it will access the `operating_point_idc`
-    property of `seqobu->points[op]` and assign it to `OperatingPointIdc`. Otherwise, it will assign
-    0 to `OperatingPointIdc`. */
-    if (h.obu_has_size_field) {
-        obu_size = read_leb128(v);
-    } else {
-        obu_size = sz - 1 - h.obu_extension_flag;
-    }
-    int op = choose_operating_point();
-    int OperatingPointIdc = seqobu? seqobu->points[op].operating_point_idc : 0;
-    int startPosition = bits_vec_position(v);
-    if (h.obu_type != OBU_SEQUENCE_HEADER &&
-        h.obu_type != OBU_TEMPORAL_DELIMITER &&
-        OperatingPointIdc != 0 &&
-        h.obu_extension_flag == 1) {
-        int inTemporalLayer = (OperatingPointIdc >> h.ext.temporal_id ) & 1;
-        int inSpatialLayer = (OperatingPointIdc >> ( h.ext.spatial_id + 8 ) ) & 1;
-        if (!inTemporalLayer || !inSpatialLayer) {
-            *obu = NULL;
-            SKIP_BITS(v, obu_size * 8);
-            return obu_size;
+    const struct clap_box *clap = (const struct clap_box *)get_property(
+        h, id, FOURCC2UINT('c', 'l', 'a', 'p'));
+    const struct irot_box *irot = (const struct irot_box *)get_property(
+        h, id, FOURCC2UINT('i', 'r', 'o', 't'));
+    const struct imir_box *imir = (const struct imir_box *)get_property(
+        h, id, FOURCC2UINT('i', 'm', 'i', 'r'));
+    int left = 0, top = 0, cw = width, ch = height;
+    if (clap && clap_rect(clap, width, height, &left, &top, &cw, &ch)) {
+        VERR(avif, "ignore clap not inside %dx%d", width, height);
+        left = top = 0;
+        cw = width;
+        ch = height;
+    }
+    int angle = irot ? irot->angle : 0;
+    int mirror = imir ? imir->mode : -1;
+    t->width = (angle & 1) ? ch : cw;
+    t->height = (angle & 1) ? cw : ch;
+
+    // undo the mirror and the anti-clockwise rotation of (x, y) in turn
+    int p[3][2] = { { 0, 0 }, { 1, 0 }, { 0, 1 } };
+    for (int i = 0; i < 3; i++) {
+        int rx = p[i][0], ry = p[i][1], cx, cy;
+        if (mirror == 0) {
+            ry = t->height - 1 - ry;
+        } else if (mirror == 1) {
+            rx = t->width - 1 - rx;
         }
-    }
-    if (h.obu_type == OBU_SEQUENCE_HEADER) {
-        seqobu = parse_sequence_header_obu(v); // at most has one
-        seqobu->h = h;
-        *obu = (struct obu_header *)seqobu;
-    } else if (h.obu_type == OBU_TEMPORAL_DELIMITER) {
-        // SeenFrameHeader = 0;
-        *obu = NULL;
-    } else if (h.obu_type == OBU_FRAME_HEADER) {
-        struct frame_header_obu * fh = parse_frame_header_obu(v);
-        fh->h = h;
-        *obu = (struct obu_header *)fh;
-    } else if (h.obu_type == OBU_REDUNDANT_FRAME_HEADER) {
-        struct frame_header_obu * fh = parse_frame_header_obu(v);
-        fh->h = h;
-        *obu = (struct obu_header *)fh;
-    } else if (h.obu_type == OBU_TILE_GROUP) {
-        parse_tile_group_obu(v, obu_size);
-    } else if (h.obu_type == OBU_METADATA) {
-        struct metadata_obu *mo = parse_metadata_obu(v);
-        mo->h = h;
-        *obu = (struct obu_header *)mo;
-    } else if (h.obu_type == OBU_FRAME) {
-        parse_frame_obu(v);
-        *obu = NULL;
-    } else if (h.obu_type == OBU_TILE_LIST) {
-        parse_tile_list_obu(v);
-        *obu = NULL;
-    } else if (h.obu_type == OBU_PADDING) {
-        *obu = NULL;
-        SKIP_BITS(v, obu_size * 8);
-        return obu_size + 1 + h.obu_extension_flag;
-    } else {
-        *obu = NULL;
-        SKIP_BITS(v, obu_size * 8);
-        return obu_size + 1 + h.obu_extension_flag;
-    }
-    int currentPosition = bits_vec_position(v);
-    int payloadBits = currentPosition - startPosition;
-    if (obu_size > 0 && h.obu_type != OBU_TILE_GROUP &&
-        h.obu_type != OBU_TILE_LIST &&
-        h.obu_type != OBU_FRAME) {
-        SKIP_BITS(v, obu_size * 8 - payloadBits);
-    }
-
-    return obu_size + 1 + h.obu_extension_flag;
+        switch (angle) {
+        case 1:
+            cx = cw - 1 - ry;
+            cy = rx;
+            break;
+        case 2:
+            cx = cw - 1 - rx;
+            cy = ch - 1 - ry;
+            break;
+        case 3:
+            cx = ry;
+            cy = ch - 1 - rx;
+            break;
+        default:
+            cx = rx;
+            cy = ry;
+            break;
+        }
+        p[i][0] = left + cx;
+        p[i][1] = top + cy;
+    }
+    t->x0 = p[0][0];
+    t->y0 = p[0][1];
+    t->dxx = p[1][0] - t->x0;
+    t->dxy = p[1][1] - t->y0;
+    t->dyx = p[2][0] - t->x0;
+    t->dyy = p[2][1] - t->y0;
+    VDBG(avif, "clap %d,%d %dx%d, irot %d, imir %d", left, top, cw, ch, angle,
+         mirror);
 }
 
-
-int
-read_av1c_box(FILE *f, struct box **bn)
+/* whether all the samples t takes are in a width x height image, it is
+ * enough to look at the corners
+ */
+static bool
+transform_fits(const struct avif_transform *t, int width, int height)
 {
-    struct av1C_box *b = malloc(sizeof(struct av1C_box));
-    b->n_obu = 0;
-    // b->configOBUs = (struct obu_header **)malloc(sizeof(struct obu_header *) * 32);
-    // memset(b->configOBUs, 0, sizeof(struct obu_header *) * 32);
-    assert (b->configOBUs);
-    if (*bn == NULL) {
-        *bn = (struct box *)b;
+    for (int i = 0; i < 4; i++) {
+        int x = (i & 1) ? t->width - 1 : 0, y = (i & 2) ? t->height - 1 : 0;
+        int sx = t->x0 + x * t->dxx + y * t->dyx;
+        int sy = t->y0 + x * t->dxy + y * t->dyy;
+        if (sx < 0 || sy < 0 || sx >= width || sy >= height) {
+            return false;
+        }
     }
-    FFREAD(b, 8, 1, f);
-    b->size = SWAP(b->size);
-
-    FFREAD(&b->type + 4, 4, 1, f);
+    return true;
+}
 
-    VDBG(avif, "size %" PRIu64 "", b->size);
-    uint8_t *data = malloc(b->size - 12);
-    FFREAD(data, b->size - 12, 1, f);
-    struct bits_vec *v = bits_vec_alloc(data, b->size - 12, BITS_LSB);
-    
-    // configOBUs field contains zero or more OBUs. Any OBU may be present provided that the following procedures produce compliant AV1 bitstreams:
-
-    //the configOBUs field SHALL contain at most one Sequence Header OBU
-    // and if present, it SHALL be the first OBU.
-
-    int sz = b->size - 12;
-    while (sz) {
-        // if (b->n_obu >= 32) {
-        //     b->configOBUs = realloc(b->configOBUs, sizeof(void *) *(b->n_obu + 1));
-        // }
-        assert(b->configOBUs);
-        sz -= parse_obu(v, sz, b->configOBUs + b->n_obu, b->n_obu);
-        b->n_obu ++;
-    }
-    bits_vec_free(v);
-    VDBG(avif, "n_obu %d", b->n_obu);
-    for (int i = 0; i < b->n_obu; i ++) {
-        struct obu_header *h = b->configOBUs[i];
-        if (h->obu_type == OBU_SEQUENCE_HEADER) {
-            // struct sequence_header_obu *obu = (struct sequence_header_obu *)b->configOBUs[i];
-            // VDBG(avif, "still_picture %d, reduced_still_picture_header %d", obu->still_picture, obu->reduced_still_picture_header);
+/* one line of the picture, the samples are taken through t from wherever
+ * they are in the tiles, a run along a line of a tile as it is. Alpha goes
+ * into the same pixels while they are at hand.
+ */
+static void
+convert_line(uint8_t *dst, const struct avif_canvas *c,
+             const struct avif_canvas *alpha, const struct avif_transform *t,
+             int line, int16_t *buf)
+{
+    const struct hevc_dsp *dsp = hevc_dsp_get();
+    int x = t->x0 + line * t->dyx, y = t->y0 + line * t->dyy;
+    for (int i = 0, n; i < t->width; i += n) {
+        int lx, ly;
+        const struct av1_yuv *yuv = canvas_tile(c, x, y, t->dxx, t->dxy, &lx, &ly, &n);
+        n = MIN(n, t->width - i);
+        int sx = yuv->subsampling_x, sy = yuv->subsampling_y;
+        const int16_t *py = (const int16_t *)yuv->planes[0] + ly * yuv->strides[0] + lx;
+        if (t->dxx == 1 && yuv->planes[1] && !(lx & sx)) {
+            int cl = (ly >> sy) * yuv->strides[1] + (lx >> sx);
+            dsp->yuv_bgra32(dst + 4 * i, py, (const int16_t *)yuv->planes[1] + cl,
+                            (const int16_t *)yuv->planes[2] + cl, n, sx,
+                            yuv->bitdepth);
+        } else {
+            int16_t *u = buf + t->width, *v = u + t->width;
+            for (int k = 0, px = lx, qy = ly; k < n; k++, px += t->dxx, qy += t->dxy) {
+                buf[k] = yuv->planes[0][qy * yuv->strides[0] + px];
+                if (yuv->planes[1]) {
+                    int cl = (qy >> sy) * yuv->strides[1] + (px >> sx);
+                    u[k] = yuv->planes[1][cl];
+                    v[k] = yuv->planes[2][cl];
+                } else {
+                    u[k] = v[k] = 1 << (yuv->bitdepth - 1);
+                }
+            }
+            dsp->yuv_bgra32(dst + 4 * i, buf, u, v, n, 0, yuv->bitdepth);
         }
+        x += n * t->dxx;
+        y += n * t->dxy;
+    }
+    if (!alpha) {
+        return;
+    }
+    x = t->x0 + line * t->dyx;
+    y = t->y0 + line * t->dyy;
+    for (int i = 0, n; i < t->width; i += n) {
+        int lx, ly;
+        const struct av1_yuv *a = canvas_tile(alpha, x, y, t->dxx, t->dxy, &lx, &ly, &n);
+        n = MIN(n, t->width - i);
+        const uint16_t *pa = a->planes[0] + ly * a->strides[0] + lx;
+        int step = t->dxx + t->dxy * a->strides[0];
+        int shift = a->bitdepth - 8;
+        if (a->color_range) {
+            for (int k = 0; k < n; k++, pa += step) {
+                dst[4 * (i + k) + 3] = *pa >> shift;
+            }
+        } else {
+            // studio swing alpha is stretched to full range, as libavif does
+            int lo = 16 << shift, range = 219 << shift;
+            int full = (1 << a->bitdepth) - 1;
+            for (int k = 0; k < n; k++, pa += step) {
+                int v = ((*pa - lo) * full + range / 2) / range;
+                dst[4 * (i + k) + 3] = clamp(v, full) >> shift;
+            }
+        }
+        x += n * t->dxx;
+        y += n * t->dxy;
     }
-
-    VDBG(avif, "av1C: version %d, marker 0x%x", b->version,
-                b->marker);
-
-    return b->size;
 }
 
-void decode_av01(uint8_t *data, uint64_t len, uint8_t **pixels UNUSED)
+static bool
+is_alpha(AVIF *h, int id)
 {
-    // hexdump(stdout, "coded ", "", data, 256);
-    uint8_t *p = data;
-    while (len > 0) {
-        int sample_len = p[0] << 24 | p[1] << 16 | p[2] << 8 | p[3];
-        len -= 4;
-        p += 4;
-        // parse_nalu(p, sample_len, pixels);
-        len -= sample_len;
-        p += sample_len;
-    }
+    const struct auxC_box *auxc = (const struct auxC_box *)get_property(
+        h, id, FOURCC2UINT('a', 'u', 'x', 'C'));
+    return auxc && auxc->aux_type &&
+           (!strcmp(auxc->aux_type, "urn:mpeg:mpegB:cicp:systems:auxiliary:alpha") ||
+            !strcmp(auxc->aux_type, "urn:mpeg:hevc:2015:auxid:1"));
 }
 
-static int pre_read_item(AVIF *h, FILE *f, uint32_t idx) {
-    // for now make sure, extent_count = 1 work
-    if (h->items[idx].item->extent_count == 1) {
-        h->items[idx].length = h->items[idx].item->extents[0].extent_length;
-        h->items[idx].data = malloc(h->items[idx].length);
-        fseek(f, h->items[idx].item->base_offset + h->items[idx].item->extents[0].extent_offset, SEEK_SET);
-        FFREAD(h->items[idx].data, h->items[idx].length, 1, f);
-    } else {
-        h->items[idx].data = malloc(1);
-        uint64_t total = 0;
-        for (int i = 0; i < h->items[idx].item->extent_count; i++) {
-            h->items[idx].data = realloc(h->items[idx].data,
-                        h->items[idx].item->extents[i].extent_length);
-            fseek(f, h->items[idx].item->base_offset + h->items[idx].item->extents[i].extent_offset, SEEK_SET);
-            FFREAD(h->items[idx].data, h->items[idx].item->extents[i].extent_length, 1, f);
-            total += h->items[idx].item->extents[i].extent_length;
+/* the auxl alpha plane of item id, -1 if it has none */
+static int
+find_alpha_item(AVIF *h, int id)
+{
+    for (int i = 0; i < h->meta.iref.refs_count; i++) {
+        struct itemtype_ref_box *ref = &h->meta.iref.refs[i];
+        if (ref->type != TYPE2UINT("auxl")) {
+            continue;
+        }
+        for (int j = 0; j < ref->ref_count; j++) {
+            if (ref->to_item_ids[j] == (uint32_t)id &&
+                is_alpha(h, ref->from_item_id)) {
+                return ref->from_item_id;
+            }
         }
-        h->items[idx].length = total;
     }
-    return 0;
+    return -1;
 }
 
-static void decode_items(AVIF *h, FILE *f, uint8_t **pixels) {
-    for (int i = 0; i < h->meta.iloc.item_count; i++) {
-        pre_read_item(h, f, i);
-        if (h->items[i].type == TYPE2UINT("mime")) {
-            // exif mime, skip it
-            // hexdump(stdout, "exif:", "", h->items[i].data,
-            // h->items[i].length);
-            VDBG(avif, "exif %" PRIu64, h->items[i].length);
-        } else if (h->items[i].type == TYPE2UINT("av01")) {
-            // take it as real coded data
-            VINFO(avif, "decoding id 0x%p len %" PRIu64, (void *)h->items[i].data, h->items[i].length);
-            decode_av01(h->items[i].data, h->items[i].length, pixels);
+/* the primary item and its alpha plane, all their av01 items decoded side
+ * by side, then converted straight to the picture as t says
+ */
+static int
+decode_items(AVIF *h, struct pic *p, const struct avif_transform *t)
+{
+    int primary_id = h->meta.pitm.item_id;
+    int alpha_id = find_alpha_item(h, primary_id);
+    struct avif_jobs g = { .jobs = NULL };
+    struct avif_canvas c, a;
+    int ret = setup_canvas(h, primary_id, &g, &c);
+    if (!ret && alpha_id >= 0 && setup_canvas(h, alpha_id, &g, &a)) {
+        VERR(avif, "ignore alpha item %d", alpha_id);
+        g.num = a.first;
+        alpha_id = -1;
+    }
+    if (!ret) {
+        ret = run_jobs(&g);
+    }
+    if (!ret) {
+        ret = check_canvas(&c, &g);
+    }
+    if (!ret && !transform_fits(t, c.width, c.height)) {
+        VERR(avif, "%dx%d image is smaller than its ispe", c.width, c.height);
+        ret = -EINVAL;
+    }
+    if (!ret && alpha_id >= 0 &&
+        (check_canvas(&a, &g) || a.width != c.width || a.height != c.height)) {
+        VERR(avif, "alpha item %d does not match the image", alpha_id);
+        alpha_id = -1;
+    }
+    if (!ret) {
+        VINFO(avif, "primary %d, alpha %d, %d items", primary_id, alpha_id, g.num);
+        int16_t *buf = malloc(3 * t->width * sizeof(int16_t));
+        for (int i = 0; i < t->height; i++) {
+            convert_line((uint8_t *)p->pixels + i * p->pitch, &c,
+                         alpha_id >= 0 ? &a : NULL, t, i, buf);
         }
+        free(buf);
+    }
+    for (int i = 0; i < g.num; i++) {
+        free(g.jobs[i].yuv.planes[0]);
     }
+    free(g.jobs);
+    return ret;
 }
+
+static void AVIF_free(struct pic *p);
+
 static struct pic* 
 AVIF_load(const char *filename, int skip_flag UNUSED)
 {
         struct pic *p = pic_alloc(sizeof(AVIF));
     AVIF *h = p->pic;
     FILE *f = fopen(filename, "rb");
+    media_file_open(&h->mf, f);
     fseek(f, 0, SEEK_END);
     uint64_t size = ftell(f);
     fseek(f, 0, SEEK_SET);
@@ -616,6 +683,11 @@ AVIF_load(const char *filename, int skip_flag UNUSED)
     struct box b;
     while (size) {
         uint32_t type = probe_box(f, &b);
+        // a truncated file ends in a box that is not all there
+        if (b.size == 0 || b.size > size) {
+            VERR(avif, "truncated box %s", UINT2TYPE(type));
+            break;
+        }
         switch (type) {
         case FOURCC2UINT('m', 'e', 't', 'a'):
             read_meta_box(f, &h->meta);
@@ -624,8 +696,11 @@ AVIF_load(const char *filename, int skip_flag UNUSED)
             h->mdat_num ++;
             // h->mdat = realloc(h->mdat, h->mdat_num * sizeof(struct mdat_box));
             // read_mdat_box(f, h->mdat + h->mdat_num - 1);
+            // payloads are reached through iloc, skip it
+            fseek(f, b.size, SEEK_CUR);
             break;
         default:
+            fseek(f, b.size, SEEK_CUR);
             break;
         }
         size -= b.size;
@@ -633,14 +708,7 @@ AVIF_load(const char *filename, int skip_flag UNUSED)
              b.size, size);
     }
 
-    // extract some info from meta box
-    for (int i = 0; i < 2; i ++) {
-        if (h->meta.iprp.ipco.property[i]->type == TYPE2UINT("ispe")) {
-            p->width = ((struct ispe_box *)(h->meta.iprp.ipco.property[i]))->image_width;
-            p->height = ((struct ispe_box *)(h->meta.iprp.ipco.property[i]))->image_height;
-        }
-    }
-    h->items = malloc(h->meta.iloc.item_count * sizeof(struct avif_item));
+    h->items = calloc(h->meta.iloc.item_count, sizeof(struct avif_item));
     for (int i = 0; i < h->meta.iloc.item_count; i++) {
         h->items[i].item = &h->meta.iloc.items[i];
         for (int j = 0; j < (int)h->meta.iinf.entry_count; j++) {
@@ -650,26 +718,28 @@ AVIF_load(const char *filename, int skip_flag UNUSED)
             }
         }
     }
-    uint16_t primary_id = h->meta.pitm.item_id;
-    VINFO(avif, "primary id %d", h->meta.pitm.item_id);
-    for (int i = 0; i < (int)h->meta.iloc.item_count; i++) {
-        if (h->meta.iloc.items[i].item_id == primary_id) {
-            VINFO(avif, "primary loc at %" PRIu64,
-                  h->meta.iloc.items[i].base_offset);
-            break;
-        }
+    int primary_id = h->meta.pitm.item_id;
+    struct ispe_box *ispe = (struct ispe_box *)get_property(
+        h, primary_id, FOURCC2UINT('i', 's', 'p', 'e'));
+    VINFO(avif, "primary id %d", primary_id);
+    struct avif_transform t = { .width = 0 };
+    if (ispe) {
+        setup_transform(h, primary_id, ispe->image_width, ispe->image_height, &t);
     }
-    // process mdata
-    VINFO(avif, "mdat_num %d", h->mdat_num);
-    p->width = ((p->width + 3) >> 2) << 2;
+    p->width = ((t.width + 3) >> 2) << 2;
+    p->height = t.height;
     p->depth = 32;
     p->pitch = ((((p->width + 15) >> 4) * 16 * p->depth + p->depth - 1) >> 5) << 2;
     p->pixels = malloc(p->pitch * p->height);
-    p->format = CS_PIXELFORMAT_RGB888;
-    decode_items(h, f, (uint8_t **)&p->pixels);
+    p->format = CS_PIXELFORMAT_RGBA8888;
+    int ret = ispe ? decode_items(h, p, &t) : -EINVAL;
 
     fclose(f);
-
+    h->mf.f = NULL;
+    if (ret) {
+        AVIF_free(p);
+        return NULL;
+    }
     return p;
 }
 
@@ -678,8 +748,14 @@ AVIF_free(struct pic *p)
 {
     AVIF * a = (AVIF *)p->pic;
     if (a->items) {
+        for (int i = 0; i < a->meta.iloc.item_count; i++) {
+            free(a->items[i].buf);
+        }
         free(a->items);
     }
+    free_meta_box(&a->meta);
+    media_file_close(&a->mf);
+    free(p->pixels);
     pic_free(p);
 }
 
@@ -5,6 +5,8 @@
 #include <string.h>
 #include <assert.h>
 #include <inttypes.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "byteorder.h"
 #include "basemedia.h"
@@ -481,6 +483,14 @@ read_irot_box(FILE *f, struct irot_box *b)
     return b->size;
 }
 
+int
+read_imir_box(FILE *f, struct imir_box *b)
+{
+    FFREAD_BOX_ST(b, f, FOURCC2UINT('i', 'm', 'i', 'r'));
+    b->mode = read_u8(f) & 0x1;
+    return b->size;
+}
+
 extern int read_hvcc_box(FILE *f, struct box **bn);
 extern int read_av1c_box(FILE *f, struct box **bn);
 
@@ -491,7 +501,7 @@ read_ipco_box(FILE *f, struct ipco_box *b)
     int64_t s = b->size - 8;
     int n = 0;
     VDBG(basemedia, "IPCO: total length %" PRIu64 "", s);
-    while (s > 0) {
+    while (s > 0 && n < IPCO_MAX_PROPERTY) {
         struct box p;
         struct box *cc = NULL;
         uint32_t type = probe_box(f, &p);
@@ -535,12 +545,24 @@ read_ipco_box(FILE *f, struct ipco_box *b)
                 s -= read_irot_box(f, (struct irot_box*)cc);
                 b->property[n++] = (struct box *)cc;
                 break;
+            case FOURCC2UINT('i', 'm', 'i', 'r'):
+                cc = calloc(1, sizeof(struct imir_box));
+                s -= read_imir_box(f, (struct imir_box*)cc);
+                b->property[n++] = (struct box *)cc;
+                break;
             default:
+                cc = malloc(sizeof(struct box));
+                *cc = p;
+                b->property[n++] = cc;
                 s -= (p.size);
                 fseek(f, p.size, SEEK_CUR);
                 break;
         }
     }
+    if (s > 0) {
+        VERR(basemedia, "IPCO: more than %d properties", IPCO_MAX_PROPERTY);
+        fseek(f, s, SEEK_CUR);
+    }
     b->n_property = n;
     VDBG(basemedia, "IPCO: property %d", b->n_property);
     return b->size;
@@ -747,13 +769,19 @@ int read_stsd_box(FILE *f, struct stsd_box *b)
     for (uint32_t i = 0; i < b->entry_count; i++) {
         struct box p;
         probe_box(f, &p);
+        long start = ftell(f);
         struct SampleEntry *e = NULL;
-        if (p.type == FOURCC2UINT('h', 'v', 'c', '1')) {
+        if (p.type == FOURCC2UINT('h', 'v', 'c', '1') ||
+            p.type == FOURCC2UINT('h', 'e', 'v', '1')) {
             read_HEVCSampleEntry(f, &e);
+        }
+        // the boxes after the config, like ccst for image sequences
+        fseek(f, start + p.size, SEEK_SET);
+        if (i < 16) {
+            b->entries[i] = e;
         } else {
-            fseek(f, p.size, SEEK_CUR);
+            free(e);
         }
-        b->entries[i] = e;
     }
     return b->size;
 }
@@ -1252,6 +1280,7 @@ void free_auxc_box(struct auxC_box *b) {
 }
 
 extern void free_hvcc_box(struct box *b);
+extern void free_av1c_box(struct box *b);
 
 void free_ipco_box(struct ipco_box *b)
 {
@@ -1259,6 +1288,8 @@ void free_ipco_box(struct ipco_box *b)
         if (b->property[i]) {
             if (b->property[i]->type == FOURCC2UINT('h', 'v', 'c', 'C')) {
                 free_hvcc_box(b->property[i]);
+            } else if (b->property[i]->type == FOURCC2UINT('a', 'v', '1', 'C')) {
+                free_av1c_box(b->property[i]);
             } else if (b->property[i]->type == FOURCC2UINT('p', 'i', 'x', 'i')) {
                 free_pixi_box((struct pixi_box *)b->property[i]);
             } else if(b->property[i]->type == FOURCC2UINT('a', 'u', 'x', 'C')) {
@@ -1308,7 +1339,7 @@ void free_elng_box(struct elng_box *b)
 
 void free_stsd_box(struct stsd_box *b)
 {
-    for (uint32_t i = 0; i < b->entry_count; i++) {
+    for (uint32_t i = 0; i < b->entry_count && i < 16; i++) {
         free(b->entries[i]);
     }
 }
@@ -1422,3 +1453,115 @@ void free_moov_box(struct moov_box *b)
         free(b->udta);
     }
 }
+
+void
+media_file_open(struct media_file *m, FILE *f)
+{
+    struct stat st;
+    m->f = f;
+    m->map = NULL;
+    m->size = 0;
+    if (fstat(fileno(f), &st) || st.st_size <= 0) {
+        return;
+    }
+    m->size = st.st_size;
+    // the decoders only read their input, they copy what they unescape
+    void *map = mmap(NULL, m->size, PROT_READ, MAP_PRIVATE, fileno(f), 0);
+    if (map != MAP_FAILED) {
+        m->map = map;
+    }
+}
+
+void
+media_file_close(struct media_file *m)
+{
+    if (m->map) {
+        munmap(m->map, m->size);
+        m->map = NULL;
+    }
+    m->f = NULL;
+}
+
+/* see 8.11.3.1, where construct_method puts extent j */
+static uint8_t *
+media_extent(struct media_file *m, const struct idat_box *idat,
+             const struct item_location *item, int j, uint8_t *dst)
+{
+    uint64_t offset = item->base_offset + item->extents[j].extent_offset;
+    uint64_t length = item->extents[j].extent_length;
+
+    // none of the sums may wrap around
+    if (offset < item->base_offset) {
+        return NULL;
+    }
+    if (item->construct_method == 1) {
+        if (!idat->data || idat->size < 8 || length > idat->size - 8 ||
+            offset > idat->size - 8 - length) {
+            return NULL;
+        }
+        if (!dst) {
+            return idat->data + offset;
+        }
+        memcpy(dst, idat->data + offset, length);
+        return dst;
+    }
+    if (item->construct_method != 0 ||
+        (m->size && (length > m->size || offset > m->size - length))) {
+        return NULL;
+    }
+    if (m->map) {
+        if (!dst) {
+            return m->map + offset;
+        }
+        memcpy(dst, m->map + offset, length);
+        return dst;
+    }
+    if (!dst || fseek(m->f, offset, SEEK_SET) ||
+        fread(dst, 1, length, m->f) != length) {
+        return NULL;
+    }
+    return dst;
+}
+
+uint8_t *
+media_item_data(struct media_file *m, const struct idat_box *idat,
+                const struct item_location *item, uint64_t *length,
+                uint8_t **buf)
+{
+    *buf = NULL;
+    *length = 0;
+    if (item->extent_count <= 0) {
+        return NULL;
+    }
+    if (item->extent_count == 1 && (m->map || item->construct_method == 1)) {
+        uint8_t *data = media_extent(m, idat, item, 0, NULL);
+        if (data) {
+            *length = item->extents[0].extent_length;
+        }
+        return data;
+    }
+    // more extents are glued together, in order
+    uint64_t total = 0;
+    for (int j = 0; j < item->extent_count; j++) {
+        if (item->extents[j].extent_length > UINT64_MAX - total) {
+            return NULL;
+        }
+        total += item->extents[j].extent_length;
+    }
+    uint8_t *data = malloc(total ? total : 1);
+    if (!data) {
+        return NULL;
+    }
+    uint64_t pos = 0;
+    for (int j = 0; j < item->extent_count; j++) {
+        if (!media_extent(m, idat, item, j, data + pos)) {
+            VERR(basemedia, "item %d extent %d out of range", item->item_id, j);
+            free(data);
+            return NULL;
+        }
+        pos += item->extents[j].extent_length;
+    }
+    *buf = data;
+    *length = total;
+    return data;
+}
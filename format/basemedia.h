@@ -587,12 +587,28 @@ struct irot_box {
 #endif
 };
 
+/* see ISO/IEC 23008-12 6.5.12 image mirroring, applied after irot */
+struct imir_box {
+    BOX_ST;
+#if BYTE_ORDER == LITTLE_ENDIAN
+    uint8_t mode : 1; // 0 swaps top and bottom, 1 left and right
+    uint8_t reserved : 7;
+#else
+    uint8_t reserved:7;
+    uint8_t mode:1;
+#endif
+};
+
 /* for HEIF may have hvcC, ispe, pixi, clap */
 /* for avif may have av1C, ispe, pixi, psap */
+/* properties we do not know are kept as a bare box, so the indices of ipma
+ * still point at the right ones
+ */
+#define IPCO_MAX_PROPERTY (32)
 struct ipco_box {
     BOX_ST;
     int n_property;
-    struct box *property[16];
+    struct box *property[IPCO_MAX_PROPERTY];
 };
 
 
@@ -743,6 +759,29 @@ void free_moov_box(struct moov_box *b);
 
 int read_VisualSampleEntry(FILE *f, struct VisualSampleEntry *e);
 
+/* random access to the payloads iloc points at. Only the box tree is read
+ * up front, an item is fetched when it is decoded. The file is mapped when
+ * possible, and an item of a single extent then comes without a copy.
+ */
+struct media_file {
+    FILE *f;
+    uint8_t *map;   // private mapping, NULL if mmap is not available
+    size_t size;
+};
+
+/* f stays owned by the caller, the mapping lives until media_file_close */
+void media_file_open(struct media_file *m, FILE *f);
+void media_file_close(struct media_file *m);
+
+/* resolve the extents of item to file (or idat) ranges and return its
+ * payload. *buf is set when it had to be copied and must be freed, it is
+ * NULL when the data points into the mapping. NULL on a range outside of
+ * the file.
+ */
+uint8_t *media_item_data(struct media_file *m, const struct idat_box *idat,
+                         const struct item_location *item, uint64_t *length,
+                         uint8_t **buf);
+
 uint8_t read_u8(FILE *f);
 uint16_t read_u16(FILE *f);
 uint32_t read_u32(FILE *f);
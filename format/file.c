@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <strings.h>
 
@@ -44,8 +45,27 @@ file_probe(const char *filename)
 }
 
 struct pic * file_load(struct file_ops *ops, const char *filename, int skip_flag) {
+    // pics left from the last file are dropped with the queue
+    ring_free(rq);
     rq = ring_alloc(64);
-    return ops->load(filename, skip_flag);
+    struct pic *p = ops->load(filename, skip_flag);
+    // loaders queue all their pics before they return, so a consumer
+    // waiting in file_wait_pic stops once it has taken them
+    ring_close(rq);
+    return p;
+}
+
+struct pic *
+file_load_thumbnail(struct file_ops *ops, const char *filename)
+{
+    if (!ops->thumbnail) {
+        return file_load(ops, filename, 0);
+    }
+    ring_free(rq);
+    rq = ring_alloc(64);
+    struct pic *p = ops->thumbnail(filename);
+    ring_close(rq);
+    return p;
 }
 
 struct pic *
@@ -55,6 +75,12 @@ file_dequeue_pic(void)
     return p;
 }
 
+struct pic *
+file_wait_pic(int timeout_ms)
+{
+    return (struct pic *)ring_dequeue_wait(rq, timeout_ms);
+}
+
 bool file_enqueue_pic(struct pic *p) {
     return ring_enqueue(rq, (void *)p);
 }
@@ -135,3 +161,60 @@ void pic_free(struct pic *p)
         p->refcnt--;
     }
 }
+
+struct idec *
+idec_new(struct file_ops *ops)
+{
+    if (!ops || !ops->idec) {
+        return NULL;
+    }
+    struct idec *d = calloc(1, sizeof(struct idec));
+    d->ops = ops;
+    d->status = IDEC_SUSPENDED;
+    return d;
+}
+
+int
+idec_append(struct idec *d, const uint8_t *buf, size_t len)
+{
+    if (d->status != IDEC_SUSPENDED) {
+        return d->status;
+    }
+    if (d->len + len > d->size) {
+        size_t size = d->size ? d->size : 4096;
+        while (size < d->len + len) {
+            size <<= 1;
+        }
+        uint8_t *data = realloc(d->data, size);
+        if (!data) {
+            d->status = IDEC_ERROR;
+            return d->status;
+        }
+        d->data = data;
+        d->size = size;
+    }
+    memcpy(d->data + d->len, buf, len);
+    d->len += len;
+    d->status = d->ops->idec(d);
+    return d->status;
+}
+
+struct pic *
+idec_get_rows(struct idec *d, int *rows)
+{
+    *rows = d->p ? d->rows : 0;
+    return d->p;
+}
+
+void
+idec_free(struct idec *d)
+{
+    if (d->ops->idec_free) {
+        d->ops->idec_free(d);
+    }
+    if (d->p) {
+        file_free(d->ops, d->p);
+    }
+    free(d->data);
+    free(d);
+}
@@ -15,6 +15,8 @@ extern "C" {
 #define READ_OK(dst, size, nitem, f) (fread(dst, size, nitem, f) == nitem)
 #define READ_FAIL(dst, size, nitem, f) (fread(dst, size, nitem, f) != nitem)
 
+struct idec;
+
 struct file_ops {
     const char *name;
     const char *alias;
@@ -23,6 +25,12 @@ struct file_ops {
     void (*free)(struct pic *p);
     void (*info)(FILE *f, struct pic* p);
     void (*encode)(struct pic *p, const char *fname);
+    /* optional, decode what d->data holds so far, see enum idec_status */
+    int (*idec)(struct idec *d);
+    /* free the private state of idec, the pic is freed by free */
+    void (*idec_free)(struct idec *d);
+    /* optional, decode only a small preview stored in the file */
+    struct pic* (*thumbnail)(const char *filename);
     TAILQ_ENTRY(file_ops) next;
 };
 
@@ -61,16 +69,53 @@ struct file_ops* file_probe(const char *filename);
  *         return NULL if we have multiple pics and put all pics in a queue
  */
 struct pic *file_load(struct file_ops *ops, const char *filename, int skip_flag);
+/* the embedded thumbnail, or the whole picture when the format has none */
+struct pic *file_load_thumbnail(struct file_ops *ops, const char *filename);
 void file_free(struct file_ops* ops, struct pic *p);
 void file_info(struct file_ops *ops, struct pic *p);
 struct file_ops *file_find_codec(const char *name);
 
 //
 struct pic *file_dequeue_pic(void);
+/* sleep until a pic comes in, timeout_ms < 0 waits forever. NULL on timeout
+ * or once all the pics of the file loaded last are taken */
+struct pic *file_wait_pic(int timeout_ms);
 bool file_enqueue_pic(struct pic *p);
 
 void file_ops_init(void);
 
+/* incremental decoding, data comes in pieces and the rows decoded so far
+ * can be shown before the whole file arrives */
+enum idec_status {
+    IDEC_ERROR = -1,
+    IDEC_SUSPENDED = 0,     // waiting for more data
+    IDEC_DONE = 1,
+};
+
+struct idec {
+    struct file_ops *ops;
+    uint8_t *data;          // all bytes appended so far
+    size_t len;
+    size_t size;            // allocated size of data
+    int status;
+    struct pic *p;          // created by the codec once the header is known
+    int rows;               // rows from the top of p which can be shown,
+                            // a progressive jpeg refines them scan by scan
+    void *priv;             // codec state between two calls
+};
+
+/* NULL if the codec can not decode incrementally */
+struct idec *idec_new(struct file_ops *ops);
+
+/* append len bytes and decode as much as possible, return enum idec_status */
+int idec_append(struct idec *d, const uint8_t *buf, size_t len);
+
+/* picture decoded so far, *rows is set to the number of rows to show.
+ * The picture belongs to d and is valid until idec_free */
+struct pic *idec_get_rows(struct idec *d, int *rows);
+
+void idec_free(struct idec *d);
+
 #ifdef __cplusplus
 }
 #endif
@@ -6,8 +6,12 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include <inttypes.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <unistd.h>
 
 #include "hevc.h"
+#include "hevcdsp.h"
 #include "vlog.h"
 #include "utils.h"
 #include "heif.h"
@@ -73,6 +77,7 @@ void free_hvcc_box(struct box *bn)
     if (b->nal_arrays) {
         free(b->nal_arrays);
     }
+    free_hevc_param_set(&b->hps);
 }
 
 int
@@ -133,7 +138,8 @@ int read_HEVCSampleEntry(FILE *f, struct SampleEntry **b)
     read_VisualSampleEntry(f, &e->sample);
     assert(e->sample.entry.type == FOURCC2UINT('h', 'v', 'c', '1') ||
            e->sample.entry.type == FOURCC2UINT('h', 'e', 'v', '1'));
-    read_hvcc_box(f, (struct box **)(&e->config));
+    struct box *config = (struct box *)&e->config;
+    read_hvcc_box(f, &config);
     return 0;
 }
 
@@ -157,8 +163,13 @@ get_ipma_item_from_item_id(HEIF *h, int id, uint32_t fourcc)
                 for (int k = 0; k < h->meta.iprp.ipma.entries[i].association_count; k++) {
                     // int essential = h->meta.iprp.ipma.entries[i].property_index[k] >> 15;
                     int property_index = h->meta.iprp.ipma.entries[i].property_index[k] & 0x7FFF;
+                    // 0 is no property, the rest are 1 based into ipco
+                    if (property_index == 0 ||
+                        property_index > h->meta.iprp.ipco.n_property) {
+                        continue;
+                    }
                     struct box *b = (struct box *)h->meta.iprp.ipco.property[property_index-1];
-                    if (b->type == fourcc) {
+                    if (b && b->type == fourcc) {
                         return h->meta.iprp.ipco.property[property_index-1];
                     }
                 }
@@ -198,8 +209,12 @@ get_ispe_by_item_id(HEIF *h, int id)
             for (int k = 0; k < h->meta.iprp.ipma.entries[i].association_count; k++) {
                 // int essential = h->meta.iprp.ipma.entries[i].property_index[k] >> 15;
                 int property_index = h->meta.iprp.ipma.entries[i].property_index[k] & 0x7FFF;
+                if (property_index == 0 ||
+                    property_index > h->meta.iprp.ipco.n_property) {
+                    continue;
+                }
                 struct box *bb = h->meta.iprp.ipco.property[property_index - 1];
-                if (bb->type == FOURCC2UINT('i', 's', 'p', 'e')) {
+                if (bb && bb->type == FOURCC2UINT('i', 's', 'p', 'e')) {
                     return (struct ispe_box *)bb;
                 }
             }
@@ -209,54 +224,54 @@ get_ispe_by_item_id(HEIF *h, int id)
     return NULL;
 }
 
-static void
-pre_read_item(HEIF * h, FILE *f, uint32_t idx)
+/* the payload is only read, or looked up in the mapping, when the item is
+ * decoded, items which are never used cost nothing
+ */
+static struct heif_item *
+heif_item_read(HEIF *h, struct heif_item *it)
 {
-    // for now make sure, extent_count = 1 work
-    assert(h->items[idx].item->extent_count == 1);
-    if (h->items[idx].item->extent_count == 1) {
-        h->items[idx].length = h->items[idx].item->extents[0].extent_length;
-        h->items[idx].data = malloc(h->items[idx].length);
-        VDBG(heif, "read item %d, length %" PRIu64 ", method %d", idx,
-             h->items[idx].length, h->items[idx].item->construct_method);
-        if (h->items[idx].item->construct_method == 0) {//file offset
-            fseek(f, h->items[idx].item->base_offset + h->items[idx].item->extents[0].extent_offset, SEEK_SET),
-            fread(h->items[idx].data, h->items[idx].length, 1, f);
-        } else if (h->items[idx].item->construct_method == 1) {//idat offset
-            memcpy(h->items[idx].data, h->meta.idat.data + h->items[idx].item->base_offset + h->items[idx].item->extents[0].extent_offset, h->items[idx].length);
-            // hexdump(stdout, "idat", "", h->items[idx].data, h->items[idx].length);
-        } else if (h->items[idx].item->construct_method == 2) { // item offset
-
-        }
-    } else {
-        h->items[idx].data = malloc(1);
-        uint64_t total = 0;
-        for (int i = 0; i < h->items[idx].item->extent_count; i ++) {
-            h->items[idx].data = realloc(h->items[idx].data, h->items[idx].item->extents[i].extent_length);
-            fseek(f, h->items[idx].item->base_offset + h->items[idx].item->extents[i].extent_offset, SEEK_SET),
-            fread(h->items[idx].data, h->items[idx].item->extents[i].extent_length, 1, f);
-            total += h->items[idx].item->extents[i].extent_length;
+    if (it && !it->data) {
+        it->data = media_item_data(&h->mf, &h->meta.idat, it->item,
+                                   &it->length, &it->buf);
+        if (!it->data) {
+            VERR(heif, "can not read item %d", it->item->item_id);
         }
-        h->items[idx].length = total;
     }
+    return it;
 }
 
-void decode_hvc1(uint8_t *data, uint64_t len, uint8_t **pixels,
-                 struct hevc_param_set *hps) {
+static void
+decode_hvc1(struct hevc_decoder *dec, uint8_t *data, uint64_t len,
+            const struct hevc_output *out) {
     // hexdump(stdout, "coded ", "", data, 256);
     uint8_t *p = data;
     while (len > 0) {
         int sample_len = p[0] << 24 | p[1] << 16| p[2] << 8| p[3];
         len -= 4;
         p += 4;
-        parse_nalu(p, sample_len, pixels, hps);
+        hevc_decoder_decode_nal(dec, p, sample_len, out);
         len -= sample_len;
         p += sample_len;
     }
 }
 
+/* the whole picture p was allocated for */
+static struct hevc_output
+pic_output(struct pic *p)
+{
+    struct hevc_output out = {
+        .pixels = p->pixels,
+        .pitch = p->pitch,
+        .width = p->width,
+        .height = p->height,
+    };
+    return out;
+}
+
+static void HEIF_free(struct pic *p);
+
 static struct pic *
-HEIF_load_one(int width, int height, uint8_t *data, int length, struct hevc_param_set *hps) {
+HEIF_pic_alloc(int width, int height) {
     struct pic *p = pic_alloc(sizeof(HEIF));
     // HEIF *h = p->pic;
     p->width = width;
@@ -266,49 +281,154 @@ HEIF_load_one(int width, int height, uint8_t *data, int length, struct hevc_para
     p->pitch = ((((p->width + 15) >> 4) * 16 * p->depth + p->depth - 1) >> 5) << 2;
     p->pixels = malloc(p->pitch * p->height);
     p->format = CS_PIXELFORMAT_RGBA8888;
-    decode_hvc1(data, length, (uint8_t **)&p->pixels, hps);
     return p;
 }
 
+static struct pic *
+HEIF_load_one(int width, int height, uint8_t *data, int length, struct hevc_param_set *hps) {
+    struct pic *p = HEIF_pic_alloc(width, height);
+    struct hevc_output out = pic_output(p);
+    struct hevc_decoder *dec = hevc_decoder_init(hps);
+    decode_hvc1(dec, data, length, &out);
+    hevc_decoder_destroy(dec);
+    return p;
+}
+
+/* one dimg of a grid, decoded right into its place on the canvas */
+struct grid_tile {
+    struct heif_item *item;
+    struct hevc_param_set *hps;
+    struct hevc_output out;
+};
+
+struct grid_jobs {
+    struct grid_tile *tiles;
+    int num;
+    int nthreads; // of each decoder
+    atomic_int next;
+};
+
+static void *
+grid_worker(void *arg)
+{
+    struct grid_jobs *g = arg;
+    struct hevc_decoder *dec = NULL;
+    int i;
+    while ((i = atomic_fetch_add(&g->next, 1)) < g->num) {
+        struct grid_tile *t = &g->tiles[i];
+        // the buffers stay with the decoder from one tile to the next
+        if (dec && dec->hps != t->hps) {
+            hevc_decoder_destroy(dec);
+            dec = NULL;
+        }
+        if (!dec) {
+            dec = hevc_decoder_init(t->hps);
+            dec->nthreads = g->nthreads;
+        }
+        decode_hvc1(dec, t->item->data, t->item->length, &t->out);
+    }
+    hevc_decoder_destroy(dec);
+    return NULL;
+}
+
+/* the tiles share nothing but the parameter sets, which come from hvcC and
+ * were parsed with the meta box, so they go to a pool of threads in any
+ * order and each one converts into its (row, col) slot of p
+ */
 static int
 decode_grid_items(HEIF *h, struct heif_item *it, struct pic *p)
 {
-    int num = 0;
-    struct grid *ig = malloc(sizeof(struct grid));
-    ig->version = it->data[0];
-    ig->flags = it->data[1];
-    ig->row_minus_one = it->data[2];
-    ig->columns_minus_one = it->data[3];
+    if (!heif_item_read(h, it)->data || it->length < 8) {
+        return 0;
+    }
+    struct grid ig;
+    ig.version = it->data[0];
+    ig.flags = it->data[1];
+    ig.row_minus_one = it->data[2];
+    ig.columns_minus_one = it->data[3];
     // 8 bytes, top, left, width, height in 2 bytes
-    if ((ig->flags & 1) == 0) {
+    if ((ig.flags & 1) == 0) {
         assert(it->length == 8);
         uint16_t width = *(uint16_t *)(it->data + 4);
         uint16_t height = *(uint16_t *)(it->data + 6);
-        ig->output_width = SWAP(width);
-        ig->output_height = SWAP(height);
+        ig.output_width = SWAP(width);
+        ig.output_height = SWAP(height);
     } else {
         assert(it->length == 12);
         uint32_t width = *(uint32_t *)(it->data + 4);
         uint32_t height = *(uint32_t *)(it->data + 8);
-        ig->output_width = SWAP(width);
-        ig->output_height = SWAP(height);
+        ig.output_width = SWAP(width);
+        ig.output_height = SWAP(height);
     }
-    VDBG(heif, "grid width %d, height %d", ig->output_width, ig->output_height);
+    VDBG(heif, "grid width %d, height %d", ig.output_width, ig.output_height);
+    int rows = ig.row_minus_one + 1;
+    int columns = ig.columns_minus_one + 1;
+    int canvas_width = MIN((int)ig.output_width, p->width);
+    int canvas_height = MIN((int)ig.output_height, p->height);
+
+    struct itemtype_ref_box *ref = NULL;
     for (int i = 0; i < h->meta.iref.refs_count; i++) {
-        struct itemtype_ref_box *ref = &h->meta.iref.refs[i];
-        assert(ref->ref_count == (ig->row_minus_one + 1) * (ig->columns_minus_one + 1));
-        if (ref->from_item_id == it->item->item_id && ref->type == TYPE2UINT("dimg")) {
-            for (int j = 0; j < ref->ref_count; j++) {
-                struct heif_item *item = find_item_by_id(h, ref->to_item_ids[j]);
-                assert(item->type == TYPE2UINT("hvc1"));
-                struct hvcC_box *conf = get_hvcc_from_item_id(h, ref->to_item_ids[j]);
-                decode_hvc1(item->data, item->length, (uint8_t **)&p->pixels, &conf->hps);
-                num ++;
-            }
+        if (h->meta.iref.refs[i].from_item_id == it->item->item_id &&
+            h->meta.iref.refs[i].type == TYPE2UINT("dimg")) {
+            ref = &h->meta.iref.refs[i];
+            break;
         }
     }
-    free(ig);
-    return num;
+    if (!ref || ref->ref_count != rows * columns) {
+        VERR(heif, "grid %d has no %dx%d dimg tiles", it->item->item_id, rows,
+             columns);
+        return 0;
+    }
+
+    struct grid_jobs g = {
+        .tiles = calloc(ref->ref_count, sizeof(struct grid_tile)),
+    };
+    for (int j = 0; j < ref->ref_count; j++) {
+        struct heif_item *item = heif_item_read(h, find_item_by_id(h, ref->to_item_ids[j]));
+        struct ispe_box *ispe = get_ispe_by_item_id(h, ref->to_item_ids[j]);
+        if (!item || item->type != TYPE2UINT("hvc1") || !item->data || !ispe) {
+            VERR(heif, "grid tile %d is not a hvc1 image", ref->to_item_ids[j]);
+            free(g.tiles);
+            return 0;
+        }
+        // tiles are in raster order, all of the same size
+        int x = (j % columns) * ispe->image_width;
+        int y = (j / columns) * ispe->image_height;
+        if (x >= canvas_width || y >= canvas_height) {
+            continue;
+        }
+        struct grid_tile *t = &g.tiles[g.num++];
+        t->item = item;
+        t->hps = &get_hvcc_from_item_id(h, ref->to_item_ids[j])->hps;
+        t->out.pixels = (uint8_t *)p->pixels + y * p->pitch + x * 4;
+        t->out.pitch = p->pitch;
+        t->out.width = MIN((int)ispe->image_width, canvas_width - x);
+        t->out.height = MIN((int)ispe->image_height, canvas_height - y);
+    }
+    atomic_init(&g.next, 0);
+
+    // pick the kernels before the threads race for it
+    hevc_dsp_init();
+    // what is left of the cpus goes to the substreams inside each tile
+    int ncpu = MAX((int)sysconf(_SC_NPROCESSORS_ONLN), 1);
+    int nthreads = MIN(ncpu, g.num);
+    g.nthreads = MAX(ncpu / MAX(nthreads, 1), 1);
+    pthread_t *tids = malloc(sizeof(pthread_t) * MAX(nthreads, 1));
+    int spawned = 0;
+    for (int i = 1; i < nthreads; i++) {
+        if (pthread_create(&tids[spawned], NULL, grid_worker, &g)) {
+            break;
+        }
+        spawned++;
+    }
+    grid_worker(&g);
+    for (int i = 0; i < spawned; i++) {
+        pthread_join(tids[i], NULL);
+    }
+    free(tids);
+    free(g.tiles);
+    // all the tiles make up one picture
+    return 1;
 }
 
 static int
@@ -335,10 +455,13 @@ decode_primary_item(HEIF *h, struct pic *p)
     if (pri_item->type == TYPE2UINT("grid")) {
         // grid must have iref and decode the refered data
         num += decode_grid_items(h, pri_item, p);
-    } else if (pri_item->type == TYPE2UINT("hvc1")) {
+    } else if (pri_item->type == TYPE2UINT("hvc1") && heif_item_read(h, pri_item)->data) {
         VINFO(heif, "primary loc at %" PRIu64, h->items[pri_index].item->base_offset);
         struct hvcC_box *conf = get_hvcc_from_item_id(h, primary_id);
-        decode_hvc1(pri_item->data, pri_item->length, (uint8_t **)&p->pixels, &conf->hps);
+        struct hevc_output out = pic_output(p);
+        struct hevc_decoder *dec = hevc_decoder_init(&conf->hps);
+        decode_hvc1(dec, pri_item->data, pri_item->length, &out);
+        hevc_decoder_destroy(dec);
         num ++;
     }
     return num;
@@ -356,6 +479,12 @@ decode_reference_items_for_primary(HEIF *h, int primary_id, struct pic *p UNUSED
             int id = ref->to_item_ids[j];
             if (id == primary_id) {
                 struct heif_item *r = find_item_by_id(h, ref->from_item_id);
+                if (!r || (ref->type != TYPE2UINT("auxl") && ref->type != TYPE2UINT("cdsc"))) {
+                    continue;
+                }
+                if (!heif_item_read(h, r)->data) {
+                    continue;
+                }
                 if (r->type == TYPE2UINT("hvc1") && ref->type == TYPE2UINT("auxl")) {
                     struct hvcC_box *conf = get_hvcc_from_item_id(h, r->item->item_id);
                     struct auxC_box *auxc = get_auxc_from_item_id(h, r->item->item_id);
@@ -388,13 +517,9 @@ decode_reference_items_for_primary(HEIF *h, int primary_id, struct pic *p UNUSED
 }
 
 static int
-decode_items(HEIF *h, FILE *f, struct pic *p)
+decode_items(HEIF *h, struct pic *p)
 {
     int num = 0;
-    for (int i = 0; i < h->item_num; i++) {
-        pre_read_item(h, f, i);
-    }
-
     int primary_id = get_primary_item_id(h);
     if (primary_id >= 0) {
         num = decode_primary_item(h, p);
@@ -410,7 +535,8 @@ decode_items(HEIF *h, FILE *f, struct pic *p)
             // exif mime, skip it
             // hexdump(stdout, "exif:", "", h->items[i].data, h->items[i].length);
             VDBG(heif, "mime %" PRIu64, h->items[i].length);
-        } else if (h->items[i].type == TYPE2UINT("hvc1")) {
+        } else if (h->items[i].type == TYPE2UINT("hvc1") &&
+                   heif_item_read(h, h->items + i)->data) {
             //take it as real coded data
             VINFO(heif, "decoding id 0x%p len %" PRIu64, (void*)h->items[i].data, h->items[i].length);
             if (num == 1) {
@@ -428,45 +554,109 @@ decode_items(HEIF *h, FILE *f, struct pic *p)
     return num;
 }
 
+/* see 8.6.1.2 and 8.6.1.3 of 14496-12, the composition time of each sample
+ * from the decoding times and their offsets
+ */
+static void
+sample_times(const struct stbl_box *stbl, int64_t *cts, uint32_t count)
+{
+    uint32_t s = 0;
+    int64_t dts = 0;
+    for (uint32_t i = 0; i < stbl->stts.entry_count; i++) {
+        for (uint32_t k = 0; k < stbl->stts.sample_count[i] && s < count; k++) {
+            cts[s++] = dts;
+            dts += stbl->stts.sample_delta[i];
+        }
+    }
+    // samples stts leaves out follow at the same distance
+    for (; s < count; s++) {
+        cts[s] = s ? cts[s - 1] + 1 : 0;
+    }
+    s = 0;
+    for (uint32_t i = 0; i < stbl->ctts.entry_count; i++) {
+        for (uint32_t k = 0; k < stbl->ctts.sample_count[i] && s < count; k++) {
+            // negative offsets come with version 1
+            cts[s++] += (int32_t)stbl->ctts.sample_offset[i];
+        }
+    }
+}
+
+/* the samples of an image sequence, or the video of a live photo, are the
+ * pictures of one hevc stream predicting from each other. They are decoded
+ * in order with one decoder per track and queued in composition order.
+ */
 static int
 decode_moov(FILE *f, struct moov_box *b)
 {
     int n = 0;
-    uint32_t offset, size;
     for (int i = 0; i <b->trak_num; i++) {
-        // chunk coun
-        uint32_t chunk_count = b->trak[i].mdia.minf.stbl.stco.entry_count;
+        struct stbl_box *stbl = &b->trak[i].mdia.minf.stbl;
+        struct HEVCSampleEntry *e = (struct HEVCSampleEntry *)stbl->stsd.entries[0];
+        uint32_t count = stbl->stsz.sample_count;
+        if (!e || count == 0) {
+            continue;
+        }
         int width = (int)fix16_16(b->trak[i].tkhd.width);
         int height = (int)fix16_16(b->trak[i].tkhd.height);
-        assert(chunk_count == b->trak[i].mdia.minf.stbl.stsc.entry_count);
-        // printf("width %d, height %d, chunk count %d\n", width, height, chunk_count);
-        for (uint32_t j = 0; j < chunk_count; j++) {
-            offset = b->trak[i].mdia.minf.stbl.stco.chunk_offset[j];
-            int sample_num = b->trak[i].mdia.minf.stbl.stsc.sample_per_chunk[j];
-            // printf("sample num %d\n", sample_num);
-            n += sample_num;
-            // int first = b->trak[i].mdia.minf.stbl.stsc.first_chunk[j];
-            fseek(f, offset, SEEK_SET);
-            for (int k = 0; k < sample_num; k++) {
-                size = b->trak[i].mdia.minf.stbl.stsz.entry_size[k];
-                uint8_t *data = malloc(size);
-                fread(data, size, 1, f);
-                // printf("load one for %d, length %d\n", k, size);
-                struct pic *p1 = HEIF_load_one(width, height, data,size, NULL);
-                file_enqueue_pic(p1);
-                // free(data);
+        struct pic **pics = calloc(count, sizeof(struct pic *));
+        struct hevc_decoder *dec = hevc_decoder_init(&e->config.hps);
+        uint32_t s = 0;
+        // see 8.7.4 of 14496-12, each entry is a run of chunks with the same
+        // number of samples up to the first chunk of the next one
+        for (uint32_t j = 0; j < stbl->stsc.entry_count; j++) {
+            uint32_t last = (j + 1 < stbl->stsc.entry_count) ?
+                stbl->stsc.first_chunk[j + 1] - 1 : stbl->stco.entry_count;
+            for (uint32_t c = stbl->stsc.first_chunk[j];
+                 c <= last && c <= stbl->stco.entry_count; c++) {
+                fseek(f, stbl->stco.chunk_offset[c - 1], SEEK_SET);
+                for (uint32_t k = 0; k < stbl->stsc.sample_per_chunk[j] && s < count; k++, s++) {
+                    uint32_t size = stbl->stsz.sample_size ? stbl->stsz.sample_size
+                                                           : stbl->stsz.entry_size[s];
+                    uint8_t *data = malloc(size);
+                    if (fread(data, size, 1, f) != 1) {
+                        VERR(heif, "sample %d of track %d is cut short", s, i);
+                        free(data);
+                        break;
+                    }
+                    pics[s] = HEIF_pic_alloc(width, height);
+                    struct hevc_output out = pic_output(pics[s]);
+                    decode_hvc1(dec, data, size, &out);
+                    free(data);
+                }
+            }
+        }
+        hevc_decoder_destroy(dec);
+
+        // the pictures come in decoding order
+        int64_t *cts = malloc(count * sizeof(int64_t));
+        uint32_t *order = malloc(count * sizeof(uint32_t));
+        sample_times(stbl, cts, count);
+        for (uint32_t k = 0; k < count; k++) {
+            uint32_t m = k;
+            while (m > 0 && cts[order[m - 1]] > cts[k]) {
+                order[m] = order[m - 1];
+                m--;
             }
+            order[m] = k;
         }
+        for (uint32_t k = 0; k < count; k++) {
+            if (pics[order[k]]) {
+                file_enqueue_pic(pics[order[k]]);
+                n++;
+            }
+        }
+        free(order);
+        free(cts);
+        free(pics);
     }
     return n;
 }
 
-static struct pic*
-HEIF_load(const char *filename, int skip_flag)
+/* everything but mdat, which is only read item by item */
+static void
+HEIF_read_boxes(FILE *f, HEIF *h)
 {
-    struct pic *p = pic_alloc(sizeof(HEIF));
-    HEIF *h = p->pic;
-    FILE *f = fopen(filename, "rb");
+    media_file_open(&h->mf, f);
     fseek(f, 0, SEEK_END);
     int64_t size = ftell(f);
     fseek(f, 0, SEEK_SET);
@@ -476,6 +666,11 @@ HEIF_load(const char *filename, int skip_flag)
         struct box b;
         uint32_t type = probe_box(f, &b);
         VDBG(heif, "TOP: %s, left %"PRIu64", box %"PRIu64"", type2name(type), size, b.size);
+        // a truncated file ends in a box that is not all there
+        if (b.size == 0 || b.size > (uint64_t)size) {
+            VERR(heif, "truncated box %s", UINT2TYPE(type));
+            break;
+        }
         switch (type) {
         case FOURCC2UINT('m', 'e', 't', 'a'):
             read_meta_box(f, &h->meta);
@@ -505,21 +700,6 @@ HEIF_load(const char *filename, int skip_flag)
              b.size, size);
     }
 
-    // extract some info from meta box
-    if (get_primary_item_id(h) != -1) {
-        struct ispe_box *ispe = get_ispe_by_item_id(h, get_primary_item_id(h));
-        p->height = ispe->image_height;
-        p->width = ispe->image_width;
-        VDBG(heif, "width %d, height %d", p->width, p->height);
-    }
-    // for (int i = 0; i < h->meta.iprp.ipco.n_property; i++) {
-    //     VDBG(heif, "iprp ipco %s", type2name(h->meta.iprp.ipco.property[i]->type));
-    //     if (h->meta.iprp.ipco.property[i]->type == TYPE2UINT("ispe")) {
-    //         p->width = ((struct ispe_box *)(h->meta.iprp.ipco.property[i]))->image_width;
-    //         p->height = ((struct ispe_box *)(h->meta.iprp.ipco.property[i]))->image_height;
-    //         VDBG(heif, "width %d, height %d", p->width, p->height);
-    //     }
-    // }
     h->item_num = h->meta.iloc.item_count;
     h->items = calloc(h->meta.iloc.item_count, sizeof(struct heif_item));
     for (int i = 0; i < h->meta.iloc.item_count; i ++) {
@@ -532,28 +712,175 @@ HEIF_load(const char *filename, int skip_flag)
             }
         }
     }
+}
 
-    p->width = ((p->width + 3) >> 2) << 2;
+static void
+HEIF_alloc_pixels(struct pic *p, int width, int height)
+{
+    p->width = ((width + 3) >> 2) << 2;
+    p->height = height;
     p->depth = 32;
     p->pitch = ((((p->width + 15) >> 4) * 16 * p->depth + p->depth - 1) >> 5) << 2;
     p->pixels = malloc(p->pitch * p->height);
     p->format = CS_PIXELFORMAT_RGB888;
+}
+
+static struct pic*
+HEIF_load(const char *filename, int skip_flag)
+{
+    struct pic *p = pic_alloc(sizeof(HEIF));
+    HEIF *h = p->pic;
+    FILE *f = fopen(filename, "rb");
+    HEIF_read_boxes(f, h);
+
+    // extract some info from meta box
+    int width = 0, height = 0;
+    if (get_primary_item_id(h) != -1) {
+        struct ispe_box *ispe = get_ispe_by_item_id(h, get_primary_item_id(h));
+        height = ispe->image_height;
+        width = ispe->image_width;
+        VDBG(heif, "width %d, height %d", width, height);
+    }
+    // for (int i = 0; i < h->meta.iprp.ipco.n_property; i++) {
+    //     VDBG(heif, "iprp ipco %s", type2name(h->meta.iprp.ipco.property[i]->type));
+    //     if (h->meta.iprp.ipco.property[i]->type == TYPE2UINT("ispe")) {
+    //         p->width = ((struct ispe_box *)(h->meta.iprp.ipco.property[i]))->image_width;
+    //         p->height = ((struct ispe_box *)(h->meta.iprp.ipco.property[i]))->image_height;
+    //         VDBG(heif, "width %d, height %d", p->width, p->height);
+    //     }
+    // }
+    HEIF_alloc_pixels(p, width, height);
     int n = 0;
     if (!skip_flag) {
-        n = decode_items(h, f, p);
+        n = decode_items(h, p);
 
         for (int i = 0; i < h->moov_num; i++) {
             n += decode_moov(f, h->moov + i);
         }
     }
 
+    // items already read stay valid in the mapping
     fclose(f);
+    h->mf.f = NULL;
     if (n  == 1) {
         return p;
     }
     return NULL;
 }
 
+static bool
+item_has_ref(HEIF *h, int id, uint32_t type, bool from)
+{
+    for (int i = 0; i < h->meta.iref.refs_count; i++) {
+        struct itemtype_ref_box *ref = &h->meta.iref.refs[i];
+        if (ref->type != type) {
+            continue;
+        }
+        if (from && ref->from_item_id == (uint32_t)id) {
+            return true;
+        }
+        for (int j = 0; !from && j < ref->ref_count; j++) {
+            if (ref->to_item_ids[j] == (uint32_t)id) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+static uint64_t
+item_area(HEIF *h, int id)
+{
+    struct ispe_box *ispe = get_ispe_by_item_id(h, id);
+    return ispe ? (uint64_t)ispe->image_width * ispe->image_height : UINT64_MAX;
+}
+
+/* a thmb of the primary item, the smallest one if there are several.
+ * Without any, the smallest image which is not a tile or an auxiliary
+ * plane of some other image.
+ */
+static int
+find_thumbnail_item(HEIF *h)
+{
+    int primary_id = get_primary_item_id(h);
+    int best = -1;
+    uint64_t best_area = UINT64_MAX;
+
+    for (int i = 0; i < h->meta.iref.refs_count; i++) {
+        struct itemtype_ref_box *ref = &h->meta.iref.refs[i];
+        if (ref->type != TYPE2UINT("thmb")) {
+            continue;
+        }
+        for (int j = 0; j < ref->ref_count; j++) {
+            if ((int)ref->to_item_ids[j] == primary_id &&
+                item_area(h, ref->from_item_id) < best_area) {
+                best = ref->from_item_id;
+                best_area = item_area(h, best);
+            }
+        }
+    }
+    if (best >= 0) {
+        return best;
+    }
+    for (int i = 0; i < h->item_num; i++) {
+        int id = h->items[i].item->item_id;
+        if (h->items[i].type != TYPE2UINT("hvc1") &&
+            h->items[i].type != TYPE2UINT("grid")) {
+            continue;
+        }
+        if (item_has_ref(h, id, TYPE2UINT("dimg"), false) ||
+            item_has_ref(h, id, TYPE2UINT("auxl"), true)) {
+            continue;
+        }
+        if (item_area(h, id) < best_area) {
+            best = id;
+            best_area = item_area(h, id);
+        }
+    }
+    return best;
+}
+
+/* decode nothing but the thumbnail, the other items are never read */
+static struct pic *
+HEIF_thumbnail(const char *filename)
+{
+    struct pic *p = pic_alloc(sizeof(HEIF));
+    HEIF *h = p->pic;
+    FILE *f = fopen(filename, "rb");
+    HEIF_read_boxes(f, h);
+
+    int id = find_thumbnail_item(h);
+    struct heif_item *item = (id < 0) ? NULL : heif_item_read(h, find_item_by_id(h, id));
+    struct ispe_box *ispe = (id < 0) ? NULL : get_ispe_by_item_id(h, id);
+    if (!item || !item->data || !ispe) {
+        VERR(heif, "no thumbnail in %s", filename);
+        fclose(f);
+        HEIF_free(p);
+        return NULL;
+    }
+    VINFO(heif, "thumbnail id %d, %dx%d", id, ispe->image_width, ispe->image_height);
+    HEIF_alloc_pixels(p, ispe->image_width, ispe->image_height);
+
+    int n = 0;
+    if (item->type == TYPE2UINT("grid")) {
+        n = decode_grid_items(h, item, p);
+    } else {
+        struct hvcC_box *conf = get_hvcc_from_item_id(h, id);
+        struct hevc_output out = pic_output(p);
+        struct hevc_decoder *dec = hevc_decoder_init(&conf->hps);
+        decode_hvc1(dec, item->data, item->length, &out);
+        hevc_decoder_destroy(dec);
+        n = 1;
+    }
+    fclose(f);
+    h->mf.f = NULL;
+    if (n == 1) {
+        return p;
+    }
+    HEIF_free(p);
+    return NULL;
+}
+
 static void
 HEIF_free(struct pic *p)
 {
@@ -572,11 +899,13 @@ HEIF_free(struct pic *p)
 
     if (h->items) {
         for (int i = 0; i < h->item_num; i++) {
-            free(h->items[i].data);
+            free(h->items[i].buf);
         }
         free(h->items);
     }
 
+    media_file_close(&h->mf);
+
     free(p->pixels);
     pic_free(p);
 }
@@ -758,6 +1087,7 @@ static struct file_ops heif_ops = {
     .name = "HEIF",
     .probe = HEIF_probe,
     .load = HEIF_load,
+    .thumbnail = HEIF_thumbnail,
     .free = HEIF_free,
     .info = HEIF_info,
 };
@@ -109,7 +109,8 @@ struct heif_item {
     const struct item_location *item; //just a ref to iloc
     uint32_t type;
     uint64_t length;
-    uint8_t *data;
+    uint8_t *data;  // NULL until the item is read
+    uint8_t *buf;   // a copy of the payload, NULL if data is in the mapping
 };
 
 typedef struct {
@@ -123,6 +124,7 @@ typedef struct {
     // int mdat_num;
     // struct mdat_box *mdat; //zero or more
 
+    struct media_file mf;
     int item_num;
     struct heif_item *items;
 } HEIF;
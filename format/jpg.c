@@ -264,7 +264,10 @@ decode_data_unit(struct huffman_codec *hdec, struct jpg_decoder *d, int16_t buf[
     } else if (start == 0 && high == 0) {
         dc = huffman_decode_symbol(hdec, dc_tree);
         if (dc == -1) {
-            VERR(jpg, "invalid dc value");
+            // out of data is left to the caller
+            if (!hdec->v->eof) {
+                VERR(jpg, "invalid dc value");
+            }
             return false;
         }
         if (dc > 11) {
@@ -335,7 +338,9 @@ decode_data_unit(struct huffman_codec *hdec, struct jpg_decoder *d, int16_t buf[
         for (; i <= end;) {
             ac = huffman_decode_symbol(hdec, ac_tree);
             if (ac == -1) {
-                VERR(jpg, "invalid ac value for %d", i);
+                if (!hdec->v->eof) {
+                    VERR(jpg, "invalid ac value for %d", i);
+                }
                 return false;
             }
             int lead_zero = (ac >> 4) & 0xF;
@@ -455,24 +460,63 @@ destroy_decoder(struct jpg_decoder *d)
     free(d);
 }
 
+/* entropy decoding state of one scan, kept between two MCU rows so a
+ * baseline scan can be decoded while its data is still arriving */
+struct jpg_scan {
+    struct jpg_decoder *d[4];
+    struct huffman_codec *hdec;
+    uint8_t table_cid[4];
+    int restarts;
+    int skip;
+    int y;          // first line of the next MCU row
+};
+
 static void
-JPG_decode_scan(JPG* j, uint8_t *rawdata, int len)
+jpg_scan_init(JPG *j, struct jpg_scan *s, uint8_t *rawdata, int len)
 {
-    uint8_t *data = rawdata;
-    if (!rawdata || !len) {
-        return ;
-    }
     memset(j->data, 0, j->data_len);
     // each component owns a decoder, could be CMYK
-    const struct dct_ops *dct = get_dct_ops(16);
-    const struct cs_ops *cs_bgr = get_cs_ops(16);
-
-    struct jpg_decoder *d[4];
     //components_num is 1 or 3
     for (int i = 0; i < j->sof.components_num; i ++) {
-        d[i] = malloc(sizeof(struct jpg_decoder));
-        init_decoder(j, d[i], i);
+        s->d[i] = malloc(sizeof(struct jpg_decoder));
+        init_decoder(j, s->d[i], i);
+    }
+    memset(s->table_cid, 0, sizeof(s->table_cid));
+    for (uint8_t i = 0; i < j->sof.components_num; ++i) {
+        // int v = j->sof.colors[i].vertical;
+        // int h = j->sof.colors[i].horizontal;
+        s->table_cid[j->sof.colors[i].cid] = i;
+        // assert(h * v <= 4);
     }
+    s->restarts = j->dri.interval;
+    s->skip = 0;
+    s->y = 0;
+#if 0
+    hexdump(stdout, "jpg raw data", "", rawdata, 166);
+#endif
+    s->hdec = huffman_codec_init(rawdata, len);
+}
+
+static void
+jpg_scan_free(JPG *j, struct jpg_scan *s)
+{
+    // hexdump(stdout, "jpg decode data", j->data, 160);
+
+    for (int i = 0; i < j->sof.components_num; i ++) {
+        destroy_decoder(s->d[i]);
+    }
+
+    huffman_codec_free(s->hdec);
+    s->hdec = NULL;
+}
+
+/* decode one row of MCUs at s->y */
+static void
+jpg_scan_row(JPG *j, struct jpg_scan *s)
+{
+    const struct dct_ops *dct = get_dct_ops(16);
+    const struct cs_ops *cs_bgr = get_cs_ops(16);
+    struct jpg_decoder **d = s->d;
 
     // stride value from dc
     int yvertical = j->sof.colors[0].vertical;
@@ -485,103 +529,94 @@ JPG_decode_scan(JPG* j, uint8_t *rawdata, int len)
     int height = j->sof.height; //((j->sof.height + 7) >> 3) << 3;
     int pitch = width * 4;
 
-    int restarts = j->dri.interval;
-
     int start = j->sos.predictor_start;
     int end = j->sos.predictor_end;
     int high = j->sos.approx_bits_h;
     int low = j->sos.approx_bits_l;
 
-#if 0
-    hexdump(stdout, "jpg raw data", "", data, 166);
-#endif
-    struct huffman_codec * hdec = huffman_codec_init(data, len);
-
     int16_t Y[3][64*4], *U, *V;
     int16_t dummy[64] = {0};
-    uint8_t table_cid[4] = {0};
     int16_t *yuv[3];
-    int skip = 0;
-    for (uint8_t i = 0; i < j->sof.components_num; ++i) {
-        // int v = j->sof.colors[i].vertical;
-        // int h = j->sof.colors[i].horizontal;
-        table_cid[j->sof.colors[i].cid] = i;
-        // assert(h * v <= 4);
-    }
-
-    for (int y = 0; y < height; y += ystride) {
-        ptr = j->data + y * pitch;
-        for (int x = 0; x < width; x += xstride) {
-            VDBG(jpg, "(%d, %d) width %d MCU index %d", x, y, width, y / 8 * (width) / 8 + x / 8);
-            // for YUV420, get 4 DCU for Y and 1 DCU for U and 1 DCU for V
-            yuv[0] = j->yuv[0] + 64 * (y / 8 * (width) / 8 + x/8);
-            yuv[1] = j->yuv[1] + 64 * (y / 8 * (width) / 8 + x/8);
-            yuv[2] = j->yuv[2] + 64 * (y / 8 * (width) / 8 + x/8);
-
-            for (uint8_t i = 0; i < j->sos.nums; ++i) {
-                int cid = table_cid[j->sos.comps[i].component_selector];
-                int v = j->sof.colors[cid].vertical;
-                int h = j->sof.colors[cid].horizontal;
-
-                for (int vi = 0; vi < v && y + vi * 8 < height; vi ++) {
-                    for (int hi = 0; hi < h && x + hi * 8 < width; hi ++) {
-                        VDBG(jpg, "decode at (%d, %d) [%d, %d] for %d", x, y, hi, vi, cid);
-                        if (!decode_data_unit(hdec, d[cid], &yuv[cid][64 * (vi * h + hi)], start, end, high, low, &skip)) {
-                            // those MCU at the edge could be incomplete
-                            VDBG(jpg, "fail at (%d, %d) [%d, %d] for %d", x, y, hi, vi, cid);
-                            continue;
-                        }
-                        // memcpy(&Y[cid][64 * (vi * h + hi)], , 64 * 2);
-                        // dequant_data_unit(d[cid], &Y[cid][64 * (vi * h + hi)], &yuv[cid][64 * (vi * h + hi)], start, end);
-                        // dct->idct_8x8(&Y[cid][64 * (vi * h + hi)], 8);
+    int y = s->y;
+
+    ptr = j->data + y * pitch;
+    for (int x = 0; x < width; x += xstride) {
+        VDBG(jpg, "(%d, %d) width %d MCU index %d", x, y, width, y / 8 * (width) / 8 + x / 8);
+        // for YUV420, get 4 DCU for Y and 1 DCU for U and 1 DCU for V
+        yuv[0] = j->yuv[0] + 64 * (y / 8 * (width) / 8 + x/8);
+        yuv[1] = j->yuv[1] + 64 * (y / 8 * (width) / 8 + x/8);
+        yuv[2] = j->yuv[2] + 64 * (y / 8 * (width) / 8 + x/8);
+
+        for (uint8_t i = 0; i < j->sos.nums; ++i) {
+            int cid = s->table_cid[j->sos.comps[i].component_selector];
+            int v = j->sof.colors[cid].vertical;
+            int h = j->sof.colors[cid].horizontal;
+
+            for (int vi = 0; vi < v && y + vi * 8 < height; vi ++) {
+                for (int hi = 0; hi < h && x + hi * 8 < width; hi ++) {
+                    VDBG(jpg, "decode at (%d, %d) [%d, %d] for %d", x, y, hi, vi, cid);
+                    if (!decode_data_unit(s->hdec, d[cid], &yuv[cid][64 * (vi * h + hi)], start, end, high, low, &s->skip)) {
+                        // those MCU at the edge could be incomplete
+                        VDBG(jpg, "fail at (%d, %d) [%d, %d] for %d", x, y, hi, vi, cid);
+                        continue;
                     }
+                    // memcpy(&Y[cid][64 * (vi * h + hi)], , 64 * 2);
+                    // dequant_data_unit(d[cid], &Y[cid][64 * (vi * h + hi)], &yuv[cid][64 * (vi * h + hi)], start, end);
+                    // dct->idct_8x8(&Y[cid][64 * (vi * h + hi)], 8);
                 }
             }
-            for (uint8_t k = 0; k < j->sof.components_num; k++) {
-                int v = j->sof.colors[k].vertical;
-                int h = j->sof.colors[k].horizontal;
-                for (int vi = 0; vi < v && y + vi * 8 < height; vi ++) {
-                    for (int hi = 0; hi < h && x + hi * 8 < width; hi ++) {
-                        dequant_data_unit(d[k], &Y[k][64 * (vi * h + hi)],
-                                          &yuv[k][64 * (vi * h + hi)], end);
-                        dct->idct_8x8(&Y[k][64 * (vi * h + hi)], 8);
-                    }
+        }
+        for (uint8_t k = 0; k < j->sof.components_num; k++) {
+            int v = j->sof.colors[k].vertical;
+            int h = j->sof.colors[k].horizontal;
+            for (int vi = 0; vi < v && y + vi * 8 < height; vi ++) {
+                for (int hi = 0; hi < h && x + hi * 8 < width; hi ++) {
+                    dequant_data_unit(d[k], &Y[k][64 * (vi * h + hi)],
+                                      &yuv[k][64 * (vi * h + hi)], end);
+                    dct->idct_8x8(&Y[k][64 * (vi * h + hi)], 8);
                 }
             }
+        }
 
-            if (j->sof.components_num == 1) {
-                U = dummy;
-                V = dummy;
-            } else {
-                U = Y[1];
-                V = Y[2];
-            }
+        if (j->sof.components_num == 1) {
+            U = dummy;
+            V = dummy;
+        } else {
+            U = Y[1];
+            V = Y[2];
+        }
 
-            cs_bgr->YUV_to_BGRA32(ptr, pitch, Y[0], U, V, yvertical, yhorizontal);
+        cs_bgr->YUV_to_BGRA32(ptr, pitch, Y[0], U, V, yvertical, yhorizontal);
 
-            if (restarts > 0) {
-                restarts --;
-                if (restarts == 0) {
-                    restarts = j->dri.interval;
-                    for (int i = 0; i < j->sof.components_num; i ++) {
-                        reset_decoder(d[i]);
-                    }
-                    huffman_reset_stream(hdec);
-                    skip = 0;
-                    // read_next_rst_marker(d[0]);
+        if (s->restarts > 0) {
+            s->restarts --;
+            if (s->restarts == 0) {
+                s->restarts = j->dri.interval;
+                for (int i = 0; i < j->sof.components_num; i ++) {
+                    reset_decoder(d[i]);
                 }
+                huffman_reset_stream(s->hdec);
+                s->skip = 0;
+                // read_next_rst_marker(d[0]);
             }
-            ptr += xstride * 4; // skip to next
         }
+        ptr += xstride * 4; // skip to next
     }
+    s->y += ystride;
+}
 
-    // hexdump(stdout, "jpg decode data", j->data, 160);
-
-    for (int i = 0; i < j->sof.components_num; i ++) {
-        destroy_decoder(d[i]);
+static void
+JPG_decode_scan(JPG* j, uint8_t *rawdata, int len)
+{
+    struct jpg_scan s;
+    if (!rawdata || !len) {
+        return ;
     }
-
-    huffman_codec_free(hdec);
+    jpg_scan_init(j, &s, rawdata, len);
+    while (s.y < j->sof.height) {
+        jpg_scan_row(j, &s);
+    }
+    jpg_scan_free(j, &s);
 }
 
 static uint8_t *
@@ -631,13 +666,17 @@ read_compressed_scan(FILE *f, int *len)
             VERR(jpg, "invalid %x %x", prev, c);
         }
     }
+    // the byte right before the marker is left in c
+    if (cosum == (int)(last - pos) && c != 0xFF) {
+        compressed[l++] = c;
+    }
     VDBG(jpg, "real vs alloc: %d vs %ld", l, last-pos);
     *len = l;
     return compressed;
 }
 
 static void
-read_sos(JPG* j, FILE *f, bool skip_flag)
+read_sos_header(JPG* j, FILE *f)
 {
     fread(&j->sos, 3, 1, f);
     fread(j->sos.comps, sizeof(struct comp_sel), j->sos.nums, f);
@@ -647,6 +686,12 @@ read_sos(JPG* j, FILE *f, bool skip_flag)
          j->sos.predictor_end);
     VINFO(jpg, "sos successive approximation bits high %d, low %d", j->sos.approx_bits_h,
          j->sos.approx_bits_l);
+}
+
+static void
+read_sos(JPG* j, FILE *f, bool skip_flag)
+{
+    read_sos_header(j, f);
     int len;
     uint8_t* rawdata = read_compressed_scan(f, &len);
     if (!skip_flag) {
@@ -768,13 +813,71 @@ write_app0(FILE *f)
     fwrite(&thumbnail, 1, 1, f);
 }
 
+/* all the segments but SOS, f is right after the marker */
+static void
+jpg_read_segment(struct pic *p, JPG *j, uint16_t m, FILE *f)
+{
+    uint16_t len;
+
+    switch (m) {
+    case SOF0:
+    case SOF1:
+    case SOF2:
+        VDBG(jpg, "SOFn");
+        read_sof(j, f);
+        p->width = ((j->sof.width + 7) >> 3) << 3;
+        p->height = j->sof.height;
+        p->depth = 32;
+        p->pitch = ((p->width * 32 + 32 - 1) >> 5) << 2;
+        j->data_len = p->pitch * p->height;
+        j->data = malloc(p->pitch * (p->height+7)/8*8);
+        j->yuv[0] = calloc(1, (p->height + 7)/8 * ((p->width+7)>>3) * 64 * sizeof(int16_t));
+        j->yuv[1] = calloc(1, (p->height +7)/8 * ((p->width+7)>>3) * 64 * sizeof(int16_t));
+        j->yuv[2] = calloc(1, (p->height+7)/8 * ((p->width+7)>>3) * 64 * sizeof(int16_t));
+        break;
+    case APP0:
+        VDBG(jpg, "APP0");
+        read_app0(j, f);
+        break;
+    case DHT:
+        VDBG(jpg, "DHT");
+        read_dht(j, f);
+        break;
+    case DQT:
+        VDBG(jpg, "DQT");
+        read_dqt(j, f);
+        break;
+    case COM:
+        VDBG(jpg, "COM");
+        fread(&j->comment, 2, 1, f);
+        j->comment.len = SWAP(j->comment.len);
+        j->comment.data = malloc(j->comment.len - 2);
+        fread(j->comment.data, j->comment.len - 2, 1, f);
+        break;
+    case DRI:
+        VDBG(jpg, "DRI");
+        fread(&j->dri, sizeof(struct dri), 1, f);
+        j->dri.interval = SWAP(j->dri.interval);
+        break;
+    case APP1:
+        VDBG(jpg, "app1 exif");
+        // fall through
+    default:
+        VDBG(jpg, "skip marker %x", SWAP(m));
+        fread(&len, 2, 1, f);
+        len = SWAP(len);
+        fseek(f, len - 2, SEEK_CUR);
+        break;
+    }
+}
+
 static struct pic *
 JPG_load_one(FILE *f, int skip_flag)
 {
     struct pic *p = pic_alloc(sizeof(JPG));
     JPG *j = p->pic;
     j->data = NULL;
-    uint16_t soi, m, len;
+    uint16_t soi, m;
     fread(&soi, 2, 1, f);
     if (soi != SOI) {
         return NULL;
@@ -783,35 +886,7 @@ JPG_load_one(FILE *f, int skip_flag)
     // int num_sos = 0;
     // 0xFFFF means eof
     while (m != EOI && m != 0 && m != 0xFFFF) {
-        switch (m) {
-        case SOF0:
-        case SOF1:
-        case SOF2:
-            VDBG(jpg, "SOFn");
-            read_sof(j, f);
-            p->width = ((j->sof.width + 7) >> 3) << 3;
-            p->height = j->sof.height;
-            p->depth = 32;
-            p->pitch = ((p->width * 32 + 32 - 1) >> 5) << 2;
-            j->data_len = p->pitch * p->height;
-            j->data = malloc(p->pitch * (p->height+7)/8*8);
-            j->yuv[0] = calloc(1, (p->height + 7)/8 * ((p->width+7)>>3) * 64 * sizeof(int16_t));
-            j->yuv[1] = calloc(1, (p->height +7)/8 * ((p->width+7)>>3) * 64 * sizeof(int16_t));
-            j->yuv[2] = calloc(1, (p->height+7)/8 * ((p->width+7)>>3) * 64 * sizeof(int16_t));
-            break;
-        case APP0:
-            VDBG(jpg, "APP0");
-            read_app0(j, f);
-            break;
-        case DHT:
-            VDBG(jpg, "DHT");
-            read_dht(j, f);
-            break;
-        case DQT:
-            VDBG(jpg, "DQT");
-            read_dqt(j, f);
-            break;
-        case SOS:
+        if (m == SOS) {
             VDBG(jpg, "SOS");
             read_sos(j, f, skip_flag);
             p->format = CS_PIXELFORMAT_RGB888;
@@ -820,28 +895,8 @@ JPG_load_one(FILE *f, int skip_flag)
             // if (num_sos==3) {
             //     return p;
             // }
-            break;
-        case COM:
-            VDBG(jpg, "COM");
-            fread(&j->comment, 2, 1, f);
-            j->comment.len = SWAP(j->comment.len);
-            j->comment.data = malloc(j->comment.len - 2);
-            fread(j->comment.data, j->comment.len - 2, 1, f);
-            break;
-        case DRI:
-            VDBG(jpg, "DRI");
-            fread(&j->dri, sizeof(struct dri), 1, f);
-            j->dri.interval = SWAP(j->dri.interval);
-            break;
-        case APP1:
-            VDBG(jpg, "app1 exif");
-            // fall through
-        default:
-            VDBG(jpg, "skip marker %x", SWAP(m));
-            fread(&len, 2, 1, f);
-            len = SWAP(len);
-            fseek(f, len - 2, SEEK_CUR);
-            break;
+        } else {
+            jpg_read_segment(p, j, m, f);
         }
         VDBG(jpg, "offset at 0x%zx", ftell(f));
         m = read_marker_skip_null(f);
@@ -1233,6 +1288,226 @@ void JPG_encode(struct pic *p, const char *fname)
     huffman_codec_free(hdec);
 }
 
+/* state of JPG_idec between two calls */
+struct jpg_idec {
+    size_t pos;             // next byte to parse in d->data
+    int in_scan;
+    int progressive;
+    int incremental;        // the scan is decoded as its data arrives
+    struct jpg_scan scan;   // in use when scan.hdec is set
+    uint8_t *comp;          // entropy data of the scan, without stuffing
+    int comp_len;
+    int comp_size;
+};
+
+static void
+jpg_idec_put(struct jpg_idec *s, uint8_t c)
+{
+    if (s->comp_len == s->comp_size) {
+        s->comp_size = s->comp_size ? s->comp_size * 2 : 4096;
+        s->comp = realloc(s->comp, s->comp_size);
+    }
+    s->comp[s->comp_len++] = c;
+}
+
+/* same as read_compressed_scan but from memory, returns 1 once the marker
+ * ending the scan is reached */
+static int
+jpg_idec_unstuff(struct idec *d, struct jpg_idec *s)
+{
+    int end = 0;
+    while (s->pos < d->len) {
+        uint8_t c = d->data[s->pos];
+        if (c != 0xFF) {
+            jpg_idec_put(s, c);
+            s->pos++;
+            continue;
+        }
+        if (s->pos + 1 == d->len) {
+            break;
+        }
+        c = d->data[s->pos + 1];
+        if (c == 0) {
+            /* take 0xFF00 as 0xFF */
+            jpg_idec_put(s, 0xFF);
+            s->pos += 2;
+        } else if (c >= 0xD0 && c <= 0xD7) {
+            /* and skip rst marker */
+            s->pos += 2;
+        } else if (c == 0xFF) {
+            s->pos++;
+        } else {
+            end = 1;
+            break;
+        }
+    }
+    if (s->scan.hdec) {
+        bits_vec_extend(s->scan.hdec->v, s->comp, s->comp_len);
+    }
+    return end;
+}
+
+/* decode what is there of the current scan, complete when all of it is */
+static void
+jpg_idec_scan(struct idec *d, struct jpg_idec *s, int complete)
+{
+    JPG *j = d->p->pic;
+
+    if (!s->incremental) {
+        // progressive and non interleaved scans are decoded as a whole
+        if (complete) {
+            JPG_decode_scan(j, s->comp, s->comp_len);
+            if (!s->comp_len) {
+                free(s->comp);
+            }
+            s->comp = NULL;
+            s->comp_len = s->comp_size = 0;
+            d->rows = d->p->height;
+        }
+        return;
+    }
+    if (!s->scan.hdec) {
+        if (!s->comp_len) {
+            return;
+        }
+        jpg_scan_init(j, &s->scan, s->comp, s->comp_len);
+    }
+
+    struct bits_vec *v = s->scan.hdec->v;
+    while (s->scan.y < j->sof.height) {
+        // checkpoint, a MCU row running out of data is decoded again later
+        struct bits_vec v_save = *v;
+        int prev_dc[4];
+        int restarts = s->scan.restarts, skip = s->scan.skip;
+        for (int i = 0; i < j->sof.components_num; i++) {
+            prev_dc[i] = s->scan.d[i]->prev_dc;
+        }
+        jpg_scan_row(j, &s->scan);
+        if (!complete && v->eof) {
+            *v = v_save;
+            for (int i = 0; i < j->sof.components_num; i++) {
+                s->scan.d[i]->prev_dc = prev_dc[i];
+            }
+            s->scan.restarts = restarts;
+            s->scan.skip = skip;
+            s->scan.y -= j->sof.colors[0].vertical * 8;
+            break;
+        }
+    }
+    d->rows = MIN(s->scan.y, j->sof.height);
+    if (complete) {
+        // the huffman codec owns the scan data
+        jpg_scan_free(j, &s->scan);
+        s->comp = NULL;
+        s->comp_len = s->comp_size = 0;
+    }
+}
+
+static int
+JPG_idec(struct idec *d)
+{
+    struct jpg_idec *s = d->priv;
+    uint16_t m;
+
+    if (!s) {
+        if (d->len < 2) {
+            return IDEC_SUSPENDED;
+        }
+        memcpy(&m, d->data, 2);
+        if (m != SOI) {
+            return IDEC_ERROR;
+        }
+        s = d->priv = calloc(1, sizeof(struct jpg_idec));
+        s->pos = 2;
+        d->p = pic_alloc(sizeof(JPG));
+    }
+    struct pic *p = d->p;
+    JPG *j = p->pic;
+
+    while (1) {
+        if (s->in_scan) {
+            int end = jpg_idec_unstuff(d, s);
+            jpg_idec_scan(d, s, end);
+            if (!end) {
+                return IDEC_SUSPENDED;
+            }
+            s->in_scan = 0;
+        }
+        // skip fill bytes before a marker
+        while (s->pos + 1 < d->len && d->data[s->pos] == 0xFF &&
+               d->data[s->pos + 1] == 0xFF) {
+            s->pos++;
+        }
+        if (s->pos + 2 > d->len) {
+            return IDEC_SUSPENDED;
+        }
+        memcpy(&m, d->data + s->pos, 2);
+        if (d->data[s->pos] != 0xFF) {
+            VERR(jpg, "marker 0x%x at %zu", d->data[s->pos], s->pos);
+            return IDEC_ERROR;
+        }
+        if (m == EOI) {
+            if (!j->data) {
+                return IDEC_ERROR;
+            }
+            d->rows = p->height;
+            return IDEC_DONE;
+        }
+        // a segment is only parsed once all of it is there
+        if (s->pos + 4 > d->len) {
+            return IDEC_SUSPENDED;
+        }
+        int len = d->data[s->pos + 2] << 8 | d->data[s->pos + 3];
+        if (len < 2) {
+            return IDEC_ERROR;
+        }
+        if (s->pos + 2 + len > d->len) {
+            return IDEC_SUSPENDED;
+        }
+        FILE *f = fmemopen(d->data + s->pos + 2, len, "rb");
+        if (m == SOS) {
+            VDBG(jpg, "SOS");
+            if (!j->data) {
+                fclose(f);
+                return IDEC_ERROR;
+            }
+            read_sos_header(j, f);
+            s->in_scan = 1;
+            s->incremental = !s->progressive &&
+                             j->sos.nums == j->sof.components_num;
+        } else {
+            if (m == SOF0 || m == SOF1 || m == SOF2) {
+                // one frame only
+                if (j->data) {
+                    fclose(f);
+                    return IDEC_ERROR;
+                }
+                s->progressive = (m == SOF2);
+            }
+            jpg_read_segment(p, j, m, f);
+            p->format = CS_PIXELFORMAT_RGB888;
+            p->pixels = j->data;
+        }
+        fclose(f);
+        s->pos += 2 + len;
+    }
+}
+
+static void
+JPG_idec_free(struct idec *d)
+{
+    struct jpg_idec *s = d->priv;
+    if (s) {
+        if (s->scan.hdec) {
+            jpg_scan_free(d->p->pic, &s->scan);
+        } else {
+            free(s->comp);
+        }
+        free(s);
+        d->priv = NULL;
+    }
+}
+
 static struct file_ops jpg_ops = {
     .name = "JPG",
     .alias = "JPEG",
@@ -1241,6 +1516,8 @@ static struct file_ops jpg_ops = {
     .free = JPG_free,
     .info = JPG_info,
     .encode = JPG_encode,
+    .idec = JPG_idec,
+    .idec_free = JPG_idec_free,
 };
 
 void 
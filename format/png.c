@@ -197,26 +197,51 @@ remove_padding_bits(uint8_t *out, const uint8_t *in,
     }
 }
 
+/* rows of the image data with the filter byte in front */
+static int
+png_scanline_len(PNG *p)
+{
+    return 1 + (p->ihdr.width * calc_png_bits_per_pixel(p) + 7) / 8;
+}
+
+/* rows are only final after unfiltering when there are no padding bits */
+static bool
+png_has_padding(PNG *p)
+{
+    int depth = calc_png_bits_per_pixel(p);
+    return depth < 8 && (p->ihdr.width * depth) % 8;
+}
+
+/* unfilter the scanlines [from, to) of buf */
 static void
-PNG_unfilter(PNG *p, const uint8_t *buf)
+png_unfilter_rows(PNG *p, const uint8_t *buf, uint32_t from, uint32_t to)
 {
-    // uint8_t type = *buf;
     int depth = calc_png_bits_per_pixel(p);
     int bytewidth = (depth + 7) / 8;    /*bytewidth is used for filtering, is 1 when depth < 8, number of bytes per pixel otherwise */
     int pitch = (p->ihdr.width * depth + 7) / 8;
 
-    uint8_t *prevline = 0;
-    assert((1 + pitch) * p->ihdr.height <= (uint32_t)p->size);
+    uint8_t *prevline = from ? &p->data[pitch * (from - 1)] : 0;
+    assert((1 + pitch) * to <= (uint32_t)p->size);
 
-    for (uint32_t y = 0; y < p->ihdr.height; y++) {
+    for (uint32_t y = from; y < to; y++) {
         int outindex = pitch * y;
         int pos = (1 + pitch) * y;    /*the extra filterbyte added to each row */
         uint8_t filterType = buf[pos];
         unfilter_scanline(&p->data[outindex], &buf[pos + 1], prevline, bytewidth, filterType, pitch);
         prevline = &p->data[outindex];
     }
+}
 
-    if (bytewidth == 1 && (int)p->ihdr.width * depth != (pitch * 8)) {
+static void
+PNG_unfilter(PNG *p, const uint8_t *buf)
+{
+    // uint8_t type = *buf;
+    int depth = calc_png_bits_per_pixel(p);
+    int pitch = (p->ihdr.width * depth + 7) / 8;
+
+    png_unfilter_rows(p, buf, 0, p->ihdr.height);
+
+    if (png_has_padding(p)) {
         //means get padding per line
         remove_padding_bits(p->data, buf, p->ihdr.width * depth, pitch * 8,
                             p->ihdr.height);
@@ -515,6 +540,83 @@ read_iend(FILE *f)
     return 0;
 }
 
+/* the data of a chunk, f is right after the chunk type */
+static uint32_t
+png_read_chunk(PNG *b, FILE *f, uint32_t chunk_type, uint32_t length,
+               uint32_t crc32)
+{
+    uint8_t *data = NULL;
+
+    switch (chunk_type) {
+        case CHUNK_TYPE_IHDR:
+            crc32 = read_ihdr(b, f, crc32);
+            break;
+        case CHUNK_TYPE_PLTE:
+            crc32 = read_plte(b, f, crc32, length);
+            break;
+        case CHUNK_TYPE_IDAT:
+            crc32 = read_idat(b, f, crc32, length);
+            break;
+        case CHUNK_TYPE_GAMA:
+            crc32 = read_gama(b, f, crc32, length);
+            break;
+        case CHUNK_TYPE_ICCP:
+            crc32 = read_iccp(b, f, crc32, length);
+            break;
+        case CHUNK_TYPE_CHRM:
+            crc32 = read_chrm(b, f, crc32, length);
+            break;
+        case CHUNK_TYPE_TEXT:
+            crc32 = read_text(b, f, crc32, length);
+            break;
+        case CHUNK_TYPE_ITXT:
+            crc32 = read_itxt(b, f, crc32, length);
+            break;
+        case CHUNK_TYPE_ZTXT:
+            crc32 = read_ztxt(b, f, crc32, length);
+            break;
+        case CHUNK_TYPE_HIST:
+            crc32 = read_hist(b, f, crc32, length);
+            break;
+        case CHUNK_TYPE_BKGD:
+            crc32 = read_bkgd(b, f, crc32, length);
+            break;
+        case CHUNK_TYPE_TIME:
+            crc32 = read_time(b, f, crc32, length);
+            break;
+        default:
+            if (length) {
+                VDBG(png, "length %d", length);
+                data = calloc(1, length);
+
+                assert(data);
+                fread(data, length, 1, f);
+                crc32 = update_crc(crc32, (uint8_t*)data, length);
+                free(data);
+            }
+            break;
+    }
+    return crc32;
+}
+
+static void
+png_setup_pic(struct pic *p, PNG *b)
+{
+    p->width = b->ihdr.width;
+    p->height = b->ihdr.height;
+    p->depth = calc_png_bits_per_pixel(b);
+    p->pixels = b->data;
+    // PNG in RGB/RGBA order ?
+    if (p->depth == 32) {
+        p->format = CS_PIXELFORMAT_ABGR8888;
+        // CS_MasksToPixelFormatEnum(p->depth, 0xFF000000, 0x00FF0000, 0x0000FF00, 0x000000FF);
+    } else if (p->depth <= 24) {
+        p->format = CS_MasksToPixelFormatEnum(p->depth, 0, 0, 0, 0x000000FF);
+    }
+    VDBG(png, "depth %d, format %s", p->depth, CS_GetPixelFormatName(p->format));
+    p->pitch = ((b->ihdr.width * p->depth + 31) >> 5) << 2;
+}
+
 static struct pic* 
 PNG_load(const char* filename, int skip_flag)
 {
@@ -531,7 +633,6 @@ PNG_load(const char* filename, int skip_flag)
     uint32_t chunk_type = 0;
     uint32_t length;
 
-    uint8_t *data = NULL;
     uint32_t crc32, crc;
 
     length = read_u32(f);
@@ -544,55 +645,7 @@ PNG_load(const char* filename, int skip_flag)
         assert(length > 0);
         crc32 = init_crc32((uint8_t*)&chunk_type, sizeof(uint32_t));
         VDBG(png, "get chunk type %s", type2name(chunk_type));
-        switch (chunk_type) {
-            case CHUNK_TYPE_IHDR:
-                crc32 = read_ihdr(b, f, crc32);
-                break;
-            case CHUNK_TYPE_PLTE:
-                crc32 = read_plte(b, f, crc32, length);
-                break;
-            case CHUNK_TYPE_IDAT:
-                crc32 = read_idat(b, f, crc32, length);
-                break;
-            case CHUNK_TYPE_GAMA:
-                crc32 = read_gama(b, f, crc32, length);
-                break;
-            case CHUNK_TYPE_ICCP:
-                crc32 = read_iccp(b, f, crc32, length);
-                break;
-            case CHUNK_TYPE_CHRM:
-                crc32 = read_chrm(b, f, crc32, length);
-                break;
-            case CHUNK_TYPE_TEXT:
-                crc32 = read_text(b, f, crc32, length);
-                break;
-            case CHUNK_TYPE_ITXT:
-                crc32 = read_itxt(b, f, crc32, length);
-                break;
-            case CHUNK_TYPE_ZTXT:
-                crc32 = read_ztxt(b, f, crc32, length);
-                break;
-            case CHUNK_TYPE_HIST:
-                crc32 = read_hist(b, f, crc32, length);
-                break;
-            case CHUNK_TYPE_BKGD:
-                crc32 = read_bkgd(b, f, crc32, length);
-                break;
-            case CHUNK_TYPE_TIME:
-                crc32 = read_time(b, f, crc32, length);
-                break;
-            default:
-                if (length) {
-                    VDBG(png, "length %d", length);
-                    data = calloc(1, length);
-
-                    assert(data);
-                    fread(data, length, 1, f);
-                    crc32 = update_crc(crc32, (uint8_t*)data, length);
-                    free(data);
-                }
-                break;
-        }
+        crc32 = png_read_chunk(b, f, chunk_type, length, crc32);
 
         fread(&crc, sizeof(uint32_t), 1, f);
         crc32 = finish_crc32(crc32);
@@ -622,19 +675,7 @@ PNG_load(const char* filename, int skip_flag)
         PNG_unfilter(b, udata);
         free(udata);
     }
-    p->width = b->ihdr.width;
-    p->height = b->ihdr.height;
-    p->depth = calc_png_bits_per_pixel(b);
-    p->pixels = b->data;
-    // PNG in RGB/RGBA order ?
-    if (p->depth == 32) {
-        p->format = CS_PIXELFORMAT_ABGR8888;
-        // CS_MasksToPixelFormatEnum(p->depth, 0xFF000000, 0x00FF0000, 0x0000FF00, 0x000000FF);
-    } else if (p->depth <= 24) {
-        p->format = CS_MasksToPixelFormatEnum(p->depth, 0, 0, 0, 0x000000FF);
-    }
-    VDBG(png, "depth %d, format %s", p->depth, CS_GetPixelFormatName(p->format));
-    p->pitch = ((b->ihdr.width * p->depth + 31) >> 5) << 2;
+    png_setup_pic(p, b);
     return p;
 }
 
@@ -762,12 +803,184 @@ PNG_info(FILE* f, struct pic* p)
     }
 }
 
+/* state of PNG_idec between two calls */
+struct png_idec {
+    size_t pos;                 // next byte to parse in d->data
+    uint32_t idat_left;         // bytes of the current IDAT not seen yet
+    int in_idat;
+    uint32_t crc32;
+    struct deflate_decoder *z;
+    uint8_t *udata;             // inflated scanlines
+    uint32_t rows;              // scanlines unfiltered
+    int inflated;
+};
+
+static uint32_t
+png_idec_u32(const uint8_t *p)
+{
+    return (uint32_t)p[0] << 24 | p[1] << 16 | p[2] << 8 | p[3];
+}
+
+/* inflate what is there and unfilter all complete scanlines */
+static int
+png_idec_inflate(struct idec *d, struct png_idec *s)
+{
+    PNG *b = d->p->pic;
+    int ulen;
+
+    if (s->inflated) {
+        return 0;
+    }
+    int ret = deflate_stream_decode(s->z, b->compressed, b->compressed_size,
+                                    &ulen);
+    if (ret < 0) {
+        return ret;
+    }
+    s->inflated = ret;
+    uint32_t rows = MIN((uint32_t)(ulen / png_scanline_len(b)), b->ihdr.height);
+    if (rows > s->rows) {
+        png_unfilter_rows(b, s->udata, s->rows, rows);
+        s->rows = rows;
+    }
+    if (!png_has_padding(b)) {
+        d->rows = s->rows;
+    }
+    return 0;
+}
+
+static int
+PNG_idec(struct idec *d)
+{
+    const uint8_t png_signature[] = {0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a};
+    struct png_idec *s = d->priv;
+
+    if (!s) {
+        if (d->len < sizeof(png_signature)) {
+            return IDEC_SUSPENDED;
+        }
+        if (memcmp(d->data, png_signature, sizeof(png_signature))) {
+            return IDEC_ERROR;
+        }
+        s = d->priv = calloc(1, sizeof(struct png_idec));
+        s->pos = sizeof(png_signature);
+        d->p = pic_alloc(sizeof(struct PNG));
+        memcpy(&((PNG *)d->p->pic)->sig, png_signature, sizeof(png_signature));
+    }
+    PNG *b = d->p->pic;
+
+    while (1) {
+        if (s->idat_left) {
+            // IDAT data is used as soon as it comes
+            uint32_t n = MIN(s->idat_left, d->len - s->pos);
+            if (n) {
+                b->compressed = realloc(b->compressed, b->compressed_size + n);
+                memcpy(b->compressed + b->compressed_size, d->data + s->pos, n);
+                s->crc32 = update_crc(s->crc32, d->data + s->pos, n);
+                b->compressed_size += n;
+                s->pos += n;
+                s->idat_left -= n;
+            }
+            if (png_idec_inflate(d, s) < 0) {
+                return IDEC_ERROR;
+            }
+            if (s->idat_left) {
+                return IDEC_SUSPENDED;
+            }
+        }
+        if (s->in_idat) {
+            if (d->len < s->pos + 4) {
+                return IDEC_SUSPENDED;
+            }
+            if (finish_crc32(s->crc32) != png_idec_u32(d->data + s->pos)) {
+                VERR(png, "IDAT crc mismatch");
+                return IDEC_ERROR;
+            }
+            s->pos += 4;
+            s->in_idat = 0;
+        }
+
+        if (d->len < s->pos + 8) {
+            return IDEC_SUSPENDED;
+        }
+        uint32_t length = png_idec_u32(d->data + s->pos);
+        uint32_t chunk_type;
+        memcpy(&chunk_type, d->data + s->pos + 4, 4);
+        VDBG(png, "get chunk type %s", type2name(chunk_type));
+        if (chunk_type == CHUNK_TYPE_IDAT) {
+            if (!s->z) {
+                return IDEC_ERROR;
+            }
+            s->crc32 = init_crc32((uint8_t*)&chunk_type, sizeof(uint32_t));
+            s->idat_left = length;
+            s->in_idat = 1;
+            s->pos += 8;
+            continue;
+        }
+        // others chunks are only parsed as a whole
+        if (d->len < s->pos + 12 + length) {
+            return IDEC_SUSPENDED;
+        }
+        if (chunk_type == (uint32_t)CHARS2UINT("IEND")) {
+            if (!s->z || !s->inflated || s->rows < b->ihdr.height) {
+                return IDEC_ERROR;
+            }
+            if (png_has_padding(b)) {
+                int depth = calc_png_bits_per_pixel(b);
+                remove_padding_bits(b->data, s->udata, b->ihdr.width * depth,
+                                    (png_scanline_len(b) - 1) * 8,
+                                    b->ihdr.height);
+            }
+            d->rows = b->ihdr.height;
+            return IDEC_DONE;
+        }
+        uint32_t crc32 = init_crc32((uint8_t*)&chunk_type, sizeof(uint32_t));
+        FILE *f = fmemopen(d->data + s->pos + 8, length + 4, "rb");
+        crc32 = png_read_chunk(b, f, chunk_type, length, crc32);
+        fclose(f);
+        if (finish_crc32(crc32) != png_idec_u32(d->data + s->pos + 8 + length)) {
+            VERR(png, "%s crc mismatch", type2name(chunk_type));
+            return IDEC_ERROR;
+        }
+        if (chunk_type == CHUNK_TYPE_IHDR) {
+            if (s->z || !calc_png_bits_per_pixel(b) || b->ihdr.interlace) {
+                VERR(png, "unsupported png for incremental decoding");
+                return IDEC_ERROR;
+            }
+            b->size = calc_image_raw_size(b);
+            s->udata = malloc(b->size);
+            b->data = malloc(b->size);
+            s->z = deflate_stream_init(s->udata, b->size);
+            png_setup_pic(d->p, b);
+        }
+        s->pos += 12 + length;
+    }
+}
+
+static void
+PNG_idec_free(struct idec *d)
+{
+    struct png_idec *s = d->priv;
+    if (s) {
+        PNG *b = d->p->pic;
+        if (s->z) {
+            deflate_stream_free(s->z);
+        }
+        free(s->udata);
+        free(b->compressed);
+        b->compressed = NULL;
+        free(s);
+        d->priv = NULL;
+    }
+}
+
 static struct file_ops png_ops = {
     .name = "PNG",
     .probe = PNG_probe,
     .load = PNG_load,
     .free = PNG_free,
     .info = PNG_info,
+    .idec = PNG_idec,
+    .idec_free = PNG_idec_free,
 };
 
 void 
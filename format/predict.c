@@ -3,6 +3,7 @@
 #include <string.h>
 
 #include "predict.h"
+#include "vp8dsp.h"
 #include "utils.h"
 
 #define DST(y, x) dst[x + y*stride]
@@ -332,19 +333,19 @@ static void pred_DC_16(uint8_t *dst, uint8_t *top, uint8_t *left, int stride, in
     }
 }
 
-static void pred_VE_16(uint8_t *dst, uint8_t *top UNUSED, uint8_t *left UNUSED,
+static void pred_VE_16(uint8_t *dst, uint8_t *top, uint8_t *left UNUSED,
                        int stride, int x UNUSED, int y UNUSED) {
     // vertical
     for (int j = 0; j < 16; ++j) {
-        memcpy(dst + j * stride, dst - stride, 16);
+        memcpy(dst + j * stride, top, 16);
     }
 }
 
-static void pred_HE_16(uint8_t *dst, uint8_t *top UNUSED, uint8_t *left UNUSED,
+static void pred_HE_16(uint8_t *dst, uint8_t *top UNUSED, uint8_t *left,
                        int stride, int x UNUSED, int y UNUSED) {
     // horizontal
-    for (int j = 16; j > 0; --j) {
-        memset(dst, dst[-1], 16);
+    for (int j = 0; j < 16; ++j) {
+        memset(dst, left[j], 16);
         dst += stride;
     }
 }
@@ -354,294 +355,211 @@ static void pred_TM_16(uint8_t *dst, uint8_t *top, uint8_t *left, int stride,
     pred_TM(dst, top, left, 16, stride);
 }
 
-typedef void (*PredFunc)(uint8_t *dst, uint8_t *top, uint8_t *left, int stride, int x, int y);
-
-static PredFunc PredLuma4[NUM_BMODES] = {
+const vp8_pred_func vp8_pred_luma4_c[NUM_BMODES] = {
     pred_B_DC, pred_B_TM, pred_B_VE, pred_B_HE, pred_B_RD,
     pred_B_VR, pred_B_LD, pred_B_VL, pred_B_HD, pred_B_HU
 };
 
-static PredFunc PredChroma8[4] = {
+const vp8_pred_func vp8_pred_chroma8_c[4] = {
     pred_DC_UV,
     pred_TM_UV,
     pred_VE_UV,
     pred_HE_UV,
 };
 
-static PredFunc PredLuma16[4] = {
+const vp8_pred_func vp8_pred_luma16_c[4] = {
     pred_DC_16,
     pred_TM_16,
     pred_VE_16,
     pred_HE_16,
 };
 
-static void add_residue_subblock(int16_t *coff, uint8_t *dst, int stride)
+/* add the residue of one 4x4 subblock, nz is its VP8_NZ_CODE */
+static inline void add_residue_subblock(const struct vp8_dsp *dsp,
+                                        const int16_t *coff, uint32_t nz,
+                                        uint8_t *dst, int stride)
 {
-    /* each subblock is 4*4 size, it has 16 coffs in order */
-    int16_t *c = coff;
-    uint8_t *d = dst;
-    for (int l = 0; l < 16; l++) {
-        d[l % 4] = clamp((*c++) + d[l % 4], 255);
-        if (l % 4 == 3) {
-          d += stride;
-        }
+    switch (nz & 3) {
+    case VP8_NZ_AC:
+        dsp->transform(coff, dst, stride);
+        break;
+    case VP8_NZ_DC:
+        dsp->transform_dc(coff, dst, stride);
+        break;
+    default:
+        break;
     }
 }
 
-static void add_luma_block(int16_t *coff, uint8_t *yout, int y_stride)
+static void add_luma_block(const struct vp8_dsp *dsp, const int16_t *coff,
+                           uint32_t non_zero, uint8_t *yout, int y_stride)
 {
-    int16_t *c = coff;
-    uint8_t *y = yout;
     /* each X is 4X4 subblock, it has 16 coffs in order
         XXXX
         XXXX
         XXXX
         XXXX
     */
+    if (!non_zero) {
+        return;
+    }
     for (int i = 0; i < 4; i++) {
         for (int j = 0; j < 4; j++) {
-          y = yout + i * 4 * y_stride + j * 4;
-          add_residue_subblock(c, y, y_stride);
-          c += 16;
+            add_residue_subblock(dsp, coff, non_zero, yout + i * 4 * y_stride + j * 4,
+                                 y_stride);
+            coff += 16;
+            non_zero >>= 2;
         }
     }
 }
 
-static void add_chrome_block(int16_t *coff, uint8_t *uvout, int uv_stride)
+static void add_chrome_block(const struct vp8_dsp *dsp, const int16_t *coff,
+                             uint32_t non_zero, uint8_t *uvout, int uv_stride)
 {
-    int16_t *c = coff;
-    uint8_t *uv;
     /* each X is 4X4 subblock, it has 16 coffs in order
         XX
         XX
     */
+    if (!(non_zero & 0xFF)) {
+        return;
+    }
     for (int i = 0; i < 2; i++) {
         for (int j = 0; j < 2; j++) {
-            uv = uvout + i * 4 * uv_stride + j * 4;
-            add_residue_subblock(c, uv, uv_stride);
-            c += 16;
+            add_residue_subblock(dsp, coff, non_zero, uvout + i * 4 * uv_stride + j * 4,
+                                 uv_stride);
+            coff += 16;
+            non_zero >>= 2;
+        }
+    }
+}
+
+void pred_edges(const uint8_t *dst, int stride, int size, int x, int y,
+                uint8_t *top, uint8_t *left)
+{
+    if (x > 0) {
+        //fill left with value from prev left block value
+        for (int i = 0; i < size; i++) {
+            left[i] = *(dst + stride * i - 1);
+        }
+    } else {
+        memset(left, 129, size);
+    }
+    if (y > 0) {
+        if (x > 0) {
+            memcpy(top - 1, dst - stride - 1, size + 1);
+        } else {
+            memcpy(top, dst - stride, size);
+            top[-1] = 129;
+        }
+    } else {
+        memset(top - 1, 127, size + 1);
+    }
+}
+
+void pred_edges4(const uint8_t *dst, int stride, int n, int x, int y,
+                 uint8_t *top, uint8_t *left)
+{
+    /* 4X4 subblock shoul be like below, the top right of the last column
+       always comes from the macroblock above right, or replicates the
+       last pixel above on the rightmost macroblock
+    -----------------------------------------
+    | y x x x | x x x x | x x x x | x x x x |
+    | x x x x | x x x x | x x x x | x x x x |
+    | x x x x | x x x x | x x x x | x x x x |
+    | x x x x | x x x x | x x x x | x x x x |
+    -----------------------------------------
+    | x x x x | x x x x | x x x x | x x x x |
+    | x x x x | x x x x | x x x x | x x x x |
+    | x x x x | x x x x | x x x x | x x x x |
+    | x x x x | x x x x | x x x x | x x x x |
+    -----------------------------------------
+    | x x x x | A x x x | x x x x | x x x x |
+    | x x x x | x x x x | x x x x | x x x x |
+    | x x x x | x x x x | x x x x | x x x x |
+    | x x x x | x x x x | x x x x | x x x x |
+    -----------------------------------------
+    | x x x x | x x x x | x x x x | x x x x |
+    | x x x x | x x x x | x x x x | x x x x |
+    | x x x x | x x x x | x x x x | x x x x |
+    | x x x x | x x x x | x x x x | x x x x |
+    -----------------------------------------
+    */
+    // for example n = 9, x = (9 % 4) * 4; y = (9 / 4) * 4;
+    int xs = (n % 4);
+    int ys = (n / 4);
+    const uint8_t *sub = dst + ys * stride * 4 + xs * 4;
+    if (x > 0 || xs > 0) {
+        for (int m = 0; m < 4; m ++) {
+            left[m] = sub[m * stride - 1];
+        }
+    } else {
+        memset(left, 129, 4);
+    }
+    if (y == 0 && ys == 0) {
+        memset(top - 1, 127, 9);
+    } else {
+        memcpy(top, sub - stride, (xs < 3) ? 8 : 4);
+        if (xs > 0 || x > 0) {
+            top[-1] = sub[-stride - 1];
+        } else {
+            top[-1] = 129;
+        }
+    }
+    if (xs == 3) {
+        if (y == 0) {
+            memset(top + 4, 127, 4);
+        } else if (x < (stride / 16) - 1) {
+            memcpy(top + 4, dst - stride + 16, 4);
+        } else {
+            memset(top + 4, dst[-stride + 15], 4);
         }
     }
 }
-void pred_luma(int16_t *coff, int ymode, uint8_t imodes[16], uint8_t *dst, int stride, int x, int y) {
+
+void pred_luma(int16_t *coff, uint32_t non_zero, int ymode, uint8_t imodes[16],
+               uint8_t *dst, int stride, int x, int y) {
     assert(ymode <= NUM_PRED_MODES);
+    const struct vp8_dsp *dsp = vp8_dsp_get();
 
-    uint8_t left_default[16] = {
-        129, 129, 129, 129, 129, 129, 129, 129, 
-        129, 129, 129, 129, 129, 129, 129, 129
-    };
-    uint8_t top_default[21] = {
-        127, 127, 127, 127, 127, 127, 127, 127,
-        127, 127, 127, 127, 127, 127, 127, 127,
-        127, 127, 127, 127, 127,
-    };
+    uint8_t left_default[16];
+    uint8_t top_default[21];
 
     uint8_t *top = &top_default[1]; // so we can access top[-1]
     uint8_t *left = &left_default[0];
-    uint8_t *topright = &top_default[5];
-#ifndef NDEBUG
-    int dx = 999, dy = 999;
-#endif
-
 
     if (ymode == B_PRED) {
-        /* 4X4 subblock shoul be like below
-        -----------------------------------------
-        | y x x x | x x x x | x x x x | x x x x |
-        | x x x x | x x x x | x x x x | x x x x |
-        | x x x x | x x x x | x x x x | x x x x |
-        | x x x x | x x x x | x x x x | x x x x |
-        -----------------------------------------
-        | x x x x | x x x x | x x x x | x x x x |
-        | x x x x | x x x x | x x x x | x x x x |
-        | x x x x | x x x x | x x x x | x x x x |
-        | x x x x | x x x x | x x x x | x x x x |
-        -----------------------------------------
-        | x x x x | A x x x | x x x x | x x x x |
-        | x x x x | x x x x | x x x x | x x x x |
-        | x x x x | x x x x | x x x x | x x x x |
-        | x x x x | x x x x | x x x x | x x x x |
-        -----------------------------------------
-        | x x x x | x x x x | x x x x | x x x x |
-        | x x x x | x x x x | x x x x | x x x x |
-        | x x x x | x x x x | x x x x | x x x x |
-        | x x x x | x x x x | x x x x | x x x x |
-        -----------------------------------------
-        */
         for (int n = 0; n < 16; ++n) {
-            PredFunc lumabfunc = PredLuma4[imodes[n]];
-            // for example n = 9, x = (9 % 4) * 4; y = (9 / 4) * 4;
-            int xs = (n % 4);
-            int ys = (n / 4);
-            if (x > 0 || xs > 0) {
-                for (int m = 0; m < 4; m ++) {
-                    left[m] = *(dst + (ys * 4 + m) * stride + xs * 4 - 1);
-                }
-            } else {
-                memset(left_default, 129, 4);
-            }
-#ifndef NDEBUG
-            if (y == dy && x == dx) {
-                printf("left: ");
-                for (int m = 0; m < 4; m ++) {
-                    printf("%02x ", left[m]);
-                }
-                printf("\n");
-            }
-#endif
-            if (y == 0 && ys == 0) {
-                memset(top_default, 127, 9);
-                // top[-1] = 129;
-            } else if (y > 0 && ys == 0) {
-                memcpy(top, dst + xs * 4 - stride, 8);
-                if (xs > 0 || x > 0) {
-                    top[-1] = *(dst + xs * 4 - stride - 1);
-                } else {
-                    top[-1] = 129;
-                }
-                if (x == ((stride / 16) - 1) && xs == 3) {
-                    memset(topright, 127, 4);
-                }
-            } else {
-                memcpy(top, dst + (ys * 4)* stride + xs * 4 - stride, 4);
-                if (xs == 3) {
-                    memset(topright, 127, 4);
-                } else if (xs < 3) {
-                    memcpy(topright, dst + (ys * 4)* stride + xs * 4 - stride + 4, 4);
-                }
-                if (xs == 0 && x == 0) {
-                    top[-1] = 129;
-                } else {
-                    top[-1] = *(dst + (ys * 4) * stride + xs * 4 - stride -1);
-                }
-            }
-#ifndef NDEBUG
-            if (y == dy && x == dx) {
-                printf("top from -1 ");
-                for (int m = -1; m < 8; m ++) {
-                    printf("%02x ", top[m]);
-                    if (m == 7) {
-                        printf("\n");
-                    }
-                }
-            }
-#endif
-
-            lumabfunc(dst + ys * stride * 4 + xs * 4, top, left, stride, x, y);
-            add_residue_subblock(coff+16*n, dst + ys * stride * 4 + xs * 4, stride);
-#ifndef NDEBUG
-            if (y == dy && x == dx) {
-                printf("%d %d: mode %d ", ys, xs, imodes[n]);
-                mb_dump(stdout, "", dst + ys * stride * 4 + xs * 4, 4, stride);
-            }
-#endif
+            uint8_t *sub = dst + (n / 4) * stride * 4 + (n % 4) * 4;
+            pred_edges4(dst, stride, n, x, y, top, left);
+            dsp->pred_luma4[imodes[n]](sub, top, left, stride, x, y);
+            add_residue_subblock(dsp, coff + 16 * n, non_zero >> (2 * n), sub, stride);
         }
     } else {
-        if (x > 0) {
-            //fill left with value from prev left block value
-            for (int i = 0; i < 16; i ++) {
-                left[i] = *(dst + stride * i - 1);
-            }
-        }
-        if (y > 0) {
-            if (x > 0) {
-                memcpy(top - 1, dst - stride - 1, 17);
-            } else {
-                memcpy(top, dst - stride, 16);
-                top[-1] = 129;
-            }
-        }
-
-#ifndef NDEBUG
-        if (x == dx && y == dy) {
-            printf("left: ");
-            for (int i = 0; i < 16; i ++) {
-                printf("%02x ", left[i]);
-            }
-            printf("\n");
-            printf("top from -1: ");
-            for (int i = -1; i < 16; i ++) {
-                printf("%02x ", top[i]);
-            }
-            printf("\n");
-        }
-#endif
         /* 16X16 */
-        PredFunc lumafunc = PredLuma16[ymode];
-        lumafunc(dst, top, left, stride, x, y);
-#ifndef NDEBUG
-        if (x == dx && y == dy) {
-            printf("%d %d: mode %d ", y, x, ymode);
-            mb_dump(stdout, "pred", dst, 16, stride);
-            // mb_dump(stdout, "coff", coff, 16, 16);
-            fprintf(stdout, "coff:\n");
-            for (int i = 0; i < 16; i++) {
-                for (int j = 0; j < 16; j++) {
-                    fprintf(stdout, "%03d ", *(coff + 16*i + j));
-                }
-                fprintf(stdout, "\n");
-            }
-        }
-#endif
-        add_luma_block(coff, dst, stride);
+        pred_edges(dst, stride, 16, x, y, top, left);
+        dsp->pred_luma16[ymode](dst, top, left, stride, x, y);
+        add_luma_block(dsp, coff, non_zero, dst, stride);
     }
 }
 
-void pred_chrome(int16_t *coff, int imode, uint8_t *uout, uint8_t *vout, int stride,
-                 int x, int y) {
+void pred_chrome(int16_t *coff, uint32_t non_zero, int imode, uint8_t *uout,
+                 uint8_t *vout, int stride, int x, int y) {
     assert(imode < NUM_BMODES);
-    PredFunc chromafunc = PredChroma8[imode];
+    const struct vp8_dsp *dsp = vp8_dsp_get();
+    vp8_pred_func chromafunc = dsp->pred_chroma8[imode];
 
-    uint8_t leftu_default[8] = {129, 129, 129, 129, 129, 129, 129, 129};
-    uint8_t topu_default[9] = {
-        127, 127, 127, 127, 127, 127, 127, 127, 127
-    };
-    uint8_t leftv_default[8] = {129, 129, 129, 129, 129, 129, 129, 129};
-    uint8_t topv_default[9] = {127, 127, 127, 127, 127, 127, 127, 127, 127};
-
-    uint8_t *topu = &topu_default[1]; // so we can access top[-1]
-    uint8_t *leftu = &leftu_default[0];
-    uint8_t *topv = &topv_default[1]; // so we can access top[-1]
-    uint8_t *leftv = &leftv_default[0];
-#ifndef NDEBUG
-    int dx = 999, dy = 999;
-#endif
-    if (x > 0) {
-        // fill left with value from prev left block value
-        for (int i = 0; i < 8; i++) {
-            leftu[i] = *(uout + stride * i - 1);
-            leftv[i] = *(vout + stride * i - 1);
-        }
-    }
-    if (y > 0) {
-        if (x > 0) {
-            memcpy(topu - 1, uout - stride - 1, 9);
-            memcpy(topv - 1, vout - stride - 1, 9);
-        } else {
-            memcpy(topu, uout - stride, 8);
-            memcpy(topv, vout - stride, 8);
-            topu[-1] = 129;
-            topv[-1] = 129;
-        }
-    }
+    uint8_t left[8];
+    uint8_t top_default[9];
+    uint8_t *top = &top_default[1]; // so we can access top[-1]
 
     // U
-    chromafunc(uout, topu, leftu, stride, x, y);
-    add_chrome_block(coff, uout, stride);
-#ifndef NDEBUG
-        if (x == dx && y == dy) {
-        printf("%d %d: mode %d ", y, x, imode);
-        mb_dump(stdout, "", uout, 8, stride);
-    }
-#endif
+    pred_edges(uout, stride, 8, x, y, top, left);
+    chromafunc(uout, top, left, stride, x, y);
+    add_chrome_block(dsp, coff, non_zero, uout, stride);
     // V
-    chromafunc(vout, topv, leftv, stride, x, y);
-    add_chrome_block(coff+64, vout, stride);
-#ifndef NDEBUG
-    if (x == dx && y == dy) {
-        mb_dump(stdout, "", vout, 8, stride);
-    }
-#endif
+    pred_edges(vout, stride, 8, x, y, top, left);
+    chromafunc(vout, top, left, stride, x, y);
+    add_chrome_block(dsp, coff + 64, non_zero >> 8, vout, stride);
 }
 
 //--------------------------------------------
@@ -790,3 +708,35 @@ void hevc_intra_angular(uint16_t *dst, uint16_t *left, uint16_t *top, int nTbS,
         }
     }
 }
+
+// see 8-30 to 8-34
+void hevc_intra_filter(uint16_t *left, uint16_t *top, int nTbS)
+{
+    uint16_t fleft[64];
+    uint16_t mftop[65];
+    uint16_t *ftop = mftop + 1;
+
+    ftop[-1] = (left[0] + 2 * top[-1] + top[0] + 2) >> 2;
+    fleft[0] = (left[1] + 2 * left[0] + top[-1] + 2) >> 2;
+    for (int y = 1; y < nTbS * 2 - 1; y++) {
+        fleft[y] = (left[y + 1] + 2 * left[y] + left[y - 1] + 2) >> 2;
+    }
+    fleft[nTbS * 2 - 1] = left[nTbS * 2 - 1];
+    for (int x = 0; x < nTbS * 2 - 1; x++) {
+        ftop[x] = (top[x - 1] + 2 * top[x] + top[x + 1] + 2) >> 2;
+    }
+    ftop[nTbS * 2 - 1] = top[nTbS * 2 - 1];
+    memcpy(top - 1, mftop, (nTbS * 2 + 1) * sizeof(uint16_t));
+    memcpy(left, fleft, nTbS * 2 * sizeof(uint16_t));
+}
+
+// see 8-25 to 8-29
+void hevc_intra_strong_filter(uint16_t *left, uint16_t *top, int nTbS)
+{
+    int last = nTbS * 2 - 1;
+    int tl = top[-1], bl = left[last], tr = top[last];
+    for (int i = 0; i < last; i++) {
+        left[i] = (tl * (last - i) + (i + 1) * bl + 32) >> 6;
+        top[i] = (tl * (last - i) + (i + 1) * tr + 32) >> 6;
+    }
+}
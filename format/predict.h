@@ -34,12 +34,28 @@ enum {
 };
 
 
+/* gather the neighbours of the size x size block at macroblock (x, y) from
+ * the reconstructed plane dst points into, top[-1] is the top left pixel.
+ * Missing neighbours are 127 above and 129 on the left
+ */
+void pred_edges(const uint8_t *dst, int stride, int size, int x, int y,
+                uint8_t *top, uint8_t *left);
+
+/* same for 4x4 subblock n of the luma macroblock at dst, top holds 8 pixels
+ * including the top right ones
+ */
+void pred_edges4(const uint8_t *dst, int stride, int n, int x, int y,
+                 uint8_t *top, uint8_t *left);
+
+/* predict one macroblock and add the residue, non_zero holds the
+ * VP8_NZ_CODE of each 4x4 block, see vp8dsp.h
+ */
 void
-pred_luma(int16_t *coff, int ymode, uint8_t imodes[16], uint8_t *dst,
-          int stride, int x, int y);
+pred_luma(int16_t *coff, uint32_t non_zero, int ymode, uint8_t imodes[16],
+          uint8_t *dst, int stride, int x, int y);
 
-void pred_chrome(int16_t *coff, int imode, uint8_t *uout, uint8_t *vout,
-                 int stride, int x, int y);
+void pred_chrome(int16_t *coff, uint32_t non_zero, int imode, uint8_t *uout,
+                 uint8_t *vout, int stride, int x, int y);
 
 
 void hevc_intra_planar(uint16_t *dst, uint16_t *left, uint16_t *top,
@@ -53,6 +69,13 @@ void hevc_intra_angular(uint16_t *dst, uint16_t *left, uint16_t *top, int nTbS,
                         int stride, int cIdx, int predModeIntra,
                         int disableIntraBoundaryFilter, int bitdepth);
 
+/* filters of 8.4.4.2.3 in place, left[0..2 * nTbS - 1], top[-1..2 * nTbS - 1],
+ * the strong one is for nTbS 32 only
+ */
+void hevc_intra_filter(uint16_t *left, uint16_t *top, int nTbS);
+
+void hevc_intra_strong_filter(uint16_t *left, uint16_t *top, int nTbS);
+
 
 
 #ifdef __cplusplus
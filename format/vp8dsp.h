@@ -0,0 +1,107 @@
+#ifndef _VP8DSP_H_
+#define _VP8DSP_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#include "predict.h"
+
+/* VP8 reconstruction kernels, filled with the C version first and then
+ * overridden by whatever the cpu supports, see vp8_dsp_init()
+ */
+
+/* how a 4x4 block is reconstructed, packed in 2 bits per block.
+ * last is the index after the last decoded coefficient
+ */
+enum {
+    VP8_NZ_NONE = 0,
+    VP8_NZ_DC = 1,
+    VP8_NZ_AC = 2,
+};
+#define VP8_NZ_CODE(last, dc)                                                  \
+    ((last) > 1 ? VP8_NZ_AC : ((dc) != 0 ? VP8_NZ_DC : VP8_NZ_NONE))
+
+typedef void (*vp8_pred_func)(uint8_t *dst, uint8_t *top, uint8_t *left,
+                              int stride, int x, int y);
+
+/* block distortion between a and b */
+typedef int (*vp8_dist_func)(const uint8_t *a, int a_stride, const uint8_t *b,
+                             int b_stride);
+
+typedef void (*vp8_simple_filter_func)(uint8_t *p, int stride, int thresh);
+
+typedef void (*vp8_filter_func)(uint8_t *p, int stride, int thresh,
+                                int ithresh, int hev_thresh);
+
+typedef void (*vp8_chroma_filter_func)(uint8_t *u, uint8_t *v, int stride,
+                                       int thresh, int ithresh, int hev_thresh);
+
+struct vp8_dsp {
+    /* inverse dct of one 4x4 block, the result is added to dst */
+    void (*transform)(const int16_t *in, uint8_t *dst, int stride);
+    /* same as transform, but only in[0] is non-zero */
+    void (*transform_dc)(const int16_t *in, uint8_t *dst, int stride);
+    /* inverse wht of the Y2 block, out[16 * i] is the DC of Y block i */
+    void (*transform_wht)(const int16_t *in, int16_t *out);
+
+    vp8_pred_func pred_luma4[NUM_BMODES];
+    vp8_pred_func pred_luma16[4];
+    vp8_pred_func pred_chroma8[4];
+
+    /* simple filter, luma only */
+    vp8_simple_filter_func simple_vfilter16;
+    vp8_simple_filter_func simple_hfilter16;
+    vp8_simple_filter_func simple_vfilter16i;
+    vp8_simple_filter_func simple_hfilter16i;
+
+    /* normal filter, on macroblock edges and on the three inner edges */
+    vp8_filter_func vfilter16;
+    vp8_filter_func hfilter16;
+    vp8_filter_func vfilter16i;
+    vp8_filter_func hfilter16i;
+    vp8_chroma_filter_func vfilter8;
+    vp8_chroma_filter_func hfilter8;
+    vp8_chroma_filter_func vfilter8i;
+    vp8_chroma_filter_func hfilter8i;
+
+    /* encoder: forward dct of src - ref, the inverse of transform */
+    void (*fdct)(const uint8_t *src, int src_stride, const uint8_t *ref,
+                 int ref_stride, int16_t *out);
+    /* forward wht, in[16 * i] is the DC of Y block i */
+    void (*fwht)(const int16_t *in, int16_t *out);
+    /* sum of absolute differences */
+    vp8_dist_func sad16x16;
+    vp8_dist_func sad8x8;
+    vp8_dist_func sad4x4;
+    /* sum of absolute hadamard transformed differences of each 4x4 */
+    vp8_dist_func satd16x16;
+    vp8_dist_func satd8x8;
+    vp8_dist_func satd4x4;
+};
+
+extern const int8_t *const VP8ksclip1;  // clips [-1020, 1020] to [-128, 127]
+extern const int8_t *const VP8ksclip2;  // clips [-112, 112] to [-16, 15]
+extern const uint8_t *const VP8kclip1;  // clips [-255,511] to [0,255]
+extern const uint8_t *const VP8kabs0;   // abs(x) for x in [-255,255]
+
+/* fill all entries with the plain C version */
+void vp8_dsp_init_c(struct vp8_dsp *dsp);
+
+/* select the best kernels once, safe to call more than once */
+void vp8_dsp_init(void);
+
+const struct vp8_dsp *vp8_dsp_get(void);
+
+/* C predictors, exported for vp8_dsp_init_c() */
+extern const vp8_pred_func vp8_pred_luma4_c[NUM_BMODES];
+extern const vp8_pred_func vp8_pred_luma16_c[4];
+extern const vp8_pred_func vp8_pred_chroma8_c[4];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*_VP8DSP_H_*/
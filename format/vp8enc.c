@@ -0,0 +1,1003 @@
+#include <errno.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "boolenc.h"
+#include "colorspace.h"
+#include "predict.h"
+#include "utils.h"
+#include "vlog.h"
+#include "vp8dsp.h"
+#include "vp8enc.h"
+#include "webp.h"
+
+VLOG_REGISTER(vp8enc, INFO)
+
+/* The encoder works in two passes over the macroblocks. The first one picks
+ * the prediction modes, quantizes and reconstructs every macroblock the same
+ * way the decoder does, and keeps the levels. The second one gathers the
+ * token statistics so the coefficient probabilities can be updated, then
+ * the modes go to the first partition and the tokens to a single token
+ * partition.
+ */
+
+#define QFIX (17)
+#define MAX_LEVEL (2047)
+
+struct vp8_quant {
+    int q[2];       // dc, ac
+    int iq[2];      // (1 << QFIX) / q
+    int bias[2];
+};
+
+struct vp8_enc_mb {
+    uint8_t ymode;
+    uint8_t uvmode;
+    uint8_t skip;
+    uint8_t imodes[16];     // for 16x16 modes, the mode is repeated
+    int16_t levels[25][16]; // zigzag order, Y2, 16 Y, 4 U, 4 V
+};
+
+struct vp8_enc {
+    const struct vp8_dsp *dsp;
+    int speed;
+    int width, height;
+    int mbw, mbh;
+
+    /* source and reconstructed planes, padded to whole macroblocks */
+    uint8_t *y_src, *u_src, *v_src;
+    uint8_t *y_rec, *u_rec, *v_rec;
+    int y_stride, uv_stride;
+
+    vp8_dist_func dist16, dist8, dist4;
+
+    int qindex;
+    struct vp8_quant y1, y2, uv;
+    int lambda;         // rate weight for dist16/dist8/dist4
+    int lambda_rd;      // rate weight against sse
+    int filter_level;
+
+    VP8BandProbas probas[NUM_TYPES][NUM_BANDS];
+    uint8_t update[NUM_TYPES][NUM_BANDS][NUM_CTX][NUM_PROBAS];
+    uint32_t (*stats)[2];
+    int use_skip;
+    int skip_prob;
+
+    /* non-zero contexts during the analysis, same layout as the decoder */
+    uint8_t (*top_nz)[9];
+    uint8_t left_nz[9];
+
+    struct vp8_enc_mb *mbs;
+};
+
+//------------------------------------------------------------------------------
+// Cost estimation, in 1/256 bit
+
+static uint16_t bit_cost_tab[257];
+static int ymode_cost[NUM_PRED_MODES];
+static int uvmode_cost[4];
+static int bmode_cost[NUM_BMODES][NUM_BMODES][NUM_BMODES];
+
+static inline int
+cost_bit(int bit, int prob)
+{
+    return bit_cost_tab[bit ? 256 - prob : prob];
+}
+
+static int
+tree_cost(const int8_t *t, const uint8_t *p, int i, int value)
+{
+    for (int b = 0; b < 2; b++) {
+        int next = t[i + b];
+        if (next <= 0) {
+            if (-next == value) {
+                return cost_bit(b, p[i >> 1]);
+            }
+        } else {
+            int c = tree_cost(t, p, next, value);
+            if (c >= 0) {
+                return c + cost_bit(b, p[i >> 1]);
+            }
+        }
+    }
+    return -1;
+}
+
+static void
+cost_init(void)
+{
+    static int inited;
+    if (inited) {
+        return;
+    }
+    bit_cost_tab[0] = bit_cost_tab[256] = 8 * 256;
+    for (int p = 1; p < 256; p++) {
+        bit_cost_tab[p] = (uint16_t)(-log2(p / 256.0) * 256 + 0.5);
+    }
+    for (int m = 0; m < NUM_PRED_MODES; m++) {
+        ymode_cost[m] = tree_cost(vp8_kf_ymode_tree, vp8_kf_ymode_prob, 0, m);
+    }
+    for (int m = 0; m < 4; m++) {
+        uvmode_cost[m] =
+            tree_cost(vp8_uv_mode_tree, vp8_kf_uv_mode_prob, 0, m);
+    }
+    for (int a = 0; a < NUM_BMODES; a++) {
+        for (int l = 0; l < NUM_BMODES; l++) {
+            for (int m = 0; m < NUM_BMODES; m++) {
+                bmode_cost[a][l][m] =
+                    tree_cost(vp8_bmode_tree, vp8_kf_bmode_prob[a][l], 0, m);
+            }
+        }
+    }
+    inited = 1;
+}
+
+//------------------------------------------------------------------------------
+// Tokens, the same walk writes them, counts them or estimates their cost
+
+struct token_sink {
+    bool_enc *be;               // write the tokens, or
+    uint32_t (*stats)[2];       // count the adaptive bits, or
+    int cost;                   // add up their cost
+    const uint8_t *probas;      // base of the adaptive probabilities
+};
+
+static inline void
+put_bit(struct token_sink *s, int bit, const uint8_t *p)
+{
+    if (s->be) {
+        bool_enc_bit(s->be, bit, *p);
+    } else if (s->stats) {
+        s->stats[p - s->probas][bit]++;
+    } else {
+        s->cost += cost_bit(bit, *p);
+    }
+}
+
+static inline void
+put_fixed(struct token_sink *s, int bit, int prob)
+{
+    if (s->be) {
+        bool_enc_bit(s->be, bit, prob);
+    } else if (!s->stats) {
+        s->cost += cost_bit(bit, prob);
+    }
+}
+
+/* see vp8_get_coefficients() in webp.c, returns 1 if any level was coded */
+static int
+put_coeffs(struct token_sink *s, const VP8BandProbas *bands, int ctx,
+           const int16_t *levels, int first)
+{
+    int last = 15;
+    while (last >= first && levels[last] == 0) {
+        last--;
+    }
+    int n = first;
+    const uint8_t *p = bands[vp8_coeff_bands[n]].probas[ctx];
+    put_bit(s, last >= first, p + 0);
+    if (last < first) {
+        return 0;
+    }
+    while (n < 16) {
+        const int c = levels[n++];
+        int v = c < 0 ? -c : c;
+        if (n < 16) {
+            ctx = v == 0 ? 0 : (v == 1 ? 1 : 2);
+        }
+        put_bit(s, v != 0, p + 1);
+        if (v == 0) {
+            // no end of block right after a zero
+            p = bands[vp8_coeff_bands[n]].probas[0];
+            continue;
+        }
+        put_bit(s, v > 1, p + 2);
+        if (v > 1) {
+            put_bit(s, v > 4, p + 3);
+            if (v <= 4) {
+                put_bit(s, v != 2, p + 4);
+                if (v != 2) {
+                    put_bit(s, v == 4, p + 5);
+                }
+            } else {
+                put_bit(s, v > 10, p + 6);
+                if (v <= 10) {
+                    put_bit(s, v > 6, p + 7);
+                    if (v <= 6) {
+                        put_fixed(s, v == 6, vp8_pcat[0][0]);
+                    } else {
+                        put_fixed(s, v >= 9, vp8_pcat[1][0]);
+                        put_fixed(s, !(v & 1), vp8_pcat[1][1]);
+                    }
+                } else {
+                    int cat, bits;
+                    put_bit(s, v >= 35, p + 8);
+                    if (v < 35) {
+                        cat = (v >= 19) ? 3 : 2;
+                        put_bit(s, cat == 3, p + 9);
+                    } else {
+                        cat = (v >= 67) ? 5 : 4;
+                        put_bit(s, cat == 5, p + 10);
+                    }
+                    static const int cat_base[6] = {5, 7, 11, 19, 35, 67};
+                    static const int cat_bits[6] = {1, 2, 3, 4, 5, 11};
+                    v -= cat_base[cat];
+                    bits = cat_bits[cat];
+                    for (int i = 0; i < bits; i++) {
+                        put_fixed(s, (v >> (bits - 1 - i)) & 1,
+                                  vp8_pcat[cat][i]);
+                    }
+                }
+            }
+        }
+        put_fixed(s, c < 0, 128);
+        if (n == 16) {
+            break;
+        }
+        p = bands[vp8_coeff_bands[n]].probas[ctx];
+        put_bit(s, n <= last, p + 0);
+        if (n > last) {
+            break;
+        }
+    }
+    return 1;
+}
+
+/* see vp8_decode_residual_block() in webp.c */
+static void
+mb_tokens(struct vp8_enc *e, struct token_sink *s, const struct vp8_enc_mb *mb,
+          uint8_t *top, uint8_t *left)
+{
+    const VP8BandProbas *ac_bands = e->probas[3];
+    int first = 0;
+
+    if (mb->skip) {
+        if (mb->ymode != B_PRED) {
+            top[0] = left[0] = 0;
+        }
+        memset(top + 1, 0, 8);
+        memset(left + 1, 0, 8);
+        return;
+    }
+    if (mb->ymode != B_PRED) {
+        int ctx = top[0] + left[0];
+        top[0] = left[0] = put_coeffs(s, e->probas[1], ctx, mb->levels[0], 0);
+        first = 1;
+        ac_bands = e->probas[0];
+    }
+    for (int y = 0; y < 4; y++) {
+        int l = left[1 + y];
+        for (int x = 0; x < 4; x++) {
+            int ctx = top[1 + x] + l;
+            l = top[1 + x] = put_coeffs(s, ac_bands, ctx,
+                                        mb->levels[1 + y * 4 + x], first);
+        }
+        left[1 + y] = l;
+    }
+    for (int ch = 5; ch <= 7; ch += 2) {
+        for (int y = 0; y < 2; y++) {
+            int l = left[ch + y];
+            for (int x = 0; x < 2; x++) {
+                int ctx = top[ch + x] + l;
+                l = top[ch + x] = put_coeffs(
+                    s, e->probas[2], ctx,
+                    mb->levels[17 + (ch - 5) * 2 + y * 2 + x], 0);
+            }
+            left[ch + y] = l;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Quantization and reconstruction
+
+static void
+quant_init(struct vp8_quant *m, int dc, int ac, int dc_bias, int ac_bias)
+{
+    m->q[0] = dc;
+    m->q[1] = ac;
+    for (int i = 0; i < 2; i++) {
+        m->iq[i] = (1 << QFIX) / m->q[i];
+    }
+    // rounding biases in 1/256 of the step
+    m->bias[0] = dc_bias << (QFIX - 8);
+    m->bias[1] = ac_bias << (QFIX - 8);
+}
+
+/* levels in zigzag order, deq in raster order as the decoder sees them,
+ * returns the index of the last non-zero level or -1
+ */
+static int
+quantize(const struct vp8_quant *m, const int16_t *in, int16_t *levels,
+         int16_t *deq, int first)
+{
+    int last = -1;
+    for (int n = first; n < 16; n++) {
+        const int j = vp8_zigzag[n];
+        const int i = n > 0;
+        const int coeff = in[j] < 0 ? -in[j] : in[j];
+        int level = (coeff * m->iq[i] + m->bias[i]) >> QFIX;
+        if (level > MAX_LEVEL) {
+            level = MAX_LEVEL;
+        }
+        levels[n] = in[j] < 0 ? -level : level;
+        deq[j] = levels[n] * m->q[i];
+        if (level) {
+            last = n;
+        }
+    }
+    return last;
+}
+
+/* see add_residue_subblock() in predict.c */
+static void
+add_residue(const struct vp8_dsp *dsp, const int16_t *deq, int last,
+            uint8_t *dst, int stride)
+{
+    switch (VP8_NZ_CODE(last + 1, deq[0])) {
+    case VP8_NZ_AC:
+        dsp->transform(deq, dst, stride);
+        break;
+    case VP8_NZ_DC:
+        dsp->transform_dc(deq, dst, stride);
+        break;
+    default:
+        break;
+    }
+}
+
+/* dst holds the prediction, it is replaced by the reconstruction */
+static int
+code_block(struct vp8_enc *e, const struct vp8_quant *m, const uint8_t *src,
+           int src_stride, uint8_t *dst, int dst_stride, int16_t *levels)
+{
+    int16_t coeffs[16], deq[16];
+    e->dsp->fdct(src, src_stride, dst, dst_stride, coeffs);
+    int last = quantize(m, coeffs, levels, deq, 0);
+    add_residue(e->dsp, deq, last, dst, dst_stride);
+    return last;
+}
+
+static int
+sse(const uint8_t *a, int a_stride, const uint8_t *b, int b_stride, int w,
+    int h)
+{
+    int sum = 0;
+    for (int j = 0; j < h; j++) {
+        for (int i = 0; i < w; i++) {
+            int d = a[i] - b[i];
+            sum += d * d;
+        }
+        a += a_stride;
+        b += b_stride;
+    }
+    return sum;
+}
+
+static void
+code_i16(struct vp8_enc *e, struct vp8_enc_mb *mb, int mode, int x, int y)
+{
+    const int stride = e->y_stride;
+    const uint8_t *src = e->y_src + (y * stride + x) * 16;
+    uint8_t *rec = e->y_rec + (y * stride + x) * 16;
+    uint8_t top_buf[17], left[16];
+    uint8_t *top = top_buf + 1;
+    int16_t coeffs[16][16], deq[16][16];
+    int16_t y2[16], deq2[16], dc[256];
+
+    pred_edges(rec, stride, 16, x, y, top, left);
+    e->dsp->pred_luma16[mode](rec, top, left, stride, x, y);
+
+    for (int n = 0; n < 16; n++) {
+        int off = (n / 4) * 4 * stride + (n % 4) * 4;
+        e->dsp->fdct(src + off, stride, rec + off, stride, coeffs[n]);
+    }
+    e->dsp->fwht(&coeffs[0][0], y2);
+    int last2 = quantize(&e->y2, y2, mb->levels[0], deq2, 0);
+    // the same choice as the decoder
+    if (last2 >= 1) {
+        e->dsp->transform_wht(deq2, dc);
+    } else {
+        for (int n = 0; n < 16; n++) {
+            dc[16 * n] = (deq2[0] + 3) >> 3;
+        }
+    }
+    for (int n = 0; n < 16; n++) {
+        int off = (n / 4) * 4 * stride + (n % 4) * 4;
+        mb->levels[1 + n][0] = 0;
+        int last = quantize(&e->y1, coeffs[n], mb->levels[1 + n], deq[n], 1);
+        deq[n][0] = dc[16 * n];
+        add_residue(e->dsp, deq[n], last, rec + off, stride);
+    }
+    mb->ymode = mode;
+    memset(mb->imodes, mode, 16);
+}
+
+static int
+above_bmode(const struct vp8_enc *e, const struct vp8_enc_mb *mb, int y, int n)
+{
+    if (n >= 4) {
+        return mb->imodes[n - 4];
+    }
+    return y > 0 ? (mb - e->mbw)->imodes[n + 12] : B_DC_PRED;
+}
+
+static int
+left_bmode(const struct vp8_enc_mb *mb, int x, int n)
+{
+    if (n & 3) {
+        return mb->imodes[n - 1];
+    }
+    return x > 0 ? (mb - 1)->imodes[n + 3] : B_DC_PRED;
+}
+
+/* sixteen 4x4 blocks, reconstructed one by one since each one predicts from
+ * the previous ones. Returns the score in the same unit as the 16x16 one
+ */
+static int64_t
+code_i4(struct vp8_enc *e, struct vp8_enc_mb *mb, int x, int y)
+{
+    const int stride = e->y_stride;
+    const uint8_t *src = e->y_src + (y * stride + x) * 16;
+    uint8_t *rec = e->y_rec + (y * stride + x) * 16;
+    uint8_t top_buf[9], left[4];
+    uint8_t *top = top_buf + 1;
+    uint8_t pred[4 * 4], best_rec[4 * 4];
+    int16_t levels[16];
+    uint8_t tnz[4], lnz[4];
+    int64_t score = 0;
+    const int rd = (e->speed == VP8_ENC_BEST);
+    struct token_sink s = {.probas = &e->probas[0][0].probas[0][0]};
+
+    memcpy(tnz, e->top_nz[x] + 1, 4);
+    memcpy(lnz, e->left_nz + 1, 4);
+    for (int n = 0; n < 16; n++) {
+        const int off = (n / 4) * 4 * stride + (n % 4) * 4;
+        const int a = above_bmode(e, mb, y, n);
+        const int l = left_bmode(mb, x, n);
+        const int ctx = tnz[n % 4] + lnz[n / 4];
+        int64_t best = INT64_MAX;
+        int best_mode = B_DC_PRED, best_nz = 0;
+
+        pred_edges4(rec, stride, n, x, y, top, left);
+        for (int m = 0; m < NUM_BMODES; m++) {
+            int64_t cost;
+            e->dsp->pred_luma4[m](pred, top, left, 4, x, y);
+            if (rd) {
+                int last = code_block(e, &e->y1, src + off, stride, pred, 4,
+                                      levels);
+                s.cost = bmode_cost[a][l][m];
+                put_coeffs(&s, e->probas[3], ctx, levels, 0);
+                cost = 256 * (int64_t)sse(src + off, stride, pred, 4, 4, 4) +
+                       (int64_t)e->lambda_rd * s.cost;
+                if (cost < best) {
+                    memcpy(best_rec, pred, sizeof(pred));
+                    memcpy(mb->levels[1 + n], levels, sizeof(levels));
+                    best_nz = (last >= 0);
+                }
+            } else {
+                cost = 256 * (int64_t)e->dist4(src + off, stride, pred, 4) +
+                       (int64_t)e->lambda * bmode_cost[a][l][m];
+            }
+            if (cost < best) {
+                best = cost;
+                best_mode = m;
+            }
+        }
+        mb->imodes[n] = best_mode;
+        if (rd) {
+            tnz[n % 4] = lnz[n / 4] = best_nz;
+            for (int j = 0; j < 4; j++) {
+                memcpy(rec + off + j * stride, best_rec + j * 4, 4);
+            }
+        } else {
+            e->dsp->pred_luma4[best_mode](rec + off, top, left, stride, x, y);
+            code_block(e, &e->y1, src + off, stride, rec + off, stride,
+                       mb->levels[1 + n]);
+        }
+        score += best;
+    }
+    mb->ymode = B_PRED;
+    memset(mb->levels[0], 0, sizeof(mb->levels[0]));
+    return score + (int64_t)(rd ? e->lambda_rd : e->lambda) * ymode_cost[B_PRED];
+}
+
+static void
+code_chroma(struct vp8_enc *e, struct vp8_enc_mb *mb, int x, int y)
+{
+    const int stride = e->uv_stride;
+    const int off = (y * stride + x) * 8;
+    const uint8_t *src[2] = {e->u_src + off, e->v_src + off};
+    uint8_t *rec[2] = {e->u_rec + off, e->v_rec + off};
+    uint8_t top_buf[2][9], left[2][8];
+    uint8_t pred[8 * 8];
+    int64_t best = INT64_MAX;
+    int best_mode = DC_PRED;
+
+    for (int c = 0; c < 2; c++) {
+        pred_edges(rec[c], stride, 8, x, y, top_buf[c] + 1, left[c]);
+    }
+    for (int m = 0; m < 4; m++) {
+        int64_t cost = (int64_t)e->lambda * uvmode_cost[m];
+        for (int c = 0; c < 2; c++) {
+            e->dsp->pred_chroma8[m](pred, top_buf[c] + 1, left[c], 8, x, y);
+            cost += 256 * (int64_t)e->dist8(src[c], stride, pred, 8);
+        }
+        if (cost < best) {
+            best = cost;
+            best_mode = m;
+        }
+    }
+    mb->uvmode = best_mode;
+    for (int c = 0; c < 2; c++) {
+        e->dsp->pred_chroma8[best_mode](rec[c], top_buf[c] + 1, left[c], stride,
+                                        x, y);
+        for (int n = 0; n < 4; n++) {
+            int boff = (n / 2) * 4 * stride + (n % 2) * 4;
+            code_block(e, &e->uv, src[c] + boff, stride, rec[c] + boff, stride,
+                       mb->levels[17 + c * 4 + n]);
+        }
+    }
+}
+
+static void
+encode_mb(struct vp8_enc *e, int x, int y)
+{
+    struct vp8_enc_mb *mb = &e->mbs[y * e->mbw + x];
+    const int stride = e->y_stride;
+    const uint8_t *src = e->y_src + (y * stride + x) * 16;
+    uint8_t *rec = e->y_rec + (y * stride + x) * 16;
+    uint8_t top_buf[17], left[16], pred[16 * 16];
+    uint8_t *top = top_buf + 1;
+    int64_t best16 = INT64_MAX;
+    int mode16 = DC_PRED;
+
+    // 16x16 mode by distortion of the prediction
+    pred_edges(rec, stride, 16, x, y, top, left);
+    for (int m = 0; m < 4; m++) {
+        e->dsp->pred_luma16[m](pred, top, left, 16, x, y);
+        int64_t cost = 256 * (int64_t)e->dist16(src, stride, pred, 16) +
+                       (int64_t)e->lambda * ymode_cost[m];
+        if (cost < best16) {
+            best16 = cost;
+            mode16 = m;
+        }
+    }
+
+    if (e->speed == VP8_ENC_FASTEST) {
+        code_i16(e, mb, mode16, x, y);
+    } else if (e->speed < VP8_ENC_BEST) {
+        int64_t best4 = code_i4(e, mb, x, y);
+        if (best16 <= best4) {
+            code_i16(e, mb, mode16, x, y);
+        }
+    } else {
+        // compare both reconstructions with the real token cost
+        struct token_sink s = {.probas = &e->probas[0][0].probas[0][0]};
+        struct vp8_enc_mb mb16;
+        uint8_t rec16[16 * 16], top_nz[9], left_nz[9];
+
+        mb16.skip = 0;
+        code_i16(e, &mb16, mode16, x, y);
+        for (int j = 0; j < 16; j++) {
+            memcpy(rec16 + j * 16, rec + j * stride, 16);
+        }
+        // chroma is not coded yet, so only the luma tokens count
+        memset(mb16.levels[17], 0, 8 * sizeof(mb16.levels[0]));
+        memcpy(top_nz, e->top_nz[x], 9);
+        memcpy(left_nz, e->left_nz, 9);
+        s.cost = ymode_cost[mode16];
+        mb_tokens(e, &s, &mb16, top_nz, left_nz);
+        int64_t rd16 = 256 * (int64_t)sse(src, stride, rec16, 16, 16, 16) +
+                       (int64_t)e->lambda_rd * s.cost;
+
+        mb->skip = 0;
+        int64_t rd4 = code_i4(e, mb, x, y);
+        if (rd16 <= rd4) {
+            memcpy(mb, &mb16, sizeof(mb16));
+            for (int j = 0; j < 16; j++) {
+                memcpy(rec + j * stride, rec16 + j * 16, 16);
+            }
+        }
+    }
+    code_chroma(e, mb, x, y);
+
+    mb->skip = 1;
+    for (int i = (mb->ymode == B_PRED) ? 1 : 0; i < 25 && mb->skip; i++) {
+        for (int n = 0; n < 16; n++) {
+            if (mb->levels[i][n]) {
+                mb->skip = 0;
+                break;
+            }
+        }
+    }
+    if (e->speed == VP8_ENC_BEST) {
+        // keep the contexts the token pass will see
+        struct token_sink s = {.probas = &e->probas[0][0].probas[0][0]};
+        mb_tokens(e, &s, mb, e->top_nz[x], e->left_nz);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Setup
+
+static int
+quality_to_qindex(int quality)
+{
+    // roughly the same curve as libwebp, with a cubic root
+    double q = clamp(quality, 100) / 100.;
+    double linear = (q < 0.75) ? q * (2. / 3.) : 2. * q - 1.;
+    return clamp((int)(127 * (1. - cbrt(linear)) + .5), 127);
+}
+
+static void
+enc_setup(struct vp8_enc *e, const struct vp8_enc_config *cfg)
+{
+    int q = quality_to_qindex(cfg->quality);
+    int y2dc = vp8_dc_qlookup[q] * 2;
+    int y2ac = vp8_ac_qlookup[q] * 155 / 100;
+    int ac = vp8_ac_qlookup[q];
+
+    e->qindex = q;
+    quant_init(&e->y1, vp8_dc_qlookup[q], ac, 96, 110);
+    quant_init(&e->y2, y2dc > 132 ? 132 : y2dc, y2ac < 8 ? 8 : y2ac, 96, 108);
+    quant_init(&e->uv, vp8_dc_qlookup[q], ac, 110, 115);
+
+    e->lambda = ac * 3 / 4 + 1;
+    e->lambda_rd = (3 * ac * ac) >> 7;
+    if (e->lambda_rd < 1) {
+        e->lambda_rd = 1;
+    }
+    // stronger filtering for coarser quantizers, with a sharpness of 0
+    e->filter_level = clamp(ac * 3 / 8 + 2, 63);
+
+    e->speed = clip3(VP8_ENC_FASTEST, VP8_ENC_BEST, cfg->speed);
+    if (e->speed <= VP8_ENC_FAST) {
+        e->dist16 = e->dsp->sad16x16;
+        e->dist8 = e->dsp->sad8x8;
+        e->dist4 = e->dsp->sad4x4;
+    } else {
+        e->dist16 = e->dsp->satd16x16;
+        e->dist8 = e->dsp->satd8x8;
+        e->dist4 = e->dsp->satd4x4;
+        // the hadamard sums are about twice the absolute differences
+        e->lambda *= 2;
+    }
+    memcpy(e->probas, vp8_default_coeff_probs, sizeof(e->probas));
+}
+
+/* byte offsets of blue, green and red in one pixel */
+static void
+pixel_offsets(const struct pic *p, int *b, int *g, int *r)
+{
+    *g = 1;
+    switch (p->format) {
+    case CS_PIXELFORMAT_RGB24:
+    case CS_PIXELFORMAT_XBGR8888:
+    case CS_PIXELFORMAT_ABGR8888:
+        *r = 0;
+        *b = 2;
+        break;
+    case CS_PIXELFORMAT_RGBA8888:
+        *r = 3;
+        *g = 2;
+        *b = 1;
+        break;
+    case CS_PIXELFORMAT_BGRA8888:
+        *r = 1;
+        *g = 2;
+        *b = 3;
+        break;
+    default:
+        *b = 0;
+        *r = 2;
+        break;
+    }
+}
+
+static inline uint8_t
+studio_y(int y)
+{
+    // full range Y - 128 from BGR24_to_YUV420 to [16, 235]
+    return clamp(16 + ((y + 128) * 219 + 127) / 255, 255);
+}
+
+static inline uint8_t
+studio_uv(int c)
+{
+    // [-128, 127] to [16, 240]
+    int v = c * 224;
+    return clamp(128 + (v >= 0 ? (v + 127) / 255 : -((-v + 127) / 255)), 255);
+}
+
+static void
+import_pic(struct vp8_enc *e, const struct pic *p)
+{
+    uint8_t bgr[16 * 16 * 3];
+    int16_t Y[256], U[64], V[64];
+    int ob, og, orr;
+    int bpp = p->depth / 8;
+
+    pixel_offsets(p, &ob, &og, &orr);
+    for (int my = 0; my < e->mbh; my++) {
+        for (int mx = 0; mx < e->mbw; mx++) {
+            // replicate the last row and column into the padding
+            for (int j = 0; j < 16; j++) {
+                int sy = MIN(my * 16 + j, p->height - 1);
+                const uint8_t *row = (const uint8_t *)p->pixels + sy * p->pitch;
+                for (int i = 0; i < 16; i++) {
+                    const uint8_t *px = row + MIN(mx * 16 + i, p->width - 1) * bpp;
+                    bgr[(j * 16 + i) * 3] = px[ob];
+                    bgr[(j * 16 + i) * 3 + 1] = px[og];
+                    bgr[(j * 16 + i) * 3 + 2] = px[orr];
+                }
+            }
+            BGR24_to_YUV420(bgr, 16 * 3, Y, U, V);
+            // Y comes as four 8x8 blocks
+            for (int k = 0; k < 4; k++) {
+                uint8_t *dst = e->y_src + (my * 16 + (k >> 1) * 8) * e->y_stride +
+                               mx * 16 + (k & 1) * 8;
+                for (int j = 0; j < 8; j++) {
+                    for (int i = 0; i < 8; i++) {
+                        dst[j * e->y_stride + i] = studio_y(Y[k * 64 + j * 8 + i]);
+                    }
+                }
+            }
+            for (int j = 0; j < 8; j++) {
+                for (int i = 0; i < 8; i++) {
+                    int off = (my * 8 + j) * e->uv_stride + mx * 8 + i;
+                    e->u_src[off] = studio_uv(U[j * 8 + i]);
+                    e->v_src[off] = studio_uv(V[j * 8 + i]);
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Bitstream
+
+static void
+finalize_probas(struct vp8_enc *e)
+{
+    const uint8_t *dflt = &vp8_default_coeff_probs[0][0][0][0];
+    const uint8_t *upd = &vp8_coeff_update_probs[0][0][0][0];
+    uint8_t *probas = &e->probas[0][0].probas[0][0];
+    uint8_t *update = &e->update[0][0][0][0];
+
+    for (int i = 0; i < NUM_TYPES * NUM_BANDS * NUM_CTX * NUM_PROBAS; i++) {
+        const uint32_t n0 = e->stats[i][0], n1 = e->stats[i][1];
+        const uint32_t total = n0 + n1;
+        probas[i] = dflt[i];
+        update[i] = 0;
+        if (total == 0) {
+            continue;
+        }
+        int p = n1 ? 255 - (int)(n1 * 255ULL / total) : 255;
+        p = clip3(1, 255, p);
+        const int64_t old_cost = (int64_t)n0 * cost_bit(0, dflt[i]) +
+                                 (int64_t)n1 * cost_bit(1, dflt[i]) +
+                                 cost_bit(0, upd[i]);
+        const int64_t new_cost = (int64_t)n0 * cost_bit(0, p) +
+                                 (int64_t)n1 * cost_bit(1, p) +
+                                 cost_bit(1, upd[i]) + 8 * 256;
+        if (new_cost < old_cost) {
+            probas[i] = p;
+            update[i] = 1;
+        }
+    }
+}
+
+static void
+gather_stats(struct vp8_enc *e)
+{
+    struct token_sink s = {
+        .stats = e->stats,
+        .probas = &e->probas[0][0].probas[0][0],
+    };
+    uint8_t left[9];
+    int nskip = 0;
+
+    memset(e->top_nz, 0, e->mbw * sizeof(e->top_nz[0]));
+    for (int y = 0; y < e->mbh; y++) {
+        memset(left, 0, sizeof(left));
+        for (int x = 0; x < e->mbw; x++) {
+            struct vp8_enc_mb *mb = &e->mbs[y * e->mbw + x];
+            nskip += mb->skip;
+            mb_tokens(e, &s, mb, e->top_nz[x], left);
+        }
+    }
+    finalize_probas(e);
+
+    // probability of a macroblock having coefficients
+    int total = e->mbw * e->mbh;
+    e->skip_prob = clip3(1, 255, (total - nskip) * 255 / total);
+    e->use_skip = e->skip_prob < 250;
+    if (!e->use_skip) {
+        for (int i = 0; i < total; i++) {
+            e->mbs[i].skip = 0;
+        }
+    }
+}
+
+/* mirrors read_vp8_ctl_partition() and vp8_decode_mb_header() */
+static void
+write_first_partition(struct vp8_enc *e, bool_enc *be)
+{
+    BOOL_ENC_BIT(be, 0);    // color space
+    BOOL_ENC_BIT(be, 0);    // clamping required
+    BOOL_ENC_BIT(be, 0);    // no segmentation
+    BOOL_ENC_BIT(be, 0);    // normal loop filter
+    BOOL_ENC_BITS(be, e->filter_level, 6);
+    BOOL_ENC_BITS(be, 0, 3);    // sharpness
+    BOOL_ENC_BIT(be, 0);    // no loop filter adjustments
+    BOOL_ENC_BITS(be, 0, 2);    // one token partition
+
+    BOOL_ENC_BITS(be, e->qindex, 7);
+    for (int i = 0; i < 5; i++) {
+        BOOL_ENC_BIT(be, 0);    // no quantizer delta
+    }
+    BOOL_ENC_BIT(be, 0);    // refresh_entropy_probs
+
+    for (int t = 0; t < NUM_TYPES; t++) {
+        for (int b = 0; b < NUM_BANDS; b++) {
+            for (int c = 0; c < NUM_CTX; c++) {
+                for (int p = 0; p < NUM_PROBAS; p++) {
+                    int u = e->update[t][b][c][p];
+                    BOOL_ENCODE(be, u, vp8_coeff_update_probs[t][b][c][p]);
+                    if (u) {
+                        BOOL_ENC_BITS(be, e->probas[t][b].probas[c][p], 8);
+                    }
+                }
+            }
+        }
+    }
+
+    BOOL_ENC_BIT(be, e->use_skip);
+    if (e->use_skip) {
+        BOOL_ENC_BITS(be, e->skip_prob, 8);
+    }
+
+    for (int y = 0; y < e->mbh; y++) {
+        for (int x = 0; x < e->mbw; x++) {
+            const struct vp8_enc_mb *mb = &e->mbs[y * e->mbw + x];
+            if (e->use_skip) {
+                BOOL_ENCODE(be, mb->skip, e->skip_prob);
+            }
+            BOOL_ENC_TREE(be, vp8_kf_ymode_tree, vp8_kf_ymode_prob, mb->ymode);
+            if (mb->ymode == B_PRED) {
+                for (int n = 0; n < 16; n++) {
+                    int a = above_bmode(e, mb, y, n);
+                    int l = left_bmode(mb, x, n);
+                    BOOL_ENC_TREE(be, vp8_bmode_tree, vp8_kf_bmode_prob[a][l],
+                                  mb->imodes[n]);
+                }
+            }
+            BOOL_ENC_TREE(be, vp8_uv_mode_tree, vp8_kf_uv_mode_prob,
+                          mb->uvmode);
+        }
+    }
+}
+
+static void
+write_tokens(struct vp8_enc *e, bool_enc *be)
+{
+    struct token_sink s = {
+        .be = be,
+        .probas = &e->probas[0][0].probas[0][0],
+    };
+    uint8_t left[9];
+
+    memset(e->top_nz, 0, e->mbw * sizeof(e->top_nz[0]));
+    for (int y = 0; y < e->mbh; y++) {
+        memset(left, 0, sizeof(left));
+        for (int x = 0; x < e->mbw; x++) {
+            mb_tokens(e, &s, &e->mbs[y * e->mbw + x], e->top_nz[x], left);
+        }
+    }
+}
+
+void
+vp8_enc_config_default(struct vp8_enc_config *cfg)
+{
+    cfg->quality = 75;
+    cfg->speed = VP8_ENC_DEFAULT;
+}
+
+static void
+enc_free(struct vp8_enc *e)
+{
+    free(e->y_src);
+    free(e->y_rec);
+    free(e->top_nz);
+    free(e->stats);
+    free(e->mbs);
+    free(e);
+}
+
+int
+vp8_encode(const struct pic *p, const struct vp8_enc_config *cfg,
+           uint8_t **out)
+{
+    if (p->width <= 0 || p->height <= 0 || p->width > 0x3FFF ||
+        p->height > 0x3FFF || (p->depth != 24 && p->depth != 32)) {
+        VERR(vp8enc, "can not encode %dx%d with depth %d", p->width,
+             p->height, p->depth);
+        return -EINVAL;
+    }
+    cost_init();
+
+    struct vp8_enc *e = calloc(1, sizeof(*e));
+    e->dsp = vp8_dsp_get();
+    e->width = p->width;
+    e->height = p->height;
+    e->mbw = (p->width + 15) >> 4;
+    e->mbh = (p->height + 15) >> 4;
+    e->y_stride = e->mbw * 16;
+    e->uv_stride = e->mbw * 8;
+
+    // one allocation for all the source planes, one for the reconstructed
+    int ysize = e->y_stride * e->mbh * 16, uvsize = e->uv_stride * e->mbh * 8;
+    e->y_src = malloc(ysize + 2 * uvsize);
+    e->u_src = e->y_src + ysize;
+    e->v_src = e->u_src + uvsize;
+    e->y_rec = malloc(ysize + 2 * uvsize);
+    e->u_rec = e->y_rec + ysize;
+    e->v_rec = e->u_rec + uvsize;
+    e->top_nz = calloc(e->mbw, sizeof(e->top_nz[0]));
+    e->stats = calloc(NUM_TYPES * NUM_BANDS * NUM_CTX * NUM_PROBAS,
+                      sizeof(e->stats[0]));
+    e->mbs = calloc(e->mbw * e->mbh, sizeof(struct vp8_enc_mb));
+
+    enc_setup(e, cfg);
+    import_pic(e, p);
+
+    for (int y = 0; y < e->mbh; y++) {
+        memset(e->left_nz, 0, sizeof(e->left_nz));
+        for (int x = 0; x < e->mbw; x++) {
+            encode_mb(e, x, y);
+        }
+    }
+    gather_stats(e);
+
+    bool_enc *be0 = bool_enc_init(e->mbw * e->mbh * 4 + 1024);
+    bool_enc *be1 = bool_enc_init(e->mbw * e->mbh * 64);
+    write_first_partition(e, be0);
+    write_tokens(e, be1);
+    int len0, len1;
+    uint8_t *part0 = bool_enc_finish(be0, &len0);
+    uint8_t *part1 = bool_enc_finish(be1, &len1);
+
+    int ret = -EINVAL;
+    if (len0 >= (1 << 19)) {
+        VERR(vp8enc, "first partition too large %d", len0);
+    } else {
+        uint8_t *buf = malloc(10 + len0 + len1);
+        // frame tag: key frame, version 0, shown, size of the first partition
+        uint32_t tag = (0 << 0) | (0 << 1) | (1 << 4) | ((uint32_t)len0 << 5);
+        buf[0] = tag & 0xFF;
+        buf[1] = (tag >> 8) & 0xFF;
+        buf[2] = (tag >> 16) & 0xFF;
+        buf[3] = 0x9d;
+        buf[4] = 0x01;
+        buf[5] = 0x2a;
+        // no scaling in the upper two bits
+        buf[6] = e->width & 0xFF;
+        buf[7] = (e->width >> 8) & 0x3F;
+        buf[8] = e->height & 0xFF;
+        buf[9] = (e->height >> 8) & 0x3F;
+        memcpy(buf + 10, part0, len0);
+        memcpy(buf + 10 + len0, part1, len1);
+        *out = buf;
+        ret = 10 + len0 + len1;
+        VDBG(vp8enc, "q %d, filter %d, partitions %d + %d bytes", e->qindex,
+              e->filter_level, len0, len1);
+    }
+    bool_enc_free(be0);
+    bool_enc_free(be1);
+    enc_free(e);
+    return ret;
+}
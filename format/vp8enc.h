@@ -0,0 +1,39 @@
+#ifndef _VP8ENC_H_
+#define _VP8ENC_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#include "file.h"
+
+/* VP8 key frame encoder, the lossy part of WebP */
+
+enum vp8_enc_speed {
+    VP8_ENC_FASTEST = 0, // 16x16 modes only, decided by SAD
+    VP8_ENC_FAST,        // 16x16 and 4x4 modes, decided by SAD
+    VP8_ENC_DEFAULT,     // 16x16 and 4x4 modes, decided by SATD
+    VP8_ENC_BEST,        // 4x4 modes and 16x16 vs 4x4 by real rate-distortion
+};
+
+struct vp8_enc_config {
+    int quality;    // 0 - 100
+    int speed;      // see enum vp8_enc_speed
+};
+
+void vp8_enc_config_default(struct vp8_enc_config *cfg);
+
+/* encode p as a VP8 key frame, *out is allocated here and owned by the
+ * caller. Returns the size of the VP8 bitstream (without any RIFF chunk
+ * header) or a negative errno
+ */
+int vp8_encode(const struct pic *p, const struct vp8_enc_config *cfg,
+               uint8_t **out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*_VP8ENC_H_*/
@@ -0,0 +1,807 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "utils.h"
+#include "vlog.h"
+#include "vp8l.h"
+
+VLOG_REGISTER(vp8l, INFO)
+
+/* WebP lossless bitstream, see
+ * https://developers.google.com/speed/webp/docs/webp_lossless_bitstream_specification
+ */
+
+#define NUM_LITERAL_CODES (256)
+#define NUM_LENGTH_CODES (24)
+#define NUM_DISTANCE_CODES (40)
+#define NUM_CODE_LENGTH_CODES (19)
+#define MAX_CACHE_BITS (11)
+
+#define HUFF_ROOT_BITS (8)
+#define HUFF_MAX_LEN (15)
+
+enum { GREEN = 0, RED, BLUE, ALPHA, DIST, HUFF_CODES_PER_GROUP };
+
+/* The prefix codes are read lsb first, one symbol per pixel channel, so use
+ * a 64bit window instead of the bit by bit bits_vec reader.
+ * Reading past the end returns zero bits, bits_eos() tells it afterwards.
+ */
+struct vp8l_br {
+    const uint8_t *buf;
+    int len;
+    int pos;        /* next byte to load, may go past len */
+    int nbits;      /* valid bits in val */
+    uint64_t val;
+};
+
+static inline void
+br_fill(struct vp8l_br *br)
+{
+    while (br->nbits <= 56) {
+        uint64_t b = br->pos < br->len ? br->buf[br->pos] : 0;
+        br->val |= b << br->nbits;
+        br->pos++;
+        br->nbits += 8;
+    }
+}
+
+static inline void
+br_skip(struct vp8l_br *br, int n)
+{
+    br->val >>= n;
+    br->nbits -= n;
+}
+
+/* n is less than 32 */
+static inline uint32_t
+br_read(struct vp8l_br *br, int n)
+{
+    br_fill(br);
+    uint32_t v = br->val & ((1ULL << n) - 1);
+    br_skip(br, n);
+    return v;
+}
+
+static inline int
+br_eos(const struct vp8l_br *br)
+{
+    return (int64_t)br->pos * 8 - br->nbits > (int64_t)br->len * 8;
+}
+
+/* two level lookup table, codes longer than HUFF_ROOT_BITS are linked from
+ * the root entry with len = HUFF_ROOT_BITS + bits of the second level table
+ * and sym as its offset
+ */
+struct hcode {
+    uint8_t len;
+    uint16_t sym;
+};
+
+struct htree {
+    struct hcode *table;
+};
+
+struct hgroup {
+    struct htree t[HUFF_CODES_PER_GROUP];
+};
+
+static inline int
+huff_read(struct vp8l_br *br, const struct htree *t)
+{
+    br_fill(br);
+    const struct hcode *e = t->table + (br->val & ((1 << HUFF_ROOT_BITS) - 1));
+    if (e->len > HUFF_ROOT_BITS) {
+        br_skip(br, HUFF_ROOT_BITS);
+        e = t->table + e->sym +
+            (br->val & ((1 << (e->len - HUFF_ROOT_BITS)) - 1));
+    }
+    br_skip(br, e->len);
+    return e->sym;
+}
+
+static uint32_t
+reverse_bits(uint32_t code, int len)
+{
+    uint32_t r = 0;
+    for (int i = 0; i < len; i++) {
+        r = (r << 1) | ((code >> i) & 1);
+    }
+    return r;
+}
+
+/* canonical prefix code from code lengths, a single used symbol takes no
+ * bits at all
+ */
+static int
+huff_build(struct htree *t, const uint8_t *lens, int n)
+{
+    int count[HUFF_MAX_LEN + 1] = {0};
+    uint32_t next[HUFF_MAX_LEN + 1];
+    uint8_t sub[1 << HUFF_ROOT_BITS] = {0};
+    uint16_t base[1 << HUFF_ROOT_BITS];
+    int nsym = 0, last = 0;
+
+    t->table = NULL;
+    for (int i = 0; i < n; i++) {
+        if (lens[i]) {
+            count[lens[i]]++;
+            nsym++;
+            last = i;
+        }
+    }
+    if (nsym == 0) {
+        return -1;
+    }
+    if (nsym == 1) {
+        t->table = malloc(sizeof(struct hcode) << HUFF_ROOT_BITS);
+        for (int i = 0; i < (1 << HUFF_ROOT_BITS); i++) {
+            t->table[i].len = 0;
+            t->table[i].sym = last;
+        }
+        return 0;
+    }
+
+    /* only complete codes are valid */
+    int left = 1;
+    for (int l = 1; l <= HUFF_MAX_LEN; l++) {
+        left = (left << 1) - count[l];
+        if (left < 0) {
+            return -1;
+        }
+    }
+    if (left) {
+        return -1;
+    }
+
+    uint16_t *codes = malloc(n * sizeof(uint16_t));
+    next[1] = 0;
+    for (int l = 2; l <= HUFF_MAX_LEN; l++) {
+        next[l] = (next[l - 1] + count[l - 1]) << 1;
+    }
+    for (int i = 0; i < n; i++) {
+        int l = lens[i];
+        if (!l) {
+            continue;
+        }
+        codes[i] = reverse_bits(next[l]++, l);
+        if (l > HUFF_ROOT_BITS) {
+            int low = codes[i] & ((1 << HUFF_ROOT_BITS) - 1);
+            if (sub[low] < l - HUFF_ROOT_BITS) {
+                sub[low] = l - HUFF_ROOT_BITS;
+            }
+        }
+    }
+
+    int size = 1 << HUFF_ROOT_BITS;
+    for (int i = 0; i < (1 << HUFF_ROOT_BITS); i++) {
+        if (sub[i]) {
+            base[i] = size;
+            size += 1 << sub[i];
+        }
+    }
+    t->table = calloc(size, sizeof(struct hcode));
+    for (int i = 0; i < (1 << HUFF_ROOT_BITS); i++) {
+        if (sub[i]) {
+            t->table[i].len = HUFF_ROOT_BITS + sub[i];
+            t->table[i].sym = base[i];
+        }
+    }
+    for (int i = 0; i < n; i++) {
+        int l = lens[i];
+        if (!l) {
+            continue;
+        }
+        if (l <= HUFF_ROOT_BITS) {
+            for (int k = codes[i]; k < (1 << HUFF_ROOT_BITS); k += 1 << l) {
+                t->table[k].len = l;
+                t->table[k].sym = i;
+            }
+        } else {
+            int low = codes[i] & ((1 << HUFF_ROOT_BITS) - 1);
+            struct hcode *s = t->table + base[low];
+            for (int k = codes[i] >> HUFF_ROOT_BITS; k < (1 << sub[low]);
+                 k += 1 << (l - HUFF_ROOT_BITS)) {
+                s[k].len = l - HUFF_ROOT_BITS;
+                s[k].sym = i;
+            }
+        }
+    }
+    free(codes);
+    return 0;
+}
+
+static void
+huff_free(struct htree *t)
+{
+    free(t->table);
+    t->table = NULL;
+}
+
+static const uint8_t code_length_order[NUM_CODE_LENGTH_CODES] = {
+    17, 18, 0, 1, 2, 3, 4, 5, 16, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+};
+
+static int
+read_huffman_code(struct vp8l_br *br, int alphabet, struct htree *t)
+{
+    uint8_t *lens = calloc(alphabet, 1);
+    int ret = -1;
+
+    if (br_read(br, 1)) {
+        /* simple code, one or two symbols */
+        int num = br_read(br, 1) + 1;
+        int first_8bits = br_read(br, 1);
+        int s0 = br_read(br, 1 + 7 * first_8bits);
+        if (s0 >= alphabet) {
+            goto end;
+        }
+        lens[s0] = 1;
+        if (num == 2) {
+            int s1 = br_read(br, 8);
+            if (s1 >= alphabet) {
+                goto end;
+            }
+            lens[s1] = 1;
+        }
+    } else {
+        uint8_t cl_lens[NUM_CODE_LENGTH_CODES] = {0};
+        struct htree cl;
+        int num = br_read(br, 4) + 4;
+        for (int i = 0; i < num; i++) {
+            cl_lens[code_length_order[i]] = br_read(br, 3);
+        }
+        if (huff_build(&cl, cl_lens, NUM_CODE_LENGTH_CODES) < 0) {
+            VERR(vp8l, "invalid code length code");
+            goto end;
+        }
+        int max_symbol = alphabet;
+        if (br_read(br, 1)) {
+            int nbits = 2 + 2 * br_read(br, 3);
+            max_symbol = 2 + br_read(br, nbits);
+            if (max_symbol > alphabet) {
+                huff_free(&cl);
+                goto end;
+            }
+        }
+        int prev = 8, sym = 0;
+        while (sym < alphabet && max_symbol-- > 0) {
+            int c = huff_read(br, &cl);
+            if (c < 16) {
+                lens[sym++] = c;
+                if (c) {
+                    prev = c;
+                }
+            } else {
+                static const uint8_t extra[3] = {2, 3, 7};
+                static const uint8_t offset[3] = {3, 3, 11};
+                int rep = br_read(br, extra[c - 16]) + offset[c - 16];
+                if (sym + rep > alphabet) {
+                    huff_free(&cl);
+                    goto end;
+                }
+                memset(lens + sym, c == 16 ? prev : 0, rep);
+                sym += rep;
+            }
+        }
+        huff_free(&cl);
+    }
+    ret = huff_build(t, lens, alphabet);
+end:
+    free(lens);
+    return ret;
+}
+
+static inline int
+prefix_value(struct vp8l_br *br, int prefix)
+{
+    if (prefix < 4) {
+        return prefix + 1;
+    }
+    int extra = (prefix - 2) >> 1;
+    int offset = (2 + (prefix & 1)) << extra;
+    return offset + br_read(br, extra) + 1;
+}
+
+/* (dy << 4) | (8 - dx) for the 120 short distance codes */
+static const uint8_t code_to_plane[120] = {
+    0x18, 0x07, 0x17, 0x19, 0x28, 0x06, 0x27, 0x29, 0x16, 0x1a, 0x26, 0x2a,
+    0x38, 0x05, 0x37, 0x39, 0x15, 0x1b, 0x36, 0x3a, 0x25, 0x2b, 0x48, 0x04,
+    0x47, 0x49, 0x14, 0x1c, 0x35, 0x3b, 0x46, 0x4a, 0x24, 0x2c, 0x58, 0x45,
+    0x4b, 0x34, 0x3c, 0x03, 0x57, 0x59, 0x13, 0x1d, 0x56, 0x5a, 0x23, 0x2d,
+    0x44, 0x4c, 0x55, 0x5b, 0x33, 0x3d, 0x68, 0x02, 0x67, 0x69, 0x12, 0x1e,
+    0x66, 0x6a, 0x22, 0x2e, 0x54, 0x5c, 0x43, 0x4d, 0x65, 0x6b, 0x32, 0x3e,
+    0x78, 0x01, 0x77, 0x79, 0x53, 0x5d, 0x11, 0x1f, 0x64, 0x6c, 0x42, 0x4e,
+    0x76, 0x7a, 0x21, 0x2f, 0x75, 0x7b, 0x31, 0x3f, 0x63, 0x6d, 0x52, 0x5e,
+    0x00, 0x74, 0x7c, 0x41, 0x4f, 0x10, 0x20, 0x62, 0x6e, 0x30, 0x73, 0x7d,
+    0x51, 0x5f, 0x40, 0x72, 0x7e, 0x61, 0x6f, 0x50, 0x71, 0x7f, 0x60, 0x70,
+};
+
+static inline int
+plane_to_distance(int xsize, int code)
+{
+    if (code > 120) {
+        return code - 120;
+    }
+    int v = code_to_plane[code - 1];
+    int dist = (v >> 4) * xsize + 8 - (v & 0xf);
+    return dist >= 1 ? dist : 1;
+}
+
+struct vp8l_transform {
+    int type;
+    int bits;
+    int xsize;      /* width of the image after the inverse transform */
+    uint32_t *data; /* sub image, or the color table */
+};
+
+struct vp8l_dec {
+    struct vp8l_br br;
+    int ntransforms;
+    uint32_t seen;
+    struct vp8l_transform transforms[4];
+};
+
+static int decode_image_stream(struct vp8l_dec *d, int xsize, int ysize,
+                               int is_level0, uint32_t *out);
+
+static inline uint32_t
+add_pixels(uint32_t a, uint32_t b)
+{
+    uint32_t ag = (a & 0xff00ff00u) + (b & 0xff00ff00u);
+    uint32_t rb = (a & 0x00ff00ffu) + (b & 0x00ff00ffu);
+    return (ag & 0xff00ff00u) | (rb & 0x00ff00ffu);
+}
+
+static inline uint32_t
+average2(uint32_t a, uint32_t b)
+{
+    return (((a ^ b) & 0xfefefefeu) >> 1) + (a & b);
+}
+
+static inline int
+sub_abs(uint32_t a, uint32_t b, int shift)
+{
+    int d = (int)((a >> shift) & 0xff) - (int)((b >> shift) & 0xff);
+    return d < 0 ? -d : d;
+}
+
+static inline uint32_t
+select_pixel(uint32_t l, uint32_t t, uint32_t tl)
+{
+    int pl = 0, pt = 0;
+    for (int s = 0; s < 32; s += 8) {
+        pl += sub_abs(t, tl, s);
+        pt += sub_abs(l, tl, s);
+    }
+    return pl < pt ? l : t;
+}
+
+static inline uint32_t
+clamp_add_sub_full(uint32_t a, uint32_t b, uint32_t c)
+{
+    uint32_t r = 0;
+    for (int s = 0; s < 32; s += 8) {
+        int v = (int)((a >> s) & 0xff) + (int)((b >> s) & 0xff) -
+                (int)((c >> s) & 0xff);
+        r |= (uint32_t)clamp(v, 255) << s;
+    }
+    return r;
+}
+
+static inline uint32_t
+clamp_add_sub_half(uint32_t a, uint32_t b)
+{
+    uint32_t r = 0;
+    for (int s = 0; s < 32; s += 8) {
+        int av = (a >> s) & 0xff;
+        int v = av + (av - (int)((b >> s) & 0xff)) / 2;
+        r |= (uint32_t)clamp(v, 255) << s;
+    }
+    return r;
+}
+
+/* top points to the pixel above, top[-1] and top[1] are valid */
+static inline uint32_t
+predict(int mode, uint32_t left, const uint32_t *top)
+{
+    switch (mode) {
+    case 1:
+        return left;
+    case 2:
+        return top[0];
+    case 3:
+        return top[1];
+    case 4:
+        return top[-1];
+    case 5:
+        return average2(average2(left, top[1]), top[0]);
+    case 6:
+        return average2(left, top[-1]);
+    case 7:
+        return average2(left, top[0]);
+    case 8:
+        return average2(top[-1], top[0]);
+    case 9:
+        return average2(top[0], top[1]);
+    case 10:
+        return average2(average2(left, top[-1]), average2(top[0], top[1]));
+    case 11:
+        return select_pixel(left, top[0], top[-1]);
+    case 12:
+        return clamp_add_sub_full(left, top[0], top[-1]);
+    case 13:
+        return clamp_add_sub_half(average2(left, top[0]), top[-1]);
+    default:
+        return 0xff000000;
+    }
+}
+
+static void
+inverse_predictor(const struct vp8l_transform *t, uint32_t *data, int ysize)
+{
+    int w = t->xsize;
+    int bw = DIV_ROUND_UP(w, 1 << t->bits);
+
+    data[0] = add_pixels(data[0], 0xff000000);
+    for (int x = 1; x < w; x++) {
+        data[x] = add_pixels(data[x], data[x - 1]);
+    }
+    for (int y = 1; y < ysize; y++) {
+        uint32_t *row = data + y * w;
+        const uint32_t *top = row - w;
+        const uint32_t *modes = t->data + (y >> t->bits) * bw;
+        row[0] = add_pixels(row[0], top[0]);
+        /* the top right of the last column is the first pixel of this row,
+         * which is exactly what follows in memory
+         */
+        for (int x = 1; x < w; x++) {
+            int mode = (modes[x >> t->bits] >> 8) & 0xf;
+            row[x] = add_pixels(row[x], predict(mode, row[x - 1], top + x));
+        }
+    }
+}
+
+static inline int
+color_delta(int8_t t, int8_t c)
+{
+    return ((int)t * c) >> 5;
+}
+
+static void
+inverse_color(const struct vp8l_transform *t, uint32_t *data, int ysize)
+{
+    int w = t->xsize;
+    int bw = DIV_ROUND_UP(w, 1 << t->bits);
+
+    for (int y = 0; y < ysize; y++) {
+        const uint32_t *m = t->data + (y >> t->bits) * bw;
+        uint32_t *row = data + y * w;
+        for (int x = 0; x < w; x++) {
+            uint32_t e = m[x >> t->bits];
+            uint32_t argb = row[x];
+            int8_t green = (int8_t)(argb >> 8);
+            int r = (argb >> 16) & 0xff;
+            int b = argb & 0xff;
+            r = (r + color_delta((int8_t)e, green)) & 0xff;
+            b = (b + color_delta((int8_t)(e >> 8), green)) & 0xff;
+            b = (b + color_delta((int8_t)(e >> 16), (int8_t)r)) & 0xff;
+            row[x] = (argb & 0xff00ff00u) | ((uint32_t)r << 16) | b;
+        }
+    }
+}
+
+static void
+inverse_subtract_green(uint32_t *data, int num)
+{
+    for (int i = 0; i < num; i++) {
+        uint32_t g = (data[i] >> 8) & 0xff;
+        uint32_t rb = (data[i] & 0x00ff00ffu) + ((g << 16) | g);
+        data[i] = (data[i] & 0xff00ff00u) | (rb & 0x00ff00ffu);
+    }
+}
+
+/* packed indices are expanded in place from the end, every output pixel is
+ * at or behind the packed pixel it is read from
+ */
+static void
+inverse_color_indexing(const struct vp8l_transform *t, uint32_t *data,
+                       int ysize)
+{
+    int w = t->xsize;
+    int pw = DIV_ROUND_UP(w, 1 << t->bits);
+    int bpp = 8 >> t->bits;
+    int xmask = (1 << t->bits) - 1;
+    uint32_t imask = (1 << bpp) - 1;
+
+    for (int y = ysize - 1; y >= 0; y--) {
+        const uint32_t *src = data + y * pw;
+        uint32_t *dst = data + y * w;
+        for (int x = w - 1; x >= 0; x--) {
+            uint32_t packed = (src[x >> t->bits] >> 8) & 0xff;
+            uint32_t idx = (packed >> ((x & xmask) * bpp)) & imask;
+            dst[x] = t->data[idx];
+        }
+    }
+}
+
+static int
+read_transform(struct vp8l_dec *d, int *xsize, int ysize)
+{
+    struct vp8l_br *br = &d->br;
+    int type = br_read(br, 2);
+
+    if (d->seen & (1 << type)) {
+        VERR(vp8l, "transform %d used twice", type);
+        return -1;
+    }
+    d->seen |= 1 << type;
+
+    struct vp8l_transform *t = d->transforms + d->ntransforms++;
+    t->type = type;
+    t->bits = 0;
+    t->xsize = *xsize;
+    t->data = NULL;
+
+    switch (type) {
+    case PREDICTOR_TRANSFORM:
+    case COLOR_TRANSFORM: {
+        t->bits = br_read(br, 3) + 2;
+        int w = DIV_ROUND_UP(*xsize, 1 << t->bits);
+        int h = DIV_ROUND_UP(ysize, 1 << t->bits);
+        t->data = malloc(w * h * sizeof(uint32_t));
+        return decode_image_stream(d, w, h, 0, t->data);
+    }
+    case COLOR_INDEXING_TRANSFORM: {
+        int n = br_read(br, 8) + 1;
+        t->bits = n > 16 ? 0 : n > 4 ? 1 : n > 2 ? 2 : 3;
+        /* indices out of the table give transparent black */
+        t->data = calloc(256, sizeof(uint32_t));
+        if (decode_image_stream(d, n, 1, 0, t->data) < 0) {
+            return -1;
+        }
+        for (int i = 1; i < n; i++) {
+            t->data[i] = add_pixels(t->data[i], t->data[i - 1]);
+        }
+        *xsize = DIV_ROUND_UP(*xsize, 1 << t->bits);
+        return 0;
+    }
+    default:
+        return 0;
+    }
+}
+
+static void
+inverse_transforms(struct vp8l_dec *d, uint32_t *data, int ysize)
+{
+    for (int i = d->ntransforms - 1; i >= 0; i--) {
+        const struct vp8l_transform *t = d->transforms + i;
+        switch (t->type) {
+        case PREDICTOR_TRANSFORM:
+            inverse_predictor(t, data, ysize);
+            break;
+        case COLOR_TRANSFORM:
+            inverse_color(t, data, ysize);
+            break;
+        case SUBTRACT_GREEN_TRANSFORM:
+            inverse_subtract_green(data, t->xsize * ysize);
+            break;
+        case COLOR_INDEXING_TRANSFORM:
+            inverse_color_indexing(t, data, ysize);
+            break;
+        }
+    }
+}
+
+static int
+decode_pixels(struct vp8l_dec *d, uint32_t *data, int w, int h,
+              const struct hgroup *groups, const uint32_t *huff_image,
+              int huff_bits, int cache_bits)
+{
+    struct vp8l_br *br = &d->br;
+    uint32_t *cache = cache_bits ? calloc(1 << cache_bits, sizeof(uint32_t))
+                                 : NULL;
+    int hw = huff_image ? DIV_ROUND_UP(w, 1 << huff_bits) : 0;
+    int mask = huff_image ? (1 << huff_bits) - 1 : 0;
+    const struct hgroup *g = groups;
+    int total = w * h, pos = 0, x = 0, y = 0;
+    int cached = 0; /* pixels before this one are in the color cache */
+    int ret = -1;
+
+    while (pos < total) {
+        if (huff_image && (x & mask) == 0) {
+            g = groups + huff_image[(y >> huff_bits) * hw + (x >> huff_bits)];
+        }
+        int s = huff_read(br, &g->t[GREEN]);
+        if (s < NUM_LITERAL_CODES) {
+            uint32_t r = huff_read(br, &g->t[RED]);
+            uint32_t b = huff_read(br, &g->t[BLUE]);
+            uint32_t a = huff_read(br, &g->t[ALPHA]);
+            data[pos++] = (a << 24) | (r << 16) | ((uint32_t)s << 8) | b;
+            if (++x == w) {
+                x = 0;
+                y++;
+            }
+        } else if (s < NUM_LITERAL_CODES + NUM_LENGTH_CODES) {
+            int len = prefix_value(br, s - NUM_LITERAL_CODES);
+            int dsym = huff_read(br, &g->t[DIST]);
+            int dist = plane_to_distance(w, prefix_value(br, dsym));
+            if (dist > pos || len > total - pos) {
+                VERR(vp8l, "invalid backward reference %d, %d at %d", dist,
+                     len, pos);
+                goto end;
+            }
+            /* may overlap, copy pixel by pixel */
+            for (int i = 0; i < len; i++) {
+                data[pos + i] = data[pos + i - dist];
+            }
+            pos += len;
+            x += len;
+            while (x >= w) {
+                x -= w;
+                y++;
+            }
+            if (huff_image && (x & mask) && pos < total) {
+                g = groups +
+                    huff_image[(y >> huff_bits) * hw + (x >> huff_bits)];
+            }
+        } else {
+            int idx = s - NUM_LITERAL_CODES - NUM_LENGTH_CODES;
+            if (!cache || idx >= (1 << cache_bits)) {
+                VERR(vp8l, "invalid color cache index %d", idx);
+                goto end;
+            }
+            for (; cached < pos; cached++) {
+                uint32_t c = data[cached];
+                cache[(0x1e35a7bdu * c) >> (32 - cache_bits)] = c;
+            }
+            data[pos++] = cache[idx];
+            if (++x == w) {
+                x = 0;
+                y++;
+            }
+        }
+        if (br_eos(br)) {
+            VERR(vp8l, "end of stream at pixel %d", pos);
+            goto end;
+        }
+    }
+    ret = 0;
+end:
+    free(cache);
+    return ret;
+}
+
+/* entropy coded image, the main image (level0) also carries the transforms
+ * and the meta prefix codes
+ */
+static int
+decode_image_stream(struct vp8l_dec *d, int xsize, int ysize, int is_level0,
+                    uint32_t *out)
+{
+    struct vp8l_br *br = &d->br;
+    uint32_t *huff_image = NULL;
+    struct hgroup *groups = NULL;
+    int cache_bits = 0, huff_bits = 0, ngroups = 1;
+    int ret = -1;
+
+    if (is_level0) {
+        while (br_read(br, 1)) {
+            if (read_transform(d, &xsize, ysize) < 0) {
+                return -1;
+            }
+        }
+    }
+    if (br_read(br, 1)) {
+        cache_bits = br_read(br, 4);
+        if (cache_bits < 1 || cache_bits > MAX_CACHE_BITS) {
+            VERR(vp8l, "invalid color cache bits %d", cache_bits);
+            return -1;
+        }
+    }
+    if (is_level0 && br_read(br, 1)) {
+        huff_bits = br_read(br, 3) + 2;
+        int hw = DIV_ROUND_UP(xsize, 1 << huff_bits);
+        int hh = DIV_ROUND_UP(ysize, 1 << huff_bits);
+        huff_image = malloc(hw * hh * sizeof(uint32_t));
+        if (decode_image_stream(d, hw, hh, 0, huff_image) < 0) {
+            goto end;
+        }
+        for (int i = 0; i < hw * hh; i++) {
+            huff_image[i] = (huff_image[i] >> 8) & 0xffff;
+            if ((int)huff_image[i] >= ngroups) {
+                ngroups = huff_image[i] + 1;
+            }
+        }
+    }
+
+    groups = calloc(ngroups, sizeof(struct hgroup));
+    for (int i = 0; i < ngroups; i++) {
+        const int alphabet[HUFF_CODES_PER_GROUP] = {
+            NUM_LITERAL_CODES + NUM_LENGTH_CODES +
+                (cache_bits ? 1 << cache_bits : 0),
+            NUM_LITERAL_CODES, NUM_LITERAL_CODES, NUM_LITERAL_CODES,
+            NUM_DISTANCE_CODES,
+        };
+        for (int j = 0; j < HUFF_CODES_PER_GROUP; j++) {
+            if (read_huffman_code(br, alphabet[j], &groups[i].t[j]) < 0) {
+                VERR(vp8l, "invalid prefix code %d of group %d", j, i);
+                goto end;
+            }
+        }
+    }
+
+    ret = decode_pixels(d, out, xsize, ysize, groups, huff_image, huff_bits,
+                        cache_bits);
+    if (ret == 0 && is_level0) {
+        inverse_transforms(d, out, ysize);
+    }
+end:
+    if (groups) {
+        for (int i = 0; i < ngroups; i++) {
+            for (int j = 0; j < HUFF_CODES_PER_GROUP; j++) {
+                huff_free(&groups[i].t[j]);
+            }
+        }
+        free(groups);
+    }
+    free(huff_image);
+    return ret;
+}
+
+static int
+decode_level0(struct vp8l_br *br, int width, int height, uint32_t *argb)
+{
+    struct vp8l_dec d;
+    memset(&d, 0, sizeof(d));
+    d.br = *br;
+    int ret = decode_image_stream(&d, width, height, 1, argb);
+    for (int i = 0; i < d.ntransforms; i++) {
+        free(d.transforms[i].data);
+    }
+    return ret;
+}
+
+int
+vp8l_decode_stream(const uint8_t *data, int len, int width, int height,
+                   uint32_t *argb)
+{
+    struct vp8l_br br = {
+        .buf = data,
+        .len = len,
+    };
+    return decode_level0(&br, width, height, argb);
+}
+
+int
+vp8l_decode(const uint8_t *data, int len, int *width, int *height,
+            uint32_t **argb)
+{
+    struct vp8l_br br = {
+        .buf = data,
+        .len = len,
+    };
+
+    if (len < 5 || br_read(&br, 8) != VP8L_MAGIC) {
+        VERR(vp8l, "invalid magic value");
+        return -1;
+    }
+    *width = br_read(&br, 14) + 1;
+    *height = br_read(&br, 14) + 1;
+    // alpha_is_used is only a hint, the transforms say what alpha there is
+    br_read(&br, 1);
+    int version = br_read(&br, 3);
+    VDBG(vp8l, "%dx%d, version %d", *width, *height, version);
+    if (version != 0) {
+        VERR(vp8l, "unsupported version %d", version);
+        return -1;
+    }
+    *argb = malloc(*width * *height * sizeof(uint32_t));
+    if (decode_level0(&br, *width, *height, *argb) < 0) {
+        free(*argb);
+        *argb = NULL;
+        return -1;
+    }
+    return 0;
+}
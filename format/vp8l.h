@@ -0,0 +1,38 @@
+#ifndef _VP8L_H_
+#define _VP8L_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/* WebP lossless (VP8L) decoder, pixels are returned as 0xAARRGGBB */
+
+#define VP8L_MAGIC (0x2f)
+
+enum TransformType {
+    PREDICTOR_TRANSFORM = 0,
+    COLOR_TRANSFORM = 1,
+    SUBTRACT_GREEN_TRANSFORM = 2,
+    COLOR_INDEXING_TRANSFORM = 3,
+};
+
+/* decode a VP8L chunk payload starting with the magic byte, *argb is
+ * allocated here and owned by the caller
+ */
+int vp8l_decode(const uint8_t *data, int len, int *width, int *height,
+                uint32_t **argb);
+
+/* decode an image stream without the VP8L header, the size is given by the
+ * container, this is how the ALPH chunk stores compressed alpha.
+ * argb must hold width * height pixels
+ */
+int vp8l_decode_stream(const uint8_t *data, int len, int width, int height,
+                       uint32_t *argb);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*_VP8L_H_*/
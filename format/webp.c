@@ -13,9 +13,10 @@
 #include "utils.h"
 #include "vlog.h"
 #include "webp.h"
-#include "idct.h"
 #include "colorspace.h"
-#include "accl.h"
+#include "vp8dsp.h"
+#include "vp8l.h"
+#include "vp8enc.h"
 
 VLOG_REGISTER(webp, DEBUG)
 
@@ -39,319 +40,6 @@ WEBP_probe(FILE *f)
 }
 
 
-static const uint8_t abs0[255 + 255 + 1] = {
-  0xff, 0xfe, 0xfd, 0xfc, 0xfb, 0xfa, 0xf9, 0xf8, 0xf7, 0xf6, 0xf5, 0xf4,
-  0xf3, 0xf2, 0xf1, 0xf0, 0xef, 0xee, 0xed, 0xec, 0xeb, 0xea, 0xe9, 0xe8,
-  0xe7, 0xe6, 0xe5, 0xe4, 0xe3, 0xe2, 0xe1, 0xe0, 0xdf, 0xde, 0xdd, 0xdc,
-  0xdb, 0xda, 0xd9, 0xd8, 0xd7, 0xd6, 0xd5, 0xd4, 0xd3, 0xd2, 0xd1, 0xd0,
-  0xcf, 0xce, 0xcd, 0xcc, 0xcb, 0xca, 0xc9, 0xc8, 0xc7, 0xc6, 0xc5, 0xc4,
-  0xc3, 0xc2, 0xc1, 0xc0, 0xbf, 0xbe, 0xbd, 0xbc, 0xbb, 0xba, 0xb9, 0xb8,
-  0xb7, 0xb6, 0xb5, 0xb4, 0xb3, 0xb2, 0xb1, 0xb0, 0xaf, 0xae, 0xad, 0xac,
-  0xab, 0xaa, 0xa9, 0xa8, 0xa7, 0xa6, 0xa5, 0xa4, 0xa3, 0xa2, 0xa1, 0xa0,
-  0x9f, 0x9e, 0x9d, 0x9c, 0x9b, 0x9a, 0x99, 0x98, 0x97, 0x96, 0x95, 0x94,
-  0x93, 0x92, 0x91, 0x90, 0x8f, 0x8e, 0x8d, 0x8c, 0x8b, 0x8a, 0x89, 0x88,
-  0x87, 0x86, 0x85, 0x84, 0x83, 0x82, 0x81, 0x80, 0x7f, 0x7e, 0x7d, 0x7c,
-  0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x74, 0x73, 0x72, 0x71, 0x70,
-  0x6f, 0x6e, 0x6d, 0x6c, 0x6b, 0x6a, 0x69, 0x68, 0x67, 0x66, 0x65, 0x64,
-  0x63, 0x62, 0x61, 0x60, 0x5f, 0x5e, 0x5d, 0x5c, 0x5b, 0x5a, 0x59, 0x58,
-  0x57, 0x56, 0x55, 0x54, 0x53, 0x52, 0x51, 0x50, 0x4f, 0x4e, 0x4d, 0x4c,
-  0x4b, 0x4a, 0x49, 0x48, 0x47, 0x46, 0x45, 0x44, 0x43, 0x42, 0x41, 0x40,
-  0x3f, 0x3e, 0x3d, 0x3c, 0x3b, 0x3a, 0x39, 0x38, 0x37, 0x36, 0x35, 0x34,
-  0x33, 0x32, 0x31, 0x30, 0x2f, 0x2e, 0x2d, 0x2c, 0x2b, 0x2a, 0x29, 0x28,
-  0x27, 0x26, 0x25, 0x24, 0x23, 0x22, 0x21, 0x20, 0x1f, 0x1e, 0x1d, 0x1c,
-  0x1b, 0x1a, 0x19, 0x18, 0x17, 0x16, 0x15, 0x14, 0x13, 0x12, 0x11, 0x10,
-  0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06, 0x05, 0x04,
-  0x03, 0x02, 0x01, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
-  0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14,
-  0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20,
-  0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c,
-  0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
-  0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f, 0x40, 0x41, 0x42, 0x43, 0x44,
-  0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
-  0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c,
-  0x5d, 0x5e, 0x5f, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
-  0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74,
-  0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f, 0x80,
-  0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c,
-  0x8d, 0x8e, 0x8f, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98,
-  0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f, 0xa0, 0xa1, 0xa2, 0xa3, 0xa4,
-  0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf, 0xb0,
-  0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xbb, 0xbc,
-  0xbd, 0xbe, 0xbf, 0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8,
-  0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf, 0xd0, 0xd1, 0xd2, 0xd3, 0xd4,
-  0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf, 0xe0,
-  0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0xec,
-  0xed, 0xee, 0xef, 0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8,
-  0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff
-};
-
-static const uint8_t sclip1[1020 + 1020 + 1] = {
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
-  0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f, 0x90, 0x91, 0x92, 0x93,
-  0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
-  0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xab,
-  0xac, 0xad, 0xae, 0xaf, 0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7,
-  0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf, 0xc0, 0xc1, 0xc2, 0xc3,
-  0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
-  0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xdb,
-  0xdc, 0xdd, 0xde, 0xdf, 0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7,
-  0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef, 0xf0, 0xf1, 0xf2, 0xf3,
-  0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff,
-  0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
-  0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
-  0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23,
-  0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
-  0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b,
-  0x3c, 0x3d, 0x3e, 0x3f, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
-  0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53,
-  0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f,
-  0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b,
-  0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
-  0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f
-};
-
-static const uint8_t sclip2[112 + 112 + 1] = {
-  0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-  0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-  0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-  0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-  0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-  0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-  0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-  0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-  0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb,
-  0xfc, 0xfd, 0xfe, 0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
-  0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f
-};
-
-static const uint8_t clip1[255 + 511 + 1] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
-    0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14,
-    0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20,
-    0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c,
-    0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
-    0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f, 0x40, 0x41, 0x42, 0x43, 0x44,
-    0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
-    0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c,
-    0x5d, 0x5e, 0x5f, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
-    0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74,
-    0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f, 0x80,
-    0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c,
-    0x8d, 0x8e, 0x8f, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98,
-    0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f, 0xa0, 0xa1, 0xa2, 0xa3, 0xa4,
-    0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf, 0xb0,
-    0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xbb, 0xbc,
-    0xbd, 0xbe, 0xbf, 0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8,
-    0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf, 0xd0, 0xd1, 0xd2, 0xd3, 0xd4,
-    0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf, 0xe0,
-    0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0xec,
-    0xed, 0xee, 0xef, 0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8,
-    0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
-
-const int8_t* const VP8ksclip1 = (const int8_t*)&sclip1[1020];
-const int8_t* const VP8ksclip2 = (const int8_t*)&sclip2[112];
-const uint8_t* const VP8kclip1 = &clip1[255];
-const uint8_t* const VP8kabs0 = &abs0[255];
-
 
 static void
 read_vp8_segmentation_adjust(struct vp8_update_segmentation *s, struct bool_dec *br)
@@ -384,13 +72,16 @@ read_vp8_segmentation_adjust(struct vp8_update_segmentation *s, struct bool_dec
         }
         if (s->update_mb_segmentation_map) {
             for (int i = 0; i < 3; i ++) {
+                // see 9.3, a prob that is not sent is 255
                 if (BOOL_BIT(br)) {
                     s->segment_prob[i] = BOOL_BITS(br, 8);
+                } else {
+                    s->segment_prob[i] = 255;
                 }
             }
         }
     } else {
-        s->update_mb_segmentation_map = 1;
+        s->update_mb_segmentation_map = 0;
         s->update_segment_feature_data = 0;
     }
 }
@@ -423,38 +114,72 @@ read_mb_lf_adjustments(struct vp8_mb_lf_adjustments *lf, struct bool_dec *br)
 }
 
 static void
-read_token_partition(WEBP *w, struct bool_dec *br, FILE *f)
+read_token_partition(WEBP *w, struct bool_dec *br)
 {
     /* all partions info | partition 1| partition 2 */
     int log2_nbr_of_dct_partitions = BOOL_BITS(br, 2);
-    int num = (1 << log2_nbr_of_dct_partitions) - 1;
-    /*  If the number of data partitions is
-    greater than 1, the size of each partition (except the last) is
-    written in 3 bytes (24 bits).  The size of the last partition is the
-    remainder of the data not used by any of the previous partitions.
-    */
+    w->k.nbr_partitions = 1 << log2_nbr_of_dct_partitions;
+}
 
-    uint8_t size[3 * MAX_PARTI_NUM];
-    if (num) {
-        fread(size, 3, num, f);
+/* If the number of data partitions is greater than 1, the size of each
+ * partition (except the last) is written in 3 bytes (24 bits) right after
+ * the first partition. The size of the last partition is the remainder of
+ * the data not used by any of the previous partitions.
+ * Offsets are relative to the start of the VP8 payload.
+ */
+static int
+read_partition_sizes(WEBP *w, const uint8_t *buf, uint32_t start,
+                     uint32_t size)
+{
+    int num = w->k.nbr_partitions - 1;
+    uint32_t next_part = start + 3 * num;
+    if (next_part > size) {
+        return -1;
     }
-    uint32_t next_part = ftell(f);
     for (int i = 0; i < num; i ++)
     {
-        int partsize = size[i*3] | size[i*3 + 1] << 8 | size[i*3 + 2] << 16;
+        const uint8_t *sz = buf + start + 3 * i;
+        uint32_t partsize = sz[0] | sz[1] << 8 | sz[2] << 16;
         VDBG(webp, "partsize %d", partsize);
+        if (partsize > size - next_part) {
+            return -1;
+        }
         w->p[i].start = next_part;
         w->p[i].len = partsize;
-
-        fseek(f, partsize, SEEK_CUR);
-        next_part = ftell(f);
+        next_part += partsize;
     }
     w->p[num].start = next_part;
-    fseek(f, 0, SEEK_END);
-    w->p[num].len = ftell(f) - next_part; 
-    w->k.nbr_partitions = num + 1;
+    w->p[num].len = size - next_part;
+    return 0;
 }
 
+// from section 14.1 Dequantization
+const uint16_t vp8_dc_qlookup[128] = {
+    4,   5,   6,   7,   8,   9,   10,  10,  11,  12,  13,  14,  15,
+    16,  17,  17,  18,  19,  20,  20,  21,  21,  22,  22,  23,  23,
+    24,  25,  25,  26,  27,  28,  29,  30,  31,  32,  33,  34,  35,
+    36,  37,  37,  38,  39,  40,  41,  42,  43,  44,  45,  46,  46,
+    47,  48,  49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,
+    60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,  71,  72,
+    73,  74,  75,  76,  76,  77,  78,  79,  80,  81,  82,  83,  84,
+    85,  86,  87,  88,  89,  91,  93,  95,  96,  98,  100, 101, 102,
+    104, 106, 108, 110, 112, 114, 116, 118, 122, 124, 126, 128, 130,
+    132, 134, 136, 138, 140, 143, 145, 148, 151, 154, 157,
+};
+
+const uint16_t vp8_ac_qlookup[128] = {
+    4,   5,   6,   7,   8,   9,   10,  11,  12,  13,  14,  15,  16,
+    17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,
+    30,  31,  32,  33,  34,  35,  36,  37,  38,  39,  40,  41,  42,
+    43,  44,  45,  46,  47,  48,  49,  50,  51,  52,  53,  54,  55,
+    56,  57,  58,  60,  62,  64,  66,  68,  70,  72,  74,  76,  78,
+    80,  82,  84,  86,  88,  90,  92,  94,  96,  98,  100, 102, 104,
+    106, 108, 110, 112, 114, 116, 119, 122, 125, 128, 131, 134, 137,
+    140, 143, 146, 149, 152, 155, 158, 161, 164, 167, 170, 173, 177,
+    181, 185, 189, 193, 197, 201, 205, 209, 213, 217, 221, 225, 229,
+    234, 239, 245, 249, 254, 259, 264, 269, 274, 279, 284,
+};
+
 static void read_dequantization(WEBP *w, struct vp8_key_frame_header *kh,
                                 struct bool_dec *br) {
 
@@ -478,32 +203,6 @@ static void read_dequantization(WEBP *w, struct vp8_key_frame_header *kh,
         tables (the tables are given in Section 14).
    */
 
-    // from section 14.1 Dequantization
-    static const uint16_t dc_qlookup[128] = {
-        4,   5,   6,   7,   8,   9,   10,  10,  11,  12,  13,  14,  15,
-        16,  17,  17,  18,  19,  20,  20,  21,  21,  22,  22,  23,  23,
-        24,  25,  25,  26,  27,  28,  29,  30,  31,  32,  33,  34,  35,
-        36,  37,  37,  38,  39,  40,  41,  42,  43,  44,  45,  46,  46,
-        47,  48,  49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,
-        60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,  71,  72,
-        73,  74,  75,  76,  76,  77,  78,  79,  80,  81,  82,  83,  84,
-        85,  86,  87,  88,  89,  91,  93,  95,  96,  98,  100, 101, 102,
-        104, 106, 108, 110, 112, 114, 116, 118, 122, 124, 126, 128, 130,
-        132, 134, 136, 138, 140, 143, 145, 148, 151, 154, 157,
-    };
-
-    static const uint16_t ac_qlookup[128] = {
-        4,   5,   6,   7,   8,   9,   10,  11,  12,  13,  14,  15,  16,
-        17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,
-        30,  31,  32,  33,  34,  35,  36,  37,  38,  39,  40,  41,  42,
-        43,  44,  45,  46,  47,  48,  49,  50,  51,  52,  53,  54,  55,
-        56,  57,  58,  60,  62,  64,  66,  68,  70,  72,  74,  76,  78,
-        80,  82,  84,  86,  88,  90,  92,  94,  96,  98,  100, 102, 104,
-        106, 108, 110, 112, 114, 116, 119, 122, 125, 128, 131, 134, 137,
-        140, 143, 146, 149, 152, 155, 158, 161, 164, 167, 170, 173, 177,
-        181, 185, 189, 193, 197, 201, 205, 209, 213, 217, 221, 225, 229,
-        234, 239, 245, 249, 254, 259, 264, 269, 274, 279, 284,
-    };
     /*
         Lookup values from the above two tables are directly used in the DC
         and AC coefficients in Y1, respectively.  For Y2 and chroma, values
@@ -513,30 +212,32 @@ static void read_dequantization(WEBP *w, struct vp8_key_frame_header *kh,
     // section 20.4 scaling and clamping processes
     // see dequant_init and ac_q and dc_q
     for (int i = 0; i < (w->k.segmentation.segmentation_enabled ? 4 : 1); i++) {
-        uint16_t quant = kh->quant_indice.y_ac_qi;
+        int quant = kh->quant_indice.y_ac_qi;
         if (w->k.segmentation.segmentation_enabled) {
-            if(!w->k.segmentation.update_mb_segmentation_map) {
+            if (!w->k.segmentation.segment_feature_mode) {
                 quant += w->k.segmentation.quant[i].quantizer_update_value;
             } else {
                 quant = w->k.segmentation.quant[i].quantizer_update_value;
             }
         }
-        w->d[i].y1_dc = dc_qlookup[clamp(quant + kh->quant_indice.y_dc_delta, 127)];
-        w->d[i].y1_ac = ac_qlookup[clamp(quant, 127)];
+        // a segment delta may take the index below 0
+        quant = clamp(quant, 127);
+        w->d[i].y1_dc = vp8_dc_qlookup[clamp(quant + kh->quant_indice.y_dc_delta, 127)];
+        w->d[i].y1_ac = vp8_ac_qlookup[clamp(quant, 127)];
 
         w->d[i].y2_dc =
-            dc_qlookup[clamp(quant + kh->quant_indice.y2_dc_delta, 127)] * 2;
+            vp8_dc_qlookup[clamp(quant + kh->quant_indice.y2_dc_delta, 127)] * 2;
         w->d[i].y2_ac =
-            ac_qlookup[clamp(quant + kh->quant_indice.y2_ac_delta, 127)] * 155 /
+            vp8_ac_qlookup[clamp(quant + kh->quant_indice.y2_ac_delta, 127)] * 155 /
             100;
 
         w->d[i].uv_dc =
-            dc_qlookup[clamp(quant + kh->quant_indice.uv_dc_delta, 127)];
+            vp8_dc_qlookup[clamp(quant + kh->quant_indice.uv_dc_delta, 127)];
         w->d[i].uv_ac =
-            ac_qlookup[clamp(quant + kh->quant_indice.uv_ac_delta, 127)];
+            vp8_ac_qlookup[clamp(quant + kh->quant_indice.uv_ac_delta, 127)];
 
-        if (w->d[i].y2_dc > 132) {
-            w->d[i].y2_dc = 132;
+        if (w->d[i].uv_dc > 132) {
+            w->d[i].uv_dc = 132;
         }
         if (w->d[i].y2_ac < 8) {
             w->d[i].y2_ac = 8;
@@ -547,318 +248,319 @@ static void read_dequantization(WEBP *w, struct vp8_key_frame_header *kh,
     }
 }
 
-static void
-read_token_proba_update(struct vp8_key_frame_header *kh, struct bool_dec *br)
+// from Token Probality Updates 13.4
+const uint8_t
+    vp8_coeff_update_probs[NUM_TYPES][NUM_BANDS][NUM_CTX][NUM_PROBAS] = {
+{ { { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+    },
+    { { 176, 246, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 223, 241, 252, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 249, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255 }
+    },
+    { { 255, 244, 252, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 234, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+    },
+    { { 255, 246, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 239, 253, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 254, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255 }
+    },
+    { { 255, 248, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 251, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+    },
+    { { 255, 253, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 251, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 254, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255 }
+    },
+    { { 255, 254, 253, 255, 254, 255, 255, 255, 255, 255, 255 },
+    { 250, 255, 254, 255, 254, 255, 255, 255, 255, 255, 255 },
+    { 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+    },
+    { { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+    }
+},
+{ { { 217, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 225, 252, 241, 253, 255, 255, 254, 255, 255, 255, 255 },
+    { 234, 250, 241, 250, 253, 255, 253, 254, 255, 255, 255 }
+    },
+    { { 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 223, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 238, 253, 254, 254, 255, 255, 255, 255, 255, 255, 255 }
+    },
+    { { 255, 248, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 249, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+    },
+    { { 255, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 247, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+    },
+    { { 255, 253, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+    },
+    { { 255, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+    },
+    { { 255, 254, 253, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 250, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+    },
+    { { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+    }
+},
+{ { { 186, 251, 250, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 234, 251, 244, 254, 255, 255, 255, 255, 255, 255, 255 },
+    { 251, 251, 243, 253, 254, 255, 254, 255, 255, 255, 255 }
+    },
+    { { 255, 253, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 236, 253, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 251, 253, 253, 254, 254, 255, 255, 255, 255, 255, 255 }
+    },
+    { { 255, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+    },
+    { { 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+    },
+    { { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+    },
+    { { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+    },
+    { { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+    },
+    { { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+    }
+},
+{ { { 248, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 250, 254, 252, 254, 255, 255, 255, 255, 255, 255, 255 },
+    { 248, 254, 249, 253, 255, 255, 255, 255, 255, 255, 255 }
+    },
+    { { 255, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 246, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 252, 254, 251, 254, 254, 255, 255, 255, 255, 255, 255 }
+    },
+    { { 255, 254, 252, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 248, 254, 253, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 253, 255, 254, 254, 255, 255, 255, 255, 255, 255, 255 }
+    },
+    { { 255, 251, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 245, 251, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 253, 253, 254, 255, 255, 255, 255, 255, 255, 255, 255 }
+    },
+    { { 255, 251, 253, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 252, 253, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+    },
+    { { 255, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 249, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255 }
+    },
+    { { 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 250, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+    },
+    { { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+    { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+    }
+}
+};
+
+/*   Default Token Probability Table 13.5*/
+const uint8_t vp8_default_coeff_probs[NUM_TYPES][NUM_BANDS][NUM_CTX][NUM_PROBAS] =
 {
-    // from Token Probality Updates 13.4
-    static const uint8_t
-        coeff_update_probs[NUM_TYPES][NUM_BANDS][NUM_CTX][NUM_PROBAS] = {
-    { { { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+    {
+        {
+            { 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128 },
+            { 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128 },
+            { 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128 }
         },
-        { { 176, 246, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 223, 241, 252, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 249, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255 }
+        { 
+            { 253, 136, 254, 255, 228, 219, 128, 128, 128, 128, 128 },
+            { 189, 129, 242, 255, 227, 213, 255, 219, 128, 128, 128 },
+            { 106, 126, 227, 252, 214, 209, 255, 255, 128, 128, 128 }
         },
-        { { 255, 244, 252, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 234, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+        {
+            { 1, 98, 248, 255, 236, 226, 255, 255, 128, 128, 128 },
+            { 181, 133, 238, 254, 221, 234, 255, 154, 128, 128, 128 },
+            { 78, 134, 202, 247, 198, 180, 255, 219, 128, 128, 128 },
         },
-        { { 255, 246, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 239, 253, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 254, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255 }
+        {
+            { 1, 185, 249, 255, 243, 255, 128, 128, 128, 128, 128 },
+            { 184, 150, 247, 255, 236, 224, 128, 128, 128, 128, 128 },
+            { 77, 110, 216, 255, 236, 230, 128, 128, 128, 128, 128 },
         },
-        { { 255, 248, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 251, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+        {
+            { 1, 101, 251, 255, 241, 255, 128, 128, 128, 128, 128 },
+            { 170, 139, 241, 252, 236, 209, 255, 255, 128, 128, 128 },
+            { 37, 116, 196, 243, 228, 255, 255, 255, 128, 128, 128 }
         },
-        { { 255, 253, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 251, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 254, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255 }
+        {
+            { 1, 204, 254, 255, 245, 255, 128, 128, 128, 128, 128 },
+            { 207, 160, 250, 255, 238, 128, 128, 128, 128, 128, 128 },
+            { 102, 103, 231, 255, 211, 171, 128, 128, 128, 128, 128 }
         },
-        { { 255, 254, 253, 255, 254, 255, 255, 255, 255, 255, 255 },
-        { 250, 255, 254, 255, 254, 255, 255, 255, 255, 255, 255 },
-        { 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+        {
+            { 1, 152, 252, 255, 240, 255, 128, 128, 128, 128, 128 },
+            { 177, 135, 243, 255, 234, 225, 128, 128, 128, 128, 128 },
+            { 80, 129, 211, 255, 194, 224, 128, 128, 128, 128, 128 }
         },
-        { { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+        {
+            { 1, 1, 255, 128, 128, 128, 128, 128, 128, 128, 128 },
+            { 246, 1, 255, 128, 128, 128, 128, 128, 128, 128, 128 },
+            { 255, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128 }
         }
     },
-    { { { 217, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 225, 252, 241, 253, 255, 255, 254, 255, 255, 255, 255 },
-        { 234, 250, 241, 250, 253, 255, 253, 254, 255, 255, 255 }
+    {
+        {
+            { 198, 35, 237, 223, 193, 187, 162, 160, 145, 155, 62 },
+            { 131, 45, 198, 221, 172, 176, 220, 157, 252, 221, 1 },
+            { 68, 47, 146, 208, 149, 167, 221, 162, 255, 223, 128 }
         },
-        { { 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 223, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 238, 253, 254, 254, 255, 255, 255, 255, 255, 255, 255 }
+        {
+            { 1, 149, 241, 255, 221, 224, 255, 255, 128, 128, 128 },
+            { 184, 141, 234, 253, 222, 220, 255, 199, 128, 128, 128 },
+            { 81, 99, 181, 242, 176, 190, 249, 202, 255, 255, 128 }
         },
-        { { 255, 248, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 249, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+        {
+            { 1, 129, 232, 253, 214, 197, 242, 196, 255, 255, 128 },
+            { 99, 121, 210, 250, 201, 198, 255, 202, 128, 128, 128 },
+            { 23, 91, 163, 242, 170, 187, 247, 210, 255, 255, 128 }
         },
-        { { 255, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 247, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+        {
+            { 1, 200, 246, 255, 234, 255, 128, 128, 128, 128, 128 },
+            { 109, 178, 241, 255, 231, 245, 255, 255, 128, 128, 128 },
+            { 44, 130, 201, 253, 205, 192, 255, 255, 128, 128, 128 }
         },
-        { { 255, 253, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+        {
+            { 1, 132, 239, 251, 219, 209, 255, 165, 128, 128, 128 },
+            { 94, 136, 225, 251, 218, 190, 255, 255, 128, 128, 128 },
+            { 22, 100, 174, 245, 186, 161, 255, 199, 128, 128, 128 }
         },
-        { { 255, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+        {
+            { 1, 182, 249, 255, 232, 235, 128, 128, 128, 128, 128 },
+            { 124, 143, 241, 255, 227, 234, 128, 128, 128, 128, 128 },
+            { 35, 77, 181, 251, 193, 211, 255, 205, 128, 128, 128 }
         },
-        { { 255, 254, 253, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 250, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+        {
+            { 1, 157, 247, 255, 236, 231, 255, 255, 128, 128, 128 },
+            { 121, 141, 235, 255, 225, 227, 255, 255, 128, 128, 128 },
+            { 45, 99, 188, 251, 195, 217, 255, 224, 128, 128, 128 }
         },
-        { { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+        {
+            { 1, 1, 251, 255, 213, 255, 128, 128, 128, 128, 128 },
+            { 203, 1, 248, 255, 255, 128, 128, 128, 128, 128, 128 },
+            { 137, 1, 177, 255, 224, 255, 128, 128, 128, 128, 128 }
         }
     },
-    { { { 186, 251, 250, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 234, 251, 244, 254, 255, 255, 255, 255, 255, 255, 255 },
-        { 251, 251, 243, 253, 254, 255, 254, 255, 255, 255, 255 }
+    {
+        {
+            { 253, 9, 248, 251, 207, 208, 255, 192, 128, 128, 128 },
+            { 175, 13, 224, 243, 193, 185, 249, 198, 255, 255, 128 },
+            { 73, 17, 171, 221, 161, 179, 236, 167, 255, 234, 128 }
         },
-        { { 255, 253, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 236, 253, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 251, 253, 253, 254, 254, 255, 255, 255, 255, 255, 255 }
+        {
+            { 1, 95, 247, 253, 212, 183, 255, 255, 128, 128, 128 },
+            { 239, 90, 244, 250, 211, 209, 255, 255, 128, 128, 128 },
+            { 155, 77, 195, 248, 188, 195, 255, 255, 128, 128, 128 }
         },
-        { { 255, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+        {
+            { 1, 24, 239, 251, 218, 219, 255, 205, 128, 128, 128 },
+            { 201, 51, 219, 255, 196, 186, 128, 128, 128, 128, 128 },
+            { 69, 46, 190, 239, 201, 218, 255, 228, 128, 128, 128 }
         },
-        { { 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+        {
+            { 1, 191, 251, 255, 255, 128, 128, 128, 128, 128, 128 },
+            { 223, 165, 249, 255, 213, 255, 128, 128, 128, 128, 128 },
+            { 141, 124, 248, 255, 255, 128, 128, 128, 128, 128, 128 }
         },
-        { { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+        {
+            { 1, 16, 248, 255, 255, 128, 128, 128, 128, 128, 128 },
+            { 190, 36, 230, 255, 236, 255, 128, 128, 128, 128, 128 },
+            { 149, 1, 255, 128, 128, 128, 128, 128, 128, 128, 128 }
         },
-        { { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+        {
+            { 1, 226, 255, 128, 128, 128, 128, 128, 128, 128, 128 },
+            { 247, 192, 255, 128, 128, 128, 128, 128, 128, 128, 128 },
+            { 240, 128, 255, 128, 128, 128, 128, 128, 128, 128, 128 }
         },
-        { { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+        {
+            { 1, 134, 252, 255, 255, 128, 128, 128, 128, 128, 128 },
+            { 213, 62, 250, 255, 255, 128, 128, 128, 128, 128, 128 },
+            { 55, 93, 255, 128, 128, 128, 128, 128, 128, 128, 128 }
         },
-        { { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+        {
+            { 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128 },
+            { 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128 },
+            { 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128 }
         }
     },
-    { { { 248, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 250, 254, 252, 254, 255, 255, 255, 255, 255, 255, 255 },
-        { 248, 254, 249, 253, 255, 255, 255, 255, 255, 255, 255 }
-        },
-        { { 255, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 246, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 252, 254, 251, 254, 254, 255, 255, 255, 255, 255, 255 }
-        },
-        { { 255, 254, 252, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 248, 254, 253, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 253, 255, 254, 254, 255, 255, 255, 255, 255, 255, 255 }
-        },
-        { { 255, 251, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 245, 251, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 253, 253, 254, 255, 255, 255, 255, 255, 255, 255, 255 }
+    {
+        {
+            { 202, 24, 213, 235, 186, 191, 220, 160, 240, 175, 255 },
+            { 126, 38, 182, 232, 169, 184, 228, 174, 255, 187, 128 },
+            { 61, 46, 138, 219, 151, 178, 240, 170, 255, 216, 128 }
         },
-        { { 255, 251, 253, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 252, 253, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+        {
+            { 1, 112, 230, 250, 199, 191, 247, 159, 255, 255, 128 },
+            { 166, 109, 228, 252, 211, 215, 255, 174, 128, 128, 128 },
+            { 39, 77, 162, 232, 172, 180, 245, 178, 255, 255, 128 }
         },
-        { { 255, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 249, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255 }
+        {
+            { 1, 52, 220, 246, 198, 199, 249, 220, 255, 255, 128 },
+            { 124, 74, 191, 243, 183, 193, 250, 221, 255, 255, 128 },
+            { 24, 71, 130, 219, 154, 170, 243, 182, 255, 255, 128 }
         },
-        { { 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 250, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
+        {
+            { 1, 182, 225, 249, 219, 240, 255, 224, 128, 128, 128 },
+            { 149, 150, 226, 252, 216, 205, 255, 171, 128, 128, 128 },
+            { 28, 108, 170, 242, 183, 194, 254, 223, 255, 255, 128 }
         },
-        { { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
-        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 }
-        }
-    }
-    };
-
-    /*   Default Token Probability Table 13.5*/
-    static const uint8_t default_coeff_probs[NUM_TYPES][NUM_BANDS][NUM_CTX][NUM_PROBAS] = 
-    {
         {
-            {
-                { 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128 },
-                { 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128 },
-                { 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128 }
-            },
-            { 
-                { 253, 136, 254, 255, 228, 219, 128, 128, 128, 128, 128 },
-                { 189, 129, 242, 255, 227, 213, 255, 219, 128, 128, 128 },
-                { 106, 126, 227, 252, 214, 209, 255, 255, 128, 128, 128 }
-            },
-            {
-                { 1, 98, 248, 255, 236, 226, 255, 255, 128, 128, 128 },
-                { 181, 133, 238, 254, 221, 234, 255, 154, 128, 128, 128 },
-                { 78, 134, 202, 247, 198, 180, 255, 219, 128, 128, 128 },
-            },
-            {
-                { 1, 185, 249, 255, 243, 255, 128, 128, 128, 128, 128 },
-                { 184, 150, 247, 255, 236, 224, 128, 128, 128, 128, 128 },
-                { 77, 110, 216, 255, 236, 230, 128, 128, 128, 128, 128 },
-            },
-            {
-                { 1, 101, 251, 255, 241, 255, 128, 128, 128, 128, 128 },
-                { 170, 139, 241, 252, 236, 209, 255, 255, 128, 128, 128 },
-                { 37, 116, 196, 243, 228, 255, 255, 255, 128, 128, 128 }
-            },
-            {
-                { 1, 204, 254, 255, 245, 255, 128, 128, 128, 128, 128 },
-                { 207, 160, 250, 255, 238, 128, 128, 128, 128, 128, 128 },
-                { 102, 103, 231, 255, 211, 171, 128, 128, 128, 128, 128 }
-            },
-            {
-                { 1, 152, 252, 255, 240, 255, 128, 128, 128, 128, 128 },
-                { 177, 135, 243, 255, 234, 225, 128, 128, 128, 128, 128 },
-                { 80, 129, 211, 255, 194, 224, 128, 128, 128, 128, 128 }
-            },
-            {
-                { 1, 1, 255, 128, 128, 128, 128, 128, 128, 128, 128 },
-                { 246, 1, 255, 128, 128, 128, 128, 128, 128, 128, 128 },
-                { 255, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128 }
-            }
+            { 1, 81, 230, 252, 204, 203, 255, 192, 128, 128, 128 },
+            { 123, 102, 209, 247, 188, 196, 255, 233, 128, 128, 128 },
+            { 20, 95, 153, 243, 164, 173, 255, 203, 128, 128, 128 }
         },
         {
-            {
-                { 198, 35, 237, 223, 193, 187, 162, 160, 145, 155, 62 },
-                { 131, 45, 198, 221, 172, 176, 220, 157, 252, 221, 1 },
-                { 68, 47, 146, 208, 149, 167, 221, 162, 255, 223, 128 }
-            },
-            {
-                { 1, 149, 241, 255, 221, 224, 255, 255, 128, 128, 128 },
-                { 184, 141, 234, 253, 222, 220, 255, 199, 128, 128, 128 },
-                { 81, 99, 181, 242, 176, 190, 249, 202, 255, 255, 128 }
-            },
-            {
-                { 1, 129, 232, 253, 214, 197, 242, 196, 255, 255, 128 },
-                { 99, 121, 210, 250, 201, 198, 255, 202, 128, 128, 128 },
-                { 23, 91, 163, 242, 170, 187, 247, 210, 255, 255, 128 }
-            },
-            {
-                { 1, 200, 246, 255, 234, 255, 128, 128, 128, 128, 128 },
-                { 109, 178, 241, 255, 231, 245, 255, 255, 128, 128, 128 },
-                { 44, 130, 201, 253, 205, 192, 255, 255, 128, 128, 128 }
-            },
-            {
-                { 1, 132, 239, 251, 219, 209, 255, 165, 128, 128, 128 },
-                { 94, 136, 225, 251, 218, 190, 255, 255, 128, 128, 128 },
-                { 22, 100, 174, 245, 186, 161, 255, 199, 128, 128, 128 }
-            },
-            {
-                { 1, 182, 249, 255, 232, 235, 128, 128, 128, 128, 128 },
-                { 124, 143, 241, 255, 227, 234, 128, 128, 128, 128, 128 },
-                { 35, 77, 181, 251, 193, 211, 255, 205, 128, 128, 128 }
-            },
-            {
-                { 1, 157, 247, 255, 236, 231, 255, 255, 128, 128, 128 },
-                { 121, 141, 235, 255, 225, 227, 255, 255, 128, 128, 128 },
-                { 45, 99, 188, 251, 195, 217, 255, 224, 128, 128, 128 }
-            },
-            {
-                { 1, 1, 251, 255, 213, 255, 128, 128, 128, 128, 128 },
-                { 203, 1, 248, 255, 255, 128, 128, 128, 128, 128, 128 },
-                { 137, 1, 177, 255, 224, 255, 128, 128, 128, 128, 128 }
-            }
+            { 1, 222, 248, 255, 216, 213, 128, 128, 128, 128, 128 },
+            { 168, 175, 246, 252, 235, 205, 255, 255, 128, 128, 128 },
+            { 47, 116, 215, 255, 211, 212, 255, 255, 128, 128, 128 }
         },
         {
-            {
-                { 253, 9, 248, 251, 207, 208, 255, 192, 128, 128, 128 },
-                { 175, 13, 224, 243, 193, 185, 249, 198, 255, 255, 128 },
-                { 73, 17, 171, 221, 161, 179, 236, 167, 255, 234, 128 }
-            },
-            {
-                { 1, 95, 247, 253, 212, 183, 255, 255, 128, 128, 128 },
-                { 239, 90, 244, 250, 211, 209, 255, 255, 128, 128, 128 },
-                { 155, 77, 195, 248, 188, 195, 255, 255, 128, 128, 128 }
-            },
-            {
-                { 1, 24, 239, 251, 218, 219, 255, 205, 128, 128, 128 },
-                { 201, 51, 219, 255, 196, 186, 128, 128, 128, 128, 128 },
-                { 69, 46, 190, 239, 201, 218, 255, 228, 128, 128, 128 }
-            },
-            {
-                { 1, 191, 251, 255, 255, 128, 128, 128, 128, 128, 128 },
-                { 223, 165, 249, 255, 213, 255, 128, 128, 128, 128, 128 },
-                { 141, 124, 248, 255, 255, 128, 128, 128, 128, 128, 128 }
-            },
-            {
-                { 1, 16, 248, 255, 255, 128, 128, 128, 128, 128, 128 },
-                { 190, 36, 230, 255, 236, 255, 128, 128, 128, 128, 128 },
-                { 149, 1, 255, 128, 128, 128, 128, 128, 128, 128, 128 }
-            },
-            {
-                { 1, 226, 255, 128, 128, 128, 128, 128, 128, 128, 128 },
-                { 247, 192, 255, 128, 128, 128, 128, 128, 128, 128, 128 },
-                { 240, 128, 255, 128, 128, 128, 128, 128, 128, 128, 128 }
-            },
-            {
-                { 1, 134, 252, 255, 255, 128, 128, 128, 128, 128, 128 },
-                { 213, 62, 250, 255, 255, 128, 128, 128, 128, 128, 128 },
-                { 55, 93, 255, 128, 128, 128, 128, 128, 128, 128, 128 }
-            },
-            {
-                { 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128 },
-                { 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128 },
-                { 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128 }
-            }
+            { 1, 121, 236, 253, 212, 214, 255, 255, 128, 128, 128 },
+            { 141, 84, 213, 252, 201, 202, 255, 219, 128, 128, 128 },
+            { 42, 80, 160, 240, 162, 185, 255, 205, 128, 128, 128 }
         },
         {
-            {
-                { 202, 24, 213, 235, 186, 191, 220, 160, 240, 175, 255 },
-                { 126, 38, 182, 232, 169, 184, 228, 174, 255, 187, 128 },
-                { 61, 46, 138, 219, 151, 178, 240, 170, 255, 216, 128 }
-            },
-            {
-                { 1, 112, 230, 250, 199, 191, 247, 159, 255, 255, 128 },
-                { 166, 109, 228, 252, 211, 215, 255, 174, 128, 128, 128 },
-                { 39, 77, 162, 232, 172, 180, 245, 178, 255, 255, 128 }
-            },
-            {
-                { 1, 52, 220, 246, 198, 199, 249, 220, 255, 255, 128 },
-                { 124, 74, 191, 243, 183, 193, 250, 221, 255, 255, 128 },
-                { 24, 71, 130, 219, 154, 170, 243, 182, 255, 255, 128 }
-            },
-            {
-                { 1, 182, 225, 249, 219, 240, 255, 224, 128, 128, 128 },
-                { 149, 150, 226, 252, 216, 205, 255, 171, 128, 128, 128 },
-                { 28, 108, 170, 242, 183, 194, 254, 223, 255, 255, 128 }
-            },
-            {
-                { 1, 81, 230, 252, 204, 203, 255, 192, 128, 128, 128 },
-                { 123, 102, 209, 247, 188, 196, 255, 233, 128, 128, 128 },
-                { 20, 95, 153, 243, 164, 173, 255, 203, 128, 128, 128 }
-            },
-            {
-                { 1, 222, 248, 255, 216, 213, 128, 128, 128, 128, 128 },
-                { 168, 175, 246, 252, 235, 205, 255, 255, 128, 128, 128 },
-                { 47, 116, 215, 255, 211, 212, 255, 255, 128, 128, 128 }
-            },
-            {
-                { 1, 121, 236, 253, 212, 214, 255, 255, 128, 128, 128 },
-                { 141, 84, 213, 252, 201, 202, 255, 219, 128, 128, 128 },
-                { 42, 80, 160, 240, 162, 185, 255, 205, 128, 128, 128 }
-            },
-            {
-                { 1, 1, 255, 128, 128, 128, 128, 128, 128, 128, 128 },
-                { 244, 1, 255, 128, 128, 128, 128, 128, 128, 128, 128 },
-                { 238, 1, 255, 128, 128, 128, 128, 128, 128, 128, 128 }
-            }
+            { 1, 1, 255, 128, 128, 128, 128, 128, 128, 128, 128 },
+            { 244, 1, 255, 128, 128, 128, 128, 128, 128, 128, 128 },
+            { 238, 1, 255, 128, 128, 128, 128, 128, 128, 128, 128 }
         }
-    };
+    }
+};
+
+static void
+read_token_proba_update(struct vp8_key_frame_header *kh, struct bool_dec *br)
+{
 
     kh->refresh_entropy_probs = BOOL_BIT(br);
     /*if not keyframe 9.7, 9.8,
@@ -882,10 +584,10 @@ read_token_proba_update(struct vp8_key_frame_header *kh, struct bool_dec *br)
         for (int j = 0; j < NUM_BANDS ; j ++) {
             for (int k = 0; k < NUM_CTX; k ++) {
                 for (int l = 0; l < NUM_PROBAS; l ++) {
-                    if (BOOL_DECODE(br, coeff_update_probs[i][j][k][l])) {
+                    if (BOOL_DECODE(br, vp8_coeff_update_probs[i][j][k][l])) {
                         kh->coeff_prob[i][j].probas[k][l] = BOOL_BITS(br, 8);
                     } else {
-                        kh->coeff_prob[i][j].probas[k][l] = default_coeff_probs[i][j][k][l];
+                        kh->coeff_prob[i][j].probas[k][l] = vp8_default_coeff_probs[i][j][k][l];
                     }
                 }
             }
@@ -894,7 +596,7 @@ read_token_proba_update(struct vp8_key_frame_header *kh, struct bool_dec *br)
 }
 
 static void
-read_vp8_ctl_partition(WEBP *w, struct bool_dec *br, FILE *f)
+read_vp8_ctl_partition(WEBP *w, struct bool_dec *br)
 {
     // int width = ((w->fi.width + 3) >> 2) << 2;
     // int height = w->fi.height;
@@ -918,7 +620,7 @@ read_vp8_ctl_partition(WEBP *w, struct bool_dec *br, FILE *f)
     read_mb_lf_adjustments(&w->k.mb_lf_adjustments, br);
 
     /*Token Partition and Partition Data Offsets 9.5*/
-    read_token_partition(w, br, f);
+    read_token_partition(w, br);
 
     /* READ Dequantization Indices 9.6 */
     read_dequantization(w, &w->k, br);
@@ -954,22 +656,38 @@ typedef enum {
 
 /**
  * The function DCTextra performs a bitwise operation on a series of boolean values and returns the
- * result as a uint8_t.
+ * result as an int.
  * 
  * @param bt The parameter "bt" is a pointer to a boolean decoder object. It is used to decode boolean
  * values from a bitstream.
  * @param p The parameter `p` is a pointer to an array of `uint8_t` values.
  * 
- * @return a value of type `uint8_t`.
+ * @return a value of type `int`, the cat6 extra bits take 11 bits.
  */
-uint8_t DCTextra(bool_dec *bt, const uint8_t *p) {
-    uint8_t v = 0;
+int DCTextra(bool_dec *bt, const uint8_t *p) {
+    int v = 0;
     do {
         v += v + BOOL_DECODE(bt, *p);
     } while (*++p);
     return v;
 }
 
+/* pCatn specify ranges of unsigned values whose width is
+ * 1, 2, 3, 4, 5, or 11 bits, respectively.
+ */
+static const uint8_t pCat1[] = {159, 0};
+static const uint8_t pCat2[] = {165, 145, 0};
+static const uint8_t pCat3[] = {173, 148, 140, 0};
+static const uint8_t pCat4[] = {176, 155, 140, 135, 0};
+static const uint8_t pCat5[] = {180, 157, 141, 134, 130, 0};
+static const uint8_t pCat6[] = {254, 254, 243, 230, 196, 177,
+                                153, 140, 133, 130, 129, 0};
+
+const uint8_t *const vp8_pcat[6] = {pCat1, pCat2, pCat3, pCat4, pCat5, pCat6};
+
+const uint8_t vp8_zigzag[16] = {0, 1,  4,  8,  5, 2,  3,  6,
+                                 9, 12, 13, 10, 7, 11, 14, 15};
+
 /**
  * The function `vp8_get_coefficients` decodes coefficients for a VP8 video frame.
  * 
@@ -997,21 +715,6 @@ static int vp8_get_coefficients(struct bool_dec *bt, int16_t *out,
     int token = 0;
     int absValue = 0;
     static int categoryBase[6] = {5, 7, 11, 19, 35, 67};
-    /* pCatn specify ranges of unsigned values whose width is
-     * 1, 2, 3, 4, 5, or 11 bits, respectively.
-     */
-    static const uint8_t pCat1[] = {159, 0};
-    static const uint8_t pCat2[] = {165, 145, 0};
-    static const uint8_t pCat3[] = {173, 148, 140, 0};
-    static const uint8_t pCat4[] = {176, 155, 140, 135, 0};
-    static const uint8_t pCat5[] = {180, 157, 141, 134, 130, 0};
-    static const uint8_t pCat6[] = {254, 254, 243, 230, 196, 177,
-                                    153, 140, 133, 130, 129, 0};
-
-    static const uint8_t *pCat[] = {pCat1, pCat2, pCat3, pCat4, pCat5, pCat6};
-
-    static const uint8_t kZigzag[16] = {0, 1,  4,  8,  5, 2,  3,  6,
-                                        9, 12, 13, 10, 7, 11, 14, 15};
 
     static const int8_t coeff_tree[2 * (num_dct_tokens - 1)] = {
         -dct_eob,  2, /* eob = "0"   */
@@ -1041,7 +744,7 @@ static int vp8_get_coefficients(struct bool_dec *bt, int16_t *out,
             prevCoeffWasZero = true;
             absValue = 0;
         } else if (token > DCT_4) {
-            int extraBits = DCTextra(bt, pCat[token - dct_cat1]);
+            int extraBits = DCTextra(bt, vp8_pcat[token - dct_cat1]);
             // VDBG(webp, "extra %d", token);
             absValue = categoryBase[token - dct_cat1] + extraBits;
             prevCoeffWasZero = false;
@@ -1058,43 +761,11 @@ static int vp8_get_coefficients(struct bool_dec *bt, int16_t *out,
             }
         }
         /* 4X4 block zigzag values */
-        out[kZigzag[n]] = absValue * (n > 0 ? quant_ac : quant_dc);
+        out[vp8_zigzag[n]] = absValue * (n > 0 ? quant_ac : quant_dc);
     }
     return 16;
 }
 
-//in out for 4*4, but make it fast to 0, 16, 32,.. for out
-static void IWHT_long(const int16_t* in, int16_t* out)
-{
-    int tmp[16];
-    int i;
-    for (i = 0; i < 4; ++i) {
-        const int a0 = in[0 + i] + in[12 + i];
-        const int a1 = in[4 + i] + in[ 8 + i];
-        const int a2 = in[4 + i] - in[ 8 + i];
-        const int a3 = in[0 + i] - in[12 + i];
-        tmp[0  + i] = a0 + a1;
-        tmp[8  + i] = a0 - a1;
-        tmp[4  + i] = a3 + a2;
-        tmp[12 + i] = a3 - a2;
-    }
-    // pass two
-    for (i = 0; i < 4; ++i) {
-        const int a0 = tmp[0 + i * 4] + tmp[3 + i * 4];
-        const int a1 = tmp[1 + i * 4] + tmp[2 + i * 4];
-        const int a2 = tmp[1 + i * 4] - tmp[2 + i * 4];
-        const int a3 = tmp[0 + i * 4] - tmp[3 + i * 4];
-        // out[4 * i + 0] = (a0 + a1 + 3) >> 3;
-        // out[4 * i + 1] = (a3 + a2 + 3) >> 3;
-        // out[4 * i + 2] = (a0 - a1 + 3) >> 3;
-        // out[4 * i + 3] = (a3 - a2 + 3) >> 3;
-        out[64 * i ] = (a0 + a1 + 3) >> 3;
-        out[64 * i + 16] = (a3 + a2 + 3) >> 3;
-        out[64 * i + 32] = (a0 - a1 + 3) >> 3;
-        out[64 * i + 48] = (a3 - a2 + 3) >> 3;
-    }
-}
-
 static void IWHT_fast(int16_t *input, int16_t *output) {
     int i;
     int16_t *op = output;
@@ -1109,6 +780,9 @@ struct context {
     int ctx[9];
 };
 
+const uint8_t vp8_coeff_bands[16] = {0, 1, 2, 3, 6, 4, 5, 6,
+                                     6, 6, 6, 6, 6, 6, 6, 7};
+
 /**
  * The function `vp8_decode_residual_block` decodes the residual block of a VP8 video frame.
  * 
@@ -1126,22 +800,18 @@ static int vp8_decode_residual_block(WEBP *w, struct macro_block *block,
                                      int16_t *dst, struct context *left,
                                      struct context *top, bool_dec *bt) {
 
-    static const int coeff_bands[16] = {0, 1, 2, 3, 6, 4, 5, 6,
-                                 6, 6, 6, 6, 6, 6, 6, 7};
 
     const VP8BandProbas *bands[NUM_TYPES][16];
 
     struct WEBP_decoder *d = &w->d[block->segment_id];
 
-    struct accl_ops* ops = accl_find(SIMD_TYPE_SSE2);
-    const struct dct_ops *dct = get_dct_ops(16);
-
     int firstCoeff;
     const VP8BandProbas* const * ac_proba;
+    uint32_t non_zero_y = 0, non_zero_uv = 0;
 
     for (int t = 0; t < NUM_TYPES; ++t) {
         for (int b = 0; b < 16; ++b) {
-            bands[t][b] = &w->k.coeff_prob[t][coeff_bands[b]];
+            bands[t][b] = &w->k.coeff_prob[t][vp8_coeff_bands[b]];
         }
     }
     // Y2, 0-16 to 0, 16, 32, 48, 64, ...
@@ -1152,7 +822,7 @@ static int vp8_decode_residual_block(WEBP *w, struct macro_block *block,
         top[block->x].ctx[0] = left->ctx[0] = ((nz > 0) ? 1 : 0);
 
         if (nz > 1) {   // more than just the DC
-            IWHT_long(dc, dst);
+            vp8_dsp_get()->transform_wht(dc, dst);
         } else {        // only DC is non-zero
             IWHT_fast(dc, dst);
         }
@@ -1169,9 +839,7 @@ static int vp8_decode_residual_block(WEBP *w, struct macro_block *block,
         for (int x = 0; x < 4; ++x) {
             int ctx = top[block->x].ctx[x + 1] + l;
             const int nz = vp8_get_coefficients(bt, dst, ac_proba, firstCoeff, ctx, d->y1_dc, d->y1_ac);
-            if (nz > 1 || dst[0] != 0) {
-                ops ? ops->idct_4x4(dst, 8) : dct->idct_4x4(dst, 8);
-            }
+            non_zero_y |= (uint32_t)VP8_NZ_CODE(nz + firstCoeff, dst[0]) << (2 * (y * 4 + x));
             dst += 16;
             l = top[block->x].ctx[x+1] = (nz > 0 ? 1 : 0);
         }
@@ -1185,15 +853,15 @@ static int vp8_decode_residual_block(WEBP *w, struct macro_block *block,
             for (int x = 0; x < 2; ++x) {
                 int ctx = l + top[block->x].ctx[x + ch];
                 const int nz = vp8_get_coefficients(bt, dst, bands[2], 0, ctx, d->uv_dc, d->uv_ac);
-                if (nz > 1 || dst[0] != 0) {
-                    ops ? ops->idct_4x4(dst, 8) : dct->idct_4x4(dst, 8);
-                }
+                non_zero_uv |= (uint32_t)VP8_NZ_CODE(nz, dst[0]) << (2 * ((ch - 5) * 2 + y * 2 + x));
                 dst += 16;
                 l = top[block->x].ctx[x+ch] = (nz > 0) ? 1: 0;
             }
             left->ctx[y+ch] = l;
         }
     }
+    block->non_zero_y = non_zero_y;
+    block->non_zero_uv = non_zero_uv;
 
     return 0;
 }
@@ -1219,6 +887,8 @@ static int vp8_decode_residual_data(WEBP *w, struct macro_block *block,
                 left->ctx[i] = 0;
                 top[block->x].ctx[i] = 0;
             }
+            block->non_zero_y = 0;
+            block->non_zero_uv = 0;
             block->dither = 0;
     }
     return 0;
@@ -1273,6 +943,138 @@ left_block_mode(const struct macro_block *this,
     return this->imodes[b - 1];
 }
 
+const int8_t vp8_kf_ymode_tree[8] = {
+    -B_PRED, 2,         /* root: B_PRED = "0", "1" subtree */
+    4, 6,               /* "1" subtree has 2 descendant subtrees */
+    -DC_PRED, -V_PRED,  /* "10" subtree: DC_PRED = "100",
+                                                V_PRED = "101" */
+    -H_PRED, -TM_PRED   /* "11" subtree: H_PRED = "110",
+                                               TM_PRED = "111" */
+};
+const uint8_t vp8_kf_bmode_prob[NUM_BMODES][NUM_BMODES][NUM_BMODES - 1] =
+    {{{231, 120, 48, 89, 115, 113, 120, 152, 112},
+      {152, 179, 64, 126, 170, 118, 46, 70, 95},
+      {175, 69, 143, 80, 85, 82, 72, 155, 103},
+      {56, 58, 10, 171, 218, 189, 17, 13, 152},
+      {114, 26, 17, 163, 44, 195, 21, 10, 173},
+      {121, 24, 80, 195, 26, 62, 44, 64, 85},
+      {144, 71, 10, 38, 171, 213, 144, 34, 26},
+      {170, 46, 55, 19, 136, 160, 33, 206, 71},
+      {63, 20, 8, 114, 114, 208, 12, 9, 226},
+      {81, 40, 11, 96, 182, 84, 29, 16, 36}},
+     {{134, 183, 89, 137, 98, 101, 106, 165, 148},
+      {72, 187, 100, 130, 157, 111, 32, 75, 80},
+      {66, 102, 167, 99, 74, 62, 40, 234, 128},
+      {41, 53, 9, 178, 241, 141, 26, 8, 107},
+      {74, 43, 26, 146, 73, 166, 49, 23, 157},
+      {65, 38, 105, 160, 51, 52, 31, 115, 128},
+      {104, 79, 12, 27, 217, 255, 87, 17, 7},
+      {87, 68, 71, 44, 114, 51, 15, 186, 23},
+      {47, 41, 14, 110, 182, 183, 21, 17, 194},
+      {66, 45, 25, 102, 197, 189, 23, 18, 22}},
+     {{88, 88, 147, 150, 42, 46, 45, 196, 205},
+      {43, 97, 183, 117, 85, 38, 35, 179, 61},
+      {39, 53, 200, 87, 26, 21, 43, 232, 171},
+      {56, 34, 51, 104, 114, 102, 29, 93, 77},
+      {39, 28, 85, 171, 58, 165, 90, 98, 64},
+      {34, 22, 116, 206, 23, 34, 43, 166, 73},
+      {107, 54, 32, 26, 51, 1, 81, 43, 31},
+      {68, 25, 106, 22, 64, 171, 36, 225, 114},
+      {34, 19, 21, 102, 132, 188, 16, 76, 124},
+      {62, 18, 78, 95, 85, 57, 50, 48, 51}},
+     {{193, 101, 35, 159, 215, 111, 89, 46, 111},
+      {60, 148, 31, 172, 219, 228, 21, 18, 111},
+      {112, 113, 77, 85, 179, 255, 38, 120, 114},
+      {40, 42, 1, 196, 245, 209, 10, 25, 109},
+      {88, 43, 29, 140, 166, 213, 37, 43, 154},
+      {61, 63, 30, 155, 67, 45, 68, 1, 209},
+      {100, 80, 8, 43, 154, 1, 51, 26, 71},
+      {142, 78, 78, 16, 255, 128, 34, 197, 171},
+      {41, 40, 5, 102, 211, 183, 4, 1, 221},
+      {51, 50, 17, 168, 209, 192, 23, 25, 82}},
+     {{138, 31, 36, 171, 27, 166, 38, 44, 229},
+      {67, 87, 58, 169, 82, 115, 26, 59, 179},
+      {63, 59, 90, 180, 59, 166, 93, 73, 154},
+      {40, 40, 21, 116, 143, 209, 34, 39, 175},
+      {47, 15, 16, 183, 34, 223, 49, 45, 183},
+      {46, 17, 33, 183, 6, 98, 15, 32, 183},
+      {57, 46, 22, 24, 128, 1, 54, 17, 37},
+      {65, 32, 73, 115, 28, 128, 23, 128, 205},
+      {40, 3, 9, 115, 51, 192, 18, 6, 223},
+      {87, 37, 9, 115, 59, 77, 64, 21, 47}},
+     {{104, 55, 44, 218, 9, 54, 53, 130, 226},
+      {64, 90, 70, 205, 40, 41, 23, 26, 57},
+      {54, 57, 112, 184, 5, 41, 38, 166, 213},
+      {30, 34, 26, 133, 152, 116, 10, 32, 134},
+      {39, 19, 53, 221, 26, 114, 32, 73, 255},
+      {31, 9, 65, 234, 2, 15, 1, 118, 73},
+      {75, 32, 12, 51, 192, 255, 160, 43, 51},
+      {88, 31, 35, 67, 102, 85, 55, 186, 85},
+      {56, 21, 23, 111, 59, 205, 45, 37, 192},
+      {55, 38, 70, 124, 73, 102, 1, 34, 98}},
+     {{125, 98, 42, 88, 104, 85, 117, 175, 82},
+      {95, 84, 53, 89, 128, 100, 113, 101, 45},
+      {75, 79, 123, 47, 51, 128, 81, 171, 1},
+      {57, 17, 5, 71, 102, 57, 53, 41, 49},
+      {38, 33, 13, 121, 57, 73, 26, 1, 85},
+      {41, 10, 67, 138, 77, 110, 90, 47, 114},
+      {115, 21, 2, 10, 102, 255, 166, 23, 6},
+      {101, 29, 16, 10, 85, 128, 101, 196, 26},
+      {57, 18, 10, 102, 102, 213, 34, 20, 43},
+      {117, 20, 15, 36, 163, 128, 68, 1, 26}},
+     {{102, 61, 71, 37, 34, 53, 31, 243, 192},
+      {69, 60, 71, 38, 73, 119, 28, 222, 37},
+      {68, 45, 128, 34, 1, 47, 11, 245, 171},
+      {62, 17, 19, 70, 146, 85, 55, 62, 70},
+      {37, 43, 37, 154, 100, 163, 85, 160, 1},
+      {63, 9, 92, 136, 28, 64, 32, 201, 85},
+      {75, 15, 9, 9, 64, 255, 184, 119, 16},
+      {86, 6, 28, 5, 64, 255, 25, 248, 1},
+      {56, 8, 17, 132, 137, 255, 55, 116, 128},
+      {58, 15, 20, 82, 135, 57, 26, 121, 40}},
+     {{164, 50, 31, 137, 154, 133, 25, 35, 218},
+      {51, 103, 44, 131, 131, 123, 31, 6, 158},
+      {86, 40, 64, 135, 148, 224, 45, 183, 128},
+      {22, 26, 17, 131, 240, 154, 14, 1, 209},
+      {45, 16, 21, 91, 64, 222, 7, 1, 197},
+      {56, 21, 39, 155, 60, 138, 23, 102, 213},
+      {83, 12, 13, 54, 192, 255, 68, 47, 28},
+      {85, 26, 85, 85, 128, 128, 32, 146, 171},
+      {18, 11, 7, 63, 144, 171, 4, 4, 246},
+      {35, 27, 10, 146, 174, 171, 12, 26, 128}},
+     {{190, 80, 35, 99, 180, 80, 126, 54, 45},
+      {85, 126, 47, 87, 176, 51, 41, 20, 32},
+      {101, 75, 128, 139, 118, 146, 116, 128, 85},
+      {56, 41, 15, 176, 236, 85, 37, 9, 62},
+      {71, 30, 17, 119, 118, 255, 17, 18, 138},
+      {101, 38, 60, 138, 55, 70, 43, 26, 142},
+      {146, 36, 19, 30, 171, 255, 97, 27, 20},
+      {138, 45, 61, 62, 219, 1, 81, 188, 64},
+      {32, 41, 20, 117, 151, 142, 20, 21, 163},
+      {112, 19, 12, 61, 195, 128, 48, 4, 24}}};
+
+const int8_t vp8_bmode_tree[18] = {
+    -B_DC_PRED, 2,                          /* B_DC_PRED = "0" */
+    -B_TM_PRED, 4,                          /* B_TM_PRED = "10" */
+    -B_VE_PRED, 6,                          /* B_VE_PRED = "110" */
+    8,          12,         -B_HE_PRED, 10, /* B_HE_PRED = "11100" */
+    -B_RD_PRED, -B_VR_PRED,                 /* B_RD_PRED = "111010",
+                                                         B_VR_PRED = "111011" */
+    -B_LD_PRED, 14,                         /* B_LD_PRED = "111110" */
+    -B_VL_PRED, 16,                         /* B_VL_PRED = "1111110" */
+    -B_HD_PRED, -B_HU_PRED                  /* HD = "11111110",
+                                                         HU = "11111111" */
+};
+const uint8_t vp8_kf_ymode_prob[4] = {145, 156, 163, 128};
+
+const int8_t vp8_uv_mode_tree[6] = {
+    -DC_PRED, 2,      /* root: DC_PRED = "0", "1" subtree */
+    -V_PRED, 4,       /* "1" subtree:  V_PRED = "10", "11" subtree */
+    -H_PRED, -TM_PRED /* "11" subtree: H_PRED = "110",
+                                               TM_PRED = "111" */
+};
+const uint8_t vp8_kf_uv_mode_prob[3] = {142, 114, 183};
+
 static void
 vp8_decode_mb_header(WEBP *w, bool_dec *bt, struct macro_block *mb, int y, int x)
 {
@@ -1301,130 +1103,7 @@ vp8_decode_mb_header(WEBP *w, bool_dec *bt, struct macro_block *mb, int y, int x
 
     // we have key frame only, is_inter_mb = 1
     // see section 11.2 or decode_kf_mb_mode
-    static const int8_t kf_ymode_tree[8] = {
-        -B_PRED, 2,         /* root: B_PRED = "0", "1" subtree */
-        4, 6,               /* "1" subtree has 2 descendant subtrees */
-        -DC_PRED, -V_PRED,  /* "10" subtree: DC_PRED = "100",
-                                                    V_PRED = "101" */
-        -H_PRED, -TM_PRED   /* "11" subtree: H_PRED = "110",
-                                                   TM_PRED = "111" */
-    };
-    static const uint8_t kf_bmode_prob[NUM_BMODES][NUM_BMODES][NUM_BMODES - 1] =
-        {{{231, 120, 48, 89, 115, 113, 120, 152, 112},
-          {152, 179, 64, 126, 170, 118, 46, 70, 95},
-          {175, 69, 143, 80, 85, 82, 72, 155, 103},
-          {56, 58, 10, 171, 218, 189, 17, 13, 152},
-          {114, 26, 17, 163, 44, 195, 21, 10, 173},
-          {121, 24, 80, 195, 26, 62, 44, 64, 85},
-          {144, 71, 10, 38, 171, 213, 144, 34, 26},
-          {170, 46, 55, 19, 136, 160, 33, 206, 71},
-          {63, 20, 8, 114, 114, 208, 12, 9, 226},
-          {81, 40, 11, 96, 182, 84, 29, 16, 36}},
-         {{134, 183, 89, 137, 98, 101, 106, 165, 148},
-          {72, 187, 100, 130, 157, 111, 32, 75, 80},
-          {66, 102, 167, 99, 74, 62, 40, 234, 128},
-          {41, 53, 9, 178, 241, 141, 26, 8, 107},
-          {74, 43, 26, 146, 73, 166, 49, 23, 157},
-          {65, 38, 105, 160, 51, 52, 31, 115, 128},
-          {104, 79, 12, 27, 217, 255, 87, 17, 7},
-          {87, 68, 71, 44, 114, 51, 15, 186, 23},
-          {47, 41, 14, 110, 182, 183, 21, 17, 194},
-          {66, 45, 25, 102, 197, 189, 23, 18, 22}},
-         {{88, 88, 147, 150, 42, 46, 45, 196, 205},
-          {43, 97, 183, 117, 85, 38, 35, 179, 61},
-          {39, 53, 200, 87, 26, 21, 43, 232, 171},
-          {56, 34, 51, 104, 114, 102, 29, 93, 77},
-          {39, 28, 85, 171, 58, 165, 90, 98, 64},
-          {34, 22, 116, 206, 23, 34, 43, 166, 73},
-          {107, 54, 32, 26, 51, 1, 81, 43, 31},
-          {68, 25, 106, 22, 64, 171, 36, 225, 114},
-          {34, 19, 21, 102, 132, 188, 16, 76, 124},
-          {62, 18, 78, 95, 85, 57, 50, 48, 51}},
-         {{193, 101, 35, 159, 215, 111, 89, 46, 111},
-          {60, 148, 31, 172, 219, 228, 21, 18, 111},
-          {112, 113, 77, 85, 179, 255, 38, 120, 114},
-          {40, 42, 1, 196, 245, 209, 10, 25, 109},
-          {88, 43, 29, 140, 166, 213, 37, 43, 154},
-          {61, 63, 30, 155, 67, 45, 68, 1, 209},
-          {100, 80, 8, 43, 154, 1, 51, 26, 71},
-          {142, 78, 78, 16, 255, 128, 34, 197, 171},
-          {41, 40, 5, 102, 211, 183, 4, 1, 221},
-          {51, 50, 17, 168, 209, 192, 23, 25, 82}},
-         {{138, 31, 36, 171, 27, 166, 38, 44, 229},
-          {67, 87, 58, 169, 82, 115, 26, 59, 179},
-          {63, 59, 90, 180, 59, 166, 93, 73, 154},
-          {40, 40, 21, 116, 143, 209, 34, 39, 175},
-          {47, 15, 16, 183, 34, 223, 49, 45, 183},
-          {46, 17, 33, 183, 6, 98, 15, 32, 183},
-          {57, 46, 22, 24, 128, 1, 54, 17, 37},
-          {65, 32, 73, 115, 28, 128, 23, 128, 205},
-          {40, 3, 9, 115, 51, 192, 18, 6, 223},
-          {87, 37, 9, 115, 59, 77, 64, 21, 47}},
-         {{104, 55, 44, 218, 9, 54, 53, 130, 226},
-          {64, 90, 70, 205, 40, 41, 23, 26, 57},
-          {54, 57, 112, 184, 5, 41, 38, 166, 213},
-          {30, 34, 26, 133, 152, 116, 10, 32, 134},
-          {39, 19, 53, 221, 26, 114, 32, 73, 255},
-          {31, 9, 65, 234, 2, 15, 1, 118, 73},
-          {75, 32, 12, 51, 192, 255, 160, 43, 51},
-          {88, 31, 35, 67, 102, 85, 55, 186, 85},
-          {56, 21, 23, 111, 59, 205, 45, 37, 192},
-          {55, 38, 70, 124, 73, 102, 1, 34, 98}},
-         {{125, 98, 42, 88, 104, 85, 117, 175, 82},
-          {95, 84, 53, 89, 128, 100, 113, 101, 45},
-          {75, 79, 123, 47, 51, 128, 81, 171, 1},
-          {57, 17, 5, 71, 102, 57, 53, 41, 49},
-          {38, 33, 13, 121, 57, 73, 26, 1, 85},
-          {41, 10, 67, 138, 77, 110, 90, 47, 114},
-          {115, 21, 2, 10, 102, 255, 166, 23, 6},
-          {101, 29, 16, 10, 85, 128, 101, 196, 26},
-          {57, 18, 10, 102, 102, 213, 34, 20, 43},
-          {117, 20, 15, 36, 163, 128, 68, 1, 26}},
-         {{102, 61, 71, 37, 34, 53, 31, 243, 192},
-          {69, 60, 71, 38, 73, 119, 28, 222, 37},
-          {68, 45, 128, 34, 1, 47, 11, 245, 171},
-          {62, 17, 19, 70, 146, 85, 55, 62, 70},
-          {37, 43, 37, 154, 100, 163, 85, 160, 1},
-          {63, 9, 92, 136, 28, 64, 32, 201, 85},
-          {75, 15, 9, 9, 64, 255, 184, 119, 16},
-          {86, 6, 28, 5, 64, 255, 25, 248, 1},
-          {56, 8, 17, 132, 137, 255, 55, 116, 128},
-          {58, 15, 20, 82, 135, 57, 26, 121, 40}},
-         {{164, 50, 31, 137, 154, 133, 25, 35, 218},
-          {51, 103, 44, 131, 131, 123, 31, 6, 158},
-          {86, 40, 64, 135, 148, 224, 45, 183, 128},
-          {22, 26, 17, 131, 240, 154, 14, 1, 209},
-          {45, 16, 21, 91, 64, 222, 7, 1, 197},
-          {56, 21, 39, 155, 60, 138, 23, 102, 213},
-          {83, 12, 13, 54, 192, 255, 68, 47, 28},
-          {85, 26, 85, 85, 128, 128, 32, 146, 171},
-          {18, 11, 7, 63, 144, 171, 4, 4, 246},
-          {35, 27, 10, 146, 174, 171, 12, 26, 128}},
-         {{190, 80, 35, 99, 180, 80, 126, 54, 45},
-          {85, 126, 47, 87, 176, 51, 41, 20, 32},
-          {101, 75, 128, 139, 118, 146, 116, 128, 85},
-          {56, 41, 15, 176, 236, 85, 37, 9, 62},
-          {71, 30, 17, 119, 118, 255, 17, 18, 138},
-          {101, 38, 60, 138, 55, 70, 43, 26, 142},
-          {146, 36, 19, 30, 171, 255, 97, 27, 20},
-          {138, 45, 61, 62, 219, 1, 81, 188, 64},
-          {32, 41, 20, 117, 151, 142, 20, 21, 163},
-          {112, 19, 12, 61, 195, 128, 48, 4, 24}}};
-
-    static const int8_t bmode_tree[18] = {
-        -B_DC_PRED, 2,                          /* B_DC_PRED = "0" */
-        -B_TM_PRED, 4,                          /* B_TM_PRED = "10" */
-        -B_VE_PRED, 6,                          /* B_VE_PRED = "110" */
-        8,          12,         -B_HE_PRED, 10, /* B_HE_PRED = "11100" */
-        -B_RD_PRED, -B_VR_PRED,                 /* B_RD_PRED = "111010",
-                                                             B_VR_PRED = "111011" */
-        -B_LD_PRED, 14,                         /* B_LD_PRED = "111110" */
-        -B_VL_PRED, 16,                         /* B_VL_PRED = "1111110" */
-        -B_HD_PRED, -B_HU_PRED                  /* HD = "11111110",
-                                                             HU = "11111111" */
-    };
-    static const uint8_t kf_ymode_prob[4] = {145, 156, 163, 128};
-    int intra_y_mode = BOOL_TREE(bt, kf_ymode_tree, kf_ymode_prob);
+    int intra_y_mode = BOOL_TREE(bt, vp8_kf_ymode_tree, vp8_kf_ymode_prob);
     mb->intra_y_mode = intra_y_mode;
     assert(intra_y_mode <= NUM_PRED_MODES);
     mb->imodes[0] = intra_y_mode;
@@ -1433,19 +1112,12 @@ vp8_decode_mb_header(WEBP *w, bool_dec *bt, struct macro_block *mb, int y, int x
         for (int i = 0; i < 16; i++) {
             int a = above_block_mode(mb, (y > 0) ? mb - cols : &fake_top, i);
             int l = left_block_mode(mb, (x > 0) ? (mb - 1 ) : &fake_left, i);
-            int intra_b_mode = BOOL_TREE(bt, bmode_tree, kf_bmode_prob[a][l]);
+            int intra_b_mode = BOOL_TREE(bt, vp8_bmode_tree, vp8_kf_bmode_prob[a][l]);
             mb->imodes[i] = intra_b_mode;
         }
     }
 
-    const int8_t uv_mode_tree[6] = {
-        -DC_PRED, 2,      /* root: DC_PRED = "0", "1" subtree */
-        -V_PRED, 4,       /* "1" subtree:  V_PRED = "10", "11" subtree */
-        -H_PRED, -TM_PRED /* "11" subtree: H_PRED = "110",
-                                                   TM_PRED = "111" */
-    };
-    const uint8_t kf_uv_mode_prob[3] = {142, 114, 183};
-    mb->intra_uv_mode = BOOL_TREE(bt, uv_mode_tree, kf_uv_mode_prob);
+    mb->intra_uv_mode = BOOL_TREE(bt, vp8_uv_mode_tree, vp8_kf_uv_mode_prob);
     // VDBG(webp, "y %d, x %d: ymode %d, uvmode %d", y, x, mb->intra_y_mode, mb->intra_uv_mode);
 }
 
@@ -1460,10 +1132,11 @@ static void vp8_prerdict_mb(struct macro_block *block, int16_t *coeffs,
     // VDBG(webp, "ymode %d, imodes0 %d", block->intra_y_mode, block->imodes[0]);
 
 
-    pred_luma(coeffs, block->intra_y_mode, block->imodes, yout, y_stride, block->x, y);
-    
-    pred_chrome(coeffs+256, block->intra_uv_mode, uout, vout, uv_stride,
-                block->x, y);
+    pred_luma(coeffs, block->non_zero_y, block->intra_y_mode, block->imodes,
+              yout, y_stride, block->x, y);
+
+    pred_chrome(coeffs+256, block->non_zero_uv, block->intra_uv_mode, uout,
+                vout, uv_stride, block->x, y);
     // VDBG(webp, "y %d, x %d, pred%d %d:", y, block->x, block->intra_y_mode == B_PRED ? 4 : 16, block->imodes[0]);
     // mb_dump(vlog_get_stream(), "after pred", yout, 16, y_stride);
 
@@ -1475,221 +1148,14 @@ static void vp8_prerdict_mb(struct macro_block *block, int16_t *coeffs,
 //-------------------------------------------------------------------------
 // Filtering
 
-typedef void (*VP8SimpleFilterFunc)(uint8_t* p, int stride, int thresh);
-
-// 4 pixels in, 2 pixels out
-static inline void DoFilter2_C(uint8_t* p, int step) {
-  const int p1 = p[-2*step], p0 = p[-step], q0 = p[0], q1 = p[step];
-  const int a = 3 * (q0 - p0) + VP8ksclip1[p1 - q1];  // in [-893,892]
-  const int a1 = VP8ksclip2[(a + 4) >> 3];            // in [-16,15]
-  const int a2 = VP8ksclip2[(a + 3) >> 3];
-  p[-step] = VP8kclip1[p0 + a2];
-  p[    0] = VP8kclip1[q0 - a1];
-}
-
-// 4 pixels in, 4 pixels out
-static inline void DoFilter4_C(uint8_t* p, int step) {
-    const int p1 = p[-2*step], p0 = p[-step], q0 = p[0], q1 = p[step];
-    const int a = 3 * (q0 - p0);
-    const int a1 = VP8ksclip2[(a + 4) >> 3];
-    const int a2 = VP8ksclip2[(a + 3) >> 3];
-    const int a3 = (a1 + 1) >> 1;
-    p[-2*step] = VP8kclip1[p1 + a3];
-    p[-  step] = VP8kclip1[p0 + a2];
-    p[      0] = VP8kclip1[q0 - a1];
-    p[   step] = VP8kclip1[q1 - a3];
-}
-
-// 6 pixels in, 6 pixels out
-static inline void DoFilter6_C(uint8_t* p, int step)
-{
-    const int p2 = p[-3*step], p1 = p[-2*step], p0 = p[-step];
-    const int q0 = p[0], q1 = p[step], q2 = p[2 * step];
-    const int a = VP8ksclip1[3 * (q0 - p0) + VP8ksclip1[p1 - q1]];
-    // a is in [-128,127], a1 in [-27,27], a2 in [-18,18] and a3 in [-9,9]
-    const int a1 = (27 * a + 63) >> 7;  // eq. to ((3 * a + 7) * 9) >> 7
-    const int a2 = (18 * a + 63) >> 7;  // eq. to ((2 * a + 7) * 9) >> 7
-    const int a3 = (9  * a + 63) >> 7;  // eq. to ((1 * a + 7) * 9) >> 7
-    p[-3*step] = VP8kclip1[p2 + a3];
-    p[-2*step] = VP8kclip1[p1 + a2];
-    p[-  step] = VP8kclip1[p0 + a1];
-    p[      0] = VP8kclip1[q0 - a1];
-    p[   step] = VP8kclip1[q1 - a2];
-    p[ 2*step] = VP8kclip1[q2 - a3];
-}
-
-static inline int
-Hev(const uint8_t* p, int step, int thresh)
-{
-    const int p1 = p[-2*step], p0 = p[-step], q0 = p[0], q1 = p[step];
-    return (VP8kabs0[p1 - p0] > thresh) || (VP8kabs0[q1 - q0] > thresh);
-}
-
-
-static inline int
-NeedsFilter_C(const uint8_t* p, int step, int t)
-{
-    const int p1 = p[-2 * step], p0 = p[-step], q0 = p[0], q1 = p[step];
-    return ((4 * VP8kabs0[p0 - q0] + VP8kabs0[p1 - q1]) <= t);
-}
-
-static inline int
-NeedsFilter2_C(const uint8_t* p,
-               int step, int t, int it)
-{
-    const int p3 = p[-4 * step], p2 = p[-3 * step], p1 = p[-2 * step];
-    const int p0 = p[-step], q0 = p[0];
-    const int q1 = p[step], q2 = p[2 * step], q3 = p[3 * step];
-    if ((4 * VP8kabs0[p0 - q0] + VP8kabs0[p1 - q1]) > t) return 0;
-    return VP8kabs0[p3 - p2] <= it && VP8kabs0[p2 - p1] <= it &&
-            VP8kabs0[p1 - p0] <= it && VP8kabs0[q3 - q2] <= it &&
-            VP8kabs0[q2 - q1] <= it && VP8kabs0[q1 - q0] <= it;
-}
-
-static void
-SimpleVFilter16_C(uint8_t* p, int stride, int thresh)
-{
-    const int thresh2 = 2 * thresh + 1;
-    for (int i = 0; i < 16; ++i) {
-        if (NeedsFilter_C(p + i, stride, thresh2)) {
-            DoFilter2_C(p + i, stride);
-        }
-    }
-}
-
-static void
-SimpleHFilter16_C(uint8_t* p, int stride, int thresh)
-{
-    const int thresh2 = 2 * thresh + 1;
-    for (int i = 0; i < 16; ++i) {
-        if (NeedsFilter_C(p + i * stride, 1, thresh2)) {
-            DoFilter2_C(p + i * stride, 1);
-        }
-    }
-}
-
-static void
-SimpleVFilter16i_C(uint8_t* p, int stride, int thresh)
-{
-    for (int k = 3; k > 0; --k) {
-        p += 4 * stride;
-        SimpleVFilter16_C(p, stride, thresh);
-    }
-}
-
-static void
-SimpleHFilter16i_C(uint8_t* p, int stride, int thresh)
-{
-    for (int k = 3; k > 0; --k) {
-        p += 4;
-        SimpleHFilter16_C(p, stride, thresh);
-    }
-}
-
-static inline void
-FilterLoop26_C(uint8_t* p,
-                int hstride, int vstride, int size,
-                int thresh, int ithresh,
-                int hev_thresh)
-{
-    const int thresh2 = 2 * thresh + 1;
-    while (size-- > 0) {
-        if (NeedsFilter2_C(p, hstride, thresh2, ithresh)) {
-            if (Hev(p, hstride, hev_thresh)) {
-                DoFilter2_C(p, hstride);
-            } else {
-                DoFilter6_C(p, hstride);
-            }
-        }
-        p += vstride;
-    }
-}
-
-static inline
-void FilterLoop24_C(uint8_t* p,
-                    int hstride, int vstride, int size,
-                    int thresh, int ithresh,
-                    int hev_thresh)
-{
-    const int thresh2 = 2 * thresh + 1;
-    while (size-- > 0) {
-        if (NeedsFilter2_C(p, hstride, thresh2, ithresh)) {
-            if (Hev(p, hstride, hev_thresh)) {
-                DoFilter2_C(p, hstride);
-            } else {
-                DoFilter4_C(p, hstride);
-            }
-        }
-        p += vstride;
-    }
-}
-
-
-// on macroblock edges
-static void VFilter16_C(uint8_t* p, int stride,
-                        int thresh, int ithresh, int hev_thresh)
-{
-    FilterLoop26_C(p, stride, 1, 16, thresh, ithresh, hev_thresh);
-}
-
-static void HFilter16_C(uint8_t* p, int stride,
-                        int thresh, int ithresh, int hev_thresh)
-{
-    FilterLoop26_C(p, 1, stride, 16, thresh, ithresh, hev_thresh);
-}
-
-// on three inner edges
-static void VFilter16i_C(uint8_t* p, int stride,
-                         int thresh, int ithresh, int hev_thresh)
-{
-    for (int k = 3; k > 0; --k) {
-        p += 4 * stride;
-        FilterLoop24_C(p, stride, 1, 16, thresh, ithresh, hev_thresh);
-    }
-}
-
-static void HFilter16i_C(uint8_t* p, int stride,
-                         int thresh, int ithresh, int hev_thresh)
-{
-    for (int k = 3; k > 0; --k) {
-        p += 4;
-        FilterLoop24_C(p, 1, stride, 16, thresh, ithresh, hev_thresh);
-    }
-}
-
-// 8-pixels wide variant, for chroma filtering
-static void VFilter8_C(uint8_t* u, uint8_t* v, int stride,
-                       int thresh, int ithresh, int hev_thresh) {
-    FilterLoop26_C(u, stride, 1, 8, thresh, ithresh, hev_thresh);
-    FilterLoop26_C(v, stride, 1, 8, thresh, ithresh, hev_thresh);
-}
-
-static void HFilter8_C(uint8_t* u, uint8_t* v, int stride,
-                       int thresh, int ithresh, int hev_thresh) {
-    FilterLoop26_C(u, 1, stride, 8, thresh, ithresh, hev_thresh);
-    FilterLoop26_C(v, 1, stride, 8, thresh, ithresh, hev_thresh);
-}
-
-static void VFilter8i_C(uint8_t* u, uint8_t* v, int stride,
-                        int thresh, int ithresh, int hev_thresh) {
-    FilterLoop24_C(u + 4 * stride, stride, 1, 8, thresh, ithresh, hev_thresh);
-    FilterLoop24_C(v + 4 * stride, stride, 1, 8, thresh, ithresh, hev_thresh);
-}
-
-static void HFilter8i_C(uint8_t* u, uint8_t* v, int stride,
-                        int thresh, int ithresh, int hev_thresh) {
-    FilterLoop24_C(u + 4, 1, stride, 8, thresh, ithresh, hev_thresh);
-    FilterLoop24_C(v + 4, 1, stride, 8, thresh, ithresh, hev_thresh);
-}
-
 static int loopfilter(WEBP *w, struct macro_block *block, int filter_type, int y, uint8_t *y_dst, uint8_t *u_dst,
                       uint8_t *v_dst, int y_stride, int uv_stride)
 {
-
+    const struct vp8_dsp *dsp = vp8_dsp_get();
     VP8Filter *filter = &w->filters[block->segment_id][block->intra_y_mode == B_PRED];
-    // bool skip_sub_filter =
-        // ((block->intra_y_mode != B_PRED) && (block->mb_skip_coeff));
-    bool skip_sub_filter = (block->intra_y_mode != B_PRED);
+    // inner edges are filtered for B_PRED or when there is any residue
+    bool skip_sub_filter = (block->intra_y_mode != B_PRED) &&
+                           !(block->non_zero_y | block->non_zero_uv);
 
     const int sub_limit = filter->sub_limit;
     const int inter_limit = filter->inter_limit;
@@ -1705,46 +1171,46 @@ static int loopfilter(WEBP *w, struct macro_block *block, int filter_type, int y
         // across
         //    the left (vertical) inter-macroblock edge of M
         if (block->x > 0) {
-            SimpleHFilter16_C(y_dst, y_stride, mb_limit);
+            dsp->simple_hfilter16(y_dst, y_stride, mb_limit);
         }
         // step 2: Filter across the vertical subblock edges within M.
         if (!skip_sub_filter) {
-            SimpleHFilter16i_C(y_dst, y_stride, sub_limit);
+            dsp->simple_hfilter16i(y_dst, y_stride, sub_limit);
         }
         // step 3: If M is not on the topmost row of macroblocks, filter
         // across the
         //    top (horizontal) inter-macroblock edge of M.
         if (y > 0) {
-            SimpleVFilter16_C(y_dst, y_stride, mb_limit);
+            dsp->simple_vfilter16(y_dst, y_stride, mb_limit);
         }
         // step 4: Filter across the horizontal subblock edges within M.
         if (!skip_sub_filter) {
-            SimpleVFilter16i_C(y_dst, y_stride, sub_limit);
+            dsp->simple_vfilter16i(y_dst, y_stride, sub_limit);
         }
     } else {
         // normal, also follow the 4 steps like above
         const int hev_thresh = filter->hev_thresh;
         if (block->x > 0) {
-            HFilter16_C(y_dst, y_stride, mb_limit, inter_limit, hev_thresh);
-            HFilter8_C(u_dst, v_dst, uv_stride, mb_limit, inter_limit,
-                        hev_thresh);
+            dsp->hfilter16(y_dst, y_stride, mb_limit, inter_limit, hev_thresh);
+            dsp->hfilter8(u_dst, v_dst, uv_stride, mb_limit, inter_limit,
+                          hev_thresh);
         }
-        if (skip_sub_filter) {
-            HFilter16i_C(y_dst, y_stride, sub_limit, inter_limit,
+        if (!skip_sub_filter) {
+            dsp->hfilter16i(y_dst, y_stride, sub_limit, inter_limit,
                             hev_thresh);
-            HFilter8i_C(u_dst, v_dst, uv_stride, sub_limit, inter_limit,
-                        hev_thresh);
+            dsp->hfilter8i(u_dst, v_dst, uv_stride, sub_limit, inter_limit,
+                           hev_thresh);
         }
         if (y > 0) {
-            VFilter16_C(y_dst, y_stride, mb_limit, inter_limit, hev_thresh);
-            VFilter8_C(u_dst, v_dst, uv_stride, mb_limit, inter_limit,
-                        hev_thresh);
+            dsp->vfilter16(y_dst, y_stride, mb_limit, inter_limit, hev_thresh);
+            dsp->vfilter8(u_dst, v_dst, uv_stride, mb_limit, inter_limit,
+                          hev_thresh);
         }
-        if (skip_sub_filter) {
-            VFilter16i_C(y_dst, y_stride, sub_limit, inter_limit,
+        if (!skip_sub_filter) {
+            dsp->vfilter16i(y_dst, y_stride, sub_limit, inter_limit,
                             hev_thresh);
-            VFilter8i_C(u_dst, v_dst, uv_stride, sub_limit, inter_limit,
-                        hev_thresh);
+            dsp->vfilter8i(u_dst, v_dst, uv_stride, sub_limit, inter_limit,
+                           hev_thresh);
         }
     }
 
@@ -1802,97 +1268,191 @@ calculate_filter_control_parameter(WEBP *w, int segment_id, int is_4x4)
     }
 }
 
+/* undo the ALPH prediction in place. the first row is predicted from the
+ * left and the first column from above for every method
+ */
 static void
-vp8_decode(WEBP *w, bool_dec *br, bool_dec *btree[4])
+alpha_unfilter(uint8_t *a, int stride, int width, int height, int filter)
 {
-    struct macro_block *block;
-
-    int width = ((w->fi.width + 3) >> 2) << 2;
-    int height = ((w->fi.height + 3) >> 2) << 2;
-    int mbrows = (height + 15) >> 4;
-    int mbcols = (width + 15) >> 4;
-    int y_stride = mbcols * 16;       // 16 * 16 Y
-    int uv_stride = y_stride >> 1;  // 8 * 8   U
-    int pitch = ((y_stride * 32 + 32 - 1) >> 5) << 2; // for display rgb pixels
-
-    //reserve YUV data
-    w->data = malloc(4 * height * (y_stride));
-    uint8_t *Y = malloc(mbrows * 16 * y_stride);
-    uint8_t *U = malloc(mbrows * 8 * uv_stride);
-    uint8_t *V = malloc(mbrows * 8 * uv_stride);
-
-    struct macro_block *blocks = malloc(sizeof(struct macro_block)* (mbcols * mbrows));
-    // one more struct for left of zero col
-    struct context *top = calloc(mbcols, sizeof(struct context));
-
-    VDBG(webp, "rows %d, cols %d, y_stride %d", mbrows, mbcols, y_stride);
+    if (filter == ALPHA_FILTER_NONE) {
+        return;
+    }
+    for (int x = 1; x < width; x++) {
+        a[x] += a[x - 1];
+    }
+    for (int y = 1; y < height; y++) {
+        uint8_t *row = a + y * stride;
+        const uint8_t *top = row - stride;
+        row[0] += top[0];
+        switch (filter) {
+        case ALPHA_FILTER_HORIZONTAL:
+            for (int x = 1; x < width; x++) {
+                row[x] += row[x - 1];
+            }
+            break;
+        case ALPHA_FILTER_VERTICAL:
+            for (int x = 1; x < width; x++) {
+                row[x] += top[x];
+            }
+            break;
+        case ALPHA_FILTER_GRADIENT:
+            for (int x = 1; x < width; x++) {
+                row[x] += clamp(row[x - 1] + top[x] - top[x - 1], 255);
+            }
+            break;
+        }
+    }
+}
 
-    int16_t coeffs[384]; // 384 coeffs = (16+4+4) * 4*4
+/* decode the ALPH chunk into a plane with the same layout as Y */
+static int
+webp_decode_alpha(WEBP *w, uint8_t *a, int stride)
+{
+    int width = w->fi.width, height = w->fi.height;
 
-    // Section 19.3: Macroblock header & Data
-    for (int y = 0; y < mbrows; y++) {
+    if (w->alpha.compression == ALPHA_NO_COMPRESSION) {
+        if (w->alpha_len < width * height) {
+            return -1;
+        }
+        for (int y = 0; y < height; y++) {
+            memcpy(a + y * stride, w->alpha_data + y * width, width);
+        }
+    } else if (w->alpha.compression == ALPHA_LOSSLESS_COMPRESSION) {
+        /* the alpha values are in the green channel */
+        uint32_t *argb = malloc(width * height * sizeof(uint32_t));
+        if (vp8l_decode_stream(w->alpha_data, w->alpha_len, width, height,
+                               argb) < 0) {
+            free(argb);
+            return -1;
+        }
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                a[y * stride + x] = (argb[y * width + x] >> 8) & 0xFF;
+            }
+        }
+        free(argb);
+    } else {
+        VERR(webp, "unknown alpha compression %d", w->alpha.compression);
+        return -1;
+    }
+    alpha_unfilter(a, stride, width, height, w->alpha.filter);
+    return 0;
+}
 
-        // parse intra mode here or in advance
-        bool_dec *bt = btree[y & (w->k.nbr_partitions - 1)];
+/* VP8 decoding state between two MB rows, so a frame can be decoded while
+ * its data is still arriving, see WEBP_idec. Token partitions get their
+ * full size up front and are filled as the data comes.
+ */
+struct vp8_frame {
+    bool_dec *br;                       // first partition, always complete
+    bool_dec *bt[MAX_PARTI_NUM];        // token partitions, created lazily
+    uint8_t *parts[MAX_PARTI_NUM];
+    uint32_t size;                      // VP8 payload size
+    uint32_t avail;                     // VP8 payload bytes seen so far
+
+    uint8_t *Y, *U, *V, *A;
+    struct macro_block *blocks;
+    struct context *top;
+    int mbrows, mbcols;
+    int y_stride, uv_stride, pitch;
+    int filter_type;
+
+    int y;          // MB rows decoded
+    int done;       // MB rows converted to BGRA
+};
 
-        // left part for each row is independent
-        struct context left = { .ctx = {0,}};
-        // from first partition
-        for (int x = 0; x < mbcols; x++) {
-            block = blocks + y * mbcols + x;
-            vp8_decode_mb_header(w, br, block, y, x);
-            vp8_decode_residual_data(w, block, coeffs, bt, &left, top);
-
-            uint8_t *yout = Y + y_stride * y * 16 + x * 16;
-            uint8_t *uout = U + 8 * uv_stride * y + x * 8;
-            uint8_t *vout = V + 8 * uv_stride * y + x * 8;
-            vp8_prerdict_mb(block, coeffs, y, yout, uout, vout, y_stride, uv_stride);
-        }
+static void
+vp8_frame_free(struct vp8_frame *fr)
+{
+    if (fr->br) {
+        bool_dec_free(fr->br);
     }
-    int filter_type = (w->k.loop_filter_level == 0) ? WEBP_FILTER_NONE :
-           w->k.filter_type ? WEBP_FILTER_SIMPLE : WEBP_FILTER_NORMAL;
-    VDBG(webp, "filter_type %d", filter_type);
-    //  0=none, 1=simple, 2=normal
-    if (filter_type > 0) {
-        for (int y = 0; y < mbrows; y++) {
-            for (int x = 0; x < mbcols; x++) {
-                block = blocks + y * mbcols + x;
-                uint8_t *yout = Y + y_stride * y * 16 + x * 16;
-                uint8_t *uout = U + 8 * uv_stride * y + x * 8;
-                uint8_t *vout = V + 8 * uv_stride * y + x * 8;
-                loopfilter(w, block, filter_type, y, yout, uout, vout, y_stride, uv_stride);
-            }
+    for (int i = 0; i < MAX_PARTI_NUM; i++) {
+        // a bool decoder owns its partition buffer
+        if (fr->bt[i]) {
+            bool_dec_free(fr->bt[i]);
+        } else {
+            free(fr->parts[i]);
         }
     }
+    free(fr->Y);
+    free(fr->U);
+    free(fr->V);
+    free(fr->A);
+    free(fr->blocks);
+    free(fr->top);
+    memset(fr, 0, sizeof(*fr));
+}
 
-    YUV420_to_BGRA32(w->data, pitch, Y, U, V, y_stride, uv_stride, mbrows,
-                     mbcols);
+static int
+vp8_part_avail(WEBP *w, struct vp8_frame *fr, int i)
+{
+    if (fr->avail <= w->p[i].start) {
+        return 0;
+    }
+    return MIN(fr->avail - w->p[i].start, w->p[i].len);
 }
 
-int WEBP_read_frame(WEBP *w, FILE *f)
+/* the VP8 payload grew to len bytes, copy the new token partition data */
+static void
+vp8_frame_feed(WEBP *w, struct vp8_frame *fr, const uint8_t *buf, uint32_t len)
 {
-    // unsigned char b[3]; // code for I frame 10byte， P frame 3byte.
-    fread(&w->fh, sizeof(w->fh), 1, f);
+    len = MIN(len, fr->size);
+    if (len <= fr->avail) {
+        return;
+    }
+    for (int i = 0; i < w->k.nbr_partitions; i++) {
+        int from = vp8_part_avail(w, fr, i);
+        int to = MIN(len - MIN(len, w->p[i].start), w->p[i].len);
+        if (to <= from) {
+            continue;
+        }
+        memcpy(fr->parts[i] + from, buf + w->p[i].start + from, to - from);
+        if (fr->bt[i]) {
+            bits_vec_extend(fr->bt[i]->bits, fr->parts[i], to);
+        }
+    }
+    fr->avail = len;
+}
 
+/* parse the frame header and the first partition from the VP8 payload,
+ * len bytes of size are there. -EAGAIN if that is not enough.
+ */
+static int
+vp8_frame_begin(WEBP *w, struct vp8_frame *fr, const uint8_t *buf,
+                uint32_t len, uint32_t size)
+{
+    // code for I frame 10byte， P frame 3byte.
+    if (len < 10) {
+        return (size < 10) ? -EINVAL : -EAGAIN;
+    }
+    memcpy(&w->fh, buf, sizeof(w->fh));
     if (w->fh.frame_type != KEY_FRAME) {
         VERR(webp, "not a key frame for vp8\n");
-        return -1;
+        return -EINVAL;
     }
 
     /* key frame, more info */
-    fread(&w->fi, 7, 1, f);
+    memcpy(&w->fi, buf + 3, 7);
     if (w->fi.start1 != 0x9d || w->fi.start2 != 0x01 || w->fi.start3 != 0x2a) {
         VERR(webp, "not a valid start code for vp8\n");
-        return -1;
+        return -EINVAL;
+    }
+    uint32_t partition0_size = ((int)w->fh.size_h | w->fh.size << 3);
+    uint32_t first = 10 + partition0_size;
+    if (first > size) {
+        return -EINVAL;
+    }
+    // the partition sizes follow, wait for the largest table
+    if (len < MIN(first + 3 * (MAX_PARTI_NUM - 1), size)) {
+        return -EAGAIN;
     }
-    int partition0_size = ((int)w->fh.size_h | w->fh.size << 3);
-
-    uint8_t *buf = malloc(partition0_size);
-    fread(buf, partition0_size, 1, f);
 
-    struct bool_dec *first_bt = bool_dec_init(buf, partition0_size);
+    uint8_t *p0 = malloc(partition0_size);
+    memcpy(p0, buf + 10, partition0_size);
+    fr->br = bool_dec_init(p0, partition0_size);
 
-    read_vp8_ctl_partition(w, first_bt, f);
+    read_vp8_ctl_partition(w, fr->br);
 
     /* Quato From 9.11:
        The remainder of the first data partition consists of macroblock-level
@@ -1901,101 +1461,238 @@ int WEBP_read_frame(WEBP *w, FILE *f)
         the prediction and residue data are known and will not change until the
         next frame.
     */
-    bool_dec *bt[MAX_PARTI_NUM];
+    if (read_partition_sizes(w, buf, first, size) < 0) {
+        VERR(webp, "invalid partition sizes");
+        vp8_frame_free(fr);
+        return -EINVAL;
+    }
     for (int i = 0; i < w->k.nbr_partitions; i++) {
-        uint8_t *parts = malloc(w->p[i].len);
-        fseek(f, w->p[i].start, SEEK_SET);
-        fread(parts, 1, w->p[i].len, f);
-        VDBG(webp, "part %d: len %d, 0x%x", i, w->p[i].len, parts[0]);
-        // hexdump(stdout, "partitions", parts, 120);
-        bt[i] = bool_dec_init(parts, w->p[i].len);
-
+        VDBG(webp, "part %d: len %d", i, w->p[i].len);
+        fr->parts[i] = malloc(MAX(w->p[i].len, 1));
+    }
+    // the filter strength goes with the segment, not the partition
+    for (int i = 0; i < NUM_MB_SEGMENTS; i++) {
         calculate_filter_control_parameter(w, i, 0);
         calculate_filter_control_parameter(w, i, 1);
     }
-    // bits_vec_dump(first_bt->bits);
+    fr->size = size;
+    fr->avail = 0;
+    vp8_frame_feed(w, fr, buf, len);
 
-    vp8_decode(w, first_bt, bt);
+    int width = ((w->fi.width + 3) >> 2) << 2;
+    int height = ((w->fi.height + 3) >> 2) << 2;
+    fr->mbrows = (height + 15) >> 4;
+    fr->mbcols = (width + 15) >> 4;
+    fr->y_stride = fr->mbcols * 16;       // 16 * 16 Y
+    fr->uv_stride = fr->y_stride >> 1;    // 8 * 8   U
+    fr->pitch = ((fr->y_stride * 32 + 32 - 1) >> 5) << 2; // for display rgb pixels
 
-    // free all decoders
-    bool_dec_free(first_bt);
-    for (int i = 0; i < w->k.nbr_partitions; i++) {
-        bool_dec_free(bt[i]);
+    //reserve YUV data
+    // whole macroblocks are converted, not only the visible rows
+    w->data = calloc(fr->mbrows * 16, fr->pitch);
+    fr->Y = malloc(fr->mbrows * 16 * fr->y_stride);
+    fr->U = malloc(fr->mbrows * 8 * fr->uv_stride);
+    fr->V = malloc(fr->mbrows * 8 * fr->uv_stride);
+    fr->blocks = malloc(sizeof(struct macro_block) * (fr->mbcols * fr->mbrows));
+    fr->top = calloc(fr->mbcols, sizeof(struct context));
+    fr->filter_type = (w->k.loop_filter_level == 0) ? WEBP_FILTER_NONE :
+           w->k.filter_type ? WEBP_FILTER_SIMPLE : WEBP_FILTER_NORMAL;
+    VDBG(webp, "rows %d, cols %d, y_stride %d, filter_type %d", fr->mbrows,
+         fr->mbcols, fr->y_stride, fr->filter_type);
+
+    /* alpha is merged into the BGRA output by the color conversion, the
+     * ALPH chunk comes before the VP8 one */
+    if (w->alpha_data) {
+        fr->A = malloc(fr->mbrows * 16 * fr->y_stride);
+        memset(fr->A, 0xFF, fr->mbrows * 16 * fr->y_stride);
+        if (webp_decode_alpha(w, fr->A, fr->y_stride) == 0) {
+            w->has_alpha = 1;
+        } else {
+            VERR(webp, "invalid alpha, ignored");
+            free(fr->A);
+            fr->A = NULL;
+        }
     }
     return 0;
 }
 
-static void webpl_predicator_transform(WEBP *w, struct bits_vec *v) {
-    int size_bits = READ_BITS(v, 3) + 2;
-    int block_width = (1 << size_bits);
-    int block_height = (1 << size_bits);
-    int block_xsize = DIV_ROUND_UP(w->fi.width, 1 << size_bits);
-    printf("block width %d, height %d, xsize %d\n", block_width, block_height, block_xsize);
+static void
+vp8_filter_row(WEBP *w, struct vp8_frame *fr, int y)
+{
+    //  0=none, 1=simple, 2=normal
+    if (fr->filter_type == WEBP_FILTER_NONE) {
+        return;
+    }
+    for (int x = 0; x < fr->mbcols; x++) {
+        struct macro_block *block = fr->blocks + y * fr->mbcols + x;
+        uint8_t *yout = fr->Y + fr->y_stride * y * 16 + x * 16;
+        uint8_t *uout = fr->U + 8 * fr->uv_stride * y + x * 8;
+        uint8_t *vout = fr->V + 8 * fr->uv_stride * y + x * 8;
+        loopfilter(w, block, fr->filter_type, y, yout, uout, vout,
+                   fr->y_stride, fr->uv_stride);
+    }
+}
+
+/* decode the MB rows the data is there for. Filtering a row changes the
+ * bottom of the row above, so a row is final once the next one is filtered,
+ * and the filter runs one row behind as prediction takes unfiltered pixels.
+ * Returns the number of MB rows converted into w->data.
+ */
+static int
+vp8_frame_rows(WEBP *w, struct vp8_frame *fr)
+{
+    int16_t coeffs[384]; // 384 coeffs = (16+4+4) * 4*4
+    struct context *top_save = malloc(fr->mbcols * sizeof(struct context));
+
+    // Section 19.3: Macroblock header & Data
+    while (fr->y < fr->mbrows) {
+        int y = fr->y;
+        int i = y & (w->k.nbr_partitions - 1);
+        int avail = vp8_part_avail(w, fr, i);
+        int partial = avail < (int)w->p[i].len;
+        if (!fr->bt[i]) {
+            if (partial && avail == 0) {
+                break;
+            }
+            fr->bt[i] = bool_dec_init(fr->parts[i], avail);
+        }
+        bool_dec *bt = fr->bt[i];
 
-    for (int y = 0; y < w->fi.height; y++) {
-        for (int x = 0; x < w->fi.width; x ++) {
-            // int block_index = (y >> size_bits) * block_xsize + (x >> size_bits);
+        // checkpoint, a row running out of data is decoded again later
+        struct bool_dec br_save = *fr->br, bt_save = *bt;
+        struct bits_vec brv_save = *fr->br->bits, btv_save = *bt->bits;
+        if (partial) {
+            memcpy(top_save, fr->top, fr->mbcols * sizeof(struct context));
+        }
 
+        // left part for each row is independent
+        struct context left = { .ctx = {0,}};
+        for (int x = 0; x < fr->mbcols; x++) {
+            struct macro_block *block = fr->blocks + y * fr->mbcols + x;
+            // from first partition
+            vp8_decode_mb_header(w, fr->br, block, y, x);
+            vp8_decode_residual_data(w, block, coeffs, bt, &left, fr->top);
+
+            uint8_t *yout = fr->Y + fr->y_stride * y * 16 + x * 16;
+            uint8_t *uout = fr->U + 8 * fr->uv_stride * y + x * 8;
+            uint8_t *vout = fr->V + 8 * fr->uv_stride * y + x * 8;
+            vp8_prerdict_mb(block, coeffs, y, yout, uout, vout, fr->y_stride,
+                            fr->uv_stride);
         }
+        if (partial && bt->bits->eof) {
+            *fr->br = br_save;
+            *fr->br->bits = brv_save;
+            *bt = bt_save;
+            *bt->bits = btv_save;
+            memcpy(fr->top, top_save, fr->mbcols * sizeof(struct context));
+            break;
+        }
+        if (y > 0) {
+            vp8_filter_row(w, fr, y - 1);
+        }
+        fr->y++;
     }
-}
+    free(top_save);
 
-static void webpl_color_transform(WEBP *w UNUSED, struct bits_vec *v) {
-    // int size_bits = READ_BITS(v, 3) + 2;
-    // int block_width = 1 << size_bits;
-    // int block_height = 1 << size_bits;
-    bits_vec_dump(v);
-}
-static void webpl_sub_green_transform(WEBP *w UNUSED, struct bits_vec *v) {
-    bits_vec_dump(v);
+    int final;
+    if (fr->y == fr->mbrows) {
+        if (fr->done < fr->mbrows) {
+            vp8_filter_row(w, fr, fr->mbrows - 1);
+        }
+        final = fr->mbrows;
+    } else {
+        final = (fr->filter_type == WEBP_FILTER_NONE) ? fr->y : fr->y - 2;
+    }
+    if (final > fr->done) {
+        int r = fr->done;
+        YUV420_to_BGRA32(w->data + r * 16 * fr->pitch, fr->pitch,
+                         fr->Y + r * 16 * fr->y_stride,
+                         fr->U + r * 8 * fr->uv_stride,
+                         fr->V + r * 8 * fr->uv_stride,
+                         fr->A ? fr->A + r * 16 * fr->y_stride : NULL,
+                         fr->y_stride, fr->uv_stride, final - r, fr->mbcols);
+        fr->done = final;
+    }
+    return fr->done;
 }
 
-static void webpl_color_index_transform(WEBP *w UNUSED, struct bits_vec *v) {
-    bits_vec_dump(v);
+int WEBP_read_frame(WEBP *w, FILE *f)
+{
+    struct vp8_frame fr = {0};
+    uint8_t *buf = malloc(MAX(w->vp8.size, 1));
+    // a truncated chunk is decoded as far as it goes
+    uint32_t len = fread(buf, 1, w->vp8.size, f);
+
+    int ret = vp8_frame_begin(w, &fr, buf, len, len);
+    free(buf);
+    if (ret < 0) {
+        return -1;
+    }
+    vp8_frame_rows(w, &fr);
+    vp8_frame_free(&fr);
+    return 0;
 }
 
-static void webpl_read_transform(WEBP *w, struct bits_vec *v) {
-    while(READ_BIT(v)) {
-        int ttype = READ_BITS(v, 2);
-        switch (ttype) {
-            case PREDICTOR_TRANSFORM:
-            webpl_predicator_transform(w, v);
-            break;
-            case COLOR_TRANSFORM:
-            webpl_color_transform(w, v);
-            break;
-            case SUBTRACT_GREEN_TRANSFORM:
-            webpl_sub_green_transform(w, v);
-            break;
-            case COLOR_INDEXING_TRANSFORM:
-            webpl_color_index_transform(w, v);
-            break;
-            default:
-            break;
+/* decode a VP8L bitstream into w->data */
+static int
+webp_decode_lossless(WEBP *w, const uint8_t *buf, int len)
+{
+    int width, height;
+    uint32_t *argb;
+    int ret = vp8l_decode(buf, len, &width, &height, &argb);
+    if (ret < 0) {
+        return -1;
+    }
+    w->fi.width = width;
+    w->fi.height = height;
+    w->has_alpha = 1;
+
+    /* same layout as the lossy output, see WEBP_load */
+    int pitch = ((width + 15) >> 4) * 16 * 4;
+    int rows = ((height + 15) >> 4) * 16;
+    w->data = calloc(rows, pitch);
+    for (int y = 0; y < height; y++) {
+        uint8_t *dst = w->data + y * pitch;
+        const uint32_t *src = argb + y * width;
+        for (int x = 0; x < width; x++) {
+            dst[4 * x] = src[x] & 0xFF;
+            dst[4 * x + 1] = (src[x] >> 8) & 0xFF;
+            dst[4 * x + 2] = (src[x] >> 16) & 0xFF;
+            dst[4 * x + 3] = src[x] >> 24;
         }
     }
+    free(argb);
+    return 0;
 }
 
 int WEBP_read_lossless(WEBP *w, FILE *f)
 {
-    unsigned char b; // magic byte 0x2f
-    fread(&b, 1, 1, f);
-    if (b != 0x2f) {
-        VERR(webp, "invalid magic value %x", b);
+    uint8_t *buf = malloc(w->vp8l.size);
+    if (fread(buf, w->vp8l.size, 1, f) != 1) {
+        free(buf);
         return -1;
     }
-    uint8_t *buf = malloc(w->vp8l.size);
-    fread(buf, w->vp8l.size, 1, f);
-    // struct bool_dec *d = bool_dec_init(buf, w->vp8l.size);
-    struct bits_vec * v = bits_vec_alloc(buf, w->vp8l.size, BITS_LSB);
-    w->fi.width = READ_BITS(v, 14) + 1;
-    w->fi.height = READ_BITS(v, 14) + 1;
-    int is_alpha_used = READ_BIT(v);
-    int version_num = READ_BITS(v, 3);
-    printf("alpha_use %d, version_num %d\n", is_alpha_used, version_num);
-    webpl_read_transform(w, v);
-    bits_vec_free(v);
-    return 0;
+    int ret = webp_decode_lossless(w, buf, w->vp8l.size);
+    free(buf);
+    return ret;
+}
+
+static void WEBP_free(struct pic *p);
+
+static void
+webp_setup_pic(struct pic *p, WEBP *w)
+{
+    if (!p->width) {
+        p->width = ((w->fi.width + 3) >> 2) << 2;
+    }
+    if (!p->height) {
+        p->height = ((w->fi.height + 3) >> 2) << 2;
+    }
+    p->depth = 32;
+    p->pitch = ((((p->width + 15) >> 4) * 16 * p->depth + p->depth - 1) >> 5) << 2;
+    VDBG(webp, "decoded with width %d, pitch %d\n", p->width, p->pitch);
+    p->pixels = w->data;
+    p->format = w->has_alpha ? CS_PIXELFORMAT_ARGB32 : CS_PIXELFORMAT_RGB888;
 }
 
 static struct pic* 
@@ -2026,23 +1723,35 @@ WEBP_load(const char *filename, int skip_flag UNUSED)
                 fclose(f);
                 return NULL;
             }
-            p->height = READ_UINT24(w->vp8x.canvas_height);
-            p->width = READ_UINT24(w->vp8x.canvas_width);
+            // canvas size is stored minus one
+            p->height = READ_UINT24(w->vp8x.canvas_height) + 1;
+            p->width = READ_UINT24(w->vp8x.canvas_width) + 1;
         } else if (chead == CHUNCK_HEADER("ALPH")) {
             fseek(f, -4, SEEK_CUR);
             fread(&w->alpha, sizeof(struct webp_alpha), 1, f);
             VINFO(webp, "ALPH\n");
-            if (w->alpha.size != sizeof(struct webp_alpha) - 8) {
-                pic_free(p);
+            if (w->alpha.size < sizeof(struct webp_alpha) - 8) {
+                WEBP_free(p);
+                fclose(f);
+                return NULL;
+            }
+            w->alpha_len = w->alpha.size - (sizeof(struct webp_alpha) - 8);
+            w->alpha_data = malloc(w->alpha_len);
+            if (fread(w->alpha_data, 1, w->alpha_len, f) != (size_t)w->alpha_len) {
+                WEBP_free(p);
                 fclose(f);
                 return NULL;
             }
+            // chunks are padded to even size
+            if (w->alpha.size & 1) {
+                fseek(f, 1, SEEK_CUR);
+            }
         } else if (chead == CHUNCK_HEADER("VP8 ")) {
             //VP8 data chuck
             fseek(f, -4, SEEK_CUR);
             fread(&w->vp8, sizeof(struct webp_vp8), 1, f);
             if (WEBP_read_frame(w, f) < 0) {
-                pic_free(p);
+                WEBP_free(p);
                 fclose(f);
                 return NULL;
             }
@@ -2053,7 +1762,7 @@ WEBP_load(const char *filename, int skip_flag UNUSED)
             fread(&w->vp8l, sizeof(struct webp_vp8l), 1, f);
             VINFO(webp, "VP8L\n");
             if (WEBP_read_lossless(w, f) < 0) {
-                pic_free(p);
+                WEBP_free(p);
                 fclose(f);
                 return NULL;
             }
@@ -2061,29 +1770,22 @@ WEBP_load(const char *filename, int skip_flag UNUSED)
         } else {
             // skip other chuck as optional
             fread(&chunk_size, 4, 1, f);
-            fseek(f, chunk_size, SEEK_CUR);
+            fseek(f, (chunk_size + 1) & ~1, SEEK_CUR);
         }
     }
 
     fclose(f);
-    if (!p->width) {
-        p->width = ((w->fi.width + 3) >> 2) << 2;
-    }
-    if (!p->height) {
-        p->height = ((w->fi.height + 3) >> 2) << 2;
-    }
-    p->depth = 32;
-    p->pitch = ((((p->width + 15) >> 4) * 16 * p->depth + p->depth - 1) >> 5) << 2;
-    VDBG(webp, "decoded with width %d, pitch %d\n", p->width, p->pitch);
-    p->pixels = w->data;
-    p->format = CS_PIXELFORMAT_RGB888;
+    webp_setup_pic(p, w);
 
     return p;
 }
 
-void WEBP_free(struct pic *p)
+static void WEBP_free(struct pic *p)
 {
     WEBP *w = (WEBP *)p->pic;
+    if (w->alpha_data) {
+        free(w->alpha_data);
+    }
     if (w->data) {
         free(w->data);
     }
@@ -2102,8 +1804,8 @@ WEBP_info(FILE *f, struct pic* p)
         fprintf(f, "Chunk VP8X length %d:\n", w->vp8x.size);
         fprintf(f, "\tVP8X icc %d, alpha %d, exif %d, xmp %d, animation %d\n",
             w->vp8x.icc, w->vp8x.alpha, w->vp8x.exif_metadata, w->vp8x.xmp_metadata, w->vp8x.animation);
-        fprintf(f, "\tVP8X canvas witdth %d, height %d\n", READ_UINT24(w->vp8x.canvas_width),
-            READ_UINT24(w->vp8x.canvas_height));
+        fprintf(f, "\tVP8X canvas witdth %d, height %d\n", READ_UINT24(w->vp8x.canvas_width) + 1,
+            READ_UINT24(w->vp8x.canvas_height) + 1);
     }
     if (w->vp8.vp8 == CHUNCK_HEADER("VP8 ")) {
         fprintf(f, "Chunk VP8  length %d:\n", w->vp8.size);
@@ -2167,15 +1869,184 @@ WEBP_info(FILE *f, struct pic* p)
     fprintf(f, "\tprob_skip_false %d\n", w->k.prob_skip_false);
     }
 
+static void
+put_le32(uint8_t *p, uint32_t v)
+{
+    p[0] = v & 0xFF;
+    p[1] = (v >> 8) & 0xFF;
+    p[2] = (v >> 16) & 0xFF;
+    p[3] = (v >> 24) & 0xFF;
+}
+
+/* simple lossy file, a RIFF header and one VP8 chunk */
+static void
+WEBP_encode(struct pic *p, const char *fname)
+{
+    struct vp8_enc_config cfg;
+    uint8_t *vp8 = NULL;
+    uint8_t hdr[20];
+
+    vp8_enc_config_default(&cfg);
+    int len = vp8_encode(p, &cfg, &vp8);
+    if (len < 0) {
+        VERR(webp, "fail to encode %s: %d", fname, len);
+        return;
+    }
+    FILE *f = fopen(fname, "wb");
+    if (!f) {
+        VERR(webp, "fail to open %s", fname);
+        free(vp8);
+        return;
+    }
+    // chunks are padded to an even size
+    int pad = len & 1;
+    memcpy(hdr, "RIFF", 4);
+    put_le32(hdr + 4, 4 + 8 + len + pad);
+    memcpy(hdr + 8, "WEBP", 4);
+    memcpy(hdr + 12, "VP8 ", 4);
+    put_le32(hdr + 16, len);
+    fwrite(hdr, sizeof(hdr), 1, f);
+    fwrite(vp8, len, 1, f);
+    if (pad) {
+        fputc(0, f);
+    }
+    fclose(f);
+    free(vp8);
+}
+
+/* state of WEBP_idec between two calls */
+struct webp_idec {
+    size_t pos;             // next chunk in the file
+    size_t vp8_pos;         // VP8 payload in the file, 0 until it is found
+    int started;
+    struct vp8_frame fr;
+};
+
+/* handle the chunks before the VP8 data, those are only used as a whole */
+static int
+webp_idec_chunks(struct idec *d, struct webp_idec *s)
+{
+    struct pic *p = d->p;
+    WEBP *w = p->pic;
+    uint32_t chead, chunk_size;
+
+    while (!s->vp8_pos) {
+        if (d->len < s->pos + 8) {
+            return IDEC_SUSPENDED;
+        }
+        const uint8_t *c = d->data + s->pos;
+        memcpy(&chead, c, 4);
+        memcpy(&chunk_size, c + 4, 4);
+        if (chead == CHUNCK_HEADER("VP8 ")) {
+            memcpy(&w->vp8, c, sizeof(struct webp_vp8));
+            s->vp8_pos = s->pos + 8;
+            break;
+        }
+        if (d->len < s->pos + 8 + chunk_size) {
+            return IDEC_SUSPENDED;
+        }
+        if (chead == CHUNCK_HEADER("VP8X")) {
+            if (chunk_size != sizeof(struct webp_vp8x) - 8) {
+                return IDEC_ERROR;
+            }
+            memcpy(&w->vp8x, c, sizeof(struct webp_vp8x));
+            // canvas size is stored minus one
+            p->height = READ_UINT24(w->vp8x.canvas_height) + 1;
+            p->width = READ_UINT24(w->vp8x.canvas_width) + 1;
+        } else if (chead == CHUNCK_HEADER("ALPH")) {
+            if (chunk_size < sizeof(struct webp_alpha) - 8 || w->alpha_data) {
+                return IDEC_ERROR;
+            }
+            memcpy(&w->alpha, c, sizeof(struct webp_alpha));
+            w->alpha_len = chunk_size - (sizeof(struct webp_alpha) - 8);
+            w->alpha_data = malloc(w->alpha_len);
+            memcpy(w->alpha_data, c + sizeof(struct webp_alpha), w->alpha_len);
+        } else if (chead == CHUNCK_HEADER("VP8L")) {
+            // no partial decoding for lossless, it comes as a whole
+            memcpy(&w->vp8l, c, sizeof(struct webp_vp8l));
+            if (webp_decode_lossless(w, c + 8, chunk_size) < 0) {
+                return IDEC_ERROR;
+            }
+            webp_setup_pic(p, w);
+            d->rows = p->height;
+            return IDEC_DONE;
+        }
+        // chunks are padded to even size
+        s->pos += 8 + ((chunk_size + 1) & ~1);
+    }
+    return IDEC_SUSPENDED;
+}
+
+static int
+WEBP_idec(struct idec *d)
+{
+    struct webp_idec *s = d->priv;
+
+    if (!s) {
+        struct webp_header h;
+        if (d->len < sizeof(h)) {
+            return IDEC_SUSPENDED;
+        }
+        memcpy(&h, d->data, sizeof(h));
+        if (h.riff != CHUNCK_HEADER("RIFF") || h.webp != CHUNCK_HEADER("WEBP")) {
+            return IDEC_ERROR;
+        }
+        s = d->priv = calloc(1, sizeof(struct webp_idec));
+        s->pos = sizeof(h);
+        d->p = pic_alloc(sizeof(WEBP));
+        ((WEBP *)d->p->pic)->header = h;
+    }
+    WEBP *w = d->p->pic;
+    if (!s->vp8_pos) {
+        int ret = webp_idec_chunks(d, s);
+        if (ret != IDEC_SUSPENDED || !s->vp8_pos) {
+            return ret;
+        }
+    }
+
+    const uint8_t *vp8 = d->data + s->vp8_pos;
+    uint32_t len = MIN(d->len - s->vp8_pos, w->vp8.size);
+    if (!s->started) {
+        int ret = vp8_frame_begin(w, &s->fr, vp8, len, w->vp8.size);
+        if (ret == -EAGAIN) {
+            return IDEC_SUSPENDED;
+        } else if (ret < 0) {
+            return IDEC_ERROR;
+        }
+        s->started = 1;
+        webp_setup_pic(d->p, w);
+    } else {
+        vp8_frame_feed(w, &s->fr, vp8, len);
+    }
+    int done = vp8_frame_rows(w, &s->fr);
+    d->rows = MIN(done * 16, d->p->height);
+    return (done == s->fr.mbrows) ? IDEC_DONE : IDEC_SUSPENDED;
+}
+
+static void
+WEBP_idec_free(struct idec *d)
+{
+    struct webp_idec *s = d->priv;
+    if (s) {
+        vp8_frame_free(&s->fr);
+        free(s);
+        d->priv = NULL;
+    }
+}
+
 static struct file_ops webp_ops = {
     .name = "WEBP",
     .probe = WEBP_probe,
     .load = WEBP_load,
     .free = WEBP_free,
     .info = WEBP_info,
+    .encode = WEBP_encode,
+    .idec = WEBP_idec,
+    .idec_free = WEBP_idec_free,
 };
 
 void WEBP_init(void)
 {
+    vp8_dsp_init();
     file_ops_register(&webp_ops);
 }
@@ -7,6 +7,7 @@ extern "C" {
 
 #include <stdint.h>
 #include "byteorder.h"
+#include "predict.h"
 
 #define CHUNCK_HEADER(c) (uint32_t)(c[3]<<24|c[2]<<16|c[1]<<8|c[0])
 #define READ_UINT24(a)  (a[2]<<16 | a[1]<<8 | a[0])
@@ -80,6 +81,18 @@ struct webp_alpha {
     // uint8_t bitstream[0];
 };
 
+enum alpha_compression {
+    ALPHA_NO_COMPRESSION = 0,
+    ALPHA_LOSSLESS_COMPRESSION = 1,
+};
+
+enum alpha_filter {
+    ALPHA_FILTER_NONE = 0,
+    ALPHA_FILTER_HORIZONTAL = 1,
+    ALPHA_FILTER_VERTICAL = 2,
+    ALPHA_FILTER_GRADIENT = 3,
+};
+
 struct webp_color {
     uint32_t iccp; /* ICCP ascii code */
     uint32_t size;
@@ -249,6 +262,8 @@ struct macro_block {
     uint8_t imodes[16];    // one 16x16 mode (#0) or sixteen 4x4 modes
 
     // int16_t coeffs[384];   // 384 coeffs = (16+4+4) * 4*4
+    uint32_t non_zero_y;   // 2 bits per Y block, see VP8_NZ_CODE
+    uint32_t non_zero_uv;  // 2 bits per U/V block, U first
 
     uint8_t dither;        // local dithering strength (deduced from non_zero_*)
 
@@ -258,17 +273,10 @@ struct macro_block {
 
 #pragma pack(pop)
 
-enum TransformType {
-    PREDICTOR_TRANSFORM = 0,
-    COLOR_TRANSFORM = 1,
-    SUBTRACT_GREEN_TRANSFORM = 2,
-    COLOR_INDEXING_TRANSFORM = 3,
-};
-
-#define MAX_PARTI_NUM (4)
+#define MAX_PARTI_NUM (8)
 
 struct partition {
-    uint32_t start;     // offset in the file
+    uint32_t start;     // offset in the VP8 payload
     uint32_t len;       // partition length
 };
 
@@ -307,9 +315,30 @@ typedef struct {
     struct WEBP_decoder d[NUM_MB_SEGMENTS]; // different segment has different parameters
     struct vp8_filter filters[NUM_MB_SEGMENTS][2];
 
+    uint8_t *alpha_data;    // ALPH payload after the header byte
+    int alpha_len;
+    int has_alpha;
+
     uint8_t *data;
 } WEBP;
 
+/* VP8 tables, shared by the decoder and the encoder in vp8enc.c */
+extern const uint16_t vp8_dc_qlookup[128];
+extern const uint16_t vp8_ac_qlookup[128];
+extern const uint8_t
+    vp8_coeff_update_probs[NUM_TYPES][NUM_BANDS][NUM_CTX][NUM_PROBAS];
+extern const uint8_t
+    vp8_default_coeff_probs[NUM_TYPES][NUM_BANDS][NUM_CTX][NUM_PROBAS];
+extern const uint8_t *const vp8_pcat[6]; // extra bits of dct_cat1 - dct_cat6
+extern const uint8_t vp8_zigzag[16];
+extern const uint8_t vp8_coeff_bands[16];
+extern const int8_t vp8_kf_ymode_tree[8];
+extern const uint8_t vp8_kf_ymode_prob[4];
+extern const int8_t vp8_bmode_tree[18];
+extern const uint8_t vp8_kf_bmode_prob[NUM_BMODES][NUM_BMODES][NUM_BMODES - 1];
+extern const int8_t vp8_uv_mode_tree[6];
+extern const uint8_t vp8_kf_uv_mode_prob[3];
+
 void WEBP_init(void);
 
 #ifdef __cplusplus
@@ -0,0 +1,955 @@
+/* libsvtav1 still pictures in low overhead obu format, encoded at preset 2
+ * with 2x2 tiles, cdef and loop restoration on. The crc32 is the one of the
+ * libdav1d output, planes one after the other, 10 bit samples as two bytes
+ * little endian
+ */
+#ifndef _AV1_STREAMS_H_
+#define _AV1_STREAMS_H_
+
+#include <stdint.h>
+
+/* 8 bit 4:2:0 128x128, crf 25, self guided restoration on all planes */
+static const uint8_t av1_128x128[3691] = {
+    0x12, 0x00, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x03, 0x37, 0xff, 0xe7, 0xdf,
+    0xcc, 0x02, 0x32, 0xda, 0x1c, 0x10, 0x00, 0xfa, 0xb8, 0x08, 0x41, 0x04,
+    0x10, 0x05, 0x00, 0x34, 0x01, 0xff, 0x40, 0x00, 0xe8, 0x03, 0x8b, 0xb8,
+    0xb1, 0xe2, 0x4d, 0x27, 0xb9, 0xdf, 0x5f, 0x24, 0x72, 0xc2, 0x7f, 0xfd,
+    0xc5, 0xec, 0x29, 0x7b, 0x0d, 0x44, 0xdf, 0x8d, 0x5e, 0x64, 0xc0, 0x4c,
+    0x45, 0x7f, 0x7e, 0x76, 0x1c, 0xa8, 0x10, 0xd4, 0x01, 0x98, 0x5a, 0x28,
+    0xff, 0xbd, 0xfd, 0x03, 0x52, 0xc5, 0xcb, 0x88, 0xbd, 0xc3, 0xef, 0xc3,
+    0xe9, 0xce, 0xc6, 0x23, 0x76, 0x73, 0x7b, 0x3b, 0x67, 0x24, 0x61, 0x88,
+    0xe0, 0x9b, 0x33, 0x50, 0xf3, 0x26, 0x1b, 0x5a, 0xdd, 0xef, 0x37, 0x81,
+    0x43, 0xee, 0x98, 0xae, 0xc3, 0x70, 0xb9, 0xaa, 0x6e, 0xb1, 0x6b, 0x99,
+    0x9f, 0x35, 0x74, 0x48, 0x28, 0xeb, 0xe8, 0x28, 0xc3, 0x77, 0xe8, 0xe7,
+    0x65, 0xf1, 0x0c, 0x38, 0xb1, 0x26, 0x2a, 0x8b, 0x94, 0x29, 0x74, 0x74,
+    0x05, 0x30, 0xa8, 0x3a, 0x9d, 0xc5, 0x9e, 0xff, 0x5d, 0x95, 0x14, 0x60,
+    0xf0, 0x0b, 0xac, 0x81, 0x06, 0x42, 0x72, 0xcb, 0x3a, 0xeb, 0x50, 0xbb,
+    0xda, 0xa1, 0x78, 0x5f, 0x66, 0x2a, 0x6c, 0x55, 0x86, 0x8a, 0xce, 0x66,
+    0x64, 0x2c, 0x10, 0x77, 0xc7, 0x65, 0xef, 0x34, 0x68, 0x4f, 0x96, 0xa6,
+    0x12, 0x01, 0x3a, 0x9b, 0xba, 0x42, 0xd3, 0xcf, 0xdb, 0xbc, 0x46, 0xa9,
+    0x8c, 0x2f, 0x97, 0x67, 0x2a, 0x23, 0xb6, 0x8c, 0xa9, 0x2a, 0x70, 0x24,
+    0x0d, 0x1d, 0xb6, 0xe3, 0x15, 0x71, 0xb0, 0x48, 0x7c, 0x03, 0xfd, 0xbc,
+    0x4b, 0xdc, 0xa7, 0x9c, 0x87, 0xd0, 0x53, 0xae, 0x47, 0x4c, 0xfa, 0xa5,
+    0xf7, 0x2b, 0x7a, 0xdd, 0x83, 0xc3, 0xa6, 0xdc, 0x6d, 0x87, 0x40, 0x87,
+    0x0d, 0x69, 0xd9, 0xfe, 0x43, 0x09, 0x92, 0xcb, 0x33, 0x18, 0x7f, 0xc2,
+    0x3a, 0x14, 0xc1, 0x22, 0xa9, 0x2f, 0xe9, 0xad, 0x53, 0x30, 0x72, 0xc8,
+    0xcb, 0x8d, 0xa6, 0xfd, 0x4a, 0xa9, 0xd2, 0x97, 0xca, 0xbb, 0x3b, 0x95,
+    0xc3, 0x65, 0x7c, 0x2f, 0x59, 0x9c, 0x3a, 0xdc, 0xd1, 0x9c, 0x73, 0x6f,
+    0x65, 0x11, 0xac, 0xe3, 0x81, 0xd6, 0xee, 0x3f, 0x4b, 0x69, 0x75, 0x62,
+    0x2a, 0x49, 0xa7, 0x43, 0xd8, 0xaf, 0x58, 0x00, 0xd7, 0xca, 0xf2, 0xc1,
+    0x00, 0x6d, 0xf7, 0x87, 0x92, 0x37, 0xee, 0xe9, 0x85, 0x72, 0x3f, 0x81,
+    0xbf, 0x44, 0x4a, 0xad, 0xce, 0x08, 0xb0, 0xc9, 0x91, 0x31, 0x36, 0xfe,
+    0x68, 0x38, 0x5f, 0xb2, 0xc9, 0xe1, 0x59, 0xe7, 0xaa, 0x54, 0x2d, 0x6b,
+    0x83, 0x3d, 0x47, 0x43, 0xcb, 0x5e, 0xca, 0x75, 0xbc, 0x9c, 0x37, 0x5b,
+    0xd5, 0x39, 0xf9, 0x63, 0xe3, 0x03, 0x32, 0x90, 0x37, 0xf0, 0x19, 0x22,
+    0xb7, 0xc0, 0x32, 0x48, 0xff, 0x0f, 0x90, 0x7e, 0x58, 0xbe, 0x48, 0xf7,
+    0xf0, 0x67, 0x12, 0xee, 0xff, 0x7c, 0x91, 0x90, 0x81, 0xc8, 0x55, 0x21,
+    0x1e, 0x7b, 0x30, 0xb0, 0xa1, 0x1a, 0x62, 0xbd, 0x94, 0x0c, 0xa4, 0x5d,
+    0xfa, 0xf4, 0x7b, 0x83, 0x51, 0xec, 0x25, 0x4a, 0xb2, 0xab, 0x47, 0x5e,
+    0x67, 0xae, 0xc7, 0x84, 0x16, 0x58, 0xb0, 0xd2, 0x53, 0xa9, 0xc9, 0x24,
+    0x93, 0x5f, 0xce, 0xda, 0xc0, 0x21, 0x2f, 0x63, 0x62, 0x68, 0xe7, 0xf8,
+    0x9b, 0x4a, 0x0f, 0x9a, 0x57, 0x93, 0x35, 0x02, 0xf3, 0x46, 0xf2, 0xd0,
+    0xd3, 0xa9, 0xe2, 0x38, 0x30, 0x1f, 0xaf, 0x2e, 0xbb, 0xf3, 0x62, 0x12,
+    0xb2, 0xed, 0x63, 0x5c, 0xd4, 0x14, 0xec, 0x70, 0xe0, 0xea, 0xe2, 0xca,
+    0x8a, 0x4f, 0x91, 0x05, 0xa0, 0x23, 0xff, 0x80, 0x70, 0x34, 0x6c, 0x86,
+    0xa7, 0x54, 0xd8, 0xf4, 0x5d, 0x1e, 0x14, 0x89, 0x4f, 0xb9, 0xe8, 0x5f,
+    0x1c, 0x35, 0xfa, 0x11, 0x9b, 0x92, 0xa7, 0x6b, 0x26, 0xfb, 0x0c, 0xb7,
+    0xae, 0x09, 0x77, 0x8a, 0xde, 0xc1, 0x2c, 0xab, 0xc5, 0xc9, 0x8a, 0x4e,
+    0x3f, 0x45, 0xbd, 0x5c, 0x90, 0x7d, 0xfd, 0x4f, 0x2f, 0xfa, 0x8c, 0xa4,
+    0xfb, 0xbc, 0xde, 0x51, 0xf6, 0x5a, 0xa5, 0x46, 0x30, 0x9b, 0x36, 0x2f,
+    0xd6, 0xb3, 0x29, 0x76, 0x2b, 0xf3, 0x29, 0x7b, 0x92, 0xb2, 0xb2, 0x1f,
+    0x25, 0x43, 0x89, 0x0d, 0xdb, 0xcb, 0x50, 0x28, 0x30, 0x4c, 0x55, 0x3d,
+    0x00, 0x50, 0x7f, 0xf3, 0xa7, 0xef, 0xa1, 0xae, 0xf5, 0x6f, 0x39, 0x5a,
+    0x8e, 0x6e, 0xb2, 0x90, 0xd7, 0x42, 0x39, 0x3c, 0x61, 0x41, 0x36, 0x1f,
+    0x34, 0xcc, 0xb7, 0xf7, 0xc4, 0x95, 0x5d, 0x6e, 0x75, 0x41, 0x60, 0xd0,
+    0x5b, 0x98, 0x80, 0x95, 0x16, 0x41, 0x7e, 0x11, 0x1d, 0x98, 0x83, 0x49,
+    0x7c, 0xc4, 0x78, 0x62, 0x21, 0x29, 0xfc, 0x5e, 0xfa, 0x31, 0x1e, 0x55,
+    0x76, 0x8c, 0xf7, 0xf4, 0xa8, 0x2a, 0x90, 0xb6, 0x1b, 0x04, 0xe1, 0xdf,
+    0x79, 0x8d, 0x2e, 0xf4, 0x8b, 0xf9, 0xa5, 0xd8, 0x07, 0x5b, 0x0c, 0x8e,
+    0x09, 0x8b, 0x27, 0x5b, 0xab, 0xef, 0x50, 0x34, 0x2d, 0x21, 0x36, 0xac,
+    0xac, 0x6d, 0x34, 0xc4, 0x5d, 0x35, 0xbf, 0xdc, 0xb9, 0x8d, 0x17, 0x2e,
+    0x83, 0x1d, 0x86, 0x5c, 0x56, 0x32, 0x63, 0xc5, 0x46, 0x6b, 0x41, 0xad,
+    0x41, 0x31, 0xfd, 0xc2, 0xb1, 0xb0, 0xa1, 0x02, 0x8a, 0x8f, 0xae, 0x5c,
+    0xb1, 0xd3, 0x11, 0x88, 0xa0, 0xaa, 0x64, 0xb5, 0x09, 0x3e, 0x93, 0xb9,
+    0xfd, 0xb1, 0x0a, 0xda, 0x1d, 0x65, 0x77, 0xbd, 0xea, 0x75, 0x6c, 0xaf,
+    0x8c, 0xf9, 0x41, 0xc6, 0x4b, 0xd4, 0x85, 0x2d, 0xb3, 0xa9, 0x4b, 0xb5,
+    0xce, 0x56, 0x60, 0x46, 0x49, 0x41, 0x2c, 0xd3, 0x3a, 0x9d, 0xd6, 0x24,
+    0x85, 0x3c, 0xba, 0x5f, 0x12, 0x28, 0x11, 0x25, 0x99, 0xf0, 0x88, 0x53,
+    0x04, 0x24, 0x8e, 0x7f, 0xa8, 0x36, 0x41, 0xca, 0x78, 0x90, 0x47, 0xca,
+    0x8d, 0x15, 0xb3, 0x04, 0x22, 0x36, 0xb1, 0x17, 0x8a, 0x31, 0x3b, 0xad,
+    0x06, 0x57, 0x0c, 0x66, 0xd8, 0xe1, 0x01, 0x53, 0x13, 0x8a, 0x8b, 0xe4,
+    0x8c, 0x96, 0x1e, 0xd2, 0x52, 0x4f, 0x72, 0xbf, 0x86, 0x9c, 0x46, 0xed,
+    0x29, 0xd9, 0x8a, 0x5f, 0x7f, 0x45, 0x6a, 0x54, 0x29, 0xf4, 0xac, 0x3c,
+    0x29, 0xba, 0x18, 0xd9, 0x46, 0xff, 0xfb, 0xd4, 0xae, 0x1d, 0x4a, 0x68,
+    0x8b, 0x1b, 0xa1, 0x2a, 0xe3, 0x43, 0xc5, 0xf9, 0x99, 0x01, 0x53, 0xf0,
+    0x32, 0x33, 0x7b, 0xbf, 0xd1, 0x3c, 0x3f, 0x47, 0xb3, 0xea, 0x4f, 0xd0,
+    0xb3, 0x88, 0x93, 0x89, 0x46, 0x4f, 0x52, 0xcd, 0xe4, 0x0c, 0x3b, 0x20,
+    0x66, 0xc2, 0x97, 0xa7, 0x54, 0x1e, 0xd2, 0xb6, 0x7f, 0x00, 0x89, 0x26,
+    0x14, 0xd2, 0x67, 0x5e, 0xb6, 0xff, 0x09, 0xf1, 0x36, 0x82, 0x0f, 0x82,
+    0xcb, 0xe4, 0xa3, 0x2d, 0x54, 0xe9, 0x63, 0x22, 0x2d, 0x12, 0x5c, 0xdf,
+    0xc1, 0x76, 0x04, 0x2c, 0x35, 0x00, 0xfd, 0x9b, 0xba, 0x7a, 0x53, 0xf3,
+    0x32, 0x43, 0xa0, 0xc5, 0x9d, 0xb2, 0x2b, 0xcd, 0x49, 0x01, 0x20, 0x6e,
+    0xc3, 0x62, 0xd0, 0x7e, 0xa8, 0xcb, 0x31, 0x5d, 0x32, 0x28, 0x36, 0x10,
+    0x28, 0xcc, 0x84, 0xf5, 0x9d, 0xf1, 0xac, 0x9c, 0x84, 0x0a, 0xff, 0x35,
+    0xb3, 0xc8, 0x9a, 0x13, 0xba, 0x8c, 0x9a, 0xc4, 0x28, 0x91, 0x7a, 0x10,
+    0xc9, 0x69, 0xd3, 0x05, 0x1b, 0x03, 0x77, 0xad, 0xe0, 0x6f, 0xdb, 0xc3,
+    0x8d, 0xef, 0x31, 0x12, 0x76, 0x1a, 0xa3, 0x09, 0x2b, 0x09, 0xec, 0x51,
+    0x52, 0x26, 0xbf, 0x76, 0x5d, 0x4c, 0x40, 0x08, 0x90, 0xff, 0x53, 0xcc,
+    0xf3, 0x6a, 0x9f, 0xee, 0x52, 0x4c, 0x4b, 0xdc, 0xec, 0x87, 0x18, 0x3b,
+    0xcc, 0x67, 0x06, 0xd9, 0x02, 0xd9, 0x97, 0x33, 0x16, 0x12, 0x0f, 0xda,
+    0xae, 0x72, 0x27, 0xe7, 0x0e, 0xe0, 0x27, 0xa4, 0x23, 0x82, 0xb2, 0xad,
+    0x51, 0xf5, 0x17, 0x00, 0x79, 0xd5, 0x77, 0xd0, 0xe4, 0xca, 0x8d, 0xe7,
+    0xe9, 0xe6, 0xa0, 0x4c, 0x59, 0xa7, 0x5a, 0x48, 0x4f, 0xee, 0xa1, 0x9d,
+    0x9a, 0x56, 0x69, 0x92, 0x5d, 0x96, 0x67, 0x1b, 0xac, 0xfc, 0x2a, 0xe5,
+    0xee, 0xe8, 0xb7, 0xa5, 0xc1, 0xc4, 0x77, 0x8c, 0x8e, 0x8d, 0xa4, 0xad,
+    0xbe, 0x0a, 0xd1, 0xdf, 0x9c, 0x4d, 0xdd, 0x01, 0xe4, 0x85, 0xdf, 0x0c,
+    0x64, 0x01, 0xcd, 0xe6, 0x16, 0xed, 0x77, 0x17, 0x96, 0x4c, 0x8c, 0x55,
+    0xcd, 0xcb, 0x43, 0xc6, 0x6b, 0x7f, 0x3a, 0x8e, 0x0d, 0xda, 0x99, 0xb5,
+    0x65, 0x9e, 0xd3, 0x72, 0xdd, 0xaa, 0xf1, 0x75, 0x41, 0x23, 0x0e, 0xa5,
+    0x37, 0xd9, 0x28, 0x1d, 0xa0, 0x08, 0x3c, 0x2f, 0x17, 0xb3, 0x92, 0xee,
+    0xca, 0x37, 0x34, 0x3f, 0x89, 0x07, 0xfa, 0xa5, 0x16, 0x1d, 0x05, 0x8c,
+    0x53, 0xfd, 0x5e, 0x87, 0x70, 0x6b, 0x45, 0x49, 0xeb, 0x0d, 0x1a, 0xaf,
+    0x71, 0x5c, 0x11, 0x94, 0x91, 0x6b, 0xd1, 0x93, 0x09, 0x5a, 0x89, 0xbc,
+    0xdf, 0xb0, 0x1e, 0x17, 0xcc, 0xf1, 0x63, 0x16, 0x7b, 0x7b, 0xad, 0xad,
+    0x54, 0x60, 0xa0, 0xca, 0x13, 0x6e, 0x1e, 0xa1, 0x3e, 0x11, 0xf9, 0x4a,
+    0x47, 0xbf, 0xd7, 0xd5, 0xa2, 0x6e, 0x3f, 0xc5, 0xd8, 0x5a, 0xd8, 0x82,
+    0x91, 0x82, 0xe4, 0xde, 0xe5, 0x21, 0x8d, 0x4f, 0xff, 0x64, 0x2c, 0xf8,
+    0x52, 0x82, 0x80, 0x88, 0x21, 0x89, 0x1f, 0x46, 0x59, 0xbb, 0x6a, 0x48,
+    0x34, 0x5e, 0x54, 0x15, 0x50, 0xe6, 0xd8, 0xae, 0x90, 0x29, 0xa7, 0x55,
+    0x1f, 0xa9, 0xd9, 0x71, 0xb2, 0x0c, 0x61, 0xef, 0x2f, 0x22, 0x9f, 0xfb,
+    0x7c, 0x3a, 0xbe, 0x37, 0xc1, 0xff, 0x9f, 0x7f, 0x79, 0xf6, 0xb0, 0x50,
+    0xca, 0xc9, 0x6a, 0x62, 0x3b, 0x26, 0xfd, 0x66, 0xd9, 0x12, 0x89, 0x02,
+    0x6c, 0x50, 0xe8, 0x8e, 0x25, 0xd3, 0xf0, 0x49, 0x37, 0x3f, 0x8a, 0xeb,
+    0x4a, 0xb5, 0x17, 0xec, 0x1e, 0x1e, 0xb4, 0xa0, 0xf7, 0x47, 0x5c, 0xcd,
+    0x6f, 0x54, 0xfa, 0xb5, 0xfc, 0x4e, 0xe8, 0x60, 0xed, 0x07, 0x50, 0x71,
+    0x5f, 0x58, 0xa3, 0x2c, 0xa8, 0x89, 0x0f, 0x4f, 0xcc, 0xdb, 0x67, 0x33,
+    0x58, 0x08, 0x82, 0xff, 0x0d, 0x3f, 0xf2, 0xd8, 0x37, 0x9d, 0x7d, 0x54,
+    0xee, 0x9e, 0x31, 0x01, 0xe8, 0xe2, 0xa1, 0xf9, 0x32, 0x92, 0xfb, 0x49,
+    0xf8, 0xd0, 0xf4, 0x72, 0xe2, 0x18, 0x52, 0xb5, 0x20, 0x4d, 0xb5, 0x32,
+    0xcd, 0xb5, 0xda, 0x9a, 0x26, 0x11, 0xdb, 0x2e, 0x30, 0x42, 0xa7, 0x00,
+    0xf7, 0x30, 0x95, 0xf7, 0x37, 0x6b, 0xd4, 0x68, 0x23, 0xae, 0xc6, 0x1f,
+    0xca, 0xcd, 0xcc, 0xdf, 0xff, 0x2d, 0xac, 0x4b, 0x9a, 0x2f, 0x31, 0xa7,
+    0xc5, 0x32, 0x77, 0xd3, 0x7d, 0x12, 0x20, 0xe1, 0x19, 0x86, 0x9f, 0x63,
+    0x53, 0xa1, 0xda, 0xa0, 0xce, 0x63, 0xdb, 0xc4, 0x41, 0xf6, 0xcc, 0x0f,
+    0xbc, 0x0b, 0x3c, 0xeb, 0xcd, 0x6e, 0x1f, 0x58, 0xb2, 0x5b, 0xa6, 0xf8,
+    0x65, 0x60, 0x4e, 0x53, 0x5a, 0x7c, 0x4e, 0xdf, 0xe8, 0x2b, 0x91, 0x00,
+    0xb1, 0x2a, 0x3c, 0xf9, 0xec, 0x4d, 0xfa, 0x1b, 0xf8, 0x6e, 0xa3, 0xf4,
+    0x5b, 0xb0, 0x0b, 0x97, 0x7e, 0x25, 0x69, 0xdd, 0x3a, 0x03, 0xe3, 0x8c,
+    0x90, 0x9d, 0x6a, 0xdd, 0xb7, 0xfa, 0x17, 0xe5, 0xdf, 0x79, 0xe7, 0x08,
+    0x03, 0xb0, 0xb7, 0xfd, 0xe4, 0x30, 0x5c, 0x8f, 0x96, 0xcc, 0x7e, 0x7b,
+    0xd7, 0xd3, 0x92, 0xfb, 0x72, 0x3e, 0x84, 0x3d, 0x7c, 0x7b, 0xec, 0x25,
+    0x07, 0x43, 0xfe, 0x40, 0x48, 0xef, 0xf0, 0x50, 0x76, 0xfe, 0xd1, 0x5e,
+    0x72, 0xaa, 0x17, 0xc6, 0x2b, 0x36, 0x07, 0xfd, 0x75, 0x5a, 0xd7, 0x53,
+    0xa4, 0x27, 0xf6, 0xe5, 0xc2, 0xa9, 0x63, 0xc4, 0xa2, 0x0d, 0x28, 0x76,
+    0x18, 0xd3, 0x03, 0x49, 0x31, 0x81, 0x3d, 0xf5, 0xed, 0x26, 0x95, 0x43,
+    0x5d, 0x85, 0x25, 0x99, 0x40, 0xea, 0x4b, 0x76, 0xcc, 0xc5, 0x36, 0x36,
+    0xca, 0x40, 0xe2, 0x18, 0x5f, 0x99, 0xd8, 0x45, 0x6d, 0x99, 0x91, 0xa7,
+    0xe7, 0x9a, 0x60, 0xda, 0xed, 0xec, 0x1f, 0x9c, 0x91, 0x46, 0xad, 0xfe,
+    0x93, 0x65, 0x26, 0xd1, 0x75, 0xd4, 0xec, 0xeb, 0x5d, 0x59, 0xcc, 0xd3,
+    0x5b, 0xed, 0xcb, 0xef, 0x60, 0x71, 0xc7, 0x28, 0x0a, 0xef, 0xba, 0x34,
+    0x8e, 0xc0, 0xab, 0x9e, 0x25, 0xee, 0xa2, 0xb4, 0xc3, 0xe9, 0x92, 0xe1,
+    0x41, 0x71, 0x48, 0x76, 0x5c, 0x8c, 0x62, 0xcb, 0x61, 0xb7, 0x11, 0x7c,
+    0xf4, 0xe6, 0x48, 0x38, 0x33, 0xc5, 0xbb, 0x44, 0x60, 0x66, 0xe6, 0xf4,
+    0xe4, 0xd2, 0x0d, 0x97, 0x0f, 0x12, 0xd9, 0x28, 0xae, 0x1c, 0xe9, 0x0f,
+    0x8c, 0x70, 0x03, 0x01, 0xca, 0x5c, 0xef, 0x28, 0x8e, 0x50, 0xd3, 0xcc,
+    0x4b, 0x0b, 0xd4, 0x6b, 0xce, 0x32, 0x75, 0xc3, 0x09, 0x3e, 0xdb, 0xb4,
+    0x06, 0xf4, 0x61, 0x37, 0x8c, 0x45, 0xc2, 0xa0, 0x6a, 0x80, 0x77, 0xf1,
+    0x83, 0xf6, 0xe4, 0x30, 0xa6, 0x1a, 0xa6, 0x54, 0xf8, 0x1e, 0x52, 0x30,
+    0x1b, 0x08, 0x2c, 0x89, 0xc7, 0x77, 0x5a, 0x0d, 0xf8, 0x69, 0x12, 0xe4,
+    0x96, 0x41, 0x4c, 0xed, 0x2d, 0x29, 0xab, 0x62, 0x9a, 0x60, 0x5b, 0xb9,
+    0xe3, 0x4e, 0xf0, 0xaf, 0x02, 0xd8, 0x82, 0x0d, 0x87, 0xd7, 0x3c, 0xbf,
+    0x69, 0x74, 0x6c, 0xa6, 0x33, 0x2a, 0xbc, 0x26, 0x16, 0x23, 0xda, 0xd0,
+    0xc3, 0xc0, 0xb6, 0xd3, 0x7a, 0xc6, 0xfe, 0x84, 0x7f, 0x63, 0xa7, 0xe9,
+    0x0f, 0x33, 0xa9, 0x28, 0xb1, 0xd2, 0x68, 0x39, 0xcb, 0x6c, 0xc7, 0xb8,
+    0x5c, 0x86, 0x1c, 0x1b, 0x5d, 0xb9, 0x15, 0x59, 0x63, 0xd8, 0x19, 0x5b,
+    0xd0, 0x13, 0x71, 0xeb, 0xd6, 0x14, 0x78, 0x39, 0x8b, 0xce, 0xbf, 0x27,
+    0x42, 0xe9, 0x3d, 0xfe, 0xe0, 0x93, 0x2f, 0x02, 0xe2, 0xca, 0xcd, 0x6f,
+    0x04, 0x10, 0x40, 0x09, 0xea, 0x41, 0x1f, 0x08, 0xc8, 0x37, 0x24, 0x53,
+    0xce, 0xd0, 0xc8, 0xef, 0x3e, 0x44, 0xc8, 0x7b, 0x71, 0x38, 0xc5, 0xb9,
+    0x81, 0xa9, 0xc0, 0x47, 0x4c, 0xf6, 0xc9, 0xba, 0xdc, 0x71, 0xac, 0xab,
+    0x95, 0xfe, 0x58, 0xfb, 0xd1, 0x62, 0x17, 0x46, 0x45, 0x00, 0xf8, 0xcb,
+    0xfd, 0x6a, 0x51, 0xcf, 0x41, 0x27, 0x4e, 0x3b, 0x89, 0xd1, 0x6a, 0xb6,
+    0xed, 0x5f, 0x5b, 0xc4, 0x86, 0xf4, 0x19, 0x7f, 0x37, 0xee, 0x3d, 0xd8,
+    0x7b, 0x54, 0x33, 0x46, 0xec, 0x75, 0x41, 0x07, 0x10, 0x74, 0xf9, 0x7e,
+    0xf5, 0xd2, 0xad, 0x6c, 0x72, 0x93, 0x4d, 0x1c, 0xf0, 0x7d, 0x2b, 0xec,
+    0xd0, 0x86, 0xab, 0x38, 0x6b, 0xf0, 0xd6, 0x20, 0x1e, 0x7a, 0xdc, 0x7e,
+    0x77, 0x60, 0x4b, 0x48, 0x7b, 0xe0, 0x51, 0xb5, 0x41, 0xc8, 0xce, 0x0b,
+    0x61, 0xe6, 0xc1, 0xdc, 0x23, 0xfc, 0xe1, 0x23, 0x80, 0x42, 0xdd, 0x1f,
+    0x29, 0xb1, 0xf3, 0xd1, 0xb2, 0x2b, 0x97, 0x76, 0x7f, 0xbe, 0xa5, 0xa3,
+    0xd5, 0x95, 0x29, 0x71, 0x32, 0x12, 0x6f, 0x6e, 0xb8, 0x64, 0xfc, 0xe3,
+    0x0a, 0x37, 0x14, 0x1e, 0x02, 0x2e, 0x0d, 0xea, 0x34, 0x0d, 0xdf, 0xb3,
+    0xe3, 0x8a, 0x83, 0x7d, 0xd9, 0x0b, 0x2d, 0x32, 0xe9, 0x64, 0x15, 0x01,
+    0xcc, 0x6d, 0x00, 0x8a, 0xd7, 0x30, 0xe7, 0x67, 0x5b, 0x81, 0x8d, 0xde,
+    0x6a, 0x04, 0x28, 0xa6, 0x06, 0x6e, 0x5c, 0x65, 0x4c, 0x6b, 0xd7, 0xe2,
+    0x8b, 0x1d, 0xd0, 0x10, 0x0f, 0xc9, 0xf4, 0x1a, 0x66, 0x3d, 0x99, 0x7b,
+    0x73, 0xe1, 0x82, 0x5e, 0x0c, 0xac, 0xd6, 0x1b, 0x33, 0x2b, 0xb9, 0x13,
+    0xa7, 0x30, 0xcc, 0x2d, 0x98, 0x82, 0xc7, 0xa2, 0xf1, 0x0d, 0x5c, 0x83,
+    0xca, 0x56, 0x06, 0x45, 0xb9, 0x1d, 0x22, 0xfa, 0xfb, 0x73, 0x92, 0xc2,
+    0x5e, 0xcf, 0x2f, 0xb5, 0x7a, 0xf9, 0x15, 0xcb, 0xdc, 0xbc, 0x27, 0x2c,
+    0x7f, 0x88, 0x5a, 0xfe, 0x70, 0x7d, 0xe4, 0x10, 0x6e, 0x2a, 0x52, 0xdf,
+    0xc2, 0x90, 0x38, 0x9a, 0xb3, 0xe2, 0x66, 0x7f, 0x45, 0x6c, 0xc4, 0x4c,
+    0xc2, 0x2a, 0x6a, 0x69, 0x01, 0xb4, 0x2c, 0x75, 0x0d, 0x4b, 0xa0, 0x6f,
+    0x78, 0x07, 0x09, 0x03, 0x84, 0xcf, 0x73, 0xf5, 0x61, 0x7e, 0x61, 0x8b,
+    0x9d, 0x3c, 0x60, 0x32, 0xa0, 0xa3, 0x18, 0x0c, 0xc6, 0x94, 0x03, 0x40,
+    0x48, 0x9d, 0x93, 0x68, 0x61, 0x8f, 0x75, 0x1b, 0x7a, 0x89, 0x20, 0xdc,
+    0x36, 0x99, 0x98, 0x0e, 0xa3, 0x03, 0xe9, 0x41, 0xc2, 0x65, 0xb8, 0xed,
+    0xb0, 0x06, 0x27, 0x97, 0x0f, 0x5e, 0xd2, 0x97, 0x60, 0x79, 0x77, 0x3c,
+    0x80, 0x5f, 0x8f, 0xf1, 0xce, 0x2d, 0x1b, 0x66, 0x54, 0x75, 0x0e, 0x1b,
+    0x3e, 0xcc, 0x44, 0xb4, 0x69, 0x98, 0x9f, 0x37, 0x9b, 0xdf, 0x3c, 0x0d,
+    0xeb, 0x3e, 0xb9, 0x82, 0x49, 0x56, 0x84, 0x53, 0x1b, 0x22, 0x57, 0xb5,
+    0x04, 0x23, 0xc9, 0xd7, 0xcf, 0xb9, 0xb8, 0x98, 0x92, 0xd7, 0xfe, 0x77,
+    0x2f, 0xf4, 0x64, 0x85, 0x40, 0x99, 0xe4, 0x77, 0x34, 0xa1, 0x08, 0xf7,
+    0x28, 0xe0, 0x23, 0x85, 0x5d, 0x34, 0x55, 0xb1, 0x3f, 0x9f, 0x5c, 0xcc,
+    0x76, 0x87, 0x13, 0xa5, 0xed, 0x10, 0xa9, 0x9e, 0x32, 0x42, 0xdb, 0x23,
+    0x5b, 0xfa, 0x80, 0x1a, 0xbb, 0x6e, 0xe7, 0x47, 0xaa, 0x06, 0x77, 0x6c,
+    0x2d, 0xd8, 0x1b, 0x2f, 0x36, 0x04, 0x18, 0x0d, 0x1a, 0x9b, 0xdf, 0xab,
+    0x2b, 0x34, 0xee, 0x38, 0xab, 0xaa, 0x04, 0x57, 0x50, 0xf4, 0xbd, 0x38,
+    0xe3, 0x49, 0x91, 0xcd, 0x37, 0x14, 0x2f, 0x42, 0x66, 0x32, 0x8e, 0xa1,
+    0x72, 0x3f, 0xda, 0xb0, 0x63, 0x17, 0xb7, 0x07, 0x7e, 0xe3, 0xc2, 0xd4,
+    0x50, 0xa8, 0xa2, 0x13, 0x11, 0x01, 0x74, 0xb1, 0xee, 0xe8, 0xae, 0x40,
+    0xcc, 0x25, 0x78, 0x08, 0x9d, 0x2e, 0xb2, 0x45, 0xb8, 0x8b, 0xa3, 0xab,
+    0xff, 0xd4, 0x89, 0x03, 0x07, 0x22, 0x67, 0x17, 0x86, 0xbd, 0xfe, 0x5e,
+    0xcc, 0xe2, 0x4e, 0xc3, 0x02, 0x96, 0xf1, 0x7a, 0xce, 0x54, 0x8d, 0x72,
+    0x2c, 0x14, 0xea, 0x4d, 0xee, 0x72, 0x8f, 0x72, 0x4a, 0xd6, 0x7a, 0xd3,
+    0xbf, 0xf8, 0xd4, 0xed, 0x24, 0xfc, 0x00, 0xf3, 0x47, 0xa7, 0x2a, 0x58,
+    0x80, 0xc3, 0xb1, 0x9b, 0xa1, 0xaa, 0xd3, 0xfc, 0xe2, 0x33, 0x29, 0x04,
+    0x60, 0x94, 0xd8, 0x0b, 0x3c, 0xa7, 0x7d, 0x2f, 0x27, 0xb3, 0xfc, 0x6a,
+    0x49, 0x5d, 0x2e, 0x0a, 0xbc, 0x01, 0x74, 0x8b, 0x8c, 0xda, 0x78, 0xdc,
+    0xfe, 0xcc, 0xf1, 0xca, 0x9e, 0x88, 0xdb, 0x59, 0xba, 0x62, 0x23, 0x29,
+    0xbc, 0xa2, 0x17, 0xb1, 0xfb, 0xe8, 0xa4, 0x12, 0x88, 0x99, 0xe3, 0x66,
+    0xf5, 0x9f, 0x31, 0x9a, 0x58, 0xfc, 0x7f, 0x9a, 0xb4, 0x42, 0x31, 0x2b,
+    0x61, 0x75, 0xd6, 0xb1, 0x4d, 0x6a, 0x30, 0x77, 0xb8, 0x37, 0xc3, 0x0c,
+    0xa6, 0xdf, 0xef, 0x3c, 0x86, 0x8f, 0x4f, 0x87, 0x04, 0x52, 0x31, 0x5d,
+    0x63, 0x43, 0x19, 0xa0, 0x23, 0x86, 0x59, 0xf6, 0x8b, 0x8b, 0x3e, 0xa6,
+    0x77, 0xe2, 0x94, 0xbb, 0xd9, 0x2f, 0x72, 0x54, 0xa3, 0xfc, 0x04, 0xcb,
+    0x02, 0x7f, 0x59, 0xaa, 0x76, 0x88, 0x91, 0x84, 0x13, 0xe7, 0x9b, 0x97,
+    0xe1, 0x5a, 0x1c, 0x34, 0x6d, 0xb2, 0x5a, 0x77, 0x85, 0x60, 0x09, 0xe1,
+    0x12, 0xa7, 0x5a, 0xac, 0xa0, 0x2f, 0x24, 0xd4, 0x1d, 0x7f, 0xe5, 0x38,
+    0x61, 0xea, 0xd5, 0xfe, 0xca, 0x51, 0xd6, 0x87, 0xc6, 0x2f, 0x63, 0x35,
+    0x22, 0x95, 0x46, 0x67, 0x12, 0x29, 0xdc, 0xf2, 0xa6, 0xbb, 0x02, 0xd4,
+    0x3c, 0x34, 0x94, 0x9f, 0xea, 0x2a, 0xa3, 0xeb, 0x10, 0xf3, 0xbf, 0x4e,
+    0x69, 0x01, 0x62, 0x39, 0x13, 0x98, 0x2d, 0x84, 0x7a, 0xd8, 0x35, 0x12,
+    0xe3, 0x7f, 0xfd, 0x78, 0xd2, 0x23, 0x86, 0xa8, 0x92, 0x05, 0xf1, 0x37,
+    0x1d, 0xb5, 0x77, 0xae, 0xf9, 0x75, 0x68, 0xd9, 0xd1, 0x27, 0x41, 0x5a,
+    0x81, 0x09, 0xcf, 0xa9, 0xf1, 0x67, 0x98, 0x84, 0xe4, 0x3d, 0xe1, 0x54,
+    0xaa, 0x1d, 0x6a, 0x79, 0x1e, 0x29, 0x9a, 0xd1, 0x43, 0x8e, 0x39, 0x3e,
+    0x1c, 0x38, 0x43, 0x29, 0x9a, 0xb4, 0x74, 0xb6, 0x5d, 0xcc, 0xcf, 0xde,
+    0x72, 0xf7, 0x46, 0xbd, 0xf5, 0xda, 0x87, 0x6c, 0x53, 0x38, 0x33, 0x9f,
+    0x4d, 0x21, 0x27, 0x9c, 0x9f, 0x49, 0x1e, 0xde, 0xcb, 0x94, 0x1b, 0x85,
+    0x10, 0x2e, 0x6c, 0x8a, 0x58, 0xde, 0x2b, 0xaf, 0xb7, 0xe0, 0x5b, 0xab,
+    0xbc, 0x80, 0xaf, 0xd4, 0x59, 0xaf, 0x0a, 0x9a, 0xf6, 0x7b, 0xb6, 0x80,
+    0x0e, 0xb1, 0x29, 0xb2, 0x2e, 0xb6, 0xa3, 0x46, 0xe7, 0xd1, 0xdb, 0xb0,
+    0xe7, 0x66, 0x17, 0xe5, 0x63, 0x96, 0x5a, 0xc5, 0xfe, 0x88, 0x5d, 0xf9,
+    0xe7, 0xe0, 0x8d, 0x13, 0xec, 0x0c, 0x85, 0x8b, 0x28, 0x5d, 0x91, 0x98,
+    0xd6, 0x19, 0xf1, 0x16, 0xf5, 0x01, 0x60, 0x70, 0x43, 0xe9, 0x59, 0x94,
+    0xff, 0x38, 0xcb, 0xf5, 0x47, 0x75, 0x70, 0x2e, 0x05, 0xb0, 0x6e, 0x77,
+    0x78, 0x4e, 0x9e, 0xf8, 0xbc, 0xf9, 0x3a, 0x32, 0xac, 0x41, 0x67, 0xb1,
+    0x17, 0xc2, 0x89, 0x0f, 0x95, 0x67, 0x37, 0xb5, 0xdc, 0x1b, 0x94, 0xd9,
+    0xa6, 0xe6, 0xdc, 0x6e, 0xbe, 0x1e, 0x9c, 0x97, 0x8d, 0x3b, 0xe6, 0x2c,
+    0xef, 0xbc, 0x95, 0x81, 0x61, 0xcd, 0x60, 0x93, 0x7b, 0xfd, 0x0a, 0x06,
+    0xb0, 0x87, 0x3f, 0x4e, 0xe5, 0xbc, 0x70, 0x15, 0x7c, 0xe9, 0xd4, 0x1d,
+    0xee, 0xbc, 0x32, 0x90, 0x03, 0x15, 0x34, 0xdc, 0x4a, 0x9f, 0x47, 0xa1,
+    0xdb, 0x63, 0xcc, 0x2b, 0x05, 0x8f, 0xa0, 0x74, 0x74, 0x7c, 0x98, 0x42,
+    0xd4, 0xc3, 0x6e, 0xeb, 0x11, 0x31, 0x93, 0xff, 0xcf, 0xff, 0x51, 0xf6,
+    0xe9, 0x7e, 0x6a, 0x88, 0xb4, 0x8d, 0x08, 0xb9, 0xd9, 0xbe, 0x4e, 0x9b,
+    0x0c, 0xf9, 0x4e, 0x24, 0x52, 0xe4, 0x9b, 0x38, 0x18, 0x02, 0xc7, 0xa0,
+    0xf1, 0xff, 0xdc, 0xd8, 0xcb, 0x50, 0x09, 0xd3, 0x5c, 0xf7, 0x30, 0x71,
+    0xec, 0xfd, 0x6e, 0xb1, 0x46, 0xb9, 0x3f, 0xde, 0x58, 0x03, 0xdc, 0xaf,
+    0x17, 0x85, 0x25, 0x67, 0x7f, 0xf6, 0x49, 0x92, 0x8f, 0x04, 0x84, 0x83,
+    0xb2, 0x36, 0x07, 0xcd, 0xfe, 0x32, 0xd0, 0x82, 0xe0, 0x49, 0xff, 0x64,
+    0x65, 0x64, 0x4d, 0xca, 0x90, 0xc3, 0xfc, 0x66, 0xc7, 0x52, 0x74, 0x83,
+    0x55, 0x29, 0xd2, 0xbf, 0xc6, 0x6b, 0x6a, 0xd8, 0x16, 0x77, 0x90, 0x68,
+    0x39, 0x90, 0xb7, 0xc7, 0xb9, 0x53, 0xa0, 0x2f, 0x50, 0x6c, 0x5f, 0xc3,
+    0x23, 0x1f, 0x89, 0x4e, 0x85, 0x33, 0x27, 0x98, 0xbb, 0x96, 0xb8, 0x4c,
+    0xf9, 0x6a, 0x60, 0xb5, 0xf3, 0x43, 0xc7, 0xa0, 0xab, 0x5c, 0x4b, 0xa0,
+    0x0d, 0x61, 0x4a, 0x3c, 0x4f, 0x08, 0x50, 0x81, 0xa4, 0x1c, 0x2b, 0xb8,
+    0x4a, 0xb7, 0xa5, 0xa6, 0x78, 0x45, 0x2c, 0xb9, 0xaa, 0x5d, 0xf0, 0x57,
+    0xac, 0x6e, 0x98, 0x23, 0x10, 0x0e, 0x3a, 0x4f, 0x60, 0xb4, 0x24, 0xe1,
+    0xaa, 0x93, 0x89, 0x9d, 0xbf, 0x8a, 0xc6, 0x7a, 0x7b, 0xbf, 0x89, 0x8d,
+    0x80, 0xa9, 0x3e, 0xd6, 0x25, 0xcf, 0xd5, 0x67, 0xf7, 0xae, 0xdd, 0x02,
+    0x28, 0x4c, 0xf5, 0xbc, 0xf9, 0x38, 0x58, 0x01, 0x10, 0xdd, 0x53, 0xa9,
+    0xc1, 0x74, 0xd9, 0xbe, 0xd7, 0x68, 0x0a, 0x72, 0x5d, 0x1a, 0xb7, 0x51,
+    0xf7, 0x74, 0x6a, 0xcf, 0xbc, 0x07, 0xd4, 0xda, 0xa4, 0xe3, 0xca, 0xb9,
+    0xe0, 0x0e, 0xdc, 0xc4, 0xf2, 0xc8, 0x8b, 0x8a, 0x1a, 0x57, 0x4f, 0x4e,
+    0x4e, 0xfa, 0xd0, 0x7c, 0x11, 0x8d, 0x6b, 0x46, 0xb7, 0xb3, 0x27, 0xf7,
+    0x4f, 0x5d, 0x6b, 0xa8, 0x6a, 0x92, 0x88, 0x08, 0x6f, 0x58, 0x57, 0xb8,
+    0x52, 0x21, 0xb9, 0xbd, 0xde, 0xbc, 0x4d, 0x7e, 0xdf, 0x3d, 0x68, 0x7a,
+    0x02, 0x0d, 0x3c, 0x71, 0x70, 0x6e, 0x3f, 0xf5, 0x32, 0xd3, 0x60, 0x2f,
+    0xd1, 0xb7, 0x0a, 0x9c, 0x98, 0x11, 0x5e, 0x25, 0xb6, 0xce, 0xed, 0x93,
+    0xd0, 0x17, 0xb1, 0x45, 0x40, 0x4f, 0x2b, 0xcb, 0x95, 0x91, 0xe0, 0xa1,
+    0x95, 0xa1, 0xc7, 0xf9, 0x7a, 0x98, 0xc1, 0x76, 0x31, 0xb7, 0x71, 0xde,
+    0x41, 0x7d, 0x69, 0xbe, 0x5e, 0xc0, 0xaf, 0xdc, 0x9a, 0xbb, 0x1c, 0x05,
+    0x18, 0xff, 0xa9, 0xfa, 0x3d, 0x6b, 0x82, 0x83, 0xa2, 0x2f, 0x2f, 0x24,
+    0x51, 0x6e, 0x7f, 0x97, 0x9c, 0x50, 0x98, 0x69, 0x4b, 0x57, 0x7d, 0x22,
+    0xca, 0x5e, 0x76, 0xcd, 0xe9, 0x05, 0xfa, 0x9a, 0x0a, 0x15, 0xc5, 0x5f,
+    0xff, 0xd3, 0xd9, 0x2e, 0xf7, 0x05, 0xff, 0xc8, 0x48, 0xef, 0x7e, 0xff,
+    0x8e, 0xbd, 0xf2, 0x37, 0xe7, 0xea, 0x46, 0xff, 0xc9, 0x81, 0xe2, 0xa6,
+    0x77, 0x83, 0x97, 0x8f, 0x4d, 0xfb, 0x95, 0xeb, 0x38, 0xce, 0x94, 0x29,
+    0xbb, 0xa0, 0xa6, 0x2e, 0x37, 0xb1, 0xbb, 0xca, 0x01, 0x07, 0x1b, 0x3f,
+    0xaf, 0x11, 0x49, 0x9f, 0x3f, 0x38, 0x53, 0x6c, 0x65, 0x4b, 0x9e, 0x5a,
+    0x7a, 0x34, 0x2a, 0xb5, 0x0f, 0x43, 0xec, 0x5d, 0x41, 0xe0, 0xe0, 0x06,
+    0x5f, 0x0a, 0xc7, 0xfd, 0x7c, 0x74, 0xcf, 0x86, 0x67, 0x0b, 0x15, 0x3b,
+    0x5a, 0x8c, 0xf9, 0x83, 0x78, 0xce, 0xcc, 0x07, 0x1d, 0x44, 0xb9, 0xa6,
+    0x90, 0xa7, 0x30, 0x3d, 0x8e, 0x18, 0x48, 0xcf, 0xeb, 0x68, 0xd9, 0x14,
+    0xbd, 0x66, 0xef, 0x17, 0x82, 0xd8, 0x7f, 0x2f, 0x7a, 0x25, 0x34, 0x50,
+    0x9d, 0x7c, 0xcd, 0x02, 0x2a, 0x0e, 0x12, 0x94, 0x97, 0x6d, 0x0a, 0x0e,
+    0x88, 0xee, 0x28, 0xe8, 0x53, 0x5a, 0x4d, 0xa1, 0xe9, 0xf5, 0x27, 0xe6,
+    0x3c, 0xc8, 0x73, 0x82, 0xc5, 0x92, 0xe9, 0xcb, 0x54, 0x75, 0xc9, 0x3c,
+    0x8d, 0x8a, 0xd1, 0xa1, 0x30, 0xfb, 0x35, 0xcb, 0x8c, 0x1b, 0x7f, 0x5c,
+    0x9e, 0xf3, 0x85, 0x46, 0x25, 0x4c, 0xa7, 0x39, 0xa5, 0x33, 0x7a, 0xbf,
+    0x3d, 0x69, 0x57, 0x7a, 0xaf, 0x8a, 0x1f, 0xfd, 0x0e, 0x7e, 0x80, 0x53,
+    0xd6, 0x85, 0x78, 0x86, 0xe8, 0xd6, 0xae, 0x1e, 0xd7, 0x02, 0x45, 0xca,
+    0xf4, 0x03, 0xcb, 0x72, 0xd7, 0xd8, 0x70, 0x85, 0x55, 0x87, 0x1e, 0x5a,
+    0xb8, 0xc2, 0x07, 0x63, 0x2b, 0x46, 0xf3, 0x6a, 0xa5, 0x0a, 0xde, 0xf3,
+    0x70, 0x2a, 0x34, 0x8e, 0x65, 0x47, 0xac, 0xf3, 0xed, 0xf7, 0x74, 0xcb,
+    0xbb, 0xb2, 0xcd, 0x4c, 0x8d, 0xe3, 0x88, 0x95, 0x51, 0x59, 0xd1, 0x71,
+    0x66, 0xff, 0x72, 0xd6, 0x33, 0x4c, 0x62, 0x4d, 0xbf, 0x83, 0xa5, 0x37,
+    0xfb, 0x33, 0xaf, 0xdd, 0xd2, 0x80, 0x32, 0xa7, 0x61, 0xdb, 0xf7, 0xf4,
+    0x3f, 0x1a, 0xb6, 0xd7, 0x0d, 0x60, 0xf2, 0x89, 0x29, 0xae, 0x2f, 0x96,
+    0x2a, 0x30, 0xb8, 0x62, 0x92, 0xee, 0xa7, 0x86, 0xe2, 0x06, 0xa3, 0x92,
+    0xbf, 0xe6, 0xbe, 0xd4, 0x67, 0xff, 0x38, 0xe5, 0x9c, 0xde, 0xef, 0x99,
+    0x8c, 0xea, 0xa2, 0x6b, 0x73, 0xa5, 0xa8, 0x3f, 0x3b, 0x79, 0x7d, 0xcd,
+    0x3f, 0x3e, 0xc5, 0xfc, 0x8b, 0x06, 0x94, 0xe3, 0x5d, 0x56, 0x91, 0x08,
+    0x13, 0xf3, 0x1a, 0x36, 0x8d, 0x79, 0xd2, 0x5f, 0x9b, 0x57, 0x43, 0xa2,
+    0x9b, 0x62, 0x2d, 0x4b, 0x38, 0x1e, 0x17, 0xe6, 0x3b, 0xc6, 0x65, 0x57,
+    0x1c, 0x28, 0x86, 0xc7, 0xdf, 0x5b, 0xe3, 0x6f, 0x96, 0x45, 0x0a, 0xd4,
+    0xdf, 0x0d, 0xff, 0x2d, 0xb0, 0x9d, 0x82, 0x23, 0xc4, 0x0c, 0x70, 0x64,
+    0x2e, 0xfd, 0xb6, 0xe3, 0xad, 0xe2, 0x1b, 0xb9, 0xc7, 0x13, 0xd5, 0xbd,
+    0x0d, 0xf5, 0x8d, 0xc3, 0xc5, 0xd7, 0xf3, 0xe2, 0xcf, 0x4a, 0x19, 0xb3,
+    0xd0, 0x54, 0x3d, 0x0e, 0x6e, 0xef, 0xc0, 0x37, 0xf9, 0xfb, 0x6a, 0x64,
+    0xea, 0x53, 0xcd, 0x17, 0x95, 0x59, 0xe0,
+};
+#define AV1_128X128_CRC (0xe16cf408U)
+
+/* 10 bit 4:2:0 192x192, crf 30, cdef and self guided restoration on v */
+static const uint8_t av1_192x192p10[7504] = {
+    0x12, 0x00, 0x0a, 0x0b, 0x00, 0x00, 0x00, 0x03, 0xbd, 0xfd, 0xf9, 0xf7,
+    0xf3, 0x80, 0x80, 0x32, 0xbe, 0x3a, 0x10, 0x00, 0xd6, 0xb7, 0x82, 0x10,
+    0x40, 0xc4, 0x01, 0x1c, 0x10, 0x3d, 0x00, 0x00, 0x1f, 0x0c, 0xaa, 0xbd,
+    0x3f, 0xbd, 0x73, 0x61, 0x9b, 0x40, 0x33, 0x3f, 0x50, 0xb8, 0x86, 0xf6,
+    0x06, 0xed, 0x8b, 0x2d, 0x3f, 0x10, 0x21, 0xae, 0xe5, 0xd3, 0xfe, 0x1b,
+    0xa7, 0xcb, 0x69, 0x20, 0x40, 0x91, 0xdf, 0x17, 0x08, 0xb2, 0x52, 0x30,
+    0x4a, 0x54, 0x89, 0xf1, 0x9d, 0x95, 0x4a, 0xeb, 0x8d, 0x30, 0xe1, 0x94,
+    0xdd, 0x65, 0xf8, 0x35, 0x9b, 0x93, 0x95, 0x98, 0x16, 0x9c, 0x88, 0xe1,
+    0x1d, 0x6f, 0x79, 0x30, 0xb8, 0xbd, 0x6b, 0x77, 0xe5, 0x4a, 0xe8, 0x3f,
+    0x80, 0x1f, 0xe4, 0xbb, 0x5e, 0x3d, 0x10, 0xb0, 0xe4, 0xb5, 0xcb, 0xc3,
+    0x74, 0x05, 0x8a, 0x41, 0xeb, 0x07, 0x5d, 0x33, 0xba, 0xc7, 0xf8, 0x9c,
+    0x2e, 0x62, 0xec, 0x0b, 0xb3, 0x42, 0x17, 0x53, 0xfa, 0x43, 0x1f, 0xc9,
+    0xdb, 0x91, 0x8f, 0x97, 0x6f, 0x69, 0xfb, 0x52, 0x3e, 0xe6, 0xa6, 0x9f,
+    0x31, 0x0f, 0x2b, 0x03, 0x51, 0xef, 0xde, 0xa7, 0x82, 0xa5, 0xe6, 0x91,
+    0x34, 0x0c, 0x09, 0xf5, 0xac, 0xdd, 0x45, 0x47, 0x67, 0x7a, 0xff, 0x65,
+    0x3b, 0xb8, 0x83, 0xcc, 0x74, 0x64, 0x66, 0x15, 0xb3, 0xdf, 0x45, 0x91,
+    0xeb, 0x7b, 0x11, 0x9b, 0x2c, 0x37, 0x5f, 0xa3, 0x47, 0xe5, 0x76, 0x73,
+    0xe6, 0xa7, 0xe2, 0x55, 0x83, 0xd0, 0xeb, 0xd7, 0x6b, 0xbc, 0x83, 0x76,
+    0x09, 0xef, 0x8b, 0x24, 0x69, 0xa0, 0x05, 0x7c, 0x7f, 0x17, 0xf4, 0xa6,
+    0x5b, 0x91, 0xd6, 0xca, 0xa0, 0x84, 0xfa, 0x23, 0xec, 0xac, 0xa4, 0xe7,
+    0x0a, 0xce, 0x24, 0xf6, 0xdc, 0x5c, 0x93, 0x32, 0x31, 0x1b, 0x5e, 0x6f,
+    0x01, 0xa4, 0x0a, 0xbb, 0x4c, 0xd5, 0xc9, 0xf9, 0x38, 0x51, 0x15, 0x76,
+    0x12, 0x6f, 0x52, 0x4d, 0x67, 0xf1, 0x5b, 0x7c, 0x16, 0xa9, 0x62, 0xae,
+    0xb3, 0x20, 0x5a, 0x1a, 0x94, 0x3d, 0x5a, 0xda, 0x3e, 0x97, 0xb3, 0xc9,
+    0x9a, 0x22, 0x5d, 0xce, 0x7a, 0x36, 0xb0, 0xea, 0xb8, 0x02, 0xd9, 0x4f,
+    0x38, 0xd2, 0x6c, 0x1b, 0xa0, 0x53, 0x5a, 0xf1, 0x78, 0x21, 0x9d, 0xec,
+    0x35, 0x67, 0x3f, 0x10, 0xa6, 0xa0, 0xea, 0x2d, 0x9f, 0x20, 0x13, 0xf4,
+    0x2e, 0xa2, 0xb8, 0x79, 0xb1, 0x08, 0x42, 0xe7, 0x43, 0x0a, 0xc8, 0x1c,
+    0x02, 0x6d, 0x6b, 0x11, 0xe4, 0xff, 0x77, 0xd2, 0x8a, 0x65, 0xd0, 0x94,
+    0xf3, 0x03, 0x7f, 0xb0, 0xa7, 0xfe, 0xaf, 0x8d, 0xe5, 0x86, 0x9a, 0xfc,
+    0x6e, 0xf5, 0x0f, 0x91, 0x36, 0xf8, 0x1e, 0xd6, 0x23, 0xcb, 0xea, 0x8a,
+    0xb4, 0x93, 0x5d, 0xbb, 0xd3, 0xfd, 0xc8, 0xf4, 0xc1, 0x09, 0xbd, 0xcc,
+    0x7b, 0xd6, 0xea, 0x7a, 0x2b, 0xb4, 0x94, 0x53, 0x69, 0xfd, 0x37, 0x14,
+    0xfa, 0xe9, 0xb8, 0x75, 0x2a, 0x21, 0x83, 0x30, 0x4b, 0x92, 0x34, 0xb2,
+    0x80, 0x62, 0x8a, 0x8d, 0xd1, 0xf8, 0x2d, 0x12, 0x52, 0x16, 0xfa, 0xf4,
+    0xc0, 0xd6, 0x06, 0xc9, 0x93, 0x18, 0x61, 0x7e, 0xfa, 0xc6, 0x20, 0x5d,
+    0x15, 0xf8, 0x83, 0xe2, 0x79, 0x9a, 0xd2, 0x82, 0x50, 0x89, 0xe0, 0x10,
+    0x85, 0x60, 0x03, 0x30, 0x35, 0xdc, 0x94, 0x72, 0xbf, 0xd6, 0xeb, 0xc4,
+    0xb7, 0x25, 0x75, 0x5b, 0x28, 0xaf, 0x88, 0x6f, 0x80, 0x5e, 0x88, 0x0c,
+    0xba, 0x1c, 0x06, 0x5a, 0xbf, 0xb6, 0x84, 0x59, 0x44, 0x7a, 0x16, 0x4d,
+    0x02, 0xea, 0x53, 0x15, 0xb7, 0xaf, 0x03, 0x94, 0xc9, 0x01, 0xde, 0x59,
+    0xc9, 0x30, 0xa5, 0xe5, 0x52, 0x38, 0xda, 0xac, 0xbe, 0x87, 0x4e, 0x80,
+    0x07, 0xe1, 0x86, 0x99, 0xec, 0xc0, 0xaa, 0xba, 0xf1, 0xc2, 0x3b, 0x94,
+    0x35, 0xab, 0x13, 0xdc, 0x34, 0xc2, 0x19, 0x00, 0xcb, 0x10, 0xc5, 0x5d,
+    0xa7, 0x75, 0xf7, 0x49, 0x5b, 0x19, 0x5f, 0xab, 0x6c, 0xe0, 0xd4, 0x16,
+    0x30, 0x43, 0x6a, 0xb6, 0x8c, 0xc8, 0x14, 0x38, 0x77, 0x89, 0xdd, 0x88,
+    0x7d, 0xc6, 0x7a, 0xf1, 0x7f, 0x44, 0xf1, 0x7a, 0xf8, 0x0e, 0xc8, 0x0d,
+    0xcc, 0x6b, 0xac, 0xe9, 0x4b, 0xd2, 0x56, 0xab, 0x67, 0xe9, 0x38, 0x91,
+    0xdd, 0xe2, 0x65, 0x73, 0xf6, 0xf1, 0xef, 0xe3, 0x3f, 0x0c, 0x30, 0x9b,
+    0x4a, 0x76, 0x8c, 0xb8, 0x46, 0x38, 0xf3, 0x24, 0x7c, 0x9f, 0xef, 0xe6,
+    0xdf, 0xc1, 0x46, 0xd0, 0xf7, 0xcf, 0x74, 0x3f, 0x57, 0x88, 0x99, 0x98,
+    0xc3, 0x51, 0x81, 0xaa, 0xa0, 0x6c, 0x16, 0xef, 0x18, 0x7a, 0x89, 0x6e,
+    0x9c, 0x6c, 0xf2, 0xbb, 0x57, 0x2b, 0x43, 0xd7, 0xac, 0x9d, 0x63, 0xe1,
+    0xdd, 0x5c, 0x80, 0xe0, 0x7b, 0x22, 0x87, 0x32, 0x56, 0x0d, 0x3a, 0x26,
+    0xd7, 0x52, 0x1e, 0x15, 0x93, 0xbb, 0xc6, 0xe3, 0x38, 0x63, 0x18, 0x04,
+    0x81, 0x4d, 0xdd, 0xf0, 0xe6, 0xae, 0xe1, 0xd3, 0x9f, 0x4d, 0x1b, 0xe4,
+    0x07, 0x11, 0x58, 0x0a, 0x5e, 0x2b, 0x19, 0xc4, 0xdd, 0xc0, 0x72, 0xa9,
+    0x7e, 0xd0, 0x34, 0x83, 0x29, 0x76, 0x60, 0x34, 0x8f, 0xc2, 0x78, 0x95,
+    0x54, 0xa3, 0xde, 0x7c, 0x94, 0x78, 0x02, 0x88, 0xa5, 0x7c, 0xd5, 0x3d,
+    0x8a, 0x51, 0x79, 0xc5, 0x69, 0x00, 0x72, 0x52, 0xd3, 0xd3, 0x73, 0x35,
+    0x23, 0x0d, 0xd7, 0x10, 0x01, 0xb0, 0xec, 0xc7, 0x24, 0x6b, 0x77, 0x03,
+    0x63, 0xc9, 0x39, 0xbb, 0x10, 0xbe, 0xaf, 0x56, 0xa1, 0x90, 0xc2, 0x8d,
+    0xb8, 0x85, 0xf9, 0x1d, 0xbe, 0x3b, 0xed, 0x8e, 0x5d, 0x28, 0x43, 0x3f,
+    0x55, 0x5b, 0x20, 0xdd, 0xb2, 0xb7, 0xf6, 0x74, 0x0c, 0x11, 0x01, 0x03,
+    0xbd, 0x9d, 0xda, 0xe0, 0x15, 0x13, 0x11, 0xe1, 0x33, 0xab, 0xb0, 0x8d,
+    0x4a, 0xca, 0xd1, 0xb8, 0xfc, 0x65, 0x49, 0x67, 0xd8, 0x71, 0x88, 0x24,
+    0x25, 0x62, 0xe9, 0x23, 0x82, 0xcc, 0x8f, 0x13, 0x5c, 0x62, 0x90, 0xda,
+    0x7c, 0x6b, 0x15, 0x73, 0x01, 0x67, 0x7e, 0x38, 0xa9, 0xba, 0x79, 0xf0,
+    0xc2, 0x1b, 0x74, 0x4d, 0x7e, 0xdc, 0x80, 0x16, 0x00, 0xa3, 0x26, 0x82,
+    0x85, 0x79, 0x2c, 0xd0, 0xc7, 0x45, 0x71, 0xea, 0xc4, 0xca, 0xc3, 0xf7,
+    0x80, 0x41, 0xd8, 0x8a, 0x61, 0x5a, 0xdf, 0xa7, 0x58, 0xf2, 0x45, 0xd9,
+    0xec, 0x65, 0x63, 0x55, 0x84, 0xad, 0xf2, 0x68, 0x26, 0xcd, 0x36, 0x3f,
+    0x95, 0xda, 0x91, 0xdc, 0xbe, 0xaf, 0xbc, 0xad, 0xa4, 0x4e, 0x00, 0xd9,
+    0x74, 0xf4, 0xbb, 0xa9, 0x59, 0xd0, 0xfa, 0x77, 0x56, 0x47, 0x2d, 0xa0,
+    0x14, 0x10, 0xc2, 0x69, 0x64, 0x51, 0x43, 0x4e, 0xc8, 0x8f, 0xa6, 0x62,
+    0xc6, 0xef, 0xa4, 0x3e, 0x44, 0xa9, 0x07, 0xd9, 0x3f, 0x72, 0xc5, 0x61,
+    0x25, 0x75, 0x27, 0x3f, 0xd4, 0x49, 0x3c, 0x2a, 0xb5, 0xf9, 0xbf, 0x54,
+    0x72, 0x78, 0x9b, 0xad, 0x8e, 0x01, 0xde, 0x0a, 0x58, 0x6c, 0x60, 0x59,
+    0x09, 0x8a, 0x27, 0x2d, 0x63, 0x38, 0x3e, 0x3b, 0x47, 0x89, 0x38, 0xfc,
+    0xf5, 0x77, 0xae, 0x2c, 0x86, 0x24, 0xd6, 0xe0, 0x13, 0xcb, 0x1b, 0x25,
+    0xc0, 0xe4, 0xb9, 0x72, 0xdb, 0x77, 0x4a, 0xb7, 0x58, 0xef, 0x01, 0x13,
+    0x1f, 0x56, 0x6c, 0x5c, 0x5d, 0x45, 0xdc, 0xd2, 0xce, 0xca, 0xc9, 0xfd,
+    0x4e, 0x48, 0xba, 0xe4, 0x82, 0x4a, 0xd7, 0x65, 0x56, 0x63, 0xf4, 0xff,
+    0x14, 0xaa, 0x52, 0xba, 0x01, 0xcb, 0x91, 0x1d, 0x7b, 0xe3, 0x79, 0xef,
+    0x20, 0x26, 0x2d, 0xf7, 0xb5, 0x0f, 0x41, 0xa0, 0xca, 0x4a, 0xa1, 0x2a,
+    0x42, 0xc9, 0xa1, 0x35, 0x3d, 0xf6, 0xa8, 0xe2, 0x4a, 0x9e, 0x4b, 0x14,
+    0x45, 0xc2, 0x9a, 0x80, 0x50, 0x67, 0xd4, 0x44, 0xcf, 0x2f, 0xcd, 0x02,
+    0x8d, 0x4c, 0xa3, 0xc4, 0x0e, 0x75, 0x6c, 0x38, 0xaa, 0x47, 0x17, 0x21,
+    0x99, 0x69, 0x9e, 0x8e, 0x8d, 0xa4, 0xdf, 0x20, 0x0d, 0x6a, 0xb6, 0x31,
+    0x39, 0xd5, 0x16, 0x93, 0x0c, 0x15, 0xdb, 0xfa, 0xa7, 0x14, 0x1d, 0xda,
+    0x31, 0x6a, 0xe0, 0xf8, 0x68, 0xa8, 0xf7, 0x5a, 0xf9, 0xf9, 0xe0, 0x54,
+    0x5f, 0x10, 0x1b, 0xcb, 0xec, 0x9b, 0x91, 0xff, 0x04, 0x64, 0xcf, 0x1e,
+    0x0c, 0x96, 0x47, 0x15, 0xe5, 0x5b, 0xdc, 0x6e, 0xcc, 0xb7, 0xc2, 0xc8,
+    0x1e, 0x08, 0xd7, 0x37, 0x30, 0x70, 0x85, 0x59, 0xe5, 0x74, 0xbd, 0x51,
+    0x5f, 0x06, 0xc6, 0x63, 0x34, 0x91, 0x47, 0xe2, 0x31, 0x1b, 0x6a, 0x8e,
+    0x93, 0xd0, 0x35, 0x20, 0x01, 0xd9, 0x06, 0x51, 0xf4, 0x3e, 0xd6, 0xc2,
+    0x34, 0xd4, 0xcb, 0x09, 0x6f, 0xd2, 0x10, 0x3d, 0x8a, 0x19, 0xbb, 0x7a,
+    0xbf, 0x21, 0x8b, 0x2a, 0x37, 0x97, 0x38, 0x91, 0x05, 0x90, 0xd2, 0xcf,
+    0x55, 0x51, 0xdd, 0xfe, 0x1a, 0x88, 0xd8, 0x85, 0x28, 0x98, 0x66, 0x17,
+    0x68, 0x0f, 0x0c, 0x00, 0x5e, 0x70, 0x25, 0x2e, 0x33, 0x12, 0x8e, 0xe6,
+    0xbd, 0x7d, 0x34, 0xb0, 0x7d, 0xd7, 0xcb, 0xd3, 0x09, 0x46, 0xe8, 0x9f,
+    0x96, 0x10, 0x29, 0x12, 0x79, 0xcb, 0x38, 0x77, 0x07, 0xe6, 0x8b, 0xd9,
+    0xe6, 0x3d, 0x81, 0x56, 0xb8, 0x32, 0xb5, 0x05, 0x80, 0x4c, 0xc1, 0x87,
+    0x41, 0xa0, 0x8d, 0x9a, 0xbf, 0x09, 0x2e, 0x22, 0x2c, 0xce, 0xdc, 0xd7,
+    0xb9, 0x98, 0xd5, 0xff, 0xd7, 0xf1, 0x54, 0x20, 0x18, 0x3d, 0x88, 0x8f,
+    0x90, 0xf6, 0x59, 0xb1, 0x56, 0x2b, 0x19, 0xfe, 0x6d, 0xeb, 0x8d, 0x1b,
+    0x9a, 0x9a, 0x17, 0x63, 0xd2, 0x16, 0x1b, 0xbc, 0x71, 0x74, 0x8d, 0xfe,
+    0xab, 0xba, 0x13, 0x55, 0x6c, 0x9d, 0xff, 0x07, 0x5f, 0x28, 0x48, 0xdf,
+    0x6e, 0x57, 0x63, 0xbe, 0x02, 0xd5, 0xf8, 0x87, 0x4f, 0xed, 0x54, 0xaa,
+    0x0b, 0x6f, 0x44, 0x00, 0x4a, 0x8b, 0xc0, 0x06, 0x45, 0xb2, 0xd7, 0x21,
+    0x0d, 0x0b, 0xb0, 0x18, 0xd7, 0x2f, 0x2f, 0x92, 0x09, 0x4d, 0xfb, 0xd3,
+    0x9e, 0x42, 0x02, 0x50, 0x9a, 0x12, 0xe3, 0x1e, 0xc0, 0xb7, 0xc1, 0x57,
+    0xb4, 0xda, 0x1c, 0x65, 0x85, 0x6a, 0x10, 0x6b, 0x72, 0x11, 0x00, 0x52,
+    0xd9, 0xff, 0x57, 0x23, 0x8f, 0x1a, 0xfc, 0xfa, 0xb2, 0x36, 0x1c, 0xf2,
+    0xfc, 0xc7, 0x85, 0x12, 0xf0, 0xbc, 0xac, 0x32, 0xd8, 0x6e, 0x71, 0x98,
+    0x0a, 0x49, 0x8a, 0x68, 0x62, 0xda, 0x40, 0x8e, 0x46, 0x01, 0x42, 0x83,
+    0x46, 0x05, 0x61, 0xab, 0xf0, 0x62, 0x8a, 0x85, 0x35, 0xb6, 0xb3, 0xe8,
+    0xab, 0x12, 0x20, 0x30, 0x8c, 0x93, 0xc4, 0x35, 0x6f, 0x68, 0x9d, 0x26,
+    0x0b, 0xb5, 0xe0, 0x18, 0xd6, 0x09, 0xa3, 0x5f, 0x70, 0xbb, 0x43, 0xdb,
+    0xa1, 0x17, 0x6f, 0x31, 0x00, 0x9e, 0x39, 0xd0, 0xf7, 0x96, 0xfb, 0x2f,
+    0xcf, 0x78, 0xfe, 0xd0, 0xfe, 0xd7, 0xcf, 0x1d, 0xcf, 0xfd, 0x8f, 0xcc,
+    0xe1, 0x07, 0x3d, 0x6e, 0x46, 0xad, 0xb0, 0xf6, 0x57, 0x9d, 0x61, 0xa3,
+    0x2f, 0x3d, 0x18, 0xc7, 0x67, 0xdc, 0x79, 0x9a, 0x2e, 0x91, 0x62, 0x38,
+    0xd4, 0x3c, 0x67, 0x79, 0x12, 0x81, 0xd0, 0x9f, 0x33, 0x55, 0x6c, 0xc1,
+    0x96, 0x1c, 0xe6, 0x0a, 0x1b, 0x9f, 0x58, 0x4f, 0xcd, 0xc3, 0x1b, 0x7e,
+    0xd8, 0x30, 0x67, 0x2a, 0x13, 0x11, 0x2c, 0xe2, 0x91, 0x52, 0x0f, 0x78,
+    0xe2, 0xaa, 0xaa, 0x41, 0xaf, 0xca, 0x8f, 0x9b, 0x8b, 0xce, 0xca, 0xfd,
+    0x1f, 0x7c, 0x25, 0xd7, 0xc6, 0x74, 0x5f, 0x7c, 0x03, 0x34, 0xfe, 0x70,
+    0xe6, 0xd5, 0xce, 0x40, 0xde, 0x7d, 0xde, 0x62, 0x5a, 0x10, 0x99, 0xb3,
+    0x57, 0xd9, 0x5f, 0x40, 0x6f, 0x5a, 0x6c, 0xbf, 0xa8, 0x4d, 0xa9, 0x47,
+    0xbc, 0x0e, 0x8b, 0xe8, 0xdd, 0xed, 0x0f, 0xc5, 0x02, 0x5b, 0x4b, 0xe6,
+    0x7d, 0xa1, 0x8b, 0xfd, 0x78, 0xbc, 0x8c, 0xbb, 0xb8, 0xf8, 0xe3, 0x09,
+    0xca, 0x1d, 0x44, 0x12, 0x69, 0x12, 0x3e, 0x08, 0xd3, 0x13, 0xe7, 0x89,
+    0x4c, 0xba, 0x40, 0x78, 0xdb, 0x91, 0x35, 0x82, 0x6f, 0xe8, 0x39, 0x8a,
+    0xf9, 0xa1, 0x9c, 0x58, 0x3e, 0x87, 0xa9, 0xe0, 0x9a, 0x7d, 0x0c, 0x68,
+    0x30, 0xbc, 0x50, 0x53, 0x67, 0xce, 0x55, 0x64, 0xef, 0x78, 0x18, 0x4d,
+    0x75, 0x65, 0x47, 0x4f, 0xc6, 0xd3, 0xff, 0x23, 0x3e, 0x2b, 0xfa, 0x7b,
+    0xc3, 0x56, 0x92, 0x47, 0x6d, 0x58, 0xd8, 0x55, 0x2a, 0x7b, 0x67, 0x8b,
+    0x88, 0x43, 0xf1, 0x1c, 0x25, 0x96, 0xe5, 0x7a, 0xd7, 0x35, 0x09, 0x29,
+    0x97, 0x76, 0x6a, 0x9e, 0x67, 0x91, 0xfa, 0xd1, 0x24, 0x25, 0xbc, 0x1b,
+    0x8c, 0x7e, 0x57, 0x6a, 0x4b, 0x7d, 0x6d, 0xd5, 0x3e, 0x76, 0xe3, 0x54,
+    0xed, 0x6b, 0x61, 0x75, 0x63, 0x70, 0x1b, 0x04, 0x9e, 0x45, 0x72, 0x6a,
+    0x69, 0x30, 0xce, 0xbf, 0xd9, 0x75, 0x9e, 0xfc, 0xc6, 0x98, 0xf3, 0xda,
+    0xc7, 0x3a, 0x88, 0x9b, 0x79, 0xa5, 0xca, 0x43, 0x2f, 0xaf, 0x6f, 0x71,
+    0xa5, 0x8d, 0x2e, 0xed, 0xf2, 0xad, 0xc8, 0x23, 0x7a, 0x44, 0xfb, 0x79,
+    0xfc, 0x4d, 0x63, 0xa3, 0x51, 0x89, 0x9b, 0xa8, 0x6e, 0xb2, 0x54, 0xe1,
+    0x69, 0x20, 0x3e, 0x8a, 0x69, 0x46, 0x3e, 0xd2, 0x27, 0xf8, 0xf7, 0x43,
+    0xb9, 0xd0, 0xa9, 0xeb, 0x0b, 0xba, 0x6e, 0x78, 0xcb, 0xab, 0xa0, 0x30,
+    0x31, 0x14, 0xb5, 0x2c, 0x84, 0x81, 0x13, 0x14, 0xd6, 0xf3, 0x00, 0xf9,
+    0x83, 0x79, 0xde, 0xe8, 0x86, 0x81, 0x03, 0x54, 0x71, 0x31, 0xe1, 0xad,
+    0x00, 0x91, 0xff, 0xab, 0xad, 0x64, 0x27, 0xb8, 0xdd, 0x9c, 0x50, 0x43,
+    0x62, 0x2a, 0x13, 0xb9, 0x36, 0xc7, 0xdd, 0x4b, 0x52, 0x34, 0x45, 0x80,
+    0xa1, 0x53, 0x57, 0xee, 0x21, 0x71, 0x18, 0x42, 0x07, 0x42, 0x23, 0x82,
+    0x3d, 0x8d, 0x34, 0x90, 0x25, 0x35, 0x44, 0x64, 0x2c, 0x8e, 0x15, 0xfe,
+    0x3a, 0x4c, 0x73, 0x3e, 0x46, 0x47, 0xd0, 0xae, 0xfa, 0x26, 0x49, 0xe6,
+    0xcf, 0x5d, 0x1f, 0xac, 0x01, 0xbc, 0xd3, 0xf6, 0xd8, 0xc5, 0x39, 0x9e,
+    0xce, 0x42, 0x04, 0x86, 0x78, 0xa1, 0xbb, 0x4f, 0xb1, 0xcc, 0xc0, 0x21,
+    0xef, 0x4b, 0xd0, 0x6f, 0x2f, 0x90, 0x73, 0x62, 0x5d, 0x33, 0xfc, 0x7e,
+    0xf3, 0xa7, 0xf3, 0x84, 0x08, 0x93, 0xe9, 0x76, 0x31, 0xfb, 0x5a, 0x14,
+    0x3f, 0x1a, 0x80, 0xdf, 0x66, 0x84, 0x1a, 0x1c, 0x94, 0x9f, 0x7a, 0x1a,
+    0x70, 0x61, 0x65, 0x4e, 0x8a, 0x72, 0x25, 0xf1, 0x7b, 0x89, 0x62, 0xff,
+    0xdf, 0xe4, 0x13, 0xcd, 0x08, 0xfe, 0x10, 0xf7, 0x04, 0xae, 0xbe, 0xed,
+    0x40, 0x34, 0xcd, 0x0f, 0xf2, 0xf6, 0x9b, 0x50, 0xb4, 0x97, 0x9e, 0x8f,
+    0xd3, 0xf9, 0xf2, 0x6b, 0xf9, 0xfd, 0x50, 0xca, 0xb4, 0x67, 0xd4, 0x87,
+    0x69, 0x2e, 0xb3, 0x3d, 0xe7, 0xe2, 0x63, 0xfe, 0xf0, 0x42, 0xca, 0x6e,
+    0xb3, 0xf8, 0x5c, 0xd0, 0x1d, 0x76, 0x21, 0xe7, 0xab, 0x10, 0x18, 0xa8,
+    0x8a, 0x5b, 0x57, 0xac, 0x17, 0x32, 0xf0, 0xd8, 0xf5, 0x0f, 0x57, 0xda,
+    0x18, 0x24, 0x6a, 0xbb, 0x88, 0x88, 0x36, 0xe3, 0xf3, 0x15, 0x75, 0xea,
+    0xdb, 0x56, 0x5a, 0x74, 0x9e, 0xdc, 0xe5, 0x78, 0x28, 0xce, 0x0f, 0x09,
+    0x0d, 0x0c, 0xd6, 0xc2, 0x53, 0x4c, 0x5c, 0x43, 0xb9, 0x25, 0xf4, 0x8b,
+    0x9b, 0x74, 0xb3, 0xfc, 0x16, 0x4e, 0x50, 0x1b, 0x64, 0x60, 0xbb, 0x46,
+    0xd4, 0xd6, 0xc0, 0xdb, 0xc0, 0xa1, 0x34, 0x55, 0xfc, 0x45, 0xde, 0x95,
+    0xc5, 0xde, 0x18, 0x3c, 0x3f, 0x91, 0x04, 0xa9, 0xbd, 0x77, 0x50, 0xb5,
+    0xcb, 0x34, 0xb5, 0xe1, 0x35, 0x5f, 0x18, 0xc8, 0x03, 0x17, 0x86, 0x39,
+    0x0d, 0x84, 0xb2, 0xc5, 0x34, 0xa4, 0xb3, 0xd4, 0xb5, 0x9b, 0x57, 0x89,
+    0xc1, 0xe6, 0xcd, 0xab, 0x85, 0xbf, 0x94, 0x60, 0xbc, 0xa9, 0x58, 0x32,
+    0x93, 0x6d, 0x13, 0xf1, 0xb6, 0xb2, 0x27, 0x3c, 0x0b, 0x9d, 0x06, 0x88,
+    0x2a, 0x5f, 0x23, 0x48, 0x93, 0x11, 0x67, 0xb6, 0x94, 0xbf, 0x12, 0x1c,
+    0x59, 0x21, 0x39, 0xcf, 0xf0, 0x29, 0x7c, 0x78, 0x99, 0x80, 0x39, 0x53,
+    0x83, 0x30, 0x6f, 0xab, 0x78, 0x86, 0x21, 0x42, 0x4c, 0x74, 0x0f, 0x75,
+    0x63, 0x4c, 0x41, 0xae, 0x9f, 0xfd, 0x27, 0x0e, 0x4f, 0xf5, 0xfa, 0xd5,
+    0x40, 0x37, 0xe6, 0x36, 0x66, 0x7b, 0x98, 0xf5, 0xcc, 0x3a, 0x35, 0xac,
+    0x26, 0x36, 0x70, 0xf4, 0x23, 0x28, 0xf1, 0xe7, 0x86, 0x33, 0x53, 0x38,
+    0x17, 0xda, 0x25, 0x12, 0x18, 0xe1, 0x17, 0x6d, 0x12, 0x6d, 0x02, 0xe8,
+    0x6d, 0x26, 0xa7, 0xe8, 0x80, 0xe0, 0xe6, 0x6c, 0xf2, 0xa9, 0x59, 0xae,
+    0x53, 0x64, 0xa4, 0xb2, 0x48, 0x7e, 0x8b, 0x16, 0xc2, 0x24, 0x50, 0xc7,
+    0x11, 0x2b, 0x5c, 0xf4, 0x0a, 0x25, 0xac, 0x5c, 0x12, 0x53, 0xb8, 0xe4,
+    0x66, 0xd9, 0x6b, 0x2f, 0xda, 0x13, 0x27, 0x10, 0xd1, 0x69, 0x20, 0x1b,
+    0x23, 0xf1, 0x36, 0xf8, 0xa7, 0x5c, 0x84, 0x2a, 0x1d, 0x32, 0xec, 0x92,
+    0x8d, 0x0a, 0xf4, 0x65, 0xa1, 0x11, 0xb8, 0x9b, 0xdb, 0x0b, 0x97, 0xcd,
+    0x4d, 0x59, 0xa4, 0x89, 0xe5, 0xac, 0x29, 0x2b, 0xe0, 0xa9, 0xc0, 0x40,
+    0x3f, 0x1f, 0xd1, 0x39, 0xfd, 0xe2, 0x03, 0x5e, 0xf0, 0xae, 0xdb, 0x33,
+    0x3d, 0x7e, 0x4a, 0xf8, 0xf1, 0x96, 0xcd, 0xc5, 0xfa, 0x00, 0x63, 0xb0,
+    0xbb, 0x37, 0x9a, 0x89, 0x32, 0x4d, 0xee, 0x5d, 0x63, 0xb2, 0x05, 0xdd,
+    0x26, 0x12, 0x15, 0xd5, 0x7e, 0x6b, 0x3c, 0x2f, 0x81, 0x43, 0x81, 0x54,
+    0x4d, 0x59, 0xc4, 0x7c, 0x69, 0x70, 0xe8, 0x20, 0x31, 0x31, 0x03, 0x5c,
+    0xad, 0x3b, 0x8e, 0x36, 0x73, 0xe5, 0xa6, 0x9e, 0x11, 0xe6, 0x14, 0x2a,
+    0x81, 0xc9, 0x1f, 0x7f, 0x84, 0xe0, 0xab, 0x5e, 0x04, 0x84, 0xae, 0xf1,
+    0x4c, 0xea, 0x75, 0x57, 0x56, 0x2c, 0x78, 0xcb, 0xa3, 0xa6, 0x02, 0x33,
+    0x4c, 0xf9, 0xb1, 0x32, 0x8c, 0x5c, 0x5f, 0x89, 0xd5, 0xc3, 0x5c, 0x6b,
+    0xb9, 0x4a, 0xe7, 0x8e, 0xdc, 0xd4, 0xd1, 0x40, 0x97, 0xa2, 0x25, 0x41,
+    0xa4, 0xca, 0x5b, 0xe7, 0xd4, 0x97, 0xef, 0x9a, 0x9c, 0x49, 0x06, 0xbc,
+    0xc6, 0xf8, 0x7f, 0x5f, 0xfd, 0x0f, 0xca, 0x99, 0x1a, 0x4f, 0x7d, 0xee,
+    0x68, 0xeb, 0xda, 0xd8, 0x83, 0x8a, 0xa0, 0xa4, 0xd8, 0x6e, 0x9d, 0xcd,
+    0x3f, 0xf8, 0xb2, 0x54, 0xb1, 0x2f, 0xc2, 0xf2, 0x1f, 0xcf, 0x0d, 0x32,
+    0xdc, 0x30, 0x39, 0x37, 0x1e, 0x97, 0xce, 0x95, 0x90, 0x6b, 0x08, 0xc4,
+    0x84, 0x35, 0x30, 0xe8, 0xa5, 0x5b, 0xe6, 0xdd, 0x75, 0x69, 0x55, 0xb7,
+    0xc7, 0x91, 0x09, 0x77, 0xe8, 0xfa, 0x4f, 0xf6, 0x65, 0x7e, 0xa5, 0xcc,
+    0x9b, 0xbd, 0x9c, 0xa3, 0x79, 0xd6, 0xec, 0xc3, 0x80, 0x3b, 0x8b, 0xad,
+    0xd7, 0xef, 0x25, 0x22, 0x76, 0x23, 0x76, 0xb6, 0x47, 0xe7, 0x95, 0x20,
+    0x45, 0x72, 0xe8, 0xc4, 0x9f, 0x20, 0x3d, 0xe4, 0x91, 0x9c, 0x24, 0xc4,
+    0xc4, 0x74, 0x20, 0x52, 0xc0, 0x87, 0xfb, 0xab, 0xb9, 0xb9, 0x7a, 0xc3,
+    0xe2, 0x32, 0x09, 0x62, 0x00, 0xd3, 0x83, 0xe4, 0xda, 0x28, 0x4c, 0x8f,
+    0x35, 0x6c, 0xb8, 0x77, 0xff, 0x10, 0xf1, 0x33, 0xd9, 0xaf, 0x7b, 0x68,
+    0xbf, 0x8d, 0x0c, 0x55, 0x51, 0x19, 0xc1, 0x7e, 0xf0, 0x7b, 0x03, 0xc6,
+    0xb6, 0x03, 0x7f, 0xc8, 0x6d, 0xf2, 0xe7, 0x85, 0x97, 0x1d, 0x54, 0xf3,
+    0xbf, 0x6b, 0xf7, 0x9b, 0xd0, 0xbd, 0x15, 0xa0, 0x30, 0x23, 0x61, 0xef,
+    0x9c, 0x25, 0xb2, 0x08, 0xd3, 0xaf, 0xf2, 0x10, 0x22, 0x5f, 0x60, 0xcd,
+    0x0b, 0xad, 0xdd, 0xe0, 0xd5, 0xa1, 0xfb, 0x2b, 0xab, 0x50, 0x96, 0x48,
+    0x82, 0x7c, 0x53, 0x7b, 0x9f, 0x57, 0x04, 0x04, 0x70, 0xe6, 0xb5, 0xbf,
+    0x25, 0x55, 0xb4, 0x7d, 0xfc, 0x7c, 0x4c, 0xc6, 0xef, 0x2f, 0x7b, 0x18,
+    0x4d, 0xb1, 0xc5, 0x05, 0xfc, 0xd0, 0xb0, 0x56, 0xda, 0x3b, 0x60, 0xb0,
+    0xe0, 0xa0, 0x28, 0x92, 0x30, 0x8b, 0x6c, 0x53, 0x9f, 0x57, 0x2e, 0x1f,
+    0xf0, 0x15, 0xcd, 0x33, 0xb5, 0xc2, 0x34, 0xf7, 0xb4, 0xb5, 0xa4, 0x94,
+    0xbb, 0xf6, 0x11, 0xf1, 0x8e, 0xc3, 0x3b, 0x60, 0x4f, 0x86, 0x42, 0xd1,
+    0x4a, 0x4f, 0xbf, 0xf9, 0x70, 0xf7, 0x2d, 0xba, 0x45, 0x0b, 0xcf, 0xfe,
+    0x62, 0xac, 0x0d, 0x64, 0xda, 0x62, 0x80, 0x20, 0xbc, 0x97, 0xf3, 0x4f,
+    0x7e, 0xb3, 0x1a, 0xce, 0x19, 0xbe, 0x86, 0x26, 0x66, 0x98, 0x3d, 0xe8,
+    0xb0, 0x23, 0x3a, 0xd7, 0xa8, 0xd2, 0xb8, 0xf2, 0xac, 0x93, 0xaa, 0xe4,
+    0xa0, 0x9c, 0x5a, 0x3d, 0xb3, 0x05, 0xf7, 0xce, 0x6f, 0x07, 0xbd, 0x2d,
+    0xe6, 0x14, 0x76, 0x4d, 0xd3, 0x96, 0x2b, 0x6b, 0x3e, 0x96, 0x95, 0x98,
+    0xc3, 0xa1, 0x33, 0xd7, 0xf7, 0x33, 0xbf, 0x73, 0x09, 0x9b, 0x1f, 0x70,
+    0x73, 0x58, 0x23, 0x84, 0x19, 0xc9, 0x4c, 0x73, 0xc4, 0xcd, 0xa5, 0x49,
+    0x6a, 0xc8, 0xc7, 0xf1, 0x8f, 0x78, 0x10, 0x08, 0xdd, 0x4e, 0xce, 0x5c,
+    0x78, 0x0a, 0x61, 0x30, 0x21, 0xca, 0x69, 0xc7, 0x23, 0x37, 0x10, 0x99,
+    0x68, 0x27, 0x1b, 0x0a, 0xd6, 0xbe, 0x7a, 0x3f, 0x5b, 0xcd, 0xd7, 0x06,
+    0x73, 0xf4, 0x5e, 0xcf, 0x1f, 0x50, 0x03, 0xa6, 0x22, 0xa5, 0xe5, 0x5c,
+    0x06, 0xd3, 0x7d, 0xd5, 0x2c, 0x03, 0x94, 0x31, 0x4a, 0xec, 0x1c, 0x71,
+    0xaf, 0x2e, 0x38, 0x2b, 0x54, 0x15, 0xc1, 0x4e, 0xc9, 0x0b, 0xd3, 0x23,
+    0xd8, 0x5a, 0x32, 0x8a, 0xed, 0x07, 0xe6, 0x77, 0xe4, 0x68, 0x34, 0x78,
+    0x4f, 0x7e, 0x2c, 0x19, 0x29, 0x59, 0x2b, 0x18, 0x04, 0x7e, 0x42, 0x6b,
+    0x2c, 0xb6, 0x7b, 0xed, 0xa9, 0x20, 0x17, 0xf1, 0xa0, 0xe0, 0xaa, 0x01,
+    0x25, 0xf9, 0x1d, 0x20, 0xa0, 0x83, 0x31, 0xd7, 0x83, 0x80, 0x30, 0xf1,
+    0xb6, 0xe6, 0xd6, 0xf9, 0xc6, 0xc5, 0x55, 0x75, 0xf7, 0x6f, 0x91, 0x7c,
+    0x6f, 0xa4, 0x14, 0xbc, 0x99, 0xa5, 0xb0, 0x6e, 0x0c, 0xc7, 0x55, 0xf5,
+    0xbe, 0xc8, 0x69, 0xbb, 0xfa, 0x2c, 0xfc, 0xdd, 0x83, 0x51, 0x0b, 0xde,
+    0xaa, 0xe8, 0xce, 0xb3, 0x08, 0x6e, 0xf0, 0xb9, 0x21, 0xc8, 0x8f, 0x5c,
+    0x67, 0xe9, 0xf3, 0xfd, 0xd7, 0x06, 0x70, 0x73, 0xd4, 0x62, 0x5b, 0x47,
+    0xa5, 0xfd, 0xe7, 0x5b, 0xb7, 0xd1, 0x5d, 0xbd, 0xa8, 0xc9, 0x01, 0xf0,
+    0xfd, 0xf8, 0x38, 0xca, 0x2c, 0x91, 0x7f, 0x97, 0x60, 0x91, 0x60, 0xea,
+    0x88, 0xc7, 0xb8, 0xe7, 0x89, 0xe1, 0x80, 0x08, 0xfc, 0x8e, 0xfc, 0xb1,
+    0x01, 0x68, 0xa9, 0xdd, 0x38, 0xc2, 0x47, 0x06, 0xae, 0x7d, 0x85, 0x3a,
+    0x2a, 0x7a, 0xda, 0x19, 0x5c, 0x53, 0x84, 0xcb, 0xcc, 0x59, 0x54, 0xdf,
+    0xb2, 0xe3, 0xe1, 0x9c, 0xe1, 0xd3, 0xd5, 0x81, 0x17, 0x05, 0x8b, 0xa6,
+    0x81, 0xaf, 0x9f, 0x88, 0x62, 0xba, 0xdb, 0x53, 0xb0, 0x16, 0xea, 0x14,
+    0x2d, 0x6f, 0x95, 0xa9, 0x28, 0x99, 0x60, 0xc8, 0xce, 0x4b, 0xa2, 0x23,
+    0xd9, 0x22, 0x36, 0x1b, 0x35, 0x37, 0x06, 0x47, 0xe5, 0x28, 0xbd, 0x3e,
+    0x5c, 0x5d, 0xd7, 0x13, 0xc3, 0xfe, 0xf2, 0xc9, 0x40, 0x62, 0x7b, 0xa4,
+    0xd3, 0xfb, 0x48, 0x15, 0xaf, 0x2d, 0xc5, 0x92, 0x43, 0x4c, 0x10, 0x87,
+    0x36, 0x5d, 0xcc, 0xa5, 0x14, 0x45, 0xd2, 0x3c, 0xf2, 0xfe, 0x88, 0xfe,
+    0xa7, 0x0b, 0xa5, 0x3c, 0x72, 0xbd, 0xc8, 0xbc, 0x8a, 0x10, 0x08, 0x4e,
+    0x5d, 0x11, 0x89, 0x96, 0x82, 0xcc, 0xec, 0x06, 0xc9, 0x73, 0xcb, 0x5e,
+    0xb7, 0xe2, 0x3c, 0x06, 0xf2, 0x5d, 0x0b, 0x02, 0xea, 0x20, 0x5f, 0x80,
+    0x9c, 0xe9, 0xb0, 0x58, 0xcf, 0x0f, 0xd4, 0x94, 0x7b, 0x36, 0xda, 0x8e,
+    0x6b, 0x5c, 0x38, 0x47, 0x0e, 0x44, 0xc6, 0x63, 0x72, 0x82, 0xd6, 0xb3,
+    0xac, 0x2d, 0x04, 0x9f, 0x6a, 0x2b, 0xf2, 0x88, 0xe2, 0xe8, 0x11, 0xd0,
+    0x08, 0x93, 0xa5, 0xce, 0x5b, 0x06, 0xa7, 0x7e, 0x14, 0x19, 0x0f, 0x1f,
+    0xce, 0x3b, 0xe5, 0xc8, 0xf5, 0x17, 0xa5, 0xee, 0xa6, 0xcf, 0x82, 0xd1,
+    0x60, 0x17, 0xae, 0x7e, 0x16, 0x4b, 0x44, 0x08, 0x9e, 0x01, 0xde, 0xf1,
+    0x97, 0x02, 0x81, 0x27, 0x5d, 0x76, 0x04, 0x5f, 0xdd, 0x66, 0xf9, 0x24,
+    0xf9, 0x08, 0xfb, 0x67, 0xd6, 0x9e, 0xbb, 0xda, 0x5d, 0x81, 0xac, 0xd2,
+    0xd8, 0x16, 0x4e, 0x59, 0xc3, 0xad, 0x4c, 0x67, 0xf5, 0x52, 0x8c, 0x42,
+    0x80, 0x43, 0x07, 0xb9, 0x84, 0x74, 0x4d, 0xb5, 0x4e, 0xe6, 0x4e, 0x4d,
+    0xb1, 0x55, 0xc8, 0x47, 0xde, 0x25, 0x0c, 0xd6, 0xb9, 0xc5, 0x9f, 0x5c,
+    0x07, 0x36, 0x21, 0xc5, 0x67, 0x42, 0x15, 0x2d, 0xb9, 0x8e, 0x02, 0x59,
+    0x29, 0x96, 0xdd, 0x15, 0x49, 0xfb, 0xe4, 0x94, 0xbd, 0xd0, 0xb0, 0xd4,
+    0x22, 0xaf, 0x04, 0x2b, 0x4a, 0x21, 0x03, 0xad, 0xb7, 0x59, 0x6d, 0x72,
+    0xc8, 0x77, 0xe5, 0xff, 0xad, 0x9c, 0x56, 0x87, 0x18, 0xb9, 0x58, 0xb4,
+    0x76, 0x4c, 0x39, 0x55, 0xff, 0x8b, 0xda, 0x54, 0xb9, 0xb0, 0x89, 0x1b,
+    0x8a, 0x8d, 0x17, 0xfc, 0xec, 0xa4, 0xeb, 0x1b, 0x9a, 0x3e, 0x47, 0x2c,
+    0x56, 0xb2, 0x61, 0x01, 0x88, 0x53, 0x47, 0x22, 0x24, 0xe1, 0x1d, 0xaa,
+    0xd3, 0x87, 0x49, 0xce, 0xb3, 0x11, 0xbd, 0xf7, 0x0d, 0x1f, 0x09, 0x70,
+    0xc8, 0x02, 0x56, 0xc6, 0x5e, 0x5e, 0xc3, 0x39, 0x48, 0x6f, 0x1e, 0xcd,
+    0x76, 0x28, 0xf5, 0x39, 0x48, 0xbe, 0xef, 0x11, 0xdd, 0xf7, 0x1c, 0x71,
+    0x55, 0x49, 0xed, 0xa7, 0x3c, 0x68, 0x09, 0x2d, 0x1b, 0x7b, 0xe5, 0x0c,
+    0xe8, 0xd7, 0x0e, 0x25, 0xa6, 0x70, 0x3d, 0xdc, 0x27, 0x59, 0x4b, 0xf8,
+    0xf4, 0x5e, 0x01, 0xec, 0xbb, 0xcb, 0x41, 0x22, 0x02, 0x90, 0xbd, 0x75,
+    0xeb, 0x70, 0x54, 0xa9, 0xeb, 0xc2, 0x3d, 0xa2, 0x99, 0xe5, 0x79, 0x9c,
+    0xf6, 0x20, 0xba, 0x2c, 0x63, 0x4a, 0xa8, 0xfe, 0xdd, 0x42, 0xf3, 0x45,
+    0x56, 0x0b, 0xae, 0x22, 0x46, 0x83, 0x3d, 0x6d, 0x88, 0xc1, 0x05, 0xa6,
+    0xd4, 0x3f, 0x46, 0xf6, 0xec, 0xe8, 0xf0, 0xaa, 0xaa, 0x4e, 0x6e, 0x7d,
+    0x3c, 0xbb, 0xed, 0x45, 0xed, 0x7d, 0x3e, 0xd2, 0x0a, 0xb5, 0xf8, 0xbf,
+    0xea, 0xbf, 0xfb, 0x15, 0x08, 0x36, 0x82, 0x88, 0xf6, 0x42, 0xe6, 0xf1,
+    0xfc, 0x1e, 0x2a, 0x05, 0x95, 0xf6, 0xb1, 0xf6, 0x11, 0x12, 0x70, 0x62,
+    0xf4, 0x90, 0x4c, 0x25, 0xba, 0xcc, 0x5f, 0x17, 0xb7, 0x21, 0x71, 0x19,
+    0x64, 0xe4, 0x90, 0xda, 0x87, 0x73, 0x87, 0x24, 0x13, 0x86, 0x91, 0x8c,
+    0x92, 0x0e, 0x8d, 0x44, 0xe6, 0xda, 0x91, 0x27, 0xa6, 0x00, 0xe5, 0xf1,
+    0x8b, 0xb8, 0x14, 0x51, 0x9a, 0xf3, 0xaf, 0x0c, 0x33, 0x83, 0xaf, 0x19,
+    0x6b, 0xcd, 0x16, 0x45, 0x56, 0x28, 0x38, 0xb1, 0x07, 0x36, 0x2e, 0x33,
+    0x59, 0x7a, 0xfc, 0x12, 0x41, 0x01, 0x3f, 0x50, 0xa9, 0x4a, 0x2e, 0xf8,
+    0xaa, 0xe2, 0xce, 0x5b, 0xb2, 0xa7, 0xa7, 0x7f, 0x1a, 0x02, 0xcc, 0xa7,
+    0x45, 0xb4, 0x95, 0x80, 0x83, 0x49, 0xb3, 0x97, 0x86, 0x81, 0x66, 0x7e,
+    0xf3, 0xb0, 0x38, 0x5d, 0xd1, 0xcf, 0x9a, 0x92, 0xd7, 0x44, 0x4a, 0x12,
+    0x8d, 0xc2, 0xba, 0x22, 0xfd, 0xaf, 0xed, 0x2e, 0xe1, 0xd2, 0xd4, 0x71,
+    0x19, 0xae, 0xea, 0x51, 0x95, 0x13, 0x4e, 0x7b, 0x60, 0x7a, 0x15, 0xb9,
+    0x4e, 0xc1, 0xf0, 0xb4, 0x43, 0x48, 0x5e, 0x25, 0x8f, 0x2e, 0x6f, 0x39,
+    0x37, 0x75, 0x10, 0xcc, 0xdf, 0xd8, 0x0c, 0x20, 0x00, 0x54, 0x4a, 0xc8,
+    0xc4, 0x8e, 0x78, 0xa2, 0x30, 0x92, 0xaf, 0x0b, 0xb9, 0x59, 0xa0, 0x85,
+    0x8e, 0x92, 0x84, 0x12, 0x9a, 0x78, 0xd2, 0x64, 0x7f, 0x75, 0xc8, 0x97,
+    0x5f, 0xc7, 0x15, 0x93, 0x0a, 0x2a, 0xc1, 0x10, 0x8e, 0x21, 0xde, 0x64,
+    0x96, 0x5b, 0x9e, 0xed, 0xf2, 0x90, 0x0c, 0xee, 0x01, 0x59, 0xef, 0x51,
+    0x19, 0x5b, 0xcc, 0x1c, 0x9c, 0x39, 0xc7, 0x5c, 0x3c, 0xfa, 0x2f, 0x31,
+    0x41, 0xc4, 0xe2, 0xbd, 0x47, 0x0f, 0x41, 0x11, 0xf9, 0x7e, 0x04, 0x63,
+    0x69, 0x59, 0xd4, 0xf7, 0x85, 0xb2, 0x6c, 0xb3, 0x21, 0x1a, 0x13, 0x22,
+    0xe0, 0x2a, 0x87, 0xc3, 0xa9, 0x3d, 0xf9, 0x5e, 0xba, 0x6e, 0x52, 0x21,
+    0x16, 0x50, 0x8d, 0x0f, 0xe1, 0x59, 0x06, 0x6a, 0x08, 0x19, 0xea, 0x48,
+    0x46, 0xda, 0x1d, 0x90, 0x15, 0x96, 0xc5, 0xb6, 0xec, 0xb6, 0xbc, 0xd1,
+    0xc1, 0x8e, 0xe9, 0x5c, 0x63, 0xf6, 0x2b, 0x4a, 0xb8, 0xc0, 0x3f, 0x76,
+    0xad, 0x0e, 0x82, 0x7b, 0x06, 0x48, 0x85, 0x8e, 0x7f, 0xb8, 0xd0, 0x49,
+    0x1f, 0xe7, 0x7b, 0x89, 0xcc, 0x42, 0x6a, 0xab, 0xbc, 0x83, 0xcb, 0x65,
+    0xa4, 0x6c, 0xcd, 0xe3, 0x3e, 0x5a, 0x99, 0xd7, 0x2c, 0xbd, 0x6a, 0x02,
+    0x70, 0x2c, 0x71, 0xff, 0x35, 0x68, 0x51, 0x67, 0x1f, 0x7e, 0x95, 0xa0,
+    0x0c, 0x82, 0xe2, 0xea, 0x7c, 0xcc, 0x3a, 0x98, 0x34, 0xfe, 0xac, 0xd8,
+    0x2c, 0xeb, 0x4c, 0xf1, 0xdd, 0xfc, 0xd8, 0xa1, 0x1b, 0xfd, 0xee, 0x94,
+    0x16, 0x8a, 0xd5, 0xe2, 0x57, 0x45, 0x25, 0x16, 0x98, 0x66, 0x18, 0xc5,
+    0x98, 0x61, 0xbb, 0x21, 0x0d, 0x5c, 0x92, 0x29, 0x5e, 0xe5, 0x63, 0xac,
+    0xed, 0xb4, 0x15, 0x1b, 0x91, 0x5b, 0x54, 0x8d, 0xed, 0xd5, 0x3a, 0x59,
+    0x1c, 0x67, 0xd3, 0x45, 0x00, 0x6e, 0x27, 0x79, 0xd3, 0x38, 0x4d, 0x0a,
+    0xcc, 0x19, 0xe8, 0xd7, 0x2c, 0x20, 0x71, 0x4e, 0x62, 0x91, 0x50, 0xdd,
+    0xf6, 0xc9, 0xfc, 0x44, 0xa1, 0x0a, 0xaf, 0x57, 0x37, 0xc2, 0xde, 0x29,
+    0xcf, 0x80, 0xa3, 0x13, 0x16, 0x12, 0xd0, 0x11, 0xaf, 0xfb, 0x93, 0xb0,
+    0x8f, 0x04, 0xb3, 0x7a, 0x7d, 0xac, 0x98, 0x26, 0xe3, 0xf4, 0x59, 0x50,
+    0x2f, 0x80, 0x98, 0xd4, 0xca, 0xef, 0x0a, 0x89, 0xe5, 0x3f, 0x64, 0x21,
+    0xaf, 0x26, 0xf3, 0x59, 0x7c, 0xde, 0xdc, 0x9a, 0xc7, 0xcb, 0x04, 0x0f,
+    0x4d, 0x74, 0x0a, 0xe9, 0xd1, 0x19, 0x89, 0x74, 0xe7, 0x95, 0xbd, 0x9e,
+    0x80, 0xdd, 0x48, 0x5e, 0x0f, 0x7e, 0x03, 0x54, 0x7f, 0x38, 0x5f, 0x08,
+    0xa8, 0x97, 0xc2, 0x90, 0xbf, 0xa9, 0x5f, 0xfd, 0x76, 0xd9, 0x37, 0x86,
+    0xc7, 0x9c, 0xc9, 0xa1, 0x62, 0xe0, 0x60, 0x6f, 0xff, 0xd7, 0x3d, 0x68,
+    0x3d, 0xa9, 0x5d, 0x0c, 0xc6, 0x3b, 0x09, 0xbe, 0x0e, 0xb9, 0xcc, 0x37,
+    0x63, 0x03, 0xf7, 0x3a, 0x79, 0x04, 0x7e, 0x4b, 0x9e, 0xa1, 0xfb, 0xcf,
+    0x79, 0xe3, 0xa6, 0x92, 0x17, 0x2d, 0xa2, 0x87, 0x36, 0x44, 0x88, 0x85,
+    0x6c, 0x27, 0xd9, 0x31, 0x1a, 0x5c, 0x0a, 0xe7, 0xce, 0x34, 0x3a, 0x32,
+    0x97, 0x95, 0x66, 0xe3, 0x90, 0xe1, 0x25, 0xca, 0xcb, 0x77, 0xb4, 0xf0,
+    0x31, 0x87, 0xf4, 0x19, 0x65, 0x62, 0x87, 0x22, 0xf6, 0x07, 0xc1, 0x82,
+    0x2f, 0xb3, 0xc5, 0xbc, 0x6a, 0x28, 0x63, 0xa3, 0x38, 0x29, 0x2b, 0xf3,
+    0xe2, 0xe2, 0xd3, 0xfd, 0xb6, 0x5c, 0xb7, 0x9e, 0x9c, 0xe6, 0x85, 0xfc,
+    0xbf, 0x91, 0x81, 0x29, 0x63, 0x92, 0xad, 0xb6, 0x53, 0xec, 0x04, 0x7b,
+    0x1c, 0x7d, 0xff, 0xc9, 0x88, 0x15, 0x3f, 0xea, 0x56, 0xc0, 0xb5, 0x2e,
+    0x30, 0x19, 0xfa, 0x34, 0xef, 0xe2, 0x5c, 0x7c, 0xb1, 0xbb, 0x77, 0xba,
+    0x4e, 0xc9, 0x92, 0x55, 0xb8, 0xa1, 0x71, 0x75, 0x57, 0x30, 0x4e, 0xed,
+    0x3d, 0x1b, 0x56, 0x69, 0x7f, 0xf9, 0x46, 0x30, 0x11, 0x4f, 0xef, 0x35,
+    0x80, 0xd4, 0x97, 0xe1, 0xfa, 0x65, 0xf2, 0x1d, 0xb6, 0x18, 0x53, 0xae,
+    0xea, 0xfa, 0x61, 0x2c, 0xb4, 0x26, 0xe9, 0x96, 0x7c, 0x66, 0x04, 0xbf,
+    0x71, 0x14, 0x4e, 0x42, 0xcc, 0x6f, 0x26, 0x2c, 0xe7, 0xe2, 0x3c, 0xc8,
+    0xd5, 0x3d, 0xee, 0x51, 0xe7, 0xfc, 0xc9, 0xc8, 0xab, 0x6c, 0x2f, 0x02,
+    0xdf, 0x42, 0x02, 0x86, 0xfc, 0xa7, 0xd3, 0x66, 0x0c, 0xf8, 0x83, 0xae,
+    0x02, 0xab, 0xef, 0x6e, 0x67, 0x02, 0x61, 0x17, 0x88, 0x9f, 0x76, 0x61,
+    0x3b, 0x49, 0x2c, 0x5c, 0x0c, 0x64, 0x3b, 0x6a, 0x6b, 0x2c, 0xdf, 0x7c,
+    0x20, 0x26, 0x76, 0xd5, 0xde, 0x4d, 0xc2, 0x8d, 0x7d, 0x81, 0x8a, 0xf7,
+    0xf9, 0xba, 0x62, 0x6d, 0x23, 0x21, 0x10, 0x53, 0xd2, 0xee, 0xcb, 0x36,
+    0xd6, 0x27, 0xb6, 0x52, 0x5c, 0x9c, 0xff, 0x37, 0x88, 0xb8, 0xfa, 0xf1,
+    0x27, 0x02, 0x06, 0x2b, 0x5e, 0x08, 0x8f, 0xc8, 0x28, 0x74, 0x10, 0x24,
+    0xe4, 0xd7, 0xa8, 0x71, 0x2a, 0xa8, 0xd2, 0xea, 0x50, 0x1d, 0x8f, 0x2c,
+    0x44, 0xdb, 0x39, 0xe0, 0x8b, 0x69, 0x85, 0xf2, 0xbf, 0xf4, 0x35, 0xc8,
+    0x10, 0x19, 0x5e, 0x3e, 0xfb, 0xee, 0x4a, 0x6f, 0x4f, 0xa4, 0x41, 0x07,
+    0xa9, 0x82, 0x2d, 0xcd, 0xb5, 0xa1, 0x39, 0xdc, 0x96, 0x50, 0x61, 0x16,
+    0xac, 0x64, 0xfd, 0x78, 0xb6, 0x86, 0x7a, 0x7a, 0xca, 0xcd, 0x79, 0x2c,
+    0xca, 0x4d, 0xa8, 0xd4, 0x79, 0xe0, 0xe1, 0x60, 0x3b, 0x07, 0x26, 0xed,
+    0x89, 0x3d, 0xf3, 0xe2, 0x30, 0xa9, 0xf3, 0x0b, 0xfa, 0x87, 0xd8, 0x62,
+    0x45, 0x40, 0x55, 0x51, 0xd4, 0x18, 0x1e, 0x1a, 0x54, 0x29, 0x0e, 0x15,
+    0x8b, 0x5f, 0x70, 0x83, 0x67, 0x4b, 0x8a, 0xe9, 0x4e, 0x36, 0x74, 0xd9,
+    0x55, 0x84, 0xe6, 0x91, 0xcb, 0x7b, 0xff, 0x74, 0xaf, 0x02, 0x38, 0x08,
+    0x05, 0x20, 0x32, 0xf4, 0xb1, 0x61, 0x23, 0xa4, 0x0c, 0x0c, 0x81, 0xaf,
+    0x4a, 0x3d, 0x6e, 0x39, 0xeb, 0x1f, 0x21, 0x36, 0xf8, 0x75, 0xe3, 0xa1,
+    0x90, 0x45, 0xcb, 0x42, 0x30, 0x94, 0xdc, 0xba, 0x1a, 0x85, 0xb0, 0x99,
+    0xda, 0x44, 0x09, 0xae, 0xc6, 0xbc, 0x94, 0x19, 0xe9, 0x02, 0xfd, 0x30,
+    0x1b, 0x20, 0x8f, 0x5d, 0x99, 0xd2, 0x79, 0x29, 0x9b, 0x76, 0x61, 0xb3,
+    0xe9, 0x61, 0x96, 0x82, 0xa7, 0xef, 0xcf, 0xc5, 0x2c, 0xcd, 0xda, 0xf6,
+    0x77, 0x69, 0x4c, 0xb2, 0xbe, 0xb5, 0xb4, 0x07, 0x41, 0xe2, 0xaf, 0x8c,
+    0x36, 0x3f, 0xf1, 0xcd, 0x7a, 0xb7, 0x91, 0x75, 0xee, 0x30, 0x84, 0x1a,
+    0x14, 0x2d, 0x5a, 0x6e, 0x3c, 0x5f, 0xa5, 0x86, 0x67, 0x41, 0x3f, 0xb7,
+    0x83, 0xad, 0x56, 0xd1, 0x50, 0xe9, 0x4b, 0x2b, 0x8f, 0x19, 0x48, 0x53,
+    0xa6, 0x4d, 0x4b, 0x37, 0xb6, 0xf9, 0x5e, 0x99, 0x51, 0xb9, 0x58, 0x3e,
+    0x6e, 0x76, 0xd1, 0xab, 0x29, 0x33, 0xe9, 0x3f, 0x45, 0x16, 0x9d, 0x20,
+    0xdf, 0x3a, 0x57, 0xe3, 0x0e, 0xab, 0xe6, 0x40, 0x9e, 0xd4, 0xf2, 0xc6,
+    0x11, 0x27, 0xa7, 0xad, 0xbc, 0x9f, 0x2b, 0x60, 0x75, 0xc1, 0xee, 0x3d,
+    0xc9, 0x4c, 0x64, 0x27, 0xe7, 0xa1, 0xec, 0xaf, 0x7b, 0xca, 0xdf, 0x54,
+    0xa4, 0x63, 0x0e, 0xa3, 0x19, 0x85, 0x4d, 0x57, 0x9f, 0xae, 0x3b, 0x51,
+    0xdf, 0xc9, 0x98, 0xe7, 0x9f, 0x17, 0x5f, 0xaf, 0x6a, 0xf7, 0xd9, 0xed,
+    0x78, 0x11, 0x4f, 0x08, 0xb9, 0x27, 0xf7, 0xcf, 0x84, 0x57, 0x4b, 0x0d,
+    0x2b, 0x09, 0x24, 0xa0, 0x3e, 0xf0, 0x69, 0xfc, 0x82, 0x05, 0xad, 0x26,
+    0xe6, 0x9f, 0xc5, 0x8d, 0x1d, 0x7d, 0x63, 0xed, 0x1f, 0x4a, 0xea, 0x75,
+    0xb8, 0x9f, 0xf2, 0x36, 0x9c, 0x7d, 0x9e, 0xfa, 0x1f, 0xa2, 0xd7, 0xbd,
+    0x8a, 0xfa, 0x5a, 0x79, 0x2a, 0x57, 0x3b, 0x46, 0xc6, 0xee, 0x67, 0x9f,
+    0xb0, 0x4e, 0x73, 0x04, 0xb0, 0xf3, 0x8c, 0x68, 0x0e, 0x5a, 0x72, 0xb6,
+    0xf5, 0xd9, 0x4e, 0xcb, 0x03, 0x27, 0x00, 0xbd, 0x21, 0xe1, 0xd8, 0x3c,
+    0xaf, 0xa4, 0xb1, 0x53, 0x8f, 0xbd, 0x27, 0x70, 0xeb, 0x54, 0x14, 0x64,
+    0x3b, 0xb9, 0xf1, 0x46, 0x57, 0xb5, 0x12, 0x1a, 0xf9, 0x29, 0x05, 0xec,
+    0x82, 0xf7, 0x40, 0xeb, 0xab, 0x3d, 0xaa, 0xa4, 0x76, 0x39, 0x30, 0x38,
+    0xdf, 0x7b, 0xfd, 0x1d, 0x17, 0x04, 0x16, 0x9a, 0xcf, 0x10, 0x3f, 0x25,
+    0x64, 0x68, 0x2d, 0xac, 0x7c, 0xff, 0xc4, 0xe0, 0xd5, 0x1c, 0x1e, 0x84,
+    0x36, 0x00, 0xef, 0x1c, 0x6f, 0x50, 0x97, 0x9e, 0x43, 0xe0, 0xd6, 0xee,
+    0x34, 0x19, 0x14, 0xa4, 0x24, 0x0c, 0x33, 0x1d, 0x1d, 0x04, 0xc3, 0x7b,
+    0x86, 0xd1, 0x1a, 0x20, 0x06, 0x3d, 0x08, 0x55, 0xa3, 0x5a, 0x58, 0x85,
+    0xc8, 0xbe, 0x51, 0x88, 0x28, 0xd1, 0x5d, 0x9f, 0x31, 0x6b, 0x09, 0xfb,
+    0xf1, 0xc0, 0x85, 0xbf, 0x8e, 0x53, 0x34, 0xc8, 0x19, 0x2a, 0xc4, 0x41,
+    0xc8, 0x57, 0xb2, 0x43, 0xa9, 0x29, 0xb8, 0x1c, 0xd2, 0xe5, 0x67, 0x0d,
+    0xca, 0x9b, 0xb3, 0xb3, 0x85, 0xfe, 0x44, 0x75, 0x83, 0x53, 0xf0, 0x40,
+    0x4a, 0x41, 0x48, 0x8d, 0x93, 0xb0, 0x1f, 0x34, 0x08, 0x8e, 0x7c, 0x4b,
+    0x42, 0xe8, 0x78, 0x26, 0x38, 0xf1, 0x06, 0xd9, 0x4b, 0x1c, 0xa1, 0x76,
+    0x5d, 0x3a, 0xc1, 0xc4, 0x70, 0xbf, 0x72, 0xa3, 0x1b, 0x42, 0xc9, 0xc5,
+    0x8b, 0xd0, 0xb6, 0xfd, 0x10, 0xb2, 0x5f, 0x16, 0x63, 0x18, 0x4b, 0x68,
+    0x2b, 0xbd, 0xd5, 0xfa, 0x41, 0x44, 0xd8, 0x8e, 0x10, 0x33, 0x2e, 0x10,
+    0xa7, 0x1e, 0x5a, 0x81, 0x2d, 0xbe, 0xe9, 0xa9, 0xbc, 0x4f, 0x06, 0xd6,
+    0x7d, 0xaf, 0xe6, 0x9b, 0x9c, 0x0d, 0x87, 0xd8, 0x5e, 0x15, 0xff, 0x60,
+    0x7f, 0x6f, 0xe5, 0x5d, 0xb4, 0x80, 0x60, 0x3a, 0x52, 0x60, 0x15, 0x52,
+    0xdb, 0x81, 0xd8, 0xfd, 0xde, 0x2d, 0xce, 0x76, 0xd6, 0x04, 0x14, 0x8a,
+    0x1e, 0x9d, 0x84, 0xb0, 0x3a, 0x93, 0xf5, 0x3a, 0x0f, 0x89, 0x6e, 0x96,
+    0x06, 0x7b, 0x91, 0x86, 0x01, 0x4f, 0xbe, 0x61, 0x57, 0x6d, 0x2f, 0x67,
+    0xf0, 0x98, 0x26, 0xcb, 0xc3, 0xa3, 0x93, 0x6f, 0x94, 0x1f, 0x80, 0x4a,
+    0xd2, 0x5d, 0x2f, 0xa0, 0x75, 0xc5, 0x8c, 0x87, 0x5f, 0x79, 0x55, 0x47,
+    0x54, 0xd7, 0xc2, 0xef, 0xcb, 0xa2, 0x81, 0x33, 0xfc, 0x1a, 0xcd, 0xa4,
+    0xa1, 0xec, 0x56, 0x75, 0x81, 0xea, 0x40, 0x8d, 0x80, 0x01, 0x5b, 0x7d,
+    0x0b, 0x5c, 0xf7, 0xa4, 0x2f, 0x95, 0xa5, 0x0c, 0xba, 0xb8, 0x9f, 0xa7,
+    0xfe, 0xd7, 0x7b, 0xcc, 0x06, 0x5d, 0x06, 0x25, 0x6d, 0x1a, 0x77, 0x0b,
+    0x47, 0xd8, 0xe6, 0xfb, 0x1a, 0xc2, 0x86, 0x71, 0xd5, 0x05, 0x0b, 0x7c,
+    0x3f, 0x88, 0xe6, 0xe5, 0xdd, 0x57, 0xae, 0xbd, 0x97, 0xda, 0x65, 0x12,
+    0x30, 0xee, 0xd6, 0x36, 0x2f, 0xba, 0xe1, 0xa6, 0x56, 0x71, 0x3b, 0x60,
+    0x5a, 0x7f, 0xb3, 0x3d, 0xf0, 0xa0, 0x55, 0xef, 0xf8, 0x7f, 0xd0, 0x3c,
+    0x18, 0x0e, 0x15, 0x5f, 0x12, 0xc4, 0x22, 0xdc, 0xac, 0x0a, 0x32, 0xa1,
+    0xed, 0xcb, 0xd5, 0x96, 0x5b, 0xbc, 0xd3, 0xb2, 0x85, 0x03, 0x86, 0x84,
+    0x81, 0x17, 0x12, 0x78, 0x9b, 0x26, 0xd1, 0x74, 0x34, 0x13, 0x5e, 0xba,
+    0x31, 0x99, 0x0d, 0x4d, 0x43, 0x6a, 0x84, 0xf2, 0x5c, 0x82, 0x89, 0x33,
+    0x04, 0x6f, 0xcb, 0x85, 0x29, 0x62, 0x78, 0x1b, 0xba, 0x3f, 0x9d, 0xae,
+    0x98, 0x5f, 0x5d, 0x68, 0x3f, 0x2a, 0x08, 0x0e, 0x44, 0xa7, 0x81, 0x44,
+    0x23, 0x85, 0xd6, 0xfa, 0x01, 0x9f, 0xdb, 0x4d, 0x4e, 0xb9, 0x69, 0xe0,
+    0x3e, 0x0b, 0xed, 0x85, 0x78, 0x1d, 0x66, 0x49, 0x6d, 0x3d, 0xc2, 0x40,
+    0xc7, 0xd1, 0xf8, 0xe1, 0x20, 0xe3, 0x04, 0xf7, 0xd6, 0x9b, 0x38, 0x7a,
+    0xce, 0xfd, 0xe5, 0x5b, 0x50, 0x81, 0x97, 0x18, 0x98, 0x70, 0x82, 0xdc,
+    0x4e, 0x7a, 0xcd, 0xbc, 0x73, 0xd5, 0xa8, 0x1e, 0x2d, 0xa8, 0x6c, 0x37,
+    0xcc, 0x06, 0xe7, 0xe8, 0xd6, 0x5f, 0xba, 0xc1, 0x57, 0x93, 0x9b, 0xff,
+    0x81, 0xab, 0xa5, 0xad, 0x7d, 0x3d, 0x99, 0xc6, 0x06, 0x56, 0x13, 0x3b,
+    0xe7, 0x84, 0x13, 0x95, 0x18, 0x4c, 0xfc, 0xc4, 0x82, 0x12, 0xfe, 0xf7,
+    0x15, 0x65, 0x18, 0x31, 0x1c, 0x22, 0xf1, 0xf9, 0x87, 0xf3, 0x3b, 0xdb,
+    0x92, 0xef, 0x3d, 0x34, 0x60, 0xa1, 0x4c, 0x67, 0x8c, 0xb6, 0x49, 0x03,
+    0xac, 0x7e, 0x38, 0x08, 0xa4, 0x44, 0x83, 0xb5, 0x34, 0xfc, 0x0b, 0x4b,
+    0xfe, 0xb6, 0xdf, 0x19, 0x61, 0x8e, 0xf4, 0xe4, 0x35, 0x12, 0xa6, 0xee,
+    0xbb, 0xc7, 0xf9, 0x9d, 0xdf, 0x16, 0x6e, 0x04, 0x87, 0x69, 0x7c, 0x3f,
+    0x51, 0x83, 0x92, 0xfc, 0xcf, 0xbb, 0xb7, 0x24, 0x8a, 0xaf, 0x67, 0x6e,
+    0x6c, 0xf3, 0x96, 0x21, 0x9b, 0x8a, 0x79, 0x66, 0x92, 0x7a, 0xe6, 0x88,
+    0x23, 0x91, 0xb5, 0x76, 0x18, 0x34, 0x7d, 0x49, 0x40, 0x6a, 0x86, 0x50,
+    0x4e, 0x71, 0x57, 0x58, 0x34, 0xc9, 0xa6, 0xac, 0x8b, 0x51, 0x49, 0x7e,
+    0x16, 0x70, 0x7a, 0x19, 0xb6, 0xf7, 0x69, 0x2a, 0xa8, 0x1e, 0x0d, 0x36,
+    0x47, 0x2f, 0x73, 0x9a, 0xca, 0xe0, 0xec, 0xc4, 0xdd, 0x0f, 0x9f, 0xa7,
+    0x8e, 0x1a, 0xc0, 0x90, 0x64, 0xeb, 0x0b, 0x75, 0xf2, 0x3b, 0x35, 0xdf,
+    0xcf, 0x97, 0x6c, 0x5e, 0x04, 0xf4, 0x47, 0x2c, 0xa7, 0x2b, 0x2d, 0xbe,
+    0xab, 0x01, 0x5d, 0xfe, 0xd3, 0xa1, 0x8d, 0xd6, 0x3b, 0x8f, 0x79, 0x5b,
+    0x4e, 0xb8, 0xa2, 0xcd, 0x33, 0x44, 0xa0, 0x59, 0x0a, 0xba, 0xce, 0x3e,
+    0x1c, 0x6e, 0x1d, 0xaf, 0x00, 0x00, 0xfe, 0x11, 0x61, 0xe9, 0x5f, 0xc7,
+    0x06, 0xa7, 0xb8, 0xd9, 0x38, 0xd0, 0x22, 0xfd, 0x8e, 0x52, 0x73, 0x55,
+    0x4a, 0xb4, 0x6f, 0xff, 0xa5, 0xef, 0x3e, 0x71, 0x77, 0x0f, 0xba, 0xc2,
+    0xc7, 0xd2, 0x1d, 0xc3, 0x3c, 0x03, 0xfc, 0xad, 0x9f, 0xa3, 0x65, 0x38,
+    0x32, 0x3b, 0x3f, 0xee, 0xe8, 0x77, 0x95, 0x09, 0x29, 0x0f, 0xdd, 0x80,
+    0x65, 0x82, 0x4b, 0xfc, 0x06, 0x52, 0x63, 0xe6, 0x13, 0x67, 0xb0, 0xe7,
+    0x0d, 0xd7, 0x1c, 0xf4, 0xc4, 0xc7, 0x02, 0x9f, 0x6f, 0x02, 0x0c, 0xc2,
+    0x5a, 0x22, 0x89, 0xa4, 0xae, 0x51, 0x7a, 0x74, 0x38, 0x75, 0xcd, 0x15,
+    0xec, 0xa7, 0x34, 0x8b, 0xd8, 0xc9, 0x84, 0xdc, 0xe9, 0xb0, 0x5e, 0x5e,
+    0x08, 0x2d, 0x8d, 0x98, 0x4d, 0xe1, 0x4c, 0x82, 0xba, 0x72, 0x68, 0x8a,
+    0x74, 0x8c, 0x2e, 0x5f, 0x4c, 0xd3, 0xa7, 0x26, 0xaa, 0xdd, 0xf8, 0xd0,
+    0x7e, 0x60, 0xf5, 0x3d, 0xa2, 0x79, 0xf0, 0xdf, 0x7a, 0x4a, 0x46, 0xe8,
+    0x4b, 0x04, 0x1c, 0x0d, 0xf2, 0xa1, 0xe5, 0xd4, 0x0b, 0x5b, 0xfb, 0x60,
+    0x84, 0x18, 0x02, 0xc4, 0xf4, 0x19, 0xe6, 0x87, 0x92, 0x15, 0xb4, 0x6e,
+    0x35, 0x12, 0xd6, 0xca, 0x3e, 0x21, 0x6f, 0x38, 0xa3, 0x6b, 0xf4, 0x32,
+    0x7d, 0xc0, 0x1f, 0xe8, 0x0f, 0xdc, 0x96, 0xd8, 0x82, 0x42, 0x43, 0x70,
+    0x1f, 0x37, 0x0e, 0x46, 0xb6, 0x3a, 0x19, 0x15, 0x11, 0x46, 0xce, 0x90,
+    0x83, 0x64, 0xa7, 0xda, 0x6d, 0x63, 0xd5, 0xcb, 0x83, 0xc4, 0x78, 0x9c,
+    0x59, 0x8f, 0x79, 0x0e, 0x5a, 0xe6, 0x8e, 0x9a, 0xdc, 0x84, 0xcd, 0x85,
+    0x07, 0xaa, 0xe6, 0x4e, 0xff, 0x8a, 0x9b, 0x1d, 0x8e, 0x9d, 0x5e, 0xec,
+    0xd8, 0xea, 0xae, 0x4c, 0x08, 0x76, 0x3f, 0x94, 0x02, 0x6e, 0x3f, 0x34,
+    0x3c, 0xdd, 0xa3, 0xdf, 0x9d, 0x61, 0x01, 0x5d, 0xb6, 0x9f, 0x50, 0x2c,
+    0x56, 0xa3, 0xe2, 0x8f, 0x8e, 0x21, 0x01, 0x59, 0x21, 0x95, 0x4d, 0x8e,
+    0x7f, 0x9f, 0x7d, 0x0e, 0xf8, 0x40, 0x12, 0x06, 0x48, 0x77, 0x01, 0x56,
+    0xa0, 0x32, 0xeb, 0xb7, 0x33, 0xa9, 0xbf, 0x00, 0x1a, 0xd6, 0x65, 0x32,
+    0xd2, 0x3c, 0x37, 0x71, 0x2e, 0x72, 0xdb, 0xec, 0x59, 0xfa, 0x05, 0x4b,
+    0x16, 0xf9, 0xf8, 0x53, 0x01, 0xd7, 0x20, 0xba, 0x36, 0x8e, 0xa0, 0x90,
+    0x71, 0xe7, 0x72, 0x3d, 0x4d, 0xc1, 0x03, 0xb2, 0x24, 0xb3, 0xbf, 0xff,
+    0xfc, 0x46, 0x59, 0x27, 0x99, 0x7a, 0x09, 0x08, 0xf3, 0x3c, 0x65, 0x3f,
+    0xae, 0x18, 0x5b, 0x6c, 0x78, 0x2a, 0x84, 0x00, 0x3e, 0xdc, 0x73, 0x85,
+    0x50, 0xa4, 0x9d, 0x77, 0xfb, 0x8e, 0x90, 0xc3, 0x64, 0x87, 0x55, 0xc9,
+    0x18, 0xae, 0x50, 0x40, 0x7b, 0x06, 0x4f, 0x2f, 0xaf, 0xaa, 0x5a, 0x52,
+    0x21, 0x8f, 0x4a, 0xe6, 0x86, 0x52, 0x6c, 0xf9, 0x27, 0xd2, 0x64, 0x9a,
+    0x32, 0x62, 0x76, 0xf2, 0x35, 0xc3, 0xaa, 0xc8, 0x39, 0xb9, 0xd8, 0xe6,
+    0x5d, 0x7d, 0xee, 0x92, 0x47, 0x29, 0xc4, 0x73, 0x04, 0xfd, 0x89, 0x2c,
+    0x47, 0x7c, 0xee, 0x4f, 0x45, 0x07, 0x40, 0x12, 0x8e, 0xd8, 0x42, 0x2a,
+    0x5d, 0x9a, 0x17, 0x8a, 0xb0, 0x25, 0x4b, 0x10, 0xca, 0x8e, 0xe6, 0x4d,
+    0x42, 0x91, 0xa9, 0x46, 0x99, 0xad, 0x7d, 0x56, 0x86, 0x2e, 0x27, 0xa8,
+    0x51, 0xd6, 0xce, 0x56, 0x76, 0xcf, 0x1f, 0xf3, 0x56, 0xea, 0xaa, 0x24,
+    0xb8, 0xe7, 0x43, 0x9a, 0x54, 0x8a, 0xbd, 0xcc, 0x44, 0x3e, 0xee, 0x91,
+    0x64, 0x3c, 0x44, 0xf3, 0x69, 0x07, 0x91, 0x55, 0x08, 0x04, 0x2d, 0xa5,
+    0xa9, 0xf1, 0x87, 0xbf, 0x7c, 0x10, 0x51, 0x9c, 0xa5, 0xe9, 0x07, 0x68,
+    0x3f, 0xfc, 0x80, 0xb4, 0xba, 0x2a, 0x18, 0x63, 0x2e, 0x8f, 0xdb, 0x67,
+    0xf5, 0xf1, 0x37, 0x46, 0xb2, 0x71, 0xac, 0x03, 0x53, 0xca, 0xa5, 0xee,
+    0x03, 0xd8, 0xc0, 0xed, 0x9d, 0x42, 0xed, 0xdb, 0xb2, 0x98, 0x9a, 0x96,
+    0x7b, 0x4d, 0xbc, 0xf7, 0xc3, 0x63, 0x29, 0x46, 0x4c, 0x1b, 0x91, 0x5d,
+    0x48, 0x24, 0x29, 0x32, 0x09, 0xa8, 0x1e, 0x6b, 0x2b, 0xd7, 0xfd, 0x79,
+    0x01, 0x5a, 0x10, 0xb3, 0xf4, 0xfd, 0xcc, 0xe3, 0xb8, 0x28, 0xfa, 0xdd,
+    0x94, 0x56, 0x32, 0x37, 0x81, 0x45, 0x48, 0x47, 0x5b, 0x14, 0xbf, 0xe0,
+    0x9c, 0xc9, 0x1e, 0x45, 0xec, 0xb3, 0x2e, 0x99, 0x40, 0x0a, 0xa7, 0x8d,
+    0xf7, 0x7b, 0x2f, 0x5e, 0xe6, 0x7d, 0xf3, 0xbc, 0x3e, 0xea, 0x42, 0xc9,
+    0x55, 0x34, 0x66, 0xc0, 0x2e, 0x12, 0x68, 0xc8, 0x2c, 0x2a, 0xf6, 0x4f,
+    0x83, 0x49, 0xb1, 0x31, 0x89, 0xba, 0xc7, 0xe4, 0x29, 0x08, 0x15, 0x6f,
+    0xe2, 0x8a, 0x45, 0x40, 0xa1, 0x99, 0xaa, 0xf0, 0x38, 0xc8, 0x78, 0x42,
+    0x8c, 0x5b, 0x99, 0x92, 0xcf, 0x2a, 0xc2, 0xaa, 0xc2, 0xaa, 0x60, 0xd1,
+    0x15, 0x1a, 0xf6, 0x39, 0x18, 0xee, 0xc4, 0x06, 0x13, 0x66, 0xec, 0xd1,
+    0xbb, 0x4a, 0xf2, 0x0a, 0xf9, 0x19, 0x98, 0xba, 0xa0, 0x11, 0x85, 0xcc,
+    0xea, 0xa5, 0x06, 0x3c, 0x44, 0xe9, 0x21, 0x0e, 0x0a, 0x7f, 0x0a, 0x02,
+    0xd8, 0x4f, 0xde, 0x0e, 0x4c, 0x73, 0x3f, 0x55, 0x2f, 0x0e, 0x13, 0x83,
+    0x9c, 0x7e, 0xce, 0xfa, 0x18, 0x5d, 0xda, 0x2b, 0x48, 0x21, 0xd8, 0x12,
+    0x81, 0xbc, 0x35, 0x16, 0x06, 0x3b, 0xf7, 0xd8, 0x89, 0x5b, 0x35, 0xff,
+    0x6b, 0xbb, 0x11, 0xa3, 0xcd, 0x15, 0xc0, 0xc0, 0x39, 0xd1, 0x6d, 0x57,
+    0xcf, 0xe9, 0xcf, 0x26, 0x3b, 0x1a, 0x62, 0xd9, 0xda, 0xc2, 0xd7, 0x8f,
+    0xd8, 0x42, 0x4b, 0x25, 0xe2, 0x81, 0x65, 0x50, 0x59, 0xd7, 0x99, 0x6f,
+    0x1a, 0x15, 0x97, 0x26, 0x72, 0x09, 0x54, 0xc2, 0xae, 0x37, 0x5a, 0xe6,
+    0x4a, 0x9d, 0xda, 0xdb, 0x3e, 0x0a, 0x4d, 0xba, 0x86, 0xca, 0xa7, 0x4b,
+    0xb7, 0xc2, 0xd4, 0x19, 0xbf, 0x0a, 0x79, 0x2b, 0xb9, 0xe4, 0x15, 0x6c,
+    0xc8, 0x14, 0x57, 0x54, 0x30, 0x26, 0x05, 0xf2, 0x70, 0xbb, 0x86, 0xee,
+    0x83, 0xea, 0xaf, 0xef, 0x70, 0xdd, 0xb4, 0x78, 0x9d, 0x68, 0x5c, 0x6e,
+    0x20, 0x08, 0x45, 0x47, 0x1f, 0x19, 0x9f, 0x44, 0xc4, 0x40, 0xfa, 0x4d,
+    0x05, 0x8d, 0xb4, 0x3f, 0x94, 0x2c, 0x11, 0x1b, 0x28, 0xd2, 0xb2, 0x67,
+    0xee, 0x51, 0x8c, 0x95, 0x24, 0x93, 0x9c, 0x77, 0x37, 0x95, 0xd0, 0xee,
+    0x40, 0xca, 0x66, 0xbf, 0x9c, 0x6b, 0x9f, 0x00, 0xde, 0x17, 0x12, 0xe7,
+    0x54, 0xe4, 0x28, 0xa5, 0xc2, 0xd5, 0xd0, 0xc2, 0x0d, 0x53, 0xa5, 0xe5,
+    0x2d, 0x2b, 0x17, 0xf1, 0xb1, 0x6a, 0x93, 0x0d, 0x98, 0x2b, 0x35, 0x4c,
+    0x0e, 0xd0, 0x52, 0x87, 0xb8, 0xf1, 0x73, 0x83, 0x93, 0x85, 0xca, 0xa5,
+    0x56, 0xd9, 0x34, 0x55, 0x64, 0x27, 0x51, 0xe7, 0x8d, 0x15, 0xe4, 0x5e,
+    0x5d, 0xb5, 0x00, 0xb5, 0x52, 0xbe, 0x75, 0x81, 0x35, 0x18, 0xf0, 0x3d,
+    0x44, 0x07, 0xa0, 0x03, 0xe8, 0x98, 0x0b, 0x78, 0xa1, 0x65, 0xff, 0x5b,
+    0x84, 0x4d, 0x88, 0x4e, 0x1f, 0x5c, 0x96, 0x17, 0xa2, 0xaa, 0x80, 0x4b,
+    0x99, 0x8c, 0x5a, 0x83, 0x03, 0xc1, 0xbb, 0x12, 0x2b, 0xdc, 0x75, 0x83,
+    0x7c, 0xa1, 0xe9, 0x18, 0xda, 0xb5, 0xfc, 0xcf, 0x27, 0x68, 0x3e, 0xc0,
+    0xd8, 0xa4, 0xab, 0x7b, 0x84, 0x16, 0x5d, 0xa0, 0x90, 0x31, 0x3d, 0x2f,
+    0x93, 0x27, 0x8b, 0x6e, 0xd3, 0xac, 0x29, 0x58, 0x8c, 0xcd, 0xde, 0x35,
+    0x8e, 0x5c, 0x0c, 0x15, 0x48, 0x9b, 0xe8, 0x4f, 0xf8, 0xe2, 0x5e, 0x67,
+    0xe2, 0x96, 0x09, 0xb3, 0x2c, 0x4d, 0x7e, 0xbe, 0xe1, 0x9d, 0xa6, 0x18,
+    0x58, 0x69, 0xde, 0xdb, 0xd3, 0x62, 0x3c, 0x25, 0x89, 0xf3, 0x4a, 0xf9,
+    0x05, 0xca, 0x34, 0xd6, 0xd5, 0xa9, 0xe8, 0xd3, 0x9a, 0x51, 0xc7, 0x83,
+    0xc3, 0x99, 0x39, 0xaf, 0x75, 0xf5, 0xb5, 0x3d, 0xd4, 0x36, 0x74, 0xef,
+    0x51, 0xbe, 0x9c, 0xae, 0x12, 0xf3, 0xf4, 0xd4, 0x18, 0x9a, 0x54, 0x19,
+    0xe4, 0xb5, 0x9a, 0x09, 0x87, 0x87, 0x1a, 0x8d, 0xaa, 0x10, 0x72, 0x77,
+    0xbb, 0x53, 0xda, 0xcc, 0xf0, 0xfa, 0x90, 0x4d, 0xd0, 0x98, 0xd4, 0x55,
+    0x4a, 0x11, 0xc2, 0x94, 0xdc, 0x7e, 0xd6, 0xe0, 0x2e, 0x67, 0xfa, 0x11,
+    0xf0, 0x65, 0x4a, 0x79, 0x57, 0xe4, 0x30, 0xd1, 0x42, 0xb3, 0x84, 0xdd,
+    0x54, 0x3e, 0x4a, 0x89, 0xb8, 0x9d, 0x1b, 0xeb, 0xdd, 0xf7, 0x50, 0xc2,
+    0xa6, 0x48, 0x50, 0x56, 0x1f, 0x5f, 0xa3, 0xb7, 0xf5, 0x0c, 0x84, 0x53,
+    0x50, 0x6c, 0xe3, 0x78, 0xf8, 0x6b, 0x4e, 0x0f, 0x14, 0xee, 0xe6, 0x7b,
+    0x88, 0x81, 0x00, 0xd3, 0x47, 0x72, 0x1a, 0x31, 0xf3, 0x05, 0xde, 0xee,
+    0xa3, 0x0b, 0x5d, 0xe8, 0xe2, 0xe7, 0x9d, 0x6e, 0xec, 0x3c, 0xdd, 0xb0,
+    0x03, 0x45, 0x2d, 0x56, 0x7f, 0x29, 0x59, 0x9d, 0x40, 0xc9, 0x65, 0x9b,
+    0x8f, 0x39, 0x90, 0xcc, 0x74, 0x82, 0x34, 0x50, 0x5f, 0x82, 0x29, 0xbf,
+    0x99, 0x4b, 0xf2, 0x0a, 0xd3, 0x79, 0x5c, 0x85, 0x46, 0xbf, 0xe3, 0x39,
+    0xcc, 0x5e, 0xbf, 0x0c, 0xad, 0x2a, 0x5d, 0x10, 0x89, 0x9c, 0x8d, 0x08,
+    0x32, 0x97, 0xf9, 0xaa, 0x7e, 0x2b, 0xa6, 0x19, 0xab, 0x92, 0xac, 0xe0,
+    0x12, 0x10, 0x3e, 0xcb, 0xcf, 0xc5, 0xe5, 0xcf, 0x23, 0x04, 0xd3, 0x50,
+    0x1d, 0x0d, 0xf6, 0xe5, 0xfb, 0x5e, 0xbc, 0x20, 0x47, 0x6a, 0x5c, 0x6e,
+    0x2f, 0x9b, 0x29, 0x35, 0x5f, 0x5b, 0x52, 0xf7, 0xff, 0xf7, 0x74, 0x71,
+    0xed, 0x3e, 0xd2, 0x09, 0xda, 0x30, 0x7f, 0x62, 0x7d, 0x42, 0x11, 0x4f,
+    0x67, 0x83, 0xbc, 0x46, 0x8f, 0xf1, 0xe1, 0x9f, 0x7f, 0xe6, 0x93, 0x33,
+    0x58, 0x1e, 0x3a, 0xf3, 0x8d, 0xbc, 0xce, 0x98, 0xfd, 0x8c, 0x9b, 0x63,
+    0xd8, 0x85, 0xaa, 0x66, 0xb1, 0xfe, 0x27, 0xbf, 0xb6, 0x81, 0x7e, 0x1b,
+    0x94, 0x6d, 0x06, 0xd2, 0x48, 0x3e, 0x1b, 0xee, 0x26, 0x89, 0xc2, 0x51,
+    0xbe, 0x7c, 0x32, 0xfd, 0x2c, 0x53, 0x66, 0x20, 0x4a, 0xd9, 0x8d, 0x56,
+    0x08, 0x48, 0x8b, 0x2e, 0x32, 0x2b, 0x48, 0xca, 0x08, 0xd2, 0xe6, 0x21,
+    0xb5, 0xb6, 0x87, 0xed, 0xfe, 0x6d, 0x2d, 0x7e, 0x58, 0x10, 0xea, 0x93,
+    0x6d, 0x5c, 0x35, 0x67, 0x2e, 0xa8, 0x50, 0xbc, 0x89, 0x42, 0x83, 0xab,
+    0x31, 0x80, 0x93, 0xf0, 0x1c, 0x92, 0x65, 0x06, 0xae, 0x07, 0x2d, 0xb6,
+    0x89, 0x75, 0x30, 0x0b, 0xbb, 0x45, 0x74, 0xc9, 0x85, 0x29, 0x2a, 0x5a,
+    0xac, 0x65, 0xcd, 0x30, 0x16, 0x3c, 0xa5, 0x0d, 0x1d, 0xa1, 0x37, 0x96,
+    0x3a, 0x3c, 0xeb, 0x04, 0x2b, 0x56, 0x61, 0x50, 0x1f, 0x1f, 0x4a, 0xc6,
+    0x04, 0x40, 0x94, 0x8f, 0xe9, 0xf3, 0x84, 0x56, 0xbf, 0xfd, 0xce, 0x65,
+    0x50, 0xd4, 0xc5, 0xd1, 0x24, 0x38, 0x3c, 0xc1, 0x68, 0xa7, 0x7c, 0xcf,
+    0xf4, 0xaa, 0xa2, 0x8e, 0xc0, 0x03, 0xc6, 0x4a, 0x63, 0xc7, 0x41, 0xfc,
+    0x44, 0xbc, 0xdc, 0x8a, 0x9f, 0x18, 0x8b, 0x85, 0x0c, 0x6b, 0x9c, 0x33,
+    0x45, 0x8a, 0xd8, 0xc2, 0xdb, 0x00, 0x2d, 0x5c, 0xb9, 0x80, 0x77, 0x58,
+    0x1c, 0xa0, 0x5e, 0x49, 0xe6, 0xe6, 0xfe, 0x7e, 0x25, 0x59, 0xbd, 0x42,
+    0x22, 0xa5, 0x54, 0xed, 0x34, 0xa1, 0x1d, 0x8f, 0xae, 0xfc, 0xf5, 0xcb,
+    0xfe, 0x70, 0x80, 0x86, 0x0d, 0x6a, 0x8e, 0x2d, 0xfb, 0x68, 0x89, 0xbd,
+    0x66, 0xb8, 0x7d, 0xdb, 0x5a, 0x1a, 0x04, 0x6a, 0xf0, 0x55, 0xf1, 0x03,
+    0x72, 0xea, 0x34, 0xc0, 0xb0, 0x1e, 0x72, 0xe1, 0x94, 0x64, 0xf4, 0xe7,
+    0x32, 0xdc, 0x08, 0x49, 0xb6, 0x4c, 0x06, 0x5a, 0x71, 0xc3, 0x1a, 0xff,
+    0xad, 0x1b, 0x89, 0x78, 0x62, 0xb6, 0x32, 0xc5, 0x89, 0x75, 0x1a, 0xc5,
+    0x88, 0x04, 0xeb, 0xd9, 0xe6, 0x61, 0x2a, 0x18, 0xab, 0xa5, 0x12, 0x7b,
+    0x9a, 0xc9, 0xf6, 0xf4, 0xfa, 0x08, 0xbe, 0xa2, 0x0a, 0x25, 0x8f, 0x96,
+    0x9e, 0xcd, 0xbc, 0x07, 0x0c, 0x5b, 0xf2, 0xac, 0x26, 0xa7, 0xea, 0xba,
+    0x0d, 0x6c, 0x13, 0x0d, 0x5a, 0x41, 0x7e, 0x42, 0x03, 0xa6, 0xd9, 0x07,
+    0xe0, 0x1d, 0xf3, 0xf9, 0x90, 0x93, 0x2a, 0x46, 0xbf, 0x7e, 0x8e, 0x6f,
+    0x51, 0xa5, 0xbb, 0xca, 0xe0, 0x93, 0x44, 0xa5, 0xd5, 0xd2, 0x80, 0x95,
+    0xe6, 0x01, 0x07, 0xf8, 0x2f, 0x65, 0xd5, 0xac, 0x07, 0x46, 0xc8, 0x76,
+    0x26, 0xb8, 0x37, 0x1c, 0x84, 0xa1, 0x1e, 0xec, 0xde, 0x61, 0x6e, 0x23,
+    0xed, 0x0c, 0x40, 0x2d, 0x86, 0x0f, 0x07, 0x04, 0x7b, 0x29, 0x7b, 0x41,
+    0x95, 0x84, 0x48, 0x2f, 0x29, 0xc8, 0x72, 0x66, 0xd8, 0x90, 0xe1, 0x33,
+    0x16, 0x02, 0xe5, 0x8a, 0xa1, 0xa9, 0x19, 0xff, 0x8c, 0xb0, 0x3c, 0x41,
+    0xa1, 0x22, 0xef, 0x73, 0x38, 0xbb, 0x87, 0xa6, 0xd9, 0x0b, 0x74, 0x83,
+    0x18, 0xaf, 0xc4, 0xd9, 0xd0, 0x0e, 0x82, 0x90, 0xa5, 0x0d, 0x4a, 0xe2,
+    0x04, 0x41, 0xc2, 0x06, 0xf6, 0x7c, 0x47, 0xd3, 0x9a, 0x5b, 0x56, 0xaf,
+    0xf4, 0x98, 0x8c, 0xcc, 0x7e, 0xdf, 0x74, 0x00, 0xcf, 0xa5, 0xc1, 0x95,
+    0x43, 0x1d, 0x2b, 0x2c, 0xa9, 0xc3, 0x97, 0xcd, 0x94, 0x1c, 0xd3, 0x08,
+    0xe7, 0xa0, 0xf7, 0xcc, 0x17, 0x4d, 0x89, 0x20, 0xef, 0x2e, 0xd5, 0x8c,
+    0xf0, 0xbd, 0x98, 0xb4, 0x25, 0x9e, 0x94, 0x74, 0x1e, 0x7c, 0x94, 0xb4,
+    0x5f, 0xfa, 0x01, 0xf9, 0xa3, 0x8b, 0x43, 0xe1, 0x05, 0xd9, 0x95, 0x1e,
+    0x53, 0xf6, 0x12, 0x65, 0x66, 0x73, 0x4f, 0xb7, 0x5d, 0xaf, 0x06, 0x68,
+    0x21, 0x32, 0x97, 0x1e, 0x31, 0x88, 0xa3, 0xc1, 0x0d, 0xa8, 0xbf, 0x2e,
+    0x27, 0x69, 0x26, 0x36, 0x8a, 0x44, 0x88, 0x93, 0x6c, 0x17, 0x98, 0xe1,
+    0x05, 0x43, 0x0b, 0xe0, 0x3e, 0x61, 0x24, 0x74, 0x0c, 0x7e, 0x03, 0xe3,
+    0x59, 0x5c, 0x70, 0xf5, 0x25, 0x82, 0x1a, 0xf1, 0x5e, 0x17, 0xd4, 0x48,
+    0x2f, 0x28, 0x6c, 0xca, 0xee, 0xb9, 0x76, 0x3b, 0xf5, 0xb3, 0x63, 0x88,
+    0x1c, 0xe0, 0x97, 0x67, 0xf4, 0x2a, 0xd4, 0x71, 0x23, 0x35, 0xb0, 0xfe,
+    0x2d, 0x51, 0x48, 0xac, 0x5c, 0xac, 0x67, 0x6b, 0x1e, 0x68, 0x4a, 0xca,
+    0xab, 0x85, 0x85, 0x5c, 0x48, 0x61, 0x36, 0xe1, 0xbb, 0x7d, 0x22, 0x54,
+    0xca, 0x60, 0x09, 0x00, 0x66, 0x75, 0xee, 0x96, 0x68, 0x67, 0x7e, 0x7d,
+    0x93, 0xb4, 0x97, 0x89, 0x78, 0xf5, 0x84, 0xd7, 0x8c, 0x5e, 0xb6, 0x8f,
+    0xac, 0xb2, 0xa0, 0x93, 0xda, 0xbc, 0x21, 0x6d, 0x98, 0x5b, 0x8c, 0x42,
+    0xff, 0x28, 0x02, 0xc7, 0x3f, 0x9d, 0xf1, 0xa2, 0x8a, 0x98, 0x06, 0x78,
+    0x6f, 0x98, 0xcb, 0x4e, 0x87, 0xf9, 0x64, 0xed, 0x46, 0x12, 0xa8, 0xa6,
+    0x1f, 0x3e, 0x4c, 0x2c, 0x7a, 0x89, 0xe6, 0x9d, 0xf1, 0x31, 0xb6, 0xd3,
+    0x58, 0x96, 0x05, 0xa3, 0x80, 0x4e, 0x4f, 0x34, 0x99, 0xb5, 0x46, 0x2e,
+    0x95, 0x39, 0xf7, 0xc0,
+};
+#define AV1_192X192P10_CRC (0x4c4cdfabU)
+
+#endif
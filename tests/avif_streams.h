@@ -0,0 +1,314 @@
+/* avif files put together from libsvtav1 tiles, with the crc32 of their
+ * BGRA pixels worked out from the libdav1d output of the tiles: the grid
+ * composed and cropped, alpha stretched from studio swing to full range as
+ * libavif does, then rotated and mirrored
+ */
+#ifndef _AVIF_STREAMS_H_
+#define _AVIF_STREAMS_H_
+
+#include <stdint.h>
+
+/* 2x2 grid of 64x48 tiles cropped to 120x90, with a 2x2 grid of studio
+ * swing alpha tiles as its auxl item, irot 1 and imir 0, so 90x120
+ */
+static const uint8_t avif_grid_alpha[3545] = {
+    0x00, 0x00, 0x00, 0x1c, 0x66, 0x74, 0x79, 0x70, 0x61, 0x76, 0x69, 0x66,
+    0x00, 0x00, 0x00, 0x00, 0x61, 0x76, 0x69, 0x66, 0x6d, 0x69, 0x66, 0x31,
+    0x6d, 0x69, 0x61, 0x66, 0x00, 0x00, 0x02, 0xe6, 0x6d, 0x65, 0x74, 0x61,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x68, 0x64, 0x6c, 0x72,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x69, 0x63, 0x74,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x70, 0x69, 0x74, 0x6d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x9c, 0x69, 0x6c, 0x6f, 0x63, 0x00,
+    0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x03, 0x0a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x12, 0x00, 0x00, 0x01, 0xa2, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0xb4, 0x00, 0x00, 0x01,
+    0xec, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06, 0xa0, 0x00,
+    0x00, 0x01, 0xed, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08,
+    0x8d, 0x00, 0x00, 0x01, 0xcf, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x0a, 0x5c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x07, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x0a, 0x64, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x08, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x0a, 0x81, 0x00, 0x00, 0x01, 0x24, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0b, 0xa5, 0x00, 0x00, 0x00,
+    0xfe, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0c, 0xa3, 0x00,
+    0x00, 0x01, 0x36, 0x00, 0x00, 0x00, 0xe0, 0x69, 0x69, 0x6e, 0x66, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x15, 0x69, 0x6e, 0x66,
+    0x65, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x67, 0x72, 0x69,
+    0x64, 0x00, 0x00, 0x00, 0x00, 0x15, 0x69, 0x6e, 0x66, 0x65, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x61, 0x76, 0x30, 0x31, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x69, 0x6e, 0x66, 0x65, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x61, 0x76, 0x30, 0x31, 0x00, 0x00, 0x00, 0x00, 0x15,
+    0x69, 0x6e, 0x66, 0x65, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x61, 0x76, 0x30, 0x31, 0x00, 0x00, 0x00, 0x00, 0x15, 0x69, 0x6e, 0x66,
+    0x65, 0x02, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x61, 0x76, 0x30,
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x15, 0x69, 0x6e, 0x66, 0x65, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x67, 0x72, 0x69, 0x64, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x69, 0x6e, 0x66, 0x65, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x61, 0x76, 0x30, 0x31, 0x00, 0x00, 0x00, 0x00, 0x15,
+    0x69, 0x6e, 0x66, 0x65, 0x02, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+    0x61, 0x76, 0x30, 0x31, 0x00, 0x00, 0x00, 0x00, 0x15, 0x69, 0x6e, 0x66,
+    0x65, 0x02, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x61, 0x76, 0x30,
+    0x31, 0x00, 0x00, 0x00, 0x00, 0x15, 0x69, 0x6e, 0x66, 0x65, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x61, 0x76, 0x30, 0x31, 0x00, 0x00,
+    0x00, 0x00, 0x42, 0x69, 0x72, 0x65, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x14, 0x64, 0x69, 0x6d, 0x67, 0x00, 0x01, 0x00, 0x04, 0x00,
+    0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x14, 0x64,
+    0x69, 0x6d, 0x67, 0x00, 0x06, 0x00, 0x04, 0x00, 0x07, 0x00, 0x08, 0x00,
+    0x09, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0e, 0x61, 0x75, 0x78, 0x6c, 0x00,
+    0x06, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0xed, 0x69, 0x70, 0x72,
+    0x70, 0x00, 0x00, 0x00, 0x96, 0x69, 0x70, 0x63, 0x6f, 0x00, 0x00, 0x00,
+    0x0c, 0x61, 0x76, 0x31, 0x43, 0x81, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0x14, 0x69, 0x73, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x10, 0x70, 0x69, 0x78,
+    0x69, 0x00, 0x00, 0x00, 0x00, 0x03, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00,
+    0x14, 0x69, 0x73, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x78, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x38, 0x61, 0x75, 0x78,
+    0x43, 0x00, 0x00, 0x00, 0x00, 0x75, 0x72, 0x6e, 0x3a, 0x6d, 0x70, 0x65,
+    0x67, 0x3a, 0x6d, 0x70, 0x65, 0x67, 0x42, 0x3a, 0x63, 0x69, 0x63, 0x70,
+    0x3a, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x73, 0x3a, 0x61, 0x75, 0x78,
+    0x69, 0x6c, 0x69, 0x61, 0x72, 0x79, 0x3a, 0x61, 0x6c, 0x70, 0x68, 0x61,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x69, 0x72, 0x6f, 0x74, 0x01, 0x00, 0x00,
+    0x00, 0x09, 0x69, 0x6d, 0x69, 0x72, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x69,
+    0x70, 0x6d, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+    0x01, 0x03, 0x04, 0x86, 0x87, 0x00, 0x06, 0x02, 0x04, 0x05, 0x00, 0x02,
+    0x03, 0x81, 0x02, 0x03, 0x00, 0x03, 0x03, 0x81, 0x02, 0x03, 0x00, 0x04,
+    0x03, 0x81, 0x02, 0x03, 0x00, 0x05, 0x03, 0x81, 0x02, 0x03, 0x00, 0x07,
+    0x04, 0x81, 0x02, 0x03, 0x05, 0x00, 0x08, 0x04, 0x81, 0x02, 0x03, 0x05,
+    0x00, 0x09, 0x04, 0x81, 0x02, 0x03, 0x05, 0x00, 0x0a, 0x04, 0x81, 0x02,
+    0x03, 0x05, 0x00, 0x00, 0x0a, 0xd7, 0x6d, 0x64, 0x61, 0x74, 0x00, 0x00,
+    0x01, 0x01, 0x00, 0x78, 0x00, 0x5a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x02,
+    0xaf, 0xf7, 0x8d, 0x5f, 0x20, 0x08, 0x32, 0x93, 0x03, 0x10, 0x00, 0x97,
+    0x80, 0x10, 0x40, 0x82, 0x01, 0xe0, 0x10, 0xcb, 0x96, 0xad, 0xca, 0x02,
+    0x5f, 0xaf, 0x87, 0x27, 0xc6, 0x8b, 0xf8, 0x43, 0x36, 0xd6, 0x91, 0x0b,
+    0x47, 0x54, 0x42, 0xe1, 0xc2, 0xf5, 0x77, 0x75, 0x53, 0x40, 0x49, 0xac,
+    0xda, 0x4f, 0xb1, 0x2a, 0x42, 0xfb, 0xce, 0xaa, 0xf9, 0x1d, 0xb4, 0x2e,
+    0x3f, 0x1b, 0x1c, 0x5d, 0x89, 0xfe, 0x54, 0xff, 0x41, 0x98, 0x82, 0x46,
+    0x9e, 0xf6, 0xf1, 0x51, 0x21, 0x02, 0xd5, 0x44, 0x13, 0xd3, 0x38, 0xca,
+    0xb6, 0xa4, 0x7b, 0x07, 0x3b, 0x43, 0xcf, 0x88, 0xa0, 0x9e, 0x5b, 0x81,
+    0x7f, 0x1c, 0xb5, 0x70, 0x92, 0x4f, 0x30, 0x8d, 0xd3, 0xdf, 0x6b, 0xbf,
+    0x8d, 0x0e, 0x6c, 0x0b, 0xb2, 0x7c, 0xd2, 0xcb, 0x9b, 0x96, 0xc6, 0x04,
+    0x1c, 0xed, 0xfe, 0x5f, 0x7a, 0xb6, 0x58, 0xbb, 0x14, 0x98, 0x4f, 0x5f,
+    0xbc, 0x78, 0x2e, 0xf9, 0x17, 0x94, 0xbb, 0x5f, 0x2d, 0xd1, 0x54, 0xf3,
+    0xef, 0x79, 0xd9, 0x10, 0x50, 0xa9, 0x48, 0xa9, 0x62, 0x1a, 0x2a, 0x91,
+    0x73, 0x6e, 0x0b, 0x5b, 0x33, 0x0f, 0x77, 0x80, 0x62, 0x80, 0x78, 0x04,
+    0x7f, 0xbf, 0x61, 0x26, 0x77, 0xf5, 0x8c, 0xac, 0x0c, 0x33, 0x9a, 0x20,
+    0x09, 0x7a, 0x86, 0xfd, 0x62, 0x25, 0xea, 0x8c, 0xb0, 0x3e, 0x69, 0x0d,
+    0x59, 0xed, 0x3a, 0x7b, 0xfd, 0xc1, 0x1b, 0x61, 0x8e, 0xdc, 0xb2, 0x03,
+    0x61, 0xef, 0xc8, 0x48, 0x42, 0xe9, 0x0f, 0x92, 0x60, 0x95, 0xd9, 0x66,
+    0x6f, 0x25, 0x31, 0x2b, 0x38, 0x0b, 0x63, 0x92, 0x6d, 0x81, 0x6f, 0x74,
+    0xc8, 0xfc, 0xb7, 0xaa, 0x35, 0xa0, 0xa2, 0x34, 0xe9, 0x42, 0xf5, 0xbe,
+    0x0a, 0x60, 0x9f, 0x0d, 0xe3, 0x5e, 0xa8, 0x10, 0xfe, 0x51, 0xec, 0xdd,
+    0x22, 0x84, 0x81, 0x65, 0x30, 0xe0, 0x36, 0x63, 0x1c, 0xcb, 0xf1, 0x5b,
+    0x70, 0x98, 0xed, 0x22, 0xda, 0x17, 0x03, 0x34, 0x18, 0x55, 0x41, 0xd2,
+    0xe2, 0x70, 0x3e, 0xe7, 0x1d, 0x52, 0x4d, 0x5f, 0xc1, 0x52, 0xc8, 0x6b,
+    0x99, 0x0e, 0x2b, 0x11, 0xf0, 0x72, 0xd9, 0x47, 0x45, 0x77, 0x86, 0x62,
+    0x97, 0x9d, 0x0c, 0xa0, 0xe9, 0xa8, 0xb8, 0xaa, 0xbc, 0xea, 0x7b, 0x34,
+    0x0b, 0x46, 0x62, 0x7a, 0x79, 0x3c, 0x86, 0x47, 0xbe, 0xb4, 0xec, 0x27,
+    0xc5, 0x82, 0x7f, 0xd6, 0x30, 0x98, 0x3e, 0x34, 0xc3, 0xd9, 0xde, 0xd5,
+    0x13, 0xa1, 0x4e, 0x68, 0x42, 0x76, 0xe2, 0x8b, 0xf7, 0x24, 0x14, 0xef,
+    0x63, 0x67, 0x70, 0x2d, 0x41, 0xdd, 0x82, 0x9f, 0xa1, 0x07, 0xed, 0xe7,
+    0x8f, 0x8f, 0x8c, 0x64, 0xb2, 0x15, 0x4d, 0xb0, 0xf0, 0x87, 0x00, 0x84,
+    0x18, 0x67, 0x33, 0xdc, 0xb8, 0x44, 0x7e, 0xf6, 0x0a, 0xd4, 0xfe, 0xba,
+    0x8f, 0xaa, 0x84, 0x13, 0x63, 0x91, 0x84, 0x17, 0xfa, 0x27, 0xba, 0xe6,
+    0x7c, 0x53, 0xee, 0x75, 0x27, 0x9f, 0x5d, 0x99, 0x76, 0x5f, 0x30, 0xef,
+    0xdd, 0x99, 0x32, 0xf4, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x02, 0xaf, 0xf7,
+    0x8d, 0x5f, 0x20, 0x08, 0x32, 0xdd, 0x03, 0x10, 0x00, 0x97, 0x80, 0x10,
+    0x40, 0x82, 0x01, 0xe0, 0x10, 0xdd, 0x65, 0xec, 0x08, 0x3f, 0x87, 0x2c,
+    0x96, 0xaa, 0xf7, 0x60, 0xf0, 0xe8, 0xcf, 0x81, 0xa9, 0xda, 0xe8, 0x74,
+    0x39, 0x81, 0x8c, 0xd6, 0xaa, 0x17, 0x30, 0x18, 0x9b, 0xc5, 0x56, 0x72,
+    0x41, 0xfa, 0xe3, 0x84, 0x89, 0xfa, 0xeb, 0xfc, 0x90, 0x59, 0xf0, 0x73,
+    0x5f, 0x1b, 0x26, 0xc7, 0x93, 0x90, 0x41, 0x67, 0xa8, 0xfd, 0x5d, 0xd3,
+    0x40, 0xbb, 0x70, 0x10, 0xf2, 0x51, 0x98, 0x89, 0x11, 0xac, 0x4f, 0x1a,
+    0x31, 0x45, 0xd0, 0xba, 0xd8, 0x08, 0x6b, 0x80, 0xa9, 0x19, 0xaf, 0x28,
+    0xa7, 0xde, 0xac, 0xbe, 0x86, 0x05, 0x46, 0x1a, 0x46, 0x31, 0x30, 0xd1,
+    0x0b, 0xa9, 0x94, 0x41, 0x4c, 0xab, 0x01, 0xe6, 0x9b, 0x3b, 0xe0, 0x04,
+    0x2e, 0x31, 0xa6, 0x4a, 0xa0, 0x64, 0xbe, 0x47, 0x18, 0x28, 0x6c, 0xb3,
+    0x6c, 0x73, 0x5c, 0xdb, 0x14, 0xf0, 0x12, 0x69, 0x34, 0x5e, 0xd6, 0x03,
+    0x29, 0x4f, 0xf4, 0x20, 0x25, 0x92, 0x55, 0x31, 0x08, 0xa3, 0x34, 0x83,
+    0x19, 0x11, 0x73, 0x03, 0xf9, 0x10, 0xcd, 0xed, 0x22, 0xd3, 0x06, 0x11,
+    0xf3, 0x13, 0x8d, 0x06, 0x12, 0xdb, 0x45, 0x31, 0xd7, 0x97, 0xbe, 0x85,
+    0xa4, 0x1a, 0x03, 0x5d, 0x83, 0xc2, 0x39, 0xe4, 0xc8, 0x0c, 0x94, 0xc2,
+    0xfe, 0x69, 0x21, 0xb1, 0x14, 0xdd, 0x82, 0x14, 0x2b, 0x20, 0x6f, 0x07,
+    0xad, 0x11, 0x0d, 0xf8, 0x07, 0x1d, 0x73, 0x2f, 0xb4, 0xc8, 0xbf, 0x0f,
+    0xf7, 0x48, 0xf8, 0xb8, 0x6d, 0x7c, 0x19, 0x45, 0xcc, 0xf8, 0x53, 0x87,
+    0x72, 0x55, 0xed, 0x3c, 0x2d, 0x71, 0x49, 0xef, 0x52, 0x0c, 0x24, 0x2d,
+    0xdd, 0x93, 0xc5, 0xd5, 0xa7, 0xb3, 0xb7, 0xb2, 0x6d, 0xb7, 0x57, 0x8f,
+    0x74, 0xf5, 0xfa, 0xfb, 0xf6, 0x0c, 0x6a, 0x21, 0x3d, 0x98, 0xfe, 0x09,
+    0xe5, 0x12, 0xba, 0x65, 0x96, 0xf4, 0x0b, 0x43, 0x92, 0x63, 0x09, 0x7a,
+    0x5b, 0x83, 0x6b, 0x9e, 0x61, 0x1b, 0xa7, 0xc1, 0x1c, 0x9f, 0x91, 0x4f,
+    0xc3, 0x98, 0x89, 0xfb, 0x79, 0x7a, 0x96, 0xb8, 0x35, 0x4e, 0x49, 0x83,
+    0xc3, 0x01, 0xa8, 0xcc, 0xe6, 0xfd, 0x8c, 0x3a, 0x69, 0x3e, 0x66, 0x6c,
+    0xd1, 0x0b, 0xc6, 0x32, 0x30, 0xa2, 0x28, 0x4a, 0xf5, 0x98, 0x30, 0x87,
+    0x92, 0x1d, 0xcd, 0x58, 0x19, 0xa7, 0x72, 0xf4, 0x3f, 0x60, 0x82, 0x99,
+    0x44, 0x56, 0x87, 0xb5, 0x97, 0x3d, 0x56, 0x3c, 0x00, 0xb9, 0x5f, 0x59,
+    0x75, 0x6b, 0x94, 0xdc, 0xf5, 0x0d, 0xa7, 0x90, 0x0b, 0x81, 0xd2, 0x4a,
+    0x12, 0x54, 0xc1, 0x5d, 0x2b, 0x37, 0x2a, 0xa3, 0xa3, 0xeb, 0xb4, 0x5b,
+    0xe7, 0x15, 0x15, 0x14, 0x4b, 0xc9, 0xad, 0x32, 0x6b, 0xbe, 0xb4, 0xaa,
+    0x2e, 0x29, 0xd7, 0xae, 0xb5, 0xff, 0x74, 0xd1, 0xd8, 0x91, 0x68, 0xea,
+    0xb1, 0xc1, 0x22, 0x9c, 0xe7, 0xb5, 0xb3, 0x0e, 0x3d, 0xa1, 0x17, 0x2d,
+    0x93, 0x43, 0xa2, 0x6a, 0x3d, 0xad, 0x76, 0x42, 0x19, 0x6f, 0x8b, 0xe0,
+    0x73, 0xb5, 0xee, 0x25, 0xe1, 0x7f, 0x1e, 0x02, 0xbe, 0x97, 0xb5, 0x0e,
+    0xfa, 0xd4, 0x1e, 0x97, 0x14, 0x4d, 0x7f, 0xa9, 0x3d, 0xdf, 0x44, 0xc8,
+    0xf4, 0x5e, 0xb5, 0x5b, 0x11, 0x9e, 0x89, 0x83, 0x4b, 0x17, 0x39, 0x61,
+    0x15, 0x1b, 0x61, 0x3c, 0x48, 0x32, 0x72, 0x8c, 0x07, 0x12, 0xae, 0x60,
+    0xdf, 0xd5, 0x01, 0xe5, 0xe2, 0xd7, 0x85, 0x31, 0x36, 0xe2, 0x77, 0xa7,
+    0xb1, 0x59, 0x0f, 0xf0, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x02, 0xaf, 0xf7,
+    0x8d, 0x5f, 0x20, 0x08, 0x32, 0xde, 0x03, 0x10, 0x00, 0x97, 0x80, 0x10,
+    0x40, 0x82, 0x01, 0xe0, 0x10, 0xdd, 0x65, 0xf0, 0xe2, 0xcf, 0xf7, 0xb7,
+    0xe0, 0x43, 0x49, 0x09, 0x0c, 0xde, 0x4d, 0xd0, 0x0a, 0xbf, 0x5b, 0x3e,
+    0x98, 0xd9, 0xa5, 0xc5, 0xca, 0x76, 0x54, 0xa3, 0xea, 0xa1, 0x3e, 0xb8,
+    0xa8, 0x29, 0x89, 0x5b, 0xcd, 0xbc, 0x29, 0xf6, 0x78, 0x62, 0xde, 0xfd,
+    0xb8, 0x30, 0x72, 0x10, 0x55, 0x1b, 0xd4, 0xcd, 0x36, 0x15, 0x2f, 0x2a,
+    0x94, 0xae, 0x76, 0x3a, 0xaa, 0x1d, 0x44, 0xe6, 0x30, 0x63, 0x83, 0x0b,
+    0x1c, 0x1d, 0x61, 0x22, 0xa1, 0xfb, 0x9c, 0xfe, 0xf6, 0xd4, 0x08, 0x58,
+    0x03, 0x9e, 0xec, 0x0f, 0x6e, 0x1f, 0x93, 0x34, 0xc7, 0x06, 0x68, 0x1c,
+    0x34, 0x8d, 0xea, 0x28, 0x22, 0xcb, 0xcb, 0xc9, 0xd3, 0xe4, 0x65, 0xac,
+    0x95, 0xf5, 0xa2, 0xe4, 0xa3, 0x3d, 0x52, 0xb0, 0x7b, 0xb5, 0x8b, 0x93,
+    0x9e, 0x93, 0x77, 0x9e, 0x3d, 0x7d, 0x72, 0xf4, 0xb5, 0x94, 0xb4, 0xa8,
+    0x74, 0x04, 0xbf, 0x5d, 0x70, 0x4c, 0x90, 0xb7, 0x52, 0x2f, 0xdf, 0x7b,
+    0x98, 0x1a, 0xfc, 0x01, 0xcf, 0x20, 0x73, 0x20, 0x35, 0x03, 0xef, 0x86,
+    0x37, 0x25, 0xa6, 0x29, 0x2f, 0x36, 0x7d, 0x73, 0xfb, 0x7d, 0xcd, 0x52,
+    0x6c, 0x6e, 0x16, 0x61, 0x09, 0x91, 0x0d, 0xab, 0xe9, 0xae, 0xcd, 0x68,
+    0x90, 0x9d, 0xdf, 0x32, 0xa5, 0x6e, 0xcd, 0x7d, 0x66, 0xd7, 0x68, 0x57,
+    0xc1, 0x98, 0x03, 0xa9, 0xc5, 0x59, 0x90, 0xe8, 0x99, 0xcd, 0x43, 0xbf,
+    0x99, 0xcb, 0xc7, 0x77, 0x69, 0x0e, 0x25, 0x95, 0x79, 0xd9, 0xde, 0x98,
+    0x36, 0xe9, 0xae, 0x81, 0x28, 0x5b, 0x2a, 0x36, 0xf2, 0x2e, 0xf7, 0x95,
+    0xc5, 0x2f, 0x90, 0xc6, 0xac, 0x38, 0xad, 0xde, 0x5a, 0x1d, 0x5a, 0x3c,
+    0xab, 0xa8, 0xd2, 0x04, 0xe4, 0x03, 0xd8, 0xa8, 0xb9, 0x1b, 0xba, 0x31,
+    0xdf, 0xfa, 0x68, 0x3a, 0xac, 0x71, 0xc4, 0x0f, 0x6f, 0x95, 0xf1, 0x91,
+    0xb9, 0xd2, 0x8f, 0x30, 0x8d, 0xd5, 0x82, 0x75, 0xef, 0x7c, 0x4a, 0xcb,
+    0x75, 0xa2, 0x08, 0x66, 0x82, 0xb8, 0x16, 0xec, 0x16, 0xe3, 0x4c, 0x00,
+    0xa2, 0x34, 0x23, 0xd8, 0x9b, 0x9c, 0x47, 0x4e, 0xed, 0x21, 0xe9, 0x07,
+    0x69, 0x50, 0xd3, 0xfa, 0x9d, 0x91, 0x5b, 0x9d, 0x48, 0x48, 0xea, 0xfc,
+    0x03, 0x83, 0x8c, 0x85, 0xb3, 0xbb, 0x8a, 0x44, 0xaa, 0x2a, 0x54, 0x24,
+    0x13, 0xf2, 0x58, 0x22, 0x5e, 0x8f, 0x96, 0x2a, 0x88, 0xa9, 0xd7, 0x11,
+    0xc4, 0x10, 0x50, 0x61, 0x08, 0xd1, 0xf4, 0x73, 0xde, 0x85, 0x3f, 0xfb,
+    0x52, 0x78, 0x9e, 0x9c, 0x57, 0x44, 0x6c, 0x7d, 0x95, 0x7c, 0xd1, 0xc5,
+    0x95, 0xfa, 0xc6, 0x0d, 0xf3, 0xc7, 0x87, 0x84, 0x4a, 0x7f, 0x6c, 0xd3,
+    0xd4, 0x1c, 0xc2, 0x84, 0x4f, 0x0a, 0xe9, 0xbd, 0x61, 0x97, 0x61, 0x9b,
+    0x69, 0x5b, 0xdd, 0x64, 0xc4, 0xf5, 0x0f, 0x82, 0xaa, 0x20, 0xd3, 0xf9,
+    0x27, 0x62, 0x0f, 0xb8, 0x1f, 0x3a, 0x51, 0xa2, 0xee, 0xf3, 0x94, 0xe7,
+    0x94, 0x55, 0xc1, 0xb2, 0x67, 0x7e, 0xd9, 0x38, 0xc9, 0xfa, 0xd1, 0x4d,
+    0xe8, 0x7e, 0xf8, 0x14, 0x5c, 0xe2, 0x90, 0x67, 0x4c, 0x71, 0x40, 0x31,
+    0x35, 0x6d, 0x40, 0x3c, 0x52, 0xaa, 0x4d, 0x8b, 0x70, 0x39, 0xd5, 0xcb,
+    0x25, 0x8a, 0x71, 0x9d, 0x97, 0x4b, 0xb6, 0x8a, 0x68, 0x7f, 0x97, 0xc2,
+    0x1f, 0x4e, 0xa9, 0x08, 0xd9, 0x1b, 0x8c, 0x10, 0x04, 0x78, 0xf6, 0x87,
+    0xe2, 0x1a, 0xa8, 0xad, 0x70, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x02, 0xaf,
+    0xf7, 0x8d, 0x5f, 0x20, 0x08, 0x32, 0xc0, 0x03, 0x10, 0x00, 0x97, 0x80,
+    0x10, 0x40, 0x82, 0x00, 0x00, 0x10, 0xdd, 0x66, 0x06, 0xfe, 0xed, 0x3e,
+    0xff, 0x13, 0x4f, 0x0c, 0x34, 0x0e, 0x00, 0xab, 0xfe, 0x2b, 0x28, 0x24,
+    0xb8, 0x75, 0x07, 0xed, 0xc1, 0xf3, 0xac, 0x01, 0x0d, 0x68, 0x2c, 0x6a,
+    0x2b, 0x55, 0xe8, 0x89, 0x33, 0xe5, 0xce, 0xcb, 0x25, 0xfe, 0x98, 0xd0,
+    0x60, 0xf7, 0x6e, 0x4d, 0x9a, 0x3c, 0x44, 0x34, 0x76, 0xfb, 0xb7, 0x36,
+    0x78, 0x87, 0x55, 0x5f, 0x8e, 0x07, 0x78, 0x1b, 0x98, 0xab, 0x3a, 0xed,
+    0x7a, 0x0d, 0xe3, 0x27, 0xf3, 0x19, 0x22, 0xb5, 0x13, 0x56, 0x82, 0xc8,
+    0xc5, 0x14, 0x1c, 0x0f, 0x94, 0xdb, 0xb5, 0x7d, 0xc6, 0xf0, 0x10, 0x66,
+    0xbb, 0xc4, 0xa6, 0xb0, 0x89, 0x32, 0xa9, 0x4e, 0x75, 0x0b, 0x3c, 0xb8,
+    0x8d, 0x1f, 0x6b, 0xdd, 0xbe, 0xc1, 0xa4, 0x3d, 0x42, 0x58, 0x3a, 0x31,
+    0x07, 0x4c, 0xf0, 0x6c, 0x5d, 0x14, 0x7b, 0x05, 0x84, 0xf4, 0x2e, 0xd3,
+    0x3b, 0x16, 0x19, 0x0f, 0x65, 0x8e, 0x8a, 0xc2, 0x09, 0xb4, 0x24, 0x6d,
+    0xee, 0x12, 0x2e, 0x08, 0xa5, 0x47, 0xf9, 0xbb, 0x1a, 0x62, 0xf0, 0x5f,
+    0x31, 0x9d, 0xe0, 0x6e, 0x8a, 0x44, 0xe0, 0xa3, 0x98, 0x43, 0x03, 0x09,
+    0x29, 0x5e, 0x0b, 0x96, 0x11, 0x02, 0xe8, 0xa5, 0x4c, 0x99, 0x36, 0x56,
+    0xfa, 0x73, 0x75, 0xf4, 0x2d, 0x35, 0x2e, 0x41, 0xab, 0x83, 0x29, 0x4d,
+    0xcc, 0x08, 0xe7, 0xdc, 0x7e, 0x8f, 0x2b, 0x0a, 0x35, 0x85, 0x39, 0xc8,
+    0xfc, 0x4a, 0x2e, 0xb5, 0x0d, 0x37, 0xb8, 0x63, 0xa7, 0x9b, 0x63, 0x01,
+    0x92, 0x7b, 0xea, 0x76, 0xc0, 0xde, 0xb5, 0xdf, 0xf6, 0x38, 0x78, 0xd3,
+    0xf5, 0x27, 0xe3, 0xc9, 0xd0, 0x51, 0x07, 0x1b, 0xdf, 0x98, 0x6b, 0xc5,
+    0x8a, 0x34, 0xd9, 0x77, 0x23, 0x35, 0x7e, 0x8e, 0x4d, 0xef, 0x4d, 0x67,
+    0x60, 0x04, 0x75, 0xcd, 0xaf, 0xe2, 0x42, 0xbe, 0xf8, 0xae, 0xa4, 0xda,
+    0x9c, 0x08, 0x8c, 0x96, 0xad, 0x63, 0x18, 0x71, 0xc3, 0x59, 0xa5, 0x8f,
+    0x20, 0x68, 0x87, 0x17, 0xac, 0xd9, 0xb0, 0x3b, 0xc6, 0x67, 0x4e, 0x3f,
+    0xc4, 0x93, 0x17, 0x1b, 0x83, 0xfb, 0x25, 0xb6, 0x01, 0x43, 0x51, 0x52,
+    0xac, 0x3d, 0x14, 0x95, 0xa3, 0x0b, 0x49, 0xe8, 0x53, 0xf7, 0xed, 0xdb,
+    0x1d, 0xc6, 0xbb, 0x4f, 0x2d, 0x62, 0x65, 0xaf, 0xf0, 0xc7, 0xd1, 0x25,
+    0x52, 0x9a, 0x15, 0xdd, 0x98, 0x4e, 0x6b, 0xd5, 0x73, 0x3f, 0xcc, 0xac,
+    0x65, 0x08, 0xf3, 0x7e, 0xb3, 0x6f, 0xd1, 0x6a, 0xf7, 0x7e, 0xf3, 0x1d,
+    0x0d, 0x71, 0x5c, 0x70, 0x1f, 0x25, 0x12, 0x3b, 0x94, 0x59, 0xc0, 0xe9,
+    0xda, 0xcd, 0xe8, 0xa5, 0xc3, 0x88, 0xd5, 0x0e, 0x47, 0xaf, 0xc9, 0x81,
+    0x74, 0xc6, 0x51, 0x91, 0x24, 0x37, 0xcb, 0x15, 0x0a, 0xe3, 0x83, 0x86,
+    0x7b, 0xf9, 0xe1, 0x0c, 0x06, 0x4e, 0xfe, 0x45, 0x56, 0x26, 0x41, 0x63,
+    0x36, 0xcf, 0xdf, 0x70, 0x32, 0x21, 0x71, 0x75, 0x8e, 0xd4, 0xe3, 0xda,
+    0x00, 0x14, 0xd5, 0x43, 0x75, 0x46, 0x24, 0x39, 0xda, 0xbc, 0xd6, 0x8d,
+    0x65, 0x8a, 0x31, 0x94, 0x8f, 0x12, 0x00, 0x8a, 0xb2, 0xdf, 0x53, 0x90,
+    0x8d, 0xc9, 0x09, 0x42, 0x1f, 0x4f, 0x27, 0x37, 0xdd, 0x24, 0xc2, 0x36,
+    0x00, 0x00, 0x01, 0x01, 0x00, 0x78, 0x00, 0x5a, 0x0a, 0x0a, 0x00, 0x00,
+    0x00, 0x02, 0xaf, 0xf7, 0x8d, 0x5f, 0x20, 0x08, 0x32, 0x0f, 0x10, 0x00,
+    0x97, 0x80, 0x10, 0x40, 0x82, 0x00, 0x00, 0x10, 0x00, 0x27, 0x27, 0x1c,
+    0xcc, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x02, 0xaf, 0xf7, 0x8d, 0x5f, 0x20,
+    0x08, 0x32, 0x95, 0x02, 0x10, 0x00, 0x97, 0x80, 0x10, 0x40, 0x82, 0x01,
+    0xe7, 0x90, 0xcc, 0x9f, 0x8d, 0x6d, 0xa1, 0x54, 0x2f, 0xad, 0x57, 0x52,
+    0x3f, 0x06, 0xb8, 0x98, 0x79, 0x05, 0xf4, 0x3c, 0x82, 0xa4, 0x44, 0x67,
+    0x01, 0x2b, 0x22, 0x7d, 0xd7, 0xa6, 0xde, 0xbb, 0x82, 0xf1, 0x6c, 0xe9,
+    0x13, 0x60, 0xc1, 0xd4, 0x99, 0x42, 0x97, 0x7c, 0x92, 0x7e, 0xb0, 0xed,
+    0xea, 0xa9, 0x08, 0xd5, 0xb3, 0xea, 0xab, 0xad, 0x1c, 0x39, 0xee, 0x12,
+    0x1f, 0x25, 0x9f, 0x08, 0xeb, 0x5c, 0xbb, 0x91, 0x9e, 0x32, 0xb7, 0xf4,
+    0xaa, 0x88, 0xfd, 0xda, 0xfa, 0x15, 0x67, 0x83, 0x80, 0x1d, 0x7b, 0x1b,
+    0x29, 0x5b, 0x9f, 0xe8, 0x9a, 0xbc, 0xff, 0x10, 0x12, 0x6c, 0x27, 0x5c,
+    0x50, 0x54, 0x2a, 0xdb, 0xef, 0x23, 0x1e, 0x60, 0xeb, 0x29, 0x6f, 0xe4,
+    0x44, 0x55, 0x5c, 0xde, 0x4f, 0x2e, 0xa0, 0x68, 0x82, 0x69, 0x68, 0xda,
+    0xe0, 0xad, 0x09, 0xbc, 0xc5, 0x2e, 0x5c, 0x43, 0xeb, 0xdd, 0x5d, 0x49,
+    0x42, 0x17, 0x01, 0xce, 0x6b, 0x6e, 0x99, 0x4d, 0x05, 0x03, 0x48, 0x7e,
+    0xba, 0x35, 0xbc, 0x70, 0xc8, 0x3b, 0xd9, 0xc6, 0x68, 0x96, 0x6d, 0xd7,
+    0xe9, 0xc3, 0xb3, 0x8f, 0x96, 0x7a, 0x90, 0xdb, 0x51, 0x50, 0xff, 0x81,
+    0xd8, 0x63, 0x7e, 0xa2, 0xf1, 0xba, 0xac, 0x3a, 0x8c, 0x6a, 0xd2, 0xef,
+    0xd3, 0xb1, 0xa9, 0xa1, 0xcb, 0xcd, 0x96, 0xab, 0xbe, 0xa7, 0x36, 0x70,
+    0x00, 0x5a, 0x49, 0xb7, 0x52, 0x0f, 0xb4, 0x83, 0xf0, 0xed, 0x75, 0x8d,
+    0x71, 0xb8, 0xf5, 0x32, 0x55, 0x30, 0x67, 0xcf, 0xef, 0x09, 0x3b, 0xff,
+    0xd2, 0x5a, 0x51, 0xa0, 0x6a, 0x9c, 0x89, 0xaa, 0xf5, 0x6f, 0x34, 0x98,
+    0x50, 0x50, 0x0d, 0x10, 0xc9, 0x9e, 0xa5, 0xf1, 0xa4, 0xd5, 0xf1, 0x9d,
+    0xa8, 0xda, 0xda, 0xcc, 0x04, 0x03, 0x17, 0x5c, 0xb6, 0xf5, 0xfa, 0xec,
+    0x17, 0x22, 0x7b, 0xc7, 0x21, 0xf1, 0x8b, 0xab, 0x15, 0x98, 0xc7, 0x94,
+    0x7f, 0x94, 0x6f, 0x29, 0x10, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x02, 0xaf,
+    0xf7, 0x8d, 0x5f, 0x20, 0x08, 0x32, 0xef, 0x01, 0x10, 0x00, 0x97, 0x80,
+    0x10, 0x40, 0x82, 0x01, 0xe0, 0x10, 0xd8, 0x03, 0x9a, 0xfa, 0x9a, 0x8c,
+    0x5f, 0xbd, 0x20, 0xf8, 0xca, 0xd6, 0x68, 0x54, 0xa6, 0x59, 0x93, 0x18,
+    0x7b, 0xfa, 0x90, 0x21, 0x19, 0xaa, 0x6c, 0x09, 0x26, 0xe5, 0x71, 0x06,
+    0x99, 0x99, 0xb0, 0xee, 0x15, 0xaf, 0x96, 0x4e, 0x1b, 0xb3, 0x98, 0x1c,
+    0xb4, 0x1a, 0xd9, 0xcd, 0xbf, 0xe0, 0x9b, 0xaf, 0xd6, 0xdd, 0xf3, 0x8c,
+    0x4a, 0x04, 0xc5, 0xb9, 0x97, 0x11, 0x52, 0x83, 0x79, 0xee, 0x4f, 0x68,
+    0x09, 0x9b, 0x3d, 0x1b, 0xfe, 0x71, 0x8c, 0x85, 0x02, 0x30, 0x7e, 0x26,
+    0xee, 0x46, 0x82, 0x69, 0x92, 0xeb, 0x8b, 0xe1, 0xa0, 0x0b, 0xb4, 0x79,
+    0xd0, 0x48, 0xd9, 0x44, 0x8b, 0xb8, 0xed, 0x22, 0xe8, 0xc1, 0xfb, 0x35,
+    0xb9, 0xf0, 0x43, 0x70, 0x98, 0x40, 0x9c, 0x0c, 0x57, 0xc5, 0xe2, 0x28,
+    0x03, 0xf3, 0x49, 0x33, 0x76, 0x4f, 0xd1, 0xeb, 0xc3, 0xa7, 0x73, 0x9b,
+    0x58, 0xcf, 0x06, 0x21, 0xf8, 0xe1, 0xb1, 0x2e, 0xda, 0xe9, 0xcc, 0x72,
+    0x4c, 0xa0, 0x42, 0xec, 0x5f, 0xcb, 0x09, 0xda, 0xc0, 0x9d, 0x34, 0xf7,
+    0xf5, 0xe6, 0x42, 0x84, 0xba, 0x51, 0xe5, 0x88, 0xfe, 0xd9, 0xd9, 0x32,
+    0x76, 0xfa, 0xb3, 0x56, 0x42, 0xa7, 0x72, 0xa7, 0x89, 0xa4, 0xa4, 0x79,
+    0xcc, 0x8f, 0x24, 0xcd, 0xdb, 0x77, 0x56, 0xb4, 0xad, 0xaf, 0x2a, 0x02,
+    0x61, 0x4b, 0x04, 0xfe, 0x74, 0xe3, 0x08, 0xe6, 0xf1, 0xb9, 0xf9, 0x1c,
+    0x30, 0x15, 0x64, 0x7f, 0x3f, 0x10, 0x6e, 0xd0, 0xca, 0x5d, 0x4d, 0xe6,
+    0xed, 0x41, 0xc3, 0x53, 0xa1, 0x4e, 0x16, 0xcb, 0x5d, 0xe3, 0xd1, 0xfa,
+    0x7e, 0xc4, 0x0b, 0xfd, 0xda, 0xd7, 0x28, 0x0a, 0x0a, 0x00, 0x00, 0x00,
+    0x02, 0xaf, 0xf7, 0x8d, 0x5f, 0x20, 0x08, 0x32, 0xa7, 0x02, 0x10, 0x00,
+    0x97, 0x80, 0x10, 0x40, 0x82, 0x01, 0xe0, 0x10, 0xd8, 0x03, 0x9a, 0xfa,
+    0x9a, 0x8c, 0x5f, 0xbb, 0xe8, 0x89, 0xb7, 0x29, 0x78, 0xc9, 0xe2, 0xa4,
+    0xf3, 0x1c, 0x2e, 0x29, 0xf1, 0x55, 0xa7, 0xe7, 0xf3, 0xb3, 0x7c, 0xfb,
+    0x38, 0x86, 0x9a, 0xf3, 0xea, 0x05, 0x55, 0xcf, 0xc3, 0x67, 0x00, 0xed,
+    0x72, 0x17, 0x80, 0x2e, 0x85, 0x53, 0x45, 0x99, 0x68, 0x54, 0x99, 0x17,
+    0x9a, 0x9c, 0x06, 0xab, 0x2a, 0xa0, 0x87, 0xc5, 0xff, 0x99, 0x3f, 0xdb,
+    0x24, 0x7b, 0x20, 0x05, 0xd1, 0x4a, 0x89, 0xd2, 0x88, 0x40, 0xa9, 0x92,
+    0xec, 0x4a, 0x5a, 0x88, 0xb3, 0xf3, 0x2b, 0x26, 0x0d, 0x37, 0xf9, 0x9c,
+    0x95, 0x9c, 0xe7, 0x0c, 0x05, 0x77, 0x18, 0xa4, 0xaa, 0xfd, 0x77, 0x0e,
+    0xd4, 0x4a, 0x25, 0xf1, 0xe9, 0xa8, 0xa3, 0x23, 0xcb, 0xb7, 0x35, 0x99,
+    0x3a, 0x95, 0x1d, 0x73, 0xe3, 0xc8, 0x0c, 0x39, 0x5a, 0x0f, 0x90, 0x62,
+    0xd2, 0x6b, 0x02, 0x1d, 0x50, 0x22, 0xa4, 0x45, 0x3d, 0x39, 0xcb, 0xff,
+    0x5e, 0x56, 0x1a, 0xef, 0x5a, 0x34, 0xb2, 0x05, 0x3a, 0x35, 0xe0, 0x3b,
+    0x71, 0xc0, 0xee, 0x0b, 0x9c, 0xc9, 0x7c, 0x98, 0xc3, 0x28, 0xce, 0x47,
+    0xb1, 0x23, 0xb8, 0xef, 0x8f, 0x63, 0xc1, 0xa4, 0x46, 0xd0, 0xb3, 0x72,
+    0xf0, 0x48, 0x67, 0xce, 0x2e, 0xd3, 0x94, 0xaa, 0x20, 0x94, 0x29, 0xbe,
+    0xaf, 0xb4, 0xf0, 0x40, 0xcf, 0xdc, 0x87, 0xc6, 0xeb, 0xd6, 0x7c, 0x70,
+    0x62, 0xd2, 0x66, 0x15, 0x96, 0x79, 0xac, 0x7a, 0xa1, 0x83, 0xf9, 0x1c,
+    0xeb, 0x70, 0x07, 0x8a, 0x22, 0x88, 0xf5, 0xc6, 0x93, 0xb1, 0xd1, 0xd2,
+    0x52, 0xeb, 0xaa, 0x6a, 0xdf, 0xd7, 0x0f, 0x4e, 0x58, 0x60, 0x6a, 0x22,
+    0x1a, 0xad, 0x4d, 0x2e, 0xee, 0x4f, 0x3c, 0xc0, 0x31, 0x81, 0x73, 0x9b,
+    0xe8, 0x80, 0x13, 0xf4, 0x9e, 0xb6, 0xad, 0xbf, 0x77, 0x3b, 0x45, 0x53,
+    0x9e, 0x5b, 0xae, 0x35, 0xff, 0xb2, 0x6a, 0x07, 0x55, 0xe2, 0xf5, 0xda,
+    0x59, 0x75, 0x37, 0x53, 0x82, 0xeb, 0x1b, 0xe3, 0x97, 0x67, 0x2d, 0x48,
+    0x36, 0x77, 0xc9, 0x92, 0x90,
+};
+#define AVIF_GRID_ALPHA_CRC (0xdd27cc35U)
+
+#endif
@@ -0,0 +1,172 @@
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "queue.h"
+
+/* throughput of the ring with N producers and M consumers, every item is
+ * checked in so the numbers only count when nothing got lost
+ *
+ *   bench_queue [producers] [consumers] [items per producer] [batch]
+ */
+
+struct bench {
+    struct ring_queue *rq;
+    int producers;
+    int consumers;
+    long items;
+    int batch;
+    atomic_long consumed;
+};
+
+struct worker {
+    pthread_t tid;
+    struct bench *b;
+    int id;
+    uint64_t sum;
+    long n;
+};
+
+/* item values are never NULL, the id keeps producers apart */
+#define ITEM(id, i) ((uintptr_t)(((uint64_t)(id) << 32) | (uint64_t)((i) + 1)))
+
+static void *
+produce(void *arg)
+{
+    struct worker *w = arg;
+    struct bench *b = w->b;
+    void *buf[64];
+
+    for (long i = 0; i < b->items;) {
+        int n = (b->batch > 1) ? b->batch : 1;
+        if (i + n > b->items) {
+            n = b->items - i;
+        }
+        for (int k = 0; k < n; k++) {
+            buf[k] = (void *)ITEM(w->id, i + k);
+        }
+        bool ok = (n > 1) ? ring_enqueue_bulk(b->rq, buf, n)
+                          : ring_enqueue(b->rq, buf[0]);
+        if (!ok) {
+            sched_yield();
+            continue;
+        }
+        for (int k = 0; k < n; k++) {
+            w->sum += (uintptr_t)buf[k];
+        }
+        i += n;
+    }
+    return NULL;
+}
+
+static void *
+consume(void *arg)
+{
+    struct worker *w = arg;
+    struct bench *b = w->b;
+    long total = b->items * b->producers;
+    void *buf[64];
+
+    while (atomic_load(&b->consumed) < total) {
+        int n = 0;
+        if (b->batch > 1) {
+            n = ring_dequeue_bulk(b->rq, buf, b->batch);
+        }
+        if (n == 0) {
+            // the tail is shorter than a batch, or no bulk at all
+            buf[0] = ring_dequeue_wait(b->rq, 1);
+            n = buf[0] ? 1 : 0;
+        }
+        for (int k = 0; k < n; k++) {
+            w->sum += (uintptr_t)buf[k];
+        }
+        w->n += n;
+        atomic_fetch_add(&b->consumed, n);
+    }
+    return NULL;
+}
+
+static double
+now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static int
+run(int producers, int consumers, long items, int batch)
+{
+    struct bench b = {
+        .rq = ring_alloc(1024),
+        .producers = producers,
+        .consumers = consumers,
+        .items = items,
+        .batch = batch,
+    };
+    struct worker *p = calloc(producers, sizeof(struct worker));
+    struct worker *c = calloc(consumers, sizeof(struct worker));
+    uint64_t psum = 0, csum = 0;
+    long n = 0;
+
+    atomic_init(&b.consumed, 0);
+    double start = now();
+    for (int i = 0; i < consumers; i++) {
+        c[i].b = &b;
+        c[i].id = i;
+        pthread_create(&c[i].tid, NULL, consume, &c[i]);
+    }
+    for (int i = 0; i < producers; i++) {
+        p[i].b = &b;
+        p[i].id = i;
+        pthread_create(&p[i].tid, NULL, produce, &p[i]);
+    }
+    for (int i = 0; i < producers; i++) {
+        pthread_join(p[i].tid, NULL);
+        psum += p[i].sum;
+    }
+    for (int i = 0; i < consumers; i++) {
+        pthread_join(c[i].tid, NULL);
+        csum += c[i].sum;
+        n += c[i].n;
+    }
+    double t = now() - start;
+
+    int ret = 0;
+    if (n != items * producers || psum != csum || ring_count(b.rq) != 0) {
+        printf("lost items: %ld of %ld, sum %lx vs %lx\n", n, items * producers,
+               (unsigned long)csum, (unsigned long)psum);
+        ret = -1;
+    }
+    printf("%dP/%dC batch %2d: %.2f Mops/s\n", producers, consumers, batch,
+           n / t / 1e6);
+    free(p);
+    free(c);
+    ring_free(b.rq);
+    return ret;
+}
+
+int main(int argc, const char *argv[])
+{
+    int producers = (argc > 1) ? atoi(argv[1]) : 2;
+    int consumers = (argc > 2) ? atoi(argv[2]) : 2;
+    long items = (argc > 3) ? atol(argv[3]) : 1000000;
+    int batch = (argc > 4) ? atoi(argv[4]) : 0;
+
+    if (producers < 1 || consumers < 1 || items < 1 || batch < 0 || batch > 64) {
+        printf("usage: %s [producers] [consumers] [items] [batch <= 64]\n",
+               argv[0]);
+        return -1;
+    }
+    if (argc > 4) {
+        return run(producers, consumers, items, batch);
+    }
+    if (run(producers, consumers, items, 1) ||
+        run(producers, consumers, items, 16)) {
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,242 @@
+/* heif files put together from x265 pictures, with the crc32 of their
+ * BGRA pixels worked out from the libavcodec output of each tile on its own
+ */
+#ifndef _HEIF_STREAMS_H_
+#define _HEIF_STREAMS_H_
+
+#include <stdint.h>
+
+/* 2x2 grid of 64x48 tiles cropped to 120x90, each tile with its own hvcC,
+ * and a 32x24 thmb item of the grid
+ */
+static const uint8_t heif_grid_thmb[2698] = {
+    0x00, 0x00, 0x00, 0x1c, 0x66, 0x74, 0x79, 0x70, 0x68, 0x65, 0x69, 0x63,
+    0x00, 0x00, 0x00, 0x00, 0x6d, 0x69, 0x66, 0x31, 0x68, 0x65, 0x69, 0x63,
+    0x6d, 0x69, 0x61, 0x66, 0x00, 0x00, 0x04, 0x2b, 0x6d, 0x65, 0x74, 0x61,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x68, 0x64, 0x6c, 0x72,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x69, 0x63, 0x74,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x70, 0x69, 0x74, 0x6d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x64, 0x69, 0x6c, 0x6f, 0x63, 0x00,
+    0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x04, 0x4f, 0x00, 0x00, 0x00, 0x08, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x57, 0x00, 0x00, 0x01, 0x68, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0xbf, 0x00, 0x00, 0x01,
+    0x6b, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x2a, 0x00,
+    0x00, 0x01, 0x77, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08,
+    0xa1, 0x00, 0x00, 0x01, 0x74, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x0a, 0x15, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x8c, 0x69,
+    0x69, 0x6e, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x15, 0x69, 0x6e, 0x66, 0x65, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x67, 0x72, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x15, 0x69, 0x6e,
+    0x66, 0x65, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x68, 0x76,
+    0x63, 0x31, 0x00, 0x00, 0x00, 0x00, 0x15, 0x69, 0x6e, 0x66, 0x65, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x68, 0x76, 0x63, 0x31, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x69, 0x6e, 0x66, 0x65, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x68, 0x76, 0x63, 0x31, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x69, 0x6e, 0x66, 0x65, 0x02, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
+    0x00, 0x68, 0x76, 0x63, 0x31, 0x00, 0x00, 0x00, 0x00, 0x15, 0x69, 0x6e,
+    0x66, 0x65, 0x02, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x68, 0x76,
+    0x63, 0x31, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x69, 0x72, 0x65, 0x66, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x64, 0x69, 0x6d, 0x67, 0x00,
+    0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00,
+    0x00, 0x00, 0x0e, 0x74, 0x68, 0x6d, 0x62, 0x00, 0x06, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x00, 0x02, 0xd2, 0x69, 0x70, 0x72, 0x70, 0x00, 0x00, 0x02,
+    0x97, 0x69, 0x70, 0x63, 0x6f, 0x00, 0x00, 0x00, 0x74, 0x68, 0x76, 0x63,
+    0x43, 0x01, 0x01, 0x60, 0x00, 0x00, 0x03, 0x00, 0x90, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0xf0, 0x00, 0xfc, 0xfd, 0xf8, 0xf8, 0x00, 0x00, 0x0f, 0x03,
+    0xa0, 0x00, 0x01, 0x00, 0x18, 0x40, 0x01, 0x0c, 0x01, 0xff, 0xff, 0x01,
+    0x60, 0x00, 0x00, 0x03, 0x00, 0x90, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x1e, 0x95, 0x98, 0x09, 0xa1, 0x00, 0x01, 0x00, 0x28, 0x42, 0x01,
+    0x01, 0x01, 0x60, 0x00, 0x00, 0x03, 0x00, 0x90, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x03, 0x00, 0x1e, 0xa0, 0x20, 0x83, 0x16, 0x59, 0x59, 0xae, 0x4c,
+    0xae, 0x68, 0x08, 0x00, 0x00, 0x03, 0x00, 0x08, 0x00, 0x00, 0x03, 0x00,
+    0x08, 0x40, 0xa2, 0x00, 0x01, 0x00, 0x06, 0x44, 0x01, 0xc1, 0x73, 0xd0,
+    0x89, 0x00, 0x00, 0x00, 0x74, 0x68, 0x76, 0x63, 0x43, 0x01, 0x01, 0x60,
+    0x00, 0x00, 0x03, 0x00, 0x90, 0x00, 0x00, 0x03, 0x00, 0x00, 0xf0, 0x00,
+    0xfc, 0xfd, 0xf8, 0xf8, 0x00, 0x00, 0x0f, 0x03, 0xa0, 0x00, 0x01, 0x00,
+    0x18, 0x40, 0x01, 0x0c, 0x01, 0xff, 0xff, 0x01, 0x60, 0x00, 0x00, 0x03,
+    0x00, 0x90, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x1e, 0x95, 0x98,
+    0x09, 0xa1, 0x00, 0x01, 0x00, 0x28, 0x42, 0x01, 0x01, 0x01, 0x60, 0x00,
+    0x00, 0x03, 0x00, 0x90, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x1e,
+    0xa0, 0x20, 0x83, 0x16, 0x59, 0x59, 0xae, 0x4c, 0xae, 0x68, 0x08, 0x00,
+    0x00, 0x03, 0x00, 0x08, 0x00, 0x00, 0x03, 0x00, 0x08, 0x40, 0xa2, 0x00,
+    0x01, 0x00, 0x06, 0x44, 0x01, 0xc1, 0x73, 0xd0, 0x89, 0x00, 0x00, 0x00,
+    0x74, 0x68, 0x76, 0x63, 0x43, 0x01, 0x01, 0x60, 0x00, 0x00, 0x03, 0x00,
+    0x90, 0x00, 0x00, 0x03, 0x00, 0x00, 0xf0, 0x00, 0xfc, 0xfd, 0xf8, 0xf8,
+    0x00, 0x00, 0x0f, 0x03, 0xa0, 0x00, 0x01, 0x00, 0x18, 0x40, 0x01, 0x0c,
+    0x01, 0xff, 0xff, 0x01, 0x60, 0x00, 0x00, 0x03, 0x00, 0x90, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x03, 0x00, 0x1e, 0x95, 0x98, 0x09, 0xa1, 0x00, 0x01,
+    0x00, 0x28, 0x42, 0x01, 0x01, 0x01, 0x60, 0x00, 0x00, 0x03, 0x00, 0x90,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x1e, 0xa0, 0x20, 0x83, 0x16,
+    0x59, 0x59, 0xae, 0x4c, 0xae, 0x68, 0x08, 0x00, 0x00, 0x03, 0x00, 0x08,
+    0x00, 0x00, 0x03, 0x00, 0x08, 0x40, 0xa2, 0x00, 0x01, 0x00, 0x06, 0x44,
+    0x01, 0xc1, 0x73, 0xd0, 0x89, 0x00, 0x00, 0x00, 0x74, 0x68, 0x76, 0x63,
+    0x43, 0x01, 0x01, 0x60, 0x00, 0x00, 0x03, 0x00, 0x90, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0xf0, 0x00, 0xfc, 0xfd, 0xf8, 0xf8, 0x00, 0x00, 0x0f, 0x03,
+    0xa0, 0x00, 0x01, 0x00, 0x18, 0x40, 0x01, 0x0c, 0x01, 0xff, 0xff, 0x01,
+    0x60, 0x00, 0x00, 0x03, 0x00, 0x90, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x1e, 0x95, 0x98, 0x09, 0xa1, 0x00, 0x01, 0x00, 0x28, 0x42, 0x01,
+    0x01, 0x01, 0x60, 0x00, 0x00, 0x03, 0x00, 0x90, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x03, 0x00, 0x1e, 0xa0, 0x20, 0x83, 0x16, 0x59, 0x59, 0xae, 0x4c,
+    0xae, 0x68, 0x08, 0x00, 0x00, 0x03, 0x00, 0x08, 0x00, 0x00, 0x03, 0x00,
+    0x08, 0x40, 0xa2, 0x00, 0x01, 0x00, 0x06, 0x44, 0x01, 0xc1, 0x73, 0xd0,
+    0x89, 0x00, 0x00, 0x00, 0x14, 0x69, 0x73, 0x70, 0x65, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+    0x10, 0x70, 0x69, 0x78, 0x69, 0x00, 0x00, 0x00, 0x00, 0x03, 0x08, 0x08,
+    0x08, 0x00, 0x00, 0x00, 0x14, 0x69, 0x73, 0x70, 0x65, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
+    0x73, 0x68, 0x76, 0x63, 0x43, 0x01, 0x01, 0x60, 0x00, 0x00, 0x03, 0x00,
+    0x90, 0x00, 0x00, 0x03, 0x00, 0x00, 0xf0, 0x00, 0xfc, 0xfd, 0xf8, 0xf8,
+    0x00, 0x00, 0x0f, 0x03, 0xa0, 0x00, 0x01, 0x00, 0x18, 0x40, 0x01, 0x0c,
+    0x01, 0xff, 0xff, 0x01, 0x60, 0x00, 0x00, 0x03, 0x00, 0x90, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x03, 0x00, 0x1e, 0x95, 0x98, 0x09, 0xa1, 0x00, 0x01,
+    0x00, 0x27, 0x42, 0x01, 0x01, 0x01, 0x60, 0x00, 0x00, 0x03, 0x00, 0x90,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x1e, 0xa0, 0x42, 0x19, 0x65,
+    0x95, 0x9a, 0xaf, 0x2b, 0x9a, 0x02, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00,
+    0x00, 0x03, 0x00, 0x02, 0x10, 0xa2, 0x00, 0x01, 0x00, 0x06, 0x44, 0x01,
+    0xc1, 0x73, 0xd0, 0x89, 0x00, 0x00, 0x00, 0x14, 0x69, 0x73, 0x70, 0x65,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x18,
+    0x00, 0x00, 0x00, 0x33, 0x69, 0x70, 0x6d, 0x61, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x02, 0x07, 0x06, 0x00, 0x02, 0x03,
+    0x81, 0x05, 0x06, 0x00, 0x03, 0x03, 0x82, 0x05, 0x06, 0x00, 0x04, 0x03,
+    0x83, 0x05, 0x06, 0x00, 0x05, 0x03, 0x84, 0x05, 0x06, 0x00, 0x06, 0x03,
+    0x88, 0x09, 0x06, 0x00, 0x00, 0x06, 0x43, 0x6d, 0x64, 0x61, 0x74, 0x00,
+    0x00, 0x01, 0x01, 0x00, 0x78, 0x00, 0x5a, 0x00, 0x00, 0x01, 0x64, 0x28,
+    0x01, 0xaf, 0x2e, 0xe4, 0x68, 0xc0, 0xdd, 0xee, 0x7f, 0xfc, 0xda, 0x6e,
+    0x54, 0x84, 0x86, 0xbb, 0x13, 0x98, 0x48, 0x4c, 0xe4, 0x92, 0x2d, 0x17,
+    0xe9, 0x05, 0x0c, 0xed, 0xd5, 0xd3, 0x5b, 0x1f, 0x4c, 0x8c, 0x25, 0x2c,
+    0x15, 0x65, 0x92, 0x86, 0x72, 0xe4, 0x9c, 0x29, 0x9d, 0x4a, 0xb5, 0x9d,
+    0x66, 0x9d, 0xaf, 0x2d, 0xb6, 0xb0, 0xc1, 0xe6, 0x60, 0x2a, 0x45, 0xcd,
+    0xfd, 0x40, 0xee, 0xb1, 0x8f, 0xc5, 0x13, 0x4e, 0x4e, 0x2b, 0xc9, 0xb6,
+    0xd6, 0x2e, 0xbc, 0x22, 0x90, 0xed, 0x62, 0xf7, 0x67, 0x69, 0xf9, 0x84,
+    0xfb, 0xb3, 0xbc, 0x01, 0x3e, 0xe2, 0xf8, 0xa5, 0x1d, 0x98, 0xd5, 0x44,
+    0x88, 0x9c, 0x78, 0x5f, 0xa7, 0xf1, 0x12, 0xa0, 0x6b, 0x87, 0x2f, 0xb9,
+    0xf5, 0xdd, 0x52, 0x87, 0x13, 0x12, 0xb9, 0xd4, 0x3d, 0x13, 0xa4, 0x4c,
+    0x72, 0x21, 0xfb, 0x38, 0x0b, 0xbd, 0xf8, 0xa3, 0xb0, 0x99, 0x1e, 0x6a,
+    0xb1, 0xbf, 0xe3, 0xa6, 0x63, 0x80, 0x56, 0xd1, 0x23, 0xeb, 0x8b, 0x8c,
+    0x4e, 0x86, 0xe3, 0x37, 0x84, 0xf0, 0x94, 0xd9, 0x30, 0x30, 0x2d, 0xdb,
+    0x43, 0x11, 0xb8, 0x4b, 0x4c, 0xa3, 0x04, 0x5b, 0xda, 0xb3, 0xf2, 0xd5,
+    0xe3, 0x70, 0x6d, 0xab, 0xe3, 0x03, 0x8c, 0x90, 0x39, 0xa3, 0x9f, 0x1d,
+    0xd0, 0xb7, 0xf0, 0x74, 0xc6, 0x1d, 0x2b, 0xa5, 0x70, 0x92, 0xfa, 0xb6,
+    0x2d, 0x66, 0x35, 0x3d, 0x97, 0xef, 0xf0, 0x2a, 0x9d, 0xad, 0xee, 0x5c,
+    0x6d, 0x72, 0xd7, 0xbd, 0x08, 0x96, 0x2d, 0x07, 0x6e, 0xf2, 0xcd, 0xfb,
+    0xec, 0x23, 0x77, 0x45, 0x8f, 0x02, 0x90, 0xac, 0xae, 0x46, 0xc6, 0xef,
+    0x10, 0x0e, 0x33, 0x92, 0x55, 0xe9, 0x02, 0x99, 0x2e, 0x3a, 0x9f, 0x8b,
+    0xee, 0x2e, 0x2f, 0xa2, 0xdb, 0xef, 0xeb, 0x71, 0x16, 0x5c, 0xaa, 0x9b,
+    0x00, 0x2f, 0x2f, 0xd1, 0x1a, 0xb7, 0x24, 0xdf, 0x19, 0xfd, 0x13, 0xaa,
+    0xee, 0x58, 0x0e, 0xb6, 0x8d, 0x27, 0x68, 0xa0, 0x9b, 0x43, 0xd5, 0x54,
+    0xd3, 0x97, 0x04, 0x8c, 0xa8, 0xa8, 0x64, 0x14, 0x28, 0x44, 0x46, 0x90,
+    0x03, 0x5c, 0x7f, 0xf5, 0x4c, 0x36, 0x2c, 0x2b, 0x42, 0x43, 0xf7, 0xfa,
+    0x12, 0x3c, 0xb5, 0x4a, 0xc2, 0x8a, 0x8b, 0x6d, 0xcc, 0xb9, 0x3a, 0x62,
+    0x6f, 0x71, 0xa3, 0x8c, 0x67, 0x17, 0xfb, 0x08, 0x75, 0x09, 0x0f, 0x8e,
+    0x89, 0xe4, 0x12, 0xa7, 0x62, 0x4b, 0x98, 0xca, 0x5c, 0xee, 0xcb, 0xea,
+    0xa2, 0xff, 0x03, 0xc2, 0xda, 0x62, 0x93, 0xfe, 0x5e, 0x3e, 0xa7, 0xaa,
+    0x92, 0xd1, 0x3a, 0x15, 0x0e, 0x64, 0xb0, 0x00, 0x00, 0x01, 0x67, 0x28,
+    0x01, 0xaf, 0x2e, 0xe4, 0x68, 0xc0, 0xdd, 0xe9, 0xcf, 0xf3, 0x4e, 0x71,
+    0x6f, 0x75, 0x0c, 0xe7, 0x77, 0xb7, 0x52, 0xc8, 0x44, 0xeb, 0x0d, 0x9b,
+    0x94, 0x0c, 0xa6, 0x11, 0x4a, 0xf4, 0x04, 0xf1, 0xdd, 0x61, 0x6e, 0xde,
+    0x4a, 0xf6, 0xce, 0x66, 0x96, 0xda, 0xac, 0x82, 0x33, 0xdc, 0x86, 0x8c,
+    0xb6, 0xb8, 0x10, 0xfc, 0x6f, 0x45, 0x5e, 0x5a, 0x8f, 0x1c, 0x5b, 0x6b,
+    0xbe, 0xc1, 0xd9, 0x84, 0x7f, 0xc1, 0x5c, 0xe2, 0x92, 0x4a, 0x6a, 0xb4,
+    0xd0, 0x2c, 0xa9, 0xc6, 0x31, 0x28, 0xbd, 0x53, 0x79, 0x9c, 0x01, 0x78,
+    0x31, 0xfb, 0x72, 0xb4, 0xe6, 0xbc, 0x05, 0xec, 0x35, 0xb8, 0xcc, 0x9a,
+    0xe2, 0xec, 0x5d, 0x50, 0x39, 0x7c, 0x47, 0x00, 0xd7, 0xf6, 0xd7, 0x56,
+    0x53, 0x59, 0x5c, 0xf3, 0x12, 0x15, 0x87, 0x22, 0xc0, 0xe8, 0xd2, 0x33,
+    0x51, 0xe6, 0x0a, 0xdc, 0x89, 0x02, 0xd0, 0x06, 0x0b, 0x04, 0x65, 0x86,
+    0x3d, 0xc3, 0xfc, 0xb8, 0x94, 0x76, 0xe2, 0x60, 0xde, 0x42, 0xb2, 0x65,
+    0x6c, 0xf1, 0xd9, 0x7d, 0xe9, 0x51, 0x98, 0xcf, 0x61, 0x59, 0xff, 0x0c,
+    0xba, 0x04, 0xc2, 0xdb, 0xb7, 0xba, 0xd2, 0xf6, 0x72, 0x5f, 0x83, 0x83,
+    0xf9, 0x11, 0xf1, 0x20, 0x7d, 0x94, 0xe5, 0xea, 0xdf, 0x12, 0xa4, 0xfb,
+    0x65, 0xe6, 0x71, 0x29, 0x49, 0x80, 0xa3, 0xc7, 0x1a, 0xdd, 0x21, 0x0e,
+    0x7d, 0x6c, 0x2c, 0xd7, 0x1b, 0x67, 0x31, 0xf1, 0xc6, 0xec, 0x61, 0x94,
+    0xd2, 0xf1, 0xda, 0xa6, 0xb5, 0x70, 0x7d, 0xf7, 0xd0, 0x57, 0x10, 0x6e,
+    0x63, 0xaf, 0xdb, 0xfc, 0x50, 0xdb, 0xc1, 0x95, 0x52, 0x4d, 0x78, 0x61,
+    0x01, 0x66, 0x38, 0x83, 0x98, 0xad, 0x1c, 0x75, 0x33, 0x39, 0xed, 0x52,
+    0xac, 0x15, 0xdc, 0xd3, 0x7a, 0xd9, 0xe7, 0xe1, 0x1c, 0x38, 0xa5, 0xb0,
+    0x4c, 0xd8, 0xea, 0x22, 0xb3, 0x1c, 0xdc, 0xf5, 0xab, 0x23, 0xea, 0xa3,
+    0xf3, 0xdd, 0xb6, 0xbf, 0x06, 0x2c, 0x20, 0xaf, 0x15, 0x1e, 0x77, 0x9b,
+    0x15, 0xb6, 0xbb, 0xc9, 0x2d, 0x44, 0x09, 0x92, 0x56, 0x13, 0x33, 0x5a,
+    0xcf, 0xc9, 0xec, 0x4f, 0x4e, 0x86, 0xb6, 0x0f, 0xe3, 0x3a, 0xcb, 0x9b,
+    0x63, 0x17, 0x2a, 0xf7, 0x78, 0x47, 0x07, 0x23, 0xce, 0xb9, 0x14, 0xf1,
+    0x32, 0x3a, 0xa3, 0x76, 0x69, 0x18, 0xd0, 0xa7, 0xc8, 0x1f, 0x4a, 0x0b,
+    0x36, 0x50, 0x14, 0x1a, 0x84, 0xaf, 0xb3, 0x88, 0x3b, 0x84, 0x81, 0x14,
+    0x23, 0x33, 0xa2, 0xa0, 0x41, 0xb7, 0x4c, 0x85, 0xfe, 0xad, 0xe3, 0x42,
+    0xf2, 0x85, 0xdf, 0x2d, 0xbe, 0xe6, 0x9f, 0xf1, 0x75, 0x2c, 0x00, 0x00,
+    0x01, 0x73, 0x28, 0x01, 0xaf, 0x2e, 0xe5, 0x39, 0x16, 0x37, 0xde, 0x05,
+    0x77, 0x80, 0xbd, 0x90, 0xf1, 0xb1, 0xb1, 0x8e, 0x20, 0x72, 0xa6, 0x56,
+    0xbc, 0x13, 0x19, 0xff, 0x2b, 0x28, 0xe2, 0xbc, 0xe5, 0x79, 0x20, 0xcc,
+    0x62, 0xde, 0x57, 0xe1, 0xb9, 0xd9, 0xe9, 0x3a, 0x68, 0xb9, 0xec, 0xab,
+    0x02, 0x26, 0x43, 0xce, 0x91, 0x60, 0xa4, 0x08, 0x61, 0x47, 0xf3, 0x79,
+    0x4b, 0x62, 0xe4, 0xab, 0x14, 0x27, 0x9a, 0x98, 0xab, 0x3c, 0x9e, 0xcd,
+    0x23, 0x4c, 0x28, 0xe3, 0x6a, 0xe1, 0x64, 0x42, 0xd7, 0x4b, 0x67, 0x0c,
+    0x07, 0xe4, 0xab, 0xe9, 0x45, 0xf6, 0x29, 0x6e, 0x03, 0xb1, 0xcc, 0x7b,
+    0x27, 0x71, 0x31, 0xfb, 0x35, 0x9c, 0x4f, 0xad, 0x15, 0x92, 0x45, 0x68,
+    0x3f, 0xdd, 0x98, 0xa5, 0xb3, 0x90, 0xa5, 0xbc, 0xcc, 0xfc, 0x6c, 0x38,
+    0x06, 0x3c, 0x1d, 0xf0, 0x7a, 0x2b, 0x83, 0x13, 0x11, 0x4c, 0x6e, 0x43,
+    0x71, 0x38, 0xa9, 0xbd, 0x42, 0x8c, 0xd5, 0x87, 0x44, 0x6c, 0x59, 0x3e,
+    0x8d, 0x88, 0xfd, 0x2a, 0x25, 0x8a, 0x8f, 0x8e, 0xc6, 0x7f, 0x41, 0xfe,
+    0xb0, 0x60, 0x08, 0x9e, 0x68, 0x70, 0x02, 0x23, 0x57, 0xfe, 0xfc, 0x17,
+    0xaf, 0x27, 0xb8, 0x0e, 0x14, 0x49, 0x48, 0x07, 0x08, 0xac, 0x73, 0x29,
+    0xa8, 0xe5, 0xfe, 0x30, 0x90, 0x1c, 0xc0, 0x7d, 0x37, 0x32, 0xc7, 0x53,
+    0x22, 0x1c, 0xfa, 0xdd, 0xd8, 0x59, 0x38, 0xe8, 0x10, 0x32, 0xc9, 0xae,
+    0x6e, 0x20, 0x7b, 0x86, 0xef, 0x57, 0xda, 0x5c, 0xff, 0x36, 0x67, 0x6a,
+    0x22, 0xde, 0x97, 0xb2, 0x32, 0xbd, 0xee, 0xa2, 0xea, 0x67, 0xf4, 0x96,
+    0x57, 0x0e, 0xe4, 0x7b, 0xb3, 0xca, 0x81, 0x50, 0xeb, 0x9d, 0xf2, 0x2a,
+    0x64, 0x9c, 0x81, 0x30, 0x0c, 0x95, 0xf7, 0x21, 0x6a, 0xed, 0x19, 0xe0,
+    0x9d, 0x64, 0xbb, 0x0b, 0xc9, 0xa7, 0xab, 0x57, 0xa6, 0xd5, 0x75, 0x89,
+    0x9d, 0x9a, 0xf8, 0x3f, 0x84, 0xa6, 0xd6, 0x44, 0xc3, 0xa0, 0x35, 0x85,
+    0xea, 0x9c, 0xa4, 0x29, 0x20, 0x11, 0x3a, 0xac, 0x39, 0x19, 0x08, 0x04,
+    0x9c, 0xa5, 0x6d, 0xaa, 0x20, 0x79, 0x15, 0x16, 0x3a, 0x31, 0x41, 0x6e,
+    0x07, 0x8f, 0x6a, 0x21, 0x18, 0x24, 0x9b, 0x54, 0x58, 0xc5, 0x24, 0xe2,
+    0x17, 0xc9, 0x3a, 0xef, 0xf7, 0xb3, 0x88, 0x22, 0x3d, 0x72, 0x38, 0xbe,
+    0x60, 0xde, 0xf8, 0x0c, 0xd5, 0xb1, 0xf4, 0x30, 0xeb, 0x3e, 0xaf, 0x08,
+    0x19, 0xa8, 0x94, 0xaa, 0x9c, 0x4a, 0xb5, 0xad, 0x28, 0x04, 0xcb, 0x2e,
+    0x65, 0x19, 0x2d, 0xcc, 0x62, 0x28, 0xc6, 0x1b, 0xee, 0x6c, 0xd8, 0x2d,
+    0xb5, 0x88, 0xd4, 0x31, 0x92, 0x10, 0x88, 0x86, 0x2e, 0x39, 0x1b, 0xdc,
+    0x80, 0x00, 0x00, 0x01, 0x70, 0x28, 0x01, 0xaf, 0x2e, 0xe5, 0x3d, 0x63,
+    0x63, 0xd9, 0xe6, 0x96, 0xff, 0xc5, 0x17, 0x5e, 0xc5, 0x03, 0x76, 0x1d,
+    0xf1, 0x10, 0x38, 0x3d, 0x15, 0x4e, 0xc3, 0xd2, 0xa7, 0x31, 0xa7, 0xb8,
+    0x53, 0x00, 0xb1, 0x1b, 0x0b, 0xcf, 0x98, 0x21, 0x99, 0x3b, 0xcd, 0xe4,
+    0x25, 0x90, 0x5f, 0x7e, 0x39, 0x41, 0x5e, 0x1e, 0x88, 0x7c, 0x79, 0x5e,
+    0xe0, 0x03, 0x04, 0x1e, 0xe7, 0x1f, 0x11, 0x93, 0x34, 0x09, 0xfc, 0x52,
+    0x91, 0xaa, 0x07, 0x42, 0xd4, 0xed, 0xf0, 0x37, 0x85, 0x67, 0x8b, 0x82,
+    0x42, 0xd0, 0x29, 0xaf, 0x83, 0x18, 0x62, 0x21, 0x68, 0xcd, 0x5f, 0x06,
+    0x5c, 0xf8, 0xc9, 0x5c, 0xab, 0x15, 0xb4, 0x4c, 0x4a, 0x9b, 0x1a, 0xc9,
+    0x77, 0x78, 0xb2, 0xaf, 0x95, 0x15, 0xce, 0x16, 0x10, 0xfe, 0xd3, 0x4f,
+    0x39, 0x88, 0x80, 0x0a, 0xe3, 0x31, 0x08, 0xc1, 0xa5, 0x09, 0x14, 0xc4,
+    0xa8, 0xb6, 0x96, 0x62, 0x74, 0xbc, 0x18, 0xfc, 0xba, 0x9c, 0x4e, 0x72,
+    0x0d, 0x74, 0xf0, 0x61, 0x37, 0x3a, 0xd3, 0xee, 0x37, 0xf4, 0xb7, 0x4a,
+    0xf6, 0xe6, 0x50, 0x55, 0x21, 0x53, 0x94, 0xfb, 0x28, 0x58, 0x19, 0x3c,
+    0xfb, 0x8f, 0xc9, 0x5b, 0x11, 0xdd, 0x1e, 0x61, 0xa2, 0x24, 0x38, 0x0e,
+    0x1a, 0xa8, 0x71, 0x41, 0xdd, 0x7e, 0x39, 0xe5, 0xbc, 0x79, 0xab, 0x98,
+    0xc2, 0x13, 0x61, 0x53, 0x2e, 0x62, 0xc6, 0x43, 0x1c, 0x7b, 0x9e, 0x07,
+    0x88, 0xaa, 0xee, 0x27, 0xb1, 0x0e, 0xbc, 0xa4, 0x3d, 0x7f, 0x57, 0x3d,
+    0xed, 0xf8, 0x8f, 0xe6, 0xdb, 0xa3, 0x7b, 0x86, 0x91, 0xd1, 0xa7, 0xca,
+    0x9b, 0x71, 0x6a, 0x43, 0xd8, 0xed, 0xf7, 0xa3, 0x30, 0x35, 0x24, 0x64,
+    0x9b, 0x2a, 0x8f, 0x55, 0x83, 0xb0, 0xa2, 0x00, 0xd0, 0x6e, 0xba, 0x0a,
+    0x43, 0x37, 0x4e, 0x8b, 0x3c, 0xc5, 0xa4, 0x05, 0x4a, 0x2c, 0xb5, 0x87,
+    0x6b, 0x29, 0xd4, 0xf4, 0x8a, 0xca, 0x93, 0x52, 0xa0, 0xfd, 0x08, 0x40,
+    0x13, 0x5a, 0x72, 0x06, 0x95, 0x19, 0x6b, 0x9a, 0x26, 0xe2, 0x74, 0x4c,
+    0x03, 0x53, 0x33, 0x09, 0xf4, 0xda, 0xc6, 0xdc, 0x93, 0x8a, 0x63, 0xb2,
+    0x3b, 0x9b, 0xe4, 0xbf, 0x38, 0x60, 0x6e, 0x95, 0xed, 0x74, 0xcf, 0xab,
+    0xfa, 0xc6, 0x9d, 0xe0, 0xc1, 0xed, 0x54, 0xb3, 0x05, 0x2e, 0x15, 0x4f,
+    0xc1, 0x92, 0xea, 0x9b, 0x1b, 0xce, 0x65, 0x02, 0x04, 0xdf, 0x4e, 0x53,
+    0x4c, 0x63, 0x87, 0x8c, 0x8b, 0x5b, 0x98, 0xdb, 0xd4, 0xb5, 0xb8, 0x89,
+    0x66, 0x3d, 0x29, 0x2f, 0xdd, 0xbd, 0xf7, 0xe5, 0x65, 0x99, 0x48, 0xf6,
+    0x09, 0x2a, 0xb5, 0xd3, 0x50, 0x5f, 0x13, 0xf3, 0x50, 0x1d, 0xe3, 0xbf,
+    0x80, 0x00, 0x00, 0x00, 0x71, 0x28, 0x01, 0xaf, 0x2e, 0xee, 0x16, 0xfe,
+    0x43, 0xbc, 0x05, 0x19, 0x4c, 0x16, 0xb0, 0x17, 0xb5, 0xdc, 0x28, 0xb4,
+    0x03, 0x41, 0x65, 0x80, 0x2a, 0x8c, 0xb3, 0xff, 0x09, 0xf3, 0xa6, 0x65,
+    0x0c, 0x44, 0xc7, 0x2d, 0xcf, 0x41, 0xe3, 0x54, 0x80, 0xd4, 0xc7, 0xb5,
+    0x72, 0x4d, 0x45, 0xfc, 0x57, 0x89, 0xfb, 0x1c, 0xaf, 0x2b, 0xae, 0x17,
+    0x86, 0x6f, 0xef, 0xd2, 0x84, 0xca, 0x54, 0xed, 0x79, 0xed, 0xcb, 0x5a,
+    0x13, 0x5f, 0x7a, 0xd9, 0xfe, 0x2a, 0x68, 0x02, 0x9c, 0x13, 0x2c, 0x72,
+    0xe9, 0x13, 0x90, 0xc4, 0xa3, 0x56, 0x3d, 0x82, 0x50, 0x70, 0x51, 0x96,
+    0x7d, 0xc1, 0x12, 0x02, 0xa2, 0x06, 0x7c, 0xfd, 0x73, 0x21, 0x5b, 0xc5,
+    0xb4, 0x85, 0xc2, 0x37, 0x7d, 0x47, 0xbd, 0xa6, 0xa3, 0x80,
+};
+#define HEIF_GRID_CRC (0x79b8116bU)
+#define HEIF_THMB_CRC (0x92779c7cU)
+
+#endif
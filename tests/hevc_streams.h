@@ -0,0 +1,1823 @@
+/* 64x64 x265 streams of an I picture and three P or B ones, encoded with
+ * --crf 20 --keyint 4 --bframes 2 --repeat-headers --hash 3, so every
+ * picture carries its checksum in a decoded picture hash sei
+ */
+#ifndef _HEVC_STREAMS_H_
+#define _HEVC_STREAMS_H_
+
+#include <stdint.h>
+
+/* 8 bit 4:2:0 */
+static const uint8_t stream_p8[1677] = {
+    0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0x0c, 0x01, 0xff, 0xff, 0x01, 0x60,
+    0x00, 0x00, 0x03, 0x00, 0x90, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00,
+    0x1e, 0x95, 0x90, 0x09, 0x00, 0x00, 0x00, 0x01, 0x42, 0x01, 0x01, 0x01,
+    0x60, 0x00, 0x00, 0x03, 0x00, 0x90, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x1e, 0xa0, 0x20, 0x81, 0x05, 0x96, 0x56, 0x49, 0x24, 0xca, 0xe6,
+    0x80, 0x80, 0x00, 0x00, 0x03, 0x00, 0x80, 0x00, 0x00, 0x0c, 0x84, 0x00,
+    0x00, 0x00, 0x01, 0x44, 0x01, 0xc1, 0x72, 0xb4, 0x22, 0x40, 0x00, 0x00,
+    0x01, 0x28, 0x01, 0xaf, 0x78, 0x84, 0x31, 0x17, 0x65, 0xe8, 0x07, 0x80,
+    0xea, 0x70, 0xfa, 0xdb, 0x76, 0xb9, 0xa9, 0x23, 0x26, 0x1c, 0xae, 0xd9,
+    0x06, 0x39, 0xf8, 0x06, 0x10, 0x83, 0xe0, 0x06, 0x05, 0xa5, 0xff, 0xac,
+    0x7c, 0x12, 0x02, 0xc3, 0x7e, 0xd5, 0x3c, 0x2f, 0xe5, 0xe7, 0x28, 0x5c,
+    0x93, 0x4c, 0x52, 0xcf, 0x27, 0x29, 0x6d, 0x9b, 0x63, 0x56, 0x7f, 0xc8,
+    0xe3, 0xcb, 0x18, 0xb4, 0x55, 0x2d, 0xa4, 0x18, 0xbb, 0x90, 0x76, 0x78,
+    0xcb, 0x97, 0x9f, 0x33, 0x07, 0x18, 0x23, 0x1e, 0xd9, 0x7d, 0x3a, 0x34,
+    0xf7, 0x47, 0x37, 0xf9, 0x26, 0x6f, 0x33, 0x1d, 0x30, 0xac, 0x20, 0x02,
+    0x86, 0x3d, 0x16, 0x52, 0x30, 0x7d, 0xb8, 0x4b, 0xd7, 0x86, 0x73, 0xd9,
+    0x4c, 0x8b, 0x6b, 0x29, 0x4a, 0x0f, 0x2d, 0xbe, 0x99, 0xdf, 0xd8, 0x38,
+    0x9c, 0xfb, 0x07, 0x90, 0x52, 0x91, 0x85, 0x42, 0x20, 0x77, 0xc3, 0xf7,
+    0x84, 0x91, 0x6b, 0x65, 0x30, 0x63, 0x4f, 0x63, 0xa9, 0x1f, 0xf3, 0xae,
+    0x28, 0x3c, 0x1e, 0x6a, 0x1a, 0xcb, 0xc8, 0x6c, 0xa0, 0x40, 0x72, 0x6a,
+    0x58, 0x5f, 0x22, 0xc7, 0x35, 0x99, 0xec, 0x50, 0x0d, 0x3c, 0x89, 0x68,
+    0xc0, 0x4c, 0xd8, 0xb1, 0x07, 0x0d, 0x34, 0x50, 0x20, 0xd4, 0x6a, 0xcf,
+    0x55, 0x40, 0x7e, 0x74, 0xb4, 0x9f, 0x41, 0x84, 0xc2, 0x82, 0x5c, 0x2f,
+    0xfc, 0x45, 0xe3, 0xa1, 0x43, 0x30, 0xef, 0xd7, 0x96, 0xa9, 0xa8, 0x82,
+    0x71, 0x97, 0x81, 0x37, 0x53, 0xc0, 0xe7, 0x1d, 0xe0, 0xa0, 0xd9, 0x54,
+    0x01, 0x39, 0x70, 0xfa, 0x72, 0xe6, 0x66, 0xbc, 0x0f, 0x68, 0x95, 0x54,
+    0x09, 0x66, 0xcc, 0x2e, 0xc5, 0xfc, 0x6f, 0xde, 0x53, 0xc0, 0xf9, 0x09,
+    0xe3, 0x4e, 0xaa, 0x4f, 0xd3, 0xbc, 0x0b, 0x75, 0xaf, 0x59, 0x6b, 0x54,
+    0xe6, 0xad, 0x26, 0xa3, 0x94, 0x91, 0x8a, 0xff, 0x56, 0x95, 0xd8, 0xf6,
+    0xf5, 0xe8, 0x1d, 0x88, 0xd7, 0x39, 0x31, 0xb9, 0xa9, 0xa5, 0x8a, 0x70,
+    0x14, 0xbf, 0x08, 0xc2, 0x1c, 0x70, 0xa7, 0xe2, 0x6d, 0x04, 0x1b, 0xe7,
+    0x1d, 0x03, 0x1a, 0x19, 0xf4, 0x73, 0x09, 0x38, 0x1c, 0x4e, 0xd6, 0xbd,
+    0x63, 0x7c, 0xff, 0x09, 0xfe, 0xef, 0x4a, 0x72, 0x01, 0x05, 0x41, 0xa6,
+    0x7e, 0x23, 0xcb, 0x7b, 0x46, 0xe1, 0x63, 0x36, 0x64, 0xa0, 0x89, 0x52,
+    0x7d, 0x4b, 0x7e, 0x5b, 0xfe, 0x8b, 0x6f, 0x16, 0x58, 0xae, 0xbc, 0x8e,
+    0xb0, 0xda, 0x8c, 0xfe, 0x78, 0x00, 0x60, 0x93, 0x7b, 0x9a, 0x32, 0xff,
+    0x10, 0xaa, 0x43, 0x79, 0x71, 0x56, 0x13, 0xe5, 0xdf, 0x29, 0xed, 0xc2,
+    0x89, 0x7a, 0x08, 0xdc, 0xd1, 0x3c, 0x6b, 0x2f, 0x6c, 0x9d, 0x65, 0x69,
+    0x52, 0x38, 0x56, 0xb5, 0xf2, 0x7b, 0x56, 0x7e, 0x19, 0x94, 0xf1, 0x98,
+    0x32, 0x60, 0x04, 0xcc, 0xb1, 0xb7, 0x78, 0x72, 0x81, 0x98, 0x91, 0x22,
+    0xd2, 0xa7, 0xe8, 0xaf, 0x72, 0x0e, 0xa7, 0xb1, 0x0d, 0x55, 0xea, 0xb5,
+    0xd4, 0x4a, 0x79, 0x51, 0x71, 0xe9, 0xdc, 0xc7, 0x34, 0x7d, 0xf1, 0x86,
+    0x66, 0x84, 0x45, 0x01, 0x5e, 0x1d, 0xdf, 0xc5, 0xed, 0xbe, 0x2a, 0x83,
+    0x61, 0xf6, 0x27, 0x5f, 0x97, 0xea, 0xe4, 0x70, 0x1b, 0x3a, 0xc2, 0xbd,
+    0xab, 0xac, 0x14, 0x55, 0xd6, 0xe0, 0xe7, 0x4c, 0xa1, 0xee, 0x53, 0xcb,
+    0xd3, 0x4b, 0xc5, 0xc1, 0xe3, 0xbb, 0x9e, 0xa8, 0xe8, 0x98, 0x87, 0xce,
+    0x9a, 0x04, 0x7b, 0x7a, 0xed, 0x90, 0xe8, 0x52, 0xcf, 0xc7, 0xbc, 0x53,
+    0x0d, 0xc4, 0x90, 0x11, 0x54, 0x8b, 0x1c, 0x7d, 0xdd, 0x13, 0xfb, 0x34,
+    0xe6, 0xf5, 0xef, 0xa3, 0x96, 0x78, 0x3a, 0x54, 0x78, 0x06, 0xe6, 0x04,
+    0x6a, 0xf6, 0xd3, 0x44, 0xf1, 0xb3, 0x20, 0xca, 0x59, 0xf5, 0x0a, 0x5e,
+    0x0f, 0x99, 0xb5, 0xca, 0x09, 0xc3, 0x54, 0x79, 0x9b, 0x20, 0x0f, 0xd5,
+    0xff, 0x4e, 0x16, 0x57, 0x03, 0xab, 0x46, 0xc8, 0xf3, 0x22, 0x7a, 0x35,
+    0x86, 0xd6, 0x2a, 0x46, 0xa5, 0x6c, 0xe4, 0x6f, 0x89, 0x9f, 0xf9, 0xb8,
+    0xd6, 0x50, 0xac, 0x39, 0x63, 0xb9, 0xaf, 0x1a, 0x75, 0xdc, 0xf8, 0x26,
+    0x37, 0xd7, 0x10, 0x90, 0x61, 0x72, 0x14, 0xa4, 0xfc, 0xfd, 0x04, 0x8f,
+    0xf9, 0x64, 0x74, 0x95, 0xaf, 0xaf, 0x46, 0xf0, 0xab, 0xda, 0xb0, 0x30,
+    0x76, 0x9f, 0x3a, 0x6f, 0x53, 0x32, 0xc0, 0x7b, 0x9c, 0xee, 0x08, 0x74,
+    0x95, 0x90, 0xce, 0xb5, 0xf6, 0xe5, 0xf3, 0x1e, 0xab, 0x82, 0xb1, 0x73,
+    0xeb, 0x33, 0x64, 0xee, 0x93, 0xd9, 0x74, 0xec, 0xc2, 0xe4, 0x17, 0xa1,
+    0x15, 0xfe, 0x93, 0x20, 0x39, 0x6d, 0x6a, 0xb9, 0x53, 0xd0, 0x54, 0x78,
+    0x19, 0x47, 0xe9, 0x97, 0x3a, 0x23, 0x94, 0x90, 0xb4, 0x49, 0x61, 0x69,
+    0x6e, 0x76, 0xeb, 0x59, 0x18, 0x6e, 0xd6, 0x75, 0xff, 0x70, 0xf3, 0xa1,
+    0x92, 0x53, 0xd0, 0x01, 0xfb, 0xa8, 0x53, 0x6f, 0x20, 0xbd, 0xc2, 0xbb,
+    0xd2, 0xb2, 0x7e, 0x33, 0x62, 0xb4, 0x6d, 0x8f, 0x8b, 0x34, 0x82, 0x24,
+    0x8f, 0xc7, 0xe0, 0xfc, 0x9a, 0xd1, 0x3a, 0x7b, 0x2a, 0x16, 0x79, 0xeb,
+    0x3c, 0x8c, 0x29, 0x30, 0x82, 0xfd, 0xe7, 0x64, 0xf1, 0x1c, 0xe6, 0x54,
+    0xad, 0x65, 0x26, 0xee, 0x87, 0x7c, 0x81, 0xeb, 0xe2, 0x09, 0xf6, 0x66,
+    0x51, 0xdc, 0x45, 0x4a, 0x09, 0x94, 0x7b, 0x7e, 0x8e, 0xaa, 0x64, 0x95,
+    0xb6, 0x48, 0x04, 0x8b, 0xda, 0x0d, 0x0b, 0x20, 0xbf, 0xe3, 0x14, 0x40,
+    0x86, 0x36, 0x47, 0x44, 0x4d, 0xf1, 0x6c, 0xd2, 0x53, 0xf7, 0x13, 0x12,
+    0xad, 0xcf, 0x41, 0x97, 0xa8, 0x53, 0xf8, 0x89, 0x28, 0x25, 0x49, 0x10,
+    0x7d, 0x5c, 0xcf, 0x9f, 0x45, 0x94, 0x6c, 0x74, 0xa7, 0x7c, 0xa2, 0x87,
+    0x53, 0x9b, 0xca, 0x48, 0x00, 0x00, 0x01, 0x50, 0x01, 0x84, 0x0d, 0x02,
+    0x00, 0x06, 0xbd, 0x3a, 0x00, 0x02, 0x36, 0x10, 0x00, 0x02, 0x2c, 0x59,
+    0x80, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0xd0, 0x09, 0x7e, 0x8c, 0xe6,
+    0x96, 0x56, 0xf0, 0x81, 0x57, 0x9f, 0x30, 0x02, 0x06, 0x0f, 0x50, 0x2d,
+    0xcd, 0x3f, 0x37, 0xa8, 0x31, 0x9d, 0xb1, 0x78, 0xf7, 0x7d, 0xe7, 0x09,
+    0x1f, 0xc5, 0x2d, 0x9e, 0x26, 0x0b, 0xf9, 0xbf, 0xd0, 0x82, 0x11, 0x48,
+    0x41, 0x79, 0xd1, 0x2d, 0xff, 0x6d, 0xcd, 0x7c, 0x25, 0x5c, 0x2b, 0x92,
+    0xc4, 0x6b, 0xdd, 0x62, 0x9b, 0x9a, 0xee, 0x04, 0xdf, 0x3e, 0x57, 0x07,
+    0x3d, 0xbc, 0xbc, 0x30, 0x62, 0x6d, 0xf9, 0x51, 0xfe, 0xed, 0x44, 0xa7,
+    0xf9, 0x4b, 0xf4, 0x90, 0x2f, 0xeb, 0x19, 0x61, 0x3f, 0xd8, 0x04, 0x3b,
+    0xef, 0xee, 0xd0, 0x75, 0x3e, 0x69, 0xe4, 0xd9, 0x1d, 0xe7, 0x70, 0x5d,
+    0x07, 0xbf, 0x71, 0x4b, 0x94, 0xff, 0xc5, 0x30, 0xe1, 0x70, 0xa3, 0xbf,
+    0xc1, 0xc0, 0xb1, 0x67, 0xe6, 0xe0, 0xcc, 0x7f, 0x64, 0xf4, 0xac, 0x22,
+    0x70, 0x45, 0x2c, 0x67, 0xd1, 0xbe, 0xd7, 0xea, 0x75, 0x57, 0xda, 0x40,
+    0x19, 0x78, 0x1c, 0x52, 0x3f, 0x24, 0x76, 0x7a, 0x70, 0x5f, 0x95, 0x95,
+    0x57, 0x62, 0x02, 0x10, 0x15, 0x38, 0xcf, 0xeb, 0x03, 0xea, 0xcf, 0x01,
+    0x0c, 0xdf, 0xdf, 0x28, 0x4e, 0x80, 0x1b, 0x6a, 0x9b, 0x9d, 0xae, 0x65,
+    0x0d, 0x54, 0xec, 0x73, 0xc0, 0x00, 0x00, 0x01, 0x50, 0x01, 0x84, 0x0d,
+    0x02, 0x00, 0x06, 0xec, 0x7f, 0x00, 0x02, 0x27, 0x5c, 0x00, 0x02, 0x29,
+    0x79, 0x80, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0xd0, 0x11, 0xff, 0xd6,
+    0x32, 0xa6, 0x96, 0x56, 0xd0, 0x55, 0xe2, 0x87, 0x2f, 0x65, 0xe9, 0x4a,
+    0x12, 0xa2, 0xd9, 0xf1, 0xa3, 0x42, 0x98, 0x4e, 0x0c, 0x36, 0xdb, 0x06,
+    0x86, 0x50, 0x71, 0xd5, 0x8f, 0x11, 0x7f, 0xdc, 0xe1, 0x1b, 0xda, 0x88,
+    0xe6, 0xae, 0x10, 0xea, 0x07, 0x81, 0xff, 0x36, 0xb5, 0x7b, 0xb6, 0xd4,
+    0x31, 0xe5, 0x93, 0xac, 0xd8, 0x3f, 0xe7, 0x49, 0x7f, 0xff, 0x1f, 0x61,
+    0x92, 0xaa, 0xb7, 0x8d, 0xda, 0x20, 0x61, 0x88, 0x30, 0x1c, 0x06, 0x13,
+    0x5e, 0xb7, 0xd6, 0x34, 0x79, 0xd3, 0x63, 0x05, 0xb0, 0x2c, 0x61, 0x9a,
+    0xbf, 0x7f, 0xfd, 0x4a, 0x2c, 0xc7, 0x03, 0xeb, 0x44, 0x7f, 0x02, 0xfb,
+    0xc9, 0x60, 0x26, 0xfb, 0x26, 0x0f, 0x85, 0xc3, 0x2f, 0x7b, 0xee, 0xec,
+    0x04, 0x0c, 0x55, 0x2a, 0x44, 0xb2, 0x66, 0xd3, 0x36, 0x5a, 0x05, 0x1c,
+    0xd8, 0x72, 0xbd, 0x58, 0x99, 0x7e, 0xd6, 0x19, 0xb5, 0xbb, 0x4c, 0xf4,
+    0x02, 0xde, 0x3d, 0x36, 0x24, 0x43, 0x44, 0x26, 0xe9, 0x92, 0x0d, 0x8e,
+    0x80, 0x4e, 0x4a, 0xf5, 0x8f, 0x02, 0x1c, 0xf3, 0x54, 0x02, 0xa5, 0xab,
+    0xb9, 0x3f, 0x8f, 0x69, 0xe5, 0xdf, 0xc1, 0x8c, 0x0f, 0x34, 0xba, 0x7e,
+    0x3b, 0x9c, 0xbc, 0x83, 0x5c, 0x28, 0x0f, 0x7d, 0x23, 0x1c, 0xc5, 0x02,
+    0xcb, 0xc5, 0xff, 0xfc, 0xca, 0x2f, 0xed, 0x46, 0xf4, 0xde, 0x40, 0x17,
+    0x40, 0xff, 0x7a, 0xaa, 0x28, 0x7b, 0xa1, 0x7c, 0x51, 0x21, 0xef, 0x71,
+    0xd1, 0x46, 0x15, 0x30, 0x02, 0x6d, 0xad, 0x60, 0x20, 0x7f, 0x9f, 0x9a,
+    0xfd, 0x8a, 0xeb, 0x88, 0xec, 0x72, 0x2d, 0xd3, 0xd3, 0xb2, 0x54, 0x41,
+    0x3e, 0x79, 0xdb, 0x61, 0x85, 0x94, 0xed, 0x0f, 0x8e, 0x6c, 0x36, 0x4b,
+    0x0e, 0x62, 0x92, 0x86, 0x45, 0xa8, 0xe1, 0x2c, 0x51, 0x7d, 0xfe, 0xbb,
+    0x8e, 0x05, 0x13, 0x7f, 0x6b, 0x93, 0xf4, 0xf1, 0x28, 0xcc, 0x78, 0x99,
+    0xf5, 0xf0, 0x90, 0x81, 0x84, 0xfa, 0xfc, 0xf8, 0x01, 0x9d, 0x00, 0x0a,
+    0x29, 0x8c, 0xf0, 0xc0, 0xa9, 0xdb, 0x1e, 0x1f, 0xb2, 0x71, 0xef, 0x00,
+    0x00, 0x01, 0x50, 0x01, 0x84, 0x0d, 0x02, 0x00, 0x07, 0x00, 0x30, 0x00,
+    0x02, 0x19, 0x86, 0x00, 0x02, 0x21, 0x38, 0x80, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x01, 0xd0, 0x18, 0x9f, 0xfd, 0xe3, 0x24, 0x9a, 0x59, 0x5b, 0x40,
+    0x81, 0x57, 0x6f, 0x9c, 0x00, 0xd8, 0x5e, 0xde, 0x55, 0x31, 0x66, 0xba,
+    0xa8, 0x8b, 0x06, 0xea, 0xd4, 0xfe, 0x17, 0xab, 0x60, 0x9d, 0x1d, 0x5a,
+    0x3f, 0x1d, 0xa7, 0x14, 0x9a, 0xb0, 0x16, 0x49, 0x94, 0x49, 0x9d, 0xa3,
+    0x83, 0xf4, 0x9b, 0x79, 0xeb, 0xc3, 0xcd, 0xf9, 0x81, 0xc2, 0xc3, 0xd4,
+    0xf0, 0x97, 0xd2, 0x39, 0x6b, 0xaa, 0xdc, 0x5b, 0x7f, 0xf2, 0xc0, 0x87,
+    0xe4, 0x2d, 0xbd, 0x40, 0x10, 0xed, 0xa5, 0x36, 0x1f, 0x5f, 0xcf, 0x7a,
+    0x00, 0x76, 0xa5, 0x90, 0x79, 0xf3, 0x03, 0xce, 0x21, 0xf2, 0xa8, 0x70,
+    0x9b, 0x8f, 0x07, 0x16, 0xc0, 0x2a, 0xbf, 0xed, 0xfd, 0xed, 0xc3, 0x27,
+    0xb6, 0xf3, 0x95, 0xe2, 0xc1, 0xed, 0xcb, 0x46, 0xb7, 0x10, 0x75, 0xe2,
+    0x85, 0x76, 0xa3, 0xa4, 0xc6, 0x34, 0xe2, 0x05, 0xfa, 0x9b, 0xdd, 0x1a,
+    0x70, 0x04, 0x0f, 0x03, 0x3c, 0x4c, 0x12, 0x99, 0xce, 0x6d, 0x32, 0xdc,
+    0x8a, 0xda, 0xc5, 0x5e, 0x0a, 0x70, 0xf5, 0x52, 0xa1, 0x88, 0x29, 0xd4,
+    0x8e, 0x74, 0x41, 0x63, 0x99, 0x24, 0xe8, 0x79, 0x96, 0x10, 0x26, 0xd9,
+    0x5b, 0xbb, 0x77, 0x61, 0x6d, 0xff, 0xa1, 0x01, 0xc2, 0x1f, 0xe0, 0x5f,
+    0xa1, 0x52, 0x38, 0x7f, 0xa5, 0xc0, 0x2e, 0xac, 0xb2, 0xda, 0xf1, 0x3f,
+    0xd0, 0x3b, 0xbc, 0x18, 0x84, 0xaa, 0x24, 0x1d, 0x31, 0xe3, 0xe4, 0xb1,
+    0xb9, 0xab, 0x4a, 0xf4, 0x93, 0xba, 0x3e, 0x42, 0x7b, 0x7a, 0x79, 0x94,
+    0x39, 0xcd, 0xd4, 0xe4, 0xb9, 0xf8, 0x4f, 0xb5, 0xd0, 0xbf, 0x6c, 0x0d,
+    0x50, 0x7d, 0xf3, 0x14, 0x83, 0xe7, 0xac, 0xf5, 0x5a, 0x22, 0x8b, 0x76,
+    0x00, 0x00, 0x01, 0x50, 0x01, 0x84, 0x0d, 0x02, 0x00, 0x07, 0x23, 0xb6,
+    0x00, 0x02, 0x0f, 0x13, 0x00, 0x02, 0x18, 0x46, 0x80,
+};
+
+/* 10 bit 4:2:0 */
+static const uint8_t stream_p10[1528] = {
+    0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0x0c, 0x01, 0xff, 0xff, 0x02, 0x20,
+    0x00, 0x00, 0x03, 0x00, 0x90, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00,
+    0x1e, 0x95, 0x90, 0x09, 0x00, 0x00, 0x00, 0x01, 0x42, 0x01, 0x01, 0x02,
+    0x20, 0x00, 0x00, 0x03, 0x00, 0x90, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x1e, 0xa0, 0x20, 0x81, 0x04, 0xd9, 0x65, 0x64, 0x92, 0x4c, 0xae,
+    0x68, 0x08, 0x00, 0x00, 0x03, 0x00, 0x08, 0x00, 0x00, 0x03, 0x00, 0xc8,
+    0x40, 0x00, 0x00, 0x00, 0x01, 0x44, 0x01, 0xc1, 0x72, 0xb4, 0x22, 0x40,
+    0x00, 0x00, 0x01, 0x28, 0x01, 0xaf, 0x78, 0xa2, 0x50, 0x69, 0x54, 0xaf,
+    0x40, 0x3c, 0x04, 0x3b, 0x96, 0x86, 0xdb, 0xb5, 0xcd, 0x49, 0x19, 0x30,
+    0xe5, 0x76, 0xc8, 0x31, 0xcf, 0xc0, 0x30, 0x83, 0x50, 0x25, 0xa6, 0xf4,
+    0x4e, 0x95, 0xb5, 0xf1, 0xc4, 0x0b, 0x0d, 0xfb, 0x54, 0xed, 0x16, 0xd5,
+    0x64, 0x86, 0xcd, 0x0f, 0x13, 0x99, 0xe1, 0xa0, 0x4b, 0xc5, 0x83, 0x64,
+    0x6c, 0xa6, 0x11, 0x3e, 0xcd, 0x6b, 0x6c, 0x35, 0xc1, 0xac, 0xb8, 0x77,
+    0xbd, 0x99, 0xe6, 0x2b, 0xcd, 0x85, 0x60, 0x6b, 0x8e, 0x31, 0x15, 0x06,
+    0xd0, 0x1c, 0x53, 0xd8, 0x1d, 0x2a, 0x82, 0xa6, 0x67, 0x69, 0x45, 0x6b,
+    0x47, 0x79, 0x5f, 0x67, 0x6c, 0xe8, 0x5a, 0x83, 0x1f, 0xa4, 0xae, 0xdf,
+    0xc6, 0x25, 0xa8, 0xad, 0xc5, 0xb6, 0x63, 0x85, 0x3f, 0x74, 0xa1, 0xa5,
+    0xa4, 0xb4, 0x5c, 0x03, 0xe2, 0xd3, 0x4c, 0x15, 0xfc, 0xd0, 0xc6, 0xdd,
+    0x26, 0x0c, 0x9f, 0xd5, 0x8c, 0x00, 0x8e, 0xf3, 0x08, 0xbd, 0x51, 0x0c,
+    0x3b, 0x3b, 0xf9, 0xf8, 0xb7, 0xa5, 0x9d, 0x5e, 0xc1, 0x8e, 0xfa, 0x8b,
+    0x8b, 0x77, 0x27, 0xc0, 0x19, 0x5d, 0x93, 0x48, 0x46, 0x56, 0x99, 0x7b,
+    0x75, 0xe6, 0x80, 0xf2, 0x23, 0xb8, 0x54, 0x21, 0x32, 0x77, 0x81, 0x3e,
+    0x40, 0x75, 0x78, 0xff, 0x6b, 0x48, 0x45, 0x62, 0xcf, 0xcc, 0xde, 0xa8,
+    0xcd, 0x97, 0x95, 0x56, 0x36, 0xa4, 0xca, 0xa6, 0xad, 0x17, 0x87, 0xf9,
+    0xb5, 0x61, 0xb2, 0x35, 0x93, 0xb6, 0x1c, 0x70, 0x3e, 0x71, 0x86, 0xef,
+    0x69, 0x09, 0x2c, 0x98, 0x1f, 0xd8, 0x95, 0x76, 0x79, 0xd5, 0x4f, 0xa8,
+    0xb8, 0x14, 0x52, 0xbe, 0xa3, 0x0f, 0x2c, 0xec, 0xaa, 0x38, 0xea, 0x9a,
+    0x6b, 0x27, 0x61, 0x7c, 0x08, 0xe2, 0xba, 0xdd, 0x2a, 0x8b, 0xf9, 0x79,
+    0x2e, 0x32, 0x2f, 0xba, 0x27, 0xca, 0xdc, 0x7d, 0x4a, 0x26, 0x72, 0x56,
+    0xad, 0xf8, 0xcf, 0xb9, 0x69, 0xbc, 0xed, 0xd5, 0x80, 0x2f, 0x0e, 0x70,
+    0x38, 0x11, 0x29, 0xd5, 0xdf, 0xe2, 0x8c, 0x89, 0x78, 0xcf, 0xfc, 0x81,
+    0xa4, 0x58, 0x38, 0x79, 0xbf, 0x89, 0x25, 0xfe, 0xdf, 0x91, 0x3a, 0xee,
+    0x6a, 0x65, 0xbe, 0x64, 0x01, 0x45, 0xbd, 0x9a, 0xf9, 0x5b, 0xa3, 0x81,
+    0xda, 0xa2, 0x43, 0xba, 0x97, 0xfa, 0xa2, 0x4e, 0xfa, 0xeb, 0xd1, 0x29,
+    0xd0, 0xf7, 0x17, 0x7a, 0x30, 0x71, 0x69, 0x9f, 0xf7, 0x81, 0x09, 0x3b,
+    0xed, 0x6d, 0xa2, 0x39, 0x8f, 0xaf, 0xe0, 0x8f, 0xdd, 0xd1, 0x6e, 0x80,
+    0x8a, 0x61, 0x07, 0xda, 0x17, 0x25, 0x47, 0xe2, 0xb4, 0xb3, 0x03, 0x5d,
+    0xaa, 0xb1, 0xe0, 0xea, 0xdf, 0xc6, 0xc8, 0x38, 0x02, 0x45, 0x7e, 0x04,
+    0x1b, 0xea, 0x21, 0x82, 0x3c, 0x9e, 0x69, 0xfc, 0xfa, 0x70, 0x31, 0xa1,
+    0xa1, 0x5f, 0x23, 0xc6, 0x77, 0x07, 0x0d, 0x3e, 0x8d, 0x46, 0x0d, 0x86,
+    0x64, 0x8a, 0x65, 0x73, 0xff, 0x5a, 0xc2, 0x6e, 0xd4, 0xde, 0x32, 0x24,
+    0x50, 0xbe, 0x8d, 0xe6, 0xf4, 0xf5, 0xe1, 0xfb, 0x02, 0x5e, 0x51, 0xa4,
+    0xb2, 0xbc, 0x6d, 0xba, 0xf9, 0x3f, 0x7e, 0x83, 0x98, 0xac, 0xa9, 0x59,
+    0x9a, 0x25, 0xe2, 0xbb, 0x46, 0xbf, 0x59, 0xca, 0xdc, 0xa6, 0xf4, 0xa4,
+    0x45, 0xa3, 0x46, 0x10, 0x56, 0x63, 0x4c, 0xe5, 0x3d, 0xa6, 0xba, 0x67,
+    0x42, 0x3c, 0xd4, 0x00, 0x1b, 0x09, 0xdd, 0x6e, 0x69, 0x0a, 0x02, 0xff,
+    0xd4, 0xc4, 0x5a, 0x86, 0x27, 0xf3, 0xe4, 0x66, 0x36, 0x2e, 0x70, 0x55,
+    0x88, 0x9d, 0xbd, 0xd9, 0xae, 0xa3, 0x2e, 0x30, 0x92, 0x5d, 0x37, 0x27,
+    0x34, 0x75, 0xcc, 0x28, 0x2f, 0x86, 0x74, 0xb3, 0x6c, 0x4a, 0x93, 0x20,
+    0xeb, 0xce, 0x7b, 0x61, 0x64, 0xeb, 0x9d, 0x4f, 0xd5, 0xa4, 0xb8, 0xb1,
+    0xd1, 0x6f, 0xf7, 0xeb, 0xf8, 0xfa, 0xb6, 0xba, 0x18, 0x41, 0xc5, 0xf3,
+    0xd6, 0x8b, 0xee, 0xc8, 0x1f, 0x44, 0x62, 0xcd, 0xf5, 0x3e, 0xa7, 0x93,
+    0x95, 0xd0, 0x68, 0xe2, 0x40, 0x4f, 0x1a, 0x12, 0xe8, 0x5b, 0x88, 0x6f,
+    0x46, 0xc4, 0x94, 0x14, 0xd3, 0x15, 0x1f, 0x08, 0xbb, 0xfe, 0x23, 0x82,
+    0x64, 0xb1, 0x1e, 0xa0, 0x47, 0x4e, 0x24, 0x23, 0x51, 0x7d, 0x66, 0x90,
+    0x9d, 0xf1, 0x71, 0x8d, 0xbf, 0xd3, 0x71, 0x1c, 0xe1, 0x3c, 0xaa, 0xc0,
+    0xbb, 0xd0, 0xfe, 0xcc, 0x82, 0x9e, 0xa3, 0x28, 0x24, 0xcb, 0xb3, 0x58,
+    0x13, 0xb9, 0xea, 0x27, 0xb5, 0x87, 0xc3, 0x86, 0x79, 0x9e, 0x16, 0xfc,
+    0xdb, 0xc1, 0xbe, 0x86, 0x7c, 0xa9, 0xcc, 0x61, 0xa0, 0x88, 0x08, 0xd2,
+    0x49, 0xa3, 0x52, 0x48, 0xa9, 0x12, 0x4d, 0x7a, 0x8e, 0x9a, 0x07, 0x76,
+    0x9c, 0xf8, 0xb1, 0x7d, 0xd2, 0xdf, 0xef, 0x9c, 0x80, 0xfe, 0x84, 0xda,
+    0xaa, 0x9e, 0xfe, 0xdd, 0x87, 0x24, 0xcd, 0xc4, 0xec, 0x59, 0x4b, 0x7c,
+    0xa3, 0x7e, 0x71, 0xc1, 0x2c, 0x2d, 0xe2, 0xe1, 0xe3, 0x8e, 0xa0, 0x63,
+    0x27, 0xc5, 0x42, 0x64, 0x04, 0xf0, 0x77, 0xa0, 0x52, 0x8e, 0x9f, 0xef,
+    0xef, 0x08, 0x66, 0xca, 0xc9, 0x10, 0x6b, 0x29, 0xe1, 0x72, 0x0e, 0x57,
+    0xd5, 0xad, 0xbc, 0xa2, 0x40, 0x0a, 0xd2, 0x15, 0x61, 0x2d, 0xbb, 0x76,
+    0x20, 0xf9, 0x67, 0x26, 0x71, 0x76, 0xfb, 0x14, 0x78, 0x4b, 0x56, 0xb9,
+    0x4a, 0x89, 0x30, 0x49, 0x7b, 0x98, 0x90, 0xe3, 0x83, 0x5f, 0x92, 0x3c,
+    0x4e, 0xd4, 0xdd, 0x9a, 0x62, 0xf3, 0x0a, 0x52, 0x8e, 0x7d, 0x5d, 0x77,
+    0x7e, 0x3d, 0xc7, 0xc7, 0xb4, 0x3f, 0xf5, 0x7a, 0x61, 0x0b, 0xf3, 0x60,
+    0xa1, 0xb2, 0xd6, 0x7a, 0xa9, 0xa3, 0x1d, 0xf3, 0x51, 0x97, 0x78, 0x76,
+    0x25, 0x47, 0x9f, 0x01, 0x5b, 0x33, 0xbc, 0x1d, 0x03, 0x3f, 0x89, 0x29,
+    0x54, 0xc4, 0x7a, 0x20, 0x82, 0x8c, 0xae, 0x8c, 0x59, 0x61, 0xc4, 0xdf,
+    0x05, 0x19, 0xa5, 0x68, 0x00, 0x00, 0x01, 0x50, 0x01, 0x84, 0x0d, 0x02,
+    0x00, 0x0a, 0x07, 0x6d, 0x00, 0x02, 0x5f, 0xc2, 0x00, 0x02, 0x53, 0x92,
+    0x80, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0xd0, 0x09, 0x7e, 0x8c, 0xe6,
+    0x65, 0x65, 0x6f, 0x9c, 0x99, 0x72, 0xf1, 0xd2, 0x90, 0x12, 0xb0, 0xcb,
+    0x22, 0x6a, 0xd4, 0x43, 0x6b, 0x88, 0x18, 0xc3, 0xdd, 0x8c, 0xea, 0x8e,
+    0x94, 0xad, 0x15, 0x41, 0xf9, 0x83, 0xed, 0xda, 0x3e, 0x49, 0xe2, 0xc5,
+    0xd0, 0x3b, 0x5c, 0xa9, 0x7a, 0xa7, 0x55, 0x6f, 0x3f, 0xce, 0x31, 0x6f,
+    0xa7, 0xee, 0xfc, 0xff, 0xf8, 0xb3, 0xbb, 0xd9, 0xf8, 0x5b, 0x49, 0x78,
+    0x71, 0xe0, 0xa0, 0x0d, 0xbc, 0xad, 0x1f, 0x77, 0xc2, 0x95, 0x1d, 0xdd,
+    0xaa, 0x49, 0xa4, 0xc6, 0x28, 0x10, 0xe7, 0x10, 0x7e, 0x93, 0x11, 0xc4,
+    0x33, 0x64, 0xbc, 0xd5, 0xf7, 0x13, 0x1b, 0xe4, 0xc0, 0xe0, 0xbc, 0x8e,
+    0xe4, 0x23, 0x93, 0xd8, 0x58, 0x0c, 0x76, 0x1f, 0x6b, 0xed, 0xb7, 0x37,
+    0x5f, 0x40, 0x37, 0xdb, 0x88, 0x8c, 0xcb, 0x20, 0x39, 0x3e, 0xfa, 0x5a,
+    0xde, 0xe1, 0xdd, 0x22, 0x76, 0x4c, 0x20, 0x40, 0x1d, 0x31, 0x67, 0xb9,
+    0xf2, 0xa2, 0x13, 0xc4, 0xc0, 0x07, 0x28, 0x59, 0x94, 0xa0, 0x94, 0xe9,
+    0x21, 0x79, 0xa5, 0x0f, 0x74, 0x47, 0x46, 0x19, 0xcb, 0xdd, 0x59, 0x82,
+    0xcf, 0x21, 0x35, 0xec, 0x9a, 0x16, 0xfd, 0xb1, 0x07, 0x19, 0xae, 0xe9,
+    0x5f, 0xdd, 0x39, 0xe0, 0x13, 0x60, 0x00, 0x00, 0x01, 0x50, 0x01, 0x84,
+    0x0d, 0x02, 0x00, 0x0a, 0x0e, 0xaa, 0x00, 0x02, 0x65, 0xef, 0x00, 0x02,
+    0x4f, 0x15, 0x80, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0xd0, 0x19, 0xd7,
+    0xf5, 0x8c, 0xa8, 0xc2, 0x89, 0x28, 0x96, 0xd0, 0x81, 0x58, 0xc7, 0xea,
+    0x0b, 0x10, 0xd4, 0x9d, 0x3c, 0xe2, 0x29, 0x76, 0xca, 0x33, 0xfe, 0x09,
+    0xdb, 0x73, 0x1b, 0x92, 0x96, 0x4a, 0x99, 0x86, 0x1e, 0x47, 0xa3, 0x80,
+    0xf3, 0x17, 0x51, 0x1a, 0x15, 0xcb, 0x48, 0x3d, 0x19, 0xfe, 0x08, 0x5a,
+    0x76, 0x9e, 0xb1, 0xa5, 0x3c, 0xe8, 0x0c, 0xf8, 0x8e, 0x11, 0xba, 0xe7,
+    0x69, 0xfb, 0xfc, 0x8d, 0x57, 0xb8, 0x37, 0xf8, 0x6b, 0xb3, 0x18, 0x93,
+    0x1b, 0xac, 0x08, 0xcc, 0x95, 0x06, 0xdc, 0x58, 0xe5, 0xec, 0x98, 0x72,
+    0xa3, 0xe7, 0x7a, 0x3f, 0x49, 0xa6, 0xff, 0xda, 0x24, 0x22, 0xc0, 0x5d,
+    0x3b, 0x8d, 0x08, 0xa0, 0x79, 0xbb, 0x96, 0x63, 0xfe, 0x40, 0xed, 0x30,
+    0xcb, 0xbc, 0xac, 0xc6, 0xf6, 0x67, 0x25, 0x2b, 0xa5, 0x61, 0x04, 0x26,
+    0xe8, 0x2a, 0xce, 0x5e, 0x0f, 0xe4, 0x82, 0x1e, 0x04, 0x81, 0x1f, 0xd7,
+    0x2c, 0x39, 0x7e, 0x36, 0x59, 0xad, 0xe5, 0x65, 0x1f, 0xd3, 0x66, 0x5b,
+    0x14, 0x03, 0x00, 0x69, 0x73, 0xa4, 0xfd, 0x08, 0x8b, 0x37, 0xc5, 0xfe,
+    0xec, 0x6f, 0x6d, 0x9a, 0xdb, 0x1b, 0x32, 0x0c, 0xe9, 0x01, 0x2f, 0x58,
+    0x9e, 0x4f, 0x8e, 0x24, 0xcc, 0x1a, 0xe4, 0xef, 0x8c, 0x9a, 0x35, 0x7d,
+    0x87, 0xa6, 0xd3, 0x9a, 0x90, 0x57, 0xc9, 0xa0, 0x0b, 0x09, 0xf3, 0xf0,
+    0xac, 0x54, 0x1e, 0x7b, 0x28, 0x59, 0x50, 0x42, 0x3c, 0x9c, 0x42, 0x0b,
+    0xa0, 0x30, 0xb9, 0x4c, 0xc7, 0xdf, 0x38, 0xb0, 0xd9, 0xc0, 0x7f, 0x0c,
+    0xfe, 0x4d, 0x79, 0x4e, 0xeb, 0xf3, 0x33, 0xef, 0x55, 0x82, 0x66, 0xa7,
+    0x02, 0x92, 0x4c, 0x39, 0xbc, 0xcc, 0x19, 0xfa, 0x8b, 0x00, 0xab, 0x29,
+    0xd4, 0xcf, 0xd8, 0x1f, 0x84, 0x66, 0x85, 0x52, 0x1b, 0xe3, 0x4b, 0xa1,
+    0x91, 0x34, 0x77, 0xc7, 0x30, 0x27, 0x8c, 0xf2, 0x0a, 0x5a, 0x97, 0xe4,
+    0x9d, 0xc3, 0xf7, 0x90, 0xba, 0x26, 0x19, 0x18, 0x2f, 0x1b, 0x56, 0x3c,
+    0x55, 0xd7, 0xc7, 0x97, 0x22, 0x14, 0x2b, 0x4c, 0x83, 0xf4, 0x64, 0x30,
+    0x99, 0x07, 0xc0, 0x00, 0x00, 0x01, 0x50, 0x01, 0x84, 0x0d, 0x02, 0x00,
+    0x0a, 0x30, 0x29, 0x00, 0x02, 0x51, 0xb6, 0x00, 0x02, 0x53, 0x8b, 0x80,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0xe0, 0x46, 0xbf, 0xf5, 0x19, 0x10,
+    0xc9, 0x0b, 0xfd, 0xb5, 0x4f, 0xe4, 0xc4, 0xd3, 0x8c, 0x88, 0x0e, 0x1a,
+    0x19, 0x8c, 0x6e, 0xea, 0x1c, 0x3e, 0x1a, 0x43, 0x31, 0x1f, 0x4c, 0x95,
+    0x24, 0x2b, 0x68, 0x9a, 0x9e, 0x6f, 0xf0, 0x17, 0x82, 0xea, 0xf4, 0x2a,
+    0xad, 0xaf, 0x0d, 0x64, 0x39, 0xb9, 0xdb, 0x5f, 0x79, 0x03, 0xfd, 0x6c,
+    0x82, 0x8d, 0x39, 0xa3, 0x4c, 0x0c, 0xac, 0x60, 0x89, 0x1c, 0x32, 0x7c,
+    0x9d, 0xb4, 0x0f, 0xe2, 0x93, 0x24, 0x7c, 0x00, 0x00, 0x01, 0x50, 0x01,
+    0x84, 0x0d, 0x02, 0x00, 0x0a, 0x28, 0x3e, 0x00, 0x02, 0x61, 0xbe, 0x00,
+    0x02, 0x52, 0x59, 0x80,
+};
+
+/* 12 bit 4:2:0 */
+static const uint8_t stream_p12[1525] = {
+    0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0x0c, 0x01, 0xff, 0xff, 0x04, 0x08,
+    0x00, 0x00, 0x03, 0x00, 0x99, 0x88, 0x00, 0x00, 0x03, 0x00, 0x00, 0x1e,
+    0x95, 0x90, 0x09, 0x00, 0x00, 0x00, 0x01, 0x42, 0x01, 0x01, 0x04, 0x08,
+    0x00, 0x00, 0x03, 0x00, 0x99, 0x88, 0x00, 0x00, 0x03, 0x00, 0x00, 0x1e,
+    0xa0, 0x20, 0x81, 0x04, 0x52, 0x96, 0x56, 0x49, 0x24, 0xca, 0xe6, 0x80,
+    0x80, 0x00, 0x00, 0x03, 0x00, 0x80, 0x00, 0x00, 0x0c, 0x84, 0x00, 0x00,
+    0x00, 0x01, 0x44, 0x01, 0xc1, 0x72, 0xb4, 0x22, 0x40, 0x00, 0x00, 0x01,
+    0x28, 0x01, 0xaf, 0x78, 0xab, 0xda, 0x5e, 0xf1, 0x60, 0x42, 0x0c, 0x04,
+    0x3b, 0x96, 0x86, 0xdb, 0xb5, 0xcd, 0x49, 0x1c, 0x13, 0x5b, 0x7c, 0x6f,
+    0x91, 0xbf, 0xf8, 0x06, 0x12, 0x6b, 0xcd, 0x01, 0xd7, 0xeb, 0x40, 0xc4,
+    0x96, 0x97, 0x84, 0x0d, 0xa3, 0x96, 0xb0, 0x91, 0x46, 0xa5, 0x2d, 0xaa,
+    0xc2, 0x81, 0x39, 0x1d, 0x2c, 0x59, 0x7c, 0xf9, 0x95, 0x00, 0x0b, 0x5a,
+    0xae, 0x23, 0x6d, 0x95, 0x03, 0x2a, 0xb9, 0x23, 0x8a, 0x8a, 0x46, 0xbe,
+    0xde, 0x94, 0x0d, 0x6f, 0x49, 0xe7, 0x2a, 0x71, 0xab, 0xd0, 0xfc, 0x5c,
+    0x92, 0x4a, 0x7b, 0x19, 0x4b, 0x00, 0x4e, 0xa5, 0xcf, 0x4b, 0x86, 0x94,
+    0xb4, 0x18, 0xbb, 0xac, 0x92, 0x6b, 0x1f, 0x97, 0x8f, 0xb3, 0xa9, 0x19,
+    0xb3, 0xb0, 0x63, 0xc1, 0x5a, 0x6c, 0x0e, 0xc6, 0xb5, 0x49, 0xf9, 0xb0,
+    0x9b, 0xe5, 0x25, 0x89, 0xa1, 0x9b, 0x98, 0xa2, 0x9a, 0x7c, 0x54, 0xb9,
+    0xec, 0x97, 0x47, 0xd6, 0x68, 0xad, 0x35, 0x08, 0x8d, 0x03, 0xa1, 0xe4,
+    0x97, 0x7b, 0x18, 0x98, 0x6f, 0x20, 0xb6, 0xf5, 0x77, 0x4f, 0x89, 0x41,
+    0x2c, 0xd2, 0x8f, 0x4c, 0x28, 0xc2, 0xcc, 0xfe, 0xa3, 0xf1, 0x5c, 0x31,
+    0x57, 0x36, 0xeb, 0x32, 0x3a, 0xf3, 0x7e, 0xb9, 0x28, 0x63, 0x9e, 0xe6,
+    0x1b, 0x01, 0x99, 0xb5, 0x6a, 0x85, 0x7a, 0x72, 0x8c, 0xdb, 0x78, 0xd6,
+    0x38, 0x92, 0xec, 0x90, 0x56, 0x39, 0x8a, 0x95, 0x25, 0xdc, 0xc0, 0xd7,
+    0xc6, 0x9a, 0x4e, 0x10, 0xa1, 0xa5, 0xbb, 0xcb, 0x3b, 0x3c, 0xfd, 0x1e,
+    0x2b, 0x3c, 0x2a, 0x4c, 0xde, 0x73, 0xe0, 0x0c, 0xd3, 0x06, 0xc1, 0x5e,
+    0x6d, 0x53, 0x94, 0xca, 0xc8, 0x29, 0xc2, 0xd4, 0x52, 0xab, 0x7a, 0x1a,
+    0xcb, 0xcb, 0x5c, 0xe2, 0x42, 0x24, 0xad, 0x26, 0xbc, 0x12, 0xd1, 0xd1,
+    0x8a, 0x4c, 0xff, 0xd7, 0xf6, 0xcd, 0x25, 0xdf, 0x87, 0x8e, 0xea, 0x1e,
+    0x7a, 0xba, 0x4a, 0x32, 0x91, 0x67, 0x0f, 0x49, 0xbd, 0x87, 0x4a, 0x0a,
+    0xd5, 0x51, 0xd8, 0xcc, 0x57, 0x89, 0xbe, 0x17, 0xc1, 0x66, 0xf3, 0xd9,
+    0x70, 0x0a, 0x34, 0xbc, 0x80, 0x69, 0x5a, 0x49, 0x78, 0xc7, 0x09, 0xf8,
+    0xa2, 0x44, 0x49, 0xe7, 0x64, 0x18, 0x5d, 0xde, 0x9b, 0xa1, 0x9c, 0x5e,
+    0x84, 0x4f, 0x51, 0x22, 0x39, 0x52, 0x94, 0x69, 0x18, 0xb7, 0x02, 0x99,
+    0x2b, 0x75, 0x4c, 0x5b, 0x30, 0xd7, 0xdb, 0x3a, 0x0f, 0x38, 0xeb, 0x4b,
+    0xa5, 0x31, 0x03, 0x0f, 0xda, 0xc1, 0x4c, 0x9f, 0x0d, 0xbf, 0x2e, 0x86,
+    0x55, 0xf8, 0x35, 0x92, 0x54, 0x7d, 0xd8, 0xca, 0xb9, 0x97, 0xaf, 0xae,
+    0xe4, 0xe3, 0xfa, 0xf9, 0x82, 0x71, 0x25, 0xfa, 0xcc, 0x7d, 0x35, 0xc6,
+    0x11, 0xbf, 0xf0, 0xa8, 0x06, 0x2d, 0x56, 0x08, 0xf4, 0xf6, 0x5f, 0x06,
+    0x23, 0xd1, 0xee, 0x63, 0x92, 0x1f, 0x8f, 0xe8, 0x44, 0x18, 0x7c, 0xf7,
+    0xae, 0x3c, 0xe7, 0xae, 0x07, 0x6c, 0x5a, 0x26, 0x3a, 0xf4, 0xe1, 0x26,
+    0xd0, 0x9c, 0xf5, 0x06, 0xcb, 0xa9, 0x2b, 0xa7, 0xfd, 0x40, 0x07, 0xb8,
+    0x44, 0x92, 0x43, 0x97, 0xfe, 0x7a, 0x73, 0xe7, 0x9e, 0xfe, 0x4a, 0x85,
+    0x7e, 0xd1, 0x75, 0xad, 0x20, 0x07, 0x19, 0x28, 0xf1, 0xa1, 0xe1, 0xdf,
+    0xea, 0xb2, 0x2a, 0x13, 0x2c, 0xbf, 0xe7, 0x76, 0xc6, 0x0d, 0x5f, 0x73,
+    0xcc, 0x5d, 0xe0, 0x2f, 0x7d, 0xa9, 0x1d, 0xc9, 0x12, 0xf9, 0x48, 0x3a,
+    0xd9, 0x54, 0xf6, 0x42, 0x61, 0x08, 0xa2, 0x9c, 0x07, 0x14, 0x0a, 0xbc,
+    0x75, 0xd2, 0x7d, 0x15, 0x97, 0xa8, 0xa8, 0xb1, 0xf2, 0xd0, 0x67, 0x79,
+    0x65, 0xcb, 0xbb, 0x6a, 0x7b, 0x9d, 0xa5, 0x43, 0x8f, 0x14, 0x2b, 0x87,
+    0xa0, 0x8a, 0x31, 0x56, 0xa3, 0xfe, 0x67, 0x47, 0xfa, 0x6d, 0x62, 0xf4,
+    0x48, 0x1d, 0x15, 0xb8, 0x01, 0x75, 0x74, 0xec, 0xf2, 0x0a, 0xdb, 0xdf,
+    0x72, 0xb5, 0x73, 0x37, 0x24, 0x0f, 0xa9, 0x19, 0xd1, 0x1b, 0xab, 0xc5,
+    0x99, 0x99, 0xc9, 0x16, 0x52, 0x8c, 0x86, 0xc5, 0xc5, 0xa0, 0xf2, 0x68,
+    0x9d, 0xb6, 0x40, 0x11, 0x1a, 0x7e, 0xd8, 0x51, 0xfa, 0xbe, 0x81, 0x0f,
+    0xa7, 0xd8, 0xfb, 0x51, 0xc7, 0xde, 0xd7, 0xa7, 0x1f, 0x4b, 0xfc, 0xf0,
+    0x28, 0xb1, 0x4b, 0xa6, 0x69, 0xbf, 0xb3, 0xc1, 0x10, 0x36, 0xa0, 0x60,
+    0x1a, 0xf9, 0xe8, 0xe3, 0x0d, 0x11, 0xd4, 0xd2, 0x5a, 0x30, 0xc3, 0x57,
+    0x93, 0x37, 0xe4, 0x58, 0x7d, 0x95, 0x57, 0xa6, 0xe9, 0xa7, 0xf1, 0x4a,
+    0xeb, 0x29, 0x2d, 0xe6, 0xcc, 0x7d, 0x7d, 0x4a, 0xa0, 0x3e, 0x7e, 0x9a,
+    0x7e, 0xe7, 0x93, 0x35, 0x82, 0x08, 0xe0, 0xd2, 0xdb, 0x04, 0x67, 0x1c,
+    0xe0, 0x59, 0x31, 0x7d, 0x71, 0xf1, 0x24, 0x97, 0x4a, 0xfa, 0x2e, 0x87,
+    0xa9, 0x2d, 0x9b, 0xdf, 0x1c, 0x73, 0x52, 0xaf, 0xcd, 0xb1, 0xa5, 0xbe,
+    0x9e, 0xca, 0x1d, 0xea, 0xd7, 0xe0, 0x96, 0x2c, 0x38, 0x3f, 0xfa, 0x99,
+    0x9a, 0xab, 0xd6, 0x7c, 0x13, 0x88, 0x90, 0x41, 0x7f, 0xc5, 0xe3, 0xba,
+    0x79, 0xb7, 0xf9, 0xcd, 0xd3, 0x38, 0x46, 0x1b, 0xda, 0x75, 0x7a, 0xd0,
+    0x7e, 0x7d, 0x02, 0x0a, 0x81, 0x88, 0x5f, 0x80, 0x41, 0x13, 0x58, 0x8a,
+    0xb1, 0x07, 0x18, 0x4f, 0x01, 0x85, 0xb4, 0xc0, 0x28, 0xd3, 0xf0, 0x53,
+    0x99, 0xb8, 0xb2, 0x0d, 0xad, 0x88, 0x26, 0x9a, 0x20, 0xaf, 0x19, 0xa3,
+    0x95, 0x9e, 0x56, 0xba, 0x17, 0x52, 0x30, 0xc6, 0xf1, 0xed, 0x96, 0x21,
+    0xe8, 0x30, 0xee, 0xd9, 0xaf, 0x7b, 0x29, 0xd1, 0x84, 0x1f, 0x86, 0x7b,
+    0x96, 0xff, 0xa8, 0xe8, 0x92, 0x8e, 0xb5, 0x95, 0xd0, 0xd4, 0x29, 0xf2,
+    0x70, 0x94, 0x30, 0x8c, 0xe0, 0x5f, 0x34, 0x88, 0x99, 0x95, 0x7e, 0x49,
+    0x13, 0x0c, 0xed, 0x6a, 0x14, 0xc6, 0x65, 0x97, 0xca, 0xa6, 0x43, 0xf8,
+    0xad, 0x1a, 0xd1, 0xa5, 0x86, 0x6b, 0x37, 0xd5, 0xc2, 0x67, 0x82, 0x9f,
+    0xfa, 0x94, 0xac, 0x7e, 0x65, 0x7e, 0x1b, 0xd1, 0x97, 0x80, 0x00, 0x00,
+    0x01, 0x50, 0x01, 0x84, 0x0d, 0x02, 0x00, 0x09, 0xd7, 0xb3, 0x00, 0x02,
+    0x38, 0x7c, 0x00, 0x02, 0x45, 0x15, 0x80, 0x00, 0x00, 0x00, 0x01, 0x02,
+    0x01, 0xd0, 0x09, 0x7e, 0x8c, 0xa6, 0x6f, 0xab, 0x60, 0x11, 0xf3, 0xb2,
+    0x8e, 0xa0, 0x4d, 0xcd, 0x5b, 0xcf, 0x5c, 0xd0, 0x25, 0x9c, 0x79, 0xd4,
+    0x0d, 0xbd, 0x3c, 0x89, 0x68, 0xdc, 0x8c, 0x6d, 0x2f, 0xf0, 0x2a, 0xd1,
+    0x63, 0x42, 0x92, 0x31, 0x9a, 0x4b, 0x69, 0x67, 0xe3, 0x09, 0x1e, 0x00,
+    0x4b, 0xd8, 0xc0, 0xa1, 0x2c, 0x8b, 0xbf, 0x92, 0x5e, 0x9d, 0x55, 0x3d,
+    0x4a, 0xc0, 0x3f, 0x64, 0x7d, 0x84, 0x5b, 0xe9, 0xd3, 0x30, 0x8d, 0x20,
+    0x94, 0x27, 0x8c, 0x89, 0x54, 0xb0, 0xd7, 0xb7, 0x70, 0x3c, 0xdc, 0x94,
+    0xfd, 0xa4, 0xe9, 0x16, 0xe9, 0x49, 0x7f, 0x83, 0x84, 0x15, 0xd3, 0x7d,
+    0x5c, 0xf2, 0x31, 0xdc, 0xeb, 0xff, 0x68, 0xb2, 0xbb, 0x84, 0xc6, 0x7d,
+    0xfe, 0x51, 0x29, 0x60, 0x45, 0xe6, 0xfe, 0xa3, 0x04, 0xf5, 0xcf, 0xf4,
+    0x6c, 0x7d, 0xc0, 0x61, 0xfc, 0xeb, 0x5a, 0x3f, 0xe1, 0x33, 0x0d, 0x8b,
+    0x51, 0xc2, 0xcf, 0x89, 0x8c, 0x83, 0x79, 0x3c, 0xa3, 0x46, 0xa3, 0xf8,
+    0xfa, 0x4d, 0xe0, 0x88, 0x63, 0x44, 0x75, 0x63, 0x22, 0x06, 0x87, 0x60,
+    0x09, 0xba, 0x9e, 0xd3, 0xcf, 0xab, 0x3b, 0xb3, 0x6c, 0x8b, 0xe8, 0x19,
+    0xee, 0x6b, 0x6b, 0x1e, 0x93, 0x2e, 0x8d, 0x80, 0x00, 0x00, 0x01, 0x50,
+    0x01, 0x84, 0x0d, 0x02, 0x00, 0x09, 0xe5, 0xe5, 0x00, 0x02, 0x39, 0x32,
+    0x00, 0x02, 0x44, 0xdc, 0x80, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0xd0,
+    0x19, 0xd7, 0xf5, 0x8c, 0x88, 0xc6, 0xd0, 0xfe, 0x6e, 0x91, 0xa9, 0x3a,
+    0x79, 0xc4, 0x52, 0xed, 0x94, 0x67, 0xfc, 0x13, 0xb6, 0xdc, 0x37, 0x2e,
+    0x29, 0x63, 0xc1, 0xfc, 0x49, 0x24, 0xb1, 0x4d, 0x5b, 0x31, 0x75, 0x0c,
+    0x8a, 0x07, 0xe8, 0x88, 0x79, 0xb9, 0x34, 0x40, 0x5e, 0xc4, 0xdd, 0xc5,
+    0x35, 0x5f, 0x12, 0x87, 0xa6, 0x6d, 0xa4, 0x4e, 0x28, 0x11, 0x45, 0xaf,
+    0x1f, 0x2a, 0x80, 0x16, 0x13, 0xaf, 0xc3, 0x0e, 0xea, 0xe0, 0x21, 0x48,
+    0x57, 0x2f, 0x68, 0xb2, 0x9a, 0x83, 0xf6, 0x1c, 0x42, 0x57, 0xdd, 0x94,
+    0xbb, 0xda, 0x8a, 0x8b, 0xc7, 0xbf, 0xff, 0x72, 0xe4, 0x75, 0x86, 0x60,
+    0x7a, 0xc8, 0x10, 0x13, 0x43, 0xd6, 0xd8, 0x57, 0xc7, 0xbf, 0x4c, 0x93,
+    0xd0, 0x1f, 0x1d, 0x34, 0x4c, 0x78, 0xbe, 0x4f, 0xb3, 0x80, 0x37, 0xb4,
+    0x4d, 0xd1, 0x04, 0xe6, 0x1e, 0xe3, 0xaf, 0xaa, 0x34, 0x8b, 0x7d, 0x29,
+    0x53, 0x27, 0x61, 0x46, 0x19, 0x8e, 0x7d, 0x41, 0x4a, 0x1c, 0x26, 0xc7,
+    0x5e, 0x03, 0xa7, 0x75, 0x68, 0x26, 0x0d, 0x67, 0x84, 0x9a, 0x5a, 0xf8,
+    0xe4, 0x1f, 0x05, 0x80, 0x0c, 0x47, 0x53, 0xd0, 0xb7, 0x1e, 0x95, 0xe3,
+    0x23, 0x01, 0x3c, 0x71, 0xcb, 0xf9, 0xa6, 0x10, 0x3c, 0xbc, 0xd9, 0xc9,
+    0xaf, 0x46, 0x16, 0x1f, 0xc0, 0x7d, 0xbc, 0x3a, 0x3f, 0xff, 0xec, 0xb8,
+    0x9f, 0xc9, 0x77, 0xd1, 0xbf, 0x42, 0xff, 0x47, 0xe1, 0xa2, 0xbc, 0x0e,
+    0x49, 0x28, 0x49, 0xf1, 0xd7, 0xac, 0xf8, 0xd4, 0x26, 0xb7, 0x0e, 0x77,
+    0xf1, 0x75, 0x8f, 0x1e, 0x7c, 0x87, 0x4f, 0xb9, 0xd7, 0x94, 0x1b, 0x47,
+    0x3c, 0x65, 0xab, 0x2b, 0x16, 0x35, 0x0e, 0x6e, 0x04, 0x84, 0x6b, 0xf4,
+    0xbd, 0x95, 0xc3, 0x5f, 0x96, 0x5f, 0xa0, 0x53, 0x4d, 0x7b, 0x5c, 0x0d,
+    0x9e, 0x02, 0x39, 0x2c, 0x24, 0xd8, 0x8e, 0x07, 0x86, 0xc3, 0x13, 0xf2,
+    0x32, 0x5c, 0x6c, 0x0c, 0x56, 0xb9, 0x06, 0x01, 0xff, 0x17, 0xbc, 0x97,
+    0x63, 0x84, 0x6f, 0x31, 0xe0, 0x27, 0x2a, 0xe0, 0x00, 0x00, 0x01, 0x50,
+    0x01, 0x84, 0x0d, 0x02, 0x00, 0x09, 0xd5, 0x28, 0x00, 0x02, 0x2e, 0x95,
+    0x00, 0x02, 0x46, 0x50, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0xe0,
+    0x46, 0xbf, 0xf5, 0x19, 0x10, 0xe6, 0xd6, 0x99, 0x8f, 0x12, 0x0f, 0x29,
+    0xc7, 0x95, 0x2e, 0x7e, 0x4d, 0x51, 0x28, 0x30, 0xe1, 0x73, 0xad, 0xae,
+    0x14, 0x14, 0xd0, 0x47, 0xa4, 0x87, 0xab, 0xc1, 0x6a, 0x3e, 0xbf, 0x5a,
+    0x4c, 0xf7, 0x34, 0xbc, 0x6b, 0xc6, 0x6b, 0xbf, 0x4a, 0xed, 0xf4, 0xa4,
+    0x96, 0x1a, 0x73, 0x19, 0x5a, 0x0d, 0x4f, 0x4f, 0x0d, 0xd9, 0x1c, 0x7f,
+    0x36, 0x17, 0x01, 0x58, 0x00, 0x00, 0x01, 0x50, 0x01, 0x84, 0x0d, 0x02,
+    0x00, 0x09, 0xe0, 0x0e, 0x00, 0x02, 0x24, 0x40, 0x00, 0x02, 0x3e, 0x0c,
+    0x80,
+};
+
+/* 8 bit 4:2:2, with --rd 6 and a noisy checkerboard for NxN intra cus */
+static const uint8_t stream_y422[6482] = {
+    0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0x0c, 0x01, 0xff, 0xff, 0x04, 0x08,
+    0x00, 0x00, 0x03, 0x00, 0x9d, 0x08, 0x00, 0x00, 0x03, 0x00, 0x00, 0x1e,
+    0x95, 0x90, 0x09, 0x00, 0x00, 0x00, 0x01, 0x42, 0x01, 0x01, 0x04, 0x08,
+    0x00, 0x00, 0x03, 0x00, 0x9d, 0x08, 0x00, 0x00, 0x03, 0x00, 0x00, 0x1e,
+    0xb0, 0x20, 0x81, 0x05, 0x96, 0x56, 0x49, 0x24, 0xca, 0xe6, 0x80, 0x80,
+    0x00, 0x00, 0x03, 0x00, 0x80, 0x00, 0x00, 0x0c, 0x84, 0x00, 0x00, 0x00,
+    0x01, 0x44, 0x01, 0xc1, 0x72, 0xb4, 0x22, 0x40, 0x00, 0x00, 0x01, 0x28,
+    0x01, 0xaf, 0x78, 0xe2, 0xe8, 0x26, 0xf0, 0x30, 0x5b, 0x8b, 0xc7, 0x3b,
+    0x7b, 0x17, 0xfd, 0x2b, 0x01, 0xac, 0xa6, 0x26, 0x95, 0xf1, 0xf7, 0xd6,
+    0x07, 0x4f, 0x21, 0x2c, 0x53, 0x79, 0x06, 0xea, 0xd7, 0xc5, 0x0e, 0x3c,
+    0xb0, 0xcb, 0xc8, 0x4b, 0x62, 0x68, 0x94, 0xba, 0x64, 0xff, 0xe4, 0xd0,
+    0x2c, 0xea, 0x19, 0xfc, 0x89, 0x7e, 0x54, 0xe8, 0x04, 0xb0, 0x1e, 0x31,
+    0xea, 0xda, 0x0f, 0xd5, 0x06, 0x50, 0x96, 0xcb, 0xae, 0x91, 0xbd, 0xad,
+    0xfb, 0x73, 0xad, 0xf3, 0x9a, 0xdd, 0x7b, 0xe3, 0x27, 0x71, 0xfc, 0xad,
+    0x90, 0x3d, 0x0b, 0xd9, 0x6b, 0x48, 0x25, 0x59, 0xa7, 0x86, 0x9e, 0xfd,
+    0x2e, 0x23, 0xf1, 0xf8, 0x1a, 0xf0, 0x66, 0x29, 0x0b, 0xab, 0xd4, 0x5c,
+    0x11, 0xd5, 0xb5, 0x10, 0x66, 0x8e, 0x6e, 0xbe, 0xff, 0x03, 0xfa, 0x1f,
+    0x5b, 0xd1, 0x76, 0xd5, 0xc3, 0x2c, 0x78, 0x21, 0xc4, 0x90, 0xaa, 0x1c,
+    0x5f, 0x35, 0xca, 0x70, 0xea, 0x9b, 0x45, 0xde, 0x44, 0xe0, 0xaf, 0x10,
+    0xdd, 0xd1, 0xe9, 0x2b, 0x1b, 0x6c, 0xad, 0x88, 0xc0, 0x81, 0x38, 0xea,
+    0x45, 0x14, 0x15, 0xee, 0xb4, 0xaa, 0x25, 0xd8, 0x6c, 0x21, 0x20, 0xe1,
+    0x78, 0x3c, 0x85, 0xcc, 0xcc, 0x98, 0x0b, 0xdd, 0xa0, 0x3c, 0xc6, 0x43,
+    0xf7, 0x82, 0x0e, 0x17, 0x71, 0x23, 0x7d, 0xf4, 0xf9, 0xad, 0xf3, 0x5d,
+    0x95, 0x8c, 0x15, 0xce, 0xbc, 0x27, 0xc3, 0xc7, 0x75, 0xcb, 0xdc, 0xdf,
+    0x00, 0x25, 0x25, 0x5d, 0x8f, 0x76, 0x40, 0x43, 0xbf, 0x11, 0x4a, 0x39,
+    0x7d, 0xd9, 0x87, 0xff, 0x15, 0xaf, 0x59, 0xc7, 0x8c, 0xa3, 0xb7, 0xef,
+    0x23, 0xc8, 0x87, 0xe3, 0x71, 0x76, 0x02, 0x81, 0xf0, 0x70, 0xa8, 0x0a,
+    0x4e, 0x79, 0x3d, 0x70, 0xcd, 0x16, 0x47, 0x60, 0x6a, 0xcf, 0xf7, 0x52,
+    0xf3, 0xa6, 0x67, 0x20, 0x4d, 0x19, 0xf7, 0xe5, 0xe7, 0x99, 0x61, 0x48,
+    0xde, 0x51, 0xc0, 0xdb, 0x32, 0x6b, 0x6d, 0x80, 0x12, 0xbc, 0x77, 0xf5,
+    0x80, 0xe4, 0x92, 0x9c, 0xd5, 0xa2, 0x0e, 0xf8, 0x77, 0xc4, 0x27, 0x09,
+    0x32, 0xc0, 0x6c, 0x2c, 0xf8, 0x9d, 0x23, 0xfd, 0x1f, 0x8d, 0x38, 0x2d,
+    0x92, 0xb7, 0x3c, 0x26, 0xd7, 0xe5, 0x50, 0x30, 0xa5, 0xf1, 0xed, 0x60,
+    0x45, 0xdf, 0xfe, 0x69, 0x5a, 0x00, 0x49, 0x3b, 0xfa, 0x24, 0xc0, 0x0f,
+    0xf7, 0x82, 0xc9, 0x6a, 0x65, 0xa1, 0xaf, 0x1a, 0xd0, 0x67, 0xf6, 0xc3,
+    0x37, 0xae, 0xf0, 0x2e, 0xb5, 0x27, 0x3e, 0x8a, 0x48, 0x3b, 0xa6, 0xd3,
+    0x38, 0x6c, 0xff, 0x75, 0x29, 0x49, 0xb9, 0xd9, 0xcf, 0x76, 0x8a, 0xd1,
+    0x05, 0x5d, 0x39, 0xe5, 0xbe, 0xde, 0x78, 0x73, 0x86, 0xeb, 0xe6, 0xb5,
+    0xfe, 0x3c, 0x84, 0xd7, 0x77, 0x02, 0x94, 0x7b, 0xba, 0xa1, 0xa0, 0x25,
+    0xd6, 0x4e, 0x26, 0x58, 0xa9, 0x5f, 0xc8, 0x49, 0x86, 0x13, 0x4c, 0xf4,
+    0xaa, 0xb6, 0xc7, 0x91, 0x99, 0xfe, 0xf1, 0x1a, 0xe3, 0x16, 0x10, 0xa5,
+    0x14, 0x63, 0xf3, 0x2d, 0x4a, 0xa1, 0xbf, 0xed, 0xac, 0x8d, 0x8d, 0xa1,
+    0x31, 0xd3, 0xb5, 0x57, 0xec, 0xb2, 0x55, 0x2d, 0xca, 0x49, 0x8e, 0x42,
+    0x45, 0x91, 0x88, 0x7c, 0x0c, 0xc2, 0x9b, 0xbe, 0x45, 0xa8, 0xfd, 0xb8,
+    0x5e, 0xca, 0xc7, 0xc2, 0xb5, 0xb6, 0xc8, 0xf4, 0x70, 0xbe, 0x2c, 0x51,
+    0x20, 0x8f, 0x43, 0xb4, 0x08, 0x7c, 0xf8, 0x65, 0xc6, 0x1c, 0x97, 0x20,
+    0xd1, 0x49, 0x91, 0x97, 0x8b, 0x95, 0x3b, 0xe0, 0x42, 0x14, 0x84, 0x9b,
+    0x98, 0xd0, 0x1c, 0x24, 0x99, 0xbe, 0xab, 0x23, 0x5b, 0x28, 0x3e, 0x19,
+    0xf1, 0x96, 0x94, 0xd5, 0x23, 0x7e, 0x7f, 0xbf, 0xf1, 0x9c, 0xcc, 0x48,
+    0xd7, 0x88, 0x58, 0xa1, 0xc3, 0x1a, 0x68, 0x8b, 0x57, 0x9e, 0xba, 0x06,
+    0x24, 0xa9, 0x6c, 0xdc, 0x15, 0xbb, 0xa6, 0xcf, 0x3d, 0xaf, 0x5a, 0x93,
+    0x8b, 0xd5, 0x14, 0xc5, 0xf3, 0x46, 0x7e, 0x81, 0x58, 0xc4, 0xd1, 0xc0,
+    0xbe, 0x0b, 0x6c, 0xa1, 0x11, 0x43, 0xa6, 0x1c, 0xe0, 0x1c, 0xfa, 0xe4,
+    0x48, 0xcd, 0xb0, 0xc3, 0x2e, 0x6c, 0x30, 0xe3, 0x54, 0xd1, 0xa8, 0x13,
+    0xd8, 0x00, 0xfa, 0x0c, 0xec, 0x02, 0x09, 0x47, 0x40, 0x76, 0xf0, 0x86,
+    0x90, 0xf2, 0xfc, 0xcc, 0x4b, 0x23, 0x15, 0x72, 0xa7, 0x6b, 0x2d, 0x60,
+    0x33, 0xf2, 0x28, 0xa6, 0x46, 0xb7, 0xa0, 0xb4, 0x35, 0x38, 0x2c, 0x52,
+    0xb9, 0xdf, 0x2f, 0x33, 0xe4, 0xeb, 0xa9, 0x41, 0xd8, 0x07, 0x1e, 0x83,
+    0x72, 0x7a, 0xfb, 0xbd, 0x03, 0x3f, 0x97, 0xb2, 0xe5, 0x69, 0x89, 0x1b,
+    0x9b, 0x3a, 0xda, 0x6c, 0xe4, 0xc9, 0xb0, 0xd6, 0x00, 0x76, 0xff, 0x1d,
+    0x2a, 0xa7, 0x46, 0xd6, 0x78, 0x96, 0x70, 0x47, 0xd1, 0xcb, 0xef, 0x6e,
+    0x83, 0x18, 0x21, 0x92, 0x5c, 0x35, 0x8c, 0x90, 0xeb, 0x59, 0xcf, 0x74,
+    0xca, 0x70, 0xb3, 0x66, 0xce, 0xec, 0x96, 0xe2, 0xf1, 0x67, 0x1a, 0x2e,
+    0x6c, 0x70, 0xf0, 0xa5, 0x9c, 0xd6, 0xc6, 0x41, 0xa5, 0x01, 0x53, 0x2e,
+    0xd2, 0x9a, 0x53, 0x94, 0xc6, 0x86, 0xbe, 0x59, 0x4e, 0xec, 0xe3, 0xf4,
+    0xfc, 0x6e, 0x08, 0x5f, 0xfd, 0x45, 0x0f, 0xd2, 0xb6, 0x2c, 0x42, 0xf4,
+    0x9d, 0x35, 0xb3, 0x62, 0x53, 0xab, 0x76, 0xe4, 0xe2, 0x8f, 0x94, 0x54,
+    0xde, 0xe2, 0xca, 0x35, 0x9a, 0xc7, 0xac, 0xcd, 0x3f, 0x49, 0x59, 0x64,
+    0xa4, 0x71, 0x50, 0xd4, 0x78, 0x43, 0x7b, 0x50, 0x08, 0x6c, 0xe8, 0xdd,
+    0x59, 0xea, 0x44, 0xa9, 0x1a, 0xaf, 0x65, 0x1f, 0xfc, 0x87, 0x79, 0x80,
+    0x4e, 0xf5, 0x9c, 0xb1, 0xc7, 0x37, 0xf8, 0xc6, 0xda, 0xa4, 0x9f, 0x35,
+    0x2c, 0x34, 0x7c, 0x32, 0x9b, 0x00, 0x77, 0x1f, 0xc9, 0x23, 0xc9, 0x2f,
+    0x0b, 0xf0, 0x9c, 0x18, 0x63, 0xb7, 0x2e, 0xbb, 0xb0, 0x16, 0xe6, 0xe3,
+    0x7f, 0x4e, 0x8a, 0x2f, 0x5f, 0x4c, 0x7b, 0x2b, 0x82, 0x2f, 0x9c, 0x1e,
+    0xce, 0x4d, 0x3a, 0x3a, 0x84, 0xb7, 0xa9, 0x72, 0x51, 0x4c, 0x6e, 0xed,
+    0xcf, 0xb9, 0x33, 0xe4, 0x68, 0x44, 0xc8, 0xf6, 0x6d, 0x68, 0x10, 0xca,
+    0xa4, 0xaf, 0x7a, 0x7a, 0x62, 0xa5, 0x45, 0x01, 0xca, 0xe0, 0x99, 0xc3,
+    0x64, 0x09, 0x2a, 0x7f, 0x11, 0x7b, 0xb7, 0x47, 0x11, 0x6c, 0x4e, 0x58,
+    0x92, 0x47, 0x4d, 0x29, 0x17, 0x2d, 0x8f, 0x3d, 0x8b, 0x0b, 0xfa, 0xf9,
+    0x51, 0x38, 0x45, 0x15, 0x47, 0x95, 0x2c, 0x82, 0xcf, 0xf2, 0x2b, 0x7a,
+    0x6f, 0x59, 0xfd, 0xee, 0x0b, 0xb4, 0x7f, 0x38, 0x16, 0xf8, 0x26, 0xd3,
+    0x42, 0x15, 0x1f, 0x60, 0x86, 0x31, 0x15, 0x44, 0x5c, 0x04, 0xbf, 0x5e,
+    0x3e, 0xe8, 0x0e, 0xd1, 0xc9, 0xbc, 0x1a, 0x5b, 0x8b, 0xf2, 0xd0, 0x05,
+    0x2b, 0x6d, 0xb4, 0x36, 0x17, 0x1b, 0xc3, 0xfd, 0xda, 0x9c, 0xd3, 0x9d,
+    0xf9, 0xf0, 0x80, 0x78, 0x01, 0xf1, 0xa9, 0x99, 0x93, 0xaf, 0x29, 0x5b,
+    0xaf, 0xbd, 0x62, 0x52, 0xc0, 0x44, 0x99, 0x6a, 0xea, 0x29, 0x3f, 0x33,
+    0x7c, 0x72, 0x22, 0xeb, 0x6a, 0x5d, 0x4d, 0xad, 0x9b, 0xd3, 0xdf, 0x79,
+    0xfe, 0xf8, 0x0f, 0x9e, 0x8e, 0x63, 0x83, 0x50, 0xe8, 0xe2, 0x1d, 0x89,
+    0x43, 0x57, 0xdd, 0xe9, 0x98, 0x6e, 0x17, 0x0b, 0x94, 0x31, 0xf3, 0x4c,
+    0x70, 0xfc, 0x00, 0xc6, 0x27, 0x65, 0x53, 0xaa, 0x96, 0x5f, 0xa9, 0x02,
+    0xfe, 0x38, 0xbe, 0xca, 0xc6, 0xe7, 0x9c, 0x89, 0x96, 0xd3, 0x29, 0x9b,
+    0x09, 0x23, 0xb9, 0x18, 0x17, 0x3c, 0x14, 0xec, 0x0e, 0xff, 0x06, 0x16,
+    0xaa, 0xff, 0x01, 0x4d, 0x13, 0xd3, 0x78, 0x4a, 0x19, 0x60, 0xd7, 0x80,
+    0xc4, 0x90, 0x2d, 0x52, 0x37, 0x6c, 0xab, 0x11, 0x6b, 0xc9, 0x82, 0x5a,
+    0x82, 0x5f, 0xbd, 0x37, 0x30, 0x76, 0x0d, 0xa2, 0x53, 0x27, 0xe2, 0xbd,
+    0xb8, 0x82, 0x58, 0x66, 0x86, 0x01, 0xb6, 0x0b, 0xe8, 0x9f, 0x33, 0xe6,
+    0x13, 0xa8, 0x0c, 0xfc, 0x5f, 0xa4, 0x59, 0x0c, 0x90, 0x84, 0xb4, 0x28,
+    0xef, 0x8f, 0x34, 0xde, 0xac, 0xfe, 0x6a, 0xbc, 0x87, 0x12, 0x45, 0x0a,
+    0xd3, 0x58, 0xf3, 0x77, 0x57, 0xc6, 0xa1, 0x99, 0x10, 0xea, 0x18, 0x0e,
+    0x92, 0x58, 0xec, 0xc0, 0xde, 0xd6, 0xa2, 0x56, 0x45, 0x42, 0xc8, 0x21,
+    0xf1, 0x59, 0x32, 0x2a, 0x4f, 0xc4, 0x0c, 0x90, 0xac, 0x19, 0x23, 0xd0,
+    0xa9, 0x57, 0x73, 0x70, 0x5b, 0x7a, 0x84, 0x8b, 0x38, 0x48, 0xe2, 0xbb,
+    0x70, 0xbf, 0x80, 0xe1, 0xf4, 0x47, 0x8a, 0x4c, 0x38, 0x19, 0xb6, 0x0b,
+    0x73, 0xa2, 0xdc, 0xf2, 0xe9, 0xc1, 0x28, 0x42, 0xec, 0x12, 0xac, 0x55,
+    0x85, 0x89, 0x0b, 0x3a, 0xc5, 0x47, 0xb9, 0xcd, 0x3c, 0x23, 0xc3, 0x3c,
+    0x7b, 0x45, 0x0e, 0x52, 0x02, 0x1e, 0x7e, 0x94, 0x61, 0x46, 0xbf, 0x88,
+    0x90, 0x51, 0x9b, 0x8c, 0x32, 0x7e, 0x23, 0x3c, 0xa3, 0xab, 0x70, 0x7c,
+    0xf9, 0xb1, 0x9b, 0x44, 0xb2, 0x07, 0xfe, 0xc7, 0xc8, 0x9c, 0xb7, 0x37,
+    0x3f, 0x27, 0x1a, 0xdf, 0x83, 0x35, 0xd8, 0x19, 0x68, 0x83, 0x79, 0x8b,
+    0xaf, 0xb8, 0x48, 0xcf, 0xb3, 0xcb, 0xca, 0xd1, 0xee, 0x72, 0x55, 0x4b,
+    0x8e, 0x4f, 0xc5, 0xfb, 0xbb, 0x3b, 0x99, 0x31, 0x0e, 0x0a, 0x74, 0xd4,
+    0x22, 0xb9, 0x50, 0x28, 0xa6, 0xfc, 0x83, 0xbc, 0xd0, 0xbd, 0xf6, 0xf4,
+    0xed, 0x49, 0x75, 0x85, 0x66, 0x83, 0x5c, 0xc1, 0x71, 0x21, 0x90, 0x31,
+    0x14, 0xde, 0xe0, 0xa8, 0x5a, 0x90, 0x8b, 0xf3, 0x97, 0x69, 0xa1, 0x0b,
+    0x44, 0xc6, 0x3a, 0x8c, 0xfc, 0xd3, 0x65, 0xf8, 0x44, 0xc0, 0x56, 0xae,
+    0x52, 0x63, 0x7f, 0x1e, 0x56, 0x44, 0xbb, 0x09, 0x68, 0x6e, 0x13, 0xb8,
+    0x51, 0xa0, 0x75, 0x11, 0x9a, 0x4c, 0xb8, 0x89, 0x1a, 0x4e, 0x80, 0xbb,
+    0x22, 0xf1, 0x16, 0x87, 0x72, 0x22, 0xeb, 0x36, 0x16, 0x85, 0x54, 0x9a,
+    0x75, 0x2e, 0xd5, 0x13, 0x75, 0x17, 0x63, 0xe4, 0x80, 0x0b, 0x23, 0xe1,
+    0xef, 0x6d, 0x52, 0x9d, 0x8e, 0xc7, 0x12, 0xd7, 0xb3, 0x6b, 0xb6, 0xb5,
+    0x7d, 0xea, 0xc8, 0x9d, 0xea, 0x71, 0xb6, 0xc8, 0x12, 0xdc, 0xde, 0x85,
+    0xe4, 0xd6, 0x26, 0x45, 0xa0, 0xde, 0x64, 0xbe, 0x16, 0x04, 0xc5, 0x4a,
+    0x60, 0x9c, 0x00, 0x15, 0x4e, 0xf3, 0x0d, 0x39, 0xbd, 0xaa, 0x42, 0xeb,
+    0x9d, 0xc2, 0xb2, 0x9e, 0x61, 0xe6, 0x77, 0x60, 0xf6, 0xf8, 0x1a, 0xf1,
+    0xaa, 0x7b, 0x9b, 0x38, 0xe8, 0xfc, 0xd3, 0x62, 0x78, 0x9a, 0x0f, 0xe7,
+    0x49, 0xa6, 0x1b, 0xf7, 0xf3, 0x06, 0xe8, 0x93, 0x51, 0xa6, 0xc6, 0x32,
+    0xaa, 0x05, 0x5b, 0x41, 0x62, 0xbc, 0x39, 0x84, 0xf4, 0x74, 0x81, 0xa9,
+    0xdd, 0xc2, 0x0b, 0x25, 0xc3, 0x6d, 0xa4, 0x03, 0xc8, 0xa7, 0x76, 0x57,
+    0xd2, 0x25, 0xce, 0xb4, 0xce, 0x87, 0xca, 0x1e, 0x5b, 0xe8, 0x6c, 0x16,
+    0x8e, 0x4a, 0x87, 0xf5, 0x75, 0xd2, 0x0e, 0xb6, 0xcb, 0x88, 0xb7, 0xa3,
+    0x5d, 0x19, 0x10, 0xda, 0x78, 0x54, 0xe4, 0x94, 0x88, 0x5c, 0x11, 0xd0,
+    0x2a, 0xc6, 0xef, 0x86, 0x82, 0xc0, 0x2f, 0x81, 0x0b, 0xa1, 0xb9, 0x24,
+    0x04, 0xea, 0x06, 0x7f, 0x3c, 0x08, 0x1f, 0x84, 0x22, 0x14, 0x32, 0xc8,
+    0x32, 0x48, 0xe3, 0x40, 0x8a, 0x28, 0xea, 0x0f, 0x5c, 0x43, 0x6c, 0xb6,
+    0x4c, 0x2b, 0x80, 0x62, 0x71, 0x7d, 0x09, 0xd5, 0x71, 0x01, 0xe0, 0xfb,
+    0x7f, 0x7b, 0x97, 0x86, 0x87, 0x59, 0x82, 0x7d, 0x80, 0x36, 0x79, 0x28,
+    0x0d, 0x82, 0x9c, 0xf1, 0x9a, 0xd9, 0x02, 0x70, 0x00, 0xc2, 0x2d, 0xf7,
+    0x95, 0xc2, 0xa4, 0x83, 0xdf, 0xf2, 0x2a, 0xbc, 0xb3, 0x50, 0x63, 0x3d,
+    0x80, 0x24, 0x77, 0x9e, 0xb1, 0xef, 0x0b, 0xe8, 0x88, 0xa5, 0x4f, 0x4c,
+    0x94, 0x71, 0xd7, 0xa5, 0x0a, 0x84, 0x19, 0xfb, 0xc2, 0x65, 0x7c, 0xec,
+    0xdc, 0x44, 0x92, 0xb6, 0x09, 0x5e, 0x53, 0x6e, 0xae, 0xaf, 0x0d, 0x72,
+    0xd8, 0x82, 0xa4, 0xc8, 0x65, 0x5e, 0xd6, 0x09, 0xfc, 0xc6, 0x28, 0x33,
+    0x6e, 0x71, 0x21, 0xdc, 0x3c, 0x12, 0x42, 0x9e, 0x74, 0x88, 0xc2, 0xe7,
+    0xb0, 0x39, 0x75, 0x5e, 0xdb, 0xb8, 0xa2, 0xb5, 0x03, 0x24, 0xfa, 0xeb,
+    0x34, 0xad, 0xc8, 0x96, 0x03, 0xc5, 0x94, 0x8b, 0xb2, 0xcb, 0x2a, 0xd3,
+    0xcc, 0xa2, 0xd6, 0x2e, 0xee, 0x9b, 0x03, 0x4d, 0x42, 0x29, 0xea, 0x70,
+    0x96, 0xc7, 0x97, 0x9f, 0x20, 0x75, 0x65, 0xfe, 0x04, 0x10, 0xd3, 0x84,
+    0x1d, 0x99, 0xa1, 0xf5, 0x43, 0x0f, 0xfd, 0xd7, 0xc1, 0x37, 0x98, 0x0d,
+    0xe9, 0xc5, 0x46, 0x70, 0x8e, 0x88, 0xf0, 0xdb, 0x80, 0x89, 0xc9, 0xce,
+    0xcf, 0x77, 0x43, 0xa2, 0xbe, 0x8c, 0xc0, 0x62, 0x2d, 0x71, 0x6c, 0x66,
+    0x89, 0x9b, 0xb3, 0x9e, 0x9c, 0x4f, 0xab, 0xd4, 0x01, 0xd5, 0xdd, 0xc4,
+    0x75, 0x70, 0xdb, 0x8c, 0xf0, 0xdb, 0x81, 0x4d, 0x7a, 0xb1, 0x69, 0x89,
+    0x8c, 0x7b, 0x25, 0x58, 0x41, 0x18, 0x2b, 0x0c, 0x23, 0xbd, 0x9c, 0x42,
+    0xa0, 0xe9, 0x47, 0x04, 0x8f, 0x06, 0x91, 0x51, 0xc1, 0x6c, 0xd2, 0xb9,
+    0xcd, 0x84, 0x8d, 0x51, 0x82, 0x26, 0x81, 0x50, 0x38, 0xaa, 0x7e, 0x94,
+    0xc3, 0x95, 0xe5, 0x42, 0xff, 0x5c, 0x41, 0x81, 0xd5, 0x4f, 0x31, 0xa1,
+    0x62, 0xcb, 0xe3, 0x87, 0x70, 0x2c, 0xd5, 0x4e, 0x77, 0x03, 0x99, 0xd8,
+    0xfd, 0x18, 0x1e, 0x52, 0x48, 0x96, 0x20, 0x74, 0xdb, 0xae, 0xae, 0xe1,
+    0x48, 0xe8, 0x72, 0x2c, 0xc0, 0x47, 0xf6, 0x35, 0xcb, 0xbd, 0x7a, 0x23,
+    0x17, 0xde, 0xd1, 0x59, 0xfa, 0x18, 0xf5, 0xaa, 0x73, 0xf3, 0xd9, 0x1b,
+    0x78, 0x7e, 0xea, 0x7d, 0x66, 0xa8, 0x42, 0x67, 0xa4, 0x56, 0x2a, 0x8e,
+    0xd2, 0x44, 0xc5, 0x1f, 0x6c, 0x88, 0x38, 0x3a, 0x29, 0xdf, 0xa6, 0xb7,
+    0x4d, 0xee, 0x3e, 0x39, 0xda, 0x5b, 0x76, 0x49, 0xe0, 0x2a, 0xba, 0xf3,
+    0x82, 0xfe, 0x3a, 0x3f, 0xb3, 0xd0, 0xe2, 0x3f, 0x9f, 0xb7, 0x83, 0xb9,
+    0x70, 0x36, 0xe7, 0x30, 0xb3, 0x1c, 0x3d, 0x67, 0x3c, 0x65, 0xde, 0xa3,
+    0xe5, 0x83, 0x3e, 0xc0, 0xde, 0x2f, 0x5e, 0x68, 0x97, 0x30, 0xd8, 0x77,
+    0xaa, 0x63, 0x88, 0xde, 0x0a, 0x48, 0x85, 0x32, 0xba, 0x6c, 0xef, 0xd6,
+    0xfe, 0xa0, 0x65, 0xcd, 0x4b, 0xa6, 0xc0, 0x3a, 0xff, 0x01, 0x68, 0xdf,
+    0x4c, 0x2d, 0x90, 0xed, 0x18, 0xa4, 0xc7, 0x97, 0xbf, 0x97, 0xd4, 0xbf,
+    0x30, 0xb3, 0x6c, 0x60, 0xa4, 0x32, 0x95, 0x1b, 0x1b, 0x85, 0xd5, 0xfc,
+    0x50, 0xda, 0xfb, 0xed, 0x4b, 0xa7, 0x0b, 0x9d, 0x4b, 0x1d, 0xbb, 0xc8,
+    0x43, 0x53, 0x88, 0x94, 0x25, 0x6e, 0x27, 0x09, 0x35, 0x0e, 0x44, 0xbc,
+    0x49, 0x8e, 0xad, 0x98, 0xe3, 0xa2, 0x7e, 0xe0, 0xaa, 0xd5, 0x81, 0xd9,
+    0xa2, 0xb1, 0x44, 0x07, 0x62, 0xee, 0x60, 0xc4, 0x51, 0xfb, 0xab, 0x05,
+    0x7d, 0x4a, 0x3e, 0x89, 0x7d, 0xc5, 0x8a, 0x29, 0x47, 0xd8, 0x48, 0x0c,
+    0x0b, 0x29, 0xdd, 0xdc, 0x5f, 0x2d, 0x7f, 0xc5, 0xc9, 0x1e, 0xdd, 0x1b,
+    0xd4, 0x4e, 0xc7, 0xd1, 0x5d, 0x7d, 0x6e, 0xc3, 0x79, 0xa0, 0x0a, 0x4f,
+    0xc9, 0x48, 0xc6, 0xe8, 0x7d, 0x43, 0x23, 0xe4, 0x8b, 0xff, 0xd6, 0x1c,
+    0x74, 0xcb, 0x85, 0x3f, 0x79, 0x10, 0x86, 0x33, 0x5b, 0x65, 0x0c, 0x84,
+    0xbb, 0x2b, 0x61, 0x29, 0x4e, 0x1a, 0x10, 0x21, 0x02, 0xf1, 0xaa, 0x62,
+    0x3a, 0x4c, 0xc2, 0x5f, 0x89, 0x93, 0xa3, 0x73, 0x94, 0x3f, 0xf9, 0xc8,
+    0x6b, 0x24, 0xa7, 0x9c, 0xdd, 0x5c, 0xc0, 0x4a, 0xbd, 0x32, 0xc9, 0x99,
+    0x95, 0x66, 0x0b, 0x93, 0x7c, 0xed, 0xce, 0x05, 0xb5, 0x13, 0x67, 0xbb,
+    0xa9, 0xff, 0x17, 0x4d, 0x12, 0xdb, 0x75, 0x00, 0xa5, 0xce, 0xbe, 0x62,
+    0x98, 0x1b, 0xb6, 0x7a, 0x2f, 0x99, 0x2e, 0xdd, 0x39, 0x5b, 0xb0, 0x4a,
+    0xdb, 0xa1, 0x73, 0x69, 0x2c, 0x35, 0xd6, 0x30, 0xff, 0xe7, 0xeb, 0xa9,
+    0x67, 0xc3, 0x29, 0x84, 0x31, 0x59, 0xca, 0xb2, 0x97, 0x7e, 0x9e, 0x00,
+    0x43, 0xec, 0x0d, 0x0d, 0x8d, 0x97, 0x0c, 0x06, 0xc9, 0x78, 0x8f, 0x36,
+    0xe3, 0x73, 0x8f, 0x78, 0xbf, 0xfd, 0xfa, 0x15, 0x6a, 0x87, 0x1b, 0xf9,
+    0x10, 0xaf, 0x9a, 0xcb, 0xd5, 0x82, 0x5e, 0x4a, 0x9a, 0x63, 0x5f, 0x61,
+    0x46, 0x90, 0xf4, 0xd9, 0x42, 0xd4, 0x04, 0xd0, 0x5e, 0x30, 0x6e, 0x65,
+    0x62, 0x37, 0xac, 0x6d, 0x6e, 0x87, 0xfa, 0xa2, 0x71, 0x0c, 0x77, 0xb4,
+    0xad, 0xca, 0xe9, 0x75, 0x34, 0xd2, 0x33, 0xcd, 0x05, 0x5c, 0x47, 0x62,
+    0x9b, 0x95, 0xaf, 0x8d, 0x10, 0x84, 0x63, 0x15, 0xb8, 0xf6, 0xd6, 0x26,
+    0x2b, 0xd4, 0xe6, 0x09, 0xe9, 0xfa, 0x56, 0xdf, 0xf3, 0xf8, 0xeb, 0x14,
+    0x27, 0x9e, 0x34, 0xba, 0x00, 0x00, 0x01, 0x50, 0x01, 0x84, 0x0d, 0x02,
+    0x00, 0x06, 0xbd, 0xe1, 0x00, 0x04, 0x2f, 0x36, 0x00, 0x04, 0x52, 0x4f,
+    0x80, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0xd0, 0x19, 0x5f, 0x8c, 0x4d,
+    0x85, 0x82, 0x23, 0x46, 0x9d, 0xb4, 0x8c, 0x7f, 0x1f, 0x08, 0xb5, 0xa1,
+    0x52, 0xb6, 0x08, 0x16, 0x08, 0x43, 0xf4, 0x2c, 0xfe, 0x1d, 0x12, 0x42,
+    0xbe, 0x46, 0x29, 0x09, 0xfa, 0x92, 0x42, 0xdb, 0xd7, 0x9a, 0x90, 0xd0,
+    0xbe, 0xaf, 0xff, 0xe4, 0x0d, 0xe0, 0x51, 0x55, 0xbc, 0x73, 0xa3, 0xff,
+    0x3b, 0xd9, 0x20, 0x6b, 0xfd, 0x6b, 0x83, 0x9c, 0x56, 0x7d, 0x7a, 0x21,
+    0x31, 0x66, 0x5d, 0xcf, 0xa7, 0x74, 0x03, 0x8e, 0x1e, 0x38, 0x26, 0x89,
+    0xcf, 0x98, 0x2d, 0x10, 0x09, 0x0b, 0xca, 0x3f, 0xa1, 0x28, 0x97, 0xcb,
+    0x5f, 0x39, 0xe7, 0x4a, 0xcd, 0x74, 0xee, 0xcf, 0x6b, 0x47, 0x32, 0x21,
+    0x84, 0xed, 0x3b, 0x1c, 0x5a, 0x43, 0x97, 0x77, 0x1b, 0xf1, 0x70, 0xc5,
+    0xe5, 0x09, 0xc7, 0xd4, 0x11, 0x41, 0x31, 0xc2, 0xb7, 0xdf, 0x55, 0x54,
+    0x89, 0xfc, 0xb5, 0x0f, 0x82, 0xfb, 0xb1, 0x5b, 0x72, 0x60, 0x4c, 0xce,
+    0x5f, 0x66, 0x82, 0x8b, 0xa2, 0xf3, 0x46, 0xe9, 0xa0, 0xf9, 0x20, 0x00,
+    0xf8, 0x2f, 0x5e, 0x91, 0xbd, 0xae, 0xb1, 0xca, 0xc3, 0x01, 0xd0, 0xdd,
+    0x89, 0x49, 0x21, 0xda, 0xbc, 0xa0, 0xcf, 0xcb, 0xa8, 0x53, 0x72, 0xb6,
+    0x76, 0xbb, 0x5b, 0x04, 0xb8, 0x8d, 0xe1, 0x25, 0xa0, 0x00, 0xb8, 0x85,
+    0x5b, 0x66, 0xa5, 0x13, 0x29, 0x07, 0x78, 0xb7, 0x49, 0x9e, 0x95, 0xf8,
+    0xca, 0x9a, 0xbd, 0xfc, 0xfc, 0xe8, 0xb5, 0x4c, 0xec, 0x7e, 0xb2, 0x5c,
+    0x37, 0x95, 0x93, 0xa9, 0x5d, 0xbc, 0x80, 0x76, 0x45, 0x4d, 0x2e, 0x3a,
+    0x4a, 0x10, 0x8b, 0x94, 0x18, 0x40, 0x6a, 0x4f, 0xf8, 0xab, 0xe2, 0x07,
+    0x9b, 0x31, 0xde, 0xb3, 0x0d, 0x23, 0xdc, 0xa2, 0xb1, 0x85, 0xfe, 0x13,
+    0xf4, 0x1e, 0xb3, 0x3a, 0x63, 0x80, 0x5e, 0x32, 0xb4, 0xed, 0xf8, 0x58,
+    0x16, 0x4e, 0xe4, 0x44, 0x07, 0x06, 0xdd, 0xfc, 0xc4, 0xe2, 0x53, 0x39,
+    0xcc, 0xa6, 0x4f, 0x0e, 0x44, 0x67, 0xbe, 0xad, 0xff, 0x3a, 0x6f, 0x45,
+    0xc0, 0x10, 0xb3, 0x19, 0x13, 0x48, 0x28, 0x82, 0xa5, 0x86, 0xe2, 0xf0,
+    0xaf, 0xc7, 0xae, 0xcc, 0x7c, 0x92, 0x05, 0xca, 0xd0, 0x3c, 0x83, 0x82,
+    0xb5, 0x31, 0x14, 0x1a, 0x93, 0xc3, 0xae, 0x27, 0x9e, 0xf5, 0x2b, 0xb8,
+    0x6c, 0x04, 0x73, 0xca, 0x1b, 0xa7, 0x0b, 0x9e, 0xab, 0xee, 0x53, 0x7d,
+    0x45, 0x02, 0x4b, 0xa4, 0x05, 0xdf, 0xaa, 0xc9, 0x0d, 0x1c, 0x66, 0x1a,
+    0x05, 0xf1, 0x9e, 0xbc, 0x7f, 0x39, 0x5e, 0x1b, 0xef, 0x00, 0x0e, 0xb8,
+    0x5a, 0x22, 0xbb, 0xb0, 0xf0, 0xfe, 0xd3, 0x78, 0xcd, 0x40, 0xc0, 0xb8,
+    0x7c, 0x96, 0x8d, 0xc5, 0x1d, 0x4f, 0x47, 0xfe, 0x78, 0x94, 0x9d, 0x09,
+    0x91, 0x39, 0x5b, 0x78, 0x31, 0x62, 0xfd, 0xfc, 0xaa, 0xb4, 0xfd, 0x49,
+    0x21, 0x1f, 0x56, 0xb0, 0xc4, 0x61, 0xe3, 0xed, 0xc5, 0x28, 0xd9, 0x6d,
+    0x2c, 0xb3, 0xab, 0x42, 0x04, 0x48, 0xe8, 0x00, 0x2c, 0x21, 0xa4, 0xb7,
+    0x1c, 0x03, 0xb4, 0x7b, 0xd3, 0x84, 0xa4, 0xbc, 0xad, 0x89, 0x8a, 0x2d,
+    0xf3, 0xe7, 0x29, 0xb6, 0x46, 0x1e, 0xed, 0xc6, 0xa9, 0xda, 0x55, 0x42,
+    0x53, 0x55, 0xef, 0x5c, 0xd5, 0xdf, 0x16, 0xfe, 0x49, 0x7f, 0x13, 0xcd,
+    0xfa, 0x60, 0x82, 0x19, 0x16, 0x9d, 0xf9, 0xda, 0x97, 0x50, 0x1d, 0x03,
+    0xa8, 0xc8, 0xb0, 0x35, 0xdc, 0xaa, 0x34, 0xe8, 0x36, 0xbf, 0x71, 0x45,
+    0xf3, 0x45, 0x3d, 0x24, 0x67, 0xed, 0x42, 0x42, 0x09, 0xe9, 0xeb, 0x3b,
+    0xc7, 0xea, 0xb8, 0x44, 0xed, 0x78, 0xf0, 0x71, 0x7d, 0xae, 0x3d, 0xa4,
+    0xf3, 0xaf, 0x94, 0x41, 0x50, 0x6f, 0x1f, 0xcc, 0x89, 0xa9, 0x58, 0xb7,
+    0x22, 0x33, 0xc8, 0x91, 0x95, 0xe8, 0xd7, 0x52, 0xa1, 0x16, 0x3c, 0xd9,
+    0xeb, 0xaf, 0xed, 0xcb, 0x13, 0xb0, 0xa1, 0xf5, 0x5d, 0x99, 0x81, 0xd7,
+    0x54, 0xd0, 0xb1, 0x5e, 0xfb, 0xbf, 0x41, 0xff, 0x2a, 0x69, 0xea, 0x9e,
+    0x52, 0xfb, 0xd3, 0x8c, 0xef, 0x77, 0x88, 0x2e, 0x71, 0x78, 0xbc, 0x7f,
+    0x81, 0xd6, 0xae, 0xdc, 0xdf, 0x50, 0x50, 0x1a, 0xc5, 0x8c, 0x69, 0x0a,
+    0xfe, 0xcd, 0xa9, 0xe8, 0x44, 0xf3, 0xbb, 0x87, 0x4a, 0xa0, 0x14, 0x45,
+    0xb3, 0xb3, 0x69, 0xf4, 0xfa, 0x4c, 0xbd, 0x59, 0x31, 0xbf, 0xf1, 0x42,
+    0x19, 0x7c, 0xa7, 0x85, 0x43, 0x55, 0x0f, 0xfb, 0x25, 0x1d, 0xca, 0xe2,
+    0x8e, 0xeb, 0xd9, 0xea, 0x73, 0xaf, 0x4e, 0x17, 0x14, 0x67, 0x85, 0x4d,
+    0x59, 0xf4, 0xaf, 0x04, 0x39, 0xcf, 0x1e, 0xf9, 0x39, 0xa4, 0x4a, 0x7b,
+    0x00, 0x64, 0x4b, 0x74, 0x75, 0x59, 0x9b, 0xae, 0x58, 0x83, 0x18, 0xbf,
+    0x59, 0x08, 0x15, 0xf8, 0x5e, 0x2c, 0x46, 0xdb, 0xa6, 0x77, 0x51, 0x52,
+    0xeb, 0x00, 0x28, 0xf9, 0xd0, 0x26, 0x8a, 0x49, 0x57, 0x84, 0xa1, 0x03,
+    0xe1, 0x41, 0xb2, 0xad, 0x21, 0x10, 0x25, 0xb0, 0x0a, 0x29, 0x26, 0xa8,
+    0xfa, 0x52, 0x11, 0x5f, 0xc6, 0xee, 0x04, 0xfb, 0x38, 0xc9, 0xbb, 0x6e,
+    0xcd, 0x39, 0x1b, 0xf7, 0x3e, 0xd5, 0x44, 0xdf, 0x6f, 0xfd, 0xf1, 0xe6,
+    0x46, 0x7d, 0x54, 0x4e, 0x17, 0xfd, 0xb1, 0x58, 0x39, 0xf7, 0x7f, 0xcd,
+    0x74, 0x46, 0x0f, 0x8d, 0x16, 0x51, 0x53, 0x80, 0xcc, 0x7e, 0x95, 0x0c,
+    0x92, 0x83, 0xb4, 0x78, 0xf7, 0xd3, 0xa5, 0xf4, 0xdf, 0x8a, 0x2e, 0x7f,
+    0xa4, 0xc2, 0xd2, 0xd7, 0xd7, 0x1f, 0x4c, 0xc0, 0xa9, 0xde, 0xbb, 0xb4,
+    0x91, 0xd0, 0x19, 0xde, 0x41, 0xd8, 0xbf, 0xab, 0x13, 0xed, 0x3f, 0x70,
+    0xd1, 0x0d, 0x34, 0x7e, 0xd1, 0x21, 0xe8, 0xe6, 0x0c, 0x97, 0x07, 0x2e,
+    0x2a, 0xd0, 0x81, 0xc7, 0x41, 0xe3, 0xe6, 0x40, 0xa8, 0x59, 0xc7, 0x2f,
+    0xdb, 0xe0, 0x3c, 0xe5, 0xe2, 0xfa, 0x88, 0x49, 0xe2, 0xf2, 0x3e, 0x02,
+    0x69, 0x8c, 0x5f, 0xda, 0x91, 0x0b, 0xf2, 0xad, 0x89, 0x02, 0x64, 0xde,
+    0x38, 0x1c, 0x11, 0xdd, 0x36, 0x33, 0x83, 0x49, 0x4f, 0x64, 0xb7, 0xe6,
+    0xa7, 0xbe, 0x9a, 0xad, 0xf0, 0x5f, 0xef, 0xc5, 0x32, 0x89, 0x13, 0x5a,
+    0xdf, 0x27, 0x1d, 0x78, 0x32, 0xf9, 0x9b, 0x0f, 0x3c, 0x5e, 0xd7, 0x89,
+    0x74, 0x2c, 0x43, 0x9f, 0x62, 0xff, 0x59, 0x5b, 0xe4, 0xc0, 0x56, 0x33,
+    0x50, 0x4e, 0x7b, 0xa9, 0xe7, 0xa7, 0xec, 0xb4, 0xf6, 0x4f, 0x1f, 0xb3,
+    0x05, 0x1f, 0x28, 0x08, 0xfb, 0x4d, 0x32, 0x0d, 0xdc, 0xeb, 0x69, 0xdd,
+    0xf1, 0x49, 0x7c, 0x55, 0x86, 0x16, 0xe3, 0xb8, 0x24, 0xe0, 0x29, 0xf4,
+    0xee, 0x29, 0x01, 0x7e, 0x72, 0x55, 0x6e, 0xc9, 0xf2, 0xd9, 0xdc, 0x4e,
+    0x79, 0x6b, 0x0f, 0x3a, 0x52, 0x3d, 0x8c, 0xcd, 0x72, 0xb9, 0x2d, 0xd1,
+    0x00, 0x3d, 0x84, 0x21, 0xa0, 0x14, 0xd0, 0x7f, 0x41, 0xa4, 0x06, 0x74,
+    0x7c, 0xc8, 0xd9, 0x68, 0x2c, 0x70, 0x40, 0x45, 0x1b, 0xf0, 0x06, 0xd9,
+    0x16, 0x58, 0x72, 0x2f, 0x37, 0x02, 0x87, 0x78, 0x02, 0x6c, 0xbe, 0x35,
+    0xc8, 0xab, 0xa3, 0x6d, 0x13, 0x67, 0x74, 0xd4, 0x71, 0x84, 0xa2, 0xf2,
+    0xab, 0x13, 0x19, 0xf4, 0x65, 0x73, 0xa8, 0x4e, 0x4f, 0x1a, 0x4f, 0xd5,
+    0x5e, 0xa6, 0xd6, 0xe5, 0xed, 0x38, 0x09, 0xa7, 0xe0, 0x41, 0xfb, 0x23,
+    0x8a, 0x1f, 0x4b, 0x4d, 0x2b, 0x3f, 0x31, 0x08, 0x51, 0xb1, 0x1e, 0x6b,
+    0xae, 0x01, 0x3c, 0x53, 0x01, 0x86, 0x06, 0x79, 0xdd, 0x87, 0xdc, 0xbd,
+    0x3f, 0x20, 0xdc, 0xa5, 0x43, 0x82, 0xd6, 0xcf, 0x19, 0xd8, 0x9d, 0x92,
+    0x76, 0xe1, 0x34, 0x3f, 0x8c, 0xb3, 0xe4, 0xe3, 0x11, 0x64, 0x4b, 0xfe,
+    0x5b, 0xc4, 0x0f, 0x0f, 0x70, 0x77, 0x88, 0xbf, 0x42, 0xce, 0xff, 0x55,
+    0x5d, 0x45, 0x79, 0x56, 0xb4, 0xab, 0x68, 0x5c, 0xf4, 0xfd, 0x1c, 0x79,
+    0x51, 0x73, 0x0d, 0xb7, 0xd4, 0x70, 0x29, 0x2d, 0x36, 0x36, 0xa6, 0x35,
+    0xe3, 0x1e, 0xe1, 0xf7, 0x81, 0xfa, 0x78, 0xf8, 0xe0, 0x2a, 0xe3, 0x6b,
+    0xf7, 0xad, 0xee, 0x07, 0x40, 0xf2, 0xa6, 0xc2, 0x9c, 0x45, 0xd1, 0x60,
+    0x9f, 0x9c, 0xae, 0xd3, 0x21, 0x4e, 0xe3, 0x87, 0xf0, 0x3d, 0xb5, 0x97,
+    0x69, 0x83, 0x8d, 0x29, 0x92, 0xe1, 0x2e, 0xf0, 0xb2, 0x5c, 0x73, 0x5c,
+    0x62, 0x9a, 0x0a, 0x3c, 0x5c, 0x07, 0x37, 0x47, 0x03, 0xd0, 0x8d, 0xfb,
+    0x56, 0xf9, 0x57, 0x69, 0x6a, 0x3f, 0x94, 0x4a, 0x88, 0x91, 0xa7, 0x18,
+    0xfa, 0x63, 0x60, 0x63, 0x1a, 0x17, 0xc2, 0x5a, 0xa0, 0xa9, 0xa2, 0xab,
+    0xc7, 0xe1, 0x66, 0x0b, 0x99, 0x89, 0x54, 0xd9, 0x51, 0x78, 0x24, 0x67,
+    0xa3, 0x89, 0xf0, 0x55, 0x50, 0x7a, 0xf9, 0x48, 0x70, 0xf9, 0xf8, 0xb6,
+    0x16, 0x97, 0x1f, 0x69, 0x18, 0x46, 0x52, 0xc4, 0x34, 0xcc, 0x16, 0x16,
+    0x09, 0x99, 0x89, 0x86, 0xcc, 0x23, 0xd7, 0x57, 0x18, 0x73, 0x96, 0xf6,
+    0x5e, 0x78, 0xad, 0x7c, 0x2f, 0x2f, 0x65, 0xd1, 0xda, 0x61, 0xb3, 0xba,
+    0xfb, 0xbb, 0x0b, 0xd3, 0xd1, 0x52, 0xd5, 0xa6, 0xde, 0xb2, 0x1b, 0x0b,
+    0x69, 0xbe, 0x00, 0x72, 0xfc, 0xc6, 0x74, 0x4e, 0x0d, 0xce, 0x13, 0x94,
+    0xda, 0x3f, 0x69, 0x9b, 0x78, 0xb7, 0x2c, 0x84, 0xe8, 0x13, 0xbc, 0xe6,
+    0x00, 0x28, 0x84, 0xf0, 0x5e, 0xd7, 0x51, 0xc1, 0x1f, 0x25, 0x6f, 0x6c,
+    0x12, 0x0d, 0x24, 0xde, 0xf0, 0xcf, 0xb3, 0x61, 0x5a, 0xc8, 0x4e, 0x6d,
+    0xf0, 0x92, 0xfc, 0x08, 0x4c, 0xd5, 0x05, 0x66, 0x61, 0xdf, 0xd3, 0x67,
+    0xcc, 0xe7, 0x5e, 0xb2, 0x98, 0xa1, 0x44, 0x39, 0x7b, 0x65, 0x0e, 0x83,
+    0x29, 0xb7, 0x36, 0x2a, 0xaf, 0x97, 0xa9, 0x7d, 0xa3, 0xae, 0x36, 0xd9,
+    0xb5, 0xdb, 0x9a, 0x68, 0x48, 0xfe, 0x01, 0x7b, 0x4e, 0x34, 0xdc, 0x8f,
+    0x5f, 0xc1, 0x59, 0x44, 0x31, 0x59, 0x80, 0x0c, 0x35, 0x16, 0xf7, 0x3f,
+    0x5d, 0xe1, 0x08, 0xff, 0x1c, 0x1e, 0x08, 0x52, 0x43, 0xe7, 0x10, 0xd7,
+    0x37, 0x21, 0x0d, 0x7f, 0x76, 0x3c, 0x23, 0x55, 0x81, 0x57, 0xe0, 0xb2,
+    0xb8, 0x77, 0x98, 0x23, 0xa6, 0x6e, 0x4e, 0x70, 0x97, 0x55, 0xed, 0xae,
+    0xfa, 0xde, 0xf5, 0x05, 0x7f, 0x6a, 0xb7, 0x79, 0x2a, 0xd1, 0x3c, 0xc4,
+    0x0b, 0x77, 0xa7, 0xfb, 0x12, 0xc1, 0x87, 0x3a, 0xd5, 0x0b, 0xec, 0xfe,
+    0xc1, 0xaa, 0x8a, 0x5f, 0xf0, 0xde, 0xfc, 0xe5, 0xd3, 0x27, 0x68, 0x00,
+    0x3b, 0x95, 0x4b, 0x7b, 0x37, 0x2c, 0xd8, 0x93, 0x7f, 0x9f, 0xff, 0x22,
+    0x9d, 0xf6, 0x29, 0xac, 0xa6, 0xd0, 0x8f, 0xe0, 0x91, 0x77, 0xf8, 0xda,
+    0x8c, 0xee, 0x62, 0xec, 0xcd, 0xcd, 0x2f, 0xa8, 0xa0, 0xb8, 0x80, 0x90,
+    0x08, 0x69, 0xe6, 0x5a, 0x30, 0x64, 0x0c, 0xd2, 0x57, 0x06, 0x26, 0xd9,
+    0x98, 0x91, 0x05, 0xff, 0x4a, 0xdc, 0x65, 0x75, 0x9a, 0xfc, 0xb7, 0xd9,
+    0x5a, 0x2f, 0xbd, 0x1d, 0x26, 0xc0, 0x33, 0xc4, 0xc3, 0x4c, 0x9e, 0x84,
+    0xf9, 0x56, 0xee, 0xd8, 0x71, 0x39, 0x84, 0xe6, 0xbe, 0xe7, 0x41, 0x3a,
+    0x02, 0x55, 0x73, 0x8d, 0x03, 0xb1, 0x6f, 0xac, 0x76, 0x6f, 0xee, 0x4c,
+    0xab, 0x26, 0x34, 0x30, 0xc7, 0xa2, 0xcc, 0x23, 0xb2, 0xe7, 0x9e, 0x77,
+    0x4d, 0x44, 0x39, 0x67, 0xcd, 0xfd, 0x31, 0x20, 0x28, 0x30, 0x53, 0x12,
+    0x96, 0xea, 0xf4, 0x87, 0xb8, 0x84, 0x12, 0xbe, 0x87, 0xd4, 0x7a, 0x23,
+    0xb2, 0xd3, 0x01, 0x4b, 0x23, 0x1c, 0x12, 0xd6, 0x25, 0x64, 0x8c, 0x18,
+    0xe4, 0x20, 0x48, 0x37, 0x95, 0x38, 0x14, 0xc1, 0xef, 0xc6, 0x9b, 0x29,
+    0xb7, 0x5c, 0x59, 0xde, 0x5e, 0x8e, 0xf0, 0xcd, 0xce, 0xbe, 0xf8, 0x2e,
+    0xf2, 0x51, 0x47, 0xb4, 0x53, 0x77, 0xa0, 0x47, 0x0d, 0x3b, 0x70, 0xc5,
+    0xee, 0xc1, 0xbe, 0x22, 0x61, 0x06, 0x0a, 0x6d, 0x7a, 0x30, 0xdb, 0x0b,
+    0x54, 0x70, 0xd8, 0x4e, 0xf0, 0x09, 0x9f, 0x59, 0x8c, 0x02, 0x6d, 0x3d,
+    0x4d, 0x9e, 0x91, 0x2d, 0x18, 0x8b, 0x0f, 0xb2, 0xb9, 0x59, 0xed, 0x04,
+    0x0c, 0xa7, 0xc2, 0xfe, 0x95, 0xd8, 0x17, 0xdb, 0x3b, 0xef, 0x5d, 0x81,
+    0x98, 0x8f, 0x61, 0x6f, 0xf5, 0xc6, 0x40, 0x05, 0x1c, 0x09, 0xa6, 0x2e,
+    0x7a, 0x8a, 0x8c, 0x9b, 0x15, 0x43, 0xad, 0x7f, 0x47, 0x9b, 0x56, 0xc5,
+    0xb0, 0x41, 0xdb, 0x8d, 0x37, 0x7d, 0xbe, 0x0b, 0x4d, 0x4c, 0xa9, 0x35,
+    0xa8, 0x04, 0xae, 0x26, 0x6c, 0xed, 0xcf, 0x8c, 0x17, 0xd3, 0xef, 0xc7,
+    0xec, 0x97, 0xa5, 0x19, 0x4c, 0xcf, 0xe6, 0xdb, 0x29, 0x99, 0x52, 0x50,
+    0x37, 0xae, 0x11, 0x8a, 0x58, 0x04, 0xd1, 0xcd, 0xb2, 0x93, 0x6b, 0xe1,
+    0x81, 0x29, 0xc1, 0xec, 0xb5, 0x83, 0x90, 0xb8, 0x15, 0x9f, 0x86, 0x1f,
+    0x4f, 0xf9, 0xb8, 0x69, 0x61, 0xdf, 0xe9, 0xb5, 0x61, 0xe6, 0xdb, 0xc0,
+    0xc2, 0x73, 0x81, 0xb0, 0x5d, 0x3e, 0x6f, 0x4b, 0x1e, 0xfd, 0xc3, 0x59,
+    0x06, 0xff, 0x12, 0x8b, 0x20, 0xb4, 0x6b, 0x14, 0xc8, 0x30, 0x52, 0x26,
+    0xf4, 0x2b, 0x80, 0x02, 0xa8, 0xe2, 0x55, 0x52, 0x90, 0xa3, 0xba, 0x02,
+    0x80, 0x60, 0x9a, 0x06, 0x2f, 0xed, 0xbe, 0x9d, 0xa5, 0x3c, 0xbc, 0x14,
+    0xde, 0x91, 0x88, 0x40, 0x97, 0x70, 0x1e, 0xa9, 0x7f, 0x8c, 0x88, 0xc4,
+    0x17, 0xe1, 0x46, 0x72, 0xe8, 0x3a, 0x40, 0x1f, 0x70, 0x4c, 0x2a, 0x78,
+    0xa9, 0x78, 0xae, 0xc5, 0x42, 0x77, 0x6c, 0x2d, 0xd5, 0xab, 0x0d, 0xa7,
+    0x47, 0xac, 0xf0, 0x00, 0x00, 0x01, 0x50, 0x01, 0x84, 0x0d, 0x02, 0x00,
+    0x07, 0x44, 0xde, 0x00, 0x03, 0xfa, 0xa7, 0x00, 0x04, 0x29, 0x9f, 0x80,
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0xe0, 0x44, 0x97, 0xe1, 0xa4, 0xfd,
+    0xed, 0x40, 0xb4, 0x57, 0x26, 0x3e, 0xe4, 0x87, 0x5d, 0xd6, 0x87, 0x95,
+    0xd0, 0x4a, 0xa6, 0x2d, 0xb8, 0x27, 0x61, 0x6c, 0x28, 0xeb, 0x22, 0x32,
+    0x0c, 0xde, 0xec, 0xa7, 0xe3, 0x85, 0x83, 0xf1, 0x0b, 0x5a, 0xfc, 0xa8,
+    0x11, 0xbc, 0x35, 0xa4, 0xb3, 0xde, 0xeb, 0x2e, 0xfd, 0x15, 0xe2, 0xdc,
+    0xfe, 0x5e, 0x78, 0xaf, 0xd9, 0x90, 0x47, 0x66, 0x5c, 0x69, 0x1a, 0x6b,
+    0x7c, 0x3c, 0x37, 0x07, 0x1a, 0x9f, 0xe4, 0x87, 0xe6, 0x39, 0x51, 0x15,
+    0xa4, 0xfb, 0xb9, 0x22, 0x5a, 0x9d, 0x46, 0x68, 0x03, 0x63, 0xca, 0x19,
+    0x83, 0xed, 0xbc, 0xa8, 0xf0, 0x5b, 0x1a, 0x79, 0xea, 0xcc, 0x6b, 0x97,
+    0xf4, 0xec, 0x26, 0x96, 0x04, 0xfa, 0x0c, 0x50, 0xaf, 0x93, 0xb2, 0xc8,
+    0x17, 0xf8, 0xcc, 0x83, 0x99, 0xc8, 0x87, 0x6e, 0xbb, 0xb7, 0x14, 0xc4,
+    0x51, 0xe0, 0xd0, 0x59, 0x3f, 0xe8, 0x7b, 0x3c, 0x9f, 0x54, 0xcb, 0xf8,
+    0x46, 0xe0, 0x1a, 0x07, 0xd6, 0x4d, 0xbc, 0x63, 0x3d, 0xef, 0x2a, 0xb7,
+    0xd7, 0xc6, 0xb1, 0x84, 0x15, 0x54, 0xd3, 0xf4, 0x5b, 0x6d, 0x8c, 0xd9,
+    0x04, 0xe4, 0xe2, 0xe9, 0x28, 0x84, 0x41, 0x87, 0x5b, 0xf5, 0x27, 0xc5,
+    0x88, 0x0e, 0xc6, 0x7c, 0x9e, 0x73, 0x58, 0x7d, 0x95, 0x32, 0xfd, 0x05,
+    0xbd, 0x24, 0x09, 0x39, 0x05, 0x18, 0x42, 0xfc, 0xac, 0x1a, 0x27, 0x05,
+    0xb7, 0x5d, 0xc4, 0x54, 0xcc, 0x78, 0xff, 0xfd, 0x37, 0x82, 0xc4, 0x9f,
+    0x4c, 0xbb, 0xa3, 0x21, 0xac, 0x4e, 0x39, 0xa7, 0xa3, 0xba, 0x29, 0xb4,
+    0x3e, 0x7b, 0xe9, 0xbd, 0xa1, 0x82, 0x57, 0x7e, 0x21, 0xbf, 0x0b, 0xe3,
+    0x91, 0xd0, 0xb7, 0x10, 0x0c, 0xcf, 0xdd, 0xae, 0xd8, 0x80, 0xab, 0x47,
+    0x5b, 0xc1, 0x88, 0xe5, 0x33, 0x4d, 0xbd, 0x2b, 0xed, 0x0c, 0x55, 0xa3,
+    0xea, 0x92, 0x1a, 0x68, 0xee, 0x1c, 0x9c, 0x24, 0x19, 0x73, 0xa8, 0x16,
+    0xae, 0x81, 0x2d, 0x56, 0xfc, 0x42, 0x4c, 0x29, 0x1c, 0x09, 0x0c, 0xe0,
+    0x84, 0xca, 0x7f, 0xb8, 0x91, 0xba, 0x3e, 0xdb, 0x08, 0x1f, 0x69, 0x8d,
+    0xad, 0xa8, 0x19, 0x10, 0x5b, 0x38, 0xb9, 0x60, 0x8a, 0x7d, 0x11, 0xe3,
+    0x7a, 0xe0, 0xed, 0xbf, 0xdb, 0x82, 0x1e, 0x96, 0x2a, 0x04, 0xe1, 0xa8,
+    0x53, 0xe8, 0xba, 0x11, 0x67, 0xb8, 0x01, 0xaf, 0x84, 0x03, 0x49, 0x5f,
+    0xc4, 0x18, 0x9f, 0x5d, 0x5d, 0x53, 0x98, 0xcd, 0x8c, 0x26, 0x71, 0x45,
+    0xfa, 0x0a, 0x94, 0x7d, 0xd3, 0xc9, 0x8f, 0xe6, 0x99, 0x32, 0x37, 0xf0,
+    0x43, 0xd7, 0xc1, 0x86, 0x76, 0x9d, 0x08, 0xd1, 0xc5, 0x04, 0x89, 0xea,
+    0xcc, 0x2d, 0x83, 0x87, 0x2b, 0x26, 0x91, 0xa5, 0xcb, 0xf7, 0xd3, 0xc4,
+    0xe6, 0x03, 0x73, 0x4c, 0xfd, 0xa3, 0xc7, 0xf7, 0x50, 0xcc, 0x80, 0xf1,
+    0xd4, 0x9a, 0xa4, 0xd8, 0x66, 0xf4, 0x2d, 0xdb, 0xd9, 0x87, 0xa0, 0x62,
+    0x5b, 0x1b, 0xc0, 0xb3, 0xcb, 0xb2, 0x22, 0x60, 0x9f, 0x6b, 0xc2, 0x05,
+    0xb0, 0x1a, 0x18, 0x58, 0x33, 0xad, 0xdc, 0x72, 0xb8, 0x95, 0x04, 0x6d,
+    0xb4, 0xf6, 0x5a, 0x0f, 0xc7, 0xd6, 0xd2, 0xdb, 0x90, 0xd2, 0x37, 0x45,
+    0x52, 0xba, 0x61, 0xd3, 0xc0, 0xea, 0xd5, 0x48, 0xbb, 0x35, 0x53, 0xa9,
+    0x56, 0x36, 0x0e, 0x77, 0x83, 0x9a, 0x49, 0x4b, 0x64, 0xb1, 0x6f, 0xc8,
+    0x85, 0x0b, 0xcb, 0xbd, 0x02, 0x3e, 0x72, 0x41, 0x01, 0x3b, 0x2e, 0x00,
+    0x70, 0x9e, 0x93, 0x1c, 0x9f, 0x43, 0x30, 0xae, 0xfc, 0x1c, 0xaa, 0x74,
+    0x70, 0x06, 0x39, 0xac, 0x17, 0x10, 0x8d, 0xb0, 0x8f, 0x94, 0x37, 0xff,
+    0xa0, 0x6c, 0xc2, 0x4e, 0xb5, 0x3f, 0x7e, 0x7d, 0xc4, 0x29, 0x4f, 0xed,
+    0x18, 0x29, 0x08, 0xf0, 0xfc, 0x46, 0x0a, 0xa4, 0x86, 0xd9, 0x6f, 0x73,
+    0x3f, 0xda, 0xbf, 0xb4, 0x2c, 0x58, 0x5c, 0x06, 0x05, 0x7b, 0x16, 0x96,
+    0xdf, 0x46, 0x63, 0x11, 0xe4, 0xde, 0xeb, 0x2d, 0x3d, 0x47, 0x27, 0xff,
+    0xe5, 0x22, 0x6a, 0xb1, 0xfa, 0x4a, 0x64, 0x5f, 0x06, 0xa4, 0xce, 0x24,
+    0x2e, 0xa6, 0x74, 0xb6, 0x0c, 0x20, 0xcd, 0xee, 0x84, 0x55, 0xbd, 0x3e,
+    0x02, 0xd9, 0xcd, 0xba, 0x69, 0xf5, 0xb6, 0x96, 0x76, 0x6a, 0x41, 0x0a,
+    0x30, 0x83, 0x2f, 0x77, 0x0c, 0xef, 0x90, 0x3f, 0x4d, 0x52, 0x71, 0xf0,
+    0xba, 0x1d, 0x5a, 0xbe, 0xef, 0xdf, 0xf7, 0xda, 0x9b, 0xb2, 0xb5, 0x28,
+    0xe9, 0xf3, 0xf1, 0x9d, 0xbf, 0x81, 0xae, 0x08, 0x6c, 0x96, 0xa9, 0x8e,
+    0x84, 0x42, 0xdd, 0x5a, 0x93, 0x9a, 0xd9, 0xd8, 0x44, 0xce, 0xd0, 0xa2,
+    0xa6, 0x80, 0xfd, 0xf8, 0x29, 0x79, 0x0b, 0x52, 0x9b, 0xf7, 0x7c, 0xaa,
+    0x2f, 0x08, 0xe2, 0x45, 0x4f, 0x2d, 0x57, 0xa0, 0x5b, 0x1f, 0x6b, 0x86,
+    0x2e, 0xae, 0x9a, 0xae, 0xf6, 0x2c, 0x01, 0x14, 0xbb, 0x61, 0x74, 0xcf,
+    0x75, 0xa1, 0x3c, 0xe7, 0xb9, 0x64, 0xf9, 0x46, 0x7a, 0x51, 0xb2, 0xb4,
+    0x9b, 0x23, 0x2a, 0x53, 0x3b, 0x5d, 0xbd, 0x35, 0x27, 0x70, 0xc9, 0x57,
+    0x4c, 0xa3, 0xe2, 0x87, 0x30, 0xde, 0xc0, 0x2d, 0xfa, 0x5d, 0x17, 0x6a,
+    0xe2, 0xf7, 0x41, 0xfe, 0x8e, 0x65, 0x69, 0xe8, 0x1b, 0x66, 0xbf, 0xb4,
+    0x00, 0x29, 0x01, 0x66, 0x65, 0x03, 0x51, 0x5f, 0xed, 0x67, 0xdd, 0x65,
+    0x8a, 0x93, 0x0e, 0x93, 0xa7, 0x1e, 0xa3, 0x69, 0x3c, 0xc0, 0xeb, 0xe3,
+    0x03, 0x1e, 0xc7, 0xf4, 0xdf, 0x00, 0x68, 0x1f, 0x40, 0x94, 0x70, 0x32,
+    0x23, 0x7d, 0xd7, 0xad, 0x97, 0xc0, 0xf8, 0xa7, 0x53, 0x7a, 0x65, 0xbc,
+    0x45, 0xfd, 0xf6, 0x99, 0x39, 0x33, 0x11, 0x03, 0x16, 0xb1, 0xf3, 0xad,
+    0x68, 0x59, 0xd4, 0xb7, 0xbc, 0x38, 0x31, 0xc5, 0x88, 0xc1, 0xd2, 0x2f,
+    0xff, 0x33, 0x7e, 0x10, 0x30, 0x23, 0x69, 0x02, 0x08, 0x4d, 0x28, 0x0f,
+    0xc7, 0x80, 0xf2, 0xf0, 0x61, 0xd2, 0x9b, 0x08, 0x11, 0x1e, 0xc3, 0xa4,
+    0x4b, 0x42, 0x00, 0x38, 0xe2, 0xcd, 0xc0, 0xfa, 0xac, 0xdc, 0x3a, 0x3e,
+    0x65, 0xf3, 0x4a, 0xa3, 0xea, 0x91, 0x78, 0xd8, 0xe0, 0x56, 0x3b, 0xbe,
+    0xdf, 0x91, 0xa2, 0x7f, 0x9b, 0x96, 0x35, 0x29, 0x72, 0x75, 0x41, 0x54,
+    0x7c, 0x72, 0x00, 0xd2, 0x7c, 0xe7, 0xe4, 0x45, 0x3e, 0x68, 0x61, 0xb2,
+    0x44, 0xb2, 0x8a, 0xaf, 0xd9, 0x02, 0x01, 0x3f, 0x87, 0xdc, 0x93, 0x04,
+    0x8d, 0x38, 0x98, 0xf2, 0xdc, 0x61, 0xc2, 0xd4, 0x77, 0xb1, 0xee, 0xa2,
+    0x18, 0x92, 0x53, 0xf8, 0x72, 0x91, 0x88, 0x74, 0x83, 0xa1, 0xf8, 0x49,
+    0x09, 0x61, 0xf9, 0xa2, 0x4c, 0xc6, 0x9c, 0xc1, 0xb3, 0x6e, 0x2c, 0xf8,
+    0x98, 0xb0, 0x0c, 0xcd, 0xf0, 0xdf, 0x3e, 0xa4, 0x25, 0x5d, 0xf4, 0xbd,
+    0xb4, 0xe5, 0xa9, 0xb6, 0x4c, 0x1c, 0x26, 0x2b, 0x8f, 0xb3, 0xfd, 0x5e,
+    0x63, 0x7e, 0x8f, 0x23, 0xce, 0xeb, 0x7e, 0x07, 0x97, 0x7e, 0xa2, 0xa6,
+    0xa7, 0xd7, 0x94, 0x50, 0xed, 0xd9, 0x88, 0x9c, 0x9e, 0xb2, 0xee, 0xbc,
+    0x66, 0xbf, 0x40, 0x8a, 0xee, 0x1d, 0xd0, 0x57, 0x15, 0x4c, 0x92, 0x93,
+    0xc2, 0x3c, 0x52, 0x8b, 0xf3, 0xbd, 0x55, 0xc1, 0xf1, 0x91, 0xb2, 0x3c,
+    0x65, 0x08, 0x6b, 0x32, 0x7b, 0xa7, 0x90, 0xc3, 0x4f, 0xe6, 0xf9, 0x12,
+    0x37, 0xda, 0xc5, 0xdb, 0xd5, 0x45, 0x97, 0x01, 0xa6, 0xd3, 0x76, 0x3d,
+    0x1d, 0x06, 0x96, 0xd6, 0xfd, 0xd0, 0x7d, 0x47, 0x1b, 0xc6, 0x95, 0xa6,
+    0x64, 0x4c, 0x86, 0x78, 0x5a, 0xde, 0xb8, 0xbd, 0xb7, 0x22, 0x76, 0xb0,
+    0x04, 0x22, 0xdc, 0x72, 0xe0, 0x4a, 0x6b, 0x6a, 0x47, 0xeb, 0x26, 0xec,
+    0x34, 0x3c, 0x7e, 0xe2, 0x5f, 0x6a, 0xb2, 0xf0, 0x8b, 0xc4, 0x48, 0x99,
+    0xfc, 0x12, 0x62, 0xb1, 0xea, 0xe5, 0x5b, 0x3f, 0x74, 0xb0, 0xa7, 0xb4,
+    0x04, 0xf1, 0x7e, 0x47, 0x4f, 0x9b, 0xb0, 0x14, 0x12, 0x87, 0x82, 0x1c,
+    0x3f, 0x47, 0x6a, 0x43, 0x11, 0x3f, 0x36, 0xb6, 0xe0, 0xf4, 0x90, 0x99,
+    0xf2, 0x29, 0x02, 0x9d, 0x7f, 0x95, 0x0f, 0x94, 0x54, 0x8c, 0xff, 0xa4,
+    0x6e, 0x32, 0x18, 0x43, 0x52, 0xb8, 0xb8, 0x7d, 0x8c, 0xba, 0xf2, 0x59,
+    0x35, 0x62, 0x4e, 0xb1, 0x75, 0x9f, 0x4a, 0xe1, 0x10, 0xf5, 0xca, 0xe3,
+    0xaf, 0xd7, 0x5b, 0x2a, 0xfa, 0x45, 0x4b, 0x9b, 0x60, 0x6a, 0x17, 0xb3,
+    0xa3, 0x7a, 0xf7, 0xdf, 0xf5, 0x78, 0x23, 0xcb, 0xf9, 0x74, 0xa3, 0x6f,
+    0xa4, 0xf4, 0xda, 0x0b, 0x7a, 0x57, 0xed, 0xee, 0xb1, 0x74, 0x17, 0x25,
+    0x9f, 0xbc, 0x57, 0x95, 0x61, 0x41, 0xd4, 0x21, 0x0c, 0x37, 0x14, 0xc3,
+    0x3c, 0x95, 0x25, 0xb0, 0x78, 0x8a, 0xee, 0x90, 0xb2, 0x6c, 0x47, 0x0f,
+    0x9b, 0xfd, 0xce, 0x74, 0x65, 0xb0, 0xd5, 0x51, 0xb4, 0x0a, 0x1f, 0x3a,
+    0xe0, 0x2c, 0x15, 0xa4, 0x2c, 0x18, 0x28, 0xdf, 0x82, 0xbd, 0xb4, 0xf5,
+    0x84, 0x39, 0x81, 0x32, 0xd3, 0xef, 0x34, 0x13, 0x42, 0x1e, 0xaf, 0xf5,
+    0x63, 0xb4, 0x92, 0x40, 0xcd, 0x60, 0x75, 0xf0, 0x79, 0x56, 0x20, 0xbb,
+    0xc1, 0x70, 0x00, 0x00, 0x01, 0x50, 0x01, 0x84, 0x0d, 0x02, 0x00, 0x07,
+    0x15, 0xcf, 0x00, 0x04, 0x0c, 0x83, 0x00, 0x04, 0x3e, 0x39, 0x80, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x01, 0xe0, 0x24, 0xff, 0xfa, 0x2c, 0x98, 0xfd,
+    0xed, 0x5b, 0x24, 0xf1, 0xae, 0x2d, 0xc4, 0xce, 0xcb, 0x94, 0x8d, 0xf1,
+    0xc2, 0x20, 0xe7, 0x1d, 0x80, 0x8d, 0xbe, 0x55, 0x05, 0xfe, 0x24, 0x73,
+    0xfd, 0x1c, 0x5f, 0xbc, 0x39, 0x54, 0x52, 0x2e, 0x2f, 0xc6, 0x4c, 0xe8,
+    0x08, 0x95, 0x75, 0xfc, 0x54, 0xbf, 0x50, 0x7d, 0x57, 0xf0, 0x2c, 0x23,
+    0x92, 0x62, 0xaf, 0xb9, 0x6b, 0xde, 0xac, 0x30, 0x64, 0xb6, 0xd8, 0x38,
+    0x29, 0x16, 0xa8, 0xd2, 0xb5, 0x4a, 0xe7, 0x37, 0x84, 0x4e, 0xa1, 0xcc,
+    0x17, 0x05, 0x1d, 0xa2, 0x8c, 0xf7, 0x7b, 0x5f, 0x65, 0x6e, 0x91, 0xa4,
+    0xcb, 0x1e, 0x34, 0x74, 0x7d, 0x7c, 0x8c, 0x46, 0x7e, 0xbd, 0xeb, 0x7b,
+    0x39, 0xd7, 0xd3, 0xe7, 0x40, 0x9f, 0x31, 0x30, 0xac, 0x76, 0xdb, 0x1f,
+    0xbb, 0x6f, 0xd1, 0x9d, 0x10, 0xdc, 0xd7, 0x9c, 0xa1, 0xa2, 0xfc, 0x14,
+    0xca, 0xa3, 0xaa, 0xf0, 0x0b, 0xcd, 0x07, 0x80, 0xb8, 0xd5, 0x50, 0x12,
+    0xe0, 0xe2, 0xf1, 0x2e, 0xfb, 0xf6, 0xb6, 0x1b, 0x28, 0x32, 0x4b, 0xc0,
+    0x49, 0xfd, 0xf1, 0x6c, 0x5a, 0x24, 0xaa, 0x32, 0x0a, 0x50, 0xf0, 0x71,
+    0x2d, 0xf5, 0x99, 0x22, 0xc9, 0x0c, 0x9c, 0x87, 0x43, 0xe1, 0x1a, 0xce,
+    0xb0, 0x6b, 0xaa, 0xe3, 0xcd, 0x01, 0x88, 0x30, 0x3f, 0xf6, 0x80, 0x3c,
+    0x7b, 0xf3, 0xbf, 0x78, 0x20, 0x7c, 0xd1, 0x60, 0x4f, 0xa1, 0x9a, 0x11,
+    0x95, 0xd9, 0x05, 0xb1, 0xce, 0xf4, 0x19, 0xf2, 0x93, 0x19, 0x81, 0xb0,
+    0xbc, 0x79, 0x6f, 0xf8, 0xfa, 0x8d, 0x9e, 0x02, 0x37, 0x8e, 0x4d, 0xe1,
+    0xc3, 0xc1, 0x45, 0x8b, 0x95, 0x84, 0x1d, 0xab, 0x9a, 0x7f, 0xf4, 0x18,
+    0x8d, 0xa8, 0xf8, 0x08, 0x9c, 0xc8, 0x7c, 0xea, 0x61, 0x01, 0x0e, 0x03,
+    0x1b, 0x79, 0xdb, 0xe3, 0x5c, 0xdd, 0xa2, 0xdf, 0x27, 0x23, 0xf3, 0x3b,
+    0x64, 0x96, 0xf5, 0x79, 0xda, 0xaa, 0xe9, 0xa7, 0xa8, 0xde, 0xc1, 0xad,
+    0x65, 0x07, 0xde, 0x47, 0x68, 0x4e, 0x02, 0x43, 0x78, 0x6c, 0x08, 0x53,
+    0xd4, 0x1b, 0xe9, 0x7f, 0x29, 0x51, 0x01, 0x01, 0x59, 0xf3, 0x4d, 0xbd,
+    0x74, 0x9a, 0xe8, 0x3b, 0x9a, 0xd1, 0x3e, 0x57, 0x6e, 0xd8, 0xd8, 0x95,
+    0xcd, 0x15, 0xa0, 0x6f, 0x14, 0x03, 0x4c, 0x0b, 0x1c, 0x97, 0x8b, 0xe3,
+    0x4f, 0x9d, 0x05, 0xa2, 0x14, 0x9f, 0xf7, 0x60, 0x0b, 0xe8, 0xa7, 0xf9,
+    0x6c, 0xae, 0x8d, 0x28, 0xf3, 0xc1, 0xf5, 0xa9, 0x77, 0xfd, 0xdb, 0xc7,
+    0xb9, 0xbe, 0x95, 0x83, 0xa7, 0xd2, 0xb3, 0x61, 0x03, 0xa1, 0x84, 0xe1,
+    0x8e, 0x6a, 0xd7, 0xc7, 0x08, 0xc9, 0x67, 0x94, 0x9a, 0xbf, 0xd8, 0x1f,
+    0x44, 0xb3, 0xff, 0x5d, 0x6f, 0x88, 0x76, 0xe7, 0x53, 0x5e, 0x47, 0x48,
+    0xa0, 0x02, 0xe8, 0x97, 0x1c, 0xea, 0x47, 0x00, 0x74, 0x9b, 0x7c, 0x49,
+    0xf9, 0xb4, 0x3b, 0xb5, 0x20, 0x3e, 0x2b, 0xe3, 0x89, 0x6f, 0x50, 0xdb,
+    0xf9, 0x0d, 0xe9, 0x0f, 0xf0, 0xf2, 0x07, 0xc7, 0xce, 0x41, 0x58, 0xad,
+    0xa6, 0xd8, 0x89, 0x6a, 0x64, 0x5e, 0xf5, 0x62, 0xc9, 0xfe, 0x75, 0x2b,
+    0x59, 0x88, 0x9e, 0x86, 0xe7, 0x99, 0x1e, 0xb0, 0x5d, 0xa5, 0x8d, 0x44,
+    0x97, 0x66, 0x51, 0xad, 0xf0, 0xa5, 0x09, 0x90, 0x7e, 0xd5, 0x41, 0xd5,
+    0x05, 0xa9, 0x32, 0x87, 0x34, 0xdc, 0xd2, 0x28, 0x23, 0xc8, 0xc9, 0x3f,
+    0x2d, 0x67, 0xc4, 0x79, 0xcd, 0xc0, 0x4e, 0xe8, 0x1b, 0xab, 0xee, 0x9f,
+    0x95, 0x51, 0x64, 0x7d, 0x1c, 0x12, 0xb3, 0x54, 0x8e, 0x48, 0xaa, 0x24,
+    0x16, 0x70, 0x27, 0xc8, 0xfc, 0x1d, 0x8f, 0x46, 0x09, 0x05, 0x3c, 0xae,
+    0x97, 0x79, 0xcd, 0xe0, 0xa6, 0x54, 0x20, 0x97, 0x34, 0x90, 0x73, 0x4a,
+    0x11, 0x9d, 0x8b, 0xf7, 0xe0, 0xf2, 0x52, 0xd3, 0xd4, 0x1b, 0xc1, 0x76,
+    0x6b, 0xdf, 0xea, 0x24, 0x3c, 0x35, 0x73, 0x71, 0x6a, 0x84, 0x45, 0xe0,
+    0x33, 0xd8, 0x88, 0x67, 0xc7, 0x57, 0x4d, 0xe8, 0x71, 0xe0, 0x20, 0x0f,
+    0xe4, 0x83, 0x44, 0xb6, 0x37, 0x60, 0x7a, 0x9b, 0x65, 0x82, 0xf5, 0x4c,
+    0x62, 0xc3, 0xab, 0x53, 0x69, 0x0e, 0xcc, 0xe9, 0x68, 0x77, 0x9d, 0x24,
+    0xad, 0x23, 0xa3, 0xf8, 0xdb, 0xfe, 0x43, 0x3b, 0x1e, 0xc3, 0x63, 0x2d,
+    0x89, 0xf7, 0x46, 0x24, 0x11, 0xfe, 0xa5, 0xba, 0xf8, 0x1c, 0x78, 0x19,
+    0x13, 0xe8, 0x4e, 0x6d, 0x3f, 0xe0, 0xb3, 0x9b, 0xa9, 0x22, 0x2f, 0x9a,
+    0x7e, 0x41, 0xc5, 0x67, 0x79, 0x2d, 0xdb, 0xf3, 0xae, 0x30, 0x21, 0x7e,
+    0x01, 0x35, 0xb7, 0xc8, 0x42, 0xa8, 0x6e, 0xb3, 0x00, 0x2c, 0x07, 0x82,
+    0x81, 0x81, 0xd1, 0x80, 0xdf, 0xa7, 0x15, 0x48, 0x46, 0xb0, 0xec, 0xd0,
+    0xa8, 0xc6, 0x8a, 0xa6, 0xdf, 0x8a, 0x52, 0xcb, 0x8c, 0x16, 0xd3, 0x8f,
+    0x3d, 0x2e, 0xcf, 0x50, 0x14, 0x0e, 0x1f, 0x08, 0x51, 0xf4, 0xf4, 0x35,
+    0xd3, 0x10, 0x29, 0x88, 0x5c, 0xfd, 0x53, 0xcb, 0xea, 0xe8, 0x6f, 0x78,
+    0x1a, 0x21, 0x51, 0x18, 0x55, 0xf7, 0xbc, 0xc0, 0x12, 0xe6, 0xfa, 0x46,
+    0xac, 0xc2, 0xf2, 0x3e, 0x8b, 0x07, 0x48, 0x87, 0x78, 0x3f, 0x1f, 0x28,
+    0x26, 0x9d, 0x32, 0x58, 0x64, 0x48, 0x44, 0x6c, 0x70, 0x1a, 0xc2, 0xcc,
+    0x6d, 0x20, 0xde, 0xc0, 0xe2, 0x42, 0xf8, 0xa8, 0xce, 0x88, 0x94, 0x66,
+    0x74, 0xad, 0x6a, 0x15, 0xaf, 0x99, 0xe4, 0x85, 0xb0, 0x96, 0x36, 0x1a,
+    0xa7, 0xbf, 0xd5, 0xe3, 0xc0, 0xbc, 0x61, 0xfd, 0x16, 0xab, 0x90, 0xee,
+    0x40, 0xb7, 0x06, 0x35, 0xcd, 0x3f, 0xb6, 0x48, 0xdb, 0x68, 0x04, 0x89,
+    0x07, 0xd8, 0xd0, 0xa9, 0x15, 0x09, 0x30, 0x48, 0x92, 0x9d, 0x15, 0xa2,
+    0x78, 0xae, 0xa7, 0x21, 0xa8, 0x57, 0x95, 0xcf, 0x41, 0xad, 0xe4, 0x99,
+    0xee, 0x82, 0xf4, 0x6d, 0xf5, 0xdd, 0xc7, 0xdb, 0x76, 0xba, 0x5e, 0xf8,
+    0xbc, 0xb5, 0xe2, 0x96, 0x53, 0xfc, 0xe7, 0x06, 0x61, 0x3d, 0x36, 0x94,
+    0x0c, 0x63, 0xd6, 0x80, 0xeb, 0x99, 0xa3, 0xb8, 0x97, 0x5b, 0xbd, 0xa8,
+    0x79, 0xd9, 0x87, 0x66, 0xd9, 0x9c, 0x79, 0xf1, 0x45, 0x72, 0x15, 0x06,
+    0x44, 0xe6, 0x66, 0x1c, 0xe6, 0x18, 0x7e, 0x08, 0x34, 0xa3, 0x10, 0xf5,
+    0xff, 0x59, 0x50, 0x99, 0x10, 0x1c, 0x22, 0x5c, 0xfd, 0xde, 0xc0, 0xff,
+    0xd2, 0x79, 0xb4, 0xa3, 0x0d, 0x73, 0x16, 0x64, 0xae, 0x21, 0xa4, 0x80,
+    0xa8, 0x95, 0xc3, 0x4e, 0x89, 0x0b, 0x39, 0x31, 0xa1, 0x4d, 0xa1, 0xda,
+    0xaa, 0x2e, 0xfc, 0x5f, 0xb9, 0xba, 0x57, 0x6e, 0x1a, 0xcf, 0x2f, 0x6e,
+    0xdd, 0xc3, 0xcf, 0xf4, 0xb4, 0x39, 0x65, 0x9e, 0x9d, 0x9e, 0x90, 0xba,
+    0x5e, 0x45, 0xdc, 0xf2, 0x8e, 0x6b, 0xe8, 0x30, 0x65, 0x57, 0x82, 0xa4,
+    0xba, 0xa7, 0xde, 0x60, 0xcf, 0x6f, 0xb6, 0x4e, 0x8b, 0xd3, 0xf4, 0xc5,
+    0x2c, 0x51, 0xcf, 0x13, 0xe3, 0x01, 0xf6, 0xe0, 0x8b, 0x7d, 0x6a, 0x1c,
+    0xa3, 0xef, 0x5e, 0xd2, 0x0e, 0xfe, 0x01, 0x59, 0xe3, 0x34, 0xb3, 0x11,
+    0xac, 0x6e, 0x55, 0xf3, 0xed, 0x59, 0x57, 0x4a, 0xd7, 0x28, 0x6f, 0xe0,
+    0xa8, 0xb2, 0x5e, 0x71, 0x58, 0x82, 0x69, 0x7a, 0x22, 0x9b, 0xf2, 0x2a,
+    0x82, 0x13, 0xca, 0x76, 0x60, 0x00, 0x00, 0x01, 0x50, 0x01, 0x84, 0x0d,
+    0x02, 0x00, 0x06, 0xf0, 0xd8, 0x00, 0x04, 0x19, 0x3b, 0x00, 0x04, 0x4e,
+    0x3b, 0x80,
+};
+
+/* 10 bit 4:2:2, the same */
+static const uint8_t stream_y422p10[6448] = {
+    0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0x0c, 0x01, 0xff, 0xff, 0x04, 0x08,
+    0x00, 0x00, 0x03, 0x00, 0x9d, 0x08, 0x00, 0x00, 0x03, 0x00, 0x00, 0x1e,
+    0x95, 0x90, 0x09, 0x00, 0x00, 0x00, 0x01, 0x42, 0x01, 0x01, 0x04, 0x08,
+    0x00, 0x00, 0x03, 0x00, 0x9d, 0x08, 0x00, 0x00, 0x03, 0x00, 0x00, 0x1e,
+    0xb0, 0x20, 0x81, 0x04, 0xd9, 0x65, 0x64, 0x92, 0x4c, 0xae, 0x68, 0x08,
+    0x00, 0x00, 0x03, 0x00, 0x08, 0x00, 0x00, 0x03, 0x00, 0xc8, 0x40, 0x00,
+    0x00, 0x00, 0x01, 0x44, 0x01, 0xc1, 0x72, 0xb4, 0x22, 0x40, 0x00, 0x00,
+    0x01, 0x28, 0x01, 0xaf, 0x78, 0x84, 0x98, 0xeb, 0xbb, 0x92, 0x01, 0xec,
+    0x4d, 0x0e, 0xa5, 0x0c, 0x73, 0xa5, 0x60, 0x35, 0x94, 0xc4, 0xd2, 0xbe,
+    0x3e, 0xf8, 0x44, 0xfc, 0x60, 0xf9, 0x91, 0xb2, 0x98, 0x6f, 0xb6, 0x7e,
+    0x47, 0x92, 0x6c, 0x32, 0xf2, 0x12, 0xd8, 0x9a, 0x05, 0x81, 0xa1, 0xff,
+    0xfe, 0x3d, 0x02, 0xce, 0x9d, 0x59, 0xa9, 0x25, 0x7f, 0x47, 0x73, 0x18,
+    0x84, 0xe6, 0x1e, 0xad, 0xa2, 0xc7, 0x01, 0x22, 0x84, 0xb6, 0x3e, 0x7a,
+    0x03, 0x1a, 0x31, 0xee, 0xfa, 0xcf, 0xfa, 0xd7, 0x74, 0xa7, 0x52, 0xa3,
+    0x06, 0x13, 0xa6, 0x72, 0x73, 0x89, 0x14, 0x48, 0xa8, 0x25, 0x0a, 0x48,
+    0x00, 0x8a, 0xcf, 0x2c, 0xcb, 0x70, 0xf0, 0xd0, 0x39, 0x8a, 0x42, 0xea,
+    0xf5, 0x05, 0x20, 0xe0, 0x6d, 0x42, 0x68, 0x68, 0x20, 0x85, 0x5d, 0x67,
+    0x8b, 0xa3, 0xc6, 0xf1, 0x97, 0x6d, 0x5c, 0x31, 0xf7, 0xab, 0x29, 0xec,
+    0x6b, 0x5a, 0x1b, 0x1c, 0xba, 0x44, 0x38, 0x31, 0x38, 0x41, 0x7d, 0xd2,
+    0x2a, 0xe5, 0x9f, 0x18, 0x4f, 0xa7, 0x39, 0xc8, 0x81, 0x14, 0xbc, 0xa5,
+    0xb5, 0x5a, 0x0e, 0xa4, 0x51, 0x41, 0x5e, 0xeb, 0x4a, 0xab, 0x4e, 0x99,
+    0x99, 0x80, 0x62, 0xc3, 0xc7, 0x48, 0x71, 0x4b, 0xb4, 0xc4, 0xd1, 0xd4,
+    0x69, 0x49, 0xa6, 0xf5, 0xfc, 0x3b, 0xe3, 0x75, 0xeb, 0x41, 0x20, 0xd3,
+    0xe5, 0x66, 0xd0, 0x6c, 0xa9, 0xa4, 0xcd, 0xd1, 0x89, 0x5c, 0xeb, 0x99,
+    0xf7, 0xda, 0xd7, 0xd8, 0xdd, 0x35, 0xa0, 0x0c, 0x68, 0xf7, 0x41, 0x53,
+    0xe9, 0xe7, 0x2c, 0xed, 0x1a, 0xd8, 0xf6, 0x78, 0x3a, 0x77, 0x74, 0x78,
+    0xf0, 0xca, 0x81, 0x9b, 0xb9, 0x17, 0xb1, 0x95, 0xf5, 0x6e, 0xba, 0xb6,
+    0x0a, 0xc4, 0xe4, 0xd5, 0x56, 0x26, 0x8a, 0x7b, 0x23, 0x08, 0xc4, 0x11,
+    0xd8, 0x1a, 0xb6, 0xa8, 0x12, 0x7d, 0x7e, 0x84, 0x3a, 0x04, 0x66, 0x74,
+    0xb3, 0x68, 0xaa, 0x4c, 0x52, 0xd3, 0x86, 0x60, 0x3f, 0x50, 0xde, 0x68,
+    0x46, 0xd6, 0x1e, 0x4e, 0x7b, 0x65, 0xe9, 0x88, 0x5b, 0x5c, 0x1a, 0xdf,
+    0x78, 0x68, 0xe0, 0xe2, 0xbd, 0x43, 0x98, 0x74, 0x61, 0x3d, 0x0d, 0xf0,
+    0xa3, 0xe3, 0xd7, 0x10, 0xbb, 0x8e, 0xfc, 0xa8, 0x3e, 0x80, 0xb9, 0xcf,
+    0xd9, 0x20, 0x3d, 0x65, 0x69, 0x4e, 0x74, 0x1a, 0xf6, 0x76, 0x6d, 0x84,
+    0xb0, 0xbd, 0x09, 0x76, 0xdf, 0xae, 0xfe, 0xd4, 0x73, 0x99, 0xb5, 0x87,
+    0x59, 0x49, 0x9d, 0x94, 0xd6, 0x99, 0x83, 0xef, 0x89, 0x3e, 0xe7, 0xc6,
+    0x23, 0xe6, 0xd5, 0xda, 0x4b, 0x8a, 0xd1, 0xda, 0xec, 0xd5, 0x6a, 0xc5,
+    0x7c, 0x25, 0x47, 0xc7, 0x85, 0x20, 0xbf, 0xff, 0x7d, 0xa2, 0xec, 0x53,
+    0xea, 0x92, 0xa2, 0xfb, 0x16, 0x1d, 0x59, 0x1c, 0x97, 0xde, 0x3e, 0xbb,
+    0xd2, 0x9c, 0x64, 0x15, 0x1b, 0xbb, 0xd4, 0x2a, 0xf6, 0x40, 0xeb, 0x7e,
+    0xab, 0xe7, 0x57, 0x87, 0x30, 0xee, 0x72, 0xc6, 0x0a, 0x87, 0xbc, 0xdd,
+    0x56, 0xbe, 0x69, 0x30, 0xdd, 0x85, 0xd8, 0xf3, 0x13, 0xb7, 0x6b, 0xd1,
+    0x94, 0x55, 0xac, 0x35, 0x18, 0x5f, 0x24, 0x17, 0xee, 0xc8, 0xfe, 0x5f,
+    0x5a, 0x53, 0xdb, 0x71, 0xb7, 0xbd, 0x36, 0xdf, 0xe4, 0xd7, 0xe7, 0x03,
+    0xaf, 0x6e, 0x9a, 0x29, 0xf2, 0x65, 0xe3, 0x2b, 0x85, 0xdc, 0xd6, 0x85,
+    0xa6, 0x68, 0x67, 0x75, 0xac, 0x5a, 0xb5, 0x7d, 0xdd, 0x75, 0x34, 0xc7,
+    0x3a, 0x71, 0x44, 0xfd, 0x67, 0xd8, 0xb2, 0x29, 0x03, 0x12, 0x93, 0x95,
+    0x31, 0x55, 0xdc, 0x32, 0x90, 0xa8, 0xa3, 0xbd, 0xb4, 0x70, 0x25, 0xb3,
+    0x18, 0x7a, 0x74, 0xd3, 0x2d, 0xea, 0xea, 0x83, 0x90, 0x32, 0x2c, 0x96,
+    0x7b, 0xd0, 0x65, 0x26, 0x51, 0x33, 0xe6, 0x67, 0xe8, 0x10, 0x11, 0xd0,
+    0xc0, 0xfb, 0xc5, 0xdc, 0x4e, 0x1c, 0xff, 0xb2, 0x3a, 0x2e, 0x71, 0x8b,
+    0x6d, 0x66, 0x20, 0xa3, 0xf1, 0x81, 0xcf, 0x36, 0xc0, 0x66, 0xc1, 0xa2,
+    0xb4, 0xa2, 0xc9, 0xa5, 0x60, 0x24, 0xc5, 0x53, 0x84, 0xc6, 0x55, 0x7f,
+    0xa4, 0x94, 0x8b, 0x58, 0xb3, 0x72, 0xec, 0xb6, 0x0f, 0x29, 0xf3, 0x80,
+    0xc1, 0x4a, 0x94, 0x40, 0x94, 0xba, 0x52, 0xd0, 0x81, 0x57, 0xd9, 0x61,
+    0x5c, 0x8c, 0x1e, 0x98, 0x4e, 0xdd, 0x01, 0x4d, 0x07, 0x4a, 0xd2, 0xb5,
+    0x78, 0xcf, 0x96, 0x45, 0x33, 0x42, 0x49, 0xcf, 0x54, 0x41, 0xde, 0x4f,
+    0x82, 0xff, 0x12, 0x00, 0x5c, 0x4a, 0x1a, 0x9d, 0xbf, 0xc1, 0x31, 0x85,
+    0x1a, 0x07, 0xce, 0x70, 0x7b, 0x5b, 0x9a, 0xae, 0x6d, 0x24, 0xb1, 0x18,
+    0x40, 0x1c, 0x15, 0x2f, 0x55, 0x87, 0x58, 0x8d, 0x63, 0x52, 0xce, 0x90,
+    0xf1, 0xc1, 0xb0, 0xd3, 0xbd, 0xa0, 0x02, 0x06, 0xaa, 0x1b, 0x92, 0x1a,
+    0x67, 0x2e, 0x32, 0x5c, 0x98, 0x23, 0xd8, 0x33, 0x1e, 0x59, 0x35, 0xa4,
+    0x3b, 0x99, 0x34, 0x84, 0xd6, 0xbf, 0xdf, 0x5e, 0x4e, 0x63, 0xe2, 0x7d,
+    0x23, 0xc0, 0xc6, 0xd5, 0xa1, 0xda, 0xae, 0x07, 0x85, 0x94, 0xe4, 0x89,
+    0x49, 0xd5, 0x5e, 0x24, 0xd2, 0x9b, 0xa4, 0x9e, 0xa7, 0x0d, 0x89, 0xf2,
+    0x63, 0x13, 0xb4, 0xcb, 0x9c, 0xc9, 0x09, 0xd5, 0x63, 0x31, 0x45, 0x63,
+    0x3d, 0xce, 0x62, 0x2f, 0xd9, 0xaa, 0xd5, 0xf3, 0x9d, 0x41, 0xed, 0x90,
+    0xe1, 0x02, 0x58, 0x1a, 0x05, 0x9a, 0xb7, 0x49, 0x0a, 0xdb, 0x27, 0x17,
+    0x69, 0x7c, 0x79, 0x2e, 0x33, 0x7c, 0xb4, 0xe1, 0xa9, 0xfb, 0x56, 0xf5,
+    0xab, 0xa6, 0x32, 0x3d, 0x41, 0x07, 0x35, 0xb4, 0xd6, 0xb4, 0x4c, 0xd0,
+    0x05, 0x28, 0x51, 0xcb, 0x3d, 0x54, 0xe3, 0xbe, 0x0b, 0xdf, 0x38, 0x71,
+    0xe0, 0xac, 0x79, 0x80, 0xb4, 0x72, 0x28, 0x9d, 0x61, 0xc0, 0x2f, 0xab,
+    0x78, 0x3a, 0x67, 0x3f, 0x74, 0x30, 0x44, 0x90, 0x1f, 0x72, 0xcd, 0xa0,
+    0xcf, 0xe4, 0xaa, 0xe2, 0x4f, 0x27, 0x3f, 0xcb, 0x3c, 0xfc, 0x00, 0xd5,
+    0x7b, 0x9c, 0x89, 0xc2, 0xfe, 0xe4, 0x4e, 0x52, 0xd7, 0x8b, 0x6b, 0xa3,
+    0x3c, 0x9a, 0xd7, 0xbc, 0xfc, 0x71, 0x6d, 0x49, 0xe9, 0x8a, 0x89, 0x6a,
+    0xaa, 0xab, 0x2e, 0xbc, 0x1e, 0xde, 0x77, 0x91, 0xa2, 0x59, 0xe5, 0x12,
+    0x78, 0x8b, 0x62, 0x72, 0xc6, 0xb9, 0xc5, 0x40, 0xcd, 0xbf, 0x06, 0x17,
+    0x8b, 0x55, 0x93, 0x04, 0x89, 0x05, 0x21, 0x93, 0x26, 0x76, 0xbd, 0x99,
+    0xbc, 0x7f, 0x7d, 0xcf, 0xe8, 0xdd, 0x49, 0x9c, 0x5d, 0x8c, 0x64, 0x4a,
+    0x92, 0xa2, 0x1c, 0x45, 0x12, 0x83, 0xd7, 0x63, 0x4e, 0xc5, 0xb3, 0x0c,
+    0xc1, 0x30, 0x97, 0xcb, 0xfa, 0x02, 0xf8, 0x93, 0x6b, 0x03, 0xbe, 0x1f,
+    0x49, 0x4c, 0xd5, 0xf9, 0xef, 0x94, 0x4e, 0xcb, 0x30, 0x0c, 0x6f, 0x5d,
+    0xc4, 0x4d, 0x06, 0x74, 0xbb, 0xa5, 0x40, 0xb1, 0x3a, 0x8e, 0xf3, 0xfe,
+    0xb0, 0x6e, 0xf2, 0xd6, 0x27, 0xf9, 0x3f, 0xaf, 0xed, 0xfa, 0xa5, 0x9c,
+    0x13, 0x25, 0xab, 0xc6, 0xcd, 0xe2, 0xe5, 0x4a, 0x0a, 0x60, 0x05, 0xe8,
+    0xf4, 0x51, 0x09, 0xd7, 0x71, 0xb8, 0xc6, 0x35, 0x43, 0xe9, 0xf2, 0xc6,
+    0x87, 0x0b, 0x73, 0x47, 0x69, 0xfb, 0xaa, 0x51, 0xe0, 0x4d, 0xe9, 0x04,
+    0x93, 0xd6, 0xe2, 0x48, 0x67, 0xa3, 0xf3, 0x02, 0x7d, 0x89, 0xbb, 0xa2,
+    0x81, 0x66, 0xa1, 0xfd, 0xde, 0xbc, 0x70, 0x5b, 0xa4, 0xba, 0x24, 0x34,
+    0x34, 0x10, 0xb8, 0xb1, 0xb9, 0x99, 0x2e, 0xf4, 0x28, 0x66, 0x43, 0x52,
+    0x7f, 0xdc, 0x3b, 0x27, 0xce, 0xa9, 0x17, 0x7d, 0x74, 0x82, 0xfc, 0xf7,
+    0x22, 0x3d, 0x64, 0x7b, 0xe1, 0xc4, 0xdb, 0xc0, 0xe1, 0x66, 0x07, 0x6b,
+    0x13, 0xc7, 0xc5, 0xe2, 0xa6, 0xf3, 0x53, 0xe4, 0x5c, 0x6e, 0xcd, 0x1f,
+    0x82, 0x01, 0x3e, 0x51, 0x34, 0xc2, 0x9d, 0x85, 0x51, 0x7f, 0x12, 0x3b,
+    0xf9, 0x31, 0xd3, 0xbd, 0xd4, 0x74, 0xe2, 0xd1, 0x2b, 0xee, 0xeb, 0x45,
+    0x21, 0x95, 0xf9, 0x74, 0xf3, 0x4d, 0xe2, 0x56, 0x49, 0xab, 0xc8, 0x71,
+    0x26, 0xd0, 0xbc, 0x6b, 0xf1, 0x8b, 0x5e, 0x6e, 0x71, 0x84, 0x1a, 0x27,
+    0x3f, 0xf8, 0x0f, 0x65, 0x97, 0x56, 0x05, 0x5c, 0x32, 0x14, 0x33, 0x2f,
+    0x9e, 0x1c, 0x97, 0xcd, 0x55, 0x3b, 0xaa, 0xc7, 0x7a, 0x82, 0xac, 0x29,
+    0x00, 0x7d, 0x87, 0xbd, 0x83, 0x3c, 0xd3, 0x20, 0x95, 0x30, 0xc6, 0x63,
+    0xac, 0x02, 0x26, 0x0a, 0x3f, 0x81, 0x5e, 0xd4, 0x02, 0xbb, 0xa0, 0x6a,
+    0x3b, 0xba, 0xf5, 0x78, 0xfb, 0xd3, 0x42, 0xcc, 0xc9, 0x2e, 0xfc, 0x4c,
+    0x8b, 0x4c, 0x03, 0x0a, 0x41, 0x9d, 0x6b, 0x80, 0x8c, 0x0f, 0xea, 0x90,
+    0x8e, 0x4d, 0x2d, 0x61, 0x11, 0xb7, 0x63, 0x7e, 0x16, 0xfc, 0x01, 0x8e,
+    0x0a, 0x6a, 0x34, 0x5d, 0x4f, 0xb3, 0x48, 0x83, 0x22, 0x69, 0xe1, 0xbd,
+    0xaf, 0x06, 0x03, 0x59, 0x85, 0x06, 0xca, 0x3a, 0x04, 0xfe, 0xc9, 0x35,
+    0x35, 0xbb, 0x4d, 0x8a, 0x9c, 0x8d, 0x24, 0xe3, 0x8f, 0xb3, 0x17, 0x5f,
+    0x70, 0x92, 0x3a, 0x48, 0x07, 0x7a, 0x39, 0x57, 0x91, 0x3a, 0x9f, 0x25,
+    0xb0, 0xf6, 0xea, 0x96, 0xc0, 0x29, 0x8f, 0xca, 0x8a, 0x92, 0x7e, 0xe1,
+    0x32, 0x10, 0x47, 0x31, 0xb1, 0xf5, 0xcd, 0x2f, 0x54, 0x18, 0xbf, 0xe9,
+    0x19, 0x6f, 0x86, 0x77, 0xfc, 0xd4, 0x46, 0x8d, 0xa9, 0xe0, 0x02, 0x9e,
+    0x98, 0x39, 0x3e, 0xe2, 0x96, 0xbb, 0x8a, 0x89, 0x06, 0x96, 0x40, 0x95,
+    0x47, 0x0c, 0x57, 0xe5, 0x45, 0xae, 0x72, 0x78, 0x51, 0xe3, 0x7f, 0xd6,
+    0x60, 0x02, 0xea, 0xe5, 0x12, 0xf5, 0x3c, 0xdc, 0x28, 0xd0, 0x1e, 0x95,
+    0xc6, 0x8e, 0xae, 0xed, 0xd2, 0x2e, 0x14, 0x1f, 0x0f, 0x22, 0xcc, 0xec,
+    0xec, 0x34, 0xa6, 0x4b, 0x9f, 0x43, 0x44, 0x1e, 0x30, 0xc9, 0x27, 0xfc,
+    0x60, 0x37, 0x94, 0xb8, 0x96, 0x81, 0x0a, 0x00, 0x7b, 0xdb, 0x54, 0x1b,
+    0x1d, 0x4f, 0x15, 0xb5, 0xec, 0xda, 0xed, 0x50, 0x80, 0xb0, 0x2a, 0x19,
+    0x77, 0x3f, 0x8b, 0xd6, 0xa8, 0xa5, 0xd7, 0xb9, 0xc4, 0x2e, 0xa1, 0x72,
+    0xa4, 0x97, 0x97, 0x6b, 0x3e, 0x0c, 0xda, 0x1d, 0x8d, 0xec, 0x0b, 0xc6,
+    0x35, 0xfd, 0xd4, 0x31, 0x61, 0xdf, 0xac, 0xd7, 0xf5, 0x38, 0x99, 0xb7,
+    0x55, 0x65, 0xf1, 0xb2, 0x53, 0xbb, 0x48, 0x3b, 0x2f, 0x47, 0xbf, 0x01,
+    0x76, 0x3f, 0x64, 0xd2, 0x74, 0xe7, 0x72, 0x5d, 0xb7, 0xc6, 0xfd, 0xfc,
+    0xc1, 0xb6, 0x46, 0x58, 0x5c, 0xbb, 0x5e, 0x8a, 0xc4, 0xe6, 0x55, 0xe2,
+    0x31, 0x9f, 0xda, 0x8f, 0xbd, 0x1b, 0x4c, 0x9b, 0x10, 0x54, 0x39, 0x38,
+    0xca, 0x6f, 0x66, 0xd7, 0x28, 0x56, 0x65, 0xb9, 0x02, 0xa4, 0xaf, 0xa2,
+    0xf1, 0x1e, 0xaa, 0x3e, 0x4a, 0x0a, 0xa7, 0x2b, 0x73, 0x55, 0x44, 0x7a,
+    0x16, 0xfb, 0x0c, 0x12, 0x8b, 0x65, 0x3d, 0x19, 0xd5, 0x48, 0x2d, 0xfa,
+    0x3a, 0xac, 0xf5, 0xeb, 0xf5, 0xb0, 0xc7, 0xbb, 0x58, 0x80, 0xdd, 0x67,
+    0x46, 0x72, 0x13, 0x4c, 0xf1, 0x20, 0x6e, 0x58, 0xe9, 0xda, 0xcc, 0xff,
+    0x1c, 0x21, 0x3e, 0x00, 0x38, 0x09, 0x19, 0x41, 0x93, 0x30, 0xd6, 0xea,
+    0x0c, 0xda, 0x2d, 0x41, 0xc7, 0xe7, 0xc8, 0x43, 0x5e, 0xa5, 0xeb, 0x8e,
+    0xe3, 0xc1, 0x58, 0x69, 0x59, 0x61, 0xab, 0x0b, 0xe6, 0x88, 0x01, 0x4c,
+    0xd8, 0x27, 0x97, 0x82, 0x84, 0x05, 0xcf, 0x81, 0x18, 0x74, 0x9b, 0xe9,
+    0x30, 0x4f, 0x09, 0x8f, 0xa1, 0x97, 0x92, 0x6b, 0xc3, 0x09, 0x00, 0x62,
+    0xbd, 0x25, 0xee, 0x2c, 0x43, 0x00, 0xed, 0x86, 0xae, 0x0b, 0xc0, 0xf2,
+    0x3b, 0x94, 0xc3, 0xfd, 0x18, 0x72, 0x3a, 0x93, 0xf5, 0xf0, 0x49, 0xc9,
+    0x48, 0xcf, 0xa3, 0x87, 0xf2, 0x4f, 0x93, 0x1f, 0xab, 0xe2, 0x61, 0xef,
+    0xc3, 0x00, 0xda, 0xa4, 0x34, 0xd5, 0x3a, 0x98, 0x8c, 0xf5, 0xb6, 0x93,
+    0x64, 0xfe, 0x81, 0xaf, 0x70, 0x6b, 0x93, 0xef, 0x38, 0xca, 0x96, 0xbf,
+    0xf4, 0x06, 0x92, 0x0f, 0xc7, 0xf1, 0xe0, 0x18, 0x69, 0xae, 0xd2, 0x38,
+    0x5d, 0x9e, 0xad, 0x9f, 0x6e, 0x48, 0x76, 0x4e, 0xa3, 0x69, 0x34, 0xdb,
+    0x4d, 0x14, 0x54, 0x7e, 0x84, 0xd4, 0xf8, 0x83, 0x23, 0x99, 0x33, 0x7c,
+    0x84, 0xac, 0xf9, 0xf6, 0x61, 0xe8, 0x74, 0xc9, 0x04, 0x4c, 0xcd, 0x26,
+    0x22, 0x28, 0x57, 0xb7, 0xf9, 0xe2, 0x5f, 0x80, 0x65, 0x8d, 0xb0, 0x5e,
+    0xf9, 0x9c, 0xdd, 0x84, 0x18, 0xdc, 0x72, 0x56, 0x41, 0x3c, 0x89, 0x5a,
+    0x21, 0xf6, 0x74, 0x78, 0x9a, 0x3a, 0x5e, 0xd8, 0x1c, 0xb2, 0x93, 0xc7,
+    0x6c, 0x98, 0x0f, 0xba, 0xf2, 0xfb, 0x09, 0x71, 0xac, 0xb3, 0x3e, 0xa8,
+    0xfd, 0x61, 0xe1, 0x17, 0x0c, 0x5f, 0xfd, 0x8c, 0x6d, 0xe5, 0x1f, 0xb5,
+    0xc7, 0xed, 0x3c, 0x6f, 0x0f, 0xc5, 0xee, 0xe2, 0xcc, 0x27, 0x8a, 0x52,
+    0xe5, 0xc6, 0x30, 0xae, 0xe7, 0xc1, 0x58, 0x4e, 0x03, 0x3d, 0xa4, 0x6e,
+    0x87, 0xef, 0xeb, 0x56, 0xbe, 0x94, 0x3a, 0x17, 0x44, 0xb6, 0xc4, 0x21,
+    0xb9, 0xd3, 0xcc, 0xaa, 0x7d, 0x21, 0x18, 0x89, 0x6c, 0x3e, 0x55, 0xd1,
+    0x59, 0x89, 0x70, 0x98, 0x8d, 0x13, 0x9d, 0xb2, 0xb6, 0x97, 0xb0, 0xea,
+    0xb1, 0x12, 0x1c, 0x14, 0x8a, 0xc6, 0xfb, 0xb0, 0xfe, 0xe2, 0x0e, 0xcc,
+    0x5f, 0xee, 0x9b, 0x05, 0x17, 0x5f, 0x41, 0x06, 0x7b, 0xe9, 0xd5, 0x51,
+    0x7c, 0x2b, 0x4b, 0x98, 0xd8, 0x84, 0xac, 0x60, 0x6a, 0x65, 0x16, 0xb9,
+    0x60, 0x5b, 0x24, 0xb6, 0xbf, 0x4e, 0x97, 0x70, 0xee, 0xe8, 0x45, 0x33,
+    0xb1, 0xe2, 0xbe, 0x50, 0x9d, 0x6d, 0xa8, 0x1b, 0x52, 0x0b, 0x91, 0x45,
+    0xfd, 0x66, 0xe2, 0x7b, 0x8c, 0x2a, 0xce, 0xfe, 0x04, 0xc0, 0x9e, 0xed,
+    0xf8, 0xf9, 0x38, 0x90, 0xf2, 0x78, 0x7f, 0x40, 0xb4, 0x15, 0xce, 0x4b,
+    0x35, 0x6c, 0xe4, 0x7e, 0xc1, 0x92, 0x7f, 0xf2, 0xca, 0x72, 0xc7, 0x2f,
+    0x1a, 0x26, 0x23, 0x14, 0x46, 0x16, 0xfc, 0x12, 0x22, 0x5b, 0x74, 0x71,
+    0x35, 0x30, 0xdf, 0xfb, 0xf0, 0x67, 0xc3, 0x62, 0x4f, 0x2a, 0x2b, 0x33,
+    0x37, 0xfc, 0x79, 0xc8, 0x19, 0x28, 0xf4, 0xeb, 0xfd, 0x38, 0xec, 0xe5,
+    0x42, 0xc9, 0x1c, 0xbc, 0x3b, 0xb9, 0xcc, 0x46, 0x7d, 0xd8, 0xad, 0x9b,
+    0x76, 0x80, 0xa9, 0x8c, 0x1d, 0x18, 0xa4, 0xdf, 0x6e, 0x61, 0xfb, 0xfc,
+    0x8c, 0x7b, 0x47, 0xe8, 0x0c, 0xf0, 0xa8, 0x70, 0xa4, 0x06, 0xa5, 0xa3,
+    0xb0, 0x64, 0xab, 0x6b, 0x47, 0x9c, 0xc0, 0xa8, 0xe9, 0x78, 0xb2, 0x26,
+    0x63, 0xe1, 0xfe, 0xbd, 0x02, 0x0c, 0xcf, 0x80, 0x9f, 0x98, 0x1b, 0x4c,
+    0x4d, 0x78, 0xdc, 0x19, 0x80, 0xfd, 0x63, 0x8e, 0xac, 0xae, 0x75, 0xfe,
+    0xfc, 0x0b, 0x3b, 0x5e, 0xfe, 0xfc, 0x2d, 0x86, 0x0c, 0xa9, 0x09, 0x70,
+    0x6f, 0xd0, 0x4d, 0x78, 0xa8, 0x12, 0x34, 0x6b, 0x60, 0x90, 0xfc, 0x3a,
+    0x0b, 0x02, 0x0b, 0x49, 0xe4, 0x86, 0x8b, 0x14, 0x91, 0x7d, 0x18, 0x8c,
+    0xaf, 0x0e, 0xac, 0x2b, 0x0f, 0xa8, 0xec, 0xcd, 0xa7, 0x7d, 0x2a, 0x30,
+    0x51, 0xf8, 0xe7, 0x12, 0xdd, 0x98, 0xfd, 0xa3, 0xa9, 0xf0, 0xc3, 0x61,
+    0x2e, 0xa0, 0xe5, 0x12, 0x82, 0x04, 0x66, 0xac, 0x1c, 0x95, 0x31, 0x8b,
+    0xe0, 0xf4, 0xea, 0xd2, 0x84, 0x6e, 0x2b, 0xea, 0x88, 0x28, 0xde, 0x9f,
+    0x8b, 0x60, 0x2e, 0x26, 0xf1, 0xc3, 0xd7, 0xd5, 0x5a, 0xce, 0xe6, 0x4e,
+    0x81, 0xbb, 0xfa, 0x2c, 0xe9, 0xa1, 0xdd, 0x11, 0xe6, 0xc0, 0x16, 0x50,
+    0xeb, 0xc8, 0x9d, 0x9d, 0xf5, 0xcc, 0xb8, 0xd5, 0xa5, 0x2c, 0x63, 0xb1,
+    0x90, 0x4d, 0xce, 0x9b, 0x3c, 0x69, 0x70, 0x75, 0x52, 0xf7, 0xf2, 0x9a,
+    0x42, 0xe1, 0x5e, 0xfb, 0x7f, 0x7a, 0x9a, 0xed, 0x22, 0x76, 0xfb, 0x84,
+    0xf7, 0x53, 0x73, 0x31, 0x10, 0xac, 0xa8, 0x13, 0x16, 0x85, 0x6f, 0x7b,
+    0x09, 0xc0, 0x37, 0xc2, 0xb5, 0x2c, 0xc2, 0x0f, 0xc4, 0x05, 0xba, 0xbd,
+    0xd0, 0xe1, 0xed, 0xe4, 0x6f, 0xfa, 0x36, 0xff, 0x73, 0x61, 0xcc, 0x69,
+    0x86, 0x44, 0x92, 0xb5, 0x2a, 0xc8, 0x5a, 0xd5, 0xe0, 0x9c, 0xda, 0xb6,
+    0x94, 0x8e, 0xf3, 0x9d, 0x8b, 0x5e, 0x66, 0xb1, 0xc0, 0xa1, 0x04, 0x70,
+    0xe0, 0xa4, 0x1d, 0x0a, 0x9d, 0x2d, 0x0e, 0x9f, 0x19, 0x93, 0x12, 0x3a,
+    0xa0, 0xd6, 0x33, 0xab, 0x73, 0x35, 0x82, 0x79, 0xea, 0xb9, 0x39, 0x55,
+    0x92, 0x93, 0x7f, 0x14, 0x83, 0xe7, 0x02, 0xd9, 0xf7, 0xb4, 0x26, 0x79,
+    0x07, 0x85, 0x23, 0xc1, 0x02, 0x1f, 0x30, 0x00, 0xd2, 0x68, 0x96, 0x7a,
+    0xa7, 0x33, 0x78, 0x44, 0xdc, 0x02, 0x4e, 0x13, 0x6e, 0x6f, 0xf0, 0x00,
+    0x00, 0x01, 0x50, 0x01, 0x84, 0x0d, 0x02, 0x00, 0x0a, 0x14, 0xe3, 0x00,
+    0x05, 0x1c, 0x5d, 0x00, 0x05, 0x0f, 0xd6, 0x80, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x01, 0xd0, 0x19, 0x5f, 0x8e, 0xb6, 0x14, 0x1a, 0x34, 0x69, 0xdb,
+    0x40, 0x3a, 0xb4, 0xbc, 0xcb, 0x46, 0x1a, 0x42, 0x3c, 0x30, 0xd8, 0xd2,
+    0x03, 0xab, 0x60, 0x81, 0x60, 0x84, 0x3f, 0x42, 0xcf, 0xe1, 0xd1, 0x24,
+    0x2b, 0xe4, 0x62, 0x90, 0x9f, 0xa3, 0x08, 0x5e, 0x72, 0xf3, 0x52, 0x17,
+    0x0c, 0xa3, 0xff, 0xfc, 0x7c, 0x62, 0x78, 0xbb, 0x2b, 0x6d, 0xe2, 0x13,
+    0x5e, 0xa4, 0x78, 0x00, 0x50, 0xc5, 0x96, 0x7d, 0xd0, 0xa5, 0x4b, 0xc9,
+    0xd0, 0x02, 0x71, 0x07, 0xf6, 0x1c, 0xef, 0x6e, 0xdf, 0x00, 0xa2, 0x7e,
+    0xff, 0xc9, 0x64, 0x68, 0x27, 0xe6, 0xb8, 0xff, 0x49, 0x1b, 0x7e, 0xb0,
+    0xfc, 0xb9, 0xe6, 0xec, 0x18, 0x91, 0xd6, 0xae, 0xd4, 0xa7, 0x2b, 0xd7,
+    0xaf, 0xf7, 0xfa, 0xf3, 0xec, 0x34, 0xd8, 0x8f, 0xcc, 0xcb, 0x44, 0x89,
+    0x39, 0x17, 0x57, 0xb7, 0xc0, 0x7c, 0x19, 0x78, 0x72, 0x3e, 0xef, 0x60,
+    0xfa, 0xa6, 0x0e, 0xf8, 0x1e, 0x0b, 0xdd, 0xd8, 0x2c, 0xc8, 0x07, 0x93,
+    0x0b, 0xe5, 0x75, 0x36, 0x06, 0x92, 0x4a, 0x32, 0x3a, 0x4b, 0x89, 0x73,
+    0x11, 0xa7, 0x21, 0x90, 0xf1, 0xf4, 0xfb, 0xcb, 0x2f, 0x7f, 0x8e, 0x69,
+    0x42, 0xce, 0x00, 0x04, 0x16, 0xeb, 0x81, 0x6c, 0x80, 0x5e, 0xf8, 0x7d,
+    0x60, 0xad, 0xff, 0x1a, 0x1a, 0xe9, 0x30, 0x40, 0x18, 0xcb, 0x6f, 0x09,
+    0xd0, 0xa8, 0xfa, 0x7b, 0x68, 0x30, 0x69, 0x57, 0x49, 0x36, 0x6b, 0x67,
+    0x77, 0x65, 0x6a, 0x0d, 0xed, 0x47, 0xa0, 0x8e, 0x44, 0x95, 0xac, 0x1b,
+    0x00, 0xd2, 0xd5, 0x1c, 0xe9, 0x2f, 0xa5, 0xca, 0x0f, 0x0d, 0xa3, 0xfe,
+    0x42, 0xd9, 0x0c, 0xb8, 0xc2, 0xca, 0xde, 0x7e, 0x43, 0x6b, 0x9b, 0xd7,
+    0xb0, 0x14, 0x52, 0xb6, 0xab, 0xa9, 0xb9, 0xa2, 0x5b, 0x6f, 0x27, 0xf0,
+    0x29, 0x6c, 0x93, 0x68, 0x96, 0xc3, 0x11, 0x97, 0x89, 0x83, 0x96, 0x51,
+    0x72, 0x62, 0x10, 0xde, 0xba, 0x8e, 0xf5, 0x37, 0x14, 0x39, 0x56, 0x01,
+    0xa6, 0x50, 0x38, 0x23, 0x4c, 0xc3, 0x8f, 0x94, 0xf4, 0xa3, 0xa0, 0x89,
+    0xa9, 0x68, 0xb2, 0x65, 0xc9, 0xf0, 0x27, 0xb7, 0x0f, 0x36, 0x5f, 0x48,
+    0xef, 0xdc, 0xe5, 0x1c, 0xda, 0x3e, 0x5a, 0x57, 0x16, 0x45, 0xd9, 0x89,
+    0x4a, 0x83, 0x3b, 0xd0, 0xa9, 0x7e, 0x74, 0x65, 0x64, 0x39, 0xe4, 0x66,
+    0x67, 0xd4, 0x33, 0x3a, 0xc4, 0x12, 0xcf, 0x15, 0x10, 0xa5, 0x47, 0x39,
+    0x05, 0x35, 0xf0, 0x5c, 0xb8, 0xa2, 0x83, 0x90, 0x87, 0x43, 0x3f, 0xd2,
+    0xae, 0x9c, 0x13, 0xd1, 0xfb, 0x5c, 0x22, 0x28, 0x86, 0x0b, 0x8f, 0xc7,
+    0x8b, 0xc4, 0x66, 0x0b, 0xd8, 0x98, 0x62, 0xcd, 0x31, 0x7e, 0xea, 0xa7,
+    0x9d, 0xb4, 0x00, 0x4c, 0x3c, 0x62, 0x45, 0xdb, 0x93, 0xb1, 0x51, 0xb9,
+    0xe4, 0x20, 0xb1, 0x4d, 0x10, 0x9e, 0xb2, 0x2f, 0xeb, 0xb5, 0x37, 0xf4,
+    0xb7, 0x0a, 0x47, 0xd8, 0x72, 0x65, 0xf9, 0xfb, 0x88, 0xfe, 0xd3, 0x15,
+    0x05, 0xda, 0x14, 0x73, 0x3e, 0xe4, 0x16, 0x44, 0x9a, 0x6e, 0x7f, 0x73,
+    0xbe, 0xdf, 0xbc, 0xd6, 0x9e, 0x93, 0x40, 0x13, 0x48, 0x82, 0x1b, 0x56,
+    0x58, 0xf8, 0x74, 0xaa, 0x12, 0x6e, 0x32, 0xae, 0xdf, 0x77, 0xf3, 0x11,
+    0x4c, 0xd9, 0x56, 0x55, 0x9b, 0x86, 0x26, 0x1d, 0x58, 0xa3, 0xfe, 0x08,
+    0x04, 0x06, 0xa7, 0xb6, 0x42, 0x4d, 0xf2, 0xc7, 0x9d, 0x9e, 0xad, 0x00,
+    0xbc, 0xa0, 0x9e, 0x0f, 0x8f, 0x17, 0xee, 0xc8, 0xc2, 0x0e, 0xe2, 0x21,
+    0x3a, 0x97, 0xc2, 0xdd, 0xa0, 0x9e, 0x3f, 0xe1, 0x98, 0x56, 0xa1, 0x1f,
+    0xda, 0xba, 0x23, 0x46, 0x9b, 0x24, 0x6b, 0x9f, 0x7b, 0x17, 0xe1, 0x1c,
+    0x86, 0x84, 0xd4, 0x6b, 0xec, 0x83, 0xa1, 0x2d, 0x89, 0x86, 0x59, 0x10,
+    0x31, 0x2b, 0x35, 0xfd, 0x1d, 0xc5, 0x86, 0xc0, 0xd0, 0x0b, 0xba, 0x20,
+    0xdb, 0x21, 0x51, 0xc7, 0x30, 0x4b, 0x69, 0x76, 0x1f, 0x38, 0x40, 0xef,
+    0xa6, 0x6c, 0xab, 0x8e, 0xde, 0x4d, 0x17, 0x93, 0x0c, 0x25, 0xc7, 0x19,
+    0x37, 0x57, 0x5f, 0x86, 0xc1, 0x9b, 0xc7, 0xd9, 0x0e, 0x44, 0xd1, 0x30,
+    0x42, 0x8e, 0x94, 0xa6, 0x83, 0xd1, 0xf3, 0x72, 0x25, 0x44, 0xd6, 0x0d,
+    0xae, 0xe8, 0xea, 0x77, 0xd9, 0xc4, 0x64, 0xaf, 0x23, 0xa4, 0x25, 0x8a,
+    0x0c, 0x2d, 0x6c, 0xb3, 0x6e, 0x4f, 0xc6, 0x59, 0x65, 0x43, 0x2a, 0x23,
+    0x1f, 0xd6, 0xfc, 0x6c, 0x5c, 0x9a, 0x9a, 0xc1, 0x7d, 0xfe, 0xd9, 0xf6,
+    0xf1, 0xb2, 0x98, 0xe5, 0x88, 0xca, 0x7b, 0xad, 0x86, 0xc4, 0xe9, 0x99,
+    0x56, 0x6a, 0xf8, 0xbd, 0x7b, 0x83, 0x5c, 0x98, 0x10, 0xd6, 0xc1, 0x33,
+    0xae, 0x70, 0x8f, 0x79, 0x43, 0xde, 0x02, 0x23, 0x1f, 0xcb, 0x0a, 0xd7,
+    0x4d, 0xf9, 0x39, 0xd2, 0xd2, 0x7c, 0xcc, 0x47, 0x78, 0xa2, 0x66, 0x80,
+    0xaa, 0x46, 0xd4, 0x16, 0x19, 0x31, 0xed, 0x22, 0x0e, 0x69, 0x7f, 0xfc,
+    0x88, 0x53, 0x67, 0x1e, 0x55, 0xb7, 0x26, 0xb0, 0x1a, 0xb0, 0x20, 0xa4,
+    0x92, 0x3c, 0xce, 0xd2, 0x46, 0x4d, 0x9e, 0xac, 0x51, 0x19, 0xb8, 0x7b,
+    0xce, 0x33, 0xc0, 0x47, 0xd1, 0x60, 0x00, 0x90, 0x41, 0x5e, 0x3a, 0x6c,
+    0x6f, 0xf3, 0x92, 0x89, 0x66, 0x98, 0xab, 0x2f, 0x3e, 0x0b, 0xb0, 0x73,
+    0xd1, 0xe4, 0x66, 0xc9, 0xd7, 0xa0, 0xca, 0x02, 0x29, 0xf9, 0xbf, 0x73,
+    0x32, 0xb7, 0xce, 0x61, 0x9d, 0xcb, 0x42, 0x12, 0x18, 0x8b, 0x4c, 0x31,
+    0x99, 0xa3, 0x19, 0x41, 0x8e, 0xa5, 0x6c, 0xf7, 0xcd, 0x31, 0xa6, 0xf4,
+    0xb8, 0x7d, 0x1b, 0x26, 0x09, 0xc2, 0xc4, 0xed, 0x87, 0x82, 0xfd, 0x8b,
+    0x87, 0x78, 0xae, 0xea, 0x54, 0x5e, 0x1c, 0xa0, 0x54, 0x0f, 0x53, 0x71,
+    0x72, 0x17, 0xb1, 0x12, 0x3f, 0x21, 0x87, 0x44, 0x8a, 0x17, 0x3c, 0xd1,
+    0x30, 0x32, 0x05, 0x78, 0x71, 0xd0, 0x4f, 0xf2, 0x9f, 0x8d, 0x9b, 0x12,
+    0x7f, 0xc3, 0x21, 0xe9, 0x8c, 0x82, 0x92, 0x9d, 0xbe, 0x4e, 0x18, 0x12,
+    0x70, 0x95, 0xa7, 0x06, 0x21, 0xf6, 0x3d, 0x6a, 0x39, 0x74, 0x57, 0xe8,
+    0x3c, 0x93, 0xfc, 0xe8, 0x7a, 0x5c, 0x16, 0x72, 0x33, 0xc3, 0x78, 0x11,
+    0xb5, 0xba, 0xca, 0x0a, 0xe3, 0x1c, 0x43, 0xe0, 0x08, 0x05, 0xd5, 0x0e,
+    0x44, 0xca, 0x94, 0x2c, 0x29, 0xc5, 0xd4, 0x1f, 0x2a, 0xa2, 0xbc, 0x42,
+    0x6e, 0xa3, 0x3b, 0x82, 0x7a, 0x55, 0x3c, 0xfd, 0x92, 0xaf, 0xdc, 0x81,
+    0x7a, 0x56, 0xfc, 0xcf, 0xd5, 0x60, 0x41, 0xa2, 0x3c, 0x94, 0x40, 0xd6,
+    0xed, 0x58, 0xd9, 0xe9, 0xcc, 0xa0, 0x00, 0x8e, 0x73, 0x80, 0xcb, 0xc4,
+    0x10, 0x5d, 0x58, 0xe2, 0x08, 0xfd, 0x8d, 0xd3, 0x85, 0x8b, 0x2a, 0x4b,
+    0x9b, 0x87, 0xd7, 0x5f, 0xe2, 0x47, 0xd7, 0xca, 0x98, 0x3b, 0xad, 0xe5,
+    0xea, 0x2e, 0xf4, 0x10, 0x2e, 0xd4, 0x61, 0x90, 0x6b, 0xec, 0xc7, 0xe4,
+    0x1c, 0x65, 0x5b, 0xd8, 0xda, 0x22, 0x5a, 0x7a, 0xf0, 0x38, 0x0e, 0x7a,
+    0xda, 0xf0, 0xd3, 0x39, 0x13, 0x14, 0x6d, 0x66, 0x97, 0x0d, 0x70, 0x50,
+    0xb2, 0x9d, 0x31, 0x41, 0xbb, 0xac, 0xa2, 0x26, 0x8e, 0x3c, 0xf3, 0x5a,
+    0xf0, 0x81, 0xbc, 0xdb, 0x2a, 0xe9, 0x56, 0x9c, 0xe2, 0x5a, 0x1b, 0x20,
+    0x3f, 0xba, 0x12, 0x90, 0xe1, 0x78, 0x90, 0xf5, 0x60, 0xe1, 0x36, 0x81,
+    0x64, 0x26, 0x76, 0x10, 0x93, 0x3f, 0xbe, 0x3e, 0xbc, 0x2c, 0xc6, 0xa1,
+    0x45, 0x0c, 0x1c, 0x25, 0x26, 0x44, 0xbe, 0xd7, 0xdd, 0xde, 0xed, 0xad,
+    0xe7, 0x13, 0x1a, 0x87, 0xb8, 0x5c, 0x8d, 0xb6, 0x7c, 0x6d, 0x5e, 0x67,
+    0xcd, 0x23, 0xa9, 0xa5, 0x73, 0x95, 0x09, 0x79, 0x35, 0x23, 0x55, 0xce,
+    0xbc, 0x94, 0xbc, 0xdf, 0x8c, 0x05, 0xbf, 0xdc, 0xc0, 0x0f, 0x25, 0xcb,
+    0xff, 0x86, 0x0e, 0x5d, 0x09, 0x62, 0xc8, 0x51, 0x8c, 0xfa, 0x88, 0xe0,
+    0x1f, 0x7c, 0xb6, 0xf9, 0x7f, 0xf9, 0x34, 0x22, 0x98, 0x98, 0x34, 0x10,
+    0xe2, 0x95, 0x87, 0xde, 0x98, 0xc9, 0x1c, 0x9c, 0xf0, 0x09, 0xa2, 0x75,
+    0x15, 0xe4, 0x8c, 0x6a, 0x9e, 0x5c, 0x18, 0x74, 0x84, 0xec, 0x6b, 0x6e,
+    0x21, 0x22, 0x84, 0x92, 0x90, 0xdf, 0x0c, 0xbe, 0xfe, 0x6b, 0xb2, 0xcf,
+    0x2d, 0xe6, 0x21, 0x64, 0x4e, 0x85, 0xea, 0xa8, 0xfa, 0x7d, 0x6e, 0x3e,
+    0xb0, 0xc7, 0xe0, 0x53, 0x2b, 0xe4, 0xe5, 0x99, 0x92, 0x7f, 0xcf, 0x5e,
+    0x9e, 0x17, 0x9c, 0xad, 0x5a, 0xef, 0xee, 0x9a, 0xa2, 0x31, 0x56, 0xdd,
+    0xf4, 0xb0, 0xa7, 0x04, 0xdd, 0x7f, 0x22, 0xd1, 0x82, 0xf2, 0x86, 0x05,
+    0x6d, 0x45, 0x21, 0x03, 0x67, 0x0b, 0x20, 0x92, 0x89, 0x3b, 0xc6, 0x6d,
+    0xa6, 0x0f, 0x22, 0x53, 0x5e, 0xfb, 0x85, 0x73, 0x59, 0x64, 0x39, 0x69,
+    0x2f, 0x0f, 0x25, 0x8e, 0x81, 0x84, 0x05, 0x95, 0x7b, 0xe1, 0x16, 0x67,
+    0x3c, 0x7c, 0xf4, 0xf4, 0xb4, 0x6f, 0x5e, 0x27, 0x00, 0x69, 0x08, 0x83,
+    0x3d, 0xab, 0x10, 0x9a, 0x0d, 0x64, 0x5f, 0xcd, 0x5d, 0x9f, 0xe6, 0x4e,
+    0x54, 0x9e, 0xc6, 0xa1, 0x01, 0xf2, 0xed, 0xc6, 0x6c, 0xba, 0x94, 0x7c,
+    0x98, 0x13, 0x33, 0xbd, 0x32, 0xf6, 0x73, 0xcf, 0xe9, 0x19, 0xe8, 0xd9,
+    0x36, 0xb5, 0xd1, 0x4e, 0x54, 0xbe, 0xb2, 0xc7, 0xb3, 0x30, 0xf2, 0x02,
+    0x28, 0xa6, 0xf8, 0x8a, 0xa6, 0x31, 0x42, 0x96, 0xc8, 0xcd, 0x07, 0xd8,
+    0xc6, 0x3b, 0xdb, 0xd9, 0x6f, 0x44, 0xec, 0x53, 0x75, 0x79, 0xad, 0x4f,
+    0x76, 0xa9, 0xd7, 0x52, 0x78, 0xa2, 0x4d, 0x42, 0xfd, 0xec, 0x7c, 0xc7,
+    0xe6, 0x15, 0x7a, 0xa2, 0x57, 0x96, 0xcd, 0xe1, 0x04, 0x46, 0x99, 0xaa,
+    0x71, 0xea, 0xc6, 0xb0, 0xcd, 0x65, 0x79, 0xa4, 0x9e, 0xf8, 0x8d, 0xd0,
+    0xfe, 0x39, 0xf5, 0x8e, 0x4e, 0xa0, 0xae, 0x89, 0xc5, 0x30, 0x3f, 0xc9,
+    0x1d, 0xb8, 0xed, 0x72, 0x14, 0x7a, 0x5b, 0x4e, 0x7d, 0x2c, 0xa8, 0xc8,
+    0x34, 0x2f, 0x12, 0x1a, 0xb2, 0x02, 0x34, 0x48, 0x08, 0xe3, 0x0c, 0x8b,
+    0xc2, 0x5f, 0x8d, 0xb0, 0xac, 0x8f, 0x19, 0x85, 0x68, 0x36, 0x57, 0x78,
+    0x7d, 0xc3, 0x47, 0x4c, 0x5f, 0x37, 0xe2, 0xd4, 0x80, 0x9d, 0x3c, 0x1d,
+    0xb2, 0xd4, 0xab, 0x16, 0x16, 0x8b, 0xb4, 0x6c, 0x4f, 0x5c, 0xaa, 0xef,
+    0xf8, 0x69, 0xb2, 0xee, 0xde, 0xcc, 0x86, 0x1d, 0xac, 0x65, 0x0a, 0x06,
+    0x1a, 0x59, 0x96, 0x01, 0xff, 0x14, 0x43, 0x4e, 0xde, 0x3e, 0x19, 0xea,
+    0x4d, 0x0d, 0x1e, 0xcc, 0xd9, 0x3f, 0x37, 0xf1, 0x6f, 0x9a, 0x93, 0xab,
+    0xb9, 0x6f, 0x87, 0x3e, 0x2f, 0x2f, 0x8a, 0x09, 0xf8, 0x2a, 0x74, 0xa9,
+    0xa3, 0x42, 0xf7, 0xd2, 0x21, 0x03, 0xd9, 0x9d, 0xf5, 0x86, 0x56, 0x93,
+    0x88, 0xdb, 0x70, 0x1a, 0x3f, 0x1e, 0x8c, 0xc7, 0x47, 0x77, 0x2c, 0x97,
+    0xa7, 0xc2, 0xda, 0x10, 0xd7, 0x60, 0x2d, 0x8b, 0x78, 0xfa, 0xfb, 0x81,
+    0x3a, 0x65, 0x39, 0x01, 0x7c, 0xdc, 0x69, 0xbf, 0xd0, 0x9e, 0x99, 0x15,
+    0x51, 0x2c, 0x23, 0x84, 0x2d, 0xc8, 0x9b, 0xba, 0x31, 0x0f, 0x36, 0x13,
+    0x00, 0xfd, 0x10, 0x41, 0x09, 0x3d, 0x15, 0x47, 0x34, 0xb5, 0x9d, 0xa0,
+    0x00, 0xe4, 0xcd, 0x6e, 0xd7, 0x33, 0xcf, 0x1e, 0x4a, 0x43, 0x82, 0xe2,
+    0xe3, 0xb3, 0xde, 0x29, 0x1f, 0x85, 0x85, 0xa3, 0x67, 0x3a, 0xf3, 0xd7,
+    0x31, 0x36, 0x34, 0x34, 0x11, 0x02, 0x03, 0xe3, 0x5f, 0x7c, 0x62, 0x4c,
+    0xa7, 0x70, 0x7e, 0x2b, 0xb0, 0xc3, 0xf0, 0xb4, 0xaa, 0xeb, 0xd6, 0x86,
+    0xa9, 0xe9, 0x48, 0x94, 0xd0, 0xaf, 0x61, 0x5a, 0x03, 0x19, 0x26, 0x9e,
+    0xed, 0x81, 0xe5, 0x69, 0xbc, 0x51, 0x59, 0x82, 0xb4, 0x8d, 0x9a, 0x8c,
+    0x2d, 0x4a, 0x0e, 0xfd, 0x03, 0x3a, 0x6e, 0x72, 0x62, 0xb6, 0x0e, 0x9a,
+    0xd5, 0x12, 0xe2, 0x53, 0xe5, 0xd8, 0x16, 0x69, 0x62, 0x64, 0x0b, 0x8f,
+    0x68, 0x89, 0x47, 0x4c, 0x7f, 0xfe, 0x5f, 0x1a, 0x10, 0xd4, 0x9e, 0xa1,
+    0x1e, 0xb8, 0xca, 0x86, 0xfe, 0xa9, 0xd1, 0x6a, 0xd5, 0xaa, 0xcd, 0x82,
+    0x04, 0x9a, 0xda, 0x3a, 0xcf, 0xdf, 0xb6, 0x20, 0xd4, 0xf4, 0xba, 0xc3,
+    0xad, 0x7d, 0x55, 0xc2, 0x89, 0x7a, 0x7c, 0x61, 0x40, 0x3d, 0xe5, 0x89,
+    0xd4, 0x5c, 0x16, 0x13, 0xfa, 0x25, 0xbf, 0x74, 0x87, 0x53, 0xdf, 0xe1,
+    0xc1, 0x33, 0x04, 0x5c, 0x36, 0x7a, 0x40, 0xed, 0xf5, 0xaf, 0xff, 0xf0,
+    0xfc, 0x24, 0x7c, 0xb4, 0x52, 0x7a, 0x18, 0x37, 0x66, 0x96, 0xf1, 0x53,
+    0x35, 0x80, 0x02, 0xd8, 0xfa, 0x9a, 0xd1, 0x82, 0x18, 0xb3, 0xb2, 0x50,
+    0x22, 0xcb, 0xba, 0xa2, 0xbb, 0x38, 0x7d, 0xcd, 0x2a, 0x60, 0xd9, 0x87,
+    0xb5, 0x51, 0x61, 0x50, 0xec, 0xc6, 0x40, 0xc2, 0x3d, 0xa8, 0x99, 0xef,
+    0x92, 0xba, 0x93, 0xbf, 0xc4, 0x4a, 0x9a, 0xfe, 0x80, 0x03, 0x0b, 0x2a,
+    0x42, 0x5a, 0x3f, 0x2e, 0xfc, 0x5c, 0x03, 0x75, 0x41, 0xb4, 0xc4, 0xa9,
+    0xc8, 0x70, 0x00, 0x00, 0x01, 0x50, 0x01, 0x84, 0x0d, 0x02, 0x00, 0x09,
+    0xf8, 0x92, 0x00, 0x05, 0x37, 0x17, 0x00, 0x05, 0x10, 0x9b, 0x80, 0x00,
+    0x00, 0x00, 0x01, 0x02, 0x01, 0xe0, 0x44, 0x97, 0xe1, 0xa4, 0xfe, 0xeb,
+    0xf4, 0x85, 0xa4, 0x80, 0x05, 0xc1, 0xc3, 0x5f, 0x4c, 0x5c, 0xab, 0xc4,
+    0x64, 0x66, 0x0f, 0xfd, 0x1b, 0xef, 0x1f, 0x73, 0x0d, 0x06, 0xec, 0x2a,
+    0x32, 0x6c, 0xcd, 0x75, 0x35, 0xa1, 0xd0, 0x69, 0x3b, 0xe0, 0xcf, 0x8f,
+    0x8f, 0x04, 0x1e, 0xcb, 0xc3, 0x87, 0xf9, 0x80, 0x80, 0x27, 0x38, 0xe8,
+    0x6b, 0x22, 0x82, 0x64, 0x71, 0xe8, 0xb2, 0xdf, 0x53, 0x88, 0xf1, 0xff,
+    0x79, 0x14, 0x22, 0x21, 0x0f, 0xcc, 0xd5, 0x8d, 0x51, 0x70, 0xbc, 0x8b,
+    0xed, 0x91, 0x08, 0x54, 0x14, 0x0d, 0x25, 0x63, 0x6e, 0x3f, 0xed, 0x3b,
+    0xc4, 0xa2, 0xbc, 0x1f, 0xf3, 0xaf, 0xd3, 0x24, 0xdd, 0x2a, 0x91, 0x0d,
+    0xd4, 0x48, 0x03, 0x4f, 0x0f, 0x9a, 0x4e, 0x04, 0xf2, 0x31, 0xe8, 0x37,
+    0x23, 0x4c, 0x9a, 0x86, 0x63, 0xfc, 0xe8, 0xd2, 0x45, 0x71, 0x83, 0x47,
+    0x49, 0xbb, 0x75, 0xf1, 0x77, 0xcf, 0x94, 0xd7, 0x6a, 0xfc, 0x80, 0x96,
+    0x0f, 0x73, 0xfb, 0x77, 0x83, 0xae, 0x5c, 0xc7, 0x8c, 0xa6, 0x5c, 0x74,
+    0x93, 0x0d, 0xba, 0x90, 0x8b, 0x6f, 0x60, 0xc4, 0xac, 0x17, 0x65, 0x9e,
+    0xa1, 0x5d, 0xcb, 0x2a, 0x95, 0x29, 0xbb, 0xcc, 0x47, 0xef, 0x71, 0xfb,
+    0x6d, 0xaf, 0xe9, 0x33, 0xba, 0x5e, 0x9a, 0xd4, 0xb5, 0xc5, 0x32, 0xc0,
+    0xd7, 0x46, 0xf3, 0x45, 0xcf, 0x9d, 0xd8, 0x84, 0xe1, 0xfe, 0xbc, 0xc8,
+    0x3a, 0xae, 0xfc, 0xde, 0xcc, 0x6e, 0xc7, 0xed, 0x44, 0x8c, 0x0d, 0x8a,
+    0xc8, 0x6e, 0x6f, 0xee, 0xf1, 0xf4, 0xc7, 0x33, 0xee, 0xa5, 0x93, 0xe0,
+    0xd3, 0xb8, 0xd1, 0x8f, 0x55, 0xc9, 0xf6, 0xeb, 0x61, 0x15, 0x22, 0xff,
+    0x9e, 0xe2, 0xee, 0xc6, 0xe5, 0x94, 0xd6, 0xe3, 0x7d, 0xbb, 0xaf, 0xa4,
+    0x4f, 0x55, 0xd8, 0x40, 0x4e, 0xcd, 0xd0, 0x4a, 0x50, 0xd6, 0x37, 0xfd,
+    0x4c, 0xcd, 0x01, 0xc9, 0x34, 0x63, 0xc0, 0x58, 0xe9, 0x45, 0x74, 0x09,
+    0x76, 0x15, 0x3b, 0xe7, 0x16, 0x0a, 0x4b, 0xb7, 0xd8, 0x22, 0xe6, 0x99,
+    0xce, 0x14, 0x2a, 0x49, 0x64, 0xe2, 0x99, 0x56, 0x8b, 0x9b, 0xb7, 0x04,
+    0x36, 0x94, 0x24, 0x85, 0x25, 0xd3, 0x19, 0xf6, 0x48, 0x22, 0x5a, 0xd9,
+    0x35, 0xb6, 0x44, 0x05, 0x6a, 0x66, 0x56, 0x16, 0x5d, 0xaa, 0x98, 0x0b,
+    0x33, 0x04, 0x0b, 0x14, 0x2c, 0x80, 0x5b, 0x6a, 0xaf, 0x75, 0xa1, 0x77,
+    0xb6, 0x93, 0x93, 0x5b, 0x44, 0xf3, 0xbe, 0x81, 0x25, 0xfb, 0xd6, 0x79,
+    0xe9, 0x36, 0x28, 0xe1, 0xdd, 0x96, 0x95, 0x4c, 0x56, 0xda, 0x45, 0x41,
+    0xfc, 0x25, 0xa1, 0xa0, 0x11, 0x2e, 0x31, 0x43, 0x97, 0x83, 0x0e, 0x29,
+    0x12, 0xc4, 0xf6, 0x28, 0x84, 0xa6, 0x9a, 0x12, 0x03, 0x5d, 0x6d, 0x8f,
+    0xa0, 0x22, 0x84, 0xeb, 0xf4, 0x36, 0x97, 0x69, 0x0f, 0x4d, 0x6d, 0xcb,
+    0x56, 0x1b, 0xe2, 0x0a, 0x93, 0x3b, 0x95, 0x50, 0x4e, 0xa2, 0x01, 0x8d,
+    0xe8, 0xcb, 0x50, 0xa4, 0xc6, 0xa9, 0xc1, 0x5b, 0xfc, 0xf3, 0x93, 0x9f,
+    0xd4, 0xf0, 0x44, 0xae, 0xca, 0x00, 0x39, 0x8a, 0xcd, 0x94, 0xe3, 0xfd,
+    0xfb, 0x52, 0xb2, 0x38, 0x5a, 0x12, 0xda, 0xeb, 0xe6, 0x11, 0x6f, 0x1d,
+    0x79, 0x66, 0xc8, 0x58, 0xe6, 0x21, 0x59, 0xe8, 0x5a, 0x4f, 0x66, 0xd2,
+    0x28, 0xdd, 0x0f, 0x02, 0x6d, 0xb7, 0xfe, 0x7e, 0x09, 0xe5, 0x2e, 0xc1,
+    0x04, 0x94, 0x37, 0x3c, 0x24, 0xdf, 0x5a, 0x32, 0x1b, 0x8e, 0xfd, 0xb8,
+    0xdd, 0x43, 0xb0, 0x64, 0x08, 0x5a, 0x3b, 0xca, 0x8c, 0x6a, 0x94, 0xac,
+    0x07, 0x27, 0xd6, 0x0f, 0x4d, 0x67, 0x9f, 0x2e, 0x83, 0x56, 0xab, 0xe7,
+    0x10, 0x70, 0x75, 0xf5, 0x56, 0xed, 0x81, 0x0c, 0x50, 0xe9, 0x70, 0x45,
+    0xb9, 0x8f, 0x6c, 0x3b, 0x45, 0xaf, 0x31, 0x22, 0xb4, 0x96, 0x64, 0xf8,
+    0x7d, 0xf8, 0xd3, 0xc3, 0xc6, 0xcb, 0xe7, 0x9b, 0xf9, 0xd9, 0x18, 0x46,
+    0x0e, 0x40, 0x85, 0x65, 0x85, 0xe7, 0x92, 0x13, 0x48, 0x52, 0xe9, 0xb5,
+    0x99, 0x7c, 0x1f, 0x4f, 0x71, 0xbb, 0x6b, 0x3e, 0x5e, 0xca, 0x02, 0x9a,
+    0x51, 0xf6, 0x51, 0xff, 0xe1, 0xdc, 0x8f, 0x1d, 0xf2, 0xbc, 0xa2, 0x03,
+    0x37, 0x26, 0x64, 0x68, 0x16, 0xda, 0xe7, 0x3b, 0x0e, 0x83, 0xfa, 0x30,
+    0xed, 0x2c, 0xd5, 0x20, 0x76, 0xc2, 0x2a, 0x04, 0x9a, 0x82, 0x80, 0x46,
+    0x6f, 0x02, 0xb1, 0x0f, 0xf3, 0xd6, 0x1d, 0x86, 0x1b, 0xc2, 0x7f, 0x51,
+    0xfc, 0x1f, 0xa2, 0xc8, 0x91, 0xdd, 0xda, 0xbc, 0xf0, 0x5e, 0x2e, 0x85,
+    0x02, 0x61, 0x01, 0xd1, 0xe7, 0x04, 0x9b, 0x2f, 0xc5, 0xfd, 0xcb, 0xfa,
+    0xae, 0x81, 0xe9, 0xe4, 0xa5, 0x3b, 0xf7, 0x87, 0xfe, 0x44, 0x64, 0x64,
+    0x67, 0x6d, 0xe0, 0xf7, 0x41, 0x2a, 0xbc, 0x34, 0x4d, 0xb9, 0x01, 0x22,
+    0x06, 0xbb, 0x9d, 0xc6, 0x4e, 0x81, 0xfd, 0xab, 0xe1, 0x60, 0x18, 0xc4,
+    0x0f, 0x76, 0x29, 0x63, 0x19, 0x18, 0x07, 0xbc, 0x3c, 0xb2, 0x14, 0x72,
+    0xb8, 0x47, 0x96, 0xe0, 0xda, 0x73, 0xf7, 0x01, 0x30, 0xd4, 0xa9, 0x60,
+    0x3e, 0xdc, 0xd2, 0xdb, 0x80, 0x4b, 0x84, 0xe0, 0xd2, 0xbd, 0x54, 0x07,
+    0x0d, 0x0c, 0x3e, 0x5f, 0x25, 0x5b, 0x87, 0x83, 0xff, 0xbd, 0x58, 0x19,
+    0x45, 0x56, 0xd9, 0x8a, 0x19, 0xc1, 0xc8, 0x7e, 0xc1, 0xdc, 0x00, 0xd9,
+    0x92, 0x93, 0x64, 0xac, 0xb0, 0x4a, 0x7b, 0xdc, 0x21, 0x19, 0x0d, 0xb1,
+    0x87, 0x41, 0x00, 0xf7, 0xca, 0xb4, 0xf3, 0x7a, 0xa6, 0x68, 0x04, 0x41,
+    0xcd, 0x35, 0xff, 0x37, 0x22, 0x6a, 0x32, 0xd1, 0x67, 0x00, 0x35, 0x06,
+    0x64, 0xe2, 0x6b, 0x40, 0xb1, 0x75, 0x87, 0x7d, 0x47, 0xad, 0xd8, 0x97,
+    0xe7, 0x1e, 0x78, 0x82, 0xee, 0xd3, 0x63, 0x2b, 0x27, 0x16, 0x97, 0x86,
+    0xce, 0xfe, 0x6c, 0x2c, 0xda, 0xcc, 0x8c, 0x62, 0xa7, 0xd7, 0x56, 0x00,
+    0x9a, 0x0c, 0x20, 0xe4, 0x94, 0x04, 0x3d, 0x7b, 0x55, 0xe7, 0xb7, 0x40,
+    0x24, 0x21, 0x4c, 0x03, 0xf0, 0x4a, 0xdd, 0x97, 0xd3, 0xc6, 0xde, 0x41,
+    0xda, 0x89, 0x79, 0x3c, 0x3e, 0xd9, 0x0d, 0x6b, 0x88, 0x00, 0xe3, 0x30,
+    0x5c, 0xea, 0xbf, 0xb9, 0x3b, 0x53, 0x71, 0x7c, 0xa0, 0x54, 0x8e, 0x2f,
+    0x9e, 0x6c, 0xe3, 0xab, 0x18, 0x7b, 0x75, 0xf6, 0x3f, 0xce, 0x27, 0x12,
+    0x35, 0x69, 0x15, 0x4b, 0x65, 0x7d, 0x7d, 0x58, 0xcf, 0xa0, 0x68, 0x0c,
+    0x0d, 0x56, 0xe4, 0x64, 0xea, 0xdb, 0xcb, 0xc7, 0x3c, 0xbc, 0x4f, 0xd5,
+    0x21, 0x24, 0x3f, 0x4a, 0x6e, 0xa4, 0x1b, 0xf3, 0x4e, 0xc9, 0xd6, 0xbe,
+    0x61, 0x5a, 0x05, 0x31, 0xfe, 0xb9, 0x4f, 0xb3, 0xf2, 0x84, 0x5a, 0x42,
+    0x14, 0x51, 0x09, 0x0f, 0x8d, 0x84, 0xb6, 0xde, 0x06, 0xc9, 0x0e, 0x11,
+    0x19, 0x53, 0xdf, 0xeb, 0xf3, 0x12, 0x3e, 0x13, 0x60, 0x5a, 0xa6, 0xa2,
+    0x3c, 0x0f, 0x07, 0xaf, 0x15, 0xdf, 0xf3, 0x53, 0x7a, 0x5c, 0x03, 0xa1,
+    0x6c, 0xac, 0x05, 0x4f, 0xbb, 0xa4, 0xde, 0xe6, 0x67, 0xf5, 0xb1, 0xa8,
+    0x20, 0x10, 0x43, 0xa4, 0x64, 0x64, 0xd7, 0x16, 0x79, 0xfc, 0x8f, 0x96,
+    0x38, 0x7e, 0x9a, 0x19, 0xf5, 0x5e, 0xf1, 0x4f, 0xd3, 0x9c, 0xc4, 0x39,
+    0xa7, 0x25, 0xa8, 0xfd, 0x64, 0x13, 0xa9, 0x71, 0xc6, 0xa8, 0x34, 0xfd,
+    0x67, 0xa7, 0x5a, 0xc9, 0x1d, 0xf3, 0x16, 0xc4, 0x9e, 0xce, 0x58, 0xdf,
+    0xca, 0x52, 0x80, 0x21, 0xa0, 0xd3, 0xbc, 0xfc, 0xbf, 0x53, 0xa8, 0xc4,
+    0x2c, 0x10, 0x7b, 0x18, 0x52, 0x3d, 0x73, 0x62, 0x99, 0xd0, 0x30, 0x8b,
+    0xa6, 0x21, 0x20, 0xdb, 0x4f, 0xbf, 0xaf, 0x65, 0x39, 0xf3, 0x68, 0xf9,
+    0x1d, 0x8e, 0x16, 0x91, 0x8b, 0x66, 0xd9, 0xe8, 0x7c, 0x17, 0xa3, 0x8d,
+    0x7c, 0x25, 0x47, 0x9f, 0xc2, 0x7f, 0x0e, 0x48, 0x23, 0x26, 0x6d, 0x43,
+    0x80, 0x01, 0x33, 0xd1, 0xdc, 0x3a, 0xf7, 0xca, 0x49, 0x15, 0xa7, 0xf1,
+    0x2c, 0x02, 0x87, 0x54, 0x66, 0x85, 0xd5, 0x7d, 0x53, 0xf1, 0xb8, 0xf3,
+    0x2c, 0x4a, 0x8b, 0xf0, 0x32, 0x64, 0xcf, 0xf3, 0xa0, 0x16, 0x8c, 0x00,
+    0x36, 0x2b, 0x6a, 0x55, 0xa1, 0x60, 0x2c, 0xa1, 0x35, 0x52, 0xbc, 0x95,
+    0x93, 0x07, 0x63, 0x08, 0x9a, 0x69, 0xea, 0x0d, 0x48, 0x7e, 0x52, 0xf6,
+    0x8a, 0x62, 0x4f, 0x06, 0xbf, 0x9f, 0x12, 0x97, 0x10, 0xd7, 0xc8, 0xfe,
+    0x42, 0x7d, 0xf1, 0x97, 0x40, 0x0b, 0x20, 0xa5, 0x21, 0xe5, 0x8f, 0xb4,
+    0x16, 0xd3, 0x72, 0x4f, 0x21, 0xdc, 0x59, 0xc0, 0x86, 0x5e, 0x00, 0x25,
+    0x6c, 0xcc, 0x21, 0x27, 0x80, 0x7b, 0x57, 0xc4, 0x81, 0xb0, 0x81, 0x4f,
+    0x89, 0x31, 0x29, 0xc6, 0x7d, 0xa5, 0x84, 0x51, 0xde, 0x37, 0x69, 0x79,
+    0x3a, 0x2c, 0x62, 0x4e, 0x54, 0x0d, 0xed, 0xcf, 0x07, 0x37, 0x9d, 0x35,
+    0x2c, 0xf6, 0x07, 0xdd, 0x3c, 0x34, 0x05, 0x57, 0xc8, 0xb2, 0x82, 0xaf,
+    0x1f, 0xf8, 0x40, 0x49, 0xd1, 0x01, 0x3d, 0x01, 0x7b, 0x8b, 0x90, 0x2d,
+    0x13, 0xc8, 0xa9, 0x6b, 0x5f, 0x09, 0x03, 0x06, 0xdf, 0x8a, 0xfc, 0x76,
+    0xd5, 0xd0, 0x98, 0x54, 0x53, 0x65, 0x4a, 0x80, 0xb1, 0x68, 0x8a, 0x1c,
+    0x22, 0x23, 0xa2, 0x76, 0x02, 0xa0, 0x79, 0x54, 0x72, 0x1a, 0xe1, 0xf0,
+    0x00, 0x00, 0x01, 0x50, 0x01, 0x84, 0x0d, 0x02, 0x00, 0x0a, 0x02, 0xb2,
+    0x00, 0x05, 0x31, 0xc2, 0x00, 0x05, 0x0b, 0x85, 0x80, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x01, 0xe0, 0x24, 0xff, 0xfa, 0x2c, 0x98, 0xf4, 0x20, 0xfa,
+    0xdb, 0x11, 0xe8, 0x7c, 0x39, 0xb2, 0xf8, 0x88, 0xb6, 0xe6, 0x62, 0x9d,
+    0xa9, 0x55, 0x8a, 0xb2, 0x14, 0xe4, 0x7a, 0x43, 0x8e, 0x31, 0x15, 0xe6,
+    0x41, 0x66, 0x2b, 0xf8, 0xd0, 0xd2, 0x63, 0x21, 0x65, 0x84, 0x93, 0x90,
+    0xa3, 0x80, 0x1a, 0xff, 0x18, 0xde, 0x70, 0x35, 0x9f, 0x6e, 0x7b, 0xf9,
+    0x87, 0xb0, 0x7a, 0xf6, 0x30, 0x92, 0x19, 0x73, 0x95, 0x30, 0x9d, 0x45,
+    0x3d, 0xd0, 0xce, 0x4c, 0x59, 0x95, 0xd9, 0xc3, 0xcd, 0x57, 0xcf, 0x90,
+    0xac, 0x4f, 0x99, 0xc9, 0x80, 0x67, 0x36, 0x56, 0x08, 0x9d, 0x9c, 0x51,
+    0x58, 0x18, 0xd3, 0xe2, 0x5e, 0x5c, 0xdf, 0x20, 0xd3, 0x61, 0x95, 0x77,
+    0x61, 0x3b, 0x83, 0xf3, 0xe7, 0x6e, 0xfb, 0xff, 0x00, 0xd2, 0xbc, 0xb2,
+    0x08, 0xf2, 0x2d, 0x93, 0x86, 0xf1, 0x33, 0x84, 0x8a, 0x18, 0x1c, 0xd7,
+    0xca, 0xf6, 0x94, 0x0e, 0xd6, 0x98, 0x01, 0xe1, 0x70, 0x21, 0x24, 0xe9,
+    0x9f, 0x09, 0xb4, 0xc1, 0x40, 0x84, 0xcd, 0xe0, 0xb6, 0x57, 0x0a, 0x9c,
+    0x4a, 0x0d, 0x3b, 0xa1, 0xb5, 0xfe, 0xc9, 0xad, 0xea, 0x41, 0x33, 0xb3,
+    0xbb, 0x62, 0x90, 0x6f, 0x8c, 0x6f, 0x06, 0xeb, 0x8c, 0xea, 0x91, 0x11,
+    0x3f, 0x06, 0xd9, 0x00, 0x89, 0x96, 0x6c, 0xcf, 0xec, 0x1c, 0xaf, 0x80,
+    0xf6, 0xb5, 0x0c, 0x51, 0x01, 0x96, 0x29, 0x27, 0xc6, 0x24, 0x68, 0x8a,
+    0x6e, 0xaa, 0x53, 0xa9, 0x8b, 0xf7, 0xe4, 0x46, 0x8b, 0x5b, 0x1e, 0x82,
+    0xa4, 0x93, 0x0b, 0xfa, 0xd2, 0xf2, 0xda, 0x03, 0x96, 0xe1, 0x79, 0x35,
+    0x72, 0xb8, 0xd6, 0xa9, 0xe0, 0x24, 0xc3, 0xa2, 0xca, 0xa6, 0x1f, 0x4f,
+    0x7a, 0xa8, 0x71, 0x51, 0x5d, 0x38, 0x11, 0x2c, 0x9e, 0x6d, 0xcd, 0xfb,
+    0xb5, 0x19, 0x65, 0xcd, 0x1c, 0x37, 0xdb, 0xe1, 0xa4, 0x6e, 0x34, 0x8d,
+    0x06, 0xc7, 0xe1, 0x44, 0xc6, 0x69, 0x71, 0x02, 0x43, 0x5f, 0xa3, 0xe0,
+    0xb6, 0x2d, 0x6e, 0x3b, 0x52, 0xc9, 0x51, 0x2a, 0x01, 0x68, 0xf4, 0x46,
+    0x00, 0xac, 0x7f, 0x63, 0xdb, 0x84, 0xde, 0xd8, 0x2e, 0xa5, 0x8b, 0xd1,
+    0x7a, 0x3d, 0xb8, 0x00, 0x2f, 0x8c, 0x48, 0x0c, 0xa5, 0xa8, 0x68, 0x74,
+    0xf5, 0xeb, 0xc7, 0x74, 0xb1, 0x32, 0x8d, 0x2a, 0x2d, 0x33, 0xe3, 0xc5,
+    0x82, 0xd3, 0xf3, 0xbb, 0x53, 0xcc, 0xfb, 0xd5, 0xab, 0xe3, 0x6a, 0x61,
+    0x1b, 0x32, 0x9c, 0xd4, 0xbf, 0xdf, 0x94, 0x87, 0x88, 0x17, 0x57, 0x5a,
+    0xce, 0xa1, 0xbb, 0x3e, 0xf9, 0x77, 0xdc, 0x3a, 0xe6, 0xf1, 0x8b, 0x81,
+    0x6f, 0xc7, 0xd0, 0x11, 0xbf, 0x1b, 0x3c, 0x27, 0x08, 0xb7, 0xff, 0x19,
+    0x3e, 0x3f, 0x73, 0xf6, 0x50, 0xfc, 0x0a, 0x49, 0x91, 0x33, 0xe2, 0xe2,
+    0x57, 0x2a, 0x79, 0x8e, 0x7e, 0x25, 0xaa, 0x77, 0xbc, 0x6d, 0x51, 0x14,
+    0x00, 0xfa, 0x01, 0x42, 0x82, 0x79, 0x99, 0x3a, 0x26, 0x06, 0xc1, 0xa1,
+    0xcd, 0xf2, 0x44, 0x53, 0x27, 0xff, 0xbb, 0xff, 0x35, 0x68, 0xcd, 0x36,
+    0xc4, 0xe0, 0xd7, 0x40, 0x14, 0xe0, 0xd7, 0x68, 0x6a, 0xca, 0xe9, 0x42,
+    0xa3, 0x22, 0xf9, 0x19, 0x85, 0x24, 0xe6, 0x79, 0x3d, 0xbc, 0xf7, 0xac,
+    0xf0, 0x33, 0xfa, 0x79, 0x5e, 0xd9, 0x78, 0xe7, 0x99, 0x0f, 0x40, 0x89,
+    0xf8, 0x13, 0x5c, 0xbf, 0x1b, 0x51, 0x4a, 0x04, 0x71, 0x61, 0x66, 0x8e,
+    0x61, 0x7c, 0x40, 0xc8, 0x10, 0x97, 0x26, 0x22, 0x8a, 0x87, 0xb1, 0x6f,
+    0x12, 0x3d, 0x53, 0x2f, 0xde, 0x39, 0x7c, 0xa3, 0x2f, 0xad, 0xec, 0x0f,
+    0x7d, 0x49, 0x54, 0x51, 0x26, 0x07, 0x81, 0x8d, 0xc9, 0x9c, 0x8d, 0xce,
+    0xa5, 0x61, 0x96, 0x1f, 0x75, 0x56, 0x5d, 0x68, 0xf8, 0xe0, 0x52, 0xd7,
+    0xe9, 0x03, 0x37, 0xd5, 0x08, 0x5d, 0x5b, 0x62, 0x4d, 0x99, 0x55, 0x6d,
+    0x96, 0x3f, 0x41, 0x5f, 0xa5, 0xe1, 0x4e, 0x2f, 0xf9, 0x29, 0x73, 0xcd,
+    0x6b, 0x95, 0x04, 0x36, 0xdb, 0x27, 0x6b, 0x93, 0xe1, 0xae, 0x7f, 0x28,
+    0xcd, 0xa1, 0x82, 0xcc, 0xa9, 0x65, 0x8d, 0x5e, 0x93, 0x4a, 0x79, 0xa7,
+    0xea, 0x4d, 0x45, 0xc3, 0x7a, 0x78, 0x65, 0x13, 0x1d, 0xe0, 0x39, 0x79,
+    0x05, 0x41, 0xea, 0x01, 0xb9, 0x0b, 0x62, 0xf7, 0xf0, 0xcc, 0x96, 0xc0,
+    0x88, 0x5d, 0x73, 0x5b, 0xbe, 0xc6, 0xe5, 0x0c, 0x3f, 0x8c, 0xc5, 0x88,
+    0x33, 0x54, 0xbf, 0x28, 0x1b, 0x33, 0xd0, 0x78, 0x41, 0x88, 0x7c, 0x95,
+    0x6e, 0x32, 0x1a, 0x4f, 0x75, 0x59, 0x07, 0x0a, 0x17, 0x58, 0x00, 0x3b,
+    0x67, 0xe2, 0x9f, 0x42, 0xb5, 0xb9, 0x7d, 0xa8, 0xce, 0x7e, 0x6b, 0x7a,
+    0xf3, 0x9c, 0x3c, 0x4c, 0xe3, 0x4b, 0x2e, 0x4b, 0xde, 0x7d, 0x20, 0x80,
+    0x98, 0x98, 0x3e, 0xbd, 0x1f, 0xea, 0x95, 0xec, 0xb9, 0xdd, 0x4e, 0xce,
+    0x64, 0x10, 0x35, 0xf4, 0xb3, 0x80, 0xea, 0x5d, 0x6a, 0xd4, 0x72, 0xf8,
+    0xf2, 0x8b, 0xe6, 0xbf, 0x4d, 0x8d, 0xc1, 0x9e, 0x1f, 0x84, 0xf0, 0xa2,
+    0x64, 0x4e, 0x93, 0x6f, 0x40, 0x15, 0x0f, 0x79, 0x43, 0x1b, 0x9a, 0xc1,
+    0x7f, 0x32, 0x02, 0xbb, 0x94, 0xf2, 0xcd, 0x4c, 0x15, 0x51, 0x30, 0x9d,
+    0x45, 0x70, 0x57, 0x05, 0x2b, 0x96, 0xfb, 0x07, 0x30, 0x9d, 0x79, 0x7e,
+    0xdd, 0x87, 0x6a, 0x1c, 0x2b, 0xab, 0x2b, 0xff, 0x7a, 0x01, 0x1e, 0xf0,
+    0x62, 0xb5, 0x21, 0x2a, 0xfa, 0x04, 0xf3, 0xeb, 0x7c, 0xc5, 0x9c, 0x57,
+    0x1b, 0x51, 0x63, 0xac, 0x99, 0xc8, 0xbc, 0x09, 0xfc, 0x99, 0x96, 0x6f,
+    0x01, 0xc3, 0xb0, 0xb2, 0x2a, 0x02, 0x8f, 0xd7, 0x57, 0x6c, 0x16, 0xd3,
+    0xf8, 0x03, 0x72, 0xb1, 0x12, 0x32, 0xb6, 0xf9, 0x00, 0xf3, 0x20, 0x2e,
+    0x9d, 0x47, 0x5f, 0xa6, 0x24, 0x8d, 0xbf, 0x9f, 0x59, 0xd0, 0x7d, 0xb2,
+    0xd7, 0xff, 0xae, 0x20, 0x19, 0x06, 0x01, 0xd5, 0x2c, 0xea, 0x57, 0x6c,
+    0xb8, 0x91, 0x58, 0x21, 0x04, 0x86, 0x5c, 0xb1, 0x16, 0x1d, 0xdd, 0xef,
+    0x4c, 0xa7, 0x7c, 0x08, 0x94, 0xe3, 0xe7, 0xc8, 0x20, 0x4d, 0x00, 0x86,
+    0x0e, 0x62, 0xcf, 0x75, 0x88, 0x7c, 0x2b, 0x0a, 0xe0, 0x86, 0xc6, 0x53,
+    0x14, 0xae, 0x79, 0x1d, 0xe0, 0x07, 0x69, 0x92, 0x87, 0x5c, 0xaa, 0xde,
+    0x08, 0x5c, 0xac, 0x58, 0x87, 0x8c, 0x0c, 0x23, 0xe1, 0x86, 0x72, 0xf2,
+    0xd7, 0x0e, 0xfa, 0xab, 0xf4, 0xc2, 0xa0, 0xc0, 0x0f, 0xf7, 0x0b, 0xc3,
+    0xe2, 0x1f, 0xf7, 0xab, 0x1e, 0x7d, 0xd3, 0x26, 0x5b, 0x06, 0xb4, 0x05,
+    0x28, 0x1f, 0xfb, 0xa0, 0x7c, 0x66, 0xbd, 0xf8, 0x7e, 0x06, 0x4f, 0x18,
+    0xa7, 0x6a, 0x1a, 0x4d, 0xa4, 0x38, 0x3e, 0xb3, 0xd9, 0x36, 0x05, 0xab,
+    0xa9, 0x09, 0xf4, 0x5c, 0x63, 0xf9, 0xe7, 0xad, 0x7b, 0xfb, 0x93, 0x2d,
+    0xf6, 0x8a, 0xb9, 0x45, 0x09, 0x13, 0x8d, 0x2c, 0xf9, 0x7b, 0xdc, 0x6b,
+    0x15, 0x15, 0xf6, 0x1a, 0x6e, 0x1c, 0xce, 0xdc, 0xd9, 0x37, 0x56, 0x53,
+    0x2a, 0x37, 0x2a, 0x63, 0xee, 0x32, 0x88, 0xf5, 0x1e, 0x20, 0x93, 0xb3,
+    0x46, 0xac, 0xe3, 0xc9, 0x53, 0xb8, 0x54, 0x6d, 0xc0, 0xfb, 0x22, 0x4c,
+    0x35, 0x01, 0x04, 0xe1, 0xb6, 0x25, 0xec, 0x5a, 0x01, 0x7c, 0x0e, 0x93,
+    0xf7, 0x71, 0xc0, 0x99, 0xc3, 0x3e, 0x86, 0x9a, 0x25, 0xfe, 0xf6, 0x25,
+    0x34, 0x35, 0x37, 0x7f, 0x1b, 0x89, 0xff, 0x55, 0x24, 0xed, 0xd8, 0x82,
+    0x94, 0xdd, 0x83, 0x19, 0x78, 0x7d, 0xd8, 0x00, 0x00, 0x01, 0x50, 0x01,
+    0x84, 0x0d, 0x02, 0x00, 0x0a, 0x05, 0x32, 0x00, 0x05, 0x2e, 0xba, 0x00,
+    0x05, 0x0d, 0x39, 0x80,
+};
+
+/* 8 bit 4:4:4, all I pictures, x265 does not match its own hashes on
+ * 4:4:4 inter ones
+ */
+static const uint8_t stream_y444[3736] = {
+    0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0x0c, 0x01, 0xff, 0xff, 0x04, 0x08,
+    0x00, 0x00, 0x03, 0x00, 0x9e, 0x28, 0x00, 0x00, 0x03, 0x00, 0x00, 0x1e,
+    0xba, 0x02, 0x40, 0x00, 0x00, 0x00, 0x01, 0x42, 0x01, 0x01, 0x04, 0x08,
+    0x00, 0x00, 0x03, 0x00, 0x9e, 0x28, 0x00, 0x00, 0x03, 0x00, 0x00, 0x1e,
+    0x90, 0x04, 0x10, 0x20, 0xb2, 0xdd, 0x49, 0x26, 0x57, 0x34, 0x04, 0x00,
+    0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x64, 0x20, 0x00, 0x00,
+    0x00, 0x01, 0x44, 0x01, 0xc1, 0x72, 0x86, 0x0c, 0x02, 0x24, 0x00, 0x00,
+    0x01, 0x28, 0x01, 0xaf, 0x09, 0xe0, 0x69, 0x20, 0x25, 0x5b, 0xae, 0xf2,
+    0xed, 0x0e, 0x24, 0xdf, 0xf9, 0x58, 0x3e, 0xff, 0x0c, 0xef, 0x36, 0xf6,
+    0x3b, 0x60, 0x78, 0x32, 0x48, 0xfa, 0x02, 0xb6, 0xf7, 0x07, 0x30, 0x24,
+    0x64, 0x77, 0x0c, 0xce, 0x18, 0x29, 0xbf, 0x2b, 0x4b, 0x85, 0x90, 0x26,
+    0xb7, 0xc1, 0x33, 0x0f, 0x73, 0xd2, 0x86, 0x65, 0xa1, 0x29, 0x6f, 0xfc,
+    0xcc, 0x1c, 0xe5, 0x68, 0x72, 0xdc, 0xc5, 0xab, 0x33, 0x44, 0x95, 0xb9,
+    0x67, 0x3a, 0x11, 0x31, 0x0f, 0xeb, 0xe9, 0xc6, 0x53, 0x05, 0xd3, 0xa6,
+    0x7e, 0xf2, 0x56, 0x46, 0x88, 0xff, 0xaa, 0x92, 0x1c, 0x39, 0x56, 0x38,
+    0x21, 0xe6, 0x97, 0x40, 0x5f, 0xfb, 0xd1, 0x4f, 0xc4, 0xea, 0xb5, 0xbc,
+    0x6a, 0xbb, 0xff, 0x73, 0x3c, 0xee, 0x9c, 0xe9, 0x81, 0x1b, 0x00, 0xee,
+    0xfc, 0x2e, 0x06, 0x15, 0xa8, 0x93, 0x26, 0x8f, 0x8a, 0x25, 0x9b, 0x07,
+    0xa1, 0x33, 0x66, 0x4b, 0xad, 0xed, 0xd9, 0x47, 0xa7, 0xcd, 0x99, 0x2d,
+    0x4e, 0xe9, 0xca, 0x12, 0xb9, 0x1e, 0xf3, 0x40, 0x75, 0x66, 0xe4, 0x9e,
+    0x52, 0xba, 0xeb, 0x4d, 0xa2, 0xf9, 0xf3, 0x53, 0xa0, 0x74, 0x66, 0xba,
+    0x93, 0x94, 0x04, 0x5d, 0x6f, 0x88, 0x5d, 0x8d, 0xb4, 0x91, 0x39, 0x60,
+    0x52, 0x7e, 0xab, 0x2f, 0x0f, 0xfb, 0x44, 0x87, 0xbb, 0xaf, 0x46, 0x2d,
+    0x5c, 0x64, 0xa0, 0x2c, 0x58, 0xf0, 0x8f, 0x11, 0x80, 0x59, 0x06, 0x13,
+    0xed, 0x58, 0xc0, 0x98, 0x48, 0x25, 0xa0, 0x19, 0xeb, 0xeb, 0xa0, 0xbb,
+    0xd4, 0x7c, 0x68, 0x48, 0xe2, 0xef, 0xe8, 0x18, 0xfe, 0x20, 0x0e, 0x4e,
+    0xdb, 0x68, 0x0f, 0xce, 0xdf, 0x5c, 0xc8, 0x79, 0xba, 0x4b, 0x49, 0x06,
+    0x8e, 0x5a, 0x51, 0xae, 0xc9, 0xb9, 0x59, 0x0c, 0x5c, 0xd9, 0x6c, 0xfd,
+    0x40, 0xde, 0x9f, 0xa9, 0xee, 0x5d, 0x8d, 0x60, 0x8f, 0x23, 0x18, 0x43,
+    0x6e, 0x22, 0x09, 0x31, 0xab, 0xe9, 0xe3, 0xd2, 0x8a, 0x59, 0x82, 0x0a,
+    0xf3, 0xa2, 0xd3, 0x5d, 0x66, 0xe5, 0xbd, 0xf5, 0x07, 0x2c, 0x9d, 0x17,
+    0x37, 0x10, 0xf0, 0xd2, 0x55, 0x52, 0xc6, 0x21, 0x93, 0xd4, 0x51, 0x13,
+    0xde, 0x7f, 0x5e, 0x56, 0xac, 0xe6, 0xf3, 0xa0, 0x9c, 0x82, 0x37, 0x14,
+    0xd0, 0x4f, 0xb3, 0xc1, 0x1c, 0x02, 0x1a, 0x14, 0x77, 0x21, 0x7f, 0xe7,
+    0xda, 0x23, 0x6a, 0x8d, 0xf1, 0x45, 0x9c, 0xae, 0xab, 0x41, 0x8e, 0xd8,
+    0x66, 0x1a, 0x45, 0x59, 0xce, 0xb9, 0x93, 0x1f, 0x4c, 0xee, 0xf7, 0x56,
+    0x2b, 0x4b, 0xe9, 0x8b, 0xfa, 0xc8, 0x1a, 0xf5, 0x21, 0x85, 0xd5, 0x03,
+    0xf4, 0x96, 0x7a, 0xd8, 0xb1, 0xb3, 0xac, 0x48, 0x2e, 0x90, 0xc3, 0x4f,
+    0x44, 0xa4, 0x70, 0x74, 0x9a, 0xcc, 0x57, 0xbd, 0x13, 0x36, 0x74, 0x13,
+    0xcb, 0x9b, 0x28, 0x72, 0xe4, 0x12, 0x5d, 0x35, 0xea, 0x25, 0x4f, 0xcc,
+    0xb1, 0xa1, 0xa9, 0xf9, 0xd3, 0x12, 0x2f, 0xee, 0xde, 0x18, 0xc9, 0xde,
+    0x8e, 0x3e, 0x5d, 0xb0, 0xe3, 0xc5, 0xce, 0xf7, 0xb4, 0x24, 0x64, 0x31,
+    0xbd, 0x98, 0xaf, 0xca, 0xb4, 0x44, 0x5f, 0xcc, 0x34, 0x97, 0xd1, 0xa4,
+    0x0a, 0xfc, 0xbe, 0x70, 0xe6, 0x60, 0xcd, 0x8c, 0x42, 0xba, 0x70, 0x14,
+    0x02, 0xa6, 0xec, 0x01, 0xdf, 0xe2, 0xc3, 0xb4, 0xa1, 0x17, 0x65, 0x2d,
+    0x19, 0xf9, 0x4d, 0xa9, 0x9e, 0x1f, 0x5f, 0x78, 0x21, 0xe8, 0x56, 0x06,
+    0x81, 0xdf, 0x60, 0xe3, 0x03, 0x1c, 0x21, 0x1e, 0x75, 0x99, 0xf8, 0x43,
+    0x79, 0xa8, 0x2b, 0xb1, 0x37, 0x6c, 0x72, 0x42, 0xaa, 0x54, 0x72, 0x51,
+    0x0e, 0x2f, 0x08, 0x9d, 0x43, 0xae, 0x80, 0x82, 0x1f, 0x8f, 0x37, 0x50,
+    0x2e, 0x1e, 0x0b, 0x07, 0xe6, 0xd6, 0x33, 0x16, 0x98, 0xca, 0x84, 0x8c,
+    0x9b, 0x49, 0x9a, 0x47, 0x32, 0x83, 0x28, 0x77, 0x06, 0x64, 0x60, 0xfe,
+    0x12, 0x37, 0x07, 0x79, 0xe4, 0x12, 0x68, 0x28, 0xc9, 0x43, 0x39, 0x84,
+    0x2d, 0x71, 0x44, 0x19, 0x21, 0x50, 0x0f, 0x57, 0xf2, 0xf8, 0x4f, 0x14,
+    0x95, 0x98, 0xd9, 0xde, 0x7e, 0x58, 0x6f, 0x10, 0x21, 0x81, 0x16, 0xab,
+    0x6e, 0x3c, 0x7a, 0x4c, 0x3a, 0xf0, 0xf0, 0x4c, 0xd4, 0x7e, 0xcd, 0x91,
+    0xac, 0x02, 0x77, 0xa4, 0x4b, 0x2f, 0xdb, 0xe4, 0xc4, 0xc2, 0xdf, 0x74,
+    0x11, 0xdc, 0xd3, 0xec, 0xf3, 0x25, 0x25, 0x81, 0x60, 0xf7, 0x3e, 0x6f,
+    0x49, 0x1b, 0xc1, 0xad, 0x52, 0x35, 0xe3, 0x47, 0x47, 0x76, 0x0c, 0x20,
+    0x5d, 0x2e, 0x2f, 0xc3, 0xf9, 0xc7, 0xe7, 0x00, 0x2a, 0xf8, 0xbe, 0xd7,
+    0x8f, 0xf9, 0xe4, 0xb3, 0xa1, 0xb5, 0x80, 0x04, 0xc7, 0x03, 0x08, 0x5d,
+    0x6c, 0x6c, 0x4a, 0x20, 0x3c, 0x41, 0x1b, 0xab, 0xf9, 0x03, 0xf2, 0x87,
+    0xc5, 0x26, 0xc4, 0x46, 0xf3, 0x2a, 0x7e, 0x35, 0x1d, 0x86, 0xd3, 0x76,
+    0x5e, 0x7d, 0xb9, 0xd9, 0x6d, 0x59, 0xdc, 0xaa, 0x4a, 0x4e, 0x8e, 0x40,
+    0x96, 0x19, 0xd5, 0xf2, 0x0d, 0xb3, 0x11, 0xeb, 0xbc, 0x5c, 0x83, 0x6b,
+    0x9f, 0xcf, 0xdc, 0x32, 0x0b, 0xf2, 0x9a, 0x88, 0x66, 0xc7, 0x05, 0xdb,
+    0xa7, 0xbd, 0xdb, 0x35, 0x2f, 0x64, 0xff, 0xf7, 0x58, 0x8b, 0x89, 0x49,
+    0x56, 0x14, 0xf2, 0xee, 0x2d, 0x1b, 0x0c, 0x5b, 0x46, 0xe9, 0xa0, 0x80,
+    0xc9, 0x2b, 0x49, 0x2d, 0x0f, 0xa1, 0x4f, 0xa7, 0xbd, 0xff, 0xe4, 0xee,
+    0x98, 0xf5, 0xa1, 0x89, 0xe7, 0x64, 0x33, 0x45, 0x4f, 0xba, 0x34, 0x06,
+    0x7c, 0x64, 0x3f, 0xff, 0x65, 0x69, 0x07, 0xc8, 0x88, 0x3d, 0xad, 0x34,
+    0xa2, 0x99, 0xaa, 0x7c, 0x7e, 0x72, 0x54, 0xb7, 0xb1, 0x88, 0x37, 0x63,
+    0x02, 0x58, 0xf1, 0x35, 0x92, 0x96, 0x41, 0x5a, 0xbd, 0x5a, 0x78, 0x96,
+    0x64, 0xcd, 0x27, 0xad, 0xb3, 0x04, 0xc6, 0xc2, 0x05, 0xaf, 0x43, 0x96,
+    0x81, 0x68, 0xae, 0xd6, 0xfe, 0xe6, 0x97, 0x7f, 0x7f, 0x1a, 0x35, 0x55,
+    0x8b, 0x5e, 0x98, 0xa2, 0x4f, 0xe4, 0xe2, 0xe3, 0x28, 0x86, 0xc5, 0x77,
+    0x56, 0x11, 0x88, 0x0c, 0xa0, 0x79, 0xa2, 0x57, 0x23, 0xe0, 0xa7, 0xd2,
+    0x0c, 0xce, 0xbe, 0x31, 0x30, 0x49, 0x57, 0x4f, 0xcd, 0xfa, 0xab, 0xf1,
+    0x1d, 0xe3, 0xb3, 0x76, 0xbf, 0xf3, 0x25, 0x4c, 0x94, 0x7a, 0xba, 0xb5,
+    0xd9, 0x74, 0xa4, 0x64, 0x6d, 0xd6, 0x11, 0x25, 0x6f, 0x4e, 0xc9, 0xc2,
+    0x90, 0xad, 0x46, 0x9e, 0x4b, 0x20, 0xf9, 0xf5, 0x98, 0x64, 0xc5, 0xb3,
+    0xe0, 0x1b, 0x65, 0xf7, 0x7c, 0xf2, 0xdf, 0x4d, 0x4c, 0x7d, 0xd6, 0x91,
+    0x6d, 0x58, 0x75, 0x0f, 0xaa, 0x9b, 0xed, 0x99, 0xd7, 0x32, 0xbd, 0x94,
+    0x6c, 0xe3, 0x4b, 0xb2, 0xd1, 0xcc, 0x13, 0x6a, 0xfe, 0xb9, 0xf0, 0x4c,
+    0xb1, 0xd0, 0x1d, 0xf2, 0x58, 0x8e, 0x60, 0x80, 0x0b, 0x06, 0x99, 0x54,
+    0x6b, 0xdc, 0x7f, 0x26, 0x06, 0x39, 0xa1, 0x2d, 0xd6, 0x13, 0x9a, 0xf0,
+    0x6f, 0x3a, 0xca, 0x49, 0x7c, 0x31, 0x3d, 0x8f, 0xfb, 0x2f, 0x5d, 0xd7,
+    0x1f, 0x50, 0xdf, 0x5a, 0xfd, 0x58, 0x9a, 0xdd, 0x1b, 0xc5, 0xb9, 0x3a,
+    0xc4, 0xbe, 0x67, 0xb0, 0x66, 0x71, 0xee, 0xc5, 0xcd, 0xe7, 0xe8, 0x34,
+    0x4c, 0x06, 0x8f, 0x4e, 0xc3, 0x01, 0xf4, 0x35, 0x12, 0x6f, 0xb1, 0xc1,
+    0x9d, 0xc4, 0x73, 0x7d, 0x9b, 0x0e, 0x8c, 0x76, 0x2b, 0x45, 0x58, 0x3d,
+    0x8f, 0x8d, 0x01, 0xdc, 0x2f, 0xe9, 0x16, 0xc3, 0xe0, 0x08, 0x2f, 0x7d,
+    0x72, 0x7a, 0x12, 0x13, 0x62, 0x68, 0xbe, 0xd3, 0x45, 0x9f, 0xc3, 0xac,
+    0xf0, 0xec, 0x3b, 0x19, 0x2b, 0xc4, 0x4e, 0x1e, 0x38, 0xe8, 0x4a, 0x4b,
+    0xc1, 0xf6, 0x16, 0xf9, 0xd7, 0x3a, 0xde, 0x4b, 0xbc, 0x33, 0xd1, 0x3d,
+    0x15, 0x1b, 0x87, 0x2d, 0xae, 0x4f, 0x8b, 0xdc, 0x61, 0x84, 0x66, 0xf9,
+    0xd0, 0x89, 0x86, 0x2e, 0x2e, 0xe7, 0xb2, 0x3c, 0xb6, 0xd1, 0x94, 0xff,
+    0xd9, 0xf9, 0x1a, 0x07, 0x46, 0x9a, 0x74, 0x28, 0x7c, 0x94, 0x36, 0x38,
+    0x76, 0xd6, 0xad, 0xcd, 0x03, 0x72, 0xc7, 0xc7, 0x3f, 0xe0, 0xc5, 0x0d,
+    0xe2, 0x77, 0xdc, 0x69, 0x72, 0xcf, 0x2f, 0x28, 0x66, 0x7a, 0x39, 0xb2,
+    0x22, 0x5f, 0x3a, 0x18, 0xc3, 0x63, 0xa8, 0xf0, 0x9d, 0x59, 0x10, 0x5f,
+    0x9f, 0x39, 0x19, 0x30, 0xae, 0x22, 0xe5, 0x4f, 0x81, 0x04, 0xef, 0xf3,
+    0xa5, 0xad, 0x5e, 0x58, 0xb9, 0xde, 0xd8, 0x34, 0x5b, 0x07, 0xdc, 0x92,
+    0x9f, 0x17, 0x58, 0x9c, 0x21, 0x7b, 0x2d, 0xc6, 0xf7, 0xe9, 0x17, 0x84,
+    0x08, 0xef, 0x91, 0x87, 0x1e, 0xd8, 0x91, 0xf0, 0x80, 0x2b, 0xbb, 0x71,
+    0x30, 0xf6, 0x32, 0x80, 0xdc, 0xe5, 0x57, 0xda, 0x32, 0x80, 0x64, 0x14,
+    0x73, 0x8a, 0xc6, 0xd8, 0x24, 0x0f, 0x3c, 0xb3, 0x97, 0xcd, 0xc4, 0xa7,
+    0x87, 0x1a, 0x0a, 0x71, 0xad, 0xaf, 0xaf, 0x28, 0x39, 0xe3, 0xa5, 0x51,
+    0x7b, 0xd6, 0xc9, 0x2b, 0x5f, 0x22, 0x66, 0x08, 0x90, 0xdf, 0x8a, 0x43,
+    0x0e, 0x62, 0xbc, 0x2c, 0xc8, 0x31, 0xb4, 0x11, 0xfd, 0xc7, 0xa8, 0x6a,
+    0x91, 0xea, 0x84, 0x1c, 0x34, 0x45, 0xb9, 0xaf, 0xcd, 0x76, 0xdc, 0x74,
+    0x31, 0xf1, 0x48, 0x93, 0x6c, 0x6c, 0xfd, 0x59, 0x0b, 0xb8, 0x48, 0x78,
+    0x9c, 0xb2, 0xce, 0x66, 0x0b, 0xe6, 0xe6, 0xbf, 0xed, 0x0a, 0x7c, 0x4f,
+    0xf7, 0x11, 0xeb, 0xfb, 0x62, 0x9d, 0x96, 0x55, 0xfa, 0xa2, 0xe3, 0x80,
+    0xe3, 0x9a, 0x57, 0x3a, 0xa3, 0x42, 0x06, 0xac, 0xda, 0x46, 0xbe, 0x0e,
+    0xaf, 0x3d, 0x0f, 0xda, 0x58, 0x69, 0xec, 0x4d, 0xba, 0xed, 0xa8, 0xdc,
+    0xbb, 0x80, 0x0f, 0xcc, 0x06, 0xe2, 0xd0, 0x1d, 0xfb, 0x7f, 0x95, 0xcc,
+    0xf3, 0x71, 0xb5, 0x8c, 0x4e, 0xcf, 0x6d, 0x78, 0x7e, 0x60, 0xec, 0x33,
+    0x37, 0x54, 0xa0, 0xdf, 0xcf, 0x96, 0xec, 0x01, 0x5d, 0x06, 0x07, 0x6f,
+    0xa4, 0xd1, 0xec, 0x8f, 0xe4, 0xaf, 0xfb, 0xa7, 0xeb, 0xa2, 0x4e, 0xfb,
+    0x7c, 0x7c, 0xeb, 0xf1, 0x5a, 0x6d, 0x1e, 0x28, 0xcb, 0x9c, 0xe4, 0x8e,
+    0xbd, 0xfa, 0x96, 0x02, 0xf7, 0xfe, 0x16, 0x24, 0x5a, 0x57, 0x51, 0xd2,
+    0x30, 0x74, 0xee, 0x87, 0xf6, 0x88, 0xba, 0x39, 0x92, 0xa7, 0x78, 0x3c,
+    0x47, 0x07, 0x7c, 0x8e, 0x8e, 0x9e, 0x96, 0x65, 0xb7, 0x47, 0x65, 0xcd,
+    0xa7, 0xb1, 0x76, 0x56, 0x00, 0x00, 0x01, 0x50, 0x01, 0x84, 0x0d, 0x02,
+    0x00, 0x06, 0xbc, 0x21, 0x00, 0x08, 0xb3, 0x41, 0x00, 0x08, 0xb9, 0x60,
+    0x80, 0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0x0c, 0x01, 0xff, 0xff, 0x04,
+    0x08, 0x00, 0x00, 0x03, 0x00, 0x9e, 0x28, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x1e, 0xba, 0x02, 0x40, 0x00, 0x00, 0x00, 0x01, 0x42, 0x01, 0x01, 0x04,
+    0x08, 0x00, 0x00, 0x03, 0x00, 0x9e, 0x28, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x1e, 0x90, 0x04, 0x10, 0x20, 0xb2, 0xdd, 0x49, 0x26, 0x57, 0x34, 0x04,
+    0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x64, 0x20, 0x00,
+    0x00, 0x00, 0x01, 0x44, 0x01, 0xc1, 0x72, 0x86, 0x0c, 0x02, 0x24, 0x00,
+    0x00, 0x01, 0x28, 0x01, 0xaf, 0x78, 0x83, 0xe2, 0x95, 0xeb, 0x01, 0x4f,
+    0x0b, 0x20, 0xe9, 0x41, 0xaf, 0xc3, 0xc9, 0x03, 0x0c, 0x30, 0xff, 0x01,
+    0xc7, 0x33, 0x43, 0x17, 0x59, 0x8e, 0xa5, 0x71, 0xa6, 0x63, 0xd0, 0xa7,
+    0xfd, 0xb3, 0xee, 0x30, 0x82, 0x44, 0x2c, 0xf4, 0x5d, 0x49, 0x0e, 0xcf,
+    0x84, 0xca, 0x5d, 0x26, 0xc9, 0x7b, 0x01, 0xde, 0x7c, 0xe6, 0xea, 0x99,
+    0xb9, 0x77, 0x78, 0xa5, 0xff, 0xfa, 0x96, 0xa5, 0x99, 0xe4, 0xdc, 0xbd,
+    0xc8, 0x29, 0x9f, 0x7a, 0xf2, 0xbc, 0xed, 0x50, 0xa9, 0xbf, 0x7a, 0x2f,
+    0x21, 0x75, 0x90, 0xef, 0x58, 0xc9, 0x85, 0xb6, 0x5c, 0x32, 0xb1, 0x2b,
+    0x0b, 0xb4, 0x8b, 0x9a, 0xc5, 0x8a, 0xb2, 0x80, 0xff, 0x8d, 0x87, 0x22,
+    0x8f, 0xae, 0x96, 0x2b, 0x8f, 0xfa, 0x91, 0xcf, 0xf0, 0xe5, 0xaa, 0xfe,
+    0x49, 0xa6, 0xc5, 0x8f, 0x13, 0xa0, 0xfe, 0xa1, 0xe2, 0x21, 0xed, 0x07,
+    0x85, 0x96, 0xd5, 0xec, 0x19, 0xb9, 0x87, 0xf2, 0x32, 0xf4, 0x41, 0x86,
+    0xc4, 0x00, 0xda, 0x16, 0xa8, 0x1e, 0x1c, 0x33, 0xa2, 0x53, 0xad, 0x12,
+    0xc8, 0xec, 0x55, 0x6f, 0xc2, 0xc3, 0x19, 0xed, 0xa6, 0xef, 0x70, 0x6f,
+    0xb5, 0xaa, 0xa9, 0x4f, 0x6f, 0xfb, 0xa0, 0x04, 0xed, 0xab, 0xfb, 0xbd,
+    0xea, 0x40, 0x45, 0x63, 0x48, 0x68, 0x42, 0xbf, 0xbf, 0xcc, 0x7f, 0x74,
+    0xa7, 0x5c, 0xd1, 0x4f, 0x83, 0x6f, 0xf2, 0x0a, 0x21, 0x1a, 0xef, 0x3a,
+    0x46, 0xbd, 0xd6, 0xff, 0x23, 0x79, 0xf2, 0xfc, 0x39, 0x87, 0xf1, 0xf3,
+    0x2c, 0x34, 0xac, 0x80, 0xc2, 0x91, 0x10, 0xd3, 0x45, 0x38, 0xe1, 0xf9,
+    0x02, 0x3f, 0x33, 0x06, 0xcc, 0x3d, 0x58, 0xe5, 0x6f, 0x17, 0x54, 0x25,
+    0x1a, 0xa8, 0x5d, 0x99, 0xe6, 0x0d, 0x5d, 0x24, 0x8a, 0x0b, 0xee, 0xb6,
+    0xc9, 0xc2, 0xed, 0x12, 0x5d, 0x4b, 0x2f, 0x12, 0x17, 0x6e, 0x57, 0x2e,
+    0x2c, 0x74, 0x02, 0xaa, 0x25, 0x34, 0xd9, 0xd3, 0xe7, 0x30, 0xc3, 0x76,
+    0x4b, 0x56, 0x70, 0x0f, 0x7f, 0x5d, 0x72, 0xe0, 0x0a, 0x10, 0xac, 0x94,
+    0xe5, 0xb8, 0xb8, 0x91, 0x88, 0x7f, 0xc6, 0x74, 0x38, 0x17, 0x95, 0x8d,
+    0x66, 0x51, 0xba, 0x56, 0xa1, 0x3d, 0x0d, 0xbe, 0x7e, 0x36, 0xce, 0x1b,
+    0xd2, 0xb5, 0x3f, 0x4b, 0x98, 0x4e, 0xfb, 0x1e, 0x74, 0xe3, 0x35, 0x20,
+    0x3a, 0xd8, 0x36, 0x06, 0x9e, 0x5c, 0x1f, 0xc7, 0xcc, 0x2e, 0xc9, 0x73,
+    0x98, 0xe4, 0x7e, 0x01, 0x27, 0x27, 0x37, 0x71, 0xd0, 0x50, 0xa1, 0x97,
+    0x9f, 0x0f, 0x3a, 0x13, 0x47, 0x39, 0xfe, 0x76, 0xbd, 0x04, 0x67, 0xf1,
+    0x81, 0x08, 0xfc, 0xf7, 0x84, 0xc7, 0x90, 0xaf, 0x81, 0xed, 0xe2, 0xd0,
+    0xdf, 0x45, 0x36, 0x6f, 0x7c, 0xb4, 0xca, 0x32, 0xfb, 0x0e, 0x16, 0xb6,
+    0xed, 0x89, 0x4d, 0x1d, 0x0c, 0x6c, 0x31, 0xe6, 0x85, 0x4d, 0x6d, 0x47,
+    0x10, 0x5a, 0xac, 0x81, 0xc8, 0xee, 0x3b, 0x06, 0x55, 0xda, 0x38, 0x80,
+    0x8b, 0x5b, 0x2d, 0x13, 0x60, 0xb9, 0x59, 0x31, 0xf5, 0x40, 0x93, 0x5f,
+    0x9c, 0x2a, 0x4e, 0x08, 0x73, 0xc5, 0xea, 0x2a, 0x15, 0x9d, 0xd4, 0xa1,
+    0x70, 0xf9, 0xb4, 0x38, 0x1b, 0x7c, 0xef, 0x94, 0x0c, 0x7d, 0xbf, 0x6a,
+    0x37, 0x49, 0x10, 0xfe, 0x23, 0x22, 0xbe, 0xe4, 0xc8, 0x4d, 0xec, 0xbd,
+    0xd2, 0xf9, 0xf5, 0x77, 0xf2, 0x53, 0x9f, 0x7b, 0xc2, 0x66, 0x0a, 0x12,
+    0x01, 0xaa, 0xd3, 0x45, 0x77, 0xad, 0xfc, 0x9c, 0xe3, 0x7e, 0xd3, 0x53,
+    0xa9, 0x15, 0x00, 0x44, 0xa3, 0x3e, 0x72, 0xb3, 0x04, 0x59, 0xac, 0x2e,
+    0x9c, 0x3e, 0xe9, 0xbb, 0x71, 0x53, 0x82, 0x37, 0x2a, 0xf0, 0xab, 0x7b,
+    0x27, 0x7c, 0x69, 0x9d, 0x32, 0x41, 0x63, 0xf4, 0x2a, 0xb3, 0x05, 0xf0,
+    0xef, 0x5d, 0x61, 0xd5, 0xb3, 0x80, 0x12, 0x0d, 0x14, 0xfc, 0xa1, 0x8c,
+    0xf9, 0x47, 0x7e, 0xa2, 0xce, 0x79, 0xec, 0xb4, 0x3b, 0x20, 0xb2, 0x22,
+    0x18, 0x03, 0x9f, 0xcd, 0x1c, 0x3e, 0x56, 0x94, 0x93, 0xb6, 0x45, 0x1f,
+    0x8f, 0xe3, 0xc3, 0x55, 0x8b, 0x16, 0x39, 0x70, 0xab, 0x0a, 0x3b, 0x34,
+    0xce, 0x74, 0x64, 0xd6, 0x98, 0x3d, 0xf8, 0x57, 0x53, 0x57, 0x2a, 0x60,
+    0xf4, 0xdf, 0x8f, 0x87, 0xff, 0x52, 0xab, 0x60, 0x5b, 0x5b, 0x36, 0xf4,
+    0x62, 0xe1, 0x48, 0x0e, 0xac, 0x15, 0x60, 0x3d, 0xb0, 0x1a, 0x42, 0x9b,
+    0x2f, 0x34, 0x97, 0x09, 0xed, 0x6f, 0xd5, 0x8b, 0xe1, 0x35, 0xc5, 0x8e,
+    0x8f, 0x8a, 0xae, 0x98, 0x19, 0x96, 0x66, 0xda, 0x06, 0x59, 0x37, 0xe2,
+    0x82, 0xca, 0x8b, 0x49, 0x9f, 0xc0, 0x47, 0xc8, 0x03, 0x55, 0xbd, 0x19,
+    0xc1, 0x6e, 0xe0, 0x00, 0x00, 0x01, 0x50, 0x01, 0x84, 0x0d, 0x02, 0x00,
+    0x06, 0xea, 0x0d, 0x00, 0x08, 0xaf, 0x12, 0x00, 0x08, 0xb2, 0x95, 0x80,
+    0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0x0c, 0x01, 0xff, 0xff, 0x04, 0x08,
+    0x00, 0x00, 0x03, 0x00, 0x9e, 0x28, 0x00, 0x00, 0x03, 0x00, 0x00, 0x1e,
+    0xba, 0x02, 0x40, 0x00, 0x00, 0x00, 0x01, 0x42, 0x01, 0x01, 0x04, 0x08,
+    0x00, 0x00, 0x03, 0x00, 0x9e, 0x28, 0x00, 0x00, 0x03, 0x00, 0x00, 0x1e,
+    0x90, 0x04, 0x10, 0x20, 0xb2, 0xdd, 0x49, 0x26, 0x57, 0x34, 0x04, 0x00,
+    0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x64, 0x20, 0x00, 0x00,
+    0x00, 0x01, 0x44, 0x01, 0xc1, 0x72, 0x86, 0x0c, 0x02, 0x24, 0x00, 0x00,
+    0x01, 0x28, 0x01, 0xaf, 0x68, 0x81, 0x66, 0x51, 0x65, 0x80, 0xa8, 0x05,
+    0x8a, 0x0a, 0x3e, 0xb4, 0xf0, 0xef, 0x20, 0x4f, 0xe4, 0x79, 0x3d, 0x92,
+    0x97, 0x8e, 0x06, 0x0f, 0xc0, 0x26, 0xfc, 0x6e, 0x66, 0x68, 0x79, 0xd1,
+    0x00, 0x56, 0x76, 0x36, 0xb1, 0x1f, 0xb7, 0xda, 0x1c, 0x6b, 0x06, 0x5b,
+    0x0f, 0x19, 0x09, 0xd4, 0xad, 0x5e, 0x97, 0xb2, 0xad, 0xe5, 0xbf, 0x0f,
+    0x04, 0x2f, 0xff, 0xef, 0x8b, 0x7a, 0x2f, 0xb3, 0xa8, 0x22, 0x36, 0xfc,
+    0xfc, 0xb2, 0x2c, 0x68, 0x1a, 0x83, 0x60, 0x7c, 0xc3, 0x78, 0xa0, 0x68,
+    0x48, 0x55, 0x39, 0x42, 0x85, 0xe5, 0x69, 0xcf, 0x35, 0xc3, 0xfa, 0x88,
+    0xa3, 0xcf, 0x3e, 0x16, 0x3e, 0x49, 0x22, 0xb7, 0xea, 0xda, 0x5b, 0x0a,
+    0x81, 0xa5, 0xdd, 0x21, 0x16, 0x8c, 0x75, 0xf2, 0x1c, 0x56, 0x33, 0x03,
+    0x2f, 0x22, 0x6c, 0x83, 0x0b, 0xf2, 0x33, 0x37, 0x13, 0xb3, 0x38, 0xde,
+    0xed, 0x98, 0x92, 0x3b, 0x38, 0x72, 0x16, 0x3a, 0x29, 0x71, 0x20, 0x0a,
+    0x0f, 0x15, 0x16, 0x69, 0x97, 0xb5, 0xd6, 0x11, 0x37, 0x65, 0x5d, 0x8a,
+    0xca, 0xf1, 0x9b, 0x61, 0x02, 0xbf, 0x18, 0x99, 0xd7, 0x47, 0x21, 0x09,
+    0x18, 0x1d, 0xf7, 0x1e, 0xc8, 0x79, 0x79, 0x00, 0x04, 0x21, 0x3a, 0x45,
+    0x92, 0x30, 0xce, 0x80, 0x24, 0xcc, 0x72, 0xb2, 0xed, 0x65, 0xb5, 0x83,
+    0xa1, 0xb3, 0x5d, 0x57, 0x4d, 0xba, 0x43, 0xa1, 0x0d, 0xc2, 0x24, 0xfd,
+    0x4b, 0x1c, 0xc5, 0x1b, 0xc6, 0x8b, 0x73, 0x7c, 0xf1, 0xcc, 0x8e, 0xba,
+    0xda, 0x0c, 0x11, 0x29, 0x8a, 0xe6, 0x39, 0x50, 0x54, 0x9b, 0x27, 0x58,
+    0x5f, 0x3c, 0xfa, 0xae, 0x87, 0xe5, 0xd8, 0x90, 0x99, 0xea, 0x29, 0x4a,
+    0xba, 0xad, 0xe6, 0x3a, 0x7e, 0xe9, 0x99, 0x5c, 0xa4, 0x20, 0xb3, 0x8a,
+    0xc6, 0x35, 0x83, 0xba, 0x1c, 0xb9, 0x5b, 0xed, 0x38, 0xed, 0xf8, 0xa2,
+    0xd0, 0x9a, 0x0e, 0xc5, 0xbe, 0x95, 0x87, 0xa4, 0x19, 0xe5, 0x2b, 0x6b,
+    0x82, 0x56, 0x09, 0x32, 0xae, 0x41, 0x55, 0x96, 0x0e, 0xd4, 0x8e, 0xcc,
+    0x77, 0xd3, 0xf9, 0xfa, 0xfa, 0x59, 0x43, 0xcf, 0xa9, 0xa8, 0x42, 0xc8,
+    0xdd, 0x95, 0x66, 0xde, 0x98, 0xaa, 0xcc, 0xfe, 0x9f, 0x67, 0x7e, 0xf3,
+    0x95, 0x7e, 0x89, 0xfe, 0xd5, 0x34, 0xb9, 0x9a, 0xfc, 0x45, 0xd9, 0x32,
+    0x9e, 0x29, 0xb9, 0xa8, 0x2d, 0xa9, 0x0e, 0xa7, 0x2f, 0x40, 0xfd, 0x39,
+    0x11, 0xa4, 0x66, 0xcd, 0xbb, 0x1a, 0x91, 0x8c, 0x29, 0x3f, 0xbc, 0x3e,
+    0xc6, 0x33, 0x3d, 0xa5, 0xb0, 0x79, 0xe9, 0xf7, 0x11, 0x61, 0x64, 0x55,
+    0x3f, 0xd9, 0x50, 0xb4, 0xec, 0x53, 0x45, 0xc8, 0xaf, 0x77, 0x59, 0x17,
+    0x3c, 0x90, 0x9e, 0xc2, 0xd9, 0xb9, 0xd9, 0xd3, 0x97, 0xc0, 0x7f, 0xe8,
+    0xfb, 0x67, 0x46, 0xd1, 0x86, 0xd4, 0xc2, 0xdc, 0x5d, 0x25, 0x8b, 0x2b,
+    0x68, 0x17, 0x7d, 0xa5, 0xcf, 0x61, 0xcb, 0xbb, 0x60, 0x52, 0x89, 0xc3,
+    0x6a, 0x60, 0x09, 0x89, 0xdb, 0x36, 0xca, 0x85, 0x41, 0xdc, 0x95, 0xcf,
+    0x56, 0xab, 0x19, 0x54, 0x46, 0x43, 0x1d, 0x29, 0x05, 0xf4, 0x1f, 0xea,
+    0x70, 0xe5, 0xed, 0x3d, 0xfd, 0xcc, 0x7d, 0xc9, 0x1a, 0x13, 0xf0, 0xda,
+    0x9c, 0x6a, 0xfa, 0x54, 0x2e, 0xc2, 0x0f, 0xc4, 0x7f, 0x50, 0x19, 0x81,
+    0x51, 0xfe, 0xfb, 0x04, 0xbb, 0xab, 0x7e, 0xd2, 0xf2, 0x9d, 0x78, 0xcd,
+    0xbe, 0xa1, 0xf8, 0x03, 0x3b, 0x92, 0x46, 0xde, 0x0f, 0xe3, 0x86, 0x87,
+    0xd3, 0x53, 0x75, 0xf4, 0x45, 0x69, 0x0f, 0xf1, 0xcb, 0x12, 0xe9, 0x95,
+    0x5d, 0xcc, 0x72, 0xc7, 0xf0, 0x6f, 0x7a, 0xa2, 0x9f, 0xf7, 0x27, 0x42,
+    0xf0, 0x18, 0x80, 0xda, 0x85, 0x53, 0x30, 0x0a, 0xb0, 0xb0, 0xb5, 0x0a,
+    0xd9, 0x64, 0x52, 0x3e, 0xfc, 0x1d, 0x63, 0x82, 0x62, 0x3a, 0x3a, 0x1b,
+    0x80, 0x07, 0x33, 0x07, 0xa0, 0xab, 0x33, 0xfe, 0x67, 0x2a, 0xd0, 0xed,
+    0xf2, 0x7a, 0x17, 0x50, 0xb7, 0x84, 0x1f, 0xee, 0xac, 0x28, 0xe5, 0xb3,
+    0x6b, 0xd3, 0xee, 0xd6, 0x0b, 0x89, 0x4a, 0xc2, 0xa6, 0x0d, 0x32, 0x32,
+    0x4d, 0x7e, 0x3c, 0x05, 0xcd, 0x1d, 0xf4, 0xda, 0xa3, 0xbe, 0x16, 0x80,
+    0x28, 0xed, 0xed, 0x0b, 0x6d, 0xde, 0x88, 0x1d, 0x56, 0x4d, 0xb9, 0xa4,
+    0xb0, 0xeb, 0x33, 0xa3, 0xbd, 0xe4, 0x4d, 0xff, 0xd4, 0xe3, 0x19, 0x5b,
+    0xb6, 0xb2, 0x10, 0x7c, 0x63, 0x9f, 0x97, 0x5c, 0xc5, 0xb2, 0xfe, 0xeb,
+    0xf0, 0xc4, 0x90, 0xd9, 0xbb, 0x58, 0xf4, 0xe0, 0x5a, 0x57, 0x6e, 0xa7,
+    0x91, 0xa2, 0x49, 0xdd, 0xa7, 0xe2, 0xad, 0xe4, 0x96, 0xde, 0x6b, 0x2c,
+    0xf3, 0x16, 0x76, 0x66, 0x46, 0x9f, 0xaa, 0x76, 0x36, 0x1a, 0x28, 0x08,
+    0x19, 0x6e, 0x54, 0x04, 0xcd, 0xb5, 0xbd, 0xd8, 0x1f, 0x50, 0x00, 0x00,
+    0x01, 0x50, 0x01, 0x84, 0x0d, 0x02, 0x00, 0x07, 0x0a, 0xd1, 0x00, 0x08,
+    0x95, 0x55, 0x00, 0x08, 0x88, 0x1d, 0x80, 0x00, 0x00, 0x00, 0x01, 0x40,
+    0x01, 0x0c, 0x01, 0xff, 0xff, 0x04, 0x08, 0x00, 0x00, 0x03, 0x00, 0x9e,
+    0x28, 0x00, 0x00, 0x03, 0x00, 0x00, 0x1e, 0xba, 0x02, 0x40, 0x00, 0x00,
+    0x00, 0x01, 0x42, 0x01, 0x01, 0x04, 0x08, 0x00, 0x00, 0x03, 0x00, 0x9e,
+    0x28, 0x00, 0x00, 0x03, 0x00, 0x00, 0x1e, 0x90, 0x04, 0x10, 0x20, 0xb2,
+    0xdd, 0x49, 0x26, 0x57, 0x34, 0x04, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00,
+    0x00, 0x03, 0x00, 0x64, 0x20, 0x00, 0x00, 0x00, 0x01, 0x44, 0x01, 0xc1,
+    0x72, 0x86, 0x0c, 0x02, 0x24, 0x00, 0x00, 0x01, 0x28, 0x01, 0xaf, 0x68,
+    0xda, 0x61, 0x32, 0x82, 0xa2, 0x05, 0x1d, 0xf9, 0x6e, 0x1e, 0x2c, 0xe1,
+    0xc3, 0xe3, 0x4d, 0xe3, 0x5c, 0xcc, 0x4a, 0xd2, 0xfe, 0x9f, 0x3f, 0xeb,
+    0xa1, 0xd8, 0x13, 0x56, 0x77, 0xe7, 0x03, 0x49, 0x2b, 0x09, 0x3c, 0xbf,
+    0xc5, 0x8e, 0x79, 0x3e, 0xf5, 0xfb, 0xc8, 0xb6, 0xd8, 0x5c, 0x59, 0x3f,
+    0x51, 0x02, 0x25, 0x27, 0xc0, 0x48, 0xe5, 0x91, 0x17, 0xec, 0x92, 0xdf,
+    0x75, 0xb0, 0xb5, 0x72, 0x82, 0x92, 0x6f, 0xf4, 0xc2, 0x8b, 0xf6, 0x5b,
+    0xf9, 0xd8, 0x96, 0xeb, 0x5c, 0xfa, 0xc3, 0x06, 0x40, 0x57, 0x6a, 0x64,
+    0x10, 0x9b, 0x56, 0xc8, 0x77, 0x58, 0x2d, 0x39, 0x2d, 0xab, 0x0a, 0x21,
+    0x61, 0xd3, 0x15, 0x3c, 0xd5, 0x23, 0xce, 0x3f, 0x45, 0x32, 0x0f, 0xa9,
+    0x7a, 0x47, 0x75, 0x0d, 0xb0, 0x5d, 0x1a, 0xe1, 0x71, 0x5a, 0x7a, 0x45,
+    0x0d, 0x14, 0xd8, 0xe1, 0x88, 0x11, 0xbb, 0x95, 0xf9, 0xc6, 0xac, 0xd0,
+    0x0b, 0x26, 0xba, 0x71, 0x3c, 0xb2, 0xcb, 0x64, 0xdf, 0xfb, 0x1a, 0xf3,
+    0x85, 0x74, 0x82, 0x71, 0xce, 0xb0, 0xf1, 0xcc, 0x0e, 0x6b, 0x0a, 0x7c,
+    0xe2, 0xf4, 0x06, 0x0d, 0x6a, 0x56, 0xfa, 0x9d, 0x04, 0xe0, 0x20, 0x65,
+    0x51, 0x49, 0x73, 0xac, 0x87, 0xee, 0x77, 0xf2, 0x82, 0x97, 0xac, 0x00,
+    0x73, 0x64, 0x5c, 0x5f, 0xb2, 0x81, 0x95, 0x41, 0xe2, 0xc7, 0xb4, 0xcb,
+    0xb1, 0xe3, 0x47, 0xe9, 0x92, 0x58, 0x37, 0x23, 0x5d, 0x1c, 0x6a, 0x43,
+    0xb6, 0x99, 0xda, 0xd5, 0x84, 0xbf, 0x04, 0x43, 0x83, 0x1d, 0xc0, 0x82,
+    0xf2, 0x1c, 0x54, 0x9c, 0x80, 0xc8, 0x91, 0x40, 0x76, 0x13, 0xed, 0xfd,
+    0xae, 0x97, 0xd7, 0x87, 0xb1, 0x02, 0x88, 0x3a, 0x5f, 0x30, 0x04, 0x51,
+    0x21, 0x17, 0x77, 0x8b, 0x8e, 0xd1, 0x31, 0xfb, 0x33, 0xb2, 0x73, 0xde,
+    0xd8, 0xbf, 0x02, 0xc2, 0x4b, 0x86, 0xc2, 0x88, 0x53, 0x4e, 0x80, 0x38,
+    0x4f, 0x5c, 0x4b, 0x32, 0x22, 0x41, 0x04, 0x62, 0x72, 0xa4, 0x2a, 0x73,
+    0x05, 0x3b, 0x78, 0x50, 0xa7, 0x46, 0xcb, 0x10, 0x79, 0x75, 0xb6, 0x09,
+    0x4c, 0x1e, 0x20, 0xf8, 0xaa, 0x7f, 0x7a, 0x1d, 0xee, 0xc5, 0xda, 0xe3,
+    0xf0, 0xea, 0x1f, 0xae, 0xc4, 0x29, 0xe3, 0x8d, 0x45, 0xc3, 0xa2, 0x3c,
+    0x12, 0x65, 0x97, 0x20, 0x5a, 0x99, 0x31, 0x5c, 0x38, 0xa2, 0xd7, 0xef,
+    0x19, 0xfc, 0x14, 0x01, 0x65, 0xaa, 0x32, 0x3b, 0xd5, 0x2d, 0xc2, 0x34,
+    0xc6, 0x33, 0xb5, 0x14, 0x55, 0xaf, 0xac, 0xfb, 0xfc, 0x01, 0x7d, 0xdf,
+    0x55, 0xf8, 0x80, 0xeb, 0x31, 0xb0, 0xf9, 0xba, 0x71, 0x0e, 0xa4, 0x95,
+    0xd9, 0xdb, 0x0a, 0xd9, 0x62, 0x76, 0xc4, 0xea, 0xe2, 0x21, 0x57, 0x4f,
+    0x70, 0xbf, 0xbd, 0x0e, 0x1c, 0xfd, 0xc8, 0xbd, 0x1d, 0x7b, 0x61, 0xb3,
+    0xbc, 0x9a, 0xc4, 0x31, 0xf6, 0x87, 0x41, 0xfb, 0x88, 0x24, 0xf0, 0x14,
+    0x3f, 0xf9, 0x10, 0x3e, 0x1e, 0x00, 0xf1, 0xec, 0x4c, 0xe5, 0x64, 0x2f,
+    0x12, 0x14, 0x65, 0xdb, 0x05, 0xe9, 0xa0, 0x66, 0x46, 0x93, 0x36, 0x69,
+    0x00, 0x14, 0x76, 0x31, 0xea, 0x14, 0xdf, 0x13, 0x8c, 0x0a, 0x12, 0xea,
+    0x26, 0x8c, 0x9b, 0x58, 0xf3, 0x61, 0xa2, 0xfe, 0xf2, 0x23, 0x30, 0xb4,
+    0x42, 0x10, 0x49, 0x7c, 0xee, 0xeb, 0x28, 0x78, 0x3b, 0x68, 0x29, 0x49,
+    0x25, 0xc5, 0x67, 0x4a, 0x21, 0x7b, 0xcb, 0x0e, 0x14, 0xc6, 0xac, 0x27,
+    0x43, 0x9f, 0x2a, 0xe4, 0xd2, 0xc9, 0x7f, 0xb9, 0x62, 0x0b, 0x71, 0x20,
+    0x27, 0x8d, 0x86, 0x3e, 0x9b, 0x50, 0xb6, 0xaf, 0x7f, 0xb2, 0x55, 0xcf,
+    0x90, 0xa5, 0x6d, 0x48, 0xac, 0x25, 0x82, 0x04, 0xe4, 0x2c, 0xc9, 0x7f,
+    0xba, 0x68, 0x37, 0xd8, 0x36, 0x9c, 0xd5, 0x9e, 0x59, 0x87, 0x83, 0x22,
+    0x18, 0x35, 0x40, 0xa4, 0x90, 0x72, 0x93, 0x3b, 0xe6, 0x51, 0x3f, 0xca,
+    0x1d, 0x43, 0xa2, 0xd7, 0xc3, 0x5d, 0x7b, 0x70, 0x72, 0x8c, 0x0a, 0xff,
+    0x20, 0xb4, 0xd5, 0xc3, 0x60, 0xaa, 0xb8, 0xd3, 0xdf, 0xcd, 0x2e, 0xe6,
+    0x3f, 0x8a, 0xfa, 0x53, 0x33, 0x49, 0xb0, 0xc1, 0x6c, 0x4b, 0x73, 0xc3,
+    0x03, 0x9e, 0xae, 0x5f, 0x14, 0xee, 0xaf, 0x2d, 0xec, 0x95, 0x50, 0xa1,
+    0xaa, 0x5e, 0x35, 0xbc, 0x9e, 0x82, 0x6a, 0xb3, 0xe1, 0x4b, 0x95, 0x4b,
+    0x07, 0xbd, 0x05, 0x73, 0x42, 0xd0, 0x6d, 0x4a, 0x31, 0xf2, 0xd2, 0x24,
+    0x17, 0x67, 0x02, 0x25, 0x5d, 0xd4, 0x68, 0x07, 0x6c, 0x59, 0xf0, 0x22,
+    0xf2, 0x75, 0x48, 0x67, 0x91, 0x66, 0xbc, 0x00, 0x00, 0x01, 0x50, 0x01,
+    0x84, 0x0d, 0x02, 0x00, 0x07, 0x23, 0x15, 0x00, 0x08, 0x94, 0x27, 0x00,
+    0x08, 0x73, 0xf8, 0x80,
+};
+
+#endif /*_HEVC_STREAMS_H_*/
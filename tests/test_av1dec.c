@@ -0,0 +1,68 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "av1.h"
+#include "av1_streams.h"
+#include "crc.h"
+#include "vlog.h"
+
+/* decodes a still picture on nthreads threads and checks the crc32 of its
+ * planes against the one of the reference decoder
+ */
+static int
+test_stream(const char *name, const uint8_t *data, int len, int nthreads,
+            uint32_t expect)
+{
+    struct av1_decoder *dec = av1_decoder_init();
+    struct av1_yuv yuv = { .planes = { NULL } };
+    struct av1_output out = { .format = AV1_OUTPUT_YUV, .yuv = &yuv };
+    dec->nthreads = nthreads;
+    int ret = av1_decoder_decode(dec, data, len, &out);
+    if (ret || !yuv.planes[0]) {
+        printf("%s: decode fail %d\n", name, ret);
+        av1_decoder_destroy(dec);
+        return -1;
+    }
+
+    uint32_t crc = 0xFFFFFFFF;
+    for (int c = 0; c < 3; c++) {
+        int w = yuv.width, h = yuv.height;
+        if (c) {
+            w = (w + yuv.subsampling_x) >> yuv.subsampling_x;
+            h = (h + yuv.subsampling_y) >> yuv.subsampling_y;
+        }
+        for (int y = 0; y < h; y++) {
+            const uint16_t *row = yuv.planes[c] + y * yuv.strides[c];
+            for (int x = 0; x < w; x++) {
+                uint8_t s[2] = { row[x] & 0xFF, row[x] >> 8 };
+                crc = update_crc(crc, s, yuv.bitdepth > 8 ? 2 : 1);
+            }
+        }
+    }
+    crc = finish_crc32(crc);
+    free(yuv.planes[0]);
+    av1_decoder_destroy(dec);
+    if (crc != expect) {
+        printf("%s: %d threads, crc %08x, expect %08x\n", name, nthreads, crc,
+               expect);
+        return -1;
+    }
+    return 0;
+}
+
+int main(void)
+{
+    vlog_set_global_level(VLOG_ERR);
+    // one thread, and the tiles and the loop filter rows on several
+    for (int n = 1; n <= 4; n += 3) {
+        if (test_stream("8 bit", av1_128x128, sizeof(av1_128x128), n,
+                        AV1_128X128_CRC) ||
+            test_stream("10 bit", av1_192x192p10, sizeof(av1_192x192p10), n,
+                        AV1_192X192P10_CRC)) {
+            return -1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,275 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "av1dsp.h"
+#include "x86.h"
+
+#define EDGE (2 * 64 + 16)
+#define STRIDE (80)
+
+static int32_t itx_ref[64 * 64];
+static int32_t itx_simd[64 * 64];
+static uint16_t pix_ref[STRIDE * 64];
+static uint16_t pix_simd[STRIDE * 64];
+
+// a signed value of range bits, biased to small ones like real coefficients
+static int32_t
+rand_coef(int range)
+{
+    int bits = 1 + rand() % (range - 1);
+    int32_t v = rand() & ((1 << (bits - 1)) - 1);
+    return (rand() & 1) ? -v - 1 : v;
+}
+
+static void
+fill_coefs(int lanes, int n, int range)
+{
+    for (int i = 0; i < 64 * 64; i++) {
+        itx_ref[i] = 0;
+    }
+    for (int k = 0; k < n; k++) {
+        for (int l = 0; l < lanes; l++) {
+            itx_ref[k * 64 + l] = rand_coef(range);
+        }
+    }
+    memcpy(itx_simd, itx_ref, sizeof(itx_ref));
+}
+
+static int
+compare_coefs(const char *name, int n, int lanes, int range)
+{
+    for (int i = 0; i < 64 * 64; i++) {
+        if (itx_ref[i] != itx_simd[i]) {
+            printf("%s n %d lanes %d range %d not match at %d, %d: %d vs %d\n",
+                   name, n, lanes, range, i / 64, i % 64, itx_ref[i],
+                   itx_simd[i]);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int
+test_itx(const char *simd_name, const struct av1_dsp *ref,
+         const struct av1_dsp *simd)
+{
+    static const int ranges[] = { 16, 18, 20 };
+    char name[32];
+    for (int r = 0; r < 3; r++) {
+        int range = ranges[r];
+        for (int log2n = 2; log2n <= 6; log2n++) {
+            int n = 1 << log2n;
+            for (int lanes = 4; lanes <= 32; lanes += 4) {
+                fill_coefs(lanes, n, range);
+                ref->itx_prog(itx_ref, 64, lanes, av1_idct_prog(log2n), range);
+                simd->itx_prog(itx_simd, 64, lanes, av1_idct_prog(log2n), range);
+                snprintf(name, sizeof(name), "%s idct", simd_name);
+                if (compare_coefs(name, n, lanes, range)) {
+                    return -1;
+                }
+                if (log2n == 3 || log2n == 4) {
+                    fill_coefs(lanes, n, range);
+                    ref->itx_prog(itx_ref, 64, lanes, av1_iadst_prog(log2n), range);
+                    simd->itx_prog(itx_simd, 64, lanes, av1_iadst_prog(log2n), range);
+                    snprintf(name, sizeof(name), "%s iadst", simd_name);
+                    if (compare_coefs(name, n, lanes, range)) {
+                        return -1;
+                    }
+                }
+                if (log2n == 2) {
+                    fill_coefs(lanes, n, range);
+                    ref->itx_adst4(itx_ref, 64, lanes, n);
+                    simd->itx_adst4(itx_simd, 64, lanes, n);
+                    snprintf(name, sizeof(name), "%s iadst", simd_name);
+                    if (compare_coefs(name, n, lanes, range)) {
+                        return -1;
+                    }
+                }
+                if (log2n <= 5) {
+                    fill_coefs(lanes, n, range);
+                    ref->itx_identity(itx_ref, 64, lanes, n);
+                    simd->itx_identity(itx_simd, 64, lanes, n);
+                    snprintf(name, sizeof(name), "%s identity", simd_name);
+                    if (compare_coefs(name, n, lanes, range)) {
+                        return -1;
+                    }
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+static void
+fill_edge(uint16_t *edge, int maxval)
+{
+    // smooth with some steps, so paeth takes all three of its choices
+    int v = rand() % (maxval + 1);
+    for (int i = 0; i < EDGE; i++) {
+        if ((rand() & 7) == 0) {
+            v = rand() % (maxval + 1);
+        }
+        v += rand() % 9 - 4;
+        v = v < 0 ? 0 : (v > maxval ? maxval : v);
+        edge[i] = v;
+    }
+}
+
+static int
+compare_pixels(const char *name, int w, int h, int bitdepth)
+{
+    for (int i = 0; i < STRIDE * 64; i++) {
+        if (pix_ref[i] != pix_simd[i]) {
+            printf("%s %dx%d %d bits not match at (%d, %d): %d vs %d\n", name,
+                   w, h, bitdepth, i % STRIDE, i / STRIDE, pix_ref[i],
+                   pix_simd[i]);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int
+test_intra(const char *simd_name, const struct av1_dsp *ref,
+           const struct av1_dsp *simd)
+{
+    static uint16_t above_buf[EDGE], left_buf[EDGE];
+    static int16_t ac[64 * 64];
+    const uint16_t *above = above_buf + 8, *left = left_buf + 8;
+    char name[32];
+    for (int bitdepth = 8; bitdepth <= 12; bitdepth += 2) {
+        int maxval = (1 << bitdepth) - 1;
+        for (int log2w = 2; log2w <= 6; log2w++) {
+            for (int log2h = 2; log2h <= 6; log2h++) {
+                int w = 1 << log2w, h = 1 << log2h;
+                fill_edge(above_buf, maxval);
+                fill_edge(left_buf, maxval);
+                left_buf[7] = above_buf[7];
+
+                const av1_intra_func ref_f[5] = {
+                    ref->intra_v, ref->intra_h, ref->intra_paeth,
+                    ref->intra_smooth, ref->intra_smooth_v,
+                };
+                const av1_intra_func simd_f[5] = {
+                    simd->intra_v, simd->intra_h, simd->intra_paeth,
+                    simd->intra_smooth, simd->intra_smooth_v,
+                };
+                for (int k = 0; k < 6; k++) {
+                    memset(pix_ref, 0, sizeof(pix_ref));
+                    memset(pix_simd, 0, sizeof(pix_simd));
+                    if (k < 5) {
+                        ref_f[k](pix_ref, STRIDE, above, left, w, h);
+                        simd_f[k](pix_simd, STRIDE, above, left, w, h);
+                    } else {
+                        ref->intra_smooth_h(pix_ref, STRIDE, above, left, w, h);
+                        simd->intra_smooth_h(pix_simd, STRIDE, above, left, w, h);
+                    }
+                    snprintf(name, sizeof(name), "%s intra %d", simd_name, k);
+                    if (compare_pixels(name, w, h, bitdepth)) {
+                        return -1;
+                    }
+                }
+                for (int edges = 0; edges < 4; edges++) {
+                    ref->intra_dc(pix_ref, STRIDE, above, left, w, h, edges & 1,
+                                  edges >> 1, bitdepth);
+                    simd->intra_dc(pix_simd, STRIDE, above, left, w, h,
+                                   edges & 1, edges >> 1, bitdepth);
+                    snprintf(name, sizeof(name), "%s dc %d", simd_name, edges);
+                    if (compare_pixels(name, w, h, bitdepth)) {
+                        return -1;
+                    }
+                }
+                if (w > 32 || h > 32) {
+                    continue;
+                }
+                // chroma from luma on top of the dc prediction just made
+                int sum = 0;
+                for (int i = 0; i < w * h; i++) {
+                    ac[i] = (rand() % (maxval + 1)) << 3;
+                    sum += ac[i];
+                }
+                for (int i = 0; i < w * h; i++) {
+                    ac[i] -= (sum + (w * h >> 1)) >> (log2w + log2h);
+                }
+                int alpha = rand() % 33 - 16;
+                ref->cfl_pred(pix_ref, STRIDE, ac, w, h, alpha, bitdepth);
+                simd->cfl_pred(pix_simd, STRIDE, ac, w, h, alpha, bitdepth);
+                snprintf(name, sizeof(name), "%s cfl", simd_name);
+                if (compare_pixels(name, w, h, bitdepth)) {
+                    return -1;
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+/* a lone DC coefficient of DCT_DCT has to come out flat for every size,
+ * and the coefficients have to be cleared again
+ */
+static int
+test_dc_only(void)
+{
+    static int32_t coef[64 * 64];
+    for (int log2w = 2; log2w <= 6; log2w++) {
+        for (int log2h = 2; log2h <= 6; log2h++) {
+            int w = 1 << log2w, h = 1 << log2h;
+            if (log2w - log2h > 2 || log2h - log2w > 2) {
+                continue;
+            }
+            for (int i = 0; i < STRIDE * 64; i++) {
+                pix_ref[i] = 512;
+            }
+            coef[0] = 1000 + rand() % 2000;
+            av1_inv_txfm_add(pix_ref, STRIDE, coef, log2w, log2h, DCT_DCT, 0,
+                             1, 10);
+            for (int i = 0; i < h; i++) {
+                for (int j = 0; j < w; j++) {
+                    if (pix_ref[i * STRIDE + j] != pix_ref[0] ||
+                        pix_ref[0] <= 512) {
+                        printf("dc only %dx%d not flat at (%d, %d): %d vs %d\n",
+                               w, h, j, i, pix_ref[i * STRIDE + j], pix_ref[0]);
+                        return -1;
+                    }
+                }
+            }
+            for (int i = 0; i < 64 * 64; i++) {
+                if (coef[i]) {
+                    printf("dc only %dx%d left coefficient %d\n", w, h, i);
+                    return -1;
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+int main(void)
+{
+    struct av1_dsp ref, simd;
+
+    srand(4321);
+    av1_dsp_init();
+    av1_dsp_init_c(&ref);
+    if (test_dc_only()) {
+        return -1;
+    }
+#ifdef __SSE4_1__
+    av1_dsp_init_c(&simd);
+    x86_av1_dsp_init_sse4(&simd);
+    if (test_itx("sse4", &ref, &simd) || test_intra("sse4", &ref, &simd)) {
+        return -1;
+    }
+#endif
+#ifdef __AVX2__
+    av1_dsp_init_c(&simd);
+    x86_av1_dsp_init_avx2(&simd);
+    if (test_itx("avx2", &ref, &simd) || test_intra("avx2", &ref, &simd)) {
+        return -1;
+    }
+#endif
+    (void)simd;
+    return 0;
+}
@@ -0,0 +1,63 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "avif_streams.h"
+#include "crc.h"
+#include "file.h"
+#include "vlog.h"
+
+#define TEST_FILE "test_avifdec.avif"
+
+/* decodes an avif file and checks its BGRA pixels against the crc32 of
+ * the reference ones
+ */
+static int
+check_avif(const char *name, const uint8_t *data, int len, int width,
+           int height, uint32_t expect)
+{
+    FILE *f = fopen(TEST_FILE, "wb");
+    if (!f) {
+        return -1;
+    }
+    fwrite(data, len, 1, f);
+    fclose(f);
+
+    struct file_ops *ops = file_probe(TEST_FILE);
+    if (!ops) {
+        printf("%s: not probed as avif\n", name);
+        return -1;
+    }
+    struct pic *p = file_load(ops, TEST_FILE, 0);
+    if (!p) {
+        printf("%s: decode fail\n", name);
+        return -1;
+    }
+    if (p->width < width || p->height < height || p->depth != 32) {
+        printf("%s: size not match %dx%d\n", name, p->width, p->height);
+        file_free(ops, p);
+        return -1;
+    }
+    uint32_t crc = 0xFFFFFFFF;
+    for (int y = 0; y < height; y++) {
+        crc = update_crc(crc, (uint8_t *)p->pixels + y * p->pitch, width * 4);
+    }
+    crc = finish_crc32(crc);
+    file_free(ops, p);
+    if (crc != expect) {
+        printf("%s: crc %08x, expect %08x\n", name, crc, expect);
+        return -1;
+    }
+    return 0;
+}
+
+int main(void)
+{
+    vlog_set_global_level(VLOG_ERR);
+    file_ops_init();
+    int ret = check_avif("grid alpha", avif_grid_alpha, sizeof(avif_grid_alpha),
+                         90, 120, AVIF_GRID_ALPHA_CRC);
+    remove(TEST_FILE);
+    return ret ? -1 : 0;
+}
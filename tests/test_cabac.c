@@ -0,0 +1,365 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bitstream.h"
+#include "cabac.h"
+
+/* a small cabac encoder after the HEVC reference one, random bins go
+ * through it and have to come back the same from the decoder, including
+ * the byte the stream goes on at after a terminate bin of 1
+ */
+
+#define NUM_CTX (8)
+#define NUM_OPS (6000)
+
+static const uint8_t NextStateMPS[64] = {
+    1,  2,  3,  4,  5,  6,  7,  8,  9,  10, 11, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+    33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,
+    49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 62, 63
+};
+
+static const uint8_t NextStateLPS[64] = {
+    0,  0,  1,  2,  2,  4,  4,  5,  6,  7,  8,  9,  9,  11, 11, 12,
+    13, 13, 15, 15, 16, 16, 18, 18, 19, 19, 21, 21, 22, 22, 23, 24,
+    24, 25, 26, 26, 27, 27, 28, 29, 29, 30, 30, 30, 31, 32, 32, 33,
+    33, 33, 34, 34, 35, 35, 35, 36, 36, 36, 37, 37, 37, 38, 38, 63
+};
+
+static const uint8_t LPSTable[64][4] = {
+    {128, 176, 208, 240}, {128, 167, 197, 227}, {128, 158, 187, 216},
+    {123, 150, 178, 205}, {116, 142, 169, 195}, {111, 135, 160, 185},
+    {105, 128, 152, 175}, {100, 122, 144, 166}, {95, 116, 137, 158},
+    {90, 110, 130, 150},  {85, 104, 123, 142},  {81, 99, 117, 135},
+    {77, 94, 111, 128},   {73, 89, 105, 122},   {69, 85, 100, 116},
+    {66, 80, 95, 110},    {62, 76, 90, 104},    {59, 72, 86, 99},
+    {56, 69, 81, 94},     {53, 65, 77, 89},     {51, 62, 73, 85},
+    {48, 59, 69, 80},     {46, 56, 66, 76},     {43, 53, 63, 72},
+    {41, 50, 59, 69},     {39, 48, 56, 65},     {37, 45, 54, 62},
+    {35, 43, 51, 59},     {33, 41, 48, 56},     {32, 39, 46, 53},
+    {30, 37, 43, 50},     {29, 35, 41, 48},     {27, 33, 39, 45},
+    {26, 31, 37, 43},     {24, 30, 35, 41},     {23, 28, 33, 39},
+    {22, 27, 32, 37},     {21, 26, 30, 35},     {20, 24, 29, 33},
+    {19, 23, 27, 31},     {18, 22, 26, 30},     {17, 21, 25, 28},
+    {16, 20, 23, 27},     {15, 19, 22, 25},     {14, 18, 21, 24},
+    {14, 17, 20, 23},     {13, 16, 19, 22},     {12, 15, 18, 21},
+    {12, 14, 17, 20},     {11, 14, 16, 19},     {11, 13, 15, 18},
+    {10, 12, 15, 17},     {10, 12, 14, 16},     {9, 11, 13, 15},
+    {9, 11, 12, 14},      {8, 10, 12, 14},      {8, 9, 11, 13},
+    {7, 9, 11, 12},       {7, 9, 10, 12},       {7, 8, 10, 11},
+    {6, 8, 9, 11},        {6, 7, 9, 10},        {6, 7, 8, 9},
+    {2, 2, 2, 2},
+};
+
+struct enc {
+    uint32_t low;
+    uint32_t range;
+    int bits_left;
+    int num_buffered;
+    int buffered_byte;
+    uint8_t state[NUM_CTX];
+    uint8_t mps[NUM_CTX];
+
+    uint8_t *buf;
+    int bitpos;
+};
+
+static void
+put_bits(struct enc *e, uint32_t v, int n)
+{
+    for (int i = n - 1; i >= 0; i--) {
+        if ((v >> i) & 1) {
+            e->buf[e->bitpos >> 3] |= 0x80 >> (e->bitpos & 7);
+        }
+        e->bitpos++;
+    }
+}
+
+static void
+enc_start(struct enc *e)
+{
+    e->low = 0;
+    e->range = 510;
+    e->bits_left = 23;
+    e->num_buffered = 0;
+    e->buffered_byte = 0xff;
+}
+
+static void
+write_out(struct enc *e)
+{
+    if (e->bits_left >= 12) {
+        return;
+    }
+    uint32_t lead = e->low >> (24 - e->bits_left);
+    e->bits_left += 8;
+    e->low &= 0xffffffffu >> e->bits_left;
+    if (lead == 0xff) {
+        e->num_buffered++;
+    } else if (e->num_buffered > 0) {
+        int carry = lead >> 8;
+        put_bits(e, e->buffered_byte + carry, 8);
+        e->buffered_byte = lead & 0xff;
+        while (e->num_buffered > 1) {
+            put_bits(e, (0xff + carry) & 0xff, 8);
+            e->num_buffered--;
+        }
+    } else {
+        e->num_buffered = 1;
+        e->buffered_byte = lead;
+    }
+}
+
+static void
+enc_decision(struct enc *e, int ctx, int bin)
+{
+    int state = e->state[ctx];
+    uint32_t lps = LPSTable[state][(e->range >> 6) & 3];
+    e->range -= lps;
+    if (bin != e->mps[ctx]) {
+        int n = 0;
+        while ((lps << n) < 256) {
+            n++;
+        }
+        e->low = (e->low + e->range) << n;
+        e->range = lps << n;
+        e->bits_left -= n;
+        if (state == 0) {
+            e->mps[ctx] = 1 - e->mps[ctx];
+        }
+        e->state[ctx] = NextStateLPS[state];
+    } else {
+        e->state[ctx] = NextStateMPS[state];
+        if (e->range >= 256) {
+            return;
+        }
+        e->low <<= 1;
+        e->range <<= 1;
+        e->bits_left--;
+    }
+    write_out(e);
+}
+
+static void
+enc_bypass(struct enc *e, int bin)
+{
+    e->low <<= 1;
+    if (bin) {
+        e->low += e->range;
+    }
+    e->bits_left--;
+    write_out(e);
+}
+
+static void
+enc_terminate(struct enc *e, int bin)
+{
+    e->range -= 2;
+    if (bin) {
+        e->low += e->range;
+        e->low <<= 7;
+        e->range = 2 << 7;
+        e->bits_left -= 7;
+    } else if (e->range >= 256) {
+        return;
+    } else {
+        e->low <<= 1;
+        e->range <<= 1;
+        e->bits_left--;
+    }
+    write_out(e);
+}
+
+/* flush after a terminate bin of 1, then the stop bit and byte alignment */
+static void
+enc_finish(struct enc *e)
+{
+    if (e->low >> (32 - e->bits_left)) {
+        put_bits(e, e->buffered_byte + 1, 8);
+        while (e->num_buffered > 1) {
+            put_bits(e, 0, 8);
+            e->num_buffered--;
+        }
+        e->low -= 1u << (32 - e->bits_left);
+    } else {
+        if (e->num_buffered > 0) {
+            put_bits(e, e->buffered_byte, 8);
+        }
+        while (e->num_buffered > 1) {
+            put_bits(e, 0xff, 8);
+            e->num_buffered--;
+        }
+    }
+    put_bits(e, e->low >> 8, 24 - e->bits_left);
+    put_bits(e, 1, 1);
+    e->bitpos = (e->bitpos + 7) & ~7;
+}
+
+enum { OP_DECISION, OP_BYPASS, OP_BYPASS_N, OP_TERMINATE };
+
+struct op {
+    int type;
+    int ctx;
+    int n;
+    int val;
+};
+
+static void
+gen_ops(struct op *ops, int num)
+{
+    // every context gets its own skew, so the states go everywhere
+    int skew[NUM_CTX];
+    for (int k = 0; k < NUM_CTX; k++) {
+        skew[k] = rand() % 100;
+    }
+    for (int i = 0; i < num; i++) {
+        int r = rand() % 100;
+        ops[i].type = (r < 70) ? OP_DECISION :
+                      (r < 85) ? OP_BYPASS :
+                      (r < 97) ? OP_BYPASS_N : OP_TERMINATE;
+        ops[i].ctx = rand() % NUM_CTX;
+        ops[i].n = 2 + rand() % 31;
+        switch (ops[i].type) {
+        case OP_DECISION:
+            ops[i].val = (rand() % 100) < skew[ops[i].ctx];
+            break;
+        case OP_BYPASS:
+            ops[i].val = rand() & 1;
+            break;
+        case OP_BYPASS_N:
+            ops[i].val = (int)(((uint32_t)rand() << 16 ^ (uint32_t)rand()) &
+                               (0xFFFFFFFFu >> (32 - ops[i].n)));
+            break;
+        default:
+            ops[i].val = 0;
+            break;
+        }
+    }
+}
+
+static void
+encode(struct enc *e, const struct op *ops, int num)
+{
+    enc_start(e);
+    for (int i = 0; i < num; i++) {
+        switch (ops[i].type) {
+        case OP_DECISION:
+            enc_decision(e, ops[i].ctx, ops[i].val);
+            break;
+        case OP_BYPASS:
+            enc_bypass(e, ops[i].val);
+            break;
+        case OP_BYPASS_N:
+            for (int k = ops[i].n - 1; k >= 0; k--) {
+                enc_bypass(e, (ops[i].val >> k) & 1);
+            }
+            break;
+        default:
+            enc_terminate(e, 0);
+            break;
+        }
+    }
+    enc_terminate(e, 1);
+    enc_finish(e);
+}
+
+static int
+decode(cabac_dec *d, const struct op *ops, int num, int round)
+{
+    for (int i = 0; i < num; i++) {
+        int v;
+        switch (ops[i].type) {
+        case OP_DECISION:
+            v = cabac_dec_decision(d, 1 + ops[i].ctx);
+            break;
+        case OP_BYPASS:
+            v = cabac_dec_bypass(d);
+            break;
+        case OP_BYPASS_N:
+            v = cabac_dec_bypass_n(d, ops[i].n);
+            break;
+        default:
+            v = cabac_dec_terminate(d);
+            break;
+        }
+        if (v != ops[i].val) {
+            printf("round %d op %d type %d: %x vs %x\n", round, i, ops[i].type,
+                   v, ops[i].val);
+            return -1;
+        }
+    }
+    if (cabac_dec_terminate(d) != 1) {
+        printf("round %d: no terminate bin at the end\n", round);
+        return -1;
+    }
+    return 0;
+}
+
+/* two substreams back to back, the second one is started with
+ * cabac_dec_reset() where the first one says it ends
+ */
+static int
+test_round(int round)
+{
+    static struct op ops[2][NUM_OPS];
+    int num[2];
+    struct enc e;
+    memset(&e, 0, sizeof(e));
+    e.buf = calloc(NUM_OPS * 8 + 64, 1);
+
+    for (int k = 0; k < NUM_CTX; k++) {
+        e.state[k] = rand() % 63;
+        e.mps[k] = rand() & 1;
+    }
+    uint8_t state[NUM_CTX], mps[NUM_CTX];
+    memcpy(state, e.state, sizeof(state));
+    memcpy(mps, e.mps, sizeof(mps));
+
+    int ends[2];
+    for (int s = 0; s < 2; s++) {
+        num[s] = 1 + rand() % NUM_OPS;
+        gen_ops(ops[s], num[s]);
+        encode(&e, ops[s], num[s]);
+        ends[s] = e.bitpos >> 3;
+    }
+
+    struct bits_vec *v = bits_vec_alloc(e.buf, ends[1], BITS_MSB);
+    cabac_dec *d = cabac_dec_init(v);
+    for (int k = 0; k < NUM_CTX; k++) {
+        d->models[1 + k].state = state[k];
+        d->models[1 + k].mpsbit = mps[k];
+    }
+    int ret = decode(d, ops[0], num[0], round);
+    if (!ret && (v->ptr - e.buf != ends[0] || !BYTE_ALIGNED(v))) {
+        printf("round %d: first substream ends at %d, not %d\n", round,
+               (int)(v->ptr - e.buf), ends[0]);
+        ret = -1;
+    }
+    if (!ret) {
+        cabac_dec_reset(d);
+        ret = decode(d, ops[1], num[1], round);
+    }
+    if (!ret && v->ptr - e.buf != ends[1]) {
+        printf("round %d: second substream ends at %d, not %d\n", round,
+               (int)(v->ptr - e.buf), ends[1]);
+        ret = -1;
+    }
+    cabac_dec_free(d);
+    v->buff = NULL;
+    bits_vec_free(v);
+    free(e.buf);
+    return ret;
+}
+
+int main(void)
+{
+    srand(2024);
+    for (int round = 0; round < 200; round++) {
+        if (test_round(round)) {
+            return -1;
+        }
+    }
+    return 0;
+}
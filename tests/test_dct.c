@@ -299,8 +299,6 @@ int test_idct4x4(void) {
 
 #ifdef ENABLE_VULKAN
 int test_idct4x4_accl(void) {
-  accl_ops_init();
-
   int16_t data[] = {
     117, 115, 112, 112,
     110, 108, 103, 101,
@@ -327,6 +325,83 @@ int test_idct4x4_accl(void) {
 }
 #endif
 
+/* random coefficients in the top left w x h of the block, the SIMD hevc
+ * transforms have to give the same as the C ones, bit exact
+ */
+static int
+test_hevc_itrans_ops(const char *name, const struct accl_ops *ops)
+{
+    static const int sizes[5] = {4, 4, 8, 16, 32};
+    const accl_hevc_itrans ref[5] = {
+        hevc_idst_4x4_c, hevc_idct_4x4_c, hevc_idct_8x8_c,
+        hevc_idct_16x16_c, hevc_idct_32x32_c,
+    };
+    const accl_hevc_itrans simd[5] = {
+        ops->hevc_idst_4x4, ops->hevc_idct_4x4, ops->hevc_idct_8x8,
+        ops->hevc_idct_16x16, ops->hevc_idct_32x32,
+    };
+    int16_t a[32 * 32], b[32 * 32];
+
+    for (int t = 0; t < 5; t++) {
+        int n = sizes[t];
+        if (!simd[t]) {
+            continue;
+        }
+        for (int round = 0; round < 2000; round++) {
+            int bitdepth = 8 + (round % 3) * 2;
+            int w = 1 + rand() % n;
+            int h = 1 + rand() % n;
+            // small blocks of big values too, to hit the clipping
+            int range = (round & 7) ? 512 : 32768;
+            if ((round & 15) == 0) {
+                w = h = 1;
+            }
+            memset(a, 0, sizeof(a));
+            for (int y = 0; y < h; y++) {
+                for (int x = 0; x < w; x++) {
+                    a[x + y * n] = (rand() % (2 * range)) - range;
+                }
+            }
+            memcpy(b, a, sizeof(a));
+            ref[t](a, bitdepth, w, h);
+            simd[t](b, bitdepth, w, h);
+            for (int i = 0; i < n * n; i++) {
+                if (a[i] != b[i]) {
+                    printf("%s %s %dx%d round %d, %dx%d at %d: %d vs %d\n",
+                           name, t ? "idct" : "idst", n, n, round, w, h, i,
+                           a[i], b[i]);
+                    return -1;
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+int test_hevc_itrans(void)
+{
+    /* a flat block from its DC alone, 8 bit: (1024 * 64 + 64) >> 7 = 512
+     * for the columns, (512 * 64 + 2048) >> 12 = 8 for the rows
+     */
+    int16_t dc[8 * 8] = {1024};
+    hevc_idct_8x8_c(dc, 8, 1, 1);
+    for (int i = 0; i < 64; i++) {
+        if (dc[i] != 8) {
+            printf("hevc dc at %d: %d\n", i, dc[i]);
+            return -1;
+        }
+    }
+    struct accl_ops *ops = accl_find(SIMD_TYPE_SSE2);
+    if (ops && test_hevc_itrans_ops("sse", ops)) {
+        return -1;
+    }
+    ops = accl_find(SIMD_TYPE_AVX2);
+    if (ops && test_hevc_itrans_ops("avx2", ops)) {
+        return -1;
+    }
+    return 0;
+}
+
 int test_fdct8x8(void) {
     int16_t data[64] = {
         117, 115, 112, 112, 110, 108, 103, 101, 117, 115, 113, 113, 111,
@@ -408,6 +483,10 @@ int test_idct8x8_16bit()
 
 int main(void)
 {
+    srand(2024);
+    accl_ops_init();
+    if (test_hevc_itrans())
+      return -1;
     if (test_fdct8x8())
       return -1;
     if (test_idct8x8_16bit())
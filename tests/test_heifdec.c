@@ -0,0 +1,68 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "crc.h"
+#include "file.h"
+#include "heif_streams.h"
+#include "vlog.h"
+
+#define TEST_FILE "test_heifdec.heic"
+
+/* checks the size of a decoded picture and its BGRA pixels against the
+ * crc32 of the reference ones
+ */
+static int
+check_pic(const char *name, struct file_ops *ops, struct pic *p, int width,
+          int height, uint32_t expect)
+{
+    if (!p) {
+        printf("%s: decode fail\n", name);
+        return -1;
+    }
+    if (p->width != width || p->height != height || p->depth != 32) {
+        printf("%s: size %dx%d, expect %dx%d\n", name, p->width, p->height,
+               width, height);
+        file_free(ops, p);
+        return -1;
+    }
+    uint32_t crc = 0xFFFFFFFF;
+    for (int y = 0; y < height; y++) {
+        crc = update_crc(crc, (uint8_t *)p->pixels + y * p->pitch, width * 4);
+    }
+    crc = finish_crc32(crc);
+    file_free(ops, p);
+    if (crc != expect) {
+        printf("%s: crc %08x, expect %08x\n", name, crc, expect);
+        return -1;
+    }
+    return 0;
+}
+
+int main(void)
+{
+    vlog_set_global_level(VLOG_ERR);
+    file_ops_init();
+    FILE *f = fopen(TEST_FILE, "wb");
+    if (!f) {
+        return -1;
+    }
+    fwrite(heif_grid_thmb, sizeof(heif_grid_thmb), 1, f);
+    fclose(f);
+
+    int ret = -1;
+    struct file_ops *ops = file_probe(TEST_FILE);
+    if (!ops) {
+        printf("grid: not probed as heif\n");
+    } else {
+        // the canvas against its tiles decoded each on its own, then the
+        // thmb item, which is all the thumbnail mode decodes
+        ret = check_pic("grid", ops, file_load(ops, TEST_FILE, 0), 120, 90,
+                        HEIF_GRID_CRC) ||
+              check_pic("thumbnail", ops, file_load_thumbnail(ops, TEST_FILE),
+                        32, 24, HEIF_THMB_CRC);
+    }
+    remove(TEST_FILE);
+    return ret ? -1 : 0;
+}
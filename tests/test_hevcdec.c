@@ -0,0 +1,148 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hevc.h"
+#include "hevc_streams.h"
+#include "vlog.h"
+
+#define SEI_SUFFIX (40)
+#define SEI_DECODED_PICTURE_HASH (132)
+#define HASH_CHECKSUM (2)
+
+/* the picture_checksum of D.3.19 over one plane */
+static uint32_t
+plane_checksum(const uint16_t *plane, int stride, int width, int height,
+               int bitdepth)
+{
+    uint32_t sum = 0;
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            uint32_t mask = (x & 0xFF) ^ (y & 0xFF) ^ (x >> 8) ^ (y >> 8);
+            uint16_t s = plane[y * stride + x];
+            sum += (s & 0xFF) ^ mask;
+            if (bitdepth > 8) {
+                sum += (s >> 8) ^ mask;
+            }
+        }
+    }
+    return sum;
+}
+
+/* the checksums of a decoded picture hash in a suffix sei nal unit, with
+ * its emulation prevention bytes still in. Returns how many it has.
+ */
+static int
+read_checksums(const uint8_t *nal, int len, uint32_t sums[3])
+{
+    uint8_t *rbsp = malloc(len);
+    int n = 0, zeros = 0;
+    for (int i = 2; i < len; i++) {
+        if (zeros >= 2 && nal[i] == 3) {
+            zeros = 0;
+            continue;
+        }
+        zeros = nal[i] ? 0 : zeros + 1;
+        rbsp[n++] = nal[i];
+    }
+    int pos = 0, count = 0;
+    while (pos < n && rbsp[pos] != 0x80) {
+        int type = 0, size = 0;
+        while (rbsp[pos] == 0xFF) {
+            type += rbsp[pos++];
+        }
+        type += rbsp[pos++];
+        while (rbsp[pos] == 0xFF) {
+            size += rbsp[pos++];
+        }
+        size += rbsp[pos++];
+        if (type == SEI_DECODED_PICTURE_HASH && rbsp[pos] == HASH_CHECKSUM) {
+            for (count = 0; 1 + 4 * count + 4 <= size && count < 3; count++) {
+                const uint8_t *c = rbsp + pos + 1 + 4 * count;
+                sums[count] = (uint32_t)c[0] << 24 | c[1] << 16 | c[2] << 8 | c[3];
+            }
+        }
+        pos += size;
+    }
+    free(rbsp);
+    return count;
+}
+
+/* decodes an annex b stream picture by picture and checks each one against
+ * the checksum sei that follows it
+ */
+static int
+test_stream(const char *name, const uint8_t *data, int len)
+{
+    struct hevc_decoder *dec = hevc_decoder_init(NULL);
+    struct hevc_yuv yuv = { .planes = { NULL } };
+    struct hevc_output out = { .format = HEVC_OUTPUT_YUV, .yuv = &yuv };
+    int pictures = 0, checked = 0, ret = 0;
+    int i = 0;
+    while (i + 3 <= len && !(data[i] == 0 && data[i + 1] == 0 && data[i + 2] == 1)) {
+        i++;
+    }
+    while (i + 3 <= len && !ret) {
+        int s = i + 3, e = s;
+        while (e + 3 <= len &&
+               !(data[e] == 0 && data[e + 1] == 0 && data[e + 2] <= 1)) {
+            e++;
+        }
+        if (e + 3 > len) {
+            e = len;
+        }
+        i = e;
+        while (i + 3 <= len && !(data[i] == 0 && data[i + 1] == 0 && data[i + 2] == 1)) {
+            i++;
+        }
+        const uint8_t *nal = data + s;
+        uint16_t *before = yuv.planes[0];
+        int type = (nal[0] >> 1) & 0x3F;
+        if (type == SEI_SUFFIX) {
+            uint32_t sums[3];
+            int n = read_checksums(nal, e - s, sums);
+            for (int c = 0; c < n && yuv.planes[0]; c++) {
+                int w = yuv.width, h = yuv.height;
+                if (c && yuv.chroma_format_idc != 3) {
+                    w = (w + 1) / 2;
+                }
+                if (c && yuv.chroma_format_idc == 1) {
+                    h = (h + 1) / 2;
+                }
+                uint32_t sum = plane_checksum(yuv.planes[c], yuv.strides[c], w,
+                                              h, yuv.bitdepth);
+                if (sum != sums[c]) {
+                    printf("%s: picture %d plane %d checksum %08x, expect %08x\n",
+                           name, pictures - 1, c, sum, sums[c]);
+                    ret = -1;
+                }
+            }
+            checked += (n > 0);
+        } else {
+            hevc_decoder_decode_nal(dec, (uint8_t *)nal, e - s, &out);
+            pictures += (yuv.planes[0] != before);
+        }
+    }
+    if (!ret && (pictures != 4 || checked != 4)) {
+        printf("%s: %d pictures, %d checked\n", name, pictures, checked);
+        ret = -1;
+    }
+    free(yuv.planes[0]);
+    hevc_decoder_destroy(dec);
+    return ret;
+}
+
+int main(void)
+{
+    vlog_set_global_level(VLOG_ERR);
+    if (test_stream("8 bit 4:2:0", stream_p8, sizeof(stream_p8)) ||
+        test_stream("10 bit 4:2:0", stream_p10, sizeof(stream_p10)) ||
+        test_stream("12 bit 4:2:0", stream_p12, sizeof(stream_p12)) ||
+        test_stream("8 bit 4:2:2", stream_y422, sizeof(stream_y422)) ||
+        test_stream("10 bit 4:2:2", stream_y422p10, sizeof(stream_y422p10)) ||
+        test_stream("8 bit 4:4:4", stream_y444, sizeof(stream_y444))) {
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,509 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hevcdsp.h"
+#include "x86.h"
+
+#define STRIDE (80)
+#define ROWS (80)
+/* edges start at (8, 8), every kernel looks at most 4 samples back */
+#define ORIGIN (8 * STRIDE + 8)
+#define MAX_SEG (16)
+
+static int16_t buf_org[STRIDE * ROWS];
+static int16_t buf_ref[STRIDE * ROWS];
+static int16_t buf_simd[STRIDE * ROWS];
+
+/* smooth lines with a step on the edge, so the filters take all branches.
+ * ver puts the edge between column 7 and 8, otherwise between row 7 and 8
+ */
+static void
+fill_pixels(int16_t *buf, int ver, int maxval, int noise)
+{
+    int scale = (maxval + 1) / 256;
+    for (int l = 0; l < STRIDE; l++) {
+        int base = rand() % (maxval + 1);
+        int step = ((rand() % 41) - 20) * scale;
+        if ((rand() & 7) == 0) {
+            step *= 4;
+        }
+        for (int i = 0; i < ROWS; i++) {
+            int v = base + (i >= 8 ? step : 0) +
+                    (rand() % (2 * noise + 1) - noise) * scale;
+            v = v < 0 ? 0 : (v > maxval ? maxval : v);
+            if (ver) {
+                buf[l * STRIDE + i] = v;
+            } else {
+                buf[i * STRIDE + l] = v;
+            }
+        }
+    }
+}
+
+static void
+fill_edges(struct hevc_edge *e, int n, int maxval)
+{
+    int scale = (maxval + 1) / 256;
+    for (int k = 0; k < n; k++) {
+        e[k].beta = (rand() % 65) * scale;
+        e[k].tc = ((rand() & 3) == 0) ? 0 : (rand() % 25) * scale;
+        e[k].no_p = (rand() & 7) == 0;
+        e[k].no_q = (rand() & 7) == 0;
+    }
+}
+
+static int
+clip(int v, int maxval)
+{
+    return v < 0 ? 0 : (v > maxval ? maxval : v);
+}
+
+static int
+compare(const char *name, int round)
+{
+    for (int i = 0; i < STRIDE * ROWS; i++) {
+        if (buf_ref[i] != buf_simd[i]) {
+            printf("%s not match in round %d at (%d, %d): %d vs %d\n", name,
+                   round, i % STRIDE - 8, i / STRIDE - 8, buf_ref[i],
+                   buf_simd[i]);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int
+test_filters(const char *simd_name, const struct hevc_dsp *ref,
+             const struct hevc_dsp *simd)
+{
+    static const int maxvals[] = {255, 1023, 4095};
+    struct hevc_edge e[MAX_SEG];
+    int strong = 0, normal = 0;
+
+    for (int round = 0; round < 6000; round++) {
+        int maxval = maxvals[round % 3];
+        int ver = (round >> 2) & 1;
+        int n = 1 + rand() % MAX_SEG;
+        char name[64];
+
+        fill_pixels(buf_org, ver, maxval, 1 + (round & 3));
+        fill_edges(e, n, maxval);
+        memcpy(buf_ref, buf_org, sizeof(buf_org));
+        memcpy(buf_simd, buf_org, sizeof(buf_org));
+        if (round & 1) {
+            hevc_deblock_func fr = ver ? ref->chroma_edge_ver : ref->chroma_edge_hor;
+            hevc_deblock_func fs = ver ? simd->chroma_edge_ver : simd->chroma_edge_hor;
+            fr(buf_ref + ORIGIN, STRIDE, e, n, maxval);
+            fs(buf_simd + ORIGIN, STRIDE, e, n, maxval);
+            snprintf(name, sizeof(name), "%s chroma_edge_%s", simd_name,
+                     ver ? "ver" : "hor");
+        } else {
+            hevc_deblock_func fr = ver ? ref->luma_edge_ver : ref->luma_edge_hor;
+            hevc_deblock_func fs = ver ? simd->luma_edge_ver : simd->luma_edge_hor;
+            fr(buf_ref + ORIGIN, STRIDE, e, n, maxval);
+            fs(buf_simd + ORIGIN, STRIDE, e, n, maxval);
+            snprintf(name, sizeof(name), "%s luma_edge_%s", simd_name,
+                     ver ? "ver" : "hor");
+            // p2 only changes with the strong filter
+            for (int l = 0; l < 4 * n; l++) {
+                int p2 = ver ? ORIGIN + l * STRIDE - 3 : ORIGIN - 3 * STRIDE + l;
+                int p0 = ver ? ORIGIN + l * STRIDE - 1 : ORIGIN - STRIDE + l;
+                if (buf_ref[p2] != buf_org[p2]) {
+                    strong++;
+                } else if (buf_ref[p0] != buf_org[p0]) {
+                    normal++;
+                }
+            }
+        }
+        if (compare(name, round)) {
+            return -1;
+        }
+    }
+    if (strong == 0 || normal == 0) {
+        printf("%s: not all branches taken, strong %d normal %d\n", simd_name,
+               strong, normal);
+        return -1;
+    }
+    return 0;
+}
+
+/* random lines for sao, the neighbours are close to the samples so all the
+ * edge classes show up
+ */
+static int
+test_sao(const char *simd_name, const struct hevc_dsp *ref,
+         const struct hevc_dsp *simd)
+{
+    static const int maxvals[] = {255, 1023, 4095};
+    int16_t offset[5];
+
+    for (int round = 0; round < 4000; round++) {
+        int maxval = maxvals[round % 3];
+        int shift = (round % 3) * 2 + 3;
+        int n = 1 + rand() % (STRIDE - 16);
+        int range = 1 << (shift - 3 + 5);
+
+        for (int i = 0; i < STRIDE * ROWS; i++) {
+            buf_org[i] = rand() % (maxval + 1);
+        }
+        // the samples sit near their neighbours along the 135 degree class
+        for (int i = 0; i + 2 < STRIDE; i++) {
+            int v = buf_org[STRIDE + i] + (rand() % 3) - 1;
+            buf_org[2 * STRIDE + i + 1] = clip(v, maxval);
+            v = buf_org[STRIDE + i] + (rand() % 3) - 1;
+            buf_org[3 * STRIDE + i + 2] = clip(v, maxval);
+        }
+        for (int k = 0; k < 5; k++) {
+            offset[k] = (rand() % (2 * range + 1)) - range;
+        }
+        offset[0] = (round & 1) ? 0 : offset[0];
+        memcpy(buf_ref, buf_org, sizeof(buf_org));
+        memcpy(buf_simd, buf_org, sizeof(buf_org));
+        if (round & 1) {
+            int pos = rand() % 32;
+            ref->sao_band(buf_ref + 8 * STRIDE, buf_org + 2 * STRIDE, n,
+                          offset + 1, pos, shift, maxval);
+            simd->sao_band(buf_simd + 8 * STRIDE, buf_org + 2 * STRIDE, n,
+                           offset + 1, pos, shift, maxval);
+        } else {
+            ref->sao_edge(buf_ref + 8 * STRIDE, buf_org + 2 * STRIDE + 1,
+                          buf_org + STRIDE, buf_org + 3 * STRIDE + 2, n,
+                          offset, maxval);
+            simd->sao_edge(buf_simd + 8 * STRIDE, buf_org + 2 * STRIDE + 1,
+                           buf_org + STRIDE, buf_org + 3 * STRIDE + 2, n,
+                           offset, maxval);
+        }
+        if (compare((round & 1) ? "sao_band" : "sao_edge", round)) {
+            printf("%s\n", simd_name);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/* random reference samples, smooth ones for half of the rounds, through every
+ * mode, size and boundary filter case of the intra prediction
+ */
+static void
+fill_refs(uint16_t *left, uint16_t *top, int n, int maxval, int smooth)
+{
+    int v = rand() % (maxval + 1);
+    for (int i = -1; i < 2 * n; i++) {
+        v = smooth ? clip(v + (rand() % 9) - 4, maxval) : rand() % (maxval + 1);
+        top[i] = v;
+    }
+    v = top[-1];
+    for (int i = 0; i < 2 * n; i++) {
+        v = smooth ? clip(v + (rand() % 9) - 4, maxval) : rand() % (maxval + 1);
+        left[i] = v;
+    }
+}
+
+static int
+test_intra(const char *simd_name, const struct hevc_dsp *ref,
+           const struct hevc_dsp *simd)
+{
+    static const int maxvals[] = {255, 1023, 4095};
+    uint16_t left[64], top_buf[65], *top = top_buf + 1;
+    uint16_t l2[64], t2_buf[65], *t2 = t2_buf + 1;
+    uint16_t *pr = (uint16_t *)buf_ref, *ps = (uint16_t *)buf_simd;
+
+    for (int round = 0; round < 3000; round++) {
+        int bitdepth = 8 + (round % 3) * 2;
+        int maxval = maxvals[round % 3];
+        int n = 4 << (rand() % 4);
+        int cIdx = (round >> 2) & 1;
+        int disable = (round & 15) == 3;
+        fill_refs(left, top, n, maxval, round & 1);
+
+        for (int mode = 0; mode < 35; mode++) {
+            memset(buf_ref, 0, sizeof(buf_ref));
+            memset(buf_simd, 0, sizeof(buf_simd));
+            if (mode == 0) {
+                ref->intra_planar(pr, left, top, n, STRIDE);
+                simd->intra_planar(ps, left, top, n, STRIDE);
+            } else if (mode == 1) {
+                ref->intra_dc(pr, left, top, n, STRIDE, cIdx, disable);
+                simd->intra_dc(ps, left, top, n, STRIDE, cIdx, disable);
+            } else {
+                ref->intra_angular(pr, left, top, n, STRIDE, cIdx, mode,
+                                   disable, bitdepth);
+                simd->intra_angular(ps, left, top, n, STRIDE, cIdx, mode,
+                                    disable, bitdepth);
+            }
+            if (memcmp(buf_ref, buf_simd, sizeof(buf_ref))) {
+                printf("%s intra mode %d size %d cIdx %d round %d not match\n",
+                       simd_name, mode, n, cIdx, round);
+                return -1;
+            }
+        }
+        if (n == 4) {
+            continue;
+        }
+        memcpy(l2, left, sizeof(left));
+        memcpy(t2_buf, top_buf, sizeof(top_buf));
+        ref->intra_filter(left, top, n);
+        simd->intra_filter(l2, t2, n);
+        if (memcmp(left, l2, 2 * n * 2) || memcmp(top_buf, t2_buf, (2 * n + 1) * 2)) {
+            printf("%s intra filter size %d round %d not match\n", simd_name,
+                   n, round);
+            return -1;
+        }
+        if (n == 32) {
+            ref->intra_strong_filter(left, top, n);
+            simd->intra_strong_filter(l2, t2, n);
+            if (memcmp(left, l2, sizeof(left)) || memcmp(top_buf, t2_buf, sizeof(top_buf))) {
+                printf("%s strong filter round %d not match\n", simd_name, round);
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+/* a flat step of 10, worked out by hand from 8-373 to 8-378 */
+static int
+test_strong_filter(const struct hevc_dsp *ref)
+{
+    static const int16_t expect[8] = {100, 101, 103, 104, 106, 108, 109, 110};
+    struct hevc_edge e[2] = {
+        {.beta = 64, .tc = 5},
+        {.beta = 64, .tc = 5},
+    };
+    for (int i = 0; i < STRIDE * ROWS; i++) {
+        buf_ref[i] = (i % STRIDE < 8) ? 100 : 110;
+    }
+    ref->luma_edge_ver(buf_ref + ORIGIN, STRIDE, e, 2, 255);
+    for (int l = 0; l < 8; l++) {
+        for (int i = 0; i < 8; i++) {
+            if (buf_ref[ORIGIN + l * STRIDE + i - 4] != expect[i]) {
+                printf("strong filter line %d at %d: %d vs %d\n", l, i - 4,
+                       buf_ref[ORIGIN + l * STRIDE + i - 4], expect[i]);
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+/* random lines at 8, 10 and 12 bits of any width, 4:2:0 and 4:4:4 chroma */
+static int
+test_yuv(const char *simd_name, const struct hevc_dsp *ref,
+         const struct hevc_dsp *simd)
+{
+    static uint8_t out_ref[STRIDE * 8], out_simd[STRIDE * 8];
+
+    for (int round = 0; round < 3000; round++) {
+        int bitdepth = 8 + (round % 3) * 2;
+        int sub = (round >> 1) & 1;
+        int width = 1 + rand() % STRIDE;
+        // y, u and v on a row each of buf_org
+        for (int i = 0; i < 3 * STRIDE; i++) {
+            buf_org[i] = rand() % (1 << bitdepth);
+        }
+        memset(out_ref, 0, sizeof(out_ref));
+        memset(out_simd, 0, sizeof(out_simd));
+        if (round & 1) {
+            ref->yuv_rgba64((uint16_t *)out_ref, buf_org, buf_org + STRIDE,
+                            buf_org + 2 * STRIDE, width, sub, bitdepth);
+            simd->yuv_rgba64((uint16_t *)out_simd, buf_org, buf_org + STRIDE,
+                             buf_org + 2 * STRIDE, width, sub, bitdepth);
+        } else {
+            ref->yuv_bgra32(out_ref, buf_org, buf_org + STRIDE,
+                            buf_org + 2 * STRIDE, width, sub, bitdepth);
+            simd->yuv_bgra32(out_simd, buf_org, buf_org + STRIDE,
+                             buf_org + 2 * STRIDE, width, sub, bitdepth);
+        }
+        if (memcmp(out_ref, out_simd, sizeof(out_ref))) {
+            printf("%s %s round %d: width %d sub %d bitdepth %d\n", simd_name,
+                   (round & 1) ? "yuv_rgba64" : "yuv_bgra32", round, width, sub,
+                   bitdepth);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/* grey in, grey out at full scale, and the alpha */
+static int
+test_yuv_grey(const struct hevc_dsp *ref)
+{
+    int16_t y[2] = {0, 1023}, uv[2] = {512, 512};
+    uint8_t bgra[8];
+    uint16_t rgba[8];
+    ref->yuv_bgra32(bgra, y, uv, uv, 2, 0, 10);
+    ref->yuv_rgba64(rgba, y, uv, uv, 2, 0, 10);
+    for (int c = 0; c < 3; c++) {
+        if (bgra[c] != 0 || bgra[4 + c] != 255 || rgba[c] != 0 ||
+            rgba[4 + c] != 0xFFFF) {
+            printf("grey channel %d: %d %d %d %d\n", c, bgra[c], bgra[4 + c],
+                   rgba[c], rgba[4 + c]);
+            return -1;
+        }
+    }
+    if (bgra[3] != 255 || rgba[3] != 0xFFFF) {
+        printf("alpha %d %d\n", bgra[3], rgba[3]);
+        return -1;
+    }
+    return 0;
+}
+
+/* interpolation of random samples from (8, 8) on at every fraction, for the
+ * block widths of all partitions of luma and of 4:2:0 chroma
+ */
+static int
+test_mc(const char *simd_name, const struct hevc_dsp *ref,
+        const struct hevc_dsp *simd)
+{
+    static const int widths[] = {2, 4, 6, 8, 12, 16, 24, 32, 48, 64};
+
+    for (int round = 0; round < 2000; round++) {
+        int bitdepth = 8 + (round % 3) * 2;
+        int chroma = (round >> 1) & 1;
+        int w = widths[rand() % 10];
+        int h = 1 + rand() % 64;
+        int mx = rand() % (chroma ? 8 : 4);
+        int my = rand() % (chroma ? 8 : 4);
+        for (int i = 0; i < STRIDE * ROWS; i++) {
+            buf_org[i] = rand() % (1 << bitdepth);
+        }
+        memset(buf_ref, 0, sizeof(buf_ref));
+        memset(buf_simd, 0, sizeof(buf_simd));
+        hevc_mc_func fr = chroma ? ref->mc_chroma : ref->mc_luma;
+        hevc_mc_func fs = chroma ? simd->mc_chroma : simd->mc_luma;
+        fr(buf_ref, STRIDE, buf_org + ORIGIN, STRIDE, w, h, mx, my, bitdepth);
+        fs(buf_simd, STRIDE, buf_org + ORIGIN, STRIDE, w, h, mx, my, bitdepth);
+        if (memcmp(buf_ref, buf_simd, sizeof(buf_ref))) {
+            printf("%s mc_%s round %d: %dx%d frac (%d, %d) bitdepth %d\n",
+                   simd_name, chroma ? "chroma" : "luma", round, w, h, mx, my,
+                   bitdepth);
+            return compare("mc", round);
+        }
+    }
+    return 0;
+}
+
+/* the weightings of random 14 bit predictions, uni and bi, default and
+ * explicit with weights and offsets over their whole range
+ */
+static int
+test_pred(const char *simd_name, const struct hevc_dsp *ref,
+          const struct hevc_dsp *simd)
+{
+    static int16_t src0[64 * 64], src1[64 * 64];
+
+    for (int round = 0; round < 4000; round++) {
+        int bitdepth = 8 + (round % 3) * 2;
+        int w = 2 * (1 + rand() % 32);
+        int h = 1 + rand() % 64;
+        int log2wd = rand() % 8 + 14 - bitdepth;
+        int w0 = rand() % 384 - 128, w1 = rand() % 384 - 128;
+        int o0 = (rand() % 256 - 128) << (bitdepth - 8);
+        int o1 = (rand() % 256 - 128) << (bitdepth - 8);
+        for (int i = 0; i < 64 * 64; i++) {
+            src0[i] = rand() % (1 << 15) - (1 << 13);
+            src1[i] = rand() % (1 << 15) - (1 << 13);
+        }
+        memset(buf_ref, 0, sizeof(buf_ref));
+        memset(buf_simd, 0, sizeof(buf_simd));
+        switch (round & 3) {
+        case 0:
+            ref->pred_uni(buf_ref, STRIDE, src0, 64, w, h, bitdepth);
+            simd->pred_uni(buf_simd, STRIDE, src0, 64, w, h, bitdepth);
+            break;
+        case 1:
+            ref->pred_bi(buf_ref, STRIDE, src0, src1, 64, w, h, bitdepth);
+            simd->pred_bi(buf_simd, STRIDE, src0, src1, 64, w, h, bitdepth);
+            break;
+        case 2:
+            ref->pred_uni_w(buf_ref, STRIDE, src0, 64, w, h, log2wd, w0, o0,
+                            bitdepth);
+            simd->pred_uni_w(buf_simd, STRIDE, src0, 64, w, h, log2wd, w0, o0,
+                             bitdepth);
+            break;
+        default:
+            ref->pred_bi_w(buf_ref, STRIDE, src0, src1, 64, w, h, log2wd, w0,
+                           w1, o0, o1, bitdepth);
+            simd->pred_bi_w(buf_simd, STRIDE, src0, src1, 64, w, h, log2wd, w0,
+                            w1, o0, o1, bitdepth);
+            break;
+        }
+        if (memcmp(buf_ref, buf_simd, sizeof(buf_ref))) {
+            printf("%s pred %d round %d: %dx%d bitdepth %d\n", simd_name,
+                   round & 3, round, w, h, bitdepth);
+            return compare("pred", round);
+        }
+    }
+    return 0;
+}
+
+/* runs of zeros with threes in between, so there are plenty of 0x000003,
+ * including ones right after another and near the end
+ */
+static int
+test_unescape(const char *simd_name, const struct hevc_dsp *ref,
+              const struct hevc_dsp *simd)
+{
+    static uint8_t src[1024], dst_ref[1024], dst_simd[1024];
+    static int epb_ref[1024 / 3 + 1], epb_simd[1024 / 3 + 1];
+
+    for (int round = 0; round < 4000; round++) {
+        int len = 1 + rand() % (int)sizeof(src);
+        int zeros = 1 + round % 8;
+        for (int i = 0; i < len; i++) {
+            int r = rand() % 10;
+            src[i] = (r < zeros) ? 0 : (r < 9) ? 3 : rand();
+        }
+        int num_ref, num_simd;
+        int n_ref = ref->unescape(dst_ref, src, len, epb_ref, &num_ref);
+        int n_simd = simd->unescape(dst_simd, src, len, epb_simd, &num_simd);
+        if (n_ref != n_simd || num_ref != num_simd ||
+            memcmp(dst_ref, dst_simd, n_ref) ||
+            memcmp(epb_ref, epb_simd, num_ref * sizeof(int))) {
+            printf("%s unescape round %d: len %d, %d/%d bytes, %d/%d epb\n",
+                   simd_name, round, len, n_ref, n_simd, num_ref, num_simd);
+            return -1;
+        }
+        if (n_ref + num_ref != len) {
+            printf("unescape round %d: %d bytes and %d epb of %d\n", round,
+                   n_ref, num_ref, len);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+int main(void)
+{
+    struct hevc_dsp ref, simd;
+
+    srand(1234);
+    hevc_dsp_init_c(&ref);
+    if (test_strong_filter(&ref) || test_yuv_grey(&ref)) {
+        return -1;
+    }
+#ifdef __SSE4_1__
+    hevc_dsp_init_c(&simd);
+    x86_hevc_dsp_init_sse4(&simd);
+    if (test_filters("sse4", &ref, &simd) || test_sao("sse4", &ref, &simd) ||
+        test_intra("sse4", &ref, &simd) || test_yuv("sse4", &ref, &simd) ||
+        test_unescape("sse4", &ref, &simd) || test_mc("sse4", &ref, &simd) ||
+        test_pred("sse4", &ref, &simd)) {
+        return -1;
+    }
+#endif
+#ifdef __AVX2__
+    hevc_dsp_init_c(&simd);
+    x86_hevc_dsp_init_avx2(&simd);
+    if (test_filters("avx2", &ref, &simd) || test_sao("avx2", &ref, &simd) ||
+        test_intra("avx2", &ref, &simd) || test_yuv("avx2", &ref, &simd) ||
+        test_unescape("avx2", &ref, &simd) || test_mc("avx2", &ref, &simd) ||
+        test_pred("avx2", &ref, &simd)) {
+        return -1;
+    }
+#endif
+    (void)simd;
+    return 0;
+}
@@ -0,0 +1,431 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "colorspace.h"
+#include "crc.h"
+#include "file.h"
+#include "vp8enc.h"
+
+#define WIDTH 40
+#define HEIGHT 56
+#define TEST_FILE "test_idec.bin"
+
+/* gradient with a diagonal edge, in BGR24 and XRGB8888 */
+static void
+fill_pic(struct pic *p, int bpp)
+{
+    p->width = WIDTH;
+    p->height = HEIGHT;
+    p->depth = bpp * 8;
+    p->pitch = WIDTH * bpp;
+    p->format = (bpp == 4) ? CS_PIXELFORMAT_XRGB8888 : CS_PIXELFORMAT_RGB888;
+    p->pixels = malloc(p->pitch * HEIGHT);
+    uint8_t *px = p->pixels;
+    for (int y = 0; y < HEIGHT; y++) {
+        for (int x = 0; x < WIDTH; x++) {
+            uint8_t *c = px + y * p->pitch + x * bpp;
+            c[0] = 40 + x * 4;
+            c[1] = 200 - y * 3;
+            c[2] = (x > y) ? 220 : 60;
+            if (bpp == 4) {
+                c[3] = 0xFF;
+            }
+        }
+    }
+}
+
+static int
+write_whole(const char *fname, const uint8_t *buf, int len)
+{
+    FILE *f = fopen(fname, "wb");
+    if (!f) {
+        return -1;
+    }
+    fwrite(buf, len, 1, f);
+    fclose(f);
+    return 0;
+}
+
+static int
+rows_equal(const struct pic *a, const struct pic *b, int from, int to)
+{
+    int n = a->width * a->depth / 8;
+    for (int y = from; y < to; y++) {
+        if (memcmp((uint8_t *)a->pixels + y * a->pitch,
+                   (uint8_t *)b->pixels + y * b->pitch, n)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* feed buf to an incremental decoder in pieces of step bytes, every row
+ * reported as decoded must already match the one shot decode of ref */
+static int
+feed(const char *name, struct file_ops *ops, const struct pic *ref,
+     const uint8_t *buf, int len, int step)
+{
+    struct idec *d = idec_new(ops);
+    if (!d) {
+        printf("%s: no incremental decoder\n", name);
+        return -1;
+    }
+    int last = 0, partial = 0, ret = -1;
+    int status = IDEC_SUSPENDED;
+    for (int pos = 0; pos < len && status == IDEC_SUSPENDED; pos += step) {
+        status = idec_append(d, buf + pos, (len - pos < step) ? len - pos : step);
+        int rows;
+        struct pic *p = idec_get_rows(d, &rows);
+        if (status == IDEC_ERROR) {
+            printf("%s: error at %d of %d\n", name, pos, len);
+            goto out;
+        }
+        if (rows < last || rows > ref->height) {
+            printf("%s: rows %d after %d\n", name, rows, last);
+            goto out;
+        }
+        if (rows > last) {
+            if (p->width != ref->width || p->height != ref->height ||
+                p->depth != ref->depth || !rows_equal(p, ref, last, rows)) {
+                printf("%s: rows %d to %d not match\n", name, last, rows);
+                goto out;
+            }
+            if (rows < ref->height) {
+                partial = 1;
+            }
+            last = rows;
+        }
+    }
+    if (status != IDEC_DONE || last != ref->height) {
+        printf("%s: not done, status %d rows %d\n", name, status, last);
+        goto out;
+    }
+    if (!partial) {
+        printf("%s: no rows before the end\n", name);
+        goto out;
+    }
+    /* nothing more is taken once done */
+    if (idec_append(d, buf, 1) != IDEC_DONE) {
+        printf("%s: append after done\n", name);
+        goto out;
+    }
+    ret = 0;
+out:
+    idec_free(d);
+    return ret;
+}
+
+/* same data truncated, the decoder must suspend and never complete */
+static int
+feed_truncated(const char *name, struct file_ops *ops, const uint8_t *buf,
+               int len)
+{
+    struct idec *d = idec_new(ops);
+    int status = idec_append(d, buf, len * 2 / 3);
+    idec_free(d);
+    if (status != IDEC_SUSPENDED) {
+        printf("%s: truncated data status %d\n", name, status);
+        return -1;
+    }
+    return 0;
+}
+
+static int
+check(const char *name, const uint8_t *buf, int len)
+{
+    static const int steps[] = {1, 7, 61};
+    if (write_whole(TEST_FILE, buf, len)) {
+        return -1;
+    }
+    struct file_ops *ops = file_probe(TEST_FILE);
+    if (!ops) {
+        printf("%s: not probed\n", name);
+        return -1;
+    }
+    struct pic *ref = file_load(ops, TEST_FILE, 0);
+    if (!ref) {
+        printf("%s: decode fail\n", name);
+        return -1;
+    }
+    int ret = 0;
+    for (size_t i = 0; i < sizeof(steps) / sizeof(steps[0]) && !ret; i++) {
+        ret = feed(name, ops, ref, buf, len, steps[i]);
+    }
+    if (!ret) {
+        ret = feed_truncated(name, ops, buf, len);
+    }
+    file_free(ops, ref);
+    return ret;
+}
+
+static int
+test_webp(void)
+{
+    struct pic src;
+    struct vp8_enc_config cfg = {.quality = 80, .speed = VP8_ENC_FAST};
+    uint8_t *vp8;
+
+    fill_pic(&src, 4);
+    int len = vp8_encode(&src, &cfg, &vp8);
+    free(src.pixels);
+    if (len <= 0) {
+        printf("webp: encode fail %d\n", len);
+        return -1;
+    }
+    int size = 20 + len + (len & 1);
+    uint8_t *buf = calloc(1, size);
+    uint32_t riff = size - 8;
+    memcpy(buf, "RIFF", 4);
+    for (int i = 0; i < 4; i++) {
+        buf[4 + i] = (riff >> (8 * i)) & 0xFF;
+        buf[16 + i] = (len >> (8 * i)) & 0xFF;
+    }
+    memcpy(buf + 8, "WEBPVP8 ", 8);
+    memcpy(buf + 20, vp8, len);
+    free(vp8);
+    int ret = check("webp", buf, size);
+    free(buf);
+    return ret;
+}
+
+/* jpeg bits go out from the msb, with 0xFF stuffed */
+struct jpg_writer {
+    uint8_t *buf;
+    int pos;
+    uint32_t acc;
+    int n;
+};
+
+static void
+jpg_put(struct jpg_writer *w, uint32_t v, int n)
+{
+    for (int i = n - 1; i >= 0; i--) {
+        w->acc = (w->acc << 1) | ((v >> i) & 1);
+        if (++w->n == 8) {
+            w->buf[w->pos++] = w->acc;
+            if (w->acc == 0xFF) {
+                w->buf[w->pos++] = 0;
+            }
+            w->acc = w->n = 0;
+        }
+    }
+}
+
+static void
+jpg_flush(struct jpg_writer *w)
+{
+    while (w->n) {
+        jpg_put(w, 1, 1);
+    }
+}
+
+static void
+jpg_marker(struct jpg_writer *w, int m, const uint8_t *seg, int len)
+{
+    w->buf[w->pos++] = 0xFF;
+    w->buf[w->pos++] = m;
+    if (seg) {
+        w->buf[w->pos++] = (len + 2) >> 8;
+        w->buf[w->pos++] = (len + 2) & 0xFF;
+        memcpy(w->buf + w->pos, seg, len);
+        w->pos += len;
+    }
+}
+
+/* grayscale baseline with dc only blocks and a restart every 3 blocks, the
+ * dc table has 4 bits codes for all categories, the ac table only an EOB */
+static int
+test_jpg(void)
+{
+    static const uint8_t sof[] = {8, 0, HEIGHT, 0, WIDTH, 1, 1, 0x11, 0};
+    static const uint8_t dri[] = {0, 3};
+    static const uint8_t dht_dc[] = {0x00, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0,
+                                     0, 0, 0, 0, 0, 0,
+                                     0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    static const uint8_t dht_ac[] = {0x10, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                                     0, 0, 0, 0, 0, 0, 0};
+    static const uint8_t sos[] = {1, 1, 0x00, 0, 63, 0};
+    uint8_t dqt[65] = {0};
+    for (int i = 1; i < 65; i++) {
+        dqt[i] = 1;
+    }
+    struct jpg_writer w = {.buf = malloc(WIDTH * HEIGHT + 1024)};
+    jpg_marker(&w, 0xD8, NULL, 0);
+    jpg_marker(&w, 0xDB, dqt, sizeof(dqt));
+    jpg_marker(&w, 0xC0, sof, sizeof(sof));
+    jpg_marker(&w, 0xC4, dht_dc, sizeof(dht_dc));
+    jpg_marker(&w, 0xC4, dht_ac, sizeof(dht_ac));
+    jpg_marker(&w, 0xDD, dri, sizeof(dri));
+    jpg_marker(&w, 0xDA, sos, sizeof(sos));
+    int pred = 0, n = 0;
+    for (int y = 0; y < HEIGHT / 8; y++) {
+        for (int x = 0; x < WIDTH / 8; x++) {
+            if (n && n % 3 == 0) {
+                jpg_flush(&w);
+                jpg_marker(&w, 0xD0 + (n / 3 - 1) % 8, NULL, 0);
+                pred = 0;
+            }
+            int dc = ((x * 37 + y * 91) % 255 - 127) * 8;
+            int diff = dc - pred, s = 0;
+            while ((abs(diff) >> s) > 0) {
+                s++;
+            }
+            jpg_put(&w, s, 4);
+            jpg_put(&w, (diff < 0) ? diff + (1 << s) - 1 : diff, s);
+            jpg_put(&w, 0, 1);
+            pred = dc;
+            n++;
+        }
+    }
+    jpg_flush(&w);
+    jpg_marker(&w, 0xD9, NULL, 0);
+    int ret = check("jpg", w.buf, w.pos);
+    free(w.buf);
+    return ret;
+}
+
+/* deflate bits go out from the lsb, huffman codes from their msb */
+struct bit_writer {
+    uint8_t *buf;
+    int pos;
+    int bit;
+};
+
+static void
+put_bits(struct bit_writer *w, uint32_t v, int n)
+{
+    for (int i = 0; i < n; i++) {
+        if (w->bit == 0) {
+            w->buf[w->pos] = 0;
+        }
+        w->buf[w->pos] |= ((v >> i) & 1) << w->bit;
+        if (++w->bit == 8) {
+            w->bit = 0;
+            w->pos++;
+        }
+    }
+}
+
+static void
+put_code(struct bit_writer *w, uint32_t code, int n)
+{
+    for (int i = n - 1; i >= 0; i--) {
+        put_bits(w, (code >> i) & 1, 1);
+    }
+}
+
+static uint8_t *
+put_chunk(uint8_t *out, const char *type, const uint8_t *data, int len)
+{
+    for (int i = 0; i < 4; i++) {
+        out[i] = (len >> (24 - 8 * i)) & 0xFF;
+    }
+    memcpy(out + 4, type, 4);
+    memcpy(out + 8, data, len);
+    uint32_t crc = finish_crc32(update_crc(init_crc32(out + 4, 4), out + 8, len));
+    for (int i = 0; i < 4; i++) {
+        out[8 + len + i] = (crc >> (24 - 8 * i)) & 0xFF;
+    }
+    return out + 12 + len;
+}
+
+/* zlib stream with a stored block and a fixed huffman block, split in two
+ * IDAT chunks so both block types and chunk boundaries are exercised */
+static int
+test_png(void)
+{
+    int line = WIDTH * 3 + 1;
+    int raw_len = line * HEIGHT;
+    uint8_t *raw = malloc(raw_len);
+    struct pic src;
+    fill_pic(&src, 3);
+    for (int y = 0; y < HEIGHT; y++) {
+        uint8_t *s = (uint8_t *)src.pixels + y * src.pitch;
+        uint8_t *r = raw + y * line;
+        /* rgb order in png, alternate none and sub filters */
+        r[0] = y & 1;
+        for (int x = 0; x < WIDTH * 3; x++) {
+            uint8_t v = s[x - x % 3 + 2 - x % 3];
+            uint8_t a = (x >= 3) ? s[x - 3 - x % 3 + 2 - x % 3] : 0;
+            r[1 + x] = (r[0] == 1) ? (uint8_t)(v - a) : v;
+        }
+    }
+    free(src.pixels);
+
+    uint8_t *z = malloc(raw_len * 2 + 64);
+    struct bit_writer w = {.buf = z};
+    z[w.pos++] = 0x78;
+    z[w.pos++] = 0x01;
+    int stored = raw_len / 3;
+    put_bits(&w, 0, 3);
+    w.bit = 0;
+    w.pos++;
+    z[w.pos++] = stored & 0xFF;
+    z[w.pos++] = stored >> 8;
+    z[w.pos++] = ~stored & 0xFF;
+    z[w.pos++] = (~stored >> 8) & 0xFF;
+    memcpy(z + w.pos, raw, stored);
+    w.pos += stored;
+    put_bits(&w, 1, 1);
+    put_bits(&w, 1, 2);
+    for (int i = stored; i < raw_len; i++) {
+        if (raw[i] < 144) {
+            put_code(&w, 0x30 + raw[i], 8);
+        } else {
+            put_code(&w, 0x190 + raw[i] - 144, 9);
+        }
+    }
+    put_code(&w, 0, 7);
+    if (w.bit) {
+        w.pos++;
+    }
+    uint32_t s1 = 1, s2 = 0;
+    for (int i = 0; i < raw_len; i++) {
+        s1 = (s1 + raw[i]) % 65521;
+        s2 = (s2 + s1) % 65521;
+    }
+    uint32_t adler = (s2 << 16) | s1;
+    for (int i = 0; i < 4; i++) {
+        z[w.pos++] = (adler >> (24 - 8 * i)) & 0xFF;
+    }
+    free(raw);
+
+    uint8_t *buf = malloc(w.pos + 128);
+    uint8_t *out = buf;
+    uint8_t ihdr[13] = {0, 0, 0, WIDTH, 0, 0, 0, HEIGHT, 8, 2, 0, 0, 0};
+    static const uint8_t sig[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    memcpy(out, sig, 8);
+    out = put_chunk(out + 8, "IHDR", ihdr, sizeof(ihdr));
+    out = put_chunk(out, "IDAT", z, w.pos / 2);
+    out = put_chunk(out, "IDAT", z + w.pos / 2, w.pos - w.pos / 2);
+    out = put_chunk(out, "IEND", NULL, 0);
+    free(z);
+    int ret = check("png", buf, out - buf);
+    free(buf);
+    return ret;
+}
+
+static int
+test_no_idec(void)
+{
+    struct file_ops *ops = file_find_codec("BMP");
+    if (ops && idec_new(ops)) {
+        printf("bmp has no incremental decoder\n");
+        return -1;
+    }
+    return 0;
+}
+
+int main(void)
+{
+    int ret = -1;
+
+    file_ops_init();
+    if (!test_webp() && !test_jpg() && !test_png() && !test_no_idec()) {
+        ret = 0;
+    }
+    remove(TEST_FILE);
+    return ret;
+}
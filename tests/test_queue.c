@@ -7,9 +7,15 @@
 
 #include "queue.h"
 
+/* main checks the order of its first items, the thread starts after them */
+static atomic_bool started;
+
 void *test_enqueue(void *arg) {
     printf("new thread started\n");
     struct ring_queue *rq = (struct ring_queue *)arg;
+    while (!atomic_load(&started)) {
+        usleep(1);
+    }
     for (int i = 0; i < 64; i++) {
         char *k = calloc(1, 4);
         sprintf(k, "A%d", i);
@@ -20,6 +26,42 @@ void *test_enqueue(void *arg) {
     return NULL;
 }
 
+void *test_wait_producer(void *arg) {
+    struct ring_queue *rq = (struct ring_queue *)arg;
+    static int items[16];
+    for (int i = 0; i < 16; i++) {
+        usleep(200);
+        ring_enqueue(rq, &items[i]);
+    }
+    ring_close(rq);
+    return NULL;
+}
+
+/* a sleeping consumer gets every item and then NULL once the ring is closed */
+int test_wait(void) {
+    struct ring_queue *rq = ring_alloc(5);
+    if (!rq || rq->size != 8) {
+        return -1;
+    }
+    if (ring_dequeue_wait(rq, 1) != NULL) {
+        printf("wait on empty ring\n");
+        return -1;
+    }
+    pthread_t tid;
+    pthread_create(&tid, NULL, test_wait_producer, (void *)rq);
+    int n = 0;
+    while (ring_dequeue_wait(rq, -1)) {
+        n++;
+    }
+    pthread_join(tid, NULL);
+    ring_free(rq);
+    if (n != 16) {
+        printf("waited %d items\n", n);
+        return -1;
+    }
+    return 0;
+}
+
 int main(void) {
     struct ring_queue *rq = ring_alloc(128);
     if (!rq) {
@@ -35,6 +77,7 @@ int main(void) {
             printf("enenque fail %d\n", i);
         }
     }
+    atomic_store(&started, true);
     void *blk[28];
     for (int i = 4; i < 32; i++) {
         blk[i - 4] = calloc(1, 4);
@@ -71,16 +114,34 @@ int main(void) {
         return -1;
     }
     free(c);
-    if (ring_count(rq) != 124) {
+    /* the ring holds all of its 128 slots */
+    if (ring_count(rq) != 125) {
         printf("ring count %d\n", ring_count(rq));
         return -1;
     }
-    while (ring_count(rq)) {
+    static int dummy[3];
+    void *full[4] = {&dummy[0], &dummy[1], &dummy[2], NULL};
+    if (!ring_enqueue_bulk(rq, full, 3) || ring_enqueue(rq, full)) {
+        printf("ring not full at 128\n");
+        return -1;
+    }
+    if (ring_dequeue_bulk(rq, blk, 28) != 28) {
+        printf("dequeue bulk fail\n");
+        return -1;
+    }
+    for (int i = 0; i < 28; i++) {
+        free(blk[i]);
+    }
+    while (ring_count(rq) > 3) {
         c = ring_dequeue(rq);
         if (c) {
             free(c);
         }
     }
+    if (ring_dequeue_bulk(rq, full, 4) != 0 || ring_dequeue_bulk(rq, full, 3) != 3) {
+        printf("dequeue bulk of the tail fail\n");
+        return -1;
+    }
     ring_free(rq);
-    return 0;
+    return test_wait();
 }
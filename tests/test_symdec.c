@@ -0,0 +1,291 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "symdec.h"
+
+/* a small multi-symbol encoder after the daala/libaom one, random symbols
+ * with adapting cdfs, bits, literals and NS(n) values go through it and have
+ * to come back the same from the decoder
+ */
+
+#define NUM_CTX (8)
+#define MAX_SYMS (16)
+#define NUM_OPS (8000)
+
+struct enc {
+    uint32_t low;
+    uint32_t rng;
+    int cnt;
+    uint16_t *precarry;
+    int offs;
+};
+
+static void
+enc_start(struct enc *e)
+{
+    e->low = 0;
+    e->rng = 0x8000;
+    e->cnt = -9;
+    e->offs = 0;
+}
+
+static void
+enc_normalize(struct enc *e, uint32_t low, uint32_t rng)
+{
+    int d = __builtin_clz(rng) - 16;
+    int c = e->cnt;
+    int s = c + d;
+    if (s >= 0) {
+        c += 16;
+        uint32_t m = (1u << c) - 1;
+        if (s >= 8) {
+            e->precarry[e->offs++] = (uint16_t)(low >> c);
+            low &= m;
+            c -= 8;
+            m >>= 8;
+        }
+        e->precarry[e->offs++] = (uint16_t)(low >> c);
+        s = c + d - 24;
+        low &= m;
+    }
+    e->low = low << d;
+    e->rng = rng << d;
+    e->cnt = s;
+}
+
+// symbol s out of n with the cdf in the form the decoder takes
+static void
+enc_symbol(struct enc *e, const uint16_t *cdf, int s, int n)
+{
+    uint32_t l = e->low, r = e->rng;
+    uint32_t fh = 32768 - cdf[s];
+    uint32_t v = ((r >> 8) * (fh >> 6) >> 1) + 4 * (n - 1 - s);
+    if (s > 0) {
+        uint32_t fl = 32768 - cdf[s - 1];
+        uint32_t u = ((r >> 8) * (fl >> 6) >> 1) + 4 * (n - s);
+        l += r - u;
+        r = u - v;
+    } else {
+        r -= v;
+    }
+    enc_normalize(e, l, r);
+}
+
+// the same adaptation as the decoder, see 8.2.6
+static void
+adapt(uint16_t *cdf, int n, int symbol)
+{
+    int rate = 3 + (cdf[n] > 15) + (cdf[n] > 31) + (n > 3 ? 2 : n > 1);
+    for (int i = 0; i < n - 1; i++) {
+        if (i < symbol) {
+            cdf[i] -= cdf[i] >> rate;
+        } else {
+            cdf[i] += (32768 - cdf[i]) >> rate;
+        }
+    }
+    cdf[n] += (cdf[n] < 32);
+}
+
+static void
+enc_bool(struct enc *e, int bit)
+{
+    static const uint16_t half[3] = { 1 << 14, 1 << 15, 0 };
+    enc_symbol(e, half, bit, 2);
+}
+
+static void
+enc_literal(struct enc *e, int v, int n)
+{
+    for (int i = n - 1; i >= 0; i--) {
+        enc_bool(e, (v >> i) & 1);
+    }
+}
+
+// see 4.10.10, the inverse of NS(n)
+static void
+enc_ns(struct enc *e, int v, int n)
+{
+    int w = 0;
+    for (int x = n; x != 0; x >>= 1) {
+        w++;
+    }
+    int m = (1 << w) - n;
+    if (v < m) {
+        enc_literal(e, v, w - 1);
+    } else {
+        enc_literal(e, (v + m) >> 1, w - 1);
+        enc_bool(e, (v + m) & 1);
+    }
+}
+
+/* flush enough bits to tell the last symbol apart and resolve the carries,
+ * returns the length in bytes
+ */
+static int
+enc_finish(struct enc *e, uint8_t *out)
+{
+    uint32_t m = 0x3FFF;
+    uint32_t low = ((e->low + m) & ~m) | (m + 1);
+    int c = e->cnt, s = c + 10;
+    if (s > 0) {
+        uint32_t n = (1u << (c + 16)) - 1;
+        do {
+            e->precarry[e->offs++] = (uint16_t)(low >> (c + 16));
+            low &= n;
+            s -= 8;
+            c -= 8;
+            n >>= 8;
+        } while (s > 0);
+    }
+    uint32_t carry = 0;
+    for (int i = e->offs - 1; i >= 0; i--) {
+        carry += e->precarry[i];
+        out[i] = (uint8_t)carry;
+        carry >>= 8;
+    }
+    return e->offs;
+}
+
+enum { OP_SYMBOL, OP_BOOL, OP_LITERAL, OP_NS };
+
+struct op {
+    int type;
+    int ctx;
+    int n;
+    int val;
+};
+
+// random cdfs of n symbols, every symbol with some probability left
+static void
+init_cdf(uint16_t *cdf, int n)
+{
+    int left = 32768 - 4 * n;
+    int sum = 0;
+    for (int i = 0; i < n - 1; i++) {
+        sum += 4 + (left > 0 ? rand() % (left / (n - i) + 1) : 0);
+        left = 32768 - sum - 4 * (n - 1 - i);
+        cdf[i] = sum;
+    }
+    cdf[n - 1] = 32768;
+    cdf[n] = rand() % 33;
+}
+
+static void
+gen_ops(struct op *ops, int num, const int *nsyms)
+{
+    // a skewed source per context, so the cdfs adapt somewhere
+    int favour[NUM_CTX];
+    for (int k = 0; k < NUM_CTX; k++) {
+        favour[k] = rand() % nsyms[k];
+    }
+    for (int i = 0; i < num; i++) {
+        int r = rand() % 100;
+        ops[i].type = (r < 70) ? OP_SYMBOL :
+                      (r < 85) ? OP_BOOL :
+                      (r < 95) ? OP_LITERAL : OP_NS;
+        ops[i].ctx = rand() % NUM_CTX;
+        switch (ops[i].type) {
+        case OP_SYMBOL:
+            ops[i].n = nsyms[ops[i].ctx];
+            ops[i].val = (rand() & 1) ? favour[ops[i].ctx] : rand() % ops[i].n;
+            break;
+        case OP_BOOL:
+            ops[i].n = 1;
+            ops[i].val = rand() & 1;
+            break;
+        case OP_LITERAL:
+            ops[i].n = 1 + rand() % 16;
+            ops[i].val = rand() & ((1 << ops[i].n) - 1);
+            break;
+        default:
+            ops[i].n = 1 + rand() % 1000;
+            ops[i].val = rand() % ops[i].n;
+            break;
+        }
+    }
+}
+
+static int
+test_round(int round, int disable_update)
+{
+    static struct op ops[NUM_OPS];
+    static uint16_t precarry[NUM_OPS * 8];
+    static uint8_t buf[NUM_OPS * 8];
+    uint16_t ecdf[NUM_CTX][MAX_SYMS + 1], dcdf[NUM_CTX][MAX_SYMS + 1];
+    int nsyms[NUM_CTX];
+    for (int k = 0; k < NUM_CTX; k++) {
+        nsyms[k] = 2 + rand() % (MAX_SYMS - 1);
+        init_cdf(ecdf[k], nsyms[k]);
+    }
+    memcpy(dcdf, ecdf, sizeof(ecdf));
+    int num = 1 + rand() % NUM_OPS;
+    gen_ops(ops, num, nsyms);
+
+    struct enc e = { .precarry = precarry };
+    enc_start(&e);
+    for (int i = 0; i < num; i++) {
+        const struct op *op = &ops[i];
+        switch (op->type) {
+        case OP_SYMBOL:
+            enc_symbol(&e, ecdf[op->ctx], op->val, op->n);
+            if (!disable_update) {
+                adapt(ecdf[op->ctx], op->n, op->val);
+            }
+            break;
+        case OP_BOOL:
+            enc_bool(&e, op->val);
+            break;
+        case OP_LITERAL:
+            enc_literal(&e, op->val, op->n);
+            break;
+        default:
+            enc_ns(&e, op->val, op->n);
+            break;
+        }
+    }
+    int len = enc_finish(&e, buf);
+
+    struct symdec sd;
+    symdec_init(&sd, buf, len, disable_update);
+    for (int i = 0; i < num; i++) {
+        const struct op *op = &ops[i];
+        int v;
+        switch (op->type) {
+        case OP_SYMBOL:
+            v = SYM(&sd, dcdf[op->ctx], op->n);
+            break;
+        case OP_BOOL:
+            v = SYM_BOOL(&sd);
+            break;
+        case OP_LITERAL:
+            v = SYM_L(&sd, op->n);
+            break;
+        default:
+            v = symdec_ns(&sd, op->n);
+            break;
+        }
+        if (v != op->val) {
+            printf("round %d op %d type %d: %d vs %d\n", round, i, op->type, v,
+                   op->val);
+            return -1;
+        }
+    }
+    if (memcmp(ecdf, dcdf, sizeof(ecdf))) {
+        printf("round %d: cdfs adapted differently\n", round);
+        return -1;
+    }
+    return 0;
+}
+
+int main(void)
+{
+    srand(2025);
+    for (int round = 0; round < 200; round++) {
+        if (test_round(round, round & 1)) {
+            return -1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,376 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "crc.h"
+#include "vp8dsp.h"
+#include "x86.h"
+
+#define STRIDE (48)
+#define ROWS (32)
+/* the tested block starts at (8, 8) of the buffer so every kernel can look
+ * up to 8 pixels around it
+ */
+#define ORIGIN (8 * STRIDE + 8)
+
+static uint8_t buf_ref[STRIDE * ROWS];
+static uint8_t buf_simd[STRIDE * ROWS];
+
+/* smooth content with some noise, so the loop filters take all branches */
+static void
+fill_pixels(uint8_t *buf, int noise)
+{
+    int base = rand() & 0xFF;
+    for (int i = 0; i < STRIDE * ROWS; i++) {
+        int v = base + (rand() % (2 * noise + 1)) - noise;
+        buf[i] = v < 0 ? 0 : (v > 255 ? 255 : v);
+        if ((rand() & 63) == 0) {
+            base = rand() & 0xFF;
+        }
+    }
+}
+
+static int
+compare(const char *name, int round)
+{
+    if (memcmp(buf_ref, buf_simd, sizeof(buf_ref))) {
+        for (int i = 0; i < STRIDE * ROWS; i++) {
+            if (buf_ref[i] != buf_simd[i]) {
+                printf("%s not match in round %d at (%d, %d): %d vs %d\n", name,
+                       round, i / STRIDE - 8, i % STRIDE - 8, buf_ref[i],
+                       buf_simd[i]);
+                break;
+            }
+        }
+        return -1;
+    }
+    return 0;
+}
+
+static int
+test_transforms(const struct vp8_dsp *ref, const struct vp8_dsp *simd)
+{
+    int16_t in[16];
+    int16_t out_ref[256], out_simd[256];
+    for (int round = 0; round < 2000; round++) {
+        int range = (round & 1) ? 1024 : 256;
+        for (int i = 0; i < 16; i++) {
+            in[i] = (rand() % (2 * range)) - range;
+        }
+        fill_pixels(buf_ref, 128);
+        memcpy(buf_simd, buf_ref, sizeof(buf_ref));
+        ref->transform(in, buf_ref + ORIGIN, STRIDE);
+        simd->transform(in, buf_simd + ORIGIN, STRIDE);
+        if (compare("transform", round)) {
+            return -1;
+        }
+        ref->transform_dc(in, buf_ref + ORIGIN, STRIDE);
+        simd->transform_dc(in, buf_simd + ORIGIN, STRIDE);
+        if (compare("transform_dc", round)) {
+            return -1;
+        }
+
+        memset(out_ref, 0, sizeof(out_ref));
+        memset(out_simd, 0, sizeof(out_simd));
+        ref->transform_wht(in, out_ref);
+        simd->transform_wht(in, out_simd);
+        if (memcmp(out_ref, out_simd, sizeof(out_ref))) {
+            printf("transform_wht not match in round %d\n", round);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int
+test_predictors(const struct vp8_dsp *ref, const struct vp8_dsp *simd)
+{
+    uint8_t top[32], left[16];
+    for (int round = 0; round < 500; round++) {
+        for (int i = 0; i < 32; i++) {
+            top[i] = rand() & 0xFF;
+        }
+        for (int i = 0; i < 16; i++) {
+            left[i] = rand() & 0xFF;
+        }
+        int x = rand() & 1, y = rand() & 1;
+        for (int m = 0; m < NUM_BMODES; m++) {
+            memset(buf_ref, 0, sizeof(buf_ref));
+            memset(buf_simd, 0, sizeof(buf_simd));
+            ref->pred_luma4[m](buf_ref + ORIGIN, top + 1, left, STRIDE, x, y);
+            simd->pred_luma4[m](buf_simd + ORIGIN, top + 1, left, STRIDE, x, y);
+            if (compare("pred_luma4", m)) {
+                return -1;
+            }
+        }
+        for (int m = 0; m < 4; m++) {
+            memset(buf_ref, 0, sizeof(buf_ref));
+            memset(buf_simd, 0, sizeof(buf_simd));
+            ref->pred_luma16[m](buf_ref + ORIGIN, top + 1, left, STRIDE, x, y);
+            simd->pred_luma16[m](buf_simd + ORIGIN, top + 1, left, STRIDE, x, y);
+            if (compare("pred_luma16", m)) {
+                return -1;
+            }
+            ref->pred_chroma8[m](buf_ref + ORIGIN, top + 1, left, STRIDE, x, y);
+            simd->pred_chroma8[m](buf_simd + ORIGIN, top + 1, left, STRIDE, x, y);
+            if (compare("pred_chroma8", m)) {
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+static int
+test_filters(const struct vp8_dsp *ref, const struct vp8_dsp *simd)
+{
+    for (int round = 0; round < 2000; round++) {
+        int noise = 1 + (rand() % 40);
+        int thresh = rand() % 140;
+        int ithresh = 1 + rand() % 63;
+        int hev = rand() % 3;
+        uint8_t *r = buf_ref + ORIGIN, *s = buf_simd + ORIGIN;
+        uint8_t *rv = r + 8 * STRIDE + 16, *sv = s + 8 * STRIDE + 16;
+
+        fill_pixels(buf_ref, noise);
+        memcpy(buf_simd, buf_ref, sizeof(buf_ref));
+
+        ref->simple_vfilter16(r, STRIDE, thresh);
+        simd->simple_vfilter16(s, STRIDE, thresh);
+        ref->simple_hfilter16(r, STRIDE, thresh);
+        simd->simple_hfilter16(s, STRIDE, thresh);
+        ref->simple_vfilter16i(r, STRIDE, thresh);
+        simd->simple_vfilter16i(s, STRIDE, thresh);
+        ref->simple_hfilter16i(r, STRIDE, thresh);
+        simd->simple_hfilter16i(s, STRIDE, thresh);
+        if (compare("simple filter", round)) {
+            return -1;
+        }
+
+        ref->hfilter16(r, STRIDE, thresh, ithresh, hev);
+        simd->hfilter16(s, STRIDE, thresh, ithresh, hev);
+        if (compare("hfilter16", round)) {
+            return -1;
+        }
+        ref->hfilter16i(r, STRIDE, thresh, ithresh, hev);
+        simd->hfilter16i(s, STRIDE, thresh, ithresh, hev);
+        if (compare("hfilter16i", round)) {
+            return -1;
+        }
+        ref->vfilter16(r, STRIDE, thresh, ithresh, hev);
+        simd->vfilter16(s, STRIDE, thresh, ithresh, hev);
+        if (compare("vfilter16", round)) {
+            return -1;
+        }
+        ref->vfilter16i(r, STRIDE, thresh, ithresh, hev);
+        simd->vfilter16i(s, STRIDE, thresh, ithresh, hev);
+        if (compare("vfilter16i", round)) {
+            return -1;
+        }
+
+        ref->hfilter8(r, rv, STRIDE, thresh, ithresh, hev);
+        simd->hfilter8(s, sv, STRIDE, thresh, ithresh, hev);
+        ref->hfilter8i(r, rv, STRIDE, thresh, ithresh, hev);
+        simd->hfilter8i(s, sv, STRIDE, thresh, ithresh, hev);
+        if (compare("hfilter8", round)) {
+            return -1;
+        }
+        ref->vfilter8(r, rv, STRIDE, thresh, ithresh, hev);
+        simd->vfilter8(s, sv, STRIDE, thresh, ithresh, hev);
+        ref->vfilter8i(r, rv, STRIDE, thresh, ithresh, hev);
+        simd->vfilter8i(s, sv, STRIDE, thresh, ithresh, hev);
+        if (compare("vfilter8", round)) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int
+test_encoder(const struct vp8_dsp *ref, const struct vp8_dsp *simd)
+{
+    static const char *names[6] = {"sad16x16",  "sad8x8",  "sad4x4",
+                                   "satd16x16", "satd8x8", "satd4x4"};
+    const vp8_dist_func fr[6] = {ref->sad16x16,  ref->sad8x8,  ref->sad4x4,
+                                 ref->satd16x16, ref->satd8x8, ref->satd4x4};
+    const vp8_dist_func fs[6] = {simd->sad16x16,  simd->sad8x8,
+                                 simd->sad4x4,    simd->satd16x16,
+                                 simd->satd8x8,   simd->satd4x4};
+    int16_t coeffs[16];
+    int16_t dc[256], y2[16], back[256];
+
+    for (int round = 0; round < 2000; round++) {
+        // the second block is 16 rows below, keep both inside the buffer
+        fill_pixels(buf_ref, (round & 1) ? 255 : 20);
+        fill_pixels(buf_simd, (round & 1) ? 255 : 20);
+        const uint8_t *a = buf_ref + ORIGIN, *b = buf_simd + ORIGIN;
+        for (int f = 0; f < 6; f++) {
+            int r = fr[f](a, STRIDE, b, STRIDE);
+            int s = fs[f](a, STRIDE, b, STRIDE);
+            if (r != s) {
+                printf("%s not match in round %d: %d vs %d\n", names[f], round,
+                       r, s);
+                return -1;
+            }
+        }
+
+        // forward then inverse dct gives back the source within rounding
+        uint8_t rec[4 * STRIDE];
+        for (int j = 0; j < 4; j++) {
+            memcpy(rec + j * STRIDE, b + j * STRIDE, 4);
+        }
+        ref->fdct(a, STRIDE, b, STRIDE, coeffs);
+        ref->transform(coeffs, rec, STRIDE);
+        for (int j = 0; j < 4; j++) {
+            for (int i = 0; i < 4; i++) {
+                if (abs(rec[j * STRIDE + i] - a[j * STRIDE + i]) > 1) {
+                    printf("fdct not match in round %d at (%d, %d): %d vs %d\n",
+                           round, i, j, rec[j * STRIDE + i], a[j * STRIDE + i]);
+                    return -1;
+                }
+            }
+        }
+
+        // the same for the wht of the luma DCs
+        memset(dc, 0, sizeof(dc));
+        for (int i = 0; i < 16; i++) {
+            dc[16 * i] = (rand() % 4096) - 2048;
+        }
+        ref->fwht(dc, y2);
+        ref->transform_wht(y2, back);
+        for (int i = 0; i < 16; i++) {
+            if (abs(back[16 * i] - dc[16 * i]) > 1) {
+                printf("fwht not match in round %d at %d: %d vs %d\n", round, i,
+                       back[16 * i], dc[16 * i]);
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+/* known answers worked out with the reference code of RFC 6386 (14.3 for
+ * the transforms, the libvpx loop filters for 15.2-15.3), so a bug shared by
+ * the C and the SIMD kernels shows up too
+ */
+static const int16_t kat_coeffs[16] = {
+    -440, 27, -54, 72, -9, -90, 36, -45, 81, 0, -81, 45, -36, 90, 9, -72,
+};
+static const uint8_t kat_idct[16] = {
+    25, 58, 82, 73, 24, 19, 81, 93, 62, 61, 33, 41, 74, 74, 143, 50,
+};
+static const int16_t kat_wht_in[16] = {
+    -340, -119, -153, 255, -289, 306,  -51, 34,
+    -136, 136,  153,  -85, 119,  68,  -238, -102,
+};
+static const int16_t kat_wht[16] = {
+    -55, -9, -81, -179, -34, -123, 0, -149, -72, 0, 174, 0, -17, -149, 0, 13,
+};
+#define KAT_NORMAL_CRC (0x11f38a71U)
+#define KAT_SIMPLE_CRC (0xef39bef3U)
+
+/* 20 rows of 16 starting 4 rows above the block, steps every 4 rows whose
+ * height changes with the column and a little noise, so the filters take
+ * the 6 tap, the 4 tap, the hev and the skip paths
+ */
+static void
+fill_steps(uint8_t *p)
+{
+    for (int y = 0; y < 20; y++) {
+        for (int x = 0; x < 16; x++) {
+            p[y * STRIDE + x] = 60 + (y / 4) * (x % 8) * 3 +
+                                (x * 7 + y * 3) % 5 - 2 + (x / 8) * 40;
+        }
+    }
+}
+
+static uint32_t
+steps_crc(uint8_t *p)
+{
+    uint32_t crc = 0xFFFFFFFF;
+    for (int y = 0; y < 20; y++) {
+        crc = update_crc(crc, p + y * STRIDE, 16);
+    }
+    return finish_crc32(crc);
+}
+
+static int
+test_reference(const struct vp8_dsp *dsp, const char *name)
+{
+    uint8_t *p = buf_ref + ORIGIN;
+    int16_t out[256];
+
+    for (int y = 0; y < 4; y++) {
+        for (int x = 0; x < 4; x++) {
+            p[y * STRIDE + x] = 90 + 12 * x + 6 * y;
+        }
+    }
+    dsp->transform(kat_coeffs, p, STRIDE);
+    for (int i = 0; i < 16; i++) {
+        if (p[(i / 4) * STRIDE + i % 4] != kat_idct[i]) {
+            printf("%s transform not match at %d: %d vs %d\n", name, i,
+                   p[(i / 4) * STRIDE + i % 4], kat_idct[i]);
+            return -1;
+        }
+    }
+
+    dsp->transform_wht(kat_wht_in, out);
+    for (int i = 0; i < 16; i++) {
+        if (out[16 * i] != kat_wht[i]) {
+            printf("%s transform_wht not match at %d: %d vs %d\n", name, i,
+                   out[16 * i], kat_wht[i]);
+            return -1;
+        }
+    }
+
+    p = buf_ref + ORIGIN - 4 * STRIDE;
+    fill_steps(p);
+    dsp->vfilter16(p + 4 * STRIDE, STRIDE, 44, 12, 2);
+    dsp->vfilter16i(p + 4 * STRIDE, STRIDE, 40, 12, 2);
+    if (steps_crc(p) != KAT_NORMAL_CRC) {
+        printf("%s normal filter crc %08x, expect %08x\n", name, steps_crc(p),
+               KAT_NORMAL_CRC);
+        return -1;
+    }
+    fill_steps(p);
+    dsp->simple_vfilter16(p + 4 * STRIDE, STRIDE, 44);
+    dsp->simple_vfilter16i(p + 4 * STRIDE, STRIDE, 40);
+    if (steps_crc(p) != KAT_SIMPLE_CRC) {
+        printf("%s simple filter crc %08x, expect %08x\n", name, steps_crc(p),
+               KAT_SIMPLE_CRC);
+        return -1;
+    }
+    return 0;
+}
+
+int main(void)
+{
+    struct vp8_dsp ref, simd;
+
+    srand(1234);
+    vp8_dsp_init_c(&ref);
+    vp8_dsp_init_c(&simd);
+#ifdef __SSE2__
+    x86_vp8_dsp_init_sse2(&simd);
+#endif
+#ifdef __AVX2__
+    x86_vp8_dsp_init_avx2(&simd);
+#endif
+    if (test_reference(&ref, "c") || test_reference(&simd, "simd")) {
+        return -1;
+    }
+    if (test_transforms(&ref, &simd)) {
+        return -1;
+    }
+    if (test_predictors(&ref, &simd)) {
+        return -1;
+    }
+    if (test_filters(&ref, &simd)) {
+        return -1;
+    }
+    if (test_encoder(&ref, &simd)) {
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,165 @@
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "colorspace.h"
+#include "file.h"
+#include "vp8enc.h"
+
+#define WIDTH 45
+#define HEIGHT 37
+#define TEST_FILE "test_vp8enc.webp"
+
+/* smooth content with one sharp edge, in XRGB8888 */
+static void
+fill_pic(struct pic *p)
+{
+    p->width = WIDTH;
+    p->height = HEIGHT;
+    p->depth = 32;
+    p->pitch = WIDTH * 4;
+    p->format = CS_PIXELFORMAT_XRGB8888;
+    p->pixels = malloc(p->pitch * HEIGHT);
+    uint8_t *px = p->pixels;
+    for (int y = 0; y < HEIGHT; y++) {
+        for (int x = 0; x < WIDTH; x++) {
+            uint8_t *c = px + y * p->pitch + x * 4;
+            c[0] = 40 + x * 4;
+            c[1] = 200 - y * 3;
+            c[2] = (x > y) ? 220 : 60;
+            c[3] = 0xFF;
+        }
+    }
+}
+
+static int
+write_webp(const uint8_t *vp8, int len)
+{
+    uint8_t hdr[20];
+    uint32_t riff = 4 + 8 + len + (len & 1);
+    FILE *f = fopen(TEST_FILE, "wb");
+    if (!f) {
+        return -1;
+    }
+    memcpy(hdr, "RIFF", 4);
+    for (int i = 0; i < 4; i++) {
+        hdr[4 + i] = (riff >> (8 * i)) & 0xFF;
+        hdr[16 + i] = (len >> (8 * i)) & 0xFF;
+    }
+    memcpy(hdr + 8, "WEBPVP8 ", 8);
+    fwrite(hdr, sizeof(hdr), 1, f);
+    fwrite(vp8, len, 1, f);
+    if (len & 1) {
+        fputc(0, f);
+    }
+    fclose(f);
+    return 0;
+}
+
+static double
+luma(const uint8_t *c)
+{
+    return c[2] * 0.299 + c[1] * 0.587 + c[0] * 0.114;
+}
+
+/* decode the test file and compare the luma with the source */
+static int
+check_file(const char *name, const struct pic *src, double min_psnr)
+{
+    struct file_ops *ops = file_probe(TEST_FILE);
+    if (!ops) {
+        printf("%s: not probed as webp\n", name);
+        return -1;
+    }
+    struct pic *p = file_load(ops, TEST_FILE, 0);
+    if (!p) {
+        printf("%s: decode fail\n", name);
+        return -1;
+    }
+    if (p->width < WIDTH || p->height < HEIGHT || p->depth != 32) {
+        printf("%s: size not match %dx%d\n", name, p->width, p->height);
+        file_free(ops, p);
+        return -1;
+    }
+    double sse = 0;
+    for (int y = 0; y < HEIGHT; y++) {
+        for (int x = 0; x < WIDTH; x++) {
+            const uint8_t *a = (uint8_t *)src->pixels + y * src->pitch + x * 4;
+            const uint8_t *b = (uint8_t *)p->pixels + y * p->pitch + x * 4;
+            double d = luma(a) - luma(b);
+            sse += d * d;
+        }
+    }
+    file_free(ops, p);
+    double psnr = 10 * log10(255. * 255. * WIDTH * HEIGHT / (sse + 1e-9));
+    if (psnr < min_psnr) {
+        printf("%s: psnr %.2f lower than %.2f\n", name, psnr, min_psnr);
+        return -1;
+    }
+    return 0;
+}
+
+static int
+test_speeds(const struct pic *src)
+{
+    char name[32];
+    for (int speed = VP8_ENC_FASTEST; speed <= VP8_ENC_BEST; speed++) {
+        struct vp8_enc_config cfg = {.quality = 80, .speed = speed};
+        uint8_t *vp8;
+        int len = vp8_encode(src, &cfg, &vp8);
+        if (len <= 0) {
+            printf("speed %d: encode fail %d\n", speed, len);
+            return -1;
+        }
+        int ret = write_webp(vp8, len);
+        free(vp8);
+        snprintf(name, sizeof(name), "speed %d", speed);
+        if (ret || check_file(name, src, 32.0)) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int
+test_file_ops(struct pic *src)
+{
+    struct file_ops *ops = file_find_codec("WEBP");
+    if (!ops || !ops->encode) {
+        printf("no webp encoder\n");
+        return -1;
+    }
+    ops->encode(src, TEST_FILE);
+    return check_file("file ops", src, 30.0);
+}
+
+static int
+test_invalid(void)
+{
+    struct pic p = {.width = 0x4000, .height = 16, .depth = 32};
+    struct vp8_enc_config cfg;
+    uint8_t *vp8;
+    vp8_enc_config_default(&cfg);
+    if (vp8_encode(&p, &cfg, &vp8) >= 0) {
+        printf("too large picture encoded\n");
+        return -1;
+    }
+    return 0;
+}
+
+int main(void)
+{
+    struct pic src;
+    int ret = -1;
+
+    file_ops_init();
+    fill_pic(&src);
+    if (!test_speeds(&src) && !test_file_ops(&src) && !test_invalid()) {
+        ret = 0;
+    }
+    free(src.pixels);
+    remove(TEST_FILE);
+    return ret;
+}
@@ -0,0 +1,107 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "vp8l.h"
+
+/* 32x16 images encoded by libwebp in lossless mode, the pixels follow
+ * the formulas in expect_grad() and expect_pal()
+ */
+static const uint8_t grad_stream[] = {
+    0x2f, 0x1f, 0xc0, 0x03, 0x10, 0xb9, 0x0a, 0x44, 0xf4, 0x3f, 0x76, 0x11,
+    0xd1, 0xff, 0x30, 0x38, 0x92, 0x6d, 0xdb, 0x74, 0x6a, 0x7f, 0xdb, 0xfe,
+    0xb1, 0x6d, 0x63, 0xfe, 0xf3, 0x4a, 0xcb, 0x49, 0x37, 0xf5, 0x81, 0x03,
+    0x94, 0x92, 0x6d, 0x85, 0x96, 0xe3, 0x38, 0x8e, 0xe3, 0xb8, 0xef, 0x8d,
+    0xe3, 0x38, 0x8e, 0xe3, 0xc7, 0x49, 0xfb, 0x15, 0xb6, 0x6d, 0xdb, 0x64,
+    0xef, 0xa4, 0x3d, 0xe3, 0x4f, 0x62, 0x72, 0x6a, 0x7a, 0x66, 0x76, 0x6e,
+    0x7e, 0x61, 0x71, 0x69, 0x79, 0x65, 0xd5, 0xea, 0x35, 0x6b, 0xd7, 0xad,
+    0xdf, 0xb0, 0x71, 0xd3, 0xe6, 0x2d, 0x5b, 0xb7, 0x6d, 0xdf, 0xb1, 0x73,
+    0xd7, 0x00, 0xff, 0x61, 0x89, 0x84, 0x78, 0x30, 0xfe, 0x0c, 0x81, 0x8c,
+    0x82, 0x8b, 0x87, 0x78, 0x60, 0xc1, 0x67, 0x84, 0x51, 0xd1, 0xd0, 0x31,
+    0x30, 0xb1, 0xb0, 0x71, 0x6e, 0xef, 0xbd, 0xe3, 0x8e, 0x9f, 0xf7, 0xef,
+    0xf8,
+};
+
+static const uint8_t pal_stream[] = {
+    0x2f, 0x1f, 0xc0, 0x03, 0x00, 0x27, 0x30, 0x32, 0x23, 0x33, 0x32, 0xf3,
+    0x1f, 0x78, 0x77, 0x07, 0x05, 0x91, 0xac, 0x54, 0xfe, 0x02, 0x40, 0x04,
+    0x5e, 0x04, 0x89, 0x20, 0xfd, 0x5b, 0x29, 0xa0, 0x06, 0x88, 0xe8, 0xbf,
+    0xda, 0xb6, 0x6d, 0x18, 0xae, 0xe9, 0x39, 0xa3, 0x10, 0x63, 0xaa, 0x8d,
+    0xc2, 0x02, 0x5d, 0x56, 0x5c, 0x5b, 0xa7, 0x53, 0xa9, 0xcb, 0x8b, 0x12,
+    0xc3, 0xe5, 0x45, 0x05, 0xea, 0xb3, 0xe1, 0x35, 0xf1, 0x7d, 0xff, 0x17,
+    0x00,
+};
+
+static uint32_t
+expect_grad(int x, int y)
+{
+    uint32_t r = (x * 7 + y * 3) & 0xFF;
+    uint32_t g = (x * x + y) & 0xFF;
+    uint32_t b = ((x ^ y) * 5) & 0xFF;
+    uint32_t a = (255 - (x + y) * 3) & 0xFF;
+    return (a << 24) | (r << 16) | (g << 8) | b;
+}
+
+static uint32_t
+expect_pal(int x, int y)
+{
+    uint32_t v = ((x / 3 + y / 2) % 5) * 50;
+    return 0xFF000000 | (v << 16) | (v << 8) | v;
+}
+
+static int
+test_decode(const char *name, const uint8_t *stream, int len,
+            uint32_t (*expect)(int, int))
+{
+    int width, height;
+    uint32_t *argb;
+    if (vp8l_decode(stream, len, &width, &height, &argb) < 0) {
+        printf("%s decode fail\n", name);
+        return -1;
+    }
+    if (width != 32 || height != 16) {
+        printf("%s size not match %dx%d\n", name, width, height);
+        free(argb);
+        return -1;
+    }
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            if (argb[y * width + x] != expect(x, y)) {
+                printf("%s not match at (%d, %d): %08x vs %08x\n", name, x, y,
+                       argb[y * width + x], expect(x, y));
+                free(argb);
+                return -1;
+            }
+        }
+    }
+    free(argb);
+    return 0;
+}
+
+static int
+test_truncated(void)
+{
+    int width, height;
+    uint32_t *argb;
+    if (vp8l_decode(grad_stream, sizeof(grad_stream) / 2, &width, &height,
+                    &argb) == 0) {
+        printf("truncated stream decoded\n");
+        free(argb);
+        return -1;
+    }
+    return 0;
+}
+
+int main(void)
+{
+    if (test_decode("grad", grad_stream, sizeof(grad_stream), expect_grad)) {
+        return -1;
+    }
+    if (test_decode("pal", pal_stream, sizeof(pal_stream), expect_pal)) {
+        return -1;
+    }
+    if (test_truncated()) {
+        return -1;
+    }
+    return 0;
+}
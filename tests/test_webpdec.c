@@ -0,0 +1,69 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "crc.h"
+#include "file.h"
+#include "vlog.h"
+#include "webp_streams.h"
+
+#define TEST_FILE "test_webpdec.webp"
+
+/* decodes a libwebp file and checks its BGRA pixels against the crc32 of
+ * the reference ones
+ */
+static int
+check_webp(const char *name, const uint8_t *data, int len, int width,
+           int height, uint32_t expect)
+{
+    FILE *f = fopen(TEST_FILE, "wb");
+    if (!f) {
+        return -1;
+    }
+    fwrite(data, len, 1, f);
+    fclose(f);
+
+    struct file_ops *ops = file_probe(TEST_FILE);
+    if (!ops) {
+        printf("%s: not probed as webp\n", name);
+        return -1;
+    }
+    struct pic *p = file_load(ops, TEST_FILE, 0);
+    if (!p) {
+        printf("%s: decode fail\n", name);
+        return -1;
+    }
+    if (p->width < width || p->height < height || p->depth != 32) {
+        printf("%s: size not match %dx%d\n", name, p->width, p->height);
+        file_free(ops, p);
+        return -1;
+    }
+    uint32_t crc = 0xFFFFFFFF;
+    for (int y = 0; y < height; y++) {
+        crc = update_crc(crc, (uint8_t *)p->pixels + y * p->pitch, width * 4);
+    }
+    crc = finish_crc32(crc);
+    file_free(ops, p);
+    if (crc != expect) {
+        printf("%s: crc %08x, expect %08x\n", name, crc, expect);
+        return -1;
+    }
+    return 0;
+}
+
+int main(void)
+{
+    vlog_set_global_level(VLOG_ERR);
+    file_ops_init();
+    int ret = check_webp("64x48", webp_64x48, sizeof(webp_64x48), 64, 48,
+                         WEBP_64X48_CRC) ||
+              check_webp("33x17", webp_33x17, sizeof(webp_33x17), 33, 17,
+                         WEBP_33X17_CRC) ||
+              check_webp("96x96 alpha", webp_96x96a, sizeof(webp_96x96a), 96,
+                         96, WEBP_96X96A_CRC) ||
+              check_webp("48x48 alpha", webp_48x48a, sizeof(webp_48x48a), 48,
+                         48, WEBP_48X48A_CRC);
+    remove(TEST_FILE);
+    return ret ? -1 : 0;
+}
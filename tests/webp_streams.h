@@ -0,0 +1,314 @@
+/* libwebp files made through ffmpeg's libwebp encoder, with the crc32 of
+ * their BGRA pixels: the planes of ffmpeg's own webp decoder through the
+ * point-sampled conversion of dwebp -nofancy
+ */
+#ifndef _WEBP_STREAMS_H_
+#define _WEBP_STREAMS_H_
+
+#include <stdint.h>
+
+/* lossy 64x48, quality 75 */
+static const uint8_t webp_64x48[688] = {
+    0x52, 0x49, 0x46, 0x46, 0xa8, 0x02, 0x00, 0x00, 0x57, 0x45, 0x42, 0x50,
+    0x56, 0x50, 0x38, 0x20, 0x9c, 0x02, 0x00, 0x00, 0x10, 0x11, 0x00, 0x9d,
+    0x01, 0x2a, 0x40, 0x00, 0x30, 0x00, 0x3e, 0x8d, 0x36, 0x97, 0x47, 0xa5,
+    0x22, 0xa2, 0x29, 0x2d, 0x5c, 0xcc, 0x91, 0x20, 0x11, 0x89, 0x6c, 0x00,
+    0x9d, 0x32, 0x84, 0x72, 0x67, 0xa6, 0x7e, 0x43, 0xfb, 0x20, 0x51, 0xbf,
+    0xb5, 0x7e, 0x91, 0x7f, 0x9e, 0xc9, 0xfb, 0x83, 0x06, 0x70, 0xcf, 0xd5,
+    0x1d, 0xe7, 0x2e, 0xa1, 0xad, 0xe3, 0x5f, 0xdc, 0x3f, 0x48, 0xe7, 0xcf,
+    0xda, 0x60, 0x17, 0x03, 0xe3, 0x85, 0xfe, 0x23, 0xfe, 0x4b, 0xd8, 0x03,
+    0xa4, 0x07, 0xa1, 0xdf, 0xe8, 0xd0, 0x69, 0x4d, 0x9a, 0x30, 0x7a, 0x2a,
+    0xb9, 0x3b, 0x03, 0xd2, 0xc6, 0xd6, 0xe1, 0xd5, 0x74, 0xde, 0xb4, 0x54,
+    0xf2, 0x45, 0x49, 0xee, 0x65, 0x2b, 0x1e, 0x4b, 0x73, 0x6c, 0x2d, 0x3e,
+    0x92, 0xb7, 0x09, 0x9a, 0xba, 0x92, 0x0b, 0x3d, 0x28, 0x19, 0xbb, 0xf9,
+    0x09, 0xa0, 0x17, 0x34, 0xdb, 0xca, 0x02, 0x8f, 0x79, 0xdd, 0xf3, 0x8d,
+    0x18, 0x65, 0xc7, 0x1f, 0x62, 0xb3, 0x28, 0x4b, 0x70, 0x00, 0xe0, 0x23,
+    0x56, 0x60, 0x2f, 0xcc, 0x63, 0xd0, 0x1f, 0xa9, 0xa1, 0xc2, 0x9b, 0xfe,
+    0x9f, 0xb3, 0x12, 0x54, 0xaf, 0x5e, 0xb4, 0xeb, 0x5e, 0x47, 0x40, 0xf8,
+    0x83, 0x21, 0xdd, 0x76, 0x97, 0x17, 0xad, 0xde, 0xff, 0x3f, 0xcc, 0x21,
+    0xf7, 0x06, 0x8c, 0xa3, 0xe5, 0x89, 0x65, 0x60, 0x7e, 0x78, 0x3a, 0xad,
+    0x50, 0x05, 0xff, 0xfd, 0x1c, 0x67, 0x8d, 0xe0, 0xc2, 0x9f, 0x30, 0x21,
+    0x03, 0xce, 0x11, 0xe1, 0xa9, 0x5f, 0xda, 0xf1, 0x7f, 0x6a, 0x39, 0x1b,
+    0x18, 0x7c, 0x9f, 0x38, 0xae, 0x27, 0xef, 0xf8, 0x6e, 0x93, 0x41, 0xf8,
+    0xa7, 0x72, 0x02, 0x0c, 0x16, 0x4c, 0x33, 0x59, 0x27, 0x19, 0xd1, 0x58,
+    0x8e, 0x50, 0xab, 0x8b, 0x93, 0x20, 0xcb, 0xcf, 0x4a, 0xa8, 0x97, 0xb2,
+    0x7f, 0xe0, 0xf3, 0x18, 0xfe, 0x12, 0x12, 0x1e, 0x8b, 0xe1, 0xf0, 0x98,
+    0x2c, 0x00, 0x08, 0x71, 0x93, 0x91, 0xb8, 0xe2, 0x57, 0xe6, 0xa2, 0x9b,
+    0x76, 0x6d, 0xa3, 0x0e, 0xa6, 0x38, 0xfb, 0xbd, 0x35, 0x05, 0xcc, 0x6f,
+    0x7e, 0x29, 0xbc, 0x45, 0x16, 0xe9, 0x3f, 0xe1, 0x90, 0x4a, 0x79, 0x10,
+    0xdb, 0x11, 0xc3, 0xb8, 0x19, 0x11, 0xcf, 0x5b, 0x5b, 0x5e, 0x5e, 0x07,
+    0xb5, 0xab, 0x9d, 0x04, 0xcb, 0x58, 0x0f, 0xcb, 0xe4, 0x9a, 0x40, 0xf3,
+    0x7f, 0xd6, 0x9f, 0x85, 0x97, 0x8b, 0xf0, 0x48, 0xb5, 0x7f, 0x7a, 0x72,
+    0x08, 0x49, 0x47, 0x02, 0xe7, 0xc2, 0xf6, 0x3d, 0x64, 0x43, 0x1d, 0x11,
+    0xcf, 0xe4, 0xa8, 0x52, 0xf7, 0x41, 0x5b, 0x26, 0xf6, 0xa0, 0x27, 0x07,
+    0xc4, 0x9a, 0xaa, 0x72, 0x89, 0xe9, 0xb7, 0x8d, 0x7a, 0xd0, 0x87, 0x14,
+    0x07, 0x42, 0xb9, 0x36, 0xe0, 0x59, 0x66, 0x63, 0x4a, 0xcb, 0x92, 0x84,
+    0x4d, 0x69, 0xed, 0xd9, 0x59, 0xb7, 0x2f, 0x43, 0xc8, 0xca, 0x43, 0xbc,
+    0xb4, 0x82, 0x83, 0x70, 0xa3, 0x82, 0x2c, 0xeb, 0xfd, 0xfe, 0x7d, 0x5f,
+    0x1e, 0x15, 0xdd, 0x1f, 0x50, 0xc4, 0xdf, 0xa7, 0x16, 0xb1, 0xd7, 0xe3,
+    0xe3, 0x43, 0xff, 0xec, 0x89, 0x63, 0xeb, 0x4f, 0x08, 0xb2, 0x2b, 0x1a,
+    0xc3, 0xe0, 0x91, 0x00, 0x13, 0xfb, 0xd4, 0x4a, 0xb9, 0xe4, 0x21, 0x06,
+    0xc6, 0x6b, 0x6e, 0x24, 0x8e, 0xe9, 0x50, 0x0c, 0xcc, 0xfb, 0x12, 0xb9,
+    0xa1, 0x66, 0xe8, 0x6d, 0x46, 0xcb, 0x43, 0xcb, 0xa4, 0xa7, 0x3f, 0xd1,
+    0xff, 0x8e, 0xde, 0xf2, 0xf2, 0xe4, 0x61, 0x3b, 0xdb, 0x09, 0x9b, 0x46,
+    0xbe, 0x8b, 0x99, 0x20, 0x35, 0x92, 0xd9, 0x6f, 0x59, 0x6a, 0xa4, 0x18,
+    0x24, 0x1e, 0x80, 0xed, 0xfe, 0x0a, 0xeb, 0xe8, 0x28, 0xbd, 0xa8, 0x7c,
+    0x65, 0xf2, 0x54, 0x82, 0xce, 0x7e, 0xcc, 0xd9, 0x7c, 0x19, 0xee, 0xda,
+    0xd2, 0xcf, 0x38, 0x03, 0x6f, 0x33, 0xd3, 0xfd, 0x31, 0x79, 0x24, 0xf9,
+    0x20, 0xb6, 0x2f, 0x8c, 0x10, 0x84, 0xd3, 0x92, 0x8d, 0xad, 0x7b, 0xf6,
+    0x13, 0x12, 0x98, 0xa9, 0xf2, 0x84, 0x8d, 0xc1, 0x49, 0x4a, 0x51, 0x6d,
+    0xb5, 0xfc, 0x00, 0x78, 0x2d, 0x11, 0xbb, 0x4d, 0x71, 0x99, 0x6c, 0x31,
+    0x89, 0x95, 0xca, 0x34, 0x3f, 0x19, 0x5e, 0xf8, 0x04, 0x49, 0x2d, 0xd0,
+    0xd2, 0x5a, 0x7b, 0xfb, 0x19, 0x53, 0xd6, 0xa2, 0xfe, 0xd9, 0x99, 0xad,
+    0x56, 0xbf, 0x1a, 0xb2, 0x44, 0x62, 0x00, 0x0f, 0x23, 0x44, 0x1f, 0x7f,
+    0xe8, 0x9f, 0x0c, 0x92, 0x93, 0x9c, 0xdf, 0xb8, 0x9b, 0xb5, 0xa8, 0x80,
+    0x83, 0x3e, 0x4d, 0x64, 0xe6, 0x68, 0xe7, 0x07, 0x72, 0x44, 0xcf, 0x9a,
+    0xc4, 0x04, 0x85, 0x63, 0x34, 0x9c, 0x52, 0xe4, 0xc4, 0xbc, 0x52, 0x7e,
+    0xb3, 0xda, 0x36, 0xd3, 0x51, 0xf0, 0x36, 0xe1, 0x9e, 0x13, 0x98, 0xe8,
+    0x6f, 0x4f, 0x6a, 0x55, 0x56, 0xfd, 0xcc, 0x45, 0xa8, 0xf3, 0x12, 0x78,
+    0x93, 0xf9, 0x08, 0x00,
+};
+#define WEBP_64X48_CRC (0x11ecafcaU)
+
+/* lossy 33x17, quality 90, partial macroblocks */
+static const uint8_t webp_33x17[436] = {
+    0x52, 0x49, 0x46, 0x46, 0xac, 0x01, 0x00, 0x00, 0x57, 0x45, 0x42, 0x50,
+    0x56, 0x50, 0x38, 0x20, 0xa0, 0x01, 0x00, 0x00, 0x10, 0x0c, 0x00, 0x9d,
+    0x01, 0x2a, 0x21, 0x00, 0x11, 0x00, 0x3e, 0x31, 0x16, 0x88, 0x43, 0x22,
+    0x21, 0x21, 0x15, 0x5c, 0x06, 0x00, 0x20, 0x03, 0x04, 0xb6, 0x00, 0x58,
+    0x8f, 0x65, 0xe2, 0x2b, 0xce, 0x7f, 0x00, 0x3f, 0x5b, 0xb9, 0xc0, 0xf7,
+    0xe3, 0xbb, 0x5f, 0x85, 0xf3, 0x85, 0x7f, 0x8c, 0xdd, 0x46, 0x7e, 0x60,
+    0x1f, 0xac, 0x1c, 0x13, 0x3d, 0x40, 0x1b, 0xc8, 0xfe, 0x50, 0x05, 0x88,
+    0x0f, 0xf0, 0x1b, 0x40, 0x1f, 0xc0, 0x3f, 0x87, 0xff, 0x96, 0xe0, 0x20,
+    0xfd, 0x6e, 0x1e, 0xe3, 0xb5, 0x06, 0xbd, 0xc6, 0x48, 0xcf, 0x9f, 0x6b,
+    0x49, 0x98, 0xcb, 0xdb, 0xf0, 0x87, 0x85, 0xcd, 0xde, 0x4f, 0x15, 0xf1,
+    0x6e, 0xfa, 0x20, 0x0c, 0x00, 0x00, 0xe2, 0x71, 0xdc, 0x9b, 0xfd, 0x71,
+    0x5e, 0x0f, 0xd2, 0x75, 0x42, 0x20, 0xfc, 0x76, 0xff, 0xdc, 0xd9, 0x40,
+    0x22, 0xfb, 0x07, 0x9b, 0xda, 0x4f, 0xa1, 0xbe, 0xdf, 0xff, 0x00, 0x43,
+    0xe2, 0x22, 0xc4, 0x19, 0xf8, 0x51, 0x4f, 0xc3, 0x77, 0xbb, 0xc5, 0x99,
+    0xc5, 0xc8, 0x71, 0x16, 0x1f, 0x66, 0xf8, 0x3d, 0x1a, 0x54, 0x55, 0xae,
+    0x88, 0x61, 0x20, 0x7a, 0x7d, 0x74, 0xc8, 0x0b, 0x01, 0x58, 0xe4, 0xa5,
+    0x69, 0xbf, 0xfc, 0xc6, 0x7f, 0xf2, 0xd0, 0xac, 0xe9, 0x51, 0x1f, 0x6a,
+    0x20, 0x7d, 0x98, 0xb0, 0x57, 0xa7, 0x64, 0xd1, 0xed, 0x3d, 0x85, 0x71,
+    0x38, 0x5d, 0x8e, 0x47, 0x1f, 0xff, 0xa9, 0x3e, 0x19, 0x4d, 0xe2, 0x1f,
+    0xa0, 0xbb, 0xb7, 0xbe, 0x7d, 0x92, 0xe6, 0x1f, 0x62, 0xf5, 0x76, 0x6c,
+    0x78, 0x2d, 0x8b, 0x8c, 0xff, 0xe1, 0x24, 0xca, 0xc3, 0x84, 0xd0, 0x7c,
+    0xff, 0xb3, 0xf7, 0x73, 0x56, 0x72, 0x10, 0xf6, 0x37, 0xf0, 0x7f, 0xd8,
+    0x44, 0xdb, 0xdf, 0xfb, 0x0b, 0xf4, 0x44, 0x7b, 0x81, 0x5a, 0x86, 0x30,
+    0x7f, 0x98, 0x92, 0x2c, 0xc5, 0x69, 0x1d, 0x44, 0x15, 0xd7, 0x57, 0xb4,
+    0x3e, 0xcc, 0xb4, 0x68, 0x23, 0x54, 0x81, 0x37, 0x61, 0xfb, 0x33, 0xee,
+    0x93, 0x19, 0xed, 0x24, 0x94, 0x05, 0xbb, 0x59, 0x62, 0x60, 0x8c, 0x59,
+    0x77, 0xec, 0x00, 0xaf, 0x84, 0xf5, 0xa3, 0xf9, 0xbd, 0x83, 0xc7, 0x48,
+    0xff, 0x55, 0x2e, 0xba, 0xdd, 0x6f, 0x54, 0x37, 0xfa, 0xaf, 0xd2, 0xfe,
+    0xf8, 0x7a, 0xf7, 0xfd, 0xeb, 0xf9, 0x13, 0xde, 0x41, 0xcf, 0x0e, 0x8b,
+    0x84, 0x5c, 0x19, 0x2a, 0xe2, 0xdc, 0x4e, 0x01, 0xa9, 0x4e, 0x74, 0x09,
+    0xff, 0xe9, 0x43, 0xe3, 0x22, 0xe0, 0x14, 0x8a, 0x12, 0x02, 0xff, 0x70,
+    0x6a, 0xb1, 0x47, 0x00, 0x62, 0x52, 0x17, 0x54, 0xe8, 0x42, 0xea, 0xce,
+    0xd5, 0x41, 0xec, 0x88, 0x65, 0xe8, 0x4a, 0xd5, 0x28, 0xd6, 0x80, 0x00,
+    0xba, 0x3d, 0xf2, 0x22, 0x55, 0x5d, 0xdc, 0xc0, 0x3f, 0xc6, 0x27, 0x51,
+    0x2f, 0x51, 0x95, 0x20, 0xbb, 0xb7, 0x60, 0xdc, 0xcd, 0x96, 0xff, 0x8b,
+    0x5c, 0xcb, 0xe8, 0x11, 0x41, 0xb1, 0x69, 0xef, 0x8b, 0xdf, 0xc5, 0x86,
+    0xe8, 0x00, 0x00, 0x00,
+};
+#define WEBP_33X17_CRC (0xdfb0e247U)
+
+/* lossy 96x96 with an ALPH chunk, quality 75 */
+static const uint8_t webp_96x96a[1732] = {
+    0x52, 0x49, 0x46, 0x46, 0xbc, 0x06, 0x00, 0x00, 0x57, 0x45, 0x42, 0x50,
+    0x56, 0x50, 0x38, 0x58, 0x0a, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x5f, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x41, 0x4c, 0x50, 0x48, 0x1d, 0x01,
+    0x00, 0x00, 0x01, 0x17, 0x20, 0x10, 0x48, 0x62, 0x5f, 0x7c, 0x8d, 0x88,
+    0x08, 0x07, 0xc7, 0x91, 0x24, 0x49, 0xcd, 0x04, 0x4f, 0x4c, 0xc1, 0x9f,
+    0x41, 0x87, 0x09, 0xb2, 0x62, 0x9d, 0xe0, 0xaf, 0x5b, 0xcb, 0xb8, 0xc9,
+    0x4e, 0x77, 0x03, 0x92, 0xde, 0x11, 0xfd, 0x67, 0xe4, 0xb6, 0x6d, 0x24,
+    0x75, 0x75, 0x9d, 0xcc, 0xa9, 0xcd, 0xfc, 0xc1, 0x60, 0xeb, 0x4c, 0x6a,
+    0x25, 0x22, 0xa2, 0xd7, 0x86, 0xd8, 0x23, 0x35, 0x1a, 0x55, 0x33, 0xa1,
+    0x9c, 0x49, 0x47, 0x15, 0x11, 0xdc, 0x97, 0xec, 0x2b, 0x66, 0x50, 0x75,
+    0x04, 0x8b, 0x86, 0xc1, 0x50, 0x13, 0x09, 0xb5, 0x28, 0x83, 0xd2, 0x01,
+    0x87, 0x1a, 0xc0, 0x11, 0x8d, 0xca, 0x09, 0xe2, 0x8c, 0xee, 0x8e, 0x8d,
+    0x02, 0x06, 0xe8, 0x3d, 0x72, 0x2e, 0xde, 0xf0, 0x42, 0xc6, 0x15, 0xae,
+    0xee, 0x88, 0x9a, 0x56, 0xbc, 0x80, 0xc8, 0x73, 0x66, 0x02, 0x81, 0x59,
+    0x27, 0x99, 0x29, 0x49, 0x03, 0x99, 0x12, 0xaf, 0x49, 0x13, 0x39, 0x24,
+    0x46, 0x84, 0x27, 0xea, 0x82, 0x43, 0xe6, 0x25, 0x71, 0x0d, 0x29, 0x92,
+    0x06, 0x76, 0x96, 0x22, 0x61, 0x20, 0x62, 0xc4, 0x78, 0x43, 0x51, 0xe9,
+    0x1b, 0x9c, 0x30, 0xaf, 0xe3, 0xda, 0x66, 0xf2, 0xc4, 0x61, 0x1d, 0x67,
+    0xc6, 0xb4, 0x8e, 0xaa, 0x12, 0xeb, 0x18, 0x19, 0xfe, 0x9f, 0x08, 0xfd,
+    0x43, 0x7f, 0x93, 0xed, 0xef, 0xc3, 0xf6, 0xf7, 0x6d, 0xfb, 0xfb, 0xbc,
+    0xfd, 0x7b, 0xd1, 0xdf, 0x9d, 0x29, 0xac, 0x7c, 0xd7, 0x7a, 0x1d, 0xd8,
+    0xbc, 0x9e, 0xe8, 0x75, 0x49, 0xaf, 0x63, 0x7a, 0xdd, 0xd3, 0xeb, 0xa4,
+    0x5e, 0x57, 0xe5, 0x3a, 0xac, 0xd7, 0x6d, 0xbd, 0xce, 0xeb, 0xff, 0x05,
+    0xfd, 0x3f, 0xb2, 0xf2, 0xbf, 0x73, 0xe5, 0x0c, 0x2d, 0x85, 0xd3, 0xb7,
+    0x18, 0x00, 0x39, 0xa2, 0x61, 0x89, 0xab, 0xe0, 0x24, 0x43, 0x70, 0x44,
+    0x69, 0x80, 0x2b, 0xd3, 0xa8, 0xd1, 0x6c, 0x51, 0x1a, 0xa4, 0x90, 0x68,
+    0x71, 0x31, 0xd6, 0x80, 0x4f, 0x29, 0xe0, 0x8c, 0x77, 0x32, 0x0c, 0x00,
+    0x56, 0x50, 0x38, 0x20, 0x78, 0x05, 0x00, 0x00, 0xd0, 0x21, 0x00, 0x9d,
+    0x01, 0x2a, 0x60, 0x00, 0x60, 0x00, 0x3e, 0x91, 0x3c, 0x98, 0x49, 0xa5,
+    0xa3, 0x22, 0x35, 0xac, 0x73, 0x7a, 0xea, 0xb0, 0x12, 0x09, 0x6c, 0x02,
+    0x5c, 0x02, 0x09, 0x04, 0x39, 0x56, 0xbd, 0xd7, 0xfd, 0x6f, 0xf8, 0xf7,
+    0xec, 0x27, 0xe2, 0xaf, 0xc8, 0xc5, 0x25, 0xfb, 0x77, 0xf3, 0xdf, 0xd7,
+    0xfb, 0xa8, 0x09, 0x25, 0xed, 0xd3, 0xc4, 0x37, 0xfa, 0x8f, 0xa0, 0x07,
+    0x40, 0xdf, 0xd2, 0x1f, 0x5c, 0x3f, 0x40, 0x1f, 0xfd, 0xba, 0x67, 0x75,
+    0x0e, 0x7f, 0xc4, 0xf9, 0xcd, 0xe9, 0x20, 0x4a, 0x9d, 0xd6, 0xef, 0x5d,
+    0xff, 0xca, 0xdb, 0x80, 0xf5, 0xd5, 0xc7, 0x5a, 0x23, 0x3c, 0x51, 0x73,
+    0x00, 0xf4, 0xb0, 0xee, 0x17, 0xf8, 0xa7, 0xf8, 0xff, 0x60, 0x0f, 0xd6,
+    0xce, 0xac, 0xbf, 0xaf, 0x1e, 0xca, 0x5f, 0xa4, 0x4d, 0x28, 0xdd, 0x2d,
+    0xde, 0x26, 0x98, 0xd9, 0x5d, 0x5d, 0x96, 0x83, 0x93, 0x6f, 0xd1, 0x5b,
+    0x10, 0xf0, 0xe4, 0x94, 0xfe, 0x08, 0xcf, 0x41, 0xbb, 0x1b, 0x6a, 0xf9,
+    0x6d, 0x93, 0x12, 0x56, 0xe2, 0xae, 0x12, 0xcb, 0x53, 0xe5, 0xca, 0x30,
+    0x8d, 0x0e, 0x4f, 0xa0, 0x97, 0x93, 0x88, 0x9c, 0x6d, 0x44, 0x04, 0xa7,
+    0x48, 0xdc, 0x00, 0x4e, 0x2a, 0xf5, 0x08, 0x49, 0x14, 0xfa, 0x28, 0xee,
+    0x76, 0x4b, 0x01, 0xbf, 0x62, 0x4d, 0x64, 0x4e, 0x46, 0x9e, 0xee, 0x08,
+    0x1f, 0xae, 0xa5, 0xad, 0x4f, 0x2b, 0xf4, 0xf0, 0x71, 0x16, 0xdc, 0x3a,
+    0x01, 0x57, 0x09, 0x31, 0x3a, 0xa0, 0xb2, 0xac, 0xb3, 0x55, 0x6e, 0x49,
+    0x1f, 0xeb, 0xfa, 0x2e, 0xe1, 0xc2, 0x8a, 0xad, 0x39, 0x1c, 0x9c, 0x24,
+    0x3a, 0x29, 0xf2, 0x78, 0x27, 0x19, 0x15, 0x0f, 0x9c, 0xac, 0x62, 0x15,
+    0xd9, 0x1a, 0x3e, 0x2c, 0xbb, 0xd8, 0xd6, 0x0e, 0x5b, 0xcc, 0x78, 0x2c,
+    0x5f, 0x22, 0xd8, 0x2e, 0x45, 0xff, 0x8d, 0x5d, 0x89, 0x02, 0x36, 0xe1,
+    0x46, 0x5c, 0x7f, 0x9b, 0x27, 0x8e, 0x39, 0x7f, 0x51, 0x17, 0x00, 0x00,
+    0xfe, 0xe8, 0xc2, 0xb5, 0x6d, 0xd1, 0x0c, 0x64, 0xb8, 0x13, 0xf8, 0x27,
+    0x5e, 0x0c, 0x7f, 0xc6, 0x97, 0xf9, 0xdb, 0x97, 0x59, 0xdf, 0xfe, 0xef,
+    0x2e, 0x0b, 0xc1, 0x9d, 0x41, 0xec, 0x62, 0xb8, 0x78, 0xfb, 0x41, 0xb0,
+    0xd2, 0xc1, 0xe9, 0xca, 0xb1, 0x17, 0x4f, 0x21, 0x92, 0xf1, 0xf3, 0x3f,
+    0xfc, 0x9f, 0x2e, 0x2a, 0xb8, 0xb9, 0x85, 0xa3, 0xee, 0x23, 0x15, 0x2f,
+    0x8a, 0x75, 0x28, 0x79, 0x79, 0x9c, 0x2b, 0x78, 0xbc, 0xe6, 0x1b, 0xff,
+    0x5f, 0xe8, 0x79, 0x6f, 0xac, 0x98, 0x9b, 0x19, 0x79, 0xb1, 0x87, 0xff,
+    0x51, 0x2c, 0xf8, 0x01, 0x8c, 0x50, 0x2d, 0x0a, 0x5c, 0xb5, 0x67, 0x2c,
+    0x53, 0x35, 0xa8, 0x8a, 0x26, 0xef, 0x76, 0x5d, 0xeb, 0xfe, 0xf2, 0x2e,
+    0x07, 0xaa, 0x73, 0x06, 0x0b, 0x6d, 0x85, 0xf5, 0x91, 0x9f, 0x67, 0xc0,
+    0x19, 0xdf, 0x91, 0xbe, 0x67, 0xe5, 0x28, 0xd2, 0xd0, 0x64, 0xbf, 0xc5,
+    0xb2, 0xbb, 0xb9, 0x0b, 0x81, 0x26, 0x23, 0xd1, 0xa6, 0x0b, 0x07, 0x0f,
+    0x25, 0xef, 0xc8, 0x88, 0x1b, 0xfb, 0x66, 0xf9, 0xaa, 0x23, 0x64, 0x1a,
+    0x5b, 0x80, 0x8a, 0x1a, 0x86, 0x3e, 0x61, 0x18, 0xbf, 0x01, 0x82, 0x12,
+    0x6a, 0xf4, 0xc7, 0x7d, 0xc2, 0x74, 0x0f, 0x40, 0x4b, 0x18, 0x72, 0x0c,
+    0xe1, 0x5d, 0xf8, 0x8c, 0xab, 0xfc, 0x7d, 0x4f, 0xe3, 0xc2, 0xec, 0xef,
+    0xee, 0xda, 0xb8, 0x37, 0x7e, 0xb3, 0x52, 0xff, 0x8f, 0x8e, 0x1e, 0xda,
+    0xff, 0x12, 0xa9, 0x3e, 0x3c, 0xc5, 0xe1, 0xf1, 0xcd, 0xae, 0x7d, 0x9d,
+    0xb2, 0xc4, 0x93, 0x5b, 0x94, 0x4e, 0x3d, 0x34, 0x6f, 0xce, 0x35, 0xf8,
+    0x4a, 0xe8, 0xc9, 0xb0, 0x88, 0x5a, 0x1a, 0x72, 0xa5, 0xd3, 0xe8, 0xdf,
+    0x67, 0xff, 0xfc, 0x18, 0xbf, 0x3e, 0x46, 0x63, 0x33, 0xd1, 0xfc, 0x8f,
+    0x89, 0x92, 0x94, 0x4e, 0x63, 0xfd, 0x81, 0x3f, 0x60, 0xe0, 0x24, 0x6c,
+    0x1a, 0xc4, 0xa3, 0x51, 0x72, 0xde, 0x18, 0xac, 0xb0, 0x69, 0x86, 0x11,
+    0x38, 0x22, 0x40, 0x51, 0xbf, 0xd7, 0x86, 0x8d, 0x03, 0x23, 0xfd, 0x5e,
+    0xfd, 0x3b, 0x5e, 0x51, 0x72, 0x6f, 0xab, 0x54, 0x7d, 0x11, 0x57, 0x60,
+    0xa0, 0x4f, 0x24, 0xa3, 0xf5, 0x96, 0xe7, 0xd4, 0x88, 0x2e, 0xde, 0x1e,
+    0x31, 0xbd, 0x73, 0xf1, 0x8a, 0x36, 0x95, 0x9d, 0x9a, 0xa7, 0x55, 0xec,
+    0x06, 0x0a, 0xb4, 0xf3, 0x51, 0x48, 0x96, 0xee, 0x83, 0x4e, 0xc7, 0x20,
+    0x68, 0xcb, 0xff, 0x01, 0x36, 0xfa, 0xe9, 0xe2, 0x8f, 0x8d, 0xb4, 0x3d,
+    0x5b, 0xc7, 0xa7, 0xda, 0xc9, 0x0d, 0x5e, 0xc1, 0x29, 0x66, 0x85, 0x39,
+    0x67, 0x5c, 0x7a, 0x8f, 0x4d, 0x95, 0x08, 0xcf, 0x2a, 0x62, 0x43, 0x6c,
+    0x18, 0x59, 0xdb, 0xad, 0x7a, 0x00, 0x5e, 0x68, 0x4c, 0xa6, 0x83, 0xa7,
+    0xf5, 0xd5, 0x46, 0xe0, 0x80, 0x93, 0xdc, 0x78, 0xa7, 0xaf, 0xf6, 0x03,
+    0xb8, 0xb5, 0x17, 0xca, 0x22, 0xb5, 0xfa, 0x25, 0xfe, 0xe8, 0xd9, 0x45,
+    0x61, 0x45, 0x2a, 0x62, 0x33, 0x3a, 0xc0, 0xc7, 0xae, 0x4b, 0x7a, 0xf5,
+    0x4f, 0xdf, 0x50, 0x54, 0x49, 0xb7, 0x5e, 0xa8, 0x12, 0x8f, 0x99, 0x4f,
+    0xe5, 0x17, 0x24, 0x2a, 0xc3, 0x1e, 0x5f, 0x27, 0x94, 0x5d, 0x5a, 0xa3,
+    0x07, 0x1c, 0x16, 0xa1, 0x5c, 0xfe, 0xb9, 0x56, 0x9e, 0xe7, 0xb8, 0xb2,
+    0xf4, 0xbd, 0xc0, 0x0b, 0x20, 0x7c, 0x98, 0x21, 0x7a, 0x17, 0x0f, 0x13,
+    0x40, 0xda, 0xee, 0x2f, 0xed, 0x1d, 0xf6, 0x02, 0xd1, 0x57, 0x3c, 0x2b,
+    0x80, 0x89, 0x79, 0xb4, 0xb8, 0xe3, 0xc4, 0xbc, 0x14, 0x08, 0x21, 0x2b,
+    0xa5, 0xa4, 0xb2, 0x26, 0xb4, 0x03, 0x61, 0x39, 0x3d, 0x97, 0xfd, 0x2a,
+    0x9a, 0x56, 0x4b, 0xcd, 0x15, 0xf7, 0x50, 0x32, 0x99, 0xb4, 0x16, 0xce,
+    0x25, 0x63, 0x29, 0x6f, 0xd4, 0x49, 0x19, 0x32, 0x20, 0x60, 0x28, 0x85,
+    0x9a, 0x76, 0x50, 0xb7, 0xaa, 0x46, 0x5b, 0x6f, 0x48, 0x61, 0x7b, 0xa9,
+    0x7c, 0x46, 0x97, 0xe7, 0xaf, 0x20, 0x74, 0x1a, 0x32, 0x42, 0xcd, 0xd3,
+    0x80, 0xc8, 0x90, 0x2a, 0xbb, 0xa2, 0x0a, 0x28, 0xb3, 0x81, 0x9f, 0x91,
+    0xd1, 0x89, 0x23, 0x38, 0x64, 0x3d, 0x77, 0x2a, 0x27, 0x0c, 0xf2, 0x3e,
+    0xb4, 0x49, 0x66, 0x1f, 0x94, 0x2e, 0xd7, 0x4b, 0xb2, 0x08, 0x63, 0xf2,
+    0x48, 0x3f, 0x58, 0x65, 0x91, 0x12, 0xf6, 0xde, 0x77, 0x28, 0xb9, 0x21,
+    0x55, 0xf5, 0x6a, 0xfc, 0xb9, 0x45, 0xc0, 0xc6, 0xbd, 0xef, 0x09, 0xd0,
+    0x73, 0xb5, 0x01, 0xfd, 0x7b, 0x2c, 0x1a, 0x2f, 0xd7, 0xd6, 0x90, 0x2e,
+    0xfd, 0x94, 0x0d, 0x3b, 0xe9, 0x5f, 0x06, 0x6c, 0xa1, 0xfe, 0x04, 0xb7,
+    0x47, 0xb9, 0x47, 0xd1, 0xec, 0x52, 0x13, 0x2a, 0x70, 0x37, 0x68, 0x47,
+    0x1e, 0x38, 0x5c, 0x48, 0x76, 0xb7, 0x61, 0x21, 0xaa, 0xd7, 0xfc, 0x24,
+    0xb0, 0x60, 0x8d, 0x96, 0xad, 0x07, 0xbd, 0x22, 0x3b, 0x04, 0x70, 0xc6,
+    0xb7, 0xe5, 0x32, 0xb7, 0x3e, 0xcd, 0xd4, 0xc7, 0x08, 0xdd, 0xc5, 0xae,
+    0xdc, 0xa5, 0x5e, 0xf9, 0x7c, 0xa1, 0xf1, 0x8d, 0xf6, 0x8a, 0x33, 0x67,
+    0xe3, 0x78, 0x8a, 0xef, 0x08, 0xe5, 0xf4, 0xa3, 0x68, 0xa0, 0xee, 0xf1,
+    0x57, 0xf3, 0x5c, 0xaf, 0xb5, 0x3b, 0x60, 0x61, 0xbe, 0x7e, 0x44, 0x3f,
+    0x9f, 0x79, 0x2e, 0x68, 0x7b, 0x8f, 0x3a, 0x6c, 0xc3, 0x54, 0x65, 0xaf,
+    0xd0, 0x2f, 0x79, 0x40, 0x7a, 0xf7, 0xa0, 0x06, 0x6d, 0xad, 0xf1, 0x12,
+    0x31, 0xe1, 0xa2, 0xad, 0x2c, 0x0f, 0x5b, 0x2f, 0xe4, 0x22, 0xab, 0xf5,
+    0x98, 0x24, 0x33, 0x19, 0x1e, 0xfc, 0xff, 0x27, 0x5f, 0x06, 0x34, 0x81,
+    0x06, 0x28, 0xb3, 0xcf, 0x4d, 0x2c, 0x8d, 0x5d, 0x64, 0xe2, 0x95, 0x9e,
+    0xdd, 0xf0, 0xbf, 0xb8, 0xf2, 0x90, 0x40, 0xc6, 0x7e, 0x57, 0xc2, 0x68,
+    0x87, 0x65, 0x71, 0x76, 0xa7, 0x8f, 0x43, 0x1b, 0xab, 0x12, 0x39, 0x4e,
+    0x55, 0x2f, 0xe5, 0x89, 0x69, 0xc3, 0x99, 0xfb, 0xcb, 0xfc, 0xc9, 0x14,
+    0x61, 0x83, 0xa8, 0xda, 0x8d, 0xa1, 0x3d, 0x74, 0xe4, 0x6b, 0x08, 0x40,
+    0x77, 0xfc, 0xd1, 0x07, 0xc5, 0x54, 0x48, 0x51, 0xd8, 0x39, 0x68, 0x64,
+    0x53, 0x78, 0x50, 0x7f, 0x4b, 0x20, 0xdb, 0x85, 0x88, 0x2b, 0x89, 0x16,
+    0x1e, 0xe7, 0x92, 0x85, 0xdc, 0xb3, 0xa7, 0xb7, 0x66, 0xe0, 0xf4, 0x40,
+    0xc7, 0xc3, 0x09, 0x02, 0x88, 0x12, 0x52, 0x77, 0x0e, 0x72, 0x33, 0x4d,
+    0xfd, 0x0b, 0x0a, 0xe2, 0xbc, 0x69, 0x1b, 0x0e, 0x72, 0xd0, 0xd7, 0xa6,
+    0xcf, 0xb3, 0x4a, 0x3b, 0x05, 0xed, 0x9d, 0x65, 0x0f, 0x3f, 0xbe, 0x25,
+    0xa8, 0x56, 0xa8, 0xb7, 0x22, 0x5b, 0x49, 0x61, 0xaf, 0x7e, 0x23, 0x04,
+    0xba, 0xe2, 0xf8, 0x58, 0x2c, 0x29, 0x0a, 0x37, 0xc4, 0x06, 0xb3, 0xd9,
+    0x4d, 0x4e, 0x15, 0xfe, 0xba, 0x7e, 0x09, 0xbb, 0x26, 0x62, 0xd7, 0x0f,
+    0xf1, 0x6b, 0x5b, 0x45, 0x33, 0xa7, 0x36, 0x37, 0x60, 0xa0, 0xbb, 0xc0,
+    0xa6, 0xf1, 0xa0, 0xae, 0x4e, 0x7a, 0xb0, 0x60, 0xf2, 0xd0, 0x43, 0xb2,
+    0xa7, 0xb3, 0x6f, 0xef, 0x71, 0xb1, 0x53, 0xf0, 0x03, 0x50, 0x48, 0xa3,
+    0x2c, 0x26, 0x90, 0xf3, 0x03, 0xa0, 0x41, 0x05, 0x32, 0xc7, 0xc4, 0x4a,
+    0x8c, 0xe8, 0xfa, 0x9d, 0x14, 0x29, 0xe2, 0x70, 0xe0, 0xff, 0x9b, 0x67,
+    0x70, 0x85, 0xec, 0x37, 0x47, 0x53, 0xdb, 0xff, 0x8f, 0xfb, 0x7a, 0x7f,
+    0xde, 0xc2, 0x1f, 0x89, 0x39, 0xa4, 0xc9, 0x63, 0xb8, 0x91, 0x5e, 0x4f,
+    0x44, 0xd8, 0xb5, 0xdd, 0x2f, 0xaa, 0xa1, 0x5e, 0xae, 0x5b, 0x88, 0x37,
+    0xd5, 0x23, 0x04, 0xc4, 0x91, 0x64, 0x5f, 0x1d, 0xd9, 0x0e, 0x3c, 0xaf,
+    0x10, 0x79, 0x32, 0x9b, 0x88, 0x46, 0xf6, 0xee, 0x3e, 0x89, 0x29, 0x53,
+    0x57, 0x76, 0xe9, 0x05, 0x5a, 0x6f, 0x07, 0x6d, 0x49, 0x77, 0x65, 0xa9,
+    0xc8, 0x14, 0x4a, 0x1d, 0x4e, 0x94, 0x02, 0x40, 0x99, 0x1f, 0xee, 0xf8,
+    0x8b, 0xb0, 0x9f, 0x20, 0x9d, 0xc1, 0x23, 0x79, 0xbf, 0xf5, 0x04, 0x7e,
+    0xab, 0x7d, 0x5b, 0xf2, 0x5a, 0xff, 0x70, 0x0e, 0xab, 0x57, 0x32, 0x85,
+    0xfe, 0x88, 0xab, 0xb0, 0x50, 0xfa, 0x01, 0xec, 0x4f, 0x8f, 0xd7, 0x32,
+    0x28, 0x00, 0x00, 0x00,
+};
+#define WEBP_96X96A_CRC (0x7792e038U)
+
+/* lossy 48x48 with an ALPH chunk, quality 50 */
+static const uint8_t webp_48x48a[522] = {
+    0x52, 0x49, 0x46, 0x46, 0x02, 0x02, 0x00, 0x00, 0x57, 0x45, 0x42, 0x50,
+    0x56, 0x50, 0x38, 0x58, 0x0a, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x41, 0x4c, 0x50, 0x48, 0x9b, 0x00,
+    0x00, 0x00, 0x01, 0x17, 0x20, 0x10, 0x48, 0x62, 0x5f, 0x7c, 0x8d, 0x88,
+    0x08, 0x07, 0x47, 0xb1, 0x6d, 0xb7, 0x8d, 0x46, 0x4b, 0x41, 0x11, 0x1f,
+    0x57, 0x08, 0x46, 0x21, 0x12, 0xde, 0x3b, 0x3d, 0xb9, 0x34, 0xf5, 0xfe,
+    0x4b, 0x23, 0x10, 0xd1, 0x7f, 0xb6, 0x01, 0xdb, 0xb6, 0x81, 0x7b, 0x98,
+    0x89, 0xe4, 0x15, 0x49, 0x46, 0x4e, 0x71, 0x1c, 0x50, 0x03, 0x0d, 0xa0,
+    0x28, 0xcf, 0x0e, 0xf1, 0x34, 0xc7, 0xa1, 0xd4, 0xf0, 0x36, 0x4f, 0x02,
+    0x59, 0x94, 0x20, 0x88, 0xb2, 0x0d, 0xc3, 0x0d, 0xaa, 0x28, 0xe3, 0x30,
+    0x0c, 0x22, 0xc8, 0x29, 0x47, 0x4e, 0xb0, 0x76, 0x76, 0xc8, 0x4d, 0xde,
+    0xf2, 0x2c, 0x0d, 0x06, 0xe1, 0x45, 0x39, 0xba, 0xa2, 0x42, 0x7d, 0x03,
+    0xab, 0xb2, 0x53, 0x9f, 0x0e, 0x9e, 0x8c, 0xca, 0xf0, 0x0f, 0xf0, 0xbf,
+    0xfc, 0x15, 0xef, 0x83, 0xf7, 0xe7, 0x73, 0x0f, 0xbd, 0xcf, 0xde, 0x7f,
+    0x9f, 0x8b, 0xcf, 0xcb, 0xe6, 0xe8, 0xf3, 0xf5, 0xb9, 0xfb, 0x3e, 0xd8,
+    0x9e, 0xf8, 0xfe, 0xf8, 0x5e, 0xd9, 0xbe, 0xf9, 0x1e, 0xbe, 0xeb, 0x67,
+    0x02, 0x00, 0x56, 0x50, 0x38, 0x20, 0x40, 0x01, 0x00, 0x00, 0x90, 0x09,
+    0x00, 0x9d, 0x01, 0x2a, 0x30, 0x00, 0x30, 0x00, 0x3e, 0xd1, 0x54, 0xa3,
+    0x4d, 0xa8, 0x36, 0x32, 0xa2, 0x31, 0xd3, 0x3a, 0x02, 0xc0, 0x1a, 0x09,
+    0x6c, 0x00, 0x9d, 0x39, 0x41, 0x51, 0x9d, 0xc1, 0x7d, 0x9b, 0x8d, 0xa4,
+    0xe0, 0x3c, 0xff, 0xfc, 0xff, 0xef, 0x92, 0x88, 0x85, 0xc8, 0x13, 0x1f,
+    0x02, 0xd8, 0x0a, 0x2e, 0xf3, 0xb7, 0x99, 0xd1, 0xb9, 0x69, 0xbb, 0xa0,
+    0xc8, 0x76, 0x13, 0xfb, 0xea, 0xd1, 0x7a, 0x1d, 0xe0, 0xe3, 0x23, 0x1f,
+    0x1c, 0xf2, 0xa2, 0xcb, 0x2a, 0xf1, 0x8e, 0xf8, 0xb8, 0x0a, 0x60, 0x00,
+    0xfd, 0xcd, 0x29, 0x9d, 0x55, 0xac, 0x82, 0xa4, 0xea, 0xea, 0xe5, 0x31,
+    0x7e, 0xa4, 0x92, 0x80, 0x0c, 0xe4, 0x8c, 0xfc, 0xc5, 0xab, 0x82, 0x9f,
+    0x8b, 0xdb, 0xf0, 0xa3, 0xf9, 0x81, 0xf0, 0xaf, 0xc2, 0xf2, 0x96, 0xa6,
+    0x9b, 0xd5, 0x2b, 0xf8, 0x6a, 0xc5, 0x7b, 0x44, 0xb1, 0x01, 0xe2, 0x2c,
+    0x0e, 0xde, 0x63, 0xde, 0xa6, 0xab, 0xe3, 0xde, 0x4f, 0x0c, 0x1b, 0x89,
+    0xed, 0x9c, 0x4c, 0x1a, 0xa8, 0x50, 0xdb, 0xa0, 0xa5, 0x9d, 0x13, 0x09,
+    0xcc, 0xac, 0x08, 0x37, 0xf1, 0x25, 0x39, 0x3c, 0x0c, 0x3c, 0x18, 0x8a,
+    0x46, 0xcf, 0x06, 0xd6, 0x2d, 0x1e, 0xa8, 0xa2, 0xef, 0x4b, 0xe1, 0xef,
+    0x4c, 0x1b, 0x82, 0x84, 0x6e, 0xd1, 0x13, 0xa5, 0x05, 0xac, 0xe7, 0xd4,
+    0x7e, 0x00, 0xfc, 0xf3, 0x10, 0xff, 0x85, 0xe5, 0x2d, 0x4b, 0x51, 0x3d,
+    0xed, 0xae, 0xc2, 0xb0, 0x17, 0x08, 0x90, 0xf3, 0x60, 0x7c, 0xb4, 0xe9,
+    0x38, 0x8d, 0x75, 0x16, 0xa5, 0x92, 0xcc, 0xe7, 0xb0, 0x6e, 0x98, 0x03,
+    0x54, 0x88, 0xbf, 0x5e, 0xb4, 0x54, 0xcc, 0x6c, 0xea, 0x59, 0xc3, 0xe3,
+    0x14, 0x8a, 0x19, 0xa2, 0xfc, 0x6a, 0x5c, 0x98, 0x98, 0x2d, 0x60, 0x23,
+    0x14, 0xe9, 0x28, 0xaf, 0x36, 0x6d, 0x97, 0xef, 0xd5, 0x52, 0xf4, 0xbe,
+    0x31, 0x16, 0xec, 0xcc, 0x27, 0x05, 0xfa, 0x7e, 0x2f, 0x7e, 0x59, 0x7e,
+    0xe4, 0x5e, 0xdd, 0xbf, 0x71, 0x2c, 0xfe, 0x4c, 0x1c, 0x35, 0xc8, 0x48,
+    0xfe, 0x27, 0xca, 0xa5, 0x95, 0x7f, 0xd9, 0xfe, 0xc2, 0xd9, 0x34, 0x27,
+    0x21, 0xba, 0x7c, 0xe3, 0x92, 0x3e, 0x86, 0x6a, 0xa2, 0xb9, 0xe9, 0x49,
+    0xd1, 0xf7, 0x07, 0x17, 0x00, 0x00,
+};
+#define WEBP_48X48A_CRC (0xfddf6a5aU)
+
+#endif /*_WEBP_STREAMS_H_*/
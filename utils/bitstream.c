@@ -34,6 +34,7 @@ struct bits_vec *bits_vec_alloc(uint8_t *buff, int len, uint8_t msb) {
   vec->offset = 0;
   vec->len = len;
   vec->msb = msb;
+  vec->eof = 0;
   return vec;
 }
 
@@ -45,14 +46,7 @@ void bits_vec_free(struct bits_vec *v) {
 }
 
 int bits_vec_eof_bits(struct bits_vec *v, int n) {
-  if (v->ptr + (v->offset + n) / 8 - v->start > (long)v->len) {
-    return 1;
-  } else if (v->ptr + (v->offset + n) / 8 - v->start == (long)v->len) {
-    if (v->offset + n % 8 > 8) {
-      return 1;
-    }
-  }
-  return 0;
+  return (v->ptr - v->start) * 8 + v->offset + n > (long)v->len * 8;
 }
 
 int bits_vec_left_bits(struct bits_vec *v)
@@ -60,6 +54,17 @@ int bits_vec_left_bits(struct bits_vec *v)
   return (v->start+v->len - v->ptr)*8 - v->offset;
 }
 
+void bits_vec_extend(struct bits_vec *v, uint8_t *buff, int len)
+{
+  long pos = v->ptr - v->start;
+  long base = v->start - v->buff;
+  v->buff = buff;
+  v->start = buff + base;
+  v->ptr = v->start + pos;
+  v->len = len - base;
+  v->eof = 0;
+}
+
 void bits_vec_step_back(struct bits_vec *v, int n) {
   while (n--) {
     if (v->offset == 0) {
@@ -113,9 +118,9 @@ read_bits(struct bits_vec *v, int n)
 #endif
 
 int bits_vec_read_bit(struct bits_vec *v) {
-  if (v->ptr - v->start > (long)v->len) {
-    printf("bits longer than expect\n");
-    exit(-1);
+  if (v->ptr - v->start >= (long)v->len) {
+    // let the caller decide, an incremental decoder waits for more data
+    v->eof = 1;
     return -1;
   }
   int ret, shift;
@@ -148,12 +153,7 @@ int bits_vec_read_bits(struct bits_vec *v, int n) {
 }
 
 void bits_vec_skip_bits(struct bits_vec *v, int n) {
-  uint8_t skip = 0;
-  int bytes = n / 8;
-  while (skip < bytes) {
-    v->ptr++;
-    skip += 1;
-  }
+  v->ptr += n / 8;
   v->offset += n % 8;
   if (v->offset >= 8) {
     v->ptr++;
@@ -213,6 +213,7 @@ struct bits_vec *bits_writer_reserve(uint8_t msb) {
   vec->offset = 0;
   vec->len = 0;
   vec->msb = msb;
+  vec->eof = 0;
   return vec;
 }
 
@@ -22,6 +22,7 @@ struct bits_vec {
     int len;            /* total bitstream length in bytes */
     int reserve;
     uint8_t msb;        /* indicate bits read from which side */
+    uint8_t eof;        /* sticky, set once a read goes past len */
 };
 
 /* Allocate a bitstream reader */
@@ -71,6 +72,9 @@ void bits_vec_reinit_cur(struct bits_vec *v);
 
 int bits_vec_left_bits(struct bits_vec *v);
 
+/* the data moved to buff and grew to len bytes, keep the read position */
+void bits_vec_extend(struct bits_vec *v, uint8_t *buff, int len);
+
 /* macro define for bitstream helper */
 #define READ_BIT(v) bits_vec_read_bit(v)
 #define READ_BITS(v, n) bits_vec_read_bits(v, n)
@@ -263,6 +263,7 @@ void BGR24_to_YUV420(uint8_t *ptr, int pitch, int16_t *Y, int16_t *U,
     int r, g, b;
     uint8_t *p = ptr;
     uint8_t *p2 = ptr;
+    float u[64] = {0}, v[64] = {0};
     for (int k = 0; k < 4; k++) {
         p = p2;
         if (k == 1) {
@@ -271,55 +272,69 @@ void BGR24_to_YUV420(uint8_t *ptr, int pitch, int16_t *Y, int16_t *U,
             p2 = p + 8 * 3;
         }
         for (int j = 0; j < 8; j++) {
+            // chroma is the average of each 2x2 pixels of the 16x16 block
+            float *cu = u + (((k >> 1) * 8 + j) / 2) * 8 + (k & 1) * 4;
+            float *cv = v + (cu - u);
             for (int i = 0; i < 8; i++) {
                 b = *(p + 3 * i);
                 g = *(p + 3 * i + 1);
                 r = *(p + 3 * i + 2);
                 Y[j * 8 + i] = (int16_t)(0.299 * r + 0.587 * g + 0.114 * b -128);
-                if (k == 0) {
-                    U[j * 8 + i] = (int16_t)(-0.16874 * r - 0.33126 * g + 0.5 * b );
-                } else if (k == 2) {
-                    V[j * 8 + i] = (int16_t)(0.5 * r - 0.41869 * g - 0.08131 * b);
-                }
+                cu[i / 2] += 0.25f * (-0.16874f * r - 0.33126f * g + 0.5f * b);
+                cv[i / 2] += 0.25f * (0.5f * r - 0.41869f * g - 0.08131f * b);
             }
             p += pitch;
         }
         Y += 64;
     }
+    for (int i = 0; i < 64; i++) {
+        U[i] = (int16_t)u[i];
+        V[i] = (int16_t)v[i];
+    }
+}
+
+/* BT.601 limited range in 14bit fixed point, the same as libwebp so the
+ * decoded pixels match the reference decoder
+ */
+static inline uint8_t yuv_clip8(int v)
+{
+    return ((v & ~16383) == 0) ? (v >> 6) : (v < 0) ? 0 : 255;
+}
+
+static inline int yuv_mult_hi(int v, int coeff)
+{
+    return (v * coeff) >> 8;
 }
 
 void YUV420_to_BGRA32(uint8_t *ptr, int pitch, uint8_t *yout, uint8_t *uout,
-                      uint8_t *vout, int y_stride, int uv_stride, int mbrows,
-                      int mbcols) {
+                      uint8_t *vout, uint8_t *aout, int y_stride,
+                      int uv_stride, int mbrows, int mbcols) {
     uint8_t *p = ptr, *p2 = ptr;
     int width = mbcols << 4;
     int right_space = pitch - width * 4;
-    uint8_t *Y, *U, *V;
-    int16_t yy, u, v;
-    uint8_t r, g, b;
+    uint8_t *Y, *U, *V, *A = NULL;
+    int yy, u, v;
 
     for (int y = 0; y < mbrows; y++) {
         for (int x = 0; x < mbcols; x++) {
             Y = yout + (y_stride * y + x) * 16;
             U = uout + 8 * (uv_stride * y + x);
             V = vout + 8 * (uv_stride * y + x);
+            if (aout) {
+                A = aout + (y_stride * y + x) * 16;
+            }
             p = p2;
             p2 = p + 16 * 4;
             for (int i = 0; i < 16; i++) {
                 for (int j = 0; j < 16; j++) {
-                    yy = Y[i * y_stride + j];
-                    u = U[(i / 2) * uv_stride + (j / 2)] - 128;
-                    v = V[(i / 2) * uv_stride + (j / 2)] - 128;
-                    // r = clamp(yy + 1.4075 * v, 255);
-                    // g = clamp(yy - 0.3455 * u - 0.7169 * v, 255);
-                    // b = clamp(yy + 1.779 * u, 255);
-                    r = clamp(yy + 1.28 * v, 255);
-                    g = clamp(yy - 0.215 * u - 0.381 * v, 255);
-                    b = clamp(yy + 2.128 * u, 255);
-                    p[4 * j] = b;
-                    p[4 * j + 1] = g;
-                    p[4 * j + 2] = r;
-                    p[4 * j + 3] = 0xFF;
+                    yy = yuv_mult_hi(Y[i * y_stride + j], 19077);
+                    u = U[(i / 2) * uv_stride + (j / 2)];
+                    v = V[(i / 2) * uv_stride + (j / 2)];
+                    p[4 * j] = yuv_clip8(yy + yuv_mult_hi(u, 33050) - 17685);
+                    p[4 * j + 1] = yuv_clip8(yy - yuv_mult_hi(u, 6419) -
+                                             yuv_mult_hi(v, 13320) + 8708);
+                    p[4 * j + 2] = yuv_clip8(yy + yuv_mult_hi(v, 26149) - 14234);
+                    p[4 * j + 3] = A ? A[i * y_stride + j] : 0xFF;
                 }
                 p += pitch;
             }
@@ -7,9 +7,10 @@ extern "C" {
 #endif
 #include "byteorder.h"
 
+/* aout is an optional alpha plane with y_stride, NULL for opaque output */
 void YUV420_to_BGRA32(uint8_t *ptr, int pitch, uint8_t *yout, uint8_t *uout,
-                      uint8_t *vout, int y_stride, int uv_stride, int mbrows,
-                      int mbcols);
+                      uint8_t *vout, uint8_t *aout, int y_stride,
+                      int uv_stride, int mbrows, int mbcols);
 
 void YUV420_to_BGRA32_16bit(uint8_t *ptr, int pitch, int16_t *yout,
                             int16_t *uout, int16_t *vout, int y_stride,
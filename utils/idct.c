@@ -1,5 +1,6 @@
 #include <stdint.h>
 #include <assert.h>
+#include <string.h>
 
 #include "utils.h"
 #include "idct.h"
@@ -806,6 +807,131 @@ fdct_8x8_8(void *data) {
     }
 }
 
+//------------------------------------------------------------------------------
+// HEVC inverse transforms, see 8.6.4.2
+
+// see 8-314
+const int8_t hevc_idst_matrix[4][4] = {
+    {29, 55, 74, 84},
+    {74, 74, 0, -74},
+    {84, -29, -74, 55},
+    {55, -84, 74, -29}
+};
+
+// see 8-315 to 8-317, the n point transform uses every (32 / n)th row
+const int8_t hevc_idct_matrix[32][32] = {
+    {64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,  64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64},
+    {90, 90, 88, 85, 82, 78, 73, 67, 61, 54, 46, 38, 31, 22, 13,  4,  -4,-13,-22,-31,-38,-46,-54,-61,-67,-73,-78,-82,-85,-88,-90,-90},
+    {90, 87, 80, 70, 57, 43, 25,  9, -9,-25,-43,-57,-70,-80,-87,-90,  -90,-87,-80,-70,-57,-43,-25, -9,  9, 25, 43, 57, 70, 80, 87, 90},
+    {90, 82, 67, 46, 22, -4,-31,-54,-73,-85,-90,-88,-78,-61,-38,-13,  13, 38, 61, 78, 88, 90, 85, 73, 54, 31,  4,-22,-46,-67,-82,-90},
+    {89, 75, 50, 18,-18,-50,-75,-89,-89,-75,-50,-18, 18, 50, 75, 89,  89, 75, 50, 18,-18,-50,-75,-89,-89,-75,-50,-18, 18, 50, 75, 89},
+    {88, 67, 31,-13,-54,-82,-90,-78,-46, -4, 38, 73, 90, 85, 61, 22,  -22,-61,-85,-90,-73,-38,  4, 46, 78, 90, 82, 54, 13,-31,-67,-88},
+    {87, 57,  9,-43,-80,-90,-70,-25, 25, 70, 90, 80, 43, -9,-57,-87,  -87,-57, -9, 43, 80, 90, 70, 25,-25,-70,-90,-80,-43,  9, 57, 87},
+    {85, 46,-13,-67,-90,-73,-22, 38, 82, 88, 54, -4,-61,-90,-78,-31,  31, 78, 90, 61,  4,-54,-88,-82,-38, 22, 73, 90, 67, 13,-46,-85},
+    {83, 36,-36,-83,-83,-36, 36, 83, 83, 36,-36,-83,-83,-36, 36, 83,  83, 36,-36,-83,-83,-36, 36, 83, 83, 36,-36,-83,-83,-36, 36, 83},
+    {82, 22,-54,-90,-61, 13, 78, 85, 31,-46,-90,-67,  4, 73, 88, 38,  -38,-88,-73, -4, 67, 90, 46,-31,-85,-78,-13, 61, 90, 54,-22,-82},
+    {80,  9,-70,-87,-25, 57, 90, 43,-43,-90,-57, 25, 87, 70, -9,-80, -80, -9, 70, 87, 25,-57,-90,-43, 43, 90, 57,-25,-87,-70,  9, 80},
+    {78, -4,-82,-73, 13, 85, 67,-22,-88,-61, 31, 90, 54,-38,-90,-46, 46, 90, 38,-54,-90,-31, 61, 88, 22,-67,-85,-13, 73, 82,  4,-78},
+    {75,-18,-89,-50, 50, 89, 18,-75,-75, 18, 89, 50,-50,-89,-18, 75, 75,-18,-89,-50, 50, 89, 18,-75,-75, 18, 89, 50,-50,-89,-18, 75},
+    {73,-31,-90,-22, 78, 67,-38,-90,-13, 82, 61,-46,-88, -4, 85, 54, -54,-85,  4, 88, 46,-61,-82, 13, 90, 38,-67,-78, 22, 90, 31,-73},
+    {70,-43,-87,  9, 90, 25,-80,-57, 57, 80,-25,-90, -9, 87, 43,-70, -70, 43, 87, -9,-90,-25, 80, 57,-57,-80, 25, 90,  9,-87,-43, 70},
+    {67,-54,-78, 38, 85,-22,-90,  4, 90, 13,-88,-31, 82, 46,-73,-61, 61, 73,-46,-82, 31, 88,-13,-90, -4, 90, 22,-85,-38, 78, 54,-67},
+    {64,-64,-64, 64, 64,-64,-64, 64, 64,-64,-64, 64, 64,-64,-64, 64, 64,-64,-64, 64, 64,-64,-64, 64, 64,-64,-64, 64, 64,-64,-64, 64},
+    {61,-73,-46, 82, 31,-88,-13, 90, -4,-90, 22, 85,-38,-78, 54, 67, -67,-54, 78, 38,-85,-22, 90,  4,-90, 13, 88,-31,-82, 46, 73,-61},
+    {57,-80,-25, 90, -9,-87, 43, 70,-70,-43, 87,  9,-90, 25, 80,-57, -57, 80, 25,-90,  9, 87,-43,-70, 70, 43,-87, -9, 90,-25,-80, 57},
+    {54,-85, -4, 88,-46,-61, 82, 13,-90, 38, 67,-78,-22, 90,-31,-73, 73, 31,-90, 22, 78,-67,-38, 90,-13,-82, 61, 46,-88,  4, 85,-54},
+    {50,-89, 18, 75,-75,-18, 89,-50,-50, 89,-18,-75, 75, 18,-89, 50, 50,-89, 18, 75,-75,-18, 89,-50,-50, 89,-18,-75, 75, 18,-89, 50},
+    {46,-90, 38, 54,-90, 31, 61,-88, 22, 67,-85, 13, 73,-82,  4, 78, -78, -4, 82,-73,-13, 85,-67,-22, 88,-61,-31, 90,-54,-38, 90,-46},
+    {43,-90, 57, 25,-87, 70,  9,-80, 80, -9,-70, 87,-25,-57, 90,-43, -43, 90,-57,-25, 87,-70, -9, 80,-80,  9, 70,-87, 25, 57,-90, 43},
+    {38,-88, 73, -4,-67, 90,-46,-31, 85,-78, 13, 61,-90, 54, 22,-82, 82,-22,-54, 90,-61,-13, 78,-85, 31, 46,-90, 67,  4,-73, 88,-38},
+    {36,-83, 83,-36,-36, 83,-83, 36, 36,-83, 83,-36,-36, 83,-83, 36, 36,-83, 83,-36,-36, 83,-83, 36, 36,-83, 83,-36,-36, 83,-83, 36},
+    {31,-78, 90,-61,  4, 54,-88, 82,-38,-22, 73,-90, 67,-13,-46, 85, -85, 46, 13,-67, 90,-73, 22, 38,-82, 88,-54, -4, 61,-90, 78,-31},
+    {25,-70, 90,-80, 43,  9,-57, 87,-87, 57, -9,-43, 80,-90, 70,-25, -25, 70,-90, 80,-43, -9, 57,-87, 87,-57,  9, 43,-80, 90,-70, 25},
+    {22,-61, 85,-90, 73,-38, -4, 46,-78, 90,-82, 54,-13,-31, 67,-88, 88,-67, 31, 13,-54, 82,-90, 78,-46,  4, 38,-73, 90,-85, 61,-22},
+    {18,-50, 75,-89, 89,-75, 50,-18,-18, 50,-75, 89,-89, 75,-50, 18, 18,-50, 75,-89, 89,-75, 50,-18,-18, 50,-75, 89,-89, 75,-50, 18},
+    {13,-38, 61,-78, 88,-90, 85,-73, 54,-31,  4, 22,-46, 67,-82, 90, -90, 82,-67, 46,-22, -4, 31,-54, 73,-85, 90,-88, 78,-61, 38,-13},
+    {9,-25, 43,-57, 70,-80, 87,-90, 90,-87, 80,-70, 57,-43, 25, -9,  -9, 25,-43, 57,-70, 80,-87, 90,-90, 87,-80, 70,-57, 43,-25,  9},
+    {4,-13, 22,-31, 38,-46, 54,-61, 67,-73, 78,-82, 85,-88, 90,-90,  90,-90, 88,-85, 82,-78, 73,-67, 61,-54, 46,-38, 31,-22, 13, -4}
+};
+
+/* n coefficients in[0], in[stride], ... of which only the first h may be
+ * non-zero
+ */
+static void
+hevc_itrans_1d(const int16_t *in, int stride, int32_t *out, int n, int h,
+               int dst)
+{
+    int step = 32 / n;
+    for (int j = 0; j < n; j++) {
+        int32_t sum = 0;
+        for (int k = 0; k < h; k++) {
+            int c = dst ? hevc_idst_matrix[k][j] : hevc_idct_matrix[k * step][j];
+            sum += c * in[k * stride];
+        }
+        out[j] = sum;
+    }
+}
+
+/* see 8.6.4.1, the columns and then the rows. The intermediate values are
+ * clipped to 16 bits as 8-318 does, the residuals are saturated to 16 bits
+ * too, as the SIMD versions do.
+ */
+static void
+hevc_itrans_c(int16_t *coeffs, int n, int bitdepth, int w, int h, int dst)
+{
+    int bdShift = 20 - bitdepth;
+    int16_t g[32 * 32];
+    int32_t e[32];
+
+    for (int x = 0; x < n; x++) {
+        if (x < w) {
+            hevc_itrans_1d(coeffs + x, n, e, n, h, dst);
+        } else {
+            memset(e, 0, sizeof(e));
+        }
+        for (int y = 0; y < n; y++) {
+            g[x + y * n] = clip3(-32768, 32767, (e[y] + 64) >> 7);
+        }
+    }
+    for (int y = 0; y < n; y++) {
+        hevc_itrans_1d(g + y * n, 1, e, n, w, dst);
+        for (int x = 0; x < n; x++) {
+            coeffs[x + y * n] = clip3(-32768, 32767,
+                                      (e[x] + (1 << (bdShift - 1))) >> bdShift);
+        }
+    }
+}
+
+void
+hevc_idst_4x4_c(int16_t *coeffs, int bitdepth, int w, int h)
+{
+    hevc_itrans_c(coeffs, 4, bitdepth, w, h, 1);
+}
+
+void
+hevc_idct_4x4_c(int16_t *coeffs, int bitdepth, int w, int h)
+{
+    hevc_itrans_c(coeffs, 4, bitdepth, w, h, 0);
+}
+
+void
+hevc_idct_8x8_c(int16_t *coeffs, int bitdepth, int w, int h)
+{
+    hevc_itrans_c(coeffs, 8, bitdepth, w, h, 0);
+}
+
+void
+hevc_idct_16x16_c(int16_t *coeffs, int bitdepth, int w, int h)
+{
+    hevc_itrans_c(coeffs, 16, bitdepth, w, h, 0);
+}
+
+void
+hevc_idct_32x32_c(int16_t *coeffs, int bitdepth, int w, int h)
+{
+    hevc_itrans_c(coeffs, 32, bitdepth, w, h, 0);
+}
+
 enum dct_type {
     DCT_BITLEN_8 = 0,
     DCT_BITLEN_16 = 1,
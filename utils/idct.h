@@ -24,6 +24,20 @@ const struct dct_ops *get_dct_ops(int component_bits);
 
 void idct_4x4_hevc(const int16_t *in, int16_t *out, int bitdepth, bool epp);
 
+/* HEVC inverse transforms of 8.6.4, both stages in place on the n x n scaled
+ * coefficients in raster order. Only the first w columns and h rows may hold
+ * non-zero coefficients. The plain C versions, SIMD ones come through the
+ * hevc slots of accl_ops.
+ */
+extern const int8_t hevc_idst_matrix[4][4];
+extern const int8_t hevc_idct_matrix[32][32];
+
+void hevc_idst_4x4_c(int16_t *coeffs, int bitdepth, int w, int h);
+void hevc_idct_4x4_c(int16_t *coeffs, int bitdepth, int w, int h);
+void hevc_idct_8x8_c(int16_t *coeffs, int bitdepth, int w, int h);
+void hevc_idct_16x16_c(int16_t *coeffs, int bitdepth, int w, int h);
+void hevc_idct_32x32_c(int16_t *coeffs, int bitdepth, int w, int h);
+
 void dct_float(float *data);
 
 #ifdef __cplusplus
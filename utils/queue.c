@@ -2,176 +2,258 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
+#include <time.h>
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 #include "queue.h"
-
-typedef struct {
-    int index;
-    int tag;
-} tagged_index_t;
+#include "utils.h"
+
+static inline void
+ring_relax(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#endif
+}
 
 struct ring_queue *ring_alloc(int size) {
     struct ring_queue *queue;
-    queue = (struct ring_queue *)malloc(sizeof(struct ring_queue));
+    size_t n = 1;
+
+    if (size <= 0) {
+        return NULL;
+    }
+    while (n < (size_t)size) {
+        n <<= 1;
+    }
+    queue = aligned_alloc(RING_CACHE_LINE, sizeof(struct ring_queue));
     if (!queue) {
         return NULL;
     }
-
-    tagged_index_t head = {0, 0};
-    tagged_index_t tail = {0, 0};
-
-    atomic_init(&queue->head, *(uintptr_t *)&head);
-    atomic_init(&queue->tail, *(uintptr_t *)&tail);
-    queue->size = size;
-    queue->queue = (void **)malloc(size * sizeof(void *));
-    if (!queue->queue) {
+    memset(queue, 0, sizeof(struct ring_queue));
+    queue->slots = malloc(n * sizeof(struct ring_slot));
+    if (!queue->slots) {
         free(queue);
         return NULL;
     }
+    for (size_t i = 0; i < n; i++) {
+        atomic_init(&queue->slots[i].seq, i);
+        queue->slots[i].data = NULL;
+    }
+    atomic_init(&queue->head, 0);
+    atomic_init(&queue->tail, 0);
+    atomic_init(&queue->events, 0);
+    atomic_init(&queue->waiters, 0);
+    atomic_init(&queue->closed, false);
+    queue->mask = n - 1;
+    queue->size = n;
 
     return queue;
 }
 
 void ring_free(struct ring_queue *queue) {
     if (queue) {
-        free(queue->queue);
+        free(queue->slots);
         free(queue);
     }
 }
 
-bool ring_enqueue(struct ring_queue *queue, void *data) {
-    uintptr_t head, tail;
-    tagged_index_t *head_ptr, *tail_ptr;
-    tagged_index_t new_tail;
-    int pos;
-
-    do {
-        tail = atomic_load(&queue->tail);
-        tail_ptr = (tagged_index_t *)&tail;
+static void
+ring_wake(struct ring_queue *queue, bool force)
+{
+    // pairs with the fence in ring_dequeue_wait: either the sleeper sees
+    // the published slot on its re-check or we see it counted in waiters,
+    // so with nobody asleep an enqueue never touches the futex word
+    atomic_thread_fence(memory_order_seq_cst);
+    if (!force && atomic_load_explicit(&queue->waiters, memory_order_relaxed) == 0) {
+        return;
+    }
+    atomic_fetch_add_explicit(&queue->events, 1, memory_order_release);
+#ifdef __linux__
+    syscall(SYS_futex, &queue->events, FUTEX_WAKE_PRIVATE, INT32_MAX, NULL,
+            NULL, 0);
+#endif
+}
 
-        head = atomic_load(&queue->head);
-        head_ptr = (tagged_index_t *)&head;
-        int next = (tail_ptr->index + 1) % queue->size;
-        if (next == head_ptr->index)
+bool ring_enqueue(struct ring_queue *queue, void *data) {
+    struct ring_slot *slot;
+    size_t pos = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+
+    while (1) {
+        slot = &queue->slots[pos & queue->mask];
+        size_t seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(
+                    &queue->tail, &pos, pos + 1, memory_order_relaxed,
+                    memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // the slot still holds the data of the previous lap
             return false;
-
-        pos = tail_ptr->index;
-        new_tail.index = next;
-        new_tail.tag = tail_ptr->tag + 1;
-    } while (!atomic_compare_exchange_weak(&queue->tail, &tail,
-                                            *(uintptr_t *)&new_tail));
-
-    queue->queue[pos] = data;
+        } else {
+            pos = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+        }
+    }
+    slot->data = data;
+    atomic_store_explicit(&slot->seq, pos + 1, memory_order_release);
+    ring_wake(queue, false);
     return true;
 }
 
 bool ring_enqueue_bulk(struct ring_queue *queue, void **data, int n) {
-    uintptr_t head, tail;
-    tagged_index_t *head_ptr, *tail_ptr;
-    tagged_index_t new_tail;
-    int pos;
-    int avail;
-    do {
-        tail = atomic_load(&queue->tail);
-        tail_ptr = (tagged_index_t *)&tail;
-
-        head = atomic_load(&queue->head);
-        head_ptr = (tagged_index_t *)&head;
+    size_t pos = atomic_load_explicit(&queue->tail, memory_order_relaxed);
 
-        avail = queue->size -
-                (queue->size + tail_ptr->index - head_ptr->index) % queue->size;
-
-        if (avail < n)
+    if (n <= 0 || n > queue->size) {
+        return n == 0;
+    }
+    do {
+        size_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+        if (pos + n - head > (size_t)queue->size) {
             return false;
-
-        pos = tail_ptr->index;
-        new_tail.index = tail_ptr->index + n;
-        new_tail.tag = tail_ptr->tag + 1;
-    } while (!atomic_compare_exchange_weak(&queue->tail, &tail,
-                                            *(uintptr_t *)&new_tail));
+        }
+    } while (!atomic_compare_exchange_weak_explicit(&queue->tail, &pos, pos + n,
+                                                    memory_order_relaxed,
+                                                    memory_order_relaxed));
 
     for (int i = 0; i < n; i++) {
-        queue->queue[(pos + i) % queue->size] = data[i];
+        struct ring_slot *slot = &queue->slots[(pos + i) & queue->mask];
+        // a consumer may have claimed the slot but not read it yet
+        while (atomic_load_explicit(&slot->seq, memory_order_acquire) != pos + i) {
+            ring_relax();
+        }
+        slot->data = data[i];
+        atomic_store_explicit(&slot->seq, pos + i + 1, memory_order_release);
     }
-
+    ring_wake(queue, false);
     return true;
 }
 
 void *ring_dequeue(struct ring_queue *queue) {
-    uintptr_t head, tail;
-    tagged_index_t *head_ptr, *tail_ptr;
-    tagged_index_t new_head;
-    void *data = NULL;
-    int pos;
-
-    do {
-        tail = atomic_load(&queue->tail);
-        tail_ptr = (tagged_index_t *)&tail;
-        head = atomic_load(&queue->head);
-        head_ptr = (tagged_index_t *)&head;
-
-        if (head_ptr->index == tail_ptr->index) {
+    struct ring_slot *slot;
+    size_t pos = atomic_load_explicit(&queue->head, memory_order_relaxed);
+
+    while (1) {
+        slot = &queue->slots[pos & queue->mask];
+        size_t seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(
+                    &queue->head, &pos, pos + 1, memory_order_relaxed,
+                    memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
             return NULL;
+        } else {
+            pos = atomic_load_explicit(&queue->head, memory_order_relaxed);
         }
-
-        pos = head_ptr->index;
-        new_head.index = (head_ptr->index + 1) % queue->size;
-        new_head.tag = head_ptr->tag + 1;
-
-    } while (!atomic_compare_exchange_weak(&queue->head, &head,
-                                            *(uintptr_t *)&new_head));
-
-    data = queue->queue[pos];
+    }
+    void *data = slot->data;
+    atomic_store_explicit(&slot->seq, pos + queue->mask + 1,
+                          memory_order_release);
     return data;
 }
 
 int ring_dequeue_bulk(struct ring_queue *queue, void **data, int n) {
-    uintptr_t head, tail;
-    tagged_index_t *head_ptr, *tail_ptr;
-    tagged_index_t new_head;
-    int inuse = 0;
-    int pos;
+    size_t pos = atomic_load_explicit(&queue->head, memory_order_relaxed);
 
+    if (n <= 0) {
+        return 0;
+    }
     do {
-        tail = atomic_load(&queue->tail);
-        tail_ptr = (tagged_index_t *)&tail;
-        head = atomic_load(&queue->head);
-        head_ptr = (tagged_index_t *)&head;
-
-        if (head_ptr->index == tail_ptr->index) {
+        size_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+        if (tail - pos < (size_t)n || tail < pos) {
             return 0;
         }
+    } while (!atomic_compare_exchange_weak_explicit(&queue->head, &pos, pos + n,
+                                                    memory_order_relaxed,
+                                                    memory_order_relaxed));
 
-        inuse = (queue->size + tail_ptr->index - head_ptr->index) % queue->size;
-        if (inuse < n) {
-        return 0;
+    for (int i = 0; i < n; i++) {
+        struct ring_slot *slot = &queue->slots[(pos + i) & queue->mask];
+        // a producer may have claimed the slot but not written it yet
+        while (atomic_load_explicit(&slot->seq, memory_order_acquire) !=
+               pos + i + 1) {
+            ring_relax();
         }
-        pos = head_ptr->index;
-        new_head.index = (head_ptr->index + n) % queue->size;
-        new_head.tag = head_ptr->tag + 1;
+        data[i] = slot->data;
+        atomic_store_explicit(&slot->seq, pos + i + queue->mask + 1,
+                              memory_order_release);
+    }
+    return n;
+}
+
+static long
+ring_now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
 
-    } while (!atomic_compare_exchange_weak(&queue->head, &head,
-                                            *(uintptr_t *)&new_head));
+void *ring_dequeue_wait(struct ring_queue *queue, int timeout_ms) {
+    long deadline = (timeout_ms >= 0) ? ring_now_ms() + timeout_ms : 0;
 
-    for (int i = 0; i < n; i++) {
-        data[i] = queue->queue[(pos + i) % queue->size];
+    while (1) {
+        void *data = ring_dequeue(queue);
+        if (data) {
+            return data;
+        }
+        if (atomic_load(&queue->closed)) {
+            // a producer may have slipped one in before closing
+            return ring_dequeue(queue);
+        }
+        long left = 1;
+        if (timeout_ms >= 0) {
+            left = deadline - ring_now_ms();
+            if (left <= 0) {
+                return NULL;
+            }
+        }
+        atomic_fetch_add(&queue->waiters, 1);
+        atomic_thread_fence(memory_order_seq_cst);
+        unsigned ev = atomic_load_explicit(&queue->events, memory_order_acquire);
+        // a producer that saw no waiters published before the fence above
+        data = ring_dequeue(queue);
+        if (data || atomic_load(&queue->closed)) {
+            atomic_fetch_sub(&queue->waiters, 1);
+            if (data) {
+                return data;
+            }
+            continue;
+        }
+#ifdef __linux__
+        struct timespec ts = {left / 1000, (left % 1000) * 1000000};
+        // returns at once if a producer bumped events after the load above
+        syscall(SYS_futex, &queue->events, FUTEX_WAIT_PRIVATE, ev,
+                (timeout_ms >= 0) ? &ts : NULL, NULL, 0);
+#else
+        (void)ev;
+        struct timespec ts = {0, 1000000};
+        nanosleep(&ts, NULL);
+#endif
+        atomic_fetch_sub(&queue->waiters, 1);
     }
+}
 
-    return n;
+void ring_close(struct ring_queue *queue) {
+    atomic_store(&queue->closed, true);
+    ring_wake(queue, true);
 }
 
 int ring_count(struct ring_queue *queue) {
-    uintptr_t tail, head;
-    tagged_index_t *head_ptr, *tail_ptr;
-    int size = 0;
+    size_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
 
-    do {
-        tail = atomic_load(&queue->tail);
-        tail_ptr = (tagged_index_t *)&tail;
-        head = atomic_load(&queue->head);
-        head_ptr = (tagged_index_t *)&head;
-        size = (queue->size + tail_ptr->index - head_ptr->index) % queue->size;
-    } while (atomic_load(&queue->tail) != tail);
-
-    return size;
+    if (tail < head) {
+        // head moved on after it was loaded
+        return 0;
+    }
+    return MIN(tail - head, (size_t)queue->size);
 }
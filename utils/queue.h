@@ -1,22 +1,40 @@
 #ifndef __QUEUE_H__
 #define __QUEUE_H__
 
+#include <stdalign.h>
 #include <stdatomic.h>
 #include <stdbool.h>
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+#define RING_CACHE_LINE (64)
+
+/* a slot is free for position pos when seq == pos, and holds the data of
+ * position pos when seq == pos + 1 */
+struct ring_slot {
+    atomic_size_t seq;
+    void *data;
+};
+
+/* bounded MPMC ring with a sequence number per slot, producers and consumers
+ * only meet on the slots, head and tail stay on their own cache lines */
 struct ring_queue {
-    atomic_uintptr_t head;
-    atomic_uintptr_t tail;
+    alignas(RING_CACHE_LINE) atomic_size_t tail;
+    alignas(RING_CACHE_LINE) atomic_size_t head;
+    alignas(RING_CACHE_LINE) atomic_uint events;  // futex word, bumped by producers with sleepers
+    atomic_int waiters;
+    atomic_bool closed;
+    size_t mask;
     int size;
-    void **queue;
+    struct ring_slot *slots;
 };
 
 /**
- * It allocates a ring buffer of size `size` and returns a pointer to it.
+ * It allocates a ring buffer which holds at least `size` entries, the size is
+ * rounded up to a power of two.
  *
  * @param size The size of the ring buffer.
  *
@@ -25,63 +43,55 @@ struct ring_queue {
 struct ring_queue *ring_alloc(int size);
 
 /**
- * "If the queue is not empty, then remove the first element from the queue and
- * return it."
- *
- * The first thing we do is check to see if the queue is empty. If it is, then
- * we return NULL
+ * It frees the ring buffer, the entries left in it are not touched.
  *
  * @param queue The queue to free.
  */
 void ring_free(struct ring_queue *queue);
 
 /**
- * "Try to increment the tail pointer, and if successful, write the data to the
- * queue."
+ * Claim the slot at the tail and write the data to it.
  *
- * The first thing we do is load the tail pointer. We then load the head
- * pointer. We check if the queue is full by comparing the next index of the
- * tail pointer to the head pointer. If the queue is full, we return false
+ * The slot at the tail is free when its sequence equals the tail position,
+ * the tail is moved on by CAS and the sequence is published after the data
+ * is written, so a consumer never sees a half written slot.
  *
  * @param queue The ring queue to enqueue to.
  * @param data The data to be enqueued.
  *
- * @return A pointer to the data that was dequeued.
+ * @return false if the queue is full.
  */
 bool ring_enqueue(struct ring_queue *queue, void *data);
 
 /**
- * It tries to enqueue a bunch of items, and if it can't, it returns false
+ * It enqueues all the n items or none of them.
  *
  * @param queue the ring queue
  * @param data the array of data to be enqueued
  * @param n the number of items to enqueue
  *
- * @return A boolean value.
+ * @return false if there is not room for n items.
  */
 bool ring_enqueue_bulk(struct ring_queue *queue, void **data, int n);
 
 /**
- * "If the queue is not empty, remove the first element from the queue and
- * return it."
+ * Claim the slot at the head and take the data from it.
  *
- * The first thing we do is load the head and tail pointers. We then check if
- * the queue is empty. If it is, we return NULL. If it isn't, we increment the
- * head pointer and store it back in the queue. We then return the data at the
- * old head position
+ * The slot at the head is full when its sequence is one past the head
+ * position, after reading the data the sequence is set to the position of
+ * the next lap so the slot is free for producers again.
  *
  * @param queue The queue to dequeue from.
  *
- * @return A pointer to the data at the head of the queue.
+ * @return A pointer to the data at the head of the queue, NULL if empty.
  */
 void *ring_dequeue(struct ring_queue *queue);
 
 /**
- * It tries to dequeue n items from the queue, and returns the number of items
- * actually dequeued
+ * It dequeues all the n items or none of them.
  *
  * @param queue the ring queue
- * @param data the array of data to be enqueued
+ * @param data the array for the dequeued items
  * @param n the number of elements to dequeue
  *
  * @return The number of items dequeued, return n or 0.
@@ -89,9 +99,27 @@ void *ring_dequeue(struct ring_queue *queue);
 int ring_dequeue_bulk(struct ring_queue *queue, void **data, int n);
 
 /**
- * > If the tail and head pointers are the same, then the queue is empty.
- * Otherwise, the queue size is the difference between the tail and head
- * pointers, modulo the queue size
+ * Like ring_dequeue, but sleeps until an item comes in.
+ *
+ * The wait is a futex on Linux and a short sleep elsewhere.
+ *
+ * @param queue The queue to dequeue from.
+ * @param timeout_ms How long to wait at most, negative to wait forever.
+ *
+ * @return The data, NULL on timeout or once the queue is closed and empty.
+ */
+void *ring_dequeue_wait(struct ring_queue *queue, int timeout_ms);
+
+/**
+ * No more items will come, wake up all the waiting consumers.
+ *
+ * @param queue The queue to close.
+ */
+void ring_close(struct ring_queue *queue);
+
+/**
+ * The queue size is the difference between the tail and head positions, it
+ * is only a snapshot when others are working on the queue.
  *
  * @param queue The queue to count the number of elements in.
  *